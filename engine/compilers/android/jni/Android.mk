@@ -170,6 +170,7 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../lib/lpng/pngwutil.c \
 					../../../source/2d/assets/AnimationAsset.cc \
 					../../../source/2d/assets/ImageAsset.cc \
+					../../../source/2d/assets/ImageAtlas.cc \
 					../../../source/2d/assets/ParticleAsset.cc \
 					../../../source/2d/assets/ParticleAssetEmitter.cc \
 					../../../source/2d/assets/ParticleAssetField.cc \
@@ -179,7 +180,9 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/2d/controllers/BuoyancyController.cc \
 					../../../source/2d/controllers/core/GroupedSceneController.cc \
 					../../../source/2d/controllers/core/PickingSceneController.cc \
+					../../../source/2d/controllers/core/SceneController.cc \
 					../../../source/2d/controllers/PointForceController.cc \
+					../../../source/2d/core/AnimationClock.cc \
 					../../../source/2d/core/BatchRender.cc \
 					../../../source/2d/core/CoreMath.cc \
 					../../../source/2d/core/ImageFrameProvider.cc \
@@ -197,6 +200,7 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/2d/gui/guiSceneObjectCtrl.cc \
 					../../../source/2d/gui/guiSpriteCtrl.cc \
 					../../../source/2d/gui/SceneWindow.cc \
+					../../../source/2d/sceneobject/AudioEmitter.cc \
 					../../../source/2d/sceneobject/CompositeSprite.cc \
 					../../../source/2d/sceneobject/ImageFont.cc \
 					../../../source/2d/sceneobject/ParticlePlayer.cc \
@@ -211,8 +215,13 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/2d/scene/ContactFilter.cc \
 					../../../source/2d/scene/DebugDraw.cc \
 					../../../source/2d/scene/Scene.cc \
+					../../../source/2d/scene/SceneCallbackQueue.cc \
+					../../../source/2d/scene/ScenePool.cc \
 					../../../source/2d/scene/SceneRenderFactories.cpp \
 					../../../source/2d/scene/SceneRenderQueue.cpp \
+					../../../source/2d/scene/SceneScheduler.cc \
+					../../../source/2d/scene/SceneTransformHistory.cc \
+					../../../source/2d/scene/SceneTransformStore.cc \
 					../../../source/2d/scene/WorldQuery.cc \
 					../../../source/algorithm/crc.cc \
 					../../../source/algorithm/hashFunction.cc \
@@ -220,6 +229,7 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/assets/assetFieldTypes.cc \
 					../../../source/assets/assetManager.cc \
 					../../../source/assets/assetQuery.cc \
+					../../../source/assets/assetScanCache.cc \
 					../../../source/assets/assetTagsManifest.cc \
 					../../../source/assets/declaredAssets.cc \
 					../../../source/assets/referencedAssets.cc \
@@ -231,11 +241,13 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/Box2D/Collision/b2Collision.cpp \
 					../../../source/Box2D/Collision/b2Distance.cpp \
 					../../../source/Box2D/Collision/b2DynamicTree.cpp \
+					../../../source/Box2D/Collision/b2SpatialHash.cpp \
 					../../../source/Box2D/Collision/b2TimeOfImpact.cpp \
 					../../../source/Box2D/Collision/Shapes/b2ChainShape.cpp \
 					../../../source/Box2D/Collision/Shapes/b2CircleShape.cpp \
 					../../../source/Box2D/Collision/Shapes/b2EdgeShape.cpp \
 					../../../source/Box2D/Collision/Shapes/b2PolygonShape.cpp \
+					../../../source/Box2D/Common/b2ArenaAllocator.cpp \
 					../../../source/Box2D/Common/b2BlockAllocator.cpp \
 					../../../source/Box2D/Common/b2Draw.cpp \
 					../../../source/Box2D/Common/b2Math.cpp \
@@ -278,23 +290,31 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/console/consoleBaseType.cc \
 					../../../source/console/consoleDictionary.cc \
 					../../../source/console/consoleExprEvalState.cc \
+					../../../source/console/consoleLogWriter.cc \
 					../../../source/console/consoleNamespace.cc \
+					../../../source/console/consoleTypedBinding.cc \
 					../../../source/console/ConsoleTypeValidators.cc \
 					../../../source/console/metaScripting_ScriptBinding.cc \
+					../../../source/debug/frameStats.cc \
+					../../../source/debug/gpuTimer.cc \
 					../../../source/debug/profiler.cc \
 					../../../source/debug/remote/RemoteDebugger1.cc \
 					../../../source/debug/remote/RemoteDebuggerBase.cc \
 					../../../source/debug/remote/RemoteDebuggerBridge.cc \
+					../../../source/debug/scriptProfiler.cc \
 					../../../source/debug/telnetDebugger.cc \
 					../../../source/delegates/delegateSignal.cpp \
 					../../../source/game/defaultGame.cc \
 					../../../source/game/gameInterface.cc \
 					../../../source/graphics/bitmapBmp.cc \
+					../../../source/graphics/bitmapCompressed.cc \
+					../../../source/graphics/bitmapDistanceField.cc \
 					../../../source/graphics/bitmapJpeg.cc \
 					../../../source/graphics/bitmapPng.cc \
 					../../../source/graphics/color.cc \
 					../../../source/graphics/dgl.cc \
 					../../../source/graphics/dglMatrix.cc \
+					../../../source/graphics/dglState.cc \
 					../../../source/graphics/DynamicTexture.cc \
 					../../../source/graphics/gBitmap.cc \
 					../../../source/graphics/gFont.cc \
@@ -340,15 +360,20 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/gui/language/lang.cc \
 					../../../source/gui/messageVector.cc \
 					../../../source/input/actionMap.cc \
+					../../../source/io/asyncFileIO.cc \
 					../../../source/io/bitStream.cc \
 					../../../source/io/bufferStream.cc \
+					../../../source/io/directoryScanCache.cc \
 					../../../source/io/fileObject.cc \
+					../../../source/io/filePrefetch.cc \
 					../../../source/io/fileStream.cc \
 					../../../source/io/fileStreamObject.cc \
 					../../../source/io/fileSystem_ScriptBinding.cc \
+					../../../source/io/fileWatcher.cc \
 					../../../source/io/filterStream.cc \
 					../../../source/io/memStream.cc \
 					../../../source/io/nStream.cc \
+					../../../source/io/packFile.cc \
 					../../../source/io/resizeStream.cc \
 					../../../source/io/resource/resourceDictionary.cc \
 					../../../source/io/resource/resourceManager.cc \
@@ -364,8 +389,12 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/io/zip/zipObject.cc \
 					../../../source/io/zip/zipSubStream.cc \
 					../../../source/io/zip/zipTempStream.cc \
+					../../../source/math/mMathAVX2.cc \
+					../../../source/math/mMathVerify.cc \
 					../../../source/math/rectClipper.cpp \
 					../../../source/memory/dataChunker.cc \
+					../../../source/memory/factoryCache.cc \
+					../../../source/memory/frameAllocator.cc \
 					../../../source/memory/frameAllocator_ScriptBinding.cc \
 					../../../source/messaging/dispatcher.cc \
 					../../../source/messaging/eventManager.cc \
@@ -378,9 +407,12 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/network/connectionProtocol.cc \
 					../../../source/network/connectionStringTable.cc \
 					../../../source/network/httpObject.cc \
+					../../../source/network/httpRequest.cc \
+					../../../source/network/netBenchmark.cc \
 					../../../source/network/netConnection.cc \
 					../../../source/network/netDownload.cc \
 					../../../source/network/netEvent.cc \
+					../../../source/network/netFieldTable.cc \
 					../../../source/network/netGhost.cc \
 					../../../source/network/netInterface.cc \
 					../../../source/network/netObject.cc \
@@ -391,6 +423,7 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/network/serverQuery.cc \
 					../../../source/network/tcpObject.cc \
 					../../../source/network/telnetConsole.cc \
+					../../../source/persistence/taml/binary/tamlBinaryParser.cc \
 					../../../source/persistence/taml/binary/tamlBinaryReader.cc \
 					../../../source/persistence/taml/binary/tamlBinaryWriter.cc \
 					../../../source/persistence/taml/json/tamlJSONParser.cc \
@@ -398,9 +431,11 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/persistence/taml/json/tamlJSONWriter.cc \
 					../../../source/persistence/taml/taml.cc \
 					../../../source/persistence/taml/tamlCustom.cc \
+					../../../source/persistence/taml/tamlTemplates.cc \
 					../../../source/persistence/taml/tamlWriteNode.cc \
 					../../../source/persistence/taml/xml/tamlXmlParser.cc \
 					../../../source/persistence/taml/xml/tamlXmlReader.cc \
+					../../../source/persistence/taml/xml/tamlXmlTokenizer.cc \
 					../../../source/persistence/taml/xml/tamlXmlWriter.cc \
 					../../../source/persistence/tinyXML/tinystr.cpp \
 					../../../source/persistence/tinyXML/tinyxml.cpp \
@@ -411,12 +446,14 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/audio/audioDataBlock.cc \
 					../../../source/audio/audio_ScriptBinding.cc \
 					../../../source/audio/audioStreamSourceFactory.cc \
+					../../../source/audio/imaAdpcm.cc \
 					../../../source/audio/wavStreamSource.cc \
 					../../../source/component/dynamicConsoleMethodComponent.cpp \
 					../../../source/component/simComponent.cpp \
 					../../../source/component/behaviors/behaviorComponent.cpp \
 					../../../source/component/behaviors/behaviorInstance.cpp \
 					../../../source/component/behaviors/behaviorTemplate.cpp \
+					../../../source/component/behaviors/nativeBehaviorTemplate.cpp \
 					../../../source/console/astAlloc.cc \
 					../../../source/console/astNodes.cc \
 					../../../source/console/cmdgram.cc \
@@ -441,6 +478,7 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/math/mMathAltivec.cc \
 					../../../source/math/mMathAMD.cc \
 					../../../source/math/mMathFn.cc \
+					../../../source/math/mMathNEON.cc \
 					../../../source/math/mMathSSE.cc \
 					../../../source/math/mMatrix.cc \
 					../../../source/math/mPlaneTransformer.cc \
@@ -463,6 +501,8 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/platform/platformString.cc \
 					../../../source/platform/platformVideo.cc \
 					../../../source/platform/platformNetAsync.unix.cc \
+					../../../source/platform/threads/jobSystem.cc \
+					../../../source/platform/threads/threadPool.cc \
 					../../../source/platform/menus/popupMenu.cc \
 					../../../source/platform/nativeDialogs/msgBox.cpp \
 					../../../source/platform/Tickable.cc \
@@ -567,6 +607,11 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/gui/editor/guiInspectorTypes.cc \
 					../../../source/gui/editor/guiMenuBar.cc \
 					../../../source/gui/editor/guiSeparatorCtrl.cc 
+#					../../../source/testing/benchmarks/coreBenchmarks.cc \
+#					../../../source/testing/benchmarks/consoleBenchmarks.cc \
+#					../../../source/testing/benchmarks/sceneBenchmarks.cc \
+#					../../../source/testing/benchmarks/streamBenchmarks.cc \
+#					../../../source/testing/benchmarking.cc \
 #					../../../source/testing/tests/platformFileIoTests.cc \
 #					../../../source/testing/tests/platformMemoryTests.cc \
 #					../../../source/testing/tests/platformStringTests.cc \
@@ -577,6 +622,9 @@ ifeq ($(APP_OPTIM),debug)
 else
 	LOCAL_CFLAGS := -DENABLE_CONSOLE_MSGS -D__ANDROID__ -DTORQUE_OS_ANDROID -DGL_GLEXT_PROTOTYPES -O3 -fsigned-char   
 endif				   
+ifdef TORQUE_PHYSICS_DETERMINISTIC
+	LOCAL_CFLAGS += -DTORQUE_PHYSICS_DETERMINISTIC -ffp-contract=off
+endif
 LOCAL_LDLIBS    := -llog -landroid -lEGL -lGLESv1_CM -lz -lOpenSLES -L../../../lib/openal/Android/$(TARGET_ARCH_ABI)
 LOCAL_STATIC_LIBRARIES := android_native_app_glue freetype-prebuilt
 LOCAL_SHARED_LIBRARIES := libopenal-prebuilt
@@ -82,6 +82,7 @@ IMPLEMENT_CONOBJECT(AnimationAsset);
 AnimationAsset::AnimationAsset() :  mAnimationTime(1.0f),
                                     mAnimationCycle(true),
                                     mRandomStart(false),
+                                    mSharedClock(false),
                                     mAnimationIntegration(0.0f),
                                     mNamedCellsMode(false)
 {
@@ -110,6 +111,7 @@ void AnimationAsset::initPersistFields()
     addProtectedField("AnimationTime", TypeF32, Offset(mAnimationTime, AnimationAsset), &setAnimationTime, &defaultProtectedGetFn, &defaultProtectedWriteFn, "");
     addProtectedField("AnimationCycle", TypeBool, Offset(mAnimationCycle, AnimationAsset), &setAnimationCycle, &defaultProtectedGetFn, &writeAnimationCycle, "");
     addProtectedField("RandomStart", TypeBool, Offset(mRandomStart, AnimationAsset), &setRandomStart, &defaultProtectedGetFn, &writeRandomStart, "");
+    addProtectedField("SharedClock", TypeBool, Offset(mSharedClock, AnimationAsset), &setSharedClock, &defaultProtectedGetFn, &writeSharedClock, "");
     addProtectedField("NamedCellsMode", TypeBool, Offset(mNamedCellsMode, AnimationAsset), &setNamedCellsMode, &defaultProtectedGetFn, &writeNamedCellsMode, "");
 }
 
@@ -170,6 +172,7 @@ void AnimationAsset::copyTo(SimObject* object)
     pAsset->setAnimationTime( getAnimationTime() );
     pAsset->setAnimationCycle( getAnimationCycle() );
     pAsset->setRandomStart( getRandomStart() );
+    pAsset->setSharedClock( getSharedClock() );
     pAsset->setNamedCellsMode( getNamedCellsMode() );
 }
 
@@ -293,6 +296,21 @@ void AnimationAsset::setRandomStart( const bool randomStart )
 
 //------------------------------------------------------------------------------
 
+void AnimationAsset::setSharedClock( const bool sharedClock )
+{
+    // Ignore no change.
+    if ( sharedClock == mSharedClock )
+        return;
+
+    // Update.
+    mSharedClock = sharedClock;
+
+    // Refresh the asset.
+    refreshAsset();
+}
+
+//------------------------------------------------------------------------------
+
 void AnimationAsset::setNamedCellsMode( const bool namedCellsMode )
 {
     // Ignore no change.
@@ -50,6 +50,7 @@ private:
     F32                      mAnimationTime;
     bool                     mAnimationCycle;
     bool                     mRandomStart;
+    bool                     mSharedClock;
 
     F32                      mAnimationIntegration;
 
@@ -81,6 +82,8 @@ public:
     inline bool     getAnimationCycle( void ) const                     { return mAnimationCycle; }
     void            setRandomStart( const bool randomStart );
     inline bool     getRandomStart( void ) const                        { return mRandomStart; }
+    void            setSharedClock( const bool sharedClock );
+    inline bool     getSharedClock( void ) const                        { return mSharedClock; }
     void            setNamedCellsMode( const bool namedCellsMode );
     inline bool     getNamedCellsMode( void ) const                     { return mNamedCellsMode; }
 
@@ -111,6 +114,8 @@ protected:
     static bool writeAnimationCycle( void* obj, StringTableEntry pFieldName )       { return static_cast<AnimationAsset*>(obj)->getAnimationCycle() == false; }
     static bool setRandomStart( void* obj, const char* data )                       { static_cast<AnimationAsset*>(obj)->setRandomStart( dAtob(data) ); return false; }
     static bool writeRandomStart( void* obj, StringTableEntry pFieldName )          { return static_cast<AnimationAsset*>(obj)->getRandomStart() == true; }
+    static bool setSharedClock( void* obj, const char* data )                       { static_cast<AnimationAsset*>(obj)->setSharedClock( dAtob(data) ); return false; }
+    static bool writeSharedClock( void* obj, StringTableEntry pFieldName )          { return static_cast<AnimationAsset*>(obj)->getSharedClock() == true; }
     static bool setNamedCellsMode( void* obj, const char* data )                    { static_cast<AnimationAsset*>(obj)->setNamedCellsMode( dAtob(data) ); return false; }
     static bool writeNamedCellsMode( void* obj, StringTableEntry pFieldName )       { return static_cast<AnimationAsset*>(obj)->getNamedCellsMode() == true; }
 };
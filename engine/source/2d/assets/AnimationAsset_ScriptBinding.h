@@ -257,6 +257,29 @@ ConsoleMethodWithDocs(AnimationAsset, getAnimationCycle, ConsoleBool, 2, 2, ())
 
 //-----------------------------------------------------------------------------
 
+/*! Sets whether providers playing the animation share a single animation clock.
+    When on, looping animations that do not use a random start are stepped once per tick for
+    each time-scale and every provider playing them shows the same frame.
+    @param sharedClock Whether providers share a single animation clock or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(AnimationAsset, setSharedClock, ConsoleVoid, 3, 3, (bool sharedClock))
+{
+    object->setSharedClock( dAtob(argv[2] ) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether providers playing the animation share a single animation clock.
+    @return Whether providers playing the animation share a single animation clock.
+*/
+ConsoleMethodWithDocs(AnimationAsset, getSharedClock, ConsoleBool, 2, 2, ())
+{
+    return object->getSharedClock();
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Sets whether the animation uses names for cells, instead of numerical index.
     @param namedCellsMode True if it should be using named cells.
     @return No return value.
@@ -52,6 +52,14 @@
 #include "2d/assets/ImageAsset.h"
 #endif
 
+#ifndef _IMAGE_ATLAS_H_
+#include "2d/assets/ImageAtlas.h"
+#endif
+
+#ifndef _ASSET_MANAGER_H_
+#include "assets/assetManager.h"
+#endif
+
 // Script bindings.
 #include "ImageAsset_ScriptBinding.h"
 
@@ -60,6 +68,11 @@
 
 //------------------------------------------------------------------------------
 
+/// Texels either side of an edge encoded in a distance-field image.
+#define IMAGE_ASSET_DISTANCE_FIELD_SPREAD   8
+
+//------------------------------------------------------------------------------
+
 ImageAsset::FrameArea BadFrameArea(0, 0, 0, 0, 0.0f, 0.0f);
 
 //------------------------------------------------------------------------------
@@ -123,6 +136,7 @@ static EnumTable::Enums textureFilterLookup[] =
                 {
                 { ImageAsset::FILTER_NEAREST,     "NEAREST"     },
                 { ImageAsset::FILTER_BILINEAR,    "BILINEAR"    },
+                { ImageAsset::FILTER_TRILINEAR,   "TRILINEAR"   },
                 };
 
 EnumTable textureFilterTable(sizeof(textureFilterLookup) / sizeof(EnumTable::Enums), &textureFilterLookup[0]);
@@ -162,6 +176,9 @@ const char* ImageAsset::getFilterModeDescription( ImageAsset::TextureFilterMode
 ImageAsset::ImageAsset() :  mImageFile(StringTable->EmptyString),
                             mForce16Bit(false),
                             mLocalFilterMode(FILTER_INVALID),
+                            mMipStreaming(false),
+                            mCritical(false),
+                            mDistanceField(false),
                             mExplicitMode(false),
                             mCellRowOrder(true),
                             mCellOffsetX(0),
@@ -173,7 +190,12 @@ ImageAsset::ImageAsset() :  mImageFile(StringTable->EmptyString),
                             mCellWidth(0),
                             mCellHeight(0),
 
-                            mImageTextureHandle(NULL)
+                            mImageTextureHandle(NULL),
+                            mImageWidth(0),
+                            mImageHeight(0),
+
+                            mAtlasName(StringTable->EmptyString),
+                            mAtlasOffset(0, 0)
 {
     // Set Vector Associations.
     VECTOR_SET_ASSOCIATION( mFrames );
@@ -197,6 +219,9 @@ void ImageAsset::initPersistFields()
     addProtectedField("ImageFile", TypeAssetLooseFilePath, Offset(mImageFile, ImageAsset), &setImageFile, &getImageFile, &defaultProtectedWriteFn, "");
     addProtectedField("Force16bit", TypeBool, Offset(mForce16Bit, ImageAsset), &setForce16Bit, &defaultProtectedGetFn, &writeForce16Bit, "");
     addProtectedField("FilterMode", TypeEnum, Offset(mLocalFilterMode, ImageAsset), &setFilterMode, &defaultProtectedGetFn, &writeFilterMode, 1, &textureFilterTable);   
+    addProtectedField("MipStreaming", TypeBool, Offset(mMipStreaming, ImageAsset), &setMipStreaming, &defaultProtectedGetFn, &writeMipStreaming, "");
+    addProtectedField("Critical", TypeBool, Offset(mCritical, ImageAsset), &setCritical, &defaultProtectedGetFn, &writeCritical, "");
+    addProtectedField("DistanceField", TypeBool, Offset(mDistanceField, ImageAsset), &setDistanceField, &defaultProtectedGetFn, &writeDistanceField, "");
     addProtectedField("ExplicitMode", TypeBool, Offset(mExplicitMode, ImageAsset), &setExplicitMode, &defaultProtectedGetFn, &defaultProtectedNotWriteFn, "");
 
     addProtectedField("CellRowOrder", TypeBool, Offset(mCellRowOrder, ImageAsset), &setCellRowOrder, &defaultProtectedGetFn, &writeCellRowOrder, "");
@@ -225,6 +250,13 @@ bool ImageAsset::onAdd()
 
 void ImageAsset::onRemove()
 {
+    // Release any atlas area.
+    if ( getAtlased() )
+    {
+        ImageAtlas::release( getAssetId() );
+        mAtlasName = StringTable->EmptyString;
+    }
+
     // Call Parent.
     Parent::onRemove();
 }
@@ -267,6 +299,9 @@ void ImageAsset::copyTo(SimObject* object)
     pAsset->setImageFile( getImageFile() );
     pAsset->setForce16Bit( getForce16Bit() );
     pAsset->setFilterMode( getFilterMode() );
+    pAsset->setMipStreaming( getMipStreaming() );
+    pAsset->setCritical( getCritical() );
+    pAsset->setDistanceField( getDistanceField() );
     pAsset->setExplicitMode( getExplicitMode() );
     pAsset->setCellRowOrder( getCellRowOrder() );
     pAsset->setCellOffsetX( getCellCountX() );
@@ -341,6 +376,52 @@ void ImageAsset::setFilterMode( const ImageAsset::TextureFilterMode filterMode )
 
 //------------------------------------------------------------------------------
 
+void ImageAsset::setMipStreaming( const bool mipStreaming )
+{
+    // Ignore no change,
+    if ( mipStreaming == mMipStreaming )
+        return;
+
+    // Update.
+    mMipStreaming = mipStreaming;
+
+    // Refresh the asset.
+    refreshAsset();
+}
+
+//------------------------------------------------------------------------------
+
+void ImageAsset::setCritical( const bool critical )
+{
+    // Ignore no change,
+    if ( critical == mCritical )
+        return;
+
+    // Update.
+    mCritical = critical;
+
+    // Apply to any texture without refreshing the asset.
+    if ( !mImageTextureHandle.IsNull() )
+        mImageTextureHandle.setCritical( mCritical );
+}
+
+//------------------------------------------------------------------------------
+
+void ImageAsset::setDistanceField( const bool distanceField )
+{
+    // Ignore no change,
+    if ( distanceField == mDistanceField )
+        return;
+
+    // Update.
+    mDistanceField = distanceField;
+
+    // Refresh the asset.
+    refreshAsset();
+}
+
+//------------------------------------------------------------------------------
+
 void ImageAsset::setExplicitMode( const bool explicitMode )
 {
     // Ignore no change,
@@ -1050,6 +1131,13 @@ void ImageAsset::setTextureFilter( const TextureFilterMode filterMode )
 
         } break;
 
+        // Trilinear ("smooth" blended between mip levels).
+        case FILTER_TRILINEAR:
+        {
+            glFilterMode = GL_LINEAR_MIPMAP_LINEAR;
+
+        } break;
+
         // Huh?
         default:
             // Oh well...
@@ -1121,13 +1209,58 @@ void ImageAsset::calculateImage( void )
     // Clear frames.
     mFrames.clear();
 
-    // If we have an existing texture and we're setting to the same bitmap then force the texture manager
-    // to refresh the texture itself.
-    if ( !mImageTextureHandle.IsNull() && dStricmp(mImageTextureHandle.getTextureKey(), mImageFile) == 0 )
-        TextureManager::refresh( mImageFile );
+    // A headless server never renders so only needs the image dimensions to calculate the frames.
+    if ( Platform::isHeadless() )
+    {
+        U32 imageWidth;
+        U32 imageHeight;
+        if ( !TextureManager::loadBitmapSize( mImageFile, imageWidth, imageHeight ) )
+        {
+            // Warn.
+            mImageWidth = mImageHeight = 0;
+            Con::warnf( "Image '%s' could not read the size of image '%s'.", getAssetId(), mImageFile );
+            return;
+        }
+
+        mImageWidth = (S32)imageWidth;
+        mImageHeight = (S32)imageHeight;
+
+        // Calculate according to mode.
+        if ( mExplicitMode )
+            calculateExplicitMode();
+        else
+            calculateImplicitMode();
+
+        return;
+    }
+
+    // Pack into an atlas if tagged or convert to a distance field if requested otherwise use the image texture.
+    if ( !calculateAtlasImage() && !calculateDistanceFieldImage() )
+    {
+        // If we have an existing texture and we're setting to the same bitmap then force the texture manager
+        // to refresh the texture itself.
+        if ( !mImageTextureHandle.IsNull() && dStricmp(mImageTextureHandle.getTextureKey(), mImageFile) == 0 )
+            TextureManager::refresh( mImageFile );
+
+        // Get image texture.
+        // NOTE: The texture is decoded in the background if the asset is being acquired asynchronously.
+        const bool asyncTextureLoading = TextureManager::getAsyncTextureLoading();
+        if ( AssetDatabase.isAcquiringAsync() )
+            TextureManager::setAsyncTextureLoading( true );
+        mImageTextureHandle.set( mImageFile, TextureHandle::BitmapTexture, true, getForce16Bit() );
+        TextureManager::setAsyncTextureLoading( asyncTextureLoading );
 
-    // Get image texture.
-    mImageTextureHandle.set( mImageFile, TextureHandle::BitmapTexture, true, getForce16Bit() );
+        // Fetch the image dimensions.
+        mImageWidth = mImageTextureHandle.getWidth();
+        mImageHeight = mImageTextureHandle.getHeight();
+
+        // Set mip streaming.
+        // NOTE: Atlas pages are shared so they are never streamed.
+        mImageTextureHandle.setMipStreaming( mMipStreaming );
+
+        // Set whether the texture is critical.
+        mImageTextureHandle.setCritical( mCritical );
+    }
 
     // Is the texture valid?
     if ( mImageTextureHandle.IsNull() )
@@ -1145,10 +1278,11 @@ void ImageAsset::calculateImage( void )
     }
     else
     {
-        TextureFilterMode filterMode = FILTER_NEAREST;
+        // Distance fields are only reconstructed correctly when filtered.
+        TextureFilterMode filterMode = mDistanceField ? FILTER_BILINEAR : FILTER_NEAREST;
 
-        // No, so fetch the global filter.
-        const char* pGlobalFilter = Con::getVariable( "$pref::T2D::imageAssetGlobalFilterMode" );
+        // No, so fetch the global filter (distance fields ignore it).
+        const char* pGlobalFilter = mDistanceField ? NULL : Con::getVariable( "$pref::T2D::imageAssetGlobalFilterMode" );
 
         // Fetch the global filter mode.
         if ( pGlobalFilter != NULL && dStrlen(pGlobalFilter) > 0 )
@@ -1175,6 +1309,94 @@ void ImageAsset::calculateImage( void )
 
 //------------------------------------------------------------------------------
 
+bool ImageAsset::calculateAtlasImage( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ImageAsset_CalculateAtlasImage);
+
+    // Fetch any atlas tag (private copies and distance fields are never atlased).
+    StringTableEntry atlasName = getOwned() && !mDistanceField ? ImageAtlas::findAtlasName( getAssetId() ) : NULL;
+
+    // Pack into the atlas.
+    if ( atlasName != NULL )
+    {
+        Point2I imageSize;
+        if ( ImageAtlas::pack( atlasName, getAssetId(), mImageFile, mImageTextureHandle, mAtlasOffset, imageSize ) )
+        {
+            mAtlasName = atlasName;
+            mImageWidth = imageSize.x;
+            mImageHeight = imageSize.y;
+            return true;
+        }
+
+        // Warn.
+        Con::warnf( "ImageAsset::calculateAtlasImage() - Image '%s' could not be packed into atlas '%s' so will use its own texture.", getAssetId(), atlasName );
+    }
+
+    // Release any previous atlas area.
+    if ( getAtlased() )
+    {
+        ImageAtlas::release( getAssetId() );
+        mImageTextureHandle = NULL;
+        mAtlasName = StringTable->EmptyString;
+    }
+
+    mAtlasOffset.set( 0, 0 );
+    return false;
+}
+
+//------------------------------------------------------------------------------
+
+bool ImageAsset::calculateDistanceFieldImage( void )
+{
+    // Finish if not a distance field.
+    if ( !mDistanceField )
+        return false;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(ImageAsset_CalculateDistanceFieldImage);
+
+    // Load the bitmap uncompressed as the alpha channel is replaced.
+    GBitmap* pBitmap = TextureManager::loadBitmap( mImageFile, true, true );
+    if ( pBitmap == NULL )
+        return false;
+
+    // Convert the bitmap.
+    if ( !pBitmap->convertToDistanceField( IMAGE_ASSET_DISTANCE_FIELD_SPREAD ) )
+    {
+        // Warn.
+        Con::warnf( "ImageAsset::calculateDistanceFieldImage() - Image '%s' has no alpha channel so cannot be a distance field.", getAssetId() );
+        delete pBitmap;
+        return false;
+    }
+
+    // Register the field under its own key so that plain uses of the same image file are unaffected.
+    // NOTE: The bitmap is kept as it cannot be reloaded from the image file if the texture needs restoring.
+    char textureKey[1024];
+    dSprintf( textureKey, sizeof(textureKey), "%s?distanceField", mImageFile );
+    mImageTextureHandle.set( textureKey, pBitmap, TextureHandle::BitmapKeepTexture, true );
+
+    // Fetch the image dimensions.
+    mImageWidth = mImageTextureHandle.getWidth();
+    mImageHeight = mImageTextureHandle.getHeight();
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+
+void ImageAsset::calculateTexelScales( F32& texelWidthScale, F32& texelHeightScale )
+{
+    // Fetch the texture object.
+    TextureObject* pTextureObject = ((TextureObject*)mImageTextureHandle);
+
+    // Use the image dimensions if there is no texture such as in a headless server.
+    texelWidthScale = 1.0f / (F32)(pTextureObject != NULL ? pTextureObject->getTextureWidth() : getImageWidth());
+    texelHeightScale = 1.0f / (F32)(pTextureObject != NULL ? pTextureObject->getTextureHeight() : getImageHeight());
+}
+
+//------------------------------------------------------------------------------
+
 void ImageAsset::calculateImplicitMode( void )
 {
     // Debug Profiling.
@@ -1183,19 +1405,17 @@ void ImageAsset::calculateImplicitMode( void )
     // Sanity!
     AssertFatal( !mExplicitMode, "Cannot calculate implicit cells when in explicit mode." );
 
-    // Fetch the texture object.
-    TextureObject* pTextureObject = ((TextureObject*)mImageTextureHandle);
- 
     // Calculate texel scales.
-    const F32 texelWidthScale = 1.0f / (F32)pTextureObject->getTextureWidth();
-    const F32 texelHeightScale = 1.0f / (F32)pTextureObject->getTextureHeight();
+    F32 texelWidthScale;
+    F32 texelHeightScale;
+    calculateTexelScales( texelWidthScale, texelHeightScale );
 
     // Fetch the original image dimensions.
     const S32 imageWidth = getImageWidth();
     const S32 imageHeight = getImageHeight();
 
     // Set full-frame as default.
-    FrameArea frameArea( 0, 0, imageWidth, imageHeight, texelWidthScale, texelHeightScale );
+    FrameArea frameArea( mAtlasOffset.x, mAtlasOffset.y, imageWidth, imageHeight, texelWidthScale, texelHeightScale );
     mFrames.push_back( frameArea );
 
     // Finish if no cell counts are specified.  This is how we default to full-frame mode.
@@ -1306,7 +1526,7 @@ void ImageAsset::calculateImplicitMode( void )
             for ( S32 x = 0, cellPositionX = mCellOffsetX; x < mCellCountX; x++, cellPositionX+=cellStepX )
             {
                 // Set frame area.
-                frameArea.setArea( cellPositionX, cellPositionY, mCellWidth, mCellHeight, texelWidthScale, texelHeightScale );
+                frameArea.setArea( mAtlasOffset.x + cellPositionX, mAtlasOffset.y + cellPositionY, mCellWidth, mCellHeight, texelWidthScale, texelHeightScale );
 
                 // Store fame.
                 mFrames.push_back( frameArea );
@@ -1322,7 +1542,7 @@ void ImageAsset::calculateImplicitMode( void )
         for ( S32 y = 0, cellPositionY = mCellOffsetY; y < mCellCountY; y++, cellPositionY+=cellStepY )
         {
             // Set frame area.
-            frameArea.setArea( cellPositionX, cellPositionY, mCellWidth, mCellHeight, texelWidthScale, texelHeightScale );
+            frameArea.setArea( mAtlasOffset.x + cellPositionX, mAtlasOffset.y + cellPositionY, mCellWidth, mCellHeight, texelWidthScale, texelHeightScale );
 
             // Store fame.
             mFrames.push_back( frameArea );
@@ -1340,12 +1560,10 @@ void ImageAsset::calculateExplicitMode( void )
     // Sanity!
     AssertFatal( mExplicitMode, "Cannot calculate explicit cells when not in explicit mode." );
 
-    // Fetch the texture object.
-    TextureObject* pTextureObject = ((TextureObject*)mImageTextureHandle);
- 
     // Calculate texel scales.
-    const F32 texelWidthScale = 1.0f / (F32)pTextureObject->getTextureWidth();
-    const F32 texelHeightScale = 1.0f / (F32)pTextureObject->getTextureHeight();
+    F32 texelWidthScale;
+    F32 texelHeightScale;
+    calculateTexelScales( texelWidthScale, texelHeightScale );
 
     // Fetch the original image dimensions.
     const S32 imageWidth = getImageWidth();
@@ -1358,7 +1576,7 @@ void ImageAsset::calculateExplicitMode( void )
     if ( mExplicitFrames.size() == 0 )
     {
         // No, so set full-frame as default.
-        FrameArea frameArea( 0, 0, imageWidth, imageHeight, texelWidthScale, texelHeightScale );
+        FrameArea frameArea( mAtlasOffset.x, mAtlasOffset.y, imageWidth, imageHeight, texelWidthScale, texelHeightScale );
         mFrames.push_back( frameArea );
 
         return;
@@ -1371,7 +1589,7 @@ void ImageAsset::calculateExplicitMode( void )
         const FrameArea::PixelArea& pixelArea = *frameItr;
 
         // Set frame area.
-        FrameArea frameArea( pixelArea.mPixelOffset.x, pixelArea.mPixelOffset.y, pixelArea.mPixelWidth, pixelArea.mPixelHeight, texelWidthScale, texelHeightScale, pixelArea.mRegionName );
+        FrameArea frameArea( mAtlasOffset.x + pixelArea.mPixelOffset.x, mAtlasOffset.y + pixelArea.mPixelOffset.y, pixelArea.mPixelWidth, pixelArea.mPixelHeight, texelWidthScale, texelHeightScale, pixelArea.mRegionName );
 
         // Store frame.
         mFrames.push_back( frameArea );
@@ -39,6 +39,10 @@
 #include "graphics/TextureManager.h"
 #endif
 
+#ifndef _DGL_H_
+#include "graphics/dgl.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 DefineConsoleType( TypeImageAssetPtr )
@@ -56,6 +60,7 @@ public:
     {
         FILTER_NEAREST,
         FILTER_BILINEAR,
+        FILTER_TRILINEAR,
 
         FILTER_INVALID,
     };
@@ -165,6 +170,9 @@ private:
     StringTableEntry            mImageFile;
     bool                        mForce16Bit;
     TextureFilterMode           mLocalFilterMode;
+    bool                        mMipStreaming;
+    bool                        mCritical;
+    bool                        mDistanceField;
     bool                        mExplicitMode;
     bool                        mCellRowOrder;
     S32                         mCellOffsetX;
@@ -180,6 +188,12 @@ private:
     typeFrameAreaVector         mFrames;
     typeExplicitFrameAreaVector mExplicitFrames;
     TextureHandle               mImageTextureHandle;
+    S32                         mImageWidth;
+    S32                         mImageHeight;
+
+    /// Atlas.
+    StringTableEntry            mAtlasName;
+    Point2I                     mAtlasOffset;
 
 public:
     ImageAsset();
@@ -200,6 +214,15 @@ public:
     void                    setFilterMode( const TextureFilterMode filterMode );
     TextureFilterMode       getFilterMode( void ) const                     { return mLocalFilterMode; }
 
+    void                    setMipStreaming( const bool mipStreaming );
+    inline bool             getMipStreaming( void ) const                   { return mMipStreaming; }
+
+    void                    setCritical( const bool critical );
+    inline bool             getCritical( void ) const                       { return mCritical; }
+
+    void                    setDistanceField( const bool distanceField );
+    inline bool             getDistanceField( void ) const                  { return mDistanceField; }
+
     void                    setExplicitMode( const bool explicitMode );
     bool                    getExplicitMode( void ) const                   { return mExplicitMode; }
 
@@ -239,8 +262,10 @@ public:
     bool                    containsNamedRegion(const char* regionName);
 
     inline TextureHandle&   getImageTexture( void )                         { return mImageTextureHandle; }
-    inline S32              getImageWidth( void ) const                     { return mImageTextureHandle.getWidth(); }
-    inline S32              getImageHeight( void ) const                    { return mImageTextureHandle.getHeight(); }
+    inline S32              getImageWidth( void ) const                     { return mImageWidth; }
+    inline S32              getImageHeight( void ) const                    { return mImageHeight; }
+    inline StringTableEntry getAtlasName( void ) const                      { return mAtlasName; }
+    inline bool             getAtlased( void ) const                        { return mAtlasName != StringTable->EmptyString; }
     inline U32              getFrameCount( void ) const                     { return (U32)mFrames.size(); };
     inline bool             containsFrame( const char* namedFrame )         { return containsNamedRegion(namedFrame); };
     
@@ -248,9 +273,12 @@ public:
     
     inline const FrameArea& getImageFrameArea( U32 frame ) const            { clampFrame(frame); return mFrames[frame]; };
     inline const FrameArea& getImageFrameArea( const char* namedFrame)      { return getCellByName(namedFrame); };
-    inline const void       bindImageTexture( void)                         { glBindTexture( GL_TEXTURE_2D, getImageTexture().getGLName() ); };
+    inline const void       bindImageTexture( void)                         { dglBindTexture( GL_TEXTURE_2D, getImageTexture().getGLName() ); };
     
-    virtual bool            isAssetValid( void ) const                      { return !mImageTextureHandle.IsNull(); }
+    virtual bool            isAssetValid( void ) const                      { return !mImageTextureHandle.IsNull() || (Platform::isHeadless() && mFrames.size() > 0); }
+    virtual bool            isAssetLoadPending( void ) const                { return mImageTextureHandle.getPending(); }
+    virtual void            finishAssetLoad( void )                         { if ( isAssetLoadPending() ) TextureManager::finishPendingTextures(); }
+    virtual U32             getAssetMemorySize( void ) const                { return mImageTextureHandle.getResidentSize(); }
 
     /// Explicit cell control.
     bool                    clearExplicitCells( void );
@@ -272,6 +300,9 @@ public:
 private:
     inline void clampFrame( U32& frame ) const                              { const U32 totalFrames = getFrameCount(); if ( frame >= totalFrames ) frame = (totalFrames == 0 ? 0 : totalFrames-1 ); };
     void calculateImage( void );
+    bool calculateAtlasImage( void );
+    bool calculateDistanceFieldImage( void );
+    void calculateTexelScales( F32& texelWidthScale, F32& texelHeightScale );
     void calculateImplicitMode( void );
     void calculateExplicitMode( void );
     void setTextureFilter( const TextureFilterMode filterMode );
@@ -300,6 +331,15 @@ protected:
     static bool setFilterMode( void* obj, const char* data );
     static bool writeFilterMode( void* obj, StringTableEntry pFieldName )   { return static_cast<ImageAsset*>(obj)->getFilterMode() != FILTER_BILINEAR; }
 
+    static bool setMipStreaming( void* obj, const char* data )              { static_cast<ImageAsset*>(obj)->setMipStreaming(dAtob(data)); return false; }
+    static bool writeMipStreaming( void* obj, StringTableEntry pFieldName ) { return static_cast<ImageAsset*>(obj)->getMipStreaming() == true; }
+
+    static bool setCritical( void* obj, const char* data )                  { static_cast<ImageAsset*>(obj)->setCritical(dAtob(data)); return false; }
+    static bool writeCritical( void* obj, StringTableEntry pFieldName )     { return static_cast<ImageAsset*>(obj)->getCritical() == true; }
+
+    static bool setDistanceField( void* obj, const char* data )             { static_cast<ImageAsset*>(obj)->setDistanceField(dAtob(data)); return false; }
+    static bool writeDistanceField( void* obj, StringTableEntry pFieldName ) { return static_cast<ImageAsset*>(obj)->getDistanceField() == true; }
+
     static bool setExplicitMode( void* obj, const char* data )              { static_cast<ImageAsset*>(obj)->setExplicitMode(dAtob(data)); return false; }
 
     static bool setCellRowOrder( void* obj, const char* data )              { static_cast<ImageAsset*>(obj)->setCellRowOrder(dAtob(data)); return false; }
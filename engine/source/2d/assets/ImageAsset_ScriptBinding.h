@@ -43,6 +43,7 @@ ConsoleMethodWithDocs(ImageAsset, getImageFile, ConsoleString, 2, 2, ())
 //------------------------------------------------------------------------------
 
 /*! Sets the filter mode.
+    @param mode The filter mode of "NEAREST", "BILINEAR" or "TRILINEAR" (which generates mip levels).
     @return No return value.
 */
 ConsoleMethodWithDocs(ImageAsset, setFilterMode, ConsoleVoid, 3, 3, (mode))
@@ -95,6 +96,70 @@ ConsoleMethodWithDocs(ImageAsset, getForce16Bit, ConsoleBool, 2, 2, ())
 
 //-----------------------------------------------------------------------------
 
+/*! Sets whether mip levels are streamed or not.
+    When streaming, only the mip levels needed for the image's on-screen texel density are uploaded.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(ImageAsset, setMipStreaming, ConsoleVoid, 3, 3, (mipStreaming?))
+{
+    object->setMipStreaming( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether mip levels are streamed or not.
+    @return Whether mip levels are streamed or not.
+*/
+ConsoleMethodWithDocs(ImageAsset, getMipStreaming, ConsoleBool, 2, 2, ())
+{
+    return object->getMipStreaming();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets whether the image is critical or not.
+    A compressed copy of a critical image is kept in memory so that, when the graphics context is lost, it is restored immediately without reading its file.
+    Other images are restored when next drawn.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(ImageAsset, setCritical, ConsoleVoid, 3, 3, (critical?))
+{
+    object->setCritical( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the image is critical or not.
+    @return Whether the image is critical or not.
+*/
+ConsoleMethodWithDocs(ImageAsset, getCritical, ConsoleBool, 2, 2, ())
+{
+    return object->getCritical();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets whether the image alpha is converted to a signed distance field or not.
+    Distance fields stay sharp when scaled as the edge is recovered by filtering and an alpha test.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(ImageAsset, setDistanceField, ConsoleVoid, 3, 3, (distanceField?))
+{
+    object->setDistanceField( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the image alpha is converted to a signed distance field or not.
+    @return Whether the image alpha is converted to a signed distance field or not.
+*/
+ConsoleMethodWithDocs(ImageAsset, getDistanceField, ConsoleBool, 2, 2, ())
+{
+    return object->getDistanceField();
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Sets whether CELL row order should be used or not.
     @return No return value.
 */
@@ -322,6 +387,17 @@ ConsoleMethodWithDocs(ImageAsset, getIsImagePOT, ConsoleBool, 2, 2, ())
 
 //-----------------------------------------------------------------------------
 
+/*! Gets the name of the atlas the image is packed into.
+    An image is packed into an atlas when it has an asset tag starting with "Atlas".  All images with the same atlas tag share a texture so can be rendered in the same batch.
+    @return The atlas name or nothing if the image is not packed into an atlas.
+*/
+ConsoleMethodWithDocs(ImageAsset, getAtlasName, ConsoleString, 2, 2, ())
+{
+    return object->getAtlasName();
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Gets the frame count.
     @return The frame count.
 */
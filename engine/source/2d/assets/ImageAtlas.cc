@@ -0,0 +1,333 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _IMAGE_ATLAS_H_
+#include "2d/assets/ImageAtlas.h"
+#endif
+
+#ifndef _ASSET_MANAGER_H_
+#include "assets/assetManager.h"
+#endif
+
+#ifndef _DGL_H_
+#include "graphics/dgl.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+// Script bindings.
+#include "ImageAtlas_ScriptBinding.h"
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+Vector<ImageAtlas::AtlasPage*> ImageAtlas::smPages;
+ImageAtlas::typePlacementHash ImageAtlas::smPlacements;
+
+//-----------------------------------------------------------------------------
+
+StringTableEntry ImageAtlas::findAtlasName( const char* pAssetId )
+{
+    // Fetch asset tags.
+    AssetTagsManifest* pAssetTags = AssetDatabase.getAssetTags();
+
+    // Finish if no tags are loaded.
+    if ( pAssetTags == NULL )
+        return NULL;
+
+    const U32 prefixLength = dStrlen( IMAGE_ATLAS_TAG_PREFIX );
+
+    // Search the asset tags for an atlas tag.
+    const U32 tagCount = pAssetTags->getAssetTagCount( pAssetId );
+    for ( U32 tagIndex = 0; tagIndex < tagCount; ++tagIndex )
+    {
+        // Fetch tag name.
+        StringTableEntry tagName = pAssetTags->getAssetTag( pAssetId, tagIndex );
+
+        // Is this an atlas tag?
+        if ( tagName != NULL && dStrnicmp( tagName, IMAGE_ATLAS_TAG_PREFIX, prefixLength ) == 0 )
+            return tagName;
+    }
+
+    return NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+bool ImageAtlas::pack( StringTableEntry atlasName, StringTableEntry assetId, const char* pImageFile, TextureHandle& texture, Point2I& offset, Point2I& imageSize )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ImageAtlas_Pack);
+
+    // Sanity!
+    AssertFatal( atlasName != NULL && assetId != NULL, "ImageAtlas::pack() - Invalid atlas or asset." );
+
+    // Load the source bitmap.
+    GBitmap* pSourceBitmap = TextureManager::loadBitmap( pImageFile );
+
+    // Finish if the bitmap could not be loaded.
+    if ( pSourceBitmap == NULL )
+    {
+        release( assetId );
+        return false;
+    }
+
+    // Fetch the tile dimensions.
+    const U32 imageWidth = pSourceBitmap->getWidth();
+    const U32 imageHeight = pSourceBitmap->getHeight();
+    const U32 tileWidth = imageWidth + (IMAGE_ATLAS_GUTTER*2);
+    const U32 tileHeight = imageHeight + (IMAGE_ATLAS_GUTTER*2);
+    const GBitmap::BitmapFormat format = pSourceBitmap->getFormat();
+
+    // Finish if the image cannot be packed.
+    if ( (format != GBitmap::RGB && format != GBitmap::RGBA) || tileWidth > IMAGE_ATLAS_PAGE_SIZE || tileHeight > IMAGE_ATLAS_PAGE_SIZE )
+    {
+        delete pSourceBitmap;
+        release( assetId );
+        return false;
+    }
+
+    // Reuse the existing area if it's the same atlas and size else release it.
+    AtlasPage* pPage = NULL;
+    Point2I tilePosition;
+    typePlacementHash::iterator placementItr = smPlacements.find( assetId );
+    if ( placementItr != smPlacements.end() )
+    {
+        const AtlasPlacement& placement = placementItr->value;
+        if ( placement.mpPage->mAtlasName == atlasName && placement.mpPage->mFormat == format &&
+             placement.mArea.extent.x == (S32)tileWidth && placement.mArea.extent.y == (S32)tileHeight )
+        {
+            pPage = placement.mpPage;
+            tilePosition = placement.mArea.point;
+        }
+        else
+        {
+            release( assetId );
+        }
+    }
+
+    // Allocate a new area if required.
+    if ( pPage == NULL )
+    {
+        pPage = allocateArea( atlasName, format, tileWidth, tileHeight, tilePosition );
+
+        // Store the placement.
+        AtlasPlacement placement;
+        placement.mpPage = pPage;
+        placement.mArea.set( tilePosition, Point2I( tileWidth, tileHeight ) );
+        smPlacements.insert( assetId, placement );
+        pPage->mReferenceCount++;
+    }
+
+    // Build the tile with the image centered in its gutter.
+    GBitmap tileBitmap( tileWidth, tileHeight, false, format );
+    tileBitmap.copyRect( pSourceBitmap, RectI( 0, 0, imageWidth, imageHeight ), Point2I( IMAGE_ATLAS_GUTTER, IMAGE_ATLAS_GUTTER ) );
+    delete pSourceBitmap;
+
+    const U32 bytesPerPixel = tileBitmap.bytesPerPixel;
+
+    // Extrude the left and right image edges into the gutter.
+    for ( U32 y = IMAGE_ATLAS_GUTTER; y < IMAGE_ATLAS_GUTTER + imageHeight; ++y )
+    {
+        const U8* pLeftEdge = tileBitmap.getAddress( IMAGE_ATLAS_GUTTER, y );
+        const U8* pRightEdge = tileBitmap.getAddress( IMAGE_ATLAS_GUTTER + imageWidth - 1, y );
+
+        for ( U32 x = 0; x < IMAGE_ATLAS_GUTTER; ++x )
+        {
+            dMemcpy( tileBitmap.getAddress( x, y ), pLeftEdge, bytesPerPixel );
+            dMemcpy( tileBitmap.getAddress( IMAGE_ATLAS_GUTTER + imageWidth + x, y ), pRightEdge, bytesPerPixel );
+        }
+    }
+
+    // Extrude the (already extruded) top and bottom rows into the gutter.
+    const U32 rowSize = tileWidth * bytesPerPixel;
+    for ( U32 y = 0; y < IMAGE_ATLAS_GUTTER; ++y )
+    {
+        dMemcpy( tileBitmap.getAddress( 0, y ), tileBitmap.getAddress( 0, IMAGE_ATLAS_GUTTER ), rowSize );
+        dMemcpy( tileBitmap.getAddress( 0, IMAGE_ATLAS_GUTTER + imageHeight + y ), tileBitmap.getAddress( 0, IMAGE_ATLAS_GUTTER + imageHeight - 1 ), rowSize );
+    }
+
+    // Copy the tile into the page and upload it.
+    uploadArea( pPage, &tileBitmap, tilePosition );
+
+    // Return the placement.
+    texture = pPage->mTexture;
+    offset.set( tilePosition.x + IMAGE_ATLAS_GUTTER, tilePosition.y + IMAGE_ATLAS_GUTTER );
+    imageSize.set( imageWidth, imageHeight );
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void ImageAtlas::release( StringTableEntry assetId )
+{
+    // Find the placement.
+    typePlacementHash::iterator placementItr = smPlacements.find( assetId );
+
+    // Finish if not packed.
+    if ( placementItr == smPlacements.end() )
+        return;
+
+    // Fetch the page and remove the placement.
+    AtlasPage* pPage = placementItr->value.mpPage;
+    smPlacements.erase( placementItr );
+
+    // Finish if the page is still referenced.
+    // NOTE: Shelf space is not reclaimed until the whole page is released.
+    if ( --pPage->mReferenceCount > 0 )
+        return;
+
+    // Remove the page.
+    for ( S32 pageIndex = 0; pageIndex < smPages.size(); ++pageIndex )
+    {
+        if ( smPages[pageIndex] == pPage )
+        {
+            smPages.erase_fast( pageIndex );
+            break;
+        }
+    }
+
+    // Delete the page which releases its texture and bitmap.
+    delete pPage;
+}
+
+//-----------------------------------------------------------------------------
+
+ImageAtlas::AtlasPage* ImageAtlas::allocateArea( StringTableEntry atlasName, const GBitmap::BitmapFormat format, const U32 width, const U32 height, Point2I& position )
+{
+    // Search the existing pages of this atlas for space.
+    for ( S32 pageIndex = 0; pageIndex < smPages.size(); ++pageIndex )
+    {
+        AtlasPage* pPage = smPages[pageIndex];
+
+        // Skip if not the same atlas and format.
+        if ( pPage->mAtlasName != atlasName || pPage->mFormat != format )
+            continue;
+
+        U32 shelfX = pPage->mShelfX;
+        U32 shelfY = pPage->mShelfY;
+        U32 shelfHeight = pPage->mShelfHeight;
+
+        // Start a new shelf if the current one is full.
+        if ( shelfX + width > IMAGE_ATLAS_PAGE_SIZE )
+        {
+            shelfX = 0;
+            shelfY += shelfHeight;
+            shelfHeight = 0;
+        }
+
+        // Skip if the page is full.
+        if ( shelfY + height > IMAGE_ATLAS_PAGE_SIZE )
+            continue;
+
+        // Allocate the area.
+        position.set( shelfX, shelfY );
+        pPage->mShelfX = shelfX + width;
+        pPage->mShelfY = shelfY;
+        pPage->mShelfHeight = getMax( shelfHeight, height );
+
+        return pPage;
+    }
+
+    // Create a new page.
+    AtlasPage* pPage = new AtlasPage();
+    pPage->mAtlasName = atlasName;
+    pPage->mFormat = format;
+    pPage->mShelfX = width;
+    pPage->mShelfY = 0;
+    pPage->mShelfHeight = height;
+    pPage->mReferenceCount = 0;
+
+    // Register the page texture, keeping the bitmap so that areas can be added and the texture restored.
+    GBitmap* pPageBitmap = new GBitmap( IMAGE_ATLAS_PAGE_SIZE, IMAGE_ATLAS_PAGE_SIZE, false, format );
+    dMemset( pPageBitmap->getWritableBits(), 0, pPageBitmap->byteSize );
+    pPage->mTexture.set( TextureManager::getUniqueTextureKey(), pPageBitmap, TextureHandle::BitmapKeepTexture, true );
+
+    smPages.push_back( pPage );
+
+    position.set( 0, 0 );
+    return pPage;
+}
+
+//-----------------------------------------------------------------------------
+
+void ImageAtlas::uploadArea( AtlasPage* pPage, const GBitmap* pTile, const Point2I& position )
+{
+    // Copy the tile into the page bitmap.
+    GBitmap* pPageBitmap = pPage->mTexture.getBitmap();
+    pPageBitmap->copyRect( pTile, RectI( 0, 0, pTile->getWidth(), pTile->getHeight() ), position );
+
+    // Finish if there is no texture to update yet (it'll be created from the bitmap).
+    const U32 glTextureName = pPage->mTexture.getGLName();
+    if ( glTextureName == 0 )
+        return;
+
+    // Upload the whole page if it has a mip chain otherwise the lower levels would be stale.
+    if ( ((TextureObject*)pPage->mTexture)->getMipLevelCount() > 1 )
+    {
+        pPage->mTexture.refresh();
+        return;
+    }
+
+    // Update only the tile area of the texture rather than the whole page.
+    dglBindTexture( GL_TEXTURE_2D, glTextureName );
+    glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
+    glTexSubImage2D( GL_TEXTURE_2D, 0,
+        position.x, position.y,
+        pTile->getWidth(), pTile->getHeight(),
+        pPage->mFormat == GBitmap::RGBA ? GL_RGBA : GL_RGB,
+        GL_UNSIGNED_BYTE,
+        pTile->getBits() );
+    glPixelStorei( GL_UNPACK_ALIGNMENT, 4 );
+}
+
+//-----------------------------------------------------------------------------
+
+void ImageAtlas::dumpMetrics( void )
+{
+    Con::printSeparator();
+    Con::printBlankLine();
+    Con::printf( "Dumping image atlas metrics:" );
+
+    for ( S32 pageIndex = 0; pageIndex < smPages.size(); ++pageIndex )
+    {
+        const AtlasPage* pPage = smPages[pageIndex];
+
+        // Info.
+        Con::printf( "Atlas=%s, Page=%d, Format=%s, Images=%d, ShelfUsed=%d of %d",
+            pPage->mAtlasName,
+            pageIndex,
+            pPage->mFormat == GBitmap::RGBA ? "RGBA" : "RGB",
+            pPage->mReferenceCount,
+            pPage->mShelfY + pPage->mShelfHeight, IMAGE_ATLAS_PAGE_SIZE );
+    }
+
+    Con::printBlankLine();
+    Con::printf( "Total pages: %d, Total images: %d", smPages.size(), smPlacements.size() );
+    Con::printBlankLine();
+    Con::printSeparator();
+}
@@ -0,0 +1,108 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _IMAGE_ATLAS_H_
+#define _IMAGE_ATLAS_H_
+
+#ifndef _TEXTURE_MANAGER_H_
+#include "graphics/TextureManager.h"
+#endif
+
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#ifndef _MRECT_H_
+#include "math/mRect.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// Asset tags starting with this prefix (case-insensitive) name an atlas e.g. "AtlasUI".
+#define IMAGE_ATLAS_TAG_PREFIX      "atlas"
+
+/// Dimension of each (square) atlas page.
+#define IMAGE_ATLAS_PAGE_SIZE       1024
+
+/// Texels of edge-extruded border placed around each image to stop filtering bleeding between neighbours.
+#define IMAGE_ATLAS_GUTTER          2
+
+//-----------------------------------------------------------------------------
+
+/// Packs the bitmaps of image assets that share an atlas tag into shared texture pages.
+///
+/// Each distinct texture forces a separate render batch so packing many small images
+/// into a single page allows them to be drawn together.  Images are packed at load-time
+/// using a simple shelf packer; an image that is too large or is of an unsupported
+/// format is simply not packed and the caller should use its own texture instead.
+///
+/// All images packed into a page share its texture and therefore its filter mode.
+class ImageAtlas
+{
+private:
+    struct AtlasPage
+    {
+        StringTableEntry        mAtlasName;
+        GBitmap::BitmapFormat   mFormat;
+        TextureHandle           mTexture;
+        U32                     mShelfX;
+        U32                     mShelfY;
+        U32                     mShelfHeight;
+        U32                     mReferenceCount;
+    };
+
+    struct AtlasPlacement
+    {
+        AtlasPage*              mpPage;
+        RectI                   mArea;
+    };
+
+    typedef HashMap<StringTableEntry, AtlasPlacement> typePlacementHash;
+
+    static Vector<AtlasPage*>   smPages;
+    static typePlacementHash    smPlacements;
+
+public:
+    /// Fetch the atlas name of the specified asset or NULL if it has no atlas tag.
+    static StringTableEntry findAtlasName( const char* pAssetId );
+
+    /// Pack the image file into the named atlas on behalf of the asset.
+    /// Returns false if the image could not be packed in which case the texture and offset are untouched.
+    /// Packing the same asset again reuses its existing area if the image dimensions are unchanged.
+    static bool pack( StringTableEntry atlasName, StringTableEntry assetId, const char* pImageFile, TextureHandle& texture, Point2I& offset, Point2I& imageSize );
+
+    /// Release any area packed on behalf of the asset.
+    static void release( StringTableEntry assetId );
+
+    /// Dump the current atlas pages to the console.
+    static void dumpMetrics( void );
+
+private:
+    static AtlasPage* allocateArea( StringTableEntry atlasName, const GBitmap::BitmapFormat format, const U32 width, const U32 height, Point2I& position );
+    static void uploadArea( AtlasPage* pPage, const GBitmap* pTile, const Point2I& position );
+};
+
+#endif // _IMAGE_ATLAS_H_
@@ -123,7 +123,10 @@ ConsoleSetType( TypeParticleAssetPtr )
 
 ParticleAsset::ParticleAsset() :
                     mLifetime( 0.0f ),
-                    mLifeMode( INFINITE )
+                    mLifeMode( INFINITE ),
+                    mLodScreenArea( 0.0f ),
+                    mLodMinimumScale( 0.1f ),
+                    mMaxParticles( 0 )
 
 {
     // Set Vector Associations.
@@ -158,6 +161,9 @@ void ParticleAsset::initPersistFields()
 
     addProtectedField("Lifetime", TypeF32, Offset(mLifetime, ParticleAsset), &setLifetime, &defaultProtectedGetFn, &writeLifetime, "");
     addProtectedField("LifeMode", TypeEnum, Offset(mLifeMode, ParticleAsset), &setLifeMode, &defaultProtectedGetFn, &writeLifeMode, 1, &LifeModeTable);
+    addProtectedField("LodScreenArea", TypeF32, Offset(mLodScreenArea, ParticleAsset), &setLodScreenArea, &defaultProtectedGetFn, &writeLodScreenArea, "");
+    addProtectedField("LodMinimumScale", TypeF32, Offset(mLodMinimumScale, ParticleAsset), &setLodMinimumScale, &defaultProtectedGetFn, &writeLodMinimumScale, "");
+    addProtectedField("MaxParticles", TypeS32, Offset(mMaxParticles, ParticleAsset), &setMaxParticles, &defaultProtectedGetFn, &writeMaxParticles, "");
 }
 
 //------------------------------------------------------------------------------
@@ -176,6 +182,9 @@ void ParticleAsset::copyTo(SimObject* object)
    // Copy fields.
    pParticleAsset->setLifetime( getLifetime() );
    pParticleAsset->setLifeMode( getLifeMode() );
+   pParticleAsset->setLodScreenArea( getLodScreenArea() );
+   pParticleAsset->setLodMinimumScale( getLodMinimumScale() );
+   pParticleAsset->setMaxParticles( getMaxParticles() );
 
    // Copy particle fields.
    mParticleFields.copyTo( pParticleAsset->mParticleFields );
@@ -274,6 +283,49 @@ void ParticleAsset::setLifeMode( const LifeMode lifemode )
 
 //------------------------------------------------------------------------------
 
+void ParticleAsset::setLodScreenArea( const F32 screenArea )
+{
+    // Is the screen-area valid?
+    if ( screenArea < 0.0f )
+    {
+        // No, so warn.
+        Con::warnf( "ParticleAsset::setLodScreenArea() - Screen-area cannot be negative." );
+        return;
+    }
+
+    // Set the screen-area.
+    // NOTE:-   There's no need to refresh the asset as players fetch this each tick.
+    mLodScreenArea = screenArea;
+}
+
+//------------------------------------------------------------------------------
+
+void ParticleAsset::setLodMinimumScale( const F32 minimumScale )
+{
+    // Set the minimum-scale.
+    // NOTE:-   There's no need to refresh the asset as players fetch this each tick.
+    mLodMinimumScale = mClampF( minimumScale, 0.0f, 1.0f );
+}
+
+//------------------------------------------------------------------------------
+
+void ParticleAsset::setMaxParticles( const S32 maxParticles )
+{
+    // Is the maximum particles valid?
+    if ( maxParticles < 0 )
+    {
+        // No, so warn.
+        Con::warnf( "ParticleAsset::setMaxParticles() - Maximum particles cannot be negative." );
+        return;
+    }
+
+    // Set the maximum particles.
+    // NOTE:-   There's no need to refresh the asset as players fetch this each tick.
+    mMaxParticles = maxParticles;
+}
+
+//------------------------------------------------------------------------------
+
 void ParticleAsset::initializeAsset( void )
 {
     // Call parent.
@@ -66,6 +66,11 @@ private:
     F32                                     mLifetime;
     LifeMode                                mLifeMode;
 
+    /// Level-of-detail.
+    F32                                     mLodScreenArea;
+    F32                                     mLodMinimumScale;
+    S32                                     mMaxParticles;
+
     /// Particle fields.
     ParticleAssetFieldCollection            mParticleFields;
     ParticleAssetFieldBase                  mParticleLifeScale;
@@ -94,6 +99,16 @@ public:
     void setLifeMode( const LifeMode lifemode );
     LifeMode getLifeMode( void ) const { return mLifeMode; }
 
+    /// Level-of-detail.
+    /// A player emits at its full rate when its size covers at least the LOD screen-area (the fraction of the camera area) of a scene window.
+    /// Smaller players scale their emission (and maximum particles) down proportionally but no further than the LOD minimum-scale.
+    void setLodScreenArea( const F32 screenArea );
+    inline F32 getLodScreenArea( void ) const { return mLodScreenArea; }
+    void setLodMinimumScale( const F32 minimumScale );
+    inline F32 getLodMinimumScale( void ) const { return mLodMinimumScale; }
+    void setMaxParticles( const S32 maxParticles );
+    inline S32 getMaxParticles( void ) const { return mMaxParticles; }
+
     inline ParticleAssetFieldCollection& getParticleFields( void ) { return mParticleFields; }
 
     inline ParticleAssetField& getParticleLifeScaleField( void ) { return mParticleLifeScale.getBase(); }
@@ -170,6 +185,15 @@ protected:
 
     static bool setLifeMode(void* obj, const char* data)                    { static_cast<ParticleAsset*>(obj)->setLifeMode( ParticleAsset::getParticleAssetLifeModeEnum(data) ); return false; }
     static bool writeLifeMode( void* obj, StringTableEntry pFieldName )     { return static_cast<ParticleAsset*>(obj)->getLifeMode() != INFINITE; }
+
+    static bool setLodScreenArea(void* obj, const char* data)               { static_cast<ParticleAsset*>(obj)->setLodScreenArea(dAtof(data)); return false; }
+    static bool writeLodScreenArea( void* obj, StringTableEntry pFieldName ) { return mNotZero( static_cast<ParticleAsset*>(obj)->getLodScreenArea() ); }
+
+    static bool setLodMinimumScale(void* obj, const char* data)             { static_cast<ParticleAsset*>(obj)->setLodMinimumScale(dAtof(data)); return false; }
+    static bool writeLodMinimumScale( void* obj, StringTableEntry pFieldName ) { return mNotEqual( static_cast<ParticleAsset*>(obj)->getLodMinimumScale(), 0.1f ); }
+
+    static bool setMaxParticles(void* obj, const char* data)                { static_cast<ParticleAsset*>(obj)->setMaxParticles(dAtoi(data)); return false; }
+    static bool writeMaxParticles( void* obj, StringTableEntry pFieldName ) { return static_cast<ParticleAsset*>(obj)->getMaxParticles() != 0; }
 };
 
 #endif // _PARTICLE_ASSET_H_
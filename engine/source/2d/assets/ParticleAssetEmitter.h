@@ -98,6 +98,7 @@ private:
     bool                                    mAttachPositionToEmitter;
     bool                                    mAttachRotationToEmitter;
     bool                                    mOldestInFront;
+    bool                                    mCosmeticParticles;
 
     bool                                    mBlendMode;
     S32                                     mSrcBlendFactor;
@@ -182,6 +183,8 @@ public:
     inline bool getAttachRotationToEmitter( void ) const { return mAttachRotationToEmitter; }
     inline void setOldestInFront( const bool oldestInFront ) { mOldestInFront = oldestInFront; refreshAsset();  }
     inline bool getOldestInFront( void ) const { return mOldestInFront; }
+    inline void setCosmeticParticles( const bool cosmeticParticles ) { mCosmeticParticles = cosmeticParticles; refreshAsset(); }
+    inline bool getCosmeticParticles( void ) const { return mCosmeticParticles; }
    
     inline bool isStaticFrameProvider( void ) const { return mStaticMode; }
     inline bool isUsingNamedImageFrame( void ) const { return mUsingNamedFrame; }
@@ -304,6 +307,8 @@ protected:
     static bool     writeAttachRotationToEmitter( void* obj, StringTableEntry pFieldName ) { return static_cast<ParticleAssetEmitter*>(obj)->getAttachRotationToEmitter() == true; }
     static bool     setOldestInFront(void* obj, const char* data)                       { static_cast<ParticleAssetEmitter*>(obj)->setOldestInFront(dAtob(data)); return false; }
     static bool     writeOldestInFront( void* obj, StringTableEntry pFieldName )        { return static_cast<ParticleAssetEmitter*>(obj)->getOldestInFront() == true; }
+    static bool     setCosmeticParticles(void* obj, const char* data)                   { static_cast<ParticleAssetEmitter*>(obj)->setCosmeticParticles(dAtob(data)); return false; }
+    static bool     writeCosmeticParticles( void* obj, StringTableEntry pFieldName )    { return static_cast<ParticleAssetEmitter*>(obj)->getCosmeticParticles() == true; }
 
     static bool     setImage(void* obj, const char* data)                               { static_cast<ParticleAssetEmitter*>(obj)->setImage(data); return false; };
     static const char* getImage(void* obj, const char* data)                            { return static_cast<ParticleAssetEmitter*>(obj)->getImage(); }
@@ -510,6 +510,28 @@ ConsoleMethodWithDocs(ParticleAssetEmitter, getOldestInFront, ConsoleBool, 2, 2,
 
 //------------------------------------------------------------------------------
 
+/*! Set Cosmetic-Particles Flag.
+    Cosmetic particles are not integrated each tick.  Instead, each particle is evaluated directly from its emission state and age when it is rendered.
+    This makes very large numbers of purely cosmetic particles (rain, snow or sparks) far cheaper but the particle motion is evaluated from its emission speed and fixed-force only so random-motion is ignored and the speed and fixed-force life graphs are fixed at their emission values.
+    @param cosmeticParticles Whether the particles are cosmetic or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(ParticleAssetEmitter, setCosmeticParticles, ConsoleVoid, 3, 3, (cosmeticParticles))
+{
+    object->setCosmeticParticles( dAtob(argv[2]) );
+}
+
+//------------------------------------------------------------------------------
+
+/*! Get Cosmetic-Particles Flag.
+*/
+ConsoleMethodWithDocs(ParticleAssetEmitter, getCosmeticParticles, ConsoleBool, 2, 2, ())
+{
+    return object->getCosmeticParticles();
+}
+
+//------------------------------------------------------------------------------
+
 /*! Sets the emitter to use the specified image asset Id and optional frame.
     @param imageAssetId The image asset Id to use.
     @param frame The frame of the image asset Id to use.  Optional.
@@ -68,6 +68,7 @@ ParticleAssetField::ParticleAssetField() :
 {
     // Set Vector Associations.
     VECTOR_SET_ASSOCIATION( mDataKeys );
+    VECTOR_SET_ASSOCIATION( mLookupTable );
 }
 
 //-----------------------------------------------------------------------------
@@ -168,6 +169,9 @@ void ParticleAssetField::setValueBounds( F32 maxTime, F32 minValue, F32 maxValue
     if ( mDataKeys.size() == 0 )
         resetDataKeys();
 
+    // Update the lookup table.
+    updateLookupTable();
+
     // Flag the value bounds as dirty.
     mValueBoundsDirty = true;
 }
@@ -202,6 +206,9 @@ bool ParticleAssetField::setRepeatTime( const F32 repeatTime )
     // Set repeat time.
     mRepeatTime = repeatTime;
 
+    // Update the lookup table.
+    updateLookupTable();
+
     // Return Okay.
     return true;
 }
@@ -223,6 +230,9 @@ bool ParticleAssetField::setValueScale( const F32 valueScale )
     // Set Value Scale/
     mValueScale = valueScale;
 
+    // Update the lookup table.
+    updateLookupTable();
+
     // Return Okay.
     return true;
 }
@@ -273,6 +283,9 @@ S32 ParticleAssetField::addDataKey( const F32 time, const F32 value )
             // Yes, so set time.
             mDataKeys[index].mValue = value;
 
+            // Update the lookup table.
+            updateLookupTable();
+
             // Return Index.
             return index;
         }
@@ -289,6 +302,9 @@ S32 ParticleAssetField::addDataKey( const F32 time, const F32 value )
     mDataKeys[index].mTime = time;
     mDataKeys[index].mValue = value;
 
+    // Update the lookup table.
+    updateLookupTable();
+
     // Return Index.
     return index;
 }
@@ -316,6 +332,9 @@ bool ParticleAssetField::removeDataKey( const U32 index )
     // Remove Index.
     mDataKeys.erase(index);
 
+    // Update the lookup table.
+    updateLookupTable();
+
     // Return Okay.
     return true;
 }
@@ -343,6 +362,9 @@ bool ParticleAssetField::setDataKeyValue( const U32 index, const F32 value )
     // Set Data Key Value.
     mDataKeys[index].mValue = value;
 
+    // Update the lookup table.
+    updateLookupTable();
+
     // Return Okay.
     return true;
 }
@@ -442,6 +464,59 @@ F32 ParticleAssetField::getFieldValue( F32 time ) const
 
 //-----------------------------------------------------------------------------
 
+void ParticleAssetField::getFieldValues( const F32* pTimes, const U32 count, F32* pValues ) const
+{
+    // Fill with the first entry if it's the only one.
+    // NOTE:-   This is by far the most common case for the life fields so avoid the lookup entirely.
+    if ( mLookupTable.size() == 0 )
+    {
+        const F32 value = getDataKeyCount() > 0 ? mDataKeys[0].mValue * mValueScale : 0.0f;
+        for ( U32 index = 0; index < count; ++index )
+            pValues[index] = value;
+
+        return;
+    }
+
+    // Fetch the lookup table.
+    const F32* pLookupTable = mLookupTable.address();
+
+    // Calculate the time to lookup scale.
+    const F32 lookupScale = F32(PARTICLE_ASSET_FIELD_LOOKUP_SIZE) / mMaxTime;
+
+    // Lerp each value from the lookup table.
+    for ( U32 index = 0; index < count; ++index )
+    {
+        const F32 lookupPosition = mClampF( pTimes[index], 0.0f, mMaxTime ) * lookupScale;
+        const U32 lookupIndex = getMin( (U32)lookupPosition, (U32)(PARTICLE_ASSET_FIELD_LOOKUP_SIZE-1) );
+        const F32 lookupBlend = lookupPosition - F32(lookupIndex);
+
+        pValues[index] = pLookupTable[lookupIndex] + ((pLookupTable[lookupIndex+1] - pLookupTable[lookupIndex]) * lookupBlend);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void ParticleAssetField::updateLookupTable( void )
+{
+    // Clear the lookup table if there's not a graph to bake.
+    if ( getDataKeyCount() < 2 )
+    {
+        mLookupTable.clear();
+        return;
+    }
+
+    // Size the lookup table.
+    // NOTE:-   There's an extra sample so the last interval can be interpolated.
+    mLookupTable.setSize( PARTICLE_ASSET_FIELD_LOOKUP_SIZE + 1 );
+
+    // Bake the field graph.
+    // NOTE:-   Sampling the field directly means the clamping and repeat-time are baked in too.
+    for ( U32 index = 0; index <= PARTICLE_ASSET_FIELD_LOOKUP_SIZE; ++index )
+        mLookupTable[index] = getFieldValue( (F32(index) / F32(PARTICLE_ASSET_FIELD_LOOKUP_SIZE)) * mMaxTime );
+}
+
+//-----------------------------------------------------------------------------
+
 F32 ParticleAssetField::calculateFieldBV( const ParticleAssetField& base, const ParticleAssetField& variation, const F32 effectAge, const bool modulate, const F32 modulo )
 {
     // Fetch Graph Components.
@@ -694,6 +769,9 @@ void ParticleAssetField::onTamlCustomRead( const TamlCustomNode* pCustomNode )
 
     // Set the data keys.
     mDataKeys = keys;
+
+    // Update the lookup table.
+    updateLookupTable();
 }
 
 //-----------------------------------------------------------------------------
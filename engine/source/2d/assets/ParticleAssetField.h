@@ -33,6 +33,11 @@
 
 ///-----------------------------------------------------------------------------
 
+/// Number of intervals each field graph is baked into for bulk evaluation.
+#define PARTICLE_ASSET_FIELD_LOOKUP_SIZE    256
+
+///-----------------------------------------------------------------------------
+
 class ParticleAssetField
 {
 public:
@@ -71,6 +76,11 @@ private:
 
     Vector<DataKey> mDataKeys;
 
+    /// Field graph baked at regular intervals over [0, max-time] (empty if there's only a single key).
+    Vector<F32> mLookupTable;
+
+    void updateLookupTable( void );
+
 public:
     ParticleAssetField();
     virtual ~ParticleAssetField();
@@ -104,6 +114,9 @@ public:
     inline U32 getDataKeyCount( void ) const { return (U32)mDataKeys.size(); }
     const DataKey& getDataKey( const U32 index ) const;
     F32 getFieldValue( F32 time ) const;
+    /// Fetch the field values at each of the specified times.
+    /// The values are interpolated from the baked lookup table so are an approximation of "getFieldValue()" between samples.
+    void getFieldValues( const F32* pTimes, const U32 count, F32* pValues ) const;
 
     static F32 calculateFieldBV( const ParticleAssetField& base, const ParticleAssetField& variation, const F32 effectAge, const bool modulate = false, const F32 modulo = 0.0f );
     static F32 calculateFieldBVE( const ParticleAssetField& base, const ParticleAssetField& variation, const ParticleAssetField& effect, const F32 effectAge, const bool modulate = false, const F32 modulo = 0.0f );
@@ -70,6 +70,70 @@ ConsoleMethodWithDocs(ParticleAsset, getLifetime, ConsoleFloat, 2, 2, ())
     return object->getLifetime();
 }
 
+//-----------------------------------------------------------------------------
+
+/*! Sets the fraction of a scene window camera area a player must cover to emit at its full rate.
+    Players covering less scale their emission rate and maximum particles down proportionally.
+    @param screenArea The fraction of the camera area (zero disables the level-of-detail).
+    @return No return value.
+*/
+ConsoleMethodWithDocs(ParticleAsset, setLodScreenArea, ConsoleVoid, 3, 3, (screenArea))
+{
+    object->setLodScreenArea( dAtof(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the fraction of a scene window camera area a player must cover to emit at its full rate.
+    @return The fraction of the camera area (zero disables the level-of-detail).
+*/
+ConsoleMethodWithDocs(ParticleAsset, getLodScreenArea, ConsoleFloat, 2, 2, ())
+{
+    return object->getLodScreenArea();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets the smallest level-of-detail scale applied to the emission rate and maximum particles.
+    @param minimumScale The smallest scale in the range [0,1].
+    @return No return value.
+*/
+ConsoleMethodWithDocs(ParticleAsset, setLodMinimumScale, ConsoleVoid, 3, 3, (minimumScale))
+{
+    object->setLodMinimumScale( dAtof(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the smallest level-of-detail scale applied to the emission rate and maximum particles.
+    @return The smallest scale in the range [0,1].
+*/
+ConsoleMethodWithDocs(ParticleAsset, getLodMinimumScale, ConsoleFloat, 2, 2, ())
+{
+    return object->getLodMinimumScale();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets the maximum number of particles a single player can have active.
+    @param maxParticles The maximum number of particles (zero is unlimited).
+    @return No return value.
+*/
+ConsoleMethodWithDocs(ParticleAsset, setMaxParticles, ConsoleVoid, 3, 3, (maxParticles))
+{
+    object->setMaxParticles( dAtoi(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the maximum number of particles a single player can have active.
+    @return The maximum number of particles (zero is unlimited).
+*/
+ConsoleMethodWithDocs(ParticleAsset, getMaxParticles, ConsoleInt, 2, 2, ())
+{
+    return object->getMaxParticles();
+}
+
 //-----------------------------------------------------------------------------
 /// Particle asset fields.
 //-----------------------------------------------------------------------------
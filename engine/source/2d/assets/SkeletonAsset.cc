@@ -102,7 +102,10 @@ SkeletonAsset::SkeletonAsset() :    mSkeletonFile(StringTable->EmptyString),
                                     mAtlasDirty(true),
                                     mAtlas(NULL),
                                     mSkeletonData(NULL),
-                                    mStateData(NULL)
+                                    mStateData(NULL),
+                                    mPoseSampleRate(0.0f),
+                                    mBakePoses(false),
+                                    mpPoseSkeleton(NULL)
 {
 }
 
@@ -110,6 +113,7 @@ SkeletonAsset::SkeletonAsset() :    mSkeletonFile(StringTable->EmptyString),
 
 SkeletonAsset::~SkeletonAsset()
 {
+    clearPoses();
     spAnimationStateData_dispose(mStateData);
     spSkeletonData_dispose(mSkeletonData);
     spAtlas_dispose(mAtlas);
@@ -125,6 +129,8 @@ void SkeletonAsset::initPersistFields()
     // Fields.
     addProtectedField("AtlasFile", TypeAssetLooseFilePath, Offset(mAtlasFile, SkeletonAsset), &setAtlasFile, &defaultProtectedGetFn, &writeAtlasFile, "The loose file pointing to the .atlas file used for skinning");
     addProtectedField("SkeletonFile", TypeAssetLooseFilePath, Offset(mSkeletonFile, SkeletonAsset), &setSkeletonFile, &defaultProtectedGetFn, &writeSkeletonFile, "The loose file produced by the editor, which is fed into this asset");
+    addProtectedField("PoseSampleRate", TypeF32, Offset(mPoseSampleRate, SkeletonAsset), &setPoseSampleRate, &defaultProtectedGetFn, &writePoseSampleRate, "The rate (per second) that poses are sampled and shared between skeleton objects playing the same animation.  Zero disables pose sharing.");
+    addProtectedField("BakePoses", TypeBool, Offset(mBakePoses, SkeletonAsset), &setBakePoses, &defaultProtectedGetFn, &writeBakePoses, "Whether all the poses of every animation are evaluated when the asset is loaded or not.");
 }
 
 //------------------------------------------------------------------------------
@@ -205,6 +211,8 @@ void SkeletonAsset::copyTo(SimObject* object)
     // Copy state.
     pAsset->setAtlasFile( getAtlasFile() );
     pAsset->setSkeletonFile( getSkeletonFile() );
+    pAsset->setPoseSampleRate( getPoseSampleRate() );
+    pAsset->setBakePoses( getBakePoses() );
 }
 
 //------------------------------------------------------------------------------
@@ -303,6 +311,9 @@ void SkeletonAsset::buildSkeletonData( void )
     // Atlas load failure
     AssertFatal(mAtlas != NULL, "SkeletonAsset::buildSkeletonData() - Atlas was not loaded.");
     
+    // Clear the poses as they reference the skeleton data.
+    clearPoses();
+
     // Clear state data
     if (mStateData)
         spAnimationStateData_dispose(mStateData);
@@ -326,6 +337,10 @@ void SkeletonAsset::buildSkeletonData( void )
     spSkeletonJson_dispose(json);
 
     mStateData = spAnimationStateData_create(mSkeletonData);
+
+    // Bake the poses if required.
+    if (mBakePoses)
+        bakePoses();
 }
 
 //-----------------------------------------------------------------------------
@@ -337,6 +352,241 @@ bool SkeletonAsset::isAssetValid( void ) const
 
 //-----------------------------------------------------------------------------
 
+void SkeletonAsset::setPoseSampleRate( const F32 sampleRate )
+{
+    // Is the sample-rate valid?
+    if ( sampleRate < 0.0f )
+    {
+        // No, so warn.
+        Con::warnf( "SkeletonAsset::setPoseSampleRate() - Sample-rate cannot be negative." );
+        return;
+    }
+
+    // Ignore no change.
+    if ( mIsEqual( sampleRate, mPoseSampleRate ) )
+        return;
+
+    mPoseSampleRate = sampleRate;
+
+    // Discard the poses sampled at the previous rate.
+    clearPoses();
+
+    // Bake the poses if required.
+    if ( mBakePoses )
+        bakePoses();
+}
+
+//-----------------------------------------------------------------------------
+
+void SkeletonAsset::setBakePoses( const bool bakePoses )
+{
+    // Ignore no change.
+    if ( bakePoses == mBakePoses )
+        return;
+
+    mBakePoses = bakePoses;
+
+    // Bake the poses if required.
+    // NOTE:-   Turning baking off keeps any poses already evaluated.
+    if ( mBakePoses )
+        this->bakePoses();
+}
+
+//-----------------------------------------------------------------------------
+
+const SkeletonAsset::typeSkeletonPose* SkeletonAsset::findPose( const SkeletonPoseKey& key, const F32 animationTime )
+{
+    // Finish if pose sharing is disabled or there's nothing to evaluate.
+    if ( mPoseSampleRate <= 0.0f || key.mpAnimation == NULL || mSkeletonData == NULL )
+        return NULL;
+
+    // Skeleton objects can share poses from worker threads.
+    mPoseMutex.lock();
+
+    // Fetch the pose track.
+    SkeletonPoseTrack* pPoseTrack = findPoseTrack( key );
+
+    // Calculate the pose index.
+    const S32 lastPoseIndex = pPoseTrack->mPoses.size() - 1;
+    const S32 poseIndex = animationTime <= 0.0f ? 0 : getMin( (S32)(animationTime * mPoseSampleRate), lastPoseIndex );
+
+    // Evaluate the pose if it hasn't been already.
+    typeSkeletonPose*& pPose = pPoseTrack->mPoses[poseIndex];
+    if ( pPose == NULL )
+    {
+        pPose = new typeSkeletonPose();
+        evaluatePose( key, (F32)poseIndex / mPoseSampleRate, *pPose );
+    }
+
+    mPoseMutex.unlock();
+
+    return pPose;
+}
+
+//-----------------------------------------------------------------------------
+
+void SkeletonAsset::capturePose( const spSkeleton* pSkeleton, typeSkeletonPose& pose )
+{
+    // Reset the pose.
+    // NOTE:-   The capacity is kept so the pose doesn't reallocate every capture.
+    pose.clear();
+
+    F32 vertexPositions[8];
+    for (int i = 0; i < pSkeleton->slotCount; ++i)
+    {
+        spSlot* slot = pSkeleton->slots[i];
+        spAttachment* attachment = slot->attachment;
+
+        if (!attachment || attachment->type != ATTACHMENT_REGION)
+            continue;
+
+        spRegionAttachment* regionAttachment = (spRegionAttachment*)attachment;
+        spRegionAttachment_computeWorldVertices(regionAttachment, pSkeleton->x, pSkeleton->y, slot->bone, vertexPositions);
+
+        pose.increment();
+        SkeletonPoseRegion& region = pose.last();
+
+        region.mFrameName = attachment->name;
+        region.mColor.set( slot->r, slot->g, slot->b, slot->a );
+
+        region.mVertices[0].x = vertexPositions[VERTEX_X1];
+        region.mVertices[0].y = vertexPositions[VERTEX_Y1];
+        region.mVertices[1].x = vertexPositions[VERTEX_X4];
+        region.mVertices[1].y = vertexPositions[VERTEX_Y4];
+        region.mVertices[2].x = vertexPositions[VERTEX_X3];
+        region.mVertices[2].y = vertexPositions[VERTEX_Y3];
+        region.mVertices[3].x = vertexPositions[VERTEX_X2];
+        region.mVertices[3].y = vertexPositions[VERTEX_Y2];
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void SkeletonAsset::clearPoses( void )
+{
+    // Delete the pose tracks.
+    for ( S32 trackIndex = 0; trackIndex < mPoseTracks.size(); ++trackIndex )
+    {
+        SkeletonPoseTrack* pPoseTrack = mPoseTracks[trackIndex];
+
+        for ( S32 poseIndex = 0; poseIndex < pPoseTrack->mPoses.size(); ++poseIndex )
+            delete pPoseTrack->mPoses[poseIndex];
+
+        delete pPoseTrack;
+    }
+    mPoseTracks.clear();
+
+    // Dispose of the pose skeleton.
+    if (mpPoseSkeleton)
+    {
+        spSkeleton_dispose(mpPoseSkeleton);
+        mpPoseSkeleton = NULL;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void SkeletonAsset::bakePoses( void )
+{
+    // Finish if pose sharing is disabled or there's no skeleton data.
+    if ( mPoseSampleRate <= 0.0f || mSkeletonData == NULL )
+        return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(SkeletonAsset_BakePoses);
+
+    // Bake every animation with the default key.
+    SkeletonPoseKey key;
+    key.mpSkin = NULL;
+    key.mFlipX = false;
+    key.mFlipY = false;
+    key.mRootBoneScale.SetZero();
+    key.mRootBoneOffset.SetZero();
+
+    for ( S32 animationIndex = 0; animationIndex < mSkeletonData->animationCount; ++animationIndex )
+    {
+        key.mpAnimation = mSkeletonData->animations[animationIndex];
+
+        // Fetch the pose track.
+        SkeletonPoseTrack* pPoseTrack = findPoseTrack( key );
+
+        // Evaluate any poses that haven't been already.
+        for ( S32 poseIndex = 0; poseIndex < pPoseTrack->mPoses.size(); ++poseIndex )
+        {
+            if ( pPoseTrack->mPoses[poseIndex] != NULL )
+                continue;
+
+            pPoseTrack->mPoses[poseIndex] = new typeSkeletonPose();
+            evaluatePose( key, (F32)poseIndex / mPoseSampleRate, *pPoseTrack->mPoses[poseIndex] );
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+SkeletonAsset::SkeletonPoseTrack* SkeletonAsset::findPoseTrack( const SkeletonPoseKey& key )
+{
+    // Search the existing tracks.
+    for ( S32 trackIndex = 0; trackIndex < mPoseTracks.size(); ++trackIndex )
+    {
+        if ( mPoseTracks[trackIndex]->mKey == key )
+            return mPoseTracks[trackIndex];
+    }
+
+    // Create a track with a pose for each sample across the animation duration.
+    SkeletonPoseTrack* pPoseTrack = new SkeletonPoseTrack();
+    pPoseTrack->mKey = key;
+
+    const U32 poseCount = (U32)mFloor( key.mpAnimation->duration * mPoseSampleRate ) + 1;
+    pPoseTrack->mPoses.setSize( poseCount );
+    for ( U32 poseIndex = 0; poseIndex < poseCount; ++poseIndex )
+        pPoseTrack->mPoses[poseIndex] = NULL;
+
+    mPoseTracks.push_back( pPoseTrack );
+
+    return pPoseTrack;
+}
+
+//-----------------------------------------------------------------------------
+
+void SkeletonAsset::evaluatePose( const SkeletonPoseKey& key, const F32 animationTime, typeSkeletonPose& pose )
+{
+    // Create the pose skeleton if required.
+    if (!mpPoseSkeleton)
+        mpPoseSkeleton = spSkeleton_create(mSkeletonData);
+
+    // Reset the pose skeleton.
+    spSkeleton_setSkin(mpPoseSkeleton, key.mpSkin);
+    spSkeleton_setToSetupPose(mpPoseSkeleton);
+
+    if (key.mRootBoneScale.notZero())
+    {
+        spBone* rootBone = mpPoseSkeleton->root;
+        rootBone->scaleX = key.mRootBoneScale.x;
+        rootBone->scaleY = key.mRootBoneScale.y;
+    }
+
+    if (key.mRootBoneOffset.notZero())
+    {
+        spBone* rootBone = mpPoseSkeleton->root;
+        rootBone->x = key.mRootBoneOffset.x;
+        rootBone->y = key.mRootBoneOffset.y;
+    }
+
+    mpPoseSkeleton->flipX = key.mFlipX;
+    mpPoseSkeleton->flipY = key.mFlipY;
+
+    // Pose the skeleton.
+    // NOTE:-   No events are collected as the pose is shared.
+    spAnimation_apply(key.mpAnimation, mpPoseSkeleton, animationTime, animationTime, false, NULL, NULL);
+    spSkeleton_updateWorldTransform(mpPoseSkeleton);
+
+    // Capture the pose.
+    capturePose( mpPoseSkeleton, pose );
+}
+
+//-----------------------------------------------------------------------------
+
 void SkeletonAsset::onTamlPreWrite( void )
 {
     // Call parent.
@@ -31,6 +31,10 @@
 #include "2d/assets/ImageAsset.h"
 #endif
 
+#ifndef _PLATFORM_THREADS_MUTEX_H_
+#include "platform/threads/mutex.h"
+#endif
+
 #ifndef SPINE_SPINE_H_
 #include "spine/spine.h"
 #endif
@@ -48,6 +52,46 @@ private:
     bool                            mAtlasDirty;
 
 public:
+    /// Skeleton pose region.
+    /// The world vertices and color of a single visible region attachment.
+    /// The frame name is owned by the skeleton data.
+    struct SkeletonPoseRegion
+    {
+        const char*                 mFrameName;
+        Vector2                     mVertices[4];
+        ColorF                      mColor;
+    };
+
+    typedef Vector<SkeletonPoseRegion> typeSkeletonPose;
+
+    /// Skeleton pose key.
+    /// Everything other than the animation time that changes the pose of a skeleton playing a single animation.
+    struct SkeletonPoseKey
+    {
+        spAnimation*                mpAnimation;
+        spSkin*                     mpSkin;
+        bool                        mFlipX;
+        bool                        mFlipY;
+        Vector2                     mRootBoneScale;
+        Vector2                     mRootBoneOffset;
+
+        inline bool operator==( const SkeletonPoseKey& key ) const
+        {
+            return  mpAnimation == key.mpAnimation && mpSkin == key.mpSkin &&
+                    mFlipX == key.mFlipX && mFlipY == key.mFlipY &&
+                    mRootBoneScale == key.mRootBoneScale && mRootBoneOffset == key.mRootBoneOffset;
+        }
+    };
+
+    /// Skeleton pose track.
+    /// The poses of an animation sampled at the pose sample-rate.  Each pose is evaluated when first used
+    /// (or up-front when baked) and is then shared by every skeleton object with the same key.
+    struct SkeletonPoseTrack
+    {
+        SkeletonPoseKey             mKey;
+        Vector<typeSkeletonPose*>   mPoses;
+    };
+
     StringTableEntry                mSkeletonFile;
     StringTableEntry                mAtlasFile;
     AssetPtr<ImageAsset>            mImageAsset;
@@ -55,6 +99,14 @@ public:
     spSkeletonData*                 mSkeletonData;
     spAnimationStateData*           mStateData;
 
+private:
+    /// Pose sharing.
+    F32                             mPoseSampleRate;
+    bool                            mBakePoses;
+    Vector<SkeletonPoseTrack*>      mPoseTracks;
+    spSkeleton*                     mpPoseSkeleton;
+    Mutex                           mPoseMutex;
+
 public:
     SkeletonAsset();
     virtual ~SkeletonAsset();
@@ -73,12 +125,32 @@ public:
     
     virtual bool            isAssetValid( void ) const;
 
+    /// Pose sharing.
+    /// Skeleton objects playing a single animation share poses sampled at the pose sample-rate (zero disables sharing).
+    /// Baking evaluates every pose of every animation (with the default skin and no flipping or root bone changes) up-front.
+    void                    setPoseSampleRate( const F32 sampleRate );
+    inline F32              getPoseSampleRate( void ) const                 { return mPoseSampleRate; }
+    void                    setBakePoses( const bool bakePoses );
+    inline bool             getBakePoses( void ) const                      { return mBakePoses; }
+
+    /// Find the shared pose for the key at the specified animation time, evaluating it if required.
+    /// Returns NULL if pose sharing is disabled.  This is safe to call from any thread.
+    const typeSkeletonPose* findPose( const SkeletonPoseKey& key, const F32 animationTime );
+
+    /// Capture the pose of a skeleton whose world transform has been updated.
+    /// This is safe to call from any thread.
+    static void             capturePose( const spSkeleton* pSkeleton, typeSkeletonPose& pose );
+
     /// Declare Console Object.
     DECLARE_CONOBJECT(SkeletonAsset);
 
 private:
     void buildAtlasData( void );
     void buildSkeletonData( void );
+    void clearPoses( void );
+    void bakePoses( void );
+    SkeletonPoseTrack* findPoseTrack( const SkeletonPoseKey& key );
+    void evaluatePose( const SkeletonPoseKey& key, const F32 animationTime, typeSkeletonPose& pose );
 
 protected:
     virtual void initializeAsset( void );
@@ -96,6 +168,10 @@ protected:
     static bool writeSkeletonFile( void* obj, StringTableEntry pFieldName ) { return static_cast<SkeletonAsset*>(obj)->getSkeletonFile() != StringTable->EmptyString; }
     static bool setAtlasFile( void* obj, const char* data )                 { static_cast<SkeletonAsset*>(obj)->setAtlasFile(data); return false; }
     static bool writeAtlasFile( void* obj, StringTableEntry pFieldName )    { return static_cast<SkeletonAsset*>(obj)->getAtlasFile() != StringTable->EmptyString; }
+    static bool setPoseSampleRate( void* obj, const char* data )            { static_cast<SkeletonAsset*>(obj)->setPoseSampleRate(dAtof(data)); return false; }
+    static bool writePoseSampleRate( void* obj, StringTableEntry pFieldName ) { return mNotZero( static_cast<SkeletonAsset*>(obj)->getPoseSampleRate() ); }
+    static bool setBakePoses( void* obj, const char* data )                 { static_cast<SkeletonAsset*>(obj)->setBakePoses(dAtob(data)); return false; }
+    static bool writeBakePoses( void* obj, StringTableEntry pFieldName )    { return static_cast<SkeletonAsset*>(obj)->getBakePoses() == true; }
 };
 
 #endif // _SKELETON_ASSET_H_
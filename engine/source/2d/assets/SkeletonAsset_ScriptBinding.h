@@ -62,4 +62,46 @@ ConsoleMethodWithDocs(SkeletonAsset, getSkeletonFile, ConsoleString, 2, 2, ())
 
 //------------------------------------------------------------------------------
 
+/*! Sets the rate (per second) that poses are sampled and shared between skeleton objects playing the same animation.
+    @param sampleRate The pose sample-rate.  Zero disables pose sharing.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(SkeletonAsset, setPoseSampleRate, ConsoleVoid, 3, 3, (sampleRate))
+{
+    object->setPoseSampleRate( dAtof(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the rate (per second) that poses are sampled and shared between skeleton objects playing the same animation.
+    @return Returns the pose sample-rate.
+*/
+ConsoleMethodWithDocs(SkeletonAsset, getPoseSampleRate, ConsoleFloat, 2, 2, ())
+{
+    return object->getPoseSampleRate();
+}
+
+//------------------------------------------------------------------------------
+
+/*! Sets whether all the poses of every animation are evaluated when the asset is loaded or not.
+    @param bakePoses Whether to bake the poses or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(SkeletonAsset, setBakePoses, ConsoleVoid, 3, 3, (bool bakePoses))
+{
+    object->setBakePoses( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether all the poses of every animation are evaluated when the asset is loaded or not.
+    @return Returns whether the poses are baked or not.
+*/
+ConsoleMethodWithDocs(SkeletonAsset, getBakePoses, ConsoleBool, 2, 2, ())
+{
+    return object->getBakePoses();
+}
+
+//------------------------------------------------------------------------------
+
 ConsoleMethodGroupEndWithDocs(SkeletonAsset)
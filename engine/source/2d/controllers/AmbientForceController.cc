@@ -78,10 +78,21 @@ void AmbientForceController::copyTo(SimObject* object)
 
 void AmbientForceController::integrate( Scene* pScene, const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats )
 {
+    // Keep the membership in step with any control area.
+    updateControlArea( pScene );
+
     // Process all the scene objects.
-    for( SceneObjectSet::iterator itr = begin(); itr != end(); ++itr )
-    {
-        // Apply the force.
-        (*itr)->applyForce( mForce, true );
-    }
+    integrateRange( pScene, integrateObjects, this, (U32)size() );
+}
+
+//------------------------------------------------------------------------------
+
+void AmbientForceController::integrateObjects( void* pContext, const U32 start, const U32 end )
+{
+    // Fetch the controller.
+    AmbientForceController* pController = static_cast<AmbientForceController*>( pContext );
+
+    // Apply the force.
+    for ( U32 index = start; index < end; ++index )
+        (*pController)[index]->applyForce( pController->mForce, true );
 }
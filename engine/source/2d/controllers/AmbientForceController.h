@@ -40,6 +40,8 @@ private:
 
     Vector2 mForce;
 
+    static void integrateObjects( void* pContext, const U32 start, const U32 end );
+
 public:
     AmbientForceController();
     virtual ~AmbientForceController();
@@ -49,6 +51,7 @@ public:
 
     /// Integration.
     virtual void integrate( Scene* pScene, const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
+    virtual bool canIntegrateInParallel( void ) const { return true; }
 
     inline void setForce( const Vector2& force ) { mForce = force; }
     inline const Vector2& getForce( void ) const { return mForce; }
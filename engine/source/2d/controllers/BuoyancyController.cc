@@ -104,109 +104,121 @@ void BuoyancyController::copyTo(SimObject* object)
 
 void BuoyancyController::integrate( Scene* pScene, const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats )
 {
-    // Prepare query filter.
-    WorldQuery* pWorldQuery = prepareQueryFilter( pScene );
+    // Pick the objects in the fluid area.
+    const typeSceneObjectVector& pickedObjects = pickControlArea( pScene, mFluidArea );
 
-    // Query for candidate objects.
-    pWorldQuery->anyQueryAABB( mFluidArea ); 
+    // Configure the integration state.
+    IntegrateState integrateState;
+    integrateState.mpController = this;
+    integrateState.mppSceneObjects = pickedObjects.address();
 
-    // Fetch results.
-    typeWorldQueryResultVector& queryResults = pWorldQuery->getQueryResults();
+    // Integrate the picked objects.
+    integrateRange( pScene, integrateObjects, &integrateState, (U32)pickedObjects.size() );
+}
 
-    // Iterate the results.
-    for ( U32 n = 0; n < (U32)queryResults.size(); n++ )
-    {
-        // Fetch the scene object.
-        SceneObject* pSceneObject = queryResults[n].mpSceneObject;
+//------------------------------------------------------------------------------
 
-        // Skip if asleep.
-        if ( !pSceneObject->getAwake() )
-            continue;
+void BuoyancyController::integrateObjects( void* pContext, const U32 start, const U32 end )
+{
+    // Fetch the integration state.
+    const IntegrateState* pIntegrateState = static_cast<const IntegrateState*>( pContext );
 
-        // Ignore if it's a static body.
-        if ( pSceneObject->getBodyType() == b2_staticBody )
-            continue;
+    // Integrate the scene objects.
+    for ( U32 index = start; index < end; ++index )
+        pIntegrateState->mpController->integrateObject( pIntegrateState->mppSceneObjects[index] );
+}
 
-        // Fetch the shape count.
-        const U32 shapeCount = pSceneObject->getCollisionShapeCount();
+//------------------------------------------------------------------------------
 
-        // Skip if no collision shapes.
-        if ( shapeCount == 0 )
-            continue;
+void BuoyancyController::integrateObject( SceneObject* pSceneObject )
+{
+    // Skip if asleep.
+    if ( !pSceneObject->getAwake() )
+        return;
 
-        // Fetch the body transform.
-        const b2Transform& bodyTransform = pSceneObject->getBody()->GetTransform();;
+    // Ignore if it's a static body.
+    if ( pSceneObject->getBodyType() == b2_staticBody )
+        return;
 
-        Vector2 areaCenter(0.0f, 0.0f);
-        Vector2 massCenter(0.0f, 0.0f);
-        F32 area = 0.0f;
-        F32 mass = 0.0f;
+    // Fetch the shape count.
+    const U32 shapeCount = pSceneObject->getCollisionShapeCount();
 
-        // Yes, so iterate them.
-        for( U32 i = 0; i < shapeCount; ++i )
-        {
-            // Fetch the fixture definition.
-            const b2FixtureDef fixtureDef = pSceneObject->getCollisionShapeDefinition( i );
+    // Skip if no collision shapes.
+    if ( shapeCount == 0 )
+        return;
 
-            // Fetch the shape.
-            const b2Shape* pShape = fixtureDef.shape;
+    // Fetch the body transform.
+    const b2Transform& bodyTransform = pSceneObject->getBody()->GetTransform();
 
-            Vector2 shapeCenter(0.0f, 0.0f);
-            
-            F32 shapeArea = 0.0f;
+    Vector2 areaCenter(0.0f, 0.0f);
+    Vector2 massCenter(0.0f, 0.0f);
+    F32 area = 0.0f;
+    F32 mass = 0.0f;
 
-            // Calculate the area for the shape type.
-            if ( pShape->GetType() == b2Shape::e_circle )
-            {
-                shapeArea = ComputeCircleSubmergedArea( bodyTransform, dynamic_cast<const b2CircleShape*>(pShape), shapeCenter );
-            }
-            else if ( pShape->GetType() == b2Shape::e_polygon)
-            {
-                shapeArea = ComputePolygonSubmergedArea( bodyTransform, dynamic_cast<const b2PolygonShape*>(pShape), shapeCenter );
-            }
-            else if ( pShape->GetType() == b2Shape::e_edge || pShape->GetType() == b2Shape::e_chain )
-            {
-                shapeArea = 0.0f;
-            }
-            else
-            {
-                // Skip if unknown shape type.
-                continue;
-            }
+    // Yes, so iterate them.
+    for( U32 i = 0; i < shapeCount; ++i )
+    {
+        // Fetch the fixture definition.
+        const b2FixtureDef fixtureDef = pSceneObject->getCollisionShapeDefinition( i );
 
-            // Calculate area.
-            area += shapeArea;
-            areaCenter.x += shapeArea * shapeCenter.x;
-            areaCenter.y += shapeArea * shapeCenter.y;
+        // Fetch the shape.
+        const b2Shape* pShape = fixtureDef.shape;
 
-            // Calculate mass.
-            const F32 shapeDensity = mUseShapeDensity ? fixtureDef.density : 1.0f;
-            mass += shapeArea*shapeDensity;
-            massCenter.x += shapeArea * shapeCenter.x * shapeDensity;
-            massCenter.y += shapeArea * shapeCenter.y * shapeDensity;
-        }
+        Vector2 shapeCenter(0.0f, 0.0f);
+        
+        F32 shapeArea = 0.0f;
 
-        // Skip not in water.
-        if( area < b2_epsilon )
+        // Calculate the area for the shape type.
+        if ( pShape->GetType() == b2Shape::e_circle )
+        {
+            shapeArea = ComputeCircleSubmergedArea( bodyTransform, dynamic_cast<const b2CircleShape*>(pShape), shapeCenter );
+        }
+        else if ( pShape->GetType() == b2Shape::e_polygon)
+        {
+            shapeArea = ComputePolygonSubmergedArea( bodyTransform, dynamic_cast<const b2PolygonShape*>(pShape), shapeCenter );
+        }
+        else if ( pShape->GetType() == b2Shape::e_edge || pShape->GetType() == b2Shape::e_chain )
+        {
+            shapeArea = 0.0f;
+        }
+        else
+        {
+            // Skip if unknown shape type.
             continue;
+        }
 
-        // Calculate area/mass centers.
-        areaCenter.x /= area;
-        areaCenter.y /= area;
-        massCenter.x /= mass;
-        massCenter.y /= mass;
+        // Calculate area.
+        area += shapeArea;
+        areaCenter.x += shapeArea * shapeCenter.x;
+        areaCenter.y += shapeArea * shapeCenter.y;
 
-        // Buoyancy
-        const Vector2 buoyancyForce = -mFluidDensity * area * mFluidGravity;
-        pSceneObject->applyForce(buoyancyForce, massCenter);
+        // Calculate mass.
+        const F32 shapeDensity = mUseShapeDensity ? fixtureDef.density : 1.0f;
+        mass += shapeArea*shapeDensity;
+        massCenter.x += shapeArea * shapeCenter.x * shapeDensity;
+        massCenter.y += shapeArea * shapeCenter.y * shapeDensity;
+    }
 
-        // Linear drag
-        const Vector2 dragForce = (pSceneObject->getLinearVelocityFromWorldPoint(areaCenter) - mFlowVelocity) * (-mLinearDrag * area);
-        pSceneObject->applyForce(dragForce, areaCenter );
+    // Skip not in water.
+    if( area < b2_epsilon )
+        return;
 
-        // Angular drag
-        pSceneObject->applyTorque( -pSceneObject->getInertia() / pSceneObject->getMass() * area * pSceneObject->getAngularVelocity()*mAngularDrag );
-    }
+    // Calculate area/mass centers.
+    areaCenter.x /= area;
+    areaCenter.y /= area;
+    massCenter.x /= mass;
+    massCenter.y /= mass;
+
+    // Buoyancy
+    const Vector2 buoyancyForce = -mFluidDensity * area * mFluidGravity;
+    pSceneObject->applyForce(buoyancyForce, massCenter);
+
+    // Linear drag
+    const Vector2 dragForce = (pSceneObject->getLinearVelocityFromWorldPoint(areaCenter) - mFlowVelocity) * (-mLinearDrag * area);
+    pSceneObject->applyForce(dragForce, areaCenter );
+
+    // Angular drag
+    pSceneObject->applyTorque( -pSceneObject->getInertia() / pSceneObject->getMass() * area * pSceneObject->getAngularVelocity()*mAngularDrag );
 }
 
 //------------------------------------------------------------------------------
@@ -62,6 +62,16 @@ private:
     /// The outer fluid surface normal.
     Vector2 mSurfaceNormal;
 
+    /// Integration state shared by the worker threads.
+    struct IntegrateState
+    {
+        BuoyancyController* mpController;
+        SceneObject* const* mppSceneObjects;
+    };
+
+    static void integrateObjects( void* pContext, const U32 start, const U32 end );
+    void integrateObject( SceneObject* pSceneObject );
+
 protected:
     F32 ComputeCircleSubmergedArea( const b2Transform& bodyTransform, const b2CircleShape* pShape, Vector2& center );
     F32 ComputePolygonSubmergedArea( const b2Transform& bodyTransform, const b2PolygonShape* pShape, Vector2& center );
@@ -75,6 +85,7 @@ public:
 
     /// Integration.
     virtual void integrate( Scene* pScene, const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
+    virtual bool canIntegrateInParallel( void ) const { return true; }
 
     // Scene render.
     virtual void renderOverlay( Scene* pScene, const SceneRenderState* pSceneRenderState, BatchRender* pBatchRenderer );
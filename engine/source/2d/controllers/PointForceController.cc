@@ -100,9 +100,6 @@ void PointForceController::integrate( Scene* pScene, const F32 totalTime, const
     if ( mIsZero( mForce ) || mIsZero( mRadius ) )
         return;
 
-    // Prepare query filter.
-    WorldQuery* pWorldQuery = prepareQueryFilter( pScene );
-
     // Fetch the current position.
     const Vector2 currentPosition = getCurrentPosition();
 
@@ -111,96 +108,112 @@ void PointForceController::integrate( Scene* pScene, const F32 totalTime, const
     aabb.lowerBound.Set( currentPosition.x - mRadius, currentPosition.y - mRadius );
     aabb.upperBound.Set( currentPosition.x + mRadius, currentPosition.y + mRadius );
 
-    // Query for candidate objects.
-    pWorldQuery->anyQueryAABB( aabb ); 
-
-    // Fetch results.
-    typeWorldQueryResultVector& queryResults = pWorldQuery->getQueryResults();
+    // Pick the candidate objects.
+    const typeSceneObjectVector& pickedObjects = pickControlArea( pScene, aabb );
 
-    // Fetch result count.
-    const U32 resultCount = (U32)queryResults.size();
+    // Fetch picked count.
+    const U32 pickedCount = (U32)pickedObjects.size();
 
     // Finish if nothing to process.
-    if ( resultCount == 0 )
+    if ( pickedCount == 0 )
         return;
 
+    // Configure the integration state.
+    IntegrateState integrateState;
+    integrateState.mpController = this;
+    integrateState.mppSceneObjects = pickedObjects.address();
+    integrateState.mCurrentPosition = currentPosition;
+
     // Calculate the radius squared.
-    const F32 radiusSqr = mRadius * mRadius;
+    integrateState.mRadiusSqr = mRadius * mRadius;
 
     // Calculate the force squared in-case we need it.
-    const F32 forceSqr = mForce * mForce * (( mForce < 0.0f ) ? -1.0f : 1.0f);
+    integrateState.mForceSqr = mForce * mForce * (( mForce < 0.0f ) ? -1.0f : 1.0f);
 
     // Calculate drag coefficients (time-integrated).
-    const F32 linearDrag = mClampF( mLinearDrag, 0.0f, 1.0f ) * elapsedTime;
-    const F32 angularDrag = mClampF( mAngularDrag, 0.0f, 1.0f ) * elapsedTime;
+    integrateState.mLinearDrag = mClampF( mLinearDrag, 0.0f, 1.0f ) * elapsedTime;
+    integrateState.mAngularDrag = mClampF( mAngularDrag, 0.0f, 1.0f ) * elapsedTime;
 
     // Fetch the tracked object.
-    const SceneObject* pTrackedObject = mTrackedObject;
+    integrateState.mpTrackedObject = mTrackedObject;
+
+    // Integrate the picked objects.
+    integrateRange( pScene, integrateObjects, &integrateState, pickedCount );
+}
+
+//------------------------------------------------------------------------------
+
+void PointForceController::integrateObjects( void* pContext, const U32 start, const U32 end )
+{
+    // Fetch the integration state.
+    const IntegrateState* pIntegrateState = static_cast<const IntegrateState*>( pContext );
+
+    // Integrate the scene objects.
+    for ( U32 index = start; index < end; ++index )
+        pIntegrateState->mpController->integrateObject( pIntegrateState->mppSceneObjects[index], *pIntegrateState );
+}
+
+//------------------------------------------------------------------------------
+
+void PointForceController::integrateObject( SceneObject* pSceneObject, const IntegrateState& state )
+{
+    // Ignore if it's the tracked object.
+    if ( pSceneObject == state.mpTrackedObject )
+        return;
+
+    // Ignore if it's a static body.
+    if ( pSceneObject->getBodyType() == b2_staticBody )
+        return;
 
-    // Iterate the results.
-    for ( U32 n = 0; n < resultCount; n++ )
+    // Calculate the force distance to the controllers current position.
+    Vector2 distanceForce = state.mCurrentPosition - pSceneObject->getPosition();
+
+    // Fetch distance squared.
+    const F32 distanceSqr = distanceForce.LengthSquared();
+
+    // Skip if the position is outside the radius or is centered on the controller.
+    if ( distanceSqr > state.mRadiusSqr || distanceSqr < FLT_EPSILON )
+        return;
+
+    // Non-Linear force?
+    if ( mNonLinear )
     {
-        // Fetch the scene object.
-        SceneObject* pSceneObject = queryResults[n].mpSceneObject;
-
-        // Ignore if it's the tracked object.
-        if ( pSceneObject == pTrackedObject )
-            continue;
-
-        // Ignore if it's a static body.
-        if ( pSceneObject->getBodyType() == b2_staticBody )
-            continue;
-
-        // Calculate the force distance to the controllers current position.
-        Vector2 distanceForce = currentPosition - pSceneObject->getPosition();
-
-        // Fetch distance squared.
-        const F32 distanceSqr = distanceForce.LengthSquared();
-
-        // Skip if the position is outside the radius or is centered on the controller.
-        if ( distanceSqr > radiusSqr || distanceSqr < FLT_EPSILON )
-            continue;
-
-        // Non-Linear force?
-        if ( mNonLinear )
-        {
-            // Yes, so use an approximation of the inverse-square law.
-            distanceForce *= (1.0f / distanceSqr) * forceSqr;
-        }
-        else
-        {
-            // No, so normalize to the specified force (linear).
-            distanceForce.Normalize( mForce );
-        }
-
-        // Apply the force.
-        pSceneObject->applyForce( distanceForce, true );
-
-        // Linear drag?
-        if ( linearDrag > 0.0f )
-        {
-            // Yes, so fetch linear velocity.
-            Vector2 linearVelocity = pSceneObject->getLinearVelocity();
-
-            // Calculate linear velocity change.
-            const Vector2 linearVelocityDelta = linearVelocity * linearDrag;
-
-            // Set linear velocity.
-            pSceneObject->setLinearVelocity( linearVelocity - linearVelocityDelta );
-        }
-
-        // Angular drag?
-        if ( angularDrag > 0.0f )
-        {
-            // Yes, so fetch angular velocity.
-            F32 angularVelocity = pSceneObject->getAngularVelocity();
-
-            // Calculate angular velocity change.
-            const F32 angularVelocityDelta = angularVelocity * angularDrag;
-
-            // Set angular velocity.
-            pSceneObject->setAngularVelocity( angularVelocity - angularVelocityDelta );
-        }
+        // Yes, so use an approximation of the inverse-square law.
+        distanceForce *= (1.0f / distanceSqr) * state.mForceSqr;
+    }
+    else
+    {
+        // No, so normalize to the specified force (linear).
+        distanceForce.Normalize( mForce );
+    }
+
+    // Apply the force.
+    pSceneObject->applyForce( distanceForce, true );
+
+    // Linear drag?
+    if ( state.mLinearDrag > 0.0f )
+    {
+        // Yes, so fetch linear velocity.
+        Vector2 linearVelocity = pSceneObject->getLinearVelocity();
+
+        // Calculate linear velocity change.
+        const Vector2 linearVelocityDelta = linearVelocity * state.mLinearDrag;
+
+        // Set linear velocity.
+        pSceneObject->setLinearVelocity( linearVelocity - linearVelocityDelta );
+    }
+
+    // Angular drag?
+    if ( state.mAngularDrag > 0.0f )
+    {
+        // Yes, so fetch angular velocity.
+        F32 angularVelocity = pSceneObject->getAngularVelocity();
+
+        // Calculate angular velocity change.
+        const F32 angularVelocityDelta = angularVelocity * state.mAngularDrag;
+
+        // Set angular velocity.
+        pSceneObject->setAngularVelocity( angularVelocity - angularVelocityDelta );
     }
 }
 
@@ -31,6 +31,10 @@
 #include "2d/core/vector2.h"
 #endif
 
+#ifndef _SIM_OBJECT_HANDLE_H_
+#include "sim/simObjectHandle.h"
+#endif
+
 //------------------------------------------------------------------------------
 
 class PointForceController : public PickingSceneController
@@ -57,7 +61,23 @@ private:
     F32 mAngularDrag;
 
     /// Tracked object.
-    SimObjectPtr<SceneObject> mTrackedObject;
+    SimObjectHandle<SceneObject> mTrackedObject;
+
+    /// Integration state shared by the worker threads.
+    struct IntegrateState
+    {
+        PointForceController*   mpController;
+        SceneObject* const*     mppSceneObjects;
+        Vector2                 mCurrentPosition;
+        F32                     mRadiusSqr;
+        F32                     mForceSqr;
+        F32                     mLinearDrag;
+        F32                     mAngularDrag;
+        const SceneObject*      mpTrackedObject;
+    };
+
+    static void integrateObjects( void* pContext, const U32 start, const U32 end );
+    void integrateObject( SceneObject* pSceneObject, const IntegrateState& state );
 
 public:
     PointForceController();
@@ -91,6 +111,7 @@ public:
 
     /// Integration.
     virtual void integrate( Scene* pScene, const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
+    virtual bool canIntegrateInParallel( void ) const { return true; }
 
     // Scene render.
     virtual void renderOverlay( Scene* pScene, const SceneRenderState* pSceneRenderState, BatchRender* pBatchRenderer );
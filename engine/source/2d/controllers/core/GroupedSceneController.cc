@@ -24,6 +24,10 @@
 #include "2d/controllers/core/GroupedSceneController.h"
 #endif
 
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
 // Script bindings.
 #include "2d/controllers/core/GroupedSceneController_ScriptBinding.h"
 
@@ -33,6 +37,26 @@ IMPLEMENT_CONOBJECT(GroupedSceneController);
 
 //------------------------------------------------------------------------------
 
+GroupedSceneController::GroupedSceneController() :
+    mUseControlArea( false )
+{
+    mControlArea.lowerBound.SetZero();
+    mControlArea.upperBound.SetZero();
+}
+
+//------------------------------------------------------------------------------
+
+void GroupedSceneController::initPersistFields()
+{
+    // Call parent.
+    Parent::initPersistFields();
+
+    addField( "UseControlArea", TypeBool, Offset(mUseControlArea, GroupedSceneController), &writeUseControlArea, "Whether the controlled objects are those in the control area rather than those added." );
+    addField( "ControlArea", Typeb2AABB, Offset(mControlArea, GroupedSceneController), &writeControlArea, "The area whose objects are controlled when using the control area." );
+}
+
+//------------------------------------------------------------------------------
+
 void GroupedSceneController::copyTo(SimObject* object)
 {
     // Call to parent.
@@ -47,5 +71,24 @@ void GroupedSceneController::copyTo(SimObject* object)
     // Add objects to the controller.
     for( SceneObjectSet::iterator objectItr = begin(); objectItr != end(); ++objectItr )
         pController->addObject( *objectItr );
+
+    // Copy the control area.
+    pController->setUseControlArea( getUseControlArea() );
+    pController->setControlArea( getControlArea() );
+}
+
+//------------------------------------------------------------------------------
+
+void GroupedSceneController::updateControlArea( Scene* pScene )
+{
+    // Stop following the control area if it's no longer used.
+    if ( !mUseControlArea )
+    {
+        clearRegion();
+        return;
+    }
+
+    // Keep the region in place.  This does nothing unless the area changed.
+    setRegion( pScene->getWorldQuery(), mControlArea );
 }
 
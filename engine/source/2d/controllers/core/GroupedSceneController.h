@@ -39,18 +39,40 @@
 #include "2d/controllers/core/SceneController.h"
 #endif
 
+#ifndef _WORLD_QUERY_H_
+#include "2d/scene/WorldQuery.h"
+#endif
+
 //------------------------------------------------------------------------------
 
-class GroupedSceneController : public SceneObjectSet, public SceneController
+/// A controller of a set of scene objects.
+///
+/// The set can be maintained by hand or, when a control area is used, by the world query:
+/// objects are added as their proxies enter the area and removed as they leave it (proxies are
+/// slightly larger than the objects) so the membership is kept without querying every tick.
+class GroupedSceneController : public SceneObjectSet, public SceneController, protected WorldQueryRegion
 {
     typedef SceneObjectSet Parent;
 
+private:
+    /// Whether the membership follows the control area.
+    bool mUseControlArea;
+
+    /// The control area.
+    b2AABB mControlArea;
+
 public:
-    GroupedSceneController() {}
+    GroupedSceneController();
     virtual ~GroupedSceneController() {}
 
+    static void initPersistFields();
     virtual void copyTo(SimObject* object);
 
+    inline void setUseControlArea( const bool useControlArea ) { mUseControlArea = useControlArea; }
+    inline bool getUseControlArea( void ) const { return mUseControlArea; }
+    inline void setControlArea( const b2AABB& controlArea ) { mControlArea = controlArea; }
+    inline const b2AABB& getControlArea( void ) const { return mControlArea; }
+
     /// Integration.
     virtual void integrate( Scene* pScene, const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats ) {}
 
@@ -59,6 +81,16 @@ public:
 
     /// Declare Console Object.
     DECLARE_CONOBJECT( GroupedSceneController );
+
+protected:
+    /// Keep the membership in step with the control area, controllers call this when integrating.
+    void updateControlArea( Scene* pScene );
+
+    virtual void onRegionEnter( SceneObject* pSceneObject ) { addObject( pSceneObject ); }
+    virtual void onRegionLeave( SceneObject* pSceneObject ) { removeObject( pSceneObject ); }
+
+    static bool writeUseControlArea( void* obj, StringTableEntry pFieldName ) { return static_cast<GroupedSceneController*>(obj)->getUseControlArea(); }
+    static bool writeControlArea( void* obj, StringTableEntry pFieldName ) { return static_cast<GroupedSceneController*>(obj)->getUseControlArea(); }
 };
 
 #endif // _GROUPED_SCENE_CONTROLLER_H_
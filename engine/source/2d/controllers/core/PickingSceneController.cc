@@ -35,8 +35,10 @@ IMPLEMENT_CONOBJECT(PickingSceneController);
 
 PickingSceneController::PickingSceneController() :
         mControlGroupMask( MASK_ALL ),
-        mControlLayerMask( MASK_ALL )
+        mControlLayerMask( MASK_ALL ),
+        mTrackControlArea( true )
 {
+    VECTOR_SET_ASSOCIATION( mPickedObjects );
 }
 
 //------------------------------------------------------------------------------
@@ -47,6 +49,16 @@ PickingSceneController::~PickingSceneController()
 
 //------------------------------------------------------------------------------
 
+void PickingSceneController::initPersistFields()
+{
+    // Call parent.
+    Parent::initPersistFields();
+
+    addProtectedField( "TrackControlArea", TypeBool, Offset(mTrackControlArea, PickingSceneController), &setTrackControlArea, &defaultProtectedGetFn, &writeTrackControlArea, "Whether the objects in the control area are tracked as they move rather than queried every tick." );
+}
+
+//------------------------------------------------------------------------------
+
 void PickingSceneController::copyTo(SimObject* object)
 {
     // Call to parent.
@@ -61,6 +73,18 @@ void PickingSceneController::copyTo(SimObject* object)
     // Set masks.
     pController->setControlGroupMask( getControlGroupMask() );
     pController->setControlLayerMask( getControlLayerMask() );
+    pController->setTrackControlArea( getTrackControlArea() );
+}
+
+//------------------------------------------------------------------------------
+
+void PickingSceneController::setTrackControlArea( const bool trackControlArea )
+{
+    mTrackControlArea = trackControlArea;
+
+    // Stop tracking the area.
+    if ( !mTrackControlArea )
+        mControlRegion.clearRegion();
 }
 
 //------------------------------------------------------------------------------
@@ -77,3 +101,45 @@ WorldQuery* PickingSceneController::prepareQueryFilter( Scene* pScene, const boo
     return pWorldQuery;
 }
 
+//------------------------------------------------------------------------------
+
+const typeSceneObjectVector& PickingSceneController::pickControlArea( Scene* pScene, const b2AABB& area )
+{
+    // Clear the picked objects.
+    mPickedObjects.clear();
+
+    // Are we tracking the control area?
+    if ( !mTrackControlArea )
+    {
+        // No, so query the area.
+        WorldQuery* pWorldQuery = prepareQueryFilter( pScene );
+        pWorldQuery->anyQueryAABB( area );
+
+        // Fetch the results.
+        const typeWorldQueryResultVector& queryResults = pWorldQuery->getQueryResults();
+        for ( typeWorldQueryResultVector::const_iterator resultItr = queryResults.begin(); resultItr != queryResults.end(); ++resultItr )
+            mPickedObjects.push_back( resultItr->mpSceneObject );
+
+        return mPickedObjects;
+    }
+
+    // Yes, so keep the region in place.
+    mControlRegion.setRegion( pScene->getWorldQuery(), area );
+
+    // Fetch the query filter.
+    const WorldQueryFilter queryFilter( mControlLayerMask, mControlGroupMask, true, false, true, true );
+
+    // Pick the tracked objects that pass the filter and overlap the area.
+    const typeSceneObjectVector& regionObjects = mControlRegion.getRegionObjects();
+    for ( typeSceneObjectVector::const_iterator objectItr = regionObjects.begin(); objectItr != regionObjects.end(); ++objectItr )
+    {
+        SceneObject* pSceneObject = *objectItr;
+
+        if ( WorldQuery::isFiltered( pSceneObject, queryFilter ) || !b2TestOverlap( pSceneObject->getAABB(), area ) )
+            continue;
+
+        mPickedObjects.push_back( pSceneObject );
+    }
+
+    return mPickedObjects;
+}
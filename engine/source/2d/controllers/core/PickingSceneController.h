@@ -49,16 +49,26 @@ private:
     U32 mControlGroupMask;
     U32 mControlLayerMask;
 
+    /// Whether picked objects come from a tracked region rather than a query each tick.
+    bool mTrackControlArea;
+
+    /// The tracked control area and the objects last picked from it.
+    WorldQueryRegion mControlRegion;
+    typeSceneObjectVector mPickedObjects;
+
 public:
     PickingSceneController();
     virtual ~PickingSceneController();
 
+    static void initPersistFields();
     virtual void copyTo(SimObject* object);
 
     inline void setControlGroupMask( const U32 groupMask ) { mControlGroupMask = groupMask; }
     inline U32 getControlGroupMask( void ) const { return mControlGroupMask; }
     inline void setControlLayerMask( const U32 layerMask ) { mControlLayerMask = layerMask; }
     inline U32 getControlLayerMask( void ) const { return mControlLayerMask; }
+    void setTrackControlArea( const bool trackControlArea );
+    inline bool getTrackControlArea( void ) const { return mTrackControlArea; }
 
     /// Integration.
     virtual void integrate( Scene* pScene, const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats ) {}
@@ -71,6 +81,14 @@ public:
 
 protected:
     WorldQuery* prepareQueryFilter( Scene* pScene, const bool clearQuery = true );
+
+    /// Pick the objects overlapping the area that pass the control masks.
+    /// When tracking the control area this only checks the objects the world query has kept in the area
+    /// so an area that does not move costs no query at all.
+    const typeSceneObjectVector& pickControlArea( Scene* pScene, const b2AABB& area );
+
+    static bool setTrackControlArea( void* obj, const char* data ) { static_cast<PickingSceneController*>(obj)->setTrackControlArea( dAtob(data) ); return false; }
+    static bool writeTrackControlArea( void* obj, StringTableEntry pFieldName ) { return !static_cast<PickingSceneController*>(obj)->getTrackControlArea(); }
 };
 
 #endif // _PICKING_SCENE_CONTROLLER_H_
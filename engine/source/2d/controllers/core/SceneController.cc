@@ -0,0 +1,61 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#ifndef _SCENE_CONTROLLER_H_
+#include "2d/controllers/core/SceneController.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+#ifndef _PROFILER_H_
+#include "debug/profiler.h"
+#endif
+
+//------------------------------------------------------------------------------
+
+static const U32 sParallelControllerChunkSize = 128;
+static const U32 sParallelControllerMinimumObjects = 256;
+
+//------------------------------------------------------------------------------
+
+void SceneController::integrateRange( Scene* pScene, ThreadPool::RangeFunction pRangeFunction, void* pContext, const U32 itemCount )
+{
+    // Finish if nothing to process.
+    if ( itemCount == 0 )
+        return;
+
+    // Process serially if the controller or scene doesn't allow parallel integration or there are too few items.
+    if ( !canIntegrateInParallel() || !pScene->getParallelControllers() || itemCount < sParallelControllerMinimumObjects )
+    {
+        pRangeFunction( pContext, 0, itemCount );
+        return;
+    }
+
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneController_ParallelIntegrate);
+
+    // Process in parallel.
+    ThreadPool::getGlobal()->parallelFor( pRangeFunction, pContext, itemCount, sParallelControllerChunkSize );
+}
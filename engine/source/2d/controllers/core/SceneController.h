@@ -23,6 +23,10 @@
 #ifndef _SCENE_CONTROLLER_H_
 #define _SCENE_CONTROLLER_H_
 
+#ifndef _PLATFORM_THREADS_THREADPOOL_H_
+#include "platform/threads/threadPool.h"
+#endif
+
 //------------------------------------------------------------------------------
 
 class Scene;
@@ -41,8 +45,15 @@ public:
     /// Integration.
     virtual void integrate( Scene* pScene, const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats ) = 0;
 
+    /// Whether the controller only touches the body of each object it processes so objects can be processed across worker threads.
+    virtual bool canIntegrateInParallel( void ) const { return false; }
+
     // Scene render.
     virtual void renderOverlay( Scene* pScene, const SceneRenderState* pSceneRenderState, BatchRender* pBatchRenderer ) = 0;
+
+protected:
+    /// Process "itemCount" items with the range function, across worker threads if the controller and the scene allow it.
+    void integrateRange( Scene* pScene, ThreadPool::RangeFunction pRangeFunction, void* pContext, const U32 itemCount );
 };
 
 #endif // _SCENE_CONTROLLER_H_
@@ -0,0 +1,206 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#include "2d/core/AnimationClock.h"
+
+#ifndef _TICKABLE_H_
+#include "platform/Tickable.h"
+#endif
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+AnimationClock::typeAnimationClockVector AnimationClock::smAnimationClocks;
+
+//-----------------------------------------------------------------------------
+
+AnimationClock::AnimationClock( const AssetPtr<AnimationAsset>& animationAsset, const F32 timeScale ) :
+    mTimeScale( timeScale ),
+    mReferenceCount( 0 ),
+    mLastTick( Tickable::getLastTick() ),
+    mCurrentTime( 0.0f ),
+    mCurrentFrameIndex( 0 ),
+    mFrameDirty( true ),
+    mFrameValid( false ),
+    mpFrameArea( NULL )
+{
+    // Set the animation asset.
+    mAnimationAsset = animationAsset;
+}
+
+//-----------------------------------------------------------------------------
+
+void AnimationClock::update( void )
+{
+    // Finish if the clock has already been stepped this tick.
+    if ( mLastTick == Tickable::getLastTick() && !mFrameDirty )
+        return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(AnimationClock_Update);
+
+    // Calculate the time elapsed since the clock was last stepped.
+    const F32 elapsedTime = (F32)(Tickable::getLastTick() - mLastTick) * 0.001f;
+    mLastTick = Tickable::getLastTick();
+
+    // Fetch the validated frame count.
+    const S32 frameCount = mAnimationAsset->getNamedCellsMode() ?
+        mAnimationAsset->getValidatedNamedAnimationFrames().size() :
+        mAnimationAsset->getValidatedAnimationFrames().size();
+
+    // Finish if there are no frames to show.
+    const F32 totalIntegrationTime = mAnimationAsset->getAnimationTime();
+    if ( frameCount == 0 || mAnimationAsset->getImage().isNull() || totalIntegrationTime <= 0.0f )
+    {
+        mFrameValid = false;
+        return;
+    }
+
+    // Step the clock, wrapping it around the animation.
+    mCurrentTime = mFmod( mCurrentTime + elapsedTime * mTimeScale, totalIntegrationTime );
+    if ( mCurrentTime < 0.0f )
+        mCurrentTime += totalIntegrationTime;
+
+    // Calculate the current frame.
+    S32 frameIndex = (S32)(mCurrentTime / (totalIntegrationTime / frameCount));
+    if ( frameIndex >= frameCount )
+        frameIndex = frameCount-1;
+
+    // Finish if the frame has not changed.
+    if ( frameIndex == mCurrentFrameIndex && !mFrameDirty )
+        return;
+
+    // Update the frame.
+    mCurrentFrameIndex = frameIndex;
+    updateFrameArea();
+}
+
+//-----------------------------------------------------------------------------
+
+void AnimationClock::updateFrameArea( void )
+{
+    // Reset the frame.
+    mFrameDirty = false;
+    mFrameValid = false;
+    mpFrameArea = NULL;
+
+    // Fetch the image asset.
+    const AssetPtr<ImageAsset>& imageAsset = mAnimationAsset->getImage();
+
+    // Named frames?
+    if ( !mAnimationAsset->getNamedCellsMode() )
+    {
+        // No, so fetch the validated frames.
+        const Vector<S32>& validatedFrames = mAnimationAsset->getValidatedAnimationFrames();
+
+        // Finish if the frame is out of bounds.
+        if ( mCurrentFrameIndex >= validatedFrames.size() )
+            return;
+
+        // Finish if the image frame is out of bounds.
+        const U32 imageFrame = validatedFrames[mCurrentFrameIndex];
+        if ( imageFrame >= imageAsset->getFrameCount() )
+            return;
+
+        mpFrameArea = &imageAsset->getImageFrameArea( imageFrame );
+    }
+    else
+    {
+        // Yes, so fetch the validated frames.
+        const Vector<StringTableEntry>& validatedFrames = mAnimationAsset->getValidatedNamedAnimationFrames();
+
+        // Finish if the frame is out of bounds.
+        if ( mCurrentFrameIndex >= validatedFrames.size() )
+            return;
+
+        // Finish if the image does not contain the frame.
+        const char* pNamedFrame = validatedFrames[mCurrentFrameIndex];
+        if ( !imageAsset->containsFrame( pNamedFrame ) )
+            return;
+
+        mpFrameArea = &imageAsset->getImageFrameArea( pNamedFrame );
+    }
+
+    // Flag the frame as valid.
+    mFrameValid = true;
+}
+
+//-----------------------------------------------------------------------------
+
+AnimationClock* AnimationClock::acquire( const AssetPtr<AnimationAsset>& animationAsset, const F32 timeScale )
+{
+    // Sanity!
+    AssertFatal( animationAsset.notNull(), "AnimationClock::acquire() - Cannot acquire a clock without an animation asset." );
+
+    // Find an existing clock.
+    AnimationClock* pAnimationClock = NULL;
+    for ( typeAnimationClockVector::iterator clockItr = smAnimationClocks.begin(); clockItr != smAnimationClocks.end(); ++clockItr )
+    {
+        if ( (*clockItr)->getAnimationAsset() == (const AnimationAsset*)animationAsset && (*clockItr)->getTimeScale() == timeScale )
+        {
+            pAnimationClock = *clockItr;
+            break;
+        }
+    }
+
+    // Create a clock if we didn't find one.
+    if ( pAnimationClock == NULL )
+    {
+        pAnimationClock = new AnimationClock( animationAsset, timeScale );
+        smAnimationClocks.push_back( pAnimationClock );
+    }
+
+    // Reference the clock.
+    pAnimationClock->mReferenceCount++;
+
+    // The animation may have been refreshed since the clock last calculated its frame so recalculate it.
+    pAnimationClock->mFrameDirty = true;
+
+    return pAnimationClock;
+}
+
+//-----------------------------------------------------------------------------
+
+void AnimationClock::release( AnimationClock* pAnimationClock )
+{
+    // Sanity!
+    AssertFatal( pAnimationClock != NULL && pAnimationClock->mReferenceCount > 0, "AnimationClock::release() - Invalid clock release." );
+
+    // Finish if the clock is still referenced.
+    if ( --pAnimationClock->mReferenceCount > 0 )
+        return;
+
+    // Remove the clock.
+    for ( typeAnimationClockVector::iterator clockItr = smAnimationClocks.begin(); clockItr != smAnimationClocks.end(); ++clockItr )
+    {
+        if ( *clockItr == pAnimationClock )
+        {
+            smAnimationClocks.erase_fast( clockItr );
+            break;
+        }
+    }
+
+    delete pAnimationClock;
+}
@@ -0,0 +1,91 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#ifndef _ANIMATION_CLOCK_H_
+#define _ANIMATION_CLOCK_H_
+
+#ifndef _IMAGE_ASSET_H_
+#include "2d/assets/ImageAsset.h"
+#endif
+
+#ifndef _ANIMATION_ASSET_H_
+#include "2d/assets/AnimationAsset.h"
+#endif
+
+#ifndef _ASSET_PTR_H_
+#include "assets/assetPtr.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// A looping animation clock shared by every frame provider playing the same animation asset at the same time-scale.
+///
+/// The clock is stepped lazily at most once per tick by whichever subscriber asks for it first so the current frame
+/// index and its image frame area are calculated once per tick no matter how many providers show the animation.
+/// Clocks are reference counted by their subscribers and are destroyed when the last one releases it.
+class AnimationClock
+{
+private:
+    typedef Vector<AnimationClock*> typeAnimationClockVector;
+
+    AssetPtr<AnimationAsset>        mAnimationAsset;
+    F32                             mTimeScale;
+    U32                             mReferenceCount;
+
+    U32                             mLastTick;
+    F32                             mCurrentTime;
+    S32                             mCurrentFrameIndex;
+    bool                            mFrameDirty;
+    bool                            mFrameValid;
+    const ImageAsset::FrameArea*    mpFrameArea;
+
+    static typeAnimationClockVector smAnimationClocks;
+
+private:
+    AnimationClock( const AssetPtr<AnimationAsset>& animationAsset, const F32 timeScale );
+    ~AnimationClock() {}
+
+    void                            updateFrameArea( void );
+
+public:
+    /// Step the clock up to the current tick.
+    void                            update( void );
+
+    inline const AnimationAsset*    getAnimationAsset( void ) const { return mAnimationAsset; }
+    inline F32                      getTimeScale( void ) const { return mTimeScale; }
+    inline U32                      getReferenceCount( void ) const { return mReferenceCount; }
+    inline F32                      getCurrentTime( void ) const { return mCurrentTime; }
+    inline S32                      getFrameIndex( void ) const { return mCurrentFrameIndex; }
+    inline bool                     isFrameValid( void ) const { return mFrameValid; }
+    inline const ImageAsset::FrameArea& getFrameArea( void ) const { return mFrameValid ? *mpFrameArea : BadFrameArea; }
+
+    /// Fetch the shared clock for the animation and time-scale, creating it if required.
+    static AnimationClock*          acquire( const AssetPtr<AnimationAsset>& animationAsset, const F32 timeScale );
+
+    /// Release a clock fetched with acquire().
+    static void                     release( AnimationClock* pAnimationClock );
+
+    static inline U32               getClockCount( void ) { return (U32)smAnimationClocks.size(); }
+};
+
+#endif // _ANIMATION_CLOCK_H_
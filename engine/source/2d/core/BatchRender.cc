@@ -26,6 +26,18 @@
 #include "2d/sceneobject/SceneObject.h"
 #endif
 
+#ifndef _DGL_H_
+#include "graphics/dgl.h"
+#endif
+
+#ifndef _FRAME_STATS_H_
+#include "debug/frameStats.h"
+#endif
+
+#ifndef _GPU_TIMER_H_
+#include "debug/gpuTimer.h"
+#endif
+
 // Debug Profiling.
 #include "debug/profiler.h"
 
@@ -34,20 +46,37 @@
 BatchRender::BatchRender() :
     mTriangleCount( 0 ),
     mVertexCount( 0 ),
-    mTextureCoordCount( 0 ),
+    mLastTextureName( 0 ),
+    mpLastTextureBatch( NULL ),
     mIndexCount( 0 ),
     mColorCount( 0 ),
     NoColor( -1.0f, -1.0f, -1.0f ),
     mStrictOrderMode( false ),
     mpDebugStats( NULL ),
+    mBreakTracking( false ),
+    mpBatchSubmitter( NULL ),
     mBlendMode( true ),
     mSrcBlendFactor( GL_SRC_ALPHA ),
     mDstBlendFactor( GL_ONE_MINUS_SRC_ALPHA ),
     mBlendColor( ColorF(1.0f,1.0f,1.0f,1.0f) ),
     mAlphaTestMode( -1.0f ),
     mWireframeMode( false ),
-    mBatchEnabled( true )
+    mPixelSize( 0.0f ),
+    mBatchEnabled( true ),
+    mVertexBufferEnabled( true ),
+    mpCaptureCache( NULL ),
+    mpVertexDeform( NULL )
 {
+#ifdef BATCHRENDER_VERTEX_BUFFERS
+    // Reset vertex buffers.
+    // NOTE: These are generated on first use as there may be no GL context yet.
+    for ( U32 index = 0; index < BATCHRENDER_VERTEX_BUFFER_RING; ++index )
+    {
+        mVertexBufferNames[index] = 0;
+        mIndexBufferNames[index] = 0;
+    }
+    mVertexBufferRingIndex = 0;
+#endif
 }
 
 //-----------------------------------------------------------------------------
@@ -67,6 +96,9 @@ BatchRender::~BatchRender()
         delete (*itr);
     }
     mIndexVectorPool.clear();
+
+    // Destroy vertex buffers.
+    destroyVertexBuffers();
 }
 
 //-----------------------------------------------------------------------------
@@ -114,6 +146,14 @@ void BatchRender::SubmitTriangles(
     AssertFatal( vertexCount % 3 == 0, "BatchRender::SubmitTriangles() - Invalid vertex count, cannot represent whole triangles." );
     AssertFatal( vertexCount <= BATCHRENDER_BUFFERSIZE, "BatchRender::SubmitTriangles() - Invalid vertex count." );
 
+    // Capture the submission if capturing.
+    if ( mpCaptureCache != NULL )
+        captureSubmit( false, vertexCount, pVertexArray, pTextureArray, texture, color );
+
+    // Note the mip level needed by the first triangle if the texture is streaming.
+    if ( mPixelSize > 0.0f && texture.NotNull() && ((TextureObject*)texture)->getMipStreaming() )
+        requireMipLevel( texture, pVertexArray[1] - pVertexArray[0], pTextureArray[1] - pTextureArray[0], pVertexArray[2] - pVertexArray[0], pTextureArray[2] - pTextureArray[0] );
+
     // Calculate triangle count.
     const U32 triangleCount = vertexCount / 3;
 
@@ -121,7 +161,7 @@ void BatchRender::SubmitTriangles(
     if ( (mTriangleCount + triangleCount) > BATCHRENDER_MAXTRIANGLES )
     {
         // Yes, so flush.
-        flush( mpDebugStats->batchBufferFullFlush );
+        flush( FLUSH_BUFFER_FULL );
     }
     // Do we have anything batched?
     else if ( mTriangleCount > 0 )
@@ -131,13 +171,13 @@ void BatchRender::SubmitTriangles(
         {
             // No, so flush if color is specified.
             if ( color != NoColor  )
-                flush( mpDebugStats->batchColorStateFlush );
+                flush( FLUSH_COLOR_STATE );
         }
         else
         {
             // Yes, so flush if color is not specified.
             if ( color == NoColor  )
-                flush( mpDebugStats->batchColorStateFlush );
+                flush( FLUSH_COLOR_STATE );
         }
     }
 
@@ -148,7 +188,7 @@ void BatchRender::SubmitTriangles(
         if ( texture != mStrictOrderTextureHandle && mTriangleCount > 0 )
         {
             // Yes, so flush.
-            flush( mpDebugStats->batchTextureChangeFlush );
+            flush( FLUSH_TEXTURE_CHANGE );
         }
 
         // Fetch vertex index.
@@ -168,32 +208,44 @@ void BatchRender::SubmitTriangles(
     else
     {
         // No, so add triangle run.
-        findTextureBatch( texture )->push_back( TriangleRun( TriangleRun::TRIANGLE, triangleCount, mVertexCount ) );
+        addTriangleRun( texture, TriangleRun::TRIANGLE, triangleCount );
     }
 
-    // Is a color specified?
-    if ( color != NoColor )
+    // Fetch the first vertex.
+    BatchVertex* pVertex = mVertexBuffer + mVertexCount;
+
+    // Add textured vertices.
+    for( U32 n = 0; n < vertexCount; ++n, ++pVertex )
     {
-        // Yes, so add colors.
-        for( U32 n = 0; n < triangleCount; ++n )
-        {
-            mColorBuffer[mColorCount++] = color;
-            mColorBuffer[mColorCount++] = color;
-            mColorBuffer[mColorCount++] = color;
-        }
+        pVertex->mPosition = *(pVertexArray++);
+        pVertex->mTexture = *(pTextureArray++);
     }
 
-    // Add textured vertices.
-    for( U32 n = 0; n < triangleCount; ++n )
+    // Deform the vertices if a deformation is set.
+    if ( mpVertexDeform != NULL )
     {
-        mVertexBuffer[mVertexCount++]   = *(pVertexArray++);
-        mVertexBuffer[mVertexCount++]   = *(pVertexArray++);
-        mVertexBuffer[mVertexCount++]   = *(pVertexArray++);
-        mTextureBuffer[mTextureCoordCount++] = *(pTextureArray++);
-        mTextureBuffer[mTextureCoordCount++] = *(pTextureArray++);
-        mTextureBuffer[mTextureCoordCount++] = *(pTextureArray++);
+        pVertex = mVertexBuffer + mVertexCount;
+        for( U32 n = 0; n < vertexCount; ++n, ++pVertex )
+            pVertex->mPosition = mpVertexDeform->deform( pVertex->mPosition );
+    }
+
+    // Is a color specified?
+    if ( color != NoColor )
+    {
+        // Yes, so pack the color.
+        const ColorI packedColor = packColor( color );
+
+        // Add colors.
+        pVertex = mVertexBuffer + mVertexCount;
+        for( U32 n = 0; n < vertexCount; ++n, ++pVertex )
+            pVertex->mColor = packedColor;
+
+        mColorCount += vertexCount;
     }
 
+    // Increase vertex count.
+    mVertexCount += vertexCount;
+
     // Stats.
     mpDebugStats->batchTrianglesSubmitted += triangleCount;
 
@@ -204,7 +256,7 @@ void BatchRender::SubmitTriangles(
     if ( mTriangleCount == BATCHRENDER_MAXTRIANGLES )
     {
         // Yes, so flush.
-        flush( mpDebugStats->batchBufferFullFlush );
+        flush( FLUSH_BUFFER_FULL );
     }
     // Is batching enabled?
     else if ( !mBatchEnabled )
@@ -236,11 +288,23 @@ void BatchRender::SubmitQuad(
     // Debug Profiling.
     PROFILE_SCOPE(BatchRender_SubmitQuad);
 
+    // Capture the submission if capturing.
+    if ( mpCaptureCache != NULL )
+    {
+        const Vector2 vertexArray[4] = { vertexPos0, vertexPos1, vertexPos2, vertexPos3 };
+        const Vector2 textureArray[4] = { texturePos0, texturePos1, texturePos2, texturePos3 };
+        captureSubmit( true, 4, vertexArray, textureArray, texture, color );
+    }
+
+    // Note the mip level needed if the texture is streaming.
+    if ( mPixelSize > 0.0f && texture.NotNull() && ((TextureObject*)texture)->getMipStreaming() )
+        requireMipLevel( texture, vertexPos1 - vertexPos0, texturePos1 - texturePos0, vertexPos2 - vertexPos1, texturePos2 - texturePos1 );
+
     // Would we exceed the triangle buffer size?
     if ( (mTriangleCount + 2) > BATCHRENDER_MAXTRIANGLES )
     {
         // Yes, so flush.
-        flush( mpDebugStats->batchBufferFullFlush );
+        flush( FLUSH_BUFFER_FULL );
     }
     // Do we have anything batched?
     else if ( mTriangleCount > 0 )
@@ -250,13 +314,13 @@ void BatchRender::SubmitQuad(
         {
             // No, so flush if color is specified.
             if ( color != NoColor  )
-                flush( mpDebugStats->batchColorStateFlush );
+                flush( FLUSH_COLOR_STATE );
         }
         else
         {
             // Yes, so flush if color is not specified.
             if ( color == NoColor  )
-                flush( mpDebugStats->batchColorStateFlush );
+                flush( FLUSH_COLOR_STATE );
         }
     }
 
@@ -267,7 +331,7 @@ void BatchRender::SubmitQuad(
         if ( texture != mStrictOrderTextureHandle && mTriangleCount > 0 )
         {
             // Yes, so flush.
-            flush( mpDebugStats->batchTextureChangeFlush );
+            flush( FLUSH_TEXTURE_CHANGE );
         }
 
         // Add new indices.
@@ -284,29 +348,46 @@ void BatchRender::SubmitQuad(
     else
     {
         // No, so add triangle run.
-        findTextureBatch( texture )->push_back( TriangleRun( TriangleRun::QUAD, 1, mVertexCount ) );
+        addTriangleRun( texture, TriangleRun::QUAD, 1 );
+    }
+
+    // Fetch the first vertex.
+    BatchVertex* pVertex = mVertexBuffer + mVertexCount;
+
+    // Add textured vertices.
+    // NOTE: We swap #2/#3 here.
+    pVertex[0].mPosition = vertexPos0;
+    pVertex[1].mPosition = vertexPos1;
+    pVertex[2].mPosition = vertexPos3;
+    pVertex[3].mPosition = vertexPos2;
+    pVertex[0].mTexture = texturePos0;
+    pVertex[1].mTexture = texturePos1;
+    pVertex[2].mTexture = texturePos3;
+    pVertex[3].mTexture = texturePos2;
+
+    // Deform the vertices if a deformation is set.
+    if ( mpVertexDeform != NULL )
+    {
+        pVertex[0].mPosition = mpVertexDeform->deform( vertexPos0 );
+        pVertex[1].mPosition = mpVertexDeform->deform( vertexPos1 );
+        pVertex[2].mPosition = mpVertexDeform->deform( vertexPos3 );
+        pVertex[3].mPosition = mpVertexDeform->deform( vertexPos2 );
     }
 
     // Is a color specified?
     if ( color != NoColor )
     {
         // Yes, so add colors.
-        mColorBuffer[mColorCount++] = color;
-        mColorBuffer[mColorCount++] = color;
-        mColorBuffer[mColorCount++] = color;
-        mColorBuffer[mColorCount++] = color;
+        const ColorI packedColor = packColor( color );
+        pVertex[0].mColor = packedColor;
+        pVertex[1].mColor = packedColor;
+        pVertex[2].mColor = packedColor;
+        pVertex[3].mColor = packedColor;
+        mColorCount += 4;
     }
 
-    // Add textured vertices.
-    // NOTE: We swap #2/#3 here.
-    mVertexBuffer[mVertexCount++]   = vertexPos0;
-    mVertexBuffer[mVertexCount++]   = vertexPos1;
-    mVertexBuffer[mVertexCount++]   = vertexPos3;
-    mVertexBuffer[mVertexCount++]   = vertexPos2;
-    mTextureBuffer[mTextureCoordCount++] = texturePos0;
-    mTextureBuffer[mTextureCoordCount++] = texturePos1;
-    mTextureBuffer[mTextureCoordCount++] = texturePos3;
-    mTextureBuffer[mTextureCoordCount++] = texturePos2;
+    // Increase vertex count.
+    mVertexCount += 4;
 
     // Stats.
     mpDebugStats->batchTrianglesSubmitted+=2;
@@ -318,7 +399,7 @@ void BatchRender::SubmitQuad(
     if ( mTriangleCount == BATCHRENDER_MAXTRIANGLES )
     {
         // Yes, so flush.
-        flush( mpDebugStats->batchBufferFullFlush );
+        flush( FLUSH_BUFFER_FULL );
     }
     // Is batching enabled?
     else if ( !mBatchEnabled )
@@ -332,14 +413,151 @@ void BatchRender::SubmitQuad(
 
 //-----------------------------------------------------------------------------
 
-void BatchRender::flush( U32& reasonMetric )
+void BatchRender::beginCapture( BatchRenderCache* pCache )
+{
+    // Sanity!
+    AssertFatal( pCache != NULL, "BatchRender::beginCapture() - Invalid cache." );
+    AssertFatal( mpCaptureCache == NULL, "BatchRender::beginCapture() - Already capturing." );
+
+    // Reset the cache.
+    pCache->clear();
+
+    mpCaptureCache = pCache;
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::requireMipLevel( TextureHandle& texture, const Vector2& vertexEdge0, const Vector2& textureEdge0, const Vector2& vertexEdge1, const Vector2& textureEdge1 )
+{
+    TextureObject* pTextureObject = (TextureObject*)texture;
+
+    // Fetch the full texture dimensions.
+    const F32 textureWidth = (F32)pTextureObject->getTextureWidth();
+    const F32 textureHeight = (F32)pTextureObject->getTextureHeight();
+
+    // Calculate the texels covered by each window pixel along both edges.
+    const F32 pixelLength0 = vertexEdge0.Length() / mPixelSize;
+    const F32 pixelLength1 = vertexEdge1.Length() / mPixelSize;
+    const F32 texelLength0 = Vector2( textureEdge0.x * textureWidth, textureEdge0.y * textureHeight ).Length();
+    const F32 texelLength1 = Vector2( textureEdge1.x * textureWidth, textureEdge1.y * textureHeight ).Length();
+    const F32 texelsPerPixel0 = pixelLength0 > 0.0f ? texelLength0 / pixelLength0 : 0.0f;
+    const F32 texelsPerPixel1 = pixelLength1 > 0.0f ? texelLength1 / pixelLength1 : 0.0f;
+    F32 texelsPerPixel = getMin( texelsPerPixel0, texelsPerPixel1 );
+
+    // Ignore degenerate geometry.
+    if ( texelsPerPixel <= 0.0f )
+        texelsPerPixel = getMax( texelsPerPixel0, texelsPerPixel1 );
+
+    // Each mip level halves the texel density.
+    U32 mipLevel = 0;
+    while ( texelsPerPixel >= 2.0f )
+    {
+        texelsPerPixel *= 0.5f;
+        mipLevel++;
+    }
+
+    pTextureObject->requireMipLevel( mipLevel );
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::captureSubmit( const bool quad, const U32 vertexCount, const Vector2* pVertexArray, const Vector2* pTextureArray, TextureHandle& texture, const ColorF& color )
+{
+    // Fetch the cache.
+    BatchRenderCache* pCache = mpCaptureCache;
+
+    // Capture the submission and the render state it uses.
+    BatchRenderCache::CachedSubmit submit;
+    submit.mQuad = quad;
+    submit.mVertexStart = (U32)pCache->mVertices.size();
+    submit.mVertexCount = vertexCount;
+    submit.mpTextureObject = (TextureObject*)texture;
+    submit.mColor = color;
+    submit.mBlendMode = mBlendMode;
+    submit.mSrcBlendFactor = mSrcBlendFactor;
+    submit.mDstBlendFactor = mDstBlendFactor;
+    submit.mBlendColor = mBlendColor;
+    submit.mAlphaTestMode = mAlphaTestMode;
+    submit.mStrictOrderMode = mStrictOrderMode;
+    pCache->mSubmits.push_back( submit );
+
+    // Capture the geometry.
+    for ( U32 n = 0; n < vertexCount; ++n )
+    {
+        pCache->mVertices.push_back( pVertexArray[n] );
+        pCache->mTextureCoords.push_back( pTextureArray[n] );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::submitCache( const BatchRenderCache& cache )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(BatchRender_SubmitCache);
+
+    // Sanity!
+    AssertFatal( mpCaptureCache != &cache, "BatchRender::submitCache() - Cannot submit a cache whilst capturing into it." );
+
+    const Vector2* pVertices = cache.mVertices.address();
+    const Vector2* pTextureCoords = cache.mTextureCoords.address();
+
+    // Iterate the captured submissions.
+    for( Vector<BatchRenderCache::CachedSubmit>::const_iterator submitItr = cache.mSubmits.begin(); submitItr != cache.mSubmits.end(); ++submitItr )
+    {
+        const BatchRenderCache::CachedSubmit& submit = *submitItr;
+
+        // Restore the render state.
+        // NOTE: These only flush if the state actually changes.
+        if ( submit.mBlendMode )
+            setBlendMode( submit.mSrcBlendFactor, submit.mDstBlendFactor, submit.mBlendColor );
+        else
+            setBlendOff();
+        setAlphaTestMode( submit.mAlphaTestMode );
+        setStrictOrderMode( submit.mStrictOrderMode );
+
+        // Fetch the texture.
+        TextureHandle texture( submit.mpTextureObject );
+
+        // Submit the geometry.
+        const Vector2* pVertex = pVertices + submit.mVertexStart;
+        const Vector2* pTexture = pTextureCoords + submit.mVertexStart;
+        if ( submit.mQuad )
+        {
+            SubmitQuad( pVertex[0], pVertex[1], pVertex[2], pVertex[3], pTexture[0], pTexture[1], pTexture[2], pTexture[3], texture, submit.mColor );
+        }
+        else
+        {
+            SubmitTriangles( submit.mVertexCount, pVertex, pTexture, texture, submit.mColor );
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::flush( const FlushReason reason )
 {
     // Finish if no triangles to flush.
     if ( mTriangleCount == 0 )
         return;
 
     // Increase reason metric.
-    reasonMetric++;
+    switch( reason )
+    {
+        case FLUSH_BLEND_STATE:     mpDebugStats->batchBlendStateFlush++; break;
+        case FLUSH_COLOR_STATE:     mpDebugStats->batchColorStateFlush++; break;
+        case FLUSH_ALPHA_STATE:     mpDebugStats->batchAlphaStateFlush++; break;
+        case FLUSH_TEXTURE_CHANGE:  mpDebugStats->batchTextureChangeFlush++; break;
+        case FLUSH_BUFFER_FULL:     mpDebugStats->batchBufferFullFlush++; break;
+        case FLUSH_ISOLATED:        mpDebugStats->batchIsolatedFlush++; break;
+        case FLUSH_LAYER:           mpDebugStats->batchLayerFlush++; break;
+        case FLUSH_NO_BATCH:        mpDebugStats->batchNoBatchFlush++; break;
+        default:                    mpDebugStats->batchAnonymousFlush++; break;
+    }
+
+    // Record the batch break if tracking.
+    if ( mBreakTracking )
+        recordBatchBreak( reason );
 
     // Flush.
     flushInternal();
@@ -349,15 +567,52 @@ void BatchRender::flush( U32& reasonMetric )
 
 void BatchRender::flush( void )
 {
-    // Finish if no triangles to flush.
-    if ( mTriangleCount == 0 )
+    flush( FLUSH_ANONYMOUS );
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::recordBatchBreak( const FlushReason reason )
+{
+    // Finish if no more breaks can be recorded.
+    if ( mBatchBreaks.size() >= BATCHRENDER_MAXBREAKS )
         return;
 
-    // Increase reason metric.
-    mpDebugStats->batchAnonymousFlush++;
+    BatchBreak batchBreak;
+    batchBreak.mReason = reason;
+    batchBreak.mTriangleCount = mTriangleCount;
+    batchBreak.mObjectId = 0;
+    batchBreak.mObjectClass = StringTable->EmptyString;
+    batchBreak.mObjectName = StringTable->EmptyString;
 
-    // Flush.
-    flushInternal();
+    // Blame the submitting object if there is one.
+    const SimObject* pSimObject = dynamic_cast<const SimObject*>( mpBatchSubmitter );
+    if ( pSimObject != NULL )
+    {
+        batchBreak.mObjectId = pSimObject->getId();
+        batchBreak.mObjectClass = pSimObject->getClassName();
+        batchBreak.mObjectName = pSimObject->getName() != NULL ? pSimObject->getName() : StringTable->EmptyString;
+    }
+
+    mBatchBreaks.push_back( batchBreak );
+}
+
+//-----------------------------------------------------------------------------
+
+const char* BatchRender::getFlushReasonDescription( const FlushReason reason )
+{
+    switch( reason )
+    {
+        case FLUSH_BLEND_STATE:     return "Blend";
+        case FLUSH_COLOR_STATE:     return "Color";
+        case FLUSH_ALPHA_STATE:     return "Alpha";
+        case FLUSH_TEXTURE_CHANGE:  return "Texture";
+        case FLUSH_BUFFER_FULL:     return "Full";
+        case FLUSH_ISOLATED:        return "Isolated";
+        case FLUSH_LAYER:           return "Layer";
+        case FLUSH_NO_BATCH:        return "NoBatch";
+        default:                    return "Anonymous";
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -373,11 +628,16 @@ void BatchRender::flushInternal( void )
 
     // Stats.
     mpDebugStats->batchFlushes++;
+    FrameStats::addCount( FrameStats::StatBatchFlushes, 1 );
+    FrameStats::addCount( FrameStats::StatTriangles, mTriangleCount );
+
+    // Time the GPU cost of the flush.
+    GpuTimerScope flushGpuTimerScope( GpuTimer::SectionBatchFlush );
 
     if ( mWireframeMode )
     {
         // Disable texturing.    
-        glDisable( GL_TEXTURE_2D );
+        dglDisable( GL_TEXTURE_2D );
 
         // Set the polygon mode to line.
         glPolygonMode( GL_FRONT_AND_BACK, GL_LINE );
@@ -385,7 +645,7 @@ void BatchRender::flushInternal( void )
     else
     {
         // Enable texturing.    
-        glEnable( GL_TEXTURE_2D );
+        dglEnable( GL_TEXTURE_2D );
         glTexEnvi( GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE );
 
         // Set the polygon mode to fill.
@@ -395,73 +655,43 @@ void BatchRender::flushInternal( void )
     // Set blend mode.
     if ( mBlendMode )
     {
-        glEnable( GL_BLEND );
-        glBlendFunc( mSrcBlendFactor, mDstBlendFactor );
+        dglEnable( GL_BLEND );
+        dglBlendFunc( mSrcBlendFactor, mDstBlendFactor );
         glColor4f(mBlendColor.red, mBlendColor.green, mBlendColor.blue, mBlendColor.alpha );
     }
     else
     {
-        glDisable( GL_BLEND );
+        dglDisable( GL_BLEND );
         glColor4f( 1.0f, 1.0f, 1.0f, 1.0f );
     }
 
     // Set alpha-blend mode.
     if ( mAlphaTestMode >= 0.0f )
     {
-        glEnable( GL_ALPHA_TEST );
-        glAlphaFunc( GL_GREATER, mAlphaTestMode );
+        dglEnable( GL_ALPHA_TEST );
+        dglAlphaFunc( GL_GREATER, mAlphaTestMode );
     }
     else
     {
-        glDisable( GL_ALPHA_TEST );
-    }
-
-    // Enable vertex and texture arrays.
-    glEnableClientState( GL_VERTEX_ARRAY );
-    glVertexPointer( 2, GL_FLOAT, 0, mVertexBuffer );
-    glTexCoordPointer( 2, GL_FLOAT, 0, mTextureBuffer );
-
-    // Use the texture coordinates if not in wireframe mode.
-    if ( !mWireframeMode )
-        glEnableClientState( GL_TEXTURE_COORD_ARRAY );
-
-    // Do we have any colors?
-    if ( mColorCount > 0 )
-    {
-        // Yes, so enable color array.
-        glEnableClientState( GL_COLOR_ARRAY );
-        glColorPointer( 4, GL_FLOAT, 0, mColorBuffer );
+        dglDisable( GL_ALPHA_TEST );
     }
 
     // Strict order mode?
     if ( mStrictOrderMode )
     {
-        // Bind the texture if not in wireframe mode.
-        if ( !mWireframeMode )
-            glBindTexture( GL_TEXTURE_2D, mStrictOrderTextureHandle.getGLName() );
-
-        // Draw the triangles
-        glDrawElements( GL_TRIANGLES, mIndexCount, GL_UNSIGNED_SHORT, mIndexBuffer );
-
-        // Stats.
-        mpDebugStats->batchDrawCallsStrict++;
-
-        // Stats.
-        const U32 trianglesDrawn = mIndexCount / 3;
-        if ( trianglesDrawn > mpDebugStats->batchMaxTriangleDrawn )
-            mpDebugStats->batchMaxTriangleDrawn = trianglesDrawn;
-
-        // Stats.
-        if ( mVertexCount > mpDebugStats->batchMaxVertexBuffer )
-            mpDebugStats->batchMaxVertexBuffer = mVertexCount;
+        // Yes, so draw the indices in submission order.
+        mTextureDraws.push_back( TextureDraw( mStrictOrderTextureHandle.getGLName(), 0, mIndexCount ) );
     }
     else
     {
-        // No, so iterate texture batch map.
+        // No, so reset index count.
+        mIndexCount = 0;
+
+        // Iterate texture batch map.
         for( textureBatchType::iterator batchItr = mTextureBatchMap.begin(); batchItr != mTextureBatchMap.end(); ++batchItr )
         {
-            // Reset index count.
-            mIndexCount = 0;
+            // Fetch the texture draw start index.
+            const U32 startIndex = mIndexCount;
 
             // Fetch index vector.
             indexVectorType* pIndexVector = batchItr->value;
@@ -494,6 +724,9 @@ void BatchRender::flushInternal( void )
                         mIndexBuffer[mIndexCount++] = triangleIndex--;
                         mIndexBuffer[mIndexCount++] = triangleIndex--;
                         mIndexBuffer[mIndexCount++] = triangleIndex--;
+
+                        // Move to the next quad.
+                        triangleIndex += 4;
                     }
                 }
                 else if ( primitiveMode == TriangleRun::TRIANGLE )
@@ -515,26 +748,10 @@ void BatchRender::flushInternal( void )
             }
 
             // Sanity!
-            AssertFatal( mIndexCount > 0, "No batching indexes are present." );
-
-            // Bind the texture if not in wireframe mode.
-            if ( !mWireframeMode )
-                glBindTexture( GL_TEXTURE_2D, batchItr->key );
+            AssertFatal( mIndexCount > startIndex, "No batching indexes are present." );
 
-            // Draw the triangles.
-            glDrawElements( GL_TRIANGLES, mIndexCount, GL_UNSIGNED_SHORT, mIndexBuffer );
-
-            // Stats.
-            mpDebugStats->batchDrawCallsSorted++;
-
-            // Stats.
-            if ( mVertexCount > mpDebugStats->batchMaxVertexBuffer )
-                mpDebugStats->batchMaxVertexBuffer = mVertexCount;
-
-            // Stats.
-            const U32 trianglesDrawn = mIndexCount / 3;
-            if ( trianglesDrawn > mpDebugStats->batchMaxTriangleDrawn )
-                mpDebugStats->batchMaxTriangleDrawn = trianglesDrawn;
+            // Add the texture draw.
+            mTextureDraws.push_back( TextureDraw( batchItr->key, startIndex, mIndexCount - startIndex ) );
 
             // Return index vector to pool.
             pIndexVector->clear();
@@ -543,32 +760,162 @@ void BatchRender::flushInternal( void )
 
         // Clear texture batch map.
         mTextureBatchMap.clear();
+        mpLastTextureBatch = NULL;
     }
 
+    // Upload the batch.
+    const U16* pIndexBase = uploadBatch();
+
+    // Iterate texture draws.
+    for( Vector<TextureDraw>::iterator drawItr = mTextureDraws.begin(); drawItr != mTextureDraws.end(); ++drawItr )
+    {
+        // Fetch texture draw.
+        const TextureDraw& textureDraw = *drawItr;
+
+        // Bind the texture if not in wireframe mode.
+        if ( !mWireframeMode )
+            dglBindTexture( GL_TEXTURE_2D, textureDraw.mTextureName );
+
+        // Draw the triangles.
+        glDrawElements( GL_TRIANGLES, textureDraw.mIndexCount, GL_UNSIGNED_SHORT, pIndexBase + textureDraw.mStartIndex );
+
+        // Stats.
+        if ( mStrictOrderMode )
+            mpDebugStats->batchDrawCallsStrict++;
+        else
+            mpDebugStats->batchDrawCallsSorted++;
+        FrameStats::addCount( FrameStats::StatDrawCalls, 1 );
+
+        // Stats.
+        const U32 trianglesDrawn = textureDraw.mIndexCount / 3;
+        if ( trianglesDrawn > mpDebugStats->batchMaxTriangleDrawn )
+            mpDebugStats->batchMaxTriangleDrawn = trianglesDrawn;
+    }
+
+    // Stats.
+    if ( mVertexCount > mpDebugStats->batchMaxVertexBuffer )
+        mpDebugStats->batchMaxVertexBuffer = mVertexCount;
+
+    // Clear texture draws.
+    mTextureDraws.clear();
+
+#ifdef BATCHRENDER_VERTEX_BUFFERS
+    // Unbind any vertex buffers so client arrays can be used elsewhere.
+    if ( pIndexBase == NULL )
+    {
+        glBindBufferARB( GL_ARRAY_BUFFER_ARB, 0 );
+        glBindBufferARB( GL_ELEMENT_ARRAY_BUFFER_ARB, 0 );
+    }
+#endif
+
     // Reset common render state.
-    glDisableClientState( GL_VERTEX_ARRAY );
-    glDisableClientState( GL_TEXTURE_COORD_ARRAY );
-    glDisableClientState( GL_COLOR_ARRAY );
-    glDisable( GL_ALPHA_TEST );
-    glDisable( GL_BLEND );
-    glDisable( GL_TEXTURE_2D );
+    dglDisableClientState( GL_VERTEX_ARRAY );
+    dglDisableClientState( GL_TEXTURE_COORD_ARRAY );
+    dglDisableClientState( GL_COLOR_ARRAY );
+    dglDisable( GL_ALPHA_TEST );
+    dglDisable( GL_BLEND );
+    dglDisable( GL_TEXTURE_2D );
     glPolygonMode( GL_FRONT_AND_BACK, GL_FILL );
 
     // Reset batch state.
     mTriangleCount = 0;
     mVertexCount = 0;
-    mTextureCoordCount = 0;
     mIndexCount = 0;
     mColorCount = 0;
 }
 
 //-----------------------------------------------------------------------------
 
+const U16* BatchRender::uploadBatch( void )
+{
+    // Fetch the vertex source.
+    const U8* pVertexBase = (const U8*)mVertexBuffer;
+    const U16* pIndexBase = mIndexBuffer;
+
+#ifdef BATCHRENDER_VERTEX_BUFFERS
+    // Stream through vertex buffers if enabled and supported.
+    if ( mVertexBufferEnabled && dglDoesSupportARBVertexBufferObject() )
+    {
+        // Generate the vertex buffers if required.
+        if ( mVertexBufferNames[0] == 0 )
+        {
+            glGenBuffersARB( BATCHRENDER_VERTEX_BUFFER_RING, mVertexBufferNames );
+            glGenBuffersARB( BATCHRENDER_VERTEX_BUFFER_RING, mIndexBufferNames );
+        }
+
+        // Move to the next vertex buffer in the ring.
+        mVertexBufferRingIndex = (mVertexBufferRingIndex + 1) % BATCHRENDER_VERTEX_BUFFER_RING;
+
+        // Orphan the vertex buffer so the driver doesn't stall on any draw still using it then upload the vertices.
+        const U32 vertexArraySize = mVertexCount * sizeof(BatchVertex);
+        glBindBufferARB( GL_ARRAY_BUFFER_ARB, mVertexBufferNames[mVertexBufferRingIndex] );
+        glBufferDataARB( GL_ARRAY_BUFFER_ARB, vertexArraySize, NULL, GL_STREAM_DRAW_ARB );
+        glBufferSubDataARB( GL_ARRAY_BUFFER_ARB, 0, vertexArraySize, pVertexBase );
+
+        // Upload the indices.
+        glBindBufferARB( GL_ELEMENT_ARRAY_BUFFER_ARB, mIndexBufferNames[mVertexBufferRingIndex] );
+        glBufferDataARB( GL_ELEMENT_ARRAY_BUFFER_ARB, mIndexCount * sizeof(U16), mIndexBuffer, GL_STREAM_DRAW_ARB );
+
+        // The arrays are now offsets into the bound buffers.
+        pVertexBase = NULL;
+        pIndexBase = NULL;
+    }
+#endif
+
+    // Enable vertex and texture arrays.
+    dglEnableClientState( GL_VERTEX_ARRAY );
+    glVertexPointer( 2, GL_FLOAT, sizeof(BatchVertex), pVertexBase + Offset(mPosition, BatchVertex) );
+    glTexCoordPointer( 2, GL_FLOAT, sizeof(BatchVertex), pVertexBase + Offset(mTexture, BatchVertex) );
+
+    // Use the texture coordinates if not in wireframe mode.
+    if ( !mWireframeMode )
+        dglEnableClientState( GL_TEXTURE_COORD_ARRAY );
+
+    // Do we have any colors?
+    if ( mColorCount > 0 )
+    {
+        // Yes, so enable color array.
+        dglEnableClientState( GL_COLOR_ARRAY );
+        glColorPointer( 4, GL_UNSIGNED_BYTE, sizeof(BatchVertex), pVertexBase + Offset(mColor, BatchVertex) );
+    }
+
+    return pIndexBase;
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::destroyVertexBuffers( void )
+{
+#ifdef BATCHRENDER_VERTEX_BUFFERS
+    // Finish if no vertex buffers.
+    if ( mVertexBufferNames[0] == 0 )
+        return;
+
+    // Delete the vertex buffers.
+    glDeleteBuffersARB( BATCHRENDER_VERTEX_BUFFER_RING, mVertexBufferNames );
+    glDeleteBuffersARB( BATCHRENDER_VERTEX_BUFFER_RING, mIndexBufferNames );
+
+    // Reset vertex buffers.
+    for ( U32 index = 0; index < BATCHRENDER_VERTEX_BUFFER_RING; ++index )
+    {
+        mVertexBufferNames[index] = 0;
+        mIndexBufferNames[index] = 0;
+    }
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
 BatchRender::indexVectorType* BatchRender::findTextureBatch( TextureHandle& handle )
 {
     // Fetch texture binding.
     const U32 textureBinding = handle.getGLName();
 
+    // Use the last texture batch if it's the same texture.
+    // NOTE: Consecutive submissions commonly share a texture (sprite-sheets, tiles and particles) so this avoids the map lookup.
+    if ( mpLastTextureBatch != NULL && textureBinding == mLastTextureName )
+        return mpLastTextureBatch;
+
     indexVectorType* pIndexVector = NULL;
 
     // Find texture binding.
@@ -602,7 +949,40 @@ BatchRender::indexVectorType* BatchRender::findTextureBatch( TextureHandle& hand
         pIndexVector = itr->value;
     }
 
+    // Note the last texture batch.
+    mLastTextureName = textureBinding;
+    mpLastTextureBatch = pIndexVector;
+
     return pIndexVector;
 }
 
+//-----------------------------------------------------------------------------
+
+void BatchRender::addTriangleRun( TextureHandle& handle, const TriangleRun::PrimitiveMode primitiveMode, const U32 primitiveCount )
+{
+    // Find the texture batch.
+    indexVectorType* pIndexVector = findTextureBatch( handle );
+
+    // Is there an existing triangle run?
+    if ( pIndexVector->size() > 0 )
+    {
+        // Yes, so fetch the last triangle run.
+        TriangleRun& lastTriangleRun = pIndexVector->last();
+
+        // Calculate the vertices per primitive.
+        const U32 primitiveVertexCount = primitiveMode == TriangleRun::QUAD ? 4 : 3;
+
+        // Extend the last run if it's the same primitive mode and its vertices end where these start.
+        if ( lastTriangleRun.mPrimitiveMode == primitiveMode &&
+            lastTriangleRun.mStartIndex + (lastTriangleRun.mPrimitiveCount * primitiveVertexCount) == mVertexCount )
+        {
+            lastTriangleRun.mPrimitiveCount += primitiveCount;
+            return;
+        }
+    }
+
+    // Add a new triangle run.
+    pIndexVector->push_back( TriangleRun( primitiveMode, primitiveCount, mVertexCount ) );
+}
+
 
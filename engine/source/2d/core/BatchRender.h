@@ -39,8 +39,8 @@
 #include "graphics/TextureManager.h"
 #endif
 
-#ifndef _HASHTABLE_H
-#include "collection/hashTable.h"
+#ifndef _FLAT_HASH_MAP_H_
+#include "collection/flatHashMap.h"
 #endif
 
 #ifndef _COLOR_H_
@@ -51,15 +51,161 @@
 
 #define BATCHRENDER_BUFFERSIZE      (65535)
 #define BATCHRENDER_MAXTRIANGLES    (BATCHRENDER_BUFFERSIZE/3)
+#define BATCHRENDER_MAXBREAKS       (256)
+
+// Vertex buffer objects are not used on GLES devices where client arrays are used instead.
+#if !defined(TORQUE_OS_IOS) && !defined(TORQUE_OS_ANDROID) && !defined(TORQUE_OS_EMSCRIPTEN)
+#define BATCHRENDER_VERTEX_BUFFERS
+#define BATCHRENDER_VERTEX_BUFFER_RING  (3)
+#endif
 
 //-----------------------------------------------------------------------------
 
 class SceneRenderRequest;
+class SceneRenderObject;
+
+//-----------------------------------------------------------------------------
+
+/// Geometry captured from a batch renderer so that it can be submitted again without being regenerated.
+/// The render state in effect for each submission is captured along with it.
+class BatchRenderCache
+{
+    friend class BatchRender;
+
+private:
+    struct CachedSubmit
+    {
+        bool            mQuad;
+        U32             mVertexStart;
+        U32             mVertexCount;
+        TextureObject*  mpTextureObject;
+        ColorF          mColor;
+        bool            mBlendMode;
+        GLenum          mSrcBlendFactor;
+        GLenum          mDstBlendFactor;
+        ColorF          mBlendColor;
+        F32             mAlphaTestMode;
+        bool            mStrictOrderMode;
+    };
+
+    Vector<CachedSubmit>    mSubmits;
+    Vector<Vector2>         mVertices;
+    Vector<Vector2>         mTextureCoords;
+
+public:
+    BatchRenderCache()
+    {
+        VECTOR_SET_ASSOCIATION( mSubmits );
+        VECTOR_SET_ASSOCIATION( mVertices );
+        VECTOR_SET_ASSOCIATION( mTextureCoords );
+    }
+
+    inline void clear( void )                      { mSubmits.clear(); mVertices.clear(); mTextureCoords.clear(); }
+    inline U32 getSubmitCount( void ) const        { return (U32)mSubmits.size(); }
+};
+
+//-----------------------------------------------------------------------------
+
+/// A deformation applied to the position of every vertex submitted to a batch renderer whilst it is set.
+/// The parameters are shared by everything submitted so, much like shader uniforms, animating them animates
+/// the whole batch without the geometry being touched or regenerated (including geometry replayed from a cache).
+/// Positions are deformed in the frame given by the origin and up axis with "across" being the distance along
+/// the perpendicular axis and "height" the distance along the up axis.
+class BatchVertexDeform
+{
+public:
+    enum DeformMode
+    {
+        DEFORM_NONE,
+        DEFORM_WAVE,        ///< Displaced along the up axis by a sine wave travelling across.
+        DEFORM_SWAY,        ///< Displaced across by an oscillation that grows with height, anchored at zero height.
+        DEFORM_BEND,        ///< Displaced across by a constant lean that grows with height, anchored at zero height.
+
+        DEFORM_INVALID
+    };
+
+    BatchVertexDeform() :
+        mMode( DEFORM_NONE ),
+        mOrigin( 0.0f, 0.0f ),
+        mUpAxis( 0.0f, 1.0f ),
+        mAmplitude( 0.0f ),
+        mFrequency( 0.0f ),
+        mPhase( 0.0f ),
+        mHeight( 1.0f )
+    { }
+
+    DeformMode  mMode;
+    Vector2     mOrigin;
+    Vector2     mUpAxis;
+    F32         mAmplitude;     ///< Maximum displacement.
+    F32         mFrequency;     ///< Radians per unit across.
+    F32         mPhase;         ///< Radians.
+    F32         mHeight;        ///< Height at which sway or bend reaches the full amplitude.
+
+    /// Deform a position.
+    inline Vector2 deform( const Vector2& position ) const
+    {
+        const F32 offsetX = position.x - mOrigin.x;
+        const F32 offsetY = position.y - mOrigin.y;
+        const F32 across = (offsetX * mUpAxis.y) - (offsetY * mUpAxis.x);
+
+        switch( mMode )
+        {
+            case DEFORM_WAVE:
+                {
+                    const F32 displacement = mSin( (across * mFrequency) + mPhase ) * mAmplitude;
+                    return Vector2( position.x + (mUpAxis.x * displacement), position.y + (mUpAxis.y * displacement) );
+                }
+
+            case DEFORM_SWAY:
+            case DEFORM_BEND:
+                {
+                    const F32 height = mClampF( ((offsetX * mUpAxis.x) + (offsetY * mUpAxis.y)) / mHeight, 0.0f, 1.0f );
+                    F32 displacement = mAmplitude * height * height;
+                    if ( mMode == DEFORM_SWAY )
+                        displacement *= mSin( (across * mFrequency) + mPhase );
+                    return Vector2( position.x + (mUpAxis.y * displacement), position.y - (mUpAxis.x * displacement) );
+                }
+
+            default:
+                return position;
+        }
+    }
+};
 
 //-----------------------------------------------------------------------------
 
 class BatchRender
 {
+public:
+    /// The reasons a batch is flushed.
+    enum FlushReason
+    {
+        FLUSH_BLEND_STATE,
+        FLUSH_COLOR_STATE,
+        FLUSH_ALPHA_STATE,
+        FLUSH_TEXTURE_CHANGE,
+        FLUSH_BUFFER_FULL,
+        FLUSH_ISOLATED,
+        FLUSH_LAYER,
+        FLUSH_NO_BATCH,
+        FLUSH_ANONYMOUS,
+
+        FLUSH_REASON_COUNT
+    };
+
+    /// A flush recorded whilst tracking batch breaks along with the object that was submitting when it happened.
+    struct BatchBreak
+    {
+        FlushReason         mReason;
+        U32                 mTriangleCount;
+        U32                 mObjectId;
+        const char*         mObjectClass;
+        StringTableEntry    mObjectName;
+    };
+
+    typedef Vector<BatchBreak> typeBatchBreakVector;
+
 private:
     struct TriangleRun
     {
@@ -80,22 +226,43 @@ private:
         U32 mStartIndex;
     };
 
+    /// Interleaved vertex with a packed color (20 bytes).
+    struct BatchVertex
+    {
+        Vector2 mPosition;
+        Vector2 mTexture;
+        ColorI  mColor;
+    };
+
+    struct TextureDraw
+    {
+        TextureDraw( const U32 textureName, const U32 startIndex, const U32 indexCount ) :
+            mTextureName( textureName ),
+            mStartIndex( startIndex ),
+            mIndexCount( indexCount )
+        { }
+
+        U32 mTextureName;
+        U32 mStartIndex;
+        U32 mIndexCount;
+    };
+
     typedef Vector<TriangleRun> indexVectorType;
-    typedef HashMap<U32, indexVectorType*> textureBatchType;
+    typedef FlatHashMap<U32, indexVectorType*> textureBatchType;
 
     VectorPtr< indexVectorType* > mIndexVectorPool;
     textureBatchType    mTextureBatchMap;
+    Vector<TextureDraw> mTextureDraws;
+    U32                 mLastTextureName;
+    indexVectorType*    mpLastTextureBatch;
 
     const ColorF        NoColor;
 
-    Vector2             mVertexBuffer[ BATCHRENDER_BUFFERSIZE ];
-    Vector2             mTextureBuffer[ BATCHRENDER_BUFFERSIZE ];
+    BatchVertex         mVertexBuffer[ BATCHRENDER_BUFFERSIZE ];
     U16                 mIndexBuffer[ BATCHRENDER_BUFFERSIZE ];
-    ColorF              mColorBuffer[ BATCHRENDER_BUFFERSIZE ];
    
     U32                 mTriangleCount;
     U32                 mVertexCount;
-    U32                 mTextureCoordCount;
     U32                 mIndexCount;
     U32                 mColorCount;
 
@@ -109,8 +276,23 @@ private:
     TextureHandle       mStrictOrderTextureHandle;
     DebugStats*         mpDebugStats;
 
+    bool                mBreakTracking;
+    SceneRenderObject*  mpBatchSubmitter;
+    typeBatchBreakVector mBatchBreaks;
+
     bool                mWireframeMode;
+    F32                 mPixelSize;
     bool                mBatchEnabled;
+    bool                mVertexBufferEnabled;
+
+    BatchRenderCache*   mpCaptureCache;
+    const BatchVertexDeform* mpVertexDeform;
+
+#ifdef BATCHRENDER_VERTEX_BUFFERS
+    GLuint              mVertexBufferNames[ BATCHRENDER_VERTEX_BUFFER_RING ];
+    GLuint              mIndexBufferNames[ BATCHRENDER_VERTEX_BUFFER_RING ];
+    U32                 mVertexBufferRingIndex;
+#endif
 
 public:
     BatchRender();
@@ -144,7 +326,7 @@ public:
                 return;
 
         // Flush.
-        flush( mpDebugStats->batchBlendStateFlush );
+        flush( FLUSH_BLEND_STATE );
 
         mBlendMode = true;
         mSrcBlendFactor = srcFactor;
@@ -160,7 +342,7 @@ public:
             return;
 
         // Flush.
-        flush( mpDebugStats->batchBlendStateFlush );
+        flush( FLUSH_BLEND_STATE );
 
         mBlendMode = false;
     }
@@ -176,10 +358,7 @@ public:
             return;
 
         // Flush.
-        flush( mpDebugStats->batchAlphaStateFlush );
-
-        // Stats.
-        mpDebugStats->batchAlphaStateFlush++;
+        flush( FLUSH_ALPHA_STATE );
 
         mAlphaTestMode = alphaTestMode;
     }
@@ -200,6 +379,10 @@ public:
     // Gets the wireframe mode.
     inline bool getWireframeMode( void ) const { return mWireframeMode; }
 
+    /// Sets the world size of a single window pixel used to measure the texel density of mip-streamed textures (zero disables).
+    inline void setPixelSize( const F32 pixelSize ) { mPixelSize = pixelSize; }
+    inline F32 getPixelSize( void ) const { return mPixelSize; }
+
     /// Sets the batch enabled mode.
     inline void setBatchEnabled( const bool enabled )
     {
@@ -216,9 +399,40 @@ public:
     /// Gets the batch enabled mode.
     inline bool getBatchEnabled( void ) const { return mBatchEnabled; }
 
+    /// Sets whether batches are streamed through vertex buffer objects when they are supported.
+    /// Client arrays are always used when vertex buffer objects are not supported.
+    inline void setVertexBufferEnabled( const bool enabled )
+    {
+        // Ignore no change.
+        if ( mVertexBufferEnabled == enabled )
+            return;
+
+        // Flush.
+        flushInternal();
+
+        mVertexBufferEnabled = enabled;
+    }
+
+    /// Gets whether batches are streamed through vertex buffer objects when they are supported.
+    inline bool getVertexBufferEnabled( void ) const { return mVertexBufferEnabled; }
+
     /// Sets the debug stats to use.
     inline void setDebugStats( DebugStats* pDebugStats ) { mpDebugStats = pDebugStats; }
 
+    /// Sets whether each flush is recorded as a batch break (up to BATCHRENDER_MAXBREAKS until cleared).
+    inline void setBreakTracking( const bool enabled ) { mBreakTracking = enabled; }
+    inline bool getBreakTracking( void ) const { return mBreakTracking; }
+
+    /// Sets the object currently submitting which is blamed for any batch break recorded (NULL for none).
+    inline void setBatchSubmitter( SceneRenderObject* pSceneRenderObject ) { mpBatchSubmitter = pSceneRenderObject; }
+
+    /// Gets or clears the recorded batch breaks.
+    inline const typeBatchBreakVector& getBatchBreaks( void ) const { return mBatchBreaks; }
+    inline void clearBatchBreaks( void ) { mBatchBreaks.clear(); }
+
+    /// Gets a description of a flush reason.
+    static const char* getFlushReasonDescription( const FlushReason reason );
+
     /// Submit triangles for batching.
     /// Vertex and textures are indexed as:
     ///  2        5
@@ -279,8 +493,27 @@ public:
         glEnd();
     }
 
-    /// Flush (render) any pending batches with a reason metric.
-    void flush( U32& reasonMetric );
+    /// Start capturing all submitted geometry into the specified cache (which is cleared).
+    /// Submission still renders as normal whilst capturing.
+    void beginCapture( BatchRenderCache* pCache );
+
+    /// Stop capturing submitted geometry.
+    inline void endCapture( void ) { mpCaptureCache = NULL; }
+
+    /// Gets whether submitted geometry is being captured.
+    inline bool getCapturing( void ) const { return mpCaptureCache != NULL; }
+
+    /// Submit all the geometry previously captured into the specified cache along with its render state.
+    void submitCache( const BatchRenderCache& cache );
+
+    /// Sets the deformation applied to the vertices of everything submitted until it is cleared (NULL for none).
+    /// Deformation is applied as geometry is submitted so changing it never flushes and geometry is captured undeformed.
+    /// The deformation is not copied so must remain valid whilst set.
+    inline void setVertexDeform( const BatchVertexDeform* pVertexDeform ) { mpVertexDeform = pVertexDeform != NULL && pVertexDeform->mMode != BatchVertexDeform::DEFORM_NONE ? pVertexDeform : NULL; }
+    inline const BatchVertexDeform* getVertexDeform( void ) const { return mpVertexDeform; }
+
+    /// Flush (render) any pending batches with a reason.
+    void flush( const FlushReason reason );
 
     /// Flush (render) any pending batches.
     void flush( void );
@@ -289,8 +522,37 @@ private:
     /// Flush (render) any pending batches.
     void flushInternal( void );
 
+    /// Record a batch break for the pending batches.
+    void recordBatchBreak( const FlushReason reason );
+
+    /// Upload the pending vertices and indices and set the array pointers.
+    /// Returns the base to use for index offsets.
+    const U16* uploadBatch( void );
+
+    /// Destroy any vertex buffer objects.
+    void destroyVertexBuffers( void );
+
+    /// Capture a submission into the current capture cache.
+    void captureSubmit( const bool quad, const U32 vertexCount, const Vector2* pVertexArray, const Vector2* pTextureArray, TextureHandle& texture, const ColorF& color );
+
+    /// Note the mip level needed by a mip-streamed texture given two edges of the submitted geometry.
+    void requireMipLevel( TextureHandle& texture, const Vector2& vertexEdge0, const Vector2& textureEdge0, const Vector2& vertexEdge1, const Vector2& textureEdge1 );
+
+    /// Pack a color into 8-bit normalized components.
+    static inline ColorI packColor( const ColorF& color )
+    {
+        return ColorI(
+            U8( mClampF( color.red, 0.0f, 1.0f ) * 255.0f + 0.5f ),
+            U8( mClampF( color.green, 0.0f, 1.0f ) * 255.0f + 0.5f ),
+            U8( mClampF( color.blue, 0.0f, 1.0f ) * 255.0f + 0.5f ),
+            U8( mClampF( color.alpha, 0.0f, 1.0f ) * 255.0f + 0.5f ) );
+    }
+
     /// Find texture batch.
     indexVectorType* findTextureBatch( TextureHandle& handle );
+
+    /// Add a triangle run to the texture batch, extending the last run if it is contiguous.
+    void addTriangleRun( TextureHandle& handle, const TriangleRun::PrimitiveMode primitiveMode, const U32 primitiveCount );
 };
 
 #endif
\ No newline at end of file
@@ -47,7 +47,7 @@
 
 //-----------------------------------------------------------------------------
 
-ImageFrameProviderCore::ImageFrameProviderCore() : mpImageAsset(NULL), mpAnimationAsset(NULL)
+ImageFrameProviderCore::ImageFrameProviderCore() : mpImageAsset(NULL), mpAnimationAsset(NULL), mpAnimationClock(NULL), mUseAnimationClock(false)
 {
 }
 
@@ -95,6 +95,7 @@ void ImageFrameProviderCore::resetState( void )
     mFrameIntegrationTime = 0.0f;
     mAnimationPaused = false;
     mAnimationFinished = true;
+    mUseAnimationClock = false;
 
     clearAssets();
 }
@@ -151,6 +152,14 @@ bool ImageFrameProviderCore::update( const F32 elapsedTime )
     if ( isAnimationPaused() )
         return true;
 
+    // Is the animation using a shared clock?
+    if ( mpAnimationClock != NULL || acquireAnimationClock() )
+    {
+        // Yes, so fetch the frame from the clock.  Shared clocks always loop so the animation never finishes.
+        updateAnimationClock();
+        return false;
+    }
+
     // Update the animation.
     updateAnimation( Tickable::smTickSec );
 
@@ -190,6 +199,10 @@ bool ImageFrameProviderCore::validRender( void ) const
             return mpImageAsset->notNull() && getNamedImageFrame() != StringTable->EmptyString && ( (*mpImageAsset)->containsFrame(getNamedImageFrame()) );
     }
 
+    // No, so use the shared clock frame if we're showing it.
+    if ( isAnimationClockFrame() )
+        return mpAnimationClock->isFrameValid();
+
     // No, so if the animation must be valid.
     return isAnimationValid();
 }
@@ -198,6 +211,10 @@ bool ImageFrameProviderCore::validRender( void ) const
 
 const ImageAsset::FrameArea& ImageFrameProviderCore::getProviderImageFrameArea( void ) const
 {
+    // Use the frame area cached by the shared clock if we're showing its frame.
+    if ( isAnimationClockFrame() )
+        return mpAnimationClock->getFrameArea();
+
     // If this does not have a valid render state, return a bad frame
     if (!validRender())
         return BadFrameArea;
@@ -301,6 +318,9 @@ bool ImageFrameProviderCore::setImage( const char* pImageAssetId, const U32 fram
     if ( pImageAssetId == NULL )
         return false;
 
+    // Release any shared animation clock.
+    releaseAnimationClock();
+
     // Set asset.
     mpImageAsset->setAssetId( pImageAssetId );
 
@@ -326,6 +346,9 @@ bool ImageFrameProviderCore::setImage( const char* pImageAssetId, const char* pN
     if ( pImageAssetId == NULL )
         return false;
     
+    // Release any shared animation clock.
+    releaseAnimationClock();
+
     // Set asset.
     mpImageAsset->setAssetId( pImageAssetId );
     
@@ -500,6 +523,9 @@ bool ImageFrameProviderCore::setAnimation( const char* pAnimationAssetId )
     // Reset static asset.
     mpImageAsset->clear();
 
+    // Release any shared animation clock.
+    releaseAnimationClock();
+
     // Fetch animation asset.
     mpAnimationAsset->setAssetId( pAnimationAssetId );
 
@@ -577,6 +603,9 @@ bool ImageFrameProviderCore::playAnimation( const AssetPtr<AnimationAsset>& anim
     // Reset animation finished flag.
     mAnimationFinished = false;
 
+    // Allow the animation to share a clock.
+    mUseAnimationClock = true;
+
     // Do an initial animation update.
     updateAnimation(0.0f);
 
@@ -672,6 +701,9 @@ void ImageFrameProviderCore::setAnimationFrame( const U32 frameIndex )
         return;
     }
 
+    // Stop sharing a clock as the frame is now specific to this provider.
+    detachAnimationClock();
+
     // Calculate current time.
     mCurrentTime = frameIndex*mFrameIntegrationTime;
 
@@ -683,6 +715,9 @@ void ImageFrameProviderCore::setAnimationFrame( const U32 frameIndex )
 
 void ImageFrameProviderCore::clearAssets( void )
 {
+    // Release any shared animation clock.
+    releaseAnimationClock();
+
     // Clear assets.
     if ( mpAnimationAsset != NULL )
         mpAnimationAsset->clear();
@@ -708,3 +743,90 @@ void ImageFrameProviderCore::onAssetRefreshed( AssetPtrBase* pAssetPtrBase )
     // Attempt to restart the animation.
     playAnimation( *mpAnimationAsset );
 }
+
+//-----------------------------------------------------------------------------
+
+void ImageFrameProviderCore::setAnimationTimeScale( const F32 scale )
+{
+    // Update.
+    mAnimationTimeScale = scale;
+
+    // Release the shared clock if it runs at a different time-scale.  The next update will acquire a matching one.
+    if ( mpAnimationClock != NULL && mpAnimationClock->getTimeScale() != scale )
+        releaseAnimationClock();
+}
+
+//-----------------------------------------------------------------------------
+
+void ImageFrameProviderCore::pauseAnimation( const bool animationPaused )
+{
+    // Update.
+    mAnimationPaused = animationPaused;
+
+    // Stop sharing a clock if paused as the animation time is now specific to this provider.
+    if ( mAnimationPaused )
+        detachAnimationClock();
+}
+
+//-----------------------------------------------------------------------------
+
+bool ImageFrameProviderCore::acquireAnimationClock( void )
+{
+    // Finish if the animation cannot share a clock.
+    if ( !mUseAnimationClock )
+        return false;
+
+    // Fetch the animation asset.
+    const AnimationAsset* pAnimationAsset = mpAnimationAsset->notNull() ? (const AnimationAsset*)(*mpAnimationAsset) : NULL;
+
+    // Only looping animations without a random start can share a clock.
+    if ( pAnimationAsset == NULL || !pAnimationAsset->getSharedClock() || !pAnimationAsset->getAnimationCycle() || pAnimationAsset->getRandomStart() )
+    {
+        // Don't check again until the animation is played again.
+        mUseAnimationClock = false;
+        return false;
+    }
+
+    // Acquire the shared clock.
+    mpAnimationClock = AnimationClock::acquire( *mpAnimationAsset, mAnimationTimeScale );
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void ImageFrameProviderCore::releaseAnimationClock( void )
+{
+    // Finish if not using a shared clock.
+    if ( mpAnimationClock == NULL )
+        return;
+
+    // Release the shared clock.
+    AnimationClock::release( mpAnimationClock );
+    mpAnimationClock = NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+bool ImageFrameProviderCore::updateAnimationClock( void )
+{
+    // Sanity!
+    AssertFatal( mpAnimationClock != NULL, "ImageFrameProviderCore::updateAnimationClock() - No shared clock." );
+
+    // Step the shared clock.
+    mpAnimationClock->update();
+
+    // Fetch the clock time and frame.
+    mCurrentTime = mpAnimationClock->getCurrentTime();
+    mCurrentModTime = mCurrentTime;
+    mCurrentFrameIndex = mpAnimationClock->getFrameIndex();
+
+    // Calculate if frame has changed.
+    const bool frameChanged = (mCurrentFrameIndex != mLastFrameIndex);
+
+    // Reset Last Frame.
+    mLastFrameIndex = mCurrentFrameIndex;
+
+    // Return Frame-Changed Flag.
+    return frameChanged;
+}
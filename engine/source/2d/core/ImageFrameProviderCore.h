@@ -51,6 +51,10 @@
 #include "gui/guiControl.h"
 #endif
 
+#ifndef _ANIMATION_CLOCK_H_
+#include "2d/core/AnimationClock.h"
+#endif
+
 ///-----------------------------------------------------------------------------
 
 class ImageFrameProviderCore :
@@ -82,6 +86,9 @@ protected:
     bool                                    mAnimationPaused;
     bool                                    mAnimationFinished;
 
+    AnimationClock*                         mpAnimationClock;
+    bool                                    mUseAnimationClock;
+
 public:
     ImageFrameProviderCore();
     virtual ~ImageFrameProviderCore();
@@ -127,15 +134,16 @@ public:
     inline StringTableEntry getAnimation( void ) const { return mpAnimationAsset->getAssetId(); }
     void setAnimationFrame( const U32 frameIndex );
     inline S32 getAnimationFrame( void ) const { return mCurrentFrameIndex; }
-    void setAnimationTimeScale( const F32 scale ) { mAnimationTimeScale = scale; }
+    void setAnimationTimeScale( const F32 scale );
     inline F32 getAnimationTimeScale( void ) const { return mAnimationTimeScale; }
     bool playAnimation( const AssetPtr<AnimationAsset>& animationAsset);
-    inline void pauseAnimation( const bool animationPaused ) { mAnimationPaused = animationPaused; }
-    inline void stopAnimation( void ) { mAnimationFinished = true; mAnimationPaused = false; }
-    inline void resetAnimationTime( void ) { mCurrentTime = 0.0f; }
+    void pauseAnimation( const bool animationPaused );
+    inline void stopAnimation( void ) { releaseAnimationClock(); mAnimationFinished = true; mAnimationPaused = false; }
+    inline void resetAnimationTime( void ) { detachAnimationClock(); mCurrentTime = 0.0f; }
     inline bool isAnimationPaused( void ) const { return mAnimationPaused; }
     inline bool isAnimationFinished( void ) const { return mAnimationFinished; };
     bool isAnimationValid( void ) const;
+    inline bool isUsingAnimationClock( void ) const { return mpAnimationClock != NULL; }
 
     /// Frame provision.
     inline bool isStaticFrameProvider( void ) const { return mStaticProvider; }
@@ -153,6 +161,12 @@ public:
     virtual void resetState( void );
 
 protected:
+    bool acquireAnimationClock( void );
+    void releaseAnimationClock( void );
+    inline void detachAnimationClock( void ) { releaseAnimationClock(); mUseAnimationClock = false; }
+    bool updateAnimationClock( void );
+    inline bool isAnimationClockFrame( void ) const { return mpAnimationClock != NULL && mCurrentFrameIndex == mpAnimationClock->getFrameIndex(); }
+
     virtual void onAnimationEnd( void ) {}
     virtual void onAssetRefreshed( AssetPtrBase* pAssetPtrBase );
 };
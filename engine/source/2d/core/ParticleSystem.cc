@@ -22,6 +22,23 @@
 
 #include "2d/core/ParticleSystem.h"
 
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _CONSOLETYPES_H_
+#include "console/consoleTypes.h"
+#endif
+
+#ifndef _PROFILER_H_
+#include "debug/profiler.h"
+#endif
+
+//------------------------------------------------------------------------------
+
+/// The number of scene ticks between attempts to trim the particle pool.
+#define PARTICLE_SYSTEM_TRIM_INTERVAL   60
+
 //------------------------------------------------------------------------------
 
 ParticleSystem* ParticleSystem::Instance = NULL;
@@ -32,12 +49,21 @@ void ParticleSystem::Init( void )
 {
     // Create the particle system.
     Instance = new ParticleSystem();
+
+    // Expose the particle budget.
+    Con::addVariable( PARTICLE_SYSTEM_PARTICLE_BUDGET, TypeS32, &Instance->mParticleBudget );
+
+    // Tighten the particle budget under memory pressure.
+    Instance->mMemoryPressureCallbackKey = Memory::registerPressureCallback( memoryPressureCallback, Instance );
 }
 
 //------------------------------------------------------------------------------
 
 void ParticleSystem::destroy( void )
 {
+    // Stop responding to memory pressure.
+    Memory::unregisterPressureCallback( Instance->mMemoryPressureCallbackKey );
+
     // Delete the particle system.
     delete Instance;
     Instance = NULL;
@@ -46,13 +72,26 @@ void ParticleSystem::destroy( void )
 //------------------------------------------------------------------------------
 
 ParticleSystem::ParticleSystem() :
-                    mParticlePoolBlockSize(512)
+                    mParticlePoolBlockSize(512),
+                    mParticleCacheBatchSize(64)
 {
     // Reset the free particle head.
     mpFreeParticleNodes = NULL;
+    mFreeParticleCount = 0;
+
+    // Reset the uncached active particle count.
+    mUncachedActiveCount = 0;
 
-    // Reset the active particle count.
-    mActiveParticleCount = 0;
+    // Reset the thread caches.
+    mParticleCacheCount = 0;
+
+    // Reset the trim countdown.
+    mTrimCountdown = PARTICLE_SYSTEM_TRIM_INTERVAL;
+
+    // Reset the particle budget.
+    mParticleBudget = 0;
+    mPressureParticleBudget = 0;
+    mMemoryPressureCallbackKey = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -61,55 +100,67 @@ ParticleSystem::~ParticleSystem()
 {
     // Destroy all the particle pool blocks.
     for ( U32 n = 0; n < (U32)mParticlePool.size(); n++ )
-        delete [] mParticlePool[n];
+    {
+        delete [] mParticlePool[n]->mpNodes;
+        delete mParticlePool[n];
+    }
 
     // Clear the particle pool.
     mParticlePool.clear();
 
     // Reset the free particle head.
     mpFreeParticleNodes = NULL;
+    mFreeParticleCount = 0;
+
+    // Reset the thread caches.
+    mParticleCacheCount = 0;
 }
 
 //------------------------------------------------------------------------------
 
 ParticleSystem::ParticleNode* ParticleSystem::createParticle( void )
 {
-    // Have we got any free particle nodes?
-    if ( mpFreeParticleNodes == NULL )
+    // Fetch the thread cache.
+    ParticleCache* pParticleCache = findParticleCache();
+
+    // No cache available for this thread?
+    if ( pParticleCache == NULL )
     {
-        // No, so generate a new free pool block.
-        ParticleNode* pFreePoolBlock = new ParticleNode[mParticlePoolBlockSize];
+        // Yes, so fetch a node directly from the shared pool.
+        mPoolMutex.lock();
 
-        // Store new free pool block.
-        mParticlePool.push_back( pFreePoolBlock );
+        if ( mpFreeParticleNodes == NULL )
+            allocateParticleBlock();
 
-        // Initialise Free Pool Block.
-        for ( U32 n = 0; n < (mParticlePoolBlockSize-1); n++ )
-        {
-            pFreePoolBlock[n].mPreviousNode = NULL;
-            pFreePoolBlock[n].mNextNode     = pFreePoolBlock+n+1;
-        }
+        ParticleNode* pFreeParticleNode = mpFreeParticleNodes;
+        mpFreeParticleNodes = pFreeParticleNode->mNextNode;
+        mFreeParticleCount--;
+        mUncachedActiveCount++;
+
+        mPoolMutex.unlock();
 
-        // Insert Last Node Preceding any existing free nodes.
-        pFreePoolBlock[mParticlePoolBlockSize-1].mPreviousNode = NULL;
-        pFreePoolBlock[mParticlePoolBlockSize-1].mNextNode = mpFreeParticleNodes;
+        // Reset the free node reference.
+        pFreeParticleNode->mNextNode = NULL;
 
-        // Set Free References.
-        mpFreeParticleNodes = pFreePoolBlock;
+        return pFreeParticleNode;
     }
 
+    // Fill the cache if it's empty.
+    if ( pParticleCache->mpFreeNodes == NULL )
+        fillParticleCache( pParticleCache );
+
     // Fetch a free node,
-    ParticleNode* pFreeParticleNode = mpFreeParticleNodes;
+    ParticleNode* pFreeParticleNode = pParticleCache->mpFreeNodes;
 
     // Set the new free node reference.
-    mpFreeParticleNodes = mpFreeParticleNodes->mNextNode;
+    pParticleCache->mpFreeNodes = pFreeParticleNode->mNextNode;
+    pParticleCache->mFreeCount--;
 
-    // Reset any previous or next node references.
-    pFreeParticleNode->mNextNode        = NULL;
-    pFreeParticleNode->mPreviousNode    = NULL;
+    // Reset the free node reference.
+    pFreeParticleNode->mNextNode = NULL;
 
     // Increase the active particle count.
-    mActiveParticleCount++;
+    pParticleCache->mActiveCount++;
 
     return pFreeParticleNode;
 }
@@ -121,14 +172,391 @@ void ParticleSystem::freeParticle( ParticleNode* pParticleNode )
     // Reset the particle.
     pParticleNode->resetState();
 
-    // Remove the previous node reference.
-    pParticleNode->mPreviousNode = NULL;
-    
-    // Insert the node into the free pool.
-    pParticleNode->mNextNode = mpFreeParticleNodes;
-    mpFreeParticleNodes = pParticleNode;
+    // Fetch the thread cache.
+    ParticleCache* pParticleCache = findParticleCache();
+
+    // No cache available for this thread?
+    if ( pParticleCache == NULL )
+    {
+        // Yes, so insert the node directly into the shared pool.
+        mPoolMutex.lock();
+
+        pParticleNode->mNextNode = mpFreeParticleNodes;
+        mpFreeParticleNodes = pParticleNode;
+        mFreeParticleCount++;
+        mUncachedActiveCount--;
+
+        mPoolMutex.unlock();
+        return;
+    }
+
+    // Insert the node into the cache.
+    pParticleNode->mNextNode = pParticleCache->mpFreeNodes;
+    pParticleCache->mpFreeNodes = pParticleNode;
+    pParticleCache->mFreeCount++;
 
     // Decrease the active particle count.
-    mActiveParticleCount--;
+    pParticleCache->mActiveCount--;
+
+    // Return a batch to the shared pool if the cache has grown too large.
+    if ( pParticleCache->mFreeCount >= mParticleCacheBatchSize * 2 )
+        spillParticleCache( pParticleCache, mParticleCacheBatchSize );
 }
 
+//------------------------------------------------------------------------------
+
+void ParticleSystem::trimParticlePool( void )
+{
+    // Only trim periodically.
+    if ( mTrimCountdown > 0 )
+    {
+        mTrimCountdown--;
+        return;
+    }
+    mTrimCountdown = PARTICLE_SYSTEM_TRIM_INTERVAL;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(ParticleSystem_TrimParticlePool);
+
+    // Return all the cached nodes to the shared pool.
+    // NOTE:-   Nodes can be freed by a different thread than created them so the caches can hold nodes from any block.
+    for ( U32 n = 0; n < mParticleCacheCount; ++n )
+        spillParticleCache( mParticleCaches + n, mParticleCaches[n].mFreeCount );
+
+    // Finish if there aren't enough free nodes for a block to be released whilst keeping a spare.
+    if ( mFreeParticleCount < mParticlePoolBlockSize * 2 )
+        return;
+
+    mPoolMutex.lock();
+
+    // Count the free nodes in each block.
+    for ( U32 n = 0; n < (U32)mParticlePool.size(); ++n )
+        mParticlePool[n]->mFreeCount = 0;
+
+    for ( ParticleNode* pParticleNode = mpFreeParticleNodes; pParticleNode != NULL; pParticleNode = pParticleNode->mNextNode )
+        pParticleNode->mpBlock->mFreeCount++;
+
+    // Flag the entirely free blocks to be released, keeping a single spare block.
+    bool spareBlock = false;
+    U32 releaseCount = 0;
+    for ( U32 n = 0; n < (U32)mParticlePool.size(); ++n )
+    {
+        ParticleBlock* pParticleBlock = mParticlePool[n];
+
+        if ( pParticleBlock->mFreeCount != mParticlePoolBlockSize )
+            continue;
+
+        if ( !spareBlock )
+        {
+            // Keep this block.
+            // NOTE:-   The free count is changed so the block isn't released.
+            spareBlock = true;
+            pParticleBlock->mFreeCount = 0;
+            continue;
+        }
+
+        releaseCount++;
+    }
+
+    // Finish if there's nothing to release.
+    if ( releaseCount == 0 )
+    {
+        mPoolMutex.unlock();
+        return;
+    }
+
+    // Remove the nodes of the released blocks from the free list.
+    ParticleNode** ppNextNode = &mpFreeParticleNodes;
+    while( *ppNextNode != NULL )
+    {
+        ParticleNode* pParticleNode = *ppNextNode;
+
+        if ( pParticleNode->mpBlock->mFreeCount == mParticlePoolBlockSize )
+            *ppNextNode = pParticleNode->mNextNode;
+        else
+            ppNextNode = &pParticleNode->mNextNode;
+    }
+
+    // Release the blocks.
+    for ( S32 n = mParticlePool.size()-1; n >= 0; --n )
+    {
+        ParticleBlock* pParticleBlock = mParticlePool[n];
+
+        if ( pParticleBlock->mFreeCount != mParticlePoolBlockSize )
+            continue;
+
+        delete [] pParticleBlock->mpNodes;
+        delete pParticleBlock;
+        mParticlePool.erase_fast( n );
+    }
+
+    mFreeParticleCount -= releaseCount * mParticlePoolBlockSize;
+
+    mPoolMutex.unlock();
+}
+
+//------------------------------------------------------------------------------
+
+U32 ParticleSystem::getActiveParticleCount( void ) const
+{
+    // Sum the thread cache counts.
+    S32 activeParticleCount = mUncachedActiveCount;
+    for ( U32 n = 0; n < mParticleCacheCount; ++n )
+        activeParticleCount += mParticleCaches[n].mActiveCount;
+
+    return activeParticleCount < 0 ? 0 : (U32)activeParticleCount;
+}
+
+//------------------------------------------------------------------------------
+
+void ParticleSystem::memoryPressureCallback( const Memory::Tag tag, const Memory::Pressure pressure, void* pUserData )
+{
+    if ( tag != Memory::TagParticles )
+        return;
+
+    ParticleSystem* pParticleSystem = (ParticleSystem*)pUserData;
+
+    // Lift the pressure budget once the pressure has gone.
+    if ( pressure == Memory::PressureNone )
+    {
+        pParticleSystem->mPressureParticleBudget = 0;
+        return;
+    }
+
+    // Tighten the pressure budget below the active particles, more so under hard pressure.
+    // This is repeated whilst the pressure remains so the budget continues to tighten.
+    const U32 activeParticleCount = getMin( pParticleSystem->getActiveParticleCount(), pParticleSystem->getEffectiveParticleBudget() );
+    const U32 pressureParticleBudget = pressure == Memory::PressureHard ? activeParticleCount / 2 : (activeParticleCount * 3) / 4;
+    pParticleSystem->mPressureParticleBudget = getMax( pressureParticleBudget, (U32)1 );
+}
+
+//------------------------------------------------------------------------------
+
+ParticleSystem::ParticleCache* ParticleSystem::findParticleCache( void )
+{
+    // Fetch the current thread.
+    const ThreadIdent threadId = ThreadManager::getCurrentThreadId();
+
+    // Search the existing caches.
+    // NOTE:-   A cache is fully configured before the count includes it so this is safe without locking.
+    const U32 cacheCount = mParticleCacheCount;
+    for ( U32 n = 0; n < cacheCount; ++n )
+    {
+        if ( ThreadManager::compare( mParticleCaches[n].mThreadId, threadId ) )
+            return mParticleCaches + n;
+    }
+
+    // Add a cache for this thread.
+    mPoolMutex.lock();
+
+    // Finish if there are no caches left.
+    if ( mParticleCacheCount == PARTICLE_SYSTEM_MAX_THREAD_CACHES )
+    {
+        mPoolMutex.unlock();
+        return NULL;
+    }
+
+    ParticleCache* pParticleCache = mParticleCaches + mParticleCacheCount;
+    pParticleCache->mThreadId = threadId;
+    pParticleCache->mpFreeNodes = NULL;
+    pParticleCache->mFreeCount = 0;
+    pParticleCache->mActiveCount = 0;
+    mParticleCacheCount++;
+
+    mPoolMutex.unlock();
+
+    return pParticleCache;
+}
+
+//------------------------------------------------------------------------------
+
+void ParticleSystem::fillParticleCache( ParticleCache* pParticleCache )
+{
+    mPoolMutex.lock();
+
+    // Make sure there are enough free nodes for a batch.
+    if ( mFreeParticleCount < mParticleCacheBatchSize )
+        allocateParticleBlock();
+
+    // Move a batch of nodes to the cache.
+    for ( U32 n = 0; n < mParticleCacheBatchSize; ++n )
+    {
+        ParticleNode* pParticleNode = mpFreeParticleNodes;
+        mpFreeParticleNodes = pParticleNode->mNextNode;
+
+        pParticleNode->mNextNode = pParticleCache->mpFreeNodes;
+        pParticleCache->mpFreeNodes = pParticleNode;
+    }
+
+    mFreeParticleCount -= mParticleCacheBatchSize;
+    pParticleCache->mFreeCount += mParticleCacheBatchSize;
+
+    mPoolMutex.unlock();
+}
+
+//------------------------------------------------------------------------------
+
+void ParticleSystem::spillParticleCache( ParticleCache* pParticleCache, const U32 count )
+{
+    // Sanity!
+    AssertFatal( count <= pParticleCache->mFreeCount, "ParticleSystem::spillParticleCache() - Cannot spill more nodes than the cache holds." );
+
+    // Finish if nothing to spill.
+    if ( count == 0 )
+        return;
+
+    // Detach the nodes from the cache.
+    ParticleNode* pFirstNode = pParticleCache->mpFreeNodes;
+    ParticleNode* pLastNode = pFirstNode;
+    for ( U32 n = 1; n < count; ++n )
+        pLastNode = pLastNode->mNextNode;
+
+    pParticleCache->mpFreeNodes = pLastNode->mNextNode;
+    pParticleCache->mFreeCount -= count;
+
+    // Insert the nodes into the shared pool.
+    mPoolMutex.lock();
+
+    pLastNode->mNextNode = mpFreeParticleNodes;
+    mpFreeParticleNodes = pFirstNode;
+    mFreeParticleCount += count;
+
+    mPoolMutex.unlock();
+}
+
+//------------------------------------------------------------------------------
+
+void ParticleSystem::allocateParticleBlock( void )
+{
+    // NOTE:-   The pool mutex must be held by the caller.
+
+    Memory::TagScope tagScope( Memory::TagParticles );
+
+    // Generate a new free pool block.
+    ParticleBlock* pParticleBlock = new ParticleBlock();
+    pParticleBlock->mpNodes = new ParticleNode[mParticlePoolBlockSize];
+    pParticleBlock->mFreeCount = mParticlePoolBlockSize;
+
+    // Store new free pool block.
+    mParticlePool.push_back( pParticleBlock );
+
+    // Initialise Free Pool Block.
+    ParticleNode* pFreePoolBlock = pParticleBlock->mpNodes;
+    for ( U32 n = 0; n < mParticlePoolBlockSize; n++ )
+    {
+        pFreePoolBlock[n].mpBlock = pParticleBlock;
+        pFreePoolBlock[n].mNextNode = pFreePoolBlock+n+1;
+    }
+
+    // Insert Last Node Preceding any existing free nodes.
+    pFreePoolBlock[mParticlePoolBlockSize-1].mNextNode = mpFreeParticleNodes;
+
+    // Set Free References.
+    mpFreeParticleNodes = pFreePoolBlock;
+    mFreeParticleCount += mParticlePoolBlockSize;
+}
+
+//------------------------------------------------------------------------------
+
+U32 ParticleSystem::ParticleStore::append( ParticleNode* pParticleNode )
+{
+    // Sanity!
+    AssertFatal( pParticleNode != NULL, "ParticleSystem::ParticleStore::append() - Cannot append a NULL particle node." );
+
+    // Fetch the new particle index.
+    const U32 particleIndex = size();
+
+    Memory::TagScope tagScope( Memory::TagParticles );
+
+    // Grow all the arrays.
+    mParticleAge.increment();
+    mParticleLifetime.increment();
+    mPosition.increment();
+    mVelocity.increment();
+    mOrientationAngle.increment();
+    mSize.increment();
+    mSpeed.increment();
+    mSpin.increment();
+    mFixedForce.increment();
+    mRandomMotion.increment();
+    mRenderSize.increment();
+    mRenderSpeed.increment();
+    mRenderSpin.increment();
+    mRenderFixedForce.increment();
+    mRenderRandomMotion.increment();
+    mColor.increment();
+    mPreTickPosition.increment();
+    mPostTickPosition.increment();
+    mRenderTickPosition.increment();
+    mTransform.increment();
+    mTransform.last().SetIdentity();
+    mRenderOOBB.increment();
+    mNodes.push_back( pParticleNode );
+
+    return particleIndex;
+}
+
+//------------------------------------------------------------------------------
+
+void ParticleSystem::ParticleStore::move( const U32 fromIndex, const U32 toIndex )
+{
+    // Sanity!
+    AssertFatal( fromIndex < size() && toIndex < size(), "ParticleSystem::ParticleStore::move() - Particle index is out of bounds." );
+
+    mParticleAge[toIndex]           = mParticleAge[fromIndex];
+    mParticleLifetime[toIndex]      = mParticleLifetime[fromIndex];
+    mPosition[toIndex]              = mPosition[fromIndex];
+    mVelocity[toIndex]              = mVelocity[fromIndex];
+    mOrientationAngle[toIndex]      = mOrientationAngle[fromIndex];
+    mSize[toIndex]                  = mSize[fromIndex];
+    mSpeed[toIndex]                 = mSpeed[fromIndex];
+    mSpin[toIndex]                  = mSpin[fromIndex];
+    mFixedForce[toIndex]            = mFixedForce[fromIndex];
+    mRandomMotion[toIndex]          = mRandomMotion[fromIndex];
+    mRenderSize[toIndex]            = mRenderSize[fromIndex];
+    mRenderSpeed[toIndex]           = mRenderSpeed[fromIndex];
+    mRenderSpin[toIndex]            = mRenderSpin[fromIndex];
+    mRenderFixedForce[toIndex]      = mRenderFixedForce[fromIndex];
+    mRenderRandomMotion[toIndex]    = mRenderRandomMotion[fromIndex];
+    mColor[toIndex]                 = mColor[fromIndex];
+    mPreTickPosition[toIndex]       = mPreTickPosition[fromIndex];
+    mPostTickPosition[toIndex]      = mPostTickPosition[fromIndex];
+    mRenderTickPosition[toIndex]    = mRenderTickPosition[fromIndex];
+    mTransform[toIndex]             = mTransform[fromIndex];
+    mRenderOOBB[toIndex]            = mRenderOOBB[fromIndex];
+    mNodes[toIndex]                 = mNodes[fromIndex];
+}
+
+//------------------------------------------------------------------------------
+
+void ParticleSystem::ParticleStore::truncate( const U32 count )
+{
+    // Finish if nothing to discard.
+    if ( count >= size() )
+        return;
+
+    // Shrink all the arrays.
+    // NOTE:-   The capacity is kept so the arrays don't reallocate as the emission rate fluctuates.
+    mParticleAge.setSize( count );
+    mParticleLifetime.setSize( count );
+    mPosition.setSize( count );
+    mVelocity.setSize( count );
+    mOrientationAngle.setSize( count );
+    mSize.setSize( count );
+    mSpeed.setSize( count );
+    mSpin.setSize( count );
+    mFixedForce.setSize( count );
+    mRandomMotion.setSize( count );
+    mRenderSize.setSize( count );
+    mRenderSpeed.setSize( count );
+    mRenderSpin.setSize( count );
+    mRenderFixedForce.setSize( count );
+    mRenderRandomMotion.setSize( count );
+    mColor.setSize( count );
+    mPreTickPosition.setSize( count );
+    mPostTickPosition.setSize( count );
+    mRenderTickPosition.setSize( count );
+    mTransform.setSize( count );
+    mRenderOOBB.setSize( count );
+    mNodes.setSize( count );
+}
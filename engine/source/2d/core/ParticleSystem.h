@@ -27,64 +27,171 @@
 #include "2d/core/ImageFrameProvider.h"
 #endif
 
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// The maximum number of particles that can be active across all particle players (zero is unlimited).
+#define PARTICLE_SYSTEM_PARTICLE_BUDGET     "$pref::T2D::ParticleBudget"
+
+/// The maximum number of threads that can hold a particle node cache.
+/// Any further threads allocate directly from the shared pool.
+#define PARTICLE_SYSTEM_MAX_THREAD_CACHES   64
+
+//-----------------------------------------------------------------------------
+
+class ParticlePlayer;
+
 //-----------------------------------------------------------------------------
 
 class ParticleSystem
 {
 public:
+    struct ParticleBlock;
+
+    /// Emitter integration.
+    /// Identifies an emitter whose particles are waiting to be integrated at the end of the scene tick.
+    struct EmitterIntegration
+    {
+        ParticlePlayer*         mpParticlePlayer;
+        U32                     mEmitterIndex;
+    };
+
     /// Particle node.
+    /// These are the per-particle objects that can't be held in the emitter's particle store
+    /// because they can't be moved with a simple copy.  Everything else lives in the store.
     struct ParticleNode : public IFactoryObjectReset
     {
-        /// Particle Node Linkages.
-        ParticleNode*           mPreviousNode;
+        /// Free Node Linkage.
         ParticleNode*           mNextNode;
 
-        /// Suppress Movement.
-        bool                    mSuppressMovement;
+        /// Owning Pool Block.
+        ParticleBlock*          mpBlock;
 
         /// Particle Components.
-        F32                     mParticleLifetime;
-        F32                     mParticleAge;
-        Vector2                 mPosition;
-        Vector2                 mVelocity;
-        F32                     mOrientationAngle;
-        Vector2                 mRenderOOBB[4];
-        b2Transform             mTransform;
         ImageFrameProviderCore  mFrameProvider;
 
-        /// Render Properties.
-        Vector2                 mRenderSize;
-        F32                     mRenderSpeed;
-        F32                     mRenderSpin;
-        F32                     mRenderFixedForce;
-        F32                     mRenderRandomMotion;
+        ParticleNode() : mNextNode(NULL), mpBlock(NULL) { constructInPlace<ImageFrameProviderCore>(&mFrameProvider); resetState(); }
+
+        virtual void resetState( void )
+        {
+            mFrameProvider.resetState();
+        }
+    };
+
+    /// Particle pool block.
+    /// A single allocation of particle nodes.  A block is only released once all its nodes are free.
+    struct ParticleBlock
+    {
+        ParticleNode*           mpNodes;
+        U32                     mFreeCount;
+    };
+
+    /// Particle thread cache.
+    /// Free nodes owned by a single thread so that creating and freeing particles doesn't touch the shared pool.
+    /// Nodes move between the cache and the shared pool in batches.
+    struct ParticleCache
+    {
+        ThreadIdent             mThreadId;
+        ParticleNode*           mpFreeNodes;
+        U32                     mFreeCount;
+
+        /// The particles created less those freed by this thread.
+        /// This can be negative as a particle can be freed by a different thread than created it.
+        S32                     mActiveCount;
+    };
+
+    /// Particle render OOBB.
+    struct ParticleOOBB
+    {
+        Vector2                 mVertex[4];
+    };
+
+    /// Particle store.
+    /// The hot particle properties of a single emitter held as contiguous arrays (one element per particle)
+    /// so the per-tick loops stream through memory rather than chasing nodes.  Particles are held in
+    /// creation order i.e. the oldest particle is at index zero.
+    class ParticleStore
+    {
+    public:
+        /// Particle Components.
+        Vector<F32>             mParticleAge;
+        Vector<F32>             mParticleLifetime;
+        Vector<Vector2>         mPosition;
+        Vector<Vector2>         mVelocity;
+        Vector<F32>             mOrientationAngle;
 
         /// Base Properties.
-        Vector2                 mSize;
-        F32                     mSpeed;
-        F32                     mSpin;
-        F32                     mFixedForce;
-        F32                     mRandomMotion;
-        ColorF                  mColor;    
+        Vector<Vector2>         mSize;
+        Vector<F32>             mSpeed;
+        Vector<F32>             mSpin;
+        Vector<F32>             mFixedForce;
+        Vector<F32>             mRandomMotion;
+
+        /// Render Properties.
+        Vector<Vector2>         mRenderSize;
+        Vector<F32>             mRenderSpeed;
+        Vector<F32>             mRenderSpin;
+        Vector<F32>             mRenderFixedForce;
+        Vector<F32>             mRenderRandomMotion;
+        Vector<ColorF>          mColor;
 
         /// Interpolated Tick Position.
-        Vector2                 mPreTickPosition;
-        Vector2                 mPostTickPosition;
-        Vector2                 mRenderTickPosition;
+        Vector<Vector2>         mPreTickPosition;
+        Vector<Vector2>         mPostTickPosition;
+        Vector<Vector2>         mRenderTickPosition;
+        Vector<b2Transform>     mTransform;
+        Vector<ParticleOOBB>    mRenderOOBB;
+        Vector<ParticleNode*>   mNodes;
 
-        ParticleNode() { constructInPlace<ImageFrameProviderCore>(&mFrameProvider); resetState(); }
+        inline U32 size( void ) const { return (U32)mNodes.size(); }
 
-        virtual void resetState( void )
-        {
-            mFrameProvider.resetState();
-        }
+        /// Append a particle using the specified node, returning its index.
+        U32 append( ParticleNode* pParticleNode );
+
+        /// Move the particle at "fromIndex" to "toIndex", overwriting the particle there.
+        void move( const U32 fromIndex, const U32 toIndex );
+
+        /// Discard all particles at or beyond the specified count.
+        /// Nodes are not freed here.
+        void truncate( const U32 count );
     };
 
 private:
     const U32               mParticlePoolBlockSize;
-    Vector<ParticleNode*>   mParticlePool;
+    const U32               mParticleCacheBatchSize;
+
+    /// Shared pool.
+    Mutex                   mPoolMutex;
+    Vector<ParticleBlock*>  mParticlePool;
     ParticleNode*           mpFreeParticleNodes;
-    U32                     mActiveParticleCount;
+    U32                     mFreeParticleCount;
+    S32                     mUncachedActiveCount;
+
+    /// Thread caches.
+    /// Caches are only ever appended (under the pool mutex) so they can be searched without locking.
+    ParticleCache           mParticleCaches[PARTICLE_SYSTEM_MAX_THREAD_CACHES];
+    volatile U32            mParticleCacheCount;
+
+    U32                     mTrimCountdown;
+    S32                     mParticleBudget;
+
+    /// The budget imposed under memory pressure (zero is none).
+    U32                     mPressureParticleBudget;
+    U32                     mMemoryPressureCallbackKey;
+
+    static void memoryPressureCallback( const Memory::Tag tag, const Memory::Pressure pressure, void* pUserData );
+
+    ParticleCache* findParticleCache( void );
+    void fillParticleCache( ParticleCache* pParticleCache );
+    void spillParticleCache( ParticleCache* pParticleCache, const U32 count );
+    void allocateParticleBlock( void );
 
 public:
     static void Init( void );
@@ -94,11 +201,38 @@ public:
     ParticleSystem();
     ~ParticleSystem();
 
+    /// Particle creation.
+    /// These are safe to call from any thread.
     ParticleNode* createParticle( void );
     void freeParticle( ParticleNode* pParticleNode );
 
-    inline U32 getActiveParticleCount( void ) const { return mActiveParticleCount; };
+    /// Release the pool blocks that are entirely free, keeping a single spare block.
+    /// This only does any work periodically so it can be called every tick.  It must only be called
+    /// when no other thread is creating or freeing particles.
+    void trimParticlePool( void );
+
+    U32 getActiveParticleCount( void ) const;
     inline U32 getAllocatedParticleCount( void ) const { return (U32)mParticlePool.size() * mParticlePoolBlockSize; }
+
+    /// Particle budget.
+    /// Players must not emit more particles than remain within the budget.  The budget is
+    /// tightened whilst the particles memory tag is under memory pressure.
+    inline void setParticleBudget( const S32 particleBudget ) { mParticleBudget = particleBudget; }
+    inline S32 getParticleBudget( void ) const { return mParticleBudget; }
+    inline U32 getEffectiveParticleBudget( void ) const
+    {
+        const U32 particleBudget = mParticleBudget <= 0 ? U32_MAX : (U32)mParticleBudget;
+        return mPressureParticleBudget == 0 ? particleBudget : getMin( particleBudget, mPressureParticleBudget );
+    }
+    inline U32 getRemainingParticleBudget( void ) const
+    {
+        const U32 particleBudget = getEffectiveParticleBudget();
+        if ( particleBudget == U32_MAX )
+            return U32_MAX;
+
+        const U32 activeParticleCount = getActiveParticleCount();
+        return activeParticleCount >= particleBudget ? 0 : particleBudget - activeParticleCount;
+    }
 };
 
 #endif // _PARTICLE_SYSTEM_H_
@@ -67,8 +67,58 @@ void SpriteBase::integrateObject( const F32 totalTime, const F32 elapsedTime, De
     // Call Parent.
     Parent::integrateObject( totalTime, elapsedTime, pDebugStats );
 
+    // Fetch whether the animation is running.
+    const bool animating = !isStaticFrameProvider() && !isAnimationPaused() && !isAnimationFinished();
+
+    // Fetch the current animation frame.
+    const S32 animationFrame = getAnimationFrame();
+
     // Update image frame provider.
     ImageFrameProvider::update( elapsedTime );
+
+    // Invalidate the layer render cache if the animation frame changed.
+    if ( animating && getAnimationFrame() != animationFrame )
+        invalidateRenderCache();
+}
+
+//------------------------------------------------------------------------------
+
+bool SpriteBase::setImage( const char* pImageAssetId, const U32 frame )
+{
+    invalidateRenderCache();
+    return ImageFrameProvider::setImage( pImageAssetId, frame );
+}
+
+//------------------------------------------------------------------------------
+
+bool SpriteBase::setImage( const char* pImageAssetId, const char* pNamedFrame )
+{
+    invalidateRenderCache();
+    return ImageFrameProvider::setImage( pImageAssetId, pNamedFrame );
+}
+
+//------------------------------------------------------------------------------
+
+bool SpriteBase::setImageFrame( const U32 frame )
+{
+    invalidateRenderCache();
+    return ImageFrameProvider::setImageFrame( frame );
+}
+
+//------------------------------------------------------------------------------
+
+bool SpriteBase::setNamedImageFrame( const char* frame )
+{
+    invalidateRenderCache();
+    return ImageFrameProvider::setNamedImageFrame( frame );
+}
+
+//------------------------------------------------------------------------------
+
+bool SpriteBase::setAnimation( const char* pAnimationAssetId )
+{
+    invalidateRenderCache();
+    return ImageFrameProvider::setAnimation( pAnimationAssetId );
 }
 
 //------------------------------------------------------------------------------
@@ -102,3 +152,14 @@ void SpriteBase::onAnimationEnd( void )
     // Do script callback.
     Con::executef( this, 1, "onAnimationEnd" );
 }
+
+//------------------------------------------------------------------------------
+
+void SpriteBase::onAssetRefreshed( AssetPtrBase* pAssetPtrBase )
+{
+    // Call image frame provider.
+    ImageFrameProvider::onAssetRefreshed( pAssetPtrBase );
+
+    // Invalidate the layer render cache.
+    invalidateRenderCache();
+}
@@ -44,9 +44,19 @@ public:
     static void initPersistFields();
 
     virtual void integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
+    virtual bool isTickDormant( void ) const { return Parent::isTickDormant() && ( isStaticFrameProvider() || isAnimationPaused() || isAnimationFinished() ); }
 
     virtual bool validRender( void ) const;
     virtual bool shouldRender( void ) const { return true; }
+    virtual bool canCacheRender( void ) const { return Parent::canCacheRender() && ( isStaticFrameProvider() || isAnimationPaused() || isAnimationFinished() ); }
+
+    /// Frame provider changes invalidate the layer render cache.
+    using ImageFrameProvider::setImage;
+    virtual bool setImage( const char* pImageAssetId, const U32 frame );
+    virtual bool setImage( const char* pImageAssetId, const char* pNamedFrame );
+    virtual bool setImageFrame( const U32 frame );
+    virtual bool setNamedImageFrame( const char* frame );
+    virtual bool setAnimation( const char* pAnimationAssetId );
 
     virtual void copyTo(SimObject* object);
 
@@ -55,6 +65,7 @@ public:
 
 protected:
     virtual void onAnimationEnd( void );
+    virtual void onAssetRefreshed( AssetPtrBase* pAssetPtrBase );
 
 protected:
     static bool setImage(void* obj, const char* data)                           { DYNAMIC_VOID_CAST_TO(SpriteBase, ImageFrameProvider, obj)->setImage(data); return false; };
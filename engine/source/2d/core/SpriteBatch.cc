@@ -38,6 +38,52 @@ static StringTableEntry spritesNodeName = StringTable->insert( "Sprites" );
 
 //------------------------------------------------------------------------------
 
+static EnumTable::Enums batchDeformLookup[] =
+                {
+                    { BatchVertexDeform::DEFORM_NONE,   "off"   },
+                    { BatchVertexDeform::DEFORM_WAVE,   "wave"  },
+                    { BatchVertexDeform::DEFORM_SWAY,   "sway"  },
+                    { BatchVertexDeform::DEFORM_BEND,   "bend"  },
+                };
+
+EnumTable SpriteBatch::batchDeformTable(sizeof(batchDeformLookup) / sizeof(EnumTable::Enums), &batchDeformLookup[0]);
+
+//-----------------------------------------------------------------------------
+
+BatchVertexDeform::DeformMode SpriteBatch::getBatchDeformEnum( const char* label )
+{
+    // Search for Mnemonic.
+    for (U32 i = 0; i < (sizeof(batchDeformLookup) / sizeof(EnumTable::Enums)); i++)
+    {
+        if( dStricmp(batchDeformLookup[i].label, label) == 0)
+            return (BatchVertexDeform::DeformMode)batchDeformLookup[i].index;
+    }
+
+    // Warn.
+    Con::warnf("SpriteBatch::getBatchDeformEnum() - Invalid batch deform mode of '%s'", label );
+
+    return BatchVertexDeform::DEFORM_INVALID;
+}
+
+//-----------------------------------------------------------------------------
+
+const char* SpriteBatch::getBatchDeformDescription( const BatchVertexDeform::DeformMode deformMode )
+{
+    // Search for Mnemonic.
+    for (U32 i = 0; i < (sizeof(batchDeformLookup) / sizeof(EnumTable::Enums)); i++)
+    {
+        if( batchDeformLookup[i].index == deformMode )
+            return batchDeformLookup[i].label;
+    }
+
+    // Warn.
+    Con::warnf( "SpriteBatch::getBatchDeformDescription() - Invalid batch deform mode.");
+
+    return StringTable->EmptyString;
+}
+
+//------------------------------------------------------------------------------
+
 SpriteBatch::SpriteBatch() :
     mMasterBatchId( 0 ),
     mSelectedSprite( NULL ),
@@ -45,8 +91,15 @@ SpriteBatch::SpriteBatch() :
     mDefaultSpriteStride( 1.0f, 1.0f),
     mDefaultSpriteSize( 1.0f, 1.0f ),
     mDefaultSpriteAngle( 0.0f ),
+    mBatchDeformMode( BatchVertexDeform::DEFORM_NONE ),
+    mBatchDeformAmplitude( 0.1f ),
+    mBatchDeformFrequency( 10.0f ),
+    mBatchDeformSpeed( 90.0f ),
+    mBatchDeformHeight( 1.0f ),
+    mBatchDeformTime( 0.0f ),
     mpSpriteBatchQuery( NULL ),
-    mBatchCulling( true )
+    mBatchCulling( true ),
+    mBatchGridCulling( false )
 {
     // Reset batch transform.
     mBatchTransform.SetIdentity();
@@ -56,12 +109,24 @@ SpriteBatch::SpriteBatch() :
     // Reset local extents.
     mLocalExtents.SetZero();
     mLocalExtentsDirty = true;
+
+    // Reset sprite chunks.
+    mBatchChunkSize = 0.0f;
+    mSpriteChunksDirty = true;
+    VECTOR_SET_ASSOCIATION( mSpriteChunks );
+
+    // Reset sprite grid.
+    mSpriteGridMargin.SetZero();
+    mSpriteGridDirty = true;
+    VECTOR_SET_ASSOCIATION( mSpriteGridOverflow );
 }
 
 //------------------------------------------------------------------------------
 
 SpriteBatch::~SpriteBatch()
 {
+    // Delete the sprite chunks.
+    destroySpriteChunks();
 }
 
 //-----------------------------------------------------------------------------
@@ -82,6 +147,9 @@ void SpriteBatch::onRemove()
     // Clear the sprites.
     clearSprites();
 
+    // Delete the sprite chunks.
+    destroySpriteChunks();
+
     // Delete the sprite batch query.
     destroySpriteBatchQuery();
 }
@@ -99,6 +167,61 @@ void SpriteBatch::prepareRender( SceneRenderObject* pSceneRenderObject, const Sc
     // Calculate local AABB.
     const b2AABB localAABB = calculateLocalAABB( pSceneRenderState->mRenderAABB );
 
+    // Are we rendering chunks?
+    if ( getChunkedRender() )
+    {
+        // Yes, so update the sprite chunks.
+        updateSpriteChunks();
+
+        const U32 chunkCount = (U32)mSpriteChunks.size();
+
+        // Cull all the chunks against the view together.
+        if ( mBatchCulling )
+        {
+            mSpriteChunkCullAABBs.setSize( chunkCount );
+            mSpriteChunkCullResults.setSize( chunkCount );
+            for ( U32 n = 0; n < chunkCount; n++ )
+                mSpriteChunkCullAABBs[n] = mSpriteChunks[n]->mLocalAABB;
+
+            m_aabb2F_bulk_overlap( (const F32*)mSpriteChunkCullAABBs.address(), chunkCount, (const F32*)&localAABB, mSpriteChunkCullResults.address() );
+        }
+
+        // Perform a render request for all the visible chunks.
+        for ( U32 n = 0; n < chunkCount; n++ )
+        {
+            // Fetch sprite chunk.
+            SpriteChunk* pSpriteChunk = mSpriteChunks[n];
+
+            // Skip if culling and the chunk is not in view.
+            if ( mBatchCulling && mSpriteChunkCullResults[n] == 0 )
+                continue;
+
+            // Create a render request.
+            SceneRenderRequest* pSceneRenderRequest = pSceneRenderQueue->createRenderRequest();
+
+            // Set position.
+            pSceneRenderRequest->mWorldPosition = b2Mul( mBatchTransform, pSpriteChunk->mLocalAABB.GetCenter() );
+            pSceneRenderRequest->mSerialId = n;
+
+            // Set identity.
+            pSceneRenderRequest->mpSceneRenderObject = pSceneRenderObject;
+
+            // Set custom data.
+            pSceneRenderRequest->mpCustomData1 = pSpriteChunk;
+            pSceneRenderRequest->mCustomDataKey1 = SPRITE_CHUNK_REQUEST;
+        }
+
+        return;
+    }
+
+    // Are we culling using the logical grid?
+    if ( getGridCulling() )
+    {
+        // Yes, so prepare the visible grid cells.
+        prepareGridRender( pSceneRenderObject, localAABB, pSceneRenderQueue );
+        return;
+    }
+
     // Do we have a sprite batch query?
     if ( mpSpriteBatchQuery != NULL )
     {
@@ -181,11 +304,31 @@ void SpriteBatch::prepareRender( SceneRenderObject* pSceneRenderObject, const Sc
 
 void SpriteBatch::render( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer )
 {
-    // Fetch sprite batch Item.
-    SpriteBatchItem* pSpriteBatchItem = (SpriteBatchItem*)pSceneRenderRequest->mpCustomData1;
+    // Deform the submitted vertices if the batch is deformed.
+    // NOTE: This is applied by the batch renderer so the sprites (and any captured chunks) are untouched.
+    if ( getBatchDeformed() )
+    {
+        updateBatchDeform();
+        pBatchRenderer->setVertexDeform( &mBatchDeform );
+    }
 
-    // Batch render.
-    pSpriteBatchItem->render( pBatchRenderer, pSceneRenderRequest, mBatchTransformId );
+    // Is this a sprite chunk?
+    if ( pSceneRenderRequest->mCustomDataKey1 == SPRITE_CHUNK_REQUEST )
+    {
+        // Yes, so render the sprite chunk.
+        renderSpriteChunk( (SpriteChunk*)pSceneRenderRequest->mpCustomData1, pBatchRenderer );
+    }
+    else
+    {
+        // No, so fetch sprite batch Item.
+        SpriteBatchItem* pSpriteBatchItem = (SpriteBatchItem*)pSceneRenderRequest->mpCustomData1;
+
+        // Batch render.
+        pSpriteBatchItem->render( pBatchRenderer, pSceneRenderRequest, mBatchTransformId );
+    }
+
+    // Clear any deformation.
+    pBatchRenderer->setVertexDeform( NULL );
 }
 
 //------------------------------------------------------------------------------
@@ -274,12 +417,23 @@ void SpriteBatch::copyTo( SpriteBatch* pSpriteBatch ) const
 
     // Set batch culling.
     pSpriteBatch->setBatchCulling( getBatchCulling() );
+    pSpriteBatch->setBatchGridCulling( getBatchGridCulling() );
+
+    // Set batch chunk size.
+    pSpriteBatch->setBatchChunkSize( getBatchChunkSize() );
 
     // Set sprite default size and angle.
     pSpriteBatch->setDefaultSpriteStride( getDefaultSpriteStride() );
     pSpriteBatch->setDefaultSpriteSize( getDefaultSpriteSize() );
     pSpriteBatch->setDefaultSpriteAngle( getDefaultSpriteAngle() );
 
+    // Set batch deformation.
+    pSpriteBatch->setBatchDeform( getBatchDeform() );
+    pSpriteBatch->setBatchDeformAmplitude( getBatchDeformAmplitude() );
+    pSpriteBatch->setBatchDeformFrequency( getBatchDeformFrequency() );
+    pSpriteBatch->setBatchDeformSpeed( getBatchDeformSpeed() );
+    pSpriteBatch->setBatchDeformHeight( getBatchDeformHeight() );
+
     // Copy sprites.   
     for( typeSpriteBatchHash::const_iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
     {        
@@ -318,6 +472,9 @@ U32 SpriteBatch::addSprite( const SpriteBatchItem::LogicalPosition& logicalPosit
     // Flag local extents as dirty.
     setLocalExtentsDirty();
 
+    // Notify the batch of the change.
+    onSpritesChanged();
+
     return mSelectedSprite->getBatchId();
 }
 
@@ -351,6 +508,9 @@ bool SpriteBatch::removeSprite( void )
     // Flag local extents as dirty.
     setLocalExtentsDirty();
 
+    // Notify the batch of the change.
+    onSpritesChanged();
+
     return true;
 }
 
@@ -380,6 +540,9 @@ void SpriteBatch::clearSprites( void )
 
     // Flag local extents as dirty.
     setLocalExtentsDirty();
+
+    // Notify the batch of the change.
+    onSpritesChanged();
 }
 
 //------------------------------------------------------------------------------
@@ -394,10 +557,249 @@ void SpriteBatch::setBatchCulling( const bool batchCulling )
     mBatchCulling = batchCulling;
 
     // Create/destroy sprite batch query appropriately.
-    if ( mBatchCulling )
-        createSpriteBatchQuery();
+    refreshSpriteBatchQuery();
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::setBatchGridCulling( const bool gridCulling )
+{
+    // Finish if no change.
+    if ( mBatchGridCulling == gridCulling )
+        return;
+
+    // Set batch grid culling.
+    mBatchGridCulling = gridCulling;
+
+    // Flag the sprite grid as dirty.
+    mSpriteGridDirty = true;
+
+    // Create/destroy sprite batch query appropriately.
+    refreshSpriteBatchQuery();
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::setBatchChunkSize( const F32 chunkSize )
+{
+    // Sanity!
+    if ( chunkSize < 0.0f )
+    {
+        Con::warnf( "SpriteBatch::setBatchChunkSize() - Invalid chunk size of '%g'.", chunkSize );
+        return;
+    }
+
+    // Finish if no change.
+    if ( mIsEqual( mBatchChunkSize, chunkSize ) )
+        return;
+
+    // Set batch chunk size.
+    mBatchChunkSize = chunkSize;
+
+    // Delete the sprite chunks.
+    destroySpriteChunks();
+
+    // Notify the batch of the change.
+    onSpritesChanged();
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::updateSpriteChunks( void )
+{
+    // Finish if the sprite chunks are up-to-date.
+    if ( !mSpriteChunksDirty )
+        return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatch_UpdateSpriteChunks);
+
+    // Delete the existing sprite chunks.
+    destroySpriteChunks();
+
+    // Chunk cells are keyed by their packed grid coordinates.
+    typedef HashMap< U32, S32 > typeChunkCellHash;
+    typeChunkCellHash chunkCells;
+
+    const F32 inverseChunkSize = 1.0f / mBatchChunkSize;
+
+    // Assign each sprite to the chunk containing its center.
+    for( typeSpriteBatchHash::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
+    {
+        // Fetch sprite batch Item.
+        SpriteBatchItem* pSpriteBatchItem = spriteItr->value;
+
+        // Fetch the local AABB.
+        const b2AABB& localAABB = pSpriteBatchItem->getLocalAABB();
+
+        // Calculate the chunk cell.
+        const b2Vec2 center = localAABB.GetCenter();
+        const S32 cellX = (S32)mFloor( center.x * inverseChunkSize );
+        const S32 cellY = (S32)mFloor( center.y * inverseChunkSize );
+        const U32 cellKey = ((U32)(cellX & 0xFFFF) << 16) | (U32)(cellY & 0xFFFF);
+
+        // Find the chunk cell.
+        S32 chunkIndex;
+        typeChunkCellHash::iterator cellItr = chunkCells.find( cellKey );
+        if ( cellItr == chunkCells.end() )
+        {
+            // Not found so create a new chunk.
+            chunkIndex = (S32)mSpriteChunks.size();
+            SpriteChunk* pSpriteChunk = new SpriteChunk();
+            pSpriteChunk->mLocalAABB = localAABB;
+            pSpriteChunk->mTransformId = mBatchTransformId;
+            mSpriteChunks.push_back( pSpriteChunk );
+            chunkCells.insert( cellKey, chunkIndex );
+        }
+        else
+        {
+            // Found so expand the chunk.
+            chunkIndex = cellItr->value;
+            mSpriteChunks[chunkIndex]->mLocalAABB.Combine( localAABB );
+        }
+
+        // Add the sprite to the chunk.
+        mSpriteChunks[chunkIndex]->mSprites.push_back( pSpriteBatchItem );
+        pSpriteBatchItem->setChunkIndex( chunkIndex );
+    }
+
+    // Flag the sprite chunks as NOT dirty.
+    mSpriteChunksDirty = false;
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::destroySpriteChunks( void )
+{
+    // Delete all the sprite chunks.
+    for ( Vector<SpriteChunk*>::iterator chunkItr = mSpriteChunks.begin(); chunkItr != mSpriteChunks.end(); ++chunkItr )
+    {
+        delete *chunkItr;
+    }
+    mSpriteChunks.clear();
+
+    // Flag the sprite chunks as dirty.
+    mSpriteChunksDirty = true;
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::invalidateSpriteChunk( SpriteBatchItem* pSpriteBatchItem )
+{
+    // Finish if the sprite chunks are to be rebuilt anyway.
+    if ( mSpriteChunksDirty || pSpriteBatchItem == NULL )
+        return;
+
+    // Fetch the sprite chunk index.
+    const S32 chunkIndex = pSpriteBatchItem->getChunkIndex();
+
+    // Finish if the sprite is not in a chunk.
+    if ( chunkIndex == INVALID_SPRITE_CHUNK || chunkIndex >= (S32)mSpriteChunks.size() )
+        return;
+
+    // Invalidate the chunk.
+    SpriteChunk* pSpriteChunk = mSpriteChunks[chunkIndex];
+    pSpriteChunk->mValid = false;
+    pSpriteChunk->mStableFrames = 0;
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::renderSpriteChunk( SpriteChunk* pSpriteChunk, BatchRender* pBatchRenderer )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatch_RenderSpriteChunk);
+
+    // Invalidate the chunk if the batch has moved since it was captured.
+    if ( pSpriteChunk->mTransformId != mBatchTransformId )
+    {
+        pSpriteChunk->mTransformId = mBatchTransformId;
+        pSpriteChunk->mValid = false;
+        pSpriteChunk->mStableFrames = 0;
+    }
+
+    // Replay the captured chunk if it's current.
+    if ( pSpriteChunk->mValid )
+    {
+        pBatchRenderer->submitCache( pSpriteChunk->mRenderCache );
+        return;
+    }
+
+    // Capture the chunk once it has settled unless something else is already capturing.
+    const bool capture = pSpriteChunk->mStableFrames >= SPRITE_BATCH_CHUNK_SETTLE_FRAMES && !pBatchRenderer->getCapturing();
+    if ( capture )
+        pBatchRenderer->beginCapture( &pSpriteChunk->mRenderCache );
     else
-        destroySpriteBatchQuery();
+        pSpriteChunk->mStableFrames++;
+
+    // Render the visible sprites.
+    for ( Vector<SpriteBatchItem*>::iterator spriteItr = pSpriteChunk->mSprites.begin(); spriteItr != pSpriteChunk->mSprites.end(); ++spriteItr )
+    {
+        // Fetch sprite batch Item.
+        SpriteBatchItem* pSpriteBatchItem = *spriteItr;
+
+        // Skip if not visible.
+        if ( !pSpriteBatchItem->getVisible() )
+            continue;
+
+        // Batch render.
+        pSpriteBatchItem->render( pBatchRenderer, mBatchTransformId );
+    }
+
+    // Finish the capture.
+    if ( capture )
+    {
+        pBatchRenderer->endCapture();
+        pSpriteChunk->mValid = true;
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::updateBatchDeform( void )
+{
+    // Deform in the local frame of the batch.
+    mBatchDeform.mMode = mBatchDeformMode;
+    mBatchDeform.mOrigin = mBatchTransform.p;
+    mBatchDeform.mUpAxis = mBatchTransform.q.GetYAxis();
+    mBatchDeform.mAmplitude = mBatchDeformAmplitude;
+    mBatchDeform.mFrequency = mDegToRad( mBatchDeformFrequency );
+    mBatchDeform.mPhase = mDegToRad( mFmod( mBatchDeformTime * mBatchDeformSpeed, 360.0f ) );
+    mBatchDeform.mHeight = mBatchDeformHeight;
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::setBatchDeform( const BatchVertexDeform::DeformMode deformMode )
+{
+    // Sanity!
+    if ( deformMode == BatchVertexDeform::DEFORM_INVALID )
+        return;
+
+    // Finish if no change.
+    if ( mBatchDeformMode == deformMode )
+        return;
+
+    mBatchDeformMode = deformMode;
+
+    // The local extents include the deformation.
+    mLocalExtentsDirty = true;
+    onSpritesChanged();
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::setBatchDeformAmplitude( const F32 amplitude )
+{
+    // Finish if no change.
+    if ( mIsEqual( mBatchDeformAmplitude, amplitude ) )
+        return;
+
+    mBatchDeformAmplitude = amplitude;
+
+    // The local extents include the deformation.
+    mLocalExtentsDirty = true;
+    onSpritesChanged();
 }
 
 //------------------------------------------------------------------------------
@@ -481,6 +883,9 @@ void SpriteBatch::setSpriteImage( const char* pAssetId, const U32 imageFrame )
     if ( !checkSpriteSelected() )
         return;
 
+    // Notify the batch of the change.
+    onSpriteChanged( mSelectedSprite );
+
     // Set image and frame.
     mSelectedSprite->setImage( pAssetId, imageFrame );
 }
@@ -499,6 +904,9 @@ void SpriteBatch::setSpriteImage( const char* pAssetId, const char* namedFrame )
     if ( !checkSpriteSelected() )
         return;
 
+    // Notify the batch of the change.
+    onSpriteChanged( mSelectedSprite );
+
     // Set image and frame.
     mSelectedSprite->setImage( pAssetId, namedFrame );
 }
@@ -523,6 +931,9 @@ void SpriteBatch::setSpriteImageFrame( const U32 imageFrame )
     if ( !checkSpriteSelected() )
         return;
 
+    // Notify the batch of the change.
+    onSpriteChanged( mSelectedSprite );
+
     // Set image frame.
     mSelectedSprite->setImageFrame( imageFrame );
 }
@@ -547,6 +958,9 @@ void SpriteBatch::setSpriteNamedImageFrame( const char* namedFrame )
     if ( !checkSpriteSelected() )
         return;
 
+    // Notify the batch of the change.
+    onSpriteChanged( mSelectedSprite );
+
     // Set image frame.
     mSelectedSprite->setNamedImageFrame( namedFrame );
 }
@@ -577,6 +991,9 @@ void SpriteBatch::setSpriteAnimation( const char* pAssetId )
     if ( !checkSpriteSelected() )
         return;
 
+    // Notify the batch of the change.
+    onSpriteChanged( mSelectedSprite );
+
     // Set animation.
     mSelectedSprite->setAnimation( pAssetId );
 }
@@ -601,6 +1018,9 @@ void SpriteBatch::clearSpriteAsset( void )
     if ( !checkSpriteSelected() )
         return;
 
+    // Notify the batch of the change.
+    onSpriteChanged( mSelectedSprite );
+
     // Clear the asset.
     mSelectedSprite->clearAssets();
 }
@@ -613,6 +1033,9 @@ void SpriteBatch::setSpriteVisible( const bool visible )
     if ( !checkSpriteSelected() )
         return;
 
+    // Notify the batch of the change.
+    onSpriteChanged( mSelectedSprite );
+
     // Set visibility.
     mSelectedSprite->setVisible( visible );
 }
@@ -637,6 +1060,9 @@ void SpriteBatch::setSpriteLocalPosition( const Vector2& localPosition )
     if ( !checkSpriteSelected() )
         return;
 
+    // Notify the batch of the change.
+    onSpriteChanged( mSelectedSprite );
+
     // Set local position.
     mSelectedSprite->setLocalPosition( localPosition );
 
@@ -676,6 +1102,9 @@ void SpriteBatch::setSpriteAngle( const F32 localAngle )
     if ( !checkSpriteSelected() )
         return;
 
+    // Notify the batch of the change.
+    onSpriteChanged( mSelectedSprite );
+
     // Set local angle.
     mSelectedSprite->setLocalAngle( localAngle );
 
@@ -703,6 +1132,9 @@ void SpriteBatch::setSpriteDepth( const F32 depth )
     if ( !checkSpriteSelected() )
         return;
 
+    // Notify the batch of the change.
+    onSpriteChanged( mSelectedSprite );
+
     // Set depth.
     mSelectedSprite->setDepth( depth );
 }
@@ -727,6 +1159,9 @@ void SpriteBatch::setSpriteSize( const Vector2& size )
     if ( !checkSpriteSelected() )
         return;
 
+    // Notify the batch of the change.
+    onSpriteChanged( mSelectedSprite );
+
     // Set size.
     mSelectedSprite->setSize( size );
 
@@ -754,6 +1189,9 @@ void SpriteBatch::setSpriteFlipX( const bool flipX )
     if ( !checkSpriteSelected() )
         return;
 
+    // Notify the batch of the change.
+    onSpriteChanged( mSelectedSprite );
+
     // Set flip X.
     mSelectedSprite->setFlipX( flipX );
 }
@@ -778,6 +1216,9 @@ void SpriteBatch::setSpriteFlipY( const bool flipY )
     if ( !checkSpriteSelected() )
         return;
 
+    // Notify the batch of the change.
+    onSpriteChanged( mSelectedSprite );
+
     // Set flip Y.
     mSelectedSprite->setFlipY( flipY );
 }
@@ -802,6 +1243,9 @@ void SpriteBatch::setSpriteSortPoint( const Vector2& sortPoint )
     if ( !checkSpriteSelected() )
         return;
 
+    // Notify the batch of the change.
+    onSpriteChanged( mSelectedSprite );
+
     // Set sort point.
     mSelectedSprite->setSortPoint( sortPoint );
 }
@@ -826,6 +1270,9 @@ void SpriteBatch::setSpriteRenderGroup( const char* pRenderGroup )
     if ( !checkSpriteSelected() )
         return;
 
+    // Notify the batch of the change.
+    onSpriteChanged( mSelectedSprite );
+
     // Set render group.
     mSelectedSprite->setRenderGroup( pRenderGroup );
 }
@@ -850,6 +1297,9 @@ void SpriteBatch::setSpriteBlendMode( const bool blendMode )
     if ( !checkSpriteSelected() )
         return;
 
+    // Notify the batch of the change.
+    onSpriteChanged( mSelectedSprite );
+
     // Set blend mode.
     mSelectedSprite->setBlendMode( blendMode );
 }
@@ -874,6 +1324,9 @@ void SpriteBatch::setSpriteSrcBlendFactor( GLenum srcBlendFactor )
     if ( !checkSpriteSelected() )
         return;
 
+    // Notify the batch of the change.
+    onSpriteChanged( mSelectedSprite );
+
     // Set source blend factor.
     mSelectedSprite->setSrcBlendFactor( srcBlendFactor );
 }
@@ -898,6 +1351,9 @@ void SpriteBatch::setSpriteDstBlendFactor( GLenum dstBlendFactor )
     if ( !checkSpriteSelected() )
         return ;
 
+    // Notify the batch of the change.
+    onSpriteChanged( mSelectedSprite );
+
     // Set destination blend factor.
     mSelectedSprite->setDstBlendFactor( dstBlendFactor );
 }
@@ -922,6 +1378,9 @@ void SpriteBatch::setSpriteBlendColor( const ColorF& blendColor )
     if ( !checkSpriteSelected() )
         return;
 
+    // Notify the batch of the change.
+    onSpriteChanged( mSelectedSprite );
+
     // Set blend color.
     mSelectedSprite->setBlendColor( blendColor );
 }
@@ -946,6 +1405,9 @@ void SpriteBatch::setSpriteBlendAlpha( const F32 alpha )
     if ( !checkSpriteSelected() )
         return;
 
+    // Notify the batch of the change.
+    onSpriteChanged( mSelectedSprite );
+
     // Set blend alpha.
     mSelectedSprite->setBlendAlpha( alpha );
 }
@@ -970,6 +1432,9 @@ void SpriteBatch::setSpriteAlphaTest( const F32 alphaTestMode )
     if ( !checkSpriteSelected() )
         return;
 
+    // Notify the batch of the change.
+    onSpriteChanged( mSelectedSprite );
+
     // Set alpha-test mode.
     mSelectedSprite->setAlphaTest( alphaTestMode );
 }
@@ -1271,6 +1736,10 @@ void SpriteBatch::updateLocalExtents( void )
 
     // Calculate local extents.
     mLocalExtents.Set( mFabs(lowerExtentX > upperExtentX ? lowerExtentX : upperExtentX) * 2.0f, mFabs(lowerExtentY > upperExtentY ? lowerExtentY : upperExtentY) * 2.0f );
+
+    // Include the furthest the deformation can displace a vertex.
+    if ( getBatchDeformed() )
+        mLocalExtents += Vector2( mFabs(mBatchDeformAmplitude) * 2.0f, mFabs(mBatchDeformAmplitude) * 2.0f );
 }
 
 //------------------------------------------------------------------------------
@@ -1280,8 +1749,8 @@ void SpriteBatch::createSpriteBatchQuery( void )
     // Debug Profiling.
     PROFILE_SCOPE(SpriteBatch_CreateSpriteBatchQuery);
 
-    // Finish if batch culling is off or there is already a sprite batch query.
-    if ( !mBatchCulling || mpSpriteBatchQuery != NULL )
+    // Finish if query culling is off or there is already a sprite batch query.
+    if ( !getQueryCulling() || mpSpriteBatchQuery != NULL )
         return;
 
     // Set the sprite batch query appropriately.
@@ -1331,6 +1800,162 @@ void SpriteBatch::destroySpriteBatchQuery( void )
 
 //------------------------------------------------------------------------------
 
+void SpriteBatch::refreshSpriteBatchQuery( void )
+{
+    // Create/destroy sprite batch query appropriately.
+    if ( getQueryCulling() )
+        createSpriteBatchQuery();
+    else
+        destroySpriteBatchQuery();
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::updateSpriteGrid( void )
+{
+    // Finish if the sprite grid is up-to-date.
+    if ( !mSpriteGridDirty )
+        return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatch_UpdateSpriteGrid);
+
+    // Reset the sprite grid.
+    mSpriteGrid.clear();
+    mSpriteGridOverflow.clear();
+    mSpriteGridMargin.SetZero();
+
+    // Index the sprites by their grid cell.
+    for( typeSpriteBatchHash::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
+    {
+        // Fetch sprite batch Item.
+        SpriteBatchItem* pSpriteBatchItem = spriteItr->value;
+
+        // Fetch the grid cell.
+        S32 cellX;
+        S32 cellY;
+        Vector2 layoutPosition;
+        if ( !getLogicalGridCell( pSpriteBatchItem->getLogicalPosition(), cellX, cellY, layoutPosition ) )
+        {
+            // Not on the grid so it's always tested.
+            mSpriteGridOverflow.push_back( pSpriteBatchItem );
+            continue;
+        }
+
+        // Insert into the grid cell unless it's already occupied.
+        const U32 cellKey = getSpriteGridKey( cellX, cellY );
+        if ( mSpriteGrid.find( cellKey ) != mSpriteGrid.end() )
+        {
+            mSpriteGridOverflow.push_back( pSpriteBatchItem );
+            continue;
+        }
+        mSpriteGrid.insert( cellKey, pSpriteBatchItem );
+
+        // Expand the margin to cover how far the sprite extends from its layout position.
+        const b2AABB& localAABB = pSpriteBatchItem->getLocalAABB();
+        mSpriteGridMargin.x = b2Max( mSpriteGridMargin.x, b2Max( layoutPosition.x - localAABB.lowerBound.x, localAABB.upperBound.x - layoutPosition.x ) );
+        mSpriteGridMargin.y = b2Max( mSpriteGridMargin.y, b2Max( layoutPosition.y - localAABB.lowerBound.y, localAABB.upperBound.y - layoutPosition.y ) );
+    }
+
+    // Flag the sprite grid as NOT dirty.
+    mSpriteGridDirty = false;
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::prepareGridRender( SceneRenderObject* pSceneRenderObject, const b2AABB& localAABB, SceneRenderQueue* pSceneRenderQueue )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatch_PrepareGridRender);
+
+    // Update the sprite grid.
+    updateSpriteGrid();
+
+    // Expand the area by the furthest any sprite extends from its layout position.
+    b2AABB gridAABB = localAABB;
+    gridAABB.lowerBound -= mSpriteGridMargin;
+    gridAABB.upperBound += mSpriteGridMargin;
+
+    // Fetch the visible grid cell range.
+    S32 minCellX, minCellY, maxCellX, maxCellY;
+    const bool validRange = getLogicalGridRange( gridAABB, minCellX, minCellY, maxCellX, maxCellY );
+
+    // Is the cell range smaller than the number of sprites?
+    if ( validRange && (U64)(maxCellX - minCellX + 1) * (U64)(maxCellY - minCellY + 1) <= (U64)mSpriteGrid.size() )
+    {
+        // Yes, so look-up each visible grid cell.
+        for ( S32 cellY = minCellY; cellY <= maxCellY; ++cellY )
+        {
+            for ( S32 cellX = minCellX; cellX <= maxCellX; ++cellX )
+            {
+                // Fetch the sprite in the grid cell.
+                typeSpriteGridHash::iterator cellItr = mSpriteGrid.find( getSpriteGridKey( cellX, cellY ) );
+                if ( cellItr == mSpriteGrid.end() )
+                    continue;
+
+                // Fetch sprite batch Item.
+                SpriteBatchItem* pSpriteBatchItem = cellItr->value;
+
+                // Skip if not visible or not in view.
+                if ( !pSpriteBatchItem->getVisible() || !b2TestOverlap( pSpriteBatchItem->getLocalAABB(), localAABB ) )
+                    continue;
+
+                // Create a render request.
+                createSpriteRenderRequest( pSceneRenderObject, pSpriteBatchItem, pSceneRenderQueue );
+            }
+        }
+    }
+    else
+    {
+        // No, so simply test each grid sprite.
+        for( typeSpriteGridHash::iterator cellItr = mSpriteGrid.begin(); cellItr != mSpriteGrid.end(); ++cellItr )
+        {
+            // Fetch sprite batch Item.
+            SpriteBatchItem* pSpriteBatchItem = cellItr->value;
+
+            // Skip if not visible or not in view.
+            if ( !pSpriteBatchItem->getVisible() || !b2TestOverlap( pSpriteBatchItem->getLocalAABB(), localAABB ) )
+                continue;
+
+            // Create a render request.
+            createSpriteRenderRequest( pSceneRenderObject, pSpriteBatchItem, pSceneRenderQueue );
+        }
+    }
+
+    // Test the sprites that are not on the grid.
+    for ( Vector<SpriteBatchItem*>::iterator spriteItr = mSpriteGridOverflow.begin(); spriteItr != mSpriteGridOverflow.end(); ++spriteItr )
+    {
+        // Fetch sprite batch Item.
+        SpriteBatchItem* pSpriteBatchItem = *spriteItr;
+
+        // Skip if not visible or not in view.
+        if ( !pSpriteBatchItem->getVisible() || !b2TestOverlap( pSpriteBatchItem->getLocalAABB(), localAABB ) )
+            continue;
+
+        // Create a render request.
+        createSpriteRenderRequest( pSceneRenderObject, pSpriteBatchItem, pSceneRenderQueue );
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::createSpriteRenderRequest( SceneRenderObject* pSceneRenderObject, SpriteBatchItem* pSpriteBatchItem, SceneRenderQueue* pSceneRenderQueue )
+{
+    // Create a render request.
+    SceneRenderRequest* pSceneRenderRequest = pSceneRenderQueue->createRenderRequest();
+
+    // Prepare batch item.
+    pSpriteBatchItem->prepareRender( pSceneRenderRequest, mBatchTransformId );
+
+    // Set identity.
+    pSceneRenderRequest->mpSceneRenderObject = pSceneRenderObject;
+
+    // Set custom data.
+    pSceneRenderRequest->mpCustomData1 = pSpriteBatchItem;
+}
+
+//------------------------------------------------------------------------------
+
 bool SpriteBatch::destroySprite( const U32 batchId )
 {
     // Debug Profiling.
@@ -1387,6 +2012,14 @@ b2AABB SpriteBatch::calculateLocalAABB( const b2AABB& renderAABB )
     // Calculate local AABB.
     b2AABB localAABB;
     CoreMath::mOOBBtoAABB( localOOBB, localAABB );
+
+    // Widen by the furthest the deformation can displace a vertex so deformed sprites are not culled.
+    if ( getBatchDeformed() )
+    {
+        const F32 deformMargin = mFabs( mBatchDeformAmplitude );
+        localAABB.lowerBound -= b2Vec2( deformMargin, deformMargin );
+        localAABB.upperBound += b2Vec2( deformMargin, deformMargin );
+    }
     
     return localAABB;
 }
@@ -37,15 +37,41 @@ class SpriteBatchQuery;
 
 //------------------------------------------------------------------------------  
 
+/// Number of consecutive unchanged frames before a sprite chunk is captured.
+#define SPRITE_BATCH_CHUNK_SETTLE_FRAMES    2
+
+//------------------------------------------------------------------------------  
+
 class SpriteBatch
 {
 public:
     static const S32                INVALID_SPRITE_PROXY = -1;  
+    static const S32                INVALID_SPRITE_CHUNK = -1;
+
+    /// Render request custom key identifying a sprite chunk rather than a sprite.
+    static const S32                SPRITE_CHUNK_REQUEST = 1;
 
 protected:
+    /// A grid cell of sprites that is rendered (and cached) as a single unit.
+    struct SpriteChunk
+    {
+        SpriteChunk() : mTransformId( 0 ), mStableFrames( 0 ), mValid( false )
+        {
+            VECTOR_SET_ASSOCIATION( mSprites );
+        }
+
+        Vector<SpriteBatchItem*>    mSprites;
+        b2AABB                      mLocalAABB;
+        BatchRenderCache            mRenderCache;
+        U32                         mTransformId;
+        U32                         mStableFrames;
+        bool                        mValid;
+    };
+
     typedef HashMap< U32, SpriteBatchItem* > typeSpriteBatchHash;
     typedef HashMap< SpriteBatchItem::LogicalPosition, SpriteBatchItem* > typeSpritePositionHash;
     typedef HashMap< StringTableEntry, SpriteBatchItem* > typeSpriteNameHash;
+    typedef HashMap< U32, SpriteBatchItem* > typeSpriteGridHash;
 
     typeSpriteBatchHash             mSprites;
     typeSpritePositionHash          mSpritePositions;
@@ -53,9 +79,16 @@ protected:
     SpriteBatchItem*                mSelectedSprite;
     SceneRenderQueue::RenderSort    mBatchSortMode;
     bool                            mBatchCulling;
+    bool                            mBatchGridCulling;
+    F32                             mBatchChunkSize;
     Vector2                         mDefaultSpriteStride;
     Vector2                         mDefaultSpriteSize;
     F32                             mDefaultSpriteAngle;
+    BatchVertexDeform::DeformMode   mBatchDeformMode;
+    F32                             mBatchDeformAmplitude;
+    F32                             mBatchDeformFrequency;
+    F32                             mBatchDeformSpeed;
+    F32                             mBatchDeformHeight;
 
 private:
     SpriteBatchQuery*               mpSpriteBatchQuery;
@@ -68,6 +101,19 @@ private:
     Vector2                         mLocalExtents;
     bool                            mLocalExtentsDirty;
 
+    Vector<SpriteChunk*>            mSpriteChunks;
+    bool                            mSpriteChunksDirty;
+    Vector<b2AABB>                  mSpriteChunkCullAABBs;
+    Vector<U8>                      mSpriteChunkCullResults;
+
+    typeSpriteGridHash              mSpriteGrid;
+    Vector<SpriteBatchItem*>        mSpriteGridOverflow;
+    b2Vec2                          mSpriteGridMargin;
+    bool                            mSpriteGridDirty;
+
+    F32                             mBatchDeformTime;
+    BatchVertexDeform               mBatchDeform;
+
 public:
     SpriteBatch();
     virtual ~SpriteBatch();
@@ -83,7 +129,7 @@ public:
     inline U32 getBatchTransformId( void ) { return mBatchTransformId; }
     const b2Transform& getBatchTransform( void ) const { return mBatchTransform; }
 
-    inline void setLocalExtentsDirty( void ) { mLocalExtentsDirty = true; }
+    inline void setLocalExtentsDirty( void ) { mLocalExtentsDirty = true; mSpriteChunksDirty = true; mSpriteGridDirty = true; }
     inline bool getLocalExtentsDirty( void ) const { return mLocalExtentsDirty; }
     inline const Vector2& getLocalExtents( void ) { if ( getLocalExtentsDirty() ) updateLocalExtents(); return mLocalExtents; }
 
@@ -100,12 +146,57 @@ public:
     bool removeSprite( void );
     virtual void clearSprites( void );
 
-    inline void setBatchSortMode( SceneRenderQueue::RenderSort sortMode ) { mBatchSortMode = sortMode; }
+    /// Called whenever the sprites or how they render change.
+    virtual void onSpritesChanged( void ) {}
+
+    /// Called whenever how a specific sprite renders changes.
+    inline void onSpriteChanged( SpriteBatchItem* pSpriteBatchItem ) { invalidateSpriteChunk( pSpriteBatchItem ); onSpritesChanged(); }
+
+    /// Sets the size of the local grid cells sprites are grouped into and cached by (zero turns chunking off).
+    void setBatchChunkSize( const F32 chunkSize );
+    inline F32 getBatchChunkSize( void ) const { return mBatchChunkSize; }
+    inline U32 getBatchChunkCount( void ) const { return (U32)mSpriteChunks.size(); }
+
+    inline void setBatchSortMode( SceneRenderQueue::RenderSort sortMode ) { mBatchSortMode = sortMode; onSpritesChanged(); }
     inline SceneRenderQueue::RenderSort getBatchSortMode( void ) const { return mBatchSortMode; }
 
     void setBatchCulling( const bool batchCulling );
     inline bool getBatchCulling( void ) const { return mBatchCulling; }
 
+    /// Sets whether culling uses the logical grid of the layout rather than a per-sprite query tree.
+    void setBatchGridCulling( const bool gridCulling );
+    inline bool getBatchGridCulling( void ) const { return mBatchGridCulling; }
+
+    /// Sets how the vertices of the whole batch are deformed as they are rendered (for waves, wind sway and bending).
+    /// The deformation is applied in the local frame of the batch with sway and bend anchored at the local origin.
+    void setBatchDeform( const BatchVertexDeform::DeformMode deformMode );
+    inline BatchVertexDeform::DeformMode getBatchDeform( void ) const { return mBatchDeformMode; }
+    inline bool getBatchDeformed( void ) const { return mBatchDeformMode != BatchVertexDeform::DEFORM_NONE; }
+
+    /// Sets the maximum displacement of the deformation.
+    void setBatchDeformAmplitude( const F32 amplitude );
+    inline F32 getBatchDeformAmplitude( void ) const { return mBatchDeformAmplitude; }
+
+    /// Sets the degrees the deformation phase changes per local unit across the batch.
+    inline void setBatchDeformFrequency( const F32 frequency ) { mBatchDeformFrequency = frequency; }
+    inline F32 getBatchDeformFrequency( void ) const { return mBatchDeformFrequency; }
+
+    /// Sets the degrees the deformation phase changes per second.
+    inline void setBatchDeformSpeed( const F32 speed ) { mBatchDeformSpeed = speed; }
+    inline F32 getBatchDeformSpeed( void ) const { return mBatchDeformSpeed; }
+
+    /// Sets the local height at which sway and bend reach the full amplitude.
+    inline void setBatchDeformHeight( const F32 height ) { mBatchDeformHeight = getMax( height, 0.001f ); }
+    inline F32 getBatchDeformHeight( void ) const { return mBatchDeformHeight; }
+
+    /// Sets the time the deformation is animated at.
+    inline void setBatchDeformTime( const F32 time ) { mBatchDeformTime = time; }
+    inline F32 getBatchDeformTime( void ) const { return mBatchDeformTime; }
+
+    static BatchVertexDeform::DeformMode getBatchDeformEnum( const char* label );
+    static const char* getBatchDeformDescription( const BatchVertexDeform::DeformMode deformMode );
+    static EnumTable batchDeformTable;
+
     inline void setDefaultSpriteStride( const Vector2& defaultStride ) { mDefaultSpriteStride = defaultStride; }
     inline const Vector2& getDefaultSpriteStride( void ) const { return mDefaultSpriteStride; }
 
@@ -201,6 +292,30 @@ protected:
 
     void createSpriteBatchQuery( void );
     void destroySpriteBatchQuery( void );
+    void refreshSpriteBatchQuery( void );
+
+    /// Grid culling is available when the layout places sprites on an integer logical grid.
+    virtual bool canGridCull( void ) const { return false; }
+
+    /// Fetch the integer grid cell and layout position of a logical position, returning false if it is not on the grid.
+    virtual bool getLogicalGridCell( const SpriteBatchItem::LogicalPosition& logicalPosition, S32& cellX, S32& cellY, Vector2& layoutPosition ) const { return false; }
+
+    /// Fetch the range of grid cells whose layout positions may lie within the local area, returning false if it cannot be calculated.
+    virtual bool getLogicalGridRange( const b2AABB& localAABB, S32& minCellX, S32& minCellY, S32& maxCellX, S32& maxCellY ) const { return false; }
+
+    inline bool getGridCulling( void ) const { return mBatchGridCulling && canGridCull(); }
+    inline bool getQueryCulling( void ) const { return mBatchCulling && !getGridCulling(); }
+    inline static U32 getSpriteGridKey( const S32 cellX, const S32 cellY ) { return ((U32)(cellX & 0xFFFF) << 16) | (U32)(cellY & 0xFFFF); }
+    void updateSpriteGrid( void );
+    void prepareGridRender( SceneRenderObject* pSceneRenderObject, const b2AABB& localAABB, SceneRenderQueue* pSceneRenderQueue );
+    void createSpriteRenderRequest( SceneRenderObject* pSceneRenderObject, SpriteBatchItem* pSpriteBatchItem, SceneRenderQueue* pSceneRenderQueue );
+
+    inline bool getChunkedRender( void ) const { return mBatchChunkSize > 0.0f && mBatchSortMode == SceneRenderQueue::RENDER_SORT_OFF; }
+    void updateSpriteChunks( void );
+    void destroySpriteChunks( void );
+    void invalidateSpriteChunk( SpriteBatchItem* pSpriteBatchItem );
+    void renderSpriteChunk( SpriteChunk* pSpriteChunk, BatchRender* pBatchRenderer );
+    void updateBatchDeform( void );
 
     void onTamlCustomWrite( TamlCustomNodes& customNodes  );
     void onTamlCustomRead( const TamlCustomNodes& customNodes );
@@ -36,6 +36,8 @@
 
 StringTableEntry spritesItemTypeName                = StringTable->insert( "Sprite" );
 
+FactoryCache<SpriteBatchItem> SpriteBatchItemFactory( "SpriteBatchItem" );
+
 static StringTableEntry spriteNameName              = StringTable->insert("Name");
 static StringTableEntry spriteLogicalPositionName   = StringTable->insert("LogicalPosition");
 static StringTableEntry spriteVisibleName           = StringTable->insert("Visible");
@@ -94,6 +96,7 @@ void SpriteBatchItem::resetState( void )
     mBatchId = 0;
     mName = StringTable->EmptyString;
     mLogicalPosition.resetState();
+    mChunkIndex = SpriteBatch::INVALID_SPRITE_CHUNK;
 
     mVisible = true;
     mExplicitMode = false;
@@ -156,6 +159,24 @@ void SpriteBatchItem::setBatchParent( SpriteBatch* pSpriteBatch, const U32 batch
 
 //------------------------------------------------------------------------------
 
+void SpriteBatchItem::processTick( void )
+{
+    // Fetch whether the animation is running.
+    const bool animating = !isStaticFrameProvider() && !isAnimationPaused() && !isAnimationFinished();
+
+    // Fetch the current animation frame.
+    const S32 animationFrame = getAnimationFrame();
+
+    // Call parent.
+    Parent::processTick();
+
+    // Notify the batch if the animation frame changed.
+    if ( animating && mSpriteBatch != NULL && getAnimationFrame() != animationFrame )
+        mSpriteBatch->onSpriteChanged( this );
+}
+
+//------------------------------------------------------------------------------
+
 void SpriteBatchItem::copyTo( SpriteBatchItem* pSpriteBatchItem ) const
 {
     // Call parent.
@@ -232,6 +253,34 @@ void SpriteBatchItem::render( BatchRender* pBatchRenderer, const SceneRenderRequ
 
 //------------------------------------------------------------------------------
 
+void SpriteBatchItem::render( BatchRender* pBatchRenderer, const U32 batchTransformId )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatchItem_RenderChunked);
+
+    // Update the world transform.
+    updateWorldTransform( batchTransformId );
+
+    // Set the blend mode.
+    if ( mBlendMode )
+        pBatchRenderer->setBlendMode( mSrcBlendFactor, mDstBlendFactor, mBlendColor );
+    else
+        pBatchRenderer->setBlendOff();
+
+    // Set the alpha test mode.
+    pBatchRenderer->setAlphaTestMode( mAlphaTest );
+
+    // Render.
+    Parent::render( mFlipX, mFlipY,
+                    mRenderOOBB[0],
+                    mRenderOOBB[1],
+                    mRenderOOBB[2],
+                    mRenderOOBB[3],
+                    pBatchRenderer );
+}
+
+//------------------------------------------------------------------------------
+
 void SpriteBatchItem::setExplicitVertices( const Vector2* explicitVertices )
 {
     mExplicitMode = true;
@@ -27,6 +27,10 @@
 #include "2d/core/ImageFrameProvider.h"
 #endif
 
+#ifndef _SIM_OBJECT_HANDLE_H_
+#include "sim/simObjectHandle.h"
+#endif
+
 //------------------------------------------------------------------------------  
 
 class SpriteBatch;
@@ -214,7 +218,7 @@ protected:
     ColorF              mBlendColor;
     F32                 mAlphaTest;
 
-    SimObjectPtr<SimObject> mDataObject;
+    SimObjectHandle<SimObject> mDataObject;
 
     Vector2             mLocalOOBB[4];
     b2AABB              mLocalAABB;
@@ -226,6 +230,7 @@ protected:
     U32                 mLastBatchTransformId;
 
     U32                 mSpriteBatchQueryKey;
+    S32                 mChunkIndex;
 
     void*               mUserData;
 
@@ -235,6 +240,8 @@ public:
 
     virtual void resetState( void );
 
+    virtual void processTick( void );
+
     inline SpriteBatch* getBatchParent( void ) const { return mSpriteBatch; }
     inline U32 getBatchId( void ) const { return mBatchId; }
     inline S32 getProxyId( void ) const { return mProxyId; }
@@ -300,6 +307,8 @@ public:
     inline void setSpriteBatchQueryKey( const U32 key ) { mSpriteBatchQueryKey = key; }
     inline U32  getSpriteBatchQueryKey( void ) const { return mSpriteBatchQueryKey; }
 
+    inline S32 getChunkIndex( void ) const { return mChunkIndex; }
+
     virtual void copyTo( SpriteBatchItem* pSpriteBatchItem ) const;
 
     inline const Vector2* getLocalOOBB( void ) const { return mLocalOOBB; }
@@ -307,12 +316,14 @@ public:
 
     void prepareRender( SceneRenderRequest* pSceneRenderRequest, const U32 batchTransformId );
     void render( BatchRender* pBatchRenderer, const SceneRenderRequest* pSceneRenderRequest, const U32 batchTransformId );
+    void render( BatchRender* pBatchRenderer, const U32 batchTransformId );
 
     static void WriteCustomTamlSchema( const AbstractClassRep* pClassRep, TiXmlElement* pParentElement );
 
 protected:
     void setBatchParent( SpriteBatch* pSpriteBatch, const U32 batchId );
     inline void setProxyId( const S32 proxyId ) { mProxyId = proxyId; }
+    inline void setChunkIndex( const S32 chunkIndex ) { mChunkIndex = chunkIndex; }
     inline void setName( const char* pName ) { mName = StringTable->insert( pName ); }
     void updateLocalTransform( void );
     void updateWorldTransform( const U32 batchTransformId );
@@ -323,6 +334,6 @@ protected:
 
 //------------------------------------------------------------------------------  
 
-static FactoryCache<SpriteBatchItem> SpriteBatchItemFactory;
+extern FactoryCache<SpriteBatchItem> SpriteBatchItemFactory;
 
 #endif // _SPRITE_BATCH_ITEM_H_
@@ -38,15 +38,19 @@ WaveComposite::WaveComposite() :
     mPostTickTime( 0.0f ),
     mImageFrame( 0 ),
     mSpriteCount( 50 ),
-    mSpriteSize( 1.0f, 1.0f ),
-    mAmplitude( 30.0f ),
-    mFrequency( 10.0f )
+    mSpriteSize( 1.0f, 1.0f )
 {
     // Disable batch culling.
     // NOTE:    This stops the batch-query dynamic-tree from being generated.
     //          For smaller scale composites, this is more efficient and saves memory.
     //          Do not turn this off for larger scale composites like tile-maps.
     SpriteBatch::setBatchCulling( false );
+
+    // The wave is a deformation of the batch so the sprites themselves never move.
+    mBatchDeformMode = BatchVertexDeform::DEFORM_WAVE;
+    mBatchDeformAmplitude = 30.0f;
+    mBatchDeformFrequency = 10.0f;
+    mBatchDeformSpeed = 100.0f;
 }
 
 //------------------------------------------------------------------------------
@@ -66,8 +70,8 @@ void WaveComposite::initPersistFields()
     addProtectedField( "Frame", TypeS32, Offset(mImageFrame, WaveComposite), &setImageFrame, &defaultProtectedGetFn, &writeImageFrame, "The image frame used for the image." );
     addProtectedField( "SpriteCount", TypeS32, Offset(mSpriteCount, WaveComposite), &setSpriteCount, &defaultProtectedGetFn, &defaultProtectedWriteFn, "The number of sprites to generate" );
     addProtectedField( "SpriteSize", TypeVector2, Offset(mSpriteSize, WaveComposite),&setSpriteSize, &defaultProtectedGetFn, &defaultProtectedWriteFn, "The size of each sprite." );
-    addField( "Amplitude", TypeF32, Offset(mAmplitude, WaveComposite), "The amplitude of the sprite movement." );
-    addField( "Frequency", TypeF32, Offset(mFrequency, WaveComposite), "The frequency of the sprite movement." );
+    addProtectedField( "Amplitude", TypeF32, Offset(mBatchDeformAmplitude, WaveComposite), &setAmplitude, &defaultProtectedGetFn, &defaultProtectedWriteFn, "The amplitude of the sprite movement." );
+    addField( "Frequency", TypeF32, Offset(mBatchDeformFrequency, WaveComposite), "The frequency of the sprite movement." );
 }
 
 //-----------------------------------------------------------------------------
@@ -78,8 +82,8 @@ void WaveComposite::preIntegrate( const F32 totalTime, const F32 elapsedTime, De
     mPreTickTime = mPostTickTime;
     mPostTickTime = totalTime;
 
-    // Update composition at pre-tick time.
-    updateComposition( mPreTickTime );
+    // Update the wave at pre-tick time.
+    setBatchDeformTime( mPreTickTime );
 
     // Are the spatials dirty?
     if ( getSpatialDirty() )
@@ -120,8 +124,8 @@ void WaveComposite::interpolateObject( const F32 timeDelta )
     // Call parent.
     Parent::interpolateObject( timeDelta );
 
-    // Update composition time (interpolated).
-    updateComposition( (timeDelta * mPreTickTime) + ((1.0f-timeDelta) * mPostTickTime) );
+    // Update the wave time (interpolated).
+    setBatchDeformTime( (timeDelta * mPreTickTime) + ((1.0f-timeDelta) * mPostTickTime) );
 
     // Finish if the spatials are NOT dirty.
     if ( !getSpatialDirty() )
@@ -150,6 +154,7 @@ void WaveComposite::copyTo(SimObject* object)
     pComposite->setSpriteCount( getSpriteCount() );
     pComposite->setSpriteSize( getSpriteSize() );
     pComposite->setAmplitude( getAmplitude() );
+    pComposite->setFrequency( getFrequency() );
 }
 
 //-----------------------------------------------------------------------------
@@ -257,7 +262,6 @@ void WaveComposite::generateComposition( void )
 {
     // Clear all existing sprites.
     clearSprites();
-    mWaveSprites.clear();
 
     // Finish if image asset isn't available.
     if ( mImageAsset.isNull() )
@@ -266,6 +270,9 @@ void WaveComposite::generateComposition( void )
     // Fetch asset Id.
     StringTableEntry assetId = mImageAsset.getAssetId();
 
+    // Calculate sprite start position.
+    Vector2 spritePosition( mSpriteSize.x * mSpriteCount * -0.5f, 0.0f );
+
     // Generate sprites.
     for( U32 n = 0; n < mSpriteCount; ++n )
     {
@@ -276,32 +283,6 @@ void WaveComposite::generateComposition( void )
         pSprite->setImage( assetId );
         pSprite->setImageFrame( mImageFrame );
         pSprite->setSize( mSpriteSize );
-
-        // Store sprite reference.
-        mWaveSprites.push_back( pSprite );
-    }
-}
-
-//-----------------------------------------------------------------------------
-
-void WaveComposite::updateComposition( const F32 time )
-{
-    // Scale time.
-    const F32 scaledTime = time * 100.0f;
-
-    // Calculate sprite start positin.
-    Vector2 spritePosition( mSpriteSize.x * mSpriteCount * -0.5f, 0.0f );
-
-    // Update sprite positions.
-    for( typeWaveSpritesVector::iterator spriteItr = mWaveSprites.begin(); spriteItr < mWaveSprites.end(); ++spriteItr )
-    {
-        // Fetch sprite,
-        SpriteBatchItem* pSprite = *spriteItr;
-
-        // Set y position.
-        spritePosition.y = mSin(mDegToRad(scaledTime + (spritePosition.x * mFrequency))) * mAmplitude;
-
-        // Set sprite position.
         pSprite->setLocalPosition( spritePosition );
 
         // Update the position.
@@ -39,11 +39,7 @@ private:
     U32                         mImageFrame;
     U32                         mSpriteCount;
     Vector2                     mSpriteSize;
-    F32                         mAmplitude;
-    F32                         mFrequency;
 
-    typedef Vector<SpriteBatchItem*> typeWaveSpritesVector;
-    typeWaveSpritesVector       mWaveSprites;
     F32                         mPreTickTime;
     F32                         mPostTickTime;
 
@@ -56,12 +52,15 @@ public:
     virtual void preIntegrate( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
     virtual void integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
     virtual void interpolateObject( const F32 timeDelta );
+    virtual bool canPreIntegrateInParallel( void ) const { return false; }
+    virtual bool isTickDormant( void ) const { return false; }
 
     virtual void copyTo( SimObject* object );
 
     virtual bool canPrepareRender( void ) const { return true; }
     virtual bool validRender( void ) const { return mImageAsset.notNull(); }
     virtual bool shouldRender( void ) const { return true; }
+    virtual bool canCacheRender( void ) const { return false; }
     virtual void scenePrepareRender( const SceneRenderState* pSceneRenderState, SceneRenderQueue* pSceneRenderQueue );    
     virtual void sceneRender( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer );
 
@@ -73,17 +72,16 @@ public:
     inline U32 getSpriteCount( void ) const { return mSpriteCount; }
     void setSpriteSize( const Vector2& spriteSize );
     inline const Vector2& getSpriteSize( void ) const { return mSpriteSize; };
-    inline void setAmplitude( const F32 amplitude ) { mAmplitude = amplitude; }
-    inline F32 getAmplitude( void ) const { return mAmplitude; }
-    inline void setFrequency( const F32 frequency ) { mFrequency = frequency; }
-    inline F32 getFrequency( void ) const { return mFrequency; }
+    inline void setAmplitude( const F32 amplitude ) { setBatchDeformAmplitude( amplitude ); }
+    inline F32 getAmplitude( void ) const { return getBatchDeformAmplitude(); }
+    inline void setFrequency( const F32 frequency ) { setBatchDeformFrequency( frequency ); }
+    inline F32 getFrequency( void ) const { return getBatchDeformFrequency(); }
 
     /// Declare Console Object.
     DECLARE_CONOBJECT( WaveComposite );
 
 protected:
     void generateComposition( void );
-    void updateComposition( const F32 time );
 
 protected:
     static bool setImage(void* obj, const char* data) { static_cast<WaveComposite*>(obj)->setImage( data ); return false; }
@@ -93,6 +91,7 @@ protected:
     static bool writeImageFrame( void* obj, StringTableEntry pFieldName ) { return static_cast<WaveComposite*>(obj)->getImageFrame() > 0; }
     static bool setSpriteCount(void* obj, const char* data) { static_cast<WaveComposite*>(obj)->setSpriteCount( dAtoi(data) ); return false; }
     static bool setSpriteSize(void* obj, const char* data) { static_cast<WaveComposite*>(obj)->setSpriteSize( Vector2(data) ); return false; }
+    static bool setAmplitude(void* obj, const char* data) { static_cast<WaveComposite*>(obj)->setAmplitude( dAtof(data) ); return false; }
 };
 
 #endif // _WAVE_COMPOSITE_H_
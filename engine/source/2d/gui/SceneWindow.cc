@@ -40,6 +40,14 @@
 // Debug Profiling.
 #include "debug/profiler.h"
 
+#ifndef _GAMEINTERFACE_H_
+#include "game/gameInterface.h"
+#endif
+
+#ifndef _GPU_TIMER_H_
+#include "debug/gpuTimer.h"
+#endif
+
 // Input event names.
 static StringTableEntry inputEventEnterName            = StringTable->insert("onTouchEnter");
 static StringTableEntry inputEventLeaveName            = StringTable->insert("onTouchLeave");
@@ -100,6 +108,16 @@ SceneWindow::SceneWindow() :    mpScene(NULL),
                                 mRenderGroupMask(MASK_ALL),
                                 mBackgroundColor( "Black" ),
                                 mUseBackgroundColor(false),   
+                                mDynamicResolution(false),
+                                mDynamicResolutionMinScale(0.5f),
+                                mResolutionScale(1.0f),
+                                mSmoothedFrameTime(0.0f),
+                                mResolutionTexture(0),
+                                mResolutionTextureSize(0, 0),
+                                mRenderPeriod(0),
+                                mRenderScale(1.0f),
+                                mScaledRenderTime(0),
+                                mTextureCallbackKey(0),
                                 mCameraInterpolationMode(SIGMOID),
                                 mMaxQueueItems(64),
                                 mCameraTransitionTime(2.0f),
@@ -113,7 +131,10 @@ SceneWindow::SceneWindow() :    mpScene(NULL),
                                 mUseObjectInputEvents(false),
                                 mInputEventGroupMaskFilter(MASK_ALL),
                                 mInputEventLayerMaskFilter(MASK_ALL),
-                                mInputEventInvisibleFilter( true )
+                                mInputEventInvisibleFilter( true ),
+                                mInputEventPickPoint( 0.0f, 0.0f ),
+                                mInputEventPickTime( 0.0f ),
+                                mInputEventPickValid( false )
 {
     // Set Vector Associations.
     VECTOR_SET_ASSOCIATION( mCameraQueue );
@@ -141,6 +162,7 @@ bool SceneWindow::onAdd()
 
     // Register input sets.
     mInputEventWatching.registerObject();
+    mInputEventPick.registerObject();
     mInputListeners.registerObject();
 
     // Reset the camera position.
@@ -154,6 +176,9 @@ bool SceneWindow::onAdd()
 
     // Zero Camera Time.
     zeroCameraTime();
+
+    // Register for texture events so the resolution texture can be recreated.
+    mTextureCallbackKey = TextureManager::registerEventCallback( textureEventCallback, this );
    
     // Return Okay.
     return true;
@@ -168,8 +193,17 @@ void SceneWindow::onRemove()
 
     // Unregister input sets.
     mInputEventWatching.unregisterObject();
+    mInputEventPick.unregisterObject();
     mInputListeners.unregisterObject();
 
+    // Release the resolution texture.
+    TextureManager::unregisterEventCallback( mTextureCallbackKey );
+    if ( mResolutionTexture != 0 )
+    {
+        dglDeleteTextures( 1, (const GLuint*)&mResolutionTexture );
+        mResolutionTexture = 0;
+    }
+
     // Call Parent.
     Parent::onRemove();
 }
@@ -189,6 +223,14 @@ void SceneWindow::initPersistFields()
     // Background color.
     addField("UseBackgroundColor", TypeBool, Offset(mUseBackgroundColor, SceneWindow), &writeUseBackgroundColor, "" );
     addField("BackgroundColor", TypeColorF, Offset(mBackgroundColor, SceneWindow), &writeBackgroundColor, "" );
+
+    // Dynamic resolution.
+    addField("DynamicResolution", TypeBool, Offset(mDynamicResolution, SceneWindow), &writeDynamicResolution, "" );
+    addProtectedField("DynamicResolutionMinScale", TypeF32, Offset(mDynamicResolutionMinScale, SceneWindow), &setDynamicResolutionMinScale, &defaultProtectedGetFn, &writeDynamicResolutionMinScale, "" );
+
+    // Reduced rate and resolution rendering.
+    addField("RenderPeriod", TypeS32, Offset(mRenderPeriod, SceneWindow), &writeRenderPeriod, "The minimum time in milliseconds between renders of the scene.  The last render is drawn in between." );
+    addProtectedField("RenderScale", TypeF32, Offset(mRenderScale, SceneWindow), &setRenderScale, &defaultProtectedGetFn, &writeRenderScale, "The resolution scale the scene is rendered at when dynamic resolution is off." );
 }
 
 //-----------------------------------------------------------------------------
@@ -224,6 +266,8 @@ void SceneWindow::resetScene( void )
 
     // Clear input event watched objects.
     mInputEventWatching.clear();
+    mInputEventPick.clear();
+    mInputEventPickValid = false;
 
     // Reset scene.
     mpScene = NULL;
@@ -773,6 +817,9 @@ void SceneWindow::setObjectInputEventFilter( const U32 groupMask, const U32 laye
     mInputEventGroupMaskFilter = groupMask;
     mInputEventLayerMaskFilter = layerMask;
     mInputEventInvisibleFilter = useInvisible;
+
+    // The pick no longer matches the filter.
+    mInputEventPickValid = false;
 }
 
 //-----------------------------------------------------------------------------
@@ -1009,29 +1056,60 @@ void SceneWindow::sendObjectInputEvent( StringTableEntry name, const GuiEvent& e
     // Fetch old pick count.
     const U32 oldPickCount = (U32)mInputEventWatching.size();
 
-    // Fetch world query and clear results.
-    WorldQuery* pWorldQuery = getScene()->getWorldQuery( true );
-
-    // Set filter.
-    WorldQueryFilter queryFilter( mInputEventLayerMaskFilter, mInputEventGroupMaskFilter, true, mInputEventInvisibleFilter, true, true );
-    pWorldQuery->setQueryFilter( queryFilter );
+    // Pick the objects at the point unless they were picked there earlier this frame.
+    // NOTE:-   Several events often arrive at the same point in a frame such as a press and
+    //          release or a move followed by a press.  The pick is kept until the window next
+    //          renders or the scene next updates.  Deleted objects drop out of the pick set.
+    if ( !mInputEventPickValid || worldMousePoint != mInputEventPickPoint || getScene()->getSceneTime() != mInputEventPickTime )
+    {
+        // Fetch world query and clear results.
+        WorldQuery* pWorldQuery = getScene()->getWorldQuery( true );
+
+        // Set filter.
+        // NOTE: Objects not using input events are rejected before their shapes are tested.
+        WorldQueryFilter queryFilter( mInputEventLayerMaskFilter, mInputEventGroupMaskFilter, true, mInputEventInvisibleFilter, true, true );
+        queryFilter.setInputEventsFilter( true );
+        pWorldQuery->setQueryFilter( queryFilter );
+
+        // Perform world query.
+        pWorldQuery->anyQueryPoint( worldMousePoint );
+
+        // Fetch results.
+        const typeWorldQueryResultVector& queryResults = pWorldQuery->getQueryResults();
+        mInputEventPick.clear();
+        for ( U32 index = 0; index < (U32)queryResults.size(); ++index )
+        {
+            mInputEventPick.addObject( queryResults[index].mpSceneObject );
+        }
+        pWorldQuery->clearQuery();
 
-    // Perform world query.
-    const U32 newPickCount = pWorldQuery->anyQueryPoint( worldMousePoint );
+        mInputEventPickPoint = worldMousePoint;
+        mInputEventPickTime = getScene()->getSceneTime();
+        mInputEventPickValid = true;
+    }
 
     // Early-out if nothing to do.
-    if ( newPickCount == 0 && oldPickCount == 0 )
+    if ( mInputEventPick.size() == 0 && oldPickCount == 0 )
         return;
 
-    // Fetch results.
-    mInputEventQuery = pWorldQuery->getQueryResults();
-    pWorldQuery->clearQuery();
+    // Fetch the picked objects still in the scene.
+    // NOTE: The events are sent to a copy of the pick as they may change it.
+    for ( U32 index = 0; index < (U32)mInputEventPick.size(); ++index )
+    {
+        SceneObject* pSceneObject = static_cast<SceneObject*>( mInputEventPick[index] );
+
+        if ( pSceneObject->getScene() == getScene() )
+            mInputEventQuery.push_back( pSceneObject );
+    }
+
+    // Fetch new pick count.
+    const U32 newPickCount = (U32)mInputEventQuery.size();
 
     // Determine "enter" events.
     for( U32 newIndex = 0; newIndex < newPickCount; ++newIndex )
     {
         // Fetch new scene object.
-        SceneObject* pNewSceneObject = mInputEventQuery[newIndex].mpSceneObject;
+        SceneObject* pNewSceneObject = mInputEventQuery[newIndex];
 
         // Ignore object if it's not using input events.
         // NOTE:-   We only check this for "enter" events in-case the option is
@@ -1072,7 +1150,7 @@ void SceneWindow::sendObjectInputEvent( StringTableEntry name, const GuiEvent& e
         for( U32 newIndex = 0; newIndex < newPickCount; ++newIndex )
         {
             // Skip if scene object is not present.
-            if ( mInputEventQuery[newIndex].mpSceneObject != pOldSceneObject )
+            if ( mInputEventQuery[newIndex] != pOldSceneObject )
                 continue;
 
             // Flag as still present.
@@ -1085,10 +1163,10 @@ void SceneWindow::sendObjectInputEvent( StringTableEntry name, const GuiEvent& e
             mInputEventLeaving.push_back( pOldSceneObject );
     }
 
-    for ( U32 index = 0; index < (U32)mInputEventQuery.size(); ++index )
+    for ( U32 index = 0; index < newPickCount; ++index )
     {
         // Fetch scene object.
-        SceneObject* pSceneObject = mInputEventQuery[index].mpSceneObject;
+        SceneObject* pSceneObject = mInputEventQuery[index];
 
         // Ignore object if it's not using input events.
         if ( !pSceneObject->getUseInputEvents() )
@@ -1519,6 +1597,10 @@ void SceneWindow::processTick( void )
 
 void SceneWindow::interpolateTick( F32 timeDelta )
 {
+    // The scene can change every frame so always update the window.
+    if ( getScene() != NULL )
+        setUpdate();
+
     // Are we moving the camera.
     if ( mMovingCamera )
     {
@@ -1592,6 +1674,9 @@ void SceneWindow::onRender( Point2I offset, const RectI& updateRect )
     if ( !pScene )
         return;
 
+    // Pick input events again now that the scene may have changed.
+    mInputEventPickValid = false;
+
     // Calculate current camera View ( if needed ).
     calculateCameraView( &mCameraCurrent );
 
@@ -1638,6 +1723,25 @@ void SceneWindow::onRender( Point2I offset, const RectI& updateRect )
         sceneMax += mCameraShakeOffset;
     }
 
+    dglFlushBatch();
+
+    // Fetch the clip area.
+    const RectI clipRect = dglGetClipRect();
+
+    // Draw the last render again until the render period has passed.
+    if ( isScaledRenderReusable( clipRect ) )
+    {
+        drawScaledRender( clipRect );
+        renderMetricsOverlay( offset, updateRect );
+        renderChildControls( offset, updateRect );
+        setUpdate();
+        return;
+    }
+
+    // Render into a reduced area of the window if the resolution is scaled.
+    RectI scaledViewport;
+    const bool scaledRender = beginScaledRender( clipRect, scaledViewport );
+
     // Setup new logical coordinate system.
     glMatrixMode(GL_PROJECTION);
     glPushMatrix();
@@ -1652,8 +1756,8 @@ void SceneWindow::onRender( Point2I offset, const RectI& updateRect )
     glLoadIdentity();
 
     // Disable Alpha Test by default
-    glDisable( GL_ALPHA_TEST );    
-    glDisable( GL_DEPTH_TEST );
+    dglDisable( GL_ALPHA_TEST );    
+    dglDisable( GL_DEPTH_TEST );
 
     // Get Debug Stats.
     DebugStats& debugStats = pScene->getDebugStats();
@@ -1665,24 +1769,28 @@ void SceneWindow::onRender( Point2I offset, const RectI& updateRect )
         mCameraCurrent.mCameraAngle,
         mRenderLayerMask,
         mRenderGroupMask,
-        Vector2( mCameraCurrent.mSceneWindowScale ),
+        Vector2( mCameraCurrent.mSceneWindowScale ) / getResolutionScale(),
         &debugStats,
         this );
 
     // Clear the background color if requested.
-    if ( mUseBackgroundColor )
+    // NOTE: A scaled render replaces the whole window area so it is always cleared.
+    if ( mUseBackgroundColor || scaledRender )
     {
         // Enable the scissor.
-        const RectI& clipRect = dglGetClipRect();
-        glEnable(GL_SCISSOR_TEST );
-        glScissor( clipRect.point.x, Platform::getWindowSize().y - (clipRect.point.y + clipRect.extent.y), clipRect.len_x(), clipRect.len_y() );
+        dglEnable(GL_SCISSOR_TEST );
+        if ( scaledRender )
+            glScissor( scaledViewport.point.x, scaledViewport.point.y, scaledViewport.len_x(), scaledViewport.len_y() );
+        else
+            glScissor( clipRect.point.x, Platform::getWindowSize().y - (clipRect.point.y + clipRect.extent.y), clipRect.len_x(), clipRect.len_y() );
 
         // Clear the background.
-        glClearColor( mBackgroundColor.red, mBackgroundColor.green, mBackgroundColor.blue, mBackgroundColor.alpha );
+        const ColorF clearColor = mUseBackgroundColor ? mBackgroundColor : ColorF( 0.0f, 0.0f, 0.0f, 1.0f );
+        glClearColor( clearColor.red, clearColor.green, clearColor.blue, clearColor.alpha );
         glClear(GL_COLOR_BUFFER_BIT);
 
         // Disable the scissor.
-        glDisable( GL_SCISSOR_TEST );
+        dglDisable( GL_SCISSOR_TEST );
     }
 
     // Render View.
@@ -1695,6 +1803,10 @@ void SceneWindow::onRender( Point2I offset, const RectI& updateRect )
     glPopMatrix();
     glMatrixMode(GL_MODELVIEW);
 
+    // Upscale a scaled render to the window.
+    if ( scaledRender )
+        endScaledRender( clipRect, scaledViewport );
+
     // Render the metrics.
     renderMetricsOverlay( offset, updateRect );
 
@@ -1707,6 +1819,151 @@ void SceneWindow::onRender( Point2I offset, const RectI& updateRect )
 
 //------------------------------------------------------------------------------
 
+void SceneWindow::updateResolutionScale( void )
+{
+    // Fetch the frame time to aim for.
+    const U32 targetFrameRate = Game->getTargetFrameRate();
+    const F32 targetFrameTime = 1000.0f / (F32)(targetFrameRate > 0 ? targetFrameRate : 60);
+
+    // Smooth the frame time so that a single slow frame doesn't change the scale.
+    // NOTE: There are no GPU timer queries available so the frame work time is used which includes the buffer swap and so any GPU stall.
+    mSmoothedFrameTime = (mSmoothedFrameTime * 0.9f) + (Game->getFrameWorkTime() * 0.1f);
+
+    // Reduce the scale quickly when over budget and increase it slowly when comfortably under budget.
+    if ( mSmoothedFrameTime > targetFrameTime * 1.05f )
+        mResolutionScale -= 0.05f;
+    else if ( mSmoothedFrameTime < targetFrameTime * 0.8f )
+        mResolutionScale += 0.01f;
+
+    mResolutionScale = mClampF( mResolutionScale, mDynamicResolutionMinScale, 1.0f );
+}
+
+//------------------------------------------------------------------------------
+
+bool SceneWindow::beginScaledRender( const RectI& clipRect, RectI& scaledViewport )
+{
+    // Adapt the scale to recent frame times.
+    if ( mDynamicResolution )
+        updateResolutionScale();
+
+    // Finish if rendering at full resolution every frame.
+    // NOTE: A render that is drawn again until the render period has passed must be kept in the texture.
+    const F32 resolutionScale = getResolutionScale();
+    if ( (resolutionScale >= 1.0f && mRenderPeriod == 0) || !clipRect.isValidRect() )
+        return false;
+
+    // Calculate the reduced area at the bottom-left of the clip area (in window coordinates).
+    scaledViewport.point.set( clipRect.point.x, Platform::getWindowSize().y - (clipRect.point.y + clipRect.extent.y) );
+    scaledViewport.extent.set(
+        getMax( 1, (S32)(clipRect.extent.x * resolutionScale + 0.5f) ),
+        getMax( 1, (S32)(clipRect.extent.y * resolutionScale + 0.5f) ) );
+
+    // Create the texture the reduced area is copied into if it is too small.
+    const U32 textureWidth = getNextPow2( clipRect.extent.x );
+    const U32 textureHeight = getNextPow2( clipRect.extent.y );
+    if ( mResolutionTexture == 0 || textureWidth > (U32)mResolutionTextureSize.x || textureHeight > (U32)mResolutionTextureSize.y )
+    {
+        if ( mResolutionTexture != 0 )
+            dglDeleteTextures( 1, (const GLuint*)&mResolutionTexture );
+
+        glGenTextures( 1, (GLuint*)&mResolutionTexture );
+        dglBindTexture( GL_TEXTURE_2D, mResolutionTexture );
+        glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR );
+        glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
+        glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, dglDoesSupportEdgeClamp() ? GL_CLAMP_TO_EDGE : GL_CLAMP );
+        glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, dglDoesSupportEdgeClamp() ? GL_CLAMP_TO_EDGE : GL_CLAMP );
+        glTexImage2D( GL_TEXTURE_2D, 0, GL_RGB, textureWidth, textureHeight, 0, GL_RGB, GL_UNSIGNED_BYTE, NULL );
+        mResolutionTextureSize.set( textureWidth, textureHeight );
+    }
+
+    // Render into the reduced area.
+    glViewport( scaledViewport.point.x, scaledViewport.point.y, scaledViewport.len_x(), scaledViewport.len_y() );
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+
+void SceneWindow::endScaledRender( const RectI& clipRect, const RectI& scaledViewport )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneWindow_EndScaledRender);
+
+    // Copy the reduced area into the texture.
+    dglBindTexture( GL_TEXTURE_2D, mResolutionTexture );
+    glCopyTexSubImage2D( GL_TEXTURE_2D, 0, 0, 0, scaledViewport.point.x, scaledViewport.point.y, scaledViewport.len_x(), scaledViewport.len_y() );
+
+    // Note what the texture holds so that it can be drawn again.
+    mScaledRenderTime = Platform::getRealMilliseconds();
+    mScaledRenderClip = clipRect;
+    mScaledRenderViewport = scaledViewport;
+
+    // Restore the GUI viewport and projection.
+    dglSetClipRect( clipRect );
+
+    // Upscale the texture over the whole clip area.
+    drawScaledRender( clipRect );
+}
+
+//------------------------------------------------------------------------------
+
+bool SceneWindow::isScaledRenderReusable( const RectI& clipRect ) const
+{
+    return mRenderPeriod > 0 &&
+        mResolutionTexture != 0 &&
+        clipRect == mScaledRenderClip &&
+        Platform::getRealMilliseconds() - mScaledRenderTime < mRenderPeriod;
+}
+
+//------------------------------------------------------------------------------
+
+void SceneWindow::drawScaledRender( const RectI& clipRect )
+{
+    // NOTE: The texture rows run bottom-up whereas the GUI runs top-down.
+    const F32 left = (F32)clipRect.point.x;
+    const F32 top = (F32)clipRect.point.y;
+    const F32 right = (F32)(clipRect.point.x + clipRect.extent.x);
+    const F32 bottom = (F32)(clipRect.point.y + clipRect.extent.y);
+    const F32 texRight = (F32)mScaledRenderViewport.len_x() / (F32)mResolutionTextureSize.x;
+    const F32 texTop = (F32)mScaledRenderViewport.len_y() / (F32)mResolutionTextureSize.y;
+
+    const GLfloat vertices[] = { left, top, right, top, left, bottom, right, bottom };
+    const GLfloat texCoords[] = { 0.0f, texTop, texRight, texTop, 0.0f, 0.0f, texRight, 0.0f };
+
+    // The upscaled render is opaque.
+    dglDisable( GL_BLEND );
+    dglEnable( GL_TEXTURE_2D );
+    dglBindTexture( GL_TEXTURE_2D, mResolutionTexture );
+    glTexEnvi( GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_REPLACE );
+    glColor4f( 1.0f, 1.0f, 1.0f, 1.0f );
+
+    dglEnableClientState( GL_VERTEX_ARRAY );
+    dglEnableClientState( GL_TEXTURE_COORD_ARRAY );
+    dglDisableClientState( GL_COLOR_ARRAY );
+    glVertexPointer( 2, GL_FLOAT, 0, vertices );
+    glTexCoordPointer( 2, GL_FLOAT, 0, texCoords );
+    glDrawArrays( GL_TRIANGLE_STRIP, 0, 4 );
+
+    dglDisableClientState( GL_TEXTURE_COORD_ARRAY );
+    glTexEnvi( GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE );
+    dglDisable( GL_TEXTURE_2D );
+}
+
+//------------------------------------------------------------------------------
+
+void SceneWindow::textureEventCallback( const TextureManager::TextureEventCode eventCode, void* userData )
+{
+    // The texture is lost along with the context so forget it.
+    if ( eventCode == TextureManager::BeginZombification )
+    {
+        SceneWindow* pSceneWindow = static_cast<SceneWindow*>( userData );
+        pSceneWindow->mResolutionTexture = 0;
+        pSceneWindow->mResolutionTextureSize.set( 0, 0 );
+    }
+}
+
+//------------------------------------------------------------------------------
+
 void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect )
 {
     // Debug Profiling.
@@ -1733,9 +1990,11 @@ void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect
     // Fetch the font.
     Resource<GFont>& font = mProfile->mFont;    
 
+    dglFlushBatch();
+
     // Blending for banner background.
-    glEnable        ( GL_BLEND );
-    glBlendFunc     ( GL_SRC_ALPHA , GL_ONE_MINUS_SRC_ALPHA );
+    dglEnable        ( GL_BLEND );
+    dglBlendFunc     ( GL_SRC_ALPHA , GL_ONE_MINUS_SRC_ALPHA );
 
     // Set banner background color.
     const ColorI& fillColor = mProfile->mFillColor;
@@ -1752,7 +2011,7 @@ void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect
     const S32 metricsOffset = (S32)font->getStrWidth( "WWWWWWWWWWWW" );
 
     // Set Banner Height.
-    F32 bannerLineHeight = fullMetrics ? 17.0f : 1.0f;
+    F32 bannerLineHeight = fullMetrics ? 24.0f : 1.0f;
 
     // Add an extra line if we're monitoring a scene object.
     if ( pDebugSceneObject != NULL )
@@ -1771,12 +2030,12 @@ void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect
     };
     
     glVertexPointer(2, GL_FLOAT, 0, sWindowVertices);
-    glEnableClientState(GL_VERTEX_ARRAY);
+    dglEnableClientState(GL_VERTEX_ARRAY);
     glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-    glDisableClientState(GL_VERTEX_ARRAY);
+    dglDisableClientState(GL_VERTEX_ARRAY);
 
     // Disable Banner Blending.
-    glDisable       ( GL_BLEND );
+    dglDisable       ( GL_BLEND );
         
     // Set Debug Text color.
     dglSetBitmapModulation( mProfile->mFontColor );
@@ -1876,13 +2135,109 @@ void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect
         dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
         linePositionY += linePositionOffsetY;
 
+        // Batching #4.
+        {
+            // Count the batch breaks caused by each object.
+            const U32 maxBreakers = 16;
+            const BatchRender::BatchBreak* breakers[maxBreakers];
+            U32 breakerCounts[maxBreakers];
+            U32 breakerCount = 0;
+            const BatchRender::typeBatchBreakVector& batchBreaks = pScene->getBatchBreaks();
+            for ( BatchRender::typeBatchBreakVector::const_iterator breakItr = batchBreaks.begin(); breakItr != batchBreaks.end(); ++breakItr )
+            {
+                // Skip breaks not caused by an object.
+                if ( breakItr->mObjectId == 0 )
+                    continue;
+
+                U32 breakerIndex = 0;
+                while ( breakerIndex < breakerCount && breakers[breakerIndex]->mObjectId != breakItr->mObjectId )
+                    ++breakerIndex;
+
+                if ( breakerIndex == breakerCount )
+                {
+                    if ( breakerCount == maxBreakers )
+                        continue;
+
+                    breakers[breakerCount] = breakItr;
+                    breakerCounts[breakerCount++] = 0;
+                }
+
+                breakerCounts[breakerIndex]++;
+            }
+
+            const U32 drawCalls = debugStats.batchDrawCallsStrict + debugStats.batchDrawCallsSorted;
+            dSprintf( mDebugText, sizeof( mDebugText ), "- TrisPerFlush=%0.1f, TrisPerDraw=%0.1f, Breakers:",
+                debugStats.batchFlushes > 0 ? (F32)debugStats.batchTrianglesSubmitted / (F32)debugStats.batchFlushes : 0.0f,
+                drawCalls > 0 ? (F32)debugStats.batchTrianglesSubmitted / (F32)drawCalls : 0.0f );
+
+            // Show the worst three breakers.
+            for ( U32 rank = 0; rank < 3 && rank < breakerCount; ++rank )
+            {
+                U32 worstIndex = rank;
+                for ( U32 breakerIndex = rank + 1; breakerIndex < breakerCount; ++breakerIndex )
+                {
+                    if ( breakerCounts[breakerIndex] > breakerCounts[worstIndex] )
+                        worstIndex = breakerIndex;
+                }
+
+                const BatchRender::BatchBreak* pWorstBreaker = breakers[worstIndex];
+                const U32 worstCount = breakerCounts[worstIndex];
+                breakers[worstIndex] = breakers[rank];
+                breakerCounts[worstIndex] = breakerCounts[rank];
+                breakers[rank] = pWorstBreaker;
+                breakerCounts[rank] = worstCount;
+
+                const U32 textLength = dStrlen( mDebugText );
+                dSprintf( mDebugText + textLength, sizeof( mDebugText ) - textLength, " %s#%d(%s)=%d",
+                    pWorstBreaker->mObjectClass, pWorstBreaker->mObjectId, BatchRender::getFlushReasonDescription( pWorstBreaker->mReason ), worstCount );
+            }
+        }
+        dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
+        linePositionY += linePositionOffsetY;
+
+        // GPU #1.
+        dglDrawText( font, bannerOffset + Point2I(0,(S32)linePositionY), "GPU", NULL );
+        if ( GpuTimer::getEnabled() )
+        {
+            dSprintf( mDebugText, sizeof( mDebugText ), "- Frame=%0.3fms, Gui=%0.3fms, Scene=%0.3fms, Flush=%0.3fms",
+                GpuTimer::getFrameTime(),
+                GpuTimer::getResultTime( GpuTimer::SectionGui ),
+                GpuTimer::getResultTime( GpuTimer::SectionScene ),
+                GpuTimer::getResultTime( GpuTimer::SectionBatchFlush )
+                );
+        }
+        else
+        {
+            dSprintf( mDebugText, sizeof( mDebugText ), "- %s", GpuTimer::isSupported() ? "(OFF)" : "(Unsupported)" );
+        }
+        dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
+        linePositionY += linePositionOffsetY;
+
+        // GPU #2.
+        dStrcpy( mDebugText, "- Layers:" );
+        for ( U32 index = 0; index < GpuTimer::getResultCount(); ++index )
+        {
+            // Skip anything that isn't a layer.
+            const char* pSectionName = GpuTimer::getResultName( index );
+            if ( dStrncmp( pSectionName, "layer", 5 ) != 0 )
+                continue;
+
+            const U32 textLength = dStrlen( mDebugText );
+            dSprintf( mDebugText + textLength, sizeof( mDebugText ) - textLength, " L%s=%0.3f", pSectionName + 5, GpuTimer::getResultTime( index ) );
+        }
+        dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
+        linePositionY += linePositionOffsetY;
+
         // Textures.
         dglDrawText( font, bannerOffset + Point2I(0,(S32)linePositionY), "Textures", NULL );
-        dSprintf( mDebugText, sizeof( mDebugText ), "- TextureCount=%d, TextureSize=%d, TextureWaste=%d, BitmapSize=%d",
+        dSprintf( mDebugText, sizeof( mDebugText ), "- TextureCount=%d, TextureSize=%d, TextureWaste=%d, BitmapSize=%d, Budget=%d, Evicted=%d, Pending=%d",
             TextureManager::getTextureResidentCount(),
             TextureManager::getTextureResidentSize(),
             TextureManager::getTextureResidentWasteSize(),
-            TextureManager::getBitmapResidentSize()
+            TextureManager::getBitmapResidentSize(),
+            TextureManager::getTextureBudget(),
+            TextureManager::getTextureEvictedCount(),
+            TextureManager::getPendingTextureCount()
             );
         dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
         linePositionY += linePositionOffsetY;
@@ -1897,6 +2252,21 @@ void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect
         dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
         linePositionY += linePositionOffsetY;
 
+        // Continuous physics.
+        dSprintf( mDebugText, sizeof( mDebugText ), "- TOISubSteps=%d<%d>, TOIBudgetExhausted=%d",
+            debugStats.toiSubStepCount, debugStats.maxTOISubStepCount,
+            debugStats.toiBudgetExhaustedCount );
+        dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
+        linePositionY += linePositionOffsetY;
+
+        // Physics allocator.
+        dSprintf( mDebugText, sizeof( mDebugText ), "- AllocUsed=%d, AllocReserved=%d<%d>, Allocations=%d",
+            debugStats.allocatorUsed,
+            debugStats.allocatorReserved, debugStats.maxAllocatorReserved,
+            debugStats.allocatorAllocations );
+        dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
+        linePositionY += linePositionOffsetY;
+
         const b2Profile& worldProfile = debugStats.worldProfile;
         const b2Profile& maxWorldProfile = debugStats.maxWorldProfile;
 
@@ -1919,6 +2289,19 @@ void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect
         dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
         linePositionY += linePositionOffsetY;
 
+        // Tick phase timings.
+        const TickPhaseStats* pTickPhases = debugStats.tickPhases;
+        dglDrawText( font, bannerOffset + Point2I(0,(S32)linePositionY), "Tick", NULL );
+        for ( U32 phase = 0; phase < DebugStats::TICK_PHASE_COUNT; phase += 3 )
+        {
+            dSprintf( mDebugText, sizeof( mDebugText ), "- %s=%0.2f<%0.2f/%0.2f/%0.2f>(%d), %s=%0.2f<%0.2f/%0.2f/%0.2f>(%d), %s=%0.2f<%0.2f/%0.2f/%0.2f>(%d)",
+                Scene::getTickPhaseDescription( (DebugStats::TickPhase)phase ), pTickPhases[phase].last, pTickPhases[phase].getPercentile(50.0f), pTickPhases[phase].getPercentile(95.0f), pTickPhases[phase].getPercentile(99.0f), pTickPhases[phase].overBudgetCount,
+                Scene::getTickPhaseDescription( (DebugStats::TickPhase)(phase+1) ), pTickPhases[phase+1].last, pTickPhases[phase+1].getPercentile(50.0f), pTickPhases[phase+1].getPercentile(95.0f), pTickPhases[phase+1].getPercentile(99.0f), pTickPhases[phase+1].overBudgetCount,
+                Scene::getTickPhaseDescription( (DebugStats::TickPhase)(phase+2) ), pTickPhases[phase+2].last, pTickPhases[phase+2].getPercentile(50.0f), pTickPhases[phase+2].getPercentile(95.0f), pTickPhases[phase+2].getPercentile(99.0f), pTickPhases[phase+2].overBudgetCount );
+            dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
+            linePositionY += linePositionOffsetY;
+        }
+
         // Physics spatial tree.
         dglDrawText( font, bannerOffset + Point2I(0,(S32)linePositionY), "Partition", NULL );
         const b2World* pWorld = pScene->getWorld();
@@ -1952,6 +2335,37 @@ void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect
             AssetDatabase.getLoadedPrivateAssetCount(), AssetDatabase.getMaxLoadedPrivateAssetCount() );
         dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
         linePositionY += linePositionOffsetY;
+
+        // Memory.
+        Memory::TagStats memoryStats[Memory::TagCount];
+        S64 memoryLiveBytes = 0;
+        F32 memoryAllocationRate = 0.0f;
+        for ( U32 tag = 0; tag < Memory::TagCount; ++tag )
+        {
+            Memory::getTagStats( (Memory::Tag)tag, memoryStats[tag] );
+            memoryLiveBytes += memoryStats[tag].liveBytes;
+            memoryAllocationRate += memoryStats[tag].allocationRate;
+        }
+        dglDrawText( font, bannerOffset + Point2I(0,(S32)linePositionY), "Memory", NULL );
+        dSprintf( mDebugText, sizeof( mDebugText ), "- Backend=%s, LiveKB=%0.0f, Allocs/s=%0.0f",
+            Memory::getBackend()->mName,
+            (F64)memoryLiveBytes / 1024.0,
+            memoryAllocationRate );
+        dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
+        linePositionY += linePositionOffsetY;
+
+        // Memory tags (live KB and allocations per-second).
+        S32 memoryTextLength = dSprintf( mDebugText, sizeof( mDebugText ), "-" );
+        for ( U32 tag = 0; tag < Memory::TagCount; ++tag )
+        {
+            memoryTextLength += dSprintf( mDebugText + memoryTextLength, sizeof( mDebugText ) - memoryTextLength, "%s %s=%0.0f<%0.0f>",
+                tag == 0 ? "" : ",",
+                Memory::getTagName( (Memory::Tag)tag ),
+                (F64)memoryStats[tag].liveBytes / 1024.0,
+                memoryStats[tag].allocationRate );
+        }
+        dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
+        linePositionY += linePositionOffsetY;
     }
     else if ( fpsMetrics )
     {
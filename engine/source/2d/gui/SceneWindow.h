@@ -43,6 +43,10 @@
 #include "2d/core/Utility.h"
 #endif
 
+#ifndef _TEXTURE_MANAGER_H_
+#include "graphics/TextureManager.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 class SceneWindow : public GuiControl, public virtual Tickable
@@ -98,6 +102,22 @@ private:
     ColorF                      mBackgroundColor;
     bool                        mUseBackgroundColor;
 
+    /// Dynamic resolution.
+    bool                mDynamicResolution;
+    F32                 mDynamicResolutionMinScale;
+    F32                 mResolutionScale;
+    F32                 mSmoothedFrameTime;
+    U32                 mResolutionTexture;
+    Point2I             mResolutionTextureSize;
+    U32                 mTextureCallbackKey;
+
+    /// Reduced rate and resolution rendering.
+    U32                 mRenderPeriod;
+    F32                 mRenderScale;
+    U32                 mScaledRenderTime;
+    RectI               mScaledRenderClip;
+    RectI               mScaledRenderViewport;
+
     /// Camera Attachment.
     bool                mCameraMounted;
     SceneObject*        mpMountedTo;
@@ -131,7 +151,11 @@ private:
     U32                 mInputEventGroupMaskFilter;
     U32                 mInputEventLayerMaskFilter;
     bool                mInputEventInvisibleFilter;
-    typeWorldQueryResultVector mInputEventQuery;
+    SimSet              mInputEventPick;
+    typeSceneObjectVector mInputEventQuery;
+    Vector2             mInputEventPickPoint;
+    F32                 mInputEventPickTime;
+    bool                mInputEventPickValid;
     typeSceneObjectVector mInputEventEntering;
     typeSceneObjectVector mInputEventLeaving;
     SimSet              mInputEventWatching;
@@ -150,6 +174,14 @@ private:
 
     void calculateCameraView( CameraView* pCameraView );
 
+    /// Dynamic resolution.
+    void updateResolutionScale( void );
+    bool beginScaledRender( const RectI& clipRect, RectI& scaledViewport );
+    void endScaledRender( const RectI& clipRect, const RectI& scaledViewport );
+    void drawScaledRender( const RectI& clipRect );
+    bool isScaledRenderReusable( const RectI& clipRect ) const;
+    static void textureEventCallback( const TextureManager::TextureEventCode eventCode, void* userData );
+
 public:
 
     /// Camera Interpolation Mode.
@@ -192,6 +224,21 @@ public:
     inline void             setUseBackgroundColor( const bool useBackgroundColor ) { mUseBackgroundColor = useBackgroundColor; }
     inline bool             getUseBackgroundColor( void ) const         { return mUseBackgroundColor; }
 
+    /// Dynamic resolution.
+    /// When on, the scene is rendered at a reduced resolution that adapts to recent frame times and is upscaled to the window.
+    /// A scaled render replaces the whole window area so the window is always cleared (to black if no background color is used).
+    inline void             setDynamicResolution( const bool dynamicResolution ) { mDynamicResolution = dynamicResolution; mResolutionScale = 1.0f; }
+    inline bool             getDynamicResolution( void ) const          { return mDynamicResolution; }
+    inline void             setDynamicResolutionMinScale( const F32 minScale ) { mDynamicResolutionMinScale = mClampF( minScale, 0.1f, 1.0f ); }
+    inline F32              getDynamicResolutionMinScale( void ) const  { return mDynamicResolutionMinScale; }
+    inline F32              getResolutionScale( void ) const            { return mDynamicResolution ? mResolutionScale : mRenderScale; }
+
+    /// Reduced rate and resolution rendering.
+    inline void             setRenderPeriod( const U32 renderPeriod )   { mRenderPeriod = renderPeriod; }
+    inline U32              getRenderPeriod( void ) const               { return mRenderPeriod; }
+    inline void             setRenderScale( const F32 renderScale )     { mRenderScale = mClampF( renderScale, 0.1f, 1.0f ); }
+    inline F32              getRenderScale( void ) const                { return mRenderScale; }
+
     /// Input.
     void setObjectInputEventFilter( const U32 groupMask, const U32 layerMask, const bool useInvisible = false );
     void setObjectInputEventGroupFilter( const U32 groupMask );
@@ -201,7 +248,7 @@ public:
     inline void setUseObjectInputEvents( const bool inputStatus ) { mUseObjectInputEvents = inputStatus; };
     inline bool getUseWindowInputEvents( void ) const { return mUseWindowInputEvents; };
     inline bool getUseObjectInputEvents( void ) const { return mUseObjectInputEvents; };
-    inline void clearWatchedInputEvents( void ) { mInputEventWatching.clear(); }
+    inline void clearWatchedInputEvents( void ) { mInputEventWatching.clear(); mInputEventPickValid = false; }
     inline void removeFromInputEventPick(SceneObject* pSceneObject ) { mInputEventWatching.removeObject((SimObject*)pSceneObject); }
 
     void addInputListener( SimObject* pSimObject );
@@ -323,6 +370,12 @@ protected:
     static bool writeUseObjectInputEvents( void* obj, StringTableEntry pFieldName ) { return static_cast<SceneWindow*>(obj)->mUseObjectInputEvents == true; }
     static bool writeBackgroundColor( void* obj, StringTableEntry pFieldName )      { return static_cast<SceneWindow*>(obj)->mUseBackgroundColor == true; }
     static bool writeUseBackgroundColor( void* obj, StringTableEntry pFieldName )   { return static_cast<SceneWindow*>(obj)->mUseBackgroundColor == true; }
+    static bool writeDynamicResolution( void* obj, StringTableEntry pFieldName )    { return static_cast<SceneWindow*>(obj)->mDynamicResolution == true; }
+    static bool setDynamicResolutionMinScale( void* obj, const char* data )         { static_cast<SceneWindow*>(obj)->setDynamicResolutionMinScale( dAtof(data) ); return false; }
+    static bool writeDynamicResolutionMinScale( void* obj, StringTableEntry pFieldName ) { return mNotEqual( static_cast<SceneWindow*>(obj)->mDynamicResolutionMinScale, 0.5f ); }
+    static bool writeRenderPeriod( void* obj, StringTableEntry pFieldName )         { return static_cast<SceneWindow*>(obj)->mRenderPeriod != 0; }
+    static bool setRenderScale( void* obj, const char* data )                       { static_cast<SceneWindow*>(obj)->setRenderScale( dAtof(data) ); return false; }
+    static bool writeRenderScale( void* obj, StringTableEntry pFieldName )          { return mNotEqual( static_cast<SceneWindow*>(obj)->mRenderScale, 1.0f ); }
 };
 
 #endif // _SCENE_WINDOW_H_
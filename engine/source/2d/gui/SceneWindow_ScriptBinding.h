@@ -1078,6 +1078,105 @@ ConsoleMethodWithDocs(SceneWindow, getUseBackgroundColor, ConsoleBool, 2, 2, (..
 
 //-----------------------------------------------------------------------------
 
+/*! Sets whether the scene is rendered at a dynamic resolution or not.
+    When on, the scene is rendered at a reduced resolution that adapts to recent frame times and is upscaled to the window.
+    The window is always cleared (to black if the background color is not in use) as the upscaled render replaces it.
+    @param dynamicResolution Whether the scene is rendered at a dynamic resolution or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(SceneWindow, setDynamicResolution, ConsoleVoid, 3, 3, (dynamicResolution))
+{
+    object->setDynamicResolution( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the scene is rendered at a dynamic resolution or not.
+    @return Whether the scene is rendered at a dynamic resolution or not.
+*/
+ConsoleMethodWithDocs(SceneWindow, getDynamicResolution, ConsoleBool, 2, 2, ())
+{
+    return object->getDynamicResolution();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets the smallest resolution scale that a dynamic resolution can reduce to.
+    @param minScale The smallest resolution scale in the range (0.1 to 1.0).  The default is 0.5.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(SceneWindow, setDynamicResolutionMinScale, ConsoleVoid, 3, 3, (minScale))
+{
+    object->setDynamicResolutionMinScale( dAtof(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the smallest resolution scale that a dynamic resolution can reduce to.
+    @return The smallest resolution scale.
+*/
+ConsoleMethodWithDocs(SceneWindow, getDynamicResolutionMinScale, ConsoleFloat, 2, 2, ())
+{
+    return object->getDynamicResolutionMinScale();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the current resolution scale the scene is rendered at.
+    @return The current resolution scale (1.0 when rendering at full resolution).
+*/
+ConsoleMethodWithDocs(SceneWindow, getResolutionScale, ConsoleFloat, 2, 2, ())
+{
+    return object->getResolutionScale();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets the minimum time between renders of the scene.
+    In between, the last render is drawn again from a texture which suits views such as minimaps that need not update every frame.
+    @param renderPeriod The minimum time between renders in milliseconds or zero to render every frame (the default).
+    @return No return value.
+*/
+ConsoleMethodWithDocs(SceneWindow, setRenderPeriod, ConsoleVoid, 3, 3, (renderPeriod))
+{
+    const S32 renderPeriod = dAtoi(argv[2]);
+    object->setRenderPeriod( renderPeriod > 0 ? (U32)renderPeriod : 0 );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the minimum time between renders of the scene.
+    @return The minimum time between renders in milliseconds.
+*/
+ConsoleMethodWithDocs(SceneWindow, getRenderPeriod, ConsoleInt, 2, 2, ())
+{
+    return object->getRenderPeriod();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets the resolution scale the scene is rendered at when dynamic resolution is off.
+    The scene is rendered at the reduced resolution and upscaled to the window.
+    @param renderScale The resolution scale in the range (0.1 to 1.0).  The default is 1.0.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(SceneWindow, setRenderScale, ConsoleVoid, 3, 3, (renderScale))
+{
+    object->setRenderScale( dAtof(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the resolution scale the scene is rendered at when dynamic resolution is off.
+    @return The resolution scale.
+*/
+ConsoleMethodWithDocs(SceneWindow, getRenderScale, ConsoleFloat, 2, 2, ())
+{
+    return object->getRenderScale();
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Sets whether input events are monitored by the window or not.
     @param inputStatus Whether input events are processed by the window or not.
     @return No return value.
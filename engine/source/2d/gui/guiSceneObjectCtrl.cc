@@ -383,6 +383,8 @@ void GuiSceneObjectCtrl::onRender(Point2I offset, const RectI& updateRect)
       y1 *= -1;
       y2 *= -1;
 
+      dglFlushBatch();
+
       // Setup new logical coordinate system.
       glMatrixMode(GL_PROJECTION);
       glPushMatrix();
@@ -418,8 +420,8 @@ void GuiSceneObjectCtrl::onRender(Point2I offset, const RectI& updateRect)
       glLoadIdentity();
 
       // Enable Alpha Test.
-      glEnable        ( GL_ALPHA_TEST );
-      glAlphaFunc     ( GL_GREATER, 0.0f );
+      dglEnable        ( GL_ALPHA_TEST );
+      dglAlphaFunc     ( GL_GREATER, 0.0f );
 
       // Calculate maximal clip bounds.
       RectF clipBounds( -x1,-y1, x2-x1, y2-y1 );
@@ -446,8 +448,8 @@ void GuiSceneObjectCtrl::onRender(Point2I offset, const RectI& updateRect)
       mSelectedSceneObject->sceneRender( &guiSceneRenderState, &guiSceneRenderRequest, &mBatchRenderer );
 
       // Restore Standard Settings.
-      glDisable       ( GL_DEPTH_TEST );
-      glDisable       ( GL_ALPHA_TEST );
+      dglDisable       ( GL_DEPTH_TEST );
+      dglDisable       ( GL_ALPHA_TEST );
 
       // Restore Matrices.
       glMatrixMode(GL_MODELVIEW);
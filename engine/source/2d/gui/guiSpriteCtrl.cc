@@ -314,6 +314,21 @@ void GuiSpriteCtrl::onRender( Point2I offset, const RectI &updateRect)
 
 //------------------------------------------------------------------------------
 
+void GuiSpriteCtrl::processTick( void )
+{
+    // Fetch the current animation frame.
+    const S32 animationFrame = getAnimationFrame();
+
+    // Call parent.
+    ImageFrameProvider::processTick();
+
+    // Update control if the animation frame changed.
+    if ( getAnimationFrame() != animationFrame )
+        setUpdate();
+}
+
+//------------------------------------------------------------------------------
+
 void GuiSpriteCtrl::onAnimationEnd( void )
 {
     // Clear assets.
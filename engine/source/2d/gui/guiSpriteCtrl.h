@@ -67,6 +67,7 @@ public:
 
 protected:
     virtual void onAnimationEnd( void );
+    virtual void processTick( void );
 
 protected:
     static bool setImage(void* obj, const char* data) { static_cast<GuiSpriteCtrl*>(obj)->setImage( data ); return false; }
@@ -48,6 +48,12 @@ bool ContactFilter::ShouldCollide(b2Fixture* fixtureA, b2Fixture* fixtureB)
     if ( pSceneObjectA->mCollisionSuppress || pSceneObjectB->mCollisionSuppress )
         return false;
 
+    // No contact if a sensor is involved that nothing is listening to as it would have no effect.
+    if ( (fixtureA->IsSensor() || fixtureB->IsSensor()) &&
+         !pSceneObjectA->isContactRequired( pSceneObjectB ) &&
+         !pSceneObjectB->isContactRequired( pSceneObjectA ) )
+         return false;
+
     // Check collision rule A -> B.
     if ( (pSceneObjectA->mCollisionGroupMask & pSceneObjectB->mSceneGroupMask) != 0 &&
          (pSceneObjectA->mCollisionLayerMask & pSceneObjectB->mSceneLayerMask) != 0 )
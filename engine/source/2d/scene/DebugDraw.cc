@@ -28,6 +28,21 @@
 
 //-----------------------------------------------------------------------------
 
+DebugDraw::DebugDraw() :
+    mBlendMode( true ),
+    mSrcBlendFactor( GL_SRC_ALPHA ),
+    mDstBlendFactor( GL_ONE_MINUS_SRC_ALPHA ),
+    mAlphaTest( -1.0f )
+{
+    // Set Vector Associations.
+    VECTOR_SET_ASSOCIATION( mTriangleVertices );
+    VECTOR_SET_ASSOCIATION( mLineVertices );
+    VECTOR_SET_ASSOCIATION( mPointVertices );
+    VECTOR_SET_ASSOCIATION( mPointSizes );
+}
+
+//-----------------------------------------------------------------------------
+
 void DebugDraw::DrawAABB( const b2AABB& aabb, const ColorF& color )
 {
     // Debug Profiling.
@@ -264,13 +279,14 @@ void DebugDraw::DrawPolygon( const b2Vec2* vertices, int32 vertexCount, const Co
     // Debug Profiling.
     PROFILE_SCOPE(DebugDraw_DrawPolygon);
 
-    glColor3f(color.red, color.green, color.blue);
-    glBegin(GL_LINE_LOOP);
+    useDebugState();
+
+    const ColorF lineColor( color.red, color.green, color.blue, 1.0f );
     for (int32 i = 0; i < vertexCount; ++i)
     {
-        glVertex2f(vertices[i].x, vertices[i].y);
+        pushVertex( mLineVertices, vertices[i], lineColor );
+        pushVertex( mLineVertices, vertices[(i + 1) % vertexCount], lineColor );
     }
-    glEnd();
 }
 
 //-----------------------------------------------------------------------------
@@ -280,24 +296,18 @@ void DebugDraw::DrawSolidPolygon( const b2Vec2* vertices, int32 vertexCount, con
     // Debug Profiling.
     PROFILE_SCOPE(DebugDraw_DrawSolidPolygon);
 
-    glEnable(GL_BLEND);
-    glBlendFunc (GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    glColor4f(0.5f * color.red, 0.5f * color.green, 0.5f * color.blue, 0.15f);
-    glBegin(GL_TRIANGLE_FAN);
-    for (int32 i = 0; i < vertexCount; ++i)
-    {
-        glVertex2f(vertices[i].x, vertices[i].y);
-    }
-    glEnd();
-    glDisable(GL_BLEND);
+    useDebugState();
 
-    glColor4f(color.red, color.green, color.blue, 1.0f);
-    glBegin(GL_LINE_LOOP);
-    for (int32 i = 0; i < vertexCount; ++i)
+    // Fill as a fan of triangles.
+    const ColorF fillColor( 0.5f * color.red, 0.5f * color.green, 0.5f * color.blue, 0.15f );
+    for (int32 i = 2; i < vertexCount; ++i)
     {
-        glVertex2f(vertices[i].x, vertices[i].y);
+        pushVertex( mTriangleVertices, vertices[0], fillColor );
+        pushVertex( mTriangleVertices, vertices[i - 1], fillColor );
+        pushVertex( mTriangleVertices, vertices[i], fillColor );
     }
-    glEnd();
+
+    DrawPolygon( vertices, vertexCount, color );
 }
 
 //-----------------------------------------------------------------------------
@@ -307,18 +317,16 @@ void DebugDraw::DrawCircle( const b2Vec2& center, float32 radius, const ColorF&
     // Debug Profiling.
     PROFILE_SCOPE(DebugDraw_DrawCircle);
 
-    const float32 k_segments = 16.0f;
+    const int32 k_segments = 16;
     const float32 k_increment = 2.0f * b2_pi / k_segments;
-    float32 theta = 0.0f;
-    glColor3f(color.red, color.green, color.blue);
-    glBegin(GL_LINE_LOOP);
+    b2Vec2 vertices[k_segments];
     for (int32 i = 0; i < k_segments; ++i)
     {
-        b2Vec2 v = center + radius * b2Vec2(cosf(theta), sinf(theta));
-        glVertex2f(v.x, v.y);
-        theta += k_increment;
+        const float32 theta = i * k_increment;
+        vertices[i] = center + radius * b2Vec2(cosf(theta), sinf(theta));
     }
-    glEnd();
+
+    DrawPolygon( vertices, k_segments, color );
 }
     
 //-----------------------------------------------------------------------------
@@ -328,81 +336,184 @@ void DebugDraw::DrawSolidCircle( const b2Vec2& center, float32 radius, const b2V
     // Debug Profiling.
     PROFILE_SCOPE(DebugDraw_DrawSolidCircle);
 
-    const float32 k_segments = 12.0f;
+    const int32 k_segments = 12;
     const float32 k_increment = 2.0f * b2_pi / k_segments;
-    float32 theta = 0.0f;
-    glEnable(GL_BLEND);
-    glBlendFunc (GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    glColor4f(0.5f * color.red, 0.5f * color.green, 0.5f * color.blue, 0.15f);
-    glBegin(GL_TRIANGLE_FAN);
+    b2Vec2 vertices[k_segments];
     for (int32 i = 0; i < k_segments; ++i)
     {
-        b2Vec2 v = center + radius * b2Vec2(cosf(theta), sinf(theta));
-        glVertex2f(v.x, v.y);
-        theta += k_increment;
+        const float32 theta = i * k_increment;
+        vertices[i] = center + radius * b2Vec2(cosf(theta), sinf(theta));
     }
-    glEnd();
-    glDisable(GL_BLEND);
 
-    theta = 0.0f;
-    glColor4f(color.red, color.green, color.blue, 1.0f);
-    glBegin(GL_LINE_LOOP);
-    for (int32 i = 0; i < k_segments; ++i)
-    {
-        b2Vec2 v = center + radius * b2Vec2(cosf(theta), sinf(theta));
-        glVertex2f(v.x, v.y);
-        theta += k_increment;
-    }
-    glEnd();
+    DrawSolidPolygon( vertices, k_segments, color );
 
-    b2Vec2 p = center + radius * axis;
-    glBegin(GL_LINES);
-    glVertex2f(center.x, center.y);
-    glVertex2f(p.x, p.y);
-    glEnd();
+    DrawSegment( center, center + radius * axis, color );
 }
     
 //-----------------------------------------------------------------------------
 
 void DebugDraw::DrawSegment( const b2Vec2& p1, const b2Vec2& p2, const ColorF& color )
 {
-    glColor3f(color.red, color.green, color.blue);
-    glBegin(GL_LINES);
-    glVertex2f(p1.x, p1.y);
-    glVertex2f(p2.x, p2.y);
-    glEnd();
+    useDebugState();
+
+    const ColorF lineColor( color.red, color.green, color.blue, 1.0f );
+    pushVertex( mLineVertices, p1, lineColor );
+    pushVertex( mLineVertices, p2, lineColor );
 }
 
 //-----------------------------------------------------------------------------
 
 void DebugDraw::DrawTransform( const b2Transform& xf )
 {
-    b2Vec2 p1 = xf.p, p2;
     const float32 k_axisScale = 0.4f;
-    glBegin(GL_LINES);
-    
-    glColor3f(1.0f, 0.0f, 0.0f);
-    glVertex2f(p1.x, p1.y);
-    p2 = p1 + k_axisScale * xf.q.GetXAxis();
-    glVertex2f(p2.x, p2.y);
+    const b2Vec2 p1 = xf.p;
 
-    glColor3f(0.0f, 1.0f, 0.0f);
-    glVertex2f(p1.x, p1.y);
-    p2 = p1 + k_axisScale * xf.q.GetYAxis();
-    glVertex2f(p2.x, p2.y);
-
-    glEnd();
+    DrawSegment( p1, p1 + k_axisScale * xf.q.GetXAxis(), ColorF(1.0f, 0.0f, 0.0f) );
+    DrawSegment( p1, p1 + k_axisScale * xf.q.GetYAxis(), ColorF(0.0f, 1.0f, 0.0f) );
 }
 
 //-----------------------------------------------------------------------------
 
 void DebugDraw::DrawPoint( const b2Vec2& p, float32 size, const ColorF& color )
 {
-    glPointSize(size);
-    glBegin(GL_POINTS);
-    glColor3f(color.red, color.green, color.blue);
-    glVertex2f(p.x, p.y);
-    glEnd();
-    glPointSize(1.0f);
+    useDebugState();
+
+    pushVertex( mPointVertices, p, ColorF( color.red, color.green, color.blue, 1.0f ) );
+    mPointSizes.push_back( size );
 }
 
+//-----------------------------------------------------------------------------
+
+void DebugDraw::useDebugState( void )
+{
+    SetRenderState( true, GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, -1.0f );
+}
+
+//-----------------------------------------------------------------------------
+
+void DebugDraw::SetRenderState( const bool blendMode, const S32 srcBlendFactor, const S32 dstBlendFactor, const F32 alphaTest )
+{
+    // Ignore no change.
+    if ( blendMode == mBlendMode &&
+        (!blendMode || (srcBlendFactor == mSrcBlendFactor && dstBlendFactor == mDstBlendFactor)) &&
+        mIsEqual( alphaTest, mAlphaTest ) )
+        return;
+
+    // Draw any geometry using the previous state.
+    Flush();
+
+    mBlendMode = blendMode;
+    mSrcBlendFactor = srcBlendFactor;
+    mDstBlendFactor = dstBlendFactor;
+    mAlphaTest = alphaTest;
+}
+
+//-----------------------------------------------------------------------------
+
+void DebugDraw::SubmitTriangles( const U32 vertexCount, const b2Vec2* pVertices, const b2Transform& xf, const ColorF& color )
+{
+    // Sanity!
+    AssertFatal( vertexCount % 3 == 0, "DebugDraw::SubmitTriangles() - Vertex count must be a multiple of three." );
+
+    for ( U32 n = 0; n < vertexCount; ++n )
+        pushVertex( mTriangleVertices, b2Mul( xf, pVertices[n] ), color );
+}
+
+//-----------------------------------------------------------------------------
+
+void DebugDraw::SubmitLines( const U32 vertexCount, const b2Vec2* pVertices, const b2Transform& xf, const ColorF& color )
+{
+    // Sanity!
+    AssertFatal( vertexCount % 2 == 0, "DebugDraw::SubmitLines() - Vertex count must be a multiple of two." );
+
+    for ( U32 n = 0; n < vertexCount; ++n )
+        pushVertex( mLineVertices, b2Mul( xf, pVertices[n] ), color );
+}
+
+//-----------------------------------------------------------------------------
+
+void DebugDraw::Flush( void )
+{
+    // Finish if nothing to draw.
+    if ( mTriangleVertices.size() == 0 && mLineVertices.size() == 0 && mPointVertices.size() == 0 )
+        return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(DebugDraw_Flush);
+
+    // Set the render state.
+    dglDisable( GL_TEXTURE_2D );
+
+    if ( mBlendMode )
+    {
+        dglEnable( GL_BLEND );
+        dglBlendFunc( mSrcBlendFactor, mDstBlendFactor );
+    }
+    else
+    {
+        dglDisable( GL_BLEND );
+    }
+
+    if ( mAlphaTest >= 0.0f )
+    {
+        dglEnable( GL_ALPHA_TEST );
+        dglAlphaFunc( GL_GREATER, mAlphaTest );
+    }
+    else
+    {
+        dglDisable( GL_ALPHA_TEST );
+    }
+
+    dglEnableClientState( GL_VERTEX_ARRAY );
+    dglEnableClientState( GL_COLOR_ARRAY );
+    dglDisableClientState( GL_TEXTURE_COORD_ARRAY );
+
+    // Draw the triangles.
+    if ( mTriangleVertices.size() > 0 )
+    {
+        glVertexPointer( 2, GL_FLOAT, sizeof(DebugVertex), mTriangleVertices[0].mPosition );
+        glColorPointer( 4, GL_UNSIGNED_BYTE, sizeof(DebugVertex), mTriangleVertices[0].mColor );
+        glDrawArrays( GL_TRIANGLES, 0, mTriangleVertices.size() );
+        mTriangleVertices.clear();
+    }
+
+    // Draw the lines.
+    if ( mLineVertices.size() > 0 )
+    {
+        glVertexPointer( 2, GL_FLOAT, sizeof(DebugVertex), mLineVertices[0].mPosition );
+        glColorPointer( 4, GL_UNSIGNED_BYTE, sizeof(DebugVertex), mLineVertices[0].mColor );
+        glDrawArrays( GL_LINES, 0, mLineVertices.size() );
+        mLineVertices.clear();
+    }
+
+    // Draw the points in runs of the same size.
+    if ( mPointVertices.size() > 0 )
+    {
+        glVertexPointer( 2, GL_FLOAT, sizeof(DebugVertex), mPointVertices[0].mPosition );
+        glColorPointer( 4, GL_UNSIGNED_BYTE, sizeof(DebugVertex), mPointVertices[0].mColor );
+
+        const S32 pointCount = mPointVertices.size();
+        S32 runStart = 0;
+        while ( runStart < pointCount )
+        {
+            const F32 pointSize = mPointSizes[runStart];
+            S32 runEnd = runStart + 1;
+            while ( runEnd < pointCount && mIsEqual( mPointSizes[runEnd], pointSize ) )
+                ++runEnd;
+
+            glPointSize( pointSize );
+            glDrawArrays( GL_POINTS, runStart, runEnd - runStart );
+            runStart = runEnd;
+        }
+
+        glPointSize( 1.0f );
+        mPointVertices.clear();
+        mPointSizes.clear();
+    }
+
+    // Restore the client state.
+    // NOTE: The current color is undefined after using a color array.
+    dglDisableClientState( GL_VERTEX_ARRAY );
+    dglDisableClientState( GL_COLOR_ARRAY );
+    glColor4f( 1.0f, 1.0f, 1.0f, 1.0f );
+}
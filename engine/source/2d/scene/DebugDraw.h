@@ -35,14 +35,69 @@
 #include "graphics/color.h"
 #endif
 
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
+/// Draws debug and vector geometry.
+///
+/// All geometry is batched into triangle, line and point buffers which are only drawn when
+/// flushed (at least once per layer) or when the blend state changes.  Within a flush all
+/// triangles are drawn before all lines which are in turn drawn before all points.
 class DebugDraw
 {
+private:
+    struct DebugVertex
+    {
+        F32     mPosition[2];
+        U8      mColor[4];
+    };
+
+    Vector<DebugVertex> mTriangleVertices;
+    Vector<DebugVertex> mLineVertices;
+    Vector<DebugVertex> mPointVertices;
+    Vector<F32>         mPointSizes;
+
+    /// Render state of the pending geometry.
+    bool                mBlendMode;
+    S32                 mSrcBlendFactor;
+    S32                 mDstBlendFactor;
+    F32                 mAlphaTest;
+
+    inline void pushVertex( Vector<DebugVertex>& vertices, const b2Vec2& position, const ColorF& color )
+    {
+        vertices.increment();
+        DebugVertex& vertex = vertices.last();
+        vertex.mPosition[0] = position.x;
+        vertex.mPosition[1] = position.y;
+        const ColorI colorI = color;
+        vertex.mColor[0] = colorI.red;
+        vertex.mColor[1] = colorI.green;
+        vertex.mColor[2] = colorI.blue;
+        vertex.mColor[3] = colorI.alpha;
+    }
+
+    /// Use the debug render state (alpha blended without alpha test).
+    void useDebugState( void );
+
 public:
-    DebugDraw() {}
+    DebugDraw();
     virtual ~DebugDraw() {}
 
+    /// Set the render state for subsequent submissions, flushing if it changes.
+    void SetRenderState( const bool blendMode, const S32 srcBlendFactor, const S32 dstBlendFactor, const F32 alphaTest );
+
+    /// Submit triangles (three vertices each), transforming them from local-space.
+    void SubmitTriangles( const U32 vertexCount, const b2Vec2* pVertices, const b2Transform& xf, const ColorF& color );
+
+    /// Submit lines (two vertices each), transforming them from local-space.
+    void SubmitLines( const U32 vertexCount, const b2Vec2* pVertices, const b2Transform& xf, const ColorF& color );
+
+    /// Draw all the pending geometry.
+    void Flush( void );
+
     void DrawAABB( const b2AABB& aabb, const ColorF& color );
     void DrawOOBB( const b2Vec2* pOOBB, const ColorF& color );
     void DrawAsleep( const b2Vec2* pOOBB, const ColorF& color );
@@ -35,15 +35,113 @@
 #include "platform/platformMemory.h"
 #endif
 
+#ifndef _PLATFORM_STRING_H_
+#include "platform/platformString.h"
+#endif
+
+#ifndef _MMATHFN_H_
+#include "math/mMathFn.h"
+#endif
+
 #ifndef BOX2D_H
 #include "Box2D/Box2D.h"
 #endif
 
 //-----------------------------------------------------------------------------
 
+/// Rolling timings for a single tick phase.
+/// Timings are in milliseconds and percentiles are calculated over the most recent samples only.
+class TickPhaseStats
+{
+public:
+    enum { SampleCount = 128 };
+
+    TickPhaseStats() :
+        budget( 0.0f )
+    {
+        reset();
+    }
+
+    /// Reset the timings (the budget is kept).
+    void reset( void )
+    {
+        dMemset( samples, 0, sizeof(samples) );
+        sampleIndex = 0;
+        sampleTotal = 0;
+        last = 0.0f;
+        max = 0.0f;
+        overBudgetCount = 0;
+    }
+
+    inline void addSample( const F32 milliseconds )
+    {
+        // Add the sample.
+        samples[sampleIndex] = milliseconds;
+        sampleIndex = (sampleIndex + 1) % SampleCount;
+        if ( sampleTotal < SampleCount ) sampleTotal++;
+
+        // Update the ranges.
+        last = milliseconds;
+        if ( milliseconds > max ) max = milliseconds;
+
+        // Update the over-budget count.
+        if ( budget > 0.0f && milliseconds > budget ) overBudgetCount++;
+    }
+
+    /// Calculate the percentile (0 to 100) of the recent samples.
+    F32 getPercentile( const F32 percentile ) const
+    {
+        // Finish if no samples.
+        if ( sampleTotal == 0 )
+            return 0.0f;
+
+        // Sort a copy of the samples.
+        F32 sortedSamples[SampleCount];
+        dMemcpy( sortedSamples, samples, sizeof(F32) * sampleTotal );
+        dQsort( sortedSamples, sampleTotal, sizeof(F32), compareSamples );
+
+        // Fetch the nearest-rank sample.
+        const F32 clampedPercentile = percentile < 0.0f ? 0.0f : percentile > 100.0f ? 100.0f : percentile;
+        const U32 rank = (U32)mCeil( (clampedPercentile / 100.0f) * sampleTotal );
+        return sortedSamples[ rank == 0 ? 0 : rank - 1 ];
+    }
+
+    F32     samples[SampleCount];
+    U32     sampleIndex;
+    U32     sampleTotal;
+    F32     last;
+    F32     max;
+    F32     budget;
+    U32     overBudgetCount;
+
+private:
+    static S32 QSORT_CALLBACK compareSamples( const void* a, const void* b )
+    {
+        const F32 sampleA = *(const F32*)a;
+        const F32 sampleB = *(const F32*)b;
+        return sampleA < sampleB ? -1 : sampleA > sampleB ? 1 : 0;
+    }
+};
+
+//-----------------------------------------------------------------------------
+
 class DebugStats
 {
 public:
+    /// Tick phases.
+    enum TickPhase
+    {
+        TICK_PHASE_INVALID = -1,
+
+        TICK_PHASE_DELETE_REQUESTS,
+        TICK_PHASE_PRE_INTEGRATE,
+        TICK_PHASE_CONTROLLERS,
+        TICK_PHASE_WORLD_STEP,
+        TICK_PHASE_INTEGRATE,
+        TICK_PHASE_CONTACT_DISPATCH,
+
+        TICK_PHASE_COUNT,
+    };
 
     DebugStats()
     {
@@ -68,6 +166,12 @@ public:
         if ( contactCount > maxContactCount ) maxContactCount = contactCount;
         if ( proxyCount > maxProxyCount ) maxProxyCount = proxyCount;
 
+        // Continuous physics.
+        if ( toiSubStepCount > maxTOISubStepCount ) maxTOISubStepCount = toiSubStepCount;
+
+        // World allocator.
+        if ( allocatorReserved > maxAllocatorReserved ) maxAllocatorReserved = allocatorReserved;
+
         // Objects.
         if ( objectsCount > maxObjectsCount ) maxObjectsCount = objectsCount;
         if ( objectsEnabled > maxObjectsEnabled ) maxObjectsEnabled = objectsEnabled;
@@ -144,6 +248,15 @@ public:
         proxyCount = 0;
         maxProxyCount = 0;
 
+        toiSubStepCount = 0;
+        maxTOISubStepCount = 0;
+        toiBudgetExhaustedCount = 0;
+
+        allocatorUsed = 0;
+        allocatorReserved = 0;
+        maxAllocatorReserved = 0;
+        allocatorAllocations = 0;
+
         batchTrianglesSubmitted = 0;
         maxBatchTrianglesSubmitted = 0;
 
@@ -199,6 +312,9 @@ public:
 
         dMemset( &worldProfile, 0, sizeof(worldProfile) );
         dMemset( &maxWorldProfile, 0, sizeof(maxWorldProfile) );
+
+        for ( U32 phase = 0; phase < TICK_PHASE_COUNT; ++phase )
+            tickPhases[phase].reset();
     }
 
     U32     objectsCount;
@@ -234,6 +350,15 @@ public:
     U32     proxyCount;
     U32     maxProxyCount;
 
+    U32     toiSubStepCount;
+    U32     maxTOISubStepCount;
+    U32     toiBudgetExhaustedCount;
+
+    U32     allocatorUsed;
+    U32     allocatorReserved;
+    U32     maxAllocatorReserved;
+    U32     allocatorAllocations;
+
     U32     batchTrianglesSubmitted;
     U32     maxBatchTrianglesSubmitted;
 
@@ -289,6 +414,8 @@ public:
 
     b2Profile worldProfile;
     b2Profile maxWorldProfile;
+
+    TickPhaseStats tickPhases[TICK_PHASE_COUNT];
 };
 
 #endif // _DEBUG_STATS_H_
@@ -1,5603 +1,7537 @@
-//-----------------------------------------------------------------------------
-// Copyright (c) 2013 GarageGames, LLC
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to
-// deal in the Software without restriction, including without limitation the
-// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
-// sell copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in
-// all copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
-// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
-// IN THE SOFTWARE.
-//-----------------------------------------------------------------------------
-
-#ifndef _SCENE_H_
-#include "Scene.h"
-#endif
-
-#ifndef _DGL_H_
-#include "graphics/dgl.h"
-#endif
-
-#ifndef _CONSOLETYPES_H_
-#include "console/consoleTypes.h"
-#endif
-
-#ifndef _BITSTREAM_H_
-#include "io/bitStream.h"
-#endif
-
-#ifndef _SCENE_OBJECT_H_
-#include "2d/sceneobject/SceneObject.h"
-#endif
-
-#ifndef _CONTACT_FILTER_H_
-#include "ContactFilter.h"
-#endif
-
-#ifndef _SCENE_RENDER_OBJECT_H_
-#include "2d/SceneRenderObject.h"
-#endif
-
-#ifndef _SCENE_CONTROLLER_H_
-#include "2d/controllers/core/SceneController.h"
-#endif
-
-#ifndef _PARTICLE_SYSTEM_H_
-#include "2d/core/ParticleSystem.h"
-#endif
-
-// Script bindings.
-#include "Scene_ScriptBinding.h"
-
-// Debug Profiling.
-#include "debug/profiler.h"
-
-//------------------------------------------------------------------------------
-
-SimObjectPtr<Scene> Scene::LoadingScene = NULL;
-
-//------------------------------------------------------------------------------
-
-static ContactFilter mContactFilter;
-
-// Scene counter.
-static U32 sSceneCount = 0;
-static U32 sSceneMasterIndex = 0;
-
-// Joint custom node names.
-static StringTableEntry jointCustomNodeName               = StringTable->insert( "Joints" );
-static StringTableEntry jointCollideConnectedName         = StringTable->insert( "CollideConnected" );
-static StringTableEntry jointLocalAnchorAName             = StringTable->insert( "LocalAnchorA" );
-static StringTableEntry jointLocalAnchorBName             = StringTable->insert( "LocalAnchorB" );
-
-static StringTableEntry jointDistanceNodeName             = StringTable->insert( "Distance" );
-static StringTableEntry jointDistanceLengthName           = StringTable->insert( "Length" );
-static StringTableEntry jointDistanceFrequencyName        = StringTable->insert( "Frequency" );
-static StringTableEntry jointDistanceDampingRatioName     = StringTable->insert( "DampingRatio" );
-
-static StringTableEntry jointRopeNodeName                 = StringTable->insert( "Rope" );
-static StringTableEntry jointRopeMaxLengthName            = StringTable->insert( "MaxLength" );
-
-static StringTableEntry jointRevoluteNodeName             = StringTable->insert( "Revolute" );
-static StringTableEntry jointRevoluteLimitLowerAngleName  = StringTable->insert( "LowerAngle" );
-static StringTableEntry jointRevoluteLimitUpperAngleName  = StringTable->insert( "UpperAngle" );
-static StringTableEntry jointRevoluteMotorSpeedName       = StringTable->insert( "MotorSpeed" );
-static StringTableEntry jointRevoluteMotorMaxTorqueName   = StringTable->insert( "MaxTorque" );
-
-static StringTableEntry jointWeldNodeName                 = StringTable->insert( "Weld" );
-static StringTableEntry jointWeldFrequencyName            = jointDistanceFrequencyName;
-static StringTableEntry jointWeldDampingRatioName         = jointDistanceDampingRatioName;
-
-static StringTableEntry jointWheelNodeName                = StringTable->insert( "Wheel" );
-static StringTableEntry jointWheelWorldAxisName           = StringTable->insert( "WorldAxis" );
-static StringTableEntry jointWheelMotorSpeedName          = StringTable->insert( "MotorSpeed" );
-static StringTableEntry jointWheelMotorMaxTorqueName      = jointRevoluteMotorMaxTorqueName;
-static StringTableEntry jointWheelFrequencyName           = jointDistanceFrequencyName;
-static StringTableEntry jointWheelDampingRatioName        = jointDistanceDampingRatioName;
-
-static StringTableEntry jointFrictionNodeName             = StringTable->insert( "Friction" );
-static StringTableEntry jointFrictionMaxForceName         = StringTable->insert( "MaxForce" );
-static StringTableEntry jointFrictionMaxTorqueName        = jointRevoluteMotorMaxTorqueName;
-
-static StringTableEntry jointPrismaticNodeName            = StringTable->insert( "Prismatic" );
-static StringTableEntry jointPrismaticWorldAxisName       = jointWheelWorldAxisName;
-static StringTableEntry jointPrismaticLimitLowerTransName = StringTable->insert( "LowerTranslation" );
-static StringTableEntry jointPrismaticLimitUpperTransName = StringTable->insert( "UpperTranslation" );
-static StringTableEntry jointPrismaticMotorSpeedName      = jointRevoluteMotorSpeedName;
-static StringTableEntry jointPrismaticMotorMaxForceName   = jointFrictionMaxForceName;
-
-static StringTableEntry jointPulleyNodeName               = StringTable->insert( "Pulley" );
-static StringTableEntry jointPulleyGroundAnchorAName      = StringTable->insert( "GroundAnchorA" );
-static StringTableEntry jointPulleyGroundAnchorBName      = StringTable->insert( "GroundAnchorB" );
-static StringTableEntry jointPulleyLengthAName            = StringTable->insert( "LengthA" );
-static StringTableEntry jointPulleyLengthBName            = StringTable->insert( "LengthB" );
-static StringTableEntry jointPulleyRatioName              = StringTable->insert( "Ratio" );
-
-static StringTableEntry jointTargetNodeName               = StringTable->insert( "Target" );
-static StringTableEntry jointTargetWorldTargetName        = StringTable->insert( "WorldTarget" );
-static StringTableEntry jointTargetMaxForceName           = StringTable->insert( jointFrictionMaxForceName );
-static StringTableEntry jointTargetFrequencyName          = jointDistanceFrequencyName;
-static StringTableEntry jointTargetDampingRatioName       = jointDistanceDampingRatioName;
-
-static StringTableEntry jointMotorNodeName                = StringTable->insert( "Motor" );
-static StringTableEntry jointMotorLinearOffsetName        = StringTable->insert( "LinearOffset" );
-static StringTableEntry jointMotorAngularOffsetName       = StringTable->insert( "AngularOffset" );
-
-static StringTableEntry jointMotorMaxForceName            = jointFrictionMaxForceName;
-static StringTableEntry jointMotorMaxTorqueName           = jointRevoluteMotorMaxTorqueName;
-static StringTableEntry jointMotorCorrectionFactorName    = StringTable->insert( "CorrectionFactor" );
-
-// Controller custom node names.
-static StringTableEntry controllerCustomNodeName          = StringTable->insert( "Controllers" );
-
-// Asset preload custom node names.
-static StringTableEntry assetPreloadNodeName              = StringTable->insert( "AssetPreloads" );
-static StringTableEntry assetNodeName                     = StringTable->insert( "Asset" );
-
-//-----------------------------------------------------------------------------
-
-Scene::Scene() :
-    /// World.
-    mpWorld(NULL),
-    mWorldGravity(0.0f, 0.0f),
-    mVelocityIterations(8),
-    mPositionIterations(3),
-
-    /// Joint access.
-    mJointMasterId(1),
-
-    /// Scene time.
-    mSceneTime(0.0f),
-    mScenePause(false),
-
-    /// Debug and metrics.
-    mDebugMask(0X00000000),
-    mpDebugSceneObject(NULL),
-
-    /// Window rendering.
-    mpCurrentRenderWindow(NULL),
-    
-    /// Miscellaneous.
-    mIsEditorScene(0),
-    mUpdateCallback(false),
-    mRenderCallback(false),
-    mSceneIndex(0)
-{
-    // Set Vector Associations.
-    VECTOR_SET_ASSOCIATION( mSceneObjects );
-    VECTOR_SET_ASSOCIATION( mDeleteRequests );
-    VECTOR_SET_ASSOCIATION( mDeleteRequestsTemp );
-    VECTOR_SET_ASSOCIATION( mEndContacts );
-    VECTOR_SET_ASSOCIATION( mAssetPreloads );
-     
-    // Initialize layer sort mode.
-    for ( U32 n = 0; n < MAX_LAYERS_SUPPORTED; ++n )
-       mLayerSortModes[n] = SceneRenderQueue::RENDER_SORT_NEWEST;
-
-    // Set debug stats for batch renderer.
-    mBatchRenderer.setDebugStats( &mDebugStats );
-
-    // Register the scene controllers set.
-    mControllers = new SimSet();
-    mControllers->registerObject();
-
-    // Assign scene index.    
-    mSceneIndex = ++sSceneMasterIndex;
-    sSceneCount++;
-}
-
-//-----------------------------------------------------------------------------
-
-Scene::~Scene()
-{
-    // Unregister the scene controllers set.
-    if ( mControllers.notNull() )
-        mControllers->deleteObject();
-
-    // Decrease scene count.
-    --sSceneCount;
-}
-
-//-----------------------------------------------------------------------------
-
-bool Scene::onAdd()
-{
-    // Call Parent.
-    if(!Parent::onAdd())
-        return false;
-
-    // Create physics world.
-    mpWorld = new b2World( mWorldGravity );
-
-    // Set contact filter.
-    mpWorld->SetContactFilter( &mContactFilter );
-
-    // Set contact listener.
-    mpWorld->SetContactListener( this );
-
-    // Set destruction listener.
-    mpWorld->SetDestructionListener( this );
-
-    // Create ground body.
-    b2BodyDef groundBodyDef;
-    groundBodyDef.userData = static_cast<PhysicsProxy*>(this);
-    mpGroundBody = mpWorld->CreateBody(&groundBodyDef);
-    mpGroundBody->SetAwake( false );
-
-    // Create world query.
-    mpWorldQuery = new WorldQuery(this);
-
-    // Set loading scene.
-    Scene::LoadingScene = this;
-
-    // Turn-on tick processing.
-    setProcessTicks( true );
-
-    // Return Okay.
-    return true;
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::onRemove()
-{
-    // Turn-off tick processing.
-    setProcessTicks( false );
-
-    // Clear Scene.
-    clearScene();
-
-    // Process Delete Requests.
-    processDeleteRequests(true);
-
-    // Delete ground body.
-    mpWorld->DestroyBody( mpGroundBody );
-    mpGroundBody = NULL;
-
-    // Delete physics world and world query.
-    delete mpWorldQuery;
-    delete mpWorld;
-    mpWorldQuery = NULL;
-    mpWorld = NULL;
-
-    // Detach All Scene Windows.
-    detachAllSceneWindows();
-
-    // Call Parent. Clear scene handles all the object removal, so we can skip
-    // that part and just do the sim-object stuff.
-    SimObject::onRemove();
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::onDeleteNotify( SimObject* object )
-{
-    // Ignore if we're not monitoring a debug banner scene object.
-    if ( mpDebugSceneObject == NULL )
-        return;
-
-    // Ignore if it's not the one we're monitoring.
-    SceneObject* pSceneObject = dynamic_cast<SceneObject*>( object );
-    if ( pSceneObject != mpDebugSceneObject )
-        return;
-
-    // Reset the monitored scene object.
-    mpDebugSceneObject = NULL;
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::initPersistFields()
-{
-    // Call Parent.
-    Parent::initPersistFields();
-
-    // Physics.
-    addProtectedField("Gravity", TypeVector2, Offset(mWorldGravity, Scene), &setGravity, &getGravity, &writeGravity, "" );
-    addField("VelocityIterations", TypeS32, Offset(mVelocityIterations, Scene), &writeVelocityIterations, "" );
-    addField("PositionIterations", TypeS32, Offset(mPositionIterations, Scene), &writePositionIterations, "" );
-
-    // Layer sort modes.
-    char buffer[64];
-    for ( U32 n = 0; n < MAX_LAYERS_SUPPORTED; n++ )
-    {
-       dSprintf( buffer, 64, "layerSortMode%d", n );
-       addField( buffer, TypeEnum, OffsetNonConst(mLayerSortModes[n], Scene), &writeLayerSortMode, 1, &SceneRenderQueue::renderSortTable, "");
-    }
-
-    addProtectedField("Controllers", TypeSimObjectPtr, Offset(mControllers, Scene), &defaultProtectedNotSetFn, &defaultProtectedGetFn, &defaultProtectedNotWriteFn, "The scene controllers to use.");
-    
-    // Callbacks.
-    addField("UpdateCallback", TypeBool, Offset(mUpdateCallback, Scene), &writeUpdateCallback, "");
-    addField("RenderCallback", TypeBool, Offset(mRenderCallback, Scene), &writeRenderCallback, "");
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::BeginContact( b2Contact* pContact )
-{
-    // Ignore contact if it's not a touching contact.
-    if ( !pContact->IsTouching() )
-        return;
-
-    PROFILE_SCOPE(Scene_BeginContact);
-
-    // Fetch fixtures.
-    b2Fixture* pFixtureA = pContact->GetFixtureA();
-    b2Fixture* pFixtureB = pContact->GetFixtureB();
-
-    // Fetch physics proxies.
-    PhysicsProxy* pPhysicsProxyA = static_cast<PhysicsProxy*>(pFixtureA->GetBody()->GetUserData());
-    PhysicsProxy* pPhysicsProxyB = static_cast<PhysicsProxy*>(pFixtureB->GetBody()->GetUserData());
-
-    // Ignore stuff that's not a scene object.
-    if (    pPhysicsProxyA->getPhysicsProxyType() != PhysicsProxy::PHYSIC_PROXY_SCENEOBJECT ||
-            pPhysicsProxyB->getPhysicsProxyType() != PhysicsProxy::PHYSIC_PROXY_SCENEOBJECT )
-    {
-            return;
-    }
-
-    // Fetch scene objects.
-    SceneObject* pSceneObjectA = static_cast<SceneObject*>(pPhysicsProxyA);
-    SceneObject* pSceneObjectB = static_cast<SceneObject*>(pPhysicsProxyB);
-
-    // Initialize the contact.
-    TickContact tickContact;
-    tickContact.initialize( pContact, pSceneObjectA, pSceneObjectB, pFixtureA, pFixtureB );
-
-    // Add contact.
-    mBeginContacts.insert( pContact, tickContact );
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::EndContact( b2Contact* pContact )
-{
-    PROFILE_SCOPE(Scene_EndContact);
-
-    // Fetch fixtures.
-    b2Fixture* pFixtureA = pContact->GetFixtureA();
-    b2Fixture* pFixtureB = pContact->GetFixtureB();
-
-    // Fetch physics proxies.
-    PhysicsProxy* pPhysicsProxyA = static_cast<PhysicsProxy*>(pFixtureA->GetBody()->GetUserData());
-    PhysicsProxy* pPhysicsProxyB = static_cast<PhysicsProxy*>(pFixtureB->GetBody()->GetUserData());
-
-    // Ignore stuff that's not a scene object.
-    if (    pPhysicsProxyA->getPhysicsProxyType() != PhysicsProxy::PHYSIC_PROXY_SCENEOBJECT ||
-            pPhysicsProxyB->getPhysicsProxyType() != PhysicsProxy::PHYSIC_PROXY_SCENEOBJECT )
-    {
-            return;
-    }
-
-    // Fetch scene objects.
-    SceneObject* pSceneObjectA = static_cast<SceneObject*>(pPhysicsProxyA);
-    SceneObject* pSceneObjectB = static_cast<SceneObject*>(pPhysicsProxyB);
-
-    // Initialize the contact.
-    TickContact tickContact;
-    tickContact.initialize( pContact, pSceneObjectA, pSceneObjectB, pFixtureA, pFixtureB );
-
-    // Add contact.
-    mEndContacts.push_back( tickContact );
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::PostSolve( b2Contact* pContact, const b2ContactImpulse* pImpulse )
-{
-    // Find contact mapping.
-    typeContactHash::iterator contactItr = mBeginContacts.find( pContact );
-
-    // Finish if we didn't find the contact.
-    if ( contactItr == mBeginContacts.end() )
-        return;
-
-    // Fetch contact.
-    TickContact& tickContact = contactItr->value;
-
-    // Add the impulse.
-    for ( U32 index = 0; index < b2_maxManifoldPoints; ++index )
-    {
-        tickContact.mNormalImpulses[index] += pImpulse->normalImpulses[index];
-        tickContact.mTangentImpulses[index] += pImpulse->tangentImpulses[index];
-    }
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::forwardContacts( void )
-{
-    // Debug Profiling.
-    PROFILE_SCOPE(Scene_ForwardContacts);
-
-    // Iterate end contacts.
-    for( typeContactVector::iterator contactItr = mEndContacts.begin(); contactItr != mEndContacts.end(); ++contactItr )
-    {
-        // Fetch tick contact.
-        TickContact& tickContact = *contactItr;
-
-        // Inform the scene objects.
-        tickContact.mpSceneObjectA->onEndCollision( tickContact );
-        tickContact.mpSceneObjectB->onEndCollision( tickContact );
-    }
-
-    // Iterate begin contacts.
-    for( typeContactHash::iterator contactItr = mBeginContacts.begin(); contactItr != mBeginContacts.end(); ++contactItr )
-    {
-        // Fetch tick contact.
-        TickContact& tickContact = contactItr->value;
-
-        // Inform the scene objects.
-        tickContact.mpSceneObjectA->onBeginCollision( tickContact );
-        tickContact.mpSceneObjectB->onBeginCollision( tickContact );
-    }
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::dispatchBeginContactCallbacks( void )
-{
-    // Debug Profiling.
-    PROFILE_SCOPE(Scene_DispatchBeginContactCallbacks);
-
-    // Sanity!
-    AssertFatal( b2_maxManifoldPoints == 2, "Scene::dispatchBeginContactCallbacks() - Invalid assumption about max manifold points." );
-
-    // Fetch contact count.
-    const U32 contactCount = mBeginContacts.size();
-
-    // Finish if no contacts.
-    if ( contactCount == 0 )
-        return;
-
-    // Iterate all contacts.
-    for ( typeContactHash::iterator contactItr = mBeginContacts.begin(); contactItr != mBeginContacts.end(); ++contactItr )
-    {
-        // Fetch contact.
-        const TickContact& tickContact = contactItr->value;
-
-        // Fetch scene objects.
-        SceneObject* pSceneObjectA = tickContact.mpSceneObjectA;
-        SceneObject* pSceneObjectB = tickContact.mpSceneObjectB;
-
-        // Skip if either object is being deleted.
-        if ( pSceneObjectA->isBeingDeleted() || pSceneObjectB->isBeingDeleted() )
-            continue;
-
-        // Skip if both objects don't have collision callback active.
-        if ( !pSceneObjectA->getCollisionCallback() && !pSceneObjectB->getCollisionCallback() )
-            continue;
-
-        // Fetch normal and contact points.
-        const U32& pointCount = tickContact.mPointCount;
-        const b2Vec2& normal = tickContact.mWorldManifold.normal;
-        const b2Vec2& point1 = tickContact.mWorldManifold.points[0];
-        const b2Vec2& point2 = tickContact.mWorldManifold.points[1];
-        const S32 shapeIndexA = pSceneObjectA->getCollisionShapeIndex( tickContact.mpFixtureA );
-        const S32 shapeIndexB = pSceneObjectB->getCollisionShapeIndex( tickContact.mpFixtureB );
-
-        // Sanity!
-        AssertFatal( shapeIndexA >= 0, "Scene::dispatchBeginContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
-        AssertFatal( shapeIndexB >= 0, "Scene::dispatchBeginContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
-
-        // Fetch collision impulse information
-        const F32 normalImpulse1 = tickContact.mNormalImpulses[0];
-        const F32 normalImpulse2 = tickContact.mNormalImpulses[1];
-        const F32 tangentImpulse1 = tickContact.mTangentImpulses[0];
-        const F32 tangentImpulse2 = tickContact.mTangentImpulses[1];
-
-        // Format objects.
-        char sceneObjectABuffer[16];
-        char sceneObjectBBuffer[16];
-        dSprintf( sceneObjectABuffer, sizeof(sceneObjectABuffer), "%d", pSceneObjectA->getId() );
-        dSprintf( sceneObjectBBuffer, sizeof(sceneObjectBBuffer), "%d", pSceneObjectB->getId() );
-
-        // Format miscellaneous information.
-        char miscInfoBuffer[128];
-        if ( pointCount == 2 )
-        {
-            dSprintf(miscInfoBuffer, sizeof(miscInfoBuffer),
-                "%d %d %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f",
-                shapeIndexA, shapeIndexB,
-                normal.x, normal.y,
-                point1.x, point1.y,
-                normalImpulse1,
-                tangentImpulse1,
-                point2.x, point2.y,
-                normalImpulse2,
-                tangentImpulse2 );
-        }
-        else if ( pointCount == 1 )
-        {
-            dSprintf(miscInfoBuffer, sizeof(miscInfoBuffer),
-                "%d %d %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f",
-                shapeIndexA, shapeIndexB,
-                normal.x, normal.y,
-                point1.x, point1.y,
-                normalImpulse1,
-                tangentImpulse1 );
-        }
-        else
-        {
-            dSprintf(miscInfoBuffer, sizeof(miscInfoBuffer),
-                "%d %d",
-                shapeIndexA, shapeIndexB );
-        }
-
-        // Does the scene handle the collision callback?
-        Namespace* pNamespace = getNamespace();
-        if ( pNamespace != NULL && pNamespace->lookup( StringTable->insert( "onSceneCollision" ) ) != NULL )
-        {
-            // Yes, so perform script callback on the Scene.
-            Con::executef( this, 4, "onSceneCollision",
-                sceneObjectABuffer,
-                sceneObjectBBuffer,
-                miscInfoBuffer );
-        }
-        else
-        {
-            // No, so call it on its behaviors.
-            const char* args[5] = { "onSceneCollision", "", sceneObjectABuffer, sceneObjectBBuffer, miscInfoBuffer };
-            callOnBehaviors( 5, args );
-        }
-
-        // Is object A allowed to collide with object B?
-        if (    (pSceneObjectA->mCollisionGroupMask & pSceneObjectB->mSceneGroupMask) != 0 &&
-                (pSceneObjectA->mCollisionLayerMask & pSceneObjectB->mSceneLayerMask) != 0 )
-        {
-            // Yes, so does it handle the collision callback?
-            if ( pSceneObjectA->isMethod("onCollision") )            
-            {
-                // Yes, so perform the script callback on it.
-                Con::executef( pSceneObjectA, 3, "onCollision",
-                    sceneObjectBBuffer,
-                    miscInfoBuffer );
-            }
-            else
-            {
-                // No, so call it on its behaviors.
-                const char* args[4] = { "onCollision", "", sceneObjectBBuffer, miscInfoBuffer };
-                pSceneObjectA->callOnBehaviors( 4, args );
-            }
-        }
-
-        // Is object B allowed to collide with object A?
-        if (    (pSceneObjectB->mCollisionGroupMask & pSceneObjectA->mSceneGroupMask) != 0 &&
-                (pSceneObjectB->mCollisionLayerMask & pSceneObjectA->mSceneLayerMask) != 0 )
-        {
-            // Yes, so does it handle the collision callback?
-            if ( pSceneObjectB->isMethod("onCollision") )            
-            {
-                // Yes, so perform the script callback on it.
-                Con::executef( pSceneObjectB, 3, "onCollision",
-                    sceneObjectABuffer,
-                    miscInfoBuffer );
-            }
-            else
-            {
-                // No, so call it on its behaviors.
-                const char* args[4] = { "onCollision", "", sceneObjectABuffer, miscInfoBuffer };
-                pSceneObjectB->callOnBehaviors( 4, args );
-            }
-        }
-    }
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::dispatchEndContactCallbacks( void )
-{
-    // Debug Profiling.
-    PROFILE_SCOPE(Scene_DispatchEndContactCallbacks);
-
-    // Sanity!
-    AssertFatal( b2_maxManifoldPoints == 2, "Scene::dispatchEndContactCallbacks() - Invalid assumption about max manifold points." );
-
-    // Fetch contact count.
-    const U32 contactCount = mEndContacts.size();
-
-    // Finish if no contacts.
-    if ( contactCount == 0 )
-        return;
-
-    // Iterate all contacts.
-    for ( typeContactVector::iterator contactItr = mEndContacts.begin(); contactItr != mEndContacts.end(); ++contactItr )
-    {
-        // Fetch contact.
-        const TickContact& tickContact = *contactItr;
-
-        // Fetch scene objects.
-        SceneObject* pSceneObjectA = tickContact.mpSceneObjectA;
-        SceneObject* pSceneObjectB = tickContact.mpSceneObjectB;
-
-        // Skip if either object is being deleted.
-        if ( pSceneObjectA->isBeingDeleted() || pSceneObjectB->isBeingDeleted() )
-            continue;
-
-        // Skip if both objects don't have collision callback active.
-        if ( !pSceneObjectA->getCollisionCallback() && !pSceneObjectB->getCollisionCallback() )
-            continue;
-
-        // Fetch shape index.
-        const S32 shapeIndexA = pSceneObjectA->getCollisionShapeIndex( tickContact.mpFixtureA );
-        const S32 shapeIndexB = pSceneObjectB->getCollisionShapeIndex( tickContact.mpFixtureB );
-
-        // Sanity!
-        AssertFatal( shapeIndexA >= 0, "Scene::dispatchEndContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
-        AssertFatal( shapeIndexB >= 0, "Scene::dispatchEndContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
-
-        // Format objects.
-        char sceneObjectABuffer[16];
-        char sceneObjectBBuffer[16];
-        dSprintf( sceneObjectABuffer, sizeof(sceneObjectABuffer), "%d", pSceneObjectA->getId() );
-        dSprintf( sceneObjectBBuffer, sizeof(sceneObjectBBuffer), "%d", pSceneObjectB->getId() );
-
-        // Format miscellaneous information.
-        char miscInfoBuffer[32];
-        dSprintf(miscInfoBuffer, sizeof(miscInfoBuffer), "%d %d", shapeIndexA, shapeIndexB );
-
-        // Does the scene handle the collision callback?
-        Namespace* pNamespace = getNamespace();
-        if ( pNamespace != NULL && pNamespace->lookup( StringTable->insert( "onSceneEndCollision" ) ) != NULL )
-        {
-            // Yes, so does the scene handle the collision callback?
-            Con::executef( this, 4, "onSceneEndCollision",
-                sceneObjectABuffer,
-                sceneObjectBBuffer,
-                miscInfoBuffer );
-        }
-        else
-        {
-            // No, so call it on its behaviors.
-            const char* args[5] = { "onSceneEndCollision", "", sceneObjectABuffer, sceneObjectBBuffer, miscInfoBuffer };
-            callOnBehaviors( 5, args );
-        }
-
-        // Is object A allowed to collide with object B?
-        if (    (pSceneObjectA->mCollisionGroupMask & pSceneObjectB->mSceneGroupMask) != 0 &&
-                (pSceneObjectA->mCollisionLayerMask & pSceneObjectB->mSceneLayerMask) != 0 )
-        {
-            // Yes, so does it handle the collision callback?
-            if ( pSceneObjectA->isMethod("onEndCollision") )            
-            {
-                // Yes, so perform the script callback on it.
-                Con::executef( pSceneObjectA, 3, "onEndCollision",
-                    sceneObjectBBuffer,
-                    miscInfoBuffer );
-            }
-            else
-            {
-                // No, so call it on its behaviors.
-                const char* args[4] = { "onEndCollision", "", sceneObjectBBuffer, miscInfoBuffer };
-                pSceneObjectA->callOnBehaviors( 4, args );
-            }
-        }
-
-        // Is object B allowed to collide with object A?
-        if (    (pSceneObjectB->mCollisionGroupMask & pSceneObjectA->mSceneGroupMask) != 0 &&
-                (pSceneObjectB->mCollisionLayerMask & pSceneObjectA->mSceneLayerMask) != 0 )
-        {
-            // Yes, so does it handle the collision callback?
-            if ( pSceneObjectB->isMethod("onEndCollision") )            
-            {
-                // Yes, so perform the script callback on it.
-                Con::executef( pSceneObjectB, 3, "onEndCollision",
-                    sceneObjectABuffer,
-                    miscInfoBuffer );
-            }
-            else
-            {
-                // No, so call it on its behaviors.
-                const char* args[4] = { "onEndCollision", "", sceneObjectABuffer, miscInfoBuffer };
-                pSceneObjectB->callOnBehaviors( 4, args );
-            }
-        }
-    }
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::processTick( void )
-{
-    // Debug Profiling.
-    PROFILE_SCOPE(Scene_ProcessTick);
-
-    // Finish if the Scene is not added to the simulation.
-    if ( !isProperlyAdded() )
-        return;
-
-    // Process Delete Requests.
-    processDeleteRequests(false);
-
-    // Update debug stats.
-    mDebugStats.fps           = Con::getFloatVariable("fps::framePeriod", 0.0f);
-    mDebugStats.frameCount    = (U32)Con::getIntVariable("fps::frameCount", 0);
-    mDebugStats.bodyCount     = (U32)mpWorld->GetBodyCount();
-    mDebugStats.jointCount    = (U32)mpWorld->GetJointCount();
-    mDebugStats.contactCount  = (U32)mpWorld->GetContactCount();
-    mDebugStats.proxyCount    = (U32)mpWorld->GetProxyCount();
-    mDebugStats.objectsCount  = (U32)mSceneObjects.size();
-    mDebugStats.worldProfile  = mpWorld->GetProfile();
-
-    // Set particle stats.
-    mDebugStats.particlesAlloc = ParticleSystem::Instance->getAllocatedParticleCount();
-    mDebugStats.particlesUsed = ParticleSystem::Instance->getActiveParticleCount();
-    mDebugStats.particlesFree = mDebugStats.particlesAlloc - mDebugStats.particlesUsed;
-
-    // Finish if scene is paused.
-    if ( !getScenePause() )
-    {
-        // Reset object stats.
-        U32 objectsEnabled = 0;
-        U32 objectsVisible = 0;
-        U32 objectsAwake   = 0;
-
-        // Fetch if a "normal" i.e. non-editor scene.
-        const bool isNormalScene = !getIsEditorScene();
-
-        // Update scene time.
-        mSceneTime += Tickable::smTickSec;
-
-        // Clear ticked scene objects.
-        mTickedSceneObjects.clear();
-
-        // Iterate scene objects.
-        for( S32 n = 0; n < mSceneObjects.size(); ++n )
-        {
-            // Fetch scene object.
-            SceneObject* pSceneObject = mSceneObjects[n];
-
-            // Update awake/asleep counts.
-            if ( pSceneObject->getAwake() )
-                objectsAwake++;
-
-            // Update visible.
-            if ( pSceneObject->getVisible() )
-                objectsVisible++;
-
-            // Push scene object if it's eligible for ticking.
-            if ( pSceneObject->isEnabled() )
-            {
-                // Update enabled.
-                objectsEnabled++;
-
-                // Add to ticked objects if object is not being deleted and this is a "normal" scene or
-                // the object is marked as allowing editor ticks.
-                if ( !pSceneObject->isBeingDeleted() && (isNormalScene || pSceneObject->getIsEditorTickAllowed() )  )
-                    mTickedSceneObjects.push_back( pSceneObject );
-            }
-        }
-
-        // Update object stats.
-        mDebugStats.objectsEnabled = objectsEnabled;
-        mDebugStats.objectsVisible = objectsVisible;
-        mDebugStats.objectsAwake   = objectsAwake;
-
-        // Debug Status Reference.
-        DebugStats* pDebugStats = &mDebugStats;
-
-        // Fetch ticked scene object count.
-        const S32 tickedSceneObjectCount = mTickedSceneObjects.size();
-
-        // ****************************************************
-        // Pre-integrate objects.
-        // ****************************************************
-
-        // Iterate ticked scene objects.
-        for ( S32 i = 0; i < tickedSceneObjectCount; ++i )
-        {
-            // Debug Profiling.
-            PROFILE_SCOPE(Scene_PreIntegrate);
-
-            // Pre-integrate.
-            mTickedSceneObjects[i]->preIntegrate( mSceneTime, Tickable::smTickSec, pDebugStats );
-        }
-
-        // ****************************************************
-        // Integrate controllers.
-        // ****************************************************
-
-        // Fetch the controller set.
-        SimSet* pControllerSet = getControllers();
-
-        // Do we have any scene controllers?
-        if ( pControllerSet != NULL )
-        {
-            // Debug Profiling.
-            PROFILE_SCOPE(Scene_IntegrateSceneControllers);
-
-            // Yes, so fetch scene controller count.
-            const S32 sceneControllerCount = (S32)pControllerSet->size();
-
-            // Iterate scene controllers.
-            for( S32 i = 0; i < sceneControllerCount; i++ )
-            {
-                // Fetch the scene controller.
-                SceneController* pController = dynamic_cast<SceneController*>((*pControllerSet)[i]);
-
-                // Skip if not a controller.
-                if ( pController == NULL )
-                    continue;
-
-                // Integrate.
-                pController->integrate( this, mSceneTime, Tickable::smTickSec, pDebugStats );
-            }
-        }
-
-        // Debug Profiling.
-        PROFILE_START(Scene_IntegratePhysicsSystem);
-
-        // Reset contacts.
-        mBeginContacts.clear();
-        mEndContacts.clear();
-
-        // Only step the physics if a "normal" scene.
-        if ( isNormalScene )
-        {
-            // Step the physics.
-            mpWorld->Step( Tickable::smTickSec, mVelocityIterations, mPositionIterations );
-        }
-
-        // Debug Profiling.
-        PROFILE_END();   // Scene_IntegratePhysicsSystem
-
-        // Forward the contacts.
-        forwardContacts();
-
-        // ****************************************************
-        // Integrate objects.
-        // ****************************************************
-
-        // Iterate ticked scene objects.
-        for ( S32 i = 0; i < tickedSceneObjectCount; ++i )
-        {
-            // Debug Profiling.
-            PROFILE_SCOPE(Scene_IntegrateObject);
-
-            // Integrate.
-            mTickedSceneObjects[i]->integrateObject( mSceneTime, Tickable::smTickSec, pDebugStats );
-        }
-
-        // ****************************************************
-        // Post-Integrate Stage.
-        // ****************************************************
-
-        // Iterate ticked scene objects.
-        for ( S32 i = 0; i < tickedSceneObjectCount; ++i )
-        {
-            // Debug Profiling.
-            PROFILE_SCOPE(Scene_PostIntegrate);
-
-            // Post-integrate.
-            mTickedSceneObjects[i]->postIntegrate( mSceneTime, Tickable::smTickSec, pDebugStats );
-        }
-
-        // Scene update callback.
-        if( mUpdateCallback )
-        {
-            // Debug Profiling.
-            PROFILE_SCOPE(Scene_OnSceneUpdatetCallback);
-
-            Con::executef( this, 1, "onSceneUpdate" );
-        }
-
-        // Only dispatch contacts if a "normal" scene.
-        if ( isNormalScene )
-        {
-            // Dispatch contacts callbacks.
-            dispatchEndContactCallbacks();
-            dispatchBeginContactCallbacks();
-        }
-
-        // Clear ticked scene objects.
-        mTickedSceneObjects.clear();
-    }
-
-    // Update debug stat ranges.
-    mDebugStats.updateRanges();
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::interpolateTick( F32 timeDelta )
-{
-    // Finish if scene is paused.
-    if ( getScenePause() ) return;
-
-    // Debug Profiling.
-    PROFILE_SCOPE(Scene_InterpolateTick);
-
-    // ****************************************************
-    // Interpolate scene objects.
-    // ****************************************************
-
-    // Fetch the scene object count.
-    const S32 sceneObjectCount = mSceneObjects.size();
-
-    // Iterate scene objects.
-    for( S32 n = 0; n < sceneObjectCount; ++n )
-    {
-        // Fetch scene object.
-        SceneObject* pSceneObject = mSceneObjects[n];
-
-        // Skip interpolation of scene object if it's not eligible.
-        if ( !pSceneObject->isEnabled() || pSceneObject->isBeingDeleted() )
-            continue;
-
-        pSceneObject->interpolateObject( timeDelta );
-    }
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
-{
-    // Debug Profiling.
-    PROFILE_SCOPE(Scene_RenderSceneTotal);
-
-    // Fetch debug stats.
-    DebugStats* pDebugStats = pSceneRenderState->mpDebugStats;
-
-    // Reset Render Stats.
-    pDebugStats->renderPicked                   = 0;
-    pDebugStats->renderRequests                 = 0;
-    pDebugStats->renderFallbacks                = 0;
-    pDebugStats->batchTrianglesSubmitted        = 0;
-    pDebugStats->batchDrawCallsStrict           = 0;
-    pDebugStats->batchDrawCallsSorted           = 0;
-    pDebugStats->batchFlushes                   = 0;
-    pDebugStats->batchBlendStateFlush           = 0;
-    pDebugStats->batchColorStateFlush           = 0;
-    pDebugStats->batchAlphaStateFlush           = 0;
-    pDebugStats->batchTextureChangeFlush        = 0;
-    pDebugStats->batchBufferFullFlush           = 0;
-    pDebugStats->batchIsolatedFlush             = 0;
-    pDebugStats->batchLayerFlush                = 0;
-    pDebugStats->batchNoBatchFlush              = 0;
-    pDebugStats->batchAnonymousFlush            = 0;
-
-    // Set batch renderer wireframe mode.
-    mBatchRenderer.setWireframeMode( getDebugMask() & SCENE_DEBUG_WIREFRAME_RENDER );
-
-    // Debug Profiling.
-    PROFILE_START(Scene_RenderSceneVisibleQuery);
-
-    // Rotate the render AABB by the camera angle.
-    b2AABB cameraAABB;
-    CoreMath::mRotateAABB( pSceneRenderState->mRenderAABB, pSceneRenderState->mRenderAngle, cameraAABB );
-
-    // Rotate the world matrix by the camera angle.
-    const Vector2& cameraPosition = pSceneRenderState->mRenderPosition;
-    glTranslatef( cameraPosition.x, cameraPosition.y, 0.0f );
-    glRotatef( mRadToDeg(pSceneRenderState->mRenderAngle), 0.0f, 0.0f, 1.0f );
-    glTranslatef( -cameraPosition.x, -cameraPosition.y, 0.0f );
-
-    // Clear world query.
-    mpWorldQuery->clearQuery();
-
-    // Set filter.
-    WorldQueryFilter queryFilter( pSceneRenderState->mRenderLayerMask, pSceneRenderState->mRenderGroupMask, true, true, false, false );
-    mpWorldQuery->setQueryFilter( queryFilter );
-
-    // Query render AABB.
-    mpWorldQuery->aabbQueryAABB( cameraAABB );
-
-    // Debug Profiling.
-    PROFILE_END();  //Scene_RenderSceneVisibleQuery
-
-    // Are there any query results?
-    if ( mpWorldQuery->getQueryResultsCount() > 0 )
-    {
-        // Debug Profiling.
-        PROFILE_SCOPE(Scene_RenderSceneCompileRenderRequests);
-
-        // Fetch the primary scene render queue.
-        SceneRenderQueue* pSceneRenderQueue = SceneRenderQueueFactory.createObject();      
-
-        // Yes so step through layers.
-        for ( S32 layer = MAX_LAYERS_SUPPORTED-1; layer >= 0 ; layer-- )
-        {
-            // Fetch layer.
-            typeWorldQueryResultVector& layerResults = mpWorldQuery->getLayeredQueryResults( layer );
-
-            // Fetch layer object count.
-            const U32 layerObjectCount = layerResults.size();
-
-            // Are there any objects to render in this layer?
-            if ( layerObjectCount > 0 )
-            {
-                // Yes, so increase render picked.
-                pDebugStats->renderPicked += layerObjectCount;
-
-                // Iterate query results.
-                for( typeWorldQueryResultVector::iterator worldQueryItr = layerResults.begin(); worldQueryItr != layerResults.end(); ++worldQueryItr )
-                {
-                    // Fetch scene object.
-                    SceneObject* pSceneObject = worldQueryItr->mpSceneObject;
-
-                    // Skip if the object should not render.
-                    if ( !pSceneObject->shouldRender() )
-                        continue;
-
-                    // Can the scene object prepare a render?
-                    if ( pSceneObject->canPrepareRender() )
-                    {
-                        // Yes. so is it batch isolated.
-                        if ( pSceneObject->getBatchIsolated() )
-                        {
-                            // Yes, so create a default render request  on the primary queue.
-                            SceneRenderRequest* pIsolatedSceneRenderRequest = Scene::createDefaultRenderRequest( pSceneRenderQueue, pSceneObject );
-
-                            // Create a new isolated render queue.
-                            pIsolatedSceneRenderRequest->mpIsolatedRenderQueue = SceneRenderQueueFactory.createObject();
-
-                            // Prepare in the isolated queue.
-                            pSceneObject->scenePrepareRender( pSceneRenderState, pIsolatedSceneRenderRequest->mpIsolatedRenderQueue );
-
-                            // Increase render request count.
-                            pDebugStats->renderRequests += (U32)pIsolatedSceneRenderRequest->mpIsolatedRenderQueue->getRenderRequests().size();
-
-                            // Adjust for the extra private render request.
-                            pDebugStats->renderRequests -= 1;
-                        }
-                        else
-                        {
-                            // No, so prepare in primary queue.
-                            pSceneObject->scenePrepareRender( pSceneRenderState, pSceneRenderQueue );
-                        }
-                    }
-                    else
-                    {
-                        // No, so create a default render request for it.
-                        Scene::createDefaultRenderRequest( pSceneRenderQueue, pSceneObject );
-                    }
-                }
-
-                // Fetch render requests.
-                SceneRenderQueue::typeRenderRequestVector& sceneRenderRequests = pSceneRenderQueue->getRenderRequests();
-
-                // Fetch render request count.
-                const U32 renderRequestCount = (U32)sceneRenderRequests.size();
-
-                // Increase render request count.
-                pDebugStats->renderRequests += renderRequestCount;
-
-                // Do we have more than a single render request?
-                if ( renderRequestCount > 1 )
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(Scene_RenderSceneLayerSorting);
-
-                    // Yes, so fetch layer sort mode.
-                    SceneRenderQueue::RenderSort& mode = mLayerSortModes[layer];
-
-                    // Temporarily switch to normal sort if batch sort but batcher disabled.
-                    if ( !mBatchRenderer.getBatchEnabled() && mode == SceneRenderQueue::RENDER_SORT_BATCH )
-                        mode = SceneRenderQueue::RENDER_SORT_NEWEST;
-
-                    // Set render queue mode.
-                    pSceneRenderQueue->setSortMode( mode );
-
-                    // Sort the render requests.
-                    pSceneRenderQueue->sort();
-                }
-
-                // Iterate render requests.
-                for( SceneRenderQueue::typeRenderRequestVector::iterator renderRequestItr = sceneRenderRequests.begin(); renderRequestItr != sceneRenderRequests.end(); ++renderRequestItr )
-                {
-                     // Debug Profiling.
-                    PROFILE_SCOPE(Scene_RenderSceneRequests);
-
-                    // Fetch render request.
-                    SceneRenderRequest* pSceneRenderRequest = *renderRequestItr;
-
-                    // Fetch scene render object.
-                    SceneRenderObject* pSceneRenderObject = pSceneRenderRequest->mpSceneRenderObject;
-             
-                    // Flush if the object is not render batched and we're in strict order mode.
-                    if ( !pSceneRenderObject->isBatchRendered() && mBatchRenderer.getStrictOrderMode() )
-                    {
-                        mBatchRenderer.flush( pDebugStats->batchNoBatchFlush );
-                    }
-                    // Flush if the object is batch isolated.
-                    else if ( pSceneRenderObject->getBatchIsolated() )
-                    {
-                        mBatchRenderer.flush( pDebugStats->batchIsolatedFlush );
-                    }
-
-                    // Yes, so is the object batch rendered?
-                    if ( pSceneRenderObject->isBatchRendered() )
-                    {
-                        // Yes, so set the blend mode.
-                        mBatchRenderer.setBlendMode( pSceneRenderRequest );
-
-                        // Set the alpha test mode.
-                        mBatchRenderer.setAlphaTestMode( pSceneRenderRequest );
-                    }
-
-                    // Set batch strict order mode.
-                    // NOTE:    We keep reasserting this because an object is free to change it during rendering.
-                    mBatchRenderer.setStrictOrderMode( pSceneRenderQueue->getStrictOrderMode() );
-
-                    // Is the object batch isolated?
-                    if ( pSceneRenderObject->getBatchIsolated() )
-                    {
-                        // Yes, so fetch isolated render queue.
-                        SceneRenderQueue* pIsolatedRenderQueue = pSceneRenderRequest->mpIsolatedRenderQueue;
-
-                        // Sanity!
-                        AssertFatal( pIsolatedRenderQueue != NULL, "Cannot render batch isolated with an isolated render queue." );
-
-                        // Sort the isolated render requests.
-                        pIsolatedRenderQueue->sort();
-
-                        // Fetch isolated render requests.
-                        SceneRenderQueue::typeRenderRequestVector& isolatedRenderRequests = pIsolatedRenderQueue->getRenderRequests();
-
-                        // Can the object render?
-                        if ( pSceneRenderObject->validRender() )
-                        {
-                            // Yes, so iterate isolated render requests.
-                            for( SceneRenderQueue::typeRenderRequestVector::iterator isolatedRenderRequestItr = isolatedRenderRequests.begin(); isolatedRenderRequestItr != isolatedRenderRequests.end(); ++isolatedRenderRequestItr )
-                            {
-                                pSceneRenderObject->sceneRender( pSceneRenderState, *isolatedRenderRequestItr, &mBatchRenderer );
-                            }
-                        }
-                        else
-                        {
-                            // No, so iterate isolated render requests.
-                            for( SceneRenderQueue::typeRenderRequestVector::iterator isolatedRenderRequestItr = isolatedRenderRequests.begin(); isolatedRenderRequestItr != isolatedRenderRequests.end(); ++isolatedRenderRequestItr )
-                            {
-                                pSceneRenderObject->sceneRenderFallback( pSceneRenderState, *isolatedRenderRequestItr, &mBatchRenderer );
-                            }
-
-                            // Increase render fallbacks.
-                            pDebugStats->renderFallbacks++;
-                        }
-
-                        // Flush isolated batch.
-                        mBatchRenderer.flush( pDebugStats->batchIsolatedFlush );
-                    }
-                    else
-                    {
-                        // No, so can the object render?
-                        if ( pSceneRenderObject->validRender() )
-                        {
-                            // Yes, so render object.
-                            pSceneRenderObject->sceneRender( pSceneRenderState, pSceneRenderRequest, &mBatchRenderer );
-                        }
-                        else
-                        {
-                            // No, so render using fallback.
-                            pSceneRenderObject->sceneRenderFallback( pSceneRenderState, pSceneRenderRequest, &mBatchRenderer );
-
-                            // Increase render fallbacks.
-                            pDebugStats->renderFallbacks++;
-                        }
-                    }
-                }
-
-                // Flush.
-                // NOTE:    We cannot batch between layers as we adhere to a strict layer render order.
-                mBatchRenderer.flush( pDebugStats->batchLayerFlush );
-
-                // Iterate query results.
-                for( typeWorldQueryResultVector::iterator worldQueryItr = layerResults.begin(); worldQueryItr != layerResults.end(); ++worldQueryItr )
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(Scene_RenderObjectOverlays);
-
-                    // Fetch scene object.
-                    SceneObject* pSceneObject = worldQueryItr->mpSceneObject;
-
-                    // Render object overlay.
-                    pSceneObject->sceneRenderOverlay( pSceneRenderState );
-                }
-            }
-
-            // Reset render queue.
-            pSceneRenderQueue->resetState();
-        }
-
-        // Cache render queue..
-        SceneRenderQueueFactory.cacheObject( pSceneRenderQueue );
-    }
-
-    // Draw controllers.
-    if ( getDebugMask() & Scene::SCENE_DEBUG_CONTROLLERS )
-    {
-        // Fetch the controller set.
-        SimSet* pControllerSet = getControllers();
-
-        // Do we have any scene controllers?
-        if ( pControllerSet != NULL )
-        {
-            // Debug Profiling.
-            PROFILE_SCOPE(Scene_RenderControllers);
-
-            // Yes, so fetch scene controller count.
-            const S32 sceneControllerCount = (S32)pControllerSet->size();
-
-            // Iterate scene controllers.
-            for( S32 i = 0; i < sceneControllerCount; i++ )
-            {
-                // Fetch the scene controller.
-                SceneController* pController = dynamic_cast<SceneController*>((*pControllerSet)[i]);
-
-                // Skip if not a controller.
-                if ( pController == NULL )
-                    continue;
-
-                // Render the overlay.
-                pController->renderOverlay( this, pSceneRenderState, &mBatchRenderer );
-            }
-
-            // Flush isolated batch.
-            mBatchRenderer.flush( pDebugStats->batchIsolatedFlush );
-        }
-    }
-
-    // Draw Joints.
-    if ( getDebugMask() & Scene::SCENE_DEBUG_JOINTS )
-    {
-        // Debug Profiling.
-        PROFILE_SCOPE(Scene_RenderSceneJointOverlays);
-
-        mDebugDraw.DrawJoints( mpWorld );
-    }
-
-    // Update debug stat ranges.
-    mDebugStats.updateRanges();
-
-    // Are we using the render callback?
-    if( mRenderCallback )
-    {
-        // Debug Profiling.
-        PROFILE_SCOPE(Scene_OnSceneRendertCallback);
-
-        // Yes, so perform callback.
-        Con::executef( this, 1, "onSceneRender" );
-    }
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::clearScene( bool deleteObjects )
-{
-    while( mSceneObjects.size() > 0 )
-    {
-        // Fetch first scene object.
-        SceneObject* pSceneObject = mSceneObjects[0];
-
-        // Remove Object from Scene.
-        removeFromScene( pSceneObject );
-
-        // Queue Object for deletion.
-        if ( deleteObjects )
-            pSceneObject->safeDelete();
-    }
-
-    // Fetch the controller set.
-    SimSet* pControllerSet = getControllers();
-
-    // Do we have any scene controllers?
-    if ( pControllerSet != NULL )
-    {
-        // Yes, so delete them all.
-        while( pControllerSet->size() > 0 )
-            pControllerSet->at(0)->deleteObject();
-    }
-
-    // Clear asset preloads.
-    clearAssetPreloads();
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::addToScene( SceneObject* pSceneObject )
-{
-    if ( pSceneObject == NULL )
-        return;
-
-    // Fetch current scene.
-    Scene* pCurrentScene = pSceneObject->getScene();
-
-    // Ignore if already in the scene.
-    if ( pCurrentScene == this )
-        return;
-
-#if defined(TORQUE_DEBUG)
-    // Sanity!
-    for ( S32 n = 0; n < mSceneObjects.size(); ++n )
-    {
-        AssertFatal( mSceneObjects[n] != pSceneObject, "A scene object has become corrupt." );
-    }
-#endif
-
-    // Check that object is not already in a scene.
-    if ( pCurrentScene )
-    {
-        // Remove from scene.
-        pCurrentScene->removeFromScene( pSceneObject );
-    }
-
-    // Add scene object.
-    mSceneObjects.push_back( pSceneObject );
-
-    // Register with the scene.
-    pSceneObject->OnRegisterScene( this );
-
-    // Perform callback only if properly added to the simulation.
-    if ( pSceneObject->isProperlyAdded() )
-    {
-        Con::executef(pSceneObject, 2, "onAddToScene", getIdString());
-    }
-    else
-    {
-        // Warning.
-        Con::warnf("Scene object added to scene but the object is not registered with the simulation.  No 'onAddToScene' can be performed!  Use Target scene.");
-    }
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::removeFromScene( SceneObject* pSceneObject )
-{
-    if ( pSceneObject == NULL )
-        return;
-
-    // Check if object is actually in a scene.
-    if ( !pSceneObject->getScene() )
-    {
-        Con::warnf("Scene::removeFromScene() - Object '%s' is not in a scene!.", pSceneObject->getIdString());
-        return;
-    }
-
-    // Remove as debug-object if set.
-    if ( pSceneObject == getDebugSceneObject() )
-        setDebugSceneObject( NULL );
-
-    // Process Destroy Notifications.
-    pSceneObject->processDestroyNotifications();
-
-    // Dismount Any Camera.
-    pSceneObject->dismountCamera();
-
-    // Remove from the SceneWindow last pickers
-    for( U32 i = 0; i < (U32)mAttachedSceneWindows.size(); ++i )
-    {
-        (dynamic_cast<SceneWindow*>(mAttachedSceneWindows[i]))->removeFromInputEventPick(pSceneObject);
-    }
-
-    // Unregister from scene.
-    pSceneObject->OnUnregisterScene( this );
-
-    // Find scene object and remove it quickly.
-    for ( S32 n = 0; n < mSceneObjects.size(); ++n )
-    {
-        if ( mSceneObjects[n] == pSceneObject )
-        {
-            mSceneObjects.erase_fast( n );
-            break;
-        }
-    }
-
-    // Perform callback.
-    Con::executef( pSceneObject, 2, "onRemoveFromScene", getIdString() );
-}
-
-//-----------------------------------------------------------------------------
-
-SceneObject* Scene::getSceneObject( const U32 objectIndex ) const
-{
-    // Sanity!
-    AssertFatal( objectIndex < getSceneObjectCount(), "Scene::getSceneObject() - Invalid object index." );
-
-    return mSceneObjects[objectIndex];
-}
-
-//-----------------------------------------------------------------------------
-
-U32 Scene::getSceneObjects( typeSceneObjectVector& objects ) const
-{
-    // No objects if scene is empty!
-    if ( getSceneObjectCount() == 0 )
-        return 0;
-
-    // Merge with objects.
-    objects.merge( mSceneObjects );
-
-    return getSceneObjectCount();
-}
-
-//-----------------------------------------------------------------------------
-
-U32 Scene::getSceneObjects( typeSceneObjectVector& objects, const U32 sceneLayer ) const
-{
-    // No objects if scene is empty!
-    if ( getSceneObjectCount() == 0 )
-        return 0;
-
-    // Reset object count.
-    U32 count = 0;
-
-    // Iterate scene objects.
-    for( S32 n = 0; n < mSceneObjects.size(); ++n )
-    {
-        // Fetch scene object.
-        SceneObject* pSceneObject = mSceneObjects[n];
-
-        // Skip if not the correct layer.
-        if ( pSceneObject->getSceneLayer() != sceneLayer )
-            continue;
-
-        // Add to objects.
-        objects.push_back( pSceneObject );
-
-        // Increase count.
-        count++;
-    }
-
-    return count;
-}
-
-//-----------------------------------------------------------------------------
-
-const AssetPtr<AssetBase>* Scene::getAssetPreload( const S32 index ) const
-{
-    // Is the index valid?
-    if ( index < 0 || index >= mAssetPreloads.size() )
-    {
-        // Yes, so warn.
-        Con::warnf( "Scene::getAssetPreload() - Out of range index '%d'.  There are only '%d' asset preloads.", index, mAssetPreloads.size() );
-        return NULL;
-    }
-
-    return mAssetPreloads[index];
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::addAssetPreload( const char* pAssetId )
-{
-    // Sanity!
-    AssertFatal( pAssetId != NULL, "Scene::addAssetPreload() - Cannot add a NULL asset preload." );
-
-    // Fetch asset Id.
-    StringTableEntry assetId = StringTable->insert( pAssetId );
-
-    // Ignore if asset already added.
-    const S32 assetPreloadCount = mAssetPreloads.size();
-    for( S32 index = 0; index < assetPreloadCount; ++index )
-    {
-        if ( mAssetPreloads[index]->getAssetId() == assetId )
-            return;
-    }
-
-    // Create asset pointer.
-    AssetPtr<AssetBase>* pAssetPtr = new AssetPtr<AssetBase>( pAssetId );
-
-    // Was the asset acquired?
-    if ( pAssetPtr->isNull() )
-    {
-        // No, so warn.
-        Con::warnf( "Scene::addAssetPreload() - Failed to acquire asset '%s' so not added as a preload.", pAssetId );
-
-        // No, so delete the asset pointer.
-        delete pAssetPtr;
-        return;
-    }
-
-    // Add asset.
-    mAssetPreloads.push_back( pAssetPtr );
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::removeAssetPreload( const char* pAssetId )
-{
-    // Sanity!
-    AssertFatal( pAssetId != NULL, "Scene::removeAssetPreload() - Cannot remove a NULL asset preload." );
-
-    // Fetch asset Id.
-    StringTableEntry assetId = StringTable->insert( pAssetId );
-
-    // Remove asset Id.
-    const S32 assetPreloadCount = mAssetPreloads.size();
-    for( S32 index = 0; index < assetPreloadCount; ++index )
-    {
-        if ( mAssetPreloads[index]->getAssetId() == assetId )
-        {
-            delete mAssetPreloads[index];
-            mAssetPreloads.erase_fast( index );
-            return;
-        }
-    }
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::clearAssetPreloads( void )
-{
-    // Delete all the asset preloads.
-    while( mAssetPreloads.size() > 0 )
-    {
-        delete mAssetPreloads.back();
-        mAssetPreloads.pop_back();
-    }
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::mergeScene( const Scene* pScene )
-{
-    // Fetch the scene object count.
-    const U32 count = pScene->getSceneObjectCount();
-
-    // Finish if there are not objects to copy.
-    if ( count == 0 )
-        return;
-
-
-    for( U32 index = 0; index < count; ++index )
-    {
-        // Fetch a clone of the scene object.
-        SceneObject* pSceneObject = (SceneObject*)pScene->getSceneObject( index )->clone( true );
-
-        // Add the clone.
-        addToScene( pSceneObject );
-    }
-}
-
-//-----------------------------------------------------------------------------
-
-b2Joint* Scene::findJoint( const S32 jointId )
-{
-    // Find joint.
-    typeJointHash::iterator itr = mJoints.find( jointId );
-
-    return itr == mJoints.end() ? NULL : itr->value;
-}
-
-//-----------------------------------------------------------------------------
-
-b2JointType Scene::getJointType( const S32 jointId )
-{
-    // Sanity!
-    if ( jointId >= mJointMasterId )
-    {
-        Con::warnf("The joint Id of %d is invalid.", jointId);
-        return e_unknownJoint;
-    }
-
-    return findJoint( jointId )->GetType();
-}
-
-//-----------------------------------------------------------------------------
-
-S32 Scene::findJointId( b2Joint* pJoint )
-{
-    // Sanity!
-    AssertFatal( pJoint != NULL, "Joint cannot be NULL." );
-
-    // Find joint.
-    typeReverseJointHash::iterator itr = mReverseJoints.find( pJoint );
-
-    if ( itr == mReverseJoints.end() )
-    {
-        Con::warnf("The joint Id could not be found via a joint reference of %x", pJoint);
-        return 0;
-    }
-
-    return itr->value;
-}
-
-//-----------------------------------------------------------------------------
-
-S32 Scene::createJoint( b2JointDef* pJointDef )
-{
-    // Sanity!
-    AssertFatal( pJointDef != NULL, "Joint definition cannot be NULL." );
-
-    // Create Joint.
-    b2Joint* pJoint = mpWorld->CreateJoint( pJointDef );
-
-    // Allocate joint Id.
-    const S32 jointId = mJointMasterId++;
-
-    // Insert joint.
-    typeJointHash::iterator itr;
-    itr = mJoints.insert( jointId, pJoint );
-
-    // Sanity!
-    AssertFatal( itr != mJoints.end(), "Joint already in hash table." );
-
-    // Insert reverse joint.
-    mReverseJoints.insert( pJoint, jointId );
-
-    return jointId;
-}
-
-//-----------------------------------------------------------------------------
-
-bool Scene::deleteJoint( const U32 jointId )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Finish if no joint.
-    if ( pJoint == NULL )
-        return false;
-
-    // Destroy joint.
-    // This should result in the joint references also being destroyed
-    // as the scene is a destruction listener.
-    mpWorld->DestroyJoint( pJoint );
-
-    return true;
-}
-
-//-----------------------------------------------------------------------------
-
-bool Scene::hasJoints( SceneObject* pSceneObject )
-{
-    // Sanity!
-    AssertFatal( pSceneObject != NULL, "Scene object cannot be NULL!" );
-    AssertFatal( pSceneObject->getScene() != this, "Scene object is not in this scene" );
-
-    // Fetch body.
-    b2Body* pBody = pSceneObject->getBody();
-
-    // Fetch joint edge.
-    b2JointEdge* pJointEdge = pBody->GetJointList();
-
-    if ( pJointEdge == NULL || pJointEdge->joint == NULL )
-        return false;
-
-    // Found at least one joint.
-    return true;
-}
-
-//-----------------------------------------------------------------------------
-
-S32 Scene::createDistanceJoint(
-    const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
-    const b2Vec2& localAnchorA, const b2Vec2& localAnchorB,
-    const F32 length,
-    const F32 frequency,
-    const F32 dampingRatio,
-    const bool collideConnected )
-{
-    // Sanity!
-    if (    (pSceneObjectA != NULL && pSceneObjectA->getScene() == NULL) ||
-            (pSceneObjectB != NULL && pSceneObjectB->getScene() == NULL) )
-    {
-        // Warn.
-        Con::printf( "Cannot add a joint to a scene object that is not in a scene." );
-        return -1;
-    }
-
-    // Check for two invalid objects.
-    if ( pSceneObjectA == NULL && pSceneObjectB == NULL )
-    {
-        Con::warnf("Scene::createDistanceJoint() - Cannot create joint without at least a single scene object." );
-        return -1;
-    }
-
-    // Fetch bodies.
-    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getBody() : getGroundBody();
-    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getBody() : getGroundBody();
-    
-    // Populate definition.
-    b2DistanceJointDef jointDef;
-    jointDef.userData         = static_cast<PhysicsProxy*>(this);
-    jointDef.collideConnected = collideConnected;
-    jointDef.bodyA            = pBodyA;
-    jointDef.bodyB            = pBodyB;
-    jointDef.localAnchorA     = localAnchorA;
-    jointDef.localAnchorB     = localAnchorB;
-    jointDef.length           = length < 0.0f ? (pBodyB->GetWorldPoint( localAnchorB ) - pBodyA->GetWorldPoint( localAnchorA )).Length() : length;
-    jointDef.frequencyHz      = frequency;
-    jointDef.dampingRatio     = dampingRatio;
-    
-    // Create joint.
-    return createJoint( &jointDef );
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::setDistanceJointLength(
-        const U32 jointId,
-        const F32 length )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_distanceJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return;
-    }
-
-    // Cast joint.
-    b2DistanceJoint* pRealJoint = static_cast<b2DistanceJoint*>( pJoint );
-
-    // Access joint.
-    pRealJoint->SetLength( length );
-}
-
-//-----------------------------------------------------------------------------
-
-F32 Scene::getDistanceJointLength( const U32 jointId )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return -1.0f;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_distanceJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return -1.0f;
-    }
-
-    // Cast joint.
-    b2DistanceJoint* pRealJoint = static_cast<b2DistanceJoint*>( pJoint );
-
-    // Access joint.
-    return pRealJoint->GetLength();
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::setDistanceJointFrequency(
-        const U32 jointId,
-        const F32 frequency )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_distanceJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return;
-    }
-
-    // Cast joint.
-    b2DistanceJoint* pRealJoint = static_cast<b2DistanceJoint*>( pJoint );
-
-    // Access joint.
-    pRealJoint->SetFrequency( frequency );
-}
-
-//-----------------------------------------------------------------------------
-
-F32 Scene::getDistanceJointFrequency( const U32 jointId )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return -1.0f;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_distanceJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return -1.0f;
-    }
-
-    // Cast joint.
-    b2DistanceJoint* pRealJoint = static_cast<b2DistanceJoint*>( pJoint );
-
-    // Access joint.
-    return pRealJoint->GetFrequency();
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::setDistanceJointDampingRatio(
-        const U32 jointId,
-        const F32 dampingRatio )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_distanceJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return;
-    }
-
-    // Cast joint.
-    b2DistanceJoint* pRealJoint = static_cast<b2DistanceJoint*>( pJoint );
-
-    // Access joint.
-    pRealJoint->SetDampingRatio( dampingRatio );
-}
-
-//-----------------------------------------------------------------------------
-
-F32 Scene::getDistanceJointDampingRatio( const U32 jointId )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return -1.0f;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_distanceJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return -1.0f;
-    }
-
-    // Cast joint.
-    b2DistanceJoint* pRealJoint = static_cast<b2DistanceJoint*>( pJoint );
-
-    // Access joint.
-    return pRealJoint->GetDampingRatio();
-}
-
-//-----------------------------------------------------------------------------
-
-S32 Scene::createRopeJoint(
-        const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
-        const b2Vec2& localAnchorA, const b2Vec2& localAnchorB,
-        const F32 maxLength,
-        const bool collideConnected )
-{
-    // Sanity!
-    if (    (pSceneObjectA != NULL && pSceneObjectA->getScene() == NULL) ||
-            (pSceneObjectB != NULL && pSceneObjectB->getScene() == NULL) )
-    {
-        // Warn.
-        Con::printf( "Cannot add a joint to a scene object that is not in a scene." );
-        return -1;
-    }
-
-    // Check for two invalid objects.
-    if ( pSceneObjectA == NULL && pSceneObjectB == NULL )
-    {
-        Con::warnf("Scene::createRopeJoint() - Cannot create joint without at least a single scene object." );
-        return -1;
-    }
-
-    // Fetch bodies.
-    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getBody() : getGroundBody();
-    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getBody() : getGroundBody();
-    
-    // Populate definition.
-    b2RopeJointDef jointDef;
-    jointDef.userData         = static_cast<PhysicsProxy*>(this);
-    jointDef.collideConnected = collideConnected;
-    jointDef.bodyA            = pBodyA;
-    jointDef.bodyB            = pBodyB;
-    jointDef.localAnchorA     = localAnchorA;
-    jointDef.localAnchorB     = localAnchorB;
-    jointDef.maxLength        = maxLength < 0.0f ? (pBodyB->GetWorldPoint( localAnchorB ) - pBodyA->GetWorldPoint( localAnchorA )).Length() : maxLength;
-    
-    // Create joint.
-    return createJoint( &jointDef );
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::setRopeJointMaxLength(
-        const U32 jointId,
-        const F32 maxLength )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_ropeJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return;
-    }
-
-    // Cast joint.
-    b2RopeJoint* pRealJoint = static_cast<b2RopeJoint*>( pJoint );
-
-    // Access joint.
-    pRealJoint->SetMaxLength( maxLength );
-}
-
-//-----------------------------------------------------------------------------
-
-F32 Scene::getRopeJointMaxLength( const U32 jointId )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return -1.0f;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_ropeJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return -1.0f;
-    }
-
-    // Cast joint.
-    b2RopeJoint* pRealJoint = static_cast<b2RopeJoint*>( pJoint );
-
-    // Access joint.
-    return pRealJoint->GetMaxLength();
-}
-
-//-----------------------------------------------------------------------------
-
-S32 Scene::createRevoluteJoint(
-        const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
-        const b2Vec2& localAnchorA, const b2Vec2& localAnchorB,
-        const bool collideConnected )
-{
-    // Sanity!
-    if (    (pSceneObjectA != NULL && pSceneObjectA->getScene() == NULL) ||
-            (pSceneObjectB != NULL && pSceneObjectB->getScene() == NULL) )
-    {
-        // Warn.
-        Con::printf( "Cannot add a joint to a scene object that is not in a scene." );
-        return -1;
-    }
-
-    // Check for two invalid objects.
-    if ( pSceneObjectA == NULL && pSceneObjectB == NULL )
-    {
-        Con::warnf("Scene::createRevoluteJoint() - Cannot create joint without at least a single scene object." );
-        return -1;
-    }
-
-    // Fetch bodies.
-    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getBody() : getGroundBody();
-    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getBody() : getGroundBody();
-    
-    // Populate definition.
-    b2RevoluteJointDef jointDef;
-    jointDef.userData         = static_cast<PhysicsProxy*>(this);
-    jointDef.collideConnected = collideConnected;
-    jointDef.bodyA            = pBodyA;
-    jointDef.bodyB            = pBodyB;
-    jointDef.referenceAngle   = pBodyB->GetAngle() - pBodyA->GetAngle();
-    jointDef.localAnchorA     = localAnchorA;
-    jointDef.localAnchorB     = localAnchorB;
-    
-    // Create joint.
-    return createJoint( &jointDef );
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::setRevoluteJointLimit(
-        const U32 jointId,
-        const bool enableLimit,
-        const F32 lowerAngle, const F32 upperAngle )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_revoluteJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return;
-    }
-
-    // Cast joint.
-    b2RevoluteJoint* pRealJoint = static_cast<b2RevoluteJoint*>( pJoint );
-
-    // Access joint.
-    pRealJoint->SetLimits( lowerAngle, upperAngle );
-    pRealJoint->EnableLimit( enableLimit );
-}
-
-//-----------------------------------------------------------------------------
-
-bool Scene::getRevoluteJointLimit(
-        const U32 jointId,
-        bool& enableLimit,
-        F32& lowerAngle, F32& upperAngle )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return false;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_revoluteJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return false;
-    }
-
-    // Cast joint.
-    b2RevoluteJoint* pRealJoint = static_cast<b2RevoluteJoint*>( pJoint );
-
-    // Access joint.
-    enableLimit = pRealJoint->IsLimitEnabled();
-    lowerAngle = pRealJoint->GetLowerLimit();
-    upperAngle = pRealJoint->GetUpperLimit();
-
-    return true;
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::setRevoluteJointMotor(
-        const U32 jointId,
-        const bool enableMotor,
-        const F32 motorSpeed,
-        const F32 maxMotorTorque )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_revoluteJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return;
-    }
-
-    // Cast joint.
-    b2RevoluteJoint* pRealJoint = static_cast<b2RevoluteJoint*>( pJoint );
-
-    // Access joint.
-    pRealJoint->SetMotorSpeed( motorSpeed );
-    pRealJoint->SetMaxMotorTorque( maxMotorTorque );
-    pRealJoint->EnableMotor( enableMotor );    
-}
-
-//-----------------------------------------------------------------------------
-
-bool Scene::getRevoluteJointMotor(
-        const U32 jointId,
-        bool& enableMotor,
-        F32& motorSpeed,
-        F32& maxMotorTorque )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return false;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_revoluteJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return false;
-    }
-
-    // Cast joint.
-    b2RevoluteJoint* pRealJoint = static_cast<b2RevoluteJoint*>( pJoint );
-
-    // Access joint.
-    enableMotor = pRealJoint->IsMotorEnabled();
-    motorSpeed = pRealJoint->GetMotorSpeed();
-    maxMotorTorque = pRealJoint->GetMaxMotorTorque();
-
-    return true;
-}
-
-//-----------------------------------------------------------------------------
-
-F32 Scene::getRevoluteJointAngle( const U32 jointId )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return 0.0f;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_revoluteJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return 0.0f;
-    }
-
-    // Cast joint.
-    b2RevoluteJoint* pRealJoint = static_cast<b2RevoluteJoint*>( pJoint );
-
-    // Access joint.
-    return pRealJoint->GetJointAngle();
-}
-
-//-----------------------------------------------------------------------------
-
-F32 Scene::getRevoluteJointSpeed( const U32 jointId )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return 0.0f;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_revoluteJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return 0.0f;
-    }
-
-    // Cast joint.
-    b2RevoluteJoint* pRealJoint = static_cast<b2RevoluteJoint*>( pJoint );
-
-    // Access joint.
-    return pRealJoint->GetJointSpeed();
-}
-
-//-----------------------------------------------------------------------------
-
-S32 Scene::createWeldJoint(
-        const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
-        const b2Vec2& localAnchorA, const b2Vec2& localAnchorB,
-        const F32 frequency,
-        const F32 dampingRatio,
-        const bool collideConnected )
-{
-    // Sanity!
-    if (    (pSceneObjectA != NULL && pSceneObjectA->getScene() == NULL) ||
-            (pSceneObjectB != NULL && pSceneObjectB->getScene() == NULL) )
-    {
-        // Warn.
-        Con::printf( "Cannot add a joint to a scene object that is not in a scene." );
-        return -1;
-    }
-
-    // Check for two invalid objects.
-    if ( pSceneObjectA == NULL && pSceneObjectB == NULL )
-    {
-        Con::warnf("Scene::createWeldJoint() - Cannot create joint without at least a single scene object." );
-        return -1;
-    }
-
-    // Fetch bodies.
-    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getBody() : getGroundBody();
-    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getBody() : getGroundBody();
-    
-    // Populate definition.
-    b2WeldJointDef jointDef;
-    jointDef.userData         = static_cast<PhysicsProxy*>(this);
-    jointDef.collideConnected = collideConnected;
-    jointDef.bodyA            = pBodyA;
-    jointDef.bodyB            = pBodyB;
-    jointDef.referenceAngle   = pBodyB->GetAngle() - pBodyA->GetAngle();
-    jointDef.localAnchorA     = localAnchorA;
-    jointDef.localAnchorB     = localAnchorB;
-    jointDef.frequencyHz      = frequency;
-    jointDef.dampingRatio     = dampingRatio;
-    
-    // Create joint.
-    return createJoint( &jointDef );
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::setWeldJointFrequency(
-        const U32 jointId,
-        const F32 frequency )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_weldJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return;
-    }
-
-    // Cast joint.
-    b2WeldJoint* pRealJoint = static_cast<b2WeldJoint*>( pJoint );
-
-    // Access joint.
-    pRealJoint->SetFrequency( frequency );
-}
-
-
-//-----------------------------------------------------------------------------
-
-F32 Scene::getWeldJointFrequency( const U32 jointId  )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return -1.0f;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_weldJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return -1.0f;
-    }
-
-    // Cast joint.
-    b2WeldJoint* pRealJoint = static_cast<b2WeldJoint*>( pJoint );
-
-    // Access joint.
-    return pRealJoint->GetFrequency();
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::setWeldJointDampingRatio(
-        const U32 jointId,
-        const F32 dampingRatio )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_weldJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return;
-    }
-
-    // Cast joint.
-    b2WeldJoint* pRealJoint = static_cast<b2WeldJoint*>( pJoint );
-
-    // Access joint.
-    pRealJoint->SetDampingRatio( dampingRatio );
-}
-
-//-----------------------------------------------------------------------------
-
-F32 Scene::getWeldJointDampingRatio( const U32 jointId )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return -1.0f;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_weldJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return -1.0f;
-    }
-
-    // Cast joint.
-    b2WeldJoint* pRealJoint = static_cast<b2WeldJoint*>( pJoint );
-
-    // Access joint.
-    return pRealJoint->GetDampingRatio();
-}
-
-//-----------------------------------------------------------------------------
-
-S32 Scene::createWheelJoint(
-        const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
-        const b2Vec2& localAnchorA, const b2Vec2& localAnchorB,
-        const b2Vec2& worldAxis,
-        const bool collideConnected )
-{
-    // Sanity!
-    if (    (pSceneObjectA != NULL && pSceneObjectA->getScene() == NULL) ||
-            (pSceneObjectB != NULL && pSceneObjectB->getScene() == NULL) )
-    {
-        // Warn.
-        Con::printf( "Cannot add a joint to a scene object that is not in a scene." );
-        return -1;
-    }
-
-    // Check for two invalid objects.
-    if ( pSceneObjectA == NULL && pSceneObjectB == NULL )
-    {
-        Con::warnf("Scene::createWheelJoint() - Cannot create joint without at least a single scene object." );
-        return -1;
-    }
-
-    // Fetch bodies.
-    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getBody() : getGroundBody();
-    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getBody() : getGroundBody();
-    
-    // Populate definition.
-    b2WheelJointDef jointDef;
-    jointDef.userData         = static_cast<PhysicsProxy*>(this);
-    jointDef.collideConnected = collideConnected;
-    jointDef.bodyA            = pBodyA;
-    jointDef.bodyB            = pBodyB;
-    jointDef.localAnchorA     = localAnchorA;
-    jointDef.localAnchorB     = localAnchorB;
-    jointDef.localAxisA       = pBodyA->GetLocalVector( worldAxis );
-    
-    // Create joint.
-    return createJoint( &jointDef );
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::setWheelJointMotor(
-        const U32 jointId,
-        const bool enableMotor,
-        const F32 motorSpeed,
-        const F32 maxMotorTorque )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_wheelJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return;
-    }
-
-    // Cast joint.
-    b2WheelJoint* pRealJoint = static_cast<b2WheelJoint*>( pJoint );
-
-    // Access joint.
-    pRealJoint->SetMotorSpeed( motorSpeed );
-    pRealJoint->SetMaxMotorTorque( maxMotorTorque );
-    pRealJoint->EnableMotor( enableMotor ); 
-}
-
-//-----------------------------------------------------------------------------
-
-bool Scene::getWheelJointMotor(
-        const U32 jointId,
-        bool& enableMotor,
-        F32& motorSpeed,
-        F32& maxMotorTorque )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return false;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_wheelJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return false;
-    }
-
-    // Cast joint.
-    b2WheelJoint* pRealJoint = static_cast<b2WheelJoint*>( pJoint );
-
-    // Access joint.
-    enableMotor = pRealJoint->IsMotorEnabled();
-    motorSpeed = pRealJoint->GetMotorSpeed();
-    maxMotorTorque = pRealJoint->GetMaxMotorTorque();
-
-    return true;
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::setWheelJointFrequency(
-        const U32 jointId,
-        const F32 frequency )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_wheelJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return;
-    }
-
-    // Cast joint.
-    b2WheelJoint* pRealJoint = static_cast<b2WheelJoint*>( pJoint );
-
-    // Access joint.
-    pRealJoint->SetSpringFrequencyHz( frequency );
-}
-
-//-----------------------------------------------------------------------------
-
-F32 Scene::getWheelJointFrequency( const U32 jointId )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return -1.0f;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_wheelJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return -1.0f;
-    }
-
-    // Cast joint.
-    b2WheelJoint* pRealJoint = static_cast<b2WheelJoint*>( pJoint );
-
-    // Access joint.
-    return pRealJoint->GetSpringFrequencyHz();
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::setWheelJointDampingRatio(
-        const U32 jointId,
-        const F32 dampingRatio )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_wheelJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return;
-    }
-
-    // Cast joint.
-    b2WheelJoint* pRealJoint = static_cast<b2WheelJoint*>( pJoint );
-
-    // Access joint.
-    pRealJoint->SetSpringDampingRatio( dampingRatio );
-}
-
-//-----------------------------------------------------------------------------
-
-F32 Scene::getWheelJointDampingRatio( const U32 jointId )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return -1.0f;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_wheelJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return -1.0f;
-    }
-
-    // Cast joint.
-    b2WheelJoint* pRealJoint = static_cast<b2WheelJoint*>( pJoint );
-
-    // Access joint.
-    return pRealJoint->GetSpringDampingRatio();
-}
-
-//-----------------------------------------------------------------------------
-
-S32 Scene::createFrictionJoint(
-        const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
-        const b2Vec2& localAnchorA, const b2Vec2& localAnchorB,
-        const F32 maxForce,
-        const F32 maxTorque,
-        const bool collideConnected )
-{
-    // Sanity!
-    if (    (pSceneObjectA != NULL && pSceneObjectA->getScene() == NULL) ||
-            (pSceneObjectB != NULL && pSceneObjectB->getScene() == NULL) )
-    {
-        // Warn.
-        Con::printf( "Cannot add a joint to a scene object that is not in a scene." );
-        return -1;
-    }
-
-    // Check for two invalid objects.
-    if ( pSceneObjectA == NULL && pSceneObjectB == NULL )
-    {
-        Con::warnf("Scene::createFrictionJoint() - Cannot create joint without at least a single scene object." );
-        return -1;
-    }
-
-    // Fetch bodies.
-    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getBody() : getGroundBody();
-    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getBody() : getGroundBody();
-    
-    // Populate definition.
-    b2FrictionJointDef jointDef;
-    jointDef.userData         = static_cast<PhysicsProxy*>(this);
-    jointDef.collideConnected = collideConnected;
-    jointDef.bodyA            = pBodyA;
-    jointDef.bodyB            = pBodyB;
-    jointDef.localAnchorA     = localAnchorA;
-    jointDef.localAnchorB     = localAnchorB;
-    jointDef.maxForce         = maxForce;
-    jointDef.maxTorque        = maxTorque;
-    
-    // Create joint.
-    return createJoint( &jointDef );
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::setFrictionJointMaxForce(
-        const U32 jointId,
-        const F32 maxForce )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_frictionJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return;
-    }
-
-    // Cast joint.
-    b2FrictionJoint* pRealJoint = static_cast<b2FrictionJoint*>( pJoint );
-
-    // Access joint.
-    pRealJoint->SetMaxForce( maxForce );
-}
-
-//-----------------------------------------------------------------------------
-
-F32 Scene::getFrictionJointMaxForce( const U32 jointId )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return -1.0f;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_frictionJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return -1.0f;
-    }
-
-    // Cast joint.
-    b2FrictionJoint* pRealJoint = static_cast<b2FrictionJoint*>( pJoint );
-
-    // Access joint.
-    return pRealJoint->GetMaxForce();
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::setFrictionJointMaxTorque(
-        const U32 jointId,
-        const F32 maxTorque )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_frictionJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return;
-    }
-
-    // Cast joint.
-    b2FrictionJoint* pRealJoint = static_cast<b2FrictionJoint*>( pJoint );
-
-    // Access joint.
-    pRealJoint->SetMaxTorque( maxTorque );
-}
-
-
-//-----------------------------------------------------------------------------
-
-F32 Scene::getFrictionJointMaxTorque( const U32 jointId )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return -1.0f;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_frictionJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return -1.0f;
-    }
-
-    // Cast joint.
-    b2FrictionJoint* pRealJoint = static_cast<b2FrictionJoint*>( pJoint );
-
-    // Access joint.
-    return pRealJoint->GetMaxTorque();
-}
-
-//-----------------------------------------------------------------------------
-
-S32 Scene::createPrismaticJoint(
-        const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
-        const b2Vec2& localAnchorA, const b2Vec2& localAnchorB,
-        const b2Vec2& worldAxis,
-        const bool collideConnected )
-{
-    // Sanity!
-    if (    (pSceneObjectA != NULL && pSceneObjectA->getScene() == NULL) ||
-            (pSceneObjectB != NULL && pSceneObjectB->getScene() == NULL) )
-    {
-        // Warn.
-        Con::printf( "Cannot add a joint to a scene object that is not in a scene." );
-        return -1;
-    }
-
-    // Check for two invalid objects.
-    if ( pSceneObjectA == NULL && pSceneObjectB == NULL )
-    {
-        Con::warnf("Scene::createPrismaticJoint() - Cannot create joint without at least a single scene object." );
-        return -1;
-    }
-
-    // Fetch bodies.
-    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getBody() : getGroundBody();
-    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getBody() : getGroundBody();
-    
-    // Populate definition.
-    b2PrismaticJointDef jointDef;
-    jointDef.userData         = static_cast<PhysicsProxy*>(this);
-    jointDef.collideConnected = collideConnected;
-    jointDef.bodyA            = pBodyA;
-    jointDef.bodyB            = pBodyB;
-    jointDef.referenceAngle   = pBodyB->GetAngle() - pBodyA->GetAngle();
-    jointDef.localAnchorA     = localAnchorA;
-    jointDef.localAnchorB     = localAnchorB;
-    jointDef.localAxisA       = pBodyA->GetLocalVector( worldAxis );
-    
-    // Create joint.
-    return createJoint( &jointDef );
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::setPrismaticJointLimit(
-        const U32 jointId,
-        const bool enableLimit,
-        const F32 lowerTranslation, const F32 upperTranslation )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_prismaticJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return;
-    }
-
-    // Cast joint.
-    b2PrismaticJoint* pRealJoint = static_cast<b2PrismaticJoint*>( pJoint );
-
-    // Access joint.
-    pRealJoint->SetLimits( lowerTranslation, upperTranslation );
-    pRealJoint->EnableLimit( enableLimit );
-}
-
-//-----------------------------------------------------------------------------
-
-bool Scene::getPrismaticJointLimit(
-        const U32 jointId,
-        bool& enableLimit,
-        F32& lowerTranslation, F32& upperTranslation )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return false;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_prismaticJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return false;
-    }
-
-    // Cast joint.
-    b2PrismaticJoint* pRealJoint = static_cast<b2PrismaticJoint*>( pJoint );
-
-    // Access joint.
-    enableLimit = pRealJoint->IsLimitEnabled();
-    lowerTranslation = pRealJoint->GetLowerLimit();
-    upperTranslation = pRealJoint->GetUpperLimit();
-
-    return true;
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::setPrismaticJointMotor(
-        const U32 jointId,
-        const bool enableMotor,
-        const F32 motorSpeed,
-        const F32 maxMotorForce )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_prismaticJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return;
-    }
-
-    // Cast joint.
-    b2PrismaticJoint* pRealJoint = static_cast<b2PrismaticJoint*>( pJoint );
-
-    // Access joint.
-    pRealJoint->SetMotorSpeed( motorSpeed );
-    pRealJoint->SetMaxMotorForce( maxMotorForce );
-    pRealJoint->EnableMotor( enableMotor ); 
-}
-
-//-----------------------------------------------------------------------------
-
-bool Scene::getPrismaticJointMotor(
-        const U32 jointId,
-        bool& enableMotor,
-        F32& motorSpeed,
-        F32& maxMotorForce )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return false;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_prismaticJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return false;
-    }
-
-    // Cast joint.
-    b2PrismaticJoint* pRealJoint = static_cast<b2PrismaticJoint*>( pJoint );
-
-    // Access joint.
-    enableMotor = pRealJoint->IsMotorEnabled();
-    motorSpeed = pRealJoint->GetMotorSpeed();
-    maxMotorForce = pRealJoint->GetMaxMotorForce();
-
-    return true;
-}
-
-//-----------------------------------------------------------------------------
-
-S32 Scene::createPulleyJoint(
-        const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
-        const b2Vec2& localAnchorA, const b2Vec2& localAnchorB,
-        const b2Vec2& worldGroundAnchorA, const b2Vec2& worldGroundAnchorB,
-        const F32 ratio,
-        const F32 lengthA, const F32 lengthB,
-        const bool collideConnected )
-{
-    // Sanity!
-    if (    (pSceneObjectA != NULL && pSceneObjectA->getScene() == NULL) ||
-            (pSceneObjectB != NULL && pSceneObjectB->getScene() == NULL) )
-    {
-        // Warn.
-        Con::printf( "Cannot add a joint to a scene object that is not in a scene." );
-        return -1;
-    }
-
-    // Check for two invalid objects.
-    if ( pSceneObjectA == NULL && pSceneObjectB == NULL )
-    {
-        Con::warnf("Scene::createPulleyJoint() - Cannot create joint without at least a single scene object." );
-        return -1;
-    }
-
-    // Fetch bodies.
-    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getBody() : getGroundBody();
-    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getBody() : getGroundBody();
-    
-    // Populate definition.
-    b2PulleyJointDef jointDef;
-    jointDef.userData         = static_cast<PhysicsProxy*>(this);
-    jointDef.collideConnected = collideConnected;
-    jointDef.bodyA            = pBodyA;
-    jointDef.bodyB            = pBodyB;
-    jointDef.groundAnchorA    = worldGroundAnchorA;
-    jointDef.groundAnchorB    = worldGroundAnchorB;
-    jointDef.localAnchorA     = localAnchorA;
-    jointDef.localAnchorB     = localAnchorB;
-    jointDef.lengthA          = lengthA < 0.0f ? (pBodyA->GetWorldPoint( localAnchorA ) - worldGroundAnchorA).Length() : lengthA;
-    jointDef.lengthB          = lengthB < 0.0f ? (pBodyA->GetWorldPoint( localAnchorB ) - worldGroundAnchorB).Length() : lengthB;
-    jointDef.ratio            = ratio > b2_epsilon ? ratio : b2_epsilon + b2_epsilon;
-    
-    // Create joint.
-    return createJoint( &jointDef );
-}
-
-//-----------------------------------------------------------------------------
-
-S32 Scene::createTargetJoint(
-        const SceneObject* pSceneObject,
-        const b2Vec2& worldTarget,
-        const F32 maxForce,
-        const bool useCenterOfMass,
-        const F32 frequency,
-        const F32 dampingRatio,
-        const bool collideConnected )
-{
-    // Sanity!
-    if ( pSceneObject != NULL && pSceneObject->getScene() == NULL )
-    {
-        // Warn.
-        Con::printf( "Cannot add a joint to a scene object that is not in a scene." );
-        return -1;
-    }
-
-    // Check for invalid object.
-    if ( pSceneObject == NULL )
-    {
-        Con::warnf("Scene::createPulleyJoint() - Cannot create joint without a scene object." );
-        return -1;
-    }
-
-    // Fetch bodies.
-    b2Body* pBody = pSceneObject->getBody();
-    
-    // Populate definition.
-    b2MouseJointDef jointDef;
-    jointDef.userData         = static_cast<PhysicsProxy*>(this);
-    jointDef.collideConnected = collideConnected;
-    jointDef.bodyA            = getGroundBody();
-    jointDef.bodyB            = pBody;
-    jointDef.target           = useCenterOfMass ? pBody->GetWorldCenter() : worldTarget;
-    jointDef.maxForce         = maxForce;
-    jointDef.frequencyHz      = frequency;
-    jointDef.dampingRatio     = dampingRatio;
-
-    // Create joint.
-    const U32 jointId = createJoint( &jointDef );
-
-    // Cast joint.
-    b2MouseJoint* pRealJoint = static_cast<b2MouseJoint*>( findJoint( jointId ) );
-
-    // Are we using the center of mass?
-    if ( !useCenterOfMass )
-    {
-        // No, so set the target as the world target.
-        // NOTE:-   This is done because initially the target (mouse) joint assumes the target 
-        //          coincides with the body anchor.
-        pRealJoint->SetTarget( worldTarget );
-    }
-
-    return jointId;
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::setTargetJointTarget(
-        const U32 jointId,
-        const b2Vec2& worldTarget )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_mouseJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return;
-    }
-
-    // Cast joint.
-    b2MouseJoint* pRealJoint = static_cast<b2MouseJoint*>( pJoint );
-
-    // Access joint.
-    pRealJoint->SetTarget( worldTarget );
-}
-
-//-----------------------------------------------------------------------------
-b2Vec2 Scene::getTargetJointTarget( const U32 jointId )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return b2Vec2_zero;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_mouseJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return b2Vec2_zero;
-    }
-
-    // Cast joint.
-    b2MouseJoint* pRealJoint = static_cast<b2MouseJoint*>( pJoint );
-
-    // Access joint.
-    return pRealJoint->GetTarget();
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::setTargetJointMaxForce(
-        const U32 jointId,
-        const F32 maxForce )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_mouseJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return;
-    }
-
-    // Cast joint.
-    b2MouseJoint* pRealJoint = static_cast<b2MouseJoint*>( pJoint );
-
-    // Access joint.
-    pRealJoint->SetMaxForce( maxForce );
-}
-
-//-----------------------------------------------------------------------------
-
-F32 Scene::getTargetJointMaxForce( const U32 jointId )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return -1.0f;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_mouseJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return -1.0f;
-    }
-
-    // Cast joint.
-    b2MouseJoint* pRealJoint = static_cast<b2MouseJoint*>( pJoint );
-
-    // Access joint.
-    return pRealJoint->GetMaxForce();
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::setTargetJointFrequency(
-        const U32 jointId,
-        const F32 frequency )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_mouseJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return;
-    }
-
-    // Cast joint.
-    b2MouseJoint* pRealJoint = static_cast<b2MouseJoint*>( pJoint );
-
-    // Access joint.
-    pRealJoint->SetFrequency( frequency );
-}
-
-//-----------------------------------------------------------------------------
-
-F32 Scene::getTargetJointFrequency( const U32 jointId )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return -1.0f;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_mouseJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return -1.0f;
-    }
-
-    // Cast joint.
-    b2MouseJoint* pRealJoint = static_cast<b2MouseJoint*>( pJoint );
-
-    // Access joint.
-    return pRealJoint->GetFrequency();
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::setTargetJointDampingRatio(
-        const U32 jointId,
-        const F32 dampingRatio )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_mouseJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return;
-    }
-
-    // Cast joint.
-    b2MouseJoint* pRealJoint = static_cast<b2MouseJoint*>( pJoint );
-
-    // Access joint.
-    pRealJoint->SetDampingRatio( dampingRatio );
-}
-
-//-----------------------------------------------------------------------------
-
-F32 Scene::getTargetJointDampingRatio( const U32 jointId )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return -1.0f;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_mouseJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return -1.0f;
-    }
-
-    // Cast joint.
-    b2MouseJoint* pRealJoint = static_cast<b2MouseJoint*>( pJoint );
-
-    // Access joint.
-    return pRealJoint->GetDampingRatio();
-}
-
-//-----------------------------------------------------------------------------
-
-S32 Scene::createMotorJoint(
-            const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
-            const b2Vec2 linearOffset,
-            const F32 angularOffset,
-            const F32 maxForce,
-            const F32 maxTorque,
-            const F32 correctionFactor,
-            const bool collideConnected )
-{
-    // Sanity!
-    if (    (pSceneObjectA != NULL && pSceneObjectA->getScene() == NULL) ||
-            (pSceneObjectB != NULL && pSceneObjectB->getScene() == NULL) )
-    {
-        // Warn.
-        Con::printf( "Cannot add a joint to a scene object that is not in a scene." );
-        return -1;
-    }
-
-    // Check for two invalid objects.
-    if ( pSceneObjectA == NULL && pSceneObjectB == NULL )
-    {
-        Con::warnf("Scene::createMotorJoint() - Cannot create joint without at least a single scene object." );
-        return -1;
-    }
-
-    // Fetch bodies.
-    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getBody() : getGroundBody();
-    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getBody() : getGroundBody();
-    
-    // Populate definition.
-    b2MotorJointDef jointDef;
-    jointDef.userData           = static_cast<PhysicsProxy*>(this);
-    jointDef.collideConnected   = collideConnected;
-    jointDef.bodyA              = pBodyA;
-    jointDef.bodyB              = pBodyB;
-    jointDef.linearOffset       = linearOffset;
-    jointDef.angularOffset      = angularOffset;
-    jointDef.correctionFactor   = correctionFactor;
-    jointDef.maxForce           = maxForce;
-    jointDef.maxTorque          = maxTorque;
-    
-    // Create joint.
-    return createJoint( &jointDef );
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::setMotorJointLinearOffset(
-        const U32 jointId,
-        const b2Vec2& linearOffset )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_motorJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return;
-    }
-
-    // Cast joint.
-    b2MotorJoint* pRealJoint = static_cast<b2MotorJoint*>( pJoint );
-
-    // Access joint.
-    pRealJoint->SetLinearOffset( linearOffset );
-}
-
-//-----------------------------------------------------------------------------
-
-b2Vec2 Scene::getMotorJointLinearOffset( const U32 jointId )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return b2Vec2_zero;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_motorJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return b2Vec2_zero;
-    }
-
-    // Cast joint.
-    b2MotorJoint* pRealJoint = static_cast<b2MotorJoint*>( pJoint );
-
-    // Access joint.
-    return pRealJoint->GetLinearOffset();
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::setMotorJointAngularOffset(
-        const U32 jointId,
-        const F32 angularOffset )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_motorJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return;
-    }
-
-    // Cast joint.
-    b2MotorJoint* pRealJoint = static_cast<b2MotorJoint*>( pJoint );
-
-    // Access joint.
-    pRealJoint->SetAngularOffset( angularOffset );
-}
-
-//-----------------------------------------------------------------------------
-
-F32 Scene::getMotorJointAngularOffset( const U32 jointId )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return -1.0f;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_motorJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return -1.0f;
-    }
-
-    // Cast joint.
-    b2MotorJoint* pRealJoint = static_cast<b2MotorJoint*>( pJoint );
-
-    // Access joint.
-    return pRealJoint->GetAngularOffset();
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::setMotorJointMaxForce(
-        const U32 jointId,
-        const F32 maxForce )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_motorJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return;
-    }
-
-    // Cast joint.
-    b2MotorJoint* pRealJoint = static_cast<b2MotorJoint*>( pJoint );
-
-    // Access joint.
-    pRealJoint->SetMaxForce( maxForce );
-}
-
-//-----------------------------------------------------------------------------
-
-F32 Scene::getMotorJointMaxForce( const U32 jointId )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return -1.0f;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_motorJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return -1.0f;
-    }
-
-    // Cast joint.
-    b2MotorJoint* pRealJoint = static_cast<b2MotorJoint*>( pJoint );
-
-    // Access joint.
-    return pRealJoint->GetMaxForce();
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::setMotorJointMaxTorque(
-        const U32 jointId,
-        const F32 maxTorque )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_motorJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return;
-    }
-
-    // Cast joint.
-    b2MotorJoint* pRealJoint = static_cast<b2MotorJoint*>( pJoint );
-
-    // Access joint.
-    pRealJoint->SetMaxTorque( maxTorque );
-}
-
-
-//-----------------------------------------------------------------------------
-
-F32 Scene::getMotorJointMaxTorque( const U32 jointId )
-{
-    // Fetch joint.
-    b2Joint* pJoint = findJoint( jointId );
-
-    // Ignore invalid joint.
-    if ( !pJoint )
-        return -1.0f;
-
-    // Fetch joint type.
-    const b2JointType jointType = pJoint->GetType();
-
-    if ( jointType != e_motorJoint )
-    {
-        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
-        return -1.0f;
-    }
-
-    // Cast joint.
-    b2MotorJoint* pRealJoint = static_cast<b2MotorJoint*>( pJoint );
-
-    // Access joint.
-    return pRealJoint->GetMaxTorque();
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::setDebugSceneObject( SceneObject* pSceneObject )
-{
-    // Ignore no change.
-    if ( mpDebugSceneObject == pSceneObject )
-        return;
-
-    // Remove delete notification for existing monitored object.
-    if ( mpDebugSceneObject != NULL )
-        clearNotify( mpDebugSceneObject );
-
-    // Set monitored scene object.
-    mpDebugSceneObject = pSceneObject;
-
-    // Finish if resetting monitored object.
-    if ( pSceneObject == NULL )
-        return;
-
-    // Add delete notification for new monitored object.
-    deleteNotify( pSceneObject );
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::setLayerSortMode( const U32 layer, const SceneRenderQueue::RenderSort sortMode )
-{
-    // Is the layer valid?
-    if ( layer > MAX_LAYERS_SUPPORTED )
-    {
-        // No, so warn.
-        Con::warnf( "Scene::setLayerSortMode() - Layer '%d' is out of range.", layer );
-
-        return;
-    }
-
-    // Is the sort mode valid?
-    if ( sortMode == SceneRenderQueue::RENDER_SORT_INVALID )
-    {
-        // No, so warn.
-        Con::warnf( "Scene::setLayerSortMode() - Sort mode is invalid for layer '%d'.", layer );
-
-        return;
-    }
-
-    mLayerSortModes[layer] = sortMode;
-}
-
-//-----------------------------------------------------------------------------
-
-SceneRenderQueue::RenderSort Scene::getLayerSortMode( const U32 layer )
-{
-    // Is the layer valid?
-    if ( layer > MAX_LAYERS_SUPPORTED )
-    {
-        // No, so warn.
-        Con::warnf( "Scene::getLayerSortMode() - Layer '%d' is out of range.", layer );
-
-        return SceneRenderQueue::RENDER_SORT_INVALID;
-    }
-
-    return mLayerSortModes[layer];
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::attachSceneWindow( SceneWindow* pSceneWindow2D )
-{
-    // Ignore if already attached.
-    if ( isSceneWindowAttached( pSceneWindow2D ) )
-        return;
-
-    // Add to Attached List.
-    mAttachedSceneWindows.addObject( pSceneWindow2D );
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::detachSceneWindow( SceneWindow* pSceneWindow2D )
-{
-    // Ignore if not attached.
-    if ( !isSceneWindowAttached( pSceneWindow2D ) )
-        return;
-
-    // Add to Attached List.
-    mAttachedSceneWindows.removeObject( pSceneWindow2D );
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::detachAllSceneWindows( void )
-{
-    // Detach All Scene Windows.
-    while( mAttachedSceneWindows.size() > 0 )
-        dynamic_cast<SceneWindow*>(mAttachedSceneWindows[mAttachedSceneWindows.size()-1])->resetScene();
-}
-
-//-----------------------------------------------------------------------------
-
-bool Scene::isSceneWindowAttached( SceneWindow* pSceneWindow2D )
-{
-    for( SimSet::iterator itr = mAttachedSceneWindows.begin(); itr != mAttachedSceneWindows.end(); itr++ )
-        if ( pSceneWindow2D == dynamic_cast<SceneWindow*>(*itr) )
-            // Found.
-            return true;
-
-    // Not Found.
-    return false;
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::addDeleteRequest( SceneObject* pSceneObject )
-{
-    // Ignore if it's already being safe-deleted.
-    if ( pSceneObject->isBeingDeleted() )
-        return;
-
-    // Populate Delete Request.
-    tDeleteRequest deleteRequest = { pSceneObject->getId(), NULL, false };
-
-    // Push Delete Request.
-    mDeleteRequests.push_back( deleteRequest );
-
-    // Flag Delete in Progress.
-    pSceneObject->mBeingSafeDeleted = true;
-}
-
-
-//-----------------------------------------------------------------------------
-
-void Scene::processDeleteRequests( const bool forceImmediate )
-{
-    // Ignore if there's no delete requests!
-    if ( mDeleteRequests.size() == 0 )
-        return;
-
-    // Validate All Delete Requests.
-    U32 safeDeleteReadyCount = 0;
-    for ( U32 requestIndex = 0; requestIndex < (U32)mDeleteRequests.size(); )
-    {
-        // Fetch Reference to Delete Request.
-        tDeleteRequest& deleteRequest = mDeleteRequests[requestIndex];
-
-        // Fetch Object.
-        // NOTE:- Let's be safer and check that it's definitely a scene-object.
-        SceneObject* pSceneObject = dynamic_cast<SceneObject*>( Sim::findObject( deleteRequest.mObjectId ) );
-
-        // Does this object exist?
-        if ( pSceneObject )
-        {
-            // Yes, so write object.
-            deleteRequest.mpSceneObject = pSceneObject;
-
-            // Calculate Safe-Ready Flag.
-            deleteRequest.mSafeDeleteReady = forceImmediate || pSceneObject->getSafeDelete();
-
-            // Is it ready to safe-delete?
-            if ( deleteRequest.mSafeDeleteReady )
-            {
-                // Yes, so increase safe-ready count.
-                ++safeDeleteReadyCount;
-            }         
-        }
-        else
-        {
-            // No, so it looks like the object got deleted prematurely; let's just remove
-            // the request instead.
-            mDeleteRequests.erase_fast( requestIndex );
-            
-            // Repeat this item.
-            continue;
-        }
-
-        // Skip to next request index.
-        ++requestIndex;
-    }
-
-    // Stop if there's no delete requests!
-    if ( mDeleteRequests.size() == 0 )
-        return;
-
-    // Transfer Delete-Requests to Temporary version.
-    // NOTE:-   We do this because we may delete objects which have dependencies.  This would
-    //          cause objects to be added to the safe-delete list.  We don't want to work on
-    //          the list whilst this is happening so we'll transfer it to a temporary list.
-    mDeleteRequestsTemp = mDeleteRequests;
-
-    // Can we process all remaining delete-requests?
-    if ( safeDeleteReadyCount == (U32)mDeleteRequestsTemp.size() )
-    {
-        // Yes, so process ALL safe-ready delete-requests.
-        for ( U32 requestIndex = 0; requestIndex < (U32)mDeleteRequestsTemp.size(); ++requestIndex )
-        {
-            // Yes, so fetch object.
-            SceneObject* pSceneObject = mDeleteRequestsTemp[requestIndex].mpSceneObject;
-
-            // Do script callback.
-            Con::executef(this, 2, "onSafeDelete", pSceneObject->getIdString() );
-
-            // Destroy the object.
-            pSceneObject->deleteObject();
-        }
-
-        // Remove All delete-requests.
-        mDeleteRequestsTemp.clear();
-    }
-    else
-    {
-        // No, so process only safe-ready delete-requests.
-        for ( U32 requestIndex = 0; requestIndex <(U32) mDeleteRequestsTemp.size(); )
-        {
-            // Fetch Reference to Delete Request.
-            tDeleteRequest& deleteRequest = mDeleteRequestsTemp[requestIndex];
-
-            // Is the Object Safe-Ready?
-            if ( deleteRequest.mSafeDeleteReady )
-            {
-                // Yes, so fetch object.
-                SceneObject* pSceneObject = deleteRequest.mpSceneObject;
-
-                // Do script callback.
-                Con::executef(this, 2, "onSafeDelete", pSceneObject->getIdString() );
-
-                // Destroy the object.
-                pSceneObject->deleteObject();
-
-                // Quickly remove delete-request.
-                mDeleteRequestsTemp.erase_fast( requestIndex );
-
-                // Repeat this item.
-                continue;
-            }
-
-            // Skip to next request index.
-            ++requestIndex;
-        }
-    }
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::SayGoodbye( b2Joint* pJoint )
-{
-    // Find the joint id.
-    const U32 jointId = findJointId( pJoint );
-
-    // Ignore a bad joint.
-    if ( jointId == 0 )
-        return;
-
-    // Remove joint references.
-    mJoints.erase( jointId );
-    mReverseJoints.erase( pJoint );
-}
-
-//-----------------------------------------------------------------------------
-
-SceneObject* Scene::create( const char* pType )
-{
-    // Sanity!
-    AssertFatal( pType != NULL, "Scene::create() - Cannot create a NULL type." );
-
-    // Find the class rep.
-    AbstractClassRep* pClassRep = AbstractClassRep::findClassRep( pType ); 
-
-    // Did we find the type?
-    if ( pClassRep == NULL )
-    {
-        // No, so warn.
-        Con::warnf( "Scene::create() - Could not find type '%s' to create.", pType );
-        return NULL;
-    }
-
-    // Find the scene object rep.
-    AbstractClassRep* pSceneObjectRep = AbstractClassRep::findClassRep( "SceneObject" ); 
-
-    // Sanity!
-    AssertFatal( pSceneObjectRep != NULL,  "Scene::create() - Could not find SceneObject class rep." );
-
-    // Is the type derived from scene object?
-    if ( !pClassRep->isClass( pSceneObjectRep ) )
-    {
-        // No, so warn.
-        Con::warnf( "Scene::create() - Type '%s' is not derived from SceneObject.", pType );
-        return NULL;
-    }
-    
-    // Create the type.
-    SceneObject* pSceneObject = dynamic_cast<SceneObject*>( pClassRep->create() );
-
-    // Sanity!
-    AssertFatal( pSceneObject != NULL, "Scene::create() - Failed to create type via class rep." );
-
-    // Attempt to register the object.
-    if ( !pSceneObject->registerObject() )
-    {
-        // No, so warn.
-        Con::warnf( "Scene::create() - Failed to register type '%s'.", pType );
-        delete pSceneObject;
-        return NULL;
-    }
-
-    // Add to the scene.
-    addToScene( pSceneObject );
-
-    return pSceneObject;
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::onTamlPreRead( void )
-{
-    // Call parent.
-    Parent::onTamlPreRead();
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::onTamlPostRead( const TamlCustomNodes& customNodes )
-{
-    // Call parent.
-    Parent::onTamlPostRead( customNodes );
-
-    // Reset the loading scene.
-    Scene::LoadingScene = NULL;
-
-    // Find joint custom node.
-    const TamlCustomNode* pJointNode = customNodes.findNode( jointCustomNodeName );
-
-    // Do we have any joints?
-    if ( pJointNode != NULL )
-    {
-        // Yes, so fetch children joint nodes.
-        const TamlCustomNodeVector& jointChildren = pJointNode->getChildren();
-
-        // Iterate joints.
-        for( TamlCustomNodeVector::const_iterator jointNodeItr = jointChildren.begin(); jointNodeItr != jointChildren.end(); ++jointNodeItr )
-        {
-            // Fetch joint node,
-            TamlCustomNode* pJointNode = *jointNodeItr;
-
-            // Fetch node name.
-            StringTableEntry nodeName = pJointNode->getNodeName();
-
-            // Is this a distance joint?
-            if ( nodeName == jointDistanceNodeName )
-            {
-                // Fetch joint children.
-                const TamlCustomNodeVector& jointChildren = pJointNode->getChildren();
-
-                // Fetch joint objects.
-                SceneObject* pSceneObjectA = jointChildren.size() > 0 ? jointChildren[0]->getProxyObject<SceneObject>(true) : NULL;
-                SceneObject* pSceneObjectB = jointChildren.size() == 2 ? jointChildren[1]->getProxyObject<SceneObject>(true) : NULL;
-
-                // Did we get any connected objects?
-                if( pSceneObjectA == NULL && pSceneObjectB == NULL )
-                {
-                    // No, so warn.
-                    Con::warnf( "Scene::onTamlPostRead() - Encountered a joint '%s' but it has invalid connected objects.", nodeName );
-                    continue;
-                }
-
-                b2Vec2 localAnchorA = b2Vec2_zero;
-                b2Vec2 localAnchorB = b2Vec2_zero;
-                bool collideConnected = false;
-
-                F32 length = -1.0f;
-                F32 frequency = 0.0f;
-                F32 dampingRatio = 0.0f;
-
-                // Fetch joint fields.
-                const TamlCustomFieldVector& jointFields = pJointNode->getFields();
-
-                // Iterate property fields.
-                for ( TamlCustomFieldVector::const_iterator jointFieldItr = jointFields.begin(); jointFieldItr != jointFields.end(); ++jointFieldItr )
-                {
-                    // Fetch field node.
-                    TamlCustomField* pField = *jointFieldItr;
-
-                    // Fetch property field name.
-                    StringTableEntry fieldName = pField->getFieldName();
-
-                    // Fetch fields.
-                    if ( fieldName == jointLocalAnchorAName )
-                    {
-                        pField->getFieldValue( localAnchorA );
-                    }
-                    else if ( fieldName == jointLocalAnchorBName )
-                    {
-                        pField->getFieldValue( localAnchorB );
-                    }
-                    else if ( fieldName == jointCollideConnectedName )
-                    {
-                        pField->getFieldValue( collideConnected );
-                    }
-                    else if ( fieldName == jointDistanceLengthName )
-                    {
-                        pField->getFieldValue( length );
-                    }
-                    else if ( fieldName == jointDistanceFrequencyName )
-                    {
-                        pField->getFieldValue( frequency );
-                    }
-                    else if ( fieldName == jointDistanceDampingRatioName )
-                    {
-                        pField->getFieldValue( dampingRatio );
-                    }
-                }
-
-                // Create joint.
-                createDistanceJoint( pSceneObjectA, pSceneObjectB, localAnchorA, localAnchorB, length, frequency, dampingRatio, collideConnected );
-            }
-            // is this a rope joint?
-            else if ( nodeName == jointRopeNodeName )
-            {
-                // Fetch joint children.
-                const TamlCustomNodeVector& jointChildren = pJointNode->getChildren();
-
-                // Fetch joint objects.
-                SceneObject* pSceneObjectA = jointChildren.size() > 0 ? jointChildren[0]->getProxyObject<SceneObject>(true) : NULL;
-                SceneObject* pSceneObjectB = jointChildren.size() == 2 ? jointChildren[1]->getProxyObject<SceneObject>(true) : NULL;
-
-                // Did we get any connected objects?
-                if( pSceneObjectA == NULL && pSceneObjectB == NULL )
-                {
-                    // No, so warn.
-                    Con::warnf( "Scene::onTamlPostRead() - Encountered a joint '%s' but it has invalid connected objects.", nodeName );
-                    continue;
-                }
-
-                b2Vec2 localAnchorA = b2Vec2_zero;
-                b2Vec2 localAnchorB = b2Vec2_zero;
-                bool collideConnected = false;
-
-                F32 maxLength = -1.0f;
-
-                // Fetch joint fields.
-                const TamlCustomFieldVector& jointFields = pJointNode->getFields();
-
-                // Iterate property fields.
-                for ( TamlCustomFieldVector::const_iterator jointFieldItr = jointFields.begin(); jointFieldItr != jointFields.end(); ++jointFieldItr )
-                {
-                    // Fetch field node.
-                    TamlCustomField* pField = *jointFieldItr;
-
-                    // Fetch property field name.
-                    StringTableEntry fieldName = pField->getFieldName();
-
-                    // Fetch fields.
-                    if ( fieldName == jointLocalAnchorAName )
-                    {
-                        pField->getFieldValue( localAnchorA );
-                    }
-                    else if ( fieldName == jointLocalAnchorBName )
-                    {
-                        pField->getFieldValue( localAnchorB );
-                    }
-                    else if ( fieldName == jointCollideConnectedName )
-                    {
-                        pField->getFieldValue( collideConnected );
-                    }
-                    else if ( fieldName == jointRopeMaxLengthName )
-                    {
-                        pField->getFieldValue( maxLength );
-                    }
-                }
-
-                // Create joint.
-                createRopeJoint( pSceneObjectA, pSceneObjectB, localAnchorA, localAnchorB, maxLength, collideConnected );
-            }
-            // Is this a revolute joint?
-            else if ( nodeName == jointRevoluteNodeName )
-            {
-                // Fetch joint children.
-                const TamlCustomNodeVector& jointChildren = pJointNode->getChildren();
-
-                // Fetch joint objects.
-                SceneObject* pSceneObjectA = jointChildren.size() > 0 ? jointChildren[0]->getProxyObject<SceneObject>(true) : NULL;
-                SceneObject* pSceneObjectB = jointChildren.size() == 2 ? jointChildren[1]->getProxyObject<SceneObject>(true) : NULL;
-
-                // Did we get any connected objects?
-                if( pSceneObjectA == NULL && pSceneObjectB == NULL )
-                {
-                    // No, so warn.
-                    Con::warnf( "Scene::onTamlPostRead() - Encountered a joint '%s' but it has invalid connected objects.", nodeName );
-                    continue;
-                }
-
-                b2Vec2 localAnchorA = b2Vec2_zero;
-                b2Vec2 localAnchorB = b2Vec2_zero;
-                bool collideConnected = false;
-
-                bool enableLimit = false;
-                F32 lowerAngle = 0.0f;
-                F32 upperAngle = 0.0f;
-
-                bool enableMotor = false;
-                F32 motorSpeed = b2_pi;
-                F32 maxMotorTorque = 0.0f;
-
-                // Fetch joint fields.
-                const TamlCustomFieldVector& jointFields = pJointNode->getFields();
-
-                // Iterate property fields.
-                for ( TamlCustomFieldVector::const_iterator jointFieldItr = jointFields.begin(); jointFieldItr != jointFields.end(); ++jointFieldItr )
-                {
-                    // Fetch field node.
-                    TamlCustomField* pField = *jointFieldItr;
-
-                    // Fetch property field name.
-                    StringTableEntry fieldName = pField->getFieldName();
-
-                    // Fetch fields.
-                    if ( fieldName == jointLocalAnchorAName )
-                    {
-                        pField->getFieldValue( localAnchorA );
-                    }
-                    else if ( fieldName == jointLocalAnchorBName )
-                    {
-                        pField->getFieldValue( localAnchorB );
-                    }
-                    else if ( fieldName == jointCollideConnectedName )
-                    {
-                        pField->getFieldValue( collideConnected );
-                    }
-                    else if ( fieldName == jointRevoluteLimitLowerAngleName )
-                    {
-                        pField->getFieldValue( lowerAngle );
-                        lowerAngle = mDegToRad( lowerAngle );
-                        enableLimit = true;
-                    }
-                    else if ( fieldName == jointRevoluteLimitUpperAngleName )
-                    {
-                        pField->getFieldValue( upperAngle );
-                        upperAngle = mDegToRad( upperAngle );
-                        enableLimit = true;
-                    }
-                    else if ( fieldName == jointRevoluteMotorSpeedName )
-                    {
-                        pField->getFieldValue( motorSpeed );
-                        motorSpeed = mDegToRad( motorSpeed );
-                        enableMotor = true;
-                    }
-                    else if ( fieldName == jointRevoluteMotorMaxTorqueName )
-                    {
-                        pField->getFieldValue( maxMotorTorque );
-                        enableMotor = true;
-                    }
-                }
-
-                // Create joint.
-                const U32 jointId = createRevoluteJoint( pSceneObjectA, pSceneObjectB, localAnchorA, localAnchorB, collideConnected );
-            
-                if ( enableLimit )
-                    setRevoluteJointLimit( jointId, true, lowerAngle, upperAngle );
-
-                if ( enableMotor )
-                    setRevoluteJointMotor( jointId, true, motorSpeed, maxMotorTorque );
-            }
-            // is this a weld joint?
-            else if ( nodeName == jointWeldNodeName )
-            {
-                // Fetch joint children.
-                const TamlCustomNodeVector& jointChildren = pJointNode->getChildren();
-
-                // Fetch joint objects.
-                SceneObject* pSceneObjectA = jointChildren.size() > 0 ? jointChildren[0]->getProxyObject<SceneObject>(true) : NULL;
-                SceneObject* pSceneObjectB = jointChildren.size() == 2 ? jointChildren[1]->getProxyObject<SceneObject>(true) : NULL;
-
-                // Did we get any connected objects?
-                if( pSceneObjectA == NULL && pSceneObjectB == NULL )
-                {
-                    // No, so warn.
-                    Con::warnf( "Scene::onTamlPostRead() - Encountered a joint '%s' but it has invalid connected objects.", nodeName );
-                    continue;
-                }
-
-                b2Vec2 localAnchorA = b2Vec2_zero;
-                b2Vec2 localAnchorB = b2Vec2_zero;
-                bool collideConnected = false;
-
-                F32 frequency = 0.0f;
-                F32 dampingRatio = 0.0f;
-
-                // Fetch joint fields.
-                const TamlCustomFieldVector& jointFields = pJointNode->getFields();
-
-                // Iterate property fields.
-                for ( TamlCustomFieldVector::const_iterator jointFieldItr = jointFields.begin(); jointFieldItr != jointFields.end(); ++jointFieldItr )
-                {
-                    // Fetch field node.
-                    TamlCustomField* pField = *jointFieldItr;
-
-                    // Fetch property field name.
-                    StringTableEntry fieldName = pField->getFieldName();
-
-                    // Fetch fields.
-                    if ( fieldName == jointLocalAnchorAName )
-                    {
-                        pField->getFieldValue( localAnchorA );
-                    }
-                    else if ( fieldName == jointLocalAnchorBName )
-                    {
-                        pField->getFieldValue( localAnchorB );
-                    }
-                    else if ( fieldName == jointCollideConnectedName )
-                    {
-                        pField->getFieldValue( collideConnected );
-                    }
-                    else if ( fieldName == jointWeldFrequencyName )
-                    {
-                        pField->getFieldValue( frequency );
-                    }
-                    else if ( fieldName == jointWeldDampingRatioName )
-                    {
-                        pField->getFieldValue( dampingRatio );
-                    }
-                }
-
-                // Create joint.
-                createWeldJoint( pSceneObjectA, pSceneObjectB, localAnchorA, localAnchorB, frequency, dampingRatio, collideConnected );
-            }
-            // Is this a wheel joint?
-            else if ( nodeName == jointWheelNodeName )
-            {
-                // Fetch joint children.
-                const TamlCustomNodeVector& jointChildren = pJointNode->getChildren();
-
-                // Fetch joint objects.
-                SceneObject* pSceneObjectA = jointChildren.size() > 0 ? jointChildren[0]->getProxyObject<SceneObject>(true) : NULL;
-                SceneObject* pSceneObjectB = jointChildren.size() == 2 ? jointChildren[1]->getProxyObject<SceneObject>(true) : NULL;
-
-                // Did we get any connected objects?
-                if( pSceneObjectA == NULL && pSceneObjectB == NULL )
-                {
-                    // No, so warn.
-                    Con::warnf( "Scene::onTamlPostRead() - Encountered a joint '%s' but it has invalid connected objects.", nodeName );
-                    continue;
-                }
-
-                b2Vec2 localAnchorA = b2Vec2_zero;
-                b2Vec2 localAnchorB = b2Vec2_zero;
-                bool collideConnected = false;
-
-                bool enableMotor = false;
-                F32 motorSpeed = b2_pi;
-                F32 maxMotorTorque = 0.0f;
-
-                F32 frequency = 0.0f;
-                F32 dampingRatio = 0.0f;
-                b2Vec2 worldAxis( 0.0f, 1.0f );
-
-                // Fetch joint fields.
-                const TamlCustomFieldVector& jointFields = pJointNode->getFields();
-
-                // Iterate property fields.
-                for ( TamlCustomFieldVector::const_iterator jointFieldItr = jointFields.begin(); jointFieldItr != jointFields.end(); ++jointFieldItr )
-                {
-                    // Fetch field node.
-                    TamlCustomField* pField = *jointFieldItr;
-
-                    // Fetch property field name.
-                    StringTableEntry fieldName = pField->getFieldName();
-
-                    // Fetch fields.
-                    if ( fieldName == jointLocalAnchorAName )
-                    {
-                        pField->getFieldValue( localAnchorA );
-                    }
-                    else if ( fieldName == jointLocalAnchorBName )
-                    {
-                        pField->getFieldValue( localAnchorB );
-                    }
-                    else if ( fieldName == jointCollideConnectedName )
-                    {
-                        pField->getFieldValue( collideConnected );
-                    }
-                    else if ( fieldName == jointWheelMotorSpeedName )
-                    {
-                        pField->getFieldValue( motorSpeed );
-                        motorSpeed = mDegToRad( motorSpeed );
-                        enableMotor = true;
-                    }
-                    else if ( fieldName == jointWheelMotorMaxTorqueName )
-                    {
-                        pField->getFieldValue( maxMotorTorque );
-                        enableMotor = true;
-                    }
-                    else if ( fieldName == jointWheelFrequencyName )
-                    {
-                        pField->getFieldValue( frequency );
-                    }
-                    else if ( fieldName == jointWheelDampingRatioName )
-                    {
-                        pField->getFieldValue( dampingRatio );
-                    }
-                    else if ( fieldName == jointWheelWorldAxisName )
-                    {
-                        pField->getFieldValue( worldAxis );                    
-                    }
-                }
-
-                // Create joint.
-                const U32 jointId = createWheelJoint( pSceneObjectA, pSceneObjectB, localAnchorA, localAnchorB, worldAxis, collideConnected );
-
-                if ( enableMotor )
-                    setWheelJointMotor( jointId, true, motorSpeed, maxMotorTorque );
-
-                setWheelJointFrequency( jointId, frequency );
-                setWheelJointDampingRatio( jointId, dampingRatio );
-            }
-            // Is this a friction joint?
-            else if ( nodeName == jointFrictionNodeName )
-            {
-                // Fetch joint children.
-                const TamlCustomNodeVector& jointChildren = pJointNode->getChildren();
-
-                // Fetch joint objects.
-                SceneObject* pSceneObjectA = jointChildren.size() > 0 ? jointChildren[0]->getProxyObject<SceneObject>(true) : NULL;
-                SceneObject* pSceneObjectB = jointChildren.size() == 2 ? jointChildren[1]->getProxyObject<SceneObject>(true) : NULL;
-
-                // Did we get any connected objects?
-                if( pSceneObjectA == NULL && pSceneObjectB == NULL )
-                {
-                    // No, so warn.
-                    Con::warnf( "Scene::onTamlPostRead() - Encountered a joint '%s' but it has invalid connected objects.", nodeName );
-                    continue;
-                }
-
-                b2Vec2 localAnchorA = b2Vec2_zero;
-                b2Vec2 localAnchorB = b2Vec2_zero;
-                bool collideConnected = false;
-
-                F32 maxForce = 0.0f;
-                F32 maxTorque = 0.0f;
-
-                // Fetch joint fields.
-                const TamlCustomFieldVector& jointFields = pJointNode->getFields();
-
-                // Iterate property fields.
-                for ( TamlCustomFieldVector::const_iterator jointFieldItr = jointFields.begin(); jointFieldItr != jointFields.end(); ++jointFieldItr )
-                {
-                    // Fetch field node.
-                    TamlCustomField* pField = *jointFieldItr;
-
-                    // Fetch property field name.
-                    StringTableEntry fieldName = pField->getFieldName();
-
-                    // Fetch fields.
-                    if ( fieldName == jointLocalAnchorAName )
-                    {
-                        pField->getFieldValue( localAnchorA );
-                    }
-                    else if ( fieldName == jointLocalAnchorBName )
-                    {
-                        pField->getFieldValue( localAnchorB );
-                    }
-                    else if ( fieldName == jointCollideConnectedName )
-                    {
-                        pField->getFieldValue( collideConnected );
-                    }
-                    else if ( fieldName == jointFrictionMaxForceName )
-                    {
-                        pField->getFieldValue( maxForce );
-                    }
-                    else if ( fieldName == jointFrictionMaxTorqueName )
-                    {
-                        pField->getFieldValue( maxTorque );
-                    }
-                }
-
-                // Create joint.
-                createFrictionJoint( pSceneObjectA, pSceneObjectB, localAnchorA, localAnchorB, maxForce, maxTorque, collideConnected );
-            }
-            // Is this a prismatic joint?
-            else if ( nodeName == jointPrismaticNodeName )
-            {
-                // Fetch joint children.
-                const TamlCustomNodeVector& jointChildren = pJointNode->getChildren();
-
-                // Fetch joint objects.
-                SceneObject* pSceneObjectA = jointChildren.size() > 0 ? jointChildren[0]->getProxyObject<SceneObject>(true) : NULL;
-                SceneObject* pSceneObjectB = jointChildren.size() == 2 ? jointChildren[1]->getProxyObject<SceneObject>(true) : NULL;
-
-                // Did we get any connected objects?
-                if( pSceneObjectA == NULL && pSceneObjectB == NULL )
-                {
-                    // No, so warn.
-                    Con::warnf( "Scene::onTamlPostRead() - Encountered a joint '%s' but it has invalid connected objects.", nodeName );
-                    continue;
-                }
-
-                b2Vec2 localAnchorA = b2Vec2_zero;
-                b2Vec2 localAnchorB = b2Vec2_zero;
-                bool collideConnected = false;
-
-                bool enableLimit;
-                F32 lowerTransLimit = 0.0f;
-                F32 upperTransLimit = 1.0f;
-
-                bool enableMotor = false;
-                F32 motorSpeed = b2_pi;
-                F32 maxMotorForce = 0.0f;
-
-                b2Vec2 worldAxis( 0.0f, 1.0f );
-
-                // Fetch joint fields.
-                const TamlCustomFieldVector& jointFields = pJointNode->getFields();
-
-                // Iterate property fields.
-                for ( TamlCustomFieldVector::const_iterator jointFieldItr = jointFields.begin(); jointFieldItr != jointFields.end(); ++jointFieldItr )
-                {
-                    // Fetch field node.
-                    TamlCustomField* pField = *jointFieldItr;
-
-                    // Fetch property field name.
-                    StringTableEntry fieldName = pField->getFieldName();
-
-                    // Fetch fields.
-                    if ( fieldName == jointLocalAnchorAName )
-                    {
-                        pField->getFieldValue( localAnchorA );
-                    }
-                    else if ( fieldName == jointLocalAnchorBName )
-                    {
-                        pField->getFieldValue( localAnchorB );
-                    }
-                    else if ( fieldName == jointCollideConnectedName )
-                    {
-                        pField->getFieldValue( collideConnected );
-                    }
-                    else if ( fieldName == jointPrismaticLimitLowerTransName )
-                    {
-                        pField->getFieldValue( lowerTransLimit );
-                        enableLimit = true;
-                    }
-                    else if ( fieldName == jointPrismaticLimitUpperTransName )
-                    {
-                        pField->getFieldValue( upperTransLimit );
-                        enableLimit = true;
-                    }
-                    else if ( fieldName == jointPrismaticMotorSpeedName )
-                    {
-                        pField->getFieldValue( motorSpeed );
-                        motorSpeed = mDegToRad( motorSpeed );
-                        enableMotor = true;
-                    }
-                    else if ( fieldName == jointPrismaticMotorMaxForceName )
-                    {
-                        pField->getFieldValue( maxMotorForce );
-                        enableMotor = true;
-                    }
-                    else if ( fieldName == jointPrismaticWorldAxisName )
-                    {
-                        pField->getFieldValue( worldAxis );
-                    }
-                }
-
-                // Create joint.
-                const U32 jointId = createPrismaticJoint( pSceneObjectA, pSceneObjectB, localAnchorA, localAnchorB, worldAxis, collideConnected );
-
-                if ( enableLimit )
-                    setPrismaticJointLimit( jointId, true, lowerTransLimit, upperTransLimit );
-
-                if ( enableMotor )
-                    setPrismaticJointMotor( jointId, true, motorSpeed, maxMotorForce );
-            }
-            // Is this a pulley joint?
-            else if ( nodeName == jointPulleyNodeName )
-            {
-                // Fetch joint children.
-                const TamlCustomNodeVector& jointChildren = pJointNode->getChildren();
-
-                // Fetch joint objects.
-                SceneObject* pSceneObjectA = jointChildren.size() > 0 ? jointChildren[0]->getProxyObject<SceneObject>(true) : NULL;
-                SceneObject* pSceneObjectB = jointChildren.size() == 2 ? jointChildren[1]->getProxyObject<SceneObject>(true) : NULL;
-
-                // Did we get any connected objects?
-                if( pSceneObjectA == NULL && pSceneObjectB == NULL )
-                {
-                    // No, so warn.
-                    Con::warnf( "Scene::onTamlPostRead() - Encountered a joint '%s' but it has invalid connected objects.", nodeName );
-                    continue;
-                }
-
-                b2Vec2 localAnchorA = b2Vec2_zero;
-                b2Vec2 localAnchorB = b2Vec2_zero;
-                bool collideConnected = false;
-
-                F32 lengthA = -1.0f;
-                F32 lengthB = -1.0f;
-                F32 ratio = 0.5f;
-                b2Vec2 worldGroundAnchorA = b2Vec2_zero;
-                b2Vec2 worldGroundAnchorB = b2Vec2_zero;
-
-                // Fetch joint fields.
-                const TamlCustomFieldVector& jointFields = pJointNode->getFields();
-
-                // Iterate property fields.
-                for ( TamlCustomFieldVector::const_iterator jointFieldItr = jointFields.begin(); jointFieldItr != jointFields.end(); ++jointFieldItr )
-                {
-                    // Fetch field node.
-                    TamlCustomField* pField = *jointFieldItr;
-
-                    // Fetch property field name.
-                    StringTableEntry fieldName = pField->getFieldName();
-
-                    // Fetch fields.
-                    if ( fieldName == jointLocalAnchorAName )
-                    {
-                        pField->getFieldValue( localAnchorA );
-                    }
-                    else if ( fieldName == jointLocalAnchorBName )
-                    {
-                        pField->getFieldValue( localAnchorB );
-                    }
-                    else if ( fieldName == jointCollideConnectedName )
-                    {
-                        pField->getFieldValue( collideConnected );
-                    }
-                    else if ( fieldName == jointPulleyLengthAName )
-                    {
-                        pField->getFieldValue( lengthA );
-                    }
-                    else if ( fieldName == jointPulleyLengthBName )
-                    {
-                        pField->getFieldValue( lengthB );
-                    }
-                    else if ( fieldName == jointPulleyRatioName )
-                    {
-                        pField->getFieldValue( ratio );
-                    }
-                    else if ( fieldName == jointPulleyGroundAnchorAName )
-                    {
-                        pField->getFieldValue( worldGroundAnchorA );
-                    }
-                    else if ( fieldName == jointPulleyGroundAnchorBName )
-                    {
-                        pField->getFieldValue( worldGroundAnchorB );
-                    }
-                }
-
-                // Create joint.
-                createPulleyJoint( pSceneObjectA, pSceneObjectB, localAnchorA, localAnchorB, worldGroundAnchorA, worldGroundAnchorB, ratio, lengthA, lengthB, collideConnected );
-
-            }
-            // Is this a target joint?
-            else if ( nodeName == jointTargetNodeName )
-            {
-                // Fetch joint children.
-                const TamlCustomNodeVector& jointChildren = pJointNode->getChildren();
-
-                // Fetch joint objects.
-                SceneObject* pSceneObject = jointChildren.size() == 1 ? jointChildren[0]->getProxyObject<SceneObject>(true) : NULL;
-
-                // Did we get any connected objects?
-                if( pSceneObject == NULL )
-                {
-                    // No, so warn.
-                    Con::warnf( "Scene::onTamlPostRead() - Encountered a joint '%s' but it has an invalid connected object.", nodeName );
-                    continue;
-                }
-
-                bool collideConnected = false;
-                b2Vec2 worldTarget = b2Vec2_zero;
-                F32 maxForce = 1.0f;
-                F32 frequency = 5.0f;
-                F32 dampingRatio = 0.7f;
-
-                // Fetch joint fields.
-                const TamlCustomFieldVector& jointFields = pJointNode->getFields();
-
-                // Iterate property fields.
-                for ( TamlCustomFieldVector::const_iterator jointFieldItr = jointFields.begin(); jointFieldItr != jointFields.end(); ++jointFieldItr )
-                {
-                    // Fetch field node.
-                    TamlCustomField* pField = *jointFieldItr;
-
-                    // Fetch property field name.
-                    StringTableEntry fieldName = pField->getFieldName();
-
-                    // Fetch fields.
-                    if ( fieldName == jointCollideConnectedName )
-                    {
-                        pField->getFieldValue( collideConnected );
-                    }
-                    else if ( fieldName == jointTargetWorldTargetName )
-                    {
-                        pField->getFieldValue( worldTarget );
-                    }
-                    else if ( fieldName == jointTargetMaxForceName )
-                    {
-                        pField->getFieldValue( maxForce );
-                    }
-                    else if ( fieldName == jointTargetFrequencyName )
-                    {
-                        pField->getFieldValue( frequency );
-                    }
-                    else if ( fieldName == jointTargetDampingRatioName )
-                    {
-                        pField->getFieldValue( dampingRatio );
-                    }
-                }
-
-                // Create joint.
-                createTargetJoint( pSceneObject, worldTarget, maxForce, frequency, dampingRatio, collideConnected );
-            }
-            // Is this a motor joint?
-            else if ( nodeName == jointMotorNodeName )
-            {
-                // Fetch joint children.
-                const TamlCustomNodeVector& jointChildren = pJointNode->getChildren();
-
-                // Fetch joint objects.
-                SceneObject* pSceneObjectA = jointChildren.size() > 0 ? jointChildren[0]->getProxyObject<SceneObject>(true) : NULL;
-                SceneObject* pSceneObjectB = jointChildren.size() == 2 ? jointChildren[1]->getProxyObject<SceneObject>(true) : NULL;
-
-                // Did we get any connected objects?
-                if( pSceneObjectA == NULL && pSceneObjectB == NULL )
-                {
-                    // No, so warn.
-                    Con::warnf( "Scene::onTamlPostRead() - Encountered a joint '%s' but it has invalid connected objects.", nodeName );
-                    continue;
-                }
-
-                bool collideConnected = false;
-
-                b2Vec2 linearOffset = b2Vec2_zero;
-                F32 angularOffset = 0.0f;
-                F32 maxForce = 1.0f;
-                F32 maxTorque = 1.0f;
-                F32 correctionFactor = 0.3f;
-
-                // Fetch joint fields.
-                const TamlCustomFieldVector& jointFields = pJointNode->getFields();
-
-                // Iterate property fields.
-                for ( TamlCustomFieldVector::const_iterator jointFieldItr = jointFields.begin(); jointFieldItr != jointFields.end(); ++jointFieldItr )
-                {
-                    // Fetch field node.
-                    TamlCustomField* pField = *jointFieldItr;
-
-                    // Fetch property field name.
-                    StringTableEntry fieldName = pField->getFieldName();
-
-                    // Fetch fields.
-                    if ( fieldName == jointCollideConnectedName )
-                    {
-                        pField->getFieldValue( collideConnected );
-                    }
-                    else if ( fieldName == jointMotorLinearOffsetName )
-                    {
-                        pField->getFieldValue( linearOffset );
-                    }
-                    else if ( fieldName == jointMotorAngularOffsetName )
-                    {
-                        pField->getFieldValue( angularOffset );
-                        angularOffset = mDegToRad( angularOffset );
-                    }
-                    else if ( fieldName == jointMotorMaxForceName )
-                    {
-                        pField->getFieldValue( maxForce );
-                    }
-                    else if ( fieldName == jointMotorMaxTorqueName )
-                    {
-                        pField->getFieldValue( maxTorque );
-                    }
-                    else if ( fieldName == jointMotorCorrectionFactorName )
-                    {
-                        pField->getFieldValue( correctionFactor );
-                    }
-                }
-
-                // Create joint.
-                createMotorJoint( pSceneObjectA, pSceneObjectB, linearOffset, angularOffset, maxForce, maxTorque, correctionFactor, collideConnected );
-
-            }
-            // Unknown joint type!
-            else
-            {
-                // Warn.
-                Con::warnf( "Unknown joint type of '%s' encountered.", nodeName );
-
-                // Sanity!
-                AssertFatal( false, "Scene::onTamlCustomRead() - Unknown joint type detected." );
-
-                continue;
-            }
-        }
-    }
-
-    // Find controller custom node.
-    const TamlCustomNode* pControllerCustomNode = customNodes.findNode( controllerCustomNodeName );
-
-    // Do we have any controllers?
-    if ( pControllerCustomNode != NULL )
-    {
-        // Yes, so fetch the scene controllers.
-        SimSet* pControllerSet = getControllers();
-
-        // Fetch children controller nodes.
-        const TamlCustomNodeVector& controllerChildren = pControllerCustomNode->getChildren();
-
-        // Iterate controllers.
-        for( TamlCustomNodeVector::const_iterator controllerNodeItr = controllerChildren.begin(); controllerNodeItr != controllerChildren.end(); ++controllerNodeItr )
-        {
-            // Fetch controller node.
-            TamlCustomNode* pControllerNode = *controllerNodeItr;
-            
-            // Is the node a proxy object?
-            if ( !pControllerNode->isProxyObject() )
-            {
-                // No, so warn.
-                Con::warnf("Scene::onTamlPostRead() - Reading scene controllers but node '%s'is not an object.", pControllerNode->getNodeName() );
-
-                continue;
-            }
-
-            // Add the proxy object.
-            SimObject* pProxyObject = pControllerNode->getProxyObject<SimObject>(false);
-
-            // Is it a scene controller?
-            if ( dynamic_cast<SceneController*>( pProxyObject ) == NULL )
-            {
-                // No, so warn.
-                Con::warnf("Scene::onTamlPostRead() - Reading scene controllers but node '%s'is not a scene controller.", pControllerNode->getNodeName() );
-
-                // Delete the object.
-                pProxyObject->deleteObject();
-
-                continue;
-            }
-
-            // Add to scene controllers.
-            pControllerSet->addObject( pProxyObject );
-        }
-    }
-
-    // Find asset preload custom node.
-    const TamlCustomNode* pAssetPreloadNode = customNodes.findNode( assetPreloadNodeName );
-
-    // Do we have any asset preloads?
-    if ( pAssetPreloadNode != NULL )
-    {
-        // Yes, so clear any existing asset preloads.
-        clearAssetPreloads();
-
-        // Yes, so fetch asset Id type prefix.
-        StringTableEntry assetIdTypePrefix = ConsoleBaseType::getType( TypeAssetId )->getTypePrefix();
-
-        // Fetch the prefix length.
-        const S32 assetIdPrefixLength = dStrlen( assetIdTypePrefix );
-
-        // Fetch the preload children nodes.
-        const TamlCustomNodeVector& preloadChildren = pAssetPreloadNode->getChildren();
-
-        // Iterate asset preloads.
-        for( TamlCustomNodeVector::const_iterator assetPreloadNodeItr = preloadChildren.begin(); assetPreloadNodeItr != preloadChildren.end(); ++assetPreloadNodeItr )
-        {
-            // Fetch asset node.
-            const TamlCustomNode* pAssetNode = *assetPreloadNodeItr;
-
-            // Ignore non-asset nodes.
-            if ( pAssetNode->getNodeName() != assetNodeName )
-                continue;
-
-            // Find the asset Id field.
-            const TamlCustomField* pAssetIdField = pAssetNode->findField( "Id" );
-
-            // Did we find the field?
-            if ( pAssetIdField == NULL )
-            {
-                // No, so warn.
-                Con::warnf("Scene::onTamlPostRead() - Found asset preload but failed to find asset Id field." );
-                continue;
-            }
-
-            // Fetch field value.
-            const char* pFieldValue = pAssetIdField->getFieldValue();
-
-            // Calculate the field value start (skip any type prefix).
-            const S32 prefixOffset = dStrnicmp( pFieldValue, assetIdTypePrefix, assetIdPrefixLength ) == 0 ? assetIdPrefixLength : 0;
-
-            // Add asset preload.
-            addAssetPreload( pFieldValue + prefixOffset );
-        }
-    }   
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::onTamlCustomWrite( TamlCustomNodes& customNodes )
-{
-    // Call parent.
-    Parent::onTamlCustomWrite( customNodes );
-
-    // Fetch joint count.
-    const U32 jointCount = getJointCount();
-
-    // Do we have any joints?
-    if ( jointCount > 0 )
-    {
-        // Yes, so add joint custom node.
-        TamlCustomNode* pJointCustomNode = customNodes.addNode( jointCustomNodeName );
-
-        // Iterate joints.
-        for( typeJointHash::iterator jointItr = mJoints.begin(); jointItr != mJoints.end(); ++jointItr )
-        {
-            // Fetch base joint.
-            b2Joint* pBaseJoint = jointItr->value;
-
-            // Add joint node.
-            // NOTE:    The name of the node will get updated shortly.
-            TamlCustomNode* pJointNode = pJointCustomNode->addNode( StringTable->EmptyString );
-
-            // Fetch common details.
-            b2Body* pBodyA = pBaseJoint->GetBodyA();
-            b2Body* pBodyB = pBaseJoint->GetBodyB();
-
-            // Fetch physics proxies.
-            PhysicsProxy* pPhysicsProxyA = static_cast<PhysicsProxy*>(pBodyA->GetUserData());
-            PhysicsProxy* pPhysicsProxyB = static_cast<PhysicsProxy*>(pBodyB->GetUserData());
-
-            // Fetch physics proxy type.
-            PhysicsProxy::ePhysicsProxyType proxyTypeA = static_cast<PhysicsProxy*>(pBodyA->GetUserData())->getPhysicsProxyType();
-            PhysicsProxy::ePhysicsProxyType proxyTypeB = static_cast<PhysicsProxy*>(pBodyB->GetUserData())->getPhysicsProxyType();
-
-            // Fetch scene objects.
-            SceneObject* pSceneObjectA = proxyTypeA == PhysicsProxy::PHYSIC_PROXY_SCENEOBJECT ? static_cast<SceneObject*>(pPhysicsProxyA) : NULL;
-            SceneObject* pSceneObjectB = proxyTypeB == PhysicsProxy::PHYSIC_PROXY_SCENEOBJECT ? static_cast<SceneObject*>(pPhysicsProxyB) : NULL;
-
-            // Populate joint appropriately.
-            switch( pBaseJoint->GetType() )
-            {
-                case e_distanceJoint:
-                    {
-                        // Set joint name.
-                        pJointNode->setNodeName( jointDistanceNodeName );
-
-                        // Fetch joint.
-                        const b2DistanceJoint* pJoint = dynamic_cast<const b2DistanceJoint*>( pBaseJoint );
-
-                        // Sanity!
-                        AssertFatal( pJoint != NULL, "Scene::onTamlCustomWrite() - Invalid distance joint type returned." );
-
-                        // Add length.
-                        pJointNode->addField( jointDistanceLengthName, pJoint->GetLength() );
-
-                        // Add frequency.
-                        if ( mNotZero( pJoint->GetFrequency() ) )
-                            pJointNode->addField( jointDistanceFrequencyName, pJoint->GetFrequency() );
-
-                        // Add damping ratio.
-                        if ( mNotZero( pJoint->GetDampingRatio() ) )
-                            pJointNode->addField( jointDistanceDampingRatioName, pJoint->GetDampingRatio() );
-
-                        // Add local anchors.
-                        if ( mNotZero( pJoint->GetLocalAnchorA().LengthSquared() ) )
-                            pJointNode->addField( jointLocalAnchorAName, pJoint->GetLocalAnchorA() );
-                        if ( mNotZero( pJoint->GetLocalAnchorB().LengthSquared() ) )
-                            pJointNode->addField( jointLocalAnchorBName, pJoint->GetLocalAnchorB() );
-
-                        // Add scene object bodies.
-                        if ( pSceneObjectA != NULL )
-                            pJointNode->addNode( pSceneObjectA );
-
-                        if ( pSceneObjectB != NULL )
-                            pJointNode->addNode( pSceneObjectB );
-                    }
-                    break;
-
-                case e_ropeJoint:
-                    {
-                        // Set joint name.
-                        pJointNode->setNodeName( jointRopeNodeName );
-
-                        // Fetch joint.
-                        const b2RopeJoint* pJoint = dynamic_cast<const b2RopeJoint*>( pBaseJoint );
-
-                        // Sanity!
-                        AssertFatal( pJoint != NULL, "Scene::onTamlCustomWrite() - Invalid rope joint type returned." );
-
-                        // Add max length.
-                        if ( mNotZero( pJoint->GetMaxLength() ) )
-                            pJointNode->addField( jointRopeMaxLengthName, pJoint->GetMaxLength() );
-
-                        // Add local anchors.
-                        if ( mNotZero( pJoint->GetLocalAnchorA().LengthSquared() ) )
-                            pJointNode->addField( jointLocalAnchorAName, pJoint->GetLocalAnchorA() );
-                        if ( mNotZero( pJoint->GetLocalAnchorB().LengthSquared() ) )
-                            pJointNode->addField( jointLocalAnchorBName, pJoint->GetLocalAnchorB() );
-
-                        // Add scene object bodies.
-                        if ( pSceneObjectA != NULL )
-                            pJointNode->addNode( pSceneObjectA );
-
-                        if ( pSceneObjectB != NULL )
-                            pJointNode->addNode( pSceneObjectB );
-                    }
-                    break;
-
-                case e_revoluteJoint:
-                    {
-                        // Set join name.
-                        pJointNode->setNodeName( jointRevoluteNodeName );
-
-                        // Fetch joint.
-                        const b2RevoluteJoint* pJoint = dynamic_cast<const b2RevoluteJoint*>( pBaseJoint );
-
-                        // Sanity!
-                        AssertFatal( pJoint != NULL, "Scene::onTamlCustomWrite() - Invalid revolute joint type returned." );
-
-                        // Add limit.
-                        if ( pJoint->IsLimitEnabled() )
-                        {
-                            // Add limits.
-                            pJointNode->addField( jointRevoluteLimitLowerAngleName, mRadToDeg(pJoint->GetLowerLimit()) );
-                            pJointNode->addField( jointRevoluteLimitUpperAngleName, mRadToDeg(pJoint->GetUpperLimit()) );
-                        }
-
-                        // Add motor.
-                        if ( pJoint->IsMotorEnabled() )
-                        {
-                            // Add motor.
-                            pJointNode->addField( jointRevoluteMotorSpeedName, mRadToDeg(pJoint->GetMotorSpeed()) );
-                            pJointNode->addField( jointRevoluteMotorMaxTorqueName, pJoint->GetMaxMotorTorque() );
-                        }
-
-                        // Add local anchors.
-                        if ( mNotZero( pJoint->GetLocalAnchorA().LengthSquared() ) )
-                            pJointNode->addField( jointLocalAnchorAName, pJoint->GetLocalAnchorA() );
-                        if ( mNotZero( pJoint->GetLocalAnchorB().LengthSquared() ) )
-                            pJointNode->addField( jointLocalAnchorBName, pJoint->GetLocalAnchorB() );
-
-                        // Add scene object bodies.
-                        if ( pSceneObjectA != NULL )
-                            pJointNode->addNode( pSceneObjectA );
-
-                        if ( pSceneObjectB != NULL )
-                            pJointNode->addNode( pSceneObjectB );
-                    }
-                    break;
-
-                case e_weldJoint:
-                    {
-                        // Set joint name.
-                        pJointNode->setNodeName( jointWeldNodeName );
-
-                        // Fetch joint.
-                        const b2WeldJoint* pJoint = dynamic_cast<const b2WeldJoint*>( pBaseJoint );
-
-                        // Sanity!
-                        AssertFatal( pJoint != NULL, "Scene::onTamlCustomWrite() - Invalid weld joint type returned." );
-
-                        // Add frequency.
-                        if ( mNotZero( pJoint->GetFrequency() ) )
-                            pJointNode->addField( jointWeldFrequencyName, pJoint->GetFrequency() );
-
-                        // Add damping ratio.
-                        if ( mNotZero( pJoint->GetDampingRatio() ) )
-                            pJointNode->addField( jointWeldDampingRatioName, pJoint->GetDampingRatio() );
-
-                        // Add local anchors.
-                        if ( mNotZero( pJoint->GetLocalAnchorA().LengthSquared() ) )
-                            pJointNode->addField( jointLocalAnchorAName, pJoint->GetLocalAnchorA() );
-                        if ( mNotZero( pJoint->GetLocalAnchorB().LengthSquared() ) )
-                            pJointNode->addField( jointLocalAnchorBName, pJoint->GetLocalAnchorB() );
-
-                        // Add scene object bodies.
-                        if ( pSceneObjectA != NULL )
-                            pJointNode->addNode( pSceneObjectA );
-
-                        if ( pSceneObjectB != NULL )
-                            pJointNode->addNode( pSceneObjectB );
-                    }
-                    break;
-
-                case e_wheelJoint:
-                    {
-                        // Set joint name.
-                        pJointNode->setNodeName( jointWheelNodeName );
-
-                        // Fetch joint.
-                        b2WheelJoint* pJoint = dynamic_cast<b2WheelJoint*>( pBaseJoint );
-
-                        // Sanity!
-                        AssertFatal( pJoint != NULL, "Scene::onTamlCustomWrite() - Invalid wheel joint type returned." );
-
-                        // Add motor.
-                        if ( pJoint->IsMotorEnabled() )
-                        {
-                            // Add motor.
-                            pJointNode->addField( jointWheelMotorSpeedName, mRadToDeg(pJoint->GetMotorSpeed()) );
-                            pJointNode->addField( jointWheelMotorMaxTorqueName, pJoint->GetMaxMotorTorque() );
-                        }
-
-                        // Add frequency.
-                        if ( mNotZero( pJoint->GetSpringFrequencyHz() ) )
-                            pJointNode->addField( jointWheelFrequencyName, pJoint->GetSpringFrequencyHz() );
-
-                        // Add damping ratio.
-                        if ( mNotZero( pJoint->GetSpringDampingRatio() ) )
-                            pJointNode->addField( jointWheelDampingRatioName, pJoint->GetSpringDampingRatio() );
-
-                        // Add world axis.
-                        pJointNode->addField( jointWheelWorldAxisName, pJoint->GetBodyA()->GetWorldVector( pJoint->GetLocalAxisA() ) );
-
-                        // Add local anchors.
-                        pJointNode->addField( jointLocalAnchorAName, pJoint->GetLocalAnchorA() );
-                        pJointNode->addField( jointLocalAnchorBName, pJoint->GetLocalAnchorB() );
-
-                        // Add scene object bodies.
-                        if ( pSceneObjectA != NULL )
-                            pJointNode->addNode( pSceneObjectA );
-
-                        if ( pSceneObjectB != NULL )
-                            pJointNode->addNode( pSceneObjectB );
-                    }
-                    break;
-
-                case e_frictionJoint:
-                    {
-                        // Set joint name.
-                        pJointNode->setNodeName( jointFrictionNodeName );
-
-                        // Fetch joint.
-                        const b2FrictionJoint* pJoint = dynamic_cast<const b2FrictionJoint*>( pBaseJoint );
-
-                        // Add max force.
-                        if ( mNotZero( pJoint->GetMaxForce() ) )
-                            pJointNode->addField( jointFrictionMaxForceName, pJoint->GetMaxForce() );
-
-                        // Add max torque.
-                        if ( mNotZero( pJoint->GetMaxTorque() ) )
-                            pJointNode->addField( jointFrictionMaxTorqueName, pJoint->GetMaxTorque() );
-
-                        // Sanity!
-                        AssertFatal( pJoint != NULL, "Scene::onTamlCustomWrite() - Invalid friction joint type returned." );
-
-                        // Add local anchors.
-                        if ( mNotZero( pJoint->GetLocalAnchorA().LengthSquared() ) )
-                            pJointNode->addField( jointLocalAnchorAName, pJoint->GetLocalAnchorA() );
-                        if ( mNotZero( pJoint->GetLocalAnchorB().LengthSquared() ) )
-                            pJointNode->addField( jointLocalAnchorBName, pJoint->GetLocalAnchorB() );
-
-                        // Add scene object bodies.
-                        if ( pSceneObjectA != NULL )
-                            pJointNode->addNode( pSceneObjectA );
-
-                        if ( pSceneObjectB != NULL )
-                            pJointNode->addNode( pSceneObjectB );
-                    }
-                    break;
-
-                case e_prismaticJoint:
-                    {
-                        // Set joint name.
-                        pJointNode->setNodeName( jointPrismaticNodeName );
-
-                        // Fetch joint.
-                        b2PrismaticJoint* pJoint = dynamic_cast<b2PrismaticJoint*>( pBaseJoint );
-
-                        // Sanity!
-                        AssertFatal( pJoint != NULL, "Scene::onTamlCustomWrite() - Invalid prismatic joint type returned." );
-
-                        // Add limit.
-                        if ( pJoint->IsLimitEnabled() )
-                        {
-                            // Add limits.
-                            pJointNode->addField( jointPrismaticLimitLowerTransName, pJoint->GetLowerLimit() );
-                            pJointNode->addField( jointPrismaticLimitUpperTransName, pJoint->GetUpperLimit() );
-                        }
-
-                        // Add motor.
-                        if ( pJoint->IsMotorEnabled() )
-                        {
-                            // Add motor.
-                            pJointNode->addField( jointPrismaticMotorSpeedName, mRadToDeg(pJoint->GetMotorSpeed()) );
-                            pJointNode->addField( jointPrismaticMotorMaxForceName, pJoint->GetMaxMotorForce() );
-                        }
-
-                        // Add world axis.
-                        pJointNode->addField( jointPrismaticWorldAxisName, pJoint->GetBodyA()->GetWorldVector( pJoint->GetLocalAxisA() ) );
-
-                        // Add local anchors.
-                        pJointNode->addField( jointLocalAnchorAName, pJoint->GetLocalAnchorA() );
-                        pJointNode->addField( jointLocalAnchorBName, pJoint->GetLocalAnchorB() );
-
-                        // Add scene object bodies.
-                        if ( pSceneObjectA != NULL )
-                            pJointNode->addNode( pSceneObjectA );
-
-                        if ( pSceneObjectB != NULL )
-                            pJointNode->addNode( pSceneObjectB );
-                    }
-                    break;
-
-                case e_pulleyJoint:
-                    {
-                        // Set joint name.
-                        pJointNode->setNodeName( jointPulleyNodeName );
-
-                        // Fetch joint.
-                        b2PulleyJoint* pJoint = dynamic_cast<b2PulleyJoint*>( pBaseJoint );
-
-                        // Sanity!
-                        AssertFatal( pJoint != NULL, "Scene::onTamlCustomWrite() - Invalid pulley joint type returned." );
-
-                        // Add lengths.
-                        pJointNode->addField( jointPulleyLengthAName, pJoint->GetLengthA() );
-                        pJointNode->addField( jointPulleyLengthBName, pJoint->GetLengthB() );
-
-                        // Add ratio,
-                        pJointNode->addField( jointPulleyRatioName, pJoint->GetRatio() );
-
-                        // Add ground anchors.
-                        pJointNode->addField( jointPulleyGroundAnchorAName, pJoint->GetGroundAnchorA() );
-                        pJointNode->addField( jointPulleyGroundAnchorBName, pJoint->GetGroundAnchorB() );
-
-                        // Add local anchors.
-                        pJointNode->addField( jointLocalAnchorAName, pJoint->GetBodyA()->GetLocalPoint( pJoint->GetAnchorA() ) );
-                        pJointNode->addField( jointLocalAnchorBName, pJoint->GetBodyB()->GetLocalPoint( pJoint->GetAnchorB() ) );
-
-                        // Add scene object bodies.
-                        if ( pSceneObjectA != NULL )
-                            pJointNode->addNode( pSceneObjectA );
-
-                        if ( pSceneObjectB != NULL )
-                            pJointNode->addNode( pSceneObjectB );
-                    }
-                    break;
-
-                case e_mouseJoint:
-                    {
-                        // Set joint name.
-                        pJointNode->setNodeName( jointTargetNodeName );
-
-                        // Fetch joint.
-                        const b2MouseJoint* pJoint = dynamic_cast<const b2MouseJoint*>( pBaseJoint );
-
-                        // Sanity!
-                        AssertFatal( pJoint != NULL, "Scene::onTamlCustomWrite() - Invalid target joint type returned." );
-
-                        // Add target.
-                        pJointNode->addField( jointTargetWorldTargetName, pJoint->GetTarget() );
-
-                        // Add max force.
-                        pJointNode->addField( jointTargetMaxForceName, pJoint->GetMaxForce() );
-
-                        // Add frequency
-                        pJointNode->addField( jointTargetFrequencyName, pJoint->GetFrequency() );
-
-                        // Add damping ratio.
-                        pJointNode->addField( jointTargetDampingRatioName, pJoint->GetDampingRatio() );
-
-                        // Add body.
-                        // NOTE: This joint uses BODYB as the object, BODYA is the ground-body however for easy of use
-                        // we'll refer to this as OBJECTA in the persisted format.
-                        if ( pSceneObjectB != NULL )
-                            pJointNode->addNode( pSceneObjectB );
-                    }
-                    break;
-
-                case e_motorJoint:
-                    {
-                        // Set joint name.
-                        pJointNode->setNodeName( jointMotorNodeName );
-
-                        // Fetch joint.
-                        const b2MotorJoint* pJoint = dynamic_cast<const b2MotorJoint*>( pBaseJoint );
-
-                        // Sanity!
-                        AssertFatal( pJoint != NULL, "Scene::onTamlCustomWrite() - Invalid motor joint type returned." );
-
-                        // Add linear offset.
-                        if ( mNotZero( pJoint->GetLinearOffset().LengthSquared() ) )
-                            pJointNode->addField( jointMotorLinearOffsetName, pJoint->GetLinearOffset() );
-
-                        // Add angular offset.
-                        if ( mNotZero( pJoint->GetAngularOffset() ) )
-                            pJointNode->addField( jointMotorAngularOffsetName, mRadToDeg( pJoint->GetAngularOffset() ) );
-
-                        // Add max force.
-                        pJointNode->addField( jointMotorMaxForceName, pJoint->GetMaxForce() );
-
-                        // Add max torque.
-                        pJointNode->addField( jointMotorMaxTorqueName, pJoint->GetMaxTorque() );
-
-                        // Add correction factor.
-                        pJointNode->addField( jointMotorCorrectionFactorName, pJoint->GetCorrectionFactor() );
-
-                        // Add scene object bodies.
-                        if ( pSceneObjectA != NULL )
-                            pJointNode->addNode( pSceneObjectA );
-
-                        if ( pSceneObjectB != NULL )
-                            pJointNode->addNode( pSceneObjectB );
-                    }
-                    break;
-
-            default:
-                // Sanity!
-                AssertFatal( false, "Scene::onTamlCustomWrite() - Unknown joint type detected." );
-            }
-
-            // Add collide connected flag.
-            if ( pBaseJoint->GetCollideConnected() )
-                pJointNode->addField( jointCollideConnectedName, pBaseJoint->GetCollideConnected() );
-        }
-    }
-
-    // Fetch controller count.
-    const S32 sceneControllerCount = getControllers() ? getControllers()->size() : 0;
-    
-    // Do we have any scene controllers?
-    if ( sceneControllerCount > 0 )
-    {
-        // Yes, so add controller node.
-        TamlCustomNode* pControllerCustomNode = customNodes.addNode( controllerCustomNodeName );
-
-        // Fetch the scene controllers.
-        SimSet* pControllerSet = getControllers();
-
-        // Iterate scene controllers.
-        for( S32 i = 0; i < sceneControllerCount; i++ )
-        {
-            // Fetch the set object.
-            SimObject* pSetObject = pControllerSet->at(i);
-
-            // Skip if not a controller.
-            if ( !pSetObject->isType<SceneController*>() )
-                continue;
-
-            // Add controller node.
-            pControllerCustomNode->addNode( pSetObject );
-        }
-    }
-
-    // Fetch asset preload count.
-    const S32 assetPreloadCount = getAssetPreloadCount();
-
-    // Do we have any asset preloads?
-    if ( assetPreloadCount > 0 )
-    {
-        // Yes, so fetch asset Id type prefix.
-        StringTableEntry assetIdTypePrefix = ConsoleBaseType::getType( TypeAssetId )->getTypePrefix();
-
-        // Add asset preload node.
-        TamlCustomNode* pAssetPreloadCustomNode = customNodes.addNode( assetPreloadNodeName );
-
-        // Iterate asset preloads.
-        for( typeAssetPtrVector::const_iterator assetItr = mAssetPreloads.begin(); assetItr != mAssetPreloads.end(); ++assetItr )
-        {
-            // Add node.
-            TamlCustomNode* pAssetNode = pAssetPreloadCustomNode->addNode( assetNodeName );
-
-            char valueBuffer[1024];
-            dSprintf( valueBuffer, sizeof(valueBuffer), "%s%s", assetIdTypePrefix, (*assetItr)->getAssetId() );
-
-            // Add asset Id.
-            pAssetNode->addField( "Id", valueBuffer );
-        }        
-    }
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::onTamlCustomRead( const TamlCustomNodes& customNodes )
-{
-    // Call parent.
-    Parent::onTamlCustomRead( customNodes );
-}
-
-//-----------------------------------------------------------------------------
-
-U32 Scene::getGlobalSceneCount( void )
-{
-    return sSceneCount;
-}
-
-//-----------------------------------------------------------------------------
-
-SceneRenderRequest* Scene::createDefaultRenderRequest( SceneRenderQueue* pSceneRenderQueue, SceneObject* pSceneObject )
-{
-    // Create a render request and populate it with the default details.
-    SceneRenderRequest* pSceneRenderRequest = pSceneRenderQueue->createRenderRequest()->set(
-        pSceneObject,
-        pSceneObject->getRenderPosition(),
-        pSceneObject->getSceneLayerDepth(),
-        pSceneObject->getSortPoint(),
-        pSceneObject->getSerialId(),
-        pSceneObject->getRenderGroup() );
-
-    // Prepare the blending for it.
-    pSceneRenderRequest->mBlendMode = pSceneObject->getBlendMode();
-    pSceneRenderRequest->mBlendColor = pSceneObject->getBlendColor();
-    pSceneRenderRequest->mSrcBlendFactor = pSceneObject->getSrcBlendFactor();
-    pSceneRenderRequest->mDstBlendFactor = pSceneObject->getDstBlendFactor();
-    pSceneRenderRequest->mAlphaTest = pSceneObject->getAlphaTest();
-
-    return pSceneRenderRequest;
-}
-
-//-----------------------------------------------------------------------------
-
-SimObject* Scene::getTamlChild( const U32 childIndex ) const
-{
-    // Sanity!
-    AssertFatal( childIndex < (U32)mSceneObjects.size(), "Scene::getTamlChild() - Child index is out of range." );
-
-    // For when the assert is not used.
-    if ( childIndex >= (U32)mSceneObjects.size() )
-        return NULL;
-
-    return mSceneObjects[ childIndex ];
-}
-
-//-----------------------------------------------------------------------------
-
-void Scene::addTamlChild( SimObject* pSimObject )
-{
-    // Sanity!
-    AssertFatal( pSimObject != NULL, "Scene::addTamlChild() - Cannot add a NULL child object." );
-
-    // Fetch as a scene object.
-    SceneObject* pSceneObject = dynamic_cast<SceneObject*>( pSimObject );
-
-    // Is it a scene object?
-    if ( pSceneObject == NULL )
-    {
-        // No, so warn.
-        Con::warnf( "Scene::addTamlChild() - Cannot add a child object that isn't a scene object." );
-        return;
-    }
-
-    // Add the scene object.
-    addToScene( pSceneObject );
-}
-
-//-----------------------------------------------------------------------------
-
-static EnumTable::Enums DebugOptionsLookup[] =
-                {
-                { Scene::SCENE_DEBUG_METRICS,           "metrics" },
-                { Scene::SCENE_DEBUG_FPS_METRICS,       "fps" },
-                { Scene::SCENE_DEBUG_CONTROLLERS,       "controllers" },
-                { Scene::SCENE_DEBUG_JOINTS,            "joints" },
-                { Scene::SCENE_DEBUG_WIREFRAME_RENDER,  "wireframe" },
-                ///
-                { Scene::SCENE_DEBUG_AABB,              "aabb" },
-                { Scene::SCENE_DEBUG_OOBB,              "oobb" },
-                { Scene::SCENE_DEBUG_SLEEP,             "sleep" },
-                { Scene::SCENE_DEBUG_COLLISION_SHAPES,  "collision" },
-                { Scene::SCENE_DEBUG_POSITION_AND_COM,  "position" },
-                { Scene::SCENE_DEBUG_SORT_POINTS,       "sort" },
-                };
-
-//-----------------------------------------------------------------------------
-
-Scene::DebugOption Scene::getDebugOptionEnum(const char* label)
-{
-    // Search for Mnemonic.
-    for(U32 i = 0; i < (sizeof(DebugOptionsLookup) / sizeof(EnumTable::Enums)); i++)
-        if( dStricmp(DebugOptionsLookup[i].label, label) == 0)
-            return((Scene::DebugOption)DebugOptionsLookup[i].index);
-
-    // Warn.
-    Con::warnf( "Scene::getDebugOptionEnum() - Invalid debug option '%s'.", label );
-
-    return Scene::SCENE_DEBUG_INVALID;
-}
-
-//-----------------------------------------------------------------------------
-
-const char* Scene::getDebugOptionDescription( Scene::DebugOption debugOption )
-{
-    // Search for Mnemonic.
-    for (U32 i = 0; i < (sizeof(DebugOptionsLookup) / sizeof(EnumTable::Enums)); i++)
-    {
-        if( DebugOptionsLookup[i].index == debugOption )
-            return DebugOptionsLookup[i].label;
-    }
-
-    // Warn.
-    Con::warnf( "Scene::getDebugOptionDescription() - Invalid debug option." );
-
-    return StringTable->EmptyString;
-}
-
-//-----------------------------------------------------------------------------
-
-static EnumTable::Enums jointTypeLookup[] =
-                {
-                { e_distanceJoint,  "distance"  },
-                { e_ropeJoint,      "rope"      },
-                { e_revoluteJoint,  "revolute"  },
-                { e_weldJoint,      "weld"      },
-                { e_wheelJoint,     "wheel"     },
-                { e_frictionJoint,  "friction"  },
-                { e_prismaticJoint, "prismatic" },
-                { e_pulleyJoint,    "pulley"    },
-                { e_mouseJoint,     "target"    },
-                { e_motorJoint,     "motor"     },
-                };
-
-EnumTable jointTypeTable(sizeof(jointTypeLookup) / sizeof(EnumTable::Enums), &jointTypeLookup[0]);
-
-//-----------------------------------------------------------------------------
-
-const char* Scene::getJointTypeDescription( b2JointType jointType )
-{
-    // Search for Mnemonic.
-    for (U32 i = 0; i < (sizeof(jointTypeLookup) / sizeof(EnumTable::Enums)); i++)
-    {
-        if( jointTypeLookup[i].index == jointType )
-            return jointTypeLookup[i].label;
-    }
-
-    // Warn.
-    Con::warnf( "Scene::getJointTypeDescription() - Invalid joint type." );
-
-    return StringTable->EmptyString;
-}
-
-//-----------------------------------------------------------------------------
-
-b2JointType Scene::getJointTypeEnum(const char* label)
-{
-    // Search for Mnemonic.
-    for (U32 i = 0; i < (sizeof(jointTypeLookup) / sizeof(EnumTable::Enums)); i++)
-    {
-        if( dStricmp(jointTypeLookup[i].label, label) == 0)
-            return (b2JointType)jointTypeLookup[i].index;
-    }
-
-    // Warn.
-    Con::warnf( "Scene::getJointTypeEnum() - Invalid joint of '%s'", label );
-
-    return e_unknownJoint;
-}
-
-//-----------------------------------------------------------------------------
-
-static EnumTable::Enums pickModeLookup[] =
-                {
-                { Scene::PICK_ANY,          "Any" },
-                { Scene::PICK_AABB,         "AABB" },
-                { Scene::PICK_OOBB,         "OOBB" },
-                { Scene::PICK_COLLISION,    "Collision" },
-                };
-
-//-----------------------------------------------------------------------------
-
-Scene::PickMode Scene::getPickModeEnum(const char* label)
-{
-    // Search for Mnemonic.
-    for(U32 i = 0; i < (sizeof(pickModeLookup) / sizeof(EnumTable::Enums)); i++)
-        if( dStricmp(pickModeLookup[i].label, label) == 0)
-            return((Scene::PickMode)pickModeLookup[i].index);
-
-    // Warn.
-    Con::warnf( "Scene::getPickModeEnum() - Invalid pick mode '%s'.", label );
-
-    return Scene::PICK_INVALID;
-}
-
-//-----------------------------------------------------------------------------
-
-const char* Scene::getPickModeDescription( Scene::PickMode pickMode )
-{
-    // Search for Mnemonic.
-    for (U32 i = 0; i < (sizeof(pickModeLookup) / sizeof(EnumTable::Enums)); i++)
-    {
-        if( pickModeLookup[i].index == pickMode )
-            return pickModeLookup[i].label;
-    }
-
-    // Warn.
-    Con::warnf( "Scene::getPickModeDescription() - Invalid pick mode.");
-
-    return StringTable->EmptyString;
-}
-
-//-----------------------------------------------------------------------------
-
-static void WriteJointsCustomTamlScehema( const AbstractClassRep* pClassRep, TiXmlElement* pParentElement )
-{
-    // Sanity!
-    AssertFatal( pClassRep != NULL,  "Taml::WriteJointsCustomTamlScehema() - ClassRep cannot be NULL." );
-    AssertFatal( pParentElement != NULL,  "Taml::WriteJointsCustomTamlScehema() - Parent Element cannot be NULL." );
-
-    char buffer[1024];
-
-    // Create joints node element.
-    TiXmlElement* pJointsNodeElement = new TiXmlElement( "xs:element" );
-    dSprintf( buffer, sizeof(buffer), "%s.%s", pClassRep->getClassName(), jointCustomNodeName );
-    pJointsNodeElement->SetAttribute( "name", buffer );
-    pJointsNodeElement->SetAttribute( "minOccurs", 0 );
-    pJointsNodeElement->SetAttribute( "maxOccurs", 1 );
-    pParentElement->LinkEndChild( pJointsNodeElement );
-    
-    // Create complex type.
-    TiXmlElement* pJointsNodeComplexTypeElement = new TiXmlElement( "xs:complexType" );
-    pJointsNodeElement->LinkEndChild( pJointsNodeComplexTypeElement );
-    
-    // Create choice element.
-    TiXmlElement* pJointsNodeChoiceElement = new TiXmlElement( "xs:choice" );
-    pJointsNodeChoiceElement->SetAttribute( "minOccurs", 0 );
-    pJointsNodeChoiceElement->SetAttribute( "maxOccurs", "unbounded" );
-    pJointsNodeComplexTypeElement->LinkEndChild( pJointsNodeChoiceElement );
-
-    // ********************************************************************************
-    // Create Distance Joint Element.
-    // ********************************************************************************
-    TiXmlElement* pDistanceJointElement = new TiXmlElement( "xs:element" );
-    pDistanceJointElement->SetAttribute( "name", jointDistanceNodeName );
-    pDistanceJointElement->SetAttribute( "minOccurs", 0 );
-    pDistanceJointElement->SetAttribute( "maxOccurs", 1 );
-    pJointsNodeChoiceElement->LinkEndChild( pDistanceJointElement );
-
-    // Create complex type Element.
-    TiXmlElement* pDistanceJointComplexTypeElement = new TiXmlElement( "xs:complexType" );
-    pDistanceJointElement->LinkEndChild( pDistanceJointComplexTypeElement );
-
-    // Create "Length" attribute.
-    TiXmlElement* pDistanceJointElementA = new TiXmlElement( "xs:attribute" );
-    pDistanceJointElementA->SetAttribute( "name", jointDistanceLengthName );
-    pDistanceJointComplexTypeElement->LinkEndChild( pDistanceJointElementA );
-    TiXmlElement* pDistanceJointElementB = new TiXmlElement( "xs:simpleType" );
-    pDistanceJointElementA->LinkEndChild( pDistanceJointElementB );
-    TiXmlElement* pDistanceJointElementC = new TiXmlElement( "xs:restriction" );
-    pDistanceJointElementC->SetAttribute( "base", "xs:float" );
-    pDistanceJointElementB->LinkEndChild( pDistanceJointElementC );
-    TiXmlElement* pDistanceJointElementD = new TiXmlElement( "xs:minInclusive" );
-    pDistanceJointElementD->SetAttribute( "value", "0" );
-    pDistanceJointElementC->LinkEndChild( pDistanceJointElementD );
-
-    // Create "Frequency" attribute.
-    pDistanceJointElementA = new TiXmlElement( "xs:attribute" );
-    pDistanceJointElementA->SetAttribute( "name", jointDistanceFrequencyName );
-    pDistanceJointComplexTypeElement->LinkEndChild( pDistanceJointElementA );
-    pDistanceJointElementB = new TiXmlElement( "xs:simpleType" );
-    pDistanceJointElementA->LinkEndChild( pDistanceJointElementB );
-    pDistanceJointElementC = new TiXmlElement( "xs:restriction" );
-    pDistanceJointElementC->SetAttribute( "base", "xs:float" );
-    pDistanceJointElementB->LinkEndChild( pDistanceJointElementC );
-    pDistanceJointElementD = new TiXmlElement( "xs:minInclusive" );
-    pDistanceJointElementD->SetAttribute( "value", "0" );
-    pDistanceJointElementC->LinkEndChild( pDistanceJointElementD );
-
-    // Create "Damping Ratio" attribute.
-    pDistanceJointElementA = new TiXmlElement( "xs:attribute" );
-    pDistanceJointElementA->SetAttribute( "name", jointDistanceDampingRatioName );
-    pDistanceJointComplexTypeElement->LinkEndChild( pDistanceJointElementA );
-    pDistanceJointElementB = new TiXmlElement( "xs:simpleType" );
-    pDistanceJointElementA->LinkEndChild( pDistanceJointElementB );
-    pDistanceJointElementC = new TiXmlElement( "xs:restriction" );
-    pDistanceJointElementC->SetAttribute( "base", "xs:float" );
-    pDistanceJointElementB->LinkEndChild( pDistanceJointElementC );
-    pDistanceJointElementD = new TiXmlElement( "xs:minInclusive" );
-    pDistanceJointElementD->SetAttribute( "value", "0" );
-    pDistanceJointElementC->LinkEndChild( pDistanceJointElementD );
-}
-
-//-----------------------------------------------------------------------------
-
-static void WriteControllersCustomTamlScehema( const AbstractClassRep* pClassRep, TiXmlElement* pParentElement )
-{
-    // Sanity!
-    AssertFatal( pClassRep != NULL,  "Taml::WriteControllersCustomTamlScehema() - ClassRep cannot be NULL." );
-    AssertFatal( pParentElement != NULL,  "Taml::WriteControllersCustomTamlScehema() - Parent Element cannot be NULL." );
-
-    char buffer[1024];
-
-    // Create controllers node element.
-    TiXmlElement* pControllersNodeElement = new TiXmlElement( "xs:element" );
-    dSprintf( buffer, sizeof(buffer), "%s.%s", pClassRep->getClassName(), controllerCustomNodeName );
-    pControllersNodeElement->SetAttribute( "name", buffer );
-    pControllersNodeElement->SetAttribute( "minOccurs", 0 );
-    pControllersNodeElement->SetAttribute( "maxOccurs", 1 );
-    pParentElement->LinkEndChild( pControllersNodeElement );
-    
-    // Create complex type.
-    TiXmlElement* pControllersNodeComplexTypeElement = new TiXmlElement( "xs:complexType" );
-    pControllersNodeElement->LinkEndChild( pControllersNodeComplexTypeElement );
-    
-    // Create choice element.
-    TiXmlElement* pControllersNodeChoiceElement = new TiXmlElement( "xs:choice" );
-    pControllersNodeChoiceElement->SetAttribute( "minOccurs", 0 );
-    pControllersNodeChoiceElement->SetAttribute( "maxOccurs", "unbounded" );
-    pControllersNodeComplexTypeElement->LinkEndChild( pControllersNodeChoiceElement );
-
-    // Fetch the scene controller type.
-    AbstractClassRep* pPickingSceneControllerType = AbstractClassRep::findClassRep( "PickingSceneController" );
-    AbstractClassRep* pGroupedSceneControllerType = AbstractClassRep::findClassRep( "GroupedSceneController" );
-
-    // Sanity!
-    AssertFatal( pPickingSceneControllerType != NULL, "Scene::WriteControllersCustomTamlScehema() - Cannot find the PickingSceneController type." );
-    AssertFatal( pGroupedSceneControllerType != NULL, "Scene::WriteControllersCustomTamlScehema() - Cannot find the GroupedSceneController type." );
-
-    // Add choice members.
-    for ( AbstractClassRep* pChoiceType = AbstractClassRep::getClassList(); pChoiceType != NULL; pChoiceType = pChoiceType->getNextClass() )
-    {
-        // Skip if not derived from either of the scene controllers.
-        if ( !pChoiceType->isClass( pPickingSceneControllerType ) && !pChoiceType->isClass( pGroupedSceneControllerType ) )
-            continue;
-
-        // Add choice member.
-        TiXmlElement* pChoiceMemberElement = new TiXmlElement( "xs:element" );
-        pChoiceMemberElement->SetAttribute( "name", pChoiceType->getClassName() );
-        dSprintf( buffer, sizeof(buffer), "%s_Type", pChoiceType->getClassName() );
-        pChoiceMemberElement->SetAttribute( "type", buffer );
-        pControllersNodeChoiceElement->LinkEndChild( pChoiceMemberElement );
-    }
-}
-
-//-----------------------------------------------------------------------------
-
-static void WritePreloadsCustomTamlScehema( const AbstractClassRep* pClassRep, TiXmlElement* pParentElement )
-{
-    // Sanity!
-    AssertFatal( pClassRep != NULL,  "Taml::WritePreloadsCustomTamlScehema() - ClassRep cannot be NULL." );
-    AssertFatal( pParentElement != NULL,  "Taml::WritePreloadsCustomTamlScehema() - Parent Element cannot be NULL." );
-
-    char buffer[1024];
-
-    // Create preloads node element.
-    TiXmlElement* pPreloadsNodeElement = new TiXmlElement( "xs:element" );
-    dSprintf( buffer, sizeof(buffer), "%s.%s", pClassRep->getClassName(), assetPreloadNodeName );
-    pPreloadsNodeElement->SetAttribute( "name", buffer );
-    pPreloadsNodeElement->SetAttribute( "minOccurs", 0 );
-    pPreloadsNodeElement->SetAttribute( "maxOccurs", 1 );
-    pParentElement->LinkEndChild( pPreloadsNodeElement );
-    
-    // Create complex type.
-    TiXmlElement* pPreloadsNodeComplexTypeElement = new TiXmlElement( "xs:complexType" );
-    pPreloadsNodeElement->LinkEndChild( pPreloadsNodeComplexTypeElement );
-    
-    // Create choice element.
-    TiXmlElement* pPreloadsNodeChoiceElement = new TiXmlElement( "xs:choice" );
-    pPreloadsNodeChoiceElement->SetAttribute( "minOccurs", 0 );
-    pPreloadsNodeChoiceElement->SetAttribute( "maxOccurs", "unbounded" );
-    pPreloadsNodeComplexTypeElement->LinkEndChild( pPreloadsNodeChoiceElement );
-
-    // Add choice member element.
-    TiXmlElement* pChoiceMemberElement = new TiXmlElement( "xs:element" );
-    pChoiceMemberElement->SetAttribute( "name", assetNodeName );
-    pPreloadsNodeChoiceElement->LinkEndChild( pChoiceMemberElement );
-
-    // Add choice member complex type element.
-    TiXmlElement* pChoiceMemberComplexTypeElement = new TiXmlElement( "xs:complexType" );
-    pChoiceMemberElement->LinkEndChild( pChoiceMemberComplexTypeElement );
-
-    // Add choice member attribute element.
-    TiXmlElement* pChoiceAttributeElement = new TiXmlElement( "xs:attribute" );
-    pChoiceAttributeElement->SetAttribute( "name", "Id" );
-    dSprintf( buffer, sizeof(buffer), "%s", "AssetId_ConsoleType" );
-    pChoiceAttributeElement->SetAttribute( "type", buffer );
-    pChoiceMemberComplexTypeElement->LinkEndChild( pChoiceAttributeElement );
-}
-
-//-----------------------------------------------------------------------------
-
-static void WriteCustomTamlSchema( const AbstractClassRep* pClassRep, TiXmlElement* pParentElement )
-{
-    // Sanity!
-    AssertFatal( pClassRep != NULL,  "Taml::WriteCustomTamlSchema() - ClassRep cannot be NULL." );
-    AssertFatal( pParentElement != NULL,  "Taml::WriteCustomTamlSchema() - Parent Element cannot be NULL." );
-
-    WriteJointsCustomTamlScehema( pClassRep, pParentElement );
-    WriteControllersCustomTamlScehema( pClassRep, pParentElement );
-    WritePreloadsCustomTamlScehema( pClassRep, pParentElement );
-}
-
-//------------------------------------------------------------------------------
-
-IMPLEMENT_CONOBJECT_CHILDREN_SCHEMA(Scene, WriteCustomTamlSchema);
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCENE_H_
+#include "Scene.h"
+#endif
+
+#ifndef _DGL_H_
+#include "graphics/dgl.h"
+#endif
+
+#ifndef _CONSOLETYPES_H_
+#include "console/consoleTypes.h"
+#endif
+
+#ifndef _CONSOLE_VARIABLE_REF_H_
+#include "console/consoleVariableRef.h"
+#endif
+
+#ifndef _BITSTREAM_H_
+#include "io/bitStream.h"
+#endif
+
+#ifndef _SCENE_OBJECT_H_
+#include "2d/sceneobject/SceneObject.h"
+#endif
+
+#ifndef _CONTACT_FILTER_H_
+#include "ContactFilter.h"
+#endif
+
+#ifndef _SCENE_RENDER_OBJECT_H_
+#include "2d/SceneRenderObject.h"
+#endif
+
+#ifndef _SCENE_CONTROLLER_H_
+#include "2d/controllers/core/SceneController.h"
+#endif
+
+#ifndef _PARTICLE_SYSTEM_H_
+#include "2d/core/ParticleSystem.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREADPOOL_H_
+#include "platform/threads/threadPool.h"
+#endif
+
+#ifndef _SCENE_SCHEDULER_H_
+#include "2d/scene/SceneScheduler.h"
+#endif
+
+#ifndef _PARTICLE_PLAYER_H_
+#include "2d/sceneobject/ParticlePlayer.h"
+#endif
+
+#ifndef _SKELETON_OBJECT_H_
+#include "2d/sceneobject/SkeletonObject.h"
+#endif
+
+#ifndef _AUDIO_EMITTER_H_
+#include "2d/sceneobject/AudioEmitter.h"
+#endif
+
+#ifndef _FRAME_STATS_H_
+#include "debug/frameStats.h"
+#endif
+
+#ifndef _GPU_TIMER_H_
+#include "debug/gpuTimer.h"
+#endif
+
+// Script bindings.
+#include "Scene_ScriptBinding.h"
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//------------------------------------------------------------------------------
+
+// Frame statistics published by the main loop.
+static Con::VariableRef<F32> sFramePeriodVariable( "fps::framePeriod", 0.0f );
+static Con::VariableRef<S32> sFrameCountVariable( "fps::frameCount", 0 );
+static Con::VariableRef<bool> sLevelArenaVariable( "pref::Scene::levelArena", false );
+
+// GPU timer section names for each layer.
+static const char* const sLayerGpuSectionNames[MAX_LAYERS_SUPPORTED] =
+{
+    "layer0",  "layer1",  "layer2",  "layer3",  "layer4",  "layer5",  "layer6",  "layer7",
+    "layer8",  "layer9",  "layer10", "layer11", "layer12", "layer13", "layer14", "layer15",
+    "layer16", "layer17", "layer18", "layer19", "layer20", "layer21", "layer22", "layer23",
+    "layer24", "layer25", "layer26", "layer27", "layer28", "layer29", "layer30", "layer31",
+};
+
+//------------------------------------------------------------------------------
+
+SimObjectPtr<Scene> Scene::LoadingScene = NULL;
+
+//------------------------------------------------------------------------------
+
+static ContactFilter mContactFilter;
+
+// Scene counter.
+static U32 sSceneCount = 0;
+static U32 sSceneMasterIndex = 0;
+
+// Parallel ticking.
+static const U32 sParallelTickChunkSize = 256;
+static const U32 sParallelTickMinimumObjects = 1024;
+
+// Parallel render sorting.
+static const U32 sParallelRenderMinimumRequests = 2048;
+
+// Island range forwarded from the physics world to the thread pool.
+struct IslandRange
+{
+    b2ParallelRangeCallback mCallback;
+    void*                   mpContext;
+};
+
+// Contact callback names.
+static StringTableEntry sceneCollisionCallbackName        = StringTable->insert( "onSceneCollision" );
+static StringTableEntry sceneEndCollisionCallbackName     = StringTable->insert( "onSceneEndCollision" );
+static StringTableEntry collisionCallbackName             = StringTable->insert( "onCollision" );
+static StringTableEntry endCollisionCallbackName          = StringTable->insert( "onEndCollision" );
+
+// Joint custom node names.
+static StringTableEntry jointCustomNodeName               = StringTable->insert( "Joints" );
+static StringTableEntry jointCollideConnectedName         = StringTable->insert( "CollideConnected" );
+static StringTableEntry jointLocalAnchorAName             = StringTable->insert( "LocalAnchorA" );
+static StringTableEntry jointLocalAnchorBName             = StringTable->insert( "LocalAnchorB" );
+
+static StringTableEntry jointDistanceNodeName             = StringTable->insert( "Distance" );
+static StringTableEntry jointDistanceLengthName           = StringTable->insert( "Length" );
+static StringTableEntry jointDistanceFrequencyName        = StringTable->insert( "Frequency" );
+static StringTableEntry jointDistanceDampingRatioName     = StringTable->insert( "DampingRatio" );
+
+static StringTableEntry jointRopeNodeName                 = StringTable->insert( "Rope" );
+static StringTableEntry jointRopeMaxLengthName            = StringTable->insert( "MaxLength" );
+
+static StringTableEntry jointRevoluteNodeName             = StringTable->insert( "Revolute" );
+static StringTableEntry jointRevoluteLimitLowerAngleName  = StringTable->insert( "LowerAngle" );
+static StringTableEntry jointRevoluteLimitUpperAngleName  = StringTable->insert( "UpperAngle" );
+static StringTableEntry jointRevoluteMotorSpeedName       = StringTable->insert( "MotorSpeed" );
+static StringTableEntry jointRevoluteMotorMaxTorqueName   = StringTable->insert( "MaxTorque" );
+
+static StringTableEntry jointWeldNodeName                 = StringTable->insert( "Weld" );
+static StringTableEntry jointWeldFrequencyName            = jointDistanceFrequencyName;
+static StringTableEntry jointWeldDampingRatioName         = jointDistanceDampingRatioName;
+
+static StringTableEntry jointWheelNodeName                = StringTable->insert( "Wheel" );
+static StringTableEntry jointWheelWorldAxisName           = StringTable->insert( "WorldAxis" );
+static StringTableEntry jointWheelMotorSpeedName          = StringTable->insert( "MotorSpeed" );
+static StringTableEntry jointWheelMotorMaxTorqueName      = jointRevoluteMotorMaxTorqueName;
+static StringTableEntry jointWheelFrequencyName           = jointDistanceFrequencyName;
+static StringTableEntry jointWheelDampingRatioName        = jointDistanceDampingRatioName;
+
+static StringTableEntry jointFrictionNodeName             = StringTable->insert( "Friction" );
+static StringTableEntry jointFrictionMaxForceName         = StringTable->insert( "MaxForce" );
+static StringTableEntry jointFrictionMaxTorqueName        = jointRevoluteMotorMaxTorqueName;
+
+static StringTableEntry jointPrismaticNodeName            = StringTable->insert( "Prismatic" );
+static StringTableEntry jointPrismaticWorldAxisName       = jointWheelWorldAxisName;
+static StringTableEntry jointPrismaticLimitLowerTransName = StringTable->insert( "LowerTranslation" );
+static StringTableEntry jointPrismaticLimitUpperTransName = StringTable->insert( "UpperTranslation" );
+static StringTableEntry jointPrismaticMotorSpeedName      = jointRevoluteMotorSpeedName;
+static StringTableEntry jointPrismaticMotorMaxForceName   = jointFrictionMaxForceName;
+
+static StringTableEntry jointPulleyNodeName               = StringTable->insert( "Pulley" );
+static StringTableEntry jointPulleyGroundAnchorAName      = StringTable->insert( "GroundAnchorA" );
+static StringTableEntry jointPulleyGroundAnchorBName      = StringTable->insert( "GroundAnchorB" );
+static StringTableEntry jointPulleyLengthAName            = StringTable->insert( "LengthA" );
+static StringTableEntry jointPulleyLengthBName            = StringTable->insert( "LengthB" );
+static StringTableEntry jointPulleyRatioName              = StringTable->insert( "Ratio" );
+
+static StringTableEntry jointTargetNodeName               = StringTable->insert( "Target" );
+static StringTableEntry jointTargetWorldTargetName        = StringTable->insert( "WorldTarget" );
+static StringTableEntry jointTargetMaxForceName           = StringTable->insert( jointFrictionMaxForceName );
+static StringTableEntry jointTargetFrequencyName          = jointDistanceFrequencyName;
+static StringTableEntry jointTargetDampingRatioName       = jointDistanceDampingRatioName;
+
+static StringTableEntry jointMotorNodeName                = StringTable->insert( "Motor" );
+static StringTableEntry jointMotorLinearOffsetName        = StringTable->insert( "LinearOffset" );
+static StringTableEntry jointMotorAngularOffsetName       = StringTable->insert( "AngularOffset" );
+
+static StringTableEntry jointMotorMaxForceName            = jointFrictionMaxForceName;
+static StringTableEntry jointMotorMaxTorqueName           = jointRevoluteMotorMaxTorqueName;
+static StringTableEntry jointMotorCorrectionFactorName    = StringTable->insert( "CorrectionFactor" );
+
+// Controller custom node names.
+static StringTableEntry controllerCustomNodeName          = StringTable->insert( "Controllers" );
+
+// Asset preload custom node names.
+static StringTableEntry assetPreloadNodeName              = StringTable->insert( "AssetPreloads" );
+static StringTableEntry assetNodeName                     = StringTable->insert( "Asset" );
+
+//-----------------------------------------------------------------------------
+
+Scene::Scene() :
+    /// World.
+    mpWorld(NULL),
+    mWorldGravity(0.0f, 0.0f),
+    mVelocityIterations(8),
+    mPositionIterations(3),
+    mPhysicsStepRate(0.0f),
+    mMaxPhysicsSubSteps(8),
+    mPhysicsTimeAccumulator(0.0f),
+    mBulkBroadPhase(false),
+    mTOIMaxSubSteps(0),
+    mTOIMaxTime(0.0f),
+    mArenaAllocator(false),
+    mSpatialHashCellSize(0.0f),
+    mpWorldAllocator(NULL),
+
+    /// Level arena.
+    mpLevelArena(NULL),
+    mpPreviousArena(NULL),
+
+    /// Joint access.
+    mJointMasterId(1),
+
+    /// Asset pre-loads.
+    mAsyncAssetPreloads(false),
+
+    /// Audio emitters.
+    mAudioEmitterMaxRadius(0.0f),
+    mAudioPass(0),
+    mAudioListenerPosition(0.0f, 0.0f),
+
+    /// Scene time.
+    mSceneTime(0.0f),
+    mScenePause(false),
+
+    /// Debug and metrics.
+    mDebugMask(0X00000000),
+    mpDebugSceneObject(NULL),
+
+    /// Scene occupancy.
+    mEnabledSceneObjectCount(0),
+    mVisibleSceneObjectCount(0),
+
+    /// Scene object pooling.
+    mScenePool(this),
+
+    /// Static layer render caching.
+    mStaticLayerMask(0),
+    mLayerRenderCacheGuard(0.5f),
+
+    /// Batch rendering.
+    mBatchBreakDumpPending(false),
+
+    /// Window rendering.
+    mpCurrentRenderWindow(NULL),
+
+    /// Shared visibility query.
+    mViewQueryTime(0.0f),
+    mViewQueryValid(false),
+    
+    /// Miscellaneous.
+    mIsEditorScene(0),
+    mUpdateCallback(false),
+    mRenderCallback(false),
+    mParallelTick(false),
+    mParallelControllers(false),
+    mParallelParticles(false),
+    mParallelSkeletons(false),
+    mParallelIslands(false),
+    mParallelContacts(false),
+    mParallelRender(false),
+    mDormantCulling(false),
+    mScheduledTick(false),
+    mRewindTime(0.0f),
+    mSnapshotDelay(0.1f),
+    mRewound(false),
+    mTickActive(false),
+    mSceneIndex(0)
+{
+    // Set Vector Associations.
+    VECTOR_SET_ASSOCIATION( mSceneObjects );
+    VECTOR_SET_ASSOCIATION( mTickableSceneObjects );
+    VECTOR_SET_ASSOCIATION( mTickedSceneObjects );
+    VECTOR_SET_ASSOCIATION( mDeleteRequests );
+    VECTOR_SET_ASSOCIATION( mDeleteRequestsTemp );
+    VECTOR_SET_ASSOCIATION( mBeginContacts );
+    VECTOR_SET_ASSOCIATION( mEndContacts );
+    VECTOR_SET_ASSOCIATION( mPendingCallbackObjects );
+    VECTOR_SET_ASSOCIATION( mAssetPreloads );
+    VECTOR_SET_ASSOCIATION( mPendingAssetPreloads );
+     
+    // Initialize layer sort mode.
+    for ( U32 n = 0; n < MAX_LAYERS_SUPPORTED; ++n )
+       mLayerSortModes[n] = SceneRenderQueue::RENDER_SORT_NEWEST;
+
+    // Initialize layer render caches.
+    for ( U32 n = 0; n < MAX_LAYERS_SUPPORTED; ++n )
+        invalidateLayerRenderCache( n );
+
+    // Set debug stats for batch renderer.
+    mBatchRenderer.setDebugStats( &mDebugStats );
+
+    // Register the scene controllers set.
+    mControllers = new SimSet();
+    mControllers->registerObject();
+
+    // Assign scene index.    
+    mSceneIndex = ++sSceneMasterIndex;
+    sSceneCount++;
+}
+
+//-----------------------------------------------------------------------------
+
+Scene::~Scene()
+{
+    // Unregister the scene controllers set.
+    if ( mControllers.notNull() )
+        mControllers->deleteObject();
+
+    // Decrease scene count.
+    --sSceneCount;
+}
+
+//-----------------------------------------------------------------------------
+
+bool Scene::onAdd()
+{
+    // Call Parent.
+    if(!Parent::onAdd())
+        return false;
+
+#ifndef B2_DETERMINISTIC
+    // Use the best available (SSE, NEON or C) math-library kernel for the physics support searches.
+    // NOTE: The deterministic build keeps the scalar kernel as NEON flushes denormals to zero.
+    b2DotVertices = m_point2F_bulk_dot;
+#endif
+
+    // Create the world allocator.
+    if ( mArenaAllocator )
+        mpWorldAllocator = new b2ArenaAllocator();
+
+    // Create physics world.
+    mpWorld = new b2World( mWorldGravity, mpWorldAllocator );
+
+    // Set contact filter.
+    mpWorld->SetContactFilter( &mContactFilter );
+
+    // Set contact listener.
+    mpWorld->SetContactListener( this );
+
+    // Set destruction listener.
+    mpWorld->SetDestructionListener( this );
+
+    // Set parallel executor.
+    updateWorldParallelism();
+
+    // Set broad-phase mode.
+    mpWorld->SetBulkBroadPhase( mBulkBroadPhase );
+
+    // Set broad-phase proxy structure.
+    mpWorld->SetSpatialHash( mSpatialHashCellSize );
+
+    // Set continuous physics budget.
+    mpWorld->SetTOIBudget( mTOIMaxSubSteps, mTOIMaxTime );
+
+    // Create ground body.
+    createGroundBody();
+
+    // Create world query.
+    mpWorldQuery = new WorldQuery(this);
+    mpWorldQuery->setSpatialHash( mSpatialHashCellSize );
+
+    // Set loading scene.
+    Scene::LoadingScene = this;
+
+    // Turn-on tick processing.
+    if ( mScheduledTick )
+        SceneScheduler::getGlobal()->addScene( this );
+    else
+        setProcessTicks( true );
+
+    // Return Okay.
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::onRemove()
+{
+    // Turn-off tick processing.
+    if ( mScheduledTick )
+        SceneScheduler::getGlobal()->removeScene( this );
+    else
+        setProcessTicks( false );
+
+    // Clear Scene.
+    clearScene();
+
+    // Process Delete Requests.
+    processDeleteRequests(true);
+
+    // Delete ground body.
+    mpWorld->DestroyBody( mpGroundBody );
+    mpGroundBody = NULL;
+
+    // Delete physics world and world query.
+    delete mpWorldQuery;
+    delete mpWorld;
+    mpWorldQuery = NULL;
+    mpWorld = NULL;
+
+    // Delete the world allocator.
+    delete mpWorldAllocator;
+    mpWorldAllocator = NULL;
+
+    // Detach All Scene Windows.
+    detachAllSceneWindows();
+
+    // Call Parent. Clear scene handles all the object removal, so we can skip
+    // that part and just do the sim-object stuff.
+    SimObject::onRemove();
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::onDeleteNotify( SimObject* object )
+{
+    // Ignore if we're not monitoring a debug banner scene object.
+    if ( mpDebugSceneObject == NULL )
+        return;
+
+    // Ignore if it's not the one we're monitoring.
+    SceneObject* pSceneObject = dynamic_cast<SceneObject*>( object );
+    if ( pSceneObject != mpDebugSceneObject )
+        return;
+
+    // Reset the monitored scene object.
+    mpDebugSceneObject = NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::initPersistFields()
+{
+    // Call Parent.
+    Parent::initPersistFields();
+
+    // Physics.
+    addProtectedField("Gravity", TypeVector2, Offset(mWorldGravity, Scene), &setGravity, &getGravity, &writeGravity, "" );
+    addField("VelocityIterations", TypeS32, Offset(mVelocityIterations, Scene), &writeVelocityIterations, "" );
+    addField("PositionIterations", TypeS32, Offset(mPositionIterations, Scene), &writePositionIterations, "" );
+    addProtectedField("PhysicsStepRate", TypeF32, Offset(mPhysicsStepRate, Scene), &setPhysicsStepRate, &defaultProtectedGetFn, &writePhysicsStepRate, "The fixed rate (in Hz) the physics is stepped at.  Zero steps the physics once per tick." );
+    addProtectedField("MaxPhysicsSubSteps", TypeS32, Offset(mMaxPhysicsSubSteps, Scene), &setMaxPhysicsSubSteps, &defaultProtectedGetFn, &writeMaxPhysicsSubSteps, "The maximum number of physics steps taken per tick when catching up." );
+    addProtectedField("BulkBroadPhase", TypeBool, Offset(mBulkBroadPhase, Scene), &setBulkBroadPhase, &defaultProtectedGetFn, &writeBulkBroadPhase, "Whether the physics broad-phase is refit in bulk each step rather than updated per body." );
+    addProtectedField("TOIMaxSubSteps", TypeS32, Offset(mTOIMaxSubSteps, Scene), &setTOIMaxSubSteps, &defaultProtectedGetFn, &writeTOIMaxSubSteps, "The maximum number of continuous physics (TOI) sub-steps solved per physics step.  Zero is unlimited." );
+    addProtectedField("TOIMaxTime", TypeF32, Offset(mTOIMaxTime, Scene), &setTOIMaxTime, &defaultProtectedGetFn, &writeTOIMaxTime, "The maximum time (in milliseconds) spent on continuous physics (TOI) per physics step.  Zero is unlimited." );
+    addField("ArenaAllocator", TypeBool, Offset(mArenaAllocator, Scene), &writeArenaAllocator, "Whether the physics world allocates from an arena that is released when the scene is cleared.  This takes effect when the scene is added." );
+    addField("SpatialHashCellSize", TypeF32, Offset(mSpatialHashCellSize, Scene), &writeSpatialHashCellSize, "The cell size of a uniform spatial hash used by the physics broad-phase and the world query instead of a dynamic tree.  Zero uses the dynamic tree.  This takes effect when the scene is added." );
+
+    // Layer sort modes.
+    char buffer[64];
+    for ( U32 n = 0; n < MAX_LAYERS_SUPPORTED; n++ )
+    {
+       dSprintf( buffer, 64, "layerSortMode%d", n );
+       addField( buffer, TypeEnum, OffsetNonConst(mLayerSortModes[n], Scene), &writeLayerSortMode, 1, &SceneRenderQueue::renderSortTable, "");
+    }
+
+    // Static layer render caching.
+    addProtectedField("StaticLayerMask", TypeS32, Offset(mStaticLayerMask, Scene), &setStaticLayerMask, &defaultProtectedGetFn, &writeStaticLayerMask, "The layers whose render output is cached and replayed whilst nothing in them changes.");
+    addProtectedField("LayerRenderCacheGuard", TypeF32, Offset(mLayerRenderCacheGuard, Scene), &setLayerRenderCacheGuard, &defaultProtectedGetFn, &writeLayerRenderCacheGuard, "The fraction of the view size added to each side of the view when caching a static layer so the camera can move without recaching it.");
+
+    addProtectedField("Controllers", TypeSimObjectPtr, Offset(mControllers, Scene), &defaultProtectedNotSetFn, &defaultProtectedGetFn, &defaultProtectedNotWriteFn, "The scene controllers to use.");
+    
+    // Callbacks.
+    addField("UpdateCallback", TypeBool, Offset(mUpdateCallback, Scene), &writeUpdateCallback, "");
+    addField("RenderCallback", TypeBool, Offset(mRenderCallback, Scene), &writeRenderCallback, "");
+
+    // Ticking.
+    addField("ParallelTick", TypeBool, Offset(mParallelTick, Scene), &writeParallelTick, "Whether the spatial part of object integration is split across worker threads or not.");
+    addField("ParallelControllers", TypeBool, Offset(mParallelControllers, Scene), &writeParallelControllers, "Whether scene controllers that allow it apply their forces across worker threads or not.");
+    addField("ParallelParticles", TypeBool, Offset(mParallelParticles, Scene), &writeParallelParticles, "Whether the particles of each particle emitter are integrated across worker threads or not.");
+    addField("ParallelSkeletons", TypeBool, Offset(mParallelSkeletons, Scene), &writeParallelSkeletons, "Whether the poses of skeleton objects are updated across worker threads or not.");
+    addField("AsyncAssetPreloads", TypeBool, Offset(mAsyncAssetPreloads, Scene), &writeAsyncAssetPreloads, "Whether the asset preloads read with the scene are acquired asynchronously over subsequent frames or not.");
+    addProtectedField("ParallelIslands", TypeBool, Offset(mParallelIslands, Scene), &setParallelIslands, &defaultProtectedGetFn, &writeParallelIslands, "Whether independent physics islands are solved across worker threads or not.");
+    addProtectedField("ParallelContacts", TypeBool, Offset(mParallelContacts, Scene), &setParallelContacts, &defaultProtectedGetFn, &writeParallelContacts, "Whether physics contact manifolds are computed across worker threads or not.");
+    addField("ParallelRender", TypeBool, Offset(mParallelRender, Scene), &writeParallelRender, "Whether the render requests of each layer and batch are sorted across worker threads or not.");
+    addField("DormantCulling", TypeBool, Offset(mDormantCulling, Scene), &writeDormantCulling, "Whether dormant objects (asleep with nothing to update) are skipped when ticking or not.");
+    addProtectedField("RewindTime", TypeF32, Offset(mRewindTime, Scene), &setRewindTime, &defaultProtectedGetFn, &writeRewindTime, "How far back (in seconds) the scene can be rewound for lag-compensated queries.  Zero keeps no history.");
+    addProtectedField("SnapshotDelay", TypeF32, Offset(mSnapshotDelay, Scene), &setSnapshotDelay, &defaultProtectedGetFn, &writeSnapshotDelay, "How far behind the scene time (in seconds) objects with snapshots are played back.");
+    addProtectedField("ScheduledTick", TypeBool, Offset(mScheduledTick, Scene), &setScheduledTick, &defaultProtectedGetFn, &writeScheduledTick, "Whether the scene is ticked by the scene scheduler so its physics is stepped concurrently with other scheduled scenes or not.");
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setScheduledTick( const bool scheduledTick )
+{
+    // Finish if no change.
+    if ( mScheduledTick == scheduledTick )
+        return;
+
+    mScheduledTick = scheduledTick;
+
+    // Finish if the scene is not added to the simulation.
+    if ( !isProperlyAdded() )
+        return;
+
+    // Move the scene between the scheduler and its own tick processing.
+    if ( mScheduledTick )
+    {
+        setProcessTicks( false );
+        SceneScheduler::getGlobal()->addScene( this );
+    }
+    else
+    {
+        SceneScheduler::getGlobal()->removeScene( this );
+        setProcessTicks( true );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setParallelIslands( const bool parallelIslands )
+{
+    mParallelIslands = parallelIslands;
+
+    // Update the world.
+    updateWorldParallelism();
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setParallelContacts( const bool parallelContacts )
+{
+    mParallelContacts = parallelContacts;
+
+    // Update the world.
+    updateWorldParallelism();
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::updateWorldParallelism( void )
+{
+    // Finish if there's no world yet.
+    if ( mpWorld == NULL )
+        return;
+
+    // Configure the world.
+    mpWorld->SetParallelIslands( mParallelIslands );
+    mpWorld->SetParallelContacts( mParallelContacts );
+    mpWorld->SetParallelExecutor( mParallelIslands || mParallelContacts ? this : NULL );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setPhysicsStepRate( const F32 stepRate )
+{
+    // Sanity!
+    if ( stepRate < 0.0f )
+    {
+        Con::warnf( "Scene::setPhysicsStepRate() - Invalid physics step rate of '%g'.", stepRate );
+        return;
+    }
+
+    // Set the step rate.
+    mPhysicsStepRate = stepRate;
+
+    // Reset the physics time accumulator.
+    mPhysicsTimeAccumulator = 0.0f;
+}
+
+//-----------------------------------------------------------------------------
+
+// Scene snapshot header (followed by the world snapshot).
+struct SceneSnapshotHeader
+{
+    U32 mSignature;
+    F32 mSceneTime;
+    F32 mPhysicsTimeAccumulator;
+    U32 mWorldSize;
+};
+
+static const U32 sceneSnapshotSignature = 0x32445353;
+
+//-----------------------------------------------------------------------------
+
+U32 Scene::getSnapshotSize( void ) const
+{
+    // Finish if no world.
+    if ( mpWorld == NULL )
+        return 0;
+
+    return sizeof(SceneSnapshotHeader) + (U32)mpWorld->GetSnapshotSize();
+}
+
+//-----------------------------------------------------------------------------
+
+U32 Scene::captureSnapshot( void* pBuffer, const U32 bufferSize ) const
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_CaptureSnapshot);
+
+    // Sanity!
+    AssertFatal( pBuffer != NULL, "Scene::captureSnapshot() - Invalid snapshot buffer." );
+
+    // Finish if no world or the world is stepping.
+    if ( mpWorld == NULL || mpWorld->IsLocked() )
+    {
+        Con::warnf( "Scene::captureSnapshot() - Cannot capture a snapshot whilst the physics is stepping." );
+        return 0;
+    }
+
+    // Finish if the buffer is too small.
+    const U32 snapshotSize = getSnapshotSize();
+    if ( bufferSize < snapshotSize )
+        return 0;
+
+    // Write the scene header.
+    SceneSnapshotHeader* pHeader = static_cast<SceneSnapshotHeader*>( pBuffer );
+    pHeader->mSignature = sceneSnapshotSignature;
+    pHeader->mSceneTime = mSceneTime;
+    pHeader->mPhysicsTimeAccumulator = mPhysicsTimeAccumulator;
+
+    // Write the world snapshot.
+    pHeader->mWorldSize = (U32)mpWorld->SaveSnapshot( pHeader + 1, (int32)(bufferSize - sizeof(SceneSnapshotHeader)) );
+
+    return pHeader->mWorldSize == 0 ? 0 : sizeof(SceneSnapshotHeader) + pHeader->mWorldSize;
+}
+
+//-----------------------------------------------------------------------------
+
+bool Scene::restoreSnapshot( const void* pBuffer, const U32 bufferSize )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_RestoreSnapshot);
+
+    // Sanity!
+    AssertFatal( pBuffer != NULL, "Scene::restoreSnapshot() - Invalid snapshot buffer." );
+
+    // Finish if no world or the world is stepping.
+    if ( mpWorld == NULL || mpWorld->IsLocked() )
+    {
+        Con::warnf( "Scene::restoreSnapshot() - Cannot restore a snapshot whilst the physics is stepping." );
+        return false;
+    }
+
+    // Validate the scene header.
+    const SceneSnapshotHeader* pHeader = static_cast<const SceneSnapshotHeader*>( pBuffer );
+    if (    bufferSize < sizeof(SceneSnapshotHeader) ||
+            pHeader->mSignature != sceneSnapshotSignature ||
+            pHeader->mWorldSize > bufferSize - sizeof(SceneSnapshotHeader) )
+    {
+        Con::warnf( "Scene::restoreSnapshot() - Invalid snapshot." );
+        return false;
+    }
+
+    // Restore the world.
+    // NOTE: This fails if bodies, fixtures or joints were added or removed since the snapshot was captured.
+    if ( !mpWorld->LoadSnapshot( pHeader + 1, (int32)pHeader->mWorldSize ) )
+    {
+        Con::warnf( "Scene::restoreSnapshot() - The snapshot does not match the current scene." );
+        return false;
+    }
+
+    // Restore the scene timing.
+    mSceneTime = pHeader->mSceneTime;
+    mPhysicsTimeAccumulator = pHeader->mPhysicsTimeAccumulator;
+
+    // Reset the scene object spatials to the restored bodies.
+    for( typeSceneObjectVector::iterator itr = mSceneObjects.begin(); itr != mSceneObjects.end(); ++itr )
+    {
+        (*itr)->resetTickSpatials();
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::BeginContact( b2Contact* pContact )
+{
+    // Ignore contact if it's not a touching contact.
+    if ( !pContact->IsTouching() )
+        return;
+
+    PROFILE_SCOPE(Scene_BeginContact);
+
+    // Fetch fixtures.
+    b2Fixture* pFixtureA = pContact->GetFixtureA();
+    b2Fixture* pFixtureB = pContact->GetFixtureB();
+
+    // Fetch physics proxies.
+    PhysicsProxy* pPhysicsProxyA = static_cast<PhysicsProxy*>(pFixtureA->GetBody()->GetUserData());
+    PhysicsProxy* pPhysicsProxyB = static_cast<PhysicsProxy*>(pFixtureB->GetBody()->GetUserData());
+
+    // Ignore stuff that's not a scene object.
+    if (    pPhysicsProxyA->getPhysicsProxyType() != PhysicsProxy::PHYSIC_PROXY_SCENEOBJECT ||
+            pPhysicsProxyB->getPhysicsProxyType() != PhysicsProxy::PHYSIC_PROXY_SCENEOBJECT )
+    {
+            return;
+    }
+
+    // Fetch scene objects.
+    SceneObject* pSceneObjectA = static_cast<SceneObject*>(pPhysicsProxyA);
+    SceneObject* pSceneObjectB = static_cast<SceneObject*>(pPhysicsProxyB);
+
+    // Ignore the contact if neither scene object requires it.
+    if ( !pSceneObjectA->isContactRequired( pSceneObjectB ) && !pSceneObjectB->isContactRequired( pSceneObjectA ) )
+        return;
+
+    // Initialize the contact.
+    TickContact tickContact;
+    tickContact.initialize( pContact, pSceneObjectA, pSceneObjectB, pFixtureA, pFixtureB );
+
+    // Add contact.
+    // NOTE: Contacts are kept in the order Box2D reports them so callbacks are dispatched deterministically.
+    mBeginContactIndices.insert( pContact, (U32)mBeginContacts.size() );
+    mBeginContacts.push_back( tickContact );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::EndContact( b2Contact* pContact )
+{
+    PROFILE_SCOPE(Scene_EndContact);
+
+    // Fetch fixtures.
+    b2Fixture* pFixtureA = pContact->GetFixtureA();
+    b2Fixture* pFixtureB = pContact->GetFixtureB();
+
+    // Fetch physics proxies.
+    PhysicsProxy* pPhysicsProxyA = static_cast<PhysicsProxy*>(pFixtureA->GetBody()->GetUserData());
+    PhysicsProxy* pPhysicsProxyB = static_cast<PhysicsProxy*>(pFixtureB->GetBody()->GetUserData());
+
+    // Ignore stuff that's not a scene object.
+    if (    pPhysicsProxyA->getPhysicsProxyType() != PhysicsProxy::PHYSIC_PROXY_SCENEOBJECT ||
+            pPhysicsProxyB->getPhysicsProxyType() != PhysicsProxy::PHYSIC_PROXY_SCENEOBJECT )
+    {
+            return;
+    }
+
+    // Fetch scene objects.
+    SceneObject* pSceneObjectA = static_cast<SceneObject*>(pPhysicsProxyA);
+    SceneObject* pSceneObjectB = static_cast<SceneObject*>(pPhysicsProxyB);
+
+    // Ignore the contact if neither scene object requires it.
+    if ( !pSceneObjectA->isContactRequired( pSceneObjectB ) && !pSceneObjectB->isContactRequired( pSceneObjectA ) )
+        return;
+
+    // Initialize the contact.
+    TickContact tickContact;
+    tickContact.initialize( pContact, pSceneObjectA, pSceneObjectB, pFixtureA, pFixtureB );
+
+    // Add contact.
+    mEndContacts.push_back( tickContact );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::ParallelFor( b2ParallelRangeCallback callback, void* context, int32 count )
+{
+    // Fetch the island range.
+    IslandRange islandRange;
+    islandRange.mCallback = callback;
+    islandRange.mpContext = context;
+
+    // Solve each island as its own chunk.
+    ThreadPool::getGlobal()->parallelFor( parallelSolveIslands, &islandRange, (U32)count, 1 );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::PostSolve( b2Contact* pContact, const b2ContactImpulse* pImpulse )
+{
+    // Find contact mapping.
+    typeContactIndexHash::iterator contactItr = mBeginContactIndices.find( pContact );
+
+    // Finish if we didn't find the contact.
+    if ( contactItr == mBeginContactIndices.end() )
+        return;
+
+    // Fetch contact.
+    TickContact& tickContact = mBeginContacts[contactItr->value];
+
+    // Add the impulse.
+    for ( U32 index = 0; index < b2_maxManifoldPoints; ++index )
+    {
+        tickContact.mNormalImpulses[index] += pImpulse->normalImpulses[index];
+        tickContact.mTangentImpulses[index] += pImpulse->tangentImpulses[index];
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::forwardContacts( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_ForwardContacts);
+
+    // Iterate end contacts.
+    for( typeContactVector::iterator contactItr = mEndContacts.begin(); contactItr != mEndContacts.end(); ++contactItr )
+    {
+        // Fetch tick contact.
+        TickContact& tickContact = *contactItr;
+
+        // Inform the scene objects.
+        tickContact.mpSceneObjectA->onEndCollision( tickContact );
+        tickContact.mpSceneObjectB->onEndCollision( tickContact );
+    }
+
+    // Iterate begin contacts.
+    for( typeContactVector::iterator contactItr = mBeginContacts.begin(); contactItr != mBeginContacts.end(); ++contactItr )
+    {
+        // Fetch tick contact.
+        TickContact& tickContact = *contactItr;
+
+        // Inform the scene objects.
+        tickContact.mpSceneObjectA->onBeginCollision( tickContact );
+        tickContact.mpSceneObjectB->onBeginCollision( tickContact );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::dispatchBeginContactCallbacks( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_DispatchBeginContactCallbacks);
+
+    // Sanity!
+    AssertFatal( b2_maxManifoldPoints == 2, "Scene::dispatchBeginContactCallbacks() - Invalid assumption about max manifold points." );
+
+    // Fetch contact count.
+    const U32 contactCount = mBeginContacts.size();
+
+    // Finish if no contacts.
+    if ( contactCount == 0 )
+        return;
+
+    // Iterate all contacts.
+    for ( typeContactVector::iterator contactItr = mBeginContacts.begin(); contactItr != mBeginContacts.end(); ++contactItr )
+    {
+        // Fetch contact.
+        const TickContact& tickContact = *contactItr;
+
+        // Fetch scene objects.
+        SceneObject* pSceneObjectA = tickContact.mpSceneObjectA;
+        SceneObject* pSceneObjectB = tickContact.mpSceneObjectB;
+
+        // Skip if either object is being deleted.
+        if ( pSceneObjectA->isBeingDeleted() || pSceneObjectB->isBeingDeleted() )
+            continue;
+
+        // Skip if neither object wants the collision callback for the other.
+        if (    !(pSceneObjectA->getCollisionCallback() && (pSceneObjectA->getCollisionCallbackMask() & pSceneObjectB->getSceneGroupMask()) != 0) &&
+                !(pSceneObjectB->getCollisionCallback() && (pSceneObjectB->getCollisionCallbackMask() & pSceneObjectA->getSceneGroupMask()) != 0) )
+            continue;
+
+        // Fetch normal and contact points.
+        const U32& pointCount = tickContact.mPointCount;
+        const b2Vec2& normal = tickContact.mWorldManifold.normal;
+        const b2Vec2& point1 = tickContact.mWorldManifold.points[0];
+        const b2Vec2& point2 = tickContact.mWorldManifold.points[1];
+        const S32 shapeIndexA = pSceneObjectA->getCollisionShapeIndex( tickContact.mpFixtureA );
+        const S32 shapeIndexB = pSceneObjectB->getCollisionShapeIndex( tickContact.mpFixtureB );
+
+        // Sanity!
+        AssertFatal( shapeIndexA >= 0, "Scene::dispatchBeginContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
+        AssertFatal( shapeIndexB >= 0, "Scene::dispatchBeginContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
+
+        // Fetch collision impulse information
+        const F32 normalImpulse1 = tickContact.mNormalImpulses[0];
+        const F32 normalImpulse2 = tickContact.mNormalImpulses[1];
+        const F32 tangentImpulse1 = tickContact.mTangentImpulses[0];
+        const F32 tangentImpulse2 = tickContact.mTangentImpulses[1];
+
+        // Fetch objects.
+        const char* sceneObjectABuffer = pSceneObjectA->getIdString();
+        const char* sceneObjectBBuffer = pSceneObjectB->getIdString();
+
+        // Format miscellaneous information.
+        char miscInfoBuffer[128];
+        if ( pointCount == 2 )
+        {
+            dSprintf(miscInfoBuffer, sizeof(miscInfoBuffer),
+                "%d %d %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f",
+                shapeIndexA, shapeIndexB,
+                normal.x, normal.y,
+                point1.x, point1.y,
+                normalImpulse1,
+                tangentImpulse1,
+                point2.x, point2.y,
+                normalImpulse2,
+                tangentImpulse2 );
+        }
+        else if ( pointCount == 1 )
+        {
+            dSprintf(miscInfoBuffer, sizeof(miscInfoBuffer),
+                "%d %d %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f",
+                shapeIndexA, shapeIndexB,
+                normal.x, normal.y,
+                point1.x, point1.y,
+                normalImpulse1,
+                tangentImpulse1 );
+        }
+        else
+        {
+            dSprintf(miscInfoBuffer, sizeof(miscInfoBuffer),
+                "%d %d",
+                shapeIndexA, shapeIndexB );
+        }
+
+        // Queue the scene collision callback (or its behaviors if the scene doesn't handle it).
+        const char* sceneArgs[3] = { sceneObjectABuffer, sceneObjectBBuffer, miscInfoBuffer };
+        mContactCallbackQueue.queue( this, sceneCollisionCallbackName, true, 3, sceneArgs );
+
+        // Is object A allowed to collide with object B?
+        if (    (pSceneObjectA->mCollisionGroupMask & pSceneObjectB->mSceneGroupMask) != 0 &&
+                (pSceneObjectA->mCollisionLayerMask & pSceneObjectB->mSceneLayerMask) != 0 )
+        {
+            // Yes, so queue the collision callback (or its behaviors if it doesn't handle it).
+            const char* args[2] = { sceneObjectBBuffer, miscInfoBuffer };
+            mContactCallbackQueue.queue( pSceneObjectA, collisionCallbackName, true, 2, args );
+        }
+
+        // Is object B allowed to collide with object A?
+        if (    (pSceneObjectB->mCollisionGroupMask & pSceneObjectA->mSceneGroupMask) != 0 &&
+                (pSceneObjectB->mCollisionLayerMask & pSceneObjectA->mSceneLayerMask) != 0 )
+        {
+            // Yes, so queue the collision callback (or its behaviors if it doesn't handle it).
+            const char* args[2] = { sceneObjectABuffer, miscInfoBuffer };
+            mContactCallbackQueue.queue( pSceneObjectB, collisionCallbackName, true, 2, args );
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::dispatchEndContactCallbacks( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_DispatchEndContactCallbacks);
+
+    // Sanity!
+    AssertFatal( b2_maxManifoldPoints == 2, "Scene::dispatchEndContactCallbacks() - Invalid assumption about max manifold points." );
+
+    // Fetch contact count.
+    const U32 contactCount = mEndContacts.size();
+
+    // Finish if no contacts.
+    if ( contactCount == 0 )
+        return;
+
+    // Iterate all contacts.
+    for ( typeContactVector::iterator contactItr = mEndContacts.begin(); contactItr != mEndContacts.end(); ++contactItr )
+    {
+        // Fetch contact.
+        const TickContact& tickContact = *contactItr;
+
+        // Fetch scene objects.
+        SceneObject* pSceneObjectA = tickContact.mpSceneObjectA;
+        SceneObject* pSceneObjectB = tickContact.mpSceneObjectB;
+
+        // Skip if either object is being deleted.
+        if ( pSceneObjectA->isBeingDeleted() || pSceneObjectB->isBeingDeleted() )
+            continue;
+
+        // Skip if neither object wants the collision callback for the other.
+        if (    !(pSceneObjectA->getCollisionCallback() && (pSceneObjectA->getCollisionCallbackMask() & pSceneObjectB->getSceneGroupMask()) != 0) &&
+                !(pSceneObjectB->getCollisionCallback() && (pSceneObjectB->getCollisionCallbackMask() & pSceneObjectA->getSceneGroupMask()) != 0) )
+            continue;
+
+        // Fetch shape index.
+        const S32 shapeIndexA = pSceneObjectA->getCollisionShapeIndex( tickContact.mpFixtureA );
+        const S32 shapeIndexB = pSceneObjectB->getCollisionShapeIndex( tickContact.mpFixtureB );
+
+        // Sanity!
+        AssertFatal( shapeIndexA >= 0, "Scene::dispatchEndContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
+        AssertFatal( shapeIndexB >= 0, "Scene::dispatchEndContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
+
+        // Fetch objects.
+        const char* sceneObjectABuffer = pSceneObjectA->getIdString();
+        const char* sceneObjectBBuffer = pSceneObjectB->getIdString();
+
+        // Format miscellaneous information.
+        char miscInfoBuffer[32];
+        dSprintf(miscInfoBuffer, sizeof(miscInfoBuffer), "%d %d", shapeIndexA, shapeIndexB );
+
+        // Queue the scene end collision callback (or its behaviors if the scene doesn't handle it).
+        const char* sceneArgs[3] = { sceneObjectABuffer, sceneObjectBBuffer, miscInfoBuffer };
+        mContactCallbackQueue.queue( this, sceneEndCollisionCallbackName, true, 3, sceneArgs );
+
+        // Is object A allowed to collide with object B?
+        if (    (pSceneObjectA->mCollisionGroupMask & pSceneObjectB->mSceneGroupMask) != 0 &&
+                (pSceneObjectA->mCollisionLayerMask & pSceneObjectB->mSceneLayerMask) != 0 )
+        {
+            // Yes, so queue the end collision callback (or its behaviors if it doesn't handle it).
+            const char* args[2] = { sceneObjectBBuffer, miscInfoBuffer };
+            mContactCallbackQueue.queue( pSceneObjectA, endCollisionCallbackName, true, 2, args );
+        }
+
+        // Is object B allowed to collide with object A?
+        if (    (pSceneObjectB->mCollisionGroupMask & pSceneObjectA->mSceneGroupMask) != 0 &&
+                (pSceneObjectB->mCollisionLayerMask & pSceneObjectA->mSceneLayerMask) != 0 )
+        {
+            // Yes, so queue the end collision callback (or its behaviors if it doesn't handle it).
+            const char* args[2] = { sceneObjectABuffer, miscInfoBuffer };
+            mContactCallbackQueue.queue( pSceneObjectB, endCollisionCallbackName, true, 2, args );
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::addPendingCallbacks( SceneObject* pSceneObject )
+{
+    // Sanity!
+    AssertFatal( pSceneObject != NULL, "Scene::addPendingCallbacks() - Invalid scene object." );
+
+    mPendingCallbackObjects.push_back( pSceneObject->getId() );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::queuePendingCallbacks( void )
+{
+    // Finish if nothing is pending.
+    if ( mPendingCallbackObjects.size() == 0 )
+        return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_QueuePendingCallbacks);
+
+    for ( S32 n = 0; n < mPendingCallbackObjects.size(); ++n )
+    {
+        // Fetch scene object.
+        SceneObject* pSceneObject = Sim::findObject<SceneObject>( mPendingCallbackObjects[n] );
+
+        // Skip if it was deleted or removed from the scene.
+        if ( pSceneObject == NULL || pSceneObject->getScene() != this )
+            continue;
+
+        pSceneObject->queuePendingCallbacks( mCallbackQueue );
+    }
+
+    mPendingCallbackObjects.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::parallelPreIntegrateSpatial( void* pContext, const U32 start, const U32 end )
+{
+    // Fetch the ticked scene objects.
+    SceneObject** ppSceneObjects = static_cast<SceneObject**>( pContext );
+
+    // Pre-integrate spatials.
+    for ( U32 index = start; index < end; ++index )
+    {
+        // Fetch scene object.
+        SceneObject* pSceneObject = ppSceneObjects[index];
+
+        // Skip if the scene object must pre-integrate serially.
+        if ( !pSceneObject->canPreIntegrateInParallel() )
+            continue;
+
+        pSceneObject->preIntegrateSpatial();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::parallelIntegrateSpatial( void* pContext, const U32 start, const U32 end )
+{
+    // Fetch the ticked scene objects.
+    SceneObject** ppSceneObjects = static_cast<SceneObject**>( pContext );
+
+    // Integrate spatials.
+    for ( U32 index = start; index < end; ++index )
+        ppSceneObjects[index]->integrateSpatial();
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::parallelSolveIslands( void* pContext, const U32 start, const U32 end )
+{
+    // Fetch the island range.
+    const IslandRange* pIslandRange = static_cast<const IslandRange*>( pContext );
+
+    // Solve the islands.
+    pIslandRange->mCallback( pIslandRange->mpContext, (int32)start, (int32)end );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::integrateParticleEmitters( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_IntegrateParticleEmitters);
+
+    // Gather all the emitters waiting to be integrated.
+    mEmitterIntegrations.clear();
+    for ( S32 index = 0; index < mParticlePlayers.size(); ++index )
+        mParticlePlayers[index]->gatherEmitterIntegrations( mEmitterIntegrations );
+
+    // Fetch the emitter count.
+    const U32 emitterCount = (U32)mEmitterIntegrations.size();
+
+    // Finish if nothing to integrate.
+    if ( emitterCount == 0 )
+        return;
+
+    // Integrate the emitters in parallel?
+    // NOTE:-   Each emitter is independent with its own random stream so the results don't depend upon the scheduling.
+    if ( mParallelParticles && emitterCount > 1 )
+    {
+        ThreadPool::getGlobal()->parallelFor( ParticlePlayer::integrateEmitterRange, mEmitterIntegrations.address(), emitterCount, 1 );
+        return;
+    }
+
+    // Integrate the emitters serially.
+    ParticlePlayer::integrateEmitterRange( mEmitterIntegrations.address(), 0, emitterCount );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::updateSkeletonPoses( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_UpdateSkeletonPoses);
+
+    // Gather all the skeleton objects waiting for their pose to be updated.
+    mSkeletonPoseUpdates.clear();
+    for ( S32 index = 0; index < mSkeletonObjects.size(); ++index )
+    {
+        if ( mSkeletonObjects[index]->isPoseUpdatePending() )
+            mSkeletonPoseUpdates.push_back( mSkeletonObjects[index] );
+    }
+
+    // Fetch the skeleton count.
+    const U32 skeletonCount = (U32)mSkeletonPoseUpdates.size();
+
+    // Finish if nothing to update.
+    if ( skeletonCount == 0 )
+        return;
+
+    // Update the poses in parallel?
+    // NOTE:-   Each skeleton is independent and any animation events are queued until the post-integrate stage.
+    if ( mParallelSkeletons && skeletonCount > 1 )
+    {
+        ThreadPool::getGlobal()->parallelFor( SkeletonObject::updatePoseRange, mSkeletonPoseUpdates.address(), skeletonCount, 4 );
+        return;
+    }
+
+    // Update the poses serially.
+    SkeletonObject::updatePoseRange( mSkeletonPoseUpdates.address(), 0, skeletonCount );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::updateAudioEmitters( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_UpdateAudioEmitters);
+
+    // Finish if there are no audio emitters.
+    if ( mAudioEmitters.size() == 0 )
+        return;
+
+    // Start a new audio pass.
+    const U32 audioPass = ++mAudioPass;
+
+    // Fetch the listener position.
+    const Vector2 listenerPosition = getAudioListenerPosition();
+
+    // Query for everything within the largest emitter radius of the listener.
+    // NOTE:-   Emitters beyond this are culled by the broad-phase without being visited.
+    b2AABB listenerAABB;
+    listenerAABB.lowerBound.Set( listenerPosition.x - mAudioEmitterMaxRadius, listenerPosition.y - mAudioEmitterMaxRadius );
+    listenerAABB.upperBound.Set( listenerPosition.x + mAudioEmitterMaxRadius, listenerPosition.y + mAudioEmitterMaxRadius );
+    mpWorldQuery->setQueryFilter( WorldQueryFilter( MASK_ALL, MASK_ALL, true, false, false, false ) );
+    mAudioQueryResults.clear();
+    mAudioQueryOffsets.clear();
+    mpWorldQuery->aabbQueryAABBBatch( &listenerAABB, 1, mAudioQueryResults, mAudioQueryOffsets );
+
+    // Attenuate the emitters found.
+    for ( S32 index = 0; index < mAudioQueryResults.size(); ++index )
+    {
+        // Skip if not an audio emitter.
+        AudioEmitter* pAudioEmitter = dynamic_cast<AudioEmitter*>( mAudioQueryResults[index].mpSceneObject );
+        if ( pAudioEmitter == NULL )
+            continue;
+
+        // Skip if the emitter has already been updated in this pass.
+        if ( pAudioEmitter->getAudioPass() == audioPass )
+            continue;
+
+        pAudioEmitter->setAudioPass( audioPass );
+
+        // Calculate the attenuation and the pan from the listener.
+        const Vector2 offset = pAudioEmitter->getPosition() - listenerPosition;
+        const F32 distance = offset.Length();
+        const F32 attenuation = pAudioEmitter->getAttenuation( distance );
+        const F32 pan = mClampF( offset.x / getMax( distance, getMax( pAudioEmitter->getInnerRadius(), b2_linearSlop ) ), -1.0f, 1.0f );
+
+        // Update the emitter audio.
+        pAudioEmitter->updateAudio( attenuation, pan );
+
+        // Track the emitter if it is audible.
+        if ( pAudioEmitter->isAudible() && !mAudibleEmitters.contains( pAudioEmitter ) )
+            mAudibleEmitters.push_back( pAudioEmitter );
+    }
+
+    // Stop any previously audible emitters that are now out of range.
+    for ( S32 index = 0; index < mAudibleEmitters.size(); )
+    {
+        AudioEmitter* pAudioEmitter = mAudibleEmitters[index];
+
+        if ( pAudioEmitter->getAudioPass() != audioPass )
+            pAudioEmitter->stopAudio();
+
+        if ( !pAudioEmitter->isAudible() )
+        {
+            mAudibleEmitters.erase_fast( index );
+            continue;
+        }
+
+        ++index;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::recordRewindHistory( void )
+{
+    // Finish if not keeping a rewind history.
+    if ( mRewindTime <= 0.0f )
+        return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_RecordRewindHistory);
+
+    // Hold enough ticks to cover the rewind time.
+    const U32 capacity = (U32)mCeil( mRewindTime / Tickable::smTickSec ) + 2;
+
+    // Record the ticked scene objects.
+    // NOTE: Dormant objects are not moving so their history can be filled in when they next tick.
+    for ( S32 i = 0; i < mTickedSceneObjects.size(); ++i )
+    {
+        mTickedSceneObjects[i]->recordRewindHistory( mSceneTime, capacity );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::rewind( const F32 sceneTime )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_Rewind);
+
+    // Restore any current rewind.
+    restoreRewind();
+
+    // Finish if not keeping a rewind history.
+    if ( mRewindTime <= 0.0f )
+    {
+        Con::warnf( "Scene::rewind() - Cannot rewind as the scene has no rewind time." );
+        return;
+    }
+
+    mRewound = true;
+
+    // Iterate scene objects.
+    for ( S32 n = 0; n < mSceneObjects.size(); ++n )
+    {
+        // Fetch scene object.
+        SceneObject* pSceneObject = mSceneObjects[n];
+
+        // Skip if the object has no history.
+        const SceneTransformHistory* pHistory = pSceneObject->getRewindHistory();
+        if ( pHistory == NULL )
+            continue;
+
+        // Sample the history.
+        Vector2 position;
+        F32 angle;
+        if ( !pHistory->sample( sceneTime, position, angle ) )
+            continue;
+
+        // Skip if the object was not elsewhere.
+        const b2Vec2 currentPosition = pSceneObject->getPosition();
+        const F32 currentAngle = pSceneObject->getAngle();
+        if ( position.x == currentPosition.x && position.y == currentPosition.y && angle == currentAngle )
+            continue;
+
+        // Store the current transform.
+        RewoundObject rewound;
+        rewound.mpSceneObject = pSceneObject;
+        rewound.mPosition = currentPosition;
+        rewound.mAngle = currentAngle;
+        dMemcpy( rewound.mRenderOOBB, pSceneObject->getRenderOOBB(), sizeof(rewound.mRenderOOBB) );
+        mRewoundObjects.push_back( rewound );
+
+        // Rewind the object.
+        pSceneObject->setRewindTransform( position, angle, NULL );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::restoreRewind( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_RestoreRewind);
+
+    // Restore the rewound objects.
+    for ( S32 n = 0; n < mRewoundObjects.size(); ++n )
+    {
+        const RewoundObject& rewound = mRewoundObjects[n];
+        rewound.mpSceneObject->setRewindTransform( rewound.mPosition, rewound.mAngle, rewound.mRenderOOBB );
+    }
+
+    mRewoundObjects.clear();
+    mRewound = false;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::processTick( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_ProcessTick);
+
+    // Attribute allocations to the scene.
+    Memory::TagScope memoryTag( Memory::TagScene );
+
+    // Add any asset preloads that have finished acquiring.
+    processPendingAssetPreloads();
+
+    // Pre-integrate.
+    preIntegrateTick();
+
+    // Integrate physics.
+    integratePhysicsTick();
+
+    // Post-integrate.
+    postIntegrateTick();
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::preIntegrateTick( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_PreIntegrateTick);
+
+    // Reset the tick.
+    mTickActive = false;
+
+    // Finish if the Scene is not added to the simulation.
+    if ( !isProperlyAdded() )
+        return;
+
+    // Restore any rewind that was left in place.
+    if ( mRewound )
+    {
+        Con::warnf( "Scene::preIntegrateTick() - The scene was rewound but not restored." );
+        restoreRewind();
+    }
+
+    // Tick phase timer.
+    b2Timer phaseTimer;
+
+    // Process Delete Requests.
+    processDeleteRequests(false);
+    mDebugStats.tickPhases[DebugStats::TICK_PHASE_DELETE_REQUESTS].addSample( phaseTimer.GetMilliseconds() );
+
+    // Update debug stats.
+    mDebugStats.fps           = sFramePeriodVariable.get();
+    mDebugStats.frameCount    = (U32)sFrameCountVariable.get();
+    mDebugStats.bodyCount     = (U32)mpWorld->GetBodyCount();
+    mDebugStats.jointCount    = (U32)mpWorld->GetJointCount();
+    mDebugStats.contactCount  = (U32)mpWorld->GetContactCount();
+    mDebugStats.proxyCount    = (U32)mpWorld->GetProxyCount();
+    mDebugStats.toiSubStepCount = (U32)mpWorld->GetTOISubStepCount();
+    mDebugStats.toiBudgetExhaustedCount = (U32)mpWorld->GetTOIBudgetExhaustedCount();
+
+    // Update world allocator stats.
+    b2AllocatorStats allocatorStats;
+    mpWorld->GetAllocator()->GetStats( &allocatorStats );
+    mDebugStats.allocatorUsed        = (U32)allocatorStats.bytesUsed;
+    mDebugStats.allocatorReserved    = (U32)allocatorStats.bytesReserved;
+    mDebugStats.allocatorAllocations = (U32)allocatorStats.allocationCount;
+    mDebugStats.objectsCount  = (U32)mSceneObjects.size();
+    mDebugStats.worldProfile  = mpWorld->GetProfile();
+
+    // Set particle stats.
+    mDebugStats.particlesAlloc = ParticleSystem::Instance->getAllocatedParticleCount();
+    mDebugStats.particlesUsed = ParticleSystem::Instance->getActiveParticleCount();
+    mDebugStats.particlesFree = mDebugStats.particlesAlloc - mDebugStats.particlesUsed;
+
+    // Update frame stats.
+    FrameStats::addCount( FrameStats::StatContacts, mDebugStats.contactCount );
+    FrameStats::setValue( FrameStats::StatParticles, (F32)mDebugStats.particlesUsed );
+
+    // Finish if scene is paused.
+    if ( getScenePause() )
+        return;
+
+    // Flag the tick as active.
+    mTickActive = true;
+
+    // Reset object stats.
+    U32 objectsAwake   = 0;
+
+    // Update scene time.
+    mSceneTime += Tickable::smTickSec;
+
+    // Take a snapshot of the tickable scene objects.
+    // NOTE: The tickable set is maintained incrementally as objects change state so it can change whilst ticking.
+    if ( mDormantCulling )
+    {
+        // Skip dormant scene objects.
+        mTickedSceneObjects.clear();
+        for ( S32 n = 0; n < mTickableSceneObjects.size(); ++n )
+        {
+            // Fetch scene object.
+            SceneObject* pSceneObject = mTickableSceneObjects[n];
+
+            if ( !pSceneObject->isTickDormant() )
+                mTickedSceneObjects.push_back( pSceneObject );
+        }
+    }
+    else
+    {
+        mTickedSceneObjects = mTickableSceneObjects;
+    }
+
+    // Update object stats.
+    mDebugStats.objectsEnabled = mEnabledSceneObjectCount;
+    mDebugStats.objectsVisible = mVisibleSceneObjectCount;
+
+    // Debug Status Reference.
+    DebugStats* pDebugStats = &mDebugStats;
+
+    // Fetch ticked scene object count.
+    const S32 tickedSceneObjectCount = mTickedSceneObjects.size();
+    FrameStats::addCount( FrameStats::StatTickedObjects, tickedSceneObjectCount );
+
+    // Should we integrate spatials in parallel?
+    const bool parallelTick = mParallelTick && tickedSceneObjectCount >= (S32)sParallelTickMinimumObjects;
+
+    // ****************************************************
+    // Pre-integrate objects.
+    // ****************************************************
+
+    phaseTimer.Reset();
+
+    // Pre-integrate spatials in parallel.
+    if ( parallelTick )
+    {
+        // Debug Profiling.
+        PROFILE_SCOPE(Scene_ParallelPreIntegrate);
+
+        ThreadPool::getGlobal()->parallelFor( parallelPreIntegrateSpatial, mTickedSceneObjects.address(), tickedSceneObjectCount, sParallelTickChunkSize );
+    }
+
+    // Iterate ticked scene objects.
+    for ( S32 i = 0; i < tickedSceneObjectCount; ++i )
+    {
+        // Debug Profiling.
+        PROFILE_SCOPE(Scene_PreIntegrate);
+
+        // Fetch scene object.
+        SceneObject* pSceneObject = mTickedSceneObjects[i];
+
+        // Update awake count.
+        if ( pSceneObject->getAwake() )
+            objectsAwake++;
+
+        // Pre-integrate.
+        pSceneObject->preIntegrate( mSceneTime, Tickable::smTickSec, pDebugStats );
+    }
+
+    // Update awake stats.
+    mDebugStats.objectsAwake = objectsAwake;
+
+    mDebugStats.tickPhases[DebugStats::TICK_PHASE_PRE_INTEGRATE].addSample( phaseTimer.GetMilliseconds() );
+
+    // ****************************************************
+    // Integrate controllers.
+    // ****************************************************
+
+    phaseTimer.Reset();
+
+    // Fetch the controller set.
+    SimSet* pControllerSet = getControllers();
+
+    // Do we have any scene controllers?
+    if ( pControllerSet != NULL )
+    {
+        // Debug Profiling.
+        PROFILE_SCOPE(Scene_IntegrateSceneControllers);
+
+        // Yes, so fetch scene controller count.
+        const S32 sceneControllerCount = (S32)pControllerSet->size();
+
+        // Iterate scene controllers.
+        for( S32 i = 0; i < sceneControllerCount; i++ )
+        {
+            // Fetch the scene controller.
+            SceneController* pController = dynamic_cast<SceneController*>((*pControllerSet)[i]);
+
+            // Skip if not a controller.
+            if ( pController == NULL )
+                continue;
+
+            // Integrate.
+            pController->integrate( this, mSceneTime, Tickable::smTickSec, pDebugStats );
+        }
+    }
+
+    mDebugStats.tickPhases[DebugStats::TICK_PHASE_CONTROLLERS].addSample( phaseTimer.GetMilliseconds() );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::integratePhysicsTick( void )
+{
+    // Finish if the tick is not active.
+    if ( !mTickActive )
+        return;
+
+    // Fetch if a "normal" i.e. non-editor scene.
+    const bool isNormalScene = !getIsEditorScene();
+
+    // ****************************************************
+    // Integrate physics.
+    // ****************************************************
+
+    // Tick phase timer.
+    b2Timer phaseTimer;
+
+    // Fetch the physics time-step and the number of physics sub-steps for this tick.
+    F32 physicsTimeStep = Tickable::smTickSec;
+    U32 physicsSubSteps = 1;
+    if ( mPhysicsStepRate > 0.0f )
+    {
+        // Accumulate the tick time.
+        physicsTimeStep = 1.0f / mPhysicsStepRate;
+        mPhysicsTimeAccumulator += Tickable::smTickSec;
+        physicsSubSteps = (U32)mFloor( mPhysicsTimeAccumulator / physicsTimeStep );
+
+        // Have we exceeded the catch-up budget?
+        if ( physicsSubSteps > (U32)mMaxPhysicsSubSteps )
+        {
+            // Yes, so clamp the sub-steps and discard the remaining time.
+            physicsSubSteps = (U32)mMaxPhysicsSubSteps;
+            mPhysicsTimeAccumulator = 0.0f;
+        }
+        else
+        {
+            // No, so consume the sub-steps time.
+            mPhysicsTimeAccumulator -= physicsSubSteps * physicsTimeStep;
+        }
+    }
+
+    // Iterate the physics sub-steps.
+    for ( U32 subStep = 0; subStep < physicsSubSteps; ++subStep )
+    {
+        // Debug Profiling.
+        PROFILE_START(Scene_IntegratePhysicsSystem);
+
+        // Reset contacts.
+        mBeginContacts.clear();
+        mBeginContactIndices.clear();
+        mEndContacts.clear();
+
+        // Only step the physics if a "normal" scene.
+        if ( isNormalScene )
+        {
+            // Step the physics.
+            Memory::TagScope physicsMemoryTag( Memory::TagPhysics );
+            mpWorld->Step( physicsTimeStep, mVelocityIterations, mPositionIterations );
+        }
+
+        // Debug Profiling.
+        PROFILE_END();   // Scene_IntegratePhysicsSystem
+
+        // Forward the contacts.
+        // NOTE: Contacts are forwarded for each sub-step as the physics contacts they refer to may not survive the next sub-step.
+        forwardContacts();
+
+        // Only queue contacts callbacks if a "normal" scene.
+        if ( isNormalScene )
+        {
+            // Queue contacts callbacks.
+            dispatchEndContactCallbacks();
+            dispatchBeginContactCallbacks();
+        }
+    }
+
+    mDebugStats.tickPhases[DebugStats::TICK_PHASE_WORLD_STEP].addSample( phaseTimer.GetMilliseconds() );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::postIntegrateTick( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_PostIntegrateTick);
+
+    // Finish if the Scene is not added to the simulation.
+    if ( !isProperlyAdded() )
+        return;
+
+    // Is the tick active?
+    if ( mTickActive )
+    {
+        // Debug Status Reference.
+        DebugStats* pDebugStats = &mDebugStats;
+
+        // Fetch ticked scene object count.
+        const S32 tickedSceneObjectCount = mTickedSceneObjects.size();
+
+        // Should we integrate spatials in parallel?
+        const bool parallelTick = mParallelTick && tickedSceneObjectCount >= (S32)sParallelTickMinimumObjects;
+
+        // Tick phase timer.
+        b2Timer phaseTimer;
+
+        // ****************************************************
+        // Integrate objects.
+        // ****************************************************
+
+        // Integrate spatials in parallel.
+        if ( parallelTick )
+        {
+            // Debug Profiling.
+            PROFILE_SCOPE(Scene_ParallelIntegrate);
+
+            ThreadPool::getGlobal()->parallelFor( parallelIntegrateSpatial, mTickedSceneObjects.address(), tickedSceneObjectCount, sParallelTickChunkSize );
+        }
+
+        // Iterate ticked scene objects.
+        for ( S32 i = 0; i < tickedSceneObjectCount; ++i )
+        {
+            // Debug Profiling.
+            PROFILE_SCOPE(Scene_IntegrateObject);
+
+            // Integrate.
+            mTickedSceneObjects[i]->integrateObject( mSceneTime, Tickable::smTickSec, pDebugStats );
+        }
+
+        // Queue the callbacks pending from the contacts and integration.
+        queuePendingCallbacks();
+
+        // Record the rewind history.
+        recordRewindHistory();
+
+        // Integrate the particle emitters.
+        integrateParticleEmitters();
+
+        // Update the skeleton poses.
+        updateSkeletonPoses();
+
+        // Update the audio emitters.
+        updateAudioEmitters();
+
+        // Release any particle pool blocks left idle after a spike.
+        ParticleSystem::Instance->trimParticlePool();
+
+        // ****************************************************
+        // Post-Integrate Stage.
+        // ****************************************************
+
+        // Iterate ticked scene objects.
+        for ( S32 i = 0; i < tickedSceneObjectCount; ++i )
+        {
+            // Debug Profiling.
+            PROFILE_SCOPE(Scene_PostIntegrate);
+
+            // Post-integrate.
+            mTickedSceneObjects[i]->postIntegrate( mSceneTime, Tickable::smTickSec, pDebugStats );
+        }
+
+        // Dispatch the post-integrate callbacks.
+        mCallbackQueue.dispatch();
+
+        // Scene update callback.
+        if( mUpdateCallback )
+        {
+            // Debug Profiling.
+            PROFILE_SCOPE(Scene_OnSceneUpdatetCallback);
+
+            Con::executef( this, 1, "onSceneUpdate" );
+        }
+
+        mDebugStats.tickPhases[DebugStats::TICK_PHASE_INTEGRATE].addSample( phaseTimer.GetMilliseconds() );
+
+        // Dispatch contacts callbacks.
+        phaseTimer.Reset();
+        mContactCallbackQueue.dispatch();
+        mDebugStats.tickPhases[DebugStats::TICK_PHASE_CONTACT_DISPATCH].addSample( phaseTimer.GetMilliseconds() );
+
+        // Clear ticked scene objects.
+        mTickedSceneObjects.clear();
+
+        // Reset the tick.
+        mTickActive = false;
+    }
+
+    // Update debug stat ranges.
+    mDebugStats.updateRanges();
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::interpolateTick( F32 timeDelta )
+{
+    // Finish if scene is paused.
+    if ( getScenePause() ) return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_InterpolateTick);
+
+    // ****************************************************
+    // Interpolate scene objects.
+    // ****************************************************
+
+    // Interpolate the scene object spatials.
+    mTransformStore.interpolate( timeDelta );
+
+    // Fetch the scene object count.
+    const S32 sceneObjectCount = mSceneObjects.size();
+
+    // Iterate scene objects.
+    for( S32 n = 0; n < sceneObjectCount; ++n )
+    {
+        // Fetch scene object.
+        SceneObject* pSceneObject = mSceneObjects[n];
+
+        // Skip interpolation of scene object if it's not eligible.
+        if ( !pSceneObject->isEnabled() || pSceneObject->isBeingDeleted() )
+            continue;
+
+        pSceneObject->interpolateObject( timeDelta );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_RenderSceneTotal);
+
+    // Attribute allocations to the scene.
+    Memory::TagScope memoryTag( Memory::TagScene );
+
+    // Time the GPU cost of the scene.
+    GpuTimerScope sceneGpuTimerScope( GpuTimer::SectionScene );
+
+    // Fetch debug stats.
+    DebugStats* pDebugStats = pSceneRenderState->mpDebugStats;
+
+    // Reset Render Stats.
+    pDebugStats->renderPicked                   = 0;
+    pDebugStats->renderRequests                 = 0;
+    pDebugStats->renderFallbacks                = 0;
+    pDebugStats->batchTrianglesSubmitted        = 0;
+    pDebugStats->batchDrawCallsStrict           = 0;
+    pDebugStats->batchDrawCallsSorted           = 0;
+    pDebugStats->batchFlushes                   = 0;
+    pDebugStats->batchBlendStateFlush           = 0;
+    pDebugStats->batchColorStateFlush           = 0;
+    pDebugStats->batchAlphaStateFlush           = 0;
+    pDebugStats->batchTextureChangeFlush        = 0;
+    pDebugStats->batchBufferFullFlush           = 0;
+    pDebugStats->batchIsolatedFlush             = 0;
+    pDebugStats->batchLayerFlush                = 0;
+    pDebugStats->batchNoBatchFlush              = 0;
+    pDebugStats->batchAnonymousFlush            = 0;
+
+    // Set batch renderer wireframe mode.
+    mBatchRenderer.setWireframeMode( getDebugMask() & SCENE_DEBUG_WIREFRAME_RENDER );
+
+    // Set the batch renderer pixel size so mip-streamed textures can measure their on-screen texel density.
+    mBatchRenderer.setPixelSize( getMin( pSceneRenderState->mRenderScale.x, pSceneRenderState->mRenderScale.y ) );
+
+    // Track batch breaks for the metrics overlay or a pending dump.
+    mBatchRenderer.setBreakTracking( (getDebugMask() & SCENE_DEBUG_METRICS) || mBatchBreakDumpPending );
+    mBatchRenderer.clearBatchBreaks();
+
+    // Debug Profiling.
+    PROFILE_START(Scene_RenderSceneVisibleQuery);
+
+    // Rotate the render AABB by the camera angle.
+    b2AABB cameraAABB;
+    CoreMath::mRotateAABB( pSceneRenderState->mRenderAABB, pSceneRenderState->mRenderAngle, cameraAABB );
+
+    // Resolve which static layers render from their cache and which are captured into it.
+    U32 cachedLayerMask;
+    U32 captureLayerMask;
+    SceneRenderState captureRenderState( *pSceneRenderState );
+    resolveLayerRenderCaches( pSceneRenderState, captureRenderState, cachedLayerMask, captureLayerMask );
+
+    // Rotate the world matrix by the camera angle.
+    const Vector2& cameraPosition = pSceneRenderState->mRenderPosition;
+    glTranslatef( cameraPosition.x, cameraPosition.y, 0.0f );
+    glRotatef( mRadToDeg(pSceneRenderState->mRenderAngle), 0.0f, 0.0f, 1.0f );
+    glTranslatef( -cameraPosition.x, -cameraPosition.y, 0.0f );
+
+    // Clear world query.
+    mpWorldQuery->clearQuery();
+
+    // Set filter, skipping any layers rendered from their cache.
+    WorldQueryFilter queryFilter( pSceneRenderState->mRenderLayerMask & ~cachedLayerMask, pSceneRenderState->mRenderGroupMask, true, true, false, false );
+
+    // Query the render AABB or, if any layers are being captured, the guarded render AABB so the capture covers it.
+    b2AABB queryAABB = cameraAABB;
+    if ( captureLayerMask != 0 )
+        CoreMath::mRotateAABB( captureRenderState.mRenderAABB, pSceneRenderState->mRenderAngle, queryAABB );
+
+    // Use the query shared with other windows viewing the scene if possible.
+    if ( !fetchViewQuery( pSceneRenderState, queryFilter, queryAABB ) )
+    {
+        mpWorldQuery->setQueryFilter( queryFilter );
+        mpWorldQuery->aabbQueryAABB( queryAABB );
+    }
+
+    // Debug Profiling.
+    PROFILE_END();  //Scene_RenderSceneVisibleQuery
+
+    // Are there any query results or cached layers?
+    if ( mpWorldQuery->getQueryResultsCount() > 0 || cachedLayerMask != 0 )
+    {
+        // Debug Profiling.
+        PROFILE_SCOPE(Scene_RenderSceneCompileRenderRequests);
+
+        // Layer render queues and the queues that need sorting.
+        SceneRenderQueue* layerRenderQueues[MAX_LAYERS_SUPPORTED];
+        Vector<SceneRenderQueue*> pendingSortQueues;
+        U32 pendingSortRequestCount = 0;
+
+        // Compile the render requests for each layer.
+        for ( S32 layer = MAX_LAYERS_SUPPORTED-1; layer >= 0 ; layer-- )
+        {
+            // Reset the layer render queue.
+            layerRenderQueues[layer] = NULL;
+
+            // Skip if the layer is rendered from its cache.
+            if ( cachedLayerMask & BIT(layer) )
+                continue;
+
+            // Fetch layer.
+            typeWorldQueryResultVector& layerResults = mpWorldQuery->getLayeredQueryResults( layer );
+
+            // Fetch layer object count.
+            const U32 layerObjectCount = layerResults.size();
+
+            // Skip if there are no objects to render in this layer.
+            if ( layerObjectCount == 0 )
+                continue;
+
+            // Fetch the render state for the layer.
+            const SceneRenderState* pLayerRenderState = (captureLayerMask & BIT(layer)) ? &captureRenderState : pSceneRenderState;
+
+            // Create the layer render queue.
+            SceneRenderQueue* pSceneRenderQueue = SceneRenderQueueFactory.createObject();
+            layerRenderQueues[layer] = pSceneRenderQueue;
+
+            // Increase render picked.
+            pDebugStats->renderPicked += layerObjectCount;
+
+            // Iterate query results.
+            for( typeWorldQueryResultVector::iterator worldQueryItr = layerResults.begin(); worldQueryItr != layerResults.end(); ++worldQueryItr )
+            {
+                // Fetch scene object.
+                SceneObject* pSceneObject = worldQueryItr->mpSceneObject;
+
+                // Skip if the object should not render.
+                if ( !pSceneObject->shouldRender() )
+                    continue;
+
+                // Can the scene object prepare a render?
+                if ( pSceneObject->canPrepareRender() )
+                {
+                    // Yes. so is it batch isolated.
+                    if ( pSceneObject->getBatchIsolated() )
+                    {
+                        // Yes, so create a default render request  on the primary queue.
+                        SceneRenderRequest* pIsolatedSceneRenderRequest = Scene::createDefaultRenderRequest( pSceneRenderQueue, pSceneObject );
+
+                        // Create a new isolated render queue.
+                        SceneRenderQueue* pIsolatedRenderQueue = SceneRenderQueueFactory.createObject();
+                        pIsolatedSceneRenderRequest->mpIsolatedRenderQueue = pIsolatedRenderQueue;
+
+                        // Prepare in the isolated queue.
+                        pSceneObject->scenePrepareRender( pLayerRenderState, pIsolatedRenderQueue );
+
+                        // Fetch isolated render request count.
+                        const U32 isolatedRenderRequestCount = (U32)pIsolatedRenderQueue->getRenderRequests().size();
+
+                        // Increase render request count.
+                        pDebugStats->renderRequests += isolatedRenderRequestCount;
+
+                        // Adjust for the extra private render request.
+                        pDebugStats->renderRequests -= 1;
+
+                        // Queue the isolated render requests for sorting.
+                        pendingSortQueues.push_back( pIsolatedRenderQueue );
+                        pendingSortRequestCount += isolatedRenderRequestCount;
+                    }
+                    else
+                    {
+                        // No, so prepare in primary queue.
+                        pSceneObject->scenePrepareRender( pLayerRenderState, pSceneRenderQueue );
+                    }
+                }
+                else
+                {
+                    // No, so create a default render request for it.
+                    Scene::createDefaultRenderRequest( pSceneRenderQueue, pSceneObject );
+                }
+            }
+
+            // Fetch render request count.
+            const U32 renderRequestCount = (U32)pSceneRenderQueue->getRenderRequests().size();
+
+            // Increase render request count.
+            pDebugStats->renderRequests += renderRequestCount;
+
+            // Do we have more than a single render request?
+            if ( renderRequestCount > 1 )
+            {
+                // Yes, so fetch layer sort mode.
+                SceneRenderQueue::RenderSort& mode = mLayerSortModes[layer];
+
+                // Temporarily switch to normal sort if batch sort but batcher disabled.
+                if ( !mBatchRenderer.getBatchEnabled() && mode == SceneRenderQueue::RENDER_SORT_BATCH )
+                    mode = SceneRenderQueue::RENDER_SORT_NEWEST;
+
+                // Set render queue mode.
+                pSceneRenderQueue->setSortMode( mode );
+
+                // Queue the render requests for sorting.
+                pendingSortQueues.push_back( pSceneRenderQueue );
+                pendingSortRequestCount += renderRequestCount;
+            }
+        }
+
+        // Sort the render requests.
+        sortRenderQueues( pendingSortQueues, pendingSortRequestCount );
+
+        // Render the layers in order.
+        for ( S32 layer = MAX_LAYERS_SUPPORTED-1; layer >= 0 ; layer-- )
+        {
+            // Time the GPU cost of the layer if it renders anything.
+            GpuTimerScope layerGpuTimerScope( (cachedLayerMask & BIT(layer)) || layerRenderQueues[layer] != NULL ? sLayerGpuSectionNames[layer] : NULL );
+
+            // Is the layer rendered from its cache?
+            if ( cachedLayerMask & BIT(layer) )
+            {
+                // Yes, so render it.
+                renderLayerCache( pSceneRenderState, layer );
+                continue;
+            }
+
+            // Fetch layer.
+            typeWorldQueryResultVector& layerResults = mpWorldQuery->getLayeredQueryResults( layer );
+
+            // Fetch the layer render queue.
+            SceneRenderQueue* pSceneRenderQueue = layerRenderQueues[layer];
+
+            // Is the layer being captured?
+            bool captureLayer = (captureLayerMask & BIT(layer)) != 0;
+
+            // Fetch the render state for the layer.
+            const SceneRenderState* pLayerRenderState = captureLayer ? &captureRenderState : pSceneRenderState;
+
+            // Are there any objects to render in this layer?
+            if ( pSceneRenderQueue != NULL )
+            {
+                // Fetch render requests.
+                SceneRenderQueue::typeRenderRequestVector& sceneRenderRequests = pSceneRenderQueue->getRenderRequests();
+
+                // Fetch render request count.
+                const U32 renderRequestCount = (U32)sceneRenderRequests.size();
+
+                // Is the layer being captured?
+                if ( captureLayer )
+                {
+                    // Yes, so the capture is only valid if every object can be replayed from it.
+                    for( typeWorldQueryResultVector::iterator worldQueryItr = layerResults.begin(); captureLayer && worldQueryItr != layerResults.end(); ++worldQueryItr )
+                    {
+                        SceneObject* pSceneObject = worldQueryItr->mpSceneObject;
+                        captureLayer = pSceneObject->canCacheRender() && !pSceneObject->getBatchIsolated();
+                    }
+
+                    // ... and every render request is batch rendered.
+                    for( SceneRenderQueue::typeRenderRequestVector::iterator renderRequestItr = sceneRenderRequests.begin(); captureLayer && renderRequestItr != sceneRenderRequests.end(); ++renderRequestItr )
+                    {
+                        SceneRenderObject* pSceneRenderObject = (*renderRequestItr)->mpSceneRenderObject;
+                        captureLayer = pSceneRenderObject->isBatchRendered() && pSceneRenderObject->validRender();
+                    }
+
+                    // Start capturing if valid otherwise don't try again until the layer or view changes.
+                    if ( captureLayer )
+                        mBatchRenderer.beginCapture( &mLayerRenderCaches[layer].mBatchCache );
+                    else
+                        mLayerRenderCaches[layer].mUncacheable = true;
+                }
+
+                // Iterate render requests.
+                for( SceneRenderQueue::typeRenderRequestVector::iterator renderRequestItr = sceneRenderRequests.begin(); renderRequestItr != sceneRenderRequests.end(); ++renderRequestItr )
+                {
+                     // Debug Profiling.
+                    PROFILE_SCOPE(Scene_RenderSceneRequests);
+
+                    // Fetch render request.
+                    SceneRenderRequest* pSceneRenderRequest = *renderRequestItr;
+
+                    // Fetch scene render object.
+                    SceneRenderObject* pSceneRenderObject = pSceneRenderRequest->mpSceneRenderObject;
+
+                    // Blame the object for any batch breaks from here on.
+                    mBatchRenderer.setBatchSubmitter( pSceneRenderObject );
+             
+                    // Flush any vector geometry if the object is render batched and we're in strict order mode.
+                    if ( pSceneRenderObject->isBatchRendered() && mBatchRenderer.getStrictOrderMode() )
+                    {
+                        mDebugDraw.Flush();
+                    }
+
+                    // Flush if the object is not render batched and we're in strict order mode.
+                    if ( !pSceneRenderObject->isBatchRendered() && mBatchRenderer.getStrictOrderMode() )
+                    {
+                        mBatchRenderer.flush( BatchRender::FLUSH_NO_BATCH );
+                    }
+                    // Flush if the object is batch isolated.
+                    else if ( pSceneRenderObject->getBatchIsolated() )
+                    {
+                        mBatchRenderer.flush( BatchRender::FLUSH_ISOLATED );
+                    }
+
+                    // Yes, so is the object batch rendered?
+                    if ( pSceneRenderObject->isBatchRendered() )
+                    {
+                        // Yes, so set the blend mode.
+                        mBatchRenderer.setBlendMode( pSceneRenderRequest );
+
+                        // Set the alpha test mode.
+                        mBatchRenderer.setAlphaTestMode( pSceneRenderRequest );
+                    }
+
+                    // Set batch strict order mode.
+                    // NOTE:    We keep reasserting this because an object is free to change it during rendering.
+                    mBatchRenderer.setStrictOrderMode( pSceneRenderQueue->getStrictOrderMode() );
+
+                    // Is the object batch isolated?
+                    if ( pSceneRenderObject->getBatchIsolated() )
+                    {
+                        // Yes, so fetch isolated render queue.
+                        SceneRenderQueue* pIsolatedRenderQueue = pSceneRenderRequest->mpIsolatedRenderQueue;
+
+                        // Sanity!
+                        AssertFatal( pIsolatedRenderQueue != NULL, "Cannot render batch isolated with an isolated render queue." );
+
+                        // Fetch isolated render requests (already sorted).
+                        SceneRenderQueue::typeRenderRequestVector& isolatedRenderRequests = pIsolatedRenderQueue->getRenderRequests();
+
+                        // Can the object render?
+                        if ( pSceneRenderObject->validRender() )
+                        {
+                            // Yes, so iterate isolated render requests.
+                            for( SceneRenderQueue::typeRenderRequestVector::iterator isolatedRenderRequestItr = isolatedRenderRequests.begin(); isolatedRenderRequestItr != isolatedRenderRequests.end(); ++isolatedRenderRequestItr )
+                            {
+                                pSceneRenderObject->sceneRender( pLayerRenderState, *isolatedRenderRequestItr, &mBatchRenderer );
+                            }
+                        }
+                        else
+                        {
+                            // No, so iterate isolated render requests.
+                            for( SceneRenderQueue::typeRenderRequestVector::iterator isolatedRenderRequestItr = isolatedRenderRequests.begin(); isolatedRenderRequestItr != isolatedRenderRequests.end(); ++isolatedRenderRequestItr )
+                            {
+                                pSceneRenderObject->sceneRenderFallback( pLayerRenderState, *isolatedRenderRequestItr, &mBatchRenderer );
+                            }
+
+                            // Increase render fallbacks.
+                            pDebugStats->renderFallbacks++;
+                        }
+
+                        // Flush isolated batch.
+                        mBatchRenderer.flush( BatchRender::FLUSH_ISOLATED );
+                    }
+                    else
+                    {
+                        // No, so can the object render?
+                        if ( pSceneRenderObject->validRender() )
+                        {
+                            // Yes, so render object.
+                            pSceneRenderObject->sceneRender( pLayerRenderState, pSceneRenderRequest, &mBatchRenderer );
+                        }
+                        else
+                        {
+                            // No, so render using fallback.
+                            pSceneRenderObject->sceneRenderFallback( pLayerRenderState, pSceneRenderRequest, &mBatchRenderer );
+
+                            // Increase render fallbacks.
+                            pDebugStats->renderFallbacks++;
+                        }
+                    }
+                }
+
+                // The layer flush isn't caused by any object.
+                mBatchRenderer.setBatchSubmitter( NULL );
+
+                // Flush.
+                // NOTE:    We cannot batch between layers as we adhere to a strict layer render order.
+                //          Vector geometry is flushed first as it was previously drawn as it was submitted.
+                mDebugDraw.Flush();
+                mBatchRenderer.flush( BatchRender::FLUSH_LAYER );
+
+                // Finish the capture if capturing.
+                if ( captureLayer )
+                {
+                    // Stop capturing.
+                    mBatchRenderer.endCapture();
+
+                    // Record the objects and requests the capture represents.
+                    LayerRenderCache& layerCache = mLayerRenderCaches[layer];
+                    layerCache.mSceneObjects.clear();
+                    for( typeWorldQueryResultVector::iterator worldQueryItr = layerResults.begin(); worldQueryItr != layerResults.end(); ++worldQueryItr )
+                        layerCache.mSceneObjects.push_back( worldQueryItr->mpSceneObject );
+                    layerCache.mRenderRequestCount = renderRequestCount;
+                    layerCache.mValid = true;
+                }
+
+                // Iterate query results.
+                for( typeWorldQueryResultVector::iterator worldQueryItr = layerResults.begin(); worldQueryItr != layerResults.end(); ++worldQueryItr )
+                {
+                    // Debug Profiling.
+                    PROFILE_SCOPE(Scene_RenderObjectOverlays);
+
+                    // Fetch scene object.
+                    SceneObject* pSceneObject = worldQueryItr->mpSceneObject;
+
+                    // Render object overlay.
+                    pSceneObject->sceneRenderOverlay( pSceneRenderState );
+                }
+
+                // Flush the overlays.
+                mDebugDraw.Flush();
+
+                // Cache render queue.
+                SceneRenderQueueFactory.cacheObject( pSceneRenderQueue );
+            }
+            else if ( captureLayer )
+            {
+                // Nothing to capture so cache the empty layer.
+                LayerRenderCache& layerCache = mLayerRenderCaches[layer];
+                layerCache.mBatchCache.clear();
+                layerCache.mSceneObjects.clear();
+                layerCache.mRenderRequestCount = 0;
+                layerCache.mValid = true;
+            }
+        }
+    }
+
+    // Draw controllers.
+    if ( getDebugMask() & Scene::SCENE_DEBUG_CONTROLLERS )
+    {
+        // Fetch the controller set.
+        SimSet* pControllerSet = getControllers();
+
+        // Do we have any scene controllers?
+        if ( pControllerSet != NULL )
+        {
+            // Debug Profiling.
+            PROFILE_SCOPE(Scene_RenderControllers);
+
+            // Yes, so fetch scene controller count.
+            const S32 sceneControllerCount = (S32)pControllerSet->size();
+
+            // Iterate scene controllers.
+            for( S32 i = 0; i < sceneControllerCount; i++ )
+            {
+                // Fetch the scene controller.
+                SceneController* pController = dynamic_cast<SceneController*>((*pControllerSet)[i]);
+
+                // Skip if not a controller.
+                if ( pController == NULL )
+                    continue;
+
+                // Render the overlay.
+                pController->renderOverlay( this, pSceneRenderState, &mBatchRenderer );
+            }
+
+            // Flush isolated batch.
+            mDebugDraw.Flush();
+            mBatchRenderer.flush( BatchRender::FLUSH_ISOLATED );
+        }
+    }
+
+    // Draw Joints.
+    if ( getDebugMask() & Scene::SCENE_DEBUG_JOINTS )
+    {
+        // Debug Profiling.
+        PROFILE_SCOPE(Scene_RenderSceneJointOverlays);
+
+        mDebugDraw.DrawJoints( mpWorld );
+        mDebugDraw.Flush();
+    }
+
+    // Dump the batch breaks if requested.
+    if ( mBatchBreakDumpPending )
+    {
+        mBatchBreakDumpPending = false;
+        dumpBatchBreaks( pDebugStats );
+    }
+
+    // Update debug stat ranges.
+    mDebugStats.updateRanges();
+
+    // Are we using the render callback?
+    if( mRenderCallback )
+    {
+        // Debug Profiling.
+        PROFILE_SCOPE(Scene_OnSceneRendertCallback);
+
+        // Yes, so perform callback.
+        Con::executef( this, 1, "onSceneRender" );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::dumpBatchBreaks( const DebugStats* pDebugStats ) const
+{
+    // Fetch the batch breaks.
+    const BatchRender::typeBatchBreakVector& batchBreaks = mBatchRenderer.getBatchBreaks();
+
+    // Calculate the batch efficiency.
+    const U32 drawCalls = pDebugStats->batchDrawCallsStrict + pDebugStats->batchDrawCallsSorted;
+    const F32 trianglesPerFlush = pDebugStats->batchFlushes > 0 ? (F32)pDebugStats->batchTrianglesSubmitted / (F32)pDebugStats->batchFlushes : 0.0f;
+    const F32 trianglesPerDraw = drawCalls > 0 ? (F32)pDebugStats->batchTrianglesSubmitted / (F32)drawCalls : 0.0f;
+
+    Con::printf( "Scene '%s' batch breaks: Flushes=%d, DrawCalls=%d, Triangles=%d, TrianglesPerFlush=%0.1f, TrianglesPerDraw=%0.1f",
+        getIdString(), pDebugStats->batchFlushes, drawCalls, pDebugStats->batchTrianglesSubmitted, trianglesPerFlush, trianglesPerDraw );
+
+    Con::printf( "- Blend=%d, Color=%d, Alpha=%d, Texture=%d, Full=%d, Isolated=%d, Layer=%d, NoBatch=%d, Anonymous=%d",
+        pDebugStats->batchBlendStateFlush,
+        pDebugStats->batchColorStateFlush,
+        pDebugStats->batchAlphaStateFlush,
+        pDebugStats->batchTextureChangeFlush,
+        pDebugStats->batchBufferFullFlush,
+        pDebugStats->batchIsolatedFlush,
+        pDebugStats->batchLayerFlush,
+        pDebugStats->batchNoBatchFlush,
+        pDebugStats->batchAnonymousFlush );
+
+    // Dump each break in the order they happened.
+    for ( BatchRender::typeBatchBreakVector::const_iterator breakItr = batchBreaks.begin(); breakItr != batchBreaks.end(); ++breakItr )
+    {
+        if ( breakItr->mObjectId == 0 )
+        {
+            Con::printf( "- %s flush of %d triangles.", BatchRender::getFlushReasonDescription( breakItr->mReason ), breakItr->mTriangleCount );
+        }
+        else
+        {
+            Con::printf( "- %s flush of %d triangles by %s %d '%s'.",
+                BatchRender::getFlushReasonDescription( breakItr->mReason ), breakItr->mTriangleCount,
+                breakItr->mObjectClass, breakItr->mObjectId, breakItr->mObjectName );
+        }
+    }
+
+    // Warn if breaks went unrecorded.
+    if ( batchBreaks.size() >= BATCHRENDER_MAXBREAKS )
+        Con::printf( "- Only the first %d batch breaks were recorded.", BATCHRENDER_MAXBREAKS );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::parallelSortRenderQueues( void* pContext, const U32 start, const U32 end )
+{
+    // Fetch the render queues.
+    SceneRenderQueue** ppRenderQueues = static_cast<SceneRenderQueue**>( pContext );
+
+    // Sort the render queues.
+    // NOTE: This runs on worker threads so cannot use the profiler.
+    for ( U32 index = start; index < end; ++index )
+        ppRenderQueues[index]->sortRequests();
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::sortRenderQueues( Vector<SceneRenderQueue*>& renderQueues, const U32 renderRequestCount )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_RenderSceneLayerSorting);
+
+    // Fetch the render queue count.
+    const U32 renderQueueCount = (U32)renderQueues.size();
+
+    // Sort serially if not parallel or there are not enough render requests to be worth it.
+    if ( !mParallelRender || renderQueueCount < 2 || renderRequestCount < sParallelRenderMinimumRequests )
+    {
+        for ( U32 index = 0; index < renderQueueCount; ++index )
+            renderQueues[index]->sort();
+
+        return;
+    }
+
+    // Size the sort buffers here so the workers do not allocate.
+    for ( U32 index = 0; index < renderQueueCount; ++index )
+        renderQueues[index]->reserveSort();
+
+    // Sort each render queue on the workers.
+    ThreadPool::getGlobal()->parallelFor( parallelSortRenderQueues, renderQueues.address(), renderQueueCount, 1 );
+}
+
+//-----------------------------------------------------------------------------
+
+bool Scene::fetchViewQuery( const SceneRenderState* pSceneRenderState, const WorldQueryFilter& queryFilter, const b2AABB& queryAABB )
+{
+    // Finish if only one window views the scene or the render isn't for a window.
+    SimObject* pRenderHost = pSceneRenderState->mpRenderHost;
+    if ( mAttachedSceneWindows.size() < 2 || pRenderHost == NULL )
+        return false;
+
+    // Find the view in the shared query.
+    S32 viewIndex = mViewQueryHosts.size() - 1;
+    while ( viewIndex >= 0 && mViewQueryHosts[viewIndex] != pRenderHost )
+        viewIndex--;
+
+    // The shared query is for a single frame so it is rebuilt when any view renders again,
+    // when the scene has been updated or when objects or windows have been added or removed.
+    if ( !mViewQueryValid || mViewQueryTime != mSceneTime || viewIndex < 0 || mViewQueryRendered[viewIndex] )
+    {
+        buildViewQuery();
+
+        viewIndex = mViewQueryHosts.size() - 1;
+        while ( viewIndex >= 0 && mViewQueryHosts[viewIndex] != pRenderHost )
+            viewIndex--;
+
+        // Finish if the view isn't in the query.
+        if ( viewIndex < 0 )
+            return false;
+    }
+
+    mViewQueryRendered[viewIndex] = true;
+
+    // Finish if the view has changed since the query such as when the camera is moved whilst rendering.
+    const b2AABB& viewAABB = mViewQueryAABBs[viewIndex];
+    if ( queryAABB.lowerBound.x < viewAABB.lowerBound.x || queryAABB.lowerBound.y < viewAABB.lowerBound.y ||
+        queryAABB.upperBound.x > viewAABB.upperBound.x || queryAABB.upperBound.y > viewAABB.upperBound.y )
+        return false;
+
+    // Use the results for the view that pass its filter.
+    mpWorldQuery->setQueryFilter( queryFilter );
+    const U32 resultStart = mViewQueryOffsets[viewIndex];
+    mpWorldQuery->setQueryResults( mViewQueryResults.address() + resultStart, mViewQueryOffsets[viewIndex+1] - resultStart );
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::buildViewQuery( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_BuildViewQuery);
+
+    mViewQueryHosts.clear();
+    mViewQueryAABBs.clear();
+    mViewQueryRendered.clear();
+
+    U32 renderLayerMask = 0;
+    U32 renderGroupMask = 0;
+
+    // Fetch the views of the windows that will render.
+    for( SimSet::iterator itr = mAttachedSceneWindows.begin(); itr != mAttachedSceneWindows.end(); ++itr )
+    {
+        SceneWindow* pSceneWindow = static_cast<SceneWindow*>( *itr );
+        if ( !pSceneWindow->isAwake() || !pSceneWindow->isVisible() )
+            continue;
+
+        // Fetch the render AABB as the window will calculate it.
+        const RectF renderArea = pSceneWindow->getCameraRenderArea();
+        b2AABB renderAABB;
+        renderAABB.lowerBound.Set( renderArea.point.x, renderArea.point.y );
+        renderAABB.upperBound.Set( renderArea.point.x + renderArea.extent.x, renderArea.point.y + renderArea.extent.y );
+
+        // Guard the render AABB if static layers may be captured.
+        if ( mStaticLayerMask != 0 )
+        {
+            const b2Vec2 guard = mLayerRenderCacheGuard * (renderAABB.upperBound - renderAABB.lowerBound);
+            renderAABB.lowerBound -= guard;
+            renderAABB.upperBound += guard;
+        }
+
+        // Rotate the render AABB by the camera angle.
+        b2AABB viewAABB;
+        CoreMath::mRotateAABB( renderAABB, pSceneWindow->getCamera().mCameraAngle, viewAABB );
+
+        mViewQueryHosts.push_back( pSceneWindow );
+        mViewQueryAABBs.push_back( viewAABB );
+        mViewQueryRendered.push_back( false );
+
+        renderLayerMask |= pSceneWindow->getRenderLayerMask();
+        renderGroupMask |= pSceneWindow->getRenderGroupMask();
+    }
+
+    // Query every view in a single walk, filtering for any of them.
+    // NOTE: Each view filters its own results again when it uses them.
+    mpWorldQuery->setQueryFilter( WorldQueryFilter( renderLayerMask, renderGroupMask, true, true, false, false ) );
+    mpWorldQuery->aabbQueryAABBBatch( mViewQueryAABBs.address(), mViewQueryAABBs.size(), mViewQueryResults, mViewQueryOffsets );
+
+    mViewQueryTime = mSceneTime;
+    mViewQueryValid = true;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::resolveLayerRenderCaches( const SceneRenderState* pSceneRenderState, SceneRenderState& captureRenderState, U32& cachedLayerMask, U32& captureLayerMask )
+{
+    // Reset the layer masks.
+    cachedLayerMask = 0;
+    captureLayerMask = 0;
+
+    // Fetch the static layers being rendered.
+    const U32 staticLayerMask = mStaticLayerMask & pSceneRenderState->mRenderLayerMask;
+
+    // Finish if there are none.
+    if ( staticLayerMask == 0 )
+        return;
+
+    // Calculate the guarded render AABB that a capture covers.
+    const b2AABB& renderAABB = pSceneRenderState->mRenderAABB;
+    const b2Vec2 guard = mLayerRenderCacheGuard * (renderAABB.upperBound - renderAABB.lowerBound);
+    captureRenderState.mRenderAABB.lowerBound = renderAABB.lowerBound - guard;
+    captureRenderState.mRenderAABB.upperBound = renderAABB.upperBound + guard;
+    const b2Vec2 captureExtent = captureRenderState.mRenderAABB.upperBound - captureRenderState.mRenderAABB.lowerBound;
+    captureRenderState.mRenderArea = RectF( captureRenderState.mRenderAABB.lowerBound.x, captureRenderState.mRenderAABB.lowerBound.y, captureExtent.x, captureExtent.y );
+
+    // Iterate the static layers.
+    for ( U32 layer = 0; layer < MAX_LAYERS_SUPPORTED; ++layer )
+    {
+        // Skip if not a static layer.
+        if ( (staticLayerMask & BIT(layer)) == 0 )
+            continue;
+
+        // Fetch the layer cache.
+        LayerRenderCache& layerCache = mLayerRenderCaches[layer];
+
+        // Is the view still covered by the last capture?
+        const bool viewCovered =
+            layerCache.mRenderGroupMask == pSceneRenderState->mRenderGroupMask &&
+            mIsEqual( layerCache.mRenderAngle, pSceneRenderState->mRenderAngle ) &&
+            layerCache.mSortMode == mLayerSortModes[layer] &&
+            layerCache.mGuardAABB.Contains( renderAABB );
+
+        // Is the cache valid?
+        if ( layerCache.mValid )
+        {
+            // Yes, so use it if the view is covered.
+            if ( viewCovered )
+            {
+                cachedLayerMask |= BIT(layer);
+                continue;
+            }
+
+            // The view moved away so recapture.
+            layerCache.mValid = false;
+        }
+
+        // Skip if the layer could not be captured from this view.
+        if ( layerCache.mUncacheable )
+        {
+            if ( viewCovered )
+                continue;
+
+            layerCache.mUncacheable = false;
+        }
+
+        // Skip until the layer has settled.
+        if ( layerCache.mStableFrames < SCENE_LAYER_CACHE_SETTLE_FRAMES )
+        {
+            layerCache.mStableFrames++;
+            continue;
+        }
+
+        // Capture the layer from this view.
+        captureLayerMask |= BIT(layer);
+        layerCache.mGuardAABB = captureRenderState.mRenderAABB;
+        layerCache.mRenderAngle = pSceneRenderState->mRenderAngle;
+        layerCache.mRenderGroupMask = pSceneRenderState->mRenderGroupMask;
+        layerCache.mSortMode = mLayerSortModes[layer];
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::renderLayerCache( const SceneRenderState* pSceneRenderState, const U32 layer )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_RenderSceneLayerCache);
+
+    // Fetch debug stats.
+    DebugStats* pDebugStats = pSceneRenderState->mpDebugStats;
+
+    // Fetch the layer cache.
+    const LayerRenderCache& layerCache = mLayerRenderCaches[layer];
+
+    // Account for the objects and requests the cache represents.
+    pDebugStats->renderPicked += (U32)layerCache.mSceneObjects.size();
+    pDebugStats->renderRequests += layerCache.mRenderRequestCount;
+
+    // Replay the cache.
+    mBatchRenderer.submitCache( layerCache.mBatchCache );
+
+    // Flush.
+    mBatchRenderer.flush( BatchRender::FLUSH_LAYER );
+
+    // Render object overlays.
+    for( typeSceneObjectVector::const_iterator sceneObjectItr = layerCache.mSceneObjects.begin(); sceneObjectItr != layerCache.mSceneObjects.end(); ++sceneObjectItr )
+    {
+        (*sceneObjectItr)->sceneRenderOverlay( pSceneRenderState );
+    }
+
+    // Flush the overlays.
+    mDebugDraw.Flush();
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::clearScene( bool deleteObjects )
+{
+    while( mSceneObjects.size() > 0 )
+    {
+        // Fetch first scene object.
+        SceneObject* pSceneObject = mSceneObjects[0];
+
+        // Remove Object from Scene.
+        removeFromScene( pSceneObject );
+
+        // Queue Object for deletion.
+        if ( deleteObjects )
+            pSceneObject->safeDelete();
+    }
+
+    // Fetch the controller set.
+    SimSet* pControllerSet = getControllers();
+
+    // Do we have any scene controllers?
+    if ( pControllerSet != NULL )
+    {
+        // Yes, so delete them all.
+        while( pControllerSet->size() > 0 )
+            pControllerSet->at(0)->deleteObject();
+    }
+
+    // Clear asset preloads.
+    clearAssetPreloads();
+
+    // Release the world memory.
+    resetWorldAllocator();
+
+    // Release the level arena.
+    releaseLevelArena();
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::releaseLevelArena( void )
+{
+    // Finish if there's no level arena.
+    if ( mpLevelArena == NULL )
+        return;
+
+    // Stop allocating from the arena if the scene failed to finish loading.
+    if ( Memory::getCurrentArena() == mpLevelArena )
+        Memory::setCurrentArena( mpPreviousArena );
+
+    // Delete the arena.  Its chunks are freed as their last blocks are freed, which is typically when the objects are deleted.
+    delete mpLevelArena;
+    mpLevelArena = NULL;
+    mpPreviousArena = NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::createGroundBody( void )
+{
+    // Sanity!
+    AssertFatal( mpGroundBody == NULL, "Scene::createGroundBody() - The ground body already exists." );
+
+    // Create ground body.
+    b2BodyDef groundBodyDef;
+    groundBodyDef.userData = static_cast<PhysicsProxy*>(this);
+    mpGroundBody = mpWorld->CreateBody(&groundBodyDef);
+    mpGroundBody->SetAwake( false );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::resetWorldAllocator( void )
+{
+    // Finish if not using an arena.
+    if ( mpWorldAllocator == NULL || mpWorld == NULL || mpWorld->IsLocked() )
+        return;
+
+    // Finish if anything other than the ground body remains in the world.
+    if ( mpWorld->GetBodyCount() != 1 || mpWorld->GetJointCount() != 0 )
+        return;
+
+    // Destroy the ground body.
+    mpWorld->DestroyBody( mpGroundBody );
+    mpGroundBody = NULL;
+
+    // Fetch the allocator stats.
+    b2AllocatorStats allocatorStats;
+    mpWorldAllocator->GetStats( &allocatorStats );
+
+    // Release the arena pages if everything has been returned to it.
+    if ( allocatorStats.allocationCount == 0 )
+    {
+        mpWorldAllocator->Reset();
+    }
+    else
+    {
+        Con::warnf( "Scene::resetWorldAllocator() - Cannot reset the world allocator as %d allocations are still live.", allocatorStats.allocationCount );
+    }
+
+    // Recreate the ground body.
+    createGroundBody();
+}
+
+//-----------------------------------------------------------------------------
+
+// Add a scene object to a layer or group index, recording where it is.
+static void addIndexedSceneObject( typeSceneObjectVector& indexedObjects, SceneObject* pSceneObject, U32 SceneObject::* pObjectIndex )
+{
+    pSceneObject->*pObjectIndex = (U32)indexedObjects.size();
+    indexedObjects.push_back( pSceneObject );
+}
+
+//-----------------------------------------------------------------------------
+
+// Remove a scene object from a layer or group index by moving the last object into its place.
+static void removeIndexedSceneObject( typeSceneObjectVector& indexedObjects, SceneObject* pSceneObject, U32 SceneObject::* pObjectIndex )
+{
+    // Fetch the object index.
+    const U32 objectIndex = pSceneObject->*pObjectIndex;
+
+    // Sanity!
+    AssertFatal( objectIndex < (U32)indexedObjects.size() && indexedObjects[objectIndex] == pSceneObject, "Scene - The scene object index has become corrupt." );
+
+    // Move the last object into the slot.
+    SceneObject* pLastSceneObject = indexedObjects.last();
+    indexedObjects[objectIndex] = pLastSceneObject;
+    pLastSceneObject->*pObjectIndex = objectIndex;
+    indexedObjects.pop_back();
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::addToScene( SceneObject* pSceneObject )
+{
+    if ( pSceneObject == NULL )
+        return;
+
+    // Fetch current scene.
+    Scene* pCurrentScene = pSceneObject->getScene();
+
+    // Ignore if already in the scene.
+    if ( pCurrentScene == this )
+        return;
+
+#if defined(TORQUE_DEBUG)
+    // Sanity!
+    for ( S32 n = 0; n < mSceneObjects.size(); ++n )
+    {
+        AssertFatal( mSceneObjects[n] != pSceneObject, "A scene object has become corrupt." );
+    }
+#endif
+
+    // Check that object is not already in a scene.
+    if ( pCurrentScene )
+    {
+        // Remove from scene.
+        pCurrentScene->removeFromScene( pSceneObject );
+    }
+
+    // Add scene object.
+    mSceneObjects.push_back( pSceneObject );
+
+    // Index by layer and group.
+    addIndexedSceneObject( mLayerSceneObjects[pSceneObject->mSceneLayer], pSceneObject, &SceneObject::mSceneLayerIndex );
+    addIndexedSceneObject( mGroupSceneObjects[pSceneObject->mSceneGroup], pSceneObject, &SceneObject::mSceneGroupIndex );
+
+    // The shared visibility query does not include the object.
+    invalidateViewQuery();
+
+    // Register with the scene.
+    pSceneObject->OnRegisterScene( this );
+
+    // Update object counts.
+    if ( pSceneObject->isEnabled() )
+        mEnabledSceneObjectCount++;
+    if ( pSceneObject->getVisible() )
+        mVisibleSceneObjectCount++;
+
+    // Update tickable scene objects.
+    updateTickableSceneObject( pSceneObject );
+
+    // Perform callback only if properly added to the simulation.
+    if ( pSceneObject->isProperlyAdded() )
+    {
+        Con::executef(pSceneObject, 2, "onAddToScene", getIdString());
+    }
+    else
+    {
+        // Warning.
+        Con::warnf("Scene object added to scene but the object is not registered with the simulation.  No 'onAddToScene' can be performed!  Use Target scene.");
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::removeFromScene( SceneObject* pSceneObject )
+{
+    if ( pSceneObject == NULL )
+        return;
+
+    // Check if object is actually in a scene.
+    if ( !pSceneObject->getScene() )
+    {
+        Con::warnf("Scene::removeFromScene() - Object '%s' is not in a scene!.", pSceneObject->getIdString());
+        return;
+    }
+
+    // Remove as debug-object if set.
+    if ( pSceneObject == getDebugSceneObject() )
+        setDebugSceneObject( NULL );
+
+    // The shared visibility query may include the object.
+    invalidateViewQuery();
+
+    // Process Destroy Notifications.
+    pSceneObject->processDestroyNotifications();
+
+    // Dismount Any Camera.
+    pSceneObject->dismountCamera();
+
+    // Remove from the SceneWindow last pickers
+    for( U32 i = 0; i < (U32)mAttachedSceneWindows.size(); ++i )
+    {
+        (dynamic_cast<SceneWindow*>(mAttachedSceneWindows[i]))->removeFromInputEventPick(pSceneObject);
+    }
+
+    // Update object counts.
+    if ( pSceneObject->isEnabled() )
+        mEnabledSceneObjectCount--;
+    if ( pSceneObject->getVisible() )
+        mVisibleSceneObjectCount--;
+
+    // Remove from tickable scene objects.
+    removeTickableSceneObject( pSceneObject );
+
+    // Restore and forget the object if it is rewound.
+    for ( S32 n = 0; n < mRewoundObjects.size(); ++n )
+    {
+        RewoundObject& rewound = mRewoundObjects[n];
+        if ( rewound.mpSceneObject == pSceneObject )
+        {
+            pSceneObject->setRewindTransform( rewound.mPosition, rewound.mAngle, rewound.mRenderOOBB );
+            mRewoundObjects.erase_fast( n );
+            break;
+        }
+    }
+
+    // Remove from the scene pool.
+    mScenePool.onRemoveFromScene( pSceneObject );
+
+    // Unregister from scene.
+    pSceneObject->OnUnregisterScene( this );
+
+    // Remove from the layer and group indices.
+    removeIndexedSceneObject( mLayerSceneObjects[pSceneObject->mSceneLayer], pSceneObject, &SceneObject::mSceneLayerIndex );
+    removeIndexedSceneObject( mGroupSceneObjects[pSceneObject->mSceneGroup], pSceneObject, &SceneObject::mSceneGroupIndex );
+
+    // Find scene object and remove it quickly.
+    for ( S32 n = 0; n < mSceneObjects.size(); ++n )
+    {
+        if ( mSceneObjects[n] == pSceneObject )
+        {
+            mSceneObjects.erase_fast( n );
+            break;
+        }
+    }
+
+    // Perform callback.
+    Con::executef( pSceneObject, 2, "onRemoveFromScene", getIdString() );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::addParticlePlayer( ParticlePlayer* pParticlePlayer )
+{
+    // Sanity!
+    AssertFatal( pParticlePlayer != NULL, "Scene::addParticlePlayer() - Cannot add a NULL particle player." );
+
+    mParticlePlayers.push_back( pParticlePlayer );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::removeParticlePlayer( ParticlePlayer* pParticlePlayer )
+{
+    // Find particle player and remove it quickly.
+    for ( S32 n = 0; n < mParticlePlayers.size(); ++n )
+    {
+        if ( mParticlePlayers[n] == pParticlePlayer )
+        {
+            mParticlePlayers.erase_fast( n );
+            return;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::addAudioEmitter( AudioEmitter* pAudioEmitter )
+{
+    // Sanity!
+    AssertFatal( pAudioEmitter != NULL, "Scene::addAudioEmitter() - Cannot add a NULL audio emitter." );
+
+    mAudioEmitters.push_back( pAudioEmitter );
+
+    // Widen the listener query to the emitter radius.
+    updateAudioEmitterRadius( pAudioEmitter->getOuterRadius() );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::removeAudioEmitter( AudioEmitter* pAudioEmitter )
+{
+    // Remove from the audible emitters.
+    for ( S32 n = 0; n < mAudibleEmitters.size(); ++n )
+    {
+        if ( mAudibleEmitters[n] == pAudioEmitter )
+        {
+            mAudibleEmitters.erase_fast( n );
+            break;
+        }
+    }
+
+    // Find audio emitter and remove it quickly.
+    for ( S32 n = 0; n < mAudioEmitters.size(); ++n )
+    {
+        if ( mAudioEmitters[n] == pAudioEmitter )
+        {
+            mAudioEmitters.erase_fast( n );
+            break;
+        }
+    }
+
+    // Reset the listener query radius when the last emitter goes.
+    if ( mAudioEmitters.size() == 0 )
+        mAudioEmitterMaxRadius = 0.0f;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setAudioListener( const Vector2& position )
+{
+    mAudioListenerObject = NULL;
+    mAudioListenerPosition = position;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setAudioListener( SceneObject* pSceneObject )
+{
+    mAudioListenerObject = pSceneObject;
+}
+
+//-----------------------------------------------------------------------------
+
+SceneObject* Scene::getAudioListenerObject( void ) const
+{
+    return mAudioListenerObject;
+}
+
+//-----------------------------------------------------------------------------
+
+Vector2 Scene::getAudioListenerPosition( void ) const
+{
+    // Follow the listener object if there is one.
+    if ( mAudioListenerObject.notNull() )
+        return mAudioListenerObject->getPosition();
+
+    return mAudioListenerPosition;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::addSkeletonObject( SkeletonObject* pSkeletonObject )
+{
+    // Sanity!
+    AssertFatal( pSkeletonObject != NULL, "Scene::addSkeletonObject() - Cannot add a NULL skeleton object." );
+
+    mSkeletonObjects.push_back( pSkeletonObject );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::removeSkeletonObject( SkeletonObject* pSkeletonObject )
+{
+    // Find skeleton object and remove it quickly.
+    for ( S32 n = 0; n < mSkeletonObjects.size(); ++n )
+    {
+        if ( mSkeletonObjects[n] == pSkeletonObject )
+        {
+            mSkeletonObjects.erase_fast( n );
+            return;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::onSceneObjectEnabledChanged( SceneObject* pSceneObject )
+{
+    // Sanity!
+    AssertFatal( pSceneObject->getScene() == this, "Scene::onSceneObjectEnabledChanged() - Scene object is not in this scene." );
+
+    // Update enabled count.
+    if ( pSceneObject->isEnabled() )
+        mEnabledSceneObjectCount++;
+    else
+        mEnabledSceneObjectCount--;
+
+    // Update tickable scene objects.
+    updateTickableSceneObject( pSceneObject );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::onSceneObjectVisibleChanged( SceneObject* pSceneObject )
+{
+    // Sanity!
+    AssertFatal( pSceneObject->getScene() == this, "Scene::onSceneObjectVisibleChanged() - Scene object is not in this scene." );
+
+    // Update visible count.
+    if ( pSceneObject->getVisible() )
+        mVisibleSceneObjectCount++;
+    else
+        mVisibleSceneObjectCount--;
+}
+
+//-----------------------------------------------------------------------------
+
+bool Scene::isSceneObjectTickable( const SceneObject* pSceneObject ) const
+{
+    // Tick if object is enabled, not being deleted and this is a "normal" scene or
+    // the object is marked as allowing editor ticks.
+    return pSceneObject->isEnabled() && !pSceneObject->isBeingDeleted() && ( !getIsEditorScene() || pSceneObject->getIsEditorTickAllowed() );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::updateTickableSceneObject( SceneObject* pSceneObject )
+{
+    // Fetch whether the object is currently tickable.
+    const bool tickable = pSceneObject->mSceneTickIndex != -1;
+
+    // Finish if no change.
+    if ( tickable == isSceneObjectTickable( pSceneObject ) )
+        return;
+
+    // Remove if no longer tickable.
+    if ( tickable )
+    {
+        removeTickableSceneObject( pSceneObject );
+        return;
+    }
+
+    // Add tickable scene object.
+    pSceneObject->mSceneTickIndex = mTickableSceneObjects.size();
+    mTickableSceneObjects.push_back( pSceneObject );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::removeTickableSceneObject( SceneObject* pSceneObject )
+{
+    // Fetch the tick index.
+    const S32 tickIndex = pSceneObject->mSceneTickIndex;
+
+    // Finish if not tickable.
+    if ( tickIndex == -1 )
+        return;
+
+    // Sanity!
+    AssertFatal( mTickableSceneObjects[tickIndex] == pSceneObject, "Scene::removeTickableSceneObject() - Tickable scene objects are corrupt." );
+
+    // Move the last tickable object into the vacated slot.
+    SceneObject* pLastSceneObject = mTickableSceneObjects.last();
+    mTickableSceneObjects[tickIndex] = pLastSceneObject;
+    pLastSceneObject->mSceneTickIndex = tickIndex;
+    mTickableSceneObjects.pop_back();
+
+    // Reset the tick index.
+    pSceneObject->mSceneTickIndex = -1;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::refreshTickableSceneObjects( void )
+{
+    // Update all the scene objects.
+    for( S32 n = 0; n < mSceneObjects.size(); ++n )
+    {
+        updateTickableSceneObject( mSceneObjects[n] );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+SceneObject* Scene::getSceneObject( const U32 objectIndex ) const
+{
+    // Sanity!
+    AssertFatal( objectIndex < getSceneObjectCount(), "Scene::getSceneObject() - Invalid object index." );
+
+    return mSceneObjects[objectIndex];
+}
+
+//-----------------------------------------------------------------------------
+
+U32 Scene::getSceneObjects( typeSceneObjectVector& objects ) const
+{
+    // No objects if scene is empty!
+    if ( getSceneObjectCount() == 0 )
+        return 0;
+
+    // Merge with objects.
+    objects.merge( mSceneObjects );
+
+    return getSceneObjectCount();
+}
+
+//-----------------------------------------------------------------------------
+
+U32 Scene::getSceneObjects( typeSceneObjectVector& objects, const U32 sceneLayer ) const
+{
+    // No objects if scene is empty!
+    if ( getSceneObjectCount() == 0 )
+        return 0;
+
+    // Sanity!
+    AssertFatal( sceneLayer < MAX_LAYERS_SUPPORTED, "Scene::getSceneObjects() - Invalid scene layer." );
+
+    // Merge with the layer objects.
+    objects.merge( mLayerSceneObjects[sceneLayer] );
+
+    return mLayerSceneObjects[sceneLayer].size();
+}
+
+//-----------------------------------------------------------------------------
+
+U32 Scene::querySceneObjects( typeSceneObjectVector& objects, const U32 sceneLayerMask, const U32 sceneGroupMask ) const
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_QuerySceneObjects);
+
+    // Count the candidates in the selected layers and groups.
+    U32 layerCandidates = 0;
+    U32 groupCandidates = 0;
+    for ( U32 bit = 0; bit < MASK_BITCOUNT; ++bit )
+    {
+        if ( (sceneLayerMask & BIT(bit)) != 0 )
+            layerCandidates += mLayerSceneObjects[bit].size();
+
+        if ( (sceneGroupMask & BIT(bit)) != 0 )
+            groupCandidates += mGroupSceneObjects[bit].size();
+    }
+
+    // Walk whichever index has the fewest candidates and check the other mask.
+    const bool walkLayers = layerCandidates <= groupCandidates;
+    const typeSceneObjectVector* pIndexedObjects = walkLayers ? mLayerSceneObjects : mGroupSceneObjects;
+    const U32 indexMask = walkLayers ? sceneLayerMask : sceneGroupMask;
+    const U32 checkMask = walkLayers ? sceneGroupMask : sceneLayerMask;
+
+    // Reset object count.
+    U32 count = 0;
+
+    for ( U32 bit = 0; bit < MASK_BITCOUNT; ++bit )
+    {
+        // Skip if not selected.
+        if ( (indexMask & BIT(bit)) == 0 )
+            continue;
+
+        // Iterate the indexed objects.
+        const typeSceneObjectVector& indexedObjects = pIndexedObjects[bit];
+        for ( S32 n = 0; n < indexedObjects.size(); ++n )
+        {
+            // Fetch scene object.
+            SceneObject* pSceneObject = indexedObjects[n];
+
+            // Skip if not in the other mask.
+            if ( (checkMask & (walkLayers ? pSceneObject->getSceneGroupMask() : pSceneObject->getSceneLayerMask())) == 0 )
+                continue;
+
+            // Add to objects.
+            objects.push_back( pSceneObject );
+            count++;
+        }
+    }
+
+    return count;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::moveSceneObjectLayer( SceneObject* pSceneObject, const U32 sceneLayer )
+{
+    // Sanity!
+    AssertFatal( pSceneObject != NULL && pSceneObject->getScene() == this, "Scene::moveSceneObjectLayer() - The scene object is not in this scene." );
+    AssertFatal( sceneLayer < MAX_LAYERS_SUPPORTED, "Scene::moveSceneObjectLayer() - Invalid scene layer." );
+
+    // Finish if the layer is not changing.
+    if ( pSceneObject->mSceneLayer == sceneLayer )
+        return;
+
+    // Move between the layer indices.
+    removeIndexedSceneObject( mLayerSceneObjects[pSceneObject->mSceneLayer], pSceneObject, &SceneObject::mSceneLayerIndex );
+    addIndexedSceneObject( mLayerSceneObjects[sceneLayer], pSceneObject, &SceneObject::mSceneLayerIndex );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::moveSceneObjectGroup( SceneObject* pSceneObject, const U32 sceneGroup )
+{
+    // Sanity!
+    AssertFatal( pSceneObject != NULL && pSceneObject->getScene() == this, "Scene::moveSceneObjectGroup() - The scene object is not in this scene." );
+    AssertFatal( sceneGroup < MASK_BITCOUNT, "Scene::moveSceneObjectGroup() - Invalid scene group." );
+
+    // Finish if the group is not changing.
+    if ( pSceneObject->mSceneGroup == sceneGroup )
+        return;
+
+    // Move between the group indices.
+    removeIndexedSceneObject( mGroupSceneObjects[pSceneObject->mSceneGroup], pSceneObject, &SceneObject::mSceneGroupIndex );
+    addIndexedSceneObject( mGroupSceneObjects[sceneGroup], pSceneObject, &SceneObject::mSceneGroupIndex );
+}
+
+//-----------------------------------------------------------------------------
+
+const AssetPtr<AssetBase>* Scene::getAssetPreload( const S32 index ) const
+{
+    // Is the index valid?
+    if ( index < 0 || index >= mAssetPreloads.size() )
+    {
+        // Yes, so warn.
+        Con::warnf( "Scene::getAssetPreload() - Out of range index '%d'.  There are only '%d' asset preloads.", index, mAssetPreloads.size() );
+        return NULL;
+    }
+
+    return mAssetPreloads[index];
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::addAssetPreload( const char* pAssetId, const bool async )
+{
+    // Sanity!
+    AssertFatal( pAssetId != NULL, "Scene::addAssetPreload() - Cannot add a NULL asset preload." );
+
+    // Fetch asset Id.
+    StringTableEntry assetId = StringTable->insert( pAssetId );
+
+    // Ignore if asset already added.
+    const S32 assetPreloadCount = mAssetPreloads.size();
+    for( S32 index = 0; index < assetPreloadCount; ++index )
+    {
+        if ( mAssetPreloads[index]->getAssetId() == assetId )
+            return;
+    }
+
+    // Ignore if asset already being acquired.
+    for( typePendingAssetPreloadVector::iterator pendingItr = mPendingAssetPreloads.begin(); pendingItr != mPendingAssetPreloads.end(); ++pendingItr )
+    {
+        if ( pendingItr->mAssetId == assetId )
+            return;
+    }
+
+    // Acquire the asset asynchronously if requested and it isn't already loaded.
+    if ( async && !AssetDatabase.isAssetLoaded( assetId ) )
+    {
+        PendingAssetPreload pendingAssetPreload;
+        pendingAssetPreload.mAssetId = assetId;
+        pendingAssetPreload.mAcquireId = AssetDatabase.acquireAssetAsync( assetId );
+
+        // Was the acquisition started?
+        if ( pendingAssetPreload.mAcquireId == 0 )
+        {
+            // No, so warn.
+            Con::warnf( "Scene::addAssetPreload() - Failed to acquire asset '%s' so not added as a preload.", pAssetId );
+            return;
+        }
+
+        // Add pending asset.
+        mPendingAssetPreloads.push_back( pendingAssetPreload );
+        return;
+    }
+
+    // Create asset pointer.
+    AssetPtr<AssetBase>* pAssetPtr = new AssetPtr<AssetBase>( pAssetId );
+
+    // Was the asset acquired?
+    if ( pAssetPtr->isNull() )
+    {
+        // No, so warn.
+        Con::warnf( "Scene::addAssetPreload() - Failed to acquire asset '%s' so not added as a preload.", pAssetId );
+
+        // No, so delete the asset pointer.
+        delete pAssetPtr;
+        return;
+    }
+
+    // Add asset.
+    mAssetPreloads.push_back( pAssetPtr );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::processPendingAssetPreloads( void )
+{
+    // Finish if there are no pending asset preloads.
+    if ( mPendingAssetPreloads.size() == 0 )
+        return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_ProcessPendingAssetPreloads);
+
+    for( S32 index = 0; index < mPendingAssetPreloads.size(); )
+    {
+        const PendingAssetPreload pendingAssetPreload = mPendingAssetPreloads[index];
+
+        // Skip if still acquiring.
+        if ( !AssetDatabase.isAsyncAcquireComplete( pendingAssetPreload.mAcquireId ) )
+        {
+            ++index;
+            continue;
+        }
+
+        mPendingAssetPreloads.erase( index );
+
+        // Create asset pointer.
+        // NOTE: The asset is already loaded so this only references it.
+        AssetPtr<AssetBase>* pAssetPtr = new AssetPtr<AssetBase>( pendingAssetPreload.mAssetId );
+
+        // Release the acquisition now the asset pointer references the asset.
+        AssetDatabase.releaseAsyncAcquire( pendingAssetPreload.mAcquireId );
+
+        // Was the asset acquired?
+        if ( pAssetPtr->isNull() )
+        {
+            // No, so warn.
+            Con::warnf( "Scene::processPendingAssetPreloads() - Failed to acquire asset '%s' so not added as a preload.", pendingAssetPreload.mAssetId );
+
+            // No, so delete the asset pointer.
+            delete pAssetPtr;
+            continue;
+        }
+
+        // Add asset.
+        mAssetPreloads.push_back( pAssetPtr );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::removeAssetPreload( const char* pAssetId )
+{
+    // Sanity!
+    AssertFatal( pAssetId != NULL, "Scene::removeAssetPreload() - Cannot remove a NULL asset preload." );
+
+    // Fetch asset Id.
+    StringTableEntry assetId = StringTable->insert( pAssetId );
+
+    // Remove pending asset Id.
+    for( S32 index = 0; index < mPendingAssetPreloads.size(); ++index )
+    {
+        if ( mPendingAssetPreloads[index].mAssetId == assetId )
+        {
+            AssetDatabase.releaseAsyncAcquire( mPendingAssetPreloads[index].mAcquireId );
+            mPendingAssetPreloads.erase_fast( index );
+            return;
+        }
+    }
+
+    // Remove asset Id.
+    const S32 assetPreloadCount = mAssetPreloads.size();
+    for( S32 index = 0; index < assetPreloadCount; ++index )
+    {
+        if ( mAssetPreloads[index]->getAssetId() == assetId )
+        {
+            delete mAssetPreloads[index];
+            mAssetPreloads.erase_fast( index );
+            return;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::clearAssetPreloads( void )
+{
+    // Release all the pending asset preloads.
+    while( mPendingAssetPreloads.size() > 0 )
+    {
+        AssetDatabase.releaseAsyncAcquire( mPendingAssetPreloads.back().mAcquireId );
+        mPendingAssetPreloads.pop_back();
+    }
+
+    // Delete all the asset preloads.
+    while( mAssetPreloads.size() > 0 )
+    {
+        delete mAssetPreloads.back();
+        mAssetPreloads.pop_back();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::mergeScene( const Scene* pScene )
+{
+    // Fetch the scene object count.
+    const U32 count = pScene->getSceneObjectCount();
+
+    // Finish if there are not objects to copy.
+    if ( count == 0 )
+        return;
+
+
+    for( U32 index = 0; index < count; ++index )
+    {
+        // Fetch a clone of the scene object.
+        SceneObject* pSceneObject = (SceneObject*)pScene->getSceneObject( index )->clone( true );
+
+        // Add the clone.
+        addToScene( pSceneObject );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+b2Joint* Scene::findJoint( const S32 jointId )
+{
+    // Find joint.
+    typeJointHash::iterator itr = mJoints.find( jointId );
+
+    return itr == mJoints.end() ? NULL : itr->value;
+}
+
+//-----------------------------------------------------------------------------
+
+b2JointType Scene::getJointType( const S32 jointId )
+{
+    // Sanity!
+    if ( jointId >= mJointMasterId )
+    {
+        Con::warnf("The joint Id of %d is invalid.", jointId);
+        return e_unknownJoint;
+    }
+
+    return findJoint( jointId )->GetType();
+}
+
+//-----------------------------------------------------------------------------
+
+S32 Scene::findJointId( b2Joint* pJoint )
+{
+    // Sanity!
+    AssertFatal( pJoint != NULL, "Joint cannot be NULL." );
+
+    // Find joint.
+    typeReverseJointHash::iterator itr = mReverseJoints.find( pJoint );
+
+    if ( itr == mReverseJoints.end() )
+    {
+        Con::warnf("The joint Id could not be found via a joint reference of %x", pJoint);
+        return 0;
+    }
+
+    return itr->value;
+}
+
+//-----------------------------------------------------------------------------
+
+S32 Scene::createJoint( b2JointDef* pJointDef )
+{
+    // Sanity!
+    AssertFatal( pJointDef != NULL, "Joint definition cannot be NULL." );
+
+    // Create Joint.
+    b2Joint* pJoint = mpWorld->CreateJoint( pJointDef );
+
+    // Allocate joint Id.
+    const S32 jointId = mJointMasterId++;
+
+    // Insert joint.
+    typeJointHash::iterator itr;
+    itr = mJoints.insert( jointId, pJoint );
+
+    // Sanity!
+    AssertFatal( itr != mJoints.end(), "Joint already in hash table." );
+
+    // Insert reverse joint.
+    mReverseJoints.insert( pJoint, jointId );
+
+    return jointId;
+}
+
+//-----------------------------------------------------------------------------
+
+bool Scene::deleteJoint( const U32 jointId )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Finish if no joint.
+    if ( pJoint == NULL )
+        return false;
+
+    // Destroy joint.
+    // This should result in the joint references also being destroyed
+    // as the scene is a destruction listener.
+    mpWorld->DestroyJoint( pJoint );
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool Scene::hasJoints( SceneObject* pSceneObject )
+{
+    // Sanity!
+    AssertFatal( pSceneObject != NULL, "Scene object cannot be NULL!" );
+    AssertFatal( pSceneObject->getScene() != this, "Scene object is not in this scene" );
+
+    // Fetch body.
+    b2Body* pBody = pSceneObject->getBody();
+
+    // Fetch joint edge.
+    b2JointEdge* pJointEdge = pBody->GetJointList();
+
+    if ( pJointEdge == NULL || pJointEdge->joint == NULL )
+        return false;
+
+    // Found at least one joint.
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+S32 Scene::createDistanceJoint(
+    const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
+    const b2Vec2& localAnchorA, const b2Vec2& localAnchorB,
+    const F32 length,
+    const F32 frequency,
+    const F32 dampingRatio,
+    const bool collideConnected )
+{
+    // Sanity!
+    if (    (pSceneObjectA != NULL && pSceneObjectA->getScene() == NULL) ||
+            (pSceneObjectB != NULL && pSceneObjectB->getScene() == NULL) )
+    {
+        // Warn.
+        Con::printf( "Cannot add a joint to a scene object that is not in a scene." );
+        return -1;
+    }
+
+    // Check for two invalid objects.
+    if ( pSceneObjectA == NULL && pSceneObjectB == NULL )
+    {
+        Con::warnf("Scene::createDistanceJoint() - Cannot create joint without at least a single scene object." );
+        return -1;
+    }
+
+    // Fetch bodies.
+    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getBody() : getGroundBody();
+    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getBody() : getGroundBody();
+    
+    // Populate definition.
+    b2DistanceJointDef jointDef;
+    jointDef.userData         = static_cast<PhysicsProxy*>(this);
+    jointDef.collideConnected = collideConnected;
+    jointDef.bodyA            = pBodyA;
+    jointDef.bodyB            = pBodyB;
+    jointDef.localAnchorA     = localAnchorA;
+    jointDef.localAnchorB     = localAnchorB;
+    jointDef.length           = length < 0.0f ? (pBodyB->GetWorldPoint( localAnchorB ) - pBodyA->GetWorldPoint( localAnchorA )).Length() : length;
+    jointDef.frequencyHz      = frequency;
+    jointDef.dampingRatio     = dampingRatio;
+    
+    // Create joint.
+    return createJoint( &jointDef );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setDistanceJointLength(
+        const U32 jointId,
+        const F32 length )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_distanceJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return;
+    }
+
+    // Cast joint.
+    b2DistanceJoint* pRealJoint = static_cast<b2DistanceJoint*>( pJoint );
+
+    // Access joint.
+    pRealJoint->SetLength( length );
+}
+
+//-----------------------------------------------------------------------------
+
+F32 Scene::getDistanceJointLength( const U32 jointId )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return -1.0f;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_distanceJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return -1.0f;
+    }
+
+    // Cast joint.
+    b2DistanceJoint* pRealJoint = static_cast<b2DistanceJoint*>( pJoint );
+
+    // Access joint.
+    return pRealJoint->GetLength();
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setDistanceJointFrequency(
+        const U32 jointId,
+        const F32 frequency )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_distanceJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return;
+    }
+
+    // Cast joint.
+    b2DistanceJoint* pRealJoint = static_cast<b2DistanceJoint*>( pJoint );
+
+    // Access joint.
+    pRealJoint->SetFrequency( frequency );
+}
+
+//-----------------------------------------------------------------------------
+
+F32 Scene::getDistanceJointFrequency( const U32 jointId )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return -1.0f;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_distanceJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return -1.0f;
+    }
+
+    // Cast joint.
+    b2DistanceJoint* pRealJoint = static_cast<b2DistanceJoint*>( pJoint );
+
+    // Access joint.
+    return pRealJoint->GetFrequency();
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setDistanceJointDampingRatio(
+        const U32 jointId,
+        const F32 dampingRatio )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_distanceJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return;
+    }
+
+    // Cast joint.
+    b2DistanceJoint* pRealJoint = static_cast<b2DistanceJoint*>( pJoint );
+
+    // Access joint.
+    pRealJoint->SetDampingRatio( dampingRatio );
+}
+
+//-----------------------------------------------------------------------------
+
+F32 Scene::getDistanceJointDampingRatio( const U32 jointId )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return -1.0f;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_distanceJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return -1.0f;
+    }
+
+    // Cast joint.
+    b2DistanceJoint* pRealJoint = static_cast<b2DistanceJoint*>( pJoint );
+
+    // Access joint.
+    return pRealJoint->GetDampingRatio();
+}
+
+//-----------------------------------------------------------------------------
+
+S32 Scene::createRopeJoint(
+        const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
+        const b2Vec2& localAnchorA, const b2Vec2& localAnchorB,
+        const F32 maxLength,
+        const bool collideConnected )
+{
+    // Sanity!
+    if (    (pSceneObjectA != NULL && pSceneObjectA->getScene() == NULL) ||
+            (pSceneObjectB != NULL && pSceneObjectB->getScene() == NULL) )
+    {
+        // Warn.
+        Con::printf( "Cannot add a joint to a scene object that is not in a scene." );
+        return -1;
+    }
+
+    // Check for two invalid objects.
+    if ( pSceneObjectA == NULL && pSceneObjectB == NULL )
+    {
+        Con::warnf("Scene::createRopeJoint() - Cannot create joint without at least a single scene object." );
+        return -1;
+    }
+
+    // Fetch bodies.
+    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getBody() : getGroundBody();
+    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getBody() : getGroundBody();
+    
+    // Populate definition.
+    b2RopeJointDef jointDef;
+    jointDef.userData         = static_cast<PhysicsProxy*>(this);
+    jointDef.collideConnected = collideConnected;
+    jointDef.bodyA            = pBodyA;
+    jointDef.bodyB            = pBodyB;
+    jointDef.localAnchorA     = localAnchorA;
+    jointDef.localAnchorB     = localAnchorB;
+    jointDef.maxLength        = maxLength < 0.0f ? (pBodyB->GetWorldPoint( localAnchorB ) - pBodyA->GetWorldPoint( localAnchorA )).Length() : maxLength;
+    
+    // Create joint.
+    return createJoint( &jointDef );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setRopeJointMaxLength(
+        const U32 jointId,
+        const F32 maxLength )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_ropeJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return;
+    }
+
+    // Cast joint.
+    b2RopeJoint* pRealJoint = static_cast<b2RopeJoint*>( pJoint );
+
+    // Access joint.
+    pRealJoint->SetMaxLength( maxLength );
+}
+
+//-----------------------------------------------------------------------------
+
+F32 Scene::getRopeJointMaxLength( const U32 jointId )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return -1.0f;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_ropeJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return -1.0f;
+    }
+
+    // Cast joint.
+    b2RopeJoint* pRealJoint = static_cast<b2RopeJoint*>( pJoint );
+
+    // Access joint.
+    return pRealJoint->GetMaxLength();
+}
+
+//-----------------------------------------------------------------------------
+
+S32 Scene::createRevoluteJoint(
+        const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
+        const b2Vec2& localAnchorA, const b2Vec2& localAnchorB,
+        const bool collideConnected )
+{
+    // Sanity!
+    if (    (pSceneObjectA != NULL && pSceneObjectA->getScene() == NULL) ||
+            (pSceneObjectB != NULL && pSceneObjectB->getScene() == NULL) )
+    {
+        // Warn.
+        Con::printf( "Cannot add a joint to a scene object that is not in a scene." );
+        return -1;
+    }
+
+    // Check for two invalid objects.
+    if ( pSceneObjectA == NULL && pSceneObjectB == NULL )
+    {
+        Con::warnf("Scene::createRevoluteJoint() - Cannot create joint without at least a single scene object." );
+        return -1;
+    }
+
+    // Fetch bodies.
+    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getBody() : getGroundBody();
+    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getBody() : getGroundBody();
+    
+    // Populate definition.
+    b2RevoluteJointDef jointDef;
+    jointDef.userData         = static_cast<PhysicsProxy*>(this);
+    jointDef.collideConnected = collideConnected;
+    jointDef.bodyA            = pBodyA;
+    jointDef.bodyB            = pBodyB;
+    jointDef.referenceAngle   = pBodyB->GetAngle() - pBodyA->GetAngle();
+    jointDef.localAnchorA     = localAnchorA;
+    jointDef.localAnchorB     = localAnchorB;
+    
+    // Create joint.
+    return createJoint( &jointDef );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setRevoluteJointLimit(
+        const U32 jointId,
+        const bool enableLimit,
+        const F32 lowerAngle, const F32 upperAngle )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_revoluteJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return;
+    }
+
+    // Cast joint.
+    b2RevoluteJoint* pRealJoint = static_cast<b2RevoluteJoint*>( pJoint );
+
+    // Access joint.
+    pRealJoint->SetLimits( lowerAngle, upperAngle );
+    pRealJoint->EnableLimit( enableLimit );
+}
+
+//-----------------------------------------------------------------------------
+
+bool Scene::getRevoluteJointLimit(
+        const U32 jointId,
+        bool& enableLimit,
+        F32& lowerAngle, F32& upperAngle )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return false;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_revoluteJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return false;
+    }
+
+    // Cast joint.
+    b2RevoluteJoint* pRealJoint = static_cast<b2RevoluteJoint*>( pJoint );
+
+    // Access joint.
+    enableLimit = pRealJoint->IsLimitEnabled();
+    lowerAngle = pRealJoint->GetLowerLimit();
+    upperAngle = pRealJoint->GetUpperLimit();
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setRevoluteJointMotor(
+        const U32 jointId,
+        const bool enableMotor,
+        const F32 motorSpeed,
+        const F32 maxMotorTorque )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_revoluteJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return;
+    }
+
+    // Cast joint.
+    b2RevoluteJoint* pRealJoint = static_cast<b2RevoluteJoint*>( pJoint );
+
+    // Access joint.
+    pRealJoint->SetMotorSpeed( motorSpeed );
+    pRealJoint->SetMaxMotorTorque( maxMotorTorque );
+    pRealJoint->EnableMotor( enableMotor );    
+}
+
+//-----------------------------------------------------------------------------
+
+bool Scene::getRevoluteJointMotor(
+        const U32 jointId,
+        bool& enableMotor,
+        F32& motorSpeed,
+        F32& maxMotorTorque )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return false;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_revoluteJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return false;
+    }
+
+    // Cast joint.
+    b2RevoluteJoint* pRealJoint = static_cast<b2RevoluteJoint*>( pJoint );
+
+    // Access joint.
+    enableMotor = pRealJoint->IsMotorEnabled();
+    motorSpeed = pRealJoint->GetMotorSpeed();
+    maxMotorTorque = pRealJoint->GetMaxMotorTorque();
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+F32 Scene::getRevoluteJointAngle( const U32 jointId )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return 0.0f;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_revoluteJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return 0.0f;
+    }
+
+    // Cast joint.
+    b2RevoluteJoint* pRealJoint = static_cast<b2RevoluteJoint*>( pJoint );
+
+    // Access joint.
+    return pRealJoint->GetJointAngle();
+}
+
+//-----------------------------------------------------------------------------
+
+F32 Scene::getRevoluteJointSpeed( const U32 jointId )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return 0.0f;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_revoluteJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return 0.0f;
+    }
+
+    // Cast joint.
+    b2RevoluteJoint* pRealJoint = static_cast<b2RevoluteJoint*>( pJoint );
+
+    // Access joint.
+    return pRealJoint->GetJointSpeed();
+}
+
+//-----------------------------------------------------------------------------
+
+S32 Scene::createWeldJoint(
+        const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
+        const b2Vec2& localAnchorA, const b2Vec2& localAnchorB,
+        const F32 frequency,
+        const F32 dampingRatio,
+        const bool collideConnected )
+{
+    // Sanity!
+    if (    (pSceneObjectA != NULL && pSceneObjectA->getScene() == NULL) ||
+            (pSceneObjectB != NULL && pSceneObjectB->getScene() == NULL) )
+    {
+        // Warn.
+        Con::printf( "Cannot add a joint to a scene object that is not in a scene." );
+        return -1;
+    }
+
+    // Check for two invalid objects.
+    if ( pSceneObjectA == NULL && pSceneObjectB == NULL )
+    {
+        Con::warnf("Scene::createWeldJoint() - Cannot create joint without at least a single scene object." );
+        return -1;
+    }
+
+    // Fetch bodies.
+    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getBody() : getGroundBody();
+    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getBody() : getGroundBody();
+    
+    // Populate definition.
+    b2WeldJointDef jointDef;
+    jointDef.userData         = static_cast<PhysicsProxy*>(this);
+    jointDef.collideConnected = collideConnected;
+    jointDef.bodyA            = pBodyA;
+    jointDef.bodyB            = pBodyB;
+    jointDef.referenceAngle   = pBodyB->GetAngle() - pBodyA->GetAngle();
+    jointDef.localAnchorA     = localAnchorA;
+    jointDef.localAnchorB     = localAnchorB;
+    jointDef.frequencyHz      = frequency;
+    jointDef.dampingRatio     = dampingRatio;
+    
+    // Create joint.
+    return createJoint( &jointDef );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setWeldJointFrequency(
+        const U32 jointId,
+        const F32 frequency )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_weldJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return;
+    }
+
+    // Cast joint.
+    b2WeldJoint* pRealJoint = static_cast<b2WeldJoint*>( pJoint );
+
+    // Access joint.
+    pRealJoint->SetFrequency( frequency );
+}
+
+
+//-----------------------------------------------------------------------------
+
+F32 Scene::getWeldJointFrequency( const U32 jointId  )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return -1.0f;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_weldJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return -1.0f;
+    }
+
+    // Cast joint.
+    b2WeldJoint* pRealJoint = static_cast<b2WeldJoint*>( pJoint );
+
+    // Access joint.
+    return pRealJoint->GetFrequency();
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setWeldJointDampingRatio(
+        const U32 jointId,
+        const F32 dampingRatio )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_weldJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return;
+    }
+
+    // Cast joint.
+    b2WeldJoint* pRealJoint = static_cast<b2WeldJoint*>( pJoint );
+
+    // Access joint.
+    pRealJoint->SetDampingRatio( dampingRatio );
+}
+
+//-----------------------------------------------------------------------------
+
+F32 Scene::getWeldJointDampingRatio( const U32 jointId )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return -1.0f;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_weldJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return -1.0f;
+    }
+
+    // Cast joint.
+    b2WeldJoint* pRealJoint = static_cast<b2WeldJoint*>( pJoint );
+
+    // Access joint.
+    return pRealJoint->GetDampingRatio();
+}
+
+//-----------------------------------------------------------------------------
+
+S32 Scene::createWheelJoint(
+        const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
+        const b2Vec2& localAnchorA, const b2Vec2& localAnchorB,
+        const b2Vec2& worldAxis,
+        const bool collideConnected )
+{
+    // Sanity!
+    if (    (pSceneObjectA != NULL && pSceneObjectA->getScene() == NULL) ||
+            (pSceneObjectB != NULL && pSceneObjectB->getScene() == NULL) )
+    {
+        // Warn.
+        Con::printf( "Cannot add a joint to a scene object that is not in a scene." );
+        return -1;
+    }
+
+    // Check for two invalid objects.
+    if ( pSceneObjectA == NULL && pSceneObjectB == NULL )
+    {
+        Con::warnf("Scene::createWheelJoint() - Cannot create joint without at least a single scene object." );
+        return -1;
+    }
+
+    // Fetch bodies.
+    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getBody() : getGroundBody();
+    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getBody() : getGroundBody();
+    
+    // Populate definition.
+    b2WheelJointDef jointDef;
+    jointDef.userData         = static_cast<PhysicsProxy*>(this);
+    jointDef.collideConnected = collideConnected;
+    jointDef.bodyA            = pBodyA;
+    jointDef.bodyB            = pBodyB;
+    jointDef.localAnchorA     = localAnchorA;
+    jointDef.localAnchorB     = localAnchorB;
+    jointDef.localAxisA       = pBodyA->GetLocalVector( worldAxis );
+    
+    // Create joint.
+    return createJoint( &jointDef );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setWheelJointMotor(
+        const U32 jointId,
+        const bool enableMotor,
+        const F32 motorSpeed,
+        const F32 maxMotorTorque )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_wheelJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return;
+    }
+
+    // Cast joint.
+    b2WheelJoint* pRealJoint = static_cast<b2WheelJoint*>( pJoint );
+
+    // Access joint.
+    pRealJoint->SetMotorSpeed( motorSpeed );
+    pRealJoint->SetMaxMotorTorque( maxMotorTorque );
+    pRealJoint->EnableMotor( enableMotor ); 
+}
+
+//-----------------------------------------------------------------------------
+
+bool Scene::getWheelJointMotor(
+        const U32 jointId,
+        bool& enableMotor,
+        F32& motorSpeed,
+        F32& maxMotorTorque )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return false;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_wheelJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return false;
+    }
+
+    // Cast joint.
+    b2WheelJoint* pRealJoint = static_cast<b2WheelJoint*>( pJoint );
+
+    // Access joint.
+    enableMotor = pRealJoint->IsMotorEnabled();
+    motorSpeed = pRealJoint->GetMotorSpeed();
+    maxMotorTorque = pRealJoint->GetMaxMotorTorque();
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setWheelJointFrequency(
+        const U32 jointId,
+        const F32 frequency )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_wheelJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return;
+    }
+
+    // Cast joint.
+    b2WheelJoint* pRealJoint = static_cast<b2WheelJoint*>( pJoint );
+
+    // Access joint.
+    pRealJoint->SetSpringFrequencyHz( frequency );
+}
+
+//-----------------------------------------------------------------------------
+
+F32 Scene::getWheelJointFrequency( const U32 jointId )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return -1.0f;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_wheelJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return -1.0f;
+    }
+
+    // Cast joint.
+    b2WheelJoint* pRealJoint = static_cast<b2WheelJoint*>( pJoint );
+
+    // Access joint.
+    return pRealJoint->GetSpringFrequencyHz();
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setWheelJointDampingRatio(
+        const U32 jointId,
+        const F32 dampingRatio )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_wheelJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return;
+    }
+
+    // Cast joint.
+    b2WheelJoint* pRealJoint = static_cast<b2WheelJoint*>( pJoint );
+
+    // Access joint.
+    pRealJoint->SetSpringDampingRatio( dampingRatio );
+}
+
+//-----------------------------------------------------------------------------
+
+F32 Scene::getWheelJointDampingRatio( const U32 jointId )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return -1.0f;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_wheelJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return -1.0f;
+    }
+
+    // Cast joint.
+    b2WheelJoint* pRealJoint = static_cast<b2WheelJoint*>( pJoint );
+
+    // Access joint.
+    return pRealJoint->GetSpringDampingRatio();
+}
+
+//-----------------------------------------------------------------------------
+
+S32 Scene::createFrictionJoint(
+        const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
+        const b2Vec2& localAnchorA, const b2Vec2& localAnchorB,
+        const F32 maxForce,
+        const F32 maxTorque,
+        const bool collideConnected )
+{
+    // Sanity!
+    if (    (pSceneObjectA != NULL && pSceneObjectA->getScene() == NULL) ||
+            (pSceneObjectB != NULL && pSceneObjectB->getScene() == NULL) )
+    {
+        // Warn.
+        Con::printf( "Cannot add a joint to a scene object that is not in a scene." );
+        return -1;
+    }
+
+    // Check for two invalid objects.
+    if ( pSceneObjectA == NULL && pSceneObjectB == NULL )
+    {
+        Con::warnf("Scene::createFrictionJoint() - Cannot create joint without at least a single scene object." );
+        return -1;
+    }
+
+    // Fetch bodies.
+    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getBody() : getGroundBody();
+    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getBody() : getGroundBody();
+    
+    // Populate definition.
+    b2FrictionJointDef jointDef;
+    jointDef.userData         = static_cast<PhysicsProxy*>(this);
+    jointDef.collideConnected = collideConnected;
+    jointDef.bodyA            = pBodyA;
+    jointDef.bodyB            = pBodyB;
+    jointDef.localAnchorA     = localAnchorA;
+    jointDef.localAnchorB     = localAnchorB;
+    jointDef.maxForce         = maxForce;
+    jointDef.maxTorque        = maxTorque;
+    
+    // Create joint.
+    return createJoint( &jointDef );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setFrictionJointMaxForce(
+        const U32 jointId,
+        const F32 maxForce )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_frictionJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return;
+    }
+
+    // Cast joint.
+    b2FrictionJoint* pRealJoint = static_cast<b2FrictionJoint*>( pJoint );
+
+    // Access joint.
+    pRealJoint->SetMaxForce( maxForce );
+}
+
+//-----------------------------------------------------------------------------
+
+F32 Scene::getFrictionJointMaxForce( const U32 jointId )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return -1.0f;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_frictionJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return -1.0f;
+    }
+
+    // Cast joint.
+    b2FrictionJoint* pRealJoint = static_cast<b2FrictionJoint*>( pJoint );
+
+    // Access joint.
+    return pRealJoint->GetMaxForce();
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setFrictionJointMaxTorque(
+        const U32 jointId,
+        const F32 maxTorque )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_frictionJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return;
+    }
+
+    // Cast joint.
+    b2FrictionJoint* pRealJoint = static_cast<b2FrictionJoint*>( pJoint );
+
+    // Access joint.
+    pRealJoint->SetMaxTorque( maxTorque );
+}
+
+
+//-----------------------------------------------------------------------------
+
+F32 Scene::getFrictionJointMaxTorque( const U32 jointId )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return -1.0f;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_frictionJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return -1.0f;
+    }
+
+    // Cast joint.
+    b2FrictionJoint* pRealJoint = static_cast<b2FrictionJoint*>( pJoint );
+
+    // Access joint.
+    return pRealJoint->GetMaxTorque();
+}
+
+//-----------------------------------------------------------------------------
+
+S32 Scene::createPrismaticJoint(
+        const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
+        const b2Vec2& localAnchorA, const b2Vec2& localAnchorB,
+        const b2Vec2& worldAxis,
+        const bool collideConnected )
+{
+    // Sanity!
+    if (    (pSceneObjectA != NULL && pSceneObjectA->getScene() == NULL) ||
+            (pSceneObjectB != NULL && pSceneObjectB->getScene() == NULL) )
+    {
+        // Warn.
+        Con::printf( "Cannot add a joint to a scene object that is not in a scene." );
+        return -1;
+    }
+
+    // Check for two invalid objects.
+    if ( pSceneObjectA == NULL && pSceneObjectB == NULL )
+    {
+        Con::warnf("Scene::createPrismaticJoint() - Cannot create joint without at least a single scene object." );
+        return -1;
+    }
+
+    // Fetch bodies.
+    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getBody() : getGroundBody();
+    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getBody() : getGroundBody();
+    
+    // Populate definition.
+    b2PrismaticJointDef jointDef;
+    jointDef.userData         = static_cast<PhysicsProxy*>(this);
+    jointDef.collideConnected = collideConnected;
+    jointDef.bodyA            = pBodyA;
+    jointDef.bodyB            = pBodyB;
+    jointDef.referenceAngle   = pBodyB->GetAngle() - pBodyA->GetAngle();
+    jointDef.localAnchorA     = localAnchorA;
+    jointDef.localAnchorB     = localAnchorB;
+    jointDef.localAxisA       = pBodyA->GetLocalVector( worldAxis );
+    
+    // Create joint.
+    return createJoint( &jointDef );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setPrismaticJointLimit(
+        const U32 jointId,
+        const bool enableLimit,
+        const F32 lowerTranslation, const F32 upperTranslation )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_prismaticJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return;
+    }
+
+    // Cast joint.
+    b2PrismaticJoint* pRealJoint = static_cast<b2PrismaticJoint*>( pJoint );
+
+    // Access joint.
+    pRealJoint->SetLimits( lowerTranslation, upperTranslation );
+    pRealJoint->EnableLimit( enableLimit );
+}
+
+//-----------------------------------------------------------------------------
+
+bool Scene::getPrismaticJointLimit(
+        const U32 jointId,
+        bool& enableLimit,
+        F32& lowerTranslation, F32& upperTranslation )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return false;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_prismaticJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return false;
+    }
+
+    // Cast joint.
+    b2PrismaticJoint* pRealJoint = static_cast<b2PrismaticJoint*>( pJoint );
+
+    // Access joint.
+    enableLimit = pRealJoint->IsLimitEnabled();
+    lowerTranslation = pRealJoint->GetLowerLimit();
+    upperTranslation = pRealJoint->GetUpperLimit();
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setPrismaticJointMotor(
+        const U32 jointId,
+        const bool enableMotor,
+        const F32 motorSpeed,
+        const F32 maxMotorForce )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_prismaticJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return;
+    }
+
+    // Cast joint.
+    b2PrismaticJoint* pRealJoint = static_cast<b2PrismaticJoint*>( pJoint );
+
+    // Access joint.
+    pRealJoint->SetMotorSpeed( motorSpeed );
+    pRealJoint->SetMaxMotorForce( maxMotorForce );
+    pRealJoint->EnableMotor( enableMotor ); 
+}
+
+//-----------------------------------------------------------------------------
+
+bool Scene::getPrismaticJointMotor(
+        const U32 jointId,
+        bool& enableMotor,
+        F32& motorSpeed,
+        F32& maxMotorForce )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return false;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_prismaticJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return false;
+    }
+
+    // Cast joint.
+    b2PrismaticJoint* pRealJoint = static_cast<b2PrismaticJoint*>( pJoint );
+
+    // Access joint.
+    enableMotor = pRealJoint->IsMotorEnabled();
+    motorSpeed = pRealJoint->GetMotorSpeed();
+    maxMotorForce = pRealJoint->GetMaxMotorForce();
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+S32 Scene::createPulleyJoint(
+        const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
+        const b2Vec2& localAnchorA, const b2Vec2& localAnchorB,
+        const b2Vec2& worldGroundAnchorA, const b2Vec2& worldGroundAnchorB,
+        const F32 ratio,
+        const F32 lengthA, const F32 lengthB,
+        const bool collideConnected )
+{
+    // Sanity!
+    if (    (pSceneObjectA != NULL && pSceneObjectA->getScene() == NULL) ||
+            (pSceneObjectB != NULL && pSceneObjectB->getScene() == NULL) )
+    {
+        // Warn.
+        Con::printf( "Cannot add a joint to a scene object that is not in a scene." );
+        return -1;
+    }
+
+    // Check for two invalid objects.
+    if ( pSceneObjectA == NULL && pSceneObjectB == NULL )
+    {
+        Con::warnf("Scene::createPulleyJoint() - Cannot create joint without at least a single scene object." );
+        return -1;
+    }
+
+    // Fetch bodies.
+    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getBody() : getGroundBody();
+    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getBody() : getGroundBody();
+    
+    // Populate definition.
+    b2PulleyJointDef jointDef;
+    jointDef.userData         = static_cast<PhysicsProxy*>(this);
+    jointDef.collideConnected = collideConnected;
+    jointDef.bodyA            = pBodyA;
+    jointDef.bodyB            = pBodyB;
+    jointDef.groundAnchorA    = worldGroundAnchorA;
+    jointDef.groundAnchorB    = worldGroundAnchorB;
+    jointDef.localAnchorA     = localAnchorA;
+    jointDef.localAnchorB     = localAnchorB;
+    jointDef.lengthA          = lengthA < 0.0f ? (pBodyA->GetWorldPoint( localAnchorA ) - worldGroundAnchorA).Length() : lengthA;
+    jointDef.lengthB          = lengthB < 0.0f ? (pBodyA->GetWorldPoint( localAnchorB ) - worldGroundAnchorB).Length() : lengthB;
+    jointDef.ratio            = ratio > b2_epsilon ? ratio : b2_epsilon + b2_epsilon;
+    
+    // Create joint.
+    return createJoint( &jointDef );
+}
+
+//-----------------------------------------------------------------------------
+
+S32 Scene::createTargetJoint(
+        const SceneObject* pSceneObject,
+        const b2Vec2& worldTarget,
+        const F32 maxForce,
+        const bool useCenterOfMass,
+        const F32 frequency,
+        const F32 dampingRatio,
+        const bool collideConnected )
+{
+    // Sanity!
+    if ( pSceneObject != NULL && pSceneObject->getScene() == NULL )
+    {
+        // Warn.
+        Con::printf( "Cannot add a joint to a scene object that is not in a scene." );
+        return -1;
+    }
+
+    // Check for invalid object.
+    if ( pSceneObject == NULL )
+    {
+        Con::warnf("Scene::createPulleyJoint() - Cannot create joint without a scene object." );
+        return -1;
+    }
+
+    // Fetch bodies.
+    b2Body* pBody = pSceneObject->getBody();
+    
+    // Populate definition.
+    b2MouseJointDef jointDef;
+    jointDef.userData         = static_cast<PhysicsProxy*>(this);
+    jointDef.collideConnected = collideConnected;
+    jointDef.bodyA            = getGroundBody();
+    jointDef.bodyB            = pBody;
+    jointDef.target           = useCenterOfMass ? pBody->GetWorldCenter() : worldTarget;
+    jointDef.maxForce         = maxForce;
+    jointDef.frequencyHz      = frequency;
+    jointDef.dampingRatio     = dampingRatio;
+
+    // Create joint.
+    const U32 jointId = createJoint( &jointDef );
+
+    // Cast joint.
+    b2MouseJoint* pRealJoint = static_cast<b2MouseJoint*>( findJoint( jointId ) );
+
+    // Are we using the center of mass?
+    if ( !useCenterOfMass )
+    {
+        // No, so set the target as the world target.
+        // NOTE:-   This is done because initially the target (mouse) joint assumes the target 
+        //          coincides with the body anchor.
+        pRealJoint->SetTarget( worldTarget );
+    }
+
+    return jointId;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setTargetJointTarget(
+        const U32 jointId,
+        const b2Vec2& worldTarget )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_mouseJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return;
+    }
+
+    // Cast joint.
+    b2MouseJoint* pRealJoint = static_cast<b2MouseJoint*>( pJoint );
+
+    // Access joint.
+    pRealJoint->SetTarget( worldTarget );
+}
+
+//-----------------------------------------------------------------------------
+b2Vec2 Scene::getTargetJointTarget( const U32 jointId )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return b2Vec2_zero;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_mouseJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return b2Vec2_zero;
+    }
+
+    // Cast joint.
+    b2MouseJoint* pRealJoint = static_cast<b2MouseJoint*>( pJoint );
+
+    // Access joint.
+    return pRealJoint->GetTarget();
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setTargetJointMaxForce(
+        const U32 jointId,
+        const F32 maxForce )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_mouseJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return;
+    }
+
+    // Cast joint.
+    b2MouseJoint* pRealJoint = static_cast<b2MouseJoint*>( pJoint );
+
+    // Access joint.
+    pRealJoint->SetMaxForce( maxForce );
+}
+
+//-----------------------------------------------------------------------------
+
+F32 Scene::getTargetJointMaxForce( const U32 jointId )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return -1.0f;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_mouseJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return -1.0f;
+    }
+
+    // Cast joint.
+    b2MouseJoint* pRealJoint = static_cast<b2MouseJoint*>( pJoint );
+
+    // Access joint.
+    return pRealJoint->GetMaxForce();
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setTargetJointFrequency(
+        const U32 jointId,
+        const F32 frequency )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_mouseJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return;
+    }
+
+    // Cast joint.
+    b2MouseJoint* pRealJoint = static_cast<b2MouseJoint*>( pJoint );
+
+    // Access joint.
+    pRealJoint->SetFrequency( frequency );
+}
+
+//-----------------------------------------------------------------------------
+
+F32 Scene::getTargetJointFrequency( const U32 jointId )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return -1.0f;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_mouseJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return -1.0f;
+    }
+
+    // Cast joint.
+    b2MouseJoint* pRealJoint = static_cast<b2MouseJoint*>( pJoint );
+
+    // Access joint.
+    return pRealJoint->GetFrequency();
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setTargetJointDampingRatio(
+        const U32 jointId,
+        const F32 dampingRatio )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_mouseJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return;
+    }
+
+    // Cast joint.
+    b2MouseJoint* pRealJoint = static_cast<b2MouseJoint*>( pJoint );
+
+    // Access joint.
+    pRealJoint->SetDampingRatio( dampingRatio );
+}
+
+//-----------------------------------------------------------------------------
+
+F32 Scene::getTargetJointDampingRatio( const U32 jointId )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return -1.0f;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_mouseJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return -1.0f;
+    }
+
+    // Cast joint.
+    b2MouseJoint* pRealJoint = static_cast<b2MouseJoint*>( pJoint );
+
+    // Access joint.
+    return pRealJoint->GetDampingRatio();
+}
+
+//-----------------------------------------------------------------------------
+
+S32 Scene::createMotorJoint(
+            const SceneObject* pSceneObjectA, const SceneObject* pSceneObjectB,
+            const b2Vec2 linearOffset,
+            const F32 angularOffset,
+            const F32 maxForce,
+            const F32 maxTorque,
+            const F32 correctionFactor,
+            const bool collideConnected )
+{
+    // Sanity!
+    if (    (pSceneObjectA != NULL && pSceneObjectA->getScene() == NULL) ||
+            (pSceneObjectB != NULL && pSceneObjectB->getScene() == NULL) )
+    {
+        // Warn.
+        Con::printf( "Cannot add a joint to a scene object that is not in a scene." );
+        return -1;
+    }
+
+    // Check for two invalid objects.
+    if ( pSceneObjectA == NULL && pSceneObjectB == NULL )
+    {
+        Con::warnf("Scene::createMotorJoint() - Cannot create joint without at least a single scene object." );
+        return -1;
+    }
+
+    // Fetch bodies.
+    b2Body* pBodyA = pSceneObjectA != NULL ? pSceneObjectA->getBody() : getGroundBody();
+    b2Body* pBodyB = pSceneObjectB != NULL ? pSceneObjectB->getBody() : getGroundBody();
+    
+    // Populate definition.
+    b2MotorJointDef jointDef;
+    jointDef.userData           = static_cast<PhysicsProxy*>(this);
+    jointDef.collideConnected   = collideConnected;
+    jointDef.bodyA              = pBodyA;
+    jointDef.bodyB              = pBodyB;
+    jointDef.linearOffset       = linearOffset;
+    jointDef.angularOffset      = angularOffset;
+    jointDef.correctionFactor   = correctionFactor;
+    jointDef.maxForce           = maxForce;
+    jointDef.maxTorque          = maxTorque;
+    
+    // Create joint.
+    return createJoint( &jointDef );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setMotorJointLinearOffset(
+        const U32 jointId,
+        const b2Vec2& linearOffset )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_motorJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return;
+    }
+
+    // Cast joint.
+    b2MotorJoint* pRealJoint = static_cast<b2MotorJoint*>( pJoint );
+
+    // Access joint.
+    pRealJoint->SetLinearOffset( linearOffset );
+}
+
+//-----------------------------------------------------------------------------
+
+b2Vec2 Scene::getMotorJointLinearOffset( const U32 jointId )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return b2Vec2_zero;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_motorJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return b2Vec2_zero;
+    }
+
+    // Cast joint.
+    b2MotorJoint* pRealJoint = static_cast<b2MotorJoint*>( pJoint );
+
+    // Access joint.
+    return pRealJoint->GetLinearOffset();
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setMotorJointAngularOffset(
+        const U32 jointId,
+        const F32 angularOffset )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_motorJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return;
+    }
+
+    // Cast joint.
+    b2MotorJoint* pRealJoint = static_cast<b2MotorJoint*>( pJoint );
+
+    // Access joint.
+    pRealJoint->SetAngularOffset( angularOffset );
+}
+
+//-----------------------------------------------------------------------------
+
+F32 Scene::getMotorJointAngularOffset( const U32 jointId )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return -1.0f;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_motorJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return -1.0f;
+    }
+
+    // Cast joint.
+    b2MotorJoint* pRealJoint = static_cast<b2MotorJoint*>( pJoint );
+
+    // Access joint.
+    return pRealJoint->GetAngularOffset();
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setMotorJointMaxForce(
+        const U32 jointId,
+        const F32 maxForce )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_motorJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return;
+    }
+
+    // Cast joint.
+    b2MotorJoint* pRealJoint = static_cast<b2MotorJoint*>( pJoint );
+
+    // Access joint.
+    pRealJoint->SetMaxForce( maxForce );
+}
+
+//-----------------------------------------------------------------------------
+
+F32 Scene::getMotorJointMaxForce( const U32 jointId )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return -1.0f;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_motorJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return -1.0f;
+    }
+
+    // Cast joint.
+    b2MotorJoint* pRealJoint = static_cast<b2MotorJoint*>( pJoint );
+
+    // Access joint.
+    return pRealJoint->GetMaxForce();
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setMotorJointMaxTorque(
+        const U32 jointId,
+        const F32 maxTorque )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_motorJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return;
+    }
+
+    // Cast joint.
+    b2MotorJoint* pRealJoint = static_cast<b2MotorJoint*>( pJoint );
+
+    // Access joint.
+    pRealJoint->SetMaxTorque( maxTorque );
+}
+
+
+//-----------------------------------------------------------------------------
+
+F32 Scene::getMotorJointMaxTorque( const U32 jointId )
+{
+    // Fetch joint.
+    b2Joint* pJoint = findJoint( jointId );
+
+    // Ignore invalid joint.
+    if ( !pJoint )
+        return -1.0f;
+
+    // Fetch joint type.
+    const b2JointType jointType = pJoint->GetType();
+
+    if ( jointType != e_motorJoint )
+    {
+        Con::warnf( "Invalid joint type of %s.", getJointTypeDescription(jointType) );
+        return -1.0f;
+    }
+
+    // Cast joint.
+    b2MotorJoint* pRealJoint = static_cast<b2MotorJoint*>( pJoint );
+
+    // Access joint.
+    return pRealJoint->GetMaxTorque();
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setDebugSceneObject( SceneObject* pSceneObject )
+{
+    // Ignore no change.
+    if ( mpDebugSceneObject == pSceneObject )
+        return;
+
+    // Remove delete notification for existing monitored object.
+    if ( mpDebugSceneObject != NULL )
+        clearNotify( mpDebugSceneObject );
+
+    // Set monitored scene object.
+    mpDebugSceneObject = pSceneObject;
+
+    // Finish if resetting monitored object.
+    if ( pSceneObject == NULL )
+        return;
+
+    // Add delete notification for new monitored object.
+    deleteNotify( pSceneObject );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setLayerSortMode( const U32 layer, const SceneRenderQueue::RenderSort sortMode )
+{
+    // Is the layer valid?
+    if ( layer > MAX_LAYERS_SUPPORTED )
+    {
+        // No, so warn.
+        Con::warnf( "Scene::setLayerSortMode() - Layer '%d' is out of range.", layer );
+
+        return;
+    }
+
+    // Is the sort mode valid?
+    if ( sortMode == SceneRenderQueue::RENDER_SORT_INVALID )
+    {
+        // No, so warn.
+        Con::warnf( "Scene::setLayerSortMode() - Sort mode is invalid for layer '%d'.", layer );
+
+        return;
+    }
+
+    mLayerSortModes[layer] = sortMode;
+}
+
+//-----------------------------------------------------------------------------
+
+SceneRenderQueue::RenderSort Scene::getLayerSortMode( const U32 layer )
+{
+    // Is the layer valid?
+    if ( layer > MAX_LAYERS_SUPPORTED )
+    {
+        // No, so warn.
+        Con::warnf( "Scene::getLayerSortMode() - Layer '%d' is out of range.", layer );
+
+        return SceneRenderQueue::RENDER_SORT_INVALID;
+    }
+
+    return mLayerSortModes[layer];
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::setLayerStatic( const U32 layer, const bool isStatic )
+{
+    // Is the layer valid?
+    if ( layer >= MAX_LAYERS_SUPPORTED )
+    {
+        // No, so warn.
+        Con::warnf( "Scene::setLayerStatic() - Layer '%d' is out of range.", layer );
+
+        return;
+    }
+
+    // Update the static layer mask.
+    if ( isStatic )
+        mStaticLayerMask |= BIT(layer);
+    else
+        mStaticLayerMask &= ~BIT(layer);
+
+    // Invalidate the layer render cache.
+    invalidateLayerRenderCache( layer );
+}
+
+//-----------------------------------------------------------------------------
+
+bool Scene::getLayerStatic( const U32 layer ) const
+{
+    // Is the layer valid?
+    if ( layer >= MAX_LAYERS_SUPPORTED )
+    {
+        // No, so warn.
+        Con::warnf( "Scene::getLayerStatic() - Layer '%d' is out of range.", layer );
+
+        return false;
+    }
+
+    return (mStaticLayerMask & BIT(layer)) != 0;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::attachSceneWindow( SceneWindow* pSceneWindow2D )
+{
+    // Ignore if already attached.
+    if ( isSceneWindowAttached( pSceneWindow2D ) )
+        return;
+
+    // Add to Attached List.
+    mAttachedSceneWindows.addObject( pSceneWindow2D );
+
+    // The shared visibility query does not include the window.
+    invalidateViewQuery();
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::detachSceneWindow( SceneWindow* pSceneWindow2D )
+{
+    // Ignore if not attached.
+    if ( !isSceneWindowAttached( pSceneWindow2D ) )
+        return;
+
+    // Add to Attached List.
+    mAttachedSceneWindows.removeObject( pSceneWindow2D );
+
+    // The shared visibility query refers to the window.
+    invalidateViewQuery();
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::detachAllSceneWindows( void )
+{
+    // Detach All Scene Windows.
+    while( mAttachedSceneWindows.size() > 0 )
+        dynamic_cast<SceneWindow*>(mAttachedSceneWindows[mAttachedSceneWindows.size()-1])->resetScene();
+}
+
+//-----------------------------------------------------------------------------
+
+bool Scene::isSceneWindowAttached( SceneWindow* pSceneWindow2D )
+{
+    for( SimSet::iterator itr = mAttachedSceneWindows.begin(); itr != mAttachedSceneWindows.end(); itr++ )
+        if ( pSceneWindow2D == dynamic_cast<SceneWindow*>(*itr) )
+            // Found.
+            return true;
+
+    // Not Found.
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::addDeleteRequest( SceneObject* pSceneObject )
+{
+    // Ignore if it's already being safe-deleted.
+    if ( pSceneObject->isBeingDeleted() )
+        return;
+
+    // Populate Delete Request.
+    tDeleteRequest deleteRequest = { pSceneObject->getId(), NULL, false };
+
+    // Push Delete Request.
+    mDeleteRequests.push_back( deleteRequest );
+
+    // Flag Delete in Progress.
+    pSceneObject->mBeingSafeDeleted = true;
+
+    // Objects being deleted are no longer ticked.
+    removeTickableSceneObject( pSceneObject );
+}
+
+
+//-----------------------------------------------------------------------------
+
+void Scene::processDeleteRequests( const bool forceImmediate )
+{
+    // Ignore if there's no delete requests!
+    if ( mDeleteRequests.size() == 0 )
+        return;
+
+    // Validate All Delete Requests.
+    U32 safeDeleteReadyCount = 0;
+    for ( U32 requestIndex = 0; requestIndex < (U32)mDeleteRequests.size(); )
+    {
+        // Fetch Reference to Delete Request.
+        tDeleteRequest& deleteRequest = mDeleteRequests[requestIndex];
+
+        // Fetch Object.
+        // NOTE:- Let's be safer and check that it's definitely a scene-object.
+        SceneObject* pSceneObject = dynamic_cast<SceneObject*>( Sim::findObject( deleteRequest.mObjectId ) );
+
+        // Does this object exist?
+        if ( pSceneObject )
+        {
+            // Yes, so write object.
+            deleteRequest.mpSceneObject = pSceneObject;
+
+            // Calculate Safe-Ready Flag.
+            deleteRequest.mSafeDeleteReady = forceImmediate || pSceneObject->getSafeDelete();
+
+            // Is it ready to safe-delete?
+            if ( deleteRequest.mSafeDeleteReady )
+            {
+                // Yes, so increase safe-ready count.
+                ++safeDeleteReadyCount;
+            }         
+        }
+        else
+        {
+            // No, so it looks like the object got deleted prematurely; let's just remove
+            // the request instead.
+            mDeleteRequests.erase_fast( requestIndex );
+            
+            // Repeat this item.
+            continue;
+        }
+
+        // Skip to next request index.
+        ++requestIndex;
+    }
+
+    // Stop if there's no delete requests!
+    if ( mDeleteRequests.size() == 0 )
+        return;
+
+    // Transfer Delete-Requests to Temporary version.
+    // NOTE:-   We do this because we may delete objects which have dependencies.  This would
+    //          cause objects to be added to the safe-delete list.  We don't want to work on
+    //          the list whilst this is happening so we'll transfer it to a temporary list.
+    mDeleteRequestsTemp = mDeleteRequests;
+
+    // Can we process all remaining delete-requests?
+    if ( safeDeleteReadyCount == (U32)mDeleteRequestsTemp.size() )
+    {
+        // Yes, so process ALL safe-ready delete-requests.
+        for ( U32 requestIndex = 0; requestIndex < (U32)mDeleteRequestsTemp.size(); ++requestIndex )
+        {
+            // Yes, so fetch object.
+            SceneObject* pSceneObject = mDeleteRequestsTemp[requestIndex].mpSceneObject;
+
+            // Do script callback.
+            Con::executef(this, 2, "onSafeDelete", pSceneObject->getIdString() );
+
+            // Release the object back to its pool or destroy it.
+            if ( forceImmediate || !mScenePool.release( pSceneObject ) )
+                pSceneObject->deleteObject();
+        }
+
+        // Remove All delete-requests.
+        mDeleteRequestsTemp.clear();
+    }
+    else
+    {
+        // No, so process only safe-ready delete-requests.
+        for ( U32 requestIndex = 0; requestIndex <(U32) mDeleteRequestsTemp.size(); )
+        {
+            // Fetch Reference to Delete Request.
+            tDeleteRequest& deleteRequest = mDeleteRequestsTemp[requestIndex];
+
+            // Is the Object Safe-Ready?
+            if ( deleteRequest.mSafeDeleteReady )
+            {
+                // Yes, so fetch object.
+                SceneObject* pSceneObject = deleteRequest.mpSceneObject;
+
+                // Do script callback.
+                Con::executef(this, 2, "onSafeDelete", pSceneObject->getIdString() );
+
+                // Release the object back to its pool or destroy it.
+                if ( forceImmediate || !mScenePool.release( pSceneObject ) )
+                    pSceneObject->deleteObject();
+
+                // Quickly remove delete-request.
+                mDeleteRequestsTemp.erase_fast( requestIndex );
+
+                // Repeat this item.
+                continue;
+            }
+
+            // Skip to next request index.
+            ++requestIndex;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::SayGoodbye( b2Joint* pJoint )
+{
+    // Find the joint id.
+    const U32 jointId = findJointId( pJoint );
+
+    // Ignore a bad joint.
+    if ( jointId == 0 )
+        return;
+
+    // Remove joint references.
+    mJoints.erase( jointId );
+    mReverseJoints.erase( pJoint );
+}
+
+//-----------------------------------------------------------------------------
+
+SceneObject* Scene::create( const char* pType )
+{
+    // Sanity!
+    AssertFatal( pType != NULL, "Scene::create() - Cannot create a NULL type." );
+
+    // Find the class rep.
+    AbstractClassRep* pClassRep = AbstractClassRep::findClassRep( pType ); 
+
+    // Did we find the type?
+    if ( pClassRep == NULL )
+    {
+        // No, so warn.
+        Con::warnf( "Scene::create() - Could not find type '%s' to create.", pType );
+        return NULL;
+    }
+
+    // Find the scene object rep.
+    AbstractClassRep* pSceneObjectRep = AbstractClassRep::findClassRep( "SceneObject" ); 
+
+    // Sanity!
+    AssertFatal( pSceneObjectRep != NULL,  "Scene::create() - Could not find SceneObject class rep." );
+
+    // Is the type derived from scene object?
+    if ( !pClassRep->isClass( pSceneObjectRep ) )
+    {
+        // No, so warn.
+        Con::warnf( "Scene::create() - Type '%s' is not derived from SceneObject.", pType );
+        return NULL;
+    }
+    
+    // Create the type.
+    SceneObject* pSceneObject = dynamic_cast<SceneObject*>( pClassRep->create() );
+
+    // Sanity!
+    AssertFatal( pSceneObject != NULL, "Scene::create() - Failed to create type via class rep." );
+
+    // Attempt to register the object.
+    if ( !pSceneObject->registerObject() )
+    {
+        // No, so warn.
+        Con::warnf( "Scene::create() - Failed to register type '%s'.", pType );
+        delete pSceneObject;
+        return NULL;
+    }
+
+    // Add to the scene.
+    addToScene( pSceneObject );
+
+    return pSceneObject;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::onTamlPreRead( void )
+{
+    // Call parent.
+    Parent::onTamlPreRead();
+
+    // Allocate the loaded level from an arena if configured.
+    if ( sLevelArenaVariable && mpLevelArena == NULL )
+    {
+        mpLevelArena = new Memory::Arena();
+        mpPreviousArena = Memory::setCurrentArena( mpLevelArena );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::onTamlPostRead( const TamlCustomNodes& customNodes )
+{
+    // Call parent.
+    Parent::onTamlPostRead( customNodes );
+
+    // Reset the loading scene.
+    Scene::LoadingScene = NULL;
+
+    // Find joint custom node.
+    const TamlCustomNode* pJointNode = customNodes.findNode( jointCustomNodeName );
+
+    // Do we have any joints?
+    if ( pJointNode != NULL )
+    {
+        // Yes, so fetch children joint nodes.
+        const TamlCustomNodeVector& jointChildren = pJointNode->getChildren();
+
+        // Iterate joints.
+        for( TamlCustomNodeVector::const_iterator jointNodeItr = jointChildren.begin(); jointNodeItr != jointChildren.end(); ++jointNodeItr )
+        {
+            // Fetch joint node,
+            TamlCustomNode* pJointNode = *jointNodeItr;
+
+            // Fetch node name.
+            StringTableEntry nodeName = pJointNode->getNodeName();
+
+            // Is this a distance joint?
+            if ( nodeName == jointDistanceNodeName )
+            {
+                // Fetch joint children.
+                const TamlCustomNodeVector& jointChildren = pJointNode->getChildren();
+
+                // Fetch joint objects.
+                SceneObject* pSceneObjectA = jointChildren.size() > 0 ? jointChildren[0]->getProxyObject<SceneObject>(true) : NULL;
+                SceneObject* pSceneObjectB = jointChildren.size() == 2 ? jointChildren[1]->getProxyObject<SceneObject>(true) : NULL;
+
+                // Did we get any connected objects?
+                if( pSceneObjectA == NULL && pSceneObjectB == NULL )
+                {
+                    // No, so warn.
+                    Con::warnf( "Scene::onTamlPostRead() - Encountered a joint '%s' but it has invalid connected objects.", nodeName );
+                    continue;
+                }
+
+                b2Vec2 localAnchorA = b2Vec2_zero;
+                b2Vec2 localAnchorB = b2Vec2_zero;
+                bool collideConnected = false;
+
+                F32 length = -1.0f;
+                F32 frequency = 0.0f;
+                F32 dampingRatio = 0.0f;
+
+                // Fetch joint fields.
+                const TamlCustomFieldVector& jointFields = pJointNode->getFields();
+
+                // Iterate property fields.
+                for ( TamlCustomFieldVector::const_iterator jointFieldItr = jointFields.begin(); jointFieldItr != jointFields.end(); ++jointFieldItr )
+                {
+                    // Fetch field node.
+                    TamlCustomField* pField = *jointFieldItr;
+
+                    // Fetch property field name.
+                    StringTableEntry fieldName = pField->getFieldName();
+
+                    // Fetch fields.
+                    if ( fieldName == jointLocalAnchorAName )
+                    {
+                        pField->getFieldValue( localAnchorA );
+                    }
+                    else if ( fieldName == jointLocalAnchorBName )
+                    {
+                        pField->getFieldValue( localAnchorB );
+                    }
+                    else if ( fieldName == jointCollideConnectedName )
+                    {
+                        pField->getFieldValue( collideConnected );
+                    }
+                    else if ( fieldName == jointDistanceLengthName )
+                    {
+                        pField->getFieldValue( length );
+                    }
+                    else if ( fieldName == jointDistanceFrequencyName )
+                    {
+                        pField->getFieldValue( frequency );
+                    }
+                    else if ( fieldName == jointDistanceDampingRatioName )
+                    {
+                        pField->getFieldValue( dampingRatio );
+                    }
+                }
+
+                // Create joint.
+                createDistanceJoint( pSceneObjectA, pSceneObjectB, localAnchorA, localAnchorB, length, frequency, dampingRatio, collideConnected );
+            }
+            // is this a rope joint?
+            else if ( nodeName == jointRopeNodeName )
+            {
+                // Fetch joint children.
+                const TamlCustomNodeVector& jointChildren = pJointNode->getChildren();
+
+                // Fetch joint objects.
+                SceneObject* pSceneObjectA = jointChildren.size() > 0 ? jointChildren[0]->getProxyObject<SceneObject>(true) : NULL;
+                SceneObject* pSceneObjectB = jointChildren.size() == 2 ? jointChildren[1]->getProxyObject<SceneObject>(true) : NULL;
+
+                // Did we get any connected objects?
+                if( pSceneObjectA == NULL && pSceneObjectB == NULL )
+                {
+                    // No, so warn.
+                    Con::warnf( "Scene::onTamlPostRead() - Encountered a joint '%s' but it has invalid connected objects.", nodeName );
+                    continue;
+                }
+
+                b2Vec2 localAnchorA = b2Vec2_zero;
+                b2Vec2 localAnchorB = b2Vec2_zero;
+                bool collideConnected = false;
+
+                F32 maxLength = -1.0f;
+
+                // Fetch joint fields.
+                const TamlCustomFieldVector& jointFields = pJointNode->getFields();
+
+                // Iterate property fields.
+                for ( TamlCustomFieldVector::const_iterator jointFieldItr = jointFields.begin(); jointFieldItr != jointFields.end(); ++jointFieldItr )
+                {
+                    // Fetch field node.
+                    TamlCustomField* pField = *jointFieldItr;
+
+                    // Fetch property field name.
+                    StringTableEntry fieldName = pField->getFieldName();
+
+                    // Fetch fields.
+                    if ( fieldName == jointLocalAnchorAName )
+                    {
+                        pField->getFieldValue( localAnchorA );
+                    }
+                    else if ( fieldName == jointLocalAnchorBName )
+                    {
+                        pField->getFieldValue( localAnchorB );
+                    }
+                    else if ( fieldName == jointCollideConnectedName )
+                    {
+                        pField->getFieldValue( collideConnected );
+                    }
+                    else if ( fieldName == jointRopeMaxLengthName )
+                    {
+                        pField->getFieldValue( maxLength );
+                    }
+                }
+
+                // Create joint.
+                createRopeJoint( pSceneObjectA, pSceneObjectB, localAnchorA, localAnchorB, maxLength, collideConnected );
+            }
+            // Is this a revolute joint?
+            else if ( nodeName == jointRevoluteNodeName )
+            {
+                // Fetch joint children.
+                const TamlCustomNodeVector& jointChildren = pJointNode->getChildren();
+
+                // Fetch joint objects.
+                SceneObject* pSceneObjectA = jointChildren.size() > 0 ? jointChildren[0]->getProxyObject<SceneObject>(true) : NULL;
+                SceneObject* pSceneObjectB = jointChildren.size() == 2 ? jointChildren[1]->getProxyObject<SceneObject>(true) : NULL;
+
+                // Did we get any connected objects?
+                if( pSceneObjectA == NULL && pSceneObjectB == NULL )
+                {
+                    // No, so warn.
+                    Con::warnf( "Scene::onTamlPostRead() - Encountered a joint '%s' but it has invalid connected objects.", nodeName );
+                    continue;
+                }
+
+                b2Vec2 localAnchorA = b2Vec2_zero;
+                b2Vec2 localAnchorB = b2Vec2_zero;
+                bool collideConnected = false;
+
+                bool enableLimit = false;
+                F32 lowerAngle = 0.0f;
+                F32 upperAngle = 0.0f;
+
+                bool enableMotor = false;
+                F32 motorSpeed = b2_pi;
+                F32 maxMotorTorque = 0.0f;
+
+                // Fetch joint fields.
+                const TamlCustomFieldVector& jointFields = pJointNode->getFields();
+
+                // Iterate property fields.
+                for ( TamlCustomFieldVector::const_iterator jointFieldItr = jointFields.begin(); jointFieldItr != jointFields.end(); ++jointFieldItr )
+                {
+                    // Fetch field node.
+                    TamlCustomField* pField = *jointFieldItr;
+
+                    // Fetch property field name.
+                    StringTableEntry fieldName = pField->getFieldName();
+
+                    // Fetch fields.
+                    if ( fieldName == jointLocalAnchorAName )
+                    {
+                        pField->getFieldValue( localAnchorA );
+                    }
+                    else if ( fieldName == jointLocalAnchorBName )
+                    {
+                        pField->getFieldValue( localAnchorB );
+                    }
+                    else if ( fieldName == jointCollideConnectedName )
+                    {
+                        pField->getFieldValue( collideConnected );
+                    }
+                    else if ( fieldName == jointRevoluteLimitLowerAngleName )
+                    {
+                        pField->getFieldValue( lowerAngle );
+                        lowerAngle = mDegToRad( lowerAngle );
+                        enableLimit = true;
+                    }
+                    else if ( fieldName == jointRevoluteLimitUpperAngleName )
+                    {
+                        pField->getFieldValue( upperAngle );
+                        upperAngle = mDegToRad( upperAngle );
+                        enableLimit = true;
+                    }
+                    else if ( fieldName == jointRevoluteMotorSpeedName )
+                    {
+                        pField->getFieldValue( motorSpeed );
+                        motorSpeed = mDegToRad( motorSpeed );
+                        enableMotor = true;
+                    }
+                    else if ( fieldName == jointRevoluteMotorMaxTorqueName )
+                    {
+                        pField->getFieldValue( maxMotorTorque );
+                        enableMotor = true;
+                    }
+                }
+
+                // Create joint.
+                const U32 jointId = createRevoluteJoint( pSceneObjectA, pSceneObjectB, localAnchorA, localAnchorB, collideConnected );
+            
+                if ( enableLimit )
+                    setRevoluteJointLimit( jointId, true, lowerAngle, upperAngle );
+
+                if ( enableMotor )
+                    setRevoluteJointMotor( jointId, true, motorSpeed, maxMotorTorque );
+            }
+            // is this a weld joint?
+            else if ( nodeName == jointWeldNodeName )
+            {
+                // Fetch joint children.
+                const TamlCustomNodeVector& jointChildren = pJointNode->getChildren();
+
+                // Fetch joint objects.
+                SceneObject* pSceneObjectA = jointChildren.size() > 0 ? jointChildren[0]->getProxyObject<SceneObject>(true) : NULL;
+                SceneObject* pSceneObjectB = jointChildren.size() == 2 ? jointChildren[1]->getProxyObject<SceneObject>(true) : NULL;
+
+                // Did we get any connected objects?
+                if( pSceneObjectA == NULL && pSceneObjectB == NULL )
+                {
+                    // No, so warn.
+                    Con::warnf( "Scene::onTamlPostRead() - Encountered a joint '%s' but it has invalid connected objects.", nodeName );
+                    continue;
+                }
+
+                b2Vec2 localAnchorA = b2Vec2_zero;
+                b2Vec2 localAnchorB = b2Vec2_zero;
+                bool collideConnected = false;
+
+                F32 frequency = 0.0f;
+                F32 dampingRatio = 0.0f;
+
+                // Fetch joint fields.
+                const TamlCustomFieldVector& jointFields = pJointNode->getFields();
+
+                // Iterate property fields.
+                for ( TamlCustomFieldVector::const_iterator jointFieldItr = jointFields.begin(); jointFieldItr != jointFields.end(); ++jointFieldItr )
+                {
+                    // Fetch field node.
+                    TamlCustomField* pField = *jointFieldItr;
+
+                    // Fetch property field name.
+                    StringTableEntry fieldName = pField->getFieldName();
+
+                    // Fetch fields.
+                    if ( fieldName == jointLocalAnchorAName )
+                    {
+                        pField->getFieldValue( localAnchorA );
+                    }
+                    else if ( fieldName == jointLocalAnchorBName )
+                    {
+                        pField->getFieldValue( localAnchorB );
+                    }
+                    else if ( fieldName == jointCollideConnectedName )
+                    {
+                        pField->getFieldValue( collideConnected );
+                    }
+                    else if ( fieldName == jointWeldFrequencyName )
+                    {
+                        pField->getFieldValue( frequency );
+                    }
+                    else if ( fieldName == jointWeldDampingRatioName )
+                    {
+                        pField->getFieldValue( dampingRatio );
+                    }
+                }
+
+                // Create joint.
+                createWeldJoint( pSceneObjectA, pSceneObjectB, localAnchorA, localAnchorB, frequency, dampingRatio, collideConnected );
+            }
+            // Is this a wheel joint?
+            else if ( nodeName == jointWheelNodeName )
+            {
+                // Fetch joint children.
+                const TamlCustomNodeVector& jointChildren = pJointNode->getChildren();
+
+                // Fetch joint objects.
+                SceneObject* pSceneObjectA = jointChildren.size() > 0 ? jointChildren[0]->getProxyObject<SceneObject>(true) : NULL;
+                SceneObject* pSceneObjectB = jointChildren.size() == 2 ? jointChildren[1]->getProxyObject<SceneObject>(true) : NULL;
+
+                // Did we get any connected objects?
+                if( pSceneObjectA == NULL && pSceneObjectB == NULL )
+                {
+                    // No, so warn.
+                    Con::warnf( "Scene::onTamlPostRead() - Encountered a joint '%s' but it has invalid connected objects.", nodeName );
+                    continue;
+                }
+
+                b2Vec2 localAnchorA = b2Vec2_zero;
+                b2Vec2 localAnchorB = b2Vec2_zero;
+                bool collideConnected = false;
+
+                bool enableMotor = false;
+                F32 motorSpeed = b2_pi;
+                F32 maxMotorTorque = 0.0f;
+
+                F32 frequency = 0.0f;
+                F32 dampingRatio = 0.0f;
+                b2Vec2 worldAxis( 0.0f, 1.0f );
+
+                // Fetch joint fields.
+                const TamlCustomFieldVector& jointFields = pJointNode->getFields();
+
+                // Iterate property fields.
+                for ( TamlCustomFieldVector::const_iterator jointFieldItr = jointFields.begin(); jointFieldItr != jointFields.end(); ++jointFieldItr )
+                {
+                    // Fetch field node.
+                    TamlCustomField* pField = *jointFieldItr;
+
+                    // Fetch property field name.
+                    StringTableEntry fieldName = pField->getFieldName();
+
+                    // Fetch fields.
+                    if ( fieldName == jointLocalAnchorAName )
+                    {
+                        pField->getFieldValue( localAnchorA );
+                    }
+                    else if ( fieldName == jointLocalAnchorBName )
+                    {
+                        pField->getFieldValue( localAnchorB );
+                    }
+                    else if ( fieldName == jointCollideConnectedName )
+                    {
+                        pField->getFieldValue( collideConnected );
+                    }
+                    else if ( fieldName == jointWheelMotorSpeedName )
+                    {
+                        pField->getFieldValue( motorSpeed );
+                        motorSpeed = mDegToRad( motorSpeed );
+                        enableMotor = true;
+                    }
+                    else if ( fieldName == jointWheelMotorMaxTorqueName )
+                    {
+                        pField->getFieldValue( maxMotorTorque );
+                        enableMotor = true;
+                    }
+                    else if ( fieldName == jointWheelFrequencyName )
+                    {
+                        pField->getFieldValue( frequency );
+                    }
+                    else if ( fieldName == jointWheelDampingRatioName )
+                    {
+                        pField->getFieldValue( dampingRatio );
+                    }
+                    else if ( fieldName == jointWheelWorldAxisName )
+                    {
+                        pField->getFieldValue( worldAxis );                    
+                    }
+                }
+
+                // Create joint.
+                const U32 jointId = createWheelJoint( pSceneObjectA, pSceneObjectB, localAnchorA, localAnchorB, worldAxis, collideConnected );
+
+                if ( enableMotor )
+                    setWheelJointMotor( jointId, true, motorSpeed, maxMotorTorque );
+
+                setWheelJointFrequency( jointId, frequency );
+                setWheelJointDampingRatio( jointId, dampingRatio );
+            }
+            // Is this a friction joint?
+            else if ( nodeName == jointFrictionNodeName )
+            {
+                // Fetch joint children.
+                const TamlCustomNodeVector& jointChildren = pJointNode->getChildren();
+
+                // Fetch joint objects.
+                SceneObject* pSceneObjectA = jointChildren.size() > 0 ? jointChildren[0]->getProxyObject<SceneObject>(true) : NULL;
+                SceneObject* pSceneObjectB = jointChildren.size() == 2 ? jointChildren[1]->getProxyObject<SceneObject>(true) : NULL;
+
+                // Did we get any connected objects?
+                if( pSceneObjectA == NULL && pSceneObjectB == NULL )
+                {
+                    // No, so warn.
+                    Con::warnf( "Scene::onTamlPostRead() - Encountered a joint '%s' but it has invalid connected objects.", nodeName );
+                    continue;
+                }
+
+                b2Vec2 localAnchorA = b2Vec2_zero;
+                b2Vec2 localAnchorB = b2Vec2_zero;
+                bool collideConnected = false;
+
+                F32 maxForce = 0.0f;
+                F32 maxTorque = 0.0f;
+
+                // Fetch joint fields.
+                const TamlCustomFieldVector& jointFields = pJointNode->getFields();
+
+                // Iterate property fields.
+                for ( TamlCustomFieldVector::const_iterator jointFieldItr = jointFields.begin(); jointFieldItr != jointFields.end(); ++jointFieldItr )
+                {
+                    // Fetch field node.
+                    TamlCustomField* pField = *jointFieldItr;
+
+                    // Fetch property field name.
+                    StringTableEntry fieldName = pField->getFieldName();
+
+                    // Fetch fields.
+                    if ( fieldName == jointLocalAnchorAName )
+                    {
+                        pField->getFieldValue( localAnchorA );
+                    }
+                    else if ( fieldName == jointLocalAnchorBName )
+                    {
+                        pField->getFieldValue( localAnchorB );
+                    }
+                    else if ( fieldName == jointCollideConnectedName )
+                    {
+                        pField->getFieldValue( collideConnected );
+                    }
+                    else if ( fieldName == jointFrictionMaxForceName )
+                    {
+                        pField->getFieldValue( maxForce );
+                    }
+                    else if ( fieldName == jointFrictionMaxTorqueName )
+                    {
+                        pField->getFieldValue( maxTorque );
+                    }
+                }
+
+                // Create joint.
+                createFrictionJoint( pSceneObjectA, pSceneObjectB, localAnchorA, localAnchorB, maxForce, maxTorque, collideConnected );
+            }
+            // Is this a prismatic joint?
+            else if ( nodeName == jointPrismaticNodeName )
+            {
+                // Fetch joint children.
+                const TamlCustomNodeVector& jointChildren = pJointNode->getChildren();
+
+                // Fetch joint objects.
+                SceneObject* pSceneObjectA = jointChildren.size() > 0 ? jointChildren[0]->getProxyObject<SceneObject>(true) : NULL;
+                SceneObject* pSceneObjectB = jointChildren.size() == 2 ? jointChildren[1]->getProxyObject<SceneObject>(true) : NULL;
+
+                // Did we get any connected objects?
+                if( pSceneObjectA == NULL && pSceneObjectB == NULL )
+                {
+                    // No, so warn.
+                    Con::warnf( "Scene::onTamlPostRead() - Encountered a joint '%s' but it has invalid connected objects.", nodeName );
+                    continue;
+                }
+
+                b2Vec2 localAnchorA = b2Vec2_zero;
+                b2Vec2 localAnchorB = b2Vec2_zero;
+                bool collideConnected = false;
+
+                bool enableLimit;
+                F32 lowerTransLimit = 0.0f;
+                F32 upperTransLimit = 1.0f;
+
+                bool enableMotor = false;
+                F32 motorSpeed = b2_pi;
+                F32 maxMotorForce = 0.0f;
+
+                b2Vec2 worldAxis( 0.0f, 1.0f );
+
+                // Fetch joint fields.
+                const TamlCustomFieldVector& jointFields = pJointNode->getFields();
+
+                // Iterate property fields.
+                for ( TamlCustomFieldVector::const_iterator jointFieldItr = jointFields.begin(); jointFieldItr != jointFields.end(); ++jointFieldItr )
+                {
+                    // Fetch field node.
+                    TamlCustomField* pField = *jointFieldItr;
+
+                    // Fetch property field name.
+                    StringTableEntry fieldName = pField->getFieldName();
+
+                    // Fetch fields.
+                    if ( fieldName == jointLocalAnchorAName )
+                    {
+                        pField->getFieldValue( localAnchorA );
+                    }
+                    else if ( fieldName == jointLocalAnchorBName )
+                    {
+                        pField->getFieldValue( localAnchorB );
+                    }
+                    else if ( fieldName == jointCollideConnectedName )
+                    {
+                        pField->getFieldValue( collideConnected );
+                    }
+                    else if ( fieldName == jointPrismaticLimitLowerTransName )
+                    {
+                        pField->getFieldValue( lowerTransLimit );
+                        enableLimit = true;
+                    }
+                    else if ( fieldName == jointPrismaticLimitUpperTransName )
+                    {
+                        pField->getFieldValue( upperTransLimit );
+                        enableLimit = true;
+                    }
+                    else if ( fieldName == jointPrismaticMotorSpeedName )
+                    {
+                        pField->getFieldValue( motorSpeed );
+                        motorSpeed = mDegToRad( motorSpeed );
+                        enableMotor = true;
+                    }
+                    else if ( fieldName == jointPrismaticMotorMaxForceName )
+                    {
+                        pField->getFieldValue( maxMotorForce );
+                        enableMotor = true;
+                    }
+                    else if ( fieldName == jointPrismaticWorldAxisName )
+                    {
+                        pField->getFieldValue( worldAxis );
+                    }
+                }
+
+                // Create joint.
+                const U32 jointId = createPrismaticJoint( pSceneObjectA, pSceneObjectB, localAnchorA, localAnchorB, worldAxis, collideConnected );
+
+                if ( enableLimit )
+                    setPrismaticJointLimit( jointId, true, lowerTransLimit, upperTransLimit );
+
+                if ( enableMotor )
+                    setPrismaticJointMotor( jointId, true, motorSpeed, maxMotorForce );
+            }
+            // Is this a pulley joint?
+            else if ( nodeName == jointPulleyNodeName )
+            {
+                // Fetch joint children.
+                const TamlCustomNodeVector& jointChildren = pJointNode->getChildren();
+
+                // Fetch joint objects.
+                SceneObject* pSceneObjectA = jointChildren.size() > 0 ? jointChildren[0]->getProxyObject<SceneObject>(true) : NULL;
+                SceneObject* pSceneObjectB = jointChildren.size() == 2 ? jointChildren[1]->getProxyObject<SceneObject>(true) : NULL;
+
+                // Did we get any connected objects?
+                if( pSceneObjectA == NULL && pSceneObjectB == NULL )
+                {
+                    // No, so warn.
+                    Con::warnf( "Scene::onTamlPostRead() - Encountered a joint '%s' but it has invalid connected objects.", nodeName );
+                    continue;
+                }
+
+                b2Vec2 localAnchorA = b2Vec2_zero;
+                b2Vec2 localAnchorB = b2Vec2_zero;
+                bool collideConnected = false;
+
+                F32 lengthA = -1.0f;
+                F32 lengthB = -1.0f;
+                F32 ratio = 0.5f;
+                b2Vec2 worldGroundAnchorA = b2Vec2_zero;
+                b2Vec2 worldGroundAnchorB = b2Vec2_zero;
+
+                // Fetch joint fields.
+                const TamlCustomFieldVector& jointFields = pJointNode->getFields();
+
+                // Iterate property fields.
+                for ( TamlCustomFieldVector::const_iterator jointFieldItr = jointFields.begin(); jointFieldItr != jointFields.end(); ++jointFieldItr )
+                {
+                    // Fetch field node.
+                    TamlCustomField* pField = *jointFieldItr;
+
+                    // Fetch property field name.
+                    StringTableEntry fieldName = pField->getFieldName();
+
+                    // Fetch fields.
+                    if ( fieldName == jointLocalAnchorAName )
+                    {
+                        pField->getFieldValue( localAnchorA );
+                    }
+                    else if ( fieldName == jointLocalAnchorBName )
+                    {
+                        pField->getFieldValue( localAnchorB );
+                    }
+                    else if ( fieldName == jointCollideConnectedName )
+                    {
+                        pField->getFieldValue( collideConnected );
+                    }
+                    else if ( fieldName == jointPulleyLengthAName )
+                    {
+                        pField->getFieldValue( lengthA );
+                    }
+                    else if ( fieldName == jointPulleyLengthBName )
+                    {
+                        pField->getFieldValue( lengthB );
+                    }
+                    else if ( fieldName == jointPulleyRatioName )
+                    {
+                        pField->getFieldValue( ratio );
+                    }
+                    else if ( fieldName == jointPulleyGroundAnchorAName )
+                    {
+                        pField->getFieldValue( worldGroundAnchorA );
+                    }
+                    else if ( fieldName == jointPulleyGroundAnchorBName )
+                    {
+                        pField->getFieldValue( worldGroundAnchorB );
+                    }
+                }
+
+                // Create joint.
+                createPulleyJoint( pSceneObjectA, pSceneObjectB, localAnchorA, localAnchorB, worldGroundAnchorA, worldGroundAnchorB, ratio, lengthA, lengthB, collideConnected );
+
+            }
+            // Is this a target joint?
+            else if ( nodeName == jointTargetNodeName )
+            {
+                // Fetch joint children.
+                const TamlCustomNodeVector& jointChildren = pJointNode->getChildren();
+
+                // Fetch joint objects.
+                SceneObject* pSceneObject = jointChildren.size() == 1 ? jointChildren[0]->getProxyObject<SceneObject>(true) : NULL;
+
+                // Did we get any connected objects?
+                if( pSceneObject == NULL )
+                {
+                    // No, so warn.
+                    Con::warnf( "Scene::onTamlPostRead() - Encountered a joint '%s' but it has an invalid connected object.", nodeName );
+                    continue;
+                }
+
+                bool collideConnected = false;
+                b2Vec2 worldTarget = b2Vec2_zero;
+                F32 maxForce = 1.0f;
+                F32 frequency = 5.0f;
+                F32 dampingRatio = 0.7f;
+
+                // Fetch joint fields.
+                const TamlCustomFieldVector& jointFields = pJointNode->getFields();
+
+                // Iterate property fields.
+                for ( TamlCustomFieldVector::const_iterator jointFieldItr = jointFields.begin(); jointFieldItr != jointFields.end(); ++jointFieldItr )
+                {
+                    // Fetch field node.
+                    TamlCustomField* pField = *jointFieldItr;
+
+                    // Fetch property field name.
+                    StringTableEntry fieldName = pField->getFieldName();
+
+                    // Fetch fields.
+                    if ( fieldName == jointCollideConnectedName )
+                    {
+                        pField->getFieldValue( collideConnected );
+                    }
+                    else if ( fieldName == jointTargetWorldTargetName )
+                    {
+                        pField->getFieldValue( worldTarget );
+                    }
+                    else if ( fieldName == jointTargetMaxForceName )
+                    {
+                        pField->getFieldValue( maxForce );
+                    }
+                    else if ( fieldName == jointTargetFrequencyName )
+                    {
+                        pField->getFieldValue( frequency );
+                    }
+                    else if ( fieldName == jointTargetDampingRatioName )
+                    {
+                        pField->getFieldValue( dampingRatio );
+                    }
+                }
+
+                // Create joint.
+                createTargetJoint( pSceneObject, worldTarget, maxForce, frequency, dampingRatio, collideConnected );
+            }
+            // Is this a motor joint?
+            else if ( nodeName == jointMotorNodeName )
+            {
+                // Fetch joint children.
+                const TamlCustomNodeVector& jointChildren = pJointNode->getChildren();
+
+                // Fetch joint objects.
+                SceneObject* pSceneObjectA = jointChildren.size() > 0 ? jointChildren[0]->getProxyObject<SceneObject>(true) : NULL;
+                SceneObject* pSceneObjectB = jointChildren.size() == 2 ? jointChildren[1]->getProxyObject<SceneObject>(true) : NULL;
+
+                // Did we get any connected objects?
+                if( pSceneObjectA == NULL && pSceneObjectB == NULL )
+                {
+                    // No, so warn.
+                    Con::warnf( "Scene::onTamlPostRead() - Encountered a joint '%s' but it has invalid connected objects.", nodeName );
+                    continue;
+                }
+
+                bool collideConnected = false;
+
+                b2Vec2 linearOffset = b2Vec2_zero;
+                F32 angularOffset = 0.0f;
+                F32 maxForce = 1.0f;
+                F32 maxTorque = 1.0f;
+                F32 correctionFactor = 0.3f;
+
+                // Fetch joint fields.
+                const TamlCustomFieldVector& jointFields = pJointNode->getFields();
+
+                // Iterate property fields.
+                for ( TamlCustomFieldVector::const_iterator jointFieldItr = jointFields.begin(); jointFieldItr != jointFields.end(); ++jointFieldItr )
+                {
+                    // Fetch field node.
+                    TamlCustomField* pField = *jointFieldItr;
+
+                    // Fetch property field name.
+                    StringTableEntry fieldName = pField->getFieldName();
+
+                    // Fetch fields.
+                    if ( fieldName == jointCollideConnectedName )
+                    {
+                        pField->getFieldValue( collideConnected );
+                    }
+                    else if ( fieldName == jointMotorLinearOffsetName )
+                    {
+                        pField->getFieldValue( linearOffset );
+                    }
+                    else if ( fieldName == jointMotorAngularOffsetName )
+                    {
+                        pField->getFieldValue( angularOffset );
+                        angularOffset = mDegToRad( angularOffset );
+                    }
+                    else if ( fieldName == jointMotorMaxForceName )
+                    {
+                        pField->getFieldValue( maxForce );
+                    }
+                    else if ( fieldName == jointMotorMaxTorqueName )
+                    {
+                        pField->getFieldValue( maxTorque );
+                    }
+                    else if ( fieldName == jointMotorCorrectionFactorName )
+                    {
+                        pField->getFieldValue( correctionFactor );
+                    }
+                }
+
+                // Create joint.
+                createMotorJoint( pSceneObjectA, pSceneObjectB, linearOffset, angularOffset, maxForce, maxTorque, correctionFactor, collideConnected );
+
+            }
+            // Unknown joint type!
+            else
+            {
+                // Warn.
+                Con::warnf( "Unknown joint type of '%s' encountered.", nodeName );
+
+                // Sanity!
+                AssertFatal( false, "Scene::onTamlCustomRead() - Unknown joint type detected." );
+
+                continue;
+            }
+        }
+    }
+
+    // Find controller custom node.
+    const TamlCustomNode* pControllerCustomNode = customNodes.findNode( controllerCustomNodeName );
+
+    // Do we have any controllers?
+    if ( pControllerCustomNode != NULL )
+    {
+        // Yes, so fetch the scene controllers.
+        SimSet* pControllerSet = getControllers();
+
+        // Fetch children controller nodes.
+        const TamlCustomNodeVector& controllerChildren = pControllerCustomNode->getChildren();
+
+        // Iterate controllers.
+        for( TamlCustomNodeVector::const_iterator controllerNodeItr = controllerChildren.begin(); controllerNodeItr != controllerChildren.end(); ++controllerNodeItr )
+        {
+            // Fetch controller node.
+            TamlCustomNode* pControllerNode = *controllerNodeItr;
+            
+            // Is the node a proxy object?
+            if ( !pControllerNode->isProxyObject() )
+            {
+                // No, so warn.
+                Con::warnf("Scene::onTamlPostRead() - Reading scene controllers but node '%s'is not an object.", pControllerNode->getNodeName() );
+
+                continue;
+            }
+
+            // Add the proxy object.
+            SimObject* pProxyObject = pControllerNode->getProxyObject<SimObject>(false);
+
+            // Is it a scene controller?
+            if ( dynamic_cast<SceneController*>( pProxyObject ) == NULL )
+            {
+                // No, so warn.
+                Con::warnf("Scene::onTamlPostRead() - Reading scene controllers but node '%s'is not a scene controller.", pControllerNode->getNodeName() );
+
+                // Delete the object.
+                pProxyObject->deleteObject();
+
+                continue;
+            }
+
+            // Add to scene controllers.
+            pControllerSet->addObject( pProxyObject );
+        }
+    }
+
+    // Find asset preload custom node.
+    const TamlCustomNode* pAssetPreloadNode = customNodes.findNode( assetPreloadNodeName );
+
+    // Do we have any asset preloads?
+    if ( pAssetPreloadNode != NULL )
+    {
+        // Yes, so clear any existing asset preloads.
+        clearAssetPreloads();
+
+        // Yes, so fetch asset Id type prefix.
+        StringTableEntry assetIdTypePrefix = ConsoleBaseType::getType( TypeAssetId )->getTypePrefix();
+
+        // Fetch the prefix length.
+        const S32 assetIdPrefixLength = dStrlen( assetIdTypePrefix );
+
+        // Fetch the preload children nodes.
+        const TamlCustomNodeVector& preloadChildren = pAssetPreloadNode->getChildren();
+
+        // Iterate asset preloads.
+        for( TamlCustomNodeVector::const_iterator assetPreloadNodeItr = preloadChildren.begin(); assetPreloadNodeItr != preloadChildren.end(); ++assetPreloadNodeItr )
+        {
+            // Fetch asset node.
+            const TamlCustomNode* pAssetNode = *assetPreloadNodeItr;
+
+            // Ignore non-asset nodes.
+            if ( pAssetNode->getNodeName() != assetNodeName )
+                continue;
+
+            // Find the asset Id field.
+            const TamlCustomField* pAssetIdField = pAssetNode->findField( "Id" );
+
+            // Did we find the field?
+            if ( pAssetIdField == NULL )
+            {
+                // No, so warn.
+                Con::warnf("Scene::onTamlPostRead() - Found asset preload but failed to find asset Id field." );
+                continue;
+            }
+
+            // Fetch field value.
+            const char* pFieldValue = pAssetIdField->getFieldValue();
+
+            // Calculate the field value start (skip any type prefix).
+            const S32 prefixOffset = dStrnicmp( pFieldValue, assetIdTypePrefix, assetIdPrefixLength ) == 0 ? assetIdPrefixLength : 0;
+
+            // Add asset preload.
+            addAssetPreload( pFieldValue + prefixOffset, mAsyncAssetPreloads );
+        }
+    }   
+
+    // Stop allocating from the level arena.
+    // NOTE: Closing the arena lets each chunk be freed as soon as the last block in it is freed.
+    if ( mpLevelArena != NULL && Memory::getCurrentArena() == mpLevelArena )
+    {
+        Memory::setCurrentArena( mpPreviousArena );
+        mpLevelArena->close();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::onTamlCustomWrite( TamlCustomNodes& customNodes )
+{
+    // Call parent.
+    Parent::onTamlCustomWrite( customNodes );
+
+    // Fetch joint count.
+    const U32 jointCount = getJointCount();
+
+    // Do we have any joints?
+    if ( jointCount > 0 )
+    {
+        // Yes, so add joint custom node.
+        TamlCustomNode* pJointCustomNode = customNodes.addNode( jointCustomNodeName );
+
+        // Iterate joints.
+        for( typeJointHash::iterator jointItr = mJoints.begin(); jointItr != mJoints.end(); ++jointItr )
+        {
+            // Fetch base joint.
+            b2Joint* pBaseJoint = jointItr->value;
+
+            // Add joint node.
+            // NOTE:    The name of the node will get updated shortly.
+            TamlCustomNode* pJointNode = pJointCustomNode->addNode( StringTable->EmptyString );
+
+            // Fetch common details.
+            b2Body* pBodyA = pBaseJoint->GetBodyA();
+            b2Body* pBodyB = pBaseJoint->GetBodyB();
+
+            // Fetch physics proxies.
+            PhysicsProxy* pPhysicsProxyA = static_cast<PhysicsProxy*>(pBodyA->GetUserData());
+            PhysicsProxy* pPhysicsProxyB = static_cast<PhysicsProxy*>(pBodyB->GetUserData());
+
+            // Fetch physics proxy type.
+            PhysicsProxy::ePhysicsProxyType proxyTypeA = static_cast<PhysicsProxy*>(pBodyA->GetUserData())->getPhysicsProxyType();
+            PhysicsProxy::ePhysicsProxyType proxyTypeB = static_cast<PhysicsProxy*>(pBodyB->GetUserData())->getPhysicsProxyType();
+
+            // Fetch scene objects.
+            SceneObject* pSceneObjectA = proxyTypeA == PhysicsProxy::PHYSIC_PROXY_SCENEOBJECT ? static_cast<SceneObject*>(pPhysicsProxyA) : NULL;
+            SceneObject* pSceneObjectB = proxyTypeB == PhysicsProxy::PHYSIC_PROXY_SCENEOBJECT ? static_cast<SceneObject*>(pPhysicsProxyB) : NULL;
+
+            // Populate joint appropriately.
+            switch( pBaseJoint->GetType() )
+            {
+                case e_distanceJoint:
+                    {
+                        // Set joint name.
+                        pJointNode->setNodeName( jointDistanceNodeName );
+
+                        // Fetch joint.
+                        const b2DistanceJoint* pJoint = dynamic_cast<const b2DistanceJoint*>( pBaseJoint );
+
+                        // Sanity!
+                        AssertFatal( pJoint != NULL, "Scene::onTamlCustomWrite() - Invalid distance joint type returned." );
+
+                        // Add length.
+                        pJointNode->addField( jointDistanceLengthName, pJoint->GetLength() );
+
+                        // Add frequency.
+                        if ( mNotZero( pJoint->GetFrequency() ) )
+                            pJointNode->addField( jointDistanceFrequencyName, pJoint->GetFrequency() );
+
+                        // Add damping ratio.
+                        if ( mNotZero( pJoint->GetDampingRatio() ) )
+                            pJointNode->addField( jointDistanceDampingRatioName, pJoint->GetDampingRatio() );
+
+                        // Add local anchors.
+                        if ( mNotZero( pJoint->GetLocalAnchorA().LengthSquared() ) )
+                            pJointNode->addField( jointLocalAnchorAName, pJoint->GetLocalAnchorA() );
+                        if ( mNotZero( pJoint->GetLocalAnchorB().LengthSquared() ) )
+                            pJointNode->addField( jointLocalAnchorBName, pJoint->GetLocalAnchorB() );
+
+                        // Add scene object bodies.
+                        if ( pSceneObjectA != NULL )
+                            pJointNode->addNode( pSceneObjectA );
+
+                        if ( pSceneObjectB != NULL )
+                            pJointNode->addNode( pSceneObjectB );
+                    }
+                    break;
+
+                case e_ropeJoint:
+                    {
+                        // Set joint name.
+                        pJointNode->setNodeName( jointRopeNodeName );
+
+                        // Fetch joint.
+                        const b2RopeJoint* pJoint = dynamic_cast<const b2RopeJoint*>( pBaseJoint );
+
+                        // Sanity!
+                        AssertFatal( pJoint != NULL, "Scene::onTamlCustomWrite() - Invalid rope joint type returned." );
+
+                        // Add max length.
+                        if ( mNotZero( pJoint->GetMaxLength() ) )
+                            pJointNode->addField( jointRopeMaxLengthName, pJoint->GetMaxLength() );
+
+                        // Add local anchors.
+                        if ( mNotZero( pJoint->GetLocalAnchorA().LengthSquared() ) )
+                            pJointNode->addField( jointLocalAnchorAName, pJoint->GetLocalAnchorA() );
+                        if ( mNotZero( pJoint->GetLocalAnchorB().LengthSquared() ) )
+                            pJointNode->addField( jointLocalAnchorBName, pJoint->GetLocalAnchorB() );
+
+                        // Add scene object bodies.
+                        if ( pSceneObjectA != NULL )
+                            pJointNode->addNode( pSceneObjectA );
+
+                        if ( pSceneObjectB != NULL )
+                            pJointNode->addNode( pSceneObjectB );
+                    }
+                    break;
+
+                case e_revoluteJoint:
+                    {
+                        // Set join name.
+                        pJointNode->setNodeName( jointRevoluteNodeName );
+
+                        // Fetch joint.
+                        const b2RevoluteJoint* pJoint = dynamic_cast<const b2RevoluteJoint*>( pBaseJoint );
+
+                        // Sanity!
+                        AssertFatal( pJoint != NULL, "Scene::onTamlCustomWrite() - Invalid revolute joint type returned." );
+
+                        // Add limit.
+                        if ( pJoint->IsLimitEnabled() )
+                        {
+                            // Add limits.
+                            pJointNode->addField( jointRevoluteLimitLowerAngleName, mRadToDeg(pJoint->GetLowerLimit()) );
+                            pJointNode->addField( jointRevoluteLimitUpperAngleName, mRadToDeg(pJoint->GetUpperLimit()) );
+                        }
+
+                        // Add motor.
+                        if ( pJoint->IsMotorEnabled() )
+                        {
+                            // Add motor.
+                            pJointNode->addField( jointRevoluteMotorSpeedName, mRadToDeg(pJoint->GetMotorSpeed()) );
+                            pJointNode->addField( jointRevoluteMotorMaxTorqueName, pJoint->GetMaxMotorTorque() );
+                        }
+
+                        // Add local anchors.
+                        if ( mNotZero( pJoint->GetLocalAnchorA().LengthSquared() ) )
+                            pJointNode->addField( jointLocalAnchorAName, pJoint->GetLocalAnchorA() );
+                        if ( mNotZero( pJoint->GetLocalAnchorB().LengthSquared() ) )
+                            pJointNode->addField( jointLocalAnchorBName, pJoint->GetLocalAnchorB() );
+
+                        // Add scene object bodies.
+                        if ( pSceneObjectA != NULL )
+                            pJointNode->addNode( pSceneObjectA );
+
+                        if ( pSceneObjectB != NULL )
+                            pJointNode->addNode( pSceneObjectB );
+                    }
+                    break;
+
+                case e_weldJoint:
+                    {
+                        // Set joint name.
+                        pJointNode->setNodeName( jointWeldNodeName );
+
+                        // Fetch joint.
+                        const b2WeldJoint* pJoint = dynamic_cast<const b2WeldJoint*>( pBaseJoint );
+
+                        // Sanity!
+                        AssertFatal( pJoint != NULL, "Scene::onTamlCustomWrite() - Invalid weld joint type returned." );
+
+                        // Add frequency.
+                        if ( mNotZero( pJoint->GetFrequency() ) )
+                            pJointNode->addField( jointWeldFrequencyName, pJoint->GetFrequency() );
+
+                        // Add damping ratio.
+                        if ( mNotZero( pJoint->GetDampingRatio() ) )
+                            pJointNode->addField( jointWeldDampingRatioName, pJoint->GetDampingRatio() );
+
+                        // Add local anchors.
+                        if ( mNotZero( pJoint->GetLocalAnchorA().LengthSquared() ) )
+                            pJointNode->addField( jointLocalAnchorAName, pJoint->GetLocalAnchorA() );
+                        if ( mNotZero( pJoint->GetLocalAnchorB().LengthSquared() ) )
+                            pJointNode->addField( jointLocalAnchorBName, pJoint->GetLocalAnchorB() );
+
+                        // Add scene object bodies.
+                        if ( pSceneObjectA != NULL )
+                            pJointNode->addNode( pSceneObjectA );
+
+                        if ( pSceneObjectB != NULL )
+                            pJointNode->addNode( pSceneObjectB );
+                    }
+                    break;
+
+                case e_wheelJoint:
+                    {
+                        // Set joint name.
+                        pJointNode->setNodeName( jointWheelNodeName );
+
+                        // Fetch joint.
+                        b2WheelJoint* pJoint = dynamic_cast<b2WheelJoint*>( pBaseJoint );
+
+                        // Sanity!
+                        AssertFatal( pJoint != NULL, "Scene::onTamlCustomWrite() - Invalid wheel joint type returned." );
+
+                        // Add motor.
+                        if ( pJoint->IsMotorEnabled() )
+                        {
+                            // Add motor.
+                            pJointNode->addField( jointWheelMotorSpeedName, mRadToDeg(pJoint->GetMotorSpeed()) );
+                            pJointNode->addField( jointWheelMotorMaxTorqueName, pJoint->GetMaxMotorTorque() );
+                        }
+
+                        // Add frequency.
+                        if ( mNotZero( pJoint->GetSpringFrequencyHz() ) )
+                            pJointNode->addField( jointWheelFrequencyName, pJoint->GetSpringFrequencyHz() );
+
+                        // Add damping ratio.
+                        if ( mNotZero( pJoint->GetSpringDampingRatio() ) )
+                            pJointNode->addField( jointWheelDampingRatioName, pJoint->GetSpringDampingRatio() );
+
+                        // Add world axis.
+                        pJointNode->addField( jointWheelWorldAxisName, pJoint->GetBodyA()->GetWorldVector( pJoint->GetLocalAxisA() ) );
+
+                        // Add local anchors.
+                        pJointNode->addField( jointLocalAnchorAName, pJoint->GetLocalAnchorA() );
+                        pJointNode->addField( jointLocalAnchorBName, pJoint->GetLocalAnchorB() );
+
+                        // Add scene object bodies.
+                        if ( pSceneObjectA != NULL )
+                            pJointNode->addNode( pSceneObjectA );
+
+                        if ( pSceneObjectB != NULL )
+                            pJointNode->addNode( pSceneObjectB );
+                    }
+                    break;
+
+                case e_frictionJoint:
+                    {
+                        // Set joint name.
+                        pJointNode->setNodeName( jointFrictionNodeName );
+
+                        // Fetch joint.
+                        const b2FrictionJoint* pJoint = dynamic_cast<const b2FrictionJoint*>( pBaseJoint );
+
+                        // Add max force.
+                        if ( mNotZero( pJoint->GetMaxForce() ) )
+                            pJointNode->addField( jointFrictionMaxForceName, pJoint->GetMaxForce() );
+
+                        // Add max torque.
+                        if ( mNotZero( pJoint->GetMaxTorque() ) )
+                            pJointNode->addField( jointFrictionMaxTorqueName, pJoint->GetMaxTorque() );
+
+                        // Sanity!
+                        AssertFatal( pJoint != NULL, "Scene::onTamlCustomWrite() - Invalid friction joint type returned." );
+
+                        // Add local anchors.
+                        if ( mNotZero( pJoint->GetLocalAnchorA().LengthSquared() ) )
+                            pJointNode->addField( jointLocalAnchorAName, pJoint->GetLocalAnchorA() );
+                        if ( mNotZero( pJoint->GetLocalAnchorB().LengthSquared() ) )
+                            pJointNode->addField( jointLocalAnchorBName, pJoint->GetLocalAnchorB() );
+
+                        // Add scene object bodies.
+                        if ( pSceneObjectA != NULL )
+                            pJointNode->addNode( pSceneObjectA );
+
+                        if ( pSceneObjectB != NULL )
+                            pJointNode->addNode( pSceneObjectB );
+                    }
+                    break;
+
+                case e_prismaticJoint:
+                    {
+                        // Set joint name.
+                        pJointNode->setNodeName( jointPrismaticNodeName );
+
+                        // Fetch joint.
+                        b2PrismaticJoint* pJoint = dynamic_cast<b2PrismaticJoint*>( pBaseJoint );
+
+                        // Sanity!
+                        AssertFatal( pJoint != NULL, "Scene::onTamlCustomWrite() - Invalid prismatic joint type returned." );
+
+                        // Add limit.
+                        if ( pJoint->IsLimitEnabled() )
+                        {
+                            // Add limits.
+                            pJointNode->addField( jointPrismaticLimitLowerTransName, pJoint->GetLowerLimit() );
+                            pJointNode->addField( jointPrismaticLimitUpperTransName, pJoint->GetUpperLimit() );
+                        }
+
+                        // Add motor.
+                        if ( pJoint->IsMotorEnabled() )
+                        {
+                            // Add motor.
+                            pJointNode->addField( jointPrismaticMotorSpeedName, mRadToDeg(pJoint->GetMotorSpeed()) );
+                            pJointNode->addField( jointPrismaticMotorMaxForceName, pJoint->GetMaxMotorForce() );
+                        }
+
+                        // Add world axis.
+                        pJointNode->addField( jointPrismaticWorldAxisName, pJoint->GetBodyA()->GetWorldVector( pJoint->GetLocalAxisA() ) );
+
+                        // Add local anchors.
+                        pJointNode->addField( jointLocalAnchorAName, pJoint->GetLocalAnchorA() );
+                        pJointNode->addField( jointLocalAnchorBName, pJoint->GetLocalAnchorB() );
+
+                        // Add scene object bodies.
+                        if ( pSceneObjectA != NULL )
+                            pJointNode->addNode( pSceneObjectA );
+
+                        if ( pSceneObjectB != NULL )
+                            pJointNode->addNode( pSceneObjectB );
+                    }
+                    break;
+
+                case e_pulleyJoint:
+                    {
+                        // Set joint name.
+                        pJointNode->setNodeName( jointPulleyNodeName );
+
+                        // Fetch joint.
+                        b2PulleyJoint* pJoint = dynamic_cast<b2PulleyJoint*>( pBaseJoint );
+
+                        // Sanity!
+                        AssertFatal( pJoint != NULL, "Scene::onTamlCustomWrite() - Invalid pulley joint type returned." );
+
+                        // Add lengths.
+                        pJointNode->addField( jointPulleyLengthAName, pJoint->GetLengthA() );
+                        pJointNode->addField( jointPulleyLengthBName, pJoint->GetLengthB() );
+
+                        // Add ratio,
+                        pJointNode->addField( jointPulleyRatioName, pJoint->GetRatio() );
+
+                        // Add ground anchors.
+                        pJointNode->addField( jointPulleyGroundAnchorAName, pJoint->GetGroundAnchorA() );
+                        pJointNode->addField( jointPulleyGroundAnchorBName, pJoint->GetGroundAnchorB() );
+
+                        // Add local anchors.
+                        pJointNode->addField( jointLocalAnchorAName, pJoint->GetBodyA()->GetLocalPoint( pJoint->GetAnchorA() ) );
+                        pJointNode->addField( jointLocalAnchorBName, pJoint->GetBodyB()->GetLocalPoint( pJoint->GetAnchorB() ) );
+
+                        // Add scene object bodies.
+                        if ( pSceneObjectA != NULL )
+                            pJointNode->addNode( pSceneObjectA );
+
+                        if ( pSceneObjectB != NULL )
+                            pJointNode->addNode( pSceneObjectB );
+                    }
+                    break;
+
+                case e_mouseJoint:
+                    {
+                        // Set joint name.
+                        pJointNode->setNodeName( jointTargetNodeName );
+
+                        // Fetch joint.
+                        const b2MouseJoint* pJoint = dynamic_cast<const b2MouseJoint*>( pBaseJoint );
+
+                        // Sanity!
+                        AssertFatal( pJoint != NULL, "Scene::onTamlCustomWrite() - Invalid target joint type returned." );
+
+                        // Add target.
+                        pJointNode->addField( jointTargetWorldTargetName, pJoint->GetTarget() );
+
+                        // Add max force.
+                        pJointNode->addField( jointTargetMaxForceName, pJoint->GetMaxForce() );
+
+                        // Add frequency
+                        pJointNode->addField( jointTargetFrequencyName, pJoint->GetFrequency() );
+
+                        // Add damping ratio.
+                        pJointNode->addField( jointTargetDampingRatioName, pJoint->GetDampingRatio() );
+
+                        // Add body.
+                        // NOTE: This joint uses BODYB as the object, BODYA is the ground-body however for easy of use
+                        // we'll refer to this as OBJECTA in the persisted format.
+                        if ( pSceneObjectB != NULL )
+                            pJointNode->addNode( pSceneObjectB );
+                    }
+                    break;
+
+                case e_motorJoint:
+                    {
+                        // Set joint name.
+                        pJointNode->setNodeName( jointMotorNodeName );
+
+                        // Fetch joint.
+                        const b2MotorJoint* pJoint = dynamic_cast<const b2MotorJoint*>( pBaseJoint );
+
+                        // Sanity!
+                        AssertFatal( pJoint != NULL, "Scene::onTamlCustomWrite() - Invalid motor joint type returned." );
+
+                        // Add linear offset.
+                        if ( mNotZero( pJoint->GetLinearOffset().LengthSquared() ) )
+                            pJointNode->addField( jointMotorLinearOffsetName, pJoint->GetLinearOffset() );
+
+                        // Add angular offset.
+                        if ( mNotZero( pJoint->GetAngularOffset() ) )
+                            pJointNode->addField( jointMotorAngularOffsetName, mRadToDeg( pJoint->GetAngularOffset() ) );
+
+                        // Add max force.
+                        pJointNode->addField( jointMotorMaxForceName, pJoint->GetMaxForce() );
+
+                        // Add max torque.
+                        pJointNode->addField( jointMotorMaxTorqueName, pJoint->GetMaxTorque() );
+
+                        // Add correction factor.
+                        pJointNode->addField( jointMotorCorrectionFactorName, pJoint->GetCorrectionFactor() );
+
+                        // Add scene object bodies.
+                        if ( pSceneObjectA != NULL )
+                            pJointNode->addNode( pSceneObjectA );
+
+                        if ( pSceneObjectB != NULL )
+                            pJointNode->addNode( pSceneObjectB );
+                    }
+                    break;
+
+            default:
+                // Sanity!
+                AssertFatal( false, "Scene::onTamlCustomWrite() - Unknown joint type detected." );
+            }
+
+            // Add collide connected flag.
+            if ( pBaseJoint->GetCollideConnected() )
+                pJointNode->addField( jointCollideConnectedName, pBaseJoint->GetCollideConnected() );
+        }
+    }
+
+    // Fetch controller count.
+    const S32 sceneControllerCount = getControllers() ? getControllers()->size() : 0;
+    
+    // Do we have any scene controllers?
+    if ( sceneControllerCount > 0 )
+    {
+        // Yes, so add controller node.
+        TamlCustomNode* pControllerCustomNode = customNodes.addNode( controllerCustomNodeName );
+
+        // Fetch the scene controllers.
+        SimSet* pControllerSet = getControllers();
+
+        // Iterate scene controllers.
+        for( S32 i = 0; i < sceneControllerCount; i++ )
+        {
+            // Fetch the set object.
+            SimObject* pSetObject = pControllerSet->at(i);
+
+            // Skip if not a controller.
+            if ( !pSetObject->isType<SceneController*>() )
+                continue;
+
+            // Add controller node.
+            pControllerCustomNode->addNode( pSetObject );
+        }
+    }
+
+    // Fetch asset preload count.
+    const S32 assetPreloadCount = getAssetPreloadCount() + getPendingAssetPreloadCount();
+
+    // Do we have any asset preloads?
+    if ( assetPreloadCount > 0 )
+    {
+        // Yes, so fetch asset Id type prefix.
+        StringTableEntry assetIdTypePrefix = ConsoleBaseType::getType( TypeAssetId )->getTypePrefix();
+
+        // Add asset preload node.
+        TamlCustomNode* pAssetPreloadCustomNode = customNodes.addNode( assetPreloadNodeName );
+
+        // Iterate asset preloads.
+        for( typeAssetPtrVector::const_iterator assetItr = mAssetPreloads.begin(); assetItr != mAssetPreloads.end(); ++assetItr )
+        {
+            // Add node.
+            TamlCustomNode* pAssetNode = pAssetPreloadCustomNode->addNode( assetNodeName );
+
+            char valueBuffer[1024];
+            dSprintf( valueBuffer, sizeof(valueBuffer), "%s%s", assetIdTypePrefix, (*assetItr)->getAssetId() );
+
+            // Add asset Id.
+            pAssetNode->addField( "Id", valueBuffer );
+        }        
+
+        // Iterate pending asset preloads.
+        for( typePendingAssetPreloadVector::const_iterator pendingItr = mPendingAssetPreloads.begin(); pendingItr != mPendingAssetPreloads.end(); ++pendingItr )
+        {
+            // Add node.
+            TamlCustomNode* pAssetNode = pAssetPreloadCustomNode->addNode( assetNodeName );
+
+            char valueBuffer[1024];
+            dSprintf( valueBuffer, sizeof(valueBuffer), "%s%s", assetIdTypePrefix, pendingItr->mAssetId );
+
+            // Add asset Id.
+            pAssetNode->addField( "Id", valueBuffer );
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::onTamlCustomRead( const TamlCustomNodes& customNodes )
+{
+    // Call parent.
+    Parent::onTamlCustomRead( customNodes );
+}
+
+//-----------------------------------------------------------------------------
+
+U32 Scene::getGlobalSceneCount( void )
+{
+    return sSceneCount;
+}
+
+//-----------------------------------------------------------------------------
+
+SceneRenderRequest* Scene::createDefaultRenderRequest( SceneRenderQueue* pSceneRenderQueue, SceneObject* pSceneObject )
+{
+    // Create a render request and populate it with the default details.
+    SceneRenderRequest* pSceneRenderRequest = pSceneRenderQueue->createRenderRequest()->set(
+        pSceneObject,
+        pSceneObject->getRenderPosition(),
+        pSceneObject->getSceneLayerDepth(),
+        pSceneObject->getSortPoint(),
+        pSceneObject->getSerialId(),
+        pSceneObject->getRenderGroup() );
+
+    // Prepare the blending for it.
+    pSceneRenderRequest->mBlendMode = pSceneObject->getBlendMode();
+    pSceneRenderRequest->mBlendColor = pSceneObject->getBlendColor();
+    pSceneRenderRequest->mSrcBlendFactor = pSceneObject->getSrcBlendFactor();
+    pSceneRenderRequest->mDstBlendFactor = pSceneObject->getDstBlendFactor();
+    pSceneRenderRequest->mAlphaTest = pSceneObject->getAlphaTest();
+
+    return pSceneRenderRequest;
+}
+
+//-----------------------------------------------------------------------------
+
+SimObject* Scene::getTamlChild( const U32 childIndex ) const
+{
+    // Sanity!
+    AssertFatal( childIndex < (U32)mSceneObjects.size(), "Scene::getTamlChild() - Child index is out of range." );
+
+    // For when the assert is not used.
+    if ( childIndex >= (U32)mSceneObjects.size() )
+        return NULL;
+
+    return mSceneObjects[ childIndex ];
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::addTamlChild( SimObject* pSimObject )
+{
+    // Sanity!
+    AssertFatal( pSimObject != NULL, "Scene::addTamlChild() - Cannot add a NULL child object." );
+
+    // Fetch as a scene object.
+    SceneObject* pSceneObject = dynamic_cast<SceneObject*>( pSimObject );
+
+    // Is it a scene object?
+    if ( pSceneObject == NULL )
+    {
+        // No, so warn.
+        Con::warnf( "Scene::addTamlChild() - Cannot add a child object that isn't a scene object." );
+        return;
+    }
+
+    // Add the scene object.
+    addToScene( pSceneObject );
+}
+
+//-----------------------------------------------------------------------------
+
+static EnumTable::Enums DebugOptionsLookup[] =
+                {
+                { Scene::SCENE_DEBUG_METRICS,           "metrics" },
+                { Scene::SCENE_DEBUG_FPS_METRICS,       "fps" },
+                { Scene::SCENE_DEBUG_CONTROLLERS,       "controllers" },
+                { Scene::SCENE_DEBUG_JOINTS,            "joints" },
+                { Scene::SCENE_DEBUG_WIREFRAME_RENDER,  "wireframe" },
+                ///
+                { Scene::SCENE_DEBUG_AABB,              "aabb" },
+                { Scene::SCENE_DEBUG_OOBB,              "oobb" },
+                { Scene::SCENE_DEBUG_SLEEP,             "sleep" },
+                { Scene::SCENE_DEBUG_COLLISION_SHAPES,  "collision" },
+                { Scene::SCENE_DEBUG_POSITION_AND_COM,  "position" },
+                { Scene::SCENE_DEBUG_SORT_POINTS,       "sort" },
+                };
+
+//-----------------------------------------------------------------------------
+
+Scene::DebugOption Scene::getDebugOptionEnum(const char* label)
+{
+    // Search for Mnemonic.
+    for(U32 i = 0; i < (sizeof(DebugOptionsLookup) / sizeof(EnumTable::Enums)); i++)
+        if( dStricmp(DebugOptionsLookup[i].label, label) == 0)
+            return((Scene::DebugOption)DebugOptionsLookup[i].index);
+
+    // Warn.
+    Con::warnf( "Scene::getDebugOptionEnum() - Invalid debug option '%s'.", label );
+
+    return Scene::SCENE_DEBUG_INVALID;
+}
+
+//-----------------------------------------------------------------------------
+
+const char* Scene::getDebugOptionDescription( Scene::DebugOption debugOption )
+{
+    // Search for Mnemonic.
+    for (U32 i = 0; i < (sizeof(DebugOptionsLookup) / sizeof(EnumTable::Enums)); i++)
+    {
+        if( DebugOptionsLookup[i].index == debugOption )
+            return DebugOptionsLookup[i].label;
+    }
+
+    // Warn.
+    Con::warnf( "Scene::getDebugOptionDescription() - Invalid debug option." );
+
+    return StringTable->EmptyString;
+}
+
+//-----------------------------------------------------------------------------
+
+static EnumTable::Enums TickPhaseLookup[] =
+                {
+                { DebugStats::TICK_PHASE_DELETE_REQUESTS,   "deletes" },
+                { DebugStats::TICK_PHASE_PRE_INTEGRATE,     "preintegrate" },
+                { DebugStats::TICK_PHASE_CONTROLLERS,       "controllers" },
+                { DebugStats::TICK_PHASE_WORLD_STEP,        "worldstep" },
+                { DebugStats::TICK_PHASE_INTEGRATE,         "integrate" },
+                { DebugStats::TICK_PHASE_CONTACT_DISPATCH,  "contacts" },
+                };
+
+//-----------------------------------------------------------------------------
+
+DebugStats::TickPhase Scene::getTickPhaseEnum(const char* label)
+{
+    // Search for Mnemonic.
+    for(U32 i = 0; i < (sizeof(TickPhaseLookup) / sizeof(EnumTable::Enums)); i++)
+        if( dStricmp(TickPhaseLookup[i].label, label) == 0)
+            return((DebugStats::TickPhase)TickPhaseLookup[i].index);
+
+    // Warn.
+    Con::warnf( "Scene::getTickPhaseEnum() - Invalid tick phase '%s'.", label );
+
+    return DebugStats::TICK_PHASE_INVALID;
+}
+
+//-----------------------------------------------------------------------------
+
+const char* Scene::getTickPhaseDescription( DebugStats::TickPhase tickPhase )
+{
+    // Search for Mnemonic.
+    for (U32 i = 0; i < (sizeof(TickPhaseLookup) / sizeof(EnumTable::Enums)); i++)
+    {
+        if( TickPhaseLookup[i].index == tickPhase )
+            return TickPhaseLookup[i].label;
+    }
+
+    // Warn.
+    Con::warnf( "Scene::getTickPhaseDescription() - Invalid tick phase." );
+
+    return StringTable->EmptyString;
+}
+
+//-----------------------------------------------------------------------------
+
+static EnumTable::Enums jointTypeLookup[] =
+                {
+                { e_distanceJoint,  "distance"  },
+                { e_ropeJoint,      "rope"      },
+                { e_revoluteJoint,  "revolute"  },
+                { e_weldJoint,      "weld"      },
+                { e_wheelJoint,     "wheel"     },
+                { e_frictionJoint,  "friction"  },
+                { e_prismaticJoint, "prismatic" },
+                { e_pulleyJoint,    "pulley"    },
+                { e_mouseJoint,     "target"    },
+                { e_motorJoint,     "motor"     },
+                };
+
+EnumTable jointTypeTable(sizeof(jointTypeLookup) / sizeof(EnumTable::Enums), &jointTypeLookup[0]);
+
+//-----------------------------------------------------------------------------
+
+const char* Scene::getJointTypeDescription( b2JointType jointType )
+{
+    // Search for Mnemonic.
+    for (U32 i = 0; i < (sizeof(jointTypeLookup) / sizeof(EnumTable::Enums)); i++)
+    {
+        if( jointTypeLookup[i].index == jointType )
+            return jointTypeLookup[i].label;
+    }
+
+    // Warn.
+    Con::warnf( "Scene::getJointTypeDescription() - Invalid joint type." );
+
+    return StringTable->EmptyString;
+}
+
+//-----------------------------------------------------------------------------
+
+b2JointType Scene::getJointTypeEnum(const char* label)
+{
+    // Search for Mnemonic.
+    for (U32 i = 0; i < (sizeof(jointTypeLookup) / sizeof(EnumTable::Enums)); i++)
+    {
+        if( dStricmp(jointTypeLookup[i].label, label) == 0)
+            return (b2JointType)jointTypeLookup[i].index;
+    }
+
+    // Warn.
+    Con::warnf( "Scene::getJointTypeEnum() - Invalid joint of '%s'", label );
+
+    return e_unknownJoint;
+}
+
+//-----------------------------------------------------------------------------
+
+static EnumTable::Enums pickModeLookup[] =
+                {
+                { Scene::PICK_ANY,          "Any" },
+                { Scene::PICK_AABB,         "AABB" },
+                { Scene::PICK_OOBB,         "OOBB" },
+                { Scene::PICK_COLLISION,    "Collision" },
+                };
+
+//-----------------------------------------------------------------------------
+
+Scene::PickMode Scene::getPickModeEnum(const char* label)
+{
+    // Search for Mnemonic.
+    for(U32 i = 0; i < (sizeof(pickModeLookup) / sizeof(EnumTable::Enums)); i++)
+        if( dStricmp(pickModeLookup[i].label, label) == 0)
+            return((Scene::PickMode)pickModeLookup[i].index);
+
+    // Warn.
+    Con::warnf( "Scene::getPickModeEnum() - Invalid pick mode '%s'.", label );
+
+    return Scene::PICK_INVALID;
+}
+
+//-----------------------------------------------------------------------------
+
+const char* Scene::getPickModeDescription( Scene::PickMode pickMode )
+{
+    // Search for Mnemonic.
+    for (U32 i = 0; i < (sizeof(pickModeLookup) / sizeof(EnumTable::Enums)); i++)
+    {
+        if( pickModeLookup[i].index == pickMode )
+            return pickModeLookup[i].label;
+    }
+
+    // Warn.
+    Con::warnf( "Scene::getPickModeDescription() - Invalid pick mode.");
+
+    return StringTable->EmptyString;
+}
+
+//-----------------------------------------------------------------------------
+
+static void WriteJointsCustomTamlScehema( const AbstractClassRep* pClassRep, TiXmlElement* pParentElement )
+{
+    // Sanity!
+    AssertFatal( pClassRep != NULL,  "Taml::WriteJointsCustomTamlScehema() - ClassRep cannot be NULL." );
+    AssertFatal( pParentElement != NULL,  "Taml::WriteJointsCustomTamlScehema() - Parent Element cannot be NULL." );
+
+    char buffer[1024];
+
+    // Create joints node element.
+    TiXmlElement* pJointsNodeElement = new TiXmlElement( "xs:element" );
+    dSprintf( buffer, sizeof(buffer), "%s.%s", pClassRep->getClassName(), jointCustomNodeName );
+    pJointsNodeElement->SetAttribute( "name", buffer );
+    pJointsNodeElement->SetAttribute( "minOccurs", 0 );
+    pJointsNodeElement->SetAttribute( "maxOccurs", 1 );
+    pParentElement->LinkEndChild( pJointsNodeElement );
+    
+    // Create complex type.
+    TiXmlElement* pJointsNodeComplexTypeElement = new TiXmlElement( "xs:complexType" );
+    pJointsNodeElement->LinkEndChild( pJointsNodeComplexTypeElement );
+    
+    // Create choice element.
+    TiXmlElement* pJointsNodeChoiceElement = new TiXmlElement( "xs:choice" );
+    pJointsNodeChoiceElement->SetAttribute( "minOccurs", 0 );
+    pJointsNodeChoiceElement->SetAttribute( "maxOccurs", "unbounded" );
+    pJointsNodeComplexTypeElement->LinkEndChild( pJointsNodeChoiceElement );
+
+    // ********************************************************************************
+    // Create Distance Joint Element.
+    // ********************************************************************************
+    TiXmlElement* pDistanceJointElement = new TiXmlElement( "xs:element" );
+    pDistanceJointElement->SetAttribute( "name", jointDistanceNodeName );
+    pDistanceJointElement->SetAttribute( "minOccurs", 0 );
+    pDistanceJointElement->SetAttribute( "maxOccurs", 1 );
+    pJointsNodeChoiceElement->LinkEndChild( pDistanceJointElement );
+
+    // Create complex type Element.
+    TiXmlElement* pDistanceJointComplexTypeElement = new TiXmlElement( "xs:complexType" );
+    pDistanceJointElement->LinkEndChild( pDistanceJointComplexTypeElement );
+
+    // Create "Length" attribute.
+    TiXmlElement* pDistanceJointElementA = new TiXmlElement( "xs:attribute" );
+    pDistanceJointElementA->SetAttribute( "name", jointDistanceLengthName );
+    pDistanceJointComplexTypeElement->LinkEndChild( pDistanceJointElementA );
+    TiXmlElement* pDistanceJointElementB = new TiXmlElement( "xs:simpleType" );
+    pDistanceJointElementA->LinkEndChild( pDistanceJointElementB );
+    TiXmlElement* pDistanceJointElementC = new TiXmlElement( "xs:restriction" );
+    pDistanceJointElementC->SetAttribute( "base", "xs:float" );
+    pDistanceJointElementB->LinkEndChild( pDistanceJointElementC );
+    TiXmlElement* pDistanceJointElementD = new TiXmlElement( "xs:minInclusive" );
+    pDistanceJointElementD->SetAttribute( "value", "0" );
+    pDistanceJointElementC->LinkEndChild( pDistanceJointElementD );
+
+    // Create "Frequency" attribute.
+    pDistanceJointElementA = new TiXmlElement( "xs:attribute" );
+    pDistanceJointElementA->SetAttribute( "name", jointDistanceFrequencyName );
+    pDistanceJointComplexTypeElement->LinkEndChild( pDistanceJointElementA );
+    pDistanceJointElementB = new TiXmlElement( "xs:simpleType" );
+    pDistanceJointElementA->LinkEndChild( pDistanceJointElementB );
+    pDistanceJointElementC = new TiXmlElement( "xs:restriction" );
+    pDistanceJointElementC->SetAttribute( "base", "xs:float" );
+    pDistanceJointElementB->LinkEndChild( pDistanceJointElementC );
+    pDistanceJointElementD = new TiXmlElement( "xs:minInclusive" );
+    pDistanceJointElementD->SetAttribute( "value", "0" );
+    pDistanceJointElementC->LinkEndChild( pDistanceJointElementD );
+
+    // Create "Damping Ratio" attribute.
+    pDistanceJointElementA = new TiXmlElement( "xs:attribute" );
+    pDistanceJointElementA->SetAttribute( "name", jointDistanceDampingRatioName );
+    pDistanceJointComplexTypeElement->LinkEndChild( pDistanceJointElementA );
+    pDistanceJointElementB = new TiXmlElement( "xs:simpleType" );
+    pDistanceJointElementA->LinkEndChild( pDistanceJointElementB );
+    pDistanceJointElementC = new TiXmlElement( "xs:restriction" );
+    pDistanceJointElementC->SetAttribute( "base", "xs:float" );
+    pDistanceJointElementB->LinkEndChild( pDistanceJointElementC );
+    pDistanceJointElementD = new TiXmlElement( "xs:minInclusive" );
+    pDistanceJointElementD->SetAttribute( "value", "0" );
+    pDistanceJointElementC->LinkEndChild( pDistanceJointElementD );
+}
+
+//-----------------------------------------------------------------------------
+
+static void WriteControllersCustomTamlScehema( const AbstractClassRep* pClassRep, TiXmlElement* pParentElement )
+{
+    // Sanity!
+    AssertFatal( pClassRep != NULL,  "Taml::WriteControllersCustomTamlScehema() - ClassRep cannot be NULL." );
+    AssertFatal( pParentElement != NULL,  "Taml::WriteControllersCustomTamlScehema() - Parent Element cannot be NULL." );
+
+    char buffer[1024];
+
+    // Create controllers node element.
+    TiXmlElement* pControllersNodeElement = new TiXmlElement( "xs:element" );
+    dSprintf( buffer, sizeof(buffer), "%s.%s", pClassRep->getClassName(), controllerCustomNodeName );
+    pControllersNodeElement->SetAttribute( "name", buffer );
+    pControllersNodeElement->SetAttribute( "minOccurs", 0 );
+    pControllersNodeElement->SetAttribute( "maxOccurs", 1 );
+    pParentElement->LinkEndChild( pControllersNodeElement );
+    
+    // Create complex type.
+    TiXmlElement* pControllersNodeComplexTypeElement = new TiXmlElement( "xs:complexType" );
+    pControllersNodeElement->LinkEndChild( pControllersNodeComplexTypeElement );
+    
+    // Create choice element.
+    TiXmlElement* pControllersNodeChoiceElement = new TiXmlElement( "xs:choice" );
+    pControllersNodeChoiceElement->SetAttribute( "minOccurs", 0 );
+    pControllersNodeChoiceElement->SetAttribute( "maxOccurs", "unbounded" );
+    pControllersNodeComplexTypeElement->LinkEndChild( pControllersNodeChoiceElement );
+
+    // Fetch the scene controller type.
+    AbstractClassRep* pPickingSceneControllerType = AbstractClassRep::findClassRep( "PickingSceneController" );
+    AbstractClassRep* pGroupedSceneControllerType = AbstractClassRep::findClassRep( "GroupedSceneController" );
+
+    // Sanity!
+    AssertFatal( pPickingSceneControllerType != NULL, "Scene::WriteControllersCustomTamlScehema() - Cannot find the PickingSceneController type." );
+    AssertFatal( pGroupedSceneControllerType != NULL, "Scene::WriteControllersCustomTamlScehema() - Cannot find the GroupedSceneController type." );
+
+    // Add choice members.
+    for ( AbstractClassRep* pChoiceType = AbstractClassRep::getClassList(); pChoiceType != NULL; pChoiceType = pChoiceType->getNextClass() )
+    {
+        // Skip if not derived from either of the scene controllers.
+        if ( !pChoiceType->isClass( pPickingSceneControllerType ) && !pChoiceType->isClass( pGroupedSceneControllerType ) )
+            continue;
+
+        // Add choice member.
+        TiXmlElement* pChoiceMemberElement = new TiXmlElement( "xs:element" );
+        pChoiceMemberElement->SetAttribute( "name", pChoiceType->getClassName() );
+        dSprintf( buffer, sizeof(buffer), "%s_Type", pChoiceType->getClassName() );
+        pChoiceMemberElement->SetAttribute( "type", buffer );
+        pControllersNodeChoiceElement->LinkEndChild( pChoiceMemberElement );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static void WritePreloadsCustomTamlScehema( const AbstractClassRep* pClassRep, TiXmlElement* pParentElement )
+{
+    // Sanity!
+    AssertFatal( pClassRep != NULL,  "Taml::WritePreloadsCustomTamlScehema() - ClassRep cannot be NULL." );
+    AssertFatal( pParentElement != NULL,  "Taml::WritePreloadsCustomTamlScehema() - Parent Element cannot be NULL." );
+
+    char buffer[1024];
+
+    // Create preloads node element.
+    TiXmlElement* pPreloadsNodeElement = new TiXmlElement( "xs:element" );
+    dSprintf( buffer, sizeof(buffer), "%s.%s", pClassRep->getClassName(), assetPreloadNodeName );
+    pPreloadsNodeElement->SetAttribute( "name", buffer );
+    pPreloadsNodeElement->SetAttribute( "minOccurs", 0 );
+    pPreloadsNodeElement->SetAttribute( "maxOccurs", 1 );
+    pParentElement->LinkEndChild( pPreloadsNodeElement );
+    
+    // Create complex type.
+    TiXmlElement* pPreloadsNodeComplexTypeElement = new TiXmlElement( "xs:complexType" );
+    pPreloadsNodeElement->LinkEndChild( pPreloadsNodeComplexTypeElement );
+    
+    // Create choice element.
+    TiXmlElement* pPreloadsNodeChoiceElement = new TiXmlElement( "xs:choice" );
+    pPreloadsNodeChoiceElement->SetAttribute( "minOccurs", 0 );
+    pPreloadsNodeChoiceElement->SetAttribute( "maxOccurs", "unbounded" );
+    pPreloadsNodeComplexTypeElement->LinkEndChild( pPreloadsNodeChoiceElement );
+
+    // Add choice member element.
+    TiXmlElement* pChoiceMemberElement = new TiXmlElement( "xs:element" );
+    pChoiceMemberElement->SetAttribute( "name", assetNodeName );
+    pPreloadsNodeChoiceElement->LinkEndChild( pChoiceMemberElement );
+
+    // Add choice member complex type element.
+    TiXmlElement* pChoiceMemberComplexTypeElement = new TiXmlElement( "xs:complexType" );
+    pChoiceMemberElement->LinkEndChild( pChoiceMemberComplexTypeElement );
+
+    // Add choice member attribute element.
+    TiXmlElement* pChoiceAttributeElement = new TiXmlElement( "xs:attribute" );
+    pChoiceAttributeElement->SetAttribute( "name", "Id" );
+    dSprintf( buffer, sizeof(buffer), "%s", "AssetId_ConsoleType" );
+    pChoiceAttributeElement->SetAttribute( "type", buffer );
+    pChoiceMemberComplexTypeElement->LinkEndChild( pChoiceAttributeElement );
+}
+
+//-----------------------------------------------------------------------------
+
+static void WriteCustomTamlSchema( const AbstractClassRep* pClassRep, TiXmlElement* pParentElement )
+{
+    // Sanity!
+    AssertFatal( pClassRep != NULL,  "Taml::WriteCustomTamlSchema() - ClassRep cannot be NULL." );
+    AssertFatal( pParentElement != NULL,  "Taml::WriteCustomTamlSchema() - Parent Element cannot be NULL." );
+
+    WriteJointsCustomTamlScehema( pClassRep, pParentElement );
+    WriteControllersCustomTamlScehema( pClassRep, pParentElement );
+    WritePreloadsCustomTamlScehema( pClassRep, pParentElement );
+}
+
+//------------------------------------------------------------------------------
+
+IMPLEMENT_CONOBJECT_CHILDREN_SCHEMA(Scene, WriteCustomTamlSchema);
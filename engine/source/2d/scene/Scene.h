@@ -47,6 +47,18 @@
 #include "2d/scene/WorldQuery.h"
 #endif
 
+#ifndef _SCENE_TRANSFORM_STORE_H_
+#include "2d/scene/SceneTransformStore.h"
+#endif
+
+#ifndef _SCENE_CALLBACK_QUEUE_H_
+#include "2d/scene/SceneCallbackQueue.h"
+#endif
+
+#ifndef _SCENE_POOL_H_
+#include "2d/scene/ScenePool.h"
+#endif
+
 #ifndef _DEBUG_DRAW_H_
 #include "2d/scene/DebugDraw.h"
 #endif
@@ -75,6 +87,10 @@
 #include "assets/assetPtr.h"
 #endif
 
+#ifndef _PARTICLE_SYSTEM_H_
+#include "2d/core/ParticleSystem.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 extern EnumTable jointTypeTable;
@@ -83,6 +99,9 @@ extern EnumTable jointTypeTable;
 
 class SceneObject;
 class SceneWindow;
+class ParticlePlayer;
+class AudioEmitter;
+class SkeletonObject;
 
 ///-----------------------------------------------------------------------------
 
@@ -157,12 +176,18 @@ struct TickContact
 
 ///-----------------------------------------------------------------------------
 
+/// Number of frames a static layer must remain unchanged before its render output is cached.
+#define SCENE_LAYER_CACHE_SETTLE_FRAMES     2
+
+///-----------------------------------------------------------------------------
+
 class Scene :
     public BehaviorComponent,
     public TamlChildren,
     public PhysicsProxy,
     public b2ContactListener,
     public b2DestructionListener,
+    public b2ParallelExecutor,
     public virtual Tickable
 {
 public:
@@ -170,9 +195,17 @@ public:
     typedef HashMap<b2Joint*, S32>              typeReverseJointHash;
     typedef Vector<tDeleteRequest>              typeDeleteVector;
     typedef Vector<TickContact>                 typeContactVector;
-    typedef HashMap<b2Contact*, TickContact>    typeContactHash;
+    typedef HashMap<b2Contact*, U32>            typeContactIndexHash;
     typedef Vector<AssetPtr<AssetBase>*>        typeAssetPtrVector;
 
+    /// An asset preload still being acquired asynchronously.
+    struct PendingAssetPreload
+    {
+        StringTableEntry    mAssetId;
+        U32                 mAcquireId;
+    };
+    typedef Vector<PendingAssetPreload>         typePendingAssetPreloadVector;
+
     /// Scene Debug Options.
     enum DebugOption
     {
@@ -216,12 +249,54 @@ private:
     b2Vec2                      mWorldGravity;
     S32                         mVelocityIterations;
     S32                         mPositionIterations;
+    F32                         mPhysicsStepRate;
+    S32                         mMaxPhysicsSubSteps;
+    F32                         mPhysicsTimeAccumulator;
+    bool                        mBulkBroadPhase;
+    S32                         mTOIMaxSubSteps;
+    F32                         mTOIMaxTime;
+    bool                        mArenaAllocator;
+    F32                         mSpatialHashCellSize;
+    b2ArenaAllocator*           mpWorldAllocator;
     b2BlockAllocator            mBlockAllocator;
     b2Body*                     mpGroundBody;
 
+    /// Level arena.
+    Memory::Arena*              mpLevelArena;
+    Memory::Arena*              mpPreviousArena;
+
     /// Scene occupancy.
     typeSceneObjectVector       mSceneObjects;
+    typeSceneObjectVector       mTickableSceneObjects;
     typeSceneObjectVector       mTickedSceneObjects;
+    U32                         mEnabledSceneObjectCount;
+    U32                         mVisibleSceneObjectCount;
+    typeSceneObjectVector       mLayerSceneObjects[MAX_LAYERS_SUPPORTED];
+    typeSceneObjectVector       mGroupSceneObjects[MASK_BITCOUNT];
+
+    /// Particle players.
+    Vector<ParticlePlayer*>     mParticlePlayers;
+    Vector<ParticleSystem::EmitterIntegration> mEmitterIntegrations;
+
+    /// Skeleton objects.
+    Vector<SkeletonObject*>     mSkeletonObjects;
+    Vector<SkeletonObject*>     mSkeletonPoseUpdates;
+
+    /// Audio emitters.
+    Vector<AudioEmitter*>       mAudioEmitters;
+    Vector<AudioEmitter*>       mAudibleEmitters;
+    F32                         mAudioEmitterMaxRadius;
+    U32                         mAudioPass;
+    Vector2                     mAudioListenerPosition;
+    SimObjectPtr<SceneObject>   mAudioListenerObject;
+    typeWorldQueryResultVector  mAudioQueryResults;
+    Vector<U32>                 mAudioQueryOffsets;
+
+    /// Scene object spatials.
+    SceneTransformStore         mTransformStore;
+
+    /// Scene object pooling.
+    ScenePool                   mScenePool;
 
     /// Joint access.
     typeJointHash               mJoints;
@@ -233,6 +308,8 @@ private:
 
     /// Asset pre-loads.
     typeAssetPtrVector          mAssetPreloads;
+    typePendingAssetPreloadVector mPendingAssetPreloads;
+    bool                        mAsyncAssetPreloads;
 
     /// Scene time.
     F32                         mSceneTime;
@@ -246,8 +323,27 @@ private:
     /// Layer sorting and draw order.
     SceneRenderQueue::RenderSort mLayerSortModes[MAX_LAYERS_SUPPORTED];
 
+    /// Static layer render caching.
+    struct LayerRenderCache
+    {
+        BatchRenderCache            mBatchCache;
+        typeSceneObjectVector       mSceneObjects;
+        b2AABB                      mGuardAABB;
+        F32                         mRenderAngle;
+        U32                         mRenderGroupMask;
+        SceneRenderQueue::RenderSort mSortMode;
+        U32                         mRenderRequestCount;
+        U32                         mStableFrames;
+        bool                        mValid;
+        bool                        mUncacheable;
+    };
+    LayerRenderCache            mLayerRenderCaches[MAX_LAYERS_SUPPORTED];
+    U32                         mStaticLayerMask;
+    F32                         mLayerRenderCacheGuard;
+
     /// Batch rendering.
     BatchRender                 mBatchRenderer;
+    bool                        mBatchBreakDumpPending;
 
     /// Window rendering.
     SceneWindow*                mpCurrentRenderWindow;
@@ -255,6 +351,15 @@ private:
     /// Window attachments.
     SimSet                      mAttachedSceneWindows;
 
+    /// Visibility query shared by the windows viewing the scene in a frame.
+    typeWorldQueryResultVector  mViewQueryResults;
+    Vector<U32>                 mViewQueryOffsets;
+    Vector<b2AABB>              mViewQueryAABBs;
+    Vector<SimObject*>          mViewQueryHosts;
+    Vector<bool>                mViewQueryRendered;
+    F32                         mViewQueryTime;
+    bool                        mViewQueryValid;
+
     /// Delete requests.
     typeDeleteVector            mDeleteRequests;
     typeDeleteVector            mDeleteRequestsTemp;
@@ -263,8 +368,35 @@ private:
     S32                         mIsEditorScene;
     bool                        mUpdateCallback;
     bool                        mRenderCallback;
-    typeContactHash             mBeginContacts;
+    bool                        mParallelTick;
+    bool                        mParallelControllers;
+    bool                        mParallelParticles;
+    bool                        mParallelSkeletons;
+    bool                        mParallelIslands;
+    bool                        mParallelContacts;
+    bool                        mParallelRender;
+    bool                        mDormantCulling;
+    bool                        mScheduledTick;
+
+    /// Lag compensation.
+    struct RewoundObject
+    {
+        SceneObject*            mpSceneObject;
+        b2Vec2                  mPosition;
+        F32                     mAngle;
+        Vector2                 mRenderOOBB[4];
+    };
+    F32                         mRewindTime;
+    F32                         mSnapshotDelay;
+    Vector<RewoundObject>       mRewoundObjects;
+    bool                        mRewound;
+    bool                        mTickActive;
+    typeContactVector           mBeginContacts;
+    typeContactIndexHash        mBeginContactIndices;
     typeContactVector           mEndContacts;
+    SceneCallbackQueue          mCallbackQueue;
+    SceneCallbackQueue          mContactCallbackQueue;
+    Vector<SimObjectId>         mPendingCallbackObjects;
     U32                         mSceneIndex;
 
 private:   
@@ -272,6 +404,44 @@ private:
     void                        forwardContacts( void );
     void                        dispatchBeginContactCallbacks( void );
     void                        dispatchEndContactCallbacks( void );
+    void                        queuePendingCallbacks( void );
+
+    /// Tickable scene objects.
+    bool                        isSceneObjectTickable( const SceneObject* pSceneObject ) const;
+    void                        updateTickableSceneObject( SceneObject* pSceneObject );
+    void                        removeTickableSceneObject( SceneObject* pSceneObject );
+    void                        refreshTickableSceneObjects( void );
+
+    /// Lag compensation.
+    void                        recordRewindHistory( void );
+
+    /// Parallel ticking.
+    static void                 parallelPreIntegrateSpatial( void* pContext, const U32 start, const U32 end );
+    static void                 parallelIntegrateSpatial( void* pContext, const U32 start, const U32 end );
+    static void                 parallelSolveIslands( void* pContext, const U32 start, const U32 end );
+    void                        integrateParticleEmitters( void );
+    void                        updateSkeletonPoses( void );
+    void                        updateAudioEmitters( void );
+    void                        updateWorldParallelism( void );
+
+    /// Static layer render caching.
+    void                        resolveLayerRenderCaches( const SceneRenderState* pSceneRenderState, SceneRenderState& captureRenderState, U32& cachedLayerMask, U32& captureLayerMask );
+    void                        renderLayerCache( const SceneRenderState* pSceneRenderState, const U32 layer );
+    void                        dumpBatchBreaks( const DebugStats* pDebugStats ) const;
+
+    /// Shared visibility query.
+    bool                        fetchViewQuery( const SceneRenderState* pSceneRenderState, const WorldQueryFilter& queryFilter, const b2AABB& queryAABB );
+    void                        buildViewQuery( void );
+    inline void                 invalidateViewQuery( void )                 { mViewQueryValid = false; }
+
+    /// Render request sorting.
+    static void                 parallelSortRenderQueues( void* pContext, const U32 start, const U32 end );
+    void                        sortRenderQueues( Vector<SceneRenderQueue*>& renderQueues, const U32 renderRequestCount );
+
+    /// World.
+    void                        createGroundBody( void );
+    void                        resetWorldAllocator( void );
+    void                        releaseLevelArena( void );
 
     /// Joint definition.
     struct CommonJointDefinition
@@ -316,14 +486,23 @@ public:
     virtual void            PostSolve( b2Contact* pContact, const b2ContactImpulse* pImpulse );
     virtual void            BeginContact( b2Contact* pContact );
     virtual void            EndContact( b2Contact* pContact );
-    const typeContactHash&  getBeginContacts( void ) const              { return mBeginContacts; }
+    const typeContactVector& getBeginContacts( void ) const             { return mBeginContacts; }
     const typeContactVector& getEndContacts( void ) const               { return mEndContacts; }
 
+    /// Island solving.
+    virtual void            ParallelFor( b2ParallelRangeCallback callback, void* context, int32 count );
+
     /// Integration.
     virtual void            processTick();
     virtual void            interpolateTick( F32 delta );
     virtual void            advanceTime( F32 timeDelta ) {};
 
+    /// Integration stages.
+    /// NOTE: "integratePhysicsTick()" only touches the scene's own world and contacts so it can run on a worker thread.
+    void                    preIntegrateTick( void );
+    void                    integratePhysicsTick( void );
+    void                    postIntegrateTick( void );
+
     /// Render output.
     void                    sceneRender( const SceneRenderState* pSceneRenderState );
 
@@ -332,6 +511,9 @@ public:
     inline WorldQuery*      getWorldQuery( const bool clearQuery = false ) { if ( clearQuery ) mpWorldQuery->clearQuery(); return mpWorldQuery; }
     b2BlockAllocator*       getBlockAllocator( void )                   { return &mBlockAllocator; }
     inline b2Body*          getGroundBody( void ) const                 { return mpGroundBody; }
+    inline SceneTransformStore& getTransformStore( void )               { return mTransformStore; }
+    inline const SceneTransformStore& getTransformStore( void ) const   { return mTransformStore; }
+    inline ScenePool&       getScenePool( void )                        { return mScenePool; }
     virtual ePhysicsProxyType getPhysicsProxyType( void ) const         { return PhysicsProxy::PHYSIC_PROXY_GROUNDBODY; }
     void                    setGravity( const b2Vec2& gravity )         { mWorldGravity = gravity; if (mpWorld) mpWorld->SetGravity( gravity ); }
     inline b2Vec2           getGravity( void )                          { if (mpWorld) mWorldGravity = mpWorld->GetGravity(); return mWorldGravity; }
@@ -339,6 +521,26 @@ public:
     inline S32              getVelocityIterations( void ) const         { return mVelocityIterations; }
     inline void             setPositionIterations( const S32 iterations ) { mPositionIterations = iterations; }
     inline S32              getPositionIterations( void ) const         { return mPositionIterations; }
+    void                    setPhysicsStepRate( const F32 stepRate );
+    inline F32              getPhysicsStepRate( void ) const            { return mPhysicsStepRate; }
+    inline void             setMaxPhysicsSubSteps( const S32 subSteps ) { mMaxPhysicsSubSteps = getMax( subSteps, 1 ); }
+    inline S32              getMaxPhysicsSubSteps( void ) const         { return mMaxPhysicsSubSteps; }
+    void                    setBulkBroadPhase( const bool bulk )        { mBulkBroadPhase = bulk; if (mpWorld) mpWorld->SetBulkBroadPhase( bulk ); }
+    inline bool             getBulkBroadPhase( void ) const             { return mBulkBroadPhase; }
+    void                    setTOIMaxSubSteps( const S32 subSteps )     { mTOIMaxSubSteps = getMax( subSteps, 0 ); if (mpWorld) mpWorld->SetTOIBudget( mTOIMaxSubSteps, mTOIMaxTime ); }
+    inline S32              getTOIMaxSubSteps( void ) const             { return mTOIMaxSubSteps; }
+    void                    setTOIMaxTime( const F32 maxTime )          { mTOIMaxTime = getMax( maxTime, 0.0f ); if (mpWorld) mpWorld->SetTOIBudget( mTOIMaxSubSteps, mTOIMaxTime ); }
+    inline F32              getTOIMaxTime( void ) const                 { return mTOIMaxTime; }
+    inline void             setArenaAllocator( const bool arena )       { mArenaAllocator = arena; }
+    inline bool             getArenaAllocator( void ) const             { return mArenaAllocator; }
+    inline void             setSpatialHashCellSize( const F32 cellSize ){ mSpatialHashCellSize = getMax( cellSize, 0.0f ); }
+    inline F32              getSpatialHashCellSize( void ) const        { return mSpatialHashCellSize; }
+
+    /// Physics snapshots.
+    /// NOTE: These are intended for rollback where the physics state is repeatedly restored and re-stepped.
+    U32                     getSnapshotSize( void ) const;
+    U32                     captureSnapshot( void* pBuffer, const U32 bufferSize ) const;
+    bool                    restoreSnapshot( const void* pBuffer, const U32 bufferSize );
 
     /// Scene occupancy.
     void                    clearScene( bool deleteObjects = true );
@@ -351,13 +553,46 @@ public:
     U32                     getSceneObjects( typeSceneObjectVector& objects ) const;
     U32                     getSceneObjects( typeSceneObjectVector& objects, const U32 sceneLayer ) const;
 
+    /// Scene objects by layer and group.
+    /// These are indexed as objects are added, removed or change layer or group so no query walks the whole scene.
+    inline typeSceneObjectVectorConstRef getLayerSceneObjects( const U32 sceneLayer ) const { return mLayerSceneObjects[sceneLayer]; }
+    inline typeSceneObjectVectorConstRef getGroupSceneObjects( const U32 sceneGroup ) const { return mGroupSceneObjects[sceneGroup]; }
+    U32                     querySceneObjects( typeSceneObjectVector& objects, const U32 sceneLayerMask, const U32 sceneGroupMask ) const;
+    void                    moveSceneObjectLayer( SceneObject* pSceneObject, const U32 sceneLayer );
+    void                    moveSceneObjectGroup( SceneObject* pSceneObject, const U32 sceneGroup );
+
     void                    mergeScene( const Scene* pScene );
 
+    /// Particle players.
+    void                    addParticlePlayer( ParticlePlayer* pParticlePlayer );
+    void                    removeParticlePlayer( ParticlePlayer* pParticlePlayer );
+
+    /// Skeleton objects.
+    void                    addSkeletonObject( SkeletonObject* pSkeletonObject );
+    void                    removeSkeletonObject( SkeletonObject* pSkeletonObject );
+
+    /// Audio emitters.
+    void                    addAudioEmitter( AudioEmitter* pAudioEmitter );
+    void                    removeAudioEmitter( AudioEmitter* pAudioEmitter );
+    inline void             updateAudioEmitterRadius( const F32 outerRadius ) { if ( outerRadius > mAudioEmitterMaxRadius ) mAudioEmitterMaxRadius = outerRadius; }
+    void                    setAudioListener( const Vector2& position );
+    void                    setAudioListener( SceneObject* pSceneObject );
+    SceneObject*            getAudioListenerObject( void ) const;
+    Vector2                 getAudioListenerPosition( void ) const;
+
+    /// Scene object state notifications.
+    void                    onSceneObjectEnabledChanged( SceneObject* pSceneObject );
+    void                    onSceneObjectVisibleChanged( SceneObject* pSceneObject );
+
     inline SimSet*			getControllers( void )						{ return mControllers; }
 
     inline S32              getAssetPreloadCount( void ) const          { return mAssetPreloads.size(); }
+    inline S32              getPendingAssetPreloadCount( void ) const   { return mPendingAssetPreloads.size(); }
     const AssetPtr<AssetBase>* getAssetPreload( const S32 index ) const;
-    void                    addAssetPreload( const char* pAssetId );
+    void                    addAssetPreload( const char* pAssetId, const bool async = false );
+    void                    processPendingAssetPreloads( void );
+    inline void             setAsyncAssetPreloads( const bool asyncAssetPreloads ) { mAsyncAssetPreloads = asyncAssetPreloads; }
+    inline bool             getAsyncAssetPreloads( void ) const         { return mAsyncAssetPreloads; }
     void                    removeAssetPreload( const char* pAssetId );
     void                    clearAssetPreloads( void );
 
@@ -636,6 +871,15 @@ public:
     void setLayerSortMode( const U32 layer, const SceneRenderQueue::RenderSort sortMode );
     SceneRenderQueue::RenderSort getLayerSortMode( const U32 layer );
 
+    /// Static layer render caching.
+    void                    setLayerStatic( const U32 layer, const bool isStatic );
+    bool                    getLayerStatic( const U32 layer ) const;
+    inline void             setStaticLayerMask( const U32 layerMask )   { mStaticLayerMask = layerMask; for ( U32 layer = 0; layer < MAX_LAYERS_SUPPORTED; ++layer ) invalidateLayerRenderCache( layer ); }
+    inline U32              getStaticLayerMask( void ) const            { return mStaticLayerMask; }
+    inline void             setLayerRenderCacheGuard( const F32 guard ) { mLayerRenderCacheGuard = getMax( guard, 0.0f ); }
+    inline F32              getLayerRenderCacheGuard( void ) const      { return mLayerRenderCacheGuard; }
+    inline void             invalidateLayerRenderCache( const U32 layer ) { LayerRenderCache& cache = mLayerRenderCaches[layer]; cache.mValid = false; cache.mUncacheable = false; cache.mStableFrames = 0; }
+
     /// Window attachments.
     void                    attachSceneWindow( SceneWindow* pSceneWindow2D );
     void                    detachSceneWindow( SceneWindow* pSceneWindow2D );
@@ -656,14 +900,53 @@ public:
     /// Miscellaneous.
     inline void             setBatchingEnabled( const bool enabled )    { mBatchRenderer.setBatchEnabled( enabled ); }
     inline bool             getBatchingEnabled( void ) const            { return mBatchRenderer.getBatchEnabled(); }
+    inline void             setBatchVertexBuffersEnabled( const bool enabled ) { mBatchRenderer.setVertexBufferEnabled( enabled ); }
+    inline bool             getBatchVertexBuffersEnabled( void ) const  { return mBatchRenderer.getVertexBufferEnabled(); }
+    inline void             requestBatchBreakDump( void )               { mBatchBreakDumpPending = true; }
+    inline const BatchRender::typeBatchBreakVector& getBatchBreaks( void ) const { return mBatchRenderer.getBatchBreaks(); }
     inline bool             getIsEditorScene( void ) const              { return ((mIsEditorScene > 0) ? true : false); }
-    inline void             setIsEditorScene( bool status )             { mIsEditorScene += (status ? 1 : -1); }
+    inline void             setIsEditorScene( bool status )             { mIsEditorScene += (status ? 1 : -1); refreshTickableSceneObjects(); }
     static U32              getGlobalSceneCount( void );
     inline U32              getSceneIndex( void ) const                 { return mSceneIndex; }
     inline void             setUpdateCallback( const bool callback )    { mUpdateCallback = callback; }
     inline bool             getUpdateCallback( void ) const             { return mUpdateCallback; }
     inline void             setRenderCallback( const bool callback )    { mRenderCallback = callback; }
     inline bool             getRenderCallback( void ) const             { return mRenderCallback; }
+    inline void             setParallelTick( const bool parallelTick )  { mParallelTick = parallelTick; }
+    inline bool             getParallelTick( void ) const               { return mParallelTick; }
+    inline void             setParallelControllers( const bool parallelControllers ) { mParallelControllers = parallelControllers; }
+    inline bool             getParallelControllers( void ) const        { return mParallelControllers; }
+    inline void             setParallelParticles( const bool parallelParticles ) { mParallelParticles = parallelParticles; }
+    inline bool             getParallelParticles( void ) const          { return mParallelParticles; }
+    inline void             setParallelSkeletons( const bool parallelSkeletons ) { mParallelSkeletons = parallelSkeletons; }
+    inline bool             getParallelSkeletons( void ) const          { return mParallelSkeletons; }
+    void                    setParallelIslands( const bool parallelIslands );
+    inline bool             getParallelIslands( void ) const            { return mParallelIslands; }
+    void                    setParallelContacts( const bool parallelContacts );
+    inline bool             getParallelContacts( void ) const           { return mParallelContacts; }
+    inline void             setParallelRender( const bool parallelRender ) { mParallelRender = parallelRender; }
+    inline bool             getParallelRender( void ) const             { return mParallelRender; }
+    inline void             setDormantCulling( const bool culling )     { mDormantCulling = culling; }
+    inline bool             getDormantCulling( void ) const             { return mDormantCulling; }
+
+    /// Lag compensation.
+    /// With a rewind time, the scene records the recent transforms of ticked objects.  Rewinding moves the
+    /// bodies and world query proxies (but not the rendering) to where they were at a past scene time so that
+    /// queries such as ray-casts test against what a remote client saw.  The rewind must be restored before
+    /// the scene next ticks.
+    inline void             setRewindTime( const F32 rewindTime )       { mRewindTime = getMax( rewindTime, 0.0f ); }
+    inline F32              getRewindTime( void ) const                 { return mRewindTime; }
+    inline void             setSnapshotDelay( const F32 snapshotDelay ) { mSnapshotDelay = getMax( snapshotDelay, 0.0f ); }
+    inline F32              getSnapshotDelay( void ) const              { return mSnapshotDelay; }
+    void                    rewind( const F32 sceneTime );
+    void                    restoreRewind( void );
+    inline bool             getRewound( void ) const                    { return mRewound; }
+    void                    setScheduledTick( const bool scheduledTick );
+    inline bool             getScheduledTick( void ) const              { return mScheduledTick; }
+    inline SceneCallbackQueue& getCallbackQueue( void )                 { return mCallbackQueue; }
+    /// Have a scene object queue its callbacks with "SceneObject::queuePendingCallbacks()" once the current tick has integrated.
+    /// This lets objects raise callbacks from contacts without being ticked.  The object must only be added once per tick.
+    void                    addPendingCallbacks( SceneObject* pSceneObject );
     static SceneRenderRequest* createDefaultRenderRequest( SceneRenderQueue* pSceneRenderQueue, SceneObject* pSceneObject  );
 
     /// Taml children.
@@ -677,6 +960,8 @@ public:
     static const char* getPickModeDescription( PickMode pickMode );
     static DebugOption getDebugOptionEnum(const char* label);
     static const char* getDebugOptionDescription( DebugOption debugOption );
+    static DebugStats::TickPhase getTickPhaseEnum(const char* label);
+    static const char* getTickPhaseDescription( DebugStats::TickPhase tickPhase );
 
     /// Declare Console Object.
     DECLARE_CONOBJECT(Scene);
@@ -688,6 +973,22 @@ protected:
     static bool writeGravity( void* obj, StringTableEntry pFieldName )              { return Vector2(static_cast<Scene*>(obj)->getGravity()).notEqual( Vector2::getZero() ); }
     static bool writeVelocityIterations( void* obj, StringTableEntry pFieldName )   { return static_cast<Scene*>(obj)->getVelocityIterations() != 8; }
     static bool writePositionIterations( void* obj, StringTableEntry pFieldName )   { return static_cast<Scene*>(obj)->getPositionIterations() != 3; }
+    static bool setPhysicsStepRate( void* obj, const char* data )                   { static_cast<Scene*>(obj)->setPhysicsStepRate( dAtof(data) ); return false; }
+    static bool writePhysicsStepRate( void* obj, StringTableEntry pFieldName )      { return mNotZero( static_cast<Scene*>(obj)->getPhysicsStepRate() ); }
+    static bool setMaxPhysicsSubSteps( void* obj, const char* data )                { static_cast<Scene*>(obj)->setMaxPhysicsSubSteps( dAtoi(data) ); return false; }
+    static bool writeMaxPhysicsSubSteps( void* obj, StringTableEntry pFieldName )   { return static_cast<Scene*>(obj)->getMaxPhysicsSubSteps() != 8; }
+    static bool setTOIMaxSubSteps( void* obj, const char* data )                    { static_cast<Scene*>(obj)->setTOIMaxSubSteps( dAtoi(data) ); return false; }
+    static bool writeTOIMaxSubSteps( void* obj, StringTableEntry pFieldName )       { return static_cast<Scene*>(obj)->getTOIMaxSubSteps() != 0; }
+    static bool setTOIMaxTime( void* obj, const char* data )                        { static_cast<Scene*>(obj)->setTOIMaxTime( dAtof(data) ); return false; }
+    static bool writeTOIMaxTime( void* obj, StringTableEntry pFieldName )           { return mNotZero( static_cast<Scene*>(obj)->getTOIMaxTime() ); }
+    static bool setBulkBroadPhase( void* obj, const char* data )                    { static_cast<Scene*>(obj)->setBulkBroadPhase( dAtob(data) ); return false; }
+    static bool writeBulkBroadPhase( void* obj, StringTableEntry pFieldName )       { return static_cast<Scene*>(obj)->getBulkBroadPhase(); }
+    static bool writeArenaAllocator( void* obj, StringTableEntry pFieldName )       { return static_cast<Scene*>(obj)->getArenaAllocator(); }
+    static bool writeSpatialHashCellSize( void* obj, StringTableEntry pFieldName )  { return mNotZero( static_cast<Scene*>(obj)->getSpatialHashCellSize() ); }
+    static bool setStaticLayerMask( void* obj, const char* data )                   { static_cast<Scene*>(obj)->setStaticLayerMask( dAtoi(data) ); return false; }
+    static bool writeStaticLayerMask( void* obj, StringTableEntry pFieldName )      { return static_cast<Scene*>(obj)->getStaticLayerMask() != 0; }
+    static bool setLayerRenderCacheGuard( void* obj, const char* data )             { static_cast<Scene*>(obj)->setLayerRenderCacheGuard( dAtof(data) ); return false; }
+    static bool writeLayerRenderCacheGuard( void* obj, StringTableEntry pFieldName ) { return mNotEqual( static_cast<Scene*>(obj)->getLayerRenderCacheGuard(), 0.5f ); }
 
     static bool writeLayerSortMode( void* obj, StringTableEntry pFieldName )
     {
@@ -722,6 +1023,23 @@ protected:
     // Callbacks.
     static bool writeUpdateCallback( void* obj, StringTableEntry pFieldName )       { return static_cast<Scene*>(obj)->getUpdateCallback(); }
     static bool writeRenderCallback( void* obj, StringTableEntry pFieldName )       { return static_cast<Scene*>(obj)->getRenderCallback(); }
+    static bool writeParallelTick( void* obj, StringTableEntry pFieldName )         { return static_cast<Scene*>(obj)->getParallelTick(); }
+    static bool writeParallelControllers( void* obj, StringTableEntry pFieldName )  { return static_cast<Scene*>(obj)->getParallelControllers(); }
+    static bool writeParallelParticles( void* obj, StringTableEntry pFieldName )    { return static_cast<Scene*>(obj)->getParallelParticles(); }
+    static bool writeParallelSkeletons( void* obj, StringTableEntry pFieldName )    { return static_cast<Scene*>(obj)->getParallelSkeletons(); }
+    static bool writeAsyncAssetPreloads( void* obj, StringTableEntry pFieldName )   { return static_cast<Scene*>(obj)->getAsyncAssetPreloads(); }
+    static bool setParallelIslands( void* obj, const char* data )                   { static_cast<Scene*>(obj)->setParallelIslands( dAtob(data) ); return false; }
+    static bool writeParallelIslands( void* obj, StringTableEntry pFieldName )      { return static_cast<Scene*>(obj)->getParallelIslands(); }
+    static bool setParallelContacts( void* obj, const char* data )                  { static_cast<Scene*>(obj)->setParallelContacts( dAtob(data) ); return false; }
+    static bool writeParallelContacts( void* obj, StringTableEntry pFieldName )     { return static_cast<Scene*>(obj)->getParallelContacts(); }
+    static bool writeParallelRender( void* obj, StringTableEntry pFieldName )       { return static_cast<Scene*>(obj)->getParallelRender(); }
+    static bool writeDormantCulling( void* obj, StringTableEntry pFieldName )       { return static_cast<Scene*>(obj)->getDormantCulling(); }
+    static bool setRewindTime( void* obj, const char* data )                        { static_cast<Scene*>(obj)->setRewindTime( dAtof(data) ); return false; }
+    static bool writeRewindTime( void* obj, StringTableEntry pFieldName )           { return static_cast<Scene*>(obj)->getRewindTime() > 0.0f; }
+    static bool setSnapshotDelay( void* obj, const char* data )                     { static_cast<Scene*>(obj)->setSnapshotDelay( dAtof(data) ); return false; }
+    static bool writeSnapshotDelay( void* obj, StringTableEntry pFieldName )        { return mNotEqual( static_cast<Scene*>(obj)->getSnapshotDelay(), 0.1f ); }
+    static bool setScheduledTick( void* obj, const char* data )                     { static_cast<Scene*>(obj)->setScheduledTick( dAtob(data) ); return false; }
+    static bool writeScheduledTick( void* obj, StringTableEntry pFieldName )        { return static_cast<Scene*>(obj)->getScheduledTick(); }
 
 public:
     static SimObjectPtr<Scene> LoadingScene;
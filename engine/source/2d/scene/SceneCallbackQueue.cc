@@ -0,0 +1,170 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCENE_CALLBACK_QUEUE_H_
+#include "2d/scene/SceneCallbackQueue.h"
+#endif
+
+#ifndef _DYNAMIC_CONSOLEMETHOD_COMPONENT_H_
+#include "component/dynamicConsoleMethodComponent.h"
+#endif
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+SceneCallbackQueue::SceneCallbackQueue() :
+    mEntryCacheSequence( 0 ),
+    mDispatching( false )
+{
+    VECTOR_SET_ASSOCIATION( mCallbacks );
+    VECTOR_SET_ASSOCIATION( mArgumentBuffer );
+
+    // Reset the entry cache.
+    dMemset( mEntryCache, 0, sizeof(mEntryCache) );
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneCallbackQueue::queue( SimObject* pObject, StringTableEntry callbackName, const bool behaviorFallback, const U32 argumentCount, const char** pArguments )
+{
+    // Sanity!
+    AssertFatal( pObject != NULL, "SceneCallbackQueue::queue() - Invalid object." );
+    AssertFatal( argumentCount <= MaxArguments, "SceneCallbackQueue::queue() - Too many arguments." );
+    AssertFatal( !mDispatching, "SceneCallbackQueue::queue() - Cannot queue callbacks whilst dispatching." );
+
+    // Add the callback.
+    mCallbacks.increment();
+    Callback& callback = mCallbacks.last();
+    callback.mObjectId = pObject->getId();
+    callback.mCallbackName = callbackName;
+    callback.mBehaviorFallback = behaviorFallback;
+    callback.mArgumentCount = argumentCount;
+
+    // Copy the arguments.
+    for ( U32 index = 0; index < argumentCount; ++index )
+    {
+        const char* pArgument = pArguments[index];
+        const U32 argumentSize = dStrlen( pArgument ) + 1;
+        callback.mArgumentOffsets[index] = mArgumentBuffer.size();
+        mArgumentBuffer.increment( argumentSize );
+        dMemcpy( mArgumentBuffer.address() + callback.mArgumentOffsets[index], pArgument, argumentSize );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneCallbackQueue::dispatch( void )
+{
+    // Finish if nothing to dispatch.
+    if ( mCallbacks.size() == 0 )
+        return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneCallbackQueue_Dispatch);
+
+    // Flag as dispatching.
+    mDispatching = true;
+
+    const char* argv[MaxArguments + 2];
+
+    // Iterate callbacks.
+    for ( S32 callbackIndex = 0; callbackIndex < mCallbacks.size(); ++callbackIndex )
+    {
+        // Fetch callback.
+        const Callback& callback = mCallbacks[callbackIndex];
+
+        // Fetch the object, skipping it if it's been deleted.
+        SimObject* pObject = Sim::findObject( callback.mObjectId );
+        if ( pObject == NULL )
+            continue;
+
+        // Fetch the callback entry.
+        Namespace::Entry* pEntry = lookupEntry( pObject->getNamespace(), callback.mCallbackName );
+
+        // Format the arguments.
+        argv[0] = callback.mCallbackName;
+        argv[1] = "";
+        for ( U32 index = 0; index < callback.mArgumentCount; ++index )
+            argv[index + 2] = mArgumentBuffer.address() + callback.mArgumentOffsets[index];
+        const S32 argc = callback.mArgumentCount + 2;
+
+        // Pass to the behaviors if the object doesn't handle the callback and a fallback is required.
+        if ( pEntry == NULL && callback.mBehaviorFallback )
+        {
+            DynamicConsoleMethodComponent* pComponent = dynamic_cast<DynamicConsoleMethodComponent*>( pObject );
+            if ( pComponent != NULL )
+                pComponent->callOnBehaviors( argc, argv );
+
+            continue;
+        }
+
+        // Perform the callback.
+        Con::executeEntry( pObject, pEntry, argc, argv );
+    }
+
+    // Clear the callbacks.
+    mDispatching = false;
+    clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneCallbackQueue::clear( void )
+{
+    // Sanity!
+    AssertFatal( !mDispatching, "SceneCallbackQueue::clear() - Cannot clear callbacks whilst dispatching." );
+
+    mCallbacks.clear();
+    mArgumentBuffer.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+Namespace::Entry* SceneCallbackQueue::lookupEntry( Namespace* pNamespace, StringTableEntry callbackName )
+{
+    // Finish if no namespace.
+    if ( pNamespace == NULL )
+        return NULL;
+
+    // Reset the entry cache if the namespace cache has changed.
+    if ( mEntryCacheSequence != Namespace::mCacheSequence )
+    {
+        dMemset( mEntryCache, 0, sizeof(mEntryCache) );
+        mEntryCacheSequence = Namespace::mCacheSequence;
+    }
+
+    // Fetch the cache slot.
+    const U32 slot = (U32)((((dsize_t)pNamespace) >> 4) ^ (((dsize_t)callbackName) >> 2)) % EntryCacheSize;
+    EntryCache& cache = mEntryCache[slot];
+
+    // Look up the entry if it's not cached.
+    if ( cache.mpNamespace != pNamespace || cache.mCallbackName != callbackName )
+    {
+        cache.mpNamespace = pNamespace;
+        cache.mCallbackName = callbackName;
+        cache.mpEntry = pNamespace->lookup( callbackName );
+    }
+
+    return cache.mpEntry;
+}
@@ -0,0 +1,94 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCENE_CALLBACK_QUEUE_H_
+#define _SCENE_CALLBACK_QUEUE_H_
+
+#ifndef _SIMBASE_H_
+#include "sim/simBase.h"
+#endif
+
+#ifndef _CONSOLEINTERNAL_H_
+#include "console/consoleInternal.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// Collects script callbacks raised whilst a scene is ticking so they can be dispatched in a single pass.
+///
+/// Callback names are string-table entries resolved against each target's namespace through a small
+/// cache so the namespace lookup is only repeated when the console's namespace cache changes.
+/// Arguments are copied into a shared buffer when queued so no formatting is required when dispatching.
+/// Targets are referenced by Id so any deleted before dispatch are skipped.
+class SceneCallbackQueue
+{
+public:
+    enum
+    {
+        MaxArguments = 4,
+        EntryCacheSize = 64,
+    };
+
+private:
+    struct Callback
+    {
+        SimObjectId         mObjectId;
+        StringTableEntry    mCallbackName;
+        bool                mBehaviorFallback;
+        U32                 mArgumentCount;
+        U32                 mArgumentOffsets[MaxArguments];
+    };
+
+    struct EntryCache
+    {
+        Namespace*          mpNamespace;
+        StringTableEntry    mCallbackName;
+        Namespace::Entry*   mpEntry;
+    };
+
+    Vector<Callback>        mCallbacks;
+    Vector<char>            mArgumentBuffer;
+    EntryCache              mEntryCache[EntryCacheSize];
+    U32                     mEntryCacheSequence;
+    bool                    mDispatching;
+
+    Namespace::Entry*       lookupEntry( Namespace* pNamespace, StringTableEntry callbackName );
+
+public:
+    SceneCallbackQueue();
+    ~SceneCallbackQueue() {}
+
+    /// Queue a callback on an object.
+    /// If "behaviorFallback" is set and the object doesn't handle the callback then it is passed to the object's behaviors instead.
+    void                    queue( SimObject* pObject, StringTableEntry callbackName, const bool behaviorFallback = false, const U32 argumentCount = 0, const char** pArguments = NULL );
+
+    /// Dispatch all queued callbacks in the order they were queued.
+    /// Callbacks cannot be queued whilst dispatching.
+    void                    dispatch( void );
+
+    /// Discard all queued callbacks.
+    void                    clear( void );
+
+    inline U32              getCount( void ) const { return (U32)mCallbacks.size(); }
+};
+
+#endif // _SCENE_CALLBACK_QUEUE_H_
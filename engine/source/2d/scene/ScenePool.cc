@@ -0,0 +1,293 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCENE_POOL_H_
+#include "2d/scene/ScenePool.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+#ifndef _SCENE_OBJECT_H_
+#include "2d/sceneobject/SceneObject.h"
+#endif
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+ScenePool::ScenePool( Scene* pScene ) :
+    mpScene( pScene )
+{
+}
+
+//-----------------------------------------------------------------------------
+
+ScenePool::~ScenePool()
+{
+    // Destroy the idle object lists.
+    // NOTE: The idle objects themselves are owned by the scene.
+    for ( typeIdleObjectsHash::iterator itr = mIdleObjects.begin(); itr != mIdleObjects.end(); ++itr )
+        delete itr->value;
+
+    mIdleObjects.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+SceneObject* ScenePool::spawn( SceneObject* pTemplate )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ScenePool_Spawn);
+
+    // Sanity!
+    AssertFatal( pTemplate != NULL, "ScenePool::spawn() - Invalid template." );
+
+    SceneObject* pSceneObject = NULL;
+
+    // Fetch the idle objects for the template.
+    typeSceneObjectVector* pIdleObjects = findIdleObjects( pTemplate->getId(), false );
+
+    // Do we have an idle object?
+    if ( pIdleObjects != NULL && pIdleObjects->size() > 0 )
+    {
+        // Yes, so use it.
+        pSceneObject = pIdleObjects->last();
+        pIdleObjects->pop_back();
+        pSceneObject->mPoolIdle = false;
+    }
+    else
+    {
+        // No, so create one.
+        pSceneObject = createObject( pTemplate );
+
+        // Finish if we couldn't create one.
+        if ( pSceneObject == NULL )
+            return NULL;
+    }
+
+    // Reset the state from the template.
+    pTemplate->copyTo( pSceneObject );
+
+    // Enable the object.
+    pSceneObject->setEnabled( true );
+
+    return pSceneObject;
+}
+
+//-----------------------------------------------------------------------------
+
+bool ScenePool::release( SceneObject* pSceneObject )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ScenePool_Release);
+
+    // Sanity!
+    AssertFatal( pSceneObject != NULL, "ScenePool::release() - Invalid scene object." );
+
+    // Finish if the object is not pooled by this scene.
+    if ( pSceneObject->mPoolTemplateId == 0 || pSceneObject->getScene() != mpScene )
+        return false;
+
+    // Finish if the object is already idle.
+    if ( pSceneObject->mPoolIdle )
+        return true;
+
+    // Process destroy notifications.
+    pSceneObject->processDestroyNotifications();
+
+    // Dismount any camera.
+    pSceneObject->dismountCamera();
+
+    // Destroy any joints.
+    b2Body* pBody = pSceneObject->getBody();
+    while ( pBody->GetJointList() != NULL )
+        mpScene->deleteJoint( mpScene->findJointId( pBody->GetJointList()->joint ) );
+
+    // Stop any movement.
+    pSceneObject->cancelMoveTo( false );
+    pSceneObject->cancelRotateTo( false );
+    pSceneObject->setLinearVelocity( Vector2::getZero() );
+    pSceneObject->setAngularVelocity( 0.0f );
+
+    // Disable the object.
+    pSceneObject->mBeingSafeDeleted = false;
+    pSceneObject->setEnabled( false );
+
+    // Add to the idle objects.
+    findIdleObjects( pSceneObject->mPoolTemplateId, true )->push_back( pSceneObject );
+    pSceneObject->mPoolIdle = true;
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void ScenePool::prewarm( SceneObject* pTemplate, const U32 count )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ScenePool_Prewarm);
+
+    // Sanity!
+    AssertFatal( pTemplate != NULL, "ScenePool::prewarm() - Invalid template." );
+
+    // Fetch the idle objects for the template.
+    typeSceneObjectVector* pIdleObjects = findIdleObjects( pTemplate->getId(), true );
+
+    // Create idle objects until we have enough.
+    while ( (U32)pIdleObjects->size() < count )
+    {
+        // Create the object.
+        SceneObject* pSceneObject = createObject( pTemplate );
+
+        // Finish if we couldn't create one.
+        if ( pSceneObject == NULL )
+            return;
+
+        // Reset the state from the template.
+        pTemplate->copyTo( pSceneObject );
+
+        // Add to the idle objects.
+        pSceneObject->setEnabled( false );
+        pIdleObjects->push_back( pSceneObject );
+        pSceneObject->mPoolIdle = true;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void ScenePool::clear( const SimObjectId templateId )
+{
+    // Gather the idle objects to delete.
+    typeSceneObjectVector idleObjects;
+    for ( typeIdleObjectsHash::iterator itr = mIdleObjects.begin(); itr != mIdleObjects.end(); ++itr )
+    {
+        // Skip if not the requested template.
+        if ( templateId != 0 && itr->key != templateId )
+            continue;
+
+        idleObjects.merge( *(itr->value) );
+    }
+
+    // Delete the idle objects.
+    // NOTE: Deleting removes them from the scene which in turn removes them from the idle objects.
+    for ( S32 index = 0; index < idleObjects.size(); ++index )
+        idleObjects[index]->deleteObject();
+}
+
+//-----------------------------------------------------------------------------
+
+U32 ScenePool::getIdleCount( const SimObjectId templateId ) const
+{
+    // Find the idle objects for the template.
+    typeIdleObjectsHash::const_iterator itr = mIdleObjects.find( templateId );
+
+    return itr == mIdleObjects.end() ? 0 : (U32)itr->value->size();
+}
+
+//-----------------------------------------------------------------------------
+
+void ScenePool::onRemoveFromScene( SceneObject* pSceneObject )
+{
+    // Finish if the object is not pooled.
+    if ( pSceneObject->mPoolTemplateId == 0 )
+        return;
+
+    // Is the object idle?
+    if ( pSceneObject->mPoolIdle )
+    {
+        // Yes, so remove it from the idle objects.
+        typeSceneObjectVector* pIdleObjects = findIdleObjects( pSceneObject->mPoolTemplateId, false );
+        if ( pIdleObjects != NULL )
+        {
+            for ( S32 index = 0; index < pIdleObjects->size(); ++index )
+            {
+                if ( (*pIdleObjects)[index] == pSceneObject )
+                {
+                    pIdleObjects->erase_fast( index );
+                    break;
+                }
+            }
+        }
+    }
+
+    // The object is no longer pooled.
+    pSceneObject->mPoolTemplateId = 0;
+    pSceneObject->mPoolIdle = false;
+}
+
+//-----------------------------------------------------------------------------
+
+SceneObject* ScenePool::createObject( SceneObject* pTemplate )
+{
+    // Create an object of the same type as the template.
+    ConsoleObject* pObject = ConsoleObject::create( pTemplate->getClassName() );
+    SceneObject* pSceneObject = dynamic_cast<SceneObject*>( pObject );
+
+    // Sanity!
+    if ( pSceneObject == NULL )
+    {
+        Con::warnf( "ScenePool::createObject() - Could not create an object of type '%s'.", pTemplate->getClassName() );
+        delete pObject;
+        return NULL;
+    }
+
+    // Register the object.
+    if ( !pSceneObject->registerObject() )
+    {
+        Con::warnf( "ScenePool::createObject() - Could not register an object of type '%s'.", pTemplate->getClassName() );
+        delete pSceneObject;
+        return NULL;
+    }
+
+    // Add to the scene.
+    mpScene->addToScene( pSceneObject );
+
+    // Flag as pooled.
+    pSceneObject->mPoolTemplateId = pTemplate->getId();
+
+    return pSceneObject;
+}
+
+//-----------------------------------------------------------------------------
+
+typeSceneObjectVector* ScenePool::findIdleObjects( const SimObjectId templateId, const bool create )
+{
+    // Find the idle objects for the template.
+    typeIdleObjectsHash::iterator itr = mIdleObjects.find( templateId );
+
+    // Finish if found.
+    if ( itr != mIdleObjects.end() )
+        return itr->value;
+
+    // Finish if not creating.
+    if ( !create )
+        return NULL;
+
+    // Create the idle objects.
+    typeSceneObjectVector* pIdleObjects = new typeSceneObjectVector();
+    mIdleObjects.insert( templateId, pIdleObjects );
+
+    return pIdleObjects;
+}
@@ -0,0 +1,77 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCENE_POOL_H_
+#define _SCENE_POOL_H_
+
+#ifndef _SIMBASE_H_
+#include "sim/simBase.h"
+#endif
+
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
+#ifndef _UTILITY_H_
+#include "2d/core/Utility.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class Scene;
+class SceneObject;
+
+//-----------------------------------------------------------------------------
+
+/// Keeps registered but disabled scene objects per template so frequently spawned objects can be recycled.
+///
+/// Pooled objects never leave their scene so their physics body and world proxy are kept when they are
+/// released back to the pool.  Spawning an object resets its state from the template using "copyTo()"
+/// and then enables it.  Pooled objects that are safe-deleted are released back to the pool rather than
+/// being deleted.
+class ScenePool
+{
+private:
+    typedef HashMap<SimObjectId, typeSceneObjectVector*> typeIdleObjectsHash;
+
+    Scene*                  mpScene;
+    typeIdleObjectsHash     mIdleObjects;
+
+    SceneObject*            createObject( SceneObject* pTemplate );
+    typeSceneObjectVector*  findIdleObjects( const SimObjectId templateId, const bool create );
+
+public:
+    ScenePool( Scene* pScene );
+    ~ScenePool();
+
+    /// Spawning.
+    SceneObject*            spawn( SceneObject* pTemplate );
+    bool                    release( SceneObject* pSceneObject );
+    void                    prewarm( SceneObject* pTemplate, const U32 count );
+
+    /// Pool management.
+    void                    clear( const SimObjectId templateId = 0 );
+    U32                     getIdleCount( const SimObjectId templateId ) const;
+    void                    onRemoveFromScene( SceneObject* pSceneObject );
+};
+
+#endif // _SCENE_POOL_H_
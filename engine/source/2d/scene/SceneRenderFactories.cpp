@@ -30,5 +30,5 @@
 
 //-----------------------------------------------------------------------------
 
-FactoryCache<SceneRenderRequest> SceneRenderRequestFactory;
-FactoryCache<SceneRenderQueue> SceneRenderQueueFactory;   
+FactoryCache<SceneRenderRequest> SceneRenderRequestFactory( "SceneRenderRequest" );
+FactoryCache<SceneRenderQueue> SceneRenderQueueFactory( "SceneRenderQueue" );
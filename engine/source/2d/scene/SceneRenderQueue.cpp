@@ -246,3 +246,140 @@ S32 QSORT_CALLBACK SceneRenderQueue::layeredInverseYSortPointSort(const void* a,
     // We sort higher y values before lower values.
     return y1 < y2 ? 1 : y1 > y2 ? -1 : pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
 }
+
+//-----------------------------------------------------------------------------
+
+static inline U32 getFloatSortKey( F32 value )
+{
+    // Treat negative zero as zero.
+    if ( value == 0.0f )
+        value = 0.0f;
+
+    // Flip all the bits of negative values and the sign bit of positive values so the unsigned bits order like the floats.
+    U32 bits;
+    dMemcpy( &bits, &value, sizeof(bits) );
+    return (bits & 0x80000000) ? ~bits : (bits | 0x80000000);
+}
+
+//-----------------------------------------------------------------------------
+
+static inline U32 getSerialSortKey( const S32 serialId )
+{
+    // Flip the sign bit so the unsigned bits order like the signed serial Ids.
+    return (U32)serialId ^ 0x80000000;
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneRenderQueue::keyedSort( void )
+{
+    // Fetch request count.
+    const U32 requestCount = (U32)mRenderRequests.size();
+
+    // Size the keyed buffers.
+    mKeyedRequests.setSize( requestCount );
+    mKeyedRequestsScratch.setSize( requestCount );
+
+    // Build the keys.
+    // NOTE: The upper 32-bits hold the sort value and the lower 32-bits the serial Id so ties are ordered exactly like the comparison sorts.
+    for ( U32 index = 0; index < requestCount; ++index )
+    {
+        // Fetch scene render request.
+        SceneRenderRequest* pSceneRenderRequest = mRenderRequests[index];
+
+        U32 sortValue = 0;
+        U32 serialValue = getSerialSortKey( pSceneRenderRequest->mSerialId );
+
+        switch( mSortMode )
+        {
+            case RENDER_SORT_OLDEST:
+                serialValue = ~serialValue;
+                break;
+
+            case RENDER_SORT_BATCH:
+                // Batch isolated requests sort first.
+                sortValue = pSceneRenderRequest->mpSceneRenderObject->getBatchIsolated() ? 0 : 1;
+                break;
+
+            case RENDER_SORT_XAXIS:
+                sortValue = getFloatSortKey( pSceneRenderRequest->mWorldPosition.x + pSceneRenderRequest->mSortPoint.x );
+                break;
+
+            case RENDER_SORT_YAXIS:
+                sortValue = getFloatSortKey( pSceneRenderRequest->mWorldPosition.y + pSceneRenderRequest->mSortPoint.y );
+                break;
+
+            case RENDER_SORT_ZAXIS:
+                // Higher depths sort first.
+                sortValue = ~getFloatSortKey( pSceneRenderRequest->mDepth );
+                break;
+
+            case RENDER_SORT_INVERSE_XAXIS:
+                sortValue = ~getFloatSortKey( pSceneRenderRequest->mWorldPosition.x + pSceneRenderRequest->mSortPoint.x );
+                break;
+
+            case RENDER_SORT_INVERSE_YAXIS:
+                sortValue = ~getFloatSortKey( pSceneRenderRequest->mWorldPosition.y + pSceneRenderRequest->mSortPoint.y );
+                break;
+
+            case RENDER_SORT_INVERSE_ZAXIS:
+                sortValue = getFloatSortKey( pSceneRenderRequest->mDepth );
+                break;
+
+            default:
+                break;
+        }
+
+        KeyedRenderRequest& keyedRequest = mKeyedRequests[index];
+        keyedRequest.mSortKey = ((U64)sortValue << 32) | (U64)serialValue;
+        keyedRequest.mpSceneRenderRequest = pSceneRenderRequest;
+    }
+
+    // Histogram every byte of the keys in a single pass.
+    U32 histograms[8][256];
+    dMemset( histograms, 0, sizeof(histograms) );
+    for ( U32 index = 0; index < requestCount; ++index )
+    {
+        const U64 sortKey = mKeyedRequests[index].mSortKey;
+        for ( U32 pass = 0; pass < 8; ++pass )
+            histograms[pass][(sortKey >> (pass * 8)) & 0xFF]++;
+    }
+
+    // Least-significant byte first radix sort.
+    KeyedRenderRequest* pSource = mKeyedRequests.address();
+    KeyedRenderRequest* pDestination = mKeyedRequestsScratch.address();
+    for ( U32 pass = 0; pass < 8; ++pass )
+    {
+        U32* pHistogram = histograms[pass];
+        const U32 shift = pass * 8;
+
+        // Skip the pass if every key has the same byte here.
+        if ( pHistogram[(pSource[0].mSortKey >> shift) & 0xFF] == requestCount )
+            continue;
+
+        // Convert the counts to offsets.
+        U32 offset = 0;
+        for ( U32 bucket = 0; bucket < 256; ++bucket )
+        {
+            const U32 count = pHistogram[bucket];
+            pHistogram[bucket] = offset;
+            offset += count;
+        }
+
+        // Scatter.
+        for ( U32 index = 0; index < requestCount; ++index )
+        {
+            const KeyedRenderRequest& keyedRequest = pSource[index];
+            pDestination[pHistogram[(keyedRequest.mSortKey >> shift) & 0xFF]++] = keyedRequest;
+        }
+
+        // Swap buffers.
+        KeyedRenderRequest* pSwap = pSource;
+        pSource = pDestination;
+        pDestination = pSwap;
+    }
+
+    // Write back the sorted requests.
+    for ( U32 index = 0; index < requestCount; ++index )
+        mRenderRequests[index] = pSource[index].mpSceneRenderRequest;
+}
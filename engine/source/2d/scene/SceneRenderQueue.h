@@ -32,6 +32,11 @@
 
 //-----------------------------------------------------------------------------
 
+/// Render request counts at or above this are sorted with a keyed radix sort rather than a comparison sort.
+#define SCENE_RENDER_QUEUE_RADIX_SORT_THRESHOLD     64
+
+//-----------------------------------------------------------------------------
+
 class SceneRenderQueue : public IFactoryObjectReset
 {
 public:
@@ -56,10 +61,22 @@ public:
     };
 
 private: 
+    /// A render request with its packed sort key.
+    struct KeyedRenderRequest
+    {
+        U64                 mSortKey;
+        SceneRenderRequest* mpSceneRenderRequest;
+    };
+    typedef Vector<KeyedRenderRequest> typeKeyedRenderRequestVector;
+
     typeRenderRequestVector mRenderRequests;
     RenderSort              mSortMode;
     bool                    mStrictOrderMode;
 
+    /// Keyed sort buffers (kept to avoid reallocating them each sort).
+    typeKeyedRenderRequestVector mKeyedRequests;
+    typeKeyedRenderRequestVector mKeyedRequestsScratch;
+
 private:
     static S32 QSORT_CALLBACK layeredNewFrontSort(const void* a, const void* b);
     static S32 QSORT_CALLBACK layeredOldFrontSort(const void* a, const void* b);
@@ -72,6 +89,8 @@ private:
     static S32 QSORT_CALLBACK layeredInverseXSortPointSort(const void* a, const void* b);
     static S32 QSORT_CALLBACK layeredInverseYSortPointSort(const void* a, const void* b);
 
+    void keyedSort( void );
+
 public:
     SceneRenderQueue()
     {
@@ -125,32 +144,48 @@ public:
 
     void sort( void )
     {
+        // Debug Profiling.
+        PROFILE_SCOPE(SceneRenderQueue_Sort);
+
+        sortRequests();
+    }
+
+    /// Size the sort buffers so that a following sort does not allocate.
+    inline void reserveSort( void ) { mKeyedRequests.setSize( mRenderRequests.size() ); mKeyedRequestsScratch.setSize( mRenderRequests.size() ); }
+
+    /// Sort without profiling so it can be used on a worker thread.
+    void sortRequests( void )
+    {
+        // Use a keyed sort for large queues if the sort mode can be keyed.
+        // NOTE: Group sorting orders by render group address which does not fit in the key.
+        if ( mRenderRequests.size() >= SCENE_RENDER_QUEUE_RADIX_SORT_THRESHOLD && mSortMode != RENDER_SORT_OFF && mSortMode != RENDER_SORT_GROUP )
+        {
+            keyedSort();
+
+            // Batching means we don't need strict order.
+            if ( mSortMode == RENDER_SORT_BATCH )
+                mStrictOrderMode = false;
+
+            return;
+        }
+
         // Sort layer appropriately.
         switch( mSortMode )
         {
             case RENDER_SORT_NEWEST:
                 {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortNewest);
-
                     dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredNewFrontSort );
                     return;
                 }
 
             case RENDER_SORT_OLDEST:
                 {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortOldest);
-
                     dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredOldFrontSort );
                     return;
                 }
 
             case RENDER_SORT_BATCH:
                 {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortBatch);
-
                     dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layerBatchOrderSort );
 
                     // Batching means we don't need strict order.
@@ -160,63 +195,42 @@ public:
 
             case RENDER_SORT_GROUP:
                 {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortGroup);
-
                     dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layerGroupOrderSort );
                     return;
                 }
 
             case RENDER_SORT_XAXIS:
                 {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortXAxis);
-
                     dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredXSortPointSort);
                     return;
                 }
 
             case RENDER_SORT_YAXIS:
                 {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortYAxis);
-
                     dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredYSortPointSort );
                     return;
                 }
 
             case RENDER_SORT_ZAXIS:
                 {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortZAxis);
-
                     dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredDepthSort );
                     return;
                 }
 
             case RENDER_SORT_INVERSE_XAXIS:
                 {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortInverseXAxis);
-
                     dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredInverseXSortPointSort );
                     return;
                 }
 
             case RENDER_SORT_INVERSE_YAXIS:
                 {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortInverseYAxis);
-
                     dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredInverseYSortPointSort );
                     return;
                 }
 
             case RENDER_SORT_INVERSE_ZAXIS:
                 {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortInverseZAxis);
-
                     dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredInverseDepthSort );
                     return;
                 }
@@ -35,6 +35,10 @@
 #include "graphics/color.h"
 #endif
 
+#ifndef _POOL_ALLOCATED_H_
+#include "memory/poolAllocated.h"
+#endif
+
 // Debug Profiling.
 #include "debug/profiler.h"
 
@@ -45,7 +49,7 @@ class SceneRenderQueue;
 
 //-----------------------------------------------------------------------------
 
-class SceneRenderRequest : public IFactoryObjectReset
+class SceneRenderRequest : public IFactoryObjectReset, public PoolAllocated<SceneRenderRequest>
 {
 public:
     SceneRenderRequest() : mpIsolatedRenderQueue(NULL)
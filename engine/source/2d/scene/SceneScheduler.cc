@@ -0,0 +1,194 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCENE_SCHEDULER_H_
+#include "2d/scene/SceneScheduler.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREADPOOL_H_
+#include "platform/threads/threadPool.h"
+#endif
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+SceneScheduler* SceneScheduler::smGlobalScheduler = NULL;
+
+//-----------------------------------------------------------------------------
+
+SceneScheduler::SceneScheduler()
+{
+    VECTOR_SET_ASSOCIATION( mScenes );
+    VECTOR_SET_ASSOCIATION( mTickScenes );
+    VECTOR_SET_ASSOCIATION( mPhysicsScenes );
+}
+
+//-----------------------------------------------------------------------------
+
+SceneScheduler::~SceneScheduler()
+{
+    // Turn-off tick processing.
+    setProcessTicks( false );
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneScheduler::addScene( Scene* pScene )
+{
+    // Sanity!
+    AssertFatal( pScene != NULL, "SceneScheduler::addScene() - Invalid scene." );
+
+    // Finish if the scene is already scheduled.
+    for ( S32 index = 0; index < mScenes.size(); ++index )
+    {
+        if ( mScenes[index] == pScene )
+            return;
+    }
+
+    // Add the scene.
+    mScenes.push_back( pScene );
+
+    // Turn-on tick processing.
+    setProcessTicks( true );
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneScheduler::removeScene( Scene* pScene )
+{
+    // Remove the scene.
+    for ( S32 index = 0; index < mScenes.size(); ++index )
+    {
+        if ( mScenes[index] == pScene )
+        {
+            mScenes.erase( index );
+            break;
+        }
+    }
+
+    // Turn-off tick processing if there's nothing to schedule.
+    if ( mScenes.size() == 0 )
+        setProcessTicks( false );
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneScheduler::processTick( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneScheduler_ProcessTick);
+
+    // Take a snapshot of the scheduled scenes.
+    // NOTE: Scenes can be deleted or unscheduled by script callbacks whilst ticking.
+    mTickScenes = mScenes;
+
+    // Pre-integrate the scenes.
+    for ( S32 index = 0; index < mTickScenes.size(); ++index )
+    {
+        if ( mTickScenes[index].notNull() )
+            mTickScenes[index]->preIntegrateTick();
+    }
+
+    // Fetch the remaining scenes.
+    mPhysicsScenes.clear();
+    for ( S32 index = 0; index < mTickScenes.size(); ++index )
+    {
+        if ( mTickScenes[index].notNull() )
+            mPhysicsScenes.push_back( mTickScenes[index] );
+    }
+
+    // Integrate the physics of the scenes in parallel.
+    {
+        // Debug Profiling.
+        PROFILE_SCOPE(SceneScheduler_ParallelIntegratePhysics);
+
+        ThreadPool::getGlobal()->parallelFor( parallelIntegratePhysics, mPhysicsScenes.address(), mPhysicsScenes.size(), 1 );
+    }
+
+    // Post-integrate the scenes.
+    for ( S32 index = 0; index < mTickScenes.size(); ++index )
+    {
+        if ( mTickScenes[index].notNull() )
+            mTickScenes[index]->postIntegrateTick();
+    }
+
+    // Clear the snapshots.
+    mTickScenes.clear();
+    mPhysicsScenes.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneScheduler::interpolateTick( F32 timeDelta )
+{
+    // Take a snapshot of the scheduled scenes.
+    mTickScenes = mScenes;
+
+    // Interpolate the scenes.
+    for ( S32 index = 0; index < mTickScenes.size(); ++index )
+    {
+        if ( mTickScenes[index].notNull() )
+            mTickScenes[index]->interpolateTick( timeDelta );
+    }
+
+    // Clear the snapshot.
+    mTickScenes.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneScheduler::parallelIntegratePhysics( void* pContext, const U32 start, const U32 end )
+{
+    // Fetch the scenes.
+    Scene** ppScenes = static_cast<Scene**>( pContext );
+
+    // Integrate physics.
+    for ( U32 index = start; index < end; ++index )
+        ppScenes[index]->integratePhysicsTick();
+}
+
+//-----------------------------------------------------------------------------
+
+SceneScheduler* SceneScheduler::getGlobal( void )
+{
+    if ( smGlobalScheduler == NULL )
+        smGlobalScheduler = new SceneScheduler();
+
+    return smGlobalScheduler;
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneScheduler::destroyGlobal( void )
+{
+    if ( smGlobalScheduler == NULL )
+        return;
+
+    delete smGlobalScheduler;
+    smGlobalScheduler = NULL;
+}
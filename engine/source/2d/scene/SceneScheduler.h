@@ -0,0 +1,81 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCENE_SCHEDULER_H_
+#define _SCENE_SCHEDULER_H_
+
+#ifndef _TICKABLE_H_
+#include "platform/Tickable.h"
+#endif
+
+#ifndef _SIMBASE_H_
+#include "sim/simBase.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class Scene;
+
+//-----------------------------------------------------------------------------
+
+/// Ticks a set of independent scenes together so their physics can be stepped concurrently.
+///
+/// Each tick is split into three stages.  The pre-integrate stage runs serially for every scheduled
+/// scene on the main thread, the physics stage of all the scenes is then split across the global
+/// thread pool and finally the post-integrate stage (including all script callbacks) runs serially
+/// on the main thread again.  The physics stage only touches a scene's own world, world query and
+/// contacts so no two scenes share state whilst it runs.
+class SceneScheduler : public virtual Tickable
+{
+private:
+    typedef Vector< SimObjectPtr<Scene> > typeScheduledSceneVector;
+
+    typeScheduledSceneVector    mScenes;
+    typeScheduledSceneVector    mTickScenes;
+    Vector<Scene*>              mPhysicsScenes;
+
+    static SceneScheduler*      smGlobalScheduler;
+
+    static void                 parallelIntegratePhysics( void* pContext, const U32 start, const U32 end );
+
+protected:
+    virtual void                processTick( void );
+    virtual void                interpolateTick( F32 timeDelta );
+    virtual void                advanceTime( F32 timeDelta ) {}
+
+public:
+    SceneScheduler();
+    virtual ~SceneScheduler();
+
+    /// Scheduled scenes.
+    void                        addScene( Scene* pScene );
+    void                        removeScene( Scene* pScene );
+    inline U32                  getSceneCount( void ) const { return (U32)mScenes.size(); }
+
+    /// Fetch the global scheduler, creating it on first use.
+    static SceneScheduler*      getGlobal( void );
+
+    /// Destroy the global scheduler.
+    static void                 destroyGlobal( void );
+};
+
+#endif // _SCENE_SCHEDULER_H_
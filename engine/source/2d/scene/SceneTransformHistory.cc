@@ -0,0 +1,125 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#ifndef _SCENE_TRANSFORM_HISTORY_H_
+#include "2d/scene/SceneTransformHistory.h"
+#endif
+
+#ifndef _MMATHFN_H_
+#include "math/mMathFn.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+SceneTransformHistory::SceneTransformHistory( const U32 capacity ) :
+    mHead( 0 ),
+    mCount( 0 )
+{
+    VECTOR_SET_ASSOCIATION( mSnapshots );
+
+    setCapacity( capacity );
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneTransformHistory::setCapacity( const U32 capacity )
+{
+    // Sanity!
+    AssertFatal( capacity > 0, "SceneTransformHistory::setCapacity() - Capacity must be greater than zero." );
+
+    mSnapshots.setSize( capacity );
+    clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneTransformHistory::push( const F32 time, const Vector2& position, const F32 angle )
+{
+    Snapshot* pSnapshot;
+
+    // Replace the newest snapshot if this is not after it.
+    if ( mCount > 0 && time <= getNewest().mTime )
+    {
+        pSnapshot = &mSnapshots[(mHead + mCount - 1) % mSnapshots.size()];
+    }
+    else if ( mCount < (U32)mSnapshots.size() )
+    {
+        pSnapshot = &mSnapshots[(mHead + mCount) % mSnapshots.size()];
+        mCount++;
+    }
+    else
+    {
+        // Replace the oldest snapshot.
+        pSnapshot = &mSnapshots[mHead];
+        mHead = (mHead + 1) % mSnapshots.size();
+    }
+
+    pSnapshot->mTime = time;
+    pSnapshot->mPosition = position;
+    pSnapshot->mAngle = angle;
+}
+
+//-----------------------------------------------------------------------------
+
+bool SceneTransformHistory::sample( const F32 time, Vector2& position, F32& angle ) const
+{
+    // Finish if there are no snapshots.
+    if ( mCount == 0 )
+        return false;
+
+    // Clamp to the newest snapshot.
+    const Snapshot& newest = getNewest();
+    if ( time >= newest.mTime )
+    {
+        position = newest.mPosition;
+        angle = newest.mAngle;
+        return true;
+    }
+
+    // Find the snapshot before the time, searching from the newest as recent times are sampled most.
+    for ( S32 index = (S32)mCount - 2; index >= 0; --index )
+    {
+        const Snapshot& from = getSnapshot( index );
+        if ( from.mTime > time )
+            continue;
+
+        const Snapshot& to = getSnapshot( index + 1 );
+        const F32 t = (time - from.mTime) / (to.mTime - from.mTime);
+
+        // Interpolate the position and the angle along the shortest arc.
+        position = from.mPosition + (to.mPosition - from.mPosition) * t;
+        F32 angleDelta = mFmod( to.mAngle - from.mAngle, M_2PI_F );
+        if ( angleDelta > M_PI_F )
+            angleDelta -= M_2PI_F;
+        else if ( angleDelta < -M_PI_F )
+            angleDelta += M_2PI_F;
+        angle = from.mAngle + angleDelta * t;
+        return true;
+    }
+
+    // Clamp to the oldest snapshot.
+    const Snapshot& oldest = getSnapshot( 0 );
+    position = oldest.mPosition;
+    angle = oldest.mAngle;
+    return true;
+}
@@ -0,0 +1,80 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#ifndef _SCENE_TRANSFORM_HISTORY_H_
+#define _SCENE_TRANSFORM_HISTORY_H_
+
+#ifndef _VECTOR2_H_
+#include "2d/core/Vector2.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// A ring of timestamped positions and angles that can be sampled at any time within it.
+///
+/// Snapshots must be pushed in time order.  When the ring is full the oldest snapshot is replaced.
+/// Sampling interpolates between the snapshots either side of the time and clamps to the oldest
+/// or newest snapshot outside of the history; it never extrapolates.
+class SceneTransformHistory
+{
+public:
+    struct Snapshot
+    {
+        F32     mTime;
+        Vector2 mPosition;
+        F32     mAngle;
+    };
+
+private:
+    Vector<Snapshot>    mSnapshots;
+    U32                 mHead;
+    U32                 mCount;
+
+public:
+    SceneTransformHistory( const U32 capacity );
+    ~SceneTransformHistory() {}
+
+    /// Set the number of snapshots held.  This clears the history.
+    void                    setCapacity( const U32 capacity );
+    inline U32              getCapacity( void ) const                   { return (U32)mSnapshots.size(); }
+
+    inline void             clear( void )                               { mHead = 0; mCount = 0; }
+    inline U32              getCount( void ) const                      { return mCount; }
+
+    /// Add a snapshot.  A snapshot at or before the newest time replaces the newest.
+    void                    push( const F32 time, const Vector2& position, const F32 angle );
+
+    /// Get a snapshot, zero being the oldest.
+    inline const Snapshot&  getSnapshot( const U32 index ) const        { return mSnapshots[(mHead + index) % mSnapshots.size()]; }
+    inline const Snapshot&  getNewest( void ) const                     { return getSnapshot( mCount - 1 ); }
+
+    /// Sample the position and angle at the specified time.
+    /// @return Whether there are any snapshots to sample.
+    bool                    sample( const F32 time, Vector2& position, F32& angle ) const;
+};
+
+#endif // _SCENE_TRANSFORM_HISTORY_H_
@@ -0,0 +1,156 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCENE_TRANSFORM_STORE_H_
+#include "2d/scene/SceneTransformStore.h"
+#endif
+
+#ifndef _SCENE_OBJECT_H_
+#include "2d/sceneobject/SceneObject.h"
+#endif
+
+#ifndef _MMATHFN_H_
+#include "math/mMathFn.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+SceneTransformStore::SceneTransformStore()
+{
+    VECTOR_SET_ASSOCIATION( mPreTickPositionX );
+    VECTOR_SET_ASSOCIATION( mPreTickPositionY );
+    VECTOR_SET_ASSOCIATION( mPreTickAngle );
+    VECTOR_SET_ASSOCIATION( mPreTickAABB );
+    VECTOR_SET_ASSOCIATION( mTickPositionX );
+    VECTOR_SET_ASSOCIATION( mTickPositionY );
+    VECTOR_SET_ASSOCIATION( mTickAngle );
+    VECTOR_SET_ASSOCIATION( mRenderPositionX );
+    VECTOR_SET_ASSOCIATION( mRenderPositionY );
+    VECTOR_SET_ASSOCIATION( mRenderAngle );
+    VECTOR_SET_ASSOCIATION( mSpatialDirty );
+    VECTOR_SET_ASSOCIATION( mSceneObjects );
+}
+
+//-----------------------------------------------------------------------------
+
+S32 SceneTransformStore::allocate( SceneObject* pSceneObject )
+{
+    // Sanity!
+    AssertFatal( pSceneObject != NULL, "SceneTransformStore::allocate() - Invalid scene object." );
+
+    // Fetch the new handle.
+    const S32 handle = mSceneObjects.size();
+
+    // Add the entry.
+    mPreTickPositionX.increment();
+    mPreTickPositionY.increment();
+    mPreTickAngle.increment();
+    mPreTickAABB.increment();
+    mTickPositionX.increment();
+    mTickPositionY.increment();
+    mTickAngle.increment();
+    mRenderPositionX.increment();
+    mRenderPositionY.increment();
+    mRenderAngle.increment();
+    mSpatialDirty.increment();
+    mSceneObjects.push_back( pSceneObject );
+
+    // Reset the spatials.
+    b2AABB aabb;
+    aabb.lowerBound.SetZero();
+    aabb.upperBound.SetZero();
+    resetSpatials( handle, b2Vec2_zero, 0.0f, aabb );
+
+    return handle;
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneTransformStore::release( const S32 handle )
+{
+    // Sanity!
+    AssertFatal( handle >= 0 && handle < mSceneObjects.size(), "SceneTransformStore::release() - Invalid handle." );
+
+    // Fetch the last handle.
+    const S32 lastHandle = mSceneObjects.size() - 1;
+
+    // Move the last entry into the released slot.
+    if ( handle != lastHandle )
+    {
+        mPreTickPositionX[handle] = mPreTickPositionX[lastHandle];
+        mPreTickPositionY[handle] = mPreTickPositionY[lastHandle];
+        mPreTickAngle[handle]     = mPreTickAngle[lastHandle];
+        mPreTickAABB[handle]      = mPreTickAABB[lastHandle];
+        mTickPositionX[handle]    = mTickPositionX[lastHandle];
+        mTickPositionY[handle]    = mTickPositionY[lastHandle];
+        mTickAngle[handle]        = mTickAngle[lastHandle];
+        mRenderPositionX[handle]  = mRenderPositionX[lastHandle];
+        mRenderPositionY[handle]  = mRenderPositionY[lastHandle];
+        mRenderAngle[handle]      = mRenderAngle[lastHandle];
+        mSpatialDirty[handle]     = mSpatialDirty[lastHandle];
+        mSceneObjects[handle]     = mSceneObjects[lastHandle];
+
+        // Update the moved scene object handle.
+        mSceneObjects[handle]->mTransformHandle = handle;
+    }
+
+    // Remove the last entry.
+    mPreTickPositionX.pop_back();
+    mPreTickPositionY.pop_back();
+    mPreTickAngle.pop_back();
+    mPreTickAABB.pop_back();
+    mTickPositionX.pop_back();
+    mTickPositionY.pop_back();
+    mTickAngle.pop_back();
+    mRenderPositionX.pop_back();
+    mRenderPositionY.pop_back();
+    mRenderAngle.pop_back();
+    mSpatialDirty.pop_back();
+    mSceneObjects.pop_back();
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneTransformStore::resetSpatials( const S32 handle, const b2Vec2& position, const F32 angle, const b2AABB& aabb )
+{
+    // Set coincident pre-tick, tick & render.
+    mPreTickPositionX[handle] = mTickPositionX[handle] = mRenderPositionX[handle] = position.x;
+    mPreTickPositionY[handle] = mTickPositionY[handle] = mRenderPositionY[handle] = position.y;
+    mPreTickAngle[handle]     = mTickAngle[handle]     = mRenderAngle[handle]     = angle;
+    mPreTickAABB[handle]      = aabb;
+
+    // Flag spatial changed.
+    mSpatialDirty[handle] = 1;
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneTransformStore::interpolate( const F32 timeDelta )
+{
+    // Blend the render spatials for all the dirty entries.
+    // NOTE: This uses the best available (SSE, NEON or C) math-library kernel.
+    m_spatial2F_bulk_interpolate(
+        mPreTickPositionX.address(), mPreTickPositionY.address(), mPreTickAngle.address(),
+        mTickPositionX.address(), mTickPositionY.address(), mTickAngle.address(),
+        mSpatialDirty.address(), getCount(), timeDelta,
+        mRenderPositionX.address(), mRenderPositionY.address(), mRenderAngle.address() );
+}
@@ -0,0 +1,105 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCENE_TRANSFORM_STORE_H_
+#define _SCENE_TRANSFORM_STORE_H_
+
+#ifndef _VECTOR2_H_
+#include "2d/core/Vector2.h"
+#endif
+
+#ifndef _UTILITY_H_
+#include "2d/core/Utility.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// Scene-owned structure-of-arrays store for the spatials that are touched every tick and every interpolation.
+///
+/// Each scene object registered with a scene owns a dense handle into the store.  Handles are
+/// recycled by moving the last entry into the released slot so the arrays always stay contiguous
+/// and the owning scene object's handle is updated to match.
+class SceneTransformStore
+{
+private:
+    /// Pre-tick spatials.
+    Vector<F32>             mPreTickPositionX;
+    Vector<F32>             mPreTickPositionY;
+    Vector<F32>             mPreTickAngle;
+    Vector<b2AABB>          mPreTickAABB;
+
+    /// Tick spatials (as of the end of the last integration).
+    Vector<F32>             mTickPositionX;
+    Vector<F32>             mTickPositionY;
+    Vector<F32>             mTickAngle;
+
+    /// Render spatials.
+    Vector<F32>             mRenderPositionX;
+    Vector<F32>             mRenderPositionY;
+    Vector<F32>             mRenderAngle;
+
+    /// Spatial dirty flags.
+    Vector<U8>              mSpatialDirty;
+
+    /// Owners.
+    typeSceneObjectVector   mSceneObjects;
+
+public:
+    SceneTransformStore();
+    ~SceneTransformStore() {}
+
+    /// Handles.
+    S32                     allocate( SceneObject* pSceneObject );
+    void                    release( const S32 handle );
+    inline U32              getCount( void ) const                                  { return (U32)mSceneObjects.size(); }
+    inline SceneObject*     getSceneObject( const S32 handle ) const                { return mSceneObjects[handle]; }
+
+    /// Spatials.
+    void                    resetSpatials( const S32 handle, const b2Vec2& position, const F32 angle, const b2AABB& aabb );
+    inline void             setPreTickSpatials( const S32 handle, const b2AABB& aabb )
+                            {
+                                mPreTickPositionX[handle] = mRenderPositionX[handle] = mTickPositionX[handle];
+                                mPreTickPositionY[handle] = mRenderPositionY[handle] = mTickPositionY[handle];
+                                mPreTickAngle[handle]     = mRenderAngle[handle]     = mTickAngle[handle];
+                                mPreTickAABB[handle]      = aabb;
+                            }
+    inline void             setTickSpatials( const S32 handle, const b2Vec2& position, const F32 angle )
+                            {
+                                mTickPositionX[handle] = position.x;
+                                mTickPositionY[handle] = position.y;
+                                mTickAngle[handle]     = angle;
+                            }
+    inline Vector2          getPreTickPosition( const S32 handle ) const            { return Vector2( mPreTickPositionX[handle], mPreTickPositionY[handle] ); }
+    inline F32              getPreTickAngle( const S32 handle ) const               { return mPreTickAngle[handle]; }
+    inline const b2AABB&    getPreTickAABB( const S32 handle ) const                { return mPreTickAABB[handle]; }
+    inline Vector2          getTickPosition( const S32 handle ) const               { return Vector2( mTickPositionX[handle], mTickPositionY[handle] ); }
+    inline F32              getTickAngle( const S32 handle ) const                  { return mTickAngle[handle]; }
+    inline Vector2          getRenderPosition( const S32 handle ) const             { return Vector2( mRenderPositionX[handle], mRenderPositionY[handle] ); }
+    inline F32              getRenderAngle( const S32 handle ) const                { return mRenderAngle[handle]; }
+    inline void             setSpatialDirty( const S32 handle, const bool status )  { mSpatialDirty[handle] = status ? 1 : 0; }
+    inline bool             getSpatialDirty( const S32 handle ) const               { return mSpatialDirty[handle] != 0; }
+
+    /// Interpolation.
+    void                    interpolate( const F32 timeDelta );
+};
+
+#endif // _SCENE_TRANSFORM_STORE_H_
@@ -116,6 +116,109 @@ ConsoleMethodWithDocs(Scene, getPositionIterations, ConsoleInt, 2, 2, ())
 
 //-----------------------------------------------------------------------------
 
+/*! Sets the fixed rate the physics is stepped at independently of the scene tick rate.
+    Each tick takes as many physics sub-steps as are required to keep up with the rate.
+    @param stepRate The physics step rate in Hz.  Zero (the default) steps the physics once per tick.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setPhysicsStepRate, ConsoleVoid, 3, 3, (float stepRate))
+{
+    object->setPhysicsStepRate( dAtof(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the fixed rate the physics is stepped at.
+    @return The physics step rate in Hz.  Zero indicates the physics is stepped once per tick.
+*/
+ConsoleMethodWithDocs(Scene, getPhysicsStepRate, ConsoleFloat, 2, 2, ())
+{
+    return object->getPhysicsStepRate();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets the maximum number of physics sub-steps taken per tick.
+    If more sub-steps are required to keep up with the physics step rate then the physics time is discarded rather than caught up.
+    @param subSteps The maximum number of physics sub-steps taken per tick (minimum of one).
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setMaxPhysicsSubSteps, ConsoleVoid, 3, 3, (int subSteps))
+{
+    object->setMaxPhysicsSubSteps( dAtoi(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the maximum number of physics sub-steps taken per tick.
+    @return The maximum number of physics sub-steps taken per tick.
+*/
+ConsoleMethodWithDocs(Scene, getMaxPhysicsSubSteps, ConsoleInt, 2, 2, ())
+{
+    return object->getMaxPhysicsSubSteps();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets whether the physics broad-phase is refit in bulk each step rather than updated per body.
+    The bulk mode refits the broad-phase tree once all the bodies have moved and rebuilds it when it degrades.  It is faster when many bodies move every step.
+    @param bulk Whether the bulk broad-phase is enabled or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setBulkBroadPhase, ConsoleVoid, 3, 3, (bool bulk))
+{
+    object->setBulkBroadPhase( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the physics broad-phase is refit in bulk each step rather than updated per body.
+    @return Whether the bulk broad-phase is enabled or not.
+*/
+ConsoleMethodWithDocs(Scene, getBulkBroadPhase, ConsoleBool, 2, 2, ())
+{
+    return object->getBulkBroadPhase();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets the budget for continuous physics (TOI) within each physics step.
+    Once either limit is reached, the remaining time-of-impact events are skipped for that step which bounds the worst-case step time when many fast bodies are present.
+    @param maxSubSteps The maximum number of TOI sub-steps solved per physics step.  Zero is unlimited.
+    @param maxTime The maximum time (in milliseconds) spent on TOI per physics step.  Zero is unlimited (default).
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setTOIBudget, ConsoleVoid, 3, 4, (int maxSubSteps, [float maxTime]))
+{
+    object->setTOIMaxSubSteps( dAtoi(argv[2]) );
+    object->setTOIMaxTime( argc > 3 ? dAtof(argv[3]) : 0.0f );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the budget for continuous physics (TOI) within each physics step.
+    @return The maximum TOI sub-steps and maximum TOI time (in milliseconds) formatted as "maxSubSteps maxTime".
+*/
+ConsoleMethodWithDocs(Scene, getTOIBudget, ConsoleString, 2, 2, ())
+{
+    char* pBuffer = Con::getReturnBuffer(32);
+    dSprintf( pBuffer, 32, "%d %g", object->getTOIMaxSubSteps(), object->getTOIMaxTime() );
+    return pBuffer;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of physics steps that have exhausted the continuous physics (TOI) budget.
+    @return The number of physics steps that have exhausted the TOI budget.
+*/
+ConsoleMethodWithDocs(Scene, getTOIBudgetExhaustedCount, ConsoleInt, 2, 2, ())
+{
+    b2World* pWorld = object->getWorld();
+    return pWorld != NULL ? pWorld->GetTOIBudgetExhaustedCount() : 0;
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Add the SceneObject to the scene.
     @param sceneObject The SceneObject to add to the scene.
     @return No return value.
@@ -182,6 +285,111 @@ ConsoleMethodWithDocs(Scene, clear, ConsoleVoid, 2, 3, ([deleteObjects]))
 
 //-----------------------------------------------------------------------------
 
+/*! Spawns a pooled scene object in the scene, reusing an idle one if available.
+    The spawned object is reset from the template and enabled.  Safe-deleting a pooled object releases it back to the pool rather than deleting it.
+    @param template The SceneObject used as the template for the spawned object.  It is typically not in any scene.
+    @return The spawned SceneObject Id or nothing if it could not be spawned.
+*/
+ConsoleMethodWithDocs(Scene, spawnPooled, ConsoleString, 3, 3, (template))
+{
+    // Find the template.
+    SceneObject* pTemplate = dynamic_cast<SceneObject*>(Sim::findObject(argv[2]));
+
+    // Did we find the template?
+    if ( !pTemplate )
+    {
+        // No, so warn.
+        Con::warnf("Scene::spawnPooled() - Could not find the specified template '%s'.", argv[2]);
+        return StringTable->EmptyString;
+    }
+
+    // Spawn the object.
+    SceneObject* pSceneObject = object->getScenePool().spawn( pTemplate );
+
+    return pSceneObject == NULL ? StringTable->EmptyString : pSceneObject->getIdString();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Creates idle pooled scene objects for the template until the specified count are available.
+    @param template The SceneObject used as the template for the pooled objects.
+    @param count The number of idle pooled objects required.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, prewarmPool, ConsoleVoid, 4, 4, (template, count))
+{
+    // Find the template.
+    SceneObject* pTemplate = dynamic_cast<SceneObject*>(Sim::findObject(argv[2]));
+
+    // Did we find the template?
+    if ( !pTemplate )
+    {
+        // No, so warn.
+        Con::warnf("Scene::prewarmPool() - Could not find the specified template '%s'.", argv[2]);
+        return;
+    }
+
+    // Fetch the count.
+    const S32 count = dAtoi(argv[3]);
+
+    // Prewarm the pool.
+    object->getScenePool().prewarm( pTemplate, count < 0 ? 0 : (U32)count );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Deletes the idle pooled scene objects.
+    @param template The SceneObject template whose idle pooled objects are deleted.  If not specified then all idle pooled objects are deleted.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, clearPool, ConsoleVoid, 2, 3, ([template]))
+{
+    // Clear all the pools if no template specified.
+    if ( argc < 3 )
+    {
+        object->getScenePool().clear();
+        return;
+    }
+
+    // Find the template.
+    SimObject* pTemplate = Sim::findObject(argv[2]);
+
+    // Did we find the template?
+    if ( !pTemplate )
+    {
+        // No, so warn.
+        Con::warnf("Scene::clearPool() - Could not find the specified template '%s'.", argv[2]);
+        return;
+    }
+
+    // Clear the pool.
+    object->getScenePool().clear( pTemplate->getId() );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the count of idle pooled scene objects for the template.
+    @param template The SceneObject template.
+    @return The count of idle pooled scene objects for the template.
+*/
+ConsoleMethodWithDocs(Scene, getPoolIdleCount, ConsoleInt, 3, 3, (template))
+{
+    // Find the template.
+    SimObject* pTemplate = Sim::findObject(argv[2]);
+
+    // Did we find the template?
+    if ( !pTemplate )
+    {
+        // No, so warn.
+        Con::warnf("Scene::getPoolIdleCount() - Could not find the specified template '%s'.", argv[2]);
+        return 0;
+    }
+
+    return object->getScenePool().getIdleCount( pTemplate->getId() );
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Gets the count of scene objects in the scnee.
     @return Returns the number of scene objects in current scene as an integer.
 */
@@ -236,15 +444,30 @@ ConsoleMethodWithDocs(Scene, getObject, ConsoleInt, 3, 3, (sceneObjectIndex))
 //-----------------------------------------------------------------------------
 
 /*! Gets the Scene Object-List.
+    The objects are found from the scene layer and group indices so selecting a few groups or layers does not walk the whole scene.
+    @param sceneGroupMask Optional scene group mask.  (-1) or empty string selects all groups.
+    @param sceneLayerMask Optional scene layer mask.  (-1) or empty string selects all layers.
     @return Returns a string with a list of object IDs
 */
-ConsoleMethodWithDocs(Scene, getSceneObjectList, ConsoleString, 2, 2, ())
+ConsoleMethodWithDocs(Scene, getSceneObjectList, ConsoleString, 2, 4, ([sceneGroupMask], [sceneLayerMask]))
 {
+    // Calculate scene group mask.
+    U32 sceneGroupMask = MASK_ALL;
+    if ( argc > 2 && *argv[2] != 0 )
+        sceneGroupMask = dAtoi(argv[2]);
+
+    // Calculate scene layer mask.
+    U32 sceneLayerMask = MASK_ALL;
+    if ( argc > 3 && *argv[3] != 0 )
+        sceneLayerMask = dAtoi(argv[3]);
+
     // Scene Object-List.
     Vector<SceneObject*> objList;
 
     // Finish here if there are no scene objects.
-    U32 objCount = object->getSceneObjects( objList );
+    U32 objCount = ( sceneGroupMask == MASK_ALL && sceneLayerMask == MASK_ALL ) ?
+        object->getSceneObjects( objList ) :
+        object->querySceneObjects( objList, sceneLayerMask, sceneGroupMask );
     if( objCount == 0 )
         return NULL;
 
@@ -305,18 +528,33 @@ ConsoleMethodWithDocs(Scene, getAssetPreload, ConsoleString, 3, 3, (index))
 
 //-----------------------------------------------------------------------------
 
+/*! Gets the number of assets set to preload that are still being acquired asynchronously.
+    @return The number of assets still being acquired.
+*/
+ConsoleMethodWithDocs(Scene, getPendingAssetPreloadCount, ConsoleInt, 2, 2, ())
+{
+    return object->getPendingAssetPreloadCount();
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Adds the asset Id so that it is preloaded when the scene is loaded.
-    The asset loaded immediately by this operation.  Duplicate assets are ignored.
+    The asset loaded immediately by this operation unless acquired asynchronously in which case it is added
+    as a preload once it and its dependencies have loaded over subsequent frames.  Duplicate assets are ignored.
     @param assetId The asset Id to be added.
+    @param async Whether to acquire the asset asynchronously or not.  Optional: Defaults to false.
     @return No return value.
 */
-ConsoleMethodWithDocs(Scene, addAssetPreload, ConsoleVoid, 3, 3, (assetId))
+ConsoleMethodWithDocs(Scene, addAssetPreload, ConsoleVoid, 3, 4, (assetId, [async]))
 {
     // Fetch asset Id.
     const char* pAssetId = argv[2];
 
+    // Fetch async flag.
+    const bool async = argc >= 4 ? dAtob(argv[3]) : false;
+
     // Add asset preload.
-    object->addAssetPreload( pAssetId );
+    object->addAssetPreload( pAssetId, async );
 }
 
 //-----------------------------------------------------------------------------
@@ -3492,6 +3730,53 @@ ConsoleMethodWithDocs(Scene, getLayerSortMode, ConsoleString, 3, 3, (layer))
 
 //-----------------------------------------------------------------------------
 
+/*! Sets whether the specified layer is static or not.
+    The render output of a static layer is cached and replayed whilst nothing in the layer changes and the view stays within the cached area.
+    @param layer The layer to modify.
+    @param isStatic Whether the layer is static or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setLayerStatic, ConsoleVoid, 4, 4, (layer, isStatic))
+{
+    object->setLayerStatic( dAtoi(argv[2]), dAtob(argv[3]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the specified layer is static or not.
+    @param layer The layer to retrieve.
+    @return Whether the specified layer is static or not.
+*/
+ConsoleMethodWithDocs(Scene, getLayerStatic, ConsoleBool, 3, 3, (layer))
+{
+    return object->getLayerStatic( dAtoi(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Discards the cached render output of the specified static layer so it is captured again.
+    Use this when something the cache cannot detect changes how objects in the layer render.
+    @param layer The layer to invalidate.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, invalidateLayerRenderCache, ConsoleVoid, 3, 3, (layer))
+{
+    // Fetch the layer.
+    const U32 layer = dAtoi(argv[2]);
+
+    // Is the layer valid?
+    if ( layer >= MAX_LAYERS_SUPPORTED )
+    {
+        // No, so warn.
+        Con::warnf( "Scene::invalidateLayerRenderCache() - Layer '%d' is out of range.", layer );
+        return;
+    }
+
+    object->invalidateLayerRenderCache( layer );
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Resets the debug statistics.
     @return No return value.
 */
@@ -3542,6 +3827,77 @@ ConsoleMethodWithDocs(Scene, getFrameCount, ConsoleInt, 2, 2, ())
 
 //-----------------------------------------------------------------------------
 
+/*! Gets the timings for a tick phase over the most recent ticks.
+    @param tickPhase The tick phase of either "deletes", "preintegrate", "controllers", "worldstep", "integrate" or "contacts".
+    @return The timings as "last p50 p95 p99 max overBudgetCount" with the times in milliseconds.
+*/
+ConsoleMethodWithDocs(Scene, getTickPhaseStats, ConsoleString, 3, 3, (tickPhase))
+{
+    // Fetch the tick phase.
+    const DebugStats::TickPhase tickPhase = Scene::getTickPhaseEnum( argv[2] );
+
+    // Finish if invalid.
+    if ( tickPhase == DebugStats::TICK_PHASE_INVALID )
+        return StringTable->EmptyString;
+
+    // Fetch the tick phase stats.
+    const TickPhaseStats& tickPhaseStats = object->getDebugStats().tickPhases[tickPhase];
+
+    // Format the stats.
+    char* pBuffer = Con::getReturnBuffer(128);
+    dSprintf( pBuffer, 128, "%g %g %g %g %g %d",
+        tickPhaseStats.last,
+        tickPhaseStats.getPercentile( 50.0f ),
+        tickPhaseStats.getPercentile( 95.0f ),
+        tickPhaseStats.getPercentile( 99.0f ),
+        tickPhaseStats.max,
+        tickPhaseStats.overBudgetCount );
+
+    return pBuffer;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets the time budget for a tick phase.
+    Each tick where the phase takes longer than its budget increases the phase over-budget count.
+    @param tickPhase The tick phase of either "deletes", "preintegrate", "controllers", "worldstep", "integrate" or "contacts".
+    @param budget The time budget in milliseconds.  Zero disables the budget.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setTickPhaseBudget, ConsoleVoid, 4, 4, (tickPhase, budget))
+{
+    // Fetch the tick phase.
+    const DebugStats::TickPhase tickPhase = Scene::getTickPhaseEnum( argv[2] );
+
+    // Finish if invalid.
+    if ( tickPhase == DebugStats::TICK_PHASE_INVALID )
+        return;
+
+    // Set the budget.
+    const F32 budget = dAtof(argv[3]);
+    object->getDebugStats().tickPhases[tickPhase].budget = budget < 0.0f ? 0.0f : budget;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the time budget for a tick phase.
+    @param tickPhase The tick phase of either "deletes", "preintegrate", "controllers", "worldstep", "integrate" or "contacts".
+    @return The time budget in milliseconds.  Zero indicates no budget.
+*/
+ConsoleMethodWithDocs(Scene, getTickPhaseBudget, ConsoleFloat, 3, 3, (tickPhase))
+{
+    // Fetch the tick phase.
+    const DebugStats::TickPhase tickPhase = Scene::getTickPhaseEnum( argv[2] );
+
+    // Finish if invalid.
+    if ( tickPhase == DebugStats::TICK_PHASE_INVALID )
+        return 0.0f;
+
+    return object->getDebugStats().tickPhases[tickPhase].budget;
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Sets whether render batching is enabled or not.
     @param enabled Whether render batching is enabled or not.
     return No return value.
@@ -3568,6 +3924,318 @@ ConsoleMethodWithDocs(Scene, getBatchingEnabled, ConsoleBool, 2, 2, ())
 
 //-----------------------------------------------------------------------------
 
+/*! Sets whether render batches are streamed through vertex buffer objects when the device supports them.
+    Client arrays are always used on GLES devices.
+    @param enabled Whether vertex buffers are enabled or not.
+    return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setBatchVertexBuffersEnabled, ConsoleVoid, 3, 3, ( bool enabled ))
+{
+    // Fetch args.
+    const bool enabled = dAtob(argv[2]);
+
+    // Sets batch vertex buffers enabled.
+    object->setBatchVertexBuffersEnabled( enabled );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether render batches are streamed through vertex buffer objects when the device supports them.
+    return Whether vertex buffers are enabled or not.
+*/
+ConsoleMethodWithDocs(Scene, getBatchVertexBuffersEnabled, ConsoleBool, 2, 2, ())
+{
+    // Gets batch vertex buffers enabled.
+    return object->getBatchVertexBuffersEnabled();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Dumps the batch breaks of the next scene render to the console.
+    Each flush is listed with its reason, the triangles it drew and the object that caused it.
+    return No return value.
+*/
+ConsoleMethodWithDocs(Scene, dumpBatchBreaks, ConsoleVoid, 2, 2, ())
+{
+    // Request the dump.
+    object->requestBatchBreakDump();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets whether the spatial part of object integration is split across worker threads or not.
+    Script callbacks are always performed on the main thread.
+    The worker count is controlled by "$pref::ThreadPool::workerCount" when first used.
+    @param parallelTick Whether parallel ticking is enabled or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setParallelTick, ConsoleVoid, 3, 3, ( bool parallelTick ))
+{
+    object->setParallelTick( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the spatial part of object integration is split across worker threads or not.
+    @return Whether parallel ticking is enabled or not.
+*/
+ConsoleMethodWithDocs(Scene, getParallelTick, ConsoleBool, 2, 2, ())
+{
+    return object->getParallelTick();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets whether scene controllers that allow it apply their forces across worker threads or not.
+    The ambient force, point force and buoyancy controllers allow it.  Small groups of objects are always processed serially.
+    @param parallelControllers Whether parallel controllers are enabled or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setParallelControllers, ConsoleVoid, 3, 3, ( bool parallelControllers ))
+{
+    object->setParallelControllers( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether scene controllers that allow it apply their forces across worker threads or not.
+    @return Whether parallel controllers are enabled or not.
+*/
+ConsoleMethodWithDocs(Scene, getParallelControllers, ConsoleBool, 2, 2, ())
+{
+    return object->getParallelControllers();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets whether the particles of each particle emitter are integrated across worker threads or not.
+    Each emitter has its own random stream so the results are the same either way.  Particle creation and expiry always happen serially.
+    The worker count is controlled by "$pref::ThreadPool::workerCount" when first used.
+    @param parallelParticles Whether parallel particle integration is enabled or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setParallelParticles, ConsoleVoid, 3, 3, ( bool parallelParticles ))
+{
+    object->setParallelParticles( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the particles of each particle emitter are integrated across worker threads or not.
+    @return Whether parallel particle integration is enabled or not.
+*/
+ConsoleMethodWithDocs(Scene, getParallelParticles, ConsoleBool, 2, 2, ())
+{
+    return object->getParallelParticles();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets whether the poses of skeleton objects are updated across worker threads or not.
+    Animation events are queued and raised as "onAnimationEvent" callbacks after the poses are updated so the results are the same either way.
+    The worker count is controlled by "$pref::ThreadPool::workerCount" when first used.
+    @param parallelSkeletons Whether parallel skeleton updates are enabled or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setParallelSkeletons, ConsoleVoid, 3, 3, ( bool parallelSkeletons ))
+{
+    object->setParallelSkeletons( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the poses of skeleton objects are updated across worker threads or not.
+    @return Whether parallel skeleton updates are enabled or not.
+*/
+ConsoleMethodWithDocs(Scene, getParallelSkeletons, ConsoleBool, 2, 2, ())
+{
+    return object->getParallelSkeletons();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets whether independent physics islands are solved across worker threads or not.
+    Islands are groups of bodies connected by touching contacts or joints.  The simulation results and the order of the collision callbacks are the same either way.
+    The worker count is controlled by "$pref::ThreadPool::workerCount" when first used.
+    @param parallelIslands Whether parallel island solving is enabled or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setParallelIslands, ConsoleVoid, 3, 3, ( bool parallelIslands ))
+{
+    object->setParallelIslands( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether independent physics islands are solved across worker threads or not.
+    @return Whether parallel island solving is enabled or not.
+*/
+ConsoleMethodWithDocs(Scene, getParallelIslands, ConsoleBool, 2, 2, ())
+{
+    return object->getParallelIslands();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets whether physics contact manifolds are computed across worker threads or not.
+    The collision callbacks are still raised on the main thread in the same order either way.
+    The worker count is controlled by "$pref::ThreadPool::workerCount" when first used.
+    @param parallelContacts Whether parallel contact updates are enabled or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setParallelContacts, ConsoleVoid, 3, 3, ( bool parallelContacts ))
+{
+    object->setParallelContacts( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether physics contact manifolds are computed across worker threads or not.
+    @return Whether parallel contact updates are enabled or not.
+*/
+ConsoleMethodWithDocs(Scene, getParallelContacts, ConsoleBool, 2, 2, ())
+{
+    return object->getParallelContacts();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets whether the render requests of each layer and batch are sorted across worker threads or not.
+    Requests are still compiled and submitted on the main thread in the same order either way.
+    The worker count is controlled by "$pref::ThreadPool::workerCount" when first used.
+    @param parallelRender Whether parallel render sorting is enabled or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setParallelRender, ConsoleVoid, 3, 3, ( bool parallelRender ))
+{
+    object->setParallelRender( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the render requests of each layer and batch are sorted across worker threads or not.
+    @return Whether parallel render sorting is enabled or not.
+*/
+ConsoleMethodWithDocs(Scene, getParallelRender, ConsoleBool, 2, 2, ())
+{
+    return object->getParallelRender();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets whether dormant objects are skipped when ticking or not.
+    An object is dormant when its body is asleep and it has no move-to/rotate-to, lifetime, callbacks, attachments, components or animation to update.
+    Dormant objects are woken by contacts or by explicitly waking them with "setAwake()".
+    @param culling Whether dormant objects are skipped or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setDormantCulling, ConsoleVoid, 3, 3, ( bool culling ))
+{
+    object->setDormantCulling( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether dormant objects are skipped when ticking or not.
+    @return Whether dormant objects are skipped or not.
+*/
+ConsoleMethodWithDocs(Scene, getDormantCulling, ConsoleBool, 2, 2, ())
+{
+    return object->getDormantCulling();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets how far back the scene can be rewound for lag-compensated queries.
+    The scene records the transforms of its moving objects over this time.
+    @param rewindTime The time in seconds.  Zero keeps no history.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setRewindTime, ConsoleVoid, 3, 3, ( float rewindTime ))
+{
+    object->setRewindTime( dAtof(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets how far back the scene can be rewound for lag-compensated queries.
+    @return The time in seconds.
+*/
+ConsoleMethodWithDocs(Scene, getRewindTime, ConsoleFloat, 2, 2, ())
+{
+    return object->getRewindTime();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Rewinds the physics bodies and world query of moving objects to where they were at a past scene time.
+    This allows a server to test a client's shot (with "pickRay()" etc) against the scene the client saw.
+    Rendering is unaffected.  The scene must be restored with "restoreRewind()" before it next ticks.
+    @param sceneTime The scene time to rewind to.  It is clamped to the recorded history.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, rewind, ConsoleVoid, 3, 3, ( float sceneTime ))
+{
+    object->rewind( dAtof(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Restores the objects moved by "rewind()" to their current transforms.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, restoreRewind, ConsoleVoid, 2, 2, ())
+{
+    object->restoreRewind();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets how far behind the scene time objects with snapshots are played back.
+    The delay should cover the time between snapshots arriving so there is always a later snapshot to interpolate towards.
+    @param delay The delay in seconds.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setSnapshotDelay, ConsoleVoid, 3, 3, ( float delay ))
+{
+    object->setSnapshotDelay( dAtof(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets how far behind the scene time objects with snapshots are played back.
+    @return The delay in seconds.
+*/
+ConsoleMethodWithDocs(Scene, getSnapshotDelay, ConsoleFloat, 2, 2, ())
+{
+    return object->getSnapshotDelay();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets whether the scene is ticked by the scene scheduler or not.
+    The scheduler ticks all scheduled scenes together, stepping their physics concurrently across worker threads.
+    Script callbacks for scheduled scenes are still performed on the main thread once all the physics has been stepped.
+    @param scheduledTick Whether the scene is ticked by the scene scheduler or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setScheduledTick, ConsoleVoid, 3, 3, ( bool scheduledTick ))
+{
+    object->setScheduledTick( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the scene is ticked by the scene scheduler or not.
+    @return Whether the scene is ticked by the scene scheduler or not.
+*/
+ConsoleMethodWithDocs(Scene, getScheduledTick, ConsoleBool, 2, 2, ())
+{
+    return object->getScheduledTick();
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Sets whether this is an editor scene.
     @return No return value.
 */
@@ -3589,4 +4257,50 @@ ConsoleMethodWithDocs(Scene, create, ConsoleString, 3, 3, (type))
     return pSceneObject == NULL ? NULL : pSceneObject->getIdString();
 }
 
+//-----------------------------------------------------------------------------
+
+/*! Sets the listener that the scene audio emitters are attenuated and panned against.
+    The listener is either a fixed position or a scene object whose position is followed.
+    @param listener Either a position formatted as either "x y" or (x, y) or a scene object.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setAudioListener, ConsoleVoid, 3, 4, (listener))
+{
+    // (x, y)
+    if ( argc == 4 )
+    {
+        object->setAudioListener( Vector2( dAtof(argv[2]), dAtof(argv[3]) ) );
+        return;
+    }
+
+    // ("x y")
+    if ( Utility::mGetStringElementCount(argv[2]) == 2 )
+    {
+        object->setAudioListener( Utility::mGetStringElementVector(argv[2]) );
+        return;
+    }
+
+    // Find scene object.
+    SceneObject* pSceneObject = dynamic_cast<SceneObject*>( Sim::findObject(argv[2]) );
+
+    // Sanity!
+    if ( !pSceneObject )
+    {
+        Con::warnf("Scene::setAudioListener() - Could not find scene object '%s'.", argv[2]);
+        return;
+    }
+
+    object->setAudioListener( pSceneObject );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the position of the listener that the scene audio emitters are attenuated and panned against.
+    @return The listener position formatted as "x y".
+*/
+ConsoleMethodWithDocs(Scene, getAudioListener, ConsoleString, 2, 2, ())
+{
+    return object->getAudioListenerPosition().scriptThis();
+}
+
 ConsoleMethodGroupEndWithDocs(Scene)
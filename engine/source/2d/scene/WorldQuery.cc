@@ -30,19 +30,232 @@
 #include "2d/sceneobject/SceneObject.h"
 #endif
 
+#ifndef _PLATFORM_THREADS_THREADPOOL_H_
+#include "platform/threads/threadPool.h"
+#endif
+
 // Debug Profiling.
 #include "debug/profiler.h"
 
 //-----------------------------------------------------------------------------
 
+#define WORLDQUERY_RAY_BATCH_CHUNK_SIZE     64
+
+//-----------------------------------------------------------------------------
+
+/// Finds the closest scene object collision shape hit by a ray.
+/// This only reads the world so many of these can be used concurrently.
+class WorldQueryClosestRay : public b2RayCastCallback
+{
+public:
+    WorldQueryClosestRay( const WorldQuery* pWorldQuery, WorldQueryResult& result ) :
+        mpWorldQuery( pWorldQuery ),
+        mResult( result )
+    {
+    }
+
+    virtual F32 ReportFixture( b2Fixture* fixture, const b2Vec2& point, const b2Vec2& normal, F32 fraction )
+    {
+        // If not the correct proxy then ignore.
+        PhysicsProxy* pPhysicsProxy = static_cast<PhysicsProxy*>(fixture->GetBody()->GetUserData());
+        if ( pPhysicsProxy->getPhysicsProxyType() != PhysicsProxy::PHYSIC_PROXY_SCENEOBJECT )
+            return -1.0f;
+
+        // Fetch scene object.
+        SceneObject* pSceneObject = static_cast<SceneObject*>(pPhysicsProxy);
+
+        // Ignore if filtered.
+        if ( mpWorldQuery->isFiltered( pSceneObject ) )
+            return -1.0f;
+
+        // Keep the hit and clip the ray to it.
+        mResult = WorldQueryResult( pSceneObject, point, normal, fraction, (U32)pSceneObject->getCollisionShapeIndex( fixture ) );
+        return fraction;
+    }
+
+private:
+    const WorldQuery*   mpWorldQuery;
+    WorldQueryResult&   mResult;
+};
+
+//-----------------------------------------------------------------------------
+
+/// The context for a batched ray query range.
+struct WorldQueryRayBatch
+{
+    WorldQuery*             mpWorldQuery;
+    const WorldQueryRay*    mpRays;
+    WorldQueryResult*       mpResults;
+};
+
+//-----------------------------------------------------------------------------
+
+/// Updates the regions a scene object proxy overlaps after the proxy was added, moved or removed.
+/// Regions the new fat AABB overlaps gain the object and any others found lose it.
+class WorldQueryRegionPairs
+{
+public:
+    WorldQueryRegionPairs( const b2DynamicTree& regionTree, SceneObject* pSceneObject, const b2AABB* pFatAABB ) :
+        mRegionTree( regionTree ),
+        mpSceneObject( pSceneObject ),
+        mpFatAABB( pFatAABB )
+    {
+    }
+
+    bool QueryCallback( S32 proxyId )
+    {
+        // Fetch the region.
+        WorldQueryRegion* pRegion = static_cast<WorldQueryRegion*>( mRegionTree.GetUserData( proxyId ) );
+
+        // Add or remove the object.
+        if ( mpFatAABB != NULL && b2TestOverlap( *mpFatAABB, pRegion->mRegionAABB ) )
+            pRegion->addRegionObject( mpSceneObject );
+        else
+            pRegion->removeRegionObject( mpSceneObject );
+
+        return true;
+    }
+
+private:
+    const b2DynamicTree&    mRegionTree;
+    SceneObject*            mpSceneObject;
+    const b2AABB*           mpFatAABB;
+};
+
+//-----------------------------------------------------------------------------
+
+/// Adds every scene object proxy overlapping a region to the region.
+class WorldQueryRegionFill
+{
+public:
+    WorldQueryRegionFill( const WorldQuery* pWorldQuery, WorldQueryRegion* pRegion ) :
+        mpWorldQuery( pWorldQuery ),
+        mpRegion( pRegion )
+    {
+    }
+
+    bool QueryCallback( S32 proxyId )
+    {
+        // If not the correct proxy then ignore.
+        PhysicsProxy* pPhysicsProxy = static_cast<PhysicsProxy*>( mpWorldQuery->getProxyUserData( proxyId ) );
+        if ( pPhysicsProxy->getPhysicsProxyType() != PhysicsProxy::PHYSIC_PROXY_SCENEOBJECT )
+            return true;
+
+        // Add the object.
+        mpRegion->addRegionObject( static_cast<SceneObject*>(pPhysicsProxy) );
+
+        return true;
+    }
+
+private:
+    const WorldQuery*   mpWorldQuery;
+    WorldQueryRegion*   mpRegion;
+};
+
+//-----------------------------------------------------------------------------
+
+WorldQueryRegion::WorldQueryRegion() :
+    mpWorldQuery( NULL ),
+    mRegionProxyId( -1 )
+{
+    mRegionAABB.lowerBound.SetZero();
+    mRegionAABB.upperBound.SetZero();
+
+    VECTOR_SET_ASSOCIATION( mRegionObjects );
+}
+
+//-----------------------------------------------------------------------------
+
+WorldQueryRegion::~WorldQueryRegion()
+{
+    // Remove from the world query.
+    if ( mpWorldQuery != NULL )
+        mpWorldQuery->removeRegion( this );
+}
+
+//-----------------------------------------------------------------------------
+
+void WorldQueryRegion::setRegion( WorldQuery* pWorldQuery, const b2AABB& aabb )
+{
+    // Sanity!
+    AssertFatal( pWorldQuery != NULL, "WorldQueryRegion::setRegion() - Invalid world query." );
+
+    // Move the region if it's already in the world query.
+    if ( mpWorldQuery == pWorldQuery )
+    {
+        pWorldQuery->moveRegion( this, aabb );
+        return;
+    }
+
+    // Remove from any other world query.
+    if ( mpWorldQuery != NULL )
+        mpWorldQuery->removeRegion( this );
+
+    pWorldQuery->addRegion( this, aabb );
+}
+
+//-----------------------------------------------------------------------------
+
+void WorldQueryRegion::clearRegion( void )
+{
+    if ( mpWorldQuery != NULL )
+        mpWorldQuery->removeRegion( this );
+}
+
+//-----------------------------------------------------------------------------
+
+void WorldQueryRegion::addRegionObject( SceneObject* pSceneObject )
+{
+    // Finish if already in the region.
+    if ( mRegionObjectIndices.contains( pSceneObject ) )
+        return;
+
+    // Add the object.
+    mRegionObjectIndices.insert( pSceneObject, (U32)mRegionObjects.size() );
+    mRegionObjects.push_back( pSceneObject );
+
+    onRegionEnter( pSceneObject );
+}
+
+//-----------------------------------------------------------------------------
+
+void WorldQueryRegion::removeRegionObject( SceneObject* pSceneObject )
+{
+    // Finish if not in the region.
+    typeRegionObjectHash::iterator indexItr = mRegionObjectIndices.find( pSceneObject );
+    if ( indexItr == mRegionObjectIndices.end() )
+        return;
+
+    // Fetch the object index.
+    const U32 index = indexItr->value;
+    mRegionObjectIndices.erase( indexItr );
+
+    // Move the last object into the slot.
+    const U32 lastIndex = (U32)mRegionObjects.size() - 1;
+    if ( index != lastIndex )
+    {
+        SceneObject* pLastObject = mRegionObjects[lastIndex];
+        mRegionObjects[index] = pLastObject;
+        mRegionObjectIndices[pLastObject] = index;
+    }
+    mRegionObjects.pop_back();
+
+    onRegionLeave( pSceneObject );
+}
+
+//-----------------------------------------------------------------------------
+
 WorldQuery::WorldQuery( Scene* pScene ) :
         mpScene(pScene),
+        mUseSpatialHash(false),
+        mProxyCount(0),
         mIsRaycastQueryResult(false),
         mMasterQueryKey(0),
         mCheckPoint(false),
         mCheckAABB(false),
         mCheckOOBB(false),
-        mCheckCircle(false)
+        mCheckCircle(false),
+        mpBatchResultOffsets(NULL)
 {
     // Set debug associations.
     for ( U32 n = 0; n < MAX_LAYERS_SUPPORTED; n++ )
@@ -50,6 +263,7 @@ WorldQuery::WorldQuery( Scene* pScene ) :
         VECTOR_SET_ASSOCIATION( mLayeredQueryResults[n] );
     }
     VECTOR_SET_ASSOCIATION( mQueryResults );
+    VECTOR_SET_ASSOCIATION( mBatchQueryHits );
 
     // Clear the query.
     clearQuery();
@@ -57,12 +271,37 @@ WorldQuery::WorldQuery( Scene* pScene ) :
 
 //-----------------------------------------------------------------------------
 
+WorldQuery::~WorldQuery()
+{
+    // Detach any regions left, their objects are going with us.
+    for ( S32 index = 0; index < mRegions.size(); ++index )
+    {
+        WorldQueryRegion* pRegion = mRegions[index];
+        pRegion->mpWorldQuery = NULL;
+        pRegion->mRegionProxyId = -1;
+        pRegion->mRegionObjects.clear();
+        pRegion->mRegionObjectIndices.clear();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 S32 WorldQuery::add( SceneObject* pSceneObject )
 {
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_Add);
 
-    return CreateProxy( pSceneObject->getAABB(), static_cast<PhysicsProxy*>(pSceneObject) );
+    mProxyCount++;
+
+    const S32 proxyId = mUseSpatialHash ?
+        mSpatialHash.CreateProxy( pSceneObject->getAABB(), static_cast<PhysicsProxy*>(pSceneObject) ) :
+        mTree.CreateProxy( pSceneObject->getAABB(), static_cast<PhysicsProxy*>(pSceneObject) );
+
+    // Add to any regions overlapped.
+    if ( mRegions.size() > 0 )
+        updateRegionPairs( pSceneObject, NULL, &getProxyFatAABB( proxyId ) );
+
+    return proxyId;
 }
 
 //-----------------------------------------------------------------------------
@@ -72,7 +311,22 @@ void WorldQuery::remove( SceneObject* pSceneObject )
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_Remove);
 
-    DestroyProxy( pSceneObject->getWorldProxy() );
+    mProxyCount--;
+
+    // Remove from any regions overlapped.
+    if ( mRegions.size() > 0 )
+    {
+        const b2AABB fatAABB = getProxyFatAABB( pSceneObject->getWorldProxy() );
+        updateRegionPairs( pSceneObject, &fatAABB, NULL );
+    }
+
+    if ( mUseSpatialHash )
+    {
+        mSpatialHash.DestroyProxy( pSceneObject->getWorldProxy() );
+        return;
+    }
+
+    mTree.DestroyProxy( pSceneObject->getWorldProxy() );
 }
 
 //-----------------------------------------------------------------------------
@@ -82,7 +336,141 @@ bool WorldQuery::update( SceneObject* pSceneObject, const b2AABB& aabb, const b2
     // Debug Profiling.
     PROFILE_SCOPE(WorldQuery_Update);
 
-    return MoveProxy( pSceneObject->getWorldProxy(), aabb, displacement );
+    // Fetch the proxy.
+    const S32 proxyId = pSceneObject->getWorldProxy();
+
+    // Keep the old fat AABB if regions need to see the move.
+    const bool trackRegions = mRegions.size() > 0;
+    b2AABB oldFatAABB;
+    if ( trackRegions )
+        oldFatAABB = getProxyFatAABB( proxyId );
+
+    // Move the proxy.
+    const bool moved = mUseSpatialHash ?
+        mSpatialHash.MoveProxy( proxyId, aabb, displacement ) :
+        mTree.MoveProxy( proxyId, aabb, displacement );
+
+    // Update the regions if the fat AABB changed.
+    if ( moved && trackRegions )
+        updateRegionPairs( pSceneObject, &oldFatAABB, &getProxyFatAABB( proxyId ) );
+
+    return moved;
+}
+
+//-----------------------------------------------------------------------------
+
+void WorldQuery::setSpatialHash( const F32 cellSize )
+{
+    // Sanity!
+    AssertFatal( mProxyCount == 0, "WorldQuery::setSpatialHash() - Cannot change the proxy structure whilst there are proxies." );
+
+    // Set the proxy structure.
+    mUseSpatialHash = cellSize > 0.0f;
+    if ( mUseSpatialHash )
+        mSpatialHash.SetCellSize( cellSize );
+}
+
+//-----------------------------------------------------------------------------
+
+void WorldQuery::addRegion( WorldQueryRegion* pRegion, const b2AABB& aabb )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(WorldQuery_AddRegion);
+
+    // Sanity!
+    AssertFatal( pRegion != NULL, "WorldQuery::addRegion() - Invalid region." );
+    AssertFatal( pRegion->mpWorldQuery == NULL, "WorldQuery::addRegion() - Region is already added to a world query." );
+
+    // Add the region.
+    pRegion->mpWorldQuery = this;
+    pRegion->mRegionAABB = aabb;
+    pRegion->mRegionProxyId = mRegionTree.CreateProxy( aabb, pRegion );
+    mRegions.push_back( pRegion );
+
+    // Add the objects already overlapping.
+    WorldQueryRegionFill regionFill( this, pRegion );
+    queryProxies( &regionFill, aabb );
+}
+
+//-----------------------------------------------------------------------------
+
+void WorldQuery::moveRegion( WorldQueryRegion* pRegion, const b2AABB& aabb )
+{
+    // Sanity!
+    AssertFatal( pRegion != NULL && pRegion->mpWorldQuery == this, "WorldQuery::moveRegion() - Region is not added to this world query." );
+
+    // Finish if the region has not changed.
+    const b2AABB& regionAABB = pRegion->mRegionAABB;
+    if ( regionAABB.lowerBound == aabb.lowerBound && regionAABB.upperBound == aabb.upperBound )
+        return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(WorldQuery_MoveRegion);
+
+    // Move the region.
+    pRegion->mRegionAABB = aabb;
+    mRegionTree.MoveProxy( pRegion->mRegionProxyId, aabb, b2Vec2( 0.0f, 0.0f ) );
+
+    // Remove the objects no longer overlapping.
+    typeSceneObjectVector& regionObjects = pRegion->mRegionObjects;
+    for ( S32 index = regionObjects.size() - 1; index >= 0; --index )
+    {
+        SceneObject* pSceneObject = regionObjects[index];
+        if ( !b2TestOverlap( getProxyFatAABB( pSceneObject->getWorldProxy() ), aabb ) )
+            pRegion->removeRegionObject( pSceneObject );
+    }
+
+    // Add the objects now overlapping.
+    WorldQueryRegionFill regionFill( this, pRegion );
+    queryProxies( &regionFill, aabb );
+}
+
+//-----------------------------------------------------------------------------
+
+void WorldQuery::removeRegion( WorldQueryRegion* pRegion )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(WorldQuery_RemoveRegion);
+
+    // Sanity!
+    AssertFatal( pRegion != NULL && pRegion->mpWorldQuery == this, "WorldQuery::removeRegion() - Region is not added to this world query." );
+
+    // Remove the region.
+    mRegionTree.DestroyProxy( pRegion->mRegionProxyId );
+    for ( S32 index = 0; index < mRegions.size(); ++index )
+    {
+        if ( mRegions[index] == pRegion )
+        {
+            mRegions.erase_fast( index );
+            break;
+        }
+    }
+    pRegion->mpWorldQuery = NULL;
+    pRegion->mRegionProxyId = -1;
+
+    // Remove the objects.
+    typeSceneObjectVector& regionObjects = pRegion->mRegionObjects;
+    while ( regionObjects.size() > 0 )
+        pRegion->removeRegionObject( regionObjects.last() );
+}
+
+//-----------------------------------------------------------------------------
+
+void WorldQuery::updateRegionPairs( SceneObject* pSceneObject, const b2AABB* pOldFatAABB, const b2AABB* pNewFatAABB )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(WorldQuery_UpdateRegionPairs);
+
+    // Calculate the area that covers any region the object was or is now in.
+    b2AABB queryAABB;
+    if ( pOldFatAABB != NULL && pNewFatAABB != NULL )
+        queryAABB.Combine( *pOldFatAABB, *pNewFatAABB );
+    else
+        queryAABB = pOldFatAABB != NULL ? *pOldFatAABB : *pNewFatAABB;
+
+    // Update the regions.
+    WorldQueryRegionPairs regionPairs( mRegionTree, pSceneObject, pNewFatAABB );
+    mRegionTree.Query( &regionPairs, queryAABB );
 }
 
 //-----------------------------------------------------------------------------
@@ -249,7 +637,7 @@ U32 WorldQuery::aabbQueryAABB( const b2AABB& aabb )
     mIsRaycastQueryResult = false;
 
     // Query.
-    Query( this, aabb );
+    queryProxies( this, aabb );
 
     // Inject always-in-scope.
     injectAlwaysInScope();
@@ -274,7 +662,7 @@ U32 WorldQuery::aabbQueryRay( const Vector2& point1, const Vector2& point2 )
     mCompareRay.p2 = point2;
     mCompareRay.maxFraction = 1.0f;
     mCompareTransform.SetIdentity();
-    RayCast( this, mCompareRay );
+    rayCastProxies( this, mCompareRay );
 
     // Inject always-in-scope.
     injectAlwaysInScope();
@@ -298,7 +686,7 @@ U32 WorldQuery::aabbQueryPoint( const Vector2& point )
     b2AABB aabb;
     aabb.lowerBound = point;
     aabb.upperBound = point;
-    Query( this, aabb );
+    queryProxies( this, aabb );
 
     // Inject always-in-scope.
     injectAlwaysInScope();
@@ -325,7 +713,7 @@ U32 WorldQuery::aabbQueryCircle( const Vector2& centroid, const F32 radius )
     mCompareCircleShape.m_radius = radius;
     mCompareCircleShape.ComputeAABB( &aabb, mCompareTransform, 0 );
     mCheckCircle = true;
-    Query( this, aabb );
+    queryProxies( this, aabb );
     mCheckCircle = false;
 
     // Inject always-in-scope.
@@ -356,7 +744,7 @@ U32 WorldQuery::oobbQueryAABB( const b2AABB& aabb )
     mCompareTransform.SetIdentity();
     mCheckOOBB = true;
     mCheckAABB = true;
-    Query( this, aabb );
+    queryProxies( this, aabb );
     mCheckAABB = false;
     mCheckOOBB = false;
 
@@ -384,7 +772,7 @@ U32 WorldQuery::oobbQueryRay( const Vector2& point1, const Vector2& point2 )
     mCompareRay.maxFraction = 1.0f;
     mCompareTransform.SetIdentity();
     mCheckOOBB = true;
-    RayCast( this, mCompareRay );
+    rayCastProxies( this, mCompareRay );
     mCheckOOBB = false;
 
     // Inject always-in-scope.
@@ -413,7 +801,7 @@ U32 WorldQuery::oobbQueryPoint( const Vector2& point )
     mCompareTransform.SetIdentity();
     mCheckOOBB = true;
     mCheckPoint = true;
-    Query( this, aabb );
+    queryProxies( this, aabb );
     mCheckPoint = false;
     mCheckOOBB = false;
 
@@ -443,7 +831,7 @@ U32 WorldQuery::oobbQueryCircle( const Vector2& centroid, const F32 radius )
     mCompareCircleShape.ComputeAABB( &aabb, mCompareTransform, 0 );
     mCheckOOBB = true;
     mCheckCircle = true;
-    Query( this, aabb );
+    queryProxies( this, aabb );
     mCheckCircle = false;
     mCheckOOBB = false;
 
@@ -527,6 +915,149 @@ U32 WorldQuery::anyQueryCircle( const Vector2& centroid, const F32 radius )
 
 //-----------------------------------------------------------------------------
 
+U32 WorldQuery::aabbQueryAABBBatch( const b2AABB* pAABBs, const U32 queryCount, typeWorldQueryResultVector& results, Vector<U32>& resultOffsets )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(WorldQuery_AABBQueryAABBBatch);
+
+    // Reset the result counts.
+    resultOffsets.setSize( queryCount + 1 );
+    dMemset( resultOffsets.address(), 0, resultOffsets.memSize() );
+    results.clear();
+
+    // Finish if nothing to query.
+    if ( queryCount == 0 )
+        return 0;
+
+    // Query all the AABBs in a single walk of the tree.
+    // NOTE: The hits are counted into the offset of the following query.
+    mBatchQueryHits.clear();
+    mpBatchResultOffsets = &resultOffsets;
+    queryProxiesBatch( this, pAABBs, (S32)queryCount );
+    mpBatchResultOffsets = NULL;
+
+    // Convert the counts to offsets.
+    for ( U32 queryIndex = 0; queryIndex < queryCount; ++queryIndex )
+    {
+        resultOffsets[queryIndex+1] += resultOffsets[queryIndex];
+    }
+
+    // Group the results by query.
+    const U32 hitCount = mBatchQueryHits.size();
+    results.setSize( hitCount );
+    for ( typeBatchQueryHitVector::iterator hitItr = mBatchQueryHits.begin(); hitItr != mBatchQueryHits.end(); ++hitItr )
+    {
+        results[resultOffsets[hitItr->mQueryIndex]++] = WorldQueryResult( hitItr->mpSceneObject );
+    }
+
+    // Restore the offsets which have each advanced to the start of the following query.
+    for ( U32 queryIndex = queryCount; queryIndex > 0; --queryIndex )
+    {
+        resultOffsets[queryIndex] = resultOffsets[queryIndex-1];
+    }
+    resultOffsets[0] = 0;
+
+    return hitCount;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 WorldQuery::collisionQueryRayBatch( const WorldQueryRay* pRays, const U32 rayCount, WorldQueryResult* pResults, const bool parallel )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(WorldQuery_CollisionQueryRayBatch);
+
+    // Configure the batch.
+    WorldQueryRayBatch rayBatch;
+    rayBatch.mpWorldQuery = this;
+    rayBatch.mpRays = pRays;
+    rayBatch.mpResults = pResults;
+
+    // Cast the rays.
+    if ( parallel )
+    {
+        ThreadPool::getGlobal()->parallelFor( collisionQueryRayRange, &rayBatch, rayCount, WORLDQUERY_RAY_BATCH_CHUNK_SIZE );
+    }
+    else
+    {
+        collisionQueryRayRange( &rayBatch, 0, rayCount );
+    }
+
+    // Count the hits.
+    U32 hitCount = 0;
+    for ( U32 rayIndex = 0; rayIndex < rayCount; ++rayIndex )
+    {
+        if ( pResults[rayIndex].mpSceneObject != NULL )
+            hitCount++;
+    }
+
+    return hitCount;
+}
+
+//-----------------------------------------------------------------------------
+
+void WorldQuery::collisionQueryRayRange( void* pContext, const U32 start, const U32 end )
+{
+    // Fetch the batch.
+    WorldQueryRayBatch* pRayBatch = static_cast<WorldQueryRayBatch*>(pContext);
+    const b2World* pWorld = pRayBatch->mpWorldQuery->mpScene->getWorld();
+
+    // Cast the rays in the range.
+    for ( U32 rayIndex = start; rayIndex < end; ++rayIndex )
+    {
+        // Reset the result.
+        WorldQueryResult& result = pRayBatch->mpResults[rayIndex];
+        result = WorldQueryResult();
+
+        // Fetch the ray.
+        const WorldQueryRay& ray = pRayBatch->mpRays[rayIndex];
+
+        // Skip degenerate rays.
+        if ( (ray.mPoint2 - ray.mPoint1).LengthSquared() <= 0.0f )
+            continue;
+
+        // Find the closest hit.
+        WorldQueryClosestRay closestRay( pRayBatch->mpWorldQuery, result );
+        pWorld->RayCast( &closestRay, ray.mPoint1, ray.mPoint2 );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+U32 WorldQuery::setQueryResults( const WorldQueryResult* pResults, const U32 resultCount )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(WorldQuery_SetQueryResults);
+
+    mMasterQueryKey++;
+
+    // Flag as not a ray-cast query result.
+    mIsRaycastQueryResult = false;
+
+    for ( U32 index = 0; index < resultCount; ++index )
+    {
+        // Fetch scene object.
+        SceneObject* pSceneObject = pResults[index].mpSceneObject;
+
+        // Skip if filtered or already tagged with the world query key.
+        if ( pSceneObject->getWorldQueryKey() == mMasterQueryKey || isFiltered( pSceneObject ) )
+            continue;
+
+        mLayeredQueryResults[pSceneObject->getSceneLayer()].push_back( pResults[index] );
+        mQueryResults.push_back( pResults[index] );
+
+        // Tag with world query key.
+        pSceneObject->setWorldQueryKey( mMasterQueryKey );
+    }
+
+    // Inject always-in-scope.
+    injectAlwaysInScope();
+
+    return getQueryResultsCount();
+}
+
+//-----------------------------------------------------------------------------
+
 void WorldQuery::clearQuery( void )
 {
     // Debug Profiling.
@@ -609,6 +1140,10 @@ bool WorldQuery::ReportFixture( b2Fixture* fixture )
     if ( mQueryFilter.mPickingAllowedFilter && !pSceneObject->getPickingAllowed() )
         return true;
 
+    // Input events filter.
+    if ( mQueryFilter.mInputEventsFilter && !pSceneObject->getUseInputEvents() )
+        return true;
+
     // Check collision point.
     if ( mCheckPoint && !fixture->TestPoint( mComparePoint ) )
         return true;
@@ -672,6 +1207,10 @@ F32 WorldQuery::ReportFixture( b2Fixture* fixture, const b2Vec2& point, const b2
     if ( mQueryFilter.mPickingAllowedFilter && !pSceneObject->getPickingAllowed() )
         return 1.0f;
 
+    // Input events filter.
+    if ( mQueryFilter.mInputEventsFilter && !pSceneObject->getUseInputEvents() )
+        return 1.0f;
+
     // Fetch layer and group masks.
     const U32 sceneLayerMask = pSceneObject->getSceneLayerMask();
     const U32 sceneGroupMask = pSceneObject->getSceneGroupMask();
@@ -704,7 +1243,7 @@ bool WorldQuery::QueryCallback( S32 proxyId )
     PROFILE_SCOPE(WorldQuery_QueryCallback);
 
     // If not the correct proxy then ignore.
-    PhysicsProxy* pPhysicsProxy = static_cast<PhysicsProxy*>(GetUserData( proxyId ));
+    PhysicsProxy* pPhysicsProxy = static_cast<PhysicsProxy*>(getProxyUserData( proxyId ));
     if ( pPhysicsProxy->getPhysicsProxyType() != PhysicsProxy::PHYSIC_PROXY_SCENEOBJECT )
         return true;
 
@@ -727,6 +1266,10 @@ bool WorldQuery::QueryCallback( S32 proxyId )
     if ( mQueryFilter.mPickingAllowedFilter && !pSceneObject->getPickingAllowed() )
         return true;
 
+    // Input events filter.
+    if ( mQueryFilter.mInputEventsFilter && !pSceneObject->getUseInputEvents() )
+        return true;
+
     // Check OOBB.
     if ( mCheckOOBB )
     {
@@ -796,7 +1339,7 @@ F32 WorldQuery::RayCastCallback( const b2RayCastInput& input, S32 proxyId )
     PROFILE_SCOPE(WorldQuery_RayCastCallback);
 
     // If not the correct proxy then ignore.
-    PhysicsProxy* pPhysicsProxy = static_cast<PhysicsProxy*>(GetUserData( proxyId ));
+    PhysicsProxy* pPhysicsProxy = static_cast<PhysicsProxy*>(getProxyUserData( proxyId ));
     if ( pPhysicsProxy->getPhysicsProxyType() != PhysicsProxy::PHYSIC_PROXY_SCENEOBJECT )
         return 1.0f;
 
@@ -819,6 +1362,10 @@ F32 WorldQuery::RayCastCallback( const b2RayCastInput& input, S32 proxyId )
     if ( mQueryFilter.mPickingAllowedFilter && !pSceneObject->getPickingAllowed() )
         return 1.0f;
 
+    // Input events filter.
+    if ( mQueryFilter.mInputEventsFilter && !pSceneObject->getUseInputEvents() )
+        return 1.0f;
+
     // Check OOBB.
     if ( mCheckOOBB )
     {
@@ -850,6 +1397,61 @@ F32 WorldQuery::RayCastCallback( const b2RayCastInput& input, S32 proxyId )
 
 //-----------------------------------------------------------------------------
 
+void WorldQuery::QueryBatchCallback( S32 queryIndex, S32 proxyId )
+{
+    // If not the correct proxy then ignore.
+    PhysicsProxy* pPhysicsProxy = static_cast<PhysicsProxy*>(getProxyUserData( proxyId ));
+    if ( pPhysicsProxy->getPhysicsProxyType() != PhysicsProxy::PHYSIC_PROXY_SCENEOBJECT )
+        return;
+
+    // Fetch scene object.
+    SceneObject* pSceneObject = static_cast<SceneObject*>(pPhysicsProxy);
+
+    // Ignore if filtered.
+    if ( isFiltered( pSceneObject ) )
+        return;
+
+    // Keep the hit and count it against the following query offset.
+    BatchQueryHit hit;
+    hit.mQueryIndex = (U32)queryIndex;
+    hit.mpSceneObject = pSceneObject;
+    mBatchQueryHits.push_back( hit );
+    (*mpBatchResultOffsets)[queryIndex+1]++;
+}
+
+//-----------------------------------------------------------------------------
+
+bool WorldQuery::isFiltered( const SceneObject* pSceneObject ) const
+{
+    return isFiltered( pSceneObject, mQueryFilter );
+}
+
+//-----------------------------------------------------------------------------
+
+bool WorldQuery::isFiltered( const SceneObject* pSceneObject, const WorldQueryFilter& queryFilter )
+{
+    // Enabled filter.
+    if ( queryFilter.mEnabledFilter && !pSceneObject->isEnabled() )
+        return true;
+
+    // Visible filter.
+    if ( queryFilter.mVisibleFilter && !pSceneObject->getVisible() )
+        return true;
+
+    // Picking allowed filter.
+    if ( queryFilter.mPickingAllowedFilter && !pSceneObject->getPickingAllowed() )
+        return true;
+
+    // Input events filter.
+    if ( queryFilter.mInputEventsFilter && !pSceneObject->getUseInputEvents() )
+        return true;
+
+    // Compare masks.
+    return (queryFilter.mSceneLayerMask & pSceneObject->getSceneLayerMask()) == 0 || (queryFilter.mSceneGroupMask & pSceneObject->getSceneGroupMask()) == 0;
+}
+
+//-----------------------------------------------------------------------------
+
 void WorldQuery::injectAlwaysInScope( void )
 {
     // Debug Profiling.
@@ -881,6 +1483,10 @@ void WorldQuery::injectAlwaysInScope( void )
         if ( mQueryFilter.mPickingAllowedFilter && !pSceneObject->getPickingAllowed() )
             continue;
 
+        // Input events filter.
+        if ( mQueryFilter.mInputEventsFilter && !pSceneObject->getUseInputEvents() )
+            continue;
+
         // Fetch layer and group masks.
         const U32 sceneLayerMask = pSceneObject->getSceneLayerMask();
         const U32 sceneGroupMask = pSceneObject->getSceneGroupMask();
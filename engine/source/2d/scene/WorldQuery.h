@@ -31,27 +31,97 @@
 #include "2d/scene/WorldQueryResult.h"
 #endif
 
+#ifndef _FLAT_HASH_MAP_H_
+#include "collection/flatHashMap.h"
+#endif
+
 ///-----------------------------------------------------------------------------
 
 class Scene;
+class WorldQuery;
+
+///-----------------------------------------------------------------------------
+
+/// A persistent region whose overlapping scene objects are tracked by the world query.
+///
+/// Rather than querying the region every tick, the world query keeps the overlapping objects
+/// up to date as proxies are added, moved and removed, much like broad-phase pairs.  Objects
+/// are tracked against their (slightly enlarged) proxy AABBs so users wanting exact overlaps
+/// should still check each object against the region.  The region only costs anything when
+/// it moves or when an object's proxy moves across it.
+class WorldQueryRegion
+{
+public:
+    WorldQueryRegion();
+    virtual ~WorldQueryRegion();
+
+    /// Add the region to a world query or move it there.  Nothing is done if the region is unchanged.
+    void            setRegion( WorldQuery* pWorldQuery, const b2AABB& aabb );
+    void            clearRegion( void );
+
+    inline bool     getIsRegionSet( void ) const { return mpWorldQuery != NULL; }
+    inline const b2AABB& getRegionAABB( void ) const { return mRegionAABB; }
+    inline const typeSceneObjectVector& getRegionObjects( void ) const { return mRegionObjects; }
+
+protected:
+    /// Called when a scene object starts or stops overlapping the region.
+    virtual void    onRegionEnter( SceneObject* pSceneObject ) {}
+    virtual void    onRegionLeave( SceneObject* pSceneObject ) {}
+
+private:
+    friend class WorldQuery;
+    friend class WorldQueryRegionPairs;
+    friend class WorldQueryRegionFill;
+
+    void            addRegionObject( SceneObject* pSceneObject );
+    void            removeRegionObject( SceneObject* pSceneObject );
+
+    typedef FlatHashMap<SceneObject*, U32> typeRegionObjectHash;
+
+    WorldQuery*             mpWorldQuery;
+    S32                     mRegionProxyId;
+    b2AABB                  mRegionAABB;
+    typeSceneObjectVector   mRegionObjects;
+    typeRegionObjectHash    mRegionObjectIndices;
+};
+
+///-----------------------------------------------------------------------------
+
+/// A single ray in a batched ray query.
+struct WorldQueryRay
+{
+    b2Vec2          mPoint1;
+    b2Vec2          mPoint2;
+};
 
 ///-----------------------------------------------------------------------------
 
 class WorldQuery :
-    protected b2DynamicTree,
     public b2QueryCallback,
     public b2RayCastCallback,
     public SimObject
 {
 public:
     WorldQuery( Scene* pScene );
-    virtual         ~WorldQuery() {}
+    virtual         ~WorldQuery();
 
     /// Standard scope.
     S32             add( SceneObject* pSceneObject );
     void            remove( SceneObject* pSceneObject );
     bool            update( SceneObject* pSceneObject, const b2AABB& aabb, const b2Vec2& displacement );
 
+    /// Proxy structure.
+    /// A cell size of zero uses a dynamic tree otherwise a uniform spatial hash is used.
+    /// This can only be changed whilst there are no proxies.
+    void            setSpatialHash( const F32 cellSize );
+    inline F32      getSpatialHash( void ) const { return mUseSpatialHash ? mSpatialHash.GetCellSize() : 0.0f; }
+
+    /// Tracked regions.
+    void            addRegion( WorldQueryRegion* pRegion, const b2AABB& aabb );
+    void            moveRegion( WorldQueryRegion* pRegion, const b2AABB& aabb );
+    void            removeRegion( WorldQueryRegion* pRegion );
+    inline U32      getRegionCount( void ) const { return mRegions.size(); }
+
     /// Always in scope.
     void            addAlwaysInScope( SceneObject* pSceneObject );
     void            removeAlwaysInScope( SceneObject* pSceneObject );
@@ -80,8 +150,20 @@ public:
     U32             anyQueryPoint( const Vector2& point );
     U32             anyQueryCircle( const Vector2& centroid, const F32 radius );
 
+    /// Batched queries.
+    /// These fill caller-owned results and neither use nor disturb the current query results.
+    /// The query filter is applied however always-in-scope objects are not injected.
+    U32             aabbQueryAABBBatch( const b2AABB* pAABBs, const U32 queryCount, typeWorldQueryResultVector& results, Vector<U32>& resultOffsets );
+    U32             collisionQueryRayBatch( const WorldQueryRay* pRays, const U32 rayCount, WorldQueryResult* pResults, const bool parallel = true );
+
+    /// Use results from a batched query as the current query results.
+    /// Results that the current query filter rejects are skipped and always-in-scope objects are injected.
+    U32             setQueryResults( const WorldQueryResult* pResults, const U32 resultCount );
+
     /// Filtering.
     inline void     setQueryFilter( const WorldQueryFilter& queryFilter ) { mQueryFilter = queryFilter; }
+    bool            isFiltered( const SceneObject* pSceneObject ) const;
+    static bool     isFiltered( const SceneObject* pSceneObject, const WorldQueryFilter& queryFilter );
    
     /// Results.
     void            clearQuery( void );
@@ -96,13 +178,36 @@ public:
     virtual F32     ReportFixture( b2Fixture* fixture, const b2Vec2& point, const b2Vec2& normal, F32 fraction );
     bool            QueryCallback( S32 proxyId );
     F32             RayCastCallback( const b2RayCastInput& input, S32 proxyId );
+    void            QueryBatchCallback( S32 queryIndex, S32 proxyId );
 
 private:
+    friend class WorldQueryRegionFill;
+
+    inline void*    getProxyUserData( const S32 proxyId ) const { return mUseSpatialHash ? mSpatialHash.GetUserData( proxyId ) : mTree.GetUserData( proxyId ); }
+    inline const b2AABB& getProxyFatAABB( const S32 proxyId ) const { return mUseSpatialHash ? mSpatialHash.GetFatAABB( proxyId ) : mTree.GetFatAABB( proxyId ); }
+    template <typename T> inline void queryProxies( T* pCallback, const b2AABB& aabb ) const { if ( mUseSpatialHash ) mSpatialHash.Query( pCallback, aabb ); else mTree.Query( pCallback, aabb ); }
+    template <typename T> inline void queryProxiesBatch( T* pCallback, const b2AABB* pAABBs, const S32 count ) const { if ( mUseSpatialHash ) mSpatialHash.QueryBatch( pCallback, pAABBs, count ); else mTree.QueryBatch( pCallback, pAABBs, count ); }
+    template <typename T> inline void rayCastProxies( T* pCallback, const b2RayCastInput& input ) const { if ( mUseSpatialHash ) mSpatialHash.RayCast( pCallback, input ); else mTree.RayCast( pCallback, input ); }
+
     void            injectAlwaysInScope( void );
+    void            updateRegionPairs( SceneObject* pSceneObject, const b2AABB* pOldFatAABB, const b2AABB* pNewFatAABB );
     static S32      QSORT_CALLBACK rayCastFractionSort(const void* a, const void* b);
+    static void     collisionQueryRayRange( void* pContext, const U32 start, const U32 end );
+
+    /// A scene object found by a batched query.
+    struct BatchQueryHit
+    {
+        U32             mQueryIndex;
+        SceneObject*    mpSceneObject;
+    };
+    typedef Vector<BatchQueryHit> typeBatchQueryHitVector;
 
 private:
     Scene*                      mpScene;
+    b2DynamicTree               mTree;
+    b2SpatialHash               mSpatialHash;
+    bool                        mUseSpatialHash;
+    S32                         mProxyCount;
     WorldQueryFilter            mQueryFilter;
     b2PolygonShape              mComparePolygonShape;
     b2CircleShape               mCompareCircleShape;
@@ -118,6 +223,10 @@ private:
     bool                        mIsRaycastQueryResult;
     typeSceneObjectVector       mAlwaysInScopeSet;
     U32                         mMasterQueryKey;
+    typeBatchQueryHitVector     mBatchQueryHits;
+    Vector<U32>*                mpBatchResultOffsets;
+    b2DynamicTree               mRegionTree;
+    Vector<WorldQueryRegion*>   mRegions;
 };
 
 #endif // _WORLD_QUERY_H_
\ No newline at end of file
@@ -48,7 +48,8 @@ struct WorldQueryFilter
         mEnabledFilter( enabledFilter ),
         mVisibleFilter( visibleFilter ),
         mPickingAllowedFilter( pickingAllowedFilter ),
-        mAlwaysInScopeFilter( alwaysInScopeFilter )
+        mAlwaysInScopeFilter( alwaysInScopeFilter ),
+        mInputEventsFilter( false )
         {
         }
 
@@ -60,6 +61,7 @@ struct WorldQueryFilter
         mVisibleFilter        = false;
         mPickingAllowedFilter = true;
         mAlwaysInScopeFilter  = false;
+        mInputEventsFilter    = false;
     }
 
     inline void     setEnabledFilter( const bool filter )           { mEnabledFilter = filter; }
@@ -70,6 +72,8 @@ struct WorldQueryFilter
     inline bool     getPickingAllowedFilter( void ) const           { return mPickingAllowedFilter; }
     inline void     setAlwaysInScopeFilter( const bool filter )     { mAlwaysInScopeFilter = filter; }
     inline bool     getAlwaysInScopeFilter( void ) const            { return mAlwaysInScopeFilter; }
+    inline void     setInputEventsFilter( const bool filter )       { mInputEventsFilter = filter; }
+    inline bool     getInputEventsFilter( void ) const              { return mInputEventsFilter; }
     
     U32     mSceneLayerMask;
     U32     mSceneGroupMask;
@@ -77,6 +81,7 @@ struct WorldQueryFilter
     bool    mVisibleFilter;
     bool    mPickingAllowedFilter;
     bool    mAlwaysInScopeFilter;
+    bool    mInputEventsFilter;     ///< Only objects using input events are reported.
 };
 
 #endif // _WORLD_QUERY_FILTER_H_
\ No newline at end of file
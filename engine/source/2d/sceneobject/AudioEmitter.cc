@@ -0,0 +1,238 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _AUDIO_EMITTER_H_
+#include "2d/sceneobject/AudioEmitter.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+// Script bindings.
+#include "AudioEmitter_ScriptBinding.h"
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//------------------------------------------------------------------------------
+
+IMPLEMENT_CONOBJECT(AudioEmitter);
+
+//-----------------------------------------------------------------------------
+
+AudioEmitter::AudioEmitter() :
+    mVolume( 1.0f ),
+    mInnerRadius( 1.0f ),
+    mOuterRadius( 20.0f ),
+    mHandle( NULL_AUDIOHANDLE ),
+    mAudioPass( 0 ),
+    mAppliedGain( 0.0f ),
+    mAppliedPan( 0.0f )
+{
+    // Use a static body by default.
+    mBodyDefinition.type = b2_staticBody;
+}
+
+//-----------------------------------------------------------------------------
+
+AudioEmitter::~AudioEmitter()
+{
+    // Stop the audio.
+    stopAudio();
+}
+
+//-----------------------------------------------------------------------------
+
+void AudioEmitter::initPersistFields()
+{
+    // Call parent.
+    Parent::initPersistFields();
+
+    addProtectedField( "Audio", TypeAudioAssetPtr, Offset(mAudioAsset, AudioEmitter), &setAudio, &defaultProtectedGetFn, &defaultProtectedWriteFn, "The looping audio asset to play." );
+    addProtectedField( "Volume", TypeF32, Offset(mVolume, AudioEmitter), &setVolume, &defaultProtectedGetFn, &writeVolume, "The volume of the emitter before attenuation." );
+    addProtectedField( "InnerRadius", TypeF32, Offset(mInnerRadius, AudioEmitter), &setInnerRadius, &defaultProtectedGetFn, &writeInnerRadius, "The distance within which the emitter is at full volume." );
+    addProtectedField( "OuterRadius", TypeF32, Offset(mOuterRadius, AudioEmitter), &setOuterRadius, &defaultProtectedGetFn, &writeOuterRadius, "The distance beyond which the emitter is silent." );
+}
+
+//-----------------------------------------------------------------------------
+
+void AudioEmitter::OnRegisterScene( Scene* pScene )
+{
+    // Call parent.
+    Parent::OnRegisterScene( pScene );
+
+    // Add to the scene audio emitters.
+    pScene->addAudioEmitter( this );
+}
+
+//-----------------------------------------------------------------------------
+
+void AudioEmitter::OnUnregisterScene( Scene* pScene )
+{
+    // Stop the audio.
+    stopAudio();
+
+    // Remove from the scene audio emitters.
+    pScene->removeAudioEmitter( this );
+
+    // Call parent.
+    Parent::OnUnregisterScene( pScene );
+}
+
+//-----------------------------------------------------------------------------
+
+void AudioEmitter::copyTo( SimObject* object )
+{
+    // Fetch audio emitter object.
+    AudioEmitter* pAudioEmitter = dynamic_cast<AudioEmitter*>( object );
+
+    // Sanity!
+    AssertFatal( pAudioEmitter != NULL, "AudioEmitter::copyTo() - Object is not the correct type." );
+
+    // Call parent.
+    Parent::copyTo( object );
+
+    // Copy the fields.
+    pAudioEmitter->setAudio( getAudio() );
+    pAudioEmitter->setVolume( getVolume() );
+    pAudioEmitter->setInnerRadius( getInnerRadius() );
+    pAudioEmitter->setOuterRadius( getOuterRadius() );
+}
+
+//-----------------------------------------------------------------------------
+
+void AudioEmitter::setAudio( const char* pAssetId )
+{
+    // Sanity!
+    AssertFatal( pAssetId != NULL, "AudioEmitter::setAudio() - Cannot use a NULL asset Id." );
+
+    // Stop any current audio.
+    // NOTE:-   The scene starts the new audio when the emitter is next audible.
+    stopAudio();
+
+    // Set asset Id.
+    mAudioAsset = pAssetId;
+}
+
+//-----------------------------------------------------------------------------
+
+void AudioEmitter::setInnerRadius( const F32 innerRadius )
+{
+    mInnerRadius = getMax( innerRadius, 0.0f );
+
+    // Keep the outer radius beyond the inner radius.
+    if ( mOuterRadius < mInnerRadius )
+        setOuterRadius( mInnerRadius );
+}
+
+//-----------------------------------------------------------------------------
+
+void AudioEmitter::setOuterRadius( const F32 outerRadius )
+{
+    mOuterRadius = getMax( outerRadius, mInnerRadius );
+
+    // Let the scene know so it can widen its listener query.
+    if ( getScene() != NULL )
+        getScene()->updateAudioEmitterRadius( mOuterRadius );
+}
+
+//-----------------------------------------------------------------------------
+
+F32 AudioEmitter::getAttenuation( const F32 distance ) const
+{
+    // Full volume within the inner radius.
+    if ( distance <= mInnerRadius )
+        return 1.0f;
+
+    // Silent beyond the outer radius.
+    if ( distance >= mOuterRadius )
+        return 0.0f;
+
+    return 1.0f - ((distance - mInnerRadius) / (mOuterRadius - mInnerRadius));
+}
+
+//-----------------------------------------------------------------------------
+
+void AudioEmitter::updateAudio( const F32 attenuation, const F32 pan )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AudioEmitter_UpdateAudio);
+
+    // Calculate the gain.
+    const F32 gain = mVolume * attenuation;
+
+    // Stop the audio if it is silent.
+    if ( gain <= 0.0f || mAudioAsset.isNull() )
+    {
+        stopAudio();
+        return;
+    }
+
+    // Place the relative source on a unit circle in front of the listener to pan it.
+    const F32 panZ = mSqrt( getMax( 1.0f - pan * pan, 0.0f ) );
+
+    // Is the audio playing?
+    if ( mHandle == NULL_AUDIOHANDLE || !alxIsValidHandle( mHandle ) )
+    {
+        // No, so start it looping at the attenuated volume.
+        Audio::Description description = mAudioAsset->getAudioDescription();
+        description.mIsLooping = true;
+        description.mIs3D = false;
+        description.mVolume = gain;
+
+        mHandle = alxCreateSource( description, mAudioAsset->getAudioFile() );
+        if ( mHandle == NULL_AUDIOHANDLE )
+            return;
+
+        alxSource3f( mHandle, AL_POSITION, pan, 0.0f, panZ );
+        alxPlay( mHandle );
+
+        mAppliedGain = gain;
+        mAppliedPan = pan;
+        return;
+    }
+
+    // Finish if the change is inaudible.
+    if ( mFabs( gain - mAppliedGain ) < 0.01f && mFabs( pan - mAppliedPan ) < 0.01f )
+        return;
+
+    // Update the source.
+    alxSourcef( mHandle, AL_GAIN_LINEAR, gain );
+    alxSource3f( mHandle, AL_POSITION, pan, 0.0f, panZ );
+
+    mAppliedGain = gain;
+    mAppliedPan = pan;
+}
+
+//-----------------------------------------------------------------------------
+
+void AudioEmitter::stopAudio( void )
+{
+    // Finish if not playing.
+    if ( mHandle == NULL_AUDIOHANDLE )
+        return;
+
+    // Stop the audio.
+    alxStop( mHandle );
+    mHandle = NULL_AUDIOHANDLE;
+}
@@ -0,0 +1,108 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _AUDIO_EMITTER_H_
+#define _AUDIO_EMITTER_H_
+
+#ifndef _SCENE_OBJECT_H_
+#include "2d/sceneobject/SceneObject.h"
+#endif
+
+#ifndef _AUDIO_ASSET_H_
+#include "audio/AudioAsset.h"
+#endif
+
+#ifndef _PLATFORMAUDIO_H_
+#include "platform/platformAudio.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// An audio emitter plays a looping audio asset at its position in the scene.
+///
+/// The scene attenuates and pans all its emitters against the scene audio listener
+/// once per tick.  Emitters are found with a single world query around the listener
+/// so emitters further away than their outer radius cost nothing and hold no audio source.
+/// The volume falls linearly from full at the inner radius to silent at the outer radius.
+class AudioEmitter : public SceneObject
+{
+private:
+    typedef SceneObject Parent;
+
+    AssetPtr<AudioAsset>    mAudioAsset;
+    F32                     mVolume;
+    F32                     mInnerRadius;
+    F32                     mOuterRadius;
+
+    /// Playback.
+    AUDIOHANDLE             mHandle;
+    U32                     mAudioPass;
+    F32                     mAppliedGain;
+    F32                     mAppliedPan;
+
+public:
+    AudioEmitter();
+    virtual ~AudioEmitter();
+
+    static void initPersistFields();
+
+    virtual void OnRegisterScene( Scene* pScene );
+    virtual void OnUnregisterScene( Scene* pScene );
+
+    /// Rendering.
+    virtual bool shouldRender( void ) const { return false; }
+
+    /// Cloning.
+    virtual void copyTo( SimObject* object );
+
+    /// Audio.
+    void setAudio( const char* pAssetId );
+    inline StringTableEntry getAudio( void ) const { return mAudioAsset.getAssetId(); }
+    inline void setVolume( const F32 volume ) { mVolume = mClampF( volume, 0.0f, 1.0f ); }
+    inline F32 getVolume( void ) const { return mVolume; }
+    void setInnerRadius( const F32 innerRadius );
+    inline F32 getInnerRadius( void ) const { return mInnerRadius; }
+    void setOuterRadius( const F32 outerRadius );
+    inline F32 getOuterRadius( void ) const { return mOuterRadius; }
+    inline bool isAudible( void ) const { return mHandle != NULL_AUDIOHANDLE; }
+
+    /// Called by the scene when updating the emitters.
+    inline U32 getAudioPass( void ) const { return mAudioPass; }
+    inline void setAudioPass( const U32 audioPass ) { mAudioPass = audioPass; }
+    F32 getAttenuation( const F32 distance ) const;
+    void updateAudio( const F32 attenuation, const F32 pan );
+    void stopAudio( void );
+
+    /// Declare Console Object.
+    DECLARE_CONOBJECT( AudioEmitter );
+
+protected:
+    static bool setAudio( void* obj, const char* data )                         { static_cast<AudioEmitter*>( obj )->setAudio( data ); return false; }
+    static bool setVolume( void* obj, const char* data )                        { static_cast<AudioEmitter*>( obj )->setVolume( dAtof(data) ); return false; }
+    static bool writeVolume( void* obj, StringTableEntry pFieldName )           { return !mIsOne( static_cast<AudioEmitter*>( obj )->getVolume() ); }
+    static bool setInnerRadius( void* obj, const char* data )                   { static_cast<AudioEmitter*>( obj )->setInnerRadius( dAtof(data) ); return false; }
+    static bool writeInnerRadius( void* obj, StringTableEntry pFieldName )      { return mNotEqual( static_cast<AudioEmitter*>( obj )->getInnerRadius(), 1.0f ); }
+    static bool setOuterRadius( void* obj, const char* data )                   { static_cast<AudioEmitter*>( obj )->setOuterRadius( dAtof(data) ); return false; }
+    static bool writeOuterRadius( void* obj, StringTableEntry pFieldName )      { return mNotEqual( static_cast<AudioEmitter*>( obj )->getOuterRadius(), 20.0f ); }
+};
+
+#endif // _AUDIO_EMITTER_H_
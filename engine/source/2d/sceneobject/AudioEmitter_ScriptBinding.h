@@ -0,0 +1,100 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+ConsoleMethodGroupBeginWithDocs(AudioEmitter, SceneObject)
+
+/*! Sets the looping audio asset to play.
+    @param assetId The audio asset Id to play.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(AudioEmitter, setAudio, ConsoleVoid, 3, 3, (assetId))
+{
+    object->setAudio( argv[2] );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the looping audio asset being played.
+    @return The audio asset Id being played.
+*/
+ConsoleMethodWithDocs(AudioEmitter, getAudio, ConsoleString, 2, 2, ())
+{
+    return object->getAudio();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets the volume of the emitter before attenuation.
+    @param volume The volume in the range [0,1].
+    @return No return value.
+*/
+ConsoleMethodWithDocs(AudioEmitter, setVolume, ConsoleVoid, 3, 3, (volume))
+{
+    object->setVolume( dAtof(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the volume of the emitter before attenuation.
+    @return The volume in the range [0,1].
+*/
+ConsoleMethodWithDocs(AudioEmitter, getVolume, ConsoleFloat, 2, 2, ())
+{
+    return object->getVolume();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets the distances over which the emitter is attenuated.
+    @param innerRadius The distance within which the emitter is at full volume.
+    @param outerRadius The distance beyond which the emitter is silent.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(AudioEmitter, setRadius, ConsoleVoid, 4, 4, (innerRadius, outerRadius))
+{
+    object->setInnerRadius( dAtof(argv[2]) );
+    object->setOuterRadius( dAtof(argv[3]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the distances over which the emitter is attenuated.
+    @return The inner and outer radius formatted as "innerRadius outerRadius".
+*/
+ConsoleMethodWithDocs(AudioEmitter, getRadius, ConsoleString, 2, 2, ())
+{
+    char* pBuffer = Con::getReturnBuffer( 64 );
+    dSprintf( pBuffer, 64, "%g %g", object->getInnerRadius(), object->getOuterRadius() );
+    return pBuffer;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the emitter is currently close enough to the scene audio listener to be playing.
+    @return Whether the emitter is playing.
+*/
+ConsoleMethodWithDocs(AudioEmitter, getIsAudible, ConsoleBool, 2, 2, ())
+{
+    return object->isAudible();
+}
+
+ConsoleMethodGroupEndWithDocs(AudioEmitter)
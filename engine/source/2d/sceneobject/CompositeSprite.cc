@@ -109,8 +109,15 @@ void CompositeSprite::initPersistFields()
     addProtectedField( "DefaultSpriteAngle", TypeF32, Offset(mDefaultSpriteSize, CompositeSprite), &setDefaultSpriteAngle, &getDefaultSpriteAngle, &writeDefaultSpriteAngle, "");
     addProtectedField( "BatchLayout", TypeEnum, Offset(mBatchLayoutType, CompositeSprite), &setBatchLayout, &defaultProtectedGetFn, &writeBatchLayout, 1, &batchLayoutTypeTable, "");
     addProtectedField( "BatchCulling", TypeBool, Offset(mBatchCulling, CompositeSprite), &setBatchCulling, &defaultProtectedGetFn, &writeBatchCulling, "");
+    addProtectedField( "BatchGridCulling", TypeBool, Offset(mBatchGridCulling, CompositeSprite), &setBatchGridCulling, &defaultProtectedGetFn, &writeBatchGridCulling, "");
+    addProtectedField( "BatchChunkSize", TypeF32, Offset(mBatchChunkSize, CompositeSprite), &setBatchChunkSize, &defaultProtectedGetFn, &writeBatchChunkSize, "");
     addField( "BatchIsolated", TypeBool, Offset(mBatchIsolated, CompositeSprite), &writeBatchIsolated, "");
     addField( "BatchSortMode", TypeEnum, Offset(mBatchSortMode, CompositeSprite), &writeBatchSortMode, 1, &SceneRenderQueue::renderSortTable, "");
+    addProtectedField( "BatchDeform", TypeEnum, Offset(mBatchDeformMode, CompositeSprite), &setBatchDeform, &defaultProtectedGetFn, &writeBatchDeform, 1, &SpriteBatch::batchDeformTable, "");
+    addProtectedField( "BatchDeformAmplitude", TypeF32, Offset(mBatchDeformAmplitude, CompositeSprite), &setBatchDeformAmplitude, &defaultProtectedGetFn, &writeBatchDeformParameter, "");
+    addField( "BatchDeformFrequency", TypeF32, Offset(mBatchDeformFrequency, CompositeSprite), &writeBatchDeformParameter, "");
+    addField( "BatchDeformSpeed", TypeF32, Offset(mBatchDeformSpeed, CompositeSprite), &writeBatchDeformParameter, "");
+    addProtectedField( "BatchDeformHeight", TypeF32, Offset(mBatchDeformHeight, CompositeSprite), &setBatchDeformHeight, &defaultProtectedGetFn, &writeBatchDeformParameter, "");
 }
 
 //-----------------------------------------------------------------------------
@@ -180,6 +187,10 @@ void CompositeSprite::interpolateObject( const F32 timeDelta )
     // Call parent.
     Parent::interpolateObject( timeDelta );
 
+    // Animate any deformation at the interpolated scene time.
+    if ( getBatchDeformed() && getScene() != NULL )
+        setBatchDeformTime( getScene()->getSceneTime() - (timeDelta * Tickable::smTickSec) );
+
     // Finish if the spatials are NOT dirty.
     if ( !getSpatialDirty() )
         return;
@@ -242,6 +253,9 @@ void CompositeSprite::setBatchLayout( const BatchLayoutType& batchLayoutType )
 
     // Set layout type.
     mBatchLayoutType = batchLayoutType;
+
+    // The layout determines whether grid culling is available.
+    refreshSpriteBatchQuery();
 }
 
 //------------------------------------------------------------------------------
@@ -400,6 +414,86 @@ SpriteBatchItem* CompositeSprite::createCustomLayout( const SpriteBatchItem::Log
 
 //-----------------------------------------------------------------------------
 
+bool CompositeSprite::getLogicalGridCell( const SpriteBatchItem::LogicalPosition& logicalPosition, S32& cellX, S32& cellY, Vector2& layoutPosition ) const
+{
+    // Finish if not a two-dimensional logical position.
+    if ( logicalPosition.getArgCount() != 2 )
+        return false;
+
+    // Fetch logical coordinates.
+    const F32 logicalX = logicalPosition.getFloatArg(0);
+    const F32 logicalY = logicalPosition.getFloatArg(1);
+
+    // Finish if the logical coordinates are not whole grid cells within the grid key range.
+    if ( logicalX != mFloor(logicalX) || logicalY != mFloor(logicalY) ||
+         mFabs(logicalX) > (F32)S16_MAX || mFabs(logicalY) > (F32)S16_MAX )
+        return false;
+
+    cellX = (S32)logicalX;
+    cellY = (S32)logicalY;
+
+    // Fetch sprite stride.
+    const Vector2 spriteStride = getDefaultSpriteStride();
+
+    // Calculate the layout position.
+    if ( mBatchLayoutType == ISOMETRIC_LAYOUT )
+        layoutPosition.Set( (logicalX * spriteStride.x) + (logicalY * spriteStride.x), (logicalX * spriteStride.y) + (logicalY * -spriteStride.y) );
+    else
+        layoutPosition.Set( logicalX * spriteStride.x, logicalY * spriteStride.y );
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool CompositeSprite::getLogicalGridRange( const b2AABB& localAABB, S32& minCellX, S32& minCellY, S32& maxCellX, S32& maxCellY ) const
+{
+    // Fetch sprite stride.
+    const Vector2 spriteStride = getDefaultSpriteStride();
+
+    // Finish if the stride cannot be inverted.
+    if ( mIsZero( spriteStride.x ) || mIsZero( spriteStride.y ) )
+        return false;
+
+    // Transform the area corners into logical coordinates.
+    const b2Vec2 corners[4] = { localAABB.lowerBound, b2Vec2( localAABB.upperBound.x, localAABB.lowerBound.y ), localAABB.upperBound, b2Vec2( localAABB.lowerBound.x, localAABB.upperBound.y ) };
+    F32 minX = F32_MAX, minY = F32_MAX, maxX = -F32_MAX, maxY = -F32_MAX;
+    for ( U32 n = 0; n < 4; ++n )
+    {
+        const F32 u = corners[n].x / spriteStride.x;
+        const F32 v = corners[n].y / spriteStride.y;
+
+        // Invert the layout.
+        F32 logicalX;
+        F32 logicalY;
+        if ( mBatchLayoutType == ISOMETRIC_LAYOUT )
+        {
+            logicalX = (u + v) * 0.5f;
+            logicalY = (u - v) * 0.5f;
+        }
+        else
+        {
+            logicalX = u;
+            logicalY = v;
+        }
+
+        minX = getMin( minX, logicalX );
+        minY = getMin( minY, logicalY );
+        maxX = getMax( maxX, logicalX );
+        maxY = getMax( maxY, logicalY );
+    }
+
+    // Calculate the cell range clamped to the grid key range.
+    minCellX = (S32)mClampF( mFloor( minX ), (F32)S16_MIN, (F32)S16_MAX );
+    minCellY = (S32)mClampF( mFloor( minY ), (F32)S16_MIN, (F32)S16_MAX );
+    maxCellX = (S32)mClampF( mCeil( maxX ), (F32)S16_MIN, (F32)S16_MAX );
+    maxCellY = (S32)mClampF( mCeil( maxY ), (F32)S16_MIN, (F32)S16_MAX );
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
 void CompositeSprite::onTamlCustomWrite( TamlCustomNodes& customNodes )
 {
     // Call parent.
@@ -65,11 +65,15 @@ public:
     virtual void preIntegrate( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
     virtual void integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
     virtual void interpolateObject( const F32 timeDelta );
+    virtual bool canPreIntegrateInParallel( void ) const { return false; }
+    virtual bool isTickDormant( void ) const { return false; }
 
     virtual bool canPrepareRender( void ) const { return true; }
     virtual bool shouldRender( void ) const { return true; }
+    virtual bool canCacheRender( void ) const { return Parent::canCacheRender() && !getBatchDeformed(); }
     virtual void scenePrepareRender( const SceneRenderState* pSceneRenderState, SceneRenderQueue* pSceneRenderQueue );    
     virtual void sceneRender( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer );
+    virtual void onSpritesChanged( void ) { invalidateRenderCache(); }
 
     virtual void copyTo( SimObject* object );
 
@@ -88,6 +92,10 @@ protected:
     virtual SpriteBatchItem* createSpriteIsometricLayout( const SpriteBatchItem::LogicalPosition& logicalPosition );
     virtual SpriteBatchItem* createCustomLayout( const SpriteBatchItem::LogicalPosition& logicalPosition );
 
+    virtual bool canGridCull( void ) const { return mBatchLayoutType == RECTILINEAR_LAYOUT || mBatchLayoutType == ISOMETRIC_LAYOUT; }
+    virtual bool getLogicalGridCell( const SpriteBatchItem::LogicalPosition& logicalPosition, S32& cellX, S32& cellY, Vector2& layoutPosition ) const;
+    virtual bool getLogicalGridRange( const b2AABB& localAABB, S32& minCellX, S32& minCellY, S32& maxCellX, S32& maxCellY ) const;
+
     virtual void onTamlCustomWrite( TamlCustomNodes& customNodes );
     virtual void onTamlCustomRead( const TamlCustomNodes& customNodes );
 
@@ -104,6 +112,15 @@ protected:
     static bool         writeBatchLayout( void* obj, StringTableEntry pFieldName )          { return static_cast<CompositeSprite*>(obj)->getBatchLayout() != CompositeSprite::NO_LAYOUT; }
     static bool         setBatchCulling(void* obj, const char* data)                        { STATIC_VOID_CAST_TO(CompositeSprite, SpriteBatch, obj)->setBatchCulling(dAtob(data)); return false; }
     static bool         writeBatchCulling( void* obj, StringTableEntry pFieldName )         { return !static_cast<CompositeSprite*>(obj)->getBatchCulling(); }
+    static bool         setBatchChunkSize(void* obj, const char* data)                      { STATIC_VOID_CAST_TO(CompositeSprite, SpriteBatch, obj)->setBatchChunkSize(dAtof(data)); return false; }
+    static bool         setBatchGridCulling(void* obj, const char* data)                    { STATIC_VOID_CAST_TO(CompositeSprite, SpriteBatch, obj)->setBatchGridCulling(dAtob(data)); return false; }
+    static bool         writeBatchGridCulling( void* obj, StringTableEntry pFieldName )     { return static_cast<CompositeSprite*>(obj)->getBatchGridCulling(); }
+    static bool         writeBatchChunkSize( void* obj, StringTableEntry pFieldName )       { return mNotZero( static_cast<CompositeSprite*>(obj)->getBatchChunkSize() ); }
+    static bool         setBatchDeform(void* obj, const char* data)                         { STATIC_VOID_CAST_TO(CompositeSprite, SpriteBatch, obj)->setBatchDeform( getBatchDeformEnum(data) ); return false; }
+    static bool         writeBatchDeform( void* obj, StringTableEntry pFieldName )          { return static_cast<CompositeSprite*>(obj)->getBatchDeformed(); }
+    static bool         setBatchDeformAmplitude(void* obj, const char* data)                { STATIC_VOID_CAST_TO(CompositeSprite, SpriteBatch, obj)->setBatchDeformAmplitude(dAtof(data)); return false; }
+    static bool         setBatchDeformHeight(void* obj, const char* data)                   { STATIC_VOID_CAST_TO(CompositeSprite, SpriteBatch, obj)->setBatchDeformHeight(dAtof(data)); return false; }
+    static bool         writeBatchDeformParameter( void* obj, StringTableEntry pFieldName ) { return static_cast<CompositeSprite*>(obj)->getBatchDeformed(); }
 };
 
 #endif // _COMPOSITE_SPRITE_H_
@@ -151,6 +151,171 @@ ConsoleMethodWithDocs(CompositeSprite, getBatchCulling, ConsoleBool, 2, 2, ())
 
 //-----------------------------------------------------------------------------
 
+/*! Sets whether the sprites are culled using the logical grid of the batch layout.
+    Only the rectilinear and isometric layouts support this.  The visible logical position range is calculated
+    directly from the view so no per-sprite query proxies are needed which saves both memory and update time for large grids.
+    Sprites with non-integer logical positions are still culled but are tested individually.
+    @param gridCulling Whether to use grid culling or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(CompositeSprite, setBatchGridCulling, ConsoleVoid, 3, 3, (bool gridCulling))
+{
+    STATIC_VOID_CAST_TO(CompositeSprite, SpriteBatch, object)->setBatchGridCulling( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the sprites are culled using the logical grid of the batch layout.
+    @return Whether the sprites are culled using the logical grid of the batch layout or not.
+*/
+ConsoleMethodWithDocs(CompositeSprite, getBatchGridCulling, ConsoleBool, 2, 2, ())
+{
+    return object->getBatchGridCulling();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets the size of the local grid cells the sprites are grouped into when rendering.
+    Each cell is rendered as a single unit and, once its sprites stop changing, its geometry is captured and replayed
+    until a sprite in it changes or the composite moves.  Changing a sprite only recaptures its own cell.
+    Chunking is only used when the batch sort mode is "off" as the sprites within a cell are not sorted.
+    @param chunkSize The size of the chunk cells.  Zero turns chunking off (the default).
+    @return No return value.
+*/
+ConsoleMethodWithDocs(CompositeSprite, setBatchChunkSize, ConsoleVoid, 3, 3, (float chunkSize))
+{
+    STATIC_VOID_CAST_TO(CompositeSprite, SpriteBatch, object)->setBatchChunkSize( dAtof(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the size of the local grid cells the sprites are grouped into when rendering.
+    @return The size of the chunk cells.  Zero indicates chunking is off.
+*/
+ConsoleMethodWithDocs(CompositeSprite, getBatchChunkSize, ConsoleFloat, 2, 2, ())
+{
+    return object->getBatchChunkSize();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets how the vertices of all the sprites are deformed as they are rendered.
+    The deformation is applied in the local frame of the composite as the geometry is submitted so animating it
+    costs nothing per sprite, never invalidates captured chunks and never breaks the batch.
+    "wave" moves vertices up and down with a wave travelling across the composite.
+    "sway" moves vertices across with an oscillation that grows with height above the local origin, as with foliage in the wind.
+    "bend" moves vertices across by a constant lean that grows with height above the local origin.
+    @param deformMode The deform mode of "off", "wave", "sway" or "bend".
+    @return No return value.
+*/
+ConsoleMethodWithDocs(CompositeSprite, setBatchDeform, ConsoleVoid, 3, 3, (deformMode))
+{
+    // Fetch deform mode.
+    const BatchVertexDeform::DeformMode deformMode = SpriteBatch::getBatchDeformEnum( argv[2] );
+
+    // Sanity!
+    if ( deformMode == BatchVertexDeform::DEFORM_INVALID )
+        return;
+
+    STATIC_VOID_CAST_TO(CompositeSprite, SpriteBatch, object)->setBatchDeform( deformMode );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets how the vertices of all the sprites are deformed as they are rendered.
+    @return The deform mode.
+*/
+ConsoleMethodWithDocs(CompositeSprite, getBatchDeform, ConsoleString, 2, 2, ())
+{
+    return SpriteBatch::getBatchDeformDescription( object->getBatchDeform() );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets the maximum displacement of the deformation.
+    @param amplitude The maximum displacement in local units.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(CompositeSprite, setBatchDeformAmplitude, ConsoleVoid, 3, 3, (float amplitude))
+{
+    STATIC_VOID_CAST_TO(CompositeSprite, SpriteBatch, object)->setBatchDeformAmplitude( dAtof(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the maximum displacement of the deformation.
+    @return The maximum displacement in local units.
+*/
+ConsoleMethodWithDocs(CompositeSprite, getBatchDeformAmplitude, ConsoleFloat, 2, 2, ())
+{
+    return object->getBatchDeformAmplitude();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets how quickly the deformation phase changes across the composite.
+    @param frequency The degrees the phase changes per local unit across.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(CompositeSprite, setBatchDeformFrequency, ConsoleVoid, 3, 3, (float frequency))
+{
+    STATIC_VOID_CAST_TO(CompositeSprite, SpriteBatch, object)->setBatchDeformFrequency( dAtof(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets how quickly the deformation phase changes across the composite.
+    @return The degrees the phase changes per local unit across.
+*/
+ConsoleMethodWithDocs(CompositeSprite, getBatchDeformFrequency, ConsoleFloat, 2, 2, ())
+{
+    return object->getBatchDeformFrequency();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets how quickly the deformation phase changes over time.
+    @param speed The degrees the phase changes per second.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(CompositeSprite, setBatchDeformSpeed, ConsoleVoid, 3, 3, (float speed))
+{
+    STATIC_VOID_CAST_TO(CompositeSprite, SpriteBatch, object)->setBatchDeformSpeed( dAtof(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets how quickly the deformation phase changes over time.
+    @return The degrees the phase changes per second.
+*/
+ConsoleMethodWithDocs(CompositeSprite, getBatchDeformSpeed, ConsoleFloat, 2, 2, ())
+{
+    return object->getBatchDeformSpeed();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets the local height above the origin at which sway and bend reach the full amplitude.
+    @param height The local height.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(CompositeSprite, setBatchDeformHeight, ConsoleVoid, 3, 3, (float height))
+{
+    STATIC_VOID_CAST_TO(CompositeSprite, SpriteBatch, object)->setBatchDeformHeight( dAtof(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the local height above the origin at which sway and bend reach the full amplitude.
+    @return The local height.
+*/
+ConsoleMethodWithDocs(CompositeSprite, getBatchDeformHeight, ConsoleFloat, 2, 2, ())
+{
+    return object->getBatchDeformHeight();
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Sets the batch render sort mode.
     The render sort mode is used when isolated batch mode is on.
     @return No return value.
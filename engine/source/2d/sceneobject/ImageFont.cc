@@ -182,6 +182,10 @@ void ImageFont::sceneRender( const SceneRenderState* pSceneRenderState, const Sc
     if( renderCharacters == 0 )
         return;
 
+    // Recover the glyph edges of a distance field unless an explicit alpha test is set.
+    if ( mImageAsset->getDistanceField() && pSceneRenderRequest->mAlphaTest < 0.0f )
+        pBatchRenderer->setAlphaTestMode( 0.5f );
+
     // Fetch render OOBB.
     const Vector2& renderOOBB0 = mRenderOOBB[0];
     const Vector2& renderOOBB1 = mRenderOOBB[1];
@@ -280,6 +284,9 @@ void ImageFont::sceneRender( const SceneRenderState* pSceneRenderState, const Sc
 
 bool ImageFont::setImage( const char* pImageAssetId )
 {
+    // Invalidate the layer render cache.
+    invalidateRenderCache();
+
     // Set asset.
     mImageAsset = pImageAssetId;
 
@@ -338,6 +345,9 @@ void ImageFont::setFontPadding( const F32 padding )
 
 void ImageFont::calculateSpatials( void )
 {
+    // Invalidate the layer render cache.
+    invalidateRenderCache();
+
     // Fetch number of characters to render.
     const U32 renderCharacters = mText.length();
 
@@ -22,13 +22,50 @@
 
 #include "2d/sceneobject/ParticlePlayer.h"
 
+#ifndef _CONSOLE_VARIABLE_REF_H_
+#include "console/consoleVariableRef.h"
+#endif
+
 // Script bindings.
 #include "2d/sceneobject/ParticlePlayer_ScriptBinding.h"
 
+//------------------------------------------------------------------------------
+
+static Con::VariableRef<F32> sEmissionRateScaleVariable( PARTICLE_PLAYER_EMISSION_RATE_SCALE, 1.0f );
+static Con::VariableRef<F32> sSizeScaleVariable( PARTICLE_PLAYER_SIZE_SCALE, 1.0f );
+static Con::VariableRef<F32> sForceScaleVariable( PARTICLE_PLAYER_FORCE_SCALE, 1.0f );
+static Con::VariableRef<F32> sTimeScaleVariable( PARTICLE_PLAYER_TIME_SCALE, 1.0f );
+
+//------------------------------------------------------------------------------
+
+// Fetch the emitter's local pivot AABB as interleaved x/y pairs.
+static void fetchLocalPivotAABB( const ParticleAssetEmitter* pParticleAssetEmitter, F32* pLocalAABB )
+{
+    const Vector2* pLocalVertices[4] = { &pParticleAssetEmitter->getLocalPivotAABB0(), &pParticleAssetEmitter->getLocalPivotAABB1(),
+                                         &pParticleAssetEmitter->getLocalPivotAABB2(), &pParticleAssetEmitter->getLocalPivotAABB3() };
+
+    for ( U32 vertexIndex = 0; vertexIndex < 4; ++vertexIndex )
+    {
+        pLocalAABB[vertexIndex*2]   = pLocalVertices[vertexIndex]->x;
+        pLocalAABB[vertexIndex*2+1] = pLocalVertices[vertexIndex]->y;
+    }
+}
+
+//------------------------------------------------------------------------------
+
+// Calculate the world OOBB of a range of particles from their transforms and render sizes.
+static void calculateParticleOOBBs( ParticleSystem::ParticleStore& particles, const F32* pLocalAABB, const U32 firstIndex, const U32 particleCount )
+{
+    m_oobb2F_bulk_calculate( pLocalAABB,
+        (const F32*)(particles.mRenderSize.address() + firstIndex),
+        (const F32*)(particles.mTransform.address() + firstIndex),
+        particleCount,
+        (F32*)(particles.mRenderOOBB.address() + firstIndex) );
+}
 
 //------------------------------------------------------------------------------
 
-ParticleSystem::ParticleNode* ParticlePlayer::EmitterNode::createParticle( void )
+U32 ParticlePlayer::EmitterNode::createParticle( void )
 {
     // Sanity!
     AssertFatal( mOwner != NULL, "ParticlePlayer::EmitterNode::createParticle() - Cannot create a particle with a NULL owner." );
@@ -36,34 +73,34 @@ ParticleSystem::ParticleNode* ParticlePlayer::EmitterNode::createParticle( void
     // Fetch a free node,
     ParticleSystem::ParticleNode* pFreeParticleNode = ParticleSystem::Instance->createParticle();
 
-    // Insert node into emitter chain.
-    pFreeParticleNode->mNextNode        = mParticleNodeHead.mNextNode;
-    pFreeParticleNode->mPreviousNode    = &mParticleNodeHead;
-    mParticleNodeHead.mNextNode         = pFreeParticleNode;
-    pFreeParticleNode->mNextNode->mPreviousNode = pFreeParticleNode;
+    // Append the particle to the emitter store.
+    // NOTE:-   New particles are always appended so the store remains in creation order.
+    const U32 particleIndex = mParticles.append( pFreeParticleNode );
 
-    // Configure the node.
-    mOwner->configureParticle( this, pFreeParticleNode );
+    // Configure the particle.
+    mOwner->configureParticle( this, particleIndex );
 
-    return pFreeParticleNode;
+    return particleIndex;
 }
 
 //------------------------------------------------------------------------------
 
-void ParticlePlayer::EmitterNode::freeParticle( ParticleSystem::ParticleNode* pParticleNode )
+void ParticlePlayer::EmitterNode::releaseParticle( const U32 particleIndex )
 {
     // Sanity!
-    AssertFatal( mOwner != NULL, "ParticlePlayer::EmitterNode::freeParticle() - Cannot free a particle with a NULL owner." );
+    AssertFatal( mOwner != NULL, "ParticlePlayer::EmitterNode::releaseParticle() - Cannot release a particle with a NULL owner." );
+    AssertFatal( particleIndex < mParticles.size(), "ParticlePlayer::EmitterNode::releaseParticle() - Particle index is out of bounds." );
+
+    // Fetch the particle node.
+    ParticleSystem::ParticleNode* pParticleNode = mParticles.mNodes[particleIndex];
 
     // Deallocate the assets.
     pParticleNode->mFrameProvider.deallocateAssets();
 
-    // Remove the node from the emitter chain.
-    pParticleNode->mPreviousNode->mNextNode = pParticleNode->mNextNode;
-    pParticleNode->mNextNode->mPreviousNode = pParticleNode->mPreviousNode;
-   
     // Free the node.
+    // NOTE:-   The store slot is left in place; the caller is responsible for compacting the store.
     ParticleSystem::Instance->freeParticle( pParticleNode );
+    mParticles.mNodes[particleIndex] = NULL;
 }
 
 //------------------------------------------------------------------------------
@@ -74,10 +111,14 @@ void ParticlePlayer::EmitterNode::freeAllParticles( void )
     AssertFatal( mOwner != NULL, "ParticlePlayer::EmitterNode::freeAllParticles() - Cannot free all particles with a NULL owner." );
 
     // Free all the nodes,
-    while( mParticleNodeHead.mNextNode != &mParticleNodeHead )
+    const U32 particleCount = mParticles.size();
+    for ( U32 particleIndex = 0; particleIndex < particleCount; ++particleIndex )
     {
-        freeParticle( mParticleNodeHead.mNextNode );
+        releaseParticle( particleIndex );
     }
+
+    // Empty the store.
+    mParticles.truncate( 0 );
 }
 
 //------------------------------------------------------------------------------
@@ -90,6 +131,8 @@ ParticlePlayer::ParticlePlayer() :
                     mPlaying( false ),
                     mPaused( false ),
                     mAge( 0.0f ),
+                    mRenderTimeOffset( 0.0f ),
+                    mLodScale( 1.0f ),
                     mParticleInterpolation( false ),
                     mCameraIdleDistance( 0.0f ),
                     mCameraIdle( false ),
@@ -97,10 +140,10 @@ ParticlePlayer::ParticlePlayer() :
                     mWaitingForDelete( false )
 {
     // Fetch the particle player scales.
-    mEmissionRateScale = Con::getFloatVariable( PARTICLE_PLAYER_EMISSION_RATE_SCALE, 1.0f );
-    mSizeScale         = Con::getFloatVariable( PARTICLE_PLAYER_SIZE_SCALE, 1.0f );
-    mForceScale        = Con::getFloatVariable( PARTICLE_PLAYER_FORCE_SCALE, 1.0f );
-    mTimeScale         = Con::getFloatVariable( PARTICLE_PLAYER_TIME_SCALE, 1.0f );
+    mEmissionRateScale = sEmissionRateScaleVariable.get();
+    mSizeScale         = sSizeScaleVariable.get();
+    mForceScale        = sForceScaleVariable.get();
+    mTimeScale         = sTimeScaleVariable.get();
      
     // Register for refresh notifications.
     mParticleAsset.registerRefreshNotify( this );
@@ -191,6 +234,9 @@ void ParticlePlayer::OnRegisterScene( Scene* pScene )
     // Add always in scope.
     pScene->getWorldQuery()->addAlwaysInScope( this );
 
+    // Add to the scene particle players.
+    pScene->addParticlePlayer( this );
+
     // Play the the particles if appropriate.
     if ( mParticleAsset.notNull() && mParticleAsset->getEmitterCount() > 0 )
         play( true );
@@ -206,6 +252,9 @@ void ParticlePlayer::OnUnregisterScene( Scene* pScene )
     // Remove always in scope.
     pScene->getWorldQuery()->removeAlwaysInScope( this );
 
+    // Remove from the scene particle players.
+    pScene->removeParticlePlayer( this );
+
     // Call parent.
     Parent::OnUnregisterScene( pScene );
 }
@@ -217,6 +266,9 @@ void ParticlePlayer::preIntegrate( const F32 totalTime, const F32 elapsedTime, D
     // Call Parent.
     Parent::preIntegrate( totalTime, elapsedTime, pDebugStats );
 
+    // Update the level-of-detail scale.
+    updateLodScale();
+
     // Finish if the camera idle distance is zero.
     if ( mIsZero(mCameraIdleDistance) || !validRender() )
         return;
@@ -260,6 +312,58 @@ void ParticlePlayer::preIntegrate( const F32 totalTime, const F32 elapsedTime, D
 
 //------------------------------------------------------------------------------
 
+void ParticlePlayer::updateLodScale( void )
+{
+    // Reset the level-of-detail scale.
+    mLodScale = 1.0f;
+
+    // Fetch particle asset.
+    ParticleAsset* pParticleAsset = mParticleAsset;
+
+    // Finish if no particle asset assigned.
+    if ( pParticleAsset == NULL )
+        return;
+
+    // Fetch the level-of-detail screen-area.
+    const F32 lodScreenArea = pParticleAsset->getLodScreenArea();
+
+    // Finish if the level-of-detail is not used or we can't render.
+    if ( mIsZero( lodScreenArea ) || !validRender() )
+        return;
+
+    // Fetch the player area.
+    const Vector2 playerSize = getSize();
+    const F32 playerArea = mFabs( playerSize.x * playerSize.y );
+
+    // Fetch the player bounds.
+    const RectF playerBounds = getAABBRectangle();
+
+    // Reset the largest screen-area.
+    F32 screenArea = 0.0f;
+
+    // Fetch scene windows.
+    SimSet& sceneWindows = getScene()->getAttachedSceneWindows();
+
+    // Find the largest screen-area the player covers in any scene window that can see it.
+    for( SimSet::iterator itr = sceneWindows.begin(); itr != sceneWindows.end(); itr++ )
+    {
+        // Fetch the scene window camera area.
+        const RectF cameraArea = static_cast<SceneWindow*>(*itr)->getCameraArea();
+
+        // Skip if the camera area is invalid or cannot see the player.
+        if ( !cameraArea.isValidRect() || !cameraArea.overlaps( playerBounds ) )
+            continue;
+
+        // Update the largest screen-area.
+        screenArea = getMax( screenArea, playerArea / (cameraArea.extent.x * cameraArea.extent.y) );
+    }
+
+    // Calculate the level-of-detail scale.
+    mLodScale = mClampF( screenArea / lodScreenArea, pParticleAsset->getLodMinimumScale(), 1.0f );
+}
+
+//------------------------------------------------------------------------------
+
 void ParticlePlayer::integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats )
 {
     // Call parent.
@@ -284,6 +388,18 @@ void ParticlePlayer::integrateObject( const F32 totalTime, const F32 elapsedTime
     // Reset active particle count.
     U32 activeParticleCount = 0;
 
+    // Reset the render time offset until the particles are next interpolated.
+    mRenderTimeOffset = 0.0f;
+
+    // Fetch the maximum particles scaled by the level-of-detail.
+    const S32 assetMaxParticles = pParticleAsset->getMaxParticles();
+    const U32 maxParticles = assetMaxParticles > 0 ? getMax( 1U, (U32)mCeil( assetMaxParticles * mLodScale ) ) : U32_MAX;
+
+    // Count the player particles.
+    U32 playerParticleCount = 0;
+    for( typeEmitterVector::iterator emitterItr = mEmitters.begin(); emitterItr != mEmitters.end(); ++emitterItr )
+        playerParticleCount += (*emitterItr)->getParticleCount();
+
     // Is the camera idle?
     if ( !mCameraIdle )
     {
@@ -299,55 +415,84 @@ void ParticlePlayer::integrateObject( const F32 totalTime, const F32 elapsedTime
             // Fetch the asset emitter.
             ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
 
-            // Fetch the first particle node.
-            ParticleSystem::ParticleNode* pParticleNode = pEmitterNode->getFirstParticle();
+            // Fetch the particle store.
+            ParticleSystem::ParticleStore& particles = pEmitterNode->getParticles();
+
+            // Fetch the single-particle mode.
+            const bool singleParticle = pParticleAssetEmitter->getSingleParticle();
 
-            // Fetch the particle node head.
-            ParticleSystem::ParticleNode* pParticleNodeHead = pEmitterNode->getParticleNodeHead();
+            // Fetch the cosmetic-particles mode.
+            const bool cosmeticParticles = pParticleAssetEmitter->getCosmeticParticles();
 
-            // Process All particle nodes.
-            while ( pParticleNode != pParticleNodeHead )
+            // Fetch whether cosmetic particle animations need updating.
+            const bool updateCosmeticAnimations = cosmeticParticles && !pParticleAssetEmitter->isStaticFrameProvider();
+
+            // Fetch the particle count.
+            const U32 particleCount = particles.size();
+
+            // Reset the live particle count.
+            // NOTE:-   Expired particles are removed by compacting the survivors down over them as we go.
+            //          This keeps the store in creation order which the render order depends upon.
+            U32 liveParticleCount = 0;
+
+            // Process all particles.
+            for ( U32 particleIndex = 0; particleIndex < particleCount; ++particleIndex )
             {
                 // Update the particle age.
-                pParticleNode->mParticleAge += scaledTime;
+                const F32 particleAge = (particles.mParticleAge[particleIndex] += scaledTime);
+
+                // Fetch the particle lifetime.
+                const F32 particleLifetime = particles.mParticleLifetime[particleIndex];
 
                 // Has the particle expired?
                 // NOTE:-   If we're in single-particle mode then the particle lives as long as the particle player does.
-                if (    ( !pParticleAssetEmitter->getSingleParticle() && pParticleNode->mParticleAge > pParticleNode->mParticleLifetime ) ||
-                        ( mIsZero(pParticleNode->mParticleLifetime) ) )
+                if (    ( !singleParticle && particleAge > particleLifetime ) ||
+                        ( mIsZero(particleLifetime) ) )
                 {
-                    // Yes, so fetch next particle before we kill it.
-                    pParticleNode = pParticleNode->mNextNode;
-
-                    // Kill the particle.
-                    // NOTE:-   Because we move to the next particle the particle to kill is now the previous!
-                    pEmitterNode->freeParticle( pParticleNode->mPreviousNode );
+                    // Yes, so kill the particle.
+                    pEmitterNode->releaseParticle( particleIndex );
+                    playerParticleCount--;
+                    continue;
                 }
-                else
-                {
-                    // No, so integrate the particle.
-                    integrateParticle( pEmitterNode, pParticleNode, pParticleNode->mParticleAge / pParticleNode->mParticleLifetime, scaledTime );
 
-                    // Move to the next particle node.
-                    pParticleNode = pParticleNode->mNextNode;
+                // Compact the particle if any have expired before it.
+                if ( liveParticleCount != particleIndex )
+                    particles.move( particleIndex, liveParticleCount );
 
-                    // Only count particles when not in single-particle mode.
-                    activeParticleCount++;
-                }
-            };
+                // Update the cosmetic particle animation.
+                // NOTE:-   Cosmetic particles are not integrated so this is the only per-tick work they need.
+                if ( updateCosmeticAnimations )
+                    particles.mNodes[liveParticleCount]->mFrameProvider.updateAnimation( scaledTime );
+
+                liveParticleCount++;
+            }
+
+            // Discard the expired particles.
+            particles.truncate( liveParticleCount );
+
+            // Defer integrating the live particles until the scene integrates all the emitters.
+            // NOTE:-   Cosmetic particles are never integrated as they are evaluated when rendered.
+            pEmitterNode->setPendingIntegration( cosmeticParticles ? 0 : liveParticleCount, scaledTime );
+
+            // Update the active particle count.
+            activeParticleCount += liveParticleCount;
 
             // Skip generating new particles if the emitter is paused.
             if ( pEmitterNode->getPaused() )
                 continue;
 
+            // Calculate how many particles can be emitted within both the player maximum and the particle system budget.
+            const U32 emissionAllowance = getMin( ParticleSystem::Instance->getRemainingParticleBudget(), maxParticles > playerParticleCount ? maxParticles - playerParticleCount : 0 );
+
             // Are we in single-particle mode?
             if ( pParticleAssetEmitter->getSingleParticle() )
             {
                 // Yes, so do we have a single particle yet?
-                if ( pParticleNodeHead->mNextNode == pParticleNodeHead )
+                if ( !pEmitterNode->getActiveParticles() && emissionAllowance > 0 )
                 {
                     // No, so generate a single particle.
                     pEmitterNode->createParticle();
+                    playerParticleCount++;
                 }
             }
             else
@@ -372,10 +517,17 @@ void ParticlePlayer::integrateObject( const F32 totalTime, const F32 elapsedTime
                 // Fetch the emission scale.
                 const F32 effectEmission = pParticleAsset->getQuantityScaleField().getFieldValue( particlePlayerAge ) * getEmissionRateScale();
 
-                // Calculate the local emission.
+                // Calculate the local emission (scaled by the level-of-detail).
                 const F32 localEmission = mClampF(  (baseEmission + CoreMath::mGetRandomF(-varEmission, varEmission)) * effectEmission,
                                                     quantityBaseField.getMinValue(),
-                                                    quantityBaseField.getMaxValue() );
+                                                    quantityBaseField.getMaxValue() ) * mLodScale;
+
+                // Reset the accumulated generation time if there's no emission otherwise it'd all be emitted at once when emission resumes.
+                if ( mIsZero( localEmission ) )
+                {
+                    pEmitterNode->setTimeSinceLastGeneration( 0.0f );
+                    continue;
+                }
 
                 // Calculate the final time-independent emission count.
                 const U32 emissionCount = U32(mFloor( localEmission * pEmitterNode->getTimeSinceLastGeneration() ));
@@ -391,8 +543,12 @@ void ParticlePlayer::integrateObject( const F32 totalTime, const F32 elapsedTime
                         pEmitterNode->setTimeSinceLastGeneration( 0.0f );
 
                     // Generate the required emission.
-                    for ( U32 n = 0; n < emissionCount; n++ )
+                    // NOTE:-   Any emission beyond the allowance is dropped rather than deferred.
+                    const U32 allowedEmissionCount = getMin( emissionCount, emissionAllowance );
+                    for ( U32 n = 0; n < allowedEmissionCount; n++ )
                         pEmitterNode->createParticle();
+
+                    playerParticleCount += allowedEmissionCount;
                 }
             }
         }
@@ -460,6 +616,63 @@ void ParticlePlayer::integrateObject( const F32 totalTime, const F32 elapsedTime
 
 //------------------------------------------------------------------------------
 
+void ParticlePlayer::gatherEmitterIntegrations( Vector<ParticleSystem::EmitterIntegration>& emitterIntegrations )
+{
+    // Fetch emitter count.
+    const U32 emitterCount = mEmitters.size();
+
+    // Gather all the emitters with particles waiting to be integrated.
+    for ( U32 emitterIndex = 0; emitterIndex < emitterCount; ++emitterIndex )
+    {
+        // Skip if nothing to integrate.
+        if ( mEmitters[emitterIndex]->getPendingParticleCount() == 0 )
+            continue;
+
+        ParticleSystem::EmitterIntegration emitterIntegration;
+        emitterIntegration.mpParticlePlayer = this;
+        emitterIntegration.mEmitterIndex = emitterIndex;
+        emitterIntegrations.push_back( emitterIntegration );
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void ParticlePlayer::integrateEmitter( const U32 emitterIndex )
+{
+    // Sanity!
+    AssertFatal( emitterIndex < (U32)mEmitters.size(), "ParticlePlayer::integrateEmitter() - Emitter index is out of bounds." );
+
+    // Fetch the emitter node.
+    EmitterNode* pEmitterNode = mEmitters[emitterIndex];
+
+    // Fetch the pending particle count.
+    // NOTE:-   The particles may have been freed since the integration was requested so clamp to what's left.
+    const U32 particleCount = getMin( pEmitterNode->getPendingParticleCount(), pEmitterNode->getParticleCount() );
+
+    // Integrate the particles.
+    integrateParticles( pEmitterNode, 0, particleCount, pEmitterNode->getPendingElapsedTime() );
+
+    // Reset the pending integration.
+    pEmitterNode->setPendingIntegration( 0, 0.0f );
+}
+
+//------------------------------------------------------------------------------
+
+void ParticlePlayer::integrateEmitterRange( void* pContext, const U32 start, const U32 end )
+{
+    // Fetch the emitter integrations.
+    const ParticleSystem::EmitterIntegration* pEmitterIntegrations = static_cast<const ParticleSystem::EmitterIntegration*>( pContext );
+
+    // Integrate the emitters.
+    for ( U32 index = start; index < end; ++index )
+    {
+        const ParticleSystem::EmitterIntegration& emitterIntegration = pEmitterIntegrations[index];
+        emitterIntegration.mpParticlePlayer->integrateEmitter( emitterIntegration.mEmitterIndex );
+    }
+}
+
+//------------------------------------------------------------------------------
+
 void ParticlePlayer::interpolateObject( const F32 timeDelta )
 {    
     // Call parent.
@@ -469,52 +682,46 @@ void ParticlePlayer::interpolateObject( const F32 timeDelta )
     if ( !mParticleInterpolation || !mPlaying || mCameraIdle || mPaused )
         return;
 
+    // Calculate the render time offset for cosmetic particles.
+    // NOTE:-   A time-delta of one is the previous tick and zero is the current tick.
+    mRenderTimeOffset = -timeDelta * Tickable::smTickSec * mTimeScale;
+
     // Iterate the emitters.
     for( typeEmitterVector::iterator emitterItr = mEmitters.begin(); emitterItr != mEmitters.end(); ++emitterItr )
     {
         // Fetch the emitter node.
         EmitterNode* pEmitterNode = *emitterItr;
 
-        // Fetch First Particle Node.
-        ParticleSystem::ParticleNode* pParticleNode = pEmitterNode->getFirstParticle();
-
-        // Fetch the particle node head.
-        ParticleSystem::ParticleNode* pParticleNodeHead = pEmitterNode->getParticleNodeHead();
+        // Fetch the particle store.
+        ParticleSystem::ParticleStore& particles = pEmitterNode->getParticles();
 
         // Fetch the asset emitter.
         ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
 
+        // Skip if the particles are cosmetic as they are evaluated when rendered.
+        if ( pParticleAssetEmitter->getCosmeticParticles() )
+            continue;
+
         // Fetch the local AABB..
-        const Vector2& localAABB0 = pParticleAssetEmitter->getLocalPivotAABB0();
-        const Vector2& localAABB1 = pParticleAssetEmitter->getLocalPivotAABB1();
-        const Vector2& localAABB2 = pParticleAssetEmitter->getLocalPivotAABB2();
-        const Vector2& localAABB3 = pParticleAssetEmitter->getLocalPivotAABB3();
+        F32 localAABB[8];
+        fetchLocalPivotAABB( pParticleAssetEmitter, localAABB );
+
+        // Fetch the particle count.
+        const U32 particleCount = particles.size();
 
-        // Process All particle nodes.
-        while ( pParticleNode != pParticleNodeHead )
+        // Process all particles.
+        for ( U32 particleIndex = 0; particleIndex < particleCount; ++particleIndex )
         {
             // Interpolate the position.
-            pParticleNode->mRenderTickPosition = (timeDelta * pParticleNode->mPreTickPosition) + ((1.0f-timeDelta) * pParticleNode->mPostTickPosition);
+            const Vector2 renderTickPosition = (timeDelta * particles.mPreTickPosition[particleIndex]) + ((1.0f-timeDelta) * particles.mPostTickPosition[particleIndex]);
+            particles.mRenderTickPosition[particleIndex] = renderTickPosition;
 
             // Set the transform.
-            pParticleNode->mTransform.p = pParticleNode->mRenderTickPosition;
-
-            // Fetch the render size.
-            const Vector2& renderSize = pParticleNode->mRenderSize;
-
-            // Calculate the scaled AABB.
-            Vector2 scaledAABB[4];
-            scaledAABB[0] = localAABB0 * renderSize;
-            scaledAABB[1] = localAABB1 * renderSize;
-            scaledAABB[2] = localAABB2 * renderSize;
-            scaledAABB[3] = localAABB3 * renderSize;
-
-            // Calculate the world OOBB..
-            CoreMath::mCalculateOOBB( scaledAABB, pParticleNode->mTransform, pParticleNode->mRenderOOBB );
-
-            // Move to the next particle.
-            pParticleNode = pParticleNode->mNextNode;
+            particles.mTransform[particleIndex].p = renderTickPosition;
         }
+
+        // Calculate the world OOBBs.
+        calculateParticleOOBBs( particles, localAABB, 0, particleCount );
     }
 }
 
@@ -527,7 +734,7 @@ void ParticlePlayer::sceneRender( const SceneRenderState* pSceneRenderState, con
         return;
 
     // Flush.
-    pBatchRenderer->flush( getScene()->getDebugStats().batchIsolatedFlush );
+    pBatchRenderer->flush( BatchRender::FLUSH_ISOLATED );
 
     // Fetch emitter count.
     const U32 emitterCount = mEmitters.size();
@@ -571,7 +778,7 @@ void ParticlePlayer::sceneRender( const SceneRenderState* pSceneRenderState, con
         }
 
         // Flush.
-        pBatchRenderer->flush( getScene()->getDebugStats().batchIsolatedFlush );
+        pBatchRenderer->flush( BatchRender::FLUSH_ISOLATED );
 
         // Intense particles?
         if ( pParticleAssetEmitter->getIntenseParticles() )
@@ -616,20 +823,48 @@ void ParticlePlayer::sceneRender( const SceneRenderState* pSceneRenderState, con
             }
         }
 
+        // Evaluate the particles if they are cosmetic.
+        if ( pParticleAssetEmitter->getCosmeticParticles() )
+            evaluateCosmeticParticles( pEmitterNode );
+
         // Fetch the oldest-in-front flag.
         const bool oldestInFront = pParticleAssetEmitter->getOldestInFront();
 
-        // Fetch the starting particle (using appropriate particle order).
-        ParticleSystem::ParticleNode* pParticleNode = oldestInFront ? pEmitterNode->getFirstParticle() : pEmitterNode->getLastParticle();
+        // Fetch the particle store.
+        const ParticleSystem::ParticleStore& particles = pEmitterNode->getParticles();
 
-        // Fetch the particle node head.
-        ParticleSystem::ParticleNode* pParticleNodeHead = pEmitterNode->getParticleNodeHead();
+        // Fetch the particle count.
+        const U32 particleCount = particles.size();
 
-        // Process all particle nodes.
-        while ( pParticleNode != pParticleNodeHead )
+        // Cull the particles against the view if they're in world-space.
+        // NOTE:-   Particles attached to the emitter are in emitter-space so are always submitted.
+        const bool cullParticles = !pParticleAssetEmitter->getAttachPositionToEmitter();
+        if ( cullParticles )
         {
+            // Fetch the view AABB.
+            b2AABB viewAABB = pSceneRenderState->mRenderAABB;
+            if ( mNotZero( pSceneRenderState->mRenderAngle ) )
+                CoreMath::mRotateAABB( pSceneRenderState->mRenderAABB, pSceneRenderState->mRenderAngle, viewAABB );
+
+            mRenderCullAABBs.setSize( particleCount );
+            mRenderCullResults.setSize( particleCount );
+            m_oobb2F_bulk_aabb( (const F32*)particles.mRenderOOBB.address(), particleCount, (F32*)mRenderCullAABBs.address() );
+            m_aabb2F_bulk_overlap( (const F32*)mRenderCullAABBs.address(), particleCount, (const F32*)&viewAABB, mRenderCullResults.address() );
+        }
+
+        // Process all particles.
+        // NOTE:-   The store is in creation order so oldest-in-front walks it backwards to draw the oldest last.
+        for ( U32 renderIndex = 0; renderIndex < particleCount; ++renderIndex )
+        {
+            // Fetch the particle index (using appropriate particle order).
+            const U32 particleIndex = oldestInFront ? particleCount - 1 - renderIndex : renderIndex;
+
+            // Skip if the particle is outside the view.
+            if ( cullParticles && mRenderCullResults[particleIndex] == 0 )
+                continue;
+
             // Fetch the frame provider.
-            const ImageFrameProviderCore& frameProvider = pParticleNode->mFrameProvider;
+            const ImageFrameProviderCore& frameProvider = particles.mNodes[particleIndex]->mFrameProvider;
 
             // Fetch the frame area.
             const ImageAsset::FrameArea::TexelArea& texelFrameArea = frameProvider.getProviderImageFrameArea().mTexelArea;
@@ -638,7 +873,7 @@ void ParticlePlayer::sceneRender( const SceneRenderState* pSceneRenderState, con
             TextureHandle& frameTexture = frameProvider.getProviderTexture();
 
             // Fetch the particle render OOBB.
-            Vector2* renderOOBB = pParticleNode->mRenderOOBB;
+            const Vector2* renderOOBB = particles.mRenderOOBB[particleIndex].mVertex;
 
             // Fetch lower/upper texture coordinates.
             const Vector2& texLower = texelFrameArea.mTexelLower;
@@ -655,14 +890,11 @@ void ParticlePlayer::sceneRender( const SceneRenderState* pSceneRenderState, con
                 Vector2( texUpper.x, texLower.y ),
                 Vector2( texLower.x, texLower.y ),
                 frameTexture,
-                pParticleNode->mColor );
-
-            // Move to next Particle ( using appropriate sort-order ).
-            pParticleNode = oldestInFront ? pParticleNode->mNextNode : pParticleNode->mPreviousNode;
-        };
+                particles.mColor[particleIndex] );
+        }
 
         // Flush.
-        pBatchRenderer->flush( getScene()->getDebugStats().batchIsolatedFlush );
+        pBatchRenderer->flush( BatchRender::FLUSH_ISOLATED );
 
         // Restore the transformation.
         glPopMatrix();
@@ -877,7 +1109,7 @@ void ParticlePlayer::stop( const bool waitForParticles, const bool killEffect )
 
 //------------------------------------------------------------------------------
 
-void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSystem::ParticleNode* pParticleNode )
+void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, const U32 particleIndex )
 {
     // Fetch the particle player age.
     const F32 particlePlayerAge = mAge;
@@ -885,8 +1117,11 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // Fetch the particle player position.
     const Vector2& particlePlayerPosition = getPosition();
 
-    // Default to not suppressing movement.
-    pParticleNode->mSuppressMovement = false;
+    // Fetch the particle store.
+    ParticleSystem::ParticleStore& particles = pEmitterNode->getParticles();
+
+    // Fetch the particle node.
+    ParticleSystem::ParticleNode* pParticleNode = particles.mNodes[particleIndex];
 
     // Fetch particle asset.
     ParticleAsset* pParticleAsset = mParticleAsset;
@@ -913,11 +1148,11 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
         // Determine whether to use world-space or emitter-space.
         if ( attachPositionToEmitter )
         {
-            pParticleNode->mPosition = emitterOffset;
+            particles.mPosition[particleIndex] = emitterOffset;
         }
         else
         {
-            pParticleNode->mPosition = particlePlayerPosition + emitterOffset;
+            particles.mPosition[particleIndex] = particlePlayerPosition + emitterOffset;
         }
     }
     else
@@ -932,12 +1167,12 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 if ( attachPositionToEmitter )
                 {
                     // Yes, so transform the particle into emitter-space only.
-                    pParticleNode->mPosition = emitterOffset;
+                    particles.mPosition[particleIndex] = emitterOffset;
                 }
                 else
                 {
                     // No, so transform the particle into world-space here.
-                    pParticleNode->mPosition = emitterOffset + particlePlayerPosition;
+                    particles.mPosition[particleIndex] = emitterOffset + particlePlayerPosition;
                 }
 
             } break;
@@ -952,14 +1187,14 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 Vector2 emissionPosition( CoreMath::mGetRandomF( -halfWidth, halfWidth ), 0.0f );
 
                 // Transform particle position in emitter-space.
-                pParticleNode->mPosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
+                particles.mPosition[particleIndex] = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
 
                 // Are we attaching the position to the emitter?
                 if ( !attachPositionToEmitter )
                 {
                     // No, so transform the particle into world-space here.
                     b2Transform xform( particlePlayerPosition, b2Rot( getAngle()) );
-                    pParticleNode->mPosition = b2Mul( xform, pParticleNode->mPosition );
+                    particles.mPosition[particleIndex] = b2Mul( xform, particles.mPosition[particleIndex] );
                 }
 
             } break;
@@ -975,14 +1210,14 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 Vector2 emissionPosition( CoreMath::mGetRandomF( -halfWidth, halfWidth ), CoreMath::mGetRandomF( -halfHeight, halfHeight ) );
 
                 // Transform particle position in emitter-space.
-                pParticleNode->mPosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
+                particles.mPosition[particleIndex] = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
 
                 // Are we attaching the position to the emitter?
                 if ( !attachPositionToEmitter )
                 {
                     // No, so transform the particle into world-space here.
                     b2Transform xform( particlePlayerPosition, b2Rot( getAngle()) );
-                    pParticleNode->mPosition = b2Mul( xform, pParticleNode->mPosition );
+                    particles.mPosition[particleIndex] = b2Mul( xform, particles.mPosition[particleIndex] );
                 }
 
             } break;
@@ -1008,14 +1243,14 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 Vector2 emissionPosition( radiusX * mCos(angle), radiusY * mSin(angle) );
 
                 // Transform particle position in emitter-space.
-                pParticleNode->mPosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
+                particles.mPosition[particleIndex] = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
 
                 // Are we attaching the position to the emitter?
                 if ( !attachPositionToEmitter )
                 {
                     // No, so transform the particle into world-space here.
                     b2Transform xform( particlePlayerPosition, b2Rot( getAngle()) );
-                    pParticleNode->mPosition = b2Mul( xform, pParticleNode->mPosition );
+                    particles.mPosition[particleIndex] = b2Mul( xform, particles.mPosition[particleIndex] );
                 }
 
             } break;
@@ -1030,14 +1265,14 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 Vector2 emissionPosition( emitterSize.x * 0.5f * mCos(angle), emitterSize.y * 0.5f * mSin(angle) );
 
                 // Transform particle position in emitter-space.
-                pParticleNode->mPosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
+                particles.mPosition[particleIndex] = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
 
                 // Are we attaching the position to the emitter?
                 if ( !attachPositionToEmitter )
                 {
                     // No, so transform the particle into world-space here.
                     b2Transform xform( particlePlayerPosition, b2Rot( getAngle()) );
-                    pParticleNode->mPosition = b2Mul( xform, pParticleNode->mPosition );
+                    particles.mPosition[particleIndex] = b2Mul( xform, particles.mPosition[particleIndex] );
                 }
 
             } break;
@@ -1065,12 +1300,12 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 if ( attachPositionToEmitter )
                 {
                     // Yes, so transform the particle into emitter-space only.
-                    pParticleNode->mPosition = emissionPosition + emitterOffset;
+                    particles.mPosition[particleIndex] = emissionPosition + emitterOffset;
                 }
                 else
                 {
                     // No, so transform the particle into world-space here.
-                    pParticleNode->mPosition = emissionPosition + emitterOffset + particlePlayerPosition;
+                    particles.mPosition[particleIndex] = emissionPosition + emitterOffset + particlePlayerPosition;
                 }
 
             } break;
@@ -1084,8 +1319,8 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // Calculate Particle Lifetime.
     // **********************************************************************************************************************
 
-    pParticleNode->mParticleAge = 0.0f;
-    pParticleNode->mParticleLifetime = ParticleAssetField::calculateFieldBVE(   pParticleAssetEmitter->getParticleLifeBaseField(),
+    particles.mParticleAge[particleIndex] = 0.0f;
+    particles.mParticleLifetime[particleIndex] = ParticleAssetField::calculateFieldBVE(   pParticleAssetEmitter->getParticleLifeBaseField(),
                                                                                 pParticleAssetEmitter->getParticleLifeVariationField(),
                                                                                 pParticleAsset->getParticleLifeScaleField(),
                                                                                 particlePlayerAge );
@@ -1095,7 +1330,7 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // Calculate Particle Size-X.
     // **********************************************************************************************************************
 
-    pParticleNode->mSize.x = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getSizeXBaseField(),
+    particles.mSize[particleIndex].x = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getSizeXBaseField(),
                                                                     pParticleAssetEmitter->getSizeXVariationField(),
                                                                     pParticleAsset->getSizeXScaleField(),
                                                                     particlePlayerAge ) * getSizeScale();
@@ -1104,19 +1339,19 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     if ( pParticleAssetEmitter->getFixedAspect() )
     {
         // Yes, so simply copy Size-X.
-        pParticleNode->mSize.y = pParticleNode->mSize.x;
+        particles.mSize[particleIndex].y = particles.mSize[particleIndex].x;
     }
     else
     {
         // No, so calculate the particle Size-Y.
-        pParticleNode->mSize.y = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getSizeYBaseField(),
+        particles.mSize[particleIndex].y = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getSizeYBaseField(),
                                                                         pParticleAssetEmitter->getSizeYVariationField(),
                                                                         pParticleAsset->getSizeYScaleField(),
                                                                         particlePlayerAge ) * getSizeScale();
     }
 
     // Reset the render size.
-    pParticleNode->mRenderSize.Set(-1.0f, -1.0f);
+    particles.mRenderSize[particleIndex].Set(-1.0f, -1.0f);
 
 
     // **********************************************************************************************************************
@@ -1131,12 +1366,12 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // Ignore if we're using a single-particle.
     if ( !pParticleAssetEmitter->getSingleParticle() )
     {
-        pParticleNode->mSpeed = ParticleAssetField::calculateFieldBVE(  pParticleAssetEmitter->getSpeedBaseField(),
+        particles.mSpeed[particleIndex] = ParticleAssetField::calculateFieldBVE(  pParticleAssetEmitter->getSpeedBaseField(),
                                                                         pParticleAssetEmitter->getSpeedVariationField(),
                                                                         pParticleAsset->getSpeedScaleField(),
                                                                         particlePlayerAge ) * getForceScale();
 
-        pParticleNode->mRandomMotion = ParticleAssetField::calculateFieldBVE(   pParticleAssetEmitter->getRandomMotionBaseField(),
+        particles.mRandomMotion[particleIndex] = ParticleAssetField::calculateFieldBVE(   pParticleAssetEmitter->getRandomMotionBaseField(),
                                                                                 pParticleAssetEmitter->getRandomMotionVariationField(),
                                                                                 pParticleAsset->getRandomMotionScaleField(),
                                                                                 particlePlayerAge ) * getForceScale();
@@ -1170,7 +1405,15 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
 
         // Calculate the particle velocity.
         const F32 emissionAngleRadians = mDegToRad( emissionAngle );
-        pParticleNode->mVelocity.Set( emissionForce * mCos( emissionAngleRadians ), emissionForce * mSin( emissionAngleRadians ) );
+        particles.mVelocity[particleIndex].Set( emissionForce * mCos( emissionAngleRadians ), emissionForce * mSin( emissionAngleRadians ) );
+    }
+    else
+    {
+        // Reset the motion as a single-particle doesn't move.
+        // NOTE:-   These are still integrated in bulk along with everything else so must not be left undefined.
+        particles.mSpeed[particleIndex] = 0.0f;
+        particles.mRandomMotion[particleIndex] = 0.0f;
+        particles.mVelocity[particleIndex].SetZero();
     }
 
 
@@ -1178,7 +1421,7 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // Calculate Spin.
     // **********************************************************************************************************************
 
-    pParticleNode->mSpin = ParticleAssetField::calculateFieldBVE(   pParticleAssetEmitter->getSpinBaseField(),
+    particles.mSpin[particleIndex] = ParticleAssetField::calculateFieldBVE(   pParticleAssetEmitter->getSpinBaseField(),
                                                                     pParticleAssetEmitter->getSpinVariationField(),
                                                                     pParticleAsset->getSpinScaleField(),
                                                                     particlePlayerAge );
@@ -1188,7 +1431,7 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // Calculate Fixed-Force.
     // **********************************************************************************************************************
 
-    pParticleNode->mFixedForce = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getFixedForceBaseField(),
+    particles.mFixedForce[particleIndex] = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getFixedForceBaseField(),
                                                                         pParticleAssetEmitter->getFixedForceVariationField(),
                                                                         pParticleAsset->getFixedForceScaleField(),
                                                                         particlePlayerAge ) * getForceScale();
@@ -1205,7 +1448,7 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
         case ParticleAssetEmitter::ALIGNED_ORIENTATION:
         {
             // Use the emission angle with fixed offset.
-            pParticleNode->mOrientationAngle = mFmod( emissionAngle - pParticleAssetEmitter->getAlignedAngleOffset(), 360.0f );
+            particles.mOrientationAngle[particleIndex] = mFmod( emissionAngle - pParticleAssetEmitter->getAlignedAngleOffset(), 360.0f );
 
         } break;
 
@@ -1213,7 +1456,7 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
         case ParticleAssetEmitter::FIXED_ORIENTATION:
         {
             // Use a fixed angle.
-            pParticleNode->mOrientationAngle = mFmod( pParticleAssetEmitter->getFixedAngleOffset(), 360.0f );
+            particles.mOrientationAngle[particleIndex] = mFmod( pParticleAssetEmitter->getFixedAngleOffset(), 360.0f );
 
         } break;
 
@@ -1222,7 +1465,7 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
         {
             // Used a random angle/arc.
             const F32 randomArc = pParticleAssetEmitter->getRandomArc() * 0.5f;
-            pParticleNode->mOrientationAngle = mFmod( CoreMath::mGetRandomF( pParticleAssetEmitter->getRandomAngleOffset() - randomArc, pParticleAssetEmitter->getRandomAngleOffset() + randomArc ), 360.0f );
+            particles.mOrientationAngle[particleIndex] = mFmod( CoreMath::mGetRandomF( pParticleAssetEmitter->getRandomAngleOffset() - randomArc, pParticleAssetEmitter->getRandomAngleOffset() + randomArc ), 360.0f );
 
         } break;
         
@@ -1242,7 +1485,7 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     const ParticleAssetField& alphaChannelScale = pParticleAsset->getAlphaChannelScaleField();
 
     // Calculate the color.
-    pParticleNode->mColor.set(  mClampF( redChannel.getFieldValue( 0.0f ), redChannel.getMinValue(), redChannel.getMaxValue() ),
+    particles.mColor[particleIndex].set(  mClampF( redChannel.getFieldValue( 0.0f ), redChannel.getMinValue(), redChannel.getMaxValue() ),
                                 mClampF( greenChannel.getFieldValue( 0.0f ),greenChannel.getMinValue(), greenChannel.getMaxValue() ),
                                 mClampF( blueChannel.getFieldValue( 0.0f ), blueChannel.getMinValue(),blueChannel.getMaxValue() ),
                                 mClampF( alphaChannel.getFieldValue( 0.0f ) * alphaChannelScale.getFieldValue( 0.0f ), alphaChannel.getMinValue(), alphaChannel.getMaxValue() ) );
@@ -1292,108 +1535,117 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // **********************************************************************************************************************
     // Reset Tick Position.
     // **********************************************************************************************************************
-    pParticleNode->mPreTickPosition = pParticleNode->mPostTickPosition = pParticleNode->mRenderTickPosition = pParticleNode->mPosition;
+    particles.mPreTickPosition[particleIndex] = particles.mPostTickPosition[particleIndex] = particles.mRenderTickPosition[particleIndex] = particles.mPosition[particleIndex];
 
 
     // **********************************************************************************************************************
     // Do a Single Particle Integration to get things going.
     // **********************************************************************************************************************
-    integrateParticle( pEmitterNode, pParticleNode, 0.0f, 0.0f );
+    integrateParticles( pEmitterNode, particleIndex, 1, 0.0f );
 }
 
 //------------------------------------------------------------------------------
 
-void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, ParticleSystem::ParticleNode* pParticleNode, F32 particleAge, F32 elapsedTime )
+void ParticlePlayer::integrateParticles( EmitterNode* pEmitterNode, const U32 firstIndex, const U32 particleCount, const F32 elapsedTime )
 {
-    // Fetch particle asset.
-    ParticleAsset* pParticleAsset = mParticleAsset;
+    // Finish if there are no particles.
+    // NOTE:-   This can be called from a worker thread so must not use the console, the Sim or the profiler.
+    if ( particleCount == 0 )
+        return;
 
     // Fetch the asset emitter.
     ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
 
+    // Fetch the particle store.
+    ParticleSystem::ParticleStore& particles = pEmitterNode->getParticles();
 
-    // **********************************************************************************************************************
-    // Copy Old Tick Position.
-    // **********************************************************************************************************************
-    pParticleNode->mRenderTickPosition = pParticleNode->mPreTickPosition = pParticleNode->mPostTickPosition;
+    // Sanity!
+    AssertFatal( firstIndex + particleCount <= particles.size(), "ParticlePlayer::integrateParticles() - Particle range is out of bounds." );
+
+    // Fetch the particle properties.
+    const F32* pParticleAge         = particles.mParticleAge.address() + firstIndex;
+    const F32* pParticleLifetime    = particles.mParticleLifetime.address() + firstIndex;
+    Vector2* pPosition              = particles.mPosition.address() + firstIndex;
+    Vector2* pVelocity              = particles.mVelocity.address() + firstIndex;
+    F32* pOrientationAngle          = particles.mOrientationAngle.address() + firstIndex;
+    const Vector2* pRenderSize      = particles.mRenderSize.address() + firstIndex;
+    F32* pRenderSpeed               = particles.mRenderSpeed.address() + firstIndex;
+    F32* pRenderSpin                = particles.mRenderSpin.address() + firstIndex;
+    F32* pRenderFixedForce          = particles.mRenderFixedForce.address() + firstIndex;
+    F32* pRenderRandomMotion        = particles.mRenderRandomMotion.address() + firstIndex;
+    Vector2* pPreTickPosition       = particles.mPreTickPosition.address() + firstIndex;
+    Vector2* pPostTickPosition      = particles.mPostTickPosition.address() + firstIndex;
+    Vector2* pRenderTickPosition    = particles.mRenderTickPosition.address() + firstIndex;
+    ParticleSystem::ParticleNode** pNodes = particles.mNodes.address() + firstIndex;
+
+    // Allocate the life-field scratch.
+    Vector<F32>& integrationScratch = pEmitterNode->getIntegrationScratch();
+    integrationScratch.setSize( particleCount * INTEGRATION_SCRATCH_COUNT );
+    F32* pLifeAge       = integrationScratch.address() + (particleCount * INTEGRATION_SCRATCH_AGE);
+    F32* pSpeedLife     = integrationScratch.address() + (particleCount * INTEGRATION_SCRATCH_SPEED);
+    F32* pForceLife     = integrationScratch.address() + (particleCount * INTEGRATION_SCRATCH_FIXED_FORCE);
+    F32* pMotionLife    = integrationScratch.address() + (particleCount * INTEGRATION_SCRATCH_RANDOM_MOTION);
+    F32* pSpinLife      = integrationScratch.address() + (particleCount * INTEGRATION_SCRATCH_SPIN);
 
 
     // **********************************************************************************************************************
-    // Scale Size.
+    // Copy Old Tick Position.
     // **********************************************************************************************************************
-
-    // Scale Size-X.
-    pParticleNode->mRenderSize.x = mClampF( pParticleNode->mSize.x * pParticleAssetEmitter->getSizeXLifeField().getFieldValue( particleAge ),
-                                            pParticleAssetEmitter->getSizeXBaseField().getMinValue(),
-                                            pParticleAssetEmitter->getSizeXBaseField().getMaxValue());
-
-    // Is the particle using a fixed aspect?
-    if ( pParticleAssetEmitter->getFixedAspect() )
-    {
-        // Yes, so simply copy Size-X.
-        pParticleNode->mRenderSize.y = pParticleNode->mRenderSize.x;
-    }
-    else
-    {
-        // No, so Scale Size-Y.
-        pParticleNode->mRenderSize.y = mClampF( pParticleNode->mSize.y * pParticleAssetEmitter->getSizeYLifeField().getFieldValue( particleAge ),
-                                                pParticleAssetEmitter->getSizeYBaseField().getMinValue(),
-                                                pParticleAssetEmitter->getSizeYBaseField().getMaxValue() );
-    }
+    for ( U32 index = 0; index < particleCount; ++index )
+        pRenderTickPosition[index] = pPreTickPosition[index] = pPostTickPosition[index];
 
 
     // **********************************************************************************************************************
-    // Scale Speed.
+    // Evaluate Life Fields.
     // **********************************************************************************************************************
-    pParticleNode->mRenderSpeed = mClampF(  pParticleNode->mSpeed * pParticleAssetEmitter->getSpeedLifeField().getFieldValue( particleAge ),
-                                            pParticleAssetEmitter->getSpeedBaseField().getMinValue(),
-                                            pParticleAssetEmitter->getSpeedBaseField().getMaxValue() );
 
+    // Calculate the normalized particle ages.
+    // NOTE:-   A new particle is always at zero age even without a lifetime.
+    for ( U32 index = 0; index < particleCount; ++index )
+        pLifeAge[index] = mIsZero( pParticleAge[index] ) ? 0.0f : pParticleAge[index] / pParticleLifetime[index];
 
-    // **********************************************************************************************************************
-    // Scale Fixed-Force.
-    // **********************************************************************************************************************
-    pParticleNode->mRenderFixedForce = mClampF( pParticleNode->mFixedForce * pParticleAssetEmitter->getFixedForceLifeField().getFieldValue( particleAge ),
-                                                pParticleAssetEmitter->getFixedForceBaseField().getMinValue(),
-                                                pParticleAssetEmitter->getFixedForceBaseField().getMaxValue() );
+    // Fetch the motion life fields for all the particles.
+    pParticleAssetEmitter->getSpeedLifeField().getFieldValues( pLifeAge, particleCount, pSpeedLife );
+    pParticleAssetEmitter->getFixedForceLifeField().getFieldValues( pLifeAge, particleCount, pForceLife );
+    pParticleAssetEmitter->getRandomMotionLifeField().getFieldValues( pLifeAge, particleCount, pMotionLife );
+    pParticleAssetEmitter->getSpinLifeField().getFieldValues( pLifeAge, particleCount, pSpinLife );
 
 
     // **********************************************************************************************************************
-    // Scale Random-Motion.
+    // Evaluate Size and RGBA Components.
     // **********************************************************************************************************************
-    pParticleNode->mRenderRandomMotion = mClampF(   pParticleNode->mRandomMotion * pParticleAssetEmitter->getRandomMotionLifeField().getFieldValue( particleAge ),
-                                                    pParticleAssetEmitter->getRandomMotionBaseField().getMinValue(),
-                                                    pParticleAssetEmitter->getRandomMotionBaseField().getMaxValue() );
+    evaluateParticleLifeAppearance( pEmitterNode, firstIndex, particleCount );
 
 
     // **********************************************************************************************************************
-    // Calculate RGBA Components.
+    // Scale Speed, Fixed-Force and Random-Motion.
     // **********************************************************************************************************************
+    m_f32_bulk_scale_clamp( particles.mSpeed.address() + firstIndex, pSpeedLife, particleCount,
+                            pParticleAssetEmitter->getSpeedBaseField().getMinValue(),
+                            pParticleAssetEmitter->getSpeedBaseField().getMaxValue(),
+                            pRenderSpeed );
 
-    // Fetch the channels.
-    const ParticleAssetField& redChannel = pParticleAssetEmitter->getRedChannelLifeField();
-    const ParticleAssetField& greenChannel = pParticleAssetEmitter->getGreenChannelLifeField();
-    const ParticleAssetField& blueChannel = pParticleAssetEmitter->getBlueChannelLifeField();
-    const ParticleAssetField& alphaChannel = pParticleAssetEmitter->getAlphaChannelLifeField();
-    const ParticleAssetField& alphaChannelScale = pParticleAsset->getAlphaChannelScaleField();
+    m_f32_bulk_scale_clamp( particles.mFixedForce.address() + firstIndex, pForceLife, particleCount,
+                            pParticleAssetEmitter->getFixedForceBaseField().getMinValue(),
+                            pParticleAssetEmitter->getFixedForceBaseField().getMaxValue(),
+                            pRenderFixedForce );
 
-    // Calculate the color.
-    pParticleNode->mColor.set(  mClampF( redChannel.getFieldValue( particleAge ), redChannel.getMinValue(), redChannel.getMaxValue() ),
-                                mClampF( greenChannel.getFieldValue( particleAge ),greenChannel.getMinValue(), greenChannel.getMaxValue() ),
-                                mClampF( blueChannel.getFieldValue( particleAge ), blueChannel.getMinValue(),blueChannel.getMaxValue() ),
-                                mClampF( alphaChannel.getFieldValue( particleAge ) * alphaChannelScale.getFieldValue( 0.0f ), alphaChannel.getMinValue(), alphaChannel.getMaxValue() ) );
+    m_f32_bulk_scale_clamp( particles.mRandomMotion.address() + firstIndex, pMotionLife, particleCount,
+                            pParticleAssetEmitter->getRandomMotionBaseField().getMinValue(),
+                            pParticleAssetEmitter->getRandomMotionBaseField().getMaxValue(),
+                            pRenderRandomMotion );
 
 
     // **********************************************************************************************************************
     // Integrate Particle.
     // **********************************************************************************************************************
 
-
     // Is the emitter in static mode?
     if ( !pParticleAssetEmitter->isStaticFrameProvider() )
     {
-        // No, so update animation.
-        pParticleNode->mFrameProvider.updateAnimation( elapsedTime );
+        // No, so update animations.
+        for ( U32 index = 0; index < particleCount; ++index )
+            pNodes[index]->mFrameProvider.updateAnimation( elapsedTime );
     }
 
 
@@ -1404,29 +1656,26 @@ void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, ParticleSyste
     // Calculate the velocity if not a single particle.
     if ( !pParticleAssetEmitter->getSingleParticle() )
     {
-        // Calculate random motion (if we've got any).
-        if ( mNotZero( pParticleNode->mRenderRandomMotion ) )
+        // Fetch the emitter random stream.
+        RandomLCG& random = pEmitterNode->getRandom();
+
+        // Add time-integrated random motion into velocity (if we've got any).
+        for ( U32 index = 0; index < particleCount; ++index )
         {
-            // Fetch random motion.
-            const F32 randomMotion = pParticleNode->mRenderRandomMotion * 0.5f;
+            // Skip if no random motion.
+            if ( mIsZero( pRenderRandomMotion[index] ) )
+                continue;
 
-            // Add time-integrated random motion into velocity.
-            pParticleNode->mVelocity += Vector2( CoreMath::mGetRandomF(-randomMotion, randomMotion) * elapsedTime, CoreMath::mGetRandomF(-randomMotion, randomMotion) * elapsedTime );
-        }
+            // Fetch random motion.
+            const F32 randomMotion = pRenderRandomMotion[index] * 0.5f;
 
-        // Do we have any fixed force?
-        if ( mNotZero( pParticleNode->mRenderFixedForce ) )
-        {
-            // Yes, so time-integrate a fixed force to the velocity.
-            pParticleNode->mVelocity += (pParticleAssetEmitter->getFixedForceDirection() * (pParticleNode->mRenderFixedForce * getForceScale()) * elapsedTime);
+            pVelocity[index] += Vector2( random.randRangeF(-randomMotion, randomMotion) * elapsedTime, random.randRangeF(-randomMotion, randomMotion) * elapsedTime );
         }
 
-        // Are we suppressing movement?
-        if ( !pParticleNode->mSuppressMovement )
-        {
-            // No, so adjust particle position.
-            pParticleNode->mPosition += (pParticleNode->mVelocity * pParticleNode->mRenderSpeed * elapsedTime);
-        }
+        // Time-integrate the fixed force into the velocity then the velocity into the position.
+        m_particle2F_bulk_integrate( (F32*)pPosition, (F32*)pVelocity, pRenderSpeed, pRenderFixedForce,
+                                     (const F32*)&(pParticleAssetEmitter->getFixedForceDirection()), getForceScale(),
+                                     particleCount, elapsedTime );
     }
 
 
@@ -1435,60 +1684,231 @@ void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, ParticleSyste
     // **********************************************************************************************************************
     if ( pParticleAssetEmitter->getKeepAligned() && pParticleAssetEmitter->getOrientationType() == ParticleAssetEmitter::ALIGNED_ORIENTATION )
     {
-        // Yes, so calculate last movement direction.
-        F32 movementAngle = mRadToDeg( mAtan( pParticleNode->mVelocity.x, pParticleNode->mVelocity.y ) );
+        // Yes, so fetch the aligned angle offset.
+        const F32 alignedAngleOffset = pParticleAssetEmitter->getAlignedAngleOffset();
 
-        // Adjust for negative ArcTan quadrants.
-        if ( movementAngle < 0.0f )
-            movementAngle += 360.0f;
+        for ( U32 index = 0; index < particleCount; ++index )
+        {
+            // Calculate last movement direction.
+            F32 movementAngle = mRadToDeg( mAtan( pVelocity[index].x, pVelocity[index].y ) );
 
-        // Set new Orientation Angle.
-        pParticleNode->mOrientationAngle = movementAngle - pParticleAssetEmitter->getAlignedAngleOffset();
+            // Adjust for negative ArcTan quadrants.
+            if ( movementAngle < 0.0f )
+                movementAngle += 360.0f;
 
+            // Set new Orientation Angle.
+            pOrientationAngle[index] = movementAngle - alignedAngleOffset;
+        }
     }
     else
     {
         // No, so calculate the render spin.
-        pParticleNode->mRenderSpin = pParticleNode->mSpin * pParticleAssetEmitter->getSpinLifeField().getFieldValue( particleAge );
+        m_f32_bulk_scale_clamp( particles.mSpin.address() + firstIndex, pSpinLife, particleCount, -F32_MAX, F32_MAX, pRenderSpin );
 
-        // Have we got some Spin?
-        if ( mNotZero(pParticleNode->mRenderSpin) )
+        for ( U32 index = 0; index < particleCount; ++index )
         {
-            // Yes, so add into Orientation.
-            pParticleNode->mOrientationAngle += pParticleNode->mRenderSpin * elapsedTime;
+            // Skip if we've got no spin.
+            if ( mIsZero( pRenderSpin[index] ) )
+                continue;
 
-            // Clamp the orientation angle.
-            pParticleNode->mOrientationAngle = mFmod( pParticleNode->mOrientationAngle, 360.0f );
+            // Add into Orientation, clamping the orientation angle.
+            pOrientationAngle[index] = mFmod( pOrientationAngle[index] + (pRenderSpin[index] * elapsedTime), 360.0f );
         }
     }
 
-    // Calculate the transform.
-    pParticleNode->mTransform.Set( pParticleNode->mPosition, mDegToRad(pParticleNode->mOrientationAngle) );
-
     // Fetch the local AABB..
-    const Vector2& localAABB0 = pParticleAssetEmitter->getLocalPivotAABB0();
-    const Vector2& localAABB1 = pParticleAssetEmitter->getLocalPivotAABB1();
-    const Vector2& localAABB2 = pParticleAssetEmitter->getLocalPivotAABB2();
-    const Vector2& localAABB3 = pParticleAssetEmitter->getLocalPivotAABB3();
+    F32 localAABB[8];
+    fetchLocalPivotAABB( pParticleAssetEmitter, localAABB );
+
+    b2Transform* pTransform = particles.mTransform.address() + firstIndex;
+    for ( U32 index = 0; index < particleCount; ++index )
+    {
+        // Calculate the transform.
+        pTransform[index].Set( pPosition[index], mDegToRad(pOrientationAngle[index]) );
+
+        // Set Post Tick Position.
+        pPostTickPosition[index] = pPosition[index];
+    }
+
+    // Calculate the world OOBBs.
+    calculateParticleOOBBs( particles, localAABB, firstIndex, particleCount );
+}
+
+//-----------------------------------------------------------------------------
+
+void ParticlePlayer::evaluateParticleLifeAppearance( EmitterNode* pEmitterNode, const U32 firstIndex, const U32 particleCount )
+{
+    // NOTE:-   This expects the integration scratch to have been sized for the particles with their normalized ages filled in.
+    //          This can be called from a worker thread so must not use the console, the Sim or the profiler.
+
+    // Fetch particle asset.
+    ParticleAsset* pParticleAsset = mParticleAsset;
+
+    // Fetch the asset emitter.
+    ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
+
+    // Fetch the particle store.
+    ParticleSystem::ParticleStore& particles = pEmitterNode->getParticles();
 
-    // Fetch the render size.
-    const Vector2& renderSize = pParticleNode->mRenderSize;
+    // Fetch the particle properties.
+    Vector2* pRenderSize            = particles.mRenderSize.address() + firstIndex;
+    ColorF* pColor                  = particles.mColor.address() + firstIndex;
 
-    // Calculate the scaled AABB.
-    Vector2 scaledAABB[4];
-    scaledAABB[0] = localAABB0 * renderSize;
-    scaledAABB[1] = localAABB1 * renderSize;
-    scaledAABB[2] = localAABB2 * renderSize;
-    scaledAABB[3] = localAABB3 * renderSize;
+    // Fetch the life-field scratch.
+    Vector<F32>& integrationScratch = pEmitterNode->getIntegrationScratch();
+    const F32* pLifeAge = integrationScratch.address() + (particleCount * INTEGRATION_SCRATCH_AGE);
+    F32* pSizeXLife     = integrationScratch.address() + (particleCount * INTEGRATION_SCRATCH_SIZE_X);
+    F32* pSizeYLife     = integrationScratch.address() + (particleCount * INTEGRATION_SCRATCH_SIZE_Y);
+    F32* pRedLife       = integrationScratch.address() + (particleCount * INTEGRATION_SCRATCH_RED);
+    F32* pGreenLife     = integrationScratch.address() + (particleCount * INTEGRATION_SCRATCH_GREEN);
+    F32* pBlueLife      = integrationScratch.address() + (particleCount * INTEGRATION_SCRATCH_BLUE);
+    F32* pAlphaLife     = integrationScratch.address() + (particleCount * INTEGRATION_SCRATCH_ALPHA);
 
-    // Calculate the world OOBB..
-    CoreMath::mCalculateOOBB( scaledAABB, pParticleNode->mTransform, pParticleNode->mRenderOOBB );
+    // Fetch the channels.
+    const ParticleAssetField& redChannel = pParticleAssetEmitter->getRedChannelLifeField();
+    const ParticleAssetField& greenChannel = pParticleAssetEmitter->getGreenChannelLifeField();
+    const ParticleAssetField& blueChannel = pParticleAssetEmitter->getBlueChannelLifeField();
+    const ParticleAssetField& alphaChannel = pParticleAssetEmitter->getAlphaChannelLifeField();
+
+    // Fetch the life fields for all the particles.
+    pParticleAssetEmitter->getSizeXLifeField().getFieldValues( pLifeAge, particleCount, pSizeXLife );
+    pParticleAssetEmitter->getSizeYLifeField().getFieldValues( pLifeAge, particleCount, pSizeYLife );
+    redChannel.getFieldValues( pLifeAge, particleCount, pRedLife );
+    greenChannel.getFieldValues( pLifeAge, particleCount, pGreenLife );
+    blueChannel.getFieldValues( pLifeAge, particleCount, pBlueLife );
+    alphaChannel.getFieldValues( pLifeAge, particleCount, pAlphaLife );
 
 
     // **********************************************************************************************************************
-    // Set Post Tick Position.
+    // Scale Size.
     // **********************************************************************************************************************
-    pParticleNode->mPostTickPosition = pParticleNode->mPosition;
+
+    // Fetch the size ranges.
+    const ParticleAssetField& sizeXBaseField = pParticleAssetEmitter->getSizeXBaseField();
+    const ParticleAssetField& sizeYBaseField = pParticleAssetEmitter->getSizeYBaseField();
+
+    // Is the particle using a fixed aspect?
+    // NOTE:-   The Size-Y was made the same as Size-X when the particle was configured.
+    if ( pParticleAssetEmitter->getFixedAspect() )
+    {
+        // Yes, so scale both by Size-X.
+        const F32 sizeMinimum[2] = { sizeXBaseField.getMinValue(), sizeXBaseField.getMinValue() };
+        const F32 sizeMaximum[2] = { sizeXBaseField.getMaxValue(), sizeXBaseField.getMaxValue() };
+        m_point2F_bulk_scale_clamp( (const F32*)(particles.mSize.address() + firstIndex), pSizeXLife, pSizeXLife, particleCount, sizeMinimum, sizeMaximum, (F32*)pRenderSize );
+    }
+    else
+    {
+        // No, so scale Size-X and Size-Y.
+        const F32 sizeMinimum[2] = { sizeXBaseField.getMinValue(), sizeYBaseField.getMinValue() };
+        const F32 sizeMaximum[2] = { sizeXBaseField.getMaxValue(), sizeYBaseField.getMaxValue() };
+        m_point2F_bulk_scale_clamp( (const F32*)(particles.mSize.address() + firstIndex), pSizeXLife, pSizeYLife, particleCount, sizeMinimum, sizeMaximum, (F32*)pRenderSize );
+    }
+
+
+    // **********************************************************************************************************************
+    // Calculate RGBA Components.
+    // **********************************************************************************************************************
+
+    // Fetch the alpha scale.
+    const F32 alphaScale = pParticleAsset->getAlphaChannelScaleField().getFieldValue( 0.0f );
+
+    // Calculate the colors.
+    for ( U32 index = 0; index < particleCount; ++index )
+    {
+        pColor[index].set(  mClampF( pRedLife[index], redChannel.getMinValue(), redChannel.getMaxValue() ),
+                            mClampF( pGreenLife[index], greenChannel.getMinValue(), greenChannel.getMaxValue() ),
+                            mClampF( pBlueLife[index], blueChannel.getMinValue(), blueChannel.getMaxValue() ),
+                            mClampF( pAlphaLife[index] * alphaScale, alphaChannel.getMinValue(), alphaChannel.getMaxValue() ) );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void ParticlePlayer::evaluateCosmeticParticles( EmitterNode* pEmitterNode )
+{
+    // NOTE:-   Cosmetic particles are never integrated so everything is evaluated here from the emission state
+    //          and the particle age alone.  The motion uses the emission speed and fixed-force (the closed form
+    //          of the integration with those held constant) and random-motion is ignored.
+
+    // Fetch the asset emitter.
+    ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
+
+    // Fetch the particle store.
+    ParticleSystem::ParticleStore& particles = pEmitterNode->getParticles();
+
+    // Fetch the particle count.
+    const U32 particleCount = particles.size();
+
+    // Finish if there are no particles.
+    if ( particleCount == 0 )
+        return;
+
+    // Allocate the life-field scratch.
+    Vector<F32>& integrationScratch = pEmitterNode->getIntegrationScratch();
+    integrationScratch.setSize( particleCount * INTEGRATION_SCRATCH_COUNT );
+    F32* pLifeAge = integrationScratch.address() + (particleCount * INTEGRATION_SCRATCH_AGE);
+
+    // Calculate the normalized particle ages at the render time.
+    for ( U32 index = 0; index < particleCount; ++index )
+    {
+        const F32 renderAge = getMax( 0.0f, particles.mParticleAge[index] + mRenderTimeOffset );
+        pLifeAge[index] = mIsZero( renderAge ) ? 0.0f : renderAge / particles.mParticleLifetime[index];
+    }
+
+    // Evaluate the size and colors.
+    evaluateParticleLifeAppearance( pEmitterNode, 0, particleCount );
+
+    // Calculate the fixed-force acceleration direction.
+    const Vector2 forceDirection = pParticleAssetEmitter->getFixedForceDirection() * getForceScale();
+
+    // Fetch the alignment.
+    const bool keepAligned = pParticleAssetEmitter->getKeepAligned() && pParticleAssetEmitter->getOrientationType() == ParticleAssetEmitter::ALIGNED_ORIENTATION;
+    const F32 alignedAngleOffset = pParticleAssetEmitter->getAlignedAngleOffset();
+
+    // Fetch the local AABB..
+    F32 localAABB[8];
+    fetchLocalPivotAABB( pParticleAssetEmitter, localAABB );
+
+    for ( U32 index = 0; index < particleCount; ++index )
+    {
+        // Fetch the render age.
+        const F32 renderAge = getMax( 0.0f, particles.mParticleAge[index] + mRenderTimeOffset );
+
+        // Calculate the acceleration.
+        const Vector2 acceleration = forceDirection * particles.mRenderFixedForce[index];
+
+        // Fetch the emission velocity.
+        const Vector2& emissionVelocity = particles.mVelocity[index];
+
+        // Calculate the position.
+        const Vector2 renderPosition = particles.mPosition[index] + ((emissionVelocity * renderAge) + (acceleration * (0.5f * renderAge * renderAge))) * particles.mRenderSpeed[index];
+        particles.mRenderTickPosition[index] = renderPosition;
+
+        // Calculate the orientation.
+        F32 renderAngle;
+        if ( keepAligned )
+        {
+            // Calculate the movement direction.
+            const Vector2 velocity = emissionVelocity + (acceleration * renderAge);
+            renderAngle = mRadToDeg( mAtan( velocity.x, velocity.y ) );
+
+            // Adjust for negative ArcTan quadrants.
+            if ( renderAngle < 0.0f )
+                renderAngle += 360.0f;
+
+            renderAngle -= alignedAngleOffset;
+        }
+        else
+        {
+            renderAngle = mFmod( particles.mOrientationAngle[index] + (particles.mRenderSpin[index] * renderAge), 360.0f );
+        }
+
+        // Calculate the transform.
+        particles.mTransform[index].Set( renderPosition, mDegToRad(renderAngle) );
+    }
+
+    // Calculate the world OOBBs.
+    calculateParticleOOBBs( particles, localAABB, 0, particleCount );
 }
 
 //-----------------------------------------------------------------------------
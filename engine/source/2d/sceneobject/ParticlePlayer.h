@@ -31,6 +31,10 @@
 #include "2d/core/ParticleSystem.h"
 #endif
 
+#ifndef _MRANDOM_H_
+#include "math/mRandom.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 #define PARTICLE_PLAYER_EMISSION_RATE_SCALE     "$pref::T2D::ParticlePlayerEmissionRateScale"
@@ -51,11 +55,19 @@ private:
     private:
         ParticlePlayer*                 mOwner;
         ParticleAssetEmitter*           mpAssetEmitter;
-        ParticleSystem::ParticleNode    mParticleNodeHead;
+        ParticleSystem::ParticleStore   mParticles;
         F32                             mTimeSinceLastGeneration;
         bool                            mPaused;
         bool                            mVisible;
 
+        /// Particles waiting to be integrated.
+        U32                             mPendingParticleCount;
+        F32                             mPendingElapsedTime;
+
+        /// Per-emitter state used whilst integrating so emitters can be integrated concurrently.
+        RandomLCG                       mRandom;
+        Vector<F32>                     mIntegrationScratch;
+
     public:
         EmitterNode( ParticlePlayer* pParticlePlayer, ParticleAssetEmitter* pParticleAssetEmitter )
         {
@@ -78,8 +90,14 @@ private:
             // Reset time since last generation.
             mTimeSinceLastGeneration = 0.0f;
 
-            // Reset the node head.
-            mParticleNodeHead.mNextNode = mParticleNodeHead.mPreviousNode = &mParticleNodeHead;
+            // Reset the pending integration.
+            mPendingParticleCount = 0;
+            mPendingElapsedTime = 0.0f;
+
+            // Seed the emitter random stream.
+            // NOTE:-   This is drawn from the global stream on creation so the emitter sequence is deterministic
+            //          regardless of which thread ends up integrating the emitter.
+            mRandom.setSeed( CoreMath::mGetRandomI() );
         }
 
         ~EmitterNode()
@@ -90,11 +108,10 @@ private:
         inline ParticlePlayer* getOwner( void ) const { return mOwner; }
         inline ParticleAssetEmitter* getAssetEmitter( void ) const { return mpAssetEmitter; }
 
-        inline bool getActiveParticles( void ) const { return mParticleNodeHead.mNextNode != &mParticleNodeHead; }
+        inline bool getActiveParticles( void ) const { return mParticles.size() != 0; }
+        inline U32 getParticleCount( void ) const { return mParticles.size(); }
 
-        inline ParticleSystem::ParticleNode* getFirstParticle( void ) const { return mParticleNodeHead.mNextNode; }
-        inline ParticleSystem::ParticleNode* getLastParticle( void ) const { return mParticleNodeHead.mPreviousNode; }
-        inline ParticleSystem::ParticleNode* getParticleNodeHead( void ) { return &mParticleNodeHead; }
+        inline ParticleSystem::ParticleStore& getParticles( void ) { return mParticles; }
 
         inline void setTimeSinceLastGeneration( const F32 timeSinceLastGeneration ) { mTimeSinceLastGeneration = timeSinceLastGeneration; }
         inline F32 getTimeSinceLastGeneration( void ) const { return mTimeSinceLastGeneration; }
@@ -105,9 +122,16 @@ private:
         inline void setVisible( const bool visible ) { mVisible = visible; }
         inline bool getVisible( void ) const { return mVisible; }
 
-        ParticleSystem::ParticleNode* createParticle( void );
-        void freeParticle( ParticleSystem::ParticleNode* pParticleNode );
-        void freeAllParticles( void );        
+        inline void setPendingIntegration( const U32 particleCount, const F32 elapsedTime ) { mPendingParticleCount = particleCount; mPendingElapsedTime = elapsedTime; }
+        inline U32 getPendingParticleCount( void ) const { return mPendingParticleCount; }
+        inline F32 getPendingElapsedTime( void ) const { return mPendingElapsedTime; }
+
+        inline RandomLCG& getRandom( void ) { return mRandom; }
+        inline Vector<F32>& getIntegrationScratch( void ) { return mIntegrationScratch; }
+
+        U32 createParticle( void );
+        void releaseParticle( const U32 particleIndex );
+        void freeAllParticles( void );
     };
 
     typedef Vector<EmitterNode*> typeEmitterVector;
@@ -123,6 +147,8 @@ private:
     bool                        mPlaying;
     bool                        mPaused;
     F32                         mAge;
+    F32                         mRenderTimeOffset;
+    F32                         mLodScale;
     F32                         mEmissionRateScale;
     F32                         mSizeScale;
     F32                         mForceScale;
@@ -131,6 +157,28 @@ private:
     bool                        mWaitingForParticles;
     bool                        mWaitingForDelete;
 
+    /// Per-particle view culling scratch used when rendering.
+    Vector<b2AABB>              mRenderCullAABBs;
+    Vector<U8>                  mRenderCullResults;
+
+    /// Life-field values evaluated for every particle during integration.
+    enum IntegrationScratch
+    {
+        INTEGRATION_SCRATCH_AGE,
+        INTEGRATION_SCRATCH_SIZE_X,
+        INTEGRATION_SCRATCH_SIZE_Y,
+        INTEGRATION_SCRATCH_SPEED,
+        INTEGRATION_SCRATCH_FIXED_FORCE,
+        INTEGRATION_SCRATCH_RANDOM_MOTION,
+        INTEGRATION_SCRATCH_SPIN,
+        INTEGRATION_SCRATCH_RED,
+        INTEGRATION_SCRATCH_GREEN,
+        INTEGRATION_SCRATCH_BLUE,
+        INTEGRATION_SCRATCH_ALPHA,
+
+        INTEGRATION_SCRATCH_COUNT
+    };
+
 public:
     ParticlePlayer();
     virtual ~ParticlePlayer();
@@ -142,9 +190,18 @@ public:
     virtual void preIntegrate( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
     void integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
     void interpolateObject( const F32 timeDelta );
+    virtual bool isTickDormant( void ) const { return false; }
+
+    /// Emitter integration.
+    /// The particles of each emitter are integrated after all the scene objects have been integrated
+    /// so that the scene can integrate all the emitters together, in parallel if required.
+    void gatherEmitterIntegrations( Vector<ParticleSystem::EmitterIntegration>& emitterIntegrations );
+    void integrateEmitter( const U32 emitterIndex );
+    static void integrateEmitterRange( void* pContext, const U32 start, const U32 end );
 
     virtual bool validRender( void ) const { return mParticleAsset.notNull() && mParticleAsset->isAssetValid(); }
     virtual bool shouldRender( void ) const { return true; }
+    virtual bool canCacheRender( void ) const { return false; }
     virtual void sceneRender( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer );
     virtual void sceneRenderOverlay( const SceneRenderState* sceneRenderState );
 
@@ -169,6 +226,8 @@ public:
     inline void setTimeScale( const F32 scale ) { mTimeScale = scale; }
     inline F32 getTimeScale( void  ) const { return mTimeScale; }
 
+    inline F32 getLodScale( void ) const { return mLodScale; }
+
     inline const U32 getEmitterCount( void ) const { return (U32)mEmitters.size(); }
 
     void setEmitterPaused( const bool paused, const U32 emitterIndex );
@@ -192,8 +251,11 @@ protected:
     virtual void onAssetRefreshed( AssetPtrBase* pAssetPtrBase );
 
     /// Particle Creation/Integration.
-    void configureParticle( EmitterNode* pEmitterNode, ParticleSystem::ParticleNode* pParticleNode );
-    void integrateParticle( EmitterNode* pEmitterNode, ParticleSystem::ParticleNode* pParticleNode, const F32 particleAge, const F32 elapsedTime );
+    void configureParticle( EmitterNode* pEmitterNode, const U32 particleIndex );
+    void integrateParticles( EmitterNode* pEmitterNode, const U32 firstIndex, const U32 particleCount, const F32 elapsedTime );
+    void evaluateParticleLifeAppearance( EmitterNode* pEmitterNode, const U32 firstIndex, const U32 particleCount );
+    void evaluateCosmeticParticles( EmitterNode* pEmitterNode );
+    void updateLodScale( void );
 
     /// Persistence.
     virtual void onTamlAddParent( SimObject* pParentObject );
@@ -84,6 +84,17 @@ ConsoleMethodWithDocs(ParticlePlayer, getParticleInterpolation, ConsoleFloat, 2,
 
 //-----------------------------------------------------------------------------
 
+/*! Gets the current level-of-detail scale applied to the emission rate and maximum particles.
+    This is calculated each tick from the particle asset level-of-detail settings and the size of the player in the scene windows.
+    @return The current level-of-detail scale in the range [0,1].
+*/
+ConsoleMethodWithDocs(ParticlePlayer, getLodScale, ConsoleFloat, 2, 2, ())
+{
+    return object->getLodScale();
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Sets the scale for the particle player emission rate.
     @param scale The scale for the particle player emission rate.
     @return No return value.
@@ -97,6 +97,11 @@ static StringTableEntry polygonTypeName         = StringTable->insert( "Polygon"
 static StringTableEntry chainTypeName           = StringTable->insert( "Chain" );
 static StringTableEntry edgeTypeName            = StringTable->insert( "Edge" );
 
+// Script callback names.
+static StringTableEntry updateCallbackName      = StringTable->insert( "onUpdate" );
+static StringTableEntry wakeCallbackName        = StringTable->insert( "onWake" );
+static StringTableEntry sleepCallbackName       = StringTable->insert( "onSleep" );
+
 //------------------------------------------------------------------------------
 
 // Important: If these defaults are changed then modify the associated "write" field protected methods to ensure
@@ -114,20 +119,24 @@ SceneObject::SceneObject() :
     mSceneLayer(0),
     mSceneLayerMask(BIT(mSceneLayer)),
     mSceneLayerDepth(0.0f),
+    mSceneLayerIndex(0),
 
     /// Scene groups.
     mSceneGroup(0),
     mSceneGroupMask(BIT(mSceneGroup)),
+    mSceneGroupIndex(0),
 
     /// Area.
     mWorldProxyId(-1),
 
+    /// Transform history.
+    mpRewindHistory( NULL ),
+    mpSnapshots( NULL ),
+
     /// Position / Angle.
-    mPreTickPosition( 0.0f, 0.0f ),
-    mPreTickAngle( 0.0f ),
-    mRenderPosition( 0.0f, 0.0f ),
-    mRenderAngle( 0.0f ),
-    mSpatialDirty( true ),
+    mTransformHandle( -1 ),
+    mSpatialIntegrated( false ),
+    mSpatialMoved( false ),
 
     /// Body.
     mpBody(NULL),
@@ -159,6 +168,7 @@ SceneObject::SceneObject() :
     /// Script callbacks.
     mUpdateCallback(false),
     mCollisionCallback(false),
+    mCollisionCallbackMask(MASK_ALL),
     mSleepingCallback(false),
 
     /// Debug mode.
@@ -176,6 +186,13 @@ SceneObject::SceneObject() :
     mBeingSafeDeleted(false),
     mSafeDeleteReady(true),
 
+    /// Pooling.
+    mPoolTemplateId(0),
+    mPoolIdle(false),
+
+    /// Scene ticking.
+    mSceneTickIndex(-1),
+
     /// Miscellaneous.
     mBatchIsolated(false),
     mSerialiseKey(0),
@@ -210,6 +227,7 @@ SceneObject::SceneObject() :
     mBodyDefinition.awake           = true;
     mBodyDefinition.fixedRotation   = false;
     mBodyDefinition.bullet          = false;
+    mBodyDefinition.bulletStaticOnly = false;
     mBodyDefinition.type            = b2_dynamicBody;
     mBodyDefinition.active          = true;
     mBodyDefinition.gravityScale    = 1.0f;
@@ -245,6 +263,10 @@ SceneObject::~SceneObject()
         mpScene->removeFromScene( this );
     }
 
+    // Delete the transform histories.
+    delete mpRewindHistory;
+    delete mpSnapshots;
+
     // Decrease scene-object count.
     --sGlobalSceneObjectCount;
 }
@@ -279,6 +301,7 @@ void SceneObject::initPersistFields()
     addProtectedField("Active", TypeBool, NULL, &setActive, &getActive, &writeActive, "" );
     addProtectedField("Awake", TypeBool, NULL, &setAwake, &getAwake, &writeAwake, "" );
     addProtectedField("Bullet", TypeBool, NULL, &setBullet, &getBullet, &writeBullet, "" );
+    addProtectedField("BulletStaticOnly", TypeBool, NULL, &setBulletStaticOnly, &getBulletStaticOnly, &writeBulletStaticOnly, "Whether continuous collision is only computed against static bodies.  This overrides Bullet." );
     addProtectedField("SleepingAllowed", TypeBool, NULL, &setSleepingAllowed, &getSleepingAllowed, &writeSleepingAllowed, "" );
 
     /// Collision control.
@@ -300,7 +323,7 @@ void SceneObject::initPersistFields()
     addProtectedField("GravityScale", TypeF32, NULL, &setGravityScale, &getGravityScale, &writeGravityScale, "");
 
     /// Render visibility.
-    addField("Visible", TypeBool, Offset(mVisible, SceneObject), &writeVisible, "");
+    addProtectedField("Visible", TypeBool, Offset(mVisible, SceneObject), &setVisible, &defaultProtectedGetFn, &writeVisible, "");
 
     /// Render blending.
     addField("BlendMode", TypeBool, Offset(mBlendMode, SceneObject), &writeBlendMode, "");
@@ -320,7 +343,8 @@ void SceneObject::initPersistFields()
 
     // Script callbacks.
     addField("UpdateCallback", TypeBool, Offset(mUpdateCallback, SceneObject), &writeUpdateCallback, "");
-    addField("CollisionCallback", TypeBool, Offset(mCollisionCallback, SceneObject), &writeCollisionCallback, "");
+    addProtectedField("CollisionCallback", TypeBool, Offset(mCollisionCallback, SceneObject), &setCollisionCallback, &defaultProtectedGetFn, &writeCollisionCallback, "");
+    addProtectedField("CollisionCallbackGroups", TypeS32, Offset(mCollisionCallbackMask, SceneObject), &setCollisionCallbackGroups, &getCollisionCallbackGroups, &writeCollisionCallbackGroups, "The scene groups whose contacts with this object are reported to script.");
     addField("SleepingCallback", TypeBool, Offset(mSleepingCallback, SceneObject), &writeSleepingCallback, "");
 
     /// Scene.
@@ -371,6 +395,26 @@ void SceneObject::onDestroyNotify( SceneObject* pSceneObject )
 
 //-----------------------------------------------------------------------------
 
+void SceneObject::onStaticModified( const char* slotName, const char* newValue )
+{
+    // Call parent.
+    Parent::onStaticModified( slotName, newValue );
+
+    // A field may change how the object renders so invalidate the layer render cache.
+    invalidateRenderCache();
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneObject::invalidateRenderCache( void )
+{
+    // Invalidate the render cache of the layer we're in (if in scene).
+    if ( mpScene )
+        mpScene->invalidateLayerRenderCache( mSceneLayer );
+}
+
+//-----------------------------------------------------------------------------
+
 void SceneObject::OnRegisterScene( Scene* pScene )
 {
     // Sanity!
@@ -383,6 +427,9 @@ void SceneObject::OnRegisterScene( Scene* pScene )
     // Set scene.
     mpScene = pScene;
 
+    // Allocate the spatials.
+    mTransformHandle = pScene->getTransformStore().allocate( this );
+
     // Create the physics body.
     mpBody = pScene->getWorld()->CreateBody( &mBodyDefinition );
 
@@ -420,6 +467,9 @@ void SceneObject::OnRegisterScene( Scene* pScene )
     // Reset the spatials.
     resetTickSpatials();
 
+    // Invalidate the layer render cache.
+    invalidateRenderCache();
+
     // Notify components.
     notifyComponentsAddToScene();
 }
@@ -435,6 +485,13 @@ void SceneObject::OnUnregisterScene( Scene* pScene )
     // Notify components.
     notifyComponentsRemoveFromScene();
 
+    // The rewind history is only meaningful within the scene.
+    delete mpRewindHistory;
+    mpRewindHistory = NULL;
+
+    // Invalidate the layer render cache.
+    invalidateRenderCache();
+
     // Copy fixtures to fixture definitions.
     for( typeCollisionFixtureVector::iterator itr = mCollisionFixtures.begin(); itr != mCollisionFixtures.end(); itr++ )
     {
@@ -471,6 +528,7 @@ void SceneObject::OnUnregisterScene( Scene* pScene )
     mBodyDefinition.awake           = getAwake();
     mBodyDefinition.fixedRotation   = getFixedAngle();
     mBodyDefinition.bullet          = getBullet();
+    mBodyDefinition.bulletStaticOnly = getBulletStaticOnly();
     mBodyDefinition.active          = getActive();
 
     // Destroy current contacts.
@@ -489,6 +547,10 @@ void SceneObject::OnUnregisterScene( Scene* pScene )
         mWorldProxyId = -1;
     }
 
+    // Release the spatials.
+    mpScene->getTransformStore().release( mTransformHandle );
+    mTransformHandle = -1;
+
     // Reset scene.
     mpScene = NULL;
 }
@@ -497,25 +559,22 @@ void SceneObject::OnUnregisterScene( Scene* pScene )
 
 void SceneObject::resetTickSpatials( const bool resize )
 {
-    // Set coincident pre-tick, current & render.
-    mPreTickPosition = mRenderPosition = getPosition();
-    mPreTickAngle = mRenderAngle = getAngle();
-
     // Fetch body transform.
     b2Transform bodyXform = getTransform();
 
     // Calculate current AABB.
     CoreMath::mCalculateAABB( getLocalSizedOOBB(), bodyXform, &mCurrentAABB );
 
-    // Set coincident AABBs.
-    mPreTickAABB = mCurrentAABB;
-
     // Calculate render OOBB.
     CoreMath::mCalculateOOBB( getLocalSizedOOBB(), bodyXform, mRenderOOBB );
 
-    // Update world proxy (if in scene).
+    // Update spatials and world proxy (if in scene).
     if ( mpScene )
     {
+        // Set coincident pre-tick, current & render spatials and AABBs.
+        // NOTE: This also flags the spatials as changed.
+        mpScene->getTransformStore().resetSpatials( mTransformHandle, bodyXform.p, getAngle(), mCurrentAABB );
+
         // Fetch world query.
         WorldQuery* pWorldQuery = mpScene->getWorldQuery();
 
@@ -532,10 +591,10 @@ void SceneObject::resetTickSpatials( const bool resize )
             // No, so we can simply update the proxy.
             pWorldQuery->update( this, mCurrentAABB, b2Vec2( 0.0f, 0.0f ) );
         }
-    }
 
-    // Flag spatial changed.
-    mSpatialDirty = true;
+        // Invalidate the layer render cache.
+        mpScene->invalidateLayerRenderCache( mSceneLayer );
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -545,16 +604,38 @@ void SceneObject::preIntegrate( const F32 totalTime, const F32 elapsedTime, Debu
     // Debug Profiling.
     PROFILE_SCOPE(SceneObject_PreIntegrate);
 
-   // Finish if nothing is dirty.
-    if ( !mSpatialDirty )
+    // Pre-integrate spatials.
+    preIntegrateSpatial();
+
+    // Are we playing back snapshots?
+    if ( mpSnapshots != NULL )
+    {
+        // Yes, so move to the delayed snapshot transform.
+        Vector2 position;
+        F32 angle;
+        if ( mpSnapshots->sample( totalTime - mpScene->getSnapshotDelay(), position, angle ) )
+            mpBody->SetTransform( position, angle );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneObject::preIntegrateSpatial( void )
+{
+    // NOTE: This can be called from worker threads so it must not use the profiler, console or world query.
+
+    // Fetch the spatials.
+    SceneTransformStore& transformStore = mpScene->getTransformStore();
+
+    // Finish if nothing is dirty.
+    if ( !transformStore.getSpatialDirty( mTransformHandle ) )
         return;
 
     // Reset spatial changed.
-    mSpatialDirty = false;
+    transformStore.setSpatialDirty( mTransformHandle, false );
 
-    mPreTickPosition = mRenderPosition = getPosition();
-    mPreTickAngle    = mRenderAngle = getAngle();
-    mPreTickAABB     = mCurrentAABB;
+    // Set coincident pre-tick & render spatials.
+    transformStore.setPreTickSpatials( mTransformHandle, mCurrentAABB );
 
     // Calculate render OOBB.
     CoreMath::mCalculateOOBB( getLocalSizedOOBB(), getTransform(), mRenderOOBB );
@@ -562,34 +643,177 @@ void SceneObject::preIntegrate( const F32 totalTime, const F32 elapsedTime, Debu
 
 //-----------------------------------------------------------------------------
 
+void SceneObject::integrateSpatial( void )
+{
+    // NOTE: This can be called from worker threads so it must not use the profiler, console or world query.
+
+    // Flag as integrated.
+    mSpatialIntegrated = true;
+
+    // Fetch the spatials.
+    SceneTransformStore& transformStore = mpScene->getTransformStore();
+
+    // Fetch position and angle.
+    const b2Vec2 position = getPosition();
+    const F32 angle = getAngle();
+
+    // Set the tick spatials.
+    transformStore.setTickSpatials( mTransformHandle, position, angle );
+
+    // Has the angle or position changed?
+    const Vector2 preTickPosition = transformStore.getPreTickPosition( mTransformHandle );
+    mSpatialMoved = transformStore.getPreTickAngle( mTransformHandle ) != angle || preTickPosition.x != position.x || preTickPosition.y != position.y;
+
+    // Finish if not moved.
+    if ( !mSpatialMoved )
+        return;
+
+    // Flag spatial dirty.
+    transformStore.setSpatialDirty( mTransformHandle, true );
+
+    // Calculate current AABB.
+    CoreMath::mCalculateAABB( getLocalSizedOOBB(), getTransform(), &mCurrentAABB );
+}
+
+//-----------------------------------------------------------------------------
+
+bool SceneObject::isTickDormant( void ) const
+{
+    // Is the body static?
+    if ( getBodyType() == b2_staticBody )
+    {
+        // Yes, so not dormant if it has moved since it was last integrated (a static body is always awake).
+        if ( getSpatialDirty() )
+            return false;
+
+        const SceneTransformStore& transformStore = mpScene->getTransformStore();
+        const Vector2 tickPosition = transformStore.getTickPosition( mTransformHandle );
+        const b2Vec2 position = getPosition();
+        if ( tickPosition.x != position.x || tickPosition.y != position.y || transformStore.getTickAngle( mTransformHandle ) != getAngle() )
+            return false;
+    }
+    // Not dormant if the body is awake (contacts wake the body).
+    else if ( getAwake() )
+    {
+        return false;
+    }
+
+    // Not dormant if moving or rotating to a target.
+    if ( mMoveToEventId != 0 || mRotateToEventId != 0 )
+        return false;
+
+    // Not dormant if any per-tick callbacks are required.
+    if ( mUpdateCallback || mSleepingCallback || mLifetimeActive )
+        return false;
+
+    // Not dormant if anything is attached.
+    if ( mpAttachedGui != NULL || mpAttachedCamera != NULL )
+        return false;
+
+    // Not dormant if playing back snapshots.
+    if ( mpSnapshots != NULL )
+        return false;
+
+    // Not dormant if any components need updating.
+    return !hasComponents();
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneObject::addSnapshot( const F32 time, const Vector2& position, const F32 angle )
+{
+    // Create the snapshots if needed.
+    if ( mpSnapshots == NULL )
+        mpSnapshots = new SceneTransformHistory( 32 );
+
+    mpSnapshots->push( time, position, angle );
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneObject::clearSnapshots( void )
+{
+    delete mpSnapshots;
+    mpSnapshots = NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneObject::recordRewindHistory( const F32 time, const U32 capacity )
+{
+    // Create or resize the history.
+    if ( mpRewindHistory == NULL )
+        mpRewindHistory = new SceneTransformHistory( capacity );
+    else if ( mpRewindHistory->getCapacity() != capacity )
+        mpRewindHistory->setCapacity( capacity );
+
+    // Objects aren't recorded whilst dormant but neither do they move so fill
+    // the gap with the newest transform as of the previous tick.
+    if ( mpRewindHistory->getCount() > 0 )
+    {
+        const SceneTransformHistory::Snapshot newest = mpRewindHistory->getNewest();
+        if ( time - newest.mTime > Tickable::smTickSec * 1.5f )
+            mpRewindHistory->push( time - Tickable::smTickSec, newest.mPosition, newest.mAngle );
+    }
+
+    mpRewindHistory->push( time, getPosition(), getAngle() );
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneObject::setRewindTransform( const b2Vec2& position, const F32 angle, const Vector2* pRenderOOBB )
+{
+    // Sanity!
+    AssertFatal( mpScene != NULL, "SceneObject::setRewindTransform() - Object is not in a scene." );
+
+    // Move the body.
+    mpBody->SetTransform( position, angle );
+    const b2Transform xform = getTransform();
+
+    // Set the render OOBB used by queries.
+    if ( pRenderOOBB != NULL )
+        dMemcpy( mRenderOOBB, pRenderOOBB, sizeof(mRenderOOBB) );
+    else
+        CoreMath::mCalculateOOBB( getLocalSizedOOBB(), xform, mRenderOOBB );
+
+    // Update the world proxy.
+    b2AABB aabb;
+    CoreMath::mCalculateAABB( getLocalSizedOOBB(), xform, &aabb );
+    mpScene->getWorldQuery()->update( this, aabb, b2Vec2( 0.0f, 0.0f ) );
+}
+
+//-----------------------------------------------------------------------------
+
 void SceneObject::integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats )
 {
     // Debug Profiling.
     PROFILE_SCOPE(SceneObject_IntegrateObject);
 
-    // Fetch position.
-    const b2Vec2 position = getPosition();
+    // Integrate spatials if they've not already been integrated this tick.
+    if ( !mSpatialIntegrated )
+        integrateSpatial();
+
+    // Reset spatial integration.
+    mSpatialIntegrated = false;
 
     // Has the angle or position changed?
-    if (    mPreTickAngle != getAngle() ||
-            mPreTickPosition.x != position.x ||
-            mPreTickPosition.y != position.y )
+    if ( mSpatialMoved )
     {
-        // Yes, so flag spatial dirty.
-        mSpatialDirty = true;
+        // Fetch the spatials.
+        const SceneTransformStore& transformStore = mpScene->getTransformStore();
 
-        // Calculate current AABB.
-        CoreMath::mCalculateAABB( getLocalSizedOOBB(), getTransform(), &mCurrentAABB );
-
-        // Calculate tick AABB.
+        // Yes, so calculate tick AABB.
         b2AABB tickAABB;
-        tickAABB.Combine( mPreTickAABB, mCurrentAABB );
+        tickAABB.Combine( transformStore.getPreTickAABB( mTransformHandle ), mCurrentAABB );
 
         // Calculate tick displacement.
-        b2Vec2 tickDisplacement = position - mPreTickPosition;
+        b2Vec2 tickDisplacement = getPosition() - transformStore.getPreTickPosition( mTransformHandle );
             
         // Update world proxy.
         mpScene->getWorldQuery()->update( this, tickAABB, tickDisplacement );
+
+        // Invalidate the layer render cache.
+        mpScene->invalidateLayerRenderCache( mSceneLayer );
     }
 
     // Update Lifetime.
@@ -626,18 +850,18 @@ void SceneObject::postIntegrate(const F32 totalTime, const F32 elapsedTime, Debu
     // Notify components.
     notifyComponentsUpdate();
 
+    // Fetch the scene callback queue.
+    SceneCallbackQueue& callbackQueue = getScene()->getCallbackQueue();
+
     // Script "onUpdate".
     if ( mUpdateCallback )
     {
-        PROFILE_SCOPE(SceneObject_onUpdateCallback);
-        Con::executef(this, 1, "onUpdate");
+        callbackQueue.queue( this, updateCallbackName );
     }
 
     // Are we using the sleeping callback?
     if ( mSleepingCallback )
     {
-        PROFILE_SCOPE(SceneObject_onWakeSleepCallback);
-
         // Yes, so fetch the current awake state.
         const bool currentAwakeState = getAwake();
 
@@ -647,11 +871,8 @@ void SceneObject::postIntegrate(const F32 totalTime, const F32 elapsedTime, Debu
             // Yes, so update last awake state.
             mLastAwakeState = currentAwakeState;
 
-            // Perform the appropriate callback.
-            if ( currentAwakeState )
-                Con::executef(this, 1, "onWake");
-            else
-                Con::executef(this, 1, "onSleep");
+            // Queue the appropriate callback.
+            callbackQueue.queue( this, currentAwakeState ? wakeCallbackName : sleepCallbackName );
         }
     }
 }
@@ -663,40 +884,11 @@ void SceneObject::interpolateObject( const F32 timeDelta )
     // Debug Profiling.
     PROFILE_SCOPE(SceneObject_InterpolateObject);
 
-    if ( mSpatialDirty )
+    // NOTE: The render position and angle have already been interpolated by the scene transform store.
+    if ( getSpatialDirty() )
     {
-        // Debug Profiling.
-        PROFILE_SCOPE(SceneObject_InterpolatePositionAngle);
-
-        if ( timeDelta < 1.0f )
-        {
-            // Calculate render position.
-            const b2Vec2 position = getPosition();
-            b2Vec2 positionDelta = position - mPreTickPosition;
-            positionDelta *= timeDelta;
-            mRenderPosition = position - positionDelta;
-
-            // Calculate render angle.
-            const F32 angle = getAngle();
-
-            F32 relativeAngle = angle - mPreTickAngle;
-            if ( relativeAngle > b2_pi )
-                relativeAngle -= b2_pi2;
-            else if ( relativeAngle < -b2_pi )
-                relativeAngle += b2_pi2;
-            mRenderAngle = angle - (relativeAngle * timeDelta);
-        }
-        else
-        {
-            mRenderPosition = mPreTickPosition;
-            mRenderAngle    = mPreTickAngle;
-        }
-     
-        // Calculate render transform.
-        b2Transform renderXF( mRenderPosition, b2Rot(mRenderAngle) );
-
         // Calculate render OOBB.
-        CoreMath::mCalculateOOBB( getLocalSizedOOBB(), renderXF, mRenderOOBB );
+        CoreMath::mCalculateOOBB( getLocalSizedOOBB(), getRenderTransform(), mRenderOOBB );
     }
 
     // Update Any Attached GUI.
@@ -763,8 +955,8 @@ void SceneObject::sceneRenderOverlay( const SceneRenderState* sceneRenderState )
         return;
 
     // Clear blending.
-    glDisable( GL_BLEND );
-    glDisable( GL_TEXTURE_2D );
+    dglDisable( GL_BLEND );
+    dglDisable( GL_TEXTURE_2D );
 
     // AABB debug draw.
     if ( debugMask & Scene::SCENE_DEBUG_AABB )
@@ -823,6 +1015,9 @@ void SceneObject::unpackUpdate(NetConnection * conn, BitStream *stream)
 
 void SceneObject::setEnabled( const bool enabled )
 {
+    // Fetch the current enabled state.
+    const bool wasEnabled = isEnabled();
+
     // Call parent.
     Parent::setEnabled( enabled );
 
@@ -830,6 +1025,31 @@ void SceneObject::setEnabled( const bool enabled )
     if ( mpScene )
     {
         mpBody->SetActive( enabled );
+
+        // Notify the scene if the enabled state changed.
+        if ( wasEnabled != isEnabled() )
+        {
+            mpScene->onSceneObjectEnabledChanged( this );
+            invalidateRenderCache();
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneObject::setVisible( const bool status )
+{
+    // Finish if no change.
+    if ( mVisible == status )
+        return;
+
+    mVisible = status;
+
+    // Notify the scene.
+    if ( mpScene )
+    {
+        mpScene->onSceneObjectVisibleChanged( this );
+        invalidateRenderCache();
     }
 }
 
@@ -889,9 +1109,19 @@ void SceneObject::setSceneLayer( const U32 sceneLayer )
         return;
     }
 
+    // Invalidate the render cache of the old layer.
+    invalidateRenderCache();
+
+    // Move to the layer in the scene index.
+    if ( mpScene != NULL )
+        mpScene->moveSceneObjectLayer( this, sceneLayer );
+
     // Set Layer.
     mSceneLayer = sceneLayer;
 
+    // Invalidate the render cache of the new layer.
+    invalidateRenderCache();
+
     // Set Layer Mask.
     mSceneLayerMask = BIT( mSceneLayer );
 }
@@ -1115,6 +1345,10 @@ void SceneObject::setSceneGroup( const U32 sceneGroup )
         return;
     }
 
+    // Move to the group in the scene index.
+    if ( mpScene != NULL )
+        mpScene->moveSceneObjectGroup( this, sceneGroup );
+
     // Set Group.
     mSceneGroup = sceneGroup;
 
@@ -1532,6 +1766,33 @@ void SceneObject::initializeContactGathering( void )
 
 //-----------------------------------------------------------------------------
 
+void SceneObject::refilterCollisionShapes( void )
+{
+    // Finish if not in a scene.
+    if ( !mpScene )
+        return;
+
+    // Re-filter all the fixtures so the contact filter sees the change.
+    for ( typeCollisionFixtureVector::iterator fixtureItr = mCollisionFixtures.begin(); fixtureItr != mCollisionFixtures.end(); ++fixtureItr )
+    {
+        (*fixtureItr)->Refilter();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+bool SceneObject::isContactRequired( const SceneObject* pCollideWith ) const
+{
+    // Gathered contacts need every contact.
+    if ( mGatherContacts )
+        return true;
+
+    // The contact is required if its callback is wanted for the scene group collided with.
+    return mCollisionCallback && (mCollisionCallbackMask & pCollideWith->mSceneGroupMask) != 0;
+}
+
+//-----------------------------------------------------------------------------
+
 void SceneObject::onBeginCollision( const TickContact& tickContact )
 {
     // Finish if we're not gathering contacts.
@@ -2599,9 +2860,9 @@ void SceneObject::setBlendOptions( void )
     if ( mBlendMode )
     {
         // Enable Blending.
-        glEnable( GL_BLEND );
+        dglEnable( GL_BLEND );
         // Set Blend Function.
-        glBlendFunc( mSrcBlendFactor, mDstBlendFactor );
+        dglBlendFunc( mSrcBlendFactor, mDstBlendFactor );
 
         // Set color.
         glColor4f(mBlendColor.red,mBlendColor.green,mBlendColor.blue,mBlendColor.alpha );
@@ -2609,7 +2870,7 @@ void SceneObject::setBlendOptions( void )
     else
     {
         // Disable Blending.
-        glDisable( GL_BLEND );
+        dglDisable( GL_BLEND );
         // Reset color.
         glColor4f(1,1,1,1);
     }
@@ -2618,13 +2879,13 @@ void SceneObject::setBlendOptions( void )
     if ( mAlphaTest >= 0.0f )
     {
         // Enable Test.
-        glEnable( GL_ALPHA_TEST );
-        glAlphaFunc( GL_GREATER, mAlphaTest );
+        dglEnable( GL_ALPHA_TEST );
+        dglAlphaFunc( GL_GREATER, mAlphaTest );
     }
     else
     {
         // Disable Test.
-        glDisable( GL_ALPHA_TEST );
+        dglDisable( GL_ALPHA_TEST );
     }
 }
 
@@ -2633,9 +2894,9 @@ void SceneObject::setBlendOptions( void )
 void SceneObject::resetBlendOptions( void )
 {
     // Disable Blending.
-    glDisable( GL_BLEND );
+    dglDisable( GL_BLEND );
 
-    glDisable( GL_ALPHA_TEST);
+    dglDisable( GL_ALPHA_TEST);
 
     // Reset color.
     glColor4f(1,1,1,1);
@@ -2831,6 +3092,7 @@ void SceneObject::copyTo( SimObject* obj )
     pSceneObject->setActive( getActive() );
     pSceneObject->setAwake( getAwake() );
     pSceneObject->setBullet( getBullet() );
+    pSceneObject->setBulletStaticOnly( getBulletStaticOnly() );
     pSceneObject->setSleepingAllowed( getSleepingAllowed() );
 
     /// Collision control.
@@ -2873,6 +3135,7 @@ void SceneObject::copyTo( SimObject* obj )
     // Script callbacks.
     pSceneObject->setUpdateCallback( getUpdateCallback() );   
     pSceneObject->setCollisionCallback( getCollisionCallback() );
+    pSceneObject->setCollisionCallbackMask( getCollisionCallbackMask() );
     pSceneObject->setSleepingCallback( getSleepingCallback() );
 
     /// Misc.
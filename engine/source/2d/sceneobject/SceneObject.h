@@ -55,6 +55,10 @@
 #include "2d/scene/PhysicsProxy.h"
 #endif
 
+#ifndef _SCENE_TRANSFORM_HISTORY_H_
+#include "2d/scene/SceneTransformHistory.h"
+#endif
+
 #ifndef _SCENE_RENDER_OBJECT_H_
 #include "2d/scene/SceneRenderObject.h"
 #endif
@@ -105,6 +109,8 @@ private:
 
 public:
     friend class Scene;
+    friend class SceneTransformStore;
+    friend class ScenePool;
     friend class SceneWindow;
     friend class ContactFilter;
     friend class WorldQuery;
@@ -131,26 +137,29 @@ protected:
     U32                     mSceneLayer;
     U32                     mSceneLayerMask;
     F32                     mSceneLayerDepth;
+    U32                     mSceneLayerIndex;
 
     /// Scene groups.
     U32                     mSceneGroup;
     U32                     mSceneGroupMask;
+    U32                     mSceneGroupIndex;
 
     /// Area.
     Vector2                 mSize;
     bool                    mAutoSizing;
-    b2AABB                  mPreTickAABB;
     b2AABB                  mCurrentAABB;
     Vector2                 mLocalSizeOOBB[4];
     Vector2                 mRenderOOBB[4];
     S32                     mWorldProxyId;
 
+    /// Transform history.
+    SceneTransformHistory*  mpRewindHistory;
+    SceneTransformHistory*  mpSnapshots;
+
     /// Position / Angle.
-    Vector2                 mPreTickPosition;
-    F32                     mPreTickAngle;
-    Vector2                 mRenderPosition;
-    F32                     mRenderAngle;
-    bool                    mSpatialDirty;
+    S32                     mTransformHandle;
+    bool                    mSpatialIntegrated;
+    bool                    mSpatialMoved;
 
     /// Body.
     b2Body*                 mpBody;
@@ -188,6 +197,7 @@ protected:
     /// Script callbacks.
     bool                    mUpdateCallback;
     bool                    mCollisionCallback;
+    U32                     mCollisionCallbackMask;
     bool                    mSleepingCallback;
     bool                    mLastAwakeState;
 
@@ -209,6 +219,13 @@ protected:
     /// Destroy notifications.
     typeDestroyNotificationVector mDestroyNotifyList;
 
+    /// Pooling.
+    SimObjectId             mPoolTemplateId;
+    bool                    mPoolIdle;
+
+    /// Scene ticking.
+    S32                     mSceneTickIndex;
+
     /// Miscellaneous.
     bool                    mBatchIsolated;
     U32                     mSerialiseKey;
@@ -230,10 +247,11 @@ protected:
 
     /// Ticking.
     void                    resetTickSpatials( const bool resize = false );
-    inline bool             getSpatialDirty( void ) const { return mSpatialDirty; }
+    inline bool             getSpatialDirty( void ) const { return mTransformHandle == -1 || mpScene->getTransformStore().getSpatialDirty( mTransformHandle ); }
 
     /// Contact processing.
     void                    initializeContactGathering( void );
+    void                    refilterCollisionShapes( void );
 
     /// Taml callbacks.
     virtual void            onTamlCustomWrite( TamlCustomNodes& customNodes );
@@ -247,6 +265,7 @@ public:
     virtual bool            onAdd();
     virtual void            onRemove();
     virtual void            onDestroyNotify( SceneObject* pSceneObject );
+    virtual void            onStaticModified( const char* slotName, const char* newValue = NULL );
     static void             initPersistFields();
 
     /// Integration.
@@ -256,6 +275,38 @@ public:
     virtual void            interpolateObject( const F32 timeDelta );
     inline bool             getIsEditorTickAllowed( void ) const { return mEditorTickAllowed; }
 
+    /// Spatial integration.
+    /// These only touch the objects own spatial state and can therefore be run on worker threads.
+    /// Types whose pre-integration depends on the spatial state being dirty beforehand must not pre-integrate in parallel.
+    void                    preIntegrateSpatial( void );
+    void                    integrateSpatial( void );
+    virtual bool            canPreIntegrateInParallel( void ) const { return true; }
+
+    /// Dormancy.
+    /// A dormant object has nothing to do during a tick and can be skipped when the scene culls dormant objects.
+    /// Types that perform their own tick work (animation etc) must extend this.
+    virtual bool            isTickDormant( void ) const;
+
+    /// Pending callbacks.
+    /// Objects registered with "Scene::addPendingCallbacks()" queue their callbacks here once the tick has integrated.
+    virtual void            queuePendingCallbacks( SceneCallbackQueue& callbackQueue ) {}
+
+    /// Snapshot playback.
+    /// An object with snapshots is moved to its snapshot transform at the scene time less the scene "SnapshotDelay" each tick.
+    /// The render interpolation then smooths its motion between ticks.  The object should not have a dynamic body.
+    void                    addSnapshot( const F32 time, const Vector2& position, const F32 angle );
+    void                    clearSnapshots( void );
+    inline bool             getHasSnapshots( void ) const { return mpSnapshots != NULL; }
+
+    /// Rewind history.
+    /// The scene records the transform of ticked objects when it keeps a rewind history.
+    void                    recordRewindHistory( const F32 time, const U32 capacity );
+    inline const SceneTransformHistory* getRewindHistory( void ) const { return mpRewindHistory; }
+
+    /// Move the body and world proxy without changing the tick or render spatials.
+    /// This is only for the scene to rewind objects temporarily for queries.
+    void                    setRewindTransform( const b2Vec2& position, const F32 angle, const Vector2* pRenderOOBB );
+
     /// Render batching.
     inline void             setBatchIsolated( const bool batchIsolated ) { mBatchIsolated = batchIsolated; }
     virtual bool            getBatchIsolated( void ) { return mBatchIsolated; }
@@ -266,6 +317,8 @@ public:
     
     /// Render Output.
     virtual bool            canPrepareRender( void ) const { return false; }
+    virtual bool            canCacheRender( void ) const { return true; }
+    void                    invalidateRenderCache( void );
     virtual void            scenePrepareRender( const SceneRenderState* pSceneRenderState, SceneRenderQueue* pSceneRenderQueue ) {}
     virtual void            sceneRender( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer ) {}
     virtual void            sceneRenderFallback( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer );
@@ -293,7 +346,7 @@ public:
     inline U32              getSceneLayerMask( void ) const             { return mSceneLayerMask; }
 
     /// Scene Layer depth.
-    inline void             setSceneLayerDepth( const F32 order )       { mSceneLayerDepth = order; };
+    inline void             setSceneLayerDepth( const F32 order )       { mSceneLayerDepth = order; invalidateRenderCache(); };
     inline F32              getSceneLayerDepth( void ) const            { return mSceneLayerDepth; }
     bool                    setSceneLayerDepthFront( void );
     bool                    setSceneLayerDepthBack( void );
@@ -319,8 +372,8 @@ public:
     /// Position / Angle.
     virtual void            setPosition( const Vector2& position );
     inline Vector2          getPosition(void) const                     { if ( mpScene ) return mpBody->GetPosition(); else return mBodyDefinition.position; }
-    inline Vector2          getRenderPosition(void) const               { return mRenderPosition; }
-    inline F32              getRenderAngle(void) const                  { return mRenderAngle; }
+    inline Vector2          getRenderPosition(void) const               { if ( mTransformHandle != -1 ) return mpScene->getTransformStore().getRenderPosition( mTransformHandle ); else return getPosition(); }
+    inline F32              getRenderAngle(void) const                  { if ( mTransformHandle != -1 ) return mpScene->getTransformStore().getRenderAngle( mTransformHandle ); else return getAngle(); }
     inline const b2Vec2*    getRenderOOBB(void) const                   { return mRenderOOBB; }
     inline const b2Vec2*    getLocalSizedOOBB( void ) const             { return mLocalSizeOOBB; }
     virtual void            setAngle( const F32 radians );
@@ -349,6 +402,8 @@ public:
     inline bool             getAwake(void) const                        { if ( mpScene ) return mpBody->IsAwake(); else return mBodyDefinition.awake; }
     inline void             setBullet( const bool bullet )              { if ( mpScene ) mpBody->SetBullet( bullet ); else mBodyDefinition.bullet = bullet; }
     inline bool             getBullet(void) const                       { if ( mpScene ) return mpBody->IsBullet(); else return mBodyDefinition.bullet; }
+    inline void             setBulletStaticOnly( const bool staticOnly ) { if ( mpScene ) mpBody->SetBulletStaticOnly( staticOnly ); else mBodyDefinition.bulletStaticOnly = staticOnly; }
+    inline bool             getBulletStaticOnly(void) const             { if ( mpScene ) return mpBody->IsBulletStaticOnly(); else return mBodyDefinition.bulletStaticOnly; }
     inline void             setSleepingAllowed( const bool allowed )    { if ( mpScene ) mpBody->SetSleepingAllowed( allowed ); else mBodyDefinition.allowSleep = allowed; }
     inline bool             getSleepingAllowed(void) const              { if ( mpScene ) return mpBody->IsSleepingAllowed(); else return mBodyDefinition.allowSleep; }
     inline F32              getMass( void ) const                       { if ( mpScene ) return mpBody->GetMass(); else return 0.0f; }
@@ -370,8 +425,9 @@ public:
     inline bool             getCollisionSuppress(void) const            { return mCollisionSuppress; }
     inline const Scene::typeContactVector* getCurrentContacts( void ) const    { return mpCurrentContacts; }
     inline U32              getCurrentContactCount( void ) const        { if ( mpCurrentContacts != NULL ) return mpCurrentContacts->size(); else return 0; }
-    virtual void            setGatherContacts( const bool gatherContacts ) { mGatherContacts = gatherContacts; initializeContactGathering(); }
+    virtual void            setGatherContacts( const bool gatherContacts ) { mGatherContacts = gatherContacts; initializeContactGathering(); refilterCollisionShapes(); }
     inline bool             getGatherContacts( void ) const             { return mGatherContacts; }
+    virtual bool            isContactRequired( const SceneObject* pCollideWith ) const;
     virtual void            onBeginCollision( const TickContact& tickContact );
     virtual void            onEndCollision( const TickContact& tickContact );
 
@@ -475,27 +531,27 @@ public:
     Vector2                 getEdgeCollisionShapeAdjacentEnd( const U32 shapeIndex ) const;
 
     /// Render visibility.
-    inline void             setVisible( const bool status )             { mVisible = status; }
+    void                    setVisible( const bool status );
     inline bool             getVisible(void) const                      { return mVisible; }
 
     /// Render blending.
-    inline void             setBlendMode( const bool blendMode )        { mBlendMode = blendMode; }
+    inline void             setBlendMode( const bool blendMode )        { mBlendMode = blendMode; invalidateRenderCache(); }
     inline bool             getBlendMode( void ) const                  { return mBlendMode; }
-    inline void             setSrcBlendFactor( const S32 blendFactor )  { mSrcBlendFactor = blendFactor; }
+    inline void             setSrcBlendFactor( const S32 blendFactor )  { mSrcBlendFactor = blendFactor; invalidateRenderCache(); }
     inline S32              getSrcBlendFactor( void ) const             { return mSrcBlendFactor; }
-    inline void             setDstBlendFactor( const S32 blendFactor )  { mDstBlendFactor = blendFactor; }
+    inline void             setDstBlendFactor( const S32 blendFactor )  { mDstBlendFactor = blendFactor; invalidateRenderCache(); }
     inline S32              getDstBlendFactor( void ) const             { return mDstBlendFactor; }
-    inline void             setBlendColor( const ColorF& blendColor )   { mBlendColor = blendColor; }
+    inline void             setBlendColor( const ColorF& blendColor )   { mBlendColor = blendColor; invalidateRenderCache(); }
     inline const ColorF&    getBlendColor( void ) const                 { return mBlendColor; }
-    inline void             setBlendAlpha( const F32 alpha )            { mBlendColor.alpha = alpha; }
+    inline void             setBlendAlpha( const F32 alpha )            { mBlendColor.alpha = alpha; invalidateRenderCache(); }
     inline F32              getBlendAlpha( void ) const                 { return mBlendColor.alpha; }
-    inline void             setAlphaTest( const F32 alpha )             { mAlphaTest = alpha; }
+    inline void             setAlphaTest( const F32 alpha )             { mAlphaTest = alpha; invalidateRenderCache(); }
     inline F32              getAlphaTest( void ) const                  { return mAlphaTest; }
     void                    setBlendOptions( void );
     static                  void resetBlendOptions( void );
 
     /// Render sorting.
-    inline void             setSortPoint( const Vector2& pt )           { mSortPoint = pt; }
+    inline void             setSortPoint( const Vector2& pt )           { mSortPoint = pt; invalidateRenderCache(); }
     inline const Vector2&   getSortPoint(void) const                    { return mSortPoint; }
     inline void             setRenderGroup( const char* pRenderGroup )  { mRenderGroup = StringTable->insert(pRenderGroup); }
     inline StringTableEntry getRenderGroup( void ) const                { return mRenderGroup; }
@@ -508,8 +564,10 @@ public:
     // Script callbacks.
     inline void             setUpdateCallback( bool status )            { mUpdateCallback = status; }
     inline bool             getUpdateCallback( void ) const             { return mUpdateCallback; }
-    inline void             setCollisionCallback( const bool status )   { mCollisionCallback = status; }
+    inline void             setCollisionCallback( const bool status )   { mCollisionCallback = status; refilterCollisionShapes(); }
     inline bool             getCollisionCallback(void) const            { return mCollisionCallback; }
+    inline void             setCollisionCallbackMask( const U32 callbackMask ) { mCollisionCallbackMask = callbackMask; refilterCollisionShapes(); }
+    inline U32              getCollisionCallbackMask(void) const        { return mCollisionCallbackMask; }
     inline void             setSleepingCallback( bool status )          { mSleepingCallback = status; }
     inline bool             getSleepingCallback( void ) const           { return mSleepingCallback; }
 
@@ -543,6 +601,10 @@ public:
     inline bool             isBeingDeleted( void ) const                { return mBeingSafeDeleted; }
     virtual void            safeDelete( void );
 
+    /// Pooling.
+    inline SimObjectId      getPoolTemplateId( void ) const             { return mPoolTemplateId; }
+    inline bool             getPoolIdle( void ) const                   { return mPoolIdle; }
+
     /// Destroy notifications.
     void                    addDestroyNotification( SceneObject* pSceneObject );
     void                    removeDestroyNotification( SceneObject* pSceneObject );
@@ -647,6 +709,9 @@ protected:
     static bool             setBullet(void* obj, const char* data)          { static_cast<SceneObject*>(obj)->setBullet(dAtob(data)); return false; }
     static const char*      getBullet(void* obj, const char* data)          { return Con::getBoolArg( static_cast<SceneObject*>(obj)->getBullet() ); }
     static bool             writeBullet( void* obj, StringTableEntry pFieldName ) { return static_cast<SceneObject*>(obj)->getBullet() == true; }
+    static bool             setBulletStaticOnly(void* obj, const char* data) { static_cast<SceneObject*>(obj)->setBulletStaticOnly(dAtob(data)); return false; }
+    static const char*      getBulletStaticOnly(void* obj, const char* data) { return Con::getBoolArg( static_cast<SceneObject*>(obj)->getBulletStaticOnly() ); }
+    static bool             writeBulletStaticOnly( void* obj, StringTableEntry pFieldName ) { return static_cast<SceneObject*>(obj)->getBulletStaticOnly() == true; }
     static bool             setSleepingAllowed(void* obj, const char* data) { static_cast<SceneObject*>(obj)->setSleepingAllowed(dAtob(data)); return false; }
     static const char*      getSleepingAllowed(void* obj, const char* data) { return Con::getBoolArg( static_cast<SceneObject*>(obj)->getSleepingAllowed() ); }
     static bool             writeSleepingAllowed( void* obj, StringTableEntry pFieldName ) { return static_cast<SceneObject*>(obj)->getSleepingAllowed() == false; }
@@ -688,6 +753,7 @@ protected:
     static bool             writeGravityScale( void* obj, StringTableEntry pFieldName ) { return mNotEqual(static_cast<SceneObject*>(obj)->getGravityScale(), 1.0f); }
 
     /// Render visibility.
+    static bool             setVisible(void* obj, const char* data)         { static_cast<SceneObject*>(obj)->setVisible(dAtob(data)); return false; }
     static bool             writeVisible( void* obj, StringTableEntry pFieldName ) { return static_cast<SceneObject*>(obj)->getVisible() == false; }
 
     /// Render blending.
@@ -709,7 +775,11 @@ protected:
 
     /// Script callbacks.
     static bool             writeUpdateCallback( void* obj, StringTableEntry pFieldName ) { return static_cast<SceneObject*>(obj)->getUpdateCallback() == true; }
+    static bool             setCollisionCallback(void* obj, const char* data) { static_cast<SceneObject*>(obj)->setCollisionCallback(dAtob(data)); return false; }
     static bool             writeCollisionCallback( void* obj, StringTableEntry pFieldName ) { return static_cast<SceneObject*>(obj)->getCollisionCallback() == true; }
+    static bool             setCollisionCallbackGroups(void* obj, const char* data) { static_cast<SceneObject*>(obj)->setCollisionCallbackMask(Utility::mConvertStringToMask(data)); return false; }
+    static const char*      getCollisionCallbackGroups(void* obj, const char* data) { return Utility::mConvertMaskToString( static_cast<SceneObject*>(obj)->getCollisionCallbackMask() ); }
+    static bool             writeCollisionCallbackGroups( void* obj, StringTableEntry pFieldName ) { return static_cast<SceneObject*>(obj)->getCollisionCallbackMask() != MASK_ALL; }
     static bool             writeSleepingCallback( void* obj, StringTableEntry pFieldName ) { return static_cast<SceneObject*>(obj)->getSleepingCallback() == true; }
 
     /// Scene.
@@ -559,10 +559,10 @@ ConsoleMethodWithDocs(SceneObject, setPosition, ConsoleVoid, 3, 4, (float x, flo
     @param x The horizontal position of the object.
     @return No return value.
 */
-ConsoleMethodWithDocs(SceneObject, setPositionX, ConsoleVoid, 3, 3, (float x))
+ConsoleTypedMethodWithDocs(SceneObject, setPositionX, void, (SceneObject* object, F32 x), (float x))
 {
     // Set Position X-Component.
-    object->setPosition( b2Vec2( dAtof(argv[2]), object->getPosition().y ) );
+    object->setPosition( b2Vec2( x, object->getPosition().y ) );
 }
 
 //-----------------------------------------------------------------------------
@@ -571,10 +571,10 @@ ConsoleMethodWithDocs(SceneObject, setPositionX, ConsoleVoid, 3, 3, (float x))
     @param y The vertical position of the object.
     @return No return value.
 */
-ConsoleMethodWithDocs(SceneObject, setPositionY, ConsoleVoid, 3, 3, (float y))
+ConsoleTypedMethodWithDocs(SceneObject, setPositionY, void, (SceneObject* object, F32 y), (float y))
 {
     // Set Position Y-Component.
-    object->setPosition( b2Vec2( object->getPosition().x, dAtof(argv[2]) ) );
+    object->setPosition( b2Vec2( object->getPosition().x, y ) );
 }
 
 //-----------------------------------------------------------------------------
@@ -582,7 +582,7 @@ ConsoleMethodWithDocs(SceneObject, setPositionY, ConsoleVoid, 3, 3, (float y))
 /*! Gets the object's position.
     @return (float x/float y) The x and y (horizontal and vertical) position of the object.
 */
-ConsoleMethodWithDocs(SceneObject, getPosition, ConsoleString, 2, 2, ())
+ConsoleTypedMethodWithDocs(SceneObject, getPosition, const char*, (SceneObject* object), ())
 {
     // Get position.
     return object->getPosition().scriptThis();
@@ -593,7 +593,7 @@ ConsoleMethodWithDocs(SceneObject, getPosition, ConsoleString, 2, 2, ())
 /*! Gets the current render position.
     @return (float x/float y) The x and y (horizontal and vertical) render position of the object.
 */
-ConsoleMethodWithDocs(SceneObject, getRenderPosition, ConsoleString, 2, 2, ())
+ConsoleTypedMethodWithDocs(SceneObject, getRenderPosition, const char*, (SceneObject* object), ())
 {
    // Get render position.
     return object->getRenderPosition().scriptThis();
@@ -605,10 +605,10 @@ ConsoleMethodWithDocs(SceneObject, getRenderPosition, ConsoleString, 2, 2, ())
     @param angle The angle of the object.
     @return No return value.
 */
-ConsoleMethodWithDocs(SceneObject, setAngle, ConsoleVoid, 3, 3, (float angle))
+ConsoleTypedMethodWithDocs(SceneObject, setAngle, void, (SceneObject* object, F32 angle), (float angle))
 {
     // Set Rotation.
-    object->setAngle( mDegToRad( dAtof(argv[2]) ) );
+    object->setAngle( mDegToRad( angle ) );
 }   
 
 //-----------------------------------------------------------------------------
@@ -616,7 +616,7 @@ ConsoleMethodWithDocs(SceneObject, setAngle, ConsoleVoid, 3, 3, (float angle))
 /*! Gets the object's angle.
     @return (float angle) The object's current angle.
 */
-ConsoleMethodWithDocs(SceneObject, getAngle, ConsoleFloat, 2, 2, ())
+ConsoleTypedMethodWithDocs(SceneObject, getAngle, F32, (SceneObject* object), ())
 {
     // Return angle.
     return mRadToDeg( object->getAngle());
@@ -627,7 +627,7 @@ ConsoleMethodWithDocs(SceneObject, getAngle, ConsoleFloat, 2, 2, ())
 /*! Gets the object's render angle.
     @return (float rotation) The object's current render angle.
 */
-ConsoleMethodWithDocs(SceneObject, getRenderAngle, ConsoleFloat, 2, 2, ())
+ConsoleTypedMethodWithDocs(SceneObject, getRenderAngle, F32, (SceneObject* object), ())
 {
     // Return Rotation.
     return mRadToDeg( object->getRenderAngle() );
@@ -635,6 +635,56 @@ ConsoleMethodWithDocs(SceneObject, getRenderAngle, ConsoleFloat, 2, 2, ())
 
 //-----------------------------------------------------------------------------
 
+/*! Adds a snapshot of where the object should be at a scene time.
+    Once an object has snapshots, it is moved each tick to its interpolated snapshot transform at the scene time less the scene "SnapshotDelay".
+    This is typically used to smoothly play back objects whose transforms are received from a server.  Snapshots must be added in time order.
+    @param time The scene time of the snapshot.
+    @param x The position of the object along the horizontal axis.
+    @param y The position of the object along the vertical axis.
+    @param angle The angle of the object.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(SceneObject, addSnapshot, ConsoleVoid, 5, 6, (float time, float x, float y, float angle))
+{
+    // Time.
+    const F32 time = dAtof(argv[2]);
+
+    // Position.
+    Vector2 position;
+    S32 nextArg = 3;
+    const U32 elementCount = Utility::mGetStringElementCount(argv[3]);
+    if ( elementCount == 2 && argc == 5 )
+    {
+        position = Utility::mGetStringElementVector(argv[3]);
+        nextArg = 4;
+    }
+    else if ( elementCount == 1 && argc == 6 )
+    {
+        position.Set( dAtof(argv[3]), dAtof(argv[4]) );
+        nextArg = 5;
+    }
+    // Invalid
+    else
+    {
+        Con::warnf("SceneObject::addSnapshot() - Invalid number of parameters!");
+        return;
+    }
+
+    object->addSnapshot( time, position, mDegToRad( dAtof(argv[nextArg]) ) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Removes all the snapshots and stops playing them back.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(SceneObject, clearSnapshots, ConsoleVoid, 2, 2, ())
+{
+    object->clearSnapshots();
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Whether the object angle is fixed or not.
     @return No return Value.
 */
@@ -991,6 +1041,28 @@ ConsoleMethodWithDocs(SceneObject, getBullet, ConsoleBool, 2, 2, ())
 
 //-----------------------------------------------------------------------------
 
+/*! Sets whether continuous collision for the body is only computed against static bodies.
+    This is cheaper than a bullet and is useful for large numbers of fast debris that only needs to be kept out of static geometry.  It overrides the bullet setting.
+    @param status - Whether continuous collision is only computed against static bodies (defaults to true).
+    @return No return Value.
+*/
+ConsoleMethodWithDocs(SceneObject, setBulletStaticOnly, ConsoleVoid, 2, 3, ([bool status?]))
+{
+    object->setBulletStaticOnly( argc > 2 ? dAtob(argv[2]) : true );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether continuous collision for the body is only computed against static bodies.
+    @return (bool status) Whether continuous collision is only computed against static bodies.
+*/
+ConsoleMethodWithDocs(SceneObject, getBulletStaticOnly, ConsoleBool, 2, 2, ())
+{
+    return object->getBulletStaticOnly();
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Sets whether the body is allowed to sleep or not.
     @param status - Whether sleeping is allowed on the body or not (defaults to true).
     @return No return Value.
@@ -1601,10 +1673,10 @@ ConsoleMethodWithDocs(SceneObject, setLinearVelocity, ConsoleVoid, 3, 4, (float
     @param velocityX The x component of the velocity.
     @return No return Value.
 */
-ConsoleMethodWithDocs(SceneObject, setLinearVelocityX, ConsoleVoid, 3, 3, (float velocityX))
+ConsoleTypedMethodWithDocs(SceneObject, setLinearVelocityX, void, (SceneObject* object, F32 velocityX), (float velocityX))
 {
     // Set Linear Velocity X-Component.
-    object->setLinearVelocity( Vector2( dAtof(argv[2]), object->getLinearVelocity().y ) );
+    object->setLinearVelocity( Vector2( velocityX, object->getLinearVelocity().y ) );
 }
 
 //-----------------------------------------------------------------------------
@@ -1613,10 +1685,10 @@ ConsoleMethodWithDocs(SceneObject, setLinearVelocityX, ConsoleVoid, 3, 3, (float
     @param velocityY The y component of the velocity.
     @return No return Value.
 */
-ConsoleMethodWithDocs(SceneObject, setLinearVelocityY, ConsoleVoid, 3, 3, (float velocityY))
+ConsoleTypedMethodWithDocs(SceneObject, setLinearVelocityY, void, (SceneObject* object, F32 velocityY), (float velocityY))
 {
     // Set Linear Velocity Y-Component.
-    object->setLinearVelocity( Vector2( object->getLinearVelocity().x, dAtof(argv[2]) ) );
+    object->setLinearVelocity( Vector2( object->getLinearVelocity().x, velocityY ) );
 }
 
 //-----------------------------------------------------------------------------
@@ -1773,10 +1845,10 @@ ConsoleMethodWithDocs(SceneObject, getLinearVelocityFromLocalPoint, ConsoleStrin
     @param velocity The speed at which the object will rotate.
     @return No return Value.
 */
-ConsoleMethodWithDocs(SceneObject, setAngularVelocity, ConsoleVoid, 3, 3, (float velocity))
+ConsoleTypedMethodWithDocs(SceneObject, setAngularVelocity, void, (SceneObject* object, F32 velocity), (float velocity))
 {
     // Set Angular Velocity.
-    object->setAngularVelocity( mDegToRad( dAtof(argv[2]) ) );
+    object->setAngularVelocity( mDegToRad( velocity ) );
 }
 
 //-----------------------------------------------------------------------------
@@ -1784,7 +1856,7 @@ ConsoleMethodWithDocs(SceneObject, setAngularVelocity, ConsoleVoid, 3, 3, (float
 /*! Gets Object Angular Velocity.
     @return (float velocity) The speed at which the object is rotating.
 */
-ConsoleMethodWithDocs(SceneObject, getAngularVelocity, ConsoleFloat, 2, 2, ())
+ConsoleTypedMethodWithDocs(SceneObject, getAngularVelocity, F32, (SceneObject* object), ())
 {
     // Get Angular Velocity.
     return mRadToDeg( object->getAngularVelocity() );
@@ -3898,6 +3970,30 @@ ConsoleMethodWithDocs(SceneObject, getCollisionCallback, ConsoleBool, 2, 2, ())
 
 //-----------------------------------------------------------------------------
 
+/*! Sets the scene group(s) whose contacts with this object invoke the collision callbacks.
+    Contacts with any other scene group are discarded before they are queued unless contacts are being gathered.
+    @param groups A list of scene groups or "all" or "none" (default is all).
+    @return No return Value.
+*/
+ConsoleMethodWithDocs(SceneObject, setCollisionCallbackGroups, ConsoleVoid, 2, 3, ([groups?]))
+{
+    // Set collision callback groups.
+    object->setCollisionCallbackMask( argc > 2 ? Utility::mConvertStringToMask(argv[2]) : MASK_ALL );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the scene group(s) whose contacts with this object invoke the collision callbacks.
+    @return (collisionCallbackGroups) A list of scene groups.
+*/
+ConsoleMethodWithDocs(SceneObject, getCollisionCallbackGroups, ConsoleString, 2, 2, ())
+{
+    // Get collision callback groups.
+    return Utility::mConvertMaskToString( object->getCollisionCallbackMask() );
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Sets Debug option(s) on.
     @param debugOptions Either a list of debug modes (comma-separated), or a string with the modes (space-separated)
     @return No return value.
@@ -45,6 +45,10 @@
 
 //------------------------------------------------------------------------------
 
+#define SCROLLER_DEFAULT_TILE_CACHE_SIZE    8
+
+//------------------------------------------------------------------------------
+
 IMPLEMENT_CONOBJECT(Scroller);
 
 //------------------------------------------------------------------------------
@@ -55,7 +59,14 @@ Scroller::Scroller() :
     mScrollX(0.0f),
     mScrollY(0.0f),
     mTextureOffsetX(0.0f),
-    mTextureOffsetY(0.0f)
+    mTextureOffsetY(0.0f),
+    mTileImage(StringTable->EmptyString),
+    mTileCountX(0),
+    mTileCountY(0),
+    mTileCacheSize(SCROLLER_DEFAULT_TILE_CACHE_SIZE),
+    mTilePrefetchTime(1.0f),
+    mTileFrame(0),
+    mTilePrefetching(false)
 {
    // Use a static body by default.
    mBodyDefinition.type = b2_staticBody;
@@ -68,6 +79,8 @@ Scroller::Scroller() :
 
 Scroller::~Scroller()
 {
+    // Clear the tiles.
+    clearTiles();
 }
 
 //------------------------------------------------------------------------------
@@ -83,6 +96,11 @@ void Scroller::initPersistFields()
     addField("scrollY", TypeF32, Offset(mScrollY, Scroller), &writeScrollY, "");
     addField("scrollPositionX", TypeF32, Offset(mTextureOffsetX, Scroller), &writeScrollPositionX, "");
     addField("scrollPositionY", TypeF32, Offset(mTextureOffsetY, Scroller), &writeScrollPositionY, "");
+    addProtectedField("tileImage", TypeString, Offset(mTileImage, Scroller), &setTileImage, &defaultProtectedGetFn, &writeTileImage, "The base file-path of the tile images \"<tileImage>_<column>_<row>\" scrolled instead of the image.");
+    addProtectedField("tileCountX", TypeS32, Offset(mTileCountX, Scroller), &setTileCountX, &defaultProtectedGetFn, &writeTileCount, "The number of tile image columns.");
+    addProtectedField("tileCountY", TypeS32, Offset(mTileCountY, Scroller), &setTileCountY, &defaultProtectedGetFn, &writeTileCount, "The number of tile image rows.");
+    addProtectedField("tileCacheSize", TypeS32, Offset(mTileCacheSize, Scroller), &setTileCacheSize, &defaultProtectedGetFn, &writeTileCacheSize, "The number of tiles kept loaded (the visible tiles are always kept).");
+    addProtectedField("tilePrefetchTime", TypeF32, Offset(mTilePrefetchTime, Scroller), &setTilePrefetchTime, &defaultProtectedGetFn, &writeTilePrefetchTime, "How many seconds of scrolling ahead tiles are loaded.");
 }
 
 //------------------------------------------------------------------------------
@@ -97,6 +115,9 @@ void Scroller::copyTo(SimObject* object)
    scroller->setRepeat(getRepeatX(), getRepeatY());
    scroller->setScroll(getScrollX(), getScrollY());
    scroller->setScrollPosition(getScrollPositionX(), getScrollPositionY());
+   scroller->setTileImage(getTileImage(), getTileCountX(), getTileCountY());
+   scroller->setTileCacheSize(getTileCacheSize());
+   scroller->setTilePrefetchTime(getTilePrefetchTime());
 }
 
 //------------------------------------------------------------------------------
@@ -118,6 +139,9 @@ bool Scroller::onAdd()
 
 void Scroller::onRemove()
 {
+    // Clear the tiles.
+    clearTiles();
+
     // Call Parent.
     Parent::onRemove();
 }
@@ -228,6 +252,9 @@ void Scroller::resetTickScrollPositions( void )
     // Reset Scroll Positions.
     mRenderTickTextureOffset.Set( mTextureOffsetX, mTextureOffsetY );
     mPreTickTextureOffset = mPostTickTextureOffset = mRenderTickTextureOffset;
+
+    // Invalidate the layer render cache.
+    invalidateRenderCache();
 }
 
 //------------------------------------------------------------------------------
@@ -248,13 +275,28 @@ void Scroller::updateTickScrollPosition( void )
 
 void Scroller::sceneRender( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer )
 {
+    const bool tileMode = isTileMode();
+
     // Finish if we can't render.
-    if ( !ImageFrameProvider::validRender() )
+    if ( !tileMode && !ImageFrameProvider::validRender() )
         return;
 
     // Fetch texture and texture area.
-    const ImageAsset::FrameArea::TexelArea& frameTexelArea = getProviderImageFrameArea().mTexelArea;
-    TextureHandle& texture = getProviderTexture();
+    // In tile mode the area is the whole virtual texture which is split into tiles as it's submitted.
+    static TextureHandle noTexture;
+    TextureHandle& texture = tileMode ? noTexture : getProviderTexture();
+    Vector2 texLower( 0.0f, 0.0f );
+    Vector2 texUpper( 1.0f, 1.0f );
+    F32 texelWidth = 1.0f;
+    F32 texelHeight = 1.0f;
+    if ( !tileMode )
+    {
+        const ImageAsset::FrameArea::TexelArea& frameTexelArea = getProviderImageFrameArea().mTexelArea;
+        texLower = frameTexelArea.mTexelLower;
+        texUpper = frameTexelArea.mTexelUpper;
+        texelWidth = frameTexelArea.mTexelWidth;
+        texelHeight = frameTexelArea.mTexelHeight;
+    }
 
     // Calculate render offset.
     F32 renderOffsetX = mFmod( mRenderTickTextureOffset.x, 1.0f );
@@ -267,12 +309,8 @@ void Scroller::sceneRender( const SceneRenderState* pSceneRenderState, const Sce
     const bool isSplitRenderFrameY = mNotZero( renderOffsetY );
 
     // Clamp Texture Offsets.
-    const F32 textureOffsetX = frameTexelArea.mTexelWidth * renderOffsetX;
-    const F32 textureOffsetY = frameTexelArea.mTexelHeight * renderOffsetY;
-
-    // Fetch lower/upper texture coordinates.
-    const Vector2& texLower = frameTexelArea.mTexelLower;
-    const Vector2& texUpper = frameTexelArea.mTexelUpper;
+    const F32 textureOffsetX = texelWidth * renderOffsetX;
+    const F32 textureOffsetY = texelHeight * renderOffsetY;
 
     ScrollSplitRegion baseSplitRegion;
 
@@ -313,6 +351,15 @@ void Scroller::sceneRender( const SceneRenderState* pSceneRenderState, const Sce
     const S32 wholeRegionX = (S32)mCeil( mRepeatX );
     const S32 wholeRegionY = (S32)mCeil( mRepeatY );
 
+    if ( tileMode )
+    {
+        // Tiles are clipped as they are submitted so no clip-planes are needed.
+        beginTileFrame( pSceneRenderState );
+        renderRegions( pBatchRenderer, texture, baseSplitRegion, regionWidth, regionHeight, wholeRegionX, wholeRegionY, isSplitRenderFrameX, isSplitRenderFrameY );
+        evictTiles();
+        return;
+    }
+
     // Flush any existing batches.
     pBatchRenderer->flush();
 
@@ -338,16 +385,39 @@ void Scroller::sceneRender( const SceneRenderState* pSceneRenderState, const Sce
     if (maxClip > 3)
     glClipPlane(GL_CLIP_PLANE3, bottom);
 
-    glEnable(GL_CLIP_PLANE0);
+    dglEnable(GL_CLIP_PLANE0);
     if (maxClip > 1)
-    	glEnable(GL_CLIP_PLANE1);
+    	dglEnable(GL_CLIP_PLANE1);
     if (maxClip > 2)
-    	glEnable(GL_CLIP_PLANE2);
+    	dglEnable(GL_CLIP_PLANE2);
     if (maxClip > 3)
-    	glEnable(GL_CLIP_PLANE3);
+    	dglEnable(GL_CLIP_PLANE3);
 
 #endif
 
+    // Render the regions.
+    renderRegions( pBatchRenderer, texture, baseSplitRegion, regionWidth, regionHeight, wholeRegionX, wholeRegionY, isSplitRenderFrameX, isSplitRenderFrameY );
+
+    // Flush the scroller batches.
+    pBatchRenderer->flush();
+
+#ifndef TORQUE_OS_EMSCRIPTEN
+    // Disable the OOBB clip-planes.
+    dglDisable(GL_CLIP_PLANE0);
+    if (maxClip > 1)
+    	dglDisable(GL_CLIP_PLANE1);
+    if (maxClip > 2)
+    	dglDisable(GL_CLIP_PLANE2);
+    if (maxClip > 3)
+    	dglDisable(GL_CLIP_PLANE3);
+
+#endif
+}
+
+//------------------------------------------------------------------------------
+
+void Scroller::renderRegions( BatchRender* pBatchRenderer, TextureHandle& texture, const ScrollSplitRegion& baseSplitRegion, const F32 regionWidth, const F32 regionHeight, const S32 wholeRegionX, const S32 wholeRegionY, const bool isSplitRenderFrameX, const bool isSplitRenderFrameY )
+{
     // Render repeat Y.
     for ( S32 repeatIndexY = 0; repeatIndexY < wholeRegionY; ++repeatIndexY )
     {
@@ -386,79 +456,36 @@ void Scroller::sceneRender( const SceneRenderState* pSceneRenderState, const Sce
             splitRegion.addVertexOffset( regionWidth, 0.0f );
         }
     }
-
-    // Flush the scroller batches.
-    pBatchRenderer->flush();
-
-#ifndef TORQUE_OS_EMSCRIPTEN
-    // Disable the OOBB clip-planes.
-    glDisable(GL_CLIP_PLANE0);
-    if (maxClip > 1)
-    	glDisable(GL_CLIP_PLANE1);
-    if (maxClip > 2)
-    	glDisable(GL_CLIP_PLANE2);
-    if (maxClip > 3)
-    	glDisable(GL_CLIP_PLANE3);
-
-#endif
 }
 
 //------------------------------------------------------------------------------
 
 void Scroller::renderRegionSplitX( BatchRender* pBatchRenderer, TextureHandle& texture, const ScrollSplitRegion& splitRegion )
 {
-    // Submit batched quad.
-    pBatchRenderer->SubmitQuad(
-        Vector2( splitRegion.mVertSplitLowerX1, splitRegion.mVertSplitLowerY1 ),
-        Vector2( splitRegion.mVertSplitLowerX2, splitRegion.mVertSplitLowerY1 ),
-        Vector2( splitRegion.mVertSplitLowerX2, splitRegion.mVertSplitUpperY2 ),
-        Vector2( splitRegion.mVertSplitLowerX1, splitRegion.mVertSplitUpperY2 ),
-        Vector2( splitRegion.mTexSplitLowerX1, splitRegion.mTexSplitLowerY1 ),
-        Vector2( splitRegion.mTexSplitLowerX2, splitRegion.mTexSplitLowerY1 ),
-        Vector2( splitRegion.mTexSplitLowerX2, splitRegion.mTexSplitLowerY2 ),
-        Vector2( splitRegion.mTexSplitLowerX1, splitRegion.mTexSplitLowerY2 ),
-        texture );
-
-    // Submit batched quad.
-    pBatchRenderer->SubmitQuad(
-        Vector2( splitRegion.mVertSplitUpperX1, splitRegion.mVertSplitLowerY1 ),
-        Vector2( splitRegion.mVertSplitUpperX2, splitRegion.mVertSplitLowerY1 ),
-        Vector2( splitRegion.mVertSplitUpperX2, splitRegion.mVertSplitUpperY2 ),
-        Vector2( splitRegion.mVertSplitUpperX1, splitRegion.mVertSplitUpperY2 ),
-        Vector2( splitRegion.mTexSplitUpperX1, splitRegion.mTexSplitLowerY1 ),
-        Vector2( splitRegion.mTexSplitUpperX2, splitRegion.mTexSplitLowerY1 ),
-        Vector2( splitRegion.mTexSplitUpperX2, splitRegion.mTexSplitLowerY2 ),
-        Vector2( splitRegion.mTexSplitUpperX1, splitRegion.mTexSplitLowerY2 ),
-        texture );
+    // Submit region.
+    submitRegion( pBatchRenderer, texture,
+        splitRegion.mVertSplitLowerX1, splitRegion.mVertSplitLowerY1, splitRegion.mVertSplitLowerX2, splitRegion.mVertSplitUpperY2,
+        splitRegion.mTexSplitLowerX1, splitRegion.mTexSplitLowerY1, splitRegion.mTexSplitLowerX2, splitRegion.mTexSplitLowerY2 );
+
+    // Submit region.
+    submitRegion( pBatchRenderer, texture,
+        splitRegion.mVertSplitUpperX1, splitRegion.mVertSplitLowerY1, splitRegion.mVertSplitUpperX2, splitRegion.mVertSplitUpperY2,
+        splitRegion.mTexSplitUpperX1, splitRegion.mTexSplitLowerY1, splitRegion.mTexSplitUpperX2, splitRegion.mTexSplitLowerY2 );
 }
 
 //------------------------------------------------------------------------------
 
 void Scroller::renderRegionSplitY( BatchRender* pBatchRenderer, TextureHandle& texture, const ScrollSplitRegion& splitRegion )
 {
-    // Submit batched quad.
-    pBatchRenderer->SubmitQuad(
-        Vector2( splitRegion.mVertSplitLowerX1, splitRegion.mVertSplitLowerY1 ),
-        Vector2( splitRegion.mVertSplitUpperX2, splitRegion.mVertSplitLowerY1 ),
-        Vector2( splitRegion.mVertSplitUpperX2, splitRegion.mVertSplitLowerY2 ),
-        Vector2( splitRegion.mVertSplitLowerX1, splitRegion.mVertSplitLowerY2 ),
-        Vector2( splitRegion.mTexSplitLowerX1, splitRegion.mTexSplitLowerY1 ),
-        Vector2( splitRegion.mTexSplitLowerX2, splitRegion.mTexSplitLowerY1 ),
-        Vector2( splitRegion.mTexSplitLowerX2, splitRegion.mTexSplitLowerY2 ),
-        Vector2( splitRegion.mTexSplitLowerX1, splitRegion.mTexSplitLowerY2 ),
-        texture );
-
-    // Submit batched quad.
-    pBatchRenderer->SubmitQuad(
-        Vector2( splitRegion.mVertSplitLowerX1, splitRegion.mVertSplitUpperY1 ),
-        Vector2( splitRegion.mVertSplitUpperX2, splitRegion.mVertSplitUpperY1 ),
-        Vector2( splitRegion.mVertSplitUpperX2, splitRegion.mVertSplitUpperY2 ),
-        Vector2( splitRegion.mVertSplitLowerX1, splitRegion.mVertSplitUpperY2 ),
-        Vector2( splitRegion.mTexSplitLowerX1, splitRegion.mTexSplitUpperY1 ),
-        Vector2( splitRegion.mTexSplitLowerX2, splitRegion.mTexSplitUpperY1 ),
-        Vector2( splitRegion.mTexSplitLowerX2, splitRegion.mTexSplitUpperY2 ),
-        Vector2( splitRegion.mTexSplitLowerX1, splitRegion.mTexSplitUpperY2 ),
-        texture );
+    // Submit region.
+    submitRegion( pBatchRenderer, texture,
+        splitRegion.mVertSplitLowerX1, splitRegion.mVertSplitLowerY1, splitRegion.mVertSplitUpperX2, splitRegion.mVertSplitLowerY2,
+        splitRegion.mTexSplitLowerX1, splitRegion.mTexSplitLowerY1, splitRegion.mTexSplitLowerX2, splitRegion.mTexSplitLowerY2 );
+
+    // Submit region.
+    submitRegion( pBatchRenderer, texture,
+        splitRegion.mVertSplitLowerX1, splitRegion.mVertSplitUpperY1, splitRegion.mVertSplitUpperX2, splitRegion.mVertSplitUpperY2,
+        splitRegion.mTexSplitLowerX1, splitRegion.mTexSplitUpperY1, splitRegion.mTexSplitLowerX2, splitRegion.mTexSplitUpperY2 );
 
 }
 
@@ -466,70 +493,35 @@ void Scroller::renderRegionSplitY( BatchRender* pBatchRenderer, TextureHandle& t
 
 void Scroller::renderRegionSplitXY( BatchRender* pBatchRenderer, TextureHandle& texture, const ScrollSplitRegion& splitRegion )
 {
-    // Submit batched quad.
-    pBatchRenderer->SubmitQuad(
-        Vector2( splitRegion.mVertSplitLowerX1, splitRegion.mVertSplitLowerY1 ),
-        Vector2( splitRegion.mVertSplitLowerX2, splitRegion.mVertSplitLowerY1 ),
-        Vector2( splitRegion.mVertSplitLowerX2, splitRegion.mVertSplitLowerY2 ),
-        Vector2( splitRegion.mVertSplitLowerX1, splitRegion.mVertSplitLowerY2 ),
-        Vector2( splitRegion.mTexSplitLowerX1, splitRegion.mTexSplitLowerY1 ),
-        Vector2( splitRegion.mTexSplitLowerX2, splitRegion.mTexSplitLowerY1 ),
-        Vector2( splitRegion.mTexSplitLowerX2, splitRegion.mTexSplitLowerY2 ),
-        Vector2( splitRegion.mTexSplitLowerX1, splitRegion.mTexSplitLowerY2 ),
-        texture );
-
-    // Submit batched quad.
-    pBatchRenderer->SubmitQuad(
-        Vector2( splitRegion.mVertSplitUpperX1, splitRegion.mVertSplitLowerY1 ),
-        Vector2( splitRegion.mVertSplitUpperX2, splitRegion.mVertSplitLowerY1 ),
-        Vector2( splitRegion.mVertSplitUpperX2, splitRegion.mVertSplitLowerY2 ),
-        Vector2( splitRegion.mVertSplitUpperX1, splitRegion.mVertSplitLowerY2 ),
-        Vector2( splitRegion.mTexSplitUpperX1, splitRegion.mTexSplitLowerY1 ),
-        Vector2( splitRegion.mTexSplitUpperX2, splitRegion.mTexSplitLowerY1 ),
-        Vector2( splitRegion.mTexSplitUpperX2, splitRegion.mTexSplitLowerY2 ),
-        Vector2( splitRegion.mTexSplitUpperX1, splitRegion.mTexSplitLowerY2 ),
-        texture );
-
-    // Submit batched quad.
-    pBatchRenderer->SubmitQuad(
-        Vector2( splitRegion.mVertSplitLowerX1, splitRegion.mVertSplitUpperY1 ),
-        Vector2( splitRegion.mVertSplitLowerX2, splitRegion.mVertSplitUpperY1 ),
-        Vector2( splitRegion.mVertSplitLowerX2, splitRegion.mVertSplitUpperY2 ),
-        Vector2( splitRegion.mVertSplitLowerX1, splitRegion.mVertSplitUpperY2 ),
-        Vector2( splitRegion.mTexSplitLowerX1, splitRegion.mTexSplitUpperY1 ),
-        Vector2( splitRegion.mTexSplitLowerX2, splitRegion.mTexSplitUpperY1 ),
-        Vector2( splitRegion.mTexSplitLowerX2, splitRegion.mTexSplitUpperY2 ),
-        Vector2( splitRegion.mTexSplitLowerX1, splitRegion.mTexSplitUpperY2 ),
-        texture );
-
-    // Submit batched quad.
-    pBatchRenderer->SubmitQuad(
-        Vector2( splitRegion.mVertSplitUpperX1, splitRegion.mVertSplitUpperY1 ),
-        Vector2( splitRegion.mVertSplitUpperX2, splitRegion.mVertSplitUpperY1 ),
-        Vector2( splitRegion.mVertSplitUpperX2, splitRegion.mVertSplitUpperY2 ),
-        Vector2( splitRegion.mVertSplitUpperX1, splitRegion.mVertSplitUpperY2 ),
-        Vector2( splitRegion.mTexSplitUpperX1, splitRegion.mTexSplitUpperY1 ),
-        Vector2( splitRegion.mTexSplitUpperX2, splitRegion.mTexSplitUpperY1 ),
-        Vector2( splitRegion.mTexSplitUpperX2, splitRegion.mTexSplitUpperY2 ),
-        Vector2( splitRegion.mTexSplitUpperX1, splitRegion.mTexSplitUpperY2 ),
-        texture );
+    // Submit region.
+    submitRegion( pBatchRenderer, texture,
+        splitRegion.mVertSplitLowerX1, splitRegion.mVertSplitLowerY1, splitRegion.mVertSplitLowerX2, splitRegion.mVertSplitLowerY2,
+        splitRegion.mTexSplitLowerX1, splitRegion.mTexSplitLowerY1, splitRegion.mTexSplitLowerX2, splitRegion.mTexSplitLowerY2 );
+
+    // Submit region.
+    submitRegion( pBatchRenderer, texture,
+        splitRegion.mVertSplitUpperX1, splitRegion.mVertSplitLowerY1, splitRegion.mVertSplitUpperX2, splitRegion.mVertSplitLowerY2,
+        splitRegion.mTexSplitUpperX1, splitRegion.mTexSplitLowerY1, splitRegion.mTexSplitUpperX2, splitRegion.mTexSplitLowerY2 );
+
+    // Submit region.
+    submitRegion( pBatchRenderer, texture,
+        splitRegion.mVertSplitLowerX1, splitRegion.mVertSplitUpperY1, splitRegion.mVertSplitLowerX2, splitRegion.mVertSplitUpperY2,
+        splitRegion.mTexSplitLowerX1, splitRegion.mTexSplitUpperY1, splitRegion.mTexSplitLowerX2, splitRegion.mTexSplitUpperY2 );
+
+    // Submit region.
+    submitRegion( pBatchRenderer, texture,
+        splitRegion.mVertSplitUpperX1, splitRegion.mVertSplitUpperY1, splitRegion.mVertSplitUpperX2, splitRegion.mVertSplitUpperY2,
+        splitRegion.mTexSplitUpperX1, splitRegion.mTexSplitUpperY1, splitRegion.mTexSplitUpperX2, splitRegion.mTexSplitUpperY2 );
 }
 
 //------------------------------------------------------------------------------
 
 void Scroller::renderRegionNoSplit( BatchRender* pBatchRenderer, TextureHandle& texture, const ScrollSplitRegion& splitRegion )
 {
-    // Submit batched quad.
-    pBatchRenderer->SubmitQuad(
-        Vector2( splitRegion.mVertSplitLowerX1, splitRegion.mVertSplitLowerY1 ),
-        Vector2( splitRegion.mVertSplitUpperX2, splitRegion.mVertSplitLowerY1 ),
-        Vector2( splitRegion.mVertSplitUpperX2, splitRegion.mVertSplitUpperY2 ),
-        Vector2( splitRegion.mVertSplitLowerX1, splitRegion.mVertSplitUpperY2 ),
-        Vector2( splitRegion.mTexSplitLowerX1, splitRegion.mTexSplitLowerY1 ),
-        Vector2( splitRegion.mTexSplitLowerX2, splitRegion.mTexSplitLowerY1 ),
-        Vector2( splitRegion.mTexSplitLowerX2, splitRegion.mTexSplitLowerY2 ),
-        Vector2( splitRegion.mTexSplitLowerX1, splitRegion.mTexSplitLowerY2 ),
-        texture );
+    // Submit region.
+    submitRegion( pBatchRenderer, texture,
+        splitRegion.mVertSplitLowerX1, splitRegion.mVertSplitLowerY1, splitRegion.mVertSplitUpperX2, splitRegion.mVertSplitUpperY2,
+        splitRegion.mTexSplitLowerX1, splitRegion.mTexSplitLowerY1, splitRegion.mTexSplitLowerX2, splitRegion.mTexSplitLowerY2 );
 }
 
 //------------------------------------------------------------------------------
@@ -546,6 +538,9 @@ void Scroller::setRepeat( const F32 repeatX, const F32 repeatY )
     // Set Repeat X/Y.
     mRepeatX = repeatX;
     mRepeatY = repeatY;
+
+    // Invalidate the layer render cache.
+    invalidateRenderCache();
 }
 
 //------------------------------------------------------------------------------
@@ -575,3 +570,272 @@ void Scroller::setScrollPosition( F32 scrollX, F32 scrollY )
     // Reset Tick Scroll Positions.
     resetTickScrollPositions();
 }
+
+//------------------------------------------------------------------------------
+
+void Scroller::submitRegion( BatchRender* pBatchRenderer, TextureHandle& texture, const F32 vertX1, const F32 vertY1, const F32 vertX2, const F32 vertY2, const F32 texX1, const F32 texY1, const F32 texX2, const F32 texY2 )
+{
+    // Submit the region as a single quad unless in tile mode.
+    if ( !isTileMode() )
+    {
+        // Submit batched quad.
+        pBatchRenderer->SubmitQuad(
+            Vector2( vertX1, vertY1 ),
+            Vector2( vertX2, vertY1 ),
+            Vector2( vertX2, vertY2 ),
+            Vector2( vertX1, vertY2 ),
+            Vector2( texX1, texY1 ),
+            Vector2( texX2, texY1 ),
+            Vector2( texX2, texY2 ),
+            Vector2( texX1, texY2 ),
+            texture );
+        return;
+    }
+
+    // Load the tiles coming into view.
+    if ( mTilePrefetching )
+        submitTileRegion( pBatchRenderer, mTilePrefetchClip, false, vertX1, vertY1, vertX2, vertY2, texX1, texY1, texX2, texY2 );
+
+    // Render the visible tiles.
+    submitTileRegion( pBatchRenderer, mTileRenderClip, true, vertX1, vertY1, vertX2, vertY2, texX1, texY1, texX2, texY2 );
+}
+
+//------------------------------------------------------------------------------
+
+void Scroller::submitTileRegion( BatchRender* pBatchRenderer, const b2AABB& clip, const bool render, F32 vertX1, F32 vertY1, F32 vertX2, F32 vertY2, F32 texX1, F32 texY1, F32 texX2, F32 texY2 )
+{
+    // Finish if the region is empty.
+    if ( vertX2 <= vertX1 || vertY2 <= vertY1 || texX1 == texX2 || texY1 == texY2 )
+        return;
+
+    // Clip the region, keeping its texture coordinates in step.
+    const F32 texPerVertX = (texX2 - texX1) / (vertX2 - vertX1);
+    const F32 texPerVertY = (texY2 - texY1) / (vertY2 - vertY1);
+    if ( vertX1 < clip.lowerBound.x ) { texX1 += (clip.lowerBound.x - vertX1) * texPerVertX; vertX1 = clip.lowerBound.x; }
+    if ( vertX2 > clip.upperBound.x ) { texX2 -= (vertX2 - clip.upperBound.x) * texPerVertX; vertX2 = clip.upperBound.x; }
+    if ( vertY1 < clip.lowerBound.y ) { texY1 += (clip.lowerBound.y - vertY1) * texPerVertY; vertY1 = clip.lowerBound.y; }
+    if ( vertY2 > clip.upperBound.y ) { texY2 -= (vertY2 - clip.upperBound.y) * texPerVertY; vertY2 = clip.upperBound.y; }
+
+    // Finish if nothing is left.
+    if ( vertX2 <= vertX1 || vertY2 <= vertY1 )
+        return;
+
+    // Calculate the tiles covered.
+    const F32 tileCountX = (F32)mTileCountX;
+    const F32 tileCountY = (F32)mTileCountY;
+    const S32 firstTileX = mClamp( (S32)mFloor( getMin( texX1, texX2 ) * tileCountX ), 0, mTileCountX-1 );
+    const S32 lastTileX = mClamp( (S32)mCeil( getMax( texX1, texX2 ) * tileCountX ) - 1, 0, mTileCountX-1 );
+    const S32 firstTileY = mClamp( (S32)mFloor( getMin( texY1, texY2 ) * tileCountY ), 0, mTileCountY-1 );
+    const S32 lastTileY = mClamp( (S32)mCeil( getMax( texY1, texY2 ) * tileCountY ) - 1, 0, mTileCountY-1 );
+
+    for ( S32 tileY = firstTileY; tileY <= lastTileY; ++tileY )
+    {
+        // Clip the texture coordinates to the tile row (this keeps their direction).
+        const F32 tileLowerY = tileY / tileCountY;
+        const F32 tileUpperY = (tileY+1) / tileCountY;
+        const F32 pieceTexY1 = mClampF( texY1, tileLowerY, tileUpperY );
+        const F32 pieceTexY2 = mClampF( texY2, tileLowerY, tileUpperY );
+        if ( pieceTexY1 == pieceTexY2 )
+            continue;
+
+        for ( S32 tileX = firstTileX; tileX <= lastTileX; ++tileX )
+        {
+            // Clip the texture coordinates to the tile column.
+            const F32 tileLowerX = tileX / tileCountX;
+            const F32 tileUpperX = (tileX+1) / tileCountX;
+            const F32 pieceTexX1 = mClampF( texX1, tileLowerX, tileUpperX );
+            const F32 pieceTexX2 = mClampF( texX2, tileLowerX, tileUpperX );
+            if ( pieceTexX1 == pieceTexX2 )
+                continue;
+
+            // Fetch the tile, loading it if needed.
+            ScrollTile* pTile = acquireTile( tileX, tileY );
+
+            // Skip if not rendering or the tile isn't available yet.
+            if ( !render || pTile->mTexture.IsNull() || pTile->mTexture.getPending() )
+                continue;
+
+            // Calculate the tile texture coordinates.
+            // NOTE: The tile texture may be larger than its bitmap.
+            TextureObject* pTextureObject = pTile->mTexture;
+            const F32 texelScaleX = tileCountX * (F32)pTextureObject->getBitmapWidth() / (F32)pTextureObject->getTextureWidth();
+            const F32 texelScaleY = tileCountY * (F32)pTextureObject->getBitmapHeight() / (F32)pTextureObject->getTextureHeight();
+            const F32 tileTexX1 = (pieceTexX1 - tileLowerX) * texelScaleX;
+            const F32 tileTexX2 = (pieceTexX2 - tileLowerX) * texelScaleX;
+            const F32 tileTexY1 = (pieceTexY1 - tileLowerY) * texelScaleY;
+            const F32 tileTexY2 = (pieceTexY2 - tileLowerY) * texelScaleY;
+
+            // Calculate the piece vertexes.
+            const F32 pieceVertX1 = vertX1 + (pieceTexX1 - texX1) / texPerVertX;
+            const F32 pieceVertX2 = vertX1 + (pieceTexX2 - texX1) / texPerVertX;
+            const F32 pieceVertY1 = vertY1 + (pieceTexY1 - texY1) / texPerVertY;
+            const F32 pieceVertY2 = vertY1 + (pieceTexY2 - texY1) / texPerVertY;
+
+            // Submit batched quad.
+            pBatchRenderer->SubmitQuad(
+                Vector2( pieceVertX1, pieceVertY1 ),
+                Vector2( pieceVertX2, pieceVertY1 ),
+                Vector2( pieceVertX2, pieceVertY2 ),
+                Vector2( pieceVertX1, pieceVertY2 ),
+                Vector2( tileTexX1, tileTexY1 ),
+                Vector2( tileTexX2, tileTexY1 ),
+                Vector2( tileTexX2, tileTexY2 ),
+                Vector2( tileTexX1, tileTexY2 ),
+                pTile->mTexture );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void Scroller::beginTileFrame( const SceneRenderState* pSceneRenderState )
+{
+    // Start a new tile frame.
+    mTileFrame++;
+
+    // Clip to the scroller.
+    mTileRenderClip.lowerBound.Set( mRenderOOBB[0].x, mRenderOOBB[0].y );
+    mTileRenderClip.upperBound.Set( mRenderOOBB[1].x, mRenderOOBB[3].y );
+
+    // Clip to the view as well unless it's rotated.
+    if ( mIsZero( pSceneRenderState->mRenderAngle ) )
+    {
+        const b2AABB& viewAABB = pSceneRenderState->mRenderAABB;
+        mTileRenderClip.lowerBound.Set( getMax( mTileRenderClip.lowerBound.x, viewAABB.lowerBound.x ), getMax( mTileRenderClip.lowerBound.y, viewAABB.lowerBound.y ) );
+        mTileRenderClip.upperBound.Set( getMin( mTileRenderClip.upperBound.x, viewAABB.upperBound.x ), getMin( mTileRenderClip.upperBound.y, viewAABB.upperBound.y ) );
+    }
+
+    // Prefetch as far as the scroll will move in the prefetch time.
+    const F32 prefetchX = mFabs( mScrollX ) * mTilePrefetchTime;
+    const F32 prefetchY = mFabs( mScrollY ) * mTilePrefetchTime;
+    mTilePrefetching = mNotZero( prefetchX ) || mNotZero( prefetchY );
+    mTilePrefetchClip.lowerBound.Set( mTileRenderClip.lowerBound.x - prefetchX, mTileRenderClip.lowerBound.y - prefetchY );
+    mTilePrefetchClip.upperBound.Set( mTileRenderClip.upperBound.x + prefetchX, mTileRenderClip.upperBound.y + prefetchY );
+}
+
+//------------------------------------------------------------------------------
+
+Scroller::ScrollTile* Scroller::acquireTile( const S32 tileX, const S32 tileY )
+{
+    // Use the tile if it's resident.
+    for ( S32 index = 0; index < mTiles.size(); ++index )
+    {
+        ScrollTile* pTile = mTiles[index];
+        if ( pTile->mTileX == tileX && pTile->mTileY == tileY )
+        {
+            pTile->mLastUsedFrame = mTileFrame;
+            return pTile;
+        }
+    }
+
+    // Format the tile texture key.
+    char tileImageBuffer[1024];
+    char tileKey[1024];
+    Con::expandPath( tileImageBuffer, sizeof(tileImageBuffer), mTileImage );
+    dSprintf( tileKey, sizeof(tileKey), "%s_%d_%d", tileImageBuffer, tileX, tileY );
+
+    // Create the tile, loading its texture in the background.
+    // NOTE: A tile that fails to load is kept so that it's not loaded again every frame.
+    ScrollTile* pTile = new ScrollTile();
+    pTile->mTileX = tileX;
+    pTile->mTileY = tileY;
+    pTile->mLastUsedFrame = mTileFrame;
+    if ( !pTile->mTexture.setAsync( tileKey, true ) )
+        Con::warnf( "Scroller::acquireTile() - Could not load tile '%s'.", tileKey );
+
+    mTiles.push_back( pTile );
+
+    return pTile;
+}
+
+//------------------------------------------------------------------------------
+
+void Scroller::evictTiles( void )
+{
+    while ( mTiles.size() > mTileCacheSize )
+    {
+        // Find the least recently used tile that wasn't used this frame.
+        S32 evictIndex = -1;
+        for ( S32 index = 0; index < mTiles.size(); ++index )
+        {
+            const U32 lastUsedFrame = mTiles[index]->mLastUsedFrame;
+            if ( lastUsedFrame != mTileFrame && ( evictIndex == -1 || lastUsedFrame < mTiles[evictIndex]->mLastUsedFrame ) )
+                evictIndex = index;
+        }
+
+        // Finish if every tile is in use.
+        if ( evictIndex == -1 )
+            return;
+
+        delete mTiles[evictIndex];
+        mTiles.erase_fast( evictIndex );
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void Scroller::clearTiles( void )
+{
+    for ( S32 index = 0; index < mTiles.size(); ++index )
+        delete mTiles[index];
+
+    mTiles.clear();
+}
+
+//------------------------------------------------------------------------------
+
+S32 Scroller::getPendingTileCount( void ) const
+{
+    S32 pendingCount = 0;
+    for ( S32 index = 0; index < mTiles.size(); ++index )
+    {
+        if ( mTiles[index]->mTexture.getPending() )
+            pendingCount++;
+    }
+
+    return pendingCount;
+}
+
+//------------------------------------------------------------------------------
+
+void Scroller::setTileImage( const char* pTileImage, const S32 tileCountX, const S32 tileCountY )
+{
+    // Warn.
+    if ( tileCountX < 0 || tileCountY < 0 )
+    {
+        Con::warnf("Scroller::setTileImage() - Tile counts cannot be negative!");
+        return;
+    }
+
+    // Fetch the tile image.
+    StringTableEntry tileImage = pTileImage == NULL ? StringTable->EmptyString : StringTable->insert( pTileImage );
+
+    // Finish if nothing has changed.
+    if ( tileImage == mTileImage && tileCountX == mTileCountX && tileCountY == mTileCountY )
+        return;
+
+    // Set the tiles.
+    mTileImage = tileImage;
+    mTileCountX = tileCountX;
+    mTileCountY = tileCountY;
+
+    // Release the old tiles.
+    clearTiles();
+
+    // Invalidate the layer render cache.
+    invalidateRenderCache();
+}
+
+//------------------------------------------------------------------------------
+
+void Scroller::setTileCacheSize( const S32 tileCacheSize )
+{
+    // Warn.
+    if ( tileCacheSize < 1 )
+    {
+        Con::warnf("Scroller::setTileCacheSize() - The tile cache size must be at least one!");
+        return;
+    }
+
+    mTileCacheSize = tileCacheSize;
+}
@@ -85,6 +85,29 @@ private:
         }
     };
 
+    /// Tile mode.
+    /// The scrolled image is a grid of tile images named "<tileImage>_<column>_<row>" (row zero at the top)
+    /// that together form one virtual texture.  Only the tiles inside the visible part of the scroller
+    /// (plus any prefetch) are loaded, in the background, and at most the tile cache size are kept.
+    struct ScrollTile
+    {
+        TextureHandle   mTexture;
+        S32             mTileX;
+        S32             mTileY;
+        U32             mLastUsedFrame;
+    };
+
+    StringTableEntry        mTileImage;
+    S32                     mTileCountX;
+    S32                     mTileCountY;
+    S32                     mTileCacheSize;
+    F32                     mTilePrefetchTime;
+    Vector<ScrollTile*>     mTiles;
+    U32                     mTileFrame;
+    b2AABB                  mTileRenderClip;
+    b2AABB                  mTilePrefetchClip;
+    bool                    mTilePrefetching;
+
 public:
     Scroller();
     virtual ~Scroller();
@@ -101,6 +124,19 @@ public:
     inline void setScrollPositionY( F32 scrollY ) { setScrollPosition(getScrollPositionX(), scrollY); };
     void setScrollPosition( F32 scrollX, F32 scrollY );
 
+    void setTileImage( const char* pTileImage, const S32 tileCountX, const S32 tileCountY );
+    inline StringTableEntry getTileImage( void ) const { return mTileImage; }
+    inline S32 getTileCountX( void ) const { return mTileCountX; }
+    inline S32 getTileCountY( void ) const { return mTileCountY; }
+    inline bool isTileMode( void ) const { return mTileImage != StringTable->EmptyString && mTileCountX > 0 && mTileCountY > 0; }
+    void setTileCacheSize( const S32 tileCacheSize );
+    inline S32 getTileCacheSize( void ) const { return mTileCacheSize; }
+    inline void setTilePrefetchTime( const F32 prefetchTime ) { mTilePrefetchTime = getMax( prefetchTime, 0.0f ); }
+    inline F32 getTilePrefetchTime( void ) const { return mTilePrefetchTime; }
+    inline S32 getResidentTileCount( void ) const { return mTiles.size(); }
+    S32 getPendingTileCount( void ) const;
+    void clearTiles( void );
+
     inline F32 getRepeatX() { return mRepeatX; };
     inline F32 getRepeatY() { return mRepeatY; };
     inline F32 getScrollX() { return mScrollX; };
@@ -116,6 +152,9 @@ public:
     virtual bool onAdd();
     virtual void onRemove();
     virtual void integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
+    virtual bool isTickDormant( void ) const { return Parent::isTickDormant() && mIsZero( mScrollX ) && mIsZero( mScrollY ); }
+    virtual bool validRender( void ) const { return isTileMode() || Parent::validRender(); }
+    virtual bool canCacheRender( void ) const { return Parent::canCacheRender() && !isTileMode() && mIsZero( mScrollX ) && mIsZero( mScrollY ); }
     virtual void sceneRender( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer );
 
     virtual void setAngle( const F32 radians ) { Parent::setAngle( 0.0f ); }; // Stop angle being changed.
@@ -127,10 +166,16 @@ public:
     DECLARE_CONOBJECT(Scroller);
 
 private:
+    void renderRegions( BatchRender* pBatchRenderer, TextureHandle& texture, const ScrollSplitRegion& baseSplitRegion, const F32 regionWidth, const F32 regionHeight, const S32 wholeRegionX, const S32 wholeRegionY, const bool isSplitRenderFrameX, const bool isSplitRenderFrameY );
     void renderRegionSplitX( BatchRender* pBatchRenderer, TextureHandle& texture, const ScrollSplitRegion& splitRegion );
     void renderRegionSplitY( BatchRender* pBatchRenderer, TextureHandle& texture, const ScrollSplitRegion& splitRegion );
     void renderRegionSplitXY( BatchRender* pBatchRenderer, TextureHandle& texture, const ScrollSplitRegion& splitRegion );
     void renderRegionNoSplit( BatchRender* pBatchRenderer, TextureHandle& texture, const ScrollSplitRegion& splitRegion );
+    void submitRegion( BatchRender* pBatchRenderer, TextureHandle& texture, const F32 vertX1, const F32 vertY1, const F32 vertX2, const F32 vertY2, const F32 texX1, const F32 texY1, const F32 texX2, const F32 texY2 );
+    void submitTileRegion( BatchRender* pBatchRenderer, const b2AABB& clip, const bool render, F32 vertX1, F32 vertY1, F32 vertX2, F32 vertY2, F32 texX1, F32 texY1, F32 texX2, F32 texY2 );
+    void beginTileFrame( const SceneRenderState* pSceneRenderState );
+    ScrollTile* acquireTile( const S32 tileX, const S32 tileY );
+    void evictTiles( void );
 
 protected:
     static bool setRepeatX(void* obj, const char* data)                { static_cast<Scroller*>(obj)->setRepeatX( dAtof(data) ); return false; }
@@ -141,6 +186,15 @@ protected:
     static bool writeScrollY( void* obj, StringTableEntry pFieldName ) { return mNotZero(static_cast<Scroller*>(obj)->mScrollY); }
     static bool writeScrollPositionX( void* obj, StringTableEntry pFieldName ) { return mNotZero(static_cast<Scroller*>(obj)->mTextureOffsetX); }
     static bool writeScrollPositionY( void* obj, StringTableEntry pFieldName ) { return mNotZero(static_cast<Scroller*>(obj)->mTextureOffsetY); }
+    static bool setTileImage(void* obj, const char* data)              { Scroller* pScroller = static_cast<Scroller*>(obj); pScroller->setTileImage( data, pScroller->mTileCountX, pScroller->mTileCountY ); return false; }
+    static bool writeTileImage( void* obj, StringTableEntry pFieldName ) { return static_cast<Scroller*>(obj)->mTileImage != StringTable->EmptyString; }
+    static bool setTileCountX(void* obj, const char* data)             { Scroller* pScroller = static_cast<Scroller*>(obj); pScroller->setTileImage( pScroller->mTileImage, dAtoi(data), pScroller->mTileCountY ); return false; }
+    static bool setTileCountY(void* obj, const char* data)             { Scroller* pScroller = static_cast<Scroller*>(obj); pScroller->setTileImage( pScroller->mTileImage, pScroller->mTileCountX, dAtoi(data) ); return false; }
+    static bool writeTileCount( void* obj, StringTableEntry pFieldName ) { return static_cast<Scroller*>(obj)->mTileImage != StringTable->EmptyString; }
+    static bool setTileCacheSize(void* obj, const char* data)          { static_cast<Scroller*>(obj)->setTileCacheSize( dAtoi(data) ); return false; }
+    static bool writeTileCacheSize( void* obj, StringTableEntry pFieldName ) { return static_cast<Scroller*>(obj)->mTileCacheSize != 8; }
+    static bool setTilePrefetchTime(void* obj, const char* data)       { static_cast<Scroller*>(obj)->setTilePrefetchTime( dAtof(data) ); return false; }
+    static bool writeTilePrefetchTime( void* obj, StringTableEntry pFieldName ) { return mNotEqual( static_cast<Scroller*>(obj)->mTilePrefetchTime, 1.0f ); }
 };
 
 #endif // _SCROLLER_H_
@@ -272,4 +272,106 @@ ConsoleMethodWithDocs(Scroller, setScrollPosition, ConsoleVoid, 3, 4, (positionX
    object->setScrollPosition(scrollX, scrollY);
 }
 
+//------------------------------------------------------------------------------
+
+/*! Scrolls a grid of tile images instead of the image so that backgrounds can be larger than a single texture.
+    The tiles are named "<tileImage>_<column>_<row>" with row zero at the top and together form one virtual texture.
+    Only the visible tiles (and those about to scroll into view) are loaded, in the background, and at most the tile cache size are kept loaded.
+    @param tileImage The base file-path of the tile images.  An empty file-path turns tile mode off.
+    @param tileCountX The number of tile columns.
+    @param tileCountY The number of tile rows.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scroller, setTileImage, ConsoleVoid, 3, 5, (tileImage, [tileCountX], [tileCountY]))
+{
+   const S32 tileCountX = argc > 3 ? dAtoi(argv[3]) : 1;
+   const S32 tileCountY = argc > 4 ? dAtoi(argv[4]) : 1;
+
+   object->setTileImage( argv[2], tileCountX, tileCountY );
+}
+
+//------------------------------------------------------------------------------
+
+/*! Gets the base file-path of the tile images.
+    @return The base file-path of the tile images or nothing if not in tile mode.
+*/
+ConsoleMethodWithDocs(Scroller, getTileImage, ConsoleString, 2, 2, ())
+{
+   return object->getTileImage();
+}
+
+//------------------------------------------------------------------------------
+
+/*! Gets the number of tile columns and rows.
+    @return (tileCountX tileCountY) The number of tile columns and rows.
+*/
+ConsoleMethodWithDocs(Scroller, getTileCount, ConsoleString, 2, 2, ())
+{
+   char* pBuffer = Con::getReturnBuffer(32);
+   dSprintf(pBuffer, 32, "%d %d", object->getTileCountX(), object->getTileCountY());
+   return pBuffer;
+}
+
+//------------------------------------------------------------------------------
+
+/*! Sets the number of tiles kept loaded.  The visible tiles are always kept loaded.
+    @param tileCacheSize The number of tiles kept loaded.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scroller, setTileCacheSize, ConsoleVoid, 3, 3, (tileCacheSize))
+{
+   object->setTileCacheSize( dAtoi(argv[2]) );
+}
+
+//------------------------------------------------------------------------------
+
+/*! Gets the number of tiles kept loaded.
+    @return The number of tiles kept loaded.
+*/
+ConsoleMethodWithDocs(Scroller, getTileCacheSize, ConsoleInt, 2, 2, ())
+{
+   return object->getTileCacheSize();
+}
+
+//------------------------------------------------------------------------------
+
+/*! Sets how many seconds of scrolling ahead tiles are loaded.
+    @param prefetchTime The time in seconds.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scroller, setTilePrefetchTime, ConsoleVoid, 3, 3, (prefetchTime))
+{
+   object->setTilePrefetchTime( dAtof(argv[2]) );
+}
+
+//------------------------------------------------------------------------------
+
+/*! Gets how many seconds of scrolling ahead tiles are loaded.
+    @return The time in seconds.
+*/
+ConsoleMethodWithDocs(Scroller, getTilePrefetchTime, ConsoleFloat, 2, 2, ())
+{
+   return object->getTilePrefetchTime();
+}
+
+//------------------------------------------------------------------------------
+
+/*! Gets the number of tiles loaded or loading.
+    @return The number of tiles loaded or loading.
+*/
+ConsoleMethodWithDocs(Scroller, getResidentTileCount, ConsoleInt, 2, 2, ())
+{
+   return object->getResidentTileCount();
+}
+
+//------------------------------------------------------------------------------
+
+/*! Gets the number of tiles still loading.
+    @return The number of tiles still loading.
+*/
+ConsoleMethodWithDocs(Scroller, getPendingTileCount, ConsoleInt, 2, 2, ())
+{
+   return object->getPendingTileCount();
+}
+
 ConsoleMethodGroupEndWithDocs(Scroller)
@@ -24,6 +24,7 @@
 #include "console/consoleTypes.h"
 #include "2d/core/Utility.h"
 #include "ShapeVector.h"
+#include "2d/scene/Scene.h"
 
 // Script bindings.
 #include "ShapeVector_ScriptBinding.h"
@@ -42,11 +43,14 @@ ShapeVector::ShapeVector() :
     mIsCircle(false),
     mCircleRadius(1.0f),
     mFlipX(false),
-    mFlipY(false)
+    mFlipY(false),
+    mTessellated(false)
 {
     // Set Vector Associations.
     VECTOR_SET_ASSOCIATION( mPolygonBasisList );
     VECTOR_SET_ASSOCIATION( mPolygonLocalList );
+    VECTOR_SET_ASSOCIATION( mFillVertices );
+    VECTOR_SET_ASSOCIATION( mLineVertices );
 
    // Use a static body by default.
    mBodyDefinition.type = b2_staticBody;
@@ -66,8 +70,8 @@ void ShapeVector::initPersistFields()
    addField("LineColor", TypeColorF, Offset(mLineColor, ShapeVector), &writeLineColor, "");
    addField("FillColor", TypeColorF, Offset(mFillColor, ShapeVector), &writeFillColor, "");
    addField("FillMode", TypeBool, Offset(mFillMode, ShapeVector), &writeFillMode, "");
-   addField("IsCircle", TypeBool, Offset(mIsCircle, ShapeVector), &writeIsCircle, "");
-   addField("CircleRadius", TypeF32, Offset(mCircleRadius, ShapeVector), &writeCircleRadius, "");
+   addProtectedField("IsCircle", TypeBool, Offset(mIsCircle, ShapeVector), &setIsCircle, &defaultProtectedGetFn, &writeIsCircle, "");
+   addProtectedField("CircleRadius", TypeF32, Offset(mCircleRadius, ShapeVector), &setCircleRadius, &defaultProtectedGetFn, &writeCircleRadius, "");
 
    Parent::initPersistFields();
 }
@@ -89,6 +93,7 @@ void ShapeVector::copyTo(SimObject* obj)
    object->mCircleRadius = mCircleRadius;
    object->mFlipX = mFlipX;
    object->mFlipY = mFlipY;
+   object->mTessellated = false;
 
    if (getPolyVertexCount() > 0)
        object->setPolyCustom(mPolygonBasisList.size(), getPoly());
@@ -125,182 +130,86 @@ void ShapeVector::sceneRender( const SceneRenderState* pSceneRenderState, const
     if ( vertexCount == 0  && !mIsCircle)
         return;
 
-    // Disable Texturing.
-    glDisable       ( GL_TEXTURE_2D );
+    // Tessellate if the shape has changed.
+    if ( !mTessellated )
+        tessellate();
 
-    // Save Model-view.
-    glMatrixMode(GL_MODELVIEW);
-    glPushMatrix();
+    // Fetch the scene vector batch unless batching is off in which case draw immediately.
+    Scene* pScene = getScene();
+    const bool batched = pScene != NULL && pBatchRenderer->getBatchEnabled();
+    DebugDraw immediateBatch;
+    DebugDraw& vectorBatch = batched ? pScene->mDebugDraw : immediateBatch;
+
+    // Set Blend Options.
+    vectorBatch.SetRenderState( getBlendMode(), getSrcBlendFactor(), getDstBlendFactor(), getAlphaTest() );
 
     // Fetch Position/Rotation.
-    const Vector2 position = getRenderPosition();
+    const b2Transform renderTransform = getRenderTransform();
 
-    // Set Blend Options.
-    setBlendOptions();
-    
-    if (mIsCircle)
-    {
-        glRotatef( mRadToDeg(getRenderAngle()), 0.0f, 0.0f, 1.0f );
-        renderCircleShape(position, mCircleRadius);
-    }
-    else
+    // Fill Mode?
+    if ( mFillMode )
     {
-        // Move into Vector-Space.
-        glTranslatef( position.x, position.y, 0.0f );
-        glRotatef( mRadToDeg(getRenderAngle()), 0.0f, 0.0f, 1.0f );
-        renderPolygonShape(vertexCount);
+        // Yes, so submit the fill.
+        vectorBatch.SubmitTriangles( mFillVertices.size(), mFillVertices.address(), renderTransform, mFillColor );
     }
 
-    // Restore color.
-    glColor4f( 1,1,1,1 );
+    // Submit the outline.
+    // NOTE: A filled circle always has an opaque outline.
+    const ColorF lineColor = mIsCircle && mFillMode ? ColorF( mLineColor.red, mLineColor.green, mLineColor.blue, 1.0f ) : mLineColor;
+    vectorBatch.SubmitLines( mLineVertices.size(), mLineVertices.address(), renderTransform, lineColor );
 
-    // Restore Matrix.
-    glPopMatrix();
+    // Draw now if not batched.
+    if ( !batched )
+        vectorBatch.Flush();
 }
 
-void ShapeVector::renderCircleShape(Vector2 position, F32 radius)
-{
-    if (mFillMode)
-    {
-        const float32 k_segments = 32.0f;
-        const float32 k_increment = 2.0f * b2_pi / k_segments;
-        float32 theta = 0.0f;
-
-        glEnable(GL_BLEND);
-        glBlendFunc (GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-        glColor4f(mFillColor.red, mFillColor.green, mFillColor.blue, mFillColor.alpha);
-
-        glBegin(GL_TRIANGLE_FAN);
-        for (int32 i = 0; i < k_segments; ++i)
-        {
-            Vector2 v = position + radius * Vector2(cosf(theta), sinf(theta));
-            glVertex2f(v.x, v.y);
-            theta += k_increment;
-        }
-        glEnd();
+//----------------------------------------------------------------------------
 
-        glDisable(GL_BLEND);
+void ShapeVector::tessellate( void )
+{
+    // Clear the tessellation.
+    mFillVertices.clear();
+    mLineVertices.clear();
 
-        theta = 0.0f;
-        glColor4f(mLineColor.red, mLineColor.green, mLineColor.blue, 1.0f);
-        glBegin(GL_LINE_LOOP);
-        for (int32 i = 0; i < k_segments; ++i)
+    // Fetch the outline.
+    Vector<b2Vec2> outline;
+    if ( mIsCircle )
+    {
+        const U32 segments = 32;
+        const F32 increment = M_2PI_F / segments;
+        outline.setSize( segments );
+        for ( U32 n = 0; n < segments; ++n )
         {
-            Vector2 v = position + radius * Vector2(cosf(theta), sinf(theta));
-            glVertex2f(v.x, v.y);
-            theta += k_increment;
+            outline[n].Set( mCircleRadius * mCos( n * increment ), mCircleRadius * mSin( n * increment ) );
         }
-        glEnd();
     }
     else
     {
-        const float32 k_segments = 36.0f;
-        const float32 k_increment = 2.0f * b2_pi / k_segments;
-        float32 theta = 0.0f;
-
-        glColor4f(mLineColor.red, mLineColor.green, mLineColor.blue, mLineColor.alpha);
-        
-        glBegin(GL_LINE_LOOP);
-        for (int32 i = 0; i < k_segments; ++i)
+        outline.setSize( mPolygonLocalList.size() );
+        for ( U32 n = 0; n < (U32)mPolygonLocalList.size(); ++n )
         {
-            Vector2 v = position + radius * Vector2(cosf(theta), sinf(theta));
-            glVertex2f(v.x, v.y);
-            theta += k_increment;
+            outline[n] = mPolygonLocalList[n];
         }
-        glEnd();
     }
-}
 
-void ShapeVector::renderPolygonShape(U32 vertexCount)
-{
-#if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_ANDROID) || defined(TORQUE_OS_EMSCRIPTEN)
-    // Fill Mode?
-    if ( mFillMode )
+    const U32 outlineCount = outline.size();
+
+    // Fill as a fan of triangles.
+    for ( U32 n = 2; n < outlineCount; ++n )
     {
-        // Yes, so set polygon mode to FILL.
-        //glPolygonMode( GL_FRONT_AND_BACK, GL_FILL );
-
-        // Set Fill color.
-        glColor4f( (GLfloat)mFillColor.red, (GLfloat)mFillColor.green, (GLfloat)mFillColor.blue, (GLfloat)mFillColor.alpha );
-
-        GLfloat vert1[] = {//get first vert and make triangles based off of this one
-            (GLfloat)(mPolygonLocalList[0].x),
-            (GLfloat)(mPolygonLocalList[0].y),
-        };
-        GLfloat prevVert[] = {
-            (GLfloat)(mPolygonLocalList[1].x),
-            (GLfloat)(mPolygonLocalList[1].y),
-        };
-        
-        
-        // Draw Object.
-            for ( U32 n = 2; n < vertexCount; n++ )
-            {
-                //glVertex2fv ( (GLfloat*)&(mPolygonLocalList[n]) );
-                GLfloat vertex[] = {
-                                    vert1[0], vert1[1],
-                                    (GLfloat)(mPolygonLocalList[n].x), (GLfloat)(mPolygonLocalList[n].y),
-                                    prevVert[0], prevVert[1],
-                };
-                
-                glVertexPointer(2, GL_FLOAT, 0, vertex );
-                glDrawArrays(GL_TRIANGLES, 0, 3 );
-                prevVert[0] = (GLfloat)(mPolygonLocalList[n].x);//save the current one's for nxt time
-                prevVert[1] = (GLfloat)(mPolygonLocalList[n].y);
-            }
-        //glDrawArrays(GL_TRIANGLES, 0, vertexCount);
-        //glEnd();
- 
+        mFillVertices.push_back( outline[0] );
+        mFillVertices.push_back( outline[n - 1] );
+        mFillVertices.push_back( outline[n] );
     }
 
-    // Set Line color.
-    glColor4f(mLineColor.red, mLineColor.green, mLineColor.blue, mLineColor.alpha );
-    
-        for ( U32 n = 1; n <= vertexCount; n++ )
-        {
-            GLfloat verts[] = {
-                (GLfloat)(mPolygonLocalList[n - 1].x),
-                (GLfloat)(mPolygonLocalList[n - 1].y),
-                (GLfloat)(mPolygonLocalList[n == vertexCount ? 0 : n].x),
-                (GLfloat)(mPolygonLocalList[n == vertexCount ? 0 : n].y),
-            };
-
-            glVertexPointer(2, GL_FLOAT, 0, verts );			
-            glDrawArrays(GL_LINE_LOOP, 0, 2);//draw last two
-        }
-
-#else
-    // Fill Mode?
-    if ( mFillMode )
+    // Outline as a loop of lines.
+    for ( U32 n = 0; n < outlineCount; ++n )
     {
-        // Yes, so set polygon mode to FILL.
-        glPolygonMode( GL_FRONT_AND_BACK, GL_FILL );
-
-        // Set Fill color.
-        glColor4fv( (GLfloat*)&mFillColor );
-
-        // Draw Object.
-        glBegin( GL_POLYGON );
-            for ( U32 n = 0; n < vertexCount; n++ )
-            {
-                glVertex2fv ( (GLfloat*)&(mPolygonLocalList[n]) );
-            }
-        glEnd();
+        mLineVertices.push_back( outline[n] );
+        mLineVertices.push_back( outline[n + 1 == outlineCount ? 0 : n + 1] );
     }
 
-    // Set Line color.
-    glColor4fv( (GLfloat*)&mLineColor );
-
-    // Draw Object.
-    glBegin(GL_LINES);
-        for ( U32 n = 1; n <= vertexCount; n++ )
-        {
-            glVertex2fv ( (GLfloat*)&(mPolygonLocalList[n - 1]) );
-            glVertex2fv ( (GLfloat*)&(mPolygonLocalList[n == vertexCount ? 0 : n]) );
-        }
-    glEnd();
-
-#endif
+    mTessellated = true;
 }
 
 //----------------------------------------------------------------------------
@@ -314,7 +223,7 @@ void ShapeVector::setSize( const Vector2& size )
     
     if (mIsCircle)
     {
-        mCircleRadius /= xDifference;
+        setCircleRadius( mCircleRadius / xDifference );
     }
     else
     {
@@ -557,6 +466,9 @@ void ShapeVector::generateLocalPoly( void )
     // Fetch Polygon Vertex Count.
     const U32 polyVertexCount = mPolygonBasisList.size();
 
+    // Retessellate.
+    mTessellated = false;
+
     // Process Collision Polygon (if we've got one).
     if ( polyVertexCount > 0 )
     {
@@ -45,6 +45,11 @@ protected:
     bool                    mFlipX;
     bool                    mFlipY;
 
+    /// Tessellation (cached until the shape changes).
+    Vector<b2Vec2>          mFillVertices;          ///< Local fill triangles.
+    Vector<b2Vec2>          mLineVertices;          ///< Local outline lines.
+    bool                    mTessellated;
+
 public:
     ShapeVector();
     ~ShapeVector();
@@ -68,9 +73,9 @@ public:
     inline void setFillAlpha( const F32 alpha ) { mFillColor.alpha = alpha; }
     inline void setFillMode( const bool fillMode ) { mFillMode = fillMode; }
     inline bool getFillMode( void ) const { return mFillMode; }
-    inline void setIsCircle( const bool isCircle ) { mIsCircle = isCircle; }
+    inline void setIsCircle( const bool isCircle ) { mIsCircle = isCircle; mTessellated = false; }
     inline bool getIsCircle( void ) const { return mIsCircle; }
-    inline void setCircleRadius( const F32 circleRadius ) { mCircleRadius = circleRadius; }
+    inline void setCircleRadius( const F32 circleRadius ) { mCircleRadius = circleRadius; mTessellated = false; }
     inline F32 getCircleRadius ( void ) const { return mCircleRadius; }
 
     Vector2 getBoxFromPoints( void );
@@ -78,8 +83,7 @@ public:
     /// Internal Crunchers.
     void generateLocalPoly( void );
 
-    void renderCircleShape(Vector2 position, F32 radius);
-    void renderPolygonShape(U32 vertexCount);
+    void tessellate( void );
 
     /// Render flipping.
     inline void setFlip( const bool flipX, const bool flipY )   { mFlipX = flipX; mFlipY = flipY; generateLocalPoly(); }
@@ -116,7 +120,9 @@ protected:
     static bool writeLineColor( void* obj, StringTableEntry pFieldName ) { return static_cast<ShapeVector*>(obj)->mLineColor != ColorF(1.0f,1.0f,1.0f,1.0f); }
     static bool writeFillColor( void* obj, StringTableEntry pFieldName ) { return static_cast<ShapeVector*>(obj)->mFillColor != ColorF(0.5f,0.5f,0.5f,1.0f); }
     static bool writeFillMode( void* obj, StringTableEntry pFieldName ) { return static_cast<ShapeVector*>(obj)->mFillMode == true; }
+    static bool setIsCircle( void* obj, const char* data ) { static_cast<ShapeVector*>(obj)->setIsCircle( dAtob(data) ); return false; }
     static bool writeIsCircle( void* obj, StringTableEntry pFieldName ) { return static_cast<ShapeVector*>(obj)->mIsCircle == true; }
+    static bool setCircleRadius( void* obj, const char* data ) { static_cast<ShapeVector*>(obj)->setCircleRadius( dAtof(data) ); return false; }
     static bool writeCircleRadius( void* obj, StringTableEntry pFieldName ) { return static_cast<ShapeVector*>(obj)->mCircleRadius != 1; }
 };
 
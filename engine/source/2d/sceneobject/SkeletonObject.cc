@@ -24,6 +24,10 @@
 #include "2d/sceneobject/SkeletonObject.h"
 #endif
 
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
 #include "spine/extension.h"
 
 // Script bindings.
@@ -46,6 +50,10 @@ IMPLEMENT_CONOBJECT(SkeletonObject);
 
 //------------------------------------------------------------------------------
 
+static StringTableEntry animationEventCallbackName = StringTable->insert( "onAnimationEvent" );
+
+//------------------------------------------------------------------------------
+
 SkeletonObject::SkeletonObject() :  mPreTickTime( 0.0f ),
                                     mPostTickTime( 0.0f ),
                                     mTimeScale(1),
@@ -57,7 +65,9 @@ SkeletonObject::SkeletonObject() :  mPreTickTime( 0.0f ),
                                     mAnimationFinished(true),
                                     mAnimationDuration(0.0),
                                     mFlipX(false),
-                                    mFlipY(false)
+                                    mFlipY(false),
+                                    mCurrentPose(0),
+                                    mPoseUpdatePending(false)
 {
     mCurrentAnimation = StringTable->insert("");
     mSkeletonScale.SetZero();
@@ -103,8 +113,9 @@ void SkeletonObject::preIntegrate( const F32 totalTime, const F32 elapsedTime, D
     mPreTickTime = mPostTickTime;
     mPostTickTime = totalTime;
     
-    // Update composition at pre-tick time.
-    updateComposition( mPreTickTime );
+    // Flag the pose to be updated to the post-tick time.
+    // NOTE:-   The scene updates the poses of all skeleton objects during the integrate phase.
+    mPoseUpdatePending = true;
     
     // Are the spatials dirty?
     if ( getSpatialDirty() )
@@ -141,13 +152,28 @@ void SkeletonObject::integrateObject( const F32 totalTime, const F32 elapsedTime
 
 //-----------------------------------------------------------------------------
 
+void SkeletonObject::postIntegrate( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats )
+{
+    // Call parent.
+    Parent::postIntegrate( totalTime, elapsedTime, pDebugStats );
+    
+    // Update the pose if the scene hasn't already.
+    if ( mPoseUpdatePending )
+        updatePose();
+    
+    // Update composition from the post-tick pose.
+    updateComposition();
+}
+
+//-----------------------------------------------------------------------------
+
 void SkeletonObject::interpolateObject( const F32 timeDelta )
 {
     // Call parent.
     Parent::interpolateObject( timeDelta );
     
-    // Update composition time (interpolated).
-    updateComposition( (timeDelta * mPreTickTime) + ((1.0f-timeDelta) * mPostTickTime) );
+    // Update composition (interpolated).
+    interpolateComposition( timeDelta );
     
     // Finish if the spatials are NOT dirty.
     if ( !getSpatialDirty() )
@@ -180,6 +206,85 @@ void SkeletonObject::copyTo(SimObject* object)
 
 //-----------------------------------------------------------------------------
 
+void SkeletonObject::OnRegisterScene( Scene* pScene )
+{
+    // Call parent.
+    Parent::OnRegisterScene( pScene );
+    
+    // Add to the scene skeleton objects.
+    pScene->addSkeletonObject( this );
+}
+
+//-----------------------------------------------------------------------------
+
+void SkeletonObject::OnUnregisterScene( Scene* pScene )
+{
+    // Remove from the scene skeleton objects.
+    pScene->removeSkeletonObject( this );
+    
+    // Call parent.
+    Parent::OnUnregisterScene( pScene );
+}
+
+//-----------------------------------------------------------------------------
+
+void SkeletonObject::updatePose( void )
+{
+    mPoseUpdatePending = false;
+    
+    // Finish if the skeleton hasn't been built.
+    if ( !mSkeleton || !mState )
+        return;
+    
+    // Advance the animation to the post-tick time.
+    float delta = (mPostTickTime - mLastFrameTime) * mTimeScale;
+    mLastFrameTime = mPostTickTime;
+    
+    spSkeleton_update(mSkeleton, delta);
+    
+    if (!mAnimationFinished)
+        spAnimationState_update(mState, delta);
+    
+    // The current pose becomes the previous pose.
+    mCurrentPose ^= 1;
+    SkeletonAsset::typeSkeletonPose& pose = mPoses[mCurrentPose];
+    
+    // Use a shared pose if possible.
+    const SkeletonAsset::typeSkeletonPose* pSharedPose = findSharedPose();
+    if (pSharedPose != NULL)
+    {
+        if (!mAnimationFinished)
+            advanceSharedTrack();
+        
+        pose = *pSharedPose;
+        return;
+    }
+    
+    // Evaluate the pose ourselves.
+    if (!mAnimationFinished)
+        spAnimationState_apply(mState, mSkeleton);
+    
+    mSkeleton->flipX = getFlipX();
+    mSkeleton->flipY = getFlipY();
+    
+    spSkeleton_updateWorldTransform(mSkeleton);
+    
+    SkeletonAsset::capturePose(mSkeleton, pose);
+}
+
+//-----------------------------------------------------------------------------
+
+void SkeletonObject::updatePoseRange( void* pContext, const U32 start, const U32 end )
+{
+    // Fetch the skeleton objects.
+    SkeletonObject** ppSkeletonObjects = static_cast<SkeletonObject**>( pContext );
+    
+    for ( U32 index = start; index < end; ++index )
+        ppSkeletonObjects[index]->updatePose();
+}
+
+//-----------------------------------------------------------------------------
+
 void SkeletonObject::scenePrepareRender( const SceneRenderState* pSceneRenderState, SceneRenderQueue* pSceneRenderQueue )
 {
     // Prepare render.
@@ -353,7 +458,11 @@ void SkeletonObject::generateComposition( void )
         mSkeleton = spSkeleton_create(mSkeletonAsset->mSkeletonData);
     
     if (!mState)
+    {
         mState = spAnimationState_create(mSkeletonAsset->mStateData);
+        mState->listener = animationStateListener;
+        mState->context = this;
+    }
     
     if (mCurrentAnimation != StringTable->EmptyString)
     {
@@ -380,76 +489,71 @@ void SkeletonObject::generateComposition( void )
 
 //-----------------------------------------------------------------------------
 
-void SkeletonObject::updateComposition( const F32 time )
+void SkeletonObject::updateComposition( void )
 {
-    // Update position/orientation/state of visualization
-    float delta = (time - mLastFrameTime) * mTimeScale;
-    mLastFrameTime = time;
-    
-    spSkeleton_update(mSkeleton, delta);
-    
-    if (!mAnimationFinished)
+    // Dispatch the animation events raised whilst updating the pose.
+    if ( mPendingEvents.size() > 0 )
     {
-        spAnimationState_update(mState, delta);
-        spAnimationState_apply(mState, mSkeleton);
+        SceneCallbackQueue& callbackQueue = getScene()->getCallbackQueue();
+        
+        for ( S32 i = 0; i < mPendingEvents.size(); ++i )
+        {
+            const spEvent* pEvent = mPendingEvents[i];
+            
+            char intBuffer[32];
+            char floatBuffer[32];
+            dSprintf( intBuffer, sizeof(intBuffer), "%d", pEvent->intValue );
+            dSprintf( floatBuffer, sizeof(floatBuffer), "%g", pEvent->floatValue );
+            
+            const char* pArguments[4] = { pEvent->data->name, intBuffer, floatBuffer, pEvent->stringValue ? pEvent->stringValue : "" };
+            callbackQueue.queue( this, animationEventCallbackName, false, 4, pArguments );
+        }
+        
+        mPendingEvents.clear();
     }
     
-    spSkeleton_updateWorldTransform(mSkeleton);
+    // Finish if the skeleton hasn't been built.
+    if ( !mSkeleton )
+        return;
+    
+    // Fetch the post-tick pose.
+    const SkeletonAsset::typeSkeletonPose& pose = mPoses[mCurrentPose];
     
     // Get the ImageAsset used by the sprites
     StringTableEntry assetId = (*mSkeletonAsset).mImageAsset.getAssetId();
     
     clearSprites();
+    mSkeletonSprites.clear();
     
-    Vector2 vertices[4];
+    mSkeleton->r = mBlendColor.red;
+    mSkeleton->g = mBlendColor.green;
+    mSkeleton->b = mBlendColor.blue;
+    mSkeleton->a = mBlendColor.alpha;
     
-    F32 vertexPositions[8];
-    for (int i = 0; i < mSkeleton->slotCount; ++i)
+    for (S32 i = 0; i < pose.size(); ++i)
     {
-        spSlot* slot = mSkeleton->slots[i];
-        spAttachment* attachment = slot->attachment;
-        
-        if (!attachment || attachment->type != ATTACHMENT_REGION)
-            continue;
-        
-        spRegionAttachment* regionAttachment = (spRegionAttachment*)attachment;
-        spRegionAttachment_computeWorldVertices(regionAttachment, slot->skeleton->x, slot->skeleton->y, slot->bone, vertexPositions);
+        const SkeletonAsset::SkeletonPoseRegion& region = pose[i];
         
         SpriteBatchItem* pSprite = SpriteBatch::createSprite();
+        mSkeletonSprites.push_back(pSprite);
 
         pSprite->setDepth(mSceneLayerDepth);
         
         pSprite->setSrcBlendFactor(mSrcBlendFactor);
         pSprite->setDstBlendFactor(mDstBlendFactor);
         
-        mSkeleton->r = mBlendColor.red;
-        mSkeleton->g = mBlendColor.green;
-        mSkeleton->b = mBlendColor.blue;
-        mSkeleton->a = mBlendColor.alpha;
-        
-        F32 alpha = mSkeleton->a * slot->a;
+        F32 alpha = mSkeleton->a * region.mColor.alpha;
         pSprite->setBlendColor(ColorF(
-            mSkeleton->r * slot->r * alpha,
-            mSkeleton->g * slot->g * alpha,
-            mSkeleton->b * slot->b * alpha,
+            mSkeleton->r * region.mColor.red * alpha,
+            mSkeleton->g * region.mColor.green * alpha,
+            mSkeleton->b * region.mColor.blue * alpha,
             alpha
         ));
         
-        mSkeleton->flipX = getFlipX();
-        mSkeleton->flipY = getFlipY();
-        
-        vertices[0].x = vertexPositions[VERTEX_X1];
-        vertices[0].y = vertexPositions[VERTEX_Y1];
-        vertices[1].x = vertexPositions[VERTEX_X4];
-        vertices[1].y = vertexPositions[VERTEX_Y4];
-        vertices[2].x = vertexPositions[VERTEX_X3];
-        vertices[2].y = vertexPositions[VERTEX_Y3];
-        vertices[3].x = vertexPositions[VERTEX_X2];
-        vertices[3].y = vertexPositions[VERTEX_Y2];
-        pSprite->setExplicitVertices(vertices);
+        pSprite->setExplicitVertices(region.mVertices);
         
         pSprite->setImage(assetId);
-        pSprite->setNamedImageFrame(attachment->name);
+        pSprite->setNamedImageFrame(region.mFrameName);
     }
     
     if (mLastFrameTime >= mTotalAnimationTime)
@@ -465,6 +569,125 @@ void SkeletonObject::updateComposition( const F32 time )
     }
 }
 
+//-----------------------------------------------------------------------------
+
+void SkeletonObject::interpolateComposition( const F32 timeDelta )
+{
+    // Fetch the poses.
+    const SkeletonAsset::typeSkeletonPose& previousPose = mPoses[mCurrentPose ^ 1];
+    const SkeletonAsset::typeSkeletonPose& currentPose = mPoses[mCurrentPose];
+    
+    // Finish if the sprites don't match the poses.
+    // NOTE:-   The current pose is used as-is if the attachments changed over the tick.
+    const S32 regionCount = currentPose.size();
+    if ( regionCount != mSkeletonSprites.size() || regionCount != previousPose.size() )
+        return;
+    
+    Vector2 vertices[4];
+    for (S32 i = 0; i < regionCount; ++i)
+    {
+        const SkeletonAsset::SkeletonPoseRegion& previousRegion = previousPose[i];
+        const SkeletonAsset::SkeletonPoseRegion& currentRegion = currentPose[i];
+        
+        if ( previousRegion.mFrameName != currentRegion.mFrameName )
+            continue;
+        
+        for (U32 n = 0; n < 4; ++n)
+            vertices[n] = (previousRegion.mVertices[n] * timeDelta) + (currentRegion.mVertices[n] * (1.0f-timeDelta));
+        
+        mSkeletonSprites[i]->setExplicitVertices(vertices);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+const SkeletonAsset::typeSkeletonPose* SkeletonObject::findSharedPose( void )
+{
+    // Finish if pose sharing is disabled.
+    if ( mSkeletonAsset->getPoseSampleRate() <= 0.0f )
+        return NULL;
+    
+    // Only a single track without any mixing can be shared.
+    if ( mState->trackCount != 1 )
+        return NULL;
+    
+    const spTrackEntry* pTrack = mState->tracks[0];
+    if ( pTrack == NULL || pTrack->previous != NULL )
+        return NULL;
+    
+    // Calculate the animation time as the animation state would apply it.
+    const F32 duration = pTrack->animation->duration;
+    F32 animationTime = pTrack->time;
+    if ( !pTrack->loop && animationTime > pTrack->endTime )
+        animationTime = pTrack->endTime;
+    if ( pTrack->loop && duration > 0.0f )
+        animationTime = mFmod( animationTime, duration );
+    
+    // Fetch the shared pose.
+    SkeletonAsset::SkeletonPoseKey key;
+    key.mpAnimation     = pTrack->animation;
+    key.mpSkin          = mSkeleton->skin;
+    key.mFlipX          = getFlipX();
+    key.mFlipY          = getFlipY();
+    key.mRootBoneScale  = mSkeletonScale;
+    key.mRootBoneOffset = mSkeletonOffset;
+    
+    return mSkeletonAsset->findPose( key, animationTime );
+}
+
+//-----------------------------------------------------------------------------
+
+void SkeletonObject::advanceSharedTrack( void )
+{
+    spTrackEntry* pTrack = mState->tracks[0];
+    
+    // Calculate the times as the animation state would apply them.
+    F32 time = pTrack->time;
+    if ( !pTrack->loop && time > pTrack->endTime )
+        time = pTrack->endTime;
+    
+    F32 lastTime = pTrack->lastTime;
+    const F32 duration = pTrack->animation->duration;
+    if ( pTrack->loop && duration > 0.0f )
+    {
+        time = mFmod( time, duration );
+        lastTime = mFmod( lastTime, duration );
+    }
+    
+    // Fire the animation events.
+    // NOTE:-   The shared pose doesn't apply the animation so only the event timelines are applied here.
+    spEvent* events[64];
+    int eventCount = 0;
+    for ( S32 i = 0; i < pTrack->animation->timelineCount; ++i )
+    {
+        spTimeline* pTimeline = pTrack->animation->timelines[i];
+        
+        if ( pTimeline->type == TIMELINE_EVENT )
+            spTimeline_apply( pTimeline, mSkeleton, lastTime, time, events, &eventCount, 1 );
+    }
+    
+    for ( S32 i = 0; i < eventCount; ++i )
+        animationStateListener( mState, 0, ANIMATION_EVENT, events[i], 0 );
+    
+    // Advance the track as the animation state would have when applied.
+    pTrack->lastTime = pTrack->time;
+}
+
+//-----------------------------------------------------------------------------
+
+void SkeletonObject::animationStateListener( spAnimationState* pState, int trackIndex, spEventType type, spEvent* pEvent, int loopCount )
+{
+    // Ignore anything other than animation events.
+    if ( type != ANIMATION_EVENT || pEvent == NULL )
+        return;
+    
+    // Queue the event.
+    // NOTE:-   This can be called on a worker thread so the callback is raised when the composition is next updated.
+    static_cast<SkeletonObject*>( pState->context )->mPendingEvents.push_back( pEvent );
+}
+
+//-----------------------------------------------------------------------------
+
 void SkeletonObject::onAnimationFinished()
 {
     // Do script callback.
@@ -68,7 +68,14 @@ private:
     bool                        mFlipX;
     bool                        mFlipY;
     
+    /// Poses at the pre-tick and post-tick times.
+    /// The rendered vertices are interpolated between these.
+    SkeletonAsset::typeSkeletonPose mPoses[2];
+    U32                         mCurrentPose;
+    bool                        mPoseUpdatePending;
     
+    /// Animation events raised whilst updating the pose.
+    Vector<spEvent*>            mPendingEvents;
     
 public:
     SkeletonObject();
@@ -78,13 +85,27 @@ public:
     
     virtual void preIntegrate( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
     virtual void integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
+    virtual void postIntegrate( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
     virtual void interpolateObject( const F32 timeDelta );
+    virtual bool canPreIntegrateInParallel( void ) const { return false; }
+    virtual bool isTickDormant( void ) const { return false; }
     
     virtual void copyTo( SimObject* object );
     
+    virtual void OnRegisterScene( Scene* pScene );
+    virtual void OnUnregisterScene( Scene* pScene );
+    
+    /// Pose updates.
+    /// The pose of each skeleton object is updated by the scene during the integrate phase.  This is safe to
+    /// do on a worker thread as it only touches the skeleton, its animation state and the shared poses.
+    inline bool isPoseUpdatePending( void ) const { return mPoseUpdatePending; }
+    void updatePose( void );
+    static void updatePoseRange( void* pContext, const U32 start, const U32 end );
+    
     virtual bool canPrepareRender( void ) const { return true; }
     virtual bool validRender( void ) const { return mSkeletonAsset.notNull(); }
     virtual bool shouldRender( void ) const { return true; }
+    virtual bool canCacheRender( void ) const { return false; }
     virtual void scenePrepareRender( const SceneRenderState* pSceneRenderState, SceneRenderQueue* pSceneRenderQueue );
     virtual void sceneRender( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer );
     
@@ -128,7 +149,11 @@ public:
     
 protected:
     void generateComposition( void );
-    void updateComposition( const F32 time );
+    void updateComposition( void );
+    void interpolateComposition( const F32 timeDelta );
+    const SkeletonAsset::typeSkeletonPose* findSharedPose( void );
+    void advanceSharedTrack( void );
+    static void animationStateListener( spAnimationState* pState, int trackIndex, spEventType type, spEvent* pEvent, int loopCount );
     
 protected:
     static bool setSkeletonAsset( void* obj, const char* data )                  { static_cast<SkeletonObject*>(obj)->setSkeletonAsset(data); return false; }
@@ -46,7 +46,7 @@ public:
     virtual void copyTo(SimObject* object);
 
     /// Render flipping.
-    void setFlip( const bool flipX, const bool flipY )  { mFlipX = flipX; mFlipY = flipY; }
+    void setFlip( const bool flipX, const bool flipY )  { mFlipX = flipX; mFlipY = flipY; invalidateRenderCache(); }
     void setFlipX( const bool flipX )                   { setFlip( flipX, mFlipY ); }
     void setFlipY( const bool flipY )                   { setFlip( mFlipX, flipY ); }
     inline bool getFlipX( void ) const                  { return mFlipX; }
@@ -35,18 +35,35 @@
 
 IMPLEMENT_CONOBJECT(Trigger);
 
+//------------------------------------------------------------------------------
+
+static StringTableEntry enterCallbackName   = StringTable->insert( "onEnter" );
+static StringTableEntry stayCallbackName    = StringTable->insert( "onStay" );
+static StringTableEntry leaveCallbackName   = StringTable->insert( "onLeave" );
+
+// Scratch buffer for batched collider lists.
+static Vector<char> sColliderListBuffer;
+
 //-----------------------------------------------------------------------------
 
 Trigger::Trigger()
 {
     // Setup some debug vector associations.
     VECTOR_SET_ASSOCIATION(mEnterColliders);
+    VECTOR_SET_ASSOCIATION(mStayColliders);
     VECTOR_SET_ASSOCIATION(mLeaveColliders);
 
     // Set default callbacks.
     mEnterCallback = true;
     mStayCallback = false;
     mLeaveCallback = true;
+    mStayCallbackInterval = 0.0f;
+    mBatchCallbacks = false;
+
+    // Reset pending callbacks.
+    mStayPending = false;
+    mCallbacksPending = false;
+    mNextStayTime = 0.0f;
 
     // Use a static body by default.
     mBodyDefinition.type = b2_staticBody;
@@ -76,87 +93,133 @@ void Trigger::initPersistFields()
    addProtectedField("EnterCallback", TypeBool, Offset(mEnterCallback, Trigger), &setEnterCallback, &defaultProtectedGetFn, &writeEnterCallback,"");
    addProtectedField("StayCallback", TypeBool, Offset(mStayCallback, Trigger), &setStayCallback, &defaultProtectedGetFn, &writeStayCallback, "");
    addProtectedField("LeaveCallback", TypeBool, Offset(mLeaveCallback, Trigger), &setLeaveCallback, &defaultProtectedGetFn, &writeLeaveCallback, "");
+   addProtectedField("StayCallbackInterval", TypeF32, Offset(mStayCallbackInterval, Trigger), &setStayCallbackInterval, &defaultProtectedGetFn, &writeStayCallbackInterval, "The minimum time in seconds between \"onStay\" callbacks (zero raises them every tick).");
+   addProtectedField("BatchCallbacks", TypeBool, Offset(mBatchCallbacks, Trigger), &setBatchCallbacks, &defaultProtectedGetFn, &writeBatchCallbacks, "Whether each callback is raised once per tick with a list of objects rather than once per object.");
 
    Parent::initPersistFields();
 }
 
 //-----------------------------------------------------------------------------
 
-void Trigger::preIntegrate(const F32 totalTime, const F32 elapsedTime, DebugStats *pDebugStats)
+void Trigger::integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats *pDebugStats )
 {
     // Call Parent.
-    Parent::preIntegrate(totalTime, elapsedTime, pDebugStats);
+    Parent::integrateObject(totalTime, elapsedTime, pDebugStats);
 
-    // Clear Collider Callback Lists.
-    mEnterColliders.clear();
-    mLeaveColliders.clear();
+    // Debug Profiling.
+    PROFILE_SCOPE(Trigger_IntegrateObject);
+
+    // Finish if the "onStay" callback is not due.
+    if ( !mStayCallback || mOverlaps.size() == 0 || totalTime < mNextStayTime )
+        return;
+
+    // Schedule the next "onStay" callback.
+    mNextStayTime = totalTime + mStayCallbackInterval;
+
+    // Flag the "onStay" callback as pending.
+    mStayPending = true;
+    addPendingCallbacks();
 }
 
 //-----------------------------------------------------------------------------
 
-void Trigger::integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats *pDebugStats )
+bool Trigger::isTickDormant( void ) const
 {
-    // Call Parent.
-    Parent::integrateObject(totalTime, elapsedTime, pDebugStats);
+    // Not dormant whilst "onStay" callbacks are required.
+    // NOTE: The enter and leave callbacks are raised by the contacts so need no ticking.
+    if ( mStayCallback && mOverlaps.size() > 0 )
+        return false;
 
-    // Debug Profiling.
-    PROFILE_SCOPE(Trigger_IntegrateObject);
+    return Parent::isTickDormant();
+}
 
-    // Perform "OnEnter" callback.
-    if ( mEnterCallback && mEnterColliders.size() > 0 )
-    {
-        // Debug Profiling.
-        PROFILE_SCOPE(Trigger_OnEnterCallback);
+//-----------------------------------------------------------------------------
 
-        for ( collideCallbackType::iterator contactItr = mEnterColliders.begin(); contactItr != mEnterColliders.end(); ++contactItr )
-        {
-            Con::executef(this, 2, "onEnter", (*contactItr)->getIdString());
-        }
-    }
+void Trigger::queuePendingCallbacks( SceneCallbackQueue& callbackQueue )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Trigger_QueuePendingCallbacks);
 
-    // Fetch current contacts.
-    const Scene::typeContactVector* pCurrentContacts = getCurrentContacts();
+    // Reset pending callbacks.
+    mCallbacksPending = false;
 
-    // Sanity!
-    AssertFatal( pCurrentContacts != NULL, "Trigger::integrateObject() - Contacts not initialized correctly." );
+    // Queue "onEnter" callbacks.
+    if ( mEnterColliders.size() > 0 )
+    {
+        queueColliderCallbacks( callbackQueue, enterCallbackName, mEnterColliders.address(), mEnterColliders.size() );
+        mEnterColliders.clear();
+    }
 
-    // Perform "OnStay" callback.
-    if ( mStayCallback && pCurrentContacts->size() > 0 )
+    // Queue "onStay" callbacks.
+    if ( mStayPending )
     {
-        // Debug Profiling.
-        PROFILE_SCOPE(Trigger_OnStayCallback);
+        mStayPending = false;
 
-        for ( Scene::typeContactVector::const_iterator contactItr = pCurrentContacts->begin(); contactItr != pCurrentContacts->end(); ++contactItr )
-        {
-            // Fetch colliding object.
-            SceneObject* pCollideWidth = contactItr->getCollideWith( this );
+        // Gather the overlapping objects.
+        for ( typeOverlapHash::iterator overlapItr = mOverlaps.begin(); overlapItr != mOverlaps.end(); ++overlapItr )
+            mStayColliders.push_back( overlapItr->key );
 
-            Con::executef(this, 2, "onStay", pCollideWidth->getIdString());
+        // Remove any objects that were deleted or removed from the scene without ending their contacts.
+        for ( S32 index = mStayColliders.size() - 1; index >= 0; --index )
+        {
+            SceneObject* pSceneObject = Sim::findObject<SceneObject>( mStayColliders[index] );
+            if ( pSceneObject == NULL || pSceneObject->getScene() != getScene() )
+            {
+                mOverlaps.erase( mStayColliders[index] );
+                mStayColliders.erase_fast( index );
+            }
         }
+
+        if ( mStayColliders.size() > 0 )
+            queueColliderCallbacks( callbackQueue, stayCallbackName, mStayColliders.address(), mStayColliders.size() );
+
+        mStayColliders.clear();
     }
 
-    // Perform "OnLeave" callback.
-    if ( mLeaveCallback && mLeaveColliders.size() > 0 )
+    // Queue "onLeave" callbacks.
+    if ( mLeaveColliders.size() > 0 )
     {
-        // Debug Profiling.
-        PROFILE_SCOPE(Trigger_OnLeaveCallback);
-
-        for ( collideCallbackType::iterator contactItr = mLeaveColliders.begin(); contactItr != mLeaveColliders.end(); ++contactItr )
-        {
-            Con::executef(this, 2, "onLeave", (*contactItr)->getIdString());
-        }
+        queueColliderCallbacks( callbackQueue, leaveCallbackName, mLeaveColliders.address(), mLeaveColliders.size() );
+        mLeaveColliders.clear();
     }
 }
 
 //-----------------------------------------------------------------------------
 
+void Trigger::OnUnregisterScene( Scene* pScene )
+{
+    // Call parent.
+    Parent::OnUnregisterScene( pScene );
+
+    // The contacts are destroyed along with the body so forget the overlaps.
+    resetOverlaps();
+}
+
+//-----------------------------------------------------------------------------
+
 void Trigger::onBeginCollision( const TickContact& tickContact )
 {
     // Call parent.
     Parent::onBeginCollision( tickContact );
 
+    // Count the contact.
+    const SimObjectId colliderId = tickContact.getCollideWith( this )->getId();
+    typeOverlapHash::iterator overlapItr = mOverlaps.find( colliderId );
+    if ( overlapItr != mOverlaps.end() )
+    {
+        overlapItr->value++;
+        return;
+    }
+
+    // The object has started overlapping.
+    mOverlaps.insert( colliderId, 1 );
+
     // Add to enter colliders.
-    mEnterColliders.push_back( tickContact.getCollideWith( this ) );
+    if ( mEnterCallback )
+    {
+        mEnterColliders.push_back( colliderId );
+        addPendingCallbacks();
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -166,8 +229,21 @@ void Trigger::onEndCollision( const TickContact& tickContact )
     // Call parent.
     Parent::onEndCollision( tickContact );
 
+    // Finish if the object is not overlapping or has other contacts.
+    const SimObjectId colliderId = tickContact.getCollideWith( this )->getId();
+    typeOverlapHash::iterator overlapItr = mOverlaps.find( colliderId );
+    if ( overlapItr == mOverlaps.end() || --overlapItr->value > 0 )
+        return;
+
+    // The object has stopped overlapping.
+    mOverlaps.erase( overlapItr );
+
     // Add to leave colliders.
-    mLeaveColliders.push_back( tickContact.getCollideWith( this ) );
+    if ( mLeaveCallback )
+    {
+        mLeaveColliders.push_back( colliderId );
+        addPendingCallbacks();
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -182,4 +258,65 @@ void Trigger::copyTo(SimObject* object)
    trigger->mEnterCallback = mEnterCallback;
    trigger->mStayCallback = mStayCallback;
    trigger->mLeaveCallback = mLeaveCallback;
+   trigger->mStayCallbackInterval = mStayCallbackInterval;
+   trigger->mBatchCallbacks = mBatchCallbacks;
+}
+
+//-----------------------------------------------------------------------------
+
+void Trigger::addPendingCallbacks( void )
+{
+    // Finish if already pending or not in a scene.
+    if ( mCallbacksPending || getScene() == NULL )
+        return;
+
+    // Have the scene queue the callbacks once the tick has integrated.
+    mCallbacksPending = true;
+    getScene()->addPendingCallbacks( this );
+}
+
+//-----------------------------------------------------------------------------
+
+void Trigger::queueColliderCallbacks( SceneCallbackQueue& callbackQueue, StringTableEntry callbackName, const SimObjectId* pColliders, const U32 colliderCount )
+{
+    char idBuffer[16];
+    const char* pArgument = idBuffer;
+
+    // Queue a callback per collider if not batching.
+    if ( !mBatchCallbacks )
+    {
+        for ( U32 index = 0; index < colliderCount; ++index )
+        {
+            dSprintf( idBuffer, sizeof(idBuffer), "%d", pColliders[index] );
+            callbackQueue.queue( this, callbackName, false, 1, &pArgument );
+        }
+        return;
+    }
+
+    // Build the collider list.
+    sColliderListBuffer.clear();
+    for ( U32 index = 0; index < colliderCount; ++index )
+    {
+        const U32 idLength = dSprintf( idBuffer, sizeof(idBuffer), index == 0 ? "%d" : " %d", pColliders[index] );
+        const U32 offset = sColliderListBuffer.size();
+        sColliderListBuffer.increment( idLength );
+        dMemcpy( sColliderListBuffer.address() + offset, idBuffer, idLength );
+    }
+    sColliderListBuffer.push_back( '\0' );
+
+    // Queue a single callback with the list.
+    pArgument = sColliderListBuffer.address();
+    callbackQueue.queue( this, callbackName, false, 1, &pArgument );
+}
+
+//-----------------------------------------------------------------------------
+
+void Trigger::resetOverlaps( void )
+{
+    mOverlaps.clear();
+    mEnterColliders.clear();
+    mLeaveColliders.clear();
+    mStayPending = false;
+    mCallbacksPending = false;
+    mNextStayTime = 0.0f;
 }
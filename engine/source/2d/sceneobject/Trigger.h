@@ -27,12 +27,19 @@
 #include "2d/sceneobject/SceneObject.h"
 #endif
 
-#ifndef _HASHTABLE_H
-#include "collection/hashTable.h"
+#ifndef _FLAT_HASH_MAP_H_
+#include "collection/flatHashMap.h"
 #endif
 
 ///-----------------------------------------------------------------------------
 /// Trigger 2D.
+///
+/// The objects overlapping the trigger are tracked natively from the sensor begin/end contacts so
+/// a trigger with nothing entering or leaving it does no per-tick work.  The "onEnter" and "onLeave"
+/// callbacks are queued when an object's first contact begins or its last contact ends.  The "onStay"
+/// callback is off by default and can be limited to one every "StayCallbackInterval" seconds.
+/// With "BatchCallbacks" set each callback is raised at most once per tick with a space-separated
+/// list of the object Ids rather than once per object.
 ///-----------------------------------------------------------------------------
 class Trigger : public SceneObject
 {
@@ -43,12 +50,25 @@ private:
     bool                    mEnterCallback;
     bool                    mStayCallback;
     bool                    mLeaveCallback;
-
-    /// Object Mapping Database.
-    typedef VectorPtr<SceneObject*> collideCallbackType;
-
-    collideCallbackType     mEnterColliders;
-    collideCallbackType     mLeaveColliders;
+    F32                     mStayCallbackInterval;
+    bool                    mBatchCallbacks;
+
+    /// Overlapping objects with their contact counts.
+    typedef FlatHashMap<SimObjectId, U32> typeOverlapHash;
+    typeOverlapHash         mOverlaps;
+
+    /// Pending callbacks.
+    typedef Vector<SimObjectId> typeColliderVector;
+    typeColliderVector      mEnterColliders;
+    typeColliderVector      mStayColliders;
+    typeColliderVector      mLeaveColliders;
+    bool                    mStayPending;
+    bool                    mCallbacksPending;
+    F32                     mNextStayTime;
+
+    void                    addPendingCallbacks( void );
+    void                    queueColliderCallbacks( SceneCallbackQueue& callbackQueue, StringTableEntry callbackName, const SimObjectId* pColliders, const U32 colliderCount );
+    void                    resetOverlaps( void );
 
 public:
     Trigger();
@@ -59,8 +79,12 @@ public:
     static void initPersistFields();
 
     /// Integration.
-    virtual void            preIntegrate( const F32 totalTime, const F32 elapsedTime, DebugStats *pDebugStats );
     virtual void            integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
+    virtual bool            isTickDormant( void ) const;
+    virtual void            queuePendingCallbacks( SceneCallbackQueue& callbackQueue );
+
+    /// Scene.
+    virtual void            OnUnregisterScene( Scene* pScene );
 
     /// Rendering.
     virtual bool            shouldRender( void ) const { return false; }
@@ -69,6 +93,8 @@ public:
     virtual void            onBeginCollision( const TickContact& tickContact );
     virtual void            onEndCollision( const TickContact& tickContact );
     virtual void            setGatherContacts( const bool gatherContacts ) { } // Suppress changing contact gathering.
+    virtual bool            isContactRequired( const SceneObject* pCollideWith ) const { return true; } // Enter and leave colliders need every contact.
+    inline U32              getOverlapCount( void ) const               { return mOverlaps.size(); }
 
     /// Cloning.
     virtual void            copyTo(SimObject* object);
@@ -80,6 +106,10 @@ public:
     inline bool             getEnterCallback()                          { return mEnterCallback; };
     inline bool             getStayCallback()                           { return mStayCallback; };
     inline bool             getLeaveCallback()                          { return mLeaveCallback; };
+    inline void             setStayCallbackInterval( const F32 interval ) { mStayCallbackInterval = getMax( interval, 0.0f ); mNextStayTime = 0.0f; }
+    inline F32              getStayCallbackInterval( void ) const       { return mStayCallbackInterval; }
+    inline void             setBatchCallbacks( const bool batch )       { mBatchCallbacks = batch; }
+    inline bool             getBatchCallbacks( void ) const             { return mBatchCallbacks; }
     
     /// Declare Console Object.
     DECLARE_CONOBJECT( Trigger );
@@ -92,6 +122,10 @@ protected:
     static bool             writeStayCallback( void* obj, StringTableEntry pFieldName ) { return  static_cast<Trigger*>(obj)->mStayCallback == true; }
     static bool             setLeaveCallback(void* obj, const char* data) { static_cast<Trigger*>(obj)->setLeaveCallback(dAtob(data)); return false; };
     static bool             writeLeaveCallback( void* obj, StringTableEntry pFieldName ) {return  static_cast<Trigger*>(obj)->mLeaveCallback == false; }
+    static bool             setStayCallbackInterval(void* obj, const char* data) { static_cast<Trigger*>(obj)->setStayCallbackInterval(dAtof(data)); return false; };
+    static bool             writeStayCallbackInterval( void* obj, StringTableEntry pFieldName ) { return static_cast<Trigger*>(obj)->mStayCallbackInterval > 0.0f; }
+    static bool             setBatchCallbacks(void* obj, const char* data) { static_cast<Trigger*>(obj)->setBatchCallbacks(dAtob(data)); return false; };
+    static bool             writeBatchCallbacks( void* obj, StringTableEntry pFieldName ) { return static_cast<Trigger*>(obj)->mBatchCallbacks == true; }
 };
 
 #endif // _TRIGGER_H_
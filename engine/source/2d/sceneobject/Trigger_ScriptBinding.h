@@ -102,4 +102,61 @@ ConsoleMethodWithDocs(Trigger, getLeaveCallback, ConsoleBool, 2, 2, ())
 
 //-----------------------------------------------------------------------------
 
+/*! Set the minimum time between onStay events.
+    @param interval The interval in seconds.  Zero raises onStay every tick (the default).
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Trigger, setStayCallbackInterval, ConsoleVoid, 3, 3, (interval))
+{
+   object->setStayCallbackInterval(dAtof(argv[2]));
+}
+
+//-----------------------------------------------------------------------------
+
+/*!
+    @return Returns the minimum time in seconds between onStay events.
+*/
+ConsoleMethodWithDocs(Trigger, getStayCallbackInterval, ConsoleFloat, 2, 2, ())
+{
+   return object->getStayCallbackInterval();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Set whether each event is raised once per tick with a space-separated list of objects rather than once per object.
+    @param setting Default is true.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Trigger, setBatchCallbacks, ConsoleVoid, 2, 3, ([setting]?))
+{
+   // If the value isn't specified, the default is true.
+   bool batch = true;
+   if (argc > 2)
+      batch = dAtob(argv[2]);
+
+   object->setBatchCallbacks(batch);
+}
+
+//-----------------------------------------------------------------------------
+
+/*!
+    @return Returns whether events are raised once per tick with a list of objects.
+*/
+ConsoleMethodWithDocs(Trigger, getBatchCallbacks, ConsoleBool, 2, 2, ())
+{
+   return object->getBatchCallbacks();
+}
+
+//-----------------------------------------------------------------------------
+
+/*!
+    @return Returns the number of objects currently overlapping the trigger.
+*/
+ConsoleMethodWithDocs(Trigger, getOverlapCount, ConsoleInt, 2, 2, ())
+{
+   return object->getOverlapCount();
+}
+
+//-----------------------------------------------------------------------------
+
 ConsoleMethodGroupEndWithDocs(Trigger)
@@ -83,7 +83,7 @@ void b2ChainShape::SetNextVertex(const b2Vec2& nextVertex)
 	m_hasNextVertex = true;
 }
 
-b2Shape* b2ChainShape::Clone(b2BlockAllocator* allocator) const
+b2Shape* b2ChainShape::Clone(b2Allocator* allocator) const
 {
 	void* mem = allocator->Allocate(sizeof(b2ChainShape));
 	b2ChainShape* clone = new (mem) b2ChainShape;
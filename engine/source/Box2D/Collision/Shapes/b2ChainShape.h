@@ -56,7 +56,7 @@ public:
 	void SetNextVertex(const b2Vec2& nextVertex);
 
 	/// Implement b2Shape. Vertices are cloned using b2Alloc.
-	b2Shape* Clone(b2BlockAllocator* allocator) const;
+	b2Shape* Clone(b2Allocator* allocator) const;
 
 	/// @see b2Shape::GetChildCount
 	int32 GetChildCount() const;
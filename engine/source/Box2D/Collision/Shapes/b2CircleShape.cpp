@@ -20,7 +20,7 @@
 #include <new>
 using namespace std;
 
-b2Shape* b2CircleShape::Clone(b2BlockAllocator* allocator) const
+b2Shape* b2CircleShape::Clone(b2Allocator* allocator) const
 {
 	void* mem = allocator->Allocate(sizeof(b2CircleShape));
 	b2CircleShape* clone = new (mem) b2CircleShape;
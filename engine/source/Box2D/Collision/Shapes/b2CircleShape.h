@@ -28,7 +28,7 @@ public:
 	b2CircleShape();
 
 	/// Implement b2Shape.
-	b2Shape* Clone(b2BlockAllocator* allocator) const;
+	b2Shape* Clone(b2Allocator* allocator) const;
 
 	/// @see b2Shape::GetChildCount
 	int32 GetChildCount() const;
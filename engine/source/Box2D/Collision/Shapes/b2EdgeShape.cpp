@@ -28,7 +28,7 @@ void b2EdgeShape::Set(const b2Vec2& v1, const b2Vec2& v2)
 	m_hasVertex3 = false;
 }
 
-b2Shape* b2EdgeShape::Clone(b2BlockAllocator* allocator) const
+b2Shape* b2EdgeShape::Clone(b2Allocator* allocator) const
 {
 	void* mem = allocator->Allocate(sizeof(b2EdgeShape));
 	b2EdgeShape* clone = new (mem) b2EdgeShape;
@@ -33,7 +33,7 @@ public:
 	void Set(const b2Vec2& v1, const b2Vec2& v2);
 
 	/// Implement b2Shape.
-	b2Shape* Clone(b2BlockAllocator* allocator) const;
+	b2Shape* Clone(b2Allocator* allocator) const;
 
 	/// @see b2Shape::GetChildCount
 	int32 GetChildCount() const;
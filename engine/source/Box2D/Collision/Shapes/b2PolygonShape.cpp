@@ -19,7 +19,7 @@
 #include <Box2D/Collision/Shapes/b2PolygonShape.h>
 #include <new>
 
-b2Shape* b2PolygonShape::Clone(b2BlockAllocator* allocator) const
+b2Shape* b2PolygonShape::Clone(b2Allocator* allocator) const
 {
 	void* mem = allocator->Allocate(sizeof(b2PolygonShape));
 	b2PolygonShape* clone = new (mem) b2PolygonShape;
@@ -19,7 +19,7 @@
 #ifndef B2_SHAPE_H
 #define B2_SHAPE_H
 
-#include <Box2D/Common/b2BlockAllocator.h>
+#include <Box2D/Common/b2Allocator.h>
 #include <Box2D/Common/b2Math.h>
 #include <Box2D/Collision/b2Collision.h>
 
@@ -55,7 +55,7 @@ public:
 	virtual ~b2Shape() {}
 
 	/// Clone the concrete shape using the provided allocator.
-	virtual b2Shape* Clone(b2BlockAllocator* allocator) const = 0;
+	virtual b2Shape* Clone(b2Allocator* allocator) const = 0;
 
 	/// Get the type of this shape. You can use this to down cast to the concrete shape.
 	/// @return the shape type.
@@ -31,6 +31,12 @@ b2BroadPhase::b2BroadPhase()
 	m_moveCapacity = 16;
 	m_moveCount = 0;
 	m_moveBuffer = (int32*)b2Alloc(m_moveCapacity * sizeof(int32));
+
+	m_spatialHash = false;
+
+	m_bulkMove = false;
+	m_refitRequired = false;
+	m_rebuildAreaRatio = 0.0f;
 }
 
 b2BroadPhase::~b2BroadPhase()
@@ -39,9 +45,21 @@ b2BroadPhase::~b2BroadPhase()
 	b2Free(m_pairBuffer);
 }
 
+void b2BroadPhase::SetSpatialHash(float32 cellSize)
+{
+	b2Assert(m_proxyCount == 0);
+	b2Assert(cellSize >= 0.0f);
+
+	m_spatialHash = cellSize > 0.0f;
+	if (m_spatialHash)
+	{
+		m_hash.SetCellSize(cellSize);
+	}
+}
+
 int32 b2BroadPhase::CreateProxy(const b2AABB& aabb, void* userData)
 {
-	int32 proxyId = m_tree.CreateProxy(aabb, userData);
+	int32 proxyId = m_spatialHash ? m_hash.CreateProxy(aabb, userData) : m_tree.CreateProxy(aabb, userData);
 	++m_proxyCount;
 	BufferMove(proxyId);
 	return proxyId;
@@ -51,11 +69,37 @@ void b2BroadPhase::DestroyProxy(int32 proxyId)
 {
 	UnBufferMove(proxyId);
 	--m_proxyCount;
+	if (m_spatialHash)
+	{
+		m_hash.DestroyProxy(proxyId);
+		return;
+	}
 	m_tree.DestroyProxy(proxyId);
 }
 
 void b2BroadPhase::MoveProxy(int32 proxyId, const b2AABB& aabb, const b2Vec2& displacement)
 {
+	// The spatial hash is updated in place so bulk moves need no refit.
+	if (m_spatialHash)
+	{
+		if (m_hash.MoveProxy(proxyId, aabb, displacement))
+		{
+			BufferMove(proxyId);
+		}
+		return;
+	}
+
+	if (m_bulkMove)
+	{
+		bool buffer = m_tree.RefitProxy(proxyId, aabb, displacement);
+		if (buffer)
+		{
+			m_refitRequired = true;
+			BufferMove(proxyId);
+		}
+		return;
+	}
+
 	bool buffer = m_tree.MoveProxy(proxyId, aabb, displacement);
 	if (buffer)
 	{
@@ -63,6 +107,64 @@ void b2BroadPhase::MoveProxy(int32 proxyId, const b2AABB& aabb, const b2Vec2& di
 	}
 }
 
+void b2BroadPhase::SetFatAABB(int32 proxyId, const b2AABB& aabb)
+{
+	b2Assert(m_bulkMove == true);
+
+	if (m_spatialHash)
+	{
+		m_hash.SetFatAABB(proxyId, aabb);
+		return;
+	}
+
+	const b2AABB& fatAABB = m_tree.GetFatAABB(proxyId);
+	if (fatAABB.lowerBound.x == aabb.lowerBound.x && fatAABB.lowerBound.y == aabb.lowerBound.y &&
+		fatAABB.upperBound.x == aabb.upperBound.x && fatAABB.upperBound.y == aabb.upperBound.y)
+	{
+		return;
+	}
+
+	m_tree.SetFatAABB(proxyId, aabb);
+	m_refitRequired = true;
+}
+
+void b2BroadPhase::SetMoveBuffer(const int32* proxyIds, int32 count)
+{
+	m_moveCount = 0;
+	for (int32 i = 0; i < count; ++i)
+	{
+		BufferMove(proxyIds[i]);
+	}
+}
+
+void b2BroadPhase::BeginBulkMove()
+{
+	b2Assert(m_bulkMove == false);
+	m_bulkMove = true;
+}
+
+void b2BroadPhase::EndBulkMove()
+{
+	b2Assert(m_bulkMove == true);
+	m_bulkMove = false;
+
+	if (m_refitRequired == false)
+	{
+		return;
+	}
+
+	m_refitRequired = false;
+	m_tree.Refit();
+
+	// Rebuild once the refit tree has degraded too far.
+	float32 areaRatio = m_tree.GetAreaRatio();
+	if (m_rebuildAreaRatio == 0.0f || areaRatio > b2_treeRebuildRatio * m_rebuildAreaRatio)
+	{
+		m_tree.RebuildTopDown();
+		m_rebuildAreaRatio = m_tree.GetAreaRatio();
+	}
+}
+
 void b2BroadPhase::TouchProxy(int32 proxyId)
 {
 	BufferMove(proxyId);
@@ -22,6 +22,7 @@
 #include <Box2D/Common/b2Settings.h>
 #include <Box2D/Collision/b2Collision.h>
 #include <Box2D/Collision/b2DynamicTree.h>
+#include <Box2D/Collision/b2SpatialHash.h>
 #include <algorithm>
 
 struct b2Pair
@@ -45,6 +46,14 @@ public:
 	b2BroadPhase();
 	~b2BroadPhase();
 
+	/// Use a uniform spatial hash with the specified cell size instead of the dynamic tree.
+	/// A cell size of zero restores the dynamic tree. This can only be changed whilst there
+	/// are no proxies.
+	void SetSpatialHash(float32 cellSize);
+
+	/// Get the spatial hash cell size or zero if the dynamic tree is used.
+	float32 GetSpatialHash() const { return m_spatialHash ? m_hash.GetCellSize() : 0.0f; }
+
 	/// Create a proxy with an initial AABB. Pairs are not reported until
 	/// UpdatePairs is called.
 	int32 CreateProxy(const b2AABB& aabb, void* userData);
@@ -56,9 +65,27 @@ public:
 	/// call UpdatePairs to finalized the proxy pairs (for your time step).
 	void MoveProxy(int32 proxyId, const b2AABB& aabb, const b2Vec2& displacement);
 
+	/// Call BeginBulkMove before moving many proxies at once. Until EndBulkMove is called
+	/// moved proxies only have their fat AABB updated, EndBulkMove then refits the tree and
+	/// rebuilds it once it has degraded. The tree must not be queried in between.
+	void BeginBulkMove();
+	void EndBulkMove();
+
 	/// Call to trigger a re-processing of it's pairs on the next call to UpdatePairs.
 	void TouchProxy(int32 proxyId);
 
+	/// Overwrite the fat AABB of a proxy, e.g. when restoring a world snapshot. This must
+	/// be called between BeginBulkMove and EndBulkMove and does not buffer a move.
+	void SetFatAABB(int32 proxyId, const b2AABB& aabb);
+
+	/// Get the proxies buffered for the next call to UpdatePairs. Removed proxies are
+	/// left in the buffer as e_nullProxy.
+	int32 GetMoveCount() const { return m_moveCount; }
+	const int32* GetMoveBuffer() const { return m_moveBuffer; }
+
+	/// Replace the proxies buffered for the next call to UpdatePairs.
+	void SetMoveBuffer(const int32* proxyIds, int32 count);
+
 	/// Get the fat AABB for a proxy.
 	const b2AABB& GetFatAABB(int32 proxyId) const;
 
@@ -90,7 +117,7 @@ public:
 	template <typename T>
 	void RayCast(T* callback, const b2RayCastInput& input) const;
 
-	/// Get the height of the embedded tree.
+	/// Get the height of the embedded tree. This is zero when the spatial hash is used.
 	int32 GetTreeHeight() const;
 
 	/// Get the balance of the embedded tree.
@@ -107,6 +134,7 @@ public:
 private:
 
 	friend class b2DynamicTree;
+	friend class b2SpatialHash;
 
 	void BufferMove(int32 proxyId);
 	void UnBufferMove(int32 proxyId);
@@ -114,6 +142,8 @@ private:
 	bool QueryCallback(int32 proxyId);
 
 	b2DynamicTree m_tree;
+	b2SpatialHash m_hash;
+	bool m_spatialHash;
 
 	int32 m_proxyCount;
 
@@ -126,6 +156,10 @@ private:
 	int32 m_pairCount;
 
 	int32 m_queryProxyId;
+
+	bool m_bulkMove;
+	bool m_refitRequired;
+	float32 m_rebuildAreaRatio;
 };
 
 /// This is used to sort pairs.
@@ -146,19 +180,19 @@ inline bool b2PairLessThan(const b2Pair& pair1, const b2Pair& pair2)
 
 inline void* b2BroadPhase::GetUserData(int32 proxyId) const
 {
-	return m_tree.GetUserData(proxyId);
+	return m_spatialHash ? m_hash.GetUserData(proxyId) : m_tree.GetUserData(proxyId);
 }
 
 inline bool b2BroadPhase::TestOverlap(int32 proxyIdA, int32 proxyIdB) const
 {
-	const b2AABB& aabbA = m_tree.GetFatAABB(proxyIdA);
-	const b2AABB& aabbB = m_tree.GetFatAABB(proxyIdB);
+	const b2AABB& aabbA = GetFatAABB(proxyIdA);
+	const b2AABB& aabbB = GetFatAABB(proxyIdB);
 	return b2TestOverlap(aabbA, aabbB);
 }
 
 inline const b2AABB& b2BroadPhase::GetFatAABB(int32 proxyId) const
 {
-	return m_tree.GetFatAABB(proxyId);
+	return m_spatialHash ? m_hash.GetFatAABB(proxyId) : m_tree.GetFatAABB(proxyId);
 }
 
 inline int32 b2BroadPhase::GetProxyCount() const
@@ -168,17 +202,17 @@ inline int32 b2BroadPhase::GetProxyCount() const
 
 inline int32 b2BroadPhase::GetTreeHeight() const
 {
-	return m_tree.GetHeight();
+	return m_spatialHash ? 0 : m_tree.GetHeight();
 }
 
 inline int32 b2BroadPhase::GetTreeBalance() const
 {
-	return m_tree.GetMaxBalance();
+	return m_spatialHash ? 0 : m_tree.GetMaxBalance();
 }
 
 inline float32 b2BroadPhase::GetTreeQuality() const
 {
-	return m_tree.GetAreaRatio();
+	return m_spatialHash ? 0.0f : m_tree.GetAreaRatio();
 }
 
 template <typename T>
@@ -198,10 +232,10 @@ void b2BroadPhase::UpdatePairs(T* callback)
 
 		// We have to query the tree with the fat AABB so that
 		// we don't fail to create a pair that may touch later.
-		const b2AABB& fatAABB = m_tree.GetFatAABB(m_queryProxyId);
+		const b2AABB& fatAABB = GetFatAABB(m_queryProxyId);
 
 		// Query tree, create pairs and add them pair buffer.
-		m_tree.Query(this, fatAABB);
+		Query(this, fatAABB);
 	}
 
 	// Reset move buffer
@@ -215,8 +249,8 @@ void b2BroadPhase::UpdatePairs(T* callback)
 	while (i < m_pairCount)
 	{
 		b2Pair* primaryPair = m_pairBuffer + i;
-		void* userDataA = m_tree.GetUserData(primaryPair->proxyIdA);
-		void* userDataB = m_tree.GetUserData(primaryPair->proxyIdB);
+		void* userDataA = GetUserData(primaryPair->proxyIdA);
+		void* userDataB = GetUserData(primaryPair->proxyIdB);
 
 		callback->AddPair(userDataA, userDataB);
 		++i;
@@ -240,17 +274,35 @@ void b2BroadPhase::UpdatePairs(T* callback)
 template <typename T>
 inline void b2BroadPhase::Query(T* callback, const b2AABB& aabb) const
 {
+	if (m_spatialHash)
+	{
+		m_hash.Query(callback, aabb);
+		return;
+	}
+
 	m_tree.Query(callback, aabb);
 }
 
 template <typename T>
 inline void b2BroadPhase::RayCast(T* callback, const b2RayCastInput& input) const
 {
+	if (m_spatialHash)
+	{
+		m_hash.RayCast(callback, input);
+		return;
+	}
+
 	m_tree.RayCast(callback, input);
 }
 
 inline void b2BroadPhase::ShiftOrigin(const b2Vec2& newOrigin)
 {
+	if (m_spatialHash)
+	{
+		m_hash.ShiftOrigin(newOrigin);
+		return;
+	}
+
 	m_tree.ShiftOrigin(newOrigin);
 }
 
@@ -36,15 +36,17 @@ static float32 b2EdgeSeparation(const b2PolygonShape* poly1, const b2Transform&
 	b2Vec2 normal1 = b2MulT(xf2.q, normal1World);
 
 	// Find support vertex on poly2 for -normal.
+	float32 dots[b2_maxPolygonVertices];
+	b2DotVertices(&normal1.x, &vertices2[0].x, count2, dots);
+
 	int32 index = 0;
 	float32 minDot = b2_maxFloat;
 
 	for (int32 i = 0; i < count2; ++i)
 	{
-		float32 dot = b2Dot(vertices2[i], normal1);
-		if (dot < minDot)
+		if (dots[i] < minDot)
 		{
-			minDot = dot;
+			minDot = dots[i];
 			index = i;
 		}
 	}
@@ -68,14 +70,16 @@ static float32 b2FindMaxSeparation(int32* edgeIndex,
 	b2Vec2 dLocal1 = b2MulT(xf1.q, d);
 
 	// Find edge normal on poly1 that has the largest projection onto d.
+	float32 dots[b2_maxPolygonVertices];
+	b2DotVertices(&dLocal1.x, &normals1[0].x, count1, dots);
+
 	int32 edge = 0;
 	float32 maxDot = -b2_maxFloat;
 	for (int32 i = 0; i < count1; ++i)
 	{
-		float32 dot = b2Dot(normals1[i], dLocal1);
-		if (dot > maxDot)
+		if (dots[i] > maxDot)
 		{
-			maxDot = dot;
+			maxDot = dots[i];
 			edge = i;
 		}
 	}
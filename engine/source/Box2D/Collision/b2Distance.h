@@ -106,23 +106,25 @@ inline const b2Vec2& b2DistanceProxy::GetVertex(int32 index) const
 
 inline int32 b2DistanceProxy::GetSupport(const b2Vec2& d) const
 {
-	int32 bestIndex = 0;
-	float32 bestValue = b2Dot(m_vertices[0], d);
-	for (int32 i = 1; i < m_count; ++i)
+	// Polygons dot all their vertices at once.
+	if (m_count >= 4)
 	{
-		float32 value = b2Dot(m_vertices[i], d);
-		if (value > bestValue)
+		b2Assert(m_count <= b2_maxPolygonVertices);
+		float32 dots[b2_maxPolygonVertices];
+		b2DotVertices(&d.x, &m_vertices[0].x, m_count, dots);
+
+		int32 bestIndex = 0;
+		for (int32 i = 1; i < m_count; ++i)
 		{
-			bestIndex = i;
-			bestValue = value;
+			if (dots[i] > dots[bestIndex])
+			{
+				bestIndex = i;
+			}
 		}
-	}
 
-	return bestIndex;
-}
+		return bestIndex;
+	}
 
-inline const b2Vec2& b2DistanceProxy::GetSupportVertex(const b2Vec2& d) const
-{
 	int32 bestIndex = 0;
 	float32 bestValue = b2Dot(m_vertices[0], d);
 	for (int32 i = 1; i < m_count; ++i)
@@ -135,7 +137,12 @@ inline const b2Vec2& b2DistanceProxy::GetSupportVertex(const b2Vec2& d) const
 		}
 	}
 
-	return m_vertices[bestIndex];
+	return bestIndex;
+}
+
+inline const b2Vec2& b2DistanceProxy::GetSupportVertex(const b2Vec2& d) const
+{
+	return m_vertices[GetSupport(d)];
 }
 
 #endif
@@ -143,37 +143,79 @@ bool b2DynamicTree::MoveProxy(int32 proxyId, const b2AABB& aabb, const b2Vec2& d
 
 	RemoveLeaf(proxyId);
 
-	// Extend AABB.
 	b2AABB b = aabb;
+	FattenAABB(&b, displacement);
+	m_nodes[proxyId].aabb = b;
+
+	InsertLeaf(proxyId);
+	return true;
+}
+
+bool b2DynamicTree::RefitProxy(int32 proxyId, const b2AABB& aabb, const b2Vec2& displacement)
+{
+	b2Assert(0 <= proxyId && proxyId < m_nodeCapacity);
+
+	b2Assert(m_nodes[proxyId].IsLeaf());
+
+	if (m_nodes[proxyId].aabb.Contains(aabb))
+	{
+		return false;
+	}
+
+	b2AABB b = aabb;
+	FattenAABB(&b, displacement);
+	m_nodes[proxyId].aabb = b;
+	return true;
+}
+
+void b2DynamicTree::FattenAABB(b2AABB* aabb, const b2Vec2& displacement) const
+{
+	// Extend AABB.
 	b2Vec2 r(b2_aabbExtension, b2_aabbExtension);
-	b.lowerBound = b.lowerBound - r;
-	b.upperBound = b.upperBound + r;
+	aabb->lowerBound = aabb->lowerBound - r;
+	aabb->upperBound = aabb->upperBound + r;
 
 	// Predict AABB displacement.
 	b2Vec2 d = b2_aabbMultiplier * displacement;
 
 	if (d.x < 0.0f)
 	{
-		b.lowerBound.x += d.x;
+		aabb->lowerBound.x += d.x;
 	}
 	else
 	{
-		b.upperBound.x += d.x;
+		aabb->upperBound.x += d.x;
 	}
 
 	if (d.y < 0.0f)
 	{
-		b.lowerBound.y += d.y;
+		aabb->lowerBound.y += d.y;
 	}
 	else
 	{
-		b.upperBound.y += d.y;
+		aabb->upperBound.y += d.y;
 	}
+}
 
-	m_nodes[proxyId].aabb = b;
+void b2DynamicTree::Refit()
+{
+	if (m_root != b2_nullNode)
+	{
+		RefitNode(m_root);
+	}
+}
 
-	InsertLeaf(proxyId);
-	return true;
+void b2DynamicTree::RefitNode(int32 index)
+{
+	b2TreeNode* node = m_nodes + index;
+	if (node->IsLeaf())
+	{
+		return;
+	}
+
+	RefitNode(node->child1);
+	RefitNode(node->child2);
+	node->aabb.Combine(m_nodes[node->child1].aabb, m_nodes[node->child2].aabb);
 }
 
 void b2DynamicTree::InsertLeaf(int32 leaf)
@@ -770,6 +812,183 @@ void b2DynamicTree::RebuildBottomUp()
 	Validate();
 }
 
+void b2DynamicTree::RebuildTopDown()
+{
+	int32* leaves = (int32*)b2Alloc(m_nodeCount * sizeof(int32));
+	int32 count = 0;
+
+	// Build array of leaves. Free the rest.
+	for (int32 i = 0; i < m_nodeCapacity; ++i)
+	{
+		if (m_nodes[i].height < 0)
+		{
+			// free node in pool
+			continue;
+		}
+
+		if (m_nodes[i].IsLeaf())
+		{
+			m_nodes[i].parent = b2_nullNode;
+			leaves[count] = i;
+			++count;
+		}
+		else
+		{
+			FreeNode(i);
+		}
+	}
+
+	if (count > 0)
+	{
+		m_root = BuildTopDown(leaves, count);
+		m_nodes[m_root].parent = b2_nullNode;
+	}
+	else
+	{
+		m_root = b2_nullNode;
+	}
+
+	b2Free(leaves);
+}
+
+// Build a sub-tree from the leaves, returning its root.
+int32 b2DynamicTree::BuildTopDown(int32* leaves, int32 count)
+{
+	if (count == 1)
+	{
+		return leaves[0];
+	}
+
+	// Bound the leaf centers.
+	b2Vec2 lower = m_nodes[leaves[0]].aabb.GetCenter();
+	b2Vec2 upper = lower;
+	for (int32 i = 1; i < count; ++i)
+	{
+		b2Vec2 center = m_nodes[leaves[i]].aabb.GetCenter();
+		lower = b2Min(lower, center);
+		upper = b2Max(upper, center);
+	}
+
+	// Split along the longest axis.
+	int32 axis = (upper.x - lower.x) > (upper.y - lower.y) ? 0 : 1;
+	float32 minCenter = lower(axis);
+	float32 range = upper(axis) - minCenter;
+
+	int32 split = count / 2;
+	if (range > 0.0f)
+	{
+		// Bin the leaves by their center.
+		b2AABB binAABBs[b2_treeBinCount];
+		int32 binCounts[b2_treeBinCount];
+		for (int32 i = 0; i < b2_treeBinCount; ++i)
+		{
+			binCounts[i] = 0;
+		}
+
+		float32 binScale = b2_treeBinCount / range;
+		for (int32 i = 0; i < count; ++i)
+		{
+			const b2AABB& aabb = m_nodes[leaves[i]].aabb;
+			int32 bin = b2Min(int32((aabb.GetCenter()(axis) - minCenter) * binScale), b2_treeBinCount - 1);
+			if (binCounts[bin] == 0)
+			{
+				binAABBs[bin] = aabb;
+			}
+			else
+			{
+				binAABBs[bin].Combine(aabb);
+			}
+			++binCounts[bin];
+		}
+
+		// Sweep the bins from the right to find the cost of each right-hand side.
+		float32 rightCosts[b2_treeBinCount];
+		b2AABB rightAABB;
+		int32 rightCount = 0;
+		for (int32 i = b2_treeBinCount - 1; i > 0; --i)
+		{
+			if (binCounts[i] > 0)
+			{
+				if (rightCount == 0)
+				{
+					rightAABB = binAABBs[i];
+				}
+				else
+				{
+					rightAABB.Combine(binAABBs[i]);
+				}
+				rightCount += binCounts[i];
+			}
+			rightCosts[i] = rightCount > 0 ? rightCount * rightAABB.GetPerimeter() : 0.0f;
+		}
+
+		// Sweep the bins from the left to find the cheapest split.
+		float32 minCost = b2_maxFloat;
+		int32 splitBin = -1;
+		b2AABB leftAABB;
+		int32 leftCount = 0;
+		for (int32 i = 0; i < b2_treeBinCount - 1; ++i)
+		{
+			if (binCounts[i] > 0)
+			{
+				if (leftCount == 0)
+				{
+					leftAABB = binAABBs[i];
+				}
+				else
+				{
+					leftAABB.Combine(binAABBs[i]);
+				}
+				leftCount += binCounts[i];
+			}
+
+			if (leftCount == 0 || leftCount == count)
+			{
+				continue;
+			}
+
+			float32 cost = leftCount * leftAABB.GetPerimeter() + rightCosts[i + 1];
+			if (cost < minCost)
+			{
+				minCost = cost;
+				splitBin = i;
+			}
+		}
+
+		// Partition the leaves around the split.
+		if (splitBin >= 0)
+		{
+			int32 left = 0;
+			for (int32 i = 0; i < count; ++i)
+			{
+				int32 bin = b2Min(int32((m_nodes[leaves[i]].aabb.GetCenter()(axis) - minCenter) * binScale), b2_treeBinCount - 1);
+				if (bin <= splitBin)
+				{
+					b2Swap(leaves[i], leaves[left]);
+					++left;
+				}
+			}
+			split = left;
+		}
+	}
+
+	int32 child1 = BuildTopDown(leaves, split);
+	int32 child2 = BuildTopDown(leaves + split, count - split);
+
+	int32 parentIndex = AllocateNode();
+	b2TreeNode* parent = m_nodes + parentIndex;
+	parent->child1 = child1;
+	parent->child2 = child2;
+	parent->height = 1 + b2Max(m_nodes[child1].height, m_nodes[child2].height);
+	parent->aabb.Combine(m_nodes[child1].aabb, m_nodes[child2].aabb);
+	parent->parent = b2_nullNode;
+
+	m_nodes[child1].parent = parentIndex;
+	m_nodes[child2].parent = parentIndex;
+
+	return parentIndex;
+}
+
 void b2DynamicTree::ShiftOrigin(const b2Vec2& newOrigin)
 {
 	// Build array of leaves. Free the rest.
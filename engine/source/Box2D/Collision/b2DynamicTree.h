@@ -79,6 +79,19 @@ public:
 	/// @return true if the proxy was re-inserted.
 	bool MoveProxy(int32 proxyId, const b2AABB& aabb1, const b2Vec2& displacement);
 
+	/// Move a proxy with a swepted AABB without restructuring the tree. If the proxy has
+	/// moved outside of its fattened AABB then only the fattened AABB is updated and Refit
+	/// must be called before the tree is queried again.
+	/// @return true if the fattened AABB was updated.
+	bool RefitProxy(int32 proxyId, const b2AABB& aabb1, const b2Vec2& displacement);
+
+	/// Recompute the internal node AABBs bottom-up after proxies were moved with RefitProxy.
+	void Refit();
+
+	/// Overwrite the fattened AABB of a proxy without restructuring the tree. Refit
+	/// must be called before the tree is queried again.
+	void SetFatAABB(int32 proxyId, const b2AABB& aabb);
+
 	/// Get proxy user data.
 	/// @return the proxy user data or 0 if the id is invalid.
 	void* GetUserData(int32 proxyId) const;
@@ -91,6 +104,12 @@ public:
 	template <typename T>
 	void Query(T* callback, const b2AABB& aabb) const;
 
+	/// Query a batch of AABBs for overlapping proxies in a single walk of the tree.
+	/// Each node is only visited once for all the AABBs that overlap it. The callback
+	/// class is called with the AABB index for each proxy that overlaps that AABB.
+	template <typename T>
+	void QueryBatch(T* callback, const b2AABB* aabbs, int32 count) const;
+
 	/// Ray-cast against the proxies in the tree. This relies on the callback
 	/// to perform a exact ray-cast in the case were the proxy contains a shape.
 	/// The callback also performs the any collision filtering. This has performance
@@ -118,6 +137,9 @@ public:
 	/// Build an optimal tree. Very expensive. For testing.
 	void RebuildBottomUp();
 
+	/// Build a good tree top-down using a binned surface area heuristic in O(n log n).
+	void RebuildTopDown();
+
 	/// Shift the world origin. Useful for large worlds.
 	/// The shift formula is: position -= newOrigin
 	/// @param newOrigin the new origin with respect to the old origin
@@ -131,6 +153,10 @@ private:
 	void InsertLeaf(int32 node);
 	void RemoveLeaf(int32 node);
 
+	void FattenAABB(b2AABB* aabb, const b2Vec2& displacement) const;
+	void RefitNode(int32 index);
+	int32 BuildTopDown(int32* leaves, int32 count);
+
 	int32 Balance(int32 index);
 
 	int32 ComputeHeight() const;
@@ -165,6 +191,13 @@ inline const b2AABB& b2DynamicTree::GetFatAABB(int32 proxyId) const
 	return m_nodes[proxyId].aabb;
 }
 
+inline void b2DynamicTree::SetFatAABB(int32 proxyId, const b2AABB& aabb)
+{
+	b2Assert(0 <= proxyId && proxyId < m_nodeCapacity);
+	b2Assert(m_nodes[proxyId].IsLeaf());
+	m_nodes[proxyId].aabb = aabb;
+}
+
 template <typename T>
 inline void b2DynamicTree::Query(T* callback, const b2AABB& aabb) const
 {
@@ -200,6 +233,84 @@ inline void b2DynamicTree::Query(T* callback, const b2AABB& aabb) const
 	}
 }
 
+/// A node to visit during a batched query along with the range of active queries.
+struct b2TreeBatchEntry
+{
+	int32 nodeId;
+	int32 begin;
+	int32 end;
+};
+
+template <typename T>
+inline void b2DynamicTree::QueryBatch(T* callback, const b2AABB* aabbs, int32 count) const
+{
+	if (m_root == b2_nullNode || count <= 0)
+	{
+		return;
+	}
+
+	// The active query indices for each node visited are held as ranges in this stack.
+	b2GrowableStack<int32, 256> active;
+	for (int32 i = 0; i < count; ++i)
+	{
+		active.Push(i);
+	}
+
+	b2TreeBatchEntry root;
+	root.nodeId = m_root;
+	root.begin = 0;
+	root.end = count;
+
+	b2GrowableStack<b2TreeBatchEntry, 256> stack;
+	stack.Push(root);
+
+	while (stack.GetCount() > 0)
+	{
+		b2TreeBatchEntry entry = stack.Pop();
+
+		// Discard the ranges of any subtrees that have already been visited.
+		active.Truncate(entry.end);
+
+		const b2TreeNode* node = m_nodes + entry.nodeId;
+
+		// Keep the queries that overlap this node.
+		int32 begin = active.GetCount();
+		for (int32 i = entry.begin; i < entry.end; ++i)
+		{
+			int32 queryIndex = active.Get(i);
+			if (b2TestOverlap(node->aabb, aabbs[queryIndex]))
+			{
+				active.Push(queryIndex);
+			}
+		}
+		int32 end = active.GetCount();
+
+		if (begin == end)
+		{
+			continue;
+		}
+
+		if (node->IsLeaf())
+		{
+			for (int32 i = begin; i < end; ++i)
+			{
+				callback->QueryBatchCallback(active.Get(i), entry.nodeId);
+			}
+		}
+		else
+		{
+			b2TreeBatchEntry child;
+			child.begin = begin;
+			child.end = end;
+
+			child.nodeId = node->child1;
+			stack.Push(child);
+			child.nodeId = node->child2;
+			stack.Push(child);
+		}
+	}
+}
+
 template <typename T>
 inline void b2DynamicTree::RayCast(T* callback, const b2RayCastInput& input) const
 {
@@ -0,0 +1,349 @@
+/*
+* Copyright (c) 2009 Erin Catto http://www.box2d.org
+*
+* This software is provided 'as-is', without any express or implied
+* warranty.  In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it
+* freely, subject to the following restrictions:
+* 1. The origin of this software must not be misrepresented; you must not
+* claim that you wrote the original software. If you use this software
+* in a product, an acknowledgment in the product documentation would be
+* appreciated but is not required.
+* 2. Altered source versions must be plainly marked as such, and must not be
+* misrepresented as being the original software.
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <Box2D/Collision/b2SpatialHash.h>
+#include <cstring>
+using namespace std;
+
+b2SpatialHash::b2SpatialHash()
+{
+	m_cellSize = 1.0f;
+	m_inverseCellSize = 1.0f;
+
+	// Build a linked list for the proxy free list.
+	m_proxyCapacity = 16;
+	m_proxyCount = 0;
+	m_proxies = (b2HashProxy*)b2Alloc(m_proxyCapacity * sizeof(b2HashProxy));
+	memset(m_proxies, 0, m_proxyCapacity * sizeof(b2HashProxy));
+	for (int32 i = 0; i < m_proxyCapacity - 1; ++i)
+	{
+		m_proxies[i].next = i + 1;
+	}
+	m_proxies[m_proxyCapacity-1].next = b2_nullHashIndex;
+	m_freeProxy = 0;
+
+	// Build a linked list for the entry free list.
+	m_entryCapacity = 64;
+	m_entryCount = 0;
+	m_entries = (b2HashEntry*)b2Alloc(m_entryCapacity * sizeof(b2HashEntry));
+	for (int32 i = 0; i < m_entryCapacity; ++i)
+	{
+		m_entries[i].proxyId = b2_nullHashIndex;
+		m_entries[i].next = i + 1;
+	}
+	m_entries[m_entryCapacity-1].next = b2_nullHashIndex;
+	m_freeEntry = 0;
+
+	// Start with empty buckets.
+	int32 bucketCount = 256;
+	m_bucketMask = bucketCount - 1;
+	m_buckets = (int32*)b2Alloc(bucketCount * sizeof(int32));
+	for (int32 i = 0; i < bucketCount; ++i)
+	{
+		m_buckets[i] = b2_nullHashIndex;
+	}
+}
+
+b2SpatialHash::~b2SpatialHash()
+{
+	b2Free(m_buckets);
+	b2Free(m_entries);
+	b2Free(m_proxies);
+}
+
+void b2SpatialHash::SetCellSize(float32 cellSize)
+{
+	b2Assert(cellSize > 0.0f);
+	m_cellSize = cellSize;
+	m_inverseCellSize = 1.0f / cellSize;
+	RehashAll();
+}
+
+int32 b2SpatialHash::CreateProxy(const b2AABB& aabb, void* userData)
+{
+	// Expand the proxy pool if necessary.
+	if (m_freeProxy == b2_nullHashIndex)
+	{
+		b2HashProxy* oldProxies = m_proxies;
+		int32 oldCapacity = m_proxyCapacity;
+		m_proxyCapacity *= 2;
+		m_proxies = (b2HashProxy*)b2Alloc(m_proxyCapacity * sizeof(b2HashProxy));
+		memcpy(m_proxies, oldProxies, oldCapacity * sizeof(b2HashProxy));
+		memset(m_proxies + oldCapacity, 0, (m_proxyCapacity - oldCapacity) * sizeof(b2HashProxy));
+		b2Free(oldProxies);
+
+		for (int32 i = oldCapacity; i < m_proxyCapacity - 1; ++i)
+		{
+			m_proxies[i].next = i + 1;
+		}
+		m_proxies[m_proxyCapacity-1].next = b2_nullHashIndex;
+		m_freeProxy = oldCapacity;
+	}
+
+	int32 proxyId = m_freeProxy;
+	b2HashProxy* proxy = m_proxies + proxyId;
+	m_freeProxy = proxy->next;
+
+	// Fatten the aabb.
+	b2Vec2 r(b2_aabbExtension, b2_aabbExtension);
+	proxy->aabb.lowerBound = aabb.lowerBound - r;
+	proxy->aabb.upperBound = aabb.upperBound + r;
+	proxy->userData = userData;
+	proxy->next = e_allocatedProxy;
+	++m_proxyCount;
+
+	InsertCells(proxyId);
+
+	return proxyId;
+}
+
+void b2SpatialHash::DestroyProxy(int32 proxyId)
+{
+	b2Assert(0 <= proxyId && proxyId < m_proxyCapacity);
+	b2Assert(m_proxies[proxyId].next == e_allocatedProxy);
+
+	RemoveCells(proxyId);
+
+	b2HashProxy* proxy = m_proxies + proxyId;
+	proxy->userData = NULL;
+	proxy->next = m_freeProxy;
+	m_freeProxy = proxyId;
+	--m_proxyCount;
+}
+
+bool b2SpatialHash::MoveProxy(int32 proxyId, const b2AABB& aabb, const b2Vec2& displacement)
+{
+	b2Assert(0 <= proxyId && proxyId < m_proxyCapacity);
+	b2Assert(m_proxies[proxyId].next == e_allocatedProxy);
+
+	b2HashProxy* proxy = m_proxies + proxyId;
+	if (proxy->aabb.Contains(aabb))
+	{
+		return false;
+	}
+
+	// Extend AABB.
+	b2AABB b = aabb;
+	b2Vec2 r(b2_aabbExtension, b2_aabbExtension);
+	b.lowerBound = b.lowerBound - r;
+	b.upperBound = b.upperBound + r;
+
+	// Predict AABB displacement.
+	b2Vec2 d = b2_aabbMultiplier * displacement;
+
+	if (d.x < 0.0f)
+	{
+		b.lowerBound.x += d.x;
+	}
+	else
+	{
+		b.upperBound.x += d.x;
+	}
+
+	if (d.y < 0.0f)
+	{
+		b.lowerBound.y += d.y;
+	}
+	else
+	{
+		b.upperBound.y += d.y;
+	}
+
+	proxy->aabb = b;
+	UpdateCells(proxyId);
+
+	return true;
+}
+
+void b2SpatialHash::SetFatAABB(int32 proxyId, const b2AABB& aabb)
+{
+	b2Assert(0 <= proxyId && proxyId < m_proxyCapacity);
+	b2Assert(m_proxies[proxyId].next == e_allocatedProxy);
+
+	m_proxies[proxyId].aabb = aabb;
+	UpdateCells(proxyId);
+}
+
+void b2SpatialHash::ShiftOrigin(const b2Vec2& newOrigin)
+{
+	for (int32 i = 0; i < m_proxyCapacity; ++i)
+	{
+		b2HashProxy* proxy = m_proxies + i;
+		if (proxy->next != e_allocatedProxy)
+		{
+			continue;
+		}
+
+		proxy->aabb.lowerBound -= newOrigin;
+		proxy->aabb.upperBound -= newOrigin;
+	}
+
+	RehashAll();
+}
+
+void b2SpatialHash::InsertCells(int32 proxyId)
+{
+	b2HashProxy* proxy = m_proxies + proxyId;
+	proxy->lowerX = GetCell(proxy->aabb.lowerBound.x);
+	proxy->lowerY = GetCell(proxy->aabb.lowerBound.y);
+	proxy->upperX = GetCell(proxy->aabb.upperBound.x);
+	proxy->upperY = GetCell(proxy->aabb.upperBound.y);
+
+	for (int32 y = proxy->lowerY; y <= proxy->upperY; ++y)
+	{
+		for (int32 x = proxy->lowerX; x <= proxy->upperX; ++x)
+		{
+			// Expand the entry pool if necessary.
+			if (m_freeEntry == b2_nullHashIndex)
+			{
+				b2HashEntry* oldEntries = m_entries;
+				int32 oldCapacity = m_entryCapacity;
+				m_entryCapacity *= 2;
+				m_entries = (b2HashEntry*)b2Alloc(m_entryCapacity * sizeof(b2HashEntry));
+				memcpy(m_entries, oldEntries, oldCapacity * sizeof(b2HashEntry));
+				b2Free(oldEntries);
+
+				for (int32 i = oldCapacity; i < m_entryCapacity; ++i)
+				{
+					m_entries[i].proxyId = b2_nullHashIndex;
+					m_entries[i].next = i + 1;
+				}
+				m_entries[m_entryCapacity-1].next = b2_nullHashIndex;
+				m_freeEntry = oldCapacity;
+			}
+
+			int32 entryId = m_freeEntry;
+			b2HashEntry* entry = m_entries + entryId;
+			m_freeEntry = entry->next;
+
+			// Link the entry at the head of its bucket.
+			int32 bucket = GetBucket(x, y);
+			entry->proxyId = proxyId;
+			entry->x = x;
+			entry->y = y;
+			entry->next = m_buckets[bucket];
+			m_buckets[bucket] = entryId;
+			++m_entryCount;
+		}
+	}
+
+	// Keep the buckets short.
+	if (m_entryCount > 2 * (m_bucketMask + 1))
+	{
+		GrowBuckets();
+	}
+}
+
+void b2SpatialHash::RemoveCells(int32 proxyId)
+{
+	b2HashProxy* proxy = m_proxies + proxyId;
+
+	for (int32 y = proxy->lowerY; y <= proxy->upperY; ++y)
+	{
+		for (int32 x = proxy->lowerX; x <= proxy->upperX; ++x)
+		{
+			int32* link = m_buckets + GetBucket(x, y);
+			while (*link != b2_nullHashIndex)
+			{
+				b2HashEntry* entry = m_entries + *link;
+				if (entry->proxyId != proxyId || entry->x != x || entry->y != y)
+				{
+					link = &entry->next;
+					continue;
+				}
+
+				// Unlink the entry and return it to the pool.
+				int32 entryId = *link;
+				*link = entry->next;
+				entry->proxyId = b2_nullHashIndex;
+				entry->next = m_freeEntry;
+				m_freeEntry = entryId;
+				--m_entryCount;
+				break;
+			}
+		}
+	}
+}
+
+void b2SpatialHash::UpdateCells(int32 proxyId)
+{
+	b2HashProxy* proxy = m_proxies + proxyId;
+
+	// Nothing to do if the proxy still covers the same cells.
+	if (GetCell(proxy->aabb.lowerBound.x) == proxy->lowerX && GetCell(proxy->aabb.lowerBound.y) == proxy->lowerY &&
+		GetCell(proxy->aabb.upperBound.x) == proxy->upperX && GetCell(proxy->aabb.upperBound.y) == proxy->upperY)
+	{
+		return;
+	}
+
+	RemoveCells(proxyId);
+	InsertCells(proxyId);
+}
+
+void b2SpatialHash::RehashAll()
+{
+	// Return all the entries to the pool.
+	for (int32 i = 0; i < m_entryCapacity; ++i)
+	{
+		m_entries[i].proxyId = b2_nullHashIndex;
+		m_entries[i].next = i + 1;
+	}
+	m_entries[m_entryCapacity-1].next = b2_nullHashIndex;
+	m_freeEntry = 0;
+	m_entryCount = 0;
+
+	for (int32 i = 0; i <= m_bucketMask; ++i)
+	{
+		m_buckets[i] = b2_nullHashIndex;
+	}
+
+	// Insert the proxies into the cells they now cover.
+	for (int32 i = 0; i < m_proxyCapacity; ++i)
+	{
+		if (m_proxies[i].next == e_allocatedProxy)
+		{
+			InsertCells(i);
+		}
+	}
+}
+
+void b2SpatialHash::GrowBuckets()
+{
+	int32 bucketCount = 2 * (m_bucketMask + 1);
+	b2Free(m_buckets);
+	m_bucketMask = bucketCount - 1;
+	m_buckets = (int32*)b2Alloc(bucketCount * sizeof(int32));
+	for (int32 i = 0; i < bucketCount; ++i)
+	{
+		m_buckets[i] = b2_nullHashIndex;
+	}
+
+	// Re-link the entries into the new buckets.
+	for (int32 i = 0; i < m_entryCapacity; ++i)
+	{
+		b2HashEntry* entry = m_entries + i;
+		if (entry->proxyId == b2_nullHashIndex)
+		{
+			continue;
+		}
+
+		int32 bucket = GetBucket(entry->x, entry->y);
+		entry->next = m_buckets[bucket];
+		m_buckets[bucket] = i;
+	}
+}
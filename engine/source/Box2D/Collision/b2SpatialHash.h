@@ -0,0 +1,425 @@
+/*
+* Copyright (c) 2009 Erin Catto http://www.box2d.org
+*
+* This software is provided 'as-is', without any express or implied
+* warranty.  In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it
+* freely, subject to the following restrictions:
+* 1. The origin of this software must not be misrepresented; you must not
+* claim that you wrote the original software. If you use this software
+* in a product, an acknowledgment in the product documentation would be
+* appreciated but is not required.
+* 2. Altered source versions must be plainly marked as such, and must not be
+* misrepresented as being the original software.
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef B2_SPATIAL_HASH_H
+#define B2_SPATIAL_HASH_H
+
+#include <Box2D/Collision/b2Collision.h>
+
+#define b2_nullHashIndex (-1)
+
+/// A proxy in the spatial hash. The proxy is stored in every cell its fat AABB overlaps.
+struct b2HashProxy
+{
+	/// Enlarged AABB
+	b2AABB aabb;
+
+	void* userData;
+
+	/// The range of cells covered by the enlarged AABB.
+	int32 lowerX, lowerY;
+	int32 upperX, upperY;
+
+	/// The next free proxy, or e_allocatedProxy when in use.
+	int32 next;
+};
+
+/// A single cell occupied by a proxy. Entries are chained per hash bucket.
+struct b2HashEntry
+{
+	int32 proxyId;
+	int32 x, y;
+	int32 next;
+};
+
+/// A uniform grid broad-phase. The unbounded grid is hashed into a table of buckets so only
+/// occupied cells cost memory. When proxies are small relative to the cell size moving a proxy
+/// only touches a handful of cells, making updates O(1) rather than the O(log n) re-insertion of
+/// b2DynamicTree. This suits crowds of many similarly sized proxies. Large or very uneven proxies
+/// are better served by the tree. The interface mirrors b2DynamicTree.
+class b2SpatialHash
+{
+public:
+	/// Constructing the hash initializes the proxy and entry pools.
+	b2SpatialHash();
+
+	/// Destroy the hash, freeing the pools.
+	~b2SpatialHash();
+
+	/// Set the grid cell size. Any existing proxies are re-hashed.
+	void SetCellSize(float32 cellSize);
+
+	/// Get the grid cell size.
+	float32 GetCellSize() const { return m_cellSize; }
+
+	/// Create a proxy. Provide a tight fitting AABB and a userData pointer.
+	int32 CreateProxy(const b2AABB& aabb, void* userData);
+
+	/// Destroy a proxy. This asserts if the id is invalid.
+	void DestroyProxy(int32 proxyId);
+
+	/// Move a proxy with a swepted AABB. If the proxy has moved outside of its fattened AABB,
+	/// then the fattened AABB is recomputed and the proxy moves to the cells it now covers.
+	/// @return true if the fattened AABB was updated.
+	bool MoveProxy(int32 proxyId, const b2AABB& aabb1, const b2Vec2& displacement);
+
+	/// Overwrite the fattened AABB of a proxy.
+	void SetFatAABB(int32 proxyId, const b2AABB& aabb);
+
+	/// Get proxy user data.
+	void* GetUserData(int32 proxyId) const;
+
+	/// Get the fat AABB for a proxy.
+	const b2AABB& GetFatAABB(int32 proxyId) const;
+
+	/// Get the number of proxies.
+	int32 GetProxyCount() const { return m_proxyCount; }
+
+	/// Query an AABB for overlapping proxies. The callback class
+	/// is called once for each proxy that overlaps the supplied AABB.
+	template <typename T>
+	void Query(T* callback, const b2AABB& aabb) const;
+
+	/// Query a batch of AABBs for overlapping proxies. The callback class is
+	/// called with the AABB index for each proxy that overlaps that AABB.
+	template <typename T>
+	void QueryBatch(T* callback, const b2AABB* aabbs, int32 count) const;
+
+	/// Ray-cast against the proxies in the hash, walking the cells the ray passes through
+	/// in order. This relies on the callback to perform a exact ray-cast in the case were
+	/// the proxy contains a shape. The callback is called once for each proxy hit.
+	/// @param input the ray-cast input data. The ray extends from p1 to p1 + maxFraction * (p2 - p1).
+	/// @param callback a callback class that is called for each proxy that is hit by the ray.
+	template <typename T>
+	void RayCast(T* callback, const b2RayCastInput& input) const;
+
+	/// Shift the world origin. Useful for large worlds.
+	/// The shift formula is: position -= newOrigin
+	/// @param newOrigin the new origin with respect to the old origin
+	void ShiftOrigin(const b2Vec2& newOrigin);
+
+private:
+
+	enum
+	{
+		e_allocatedProxy = -2
+	};
+
+	int32 GetCell(float32 value) const;
+	int32 GetBucket(int32 x, int32 y) const;
+
+	void InsertCells(int32 proxyId);
+	void RemoveCells(int32 proxyId);
+	void UpdateCells(int32 proxyId);
+	void RehashAll();
+	void GrowBuckets();
+
+	float32 m_cellSize;
+	float32 m_inverseCellSize;
+
+	b2HashProxy* m_proxies;
+	int32 m_proxyCapacity;
+	int32 m_proxyCount;
+	int32 m_freeProxy;
+
+	b2HashEntry* m_entries;
+	int32 m_entryCapacity;
+	int32 m_entryCount;
+	int32 m_freeEntry;
+
+	int32* m_buckets;
+	int32 m_bucketMask;
+};
+
+/// Adapts a batch callback to a single query.
+template <typename T>
+struct b2SpatialHashBatchQuery
+{
+	bool QueryCallback(int32 proxyId)
+	{
+		callback->QueryBatchCallback(queryIndex, proxyId);
+		return true;
+	}
+
+	T* callback;
+	int32 queryIndex;
+};
+
+inline void* b2SpatialHash::GetUserData(int32 proxyId) const
+{
+	b2Assert(0 <= proxyId && proxyId < m_proxyCapacity);
+	return m_proxies[proxyId].userData;
+}
+
+inline const b2AABB& b2SpatialHash::GetFatAABB(int32 proxyId) const
+{
+	b2Assert(0 <= proxyId && proxyId < m_proxyCapacity);
+	return m_proxies[proxyId].aabb;
+}
+
+inline int32 b2SpatialHash::GetCell(float32 value) const
+{
+	// Clamp so that distant coordinates cannot overflow the cell index.
+	float32 cell = b2Clamp(value * m_inverseCellSize, -1.0e9f, 1.0e9f);
+	return (int32)floorf(cell);
+}
+
+inline int32 b2SpatialHash::GetBucket(int32 x, int32 y) const
+{
+	uint32 hash = ((uint32)x * 73856093u) ^ ((uint32)y * 19349663u);
+	return (int32)(hash & (uint32)m_bucketMask);
+}
+
+template <typename T>
+inline void b2SpatialHash::Query(T* callback, const b2AABB& aabb) const
+{
+	if (m_proxyCount == 0)
+	{
+		return;
+	}
+
+	int32 lowerX = GetCell(aabb.lowerBound.x);
+	int32 lowerY = GetCell(aabb.lowerBound.y);
+	int32 upperX = GetCell(aabb.upperBound.x);
+	int32 upperY = GetCell(aabb.upperBound.y);
+
+	// Scan the proxies directly when the query covers more cells than there are proxies.
+	float32 cellCount = float32(upperX - lowerX + 1) * float32(upperY - lowerY + 1);
+	if (cellCount > float32(m_proxyCount))
+	{
+		for (int32 proxyId = 0; proxyId < m_proxyCapacity; ++proxyId)
+		{
+			const b2HashProxy* proxy = m_proxies + proxyId;
+			if (proxy->next != e_allocatedProxy || b2TestOverlap(proxy->aabb, aabb) == false)
+			{
+				continue;
+			}
+
+			if (callback->QueryCallback(proxyId) == false)
+			{
+				return;
+			}
+		}
+		return;
+	}
+
+	for (int32 y = lowerY; y <= upperY; ++y)
+	{
+		for (int32 x = lowerX; x <= upperX; ++x)
+		{
+			for (int32 entryId = m_buckets[GetBucket(x, y)]; entryId != b2_nullHashIndex; entryId = m_entries[entryId].next)
+			{
+				const b2HashEntry* entry = m_entries + entryId;
+				if (entry->x != x || entry->y != y)
+				{
+					continue;
+				}
+
+				// Only report the proxy in the first cell shared with the query.
+				const b2HashProxy* proxy = m_proxies + entry->proxyId;
+				if (x != b2Max(lowerX, proxy->lowerX) || y != b2Max(lowerY, proxy->lowerY))
+				{
+					continue;
+				}
+
+				if (b2TestOverlap(proxy->aabb, aabb) == false)
+				{
+					continue;
+				}
+
+				if (callback->QueryCallback(entry->proxyId) == false)
+				{
+					return;
+				}
+			}
+		}
+	}
+}
+
+template <typename T>
+inline void b2SpatialHash::QueryBatch(T* callback, const b2AABB* aabbs, int32 count) const
+{
+	b2SpatialHashBatchQuery<T> batchQuery;
+	batchQuery.callback = callback;
+
+	for (int32 i = 0; i < count; ++i)
+	{
+		batchQuery.queryIndex = i;
+		Query(&batchQuery, aabbs[i]);
+	}
+}
+
+template <typename T>
+inline void b2SpatialHash::RayCast(T* callback, const b2RayCastInput& input) const
+{
+	if (m_proxyCount == 0)
+	{
+		return;
+	}
+
+	b2Vec2 p1 = input.p1;
+	b2Vec2 p2 = input.p2;
+	b2Vec2 d = p2 - p1;
+	b2Assert(d.LengthSquared() > 0.0f);
+
+	float32 maxFraction = input.maxFraction;
+
+	// Build a bounding box for the segment.
+	b2AABB segmentAABB;
+	{
+		b2Vec2 t = p1 + maxFraction * d;
+		segmentAABB.lowerBound = b2Min(p1, t);
+		segmentAABB.upperBound = b2Max(p1, t);
+	}
+
+	// Test the proxies directly when the ray crosses more cells than there are proxies.
+	float32 cellCount = (b2Abs(d.x) + b2Abs(d.y)) * maxFraction * m_inverseCellSize;
+	if (cellCount > float32(m_proxyCount))
+	{
+		for (int32 proxyId = 0; proxyId < m_proxyCapacity; ++proxyId)
+		{
+			const b2HashProxy* proxy = m_proxies + proxyId;
+			if (proxy->next != e_allocatedProxy || b2TestOverlap(proxy->aabb, segmentAABB) == false)
+			{
+				continue;
+			}
+
+			b2RayCastInput subInput;
+			subInput.p1 = input.p1;
+			subInput.p2 = input.p2;
+			subInput.maxFraction = maxFraction;
+
+			float32 value = callback->RayCastCallback(subInput, proxyId);
+
+			if (value == 0.0f)
+			{
+				// The client has terminated the ray cast.
+				return;
+			}
+
+			if (value > 0.0f)
+			{
+				// Update segment bounding box.
+				maxFraction = value;
+				b2Vec2 t = p1 + maxFraction * d;
+				segmentAABB.lowerBound = b2Min(p1, t);
+				segmentAABB.upperBound = b2Max(p1, t);
+			}
+		}
+		return;
+	}
+
+	// Set up the cell walk (Amanatides and Woo).
+	int32 x = GetCell(p1.x);
+	int32 y = GetCell(p1.y);
+	int32 stepX = d.x > 0.0f ? 1 : -1;
+	int32 stepY = d.y > 0.0f ? 1 : -1;
+	float32 nextX = b2_maxFloat;
+	float32 nextY = b2_maxFloat;
+	float32 deltaX = b2_maxFloat;
+	float32 deltaY = b2_maxFloat;
+	if (d.x != 0.0f)
+	{
+		float32 boundaryX = float32(stepX > 0 ? x + 1 : x) * m_cellSize;
+		nextX = (boundaryX - p1.x) / d.x;
+		deltaX = m_cellSize / b2Abs(d.x);
+	}
+	if (d.y != 0.0f)
+	{
+		float32 boundaryY = float32(stepY > 0 ? y + 1 : y) * m_cellSize;
+		nextY = (boundaryY - p1.y) / d.y;
+		deltaY = m_cellSize / b2Abs(d.y);
+	}
+
+	bool first = true;
+	int32 previousX = x;
+	int32 previousY = y;
+
+	for (;;)
+	{
+		for (int32 entryId = m_buckets[GetBucket(x, y)]; entryId != b2_nullHashIndex; entryId = m_entries[entryId].next)
+		{
+			const b2HashEntry* entry = m_entries + entryId;
+			if (entry->x != x || entry->y != y)
+			{
+				continue;
+			}
+
+			// The walk is contiguous so skip proxies that also covered the previous cell.
+			const b2HashProxy* proxy = m_proxies + entry->proxyId;
+			if (first == false &&
+				proxy->lowerX <= previousX && previousX <= proxy->upperX &&
+				proxy->lowerY <= previousY && previousY <= proxy->upperY)
+			{
+				continue;
+			}
+
+			if (b2TestOverlap(proxy->aabb, segmentAABB) == false)
+			{
+				continue;
+			}
+
+			b2RayCastInput subInput;
+			subInput.p1 = input.p1;
+			subInput.p2 = input.p2;
+			subInput.maxFraction = maxFraction;
+
+			float32 value = callback->RayCastCallback(subInput, entry->proxyId);
+
+			if (value == 0.0f)
+			{
+				// The client has terminated the ray cast.
+				return;
+			}
+
+			if (value > 0.0f)
+			{
+				// Update segment bounding box.
+				maxFraction = value;
+				b2Vec2 t = p1 + maxFraction * d;
+				segmentAABB.lowerBound = b2Min(p1, t);
+				segmentAABB.upperBound = b2Max(p1, t);
+			}
+		}
+
+		// Step to the next cell unless the ray ends first.
+		first = false;
+		previousX = x;
+		previousY = y;
+		if (nextX < nextY)
+		{
+			if (nextX > maxFraction)
+			{
+				return;
+			}
+			x += stepX;
+			nextX += deltaX;
+		}
+		else
+		{
+			if (nextY > maxFraction)
+			{
+				return;
+			}
+			y += stepY;
+			nextY += deltaY;
+		}
+	}
+}
+
+#endif
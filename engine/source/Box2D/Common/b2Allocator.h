@@ -0,0 +1,50 @@
+/*
+* Copyright (c) 2006-2009 Erin Catto http://www.box2d.org
+*
+* This software is provided 'as-is', without any express or implied
+* warranty.  In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it
+* freely, subject to the following restrictions:
+* 1. The origin of this software must not be misrepresented; you must not
+* claim that you wrote the original software. If you use this software
+* in a product, an acknowledgment in the product documentation would be
+* appreciated but is not required.
+* 2. Altered source versions must be plainly marked as such, and must not be
+* misrepresented as being the original software.
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef B2_ALLOCATOR_H
+#define B2_ALLOCATOR_H
+
+#include <Box2D/Common/b2Settings.h>
+
+/// Memory statistics reported by an allocator.
+struct b2AllocatorStats
+{
+	int32 bytesUsed;		///< bytes handed out and not yet freed
+	int32 bytesReserved;	///< bytes held from the heap, including free blocks
+	int32 allocationCount;	///< allocations not yet freed
+};
+
+/// The interface used to allocate the small objects that persist for more
+/// than one time step (bodies, fixtures, shapes, contacts and joints).
+/// Implement this to give a world its own allocation policy.
+class b2Allocator
+{
+public:
+	virtual ~b2Allocator() {}
+
+	/// Allocate memory.
+	virtual void* Allocate(int32 size) = 0;
+
+	/// Free memory. The size must be the size it was allocated with.
+	virtual void Free(void* p, int32 size) = 0;
+
+	/// Get the memory statistics.
+	virtual void GetStats(b2AllocatorStats* stats) const = 0;
+};
+
+#endif
@@ -0,0 +1,162 @@
+/*
+* Copyright (c) 2006-2009 Erin Catto http://www.box2d.org
+*
+* This software is provided 'as-is', without any express or implied
+* warranty.  In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it
+* freely, subject to the following restrictions:
+* 1. The origin of this software must not be misrepresented; you must not
+* claim that you wrote the original software. If you use this software
+* in a product, an acknowledgment in the product documentation would be
+* appreciated but is not required.
+* 2. Altered source versions must be plainly marked as such, and must not be
+* misrepresented as being the original software.
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <Box2D/Common/b2ArenaAllocator.h>
+#include <cstring>
+
+struct b2ArenaPage
+{
+	b2ArenaPage* next;
+};
+
+struct b2ArenaBlock
+{
+	b2ArenaBlock* next;
+};
+
+b2ArenaAllocator::b2ArenaAllocator(int32 pageSize)
+{
+	b2Assert(sizeof(b2ArenaPage) <= b2_arenaGranularity);
+	b2Assert(pageSize >= b2_arenaMaxBlockSize + b2_arenaGranularity);
+
+	m_pageSize = pageSize;
+	m_pages = NULL;
+	m_cursor = NULL;
+	m_remaining = 0;
+
+	memset(m_freeLists, 0, sizeof(m_freeLists));
+	memset(&m_stats, 0, sizeof(m_stats));
+}
+
+b2ArenaAllocator::~b2ArenaAllocator()
+{
+	while (m_pages)
+	{
+		b2ArenaPage* page = m_pages;
+		m_pages = page->next;
+		b2Free(page);
+	}
+}
+
+void b2ArenaAllocator::AddPage()
+{
+	// The page header takes the first granule so the blocks keep the heap alignment.
+	b2ArenaPage* page = (b2ArenaPage*)b2Alloc(m_pageSize);
+	page->next = m_pages;
+	m_pages = page;
+
+	m_cursor = (int8*)page + b2_arenaGranularity;
+	m_remaining = m_pageSize - b2_arenaGranularity;
+	m_stats.bytesReserved += m_pageSize;
+}
+
+void* b2ArenaAllocator::Allocate(int32 size)
+{
+	if (size == 0)
+		return NULL;
+
+	b2Assert(0 < size);
+
+	++m_stats.allocationCount;
+
+	if (size > b2_arenaMaxBlockSize)
+	{
+		m_stats.bytesUsed += size;
+		m_stats.bytesReserved += size;
+		return b2Alloc(size);
+	}
+
+	int32 index = (size - 1) / b2_arenaGranularity;
+	int32 blockSize = (index + 1) * b2_arenaGranularity;
+	m_stats.bytesUsed += blockSize;
+
+	if (m_freeLists[index])
+	{
+		b2ArenaBlock* block = m_freeLists[index];
+		m_freeLists[index] = block->next;
+		return block;
+	}
+
+	// The remainder of a full page is left unused. At most one maximum sized
+	// block is lost per page.
+	if (m_remaining < blockSize)
+	{
+		AddPage();
+	}
+
+	void* block = m_cursor;
+	m_cursor += blockSize;
+	m_remaining -= blockSize;
+	return block;
+}
+
+void b2ArenaAllocator::Free(void* p, int32 size)
+{
+	if (size == 0)
+	{
+		return;
+	}
+
+	b2Assert(0 < size);
+	b2Assert(m_stats.allocationCount > 0);
+
+	--m_stats.allocationCount;
+
+	if (size > b2_arenaMaxBlockSize)
+	{
+		m_stats.bytesUsed -= size;
+		m_stats.bytesReserved -= size;
+		b2Free(p);
+		return;
+	}
+
+	int32 index = (size - 1) / b2_arenaGranularity;
+	int32 blockSize = (index + 1) * b2_arenaGranularity;
+	m_stats.bytesUsed -= blockSize;
+
+#ifdef _DEBUG
+	memset(p, 0xfd, blockSize);
+#endif
+
+	b2ArenaBlock* block = (b2ArenaBlock*)p;
+	block->next = m_freeLists[index];
+	m_freeLists[index] = block;
+}
+
+void b2ArenaAllocator::Reset()
+{
+	b2Assert(m_stats.allocationCount == 0);
+
+	while (m_pages)
+	{
+		b2ArenaPage* page = m_pages;
+		m_pages = page->next;
+		b2Free(page);
+	}
+
+	m_cursor = NULL;
+	m_remaining = 0;
+
+	memset(m_freeLists, 0, sizeof(m_freeLists));
+	memset(&m_stats, 0, sizeof(m_stats));
+}
+
+void b2ArenaAllocator::GetStats(b2AllocatorStats* stats) const
+{
+	*stats = m_stats;
+}
@@ -0,0 +1,68 @@
+/*
+* Copyright (c) 2006-2009 Erin Catto http://www.box2d.org
+*
+* This software is provided 'as-is', without any express or implied
+* warranty.  In no event will the authors be held liable for any damages
+* arising from the use of this software.
+* Permission is granted to anyone to use this software for any purpose,
+* including commercial applications, and to alter it and redistribute it
+* freely, subject to the following restrictions:
+* 1. The origin of this software must not be misrepresented; you must not
+* claim that you wrote the original software. If you use this software
+* in a product, an acknowledgment in the product documentation would be
+* appreciated but is not required.
+* 2. Altered source versions must be plainly marked as such, and must not be
+* misrepresented as being the original software.
+* 3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef B2_ARENA_ALLOCATOR_H
+#define B2_ARENA_ALLOCATOR_H
+
+#include <Box2D/Common/b2Allocator.h>
+
+const int32 b2_arenaPageSize = 64 * 1024;
+const int32 b2_arenaGranularity = 16;
+const int32 b2_arenaMaxBlockSize = 640;
+const int32 b2_arenaSizeClasses = b2_arenaMaxBlockSize / b2_arenaGranularity;
+
+struct b2ArenaPage;
+struct b2ArenaBlock;
+
+/// This is a small object allocator that carves blocks of any multiple of
+/// 16 bytes from large pages. Unlike b2BlockAllocator the blocks of all
+/// sizes share the same pages so objects allocated together stay together,
+/// and the pages can be given back to the heap wholesale with Reset.
+class b2ArenaAllocator : public b2Allocator
+{
+public:
+	b2ArenaAllocator(int32 pageSize = b2_arenaPageSize);
+	~b2ArenaAllocator();
+
+	/// Allocate memory. This will use b2Alloc if the size is larger than b2_arenaMaxBlockSize.
+	void* Allocate(int32 size);
+
+	/// Free memory. This will use b2Free if the size is larger than b2_arenaMaxBlockSize.
+	void Free(void* p, int32 size);
+
+	/// Give every page back to the heap. Everything allocated must have been freed.
+	void Reset();
+
+	/// Get the memory statistics.
+	void GetStats(b2AllocatorStats* stats) const;
+
+private:
+
+	void AddPage();
+
+	int32 m_pageSize;
+	b2ArenaPage* m_pages;
+	int8* m_cursor;
+	int32 m_remaining;
+
+	b2ArenaBlock* m_freeLists[b2_arenaSizeClasses];
+
+	b2AllocatorStats m_stats;
+};
+
+#endif
@@ -64,6 +64,7 @@ b2BlockAllocator::b2BlockAllocator()
 	
 	memset(m_chunks, 0, m_chunkSpace * sizeof(b2Chunk));
 	memset(m_freeLists, 0, sizeof(m_freeLists));
+	memset(&m_stats, 0, sizeof(m_stats));
 
 	if (s_blockSizeLookupInitialized == false)
 	{
@@ -103,14 +104,20 @@ void* b2BlockAllocator::Allocate(int32 size)
 
 	b2Assert(0 < size);
 
+	++m_stats.allocationCount;
+
 	if (size > b2_maxBlockSize)
 	{
+		m_stats.bytesUsed += size;
+		m_stats.bytesReserved += size;
 		return b2Alloc(size);
 	}
 
 	int32 index = s_blockSizeLookup[size];
 	b2Assert(0 <= index && index < b2_blockSizes);
 
+	m_stats.bytesUsed += s_blockSizes[index];
+
 	if (m_freeLists[index])
 	{
 		b2Block* block = m_freeLists[index];
@@ -131,6 +138,7 @@ void* b2BlockAllocator::Allocate(int32 size)
 
 		b2Chunk* chunk = m_chunks + m_chunkCount;
 		chunk->blocks = (b2Block*)b2Alloc(b2_chunkSize);
+		m_stats.bytesReserved += b2_chunkSize;
 #if defined(_DEBUG)
 		memset(chunk->blocks, 0xcd, b2_chunkSize);
 #endif
@@ -163,8 +171,12 @@ void b2BlockAllocator::Free(void* p, int32 size)
 
 	b2Assert(0 < size);
 
+	--m_stats.allocationCount;
+
 	if (size > b2_maxBlockSize)
 	{
+		m_stats.bytesUsed -= size;
+		m_stats.bytesReserved -= size;
 		b2Free(p);
 		return;
 	}
@@ -172,6 +184,8 @@ void b2BlockAllocator::Free(void* p, int32 size)
 	int32 index = s_blockSizeLookup[size];
 	b2Assert(0 <= index && index < b2_blockSizes);
 
+	m_stats.bytesUsed -= s_blockSizes[index];
+
 #ifdef _DEBUG
 	// Verify the memory address and size is valid.
 	int32 blockSize = s_blockSizes[index];
@@ -214,4 +228,10 @@ void b2BlockAllocator::Clear()
 	memset(m_chunks, 0, m_chunkSpace * sizeof(b2Chunk));
 
 	memset(m_freeLists, 0, sizeof(m_freeLists));
+	memset(&m_stats, 0, sizeof(m_stats));
+}
+
+void b2BlockAllocator::GetStats(b2AllocatorStats* stats) const
+{
+	*stats = m_stats;
 }
@@ -19,7 +19,7 @@
 #ifndef B2_BLOCK_ALLOCATOR_H
 #define B2_BLOCK_ALLOCATOR_H
 
-#include <Box2D/Common/b2Settings.h>
+#include <Box2D/Common/b2Allocator.h>
 
 const int32 b2_chunkSize = 16 * 1024;
 const int32 b2_maxBlockSize = 640;
@@ -32,7 +32,7 @@ struct b2Chunk;
 /// This is a small object allocator used for allocating small
 /// objects that persist for more than one time step.
 /// See: http://www.codeproject.com/useritems/Small_Block_Allocator.asp
-class b2BlockAllocator
+class b2BlockAllocator : public b2Allocator
 {
 public:
 	b2BlockAllocator();
@@ -46,6 +46,9 @@ public:
 
 	void Clear();
 
+	/// Get the memory statistics.
+	void GetStats(b2AllocatorStats* stats) const;
+
 private:
 
 	b2Chunk* m_chunks;
@@ -54,6 +57,8 @@ private:
 
 	b2Block* m_freeLists[b2_blockSizes];
 
+	b2AllocatorStats m_stats;
+
 	static int32 s_blockSizes[b2_blockSizes];
 	static uint8 s_blockSizeLookup[b2_maxBlockSize + 1];
 	static bool s_blockSizeLookupInitialized;
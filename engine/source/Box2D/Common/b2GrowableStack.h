@@ -74,6 +74,19 @@ public:
 		return m_count;
 	}
 
+	const T& Get(int32 index) const
+	{
+		b2Assert(0 <= index && index < m_count);
+		return m_stack[index];
+	}
+
+	/// Discard the elements above the specified count.
+	void Truncate(int32 count)
+	{
+		b2Assert(0 <= count && count <= m_count);
+		m_count = count;
+	}
+
 private:
 	T* m_stack;
 	T m_array[N];
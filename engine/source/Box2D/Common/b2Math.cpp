@@ -20,6 +20,142 @@
 
 const b2Vec2 b2Vec2_zero(0.0f, 0.0f);
 
+static void b2DotVerticesScalar(const float32* d, const float32* vertices, uint32 count, float32* dots)
+{
+	for (uint32 i = 0; i < count; ++i)
+	{
+		dots[i] = vertices[2 * i + 0] * d[0] + vertices[2 * i + 1] * d[1];
+	}
+}
+
+void (*b2DotVertices)(const float32* d, const float32* vertices, uint32 count, float32* dots) = b2DotVerticesScalar;
+
+#ifdef B2_DETERMINISTIC
+
+// These are evaluated in double precision using only correctly rounded operations
+// (add, multiply, divide, floor and ldexp) so every conforming platform produces the
+// same bits. The polynomials are truncated series that are exact to float precision
+// over the reduced ranges.
+
+static const float64 b2_detPi = 3.14159265358979323846;
+static const float64 b2_detHalfPi = 1.57079632679489661923;
+static const float64 b2_detQuarterPi = 0.78539816339744830962;
+
+static void b2DeterministicSinCos(float32 angle, float32* s, float32* c)
+{
+	// Reduce to [-pi/4, pi/4] using a two part pi/2 so the reduction is exact for large quadrants.
+	float64 x = angle;
+	float64 q = std::floor(x * 0.63661977236758134308 + 0.5);
+	float64 r = (x - q * 1.57079632673412561417) - q * 6.07710050650619224932e-11;
+	int32 quadrant = (int32)(q - 4.0 * std::floor(q * 0.25));
+
+	float64 r2 = r * r;
+	float64 sr = r + r * r2 * (-1.0 / 6.0 + r2 * (1.0 / 120.0 + r2 * (-1.0 / 5040.0 + r2 * (1.0 / 362880.0 + r2 * (-1.0 / 39916800.0)))));
+	float64 cr = 1.0 + r2 * (-0.5 + r2 * (1.0 / 24.0 + r2 * (-1.0 / 720.0 + r2 * (1.0 / 40320.0 + r2 * (-1.0 / 3628800.0 + r2 * (1.0 / 479001600.0))))));
+
+	switch (quadrant)
+	{
+	case 0:		*s = (float32)sr;	*c = (float32)cr;	break;
+	case 1:		*s = (float32)cr;	*c = (float32)-sr;	break;
+	case 2:		*s = (float32)-sr;	*c = (float32)-cr;	break;
+	default:	*s = (float32)-cr;	*c = (float32)sr;	break;
+	}
+}
+
+float32 b2DeterministicSin(float32 angle)
+{
+	float32 s, c;
+	b2DeterministicSinCos(angle, &s, &c);
+	return s;
+}
+
+float32 b2DeterministicCos(float32 angle)
+{
+	float32 s, c;
+	b2DeterministicSinCos(angle, &s, &c);
+	return c;
+}
+
+float32 b2DeterministicAtan2(float32 y, float32 x)
+{
+	float64 ax = x < 0.0f ? -(float64)x : (float64)x;
+	float64 ay = y < 0.0f ? -(float64)y : (float64)y;
+	if (ax == 0.0 && ay == 0.0)
+	{
+		return 0.0f;
+	}
+
+	// Reduce to the first octant.
+	bool swap = ay > ax;
+	float64 t = swap ? ax / ay : ay / ax;
+
+	// Reduce to |t| <= tan(pi/8) so the series converges quickly.
+	float64 offset = 0.0;
+	if (t > 0.41421356237309504880)
+	{
+		t = (t - 1.0) / (t + 1.0);
+		offset = b2_detQuarterPi;
+	}
+
+	float64 t2 = t * t;
+	float64 p = 1.0 / 23.0;
+	p = 1.0 / 21.0 - t2 * p;
+	p = 1.0 / 19.0 - t2 * p;
+	p = 1.0 / 17.0 - t2 * p;
+	p = 1.0 / 15.0 - t2 * p;
+	p = 1.0 / 13.0 - t2 * p;
+	p = 1.0 / 11.0 - t2 * p;
+	p = 1.0 / 9.0 - t2 * p;
+	p = 1.0 / 7.0 - t2 * p;
+	p = 1.0 / 5.0 - t2 * p;
+	p = 1.0 / 3.0 - t2 * p;
+	p = 1.0 - t2 * p;
+	float64 a = offset + t * p;
+
+	// Restore the octant.
+	if (swap)
+	{
+		a = b2_detHalfPi - a;
+	}
+	if (x < 0.0f)
+	{
+		a = b2_detPi - a;
+	}
+	if (y < 0.0f)
+	{
+		a = -a;
+	}
+
+	return (float32)a;
+}
+
+float32 b2DeterministicExp(float32 x)
+{
+	// Clamp to where the float result saturates so the exponent always fits.
+	float64 v = b2Clamp((float64)x, -150.0, 150.0);
+
+	// Reduce to [-ln2/2, ln2/2] using a two part ln2.
+	float64 k = std::floor(v * 1.44269504088896340736 + 0.5);
+	float64 r = (v - k * 6.93147180369123816490e-01) - k * 1.90821492927058770002e-10;
+
+	float64 p = 1.0 / 39916800.0;
+	p = 1.0 / 3628800.0 + r * p;
+	p = 1.0 / 362880.0 + r * p;
+	p = 1.0 / 40320.0 + r * p;
+	p = 1.0 / 5040.0 + r * p;
+	p = 1.0 / 720.0 + r * p;
+	p = 1.0 / 120.0 + r * p;
+	p = 1.0 / 24.0 + r * p;
+	p = 1.0 / 6.0 + r * p;
+	p = 0.5 + r * p;
+	p = 1.0 + r * p;
+	p = 1.0 + r * p;
+
+	return (float32)std::ldexp(p, (int32)k);
+}
+
+#endif // B2_DETERMINISTIC
+
 /// Solve A * x = b, where b is a column vector. This is more efficient
 /// than computing the inverse in one-shot cases.
 b2Vec3 b2Mat33::Solve33(const b2Vec3& b) const
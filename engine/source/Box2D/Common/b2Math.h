@@ -58,7 +58,24 @@ inline float32 b2InvSqrt(float32 x)
 }
 
 #define	b2Sqrt(x)	std::sqrt(x)
+
+#ifdef B2_DETERMINISTIC
+/// Platform independent trig built only from IEEE basic operations.
+float32 b2DeterministicSin(float32 angle);
+float32 b2DeterministicCos(float32 angle);
+float32 b2DeterministicAtan2(float32 y, float32 x);
+float32 b2DeterministicExp(float32 x);
+
+#define	b2Sin(x)	b2DeterministicSin(x)
+#define	b2Cos(x)	b2DeterministicCos(x)
+#define	b2Atan2(y, x)	b2DeterministicAtan2(y, x)
+#define	b2Exp(x)	b2DeterministicExp(x)
+#else
+#define	b2Sin(x)	sinf(x)
+#define	b2Cos(x)	cosf(x)
 #define	b2Atan2(y, x)	std::atan2(y, x)
+#define	b2Exp(x)	expf(x)
+#endif
 
 /// A 2D column vector.
 struct b2Vec2
@@ -315,16 +332,16 @@ struct b2Rot
 	explicit b2Rot(float32 angle)
 	{
 		/// TODO_ERIN optimize
-		s = sinf(angle);
-		c = cosf(angle);
+		s = b2Sin(angle);
+		c = b2Cos(angle);
 	}
 
 	/// Set using an angle in radians.
 	void Set(float32 angle)
 	{
 		/// TODO_ERIN optimize
-		s = sinf(angle);
-		c = cosf(angle);
+		s = b2Sin(angle);
+		c = b2Cos(angle);
 	}
 
 	/// Set to the identity rotation
@@ -728,4 +745,9 @@ inline void b2Sweep::Normalize()
 	a -= d;
 }
 
+/// Computes dots[i] = b2Dot(vertices[i], d) for tightly packed vertices. This is the inner loop
+/// of the narrow-phase support searches so the host can install a vectorised version, which must
+/// round exactly like the scalar default so results do not depend on the CPU.
+extern void (*b2DotVertices)(const float32* d, const float32* vertices, uint32 count, float32* dots);
+
 #endif
@@ -38,6 +38,27 @@ typedef double float64;
 #define	b2_epsilon		FLT_EPSILON
 #define b2_pi			3.14159265359f
 
+/// Define B2_DETERMINISTIC (or TORQUE_PHYSICS_DETERMINISTIC) to make stepping bit-reproducible
+/// across platforms. This replaces the C runtime trig with a version built only from IEEE
+/// basic operations and requires SSE2 (not x87) float evaluation without FMA contraction.
+/// GCC ignores the contraction pragma so it must also be built with -ffp-contract=off.
+#if defined(TORQUE_PHYSICS_DETERMINISTIC) && !defined(B2_DETERMINISTIC)
+#define B2_DETERMINISTIC
+#endif
+
+#ifdef B2_DETERMINISTIC
+#if defined(_M_IX86) && (!defined(_M_IX86_FP) || _M_IX86_FP < 2)
+#error "B2_DETERMINISTIC requires SSE2 float evaluation (/arch:SSE2)."
+#elif defined(__i386__) && !defined(__SSE2_MATH__)
+#error "B2_DETERMINISTIC requires SSE2 float evaluation (-msse2 -mfpmath=sse)."
+#endif
+#if defined(_MSC_VER)
+#pragma fp_contract(off)
+#elif defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#endif
+#endif
+
 /// @file
 /// Global tuning constants based on meters-kilograms-seconds (MKS) units.
 ///
@@ -78,12 +99,26 @@ typedef double float64;
 /// Maximum number of sub-steps per contact in continuous physics simulation.
 #define b2_maxSubSteps			8
 
+/// The number of bins used when rebuilding the dynamic tree top-down.
+#define b2_treeBinCount			16
+
+/// A dynamic tree refit in bulk is rebuilt once its area ratio grows by this factor
+/// since it was last rebuilt.
+#define b2_treeRebuildRatio		1.5f
+
 
 // Dynamics
 
 /// Maximum number of contacts to be handled to solve a TOI impact.
 #define b2_maxTOIContacts			32
 
+/// Maximum number of islands solved together when a parallel executor is registered.
+/// Each of these islands owns a stack allocator so this controls the memory used.
+#define b2_maxParallelIslands		8
+
+/// Number of contacts that make up one item of work when contacts are updated concurrently.
+#define b2_parallelContactBlock		64
+
 /// A velocity threshold for elastic collisions. Any collision with a relative linear
 /// velocity below this threshold will be treated as inelastic.
 #define b2_velocityThreshold		1.0f
@@ -28,7 +28,7 @@ class b2Body;
 class b2Contact;
 class b2Fixture;
 class b2World;
-class b2BlockAllocator;
+class b2Allocator;
 class b2StackAllocator;
 class b2ContactListener;
 
@@ -48,8 +48,8 @@ inline float32 b2MixRestitution(float32 restitution1, float32 restitution2)
 
 typedef b2Contact* b2ContactCreateFcn(	b2Fixture* fixtureA, int32 indexA,
 										b2Fixture* fixtureB, int32 indexB,
-										b2BlockAllocator* allocator);
-typedef void b2ContactDestroyFcn(b2Contact* contact, b2BlockAllocator* allocator);
+										b2Allocator* allocator);
+typedef void b2ContactDestroyFcn(b2Contact* contact, b2Allocator* allocator);
 
 struct b2ContactRegister
 {
@@ -179,9 +179,9 @@ protected:
 	static void AddType(b2ContactCreateFcn* createFcn, b2ContactDestroyFcn* destroyFcn,
 						b2Shape::Type typeA, b2Shape::Type typeB);
 	static void InitializeRegisters();
-	static b2Contact* Create(b2Fixture* fixtureA, int32 indexA, b2Fixture* fixtureB, int32 indexB, b2BlockAllocator* allocator);
-	static void Destroy(b2Contact* contact, b2Shape::Type typeA, b2Shape::Type typeB, b2BlockAllocator* allocator);
-	static void Destroy(b2Contact* contact, b2BlockAllocator* allocator);
+	static b2Contact* Create(b2Fixture* fixtureA, int32 indexA, b2Fixture* fixtureB, int32 indexB, b2Allocator* allocator);
+	static void Destroy(b2Contact* contact, b2Shape::Type typeA, b2Shape::Type typeB, b2Allocator* allocator);
+	static void Destroy(b2Contact* contact, b2Allocator* allocator);
 
 	b2Contact() : m_fixtureA(NULL), m_fixtureB(NULL) {}
 	b2Contact(b2Fixture* fixtureA, int32 indexA, b2Fixture* fixtureB, int32 indexB);
@@ -189,6 +189,12 @@ protected:
 
 	void Update(b2ContactListener* listener);
 
+	// Update() split in two so manifolds can be computed concurrently. UpdateManifold only
+	// reads shared state and returns whether the shapes are touching. CommitManifold applies
+	// the results, wakes the bodies and reports to the listener.
+	bool UpdateManifold(b2Manifold* manifold);
+	void CommitManifold(const b2Manifold& manifold, bool touching, b2ContactListener* listener);
+
 	static b2ContactRegister s_registers[b2Shape::e_typeCount][b2Shape::e_typeCount];
 	static bool s_initialized;
 
@@ -258,3 +258,13 @@ void b2DistanceJoint::Dump()
 	b2Log("  jd.dampingRatio = %.15lef;\n", m_dampingRatio);
 	b2Log("  joints[%d] = m_world->CreateJoint(&jd);\n", m_index);
 }
+
+void b2DistanceJoint::SaveWarmStart(b2JointWarmStart* warmStart) const
+{
+	warmStart->impulse[0] = m_impulse;
+}
+
+void b2DistanceJoint::LoadWarmStart(const b2JointWarmStart& warmStart)
+{
+	m_impulse = warmStart.impulse[0];
+}
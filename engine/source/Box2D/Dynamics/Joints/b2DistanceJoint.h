@@ -110,6 +110,9 @@ protected:
 	void SolveVelocityConstraints(const b2SolverData& data);
 	bool SolvePositionConstraints(const b2SolverData& data);
 
+	void SaveWarmStart(b2JointWarmStart* warmStart) const;
+	void LoadWarmStart(const b2JointWarmStart& warmStart);
+
 	float32 m_frequencyHz;
 	float32 m_dampingRatio;
 	float32 m_bias;
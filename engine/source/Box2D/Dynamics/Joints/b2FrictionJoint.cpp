@@ -249,3 +249,17 @@ void b2FrictionJoint::Dump()
 	b2Log("  jd.maxTorque = %.15lef;\n", m_maxTorque);
 	b2Log("  joints[%d] = m_world->CreateJoint(&jd);\n", m_index);
 }
+
+void b2FrictionJoint::SaveWarmStart(b2JointWarmStart* warmStart) const
+{
+	warmStart->impulse[0] = m_linearImpulse.x;
+	warmStart->impulse[1] = m_linearImpulse.y;
+	warmStart->impulse[2] = m_angularImpulse;
+}
+
+void b2FrictionJoint::LoadWarmStart(const b2JointWarmStart& warmStart)
+{
+	m_linearImpulse.x = warmStart.impulse[0];
+	m_linearImpulse.y = warmStart.impulse[1];
+	m_angularImpulse = warmStart.impulse[2];
+}
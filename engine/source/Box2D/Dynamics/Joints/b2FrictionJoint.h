@@ -92,6 +92,9 @@ protected:
 	void SolveVelocityConstraints(const b2SolverData& data);
 	bool SolvePositionConstraints(const b2SolverData& data);
 
+	void SaveWarmStart(b2JointWarmStart* warmStart) const;
+	void LoadWarmStart(const b2JointWarmStart& warmStart);
+
 	b2Vec2 m_localAnchorA;
 	b2Vec2 m_localAnchorB;
 
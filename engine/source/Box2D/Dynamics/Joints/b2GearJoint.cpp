@@ -417,3 +417,13 @@ void b2GearJoint::Dump()
 	b2Log("  jd.ratio = %.15lef;\n", m_ratio);
 	b2Log("  joints[%d] = m_world->CreateJoint(&jd);\n", m_index);
 }
+
+void b2GearJoint::SaveWarmStart(b2JointWarmStart* warmStart) const
+{
+	warmStart->impulse[0] = m_impulse;
+}
+
+void b2GearJoint::LoadWarmStart(const b2JointWarmStart& warmStart)
+{
+	m_impulse = warmStart.impulse[0];
+}
@@ -84,6 +84,9 @@ protected:
 	void SolveVelocityConstraints(const b2SolverData& data);
 	bool SolvePositionConstraints(const b2SolverData& data);
 
+	void SaveWarmStart(b2JointWarmStart* warmStart) const;
+	void LoadWarmStart(const b2JointWarmStart& warmStart);
+
 	b2Joint* m_joint1;
 	b2Joint* m_joint2;
 
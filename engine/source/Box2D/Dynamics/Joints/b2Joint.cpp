@@ -30,11 +30,11 @@
 #include <Box2D/Dynamics/Joints/b2MotorJoint.h>
 #include <Box2D/Dynamics/b2Body.h>
 #include <Box2D/Dynamics/b2World.h>
-#include <Box2D/Common/b2BlockAllocator.h>
+#include <Box2D/Common/b2Allocator.h>
 
 #include <new>
 
-b2Joint* b2Joint::Create(const b2JointDef* def, b2BlockAllocator* allocator)
+b2Joint* b2Joint::Create(const b2JointDef* def, b2Allocator* allocator)
 {
 	b2Joint* joint = NULL;
 
@@ -125,7 +125,7 @@ b2Joint* b2Joint::Create(const b2JointDef* def, b2BlockAllocator* allocator)
 	return joint;
 }
 
-void b2Joint::Destroy(b2Joint* joint, b2BlockAllocator* allocator)
+void b2Joint::Destroy(b2Joint* joint, b2Allocator* allocator)
 {
 	joint->~b2Joint();
 	switch (joint->m_type)
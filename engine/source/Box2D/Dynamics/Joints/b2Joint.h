@@ -24,7 +24,7 @@
 class b2Body;
 class b2Joint;
 struct b2SolverData;
-class b2BlockAllocator;
+class b2Allocator;
 
 enum b2JointType
 {
@@ -70,6 +70,14 @@ struct b2JointEdge
 	b2JointEdge* next;		///< the next joint edge in the body's joint list
 };
 
+/// The solver state a joint carries from one step to the next. Impulses
+/// that a joint type doesn't use are left at zero.
+struct b2JointWarmStart
+{
+	float32 impulse[4];
+	int32 state;
+};
+
 /// Joint definitions are used to construct joints.
 struct b2JointDef
 {
@@ -155,8 +163,8 @@ protected:
 	friend class b2Island;
 	friend class b2GearJoint;
 
-	static b2Joint* Create(const b2JointDef* def, b2BlockAllocator* allocator);
-	static void Destroy(b2Joint* joint, b2BlockAllocator* allocator);
+	static b2Joint* Create(const b2JointDef* def, b2Allocator* allocator);
+	static void Destroy(b2Joint* joint, b2Allocator* allocator);
 
 	b2Joint(const b2JointDef* def);
 	virtual ~b2Joint() {}
@@ -167,6 +175,10 @@ protected:
 	// This returns true if the position errors are within tolerance.
 	virtual bool SolvePositionConstraints(const b2SolverData& data) = 0;
 
+	// Save and load the solver state carried between steps (used by world snapshots).
+	virtual void SaveWarmStart(b2JointWarmStart* warmStart) const { B2_NOT_USED(warmStart); }
+	virtual void LoadWarmStart(const b2JointWarmStart& warmStart) { B2_NOT_USED(warmStart); }
+
 	b2JointType m_type;
 	b2Joint* m_prev;
 	b2Joint* m_next;
@@ -101,6 +101,9 @@ protected:
 	void SolveVelocityConstraints(const b2SolverData& data);
 	bool SolvePositionConstraints(const b2SolverData& data);
 
+	void SaveWarmStart(b2JointWarmStart* warmStart) const;
+	void LoadWarmStart(const b2JointWarmStart& warmStart);
+
 	// Solver shared
 	b2Vec2 m_linearOffset;
 	float32 m_angularOffset;
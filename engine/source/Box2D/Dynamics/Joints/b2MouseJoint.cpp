@@ -220,3 +220,15 @@ void b2MouseJoint::ShiftOrigin(const b2Vec2& newOrigin)
 {
 	m_targetA -= newOrigin;
 }
+
+void b2MouseJoint::SaveWarmStart(b2JointWarmStart* warmStart) const
+{
+	warmStart->impulse[0] = m_impulse.x;
+	warmStart->impulse[1] = m_impulse.y;
+}
+
+void b2MouseJoint::LoadWarmStart(const b2JointWarmStart& warmStart)
+{
+	m_impulse.x = warmStart.impulse[0];
+	m_impulse.y = warmStart.impulse[1];
+}
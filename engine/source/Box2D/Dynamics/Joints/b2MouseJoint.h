@@ -93,7 +93,7 @@ public:
 	void Dump() { b2Log("Mouse joint dumping is not supported.\n"); }
 
 	/// Implement b2Joint::ShiftOrigin
-	void ShiftOrigin(const b2Vec2& newOrigin);
+	void ShiftOrigin(const b2Vec2& newOrigin);
 
 protected:
 	friend class b2Joint;
@@ -104,6 +104,9 @@ protected:
 	void SolveVelocityConstraints(const b2SolverData& data);
 	bool SolvePositionConstraints(const b2SolverData& data);
 
+	void SaveWarmStart(b2JointWarmStart* warmStart) const;
+	void LoadWarmStart(const b2JointWarmStart& warmStart);
+
 	b2Vec2 m_localAnchorB;
 	b2Vec2 m_targetA;
 	float32 m_frequencyHz;
@@ -346,3 +346,13 @@ void b2PulleyJoint::ShiftOrigin(const b2Vec2& newOrigin)
 	m_groundAnchorA -= newOrigin;
 	m_groundAnchorB -= newOrigin;
 }
+
+void b2PulleyJoint::SaveWarmStart(b2JointWarmStart* warmStart) const
+{
+	warmStart->impulse[0] = m_impulse;
+}
+
+void b2PulleyJoint::LoadWarmStart(const b2JointWarmStart& warmStart)
+{
+	m_impulse = warmStart.impulse[0];
+}
@@ -500,3 +500,21 @@ void b2RevoluteJoint::Dump()
 	b2Log("  jd.maxMotorTorque = %.15lef;\n", m_maxMotorTorque);
 	b2Log("  joints[%d] = m_world->CreateJoint(&jd);\n", m_index);
 }
+
+void b2RevoluteJoint::SaveWarmStart(b2JointWarmStart* warmStart) const
+{
+	warmStart->impulse[0] = m_impulse.x;
+	warmStart->impulse[1] = m_impulse.y;
+	warmStart->impulse[2] = m_impulse.z;
+	warmStart->impulse[3] = m_motorImpulse;
+	warmStart->state = m_limitState;
+}
+
+void b2RevoluteJoint::LoadWarmStart(const b2JointWarmStart& warmStart)
+{
+	m_impulse.x = warmStart.impulse[0];
+	m_impulse.y = warmStart.impulse[1];
+	m_impulse.z = warmStart.impulse[2];
+	m_motorImpulse = warmStart.impulse[3];
+	m_limitState = (b2LimitState)warmStart.state;
+}
@@ -239,3 +239,15 @@ void b2RopeJoint::Dump()
 	b2Log("  jd.maxLength = %.15lef;\n", m_maxLength);
 	b2Log("  joints[%d] = m_world->CreateJoint(&jd);\n", m_index);
 }
+
+void b2RopeJoint::SaveWarmStart(b2JointWarmStart* warmStart) const
+{
+	warmStart->impulse[0] = m_impulse;
+	warmStart->state = m_state;
+}
+
+void b2RopeJoint::LoadWarmStart(const b2JointWarmStart& warmStart)
+{
+	m_impulse = warmStart.impulse[0];
+	m_state = (b2LimitState)warmStart.state;
+}
@@ -326,3 +326,17 @@ void b2WeldJoint::Dump()
 	b2Log("  jd.dampingRatio = %.15lef;\n", m_dampingRatio);
 	b2Log("  joints[%d] = m_world->CreateJoint(&jd);\n", m_index);
 }
+
+void b2WeldJoint::SaveWarmStart(b2JointWarmStart* warmStart) const
+{
+	warmStart->impulse[0] = m_impulse.x;
+	warmStart->impulse[1] = m_impulse.y;
+	warmStart->impulse[2] = m_impulse.z;
+}
+
+void b2WeldJoint::LoadWarmStart(const b2JointWarmStart& warmStart)
+{
+	m_impulse.x = warmStart.impulse[0];
+	m_impulse.y = warmStart.impulse[1];
+	m_impulse.z = warmStart.impulse[2];
+}
@@ -417,3 +417,17 @@ void b2WheelJoint::Dump()
 	b2Log("  jd.dampingRatio = %.15lef;\n", m_dampingRatio);
 	b2Log("  joints[%d] = m_world->CreateJoint(&jd);\n", m_index);
 }
+
+void b2WheelJoint::SaveWarmStart(b2JointWarmStart* warmStart) const
+{
+	warmStart->impulse[0] = m_impulse;
+	warmStart->impulse[1] = m_motorImpulse;
+	warmStart->impulse[2] = m_springImpulse;
+}
+
+void b2WheelJoint::LoadWarmStart(const b2JointWarmStart& warmStart)
+{
+	m_impulse = warmStart.impulse[0];
+	m_motorImpulse = warmStart.impulse[1];
+	m_springImpulse = warmStart.impulse[2];
+}
@@ -37,6 +37,10 @@ b2Body::b2Body(const b2BodyDef* bd, b2World* world)
 	{
 		m_flags |= e_bulletFlag;
 	}
+	if (bd->bulletStaticOnly)
+	{
+		m_flags |= e_bulletStaticFlag;
+	}
 	if (bd->fixedRotation)
 	{
 		m_flags |= e_fixedRotationFlag;
@@ -171,7 +175,7 @@ b2Fixture* b2Body::CreateFixture(const b2FixtureDef* def)
 		return NULL;
 	}
 
-	b2BlockAllocator* allocator = &m_world->m_blockAllocator;
+	b2Allocator* allocator = m_world->m_allocator;
 
 	void* memory = allocator->Allocate(sizeof(b2Fixture));
 	b2Fixture* fixture = new (memory) b2Fixture;
@@ -258,7 +262,7 @@ void b2Body::DestroyFixture(b2Fixture* fixture)
 		}
 	}
 
-	b2BlockAllocator* allocator = &m_world->m_blockAllocator;
+	b2Allocator* allocator = m_world->m_allocator;
 
 	if (m_flags & e_activeFlag)
 	{
@@ -537,6 +541,7 @@ void b2Body::Dump()
 	b2Log("  bd.awake = bool(%d);\n", m_flags & e_awakeFlag);
 	b2Log("  bd.fixedRotation = bool(%d);\n", m_flags & e_fixedRotationFlag);
 	b2Log("  bd.bullet = bool(%d);\n", m_flags & e_bulletFlag);
+	b2Log("  bd.bulletStaticOnly = bool(%d);\n", m_flags & e_bulletStaticFlag);
 	b2Log("  bd.active = bool(%d);\n", m_flags & e_activeFlag);
 	b2Log("  bd.gravityScale = %.15lef;\n", m_gravityScale);
 	b2Log("  bodies[%d] = m_world->CreateBody(&bd);\n", m_islandIndex);
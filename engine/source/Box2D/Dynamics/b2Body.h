@@ -64,6 +64,7 @@ struct b2BodyDef
 		awake = true;
 		fixedRotation = false;
 		bullet = false;
+		bulletStaticOnly = false;
 		type = b2_staticBody;
 		active = true;
 		gravityScale = 1.0f;
@@ -112,6 +113,11 @@ struct b2BodyDef
 	/// @warning You should use this flag sparingly since it increases processing time.
 	bool bullet;
 
+	/// Should continuous collision for this body only be computed against static bodies?
+	/// This overrides the bullet setting and also skips kinematic bodies. Useful for
+	/// large numbers of fast debris that only needs to be kept out of the level geometry.
+	bool bulletStaticOnly;
+
 	/// Does this body start out active?
 	bool active;
 
@@ -311,6 +317,12 @@ public:
 	/// Is this body treated like a bullet for continuous collision detection?
 	bool IsBullet() const;
 
+	/// Should continuous collision detection for this body only consider static bodies?
+	void SetBulletStaticOnly(bool flag);
+
+	/// Does continuous collision detection for this body only consider static bodies?
+	bool IsBulletStaticOnly() const;
+
 	/// You can disable sleeping on this body. If you disable sleeping, the
 	/// body will be woken.
 	void SetSleepingAllowed(bool flag);
@@ -412,7 +424,8 @@ private:
 		e_bulletFlag		= 0x0008,
 		e_fixedRotationFlag	= 0x0010,
 		e_activeFlag		= 0x0020,
-		e_toiFlag			= 0x0040
+		e_toiFlag			= 0x0040,
+		e_bulletStaticFlag	= 0x0080
 	};
 
 	b2Body(const b2BodyDef* bd, b2World* world);
@@ -630,6 +643,23 @@ inline bool b2Body::IsBullet() const
 	return (m_flags & e_bulletFlag) == e_bulletFlag;
 }
 
+inline void b2Body::SetBulletStaticOnly(bool flag)
+{
+	if (flag)
+	{
+		m_flags |= e_bulletStaticFlag;
+	}
+	else
+	{
+		m_flags &= ~e_bulletStaticFlag;
+	}
+}
+
+inline bool b2Body::IsBulletStaticOnly() const
+{
+	return (m_flags & e_bulletStaticFlag) == e_bulletStaticFlag;
+}
+
 inline void b2Body::SetAwake(bool flag)
 {
 	if (flag)
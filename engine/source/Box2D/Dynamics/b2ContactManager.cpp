@@ -32,6 +32,19 @@ b2ContactManager::b2ContactManager()
 	m_contactFilter = &b2_defaultFilter;
 	m_contactListener = &b2_defaultListener;
 	m_allocator = NULL;
+	m_parallelExecutor = NULL;
+
+	m_updates = NULL;
+	m_updateCount = 0;
+	m_updateCapacity = 0;
+}
+
+b2ContactManager::~b2ContactManager()
+{
+	if (m_updates)
+	{
+		b2Free(m_updates);
+	}
 }
 
 void b2ContactManager::Destroy(b2Contact* c)
@@ -104,69 +117,159 @@ void b2ContactManager::Destroy(b2Contact* c)
 // contact list.
 void b2ContactManager::Collide()
 {
+	// Too few contacts are not worth splitting.
+	if (m_parallelExecutor && m_contactCount > b2_parallelContactBlock)
+	{
+		CollideParallel();
+		return;
+	}
+
 	// Update awake contacts.
 	b2Contact* c = m_contactList;
 	while (c)
 	{
+		b2Contact* next = c->GetNext();
+		CollideContact(c);
+		c = next;
+	}
+}
+
+void b2ContactManager::CollideParallel()
+{
+	// Grow the updates.
+	if (m_contactCount > m_updateCapacity)
+	{
+		if (m_updates)
+		{
+			b2Free(m_updates);
+		}
+
+		m_updateCapacity = b2Max(2 * m_updateCapacity, m_contactCount);
+		m_updates = (b2ContactUpdate*)b2Alloc(m_updateCapacity * sizeof(b2ContactUpdate));
+	}
+
+	// Gather the contacts. Only contacts that will certainly be updated are evaluated
+	// concurrently, the rest are collided serially when committing.
+	m_updateCount = 0;
+	for (b2Contact* c = m_contactList; c; c = c->GetNext())
+	{
+		b2ContactUpdate* update = m_updates + m_updateCount++;
+		update->contact = c;
+		update->evaluate = false;
+
+		if (c->m_flags & b2Contact::e_filterFlag)
+		{
+			continue;
+		}
+
 		b2Fixture* fixtureA = c->GetFixtureA();
 		b2Fixture* fixtureB = c->GetFixtureB();
-		int32 indexA = c->GetChildIndexA();
-		int32 indexB = c->GetChildIndexB();
 		b2Body* bodyA = fixtureA->GetBody();
 		b2Body* bodyB = fixtureB->GetBody();
-		 
-		// Is this contact flagged for filtering?
-		if (c->m_flags & b2Contact::e_filterFlag)
+
+		bool activeA = bodyA->IsAwake() && bodyA->m_type != b2_staticBody;
+		bool activeB = bodyB->IsAwake() && bodyB->m_type != b2_staticBody;
+		if (activeA == false && activeB == false)
 		{
-			// Should these bodies collide?
-			if (bodyB->ShouldCollide(bodyA) == false)
-			{
-				b2Contact* cNuke = c;
-				c = cNuke->GetNext();
-				Destroy(cNuke);
-				continue;
-			}
+			continue;
+		}
 
-			// Check user filtering.
-			if (m_contactFilter && m_contactFilter->ShouldCollide(fixtureA, fixtureB) == false)
-			{
-				b2Contact* cNuke = c;
-				c = cNuke->GetNext();
-				Destroy(cNuke);
-				continue;
-			}
+		int32 proxyIdA = fixtureA->m_proxies[c->GetChildIndexA()].proxyId;
+		int32 proxyIdB = fixtureB->m_proxies[c->GetChildIndexB()].proxyId;
+		update->evaluate = m_broadPhase.TestOverlap(proxyIdA, proxyIdB);
+	}
 
-			// Clear the filtering flag.
-			c->m_flags &= ~b2Contact::e_filterFlag;
+	// Compute the manifolds.
+	int32 blockCount = (m_updateCount + b2_parallelContactBlock - 1) / b2_parallelContactBlock;
+	m_parallelExecutor->ParallelFor(UpdateManifoldRange, this, blockCount);
+
+	// Commit in list order so the listener callbacks match a serial collide. Bodies are
+	// only ever woken here so a contact evaluated above is still due to be updated.
+	for (int32 i = 0; i < m_updateCount; ++i)
+	{
+		b2ContactUpdate* update = m_updates + i;
+		if (update->evaluate)
+		{
+			update->contact->CommitManifold(update->manifold, update->touching, m_contactListener);
 		}
+		else
+		{
+			CollideContact(update->contact);
+		}
+	}
 
-		bool activeA = bodyA->IsAwake() && bodyA->m_type != b2_staticBody;
-		bool activeB = bodyB->IsAwake() && bodyB->m_type != b2_staticBody;
+	m_updateCount = 0;
+}
 
-		// At least one body must be awake and it must be dynamic or kinematic.
-		if (activeA == false && activeB == false)
+void b2ContactManager::UpdateManifoldRange(void* context, int32 start, int32 end)
+{
+	b2ContactManager* contactManager = (b2ContactManager*)context;
+
+	// Each item is a block of contacts.
+	int32 first = start * b2_parallelContactBlock;
+	int32 last = b2Min(end * b2_parallelContactBlock, contactManager->m_updateCount);
+	for (int32 i = first; i < last; ++i)
+	{
+		b2ContactUpdate* update = contactManager->m_updates + i;
+		if (update->evaluate)
 		{
-			c = c->GetNext();
-			continue;
+			update->touching = update->contact->UpdateManifold(&update->manifold);
 		}
+	}
+}
 
-		int32 proxyIdA = fixtureA->m_proxies[indexA].proxyId;
-		int32 proxyIdB = fixtureB->m_proxies[indexB].proxyId;
-		bool overlap = m_broadPhase.TestOverlap(proxyIdA, proxyIdB);
+void b2ContactManager::CollideContact(b2Contact* c)
+{
+	b2Fixture* fixtureA = c->GetFixtureA();
+	b2Fixture* fixtureB = c->GetFixtureB();
+	int32 indexA = c->GetChildIndexA();
+	int32 indexB = c->GetChildIndexB();
+	b2Body* bodyA = fixtureA->GetBody();
+	b2Body* bodyB = fixtureB->GetBody();
+	 
+	// Is this contact flagged for filtering?
+	if (c->m_flags & b2Contact::e_filterFlag)
+	{
+		// Should these bodies collide?
+		if (bodyB->ShouldCollide(bodyA) == false)
+		{
+			Destroy(c);
+			return;
+		}
 
-		// Here we destroy contacts that cease to overlap in the broad-phase.
-		if (overlap == false)
+		// Check user filtering.
+		if (m_contactFilter && m_contactFilter->ShouldCollide(fixtureA, fixtureB) == false)
 		{
-			b2Contact* cNuke = c;
-			c = cNuke->GetNext();
-			Destroy(cNuke);
-			continue;
+			Destroy(c);
+			return;
 		}
 
-		// The contact persists.
-		c->Update(m_contactListener);
-		c = c->GetNext();
+		// Clear the filtering flag.
+		c->m_flags &= ~b2Contact::e_filterFlag;
 	}
+
+	bool activeA = bodyA->IsAwake() && bodyA->m_type != b2_staticBody;
+	bool activeB = bodyB->IsAwake() && bodyB->m_type != b2_staticBody;
+
+	// At least one body must be awake and it must be dynamic or kinematic.
+	if (activeA == false && activeB == false)
+	{
+		return;
+	}
+
+	int32 proxyIdA = fixtureA->m_proxies[indexA].proxyId;
+	int32 proxyIdB = fixtureB->m_proxies[indexB].proxyId;
+	bool overlap = m_broadPhase.TestOverlap(proxyIdA, proxyIdB);
+
+	// Here we destroy contacts that cease to overlap in the broad-phase.
+	if (overlap == false)
+	{
+		Destroy(c);
+		return;
+	}
+
+	// The contact persists.
+	c->Update(m_contactListener);
 }
 
 void b2ContactManager::FindNewContacts()
@@ -235,8 +338,8 @@ void b2ContactManager::AddPair(void* proxyUserDataA, void* proxyUserDataB)
 		return;
 	}
 
-	// Call the factory.
-	b2Contact* c = b2Contact::Create(fixtureA, indexA, fixtureB, indexB, m_allocator);
+	// Create and link the contact.
+	b2Contact* c = AddContact(fixtureA, indexA, fixtureB, indexB);
 	if (c == NULL)
 	{
 		return;
@@ -245,11 +348,30 @@ void b2ContactManager::AddPair(void* proxyUserDataA, void* proxyUserDataB)
 	// Contact creation may swap fixtures.
 	fixtureA = c->GetFixtureA();
 	fixtureB = c->GetFixtureB();
-	indexA = c->GetChildIndexA();
-	indexB = c->GetChildIndexB();
 	bodyA = fixtureA->GetBody();
 	bodyB = fixtureB->GetBody();
 
+	// Wake up the bodies
+	if (fixtureA->IsSensor() == false && fixtureB->IsSensor() == false)
+	{
+		bodyA->SetAwake(true);
+		bodyB->SetAwake(true);
+	}
+}
+
+b2Contact* b2ContactManager::AddContact(b2Fixture* fixtureA, int32 indexA, b2Fixture* fixtureB, int32 indexB)
+{
+	// Call the factory.
+	b2Contact* c = b2Contact::Create(fixtureA, indexA, fixtureB, indexB, m_allocator);
+	if (c == NULL)
+	{
+		return NULL;
+	}
+
+	// Contact creation may swap fixtures.
+	b2Body* bodyA = c->GetFixtureA()->GetBody();
+	b2Body* bodyB = c->GetFixtureB()->GetBody();
+
 	// Insert into the world.
 	c->m_prev = NULL;
 	c->m_next = m_contactList;
@@ -285,12 +407,7 @@ void b2ContactManager::AddPair(void* proxyUserDataA, void* proxyUserDataB)
 	}
 	bodyB->m_contactList = &c->m_nodeB;
 
-	// Wake up the bodies
-	if (fixtureA->IsSensor() == false && fixtureB->IsSensor() == false)
-	{
-		bodyA->SetAwake(true);
-		bodyB->SetAwake(true);
-	}
-
 	++m_contactCount;
+
+	return c;
 }
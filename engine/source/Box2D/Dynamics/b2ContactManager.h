@@ -22,31 +22,57 @@
 #include <Box2D/Collision/b2BroadPhase.h>
 
 class b2Contact;
+class b2Fixture;
 class b2ContactFilter;
 class b2ContactListener;
-class b2BlockAllocator;
+class b2Allocator;
+class b2ParallelExecutor;
+
+// A contact gathered by a parallel collide.
+struct b2ContactUpdate
+{
+	b2Contact* contact;
+	b2Manifold manifold;
+	bool evaluate;
+	bool touching;
+};
 
 // Delegate of b2World.
 class b2ContactManager
 {
 public:
 	b2ContactManager();
+	~b2ContactManager();
 
 	// Broad-phase callback.
 	void AddPair(void* proxyUserDataA, void* proxyUserDataB);
 
 	void FindNewContacts();
 
+	// Create a contact and link it into the world and island graph without filtering
+	// or waking the bodies. Returns NULL if the shape types don't collide.
+	b2Contact* AddContact(b2Fixture* fixtureA, int32 indexA, b2Fixture* fixtureB, int32 indexB);
+
 	void Destroy(b2Contact* c);
 
 	void Collide();
+
+	// Parallel collide. The manifolds are computed concurrently then committed in list order.
+	void CollideParallel();
+	void CollideContact(b2Contact* c);
+	static void UpdateManifoldRange(void* context, int32 start, int32 end);
             
 	b2BroadPhase m_broadPhase;
 	b2Contact* m_contactList;
 	int32 m_contactCount;
 	b2ContactFilter* m_contactFilter;
 	b2ContactListener* m_contactListener;
-	b2BlockAllocator* m_allocator;
+	b2Allocator* m_allocator;
+	b2ParallelExecutor* m_parallelExecutor;
+
+	b2ContactUpdate* m_updates;
+	int32 m_updateCount;
+	int32 m_updateCapacity;
 };
 
 #endif
@@ -25,7 +25,7 @@
 #include <Box2D/Collision/Shapes/b2ChainShape.h>
 #include <Box2D/Collision/b2BroadPhase.h>
 #include <Box2D/Collision/b2Collision.h>
-#include <Box2D/Common/b2BlockAllocator.h>
+#include <Box2D/Common/b2Allocator.h>
 
 b2Fixture::b2Fixture()
 {
@@ -38,7 +38,7 @@ b2Fixture::b2Fixture()
 	m_density = 0.0f;
 }
 
-void b2Fixture::Create(b2BlockAllocator* allocator, b2Body* body, const b2FixtureDef* def)
+void b2Fixture::Create(b2Allocator* allocator, b2Body* body, const b2FixtureDef* def)
 {
 	m_userData = def->userData;
 	m_friction = def->friction;
@@ -66,7 +66,7 @@ void b2Fixture::Create(b2BlockAllocator* allocator, b2Body* body, const b2Fixtur
 	m_density = def->density;
 }
 
-void b2Fixture::Destroy(b2BlockAllocator* allocator)
+void b2Fixture::Destroy(b2Allocator* allocator)
 {
 	// The proxies must be destroyed before calling this.
 	b2Assert(m_proxyCount == 0);
@@ -23,7 +23,7 @@
 #include <Box2D/Collision/b2Collision.h>
 #include <Box2D/Collision/Shapes/b2Shape.h>
 
-class b2BlockAllocator;
+class b2Allocator;
 class b2Body;
 class b2BroadPhase;
 class b2Fixture;
@@ -206,8 +206,8 @@ protected:
 
 	// We need separation create/destroy functions from the constructor/destructor because
 	// the destructor cannot access the allocator (no destructor arguments allowed by C++).
-	void Create(b2BlockAllocator* allocator, b2Body* body, const b2FixtureDef* def);
-	void Destroy(b2BlockAllocator* allocator);
+	void Create(b2Allocator* allocator, b2Body* body, const b2FixtureDef* def);
+	void Destroy(b2Allocator* allocator);
 
 	// These support body activation/deactivation.
 	void CreateProxies(b2BroadPhase* broadPhase, const b2Transform& xf);
@@ -26,6 +26,7 @@
 #include <Box2D/Dynamics/Joints/b2Joint.h>
 #include <Box2D/Common/b2StackAllocator.h>
 #include <Box2D/Common/b2Timer.h>
+#include <new>
 
 /*
 Position Correction Notes
@@ -162,6 +163,9 @@ b2Island::b2Island(
 	m_allocator = allocator;
 	m_listener = listener;
 
+	m_contactSolver = NULL;
+	m_positionSolved = false;
+
 	m_bodies = (b2Body**)m_allocator->Allocate(bodyCapacity * sizeof(b2Body*));
 	m_contacts = (b2Contact**)m_allocator->Allocate(contactCapacity	 * sizeof(b2Contact*));
 	m_joints = (b2Joint**)m_allocator->Allocate(jointCapacity * sizeof(b2Joint*));
@@ -182,6 +186,15 @@ b2Island::~b2Island()
 
 void b2Island::Solve(b2Profile* profile, const b2TimeStep& step, const b2Vec2& gravity, bool allowSleep)
 {
+	InitializeSolve(profile, step, gravity);
+	SolveConstraints(profile, step);
+	FinalizeSolve(step, allowSleep);
+}
+
+void b2Island::InitializeSolve(b2Profile* profile, const b2TimeStep& step, const b2Vec2& gravity)
+{
+	b2Assert(m_contactSolver == NULL);
+
 	b2Timer timer;
 
 	float32 h = step.dt;
@@ -240,12 +253,14 @@ void b2Island::Solve(b2Profile* profile, const b2TimeStep& step, const b2Vec2& g
 	contactSolverDef.velocities = m_velocities;
 	contactSolverDef.allocator = m_allocator;
 
-	b2ContactSolver contactSolver(&contactSolverDef);
-	contactSolver.InitializeVelocityConstraints();
+	// The contact solver lives until the island is finalized.
+	void* mem = m_allocator->Allocate(sizeof(b2ContactSolver));
+	m_contactSolver = new (mem) b2ContactSolver(&contactSolverDef);
+	m_contactSolver->InitializeVelocityConstraints();
 
 	if (step.warmStarting)
 	{
-		contactSolver.WarmStart();
+		m_contactSolver->WarmStart();
 	}
 	
 	for (int32 i = 0; i < m_jointCount; ++i)
@@ -254,9 +269,23 @@ void b2Island::Solve(b2Profile* profile, const b2TimeStep& step, const b2Vec2& g
 	}
 
 	profile->solveInit = timer.GetMilliseconds();
+}
+
+void b2Island::SolveConstraints(b2Profile* profile, const b2TimeStep& step)
+{
+	b2Assert(m_contactSolver != NULL);
+
+	b2Timer timer;
+
+	float32 h = step.dt;
+
+	// Solver data
+	b2SolverData solverData;
+	solverData.step = step;
+	solverData.positions = m_positions;
+	solverData.velocities = m_velocities;
 
 	// Solve velocity constraints
-	timer.Reset();
 	for (int32 i = 0; i < step.velocityIterations; ++i)
 	{
 		for (int32 j = 0; j < m_jointCount; ++j)
@@ -264,11 +293,11 @@ void b2Island::Solve(b2Profile* profile, const b2TimeStep& step, const b2Vec2& g
 			m_joints[j]->SolveVelocityConstraints(solverData);
 		}
 
-		contactSolver.SolveVelocityConstraints();
+		m_contactSolver->SolveVelocityConstraints();
 	}
 
 	// Store impulses for warm starting
-	contactSolver.StoreImpulses();
+	m_contactSolver->StoreImpulses();
 	profile->solveVelocity = timer.GetMilliseconds();
 
 	// Integrate positions
@@ -306,10 +335,10 @@ void b2Island::Solve(b2Profile* profile, const b2TimeStep& step, const b2Vec2& g
 
 	// Solve position constraints
 	timer.Reset();
-	bool positionSolved = false;
+	m_positionSolved = false;
 	for (int32 i = 0; i < step.positionIterations; ++i)
 	{
-		bool contactsOkay = contactSolver.SolvePositionConstraints();
+		bool contactsOkay = m_contactSolver->SolvePositionConstraints();
 
 		bool jointsOkay = true;
 		for (int32 i = 0; i < m_jointCount; ++i)
@@ -321,15 +350,21 @@ void b2Island::Solve(b2Profile* profile, const b2TimeStep& step, const b2Vec2& g
 		if (contactsOkay && jointsOkay)
 		{
 			// Exit early if the position errors are small.
-			positionSolved = true;
+			m_positionSolved = true;
 			break;
 		}
 	}
 
-	// Copy state buffers back to the bodies
+	// Copy state buffers back to the bodies. Static bodies can be shared
+	// with other islands so they are copied back when finalizing.
 	for (int32 i = 0; i < m_bodyCount; ++i)
 	{
 		b2Body* body = m_bodies[i];
+		if (body->m_type == b2_staticBody)
+		{
+			continue;
+		}
+
 		body->m_sweep.c = m_positions[i].c;
 		body->m_sweep.a = m_positions[i].a;
 		body->m_linearVelocity = m_velocities[i].v;
@@ -338,8 +373,31 @@ void b2Island::Solve(b2Profile* profile, const b2TimeStep& step, const b2Vec2& g
 	}
 
 	profile->solvePosition = timer.GetMilliseconds();
+}
 
-	Report(contactSolver.m_velocityConstraints);
+void b2Island::FinalizeSolve(const b2TimeStep& step, bool allowSleep)
+{
+	b2Assert(m_contactSolver != NULL);
+
+	float32 h = step.dt;
+
+	// Copy state buffers back to the static bodies
+	for (int32 i = 0; i < m_bodyCount; ++i)
+	{
+		b2Body* body = m_bodies[i];
+		if (body->m_type != b2_staticBody)
+		{
+			continue;
+		}
+
+		body->m_sweep.c = m_positions[i].c;
+		body->m_sweep.a = m_positions[i].a;
+		body->m_linearVelocity = m_velocities[i].v;
+		body->m_angularVelocity = m_velocities[i].w;
+		body->SynchronizeTransform();
+	}
+
+	Report(m_contactSolver->m_velocityConstraints);
 
 	if (allowSleep)
 	{
@@ -370,7 +428,7 @@ void b2Island::Solve(b2Profile* profile, const b2TimeStep& step, const b2Vec2& g
 			}
 		}
 
-		if (minSleepTime >= b2_timeToSleep && positionSolved)
+		if (minSleepTime >= b2_timeToSleep && m_positionSolved)
 		{
 			for (int32 i = 0; i < m_bodyCount; ++i)
 			{
@@ -379,6 +437,10 @@ void b2Island::Solve(b2Profile* profile, const b2TimeStep& step, const b2Vec2& g
 			}
 		}
 	}
+
+	m_contactSolver->~b2ContactSolver();
+	m_allocator->Free(m_contactSolver);
+	m_contactSolver = NULL;
 }
 
 void b2Island::SolveTOI(const b2TimeStep& subStep, int32 toiIndexA, int32 toiIndexB)
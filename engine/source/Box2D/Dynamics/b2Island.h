@@ -27,6 +27,7 @@ class b2Contact;
 class b2Joint;
 class b2StackAllocator;
 class b2ContactListener;
+class b2ContactSolver;
 struct b2ContactVelocityConstraint;
 struct b2Profile;
 
@@ -47,6 +48,15 @@ public:
 
 	void Solve(b2Profile* profile, const b2TimeStep& step, const b2Vec2& gravity, bool allowSleep);
 
+	/// Solve() split into stages so the constraints of independent islands can be solved
+	/// concurrently. InitializeSolve reads the island indices of static bodies so it must be
+	/// called before those bodies are added to another island. InitializeSolve and FinalizeSolve
+	/// touch bodies shared between islands and must be called from the thread stepping the
+	/// world, SolveConstraints only touches bodies owned by this island.
+	void InitializeSolve(b2Profile* profile, const b2TimeStep& step, const b2Vec2& gravity);
+	void SolveConstraints(b2Profile* profile, const b2TimeStep& step);
+	void FinalizeSolve(const b2TimeStep& step, bool allowSleep);
+
 	void SolveTOI(const b2TimeStep& subStep, int32 toiIndexA, int32 toiIndexB);
 
 	void Add(b2Body* body)
@@ -81,6 +91,9 @@ public:
 	b2Position* m_positions;
 	b2Velocity* m_velocities;
 
+	b2ContactSolver* m_contactSolver;
+	bool m_positionSolved;
+
 	int32 m_bodyCount;
 	int32 m_jointCount;
 	int32 m_contactCount;
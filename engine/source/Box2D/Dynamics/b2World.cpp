@@ -34,11 +34,42 @@
 #include <Box2D/Common/b2Timer.h>
 #include <new>
 
-b2World::b2World(const b2Vec2& gravity)
+// An island built during a parallel solve along with the allocator that owns its memory.
+struct b2IslandSlot
+{
+	b2StackAllocator allocator;
+	b2Island* island;
+	b2Profile profile;
+};
+
+// The islands whose constraints are solved concurrently.
+struct b2IslandBatch
+{
+	b2IslandSlot* slots;
+	const b2TimeStep* step;
+};
+
+static void b2SolveIslandRange(void* context, int32 start, int32 end)
+{
+	b2IslandBatch* batch = (b2IslandBatch*)context;
+	for (int32 i = start; i < end; ++i)
+	{
+		b2IslandSlot* slot = batch->slots + i;
+		slot->island->SolveConstraints(&slot->profile, *batch->step);
+	}
+}
+
+b2World::b2World(const b2Vec2& gravity, b2Allocator* allocator)
 {
 	m_destructionListener = NULL;
 	m_debugDraw = NULL;
 
+	m_parallelExecutor = NULL;
+	m_islandSlots = NULL;
+	m_parallelIslands = true;
+	m_parallelContacts = true;
+	m_bulkBroadPhase = false;
+
 	m_bodyList = NULL;
 	m_jointList = NULL;
 
@@ -49,6 +80,11 @@ b2World::b2World(const b2Vec2& gravity)
 	m_continuousPhysics = true;
 	m_subStepping = false;
 
+	m_toiMaxSubSteps = 0;
+	m_toiMaxTime = 0.0f;
+	m_toiSubStepCount = 0;
+	m_toiBudgetExhaustedCount = 0;
+
 	m_stepComplete = true;
 
 	m_allowSleep = true;
@@ -58,14 +94,32 @@ b2World::b2World(const b2Vec2& gravity)
 
 	m_inv_dt0 = 0.0f;
 
-	m_contactManager.m_allocator = &m_blockAllocator;
+	m_allocator = allocator ? allocator : &m_blockAllocator;
+	m_contactManager.m_allocator = m_allocator;
 
 	memset(&m_profile, 0, sizeof(b2Profile));
 }
 
 b2World::~b2World()
 {
-	// Some shapes allocate using b2Alloc.
+	// Return everything to the allocator as it may outlive the world.
+	// Some shapes also allocate using b2Alloc.
+	b2Contact* c = m_contactManager.m_contactList;
+	while (c)
+	{
+		b2Contact* cNext = c->m_next;
+		b2Contact::Destroy(c, m_allocator);
+		c = cNext;
+	}
+
+	b2Joint* j = m_jointList;
+	while (j)
+	{
+		b2Joint* jNext = j->m_next;
+		b2Joint::Destroy(j, m_allocator);
+		j = jNext;
+	}
+
 	b2Body* b = m_bodyList;
 	while (b)
 	{
@@ -76,12 +130,24 @@ b2World::~b2World()
 		{
 			b2Fixture* fNext = f->m_next;
 			f->m_proxyCount = 0;
-			f->Destroy(&m_blockAllocator);
+			f->Destroy(m_allocator);
+			m_allocator->Free(f, sizeof(b2Fixture));
 			f = fNext;
 		}
 
+		b->~b2Body();
+		m_allocator->Free(b, sizeof(b2Body));
 		b = bNext;
 	}
+
+	if (m_islandSlots)
+	{
+		for (int32 i = 0; i < b2_maxParallelIslands; ++i)
+		{
+			m_islandSlots[i].~b2IslandSlot();
+		}
+		b2Free(m_islandSlots);
+	}
 }
 
 void b2World::SetDestructionListener(b2DestructionListener* listener)
@@ -99,6 +165,30 @@ void b2World::SetContactListener(b2ContactListener* listener)
 	m_contactManager.m_contactListener = listener;
 }
 
+void b2World::SetParallelExecutor(b2ParallelExecutor* executor)
+{
+	b2Assert(IsLocked() == false);
+	m_parallelExecutor = executor;
+	m_contactManager.m_parallelExecutor = m_parallelContacts ? executor : NULL;
+
+	// The island slots are kept until the world is destroyed.
+	if (m_parallelExecutor && m_islandSlots == NULL)
+	{
+		m_islandSlots = (b2IslandSlot*)b2Alloc(b2_maxParallelIslands * sizeof(b2IslandSlot));
+		for (int32 i = 0; i < b2_maxParallelIslands; ++i)
+		{
+			new (m_islandSlots + i) b2IslandSlot;
+		}
+	}
+}
+
+void b2World::SetParallelContacts(bool flag)
+{
+	b2Assert(IsLocked() == false);
+	m_parallelContacts = flag;
+	m_contactManager.m_parallelExecutor = m_parallelContacts ? m_parallelExecutor : NULL;
+}
+
 void b2World::SetDebugDraw(b2Draw* debugDraw)
 {
 	m_debugDraw = debugDraw;
@@ -112,7 +202,7 @@ b2Body* b2World::CreateBody(const b2BodyDef* def)
 		return NULL;
 	}
 
-	void* mem = m_blockAllocator.Allocate(sizeof(b2Body));
+	void* mem = m_allocator->Allocate(sizeof(b2Body));
 	b2Body* b = new (mem) b2Body(def, this);
 
 	// Add to world doubly linked list.
@@ -178,9 +268,9 @@ void b2World::DestroyBody(b2Body* b)
 		}
 
 		f0->DestroyProxies(&m_contactManager.m_broadPhase);
-		f0->Destroy(&m_blockAllocator);
+		f0->Destroy(m_allocator);
 		f0->~b2Fixture();
-		m_blockAllocator.Free(f0, sizeof(b2Fixture));
+		m_allocator->Free(f0, sizeof(b2Fixture));
 
 		b->m_fixtureList = f;
 		b->m_fixtureCount -= 1;
@@ -206,7 +296,7 @@ void b2World::DestroyBody(b2Body* b)
 
 	--m_bodyCount;
 	b->~b2Body();
-	m_blockAllocator.Free(b, sizeof(b2Body));
+	m_allocator->Free(b, sizeof(b2Body));
 }
 
 b2Joint* b2World::CreateJoint(const b2JointDef* def)
@@ -217,7 +307,7 @@ b2Joint* b2World::CreateJoint(const b2JointDef* def)
 		return NULL;
 	}
 
-	b2Joint* j = b2Joint::Create(def, &m_blockAllocator);
+	b2Joint* j = b2Joint::Create(def, m_allocator);
 
 	// Connect to the world list.
 	j->m_prev = NULL;
@@ -341,7 +431,7 @@ void b2World::DestroyJoint(b2Joint* j)
 	j->m_edgeB.prev = NULL;
 	j->m_edgeB.next = NULL;
 
-	b2Joint::Destroy(j, &m_blockAllocator);
+	b2Joint::Destroy(j, m_allocator);
 
 	b2Assert(m_jointCount > 0);
 	--m_jointCount;
@@ -410,7 +500,10 @@ void b2World::Solve(const b2TimeStep& step)
 		j->m_islandFlag = false;
 	}
 
-	// Build and simulate all awake islands.
+	// Build and simulate all awake islands. With a parallel executor the islands are
+	// copied into slots and solved in batches.
+	bool parallel = m_parallelExecutor != NULL && m_parallelIslands;
+	int32 slotCount = 0;
 	int32 stackSize = m_bodyCount;
 	b2Body** stack = (b2Body**)m_stackAllocator.Allocate(stackSize * sizeof(b2Body*));
 	for (b2Body* seed = m_bodyList; seed; seed = seed->m_next)
@@ -527,11 +620,41 @@ void b2World::Solve(const b2TimeStep& step)
 			}
 		}
 
-		b2Profile profile;
-		island.Solve(&profile, step, m_gravity, m_allowSleep);
-		m_profile.solveInit += profile.solveInit;
-		m_profile.solveVelocity += profile.solveVelocity;
-		m_profile.solvePosition += profile.solvePosition;
+		if (parallel == false)
+		{
+			b2Profile profile;
+			island.Solve(&profile, step, m_gravity, m_allowSleep);
+			m_profile.solveInit += profile.solveInit;
+			m_profile.solveVelocity += profile.solveVelocity;
+			m_profile.solvePosition += profile.solvePosition;
+		}
+		else
+		{
+			// Copy the island into the next slot.
+			b2IslandSlot* slot = m_islandSlots + slotCount++;
+			void* mem = slot->allocator.Allocate(sizeof(b2Island));
+			slot->island = new (mem) b2Island(island.m_bodyCount,
+											island.m_contactCount,
+											island.m_jointCount,
+											&slot->allocator,
+											m_contactManager.m_contactListener);
+
+			for (int32 i = 0; i < island.m_bodyCount; ++i)
+			{
+				slot->island->Add(island.m_bodies[i]);
+			}
+			for (int32 i = 0; i < island.m_contactCount; ++i)
+			{
+				slot->island->Add(island.m_contacts[i]);
+			}
+			for (int32 i = 0; i < island.m_jointCount; ++i)
+			{
+				slot->island->Add(island.m_joints[i]);
+			}
+
+			// Initialize now whilst the island indices of the static bodies are valid.
+			slot->island->InitializeSolve(&slot->profile, step, m_gravity);
+		}
 
 		// Post solve cleanup.
 		for (int32 i = 0; i < island.m_bodyCount; ++i)
@@ -543,12 +666,30 @@ void b2World::Solve(const b2TimeStep& step)
 				b->m_flags &= ~b2Body::e_islandFlag;
 			}
 		}
+
+		// Solve the batch once all the slots are used.
+		if (slotCount == b2_maxParallelIslands)
+		{
+			SolveIslandSlots(slotCount, step);
+			slotCount = 0;
+		}
+	}
+
+	if (slotCount > 0)
+	{
+		SolveIslandSlots(slotCount, step);
 	}
 
 	m_stackAllocator.Free(stack);
 
 	{
 		b2Timer timer;
+
+		if (m_bulkBroadPhase)
+		{
+			m_contactManager.m_broadPhase.BeginBulkMove();
+		}
+
 		// Synchronize fixtures, check for out of range bodies.
 		for (b2Body* b = m_bodyList; b; b = b->GetNext())
 		{
@@ -567,12 +708,40 @@ void b2World::Solve(const b2TimeStep& step)
 			b->SynchronizeFixtures();
 		}
 
+		if (m_bulkBroadPhase)
+		{
+			m_contactManager.m_broadPhase.EndBulkMove();
+		}
+
 		// Look for new contacts.
 		m_contactManager.FindNewContacts();
 		m_profile.broadphase = timer.GetMilliseconds();
 	}
 }
 
+// Solve the constraints of the islands in the slots concurrently then finalize them in order.
+void b2World::SolveIslandSlots(int32 slotCount, const b2TimeStep& step)
+{
+	b2IslandBatch batch;
+	batch.slots = m_islandSlots;
+	batch.step = &step;
+	m_parallelExecutor->ParallelFor(b2SolveIslandRange, &batch, slotCount);
+
+	// Finalize in island order so the contact listener callbacks are deterministic.
+	for (int32 i = 0; i < slotCount; ++i)
+	{
+		b2IslandSlot* slot = m_islandSlots + i;
+		slot->island->FinalizeSolve(step, m_allowSleep);
+		m_profile.solveInit += slot->profile.solveInit;
+		m_profile.solveVelocity += slot->profile.solveVelocity;
+		m_profile.solvePosition += slot->profile.solvePosition;
+
+		slot->island->~b2Island();
+		slot->allocator.Free(slot->island);
+		slot->island = NULL;
+	}
+}
+
 // Find TOI contacts and solve them.
 void b2World::SolveTOI(const b2TimeStep& step)
 {
@@ -595,9 +764,25 @@ void b2World::SolveTOI(const b2TimeStep& step)
 		}
 	}
 
+	b2Timer budgetTimer;
+	m_toiSubStepCount = 0;
+
 	// Find TOI events and solve them.
 	for (;;)
 	{
+		// Stop if the budget for this step has been exhausted.
+		// The time limit is ignored in deterministic builds as it depends on the machine.
+		bool budgetExhausted = m_toiMaxSubSteps > 0 && m_toiSubStepCount >= m_toiMaxSubSteps;
+#if !defined(B2_DETERMINISTIC)
+		budgetExhausted |= m_toiMaxTime > 0.0f && m_toiSubStepCount > 0 && budgetTimer.GetMilliseconds() >= m_toiMaxTime;
+#endif
+		if (budgetExhausted)
+		{
+			++m_toiBudgetExhaustedCount;
+			m_stepComplete = true;
+			break;
+		}
+
 		// Find the first TOI.
 		b2Contact* minContact = NULL;
 		float32 minAlpha = 1.0f;
@@ -658,6 +843,13 @@ void b2World::SolveTOI(const b2TimeStep& step)
 					continue;
 				}
 
+				// Is either body restricted to static bodies only?
+				if ((bA->IsBulletStaticOnly() && typeB != b2_staticBody) ||
+					(bB->IsBulletStaticOnly() && typeA != b2_staticBody))
+				{
+					continue;
+				}
+
 				// Compute the TOI for this contact.
 				// Put the sweeps onto the same time interval.
 				float32 alpha0 = bA->m_sweep.alpha0;
@@ -728,6 +920,8 @@ void b2World::SolveTOI(const b2TimeStep& step)
 		b2Sweep backup1 = bA->m_sweep;
 		b2Sweep backup2 = bB->m_sweep;
 
+		++m_toiSubStepCount;
+
 		bA->Advance(minAlpha);
 		bB->Advance(minAlpha);
 
@@ -796,6 +990,13 @@ void b2World::SolveTOI(const b2TimeStep& step)
 						continue;
 					}
 
+					// Respect bodies restricted to static bodies only.
+					if ((body->IsBulletStaticOnly() && other->m_type != b2_staticBody) ||
+						(other->IsBulletStaticOnly() && body->m_type != b2_staticBody))
+					{
+						continue;
+					}
+
 					// Skip sensors.
 					bool sensorA = contact->m_fixtureA->m_isSensor;
 					bool sensorB = contact->m_fixtureB->m_isSensor;
@@ -1279,6 +1480,335 @@ void b2World::ShiftOrigin(const b2Vec2& newOrigin)
 	m_contactManager.m_broadPhase.ShiftOrigin(newOrigin);
 }
 
+// World snapshot layout. Each record is a multiple of four bytes so a four byte aligned
+// buffer keeps every record aligned.
+static const uint32 b2_snapshotMagic = 0x62325331;
+
+struct b2SnapshotHeader
+{
+	uint32 magic;
+	int32 bodyCount;
+	int32 proxyCount;
+	int32 jointCount;
+	int32 contactCount;
+	int32 moveCount;
+	int32 flags;
+	float32 inv_dt0;
+};
+
+struct b2BodySnapshot
+{
+	b2Transform xf;
+	b2Sweep sweep;
+	b2Vec2 linearVelocity;
+	float32 angularVelocity;
+	b2Vec2 force;
+	float32 torque;
+	float32 sleepTime;
+	int32 awake;
+};
+
+struct b2ProxySnapshot
+{
+	int32 proxyId;
+	b2AABB aabb;
+	b2AABB fatAABB;
+};
+
+struct b2JointSnapshot
+{
+	int32 type;
+	b2JointWarmStart warmStart;
+};
+
+struct b2ContactSnapshot
+{
+	int32 proxyIdA;
+	int32 proxyIdB;
+	uint32 flags;
+	int32 toiCount;
+	float32 toi;
+	float32 friction;
+	float32 restitution;
+	float32 tangentSpeed;
+	b2Manifold manifold;
+};
+
+static int32 b2GetSnapshotSize(int32 bodyCount, int32 proxyCount, int32 jointCount, int32 contactCount, int32 moveCount)
+{
+	return	sizeof(b2SnapshotHeader) +
+			bodyCount * sizeof(b2BodySnapshot) +
+			proxyCount * sizeof(b2ProxySnapshot) +
+			jointCount * sizeof(b2JointSnapshot) +
+			contactCount * sizeof(b2ContactSnapshot) +
+			moveCount * sizeof(int32);
+}
+
+int32 b2World::GetSnapshotSize() const
+{
+	const b2BroadPhase& broadPhase = m_contactManager.m_broadPhase;
+	return b2GetSnapshotSize(m_bodyCount, broadPhase.GetProxyCount(), m_jointCount, m_contactManager.m_contactCount, broadPhase.GetMoveCount());
+}
+
+int32 b2World::SaveSnapshot(void* buffer, int32 bufferSize) const
+{
+	b2Assert((m_flags & e_locked) == 0);
+
+	int32 size = GetSnapshotSize();
+	if (buffer == NULL || bufferSize < size)
+	{
+		return 0;
+	}
+
+	const b2BroadPhase& broadPhase = m_contactManager.m_broadPhase;
+
+	b2SnapshotHeader* header = (b2SnapshotHeader*)buffer;
+	header->magic = b2_snapshotMagic;
+	header->bodyCount = m_bodyCount;
+	header->proxyCount = broadPhase.GetProxyCount();
+	header->jointCount = m_jointCount;
+	header->contactCount = m_contactManager.m_contactCount;
+	header->moveCount = broadPhase.GetMoveCount();
+	header->flags = m_flags & e_newFixture;
+	header->inv_dt0 = m_inv_dt0;
+
+	b2BodySnapshot* bodies = (b2BodySnapshot*)(header + 1);
+	for (b2Body* b = m_bodyList; b; b = b->m_next)
+	{
+		b2BodySnapshot* bs = bodies++;
+		bs->xf = b->m_xf;
+		bs->sweep = b->m_sweep;
+		bs->linearVelocity = b->m_linearVelocity;
+		bs->angularVelocity = b->m_angularVelocity;
+		bs->force = b->m_force;
+		bs->torque = b->m_torque;
+		bs->sleepTime = b->m_sleepTime;
+		bs->awake = (b->m_flags & b2Body::e_awakeFlag) ? 1 : 0;
+	}
+
+	b2ProxySnapshot* proxies = (b2ProxySnapshot*)bodies;
+	for (b2Body* b = m_bodyList; b; b = b->m_next)
+	{
+		for (b2Fixture* f = b->m_fixtureList; f; f = f->m_next)
+		{
+			for (int32 i = 0; i < f->m_proxyCount; ++i)
+			{
+				const b2FixtureProxy* proxy = f->m_proxies + i;
+				b2ProxySnapshot* ps = proxies++;
+				ps->proxyId = proxy->proxyId;
+				ps->aabb = proxy->aabb;
+				ps->fatAABB = broadPhase.GetFatAABB(proxy->proxyId);
+			}
+		}
+	}
+
+	b2JointSnapshot* joints = (b2JointSnapshot*)proxies;
+	for (b2Joint* j = m_jointList; j; j = j->m_next)
+	{
+		b2JointSnapshot* js = joints++;
+		memset(js, 0, sizeof(b2JointSnapshot));
+		js->type = j->m_type;
+		j->SaveWarmStart(&js->warmStart);
+	}
+
+	b2ContactSnapshot* contacts = (b2ContactSnapshot*)joints;
+	for (b2Contact* c = m_contactManager.m_contactList; c; c = c->m_next)
+	{
+		b2ContactSnapshot* cs = contacts++;
+		cs->proxyIdA = c->m_fixtureA->m_proxies[c->m_indexA].proxyId;
+		cs->proxyIdB = c->m_fixtureB->m_proxies[c->m_indexB].proxyId;
+		cs->flags = c->m_flags;
+		cs->toiCount = c->m_toiCount;
+		cs->toi = c->m_toi;
+		cs->friction = c->m_friction;
+		cs->restitution = c->m_restitution;
+		cs->tangentSpeed = c->m_tangentSpeed;
+		cs->manifold = c->m_manifold;
+	}
+
+	int32* moves = (int32*)contacts;
+	memcpy(moves, broadPhase.GetMoveBuffer(), header->moveCount * sizeof(int32));
+
+	return size;
+}
+
+bool b2World::LoadSnapshot(const void* buffer, int32 bufferSize)
+{
+	b2Assert((m_flags & e_locked) == 0);
+	if ((m_flags & e_locked) == e_locked)
+	{
+		return false;
+	}
+
+	b2BroadPhase& broadPhase = m_contactManager.m_broadPhase;
+
+	// Validate the snapshot against the world before changing anything.
+	if (buffer == NULL || bufferSize < (int32)sizeof(b2SnapshotHeader))
+	{
+		return false;
+	}
+
+	const b2SnapshotHeader* header = (const b2SnapshotHeader*)buffer;
+	if (header->magic != b2_snapshotMagic ||
+		header->bodyCount != m_bodyCount ||
+		header->proxyCount != broadPhase.GetProxyCount() ||
+		header->jointCount != m_jointCount ||
+		header->contactCount < 0 || header->moveCount < 0 ||
+		bufferSize < b2GetSnapshotSize(header->bodyCount, header->proxyCount, header->jointCount, header->contactCount, header->moveCount))
+	{
+		return false;
+	}
+
+	const b2BodySnapshot* bodies = (const b2BodySnapshot*)(header + 1);
+	const b2ProxySnapshot* proxies = (const b2ProxySnapshot*)(bodies + header->bodyCount);
+	const b2JointSnapshot* joints = (const b2JointSnapshot*)(proxies + header->proxyCount);
+	const b2ContactSnapshot* contacts = (const b2ContactSnapshot*)(joints + header->jointCount);
+	const int32* moves = (const int32*)(contacts + header->contactCount);
+
+	// The proxies identify the fixtures so they must match exactly.
+	int32 maxProxyId = b2BroadPhase::e_nullProxy;
+	const b2ProxySnapshot* ps = proxies;
+	for (b2Body* b = m_bodyList; b; b = b->m_next)
+	{
+		for (b2Fixture* f = b->m_fixtureList; f; f = f->m_next)
+		{
+			for (int32 i = 0; i < f->m_proxyCount; ++i, ++ps)
+			{
+				if (ps->proxyId != f->m_proxies[i].proxyId)
+				{
+					return false;
+				}
+
+				maxProxyId = b2Max(maxProxyId, ps->proxyId);
+			}
+		}
+	}
+
+	const b2JointSnapshot* js = joints;
+	for (b2Joint* j = m_jointList; j; j = j->m_next, ++js)
+	{
+		if (js->type != j->m_type)
+		{
+			return false;
+		}
+	}
+
+	for (int32 i = 0; i < header->contactCount; ++i)
+	{
+		const b2ContactSnapshot& cs = contacts[i];
+		if (cs.proxyIdA < 0 || cs.proxyIdA > maxProxyId || cs.proxyIdB < 0 || cs.proxyIdB > maxProxyId)
+		{
+			return false;
+		}
+	}
+
+	for (int32 i = 0; i < header->moveCount; ++i)
+	{
+		if (moves[i] < b2BroadPhase::e_nullProxy || moves[i] > maxProxyId)
+		{
+			return false;
+		}
+	}
+
+	// Restore the world.
+	m_flags = (m_flags & ~e_newFixture) | (header->flags & e_newFixture);
+	m_inv_dt0 = header->inv_dt0;
+
+	// Restore the bodies.
+	const b2BodySnapshot* bs = bodies;
+	for (b2Body* b = m_bodyList; b; b = b->m_next, ++bs)
+	{
+		b->m_xf = bs->xf;
+		b->m_sweep = bs->sweep;
+		b->m_linearVelocity = bs->linearVelocity;
+		b->m_angularVelocity = bs->angularVelocity;
+		b->m_force = bs->force;
+		b->m_torque = bs->torque;
+		b->m_sleepTime = bs->sleepTime;
+		if (bs->awake)
+		{
+			b->m_flags |= b2Body::e_awakeFlag;
+		}
+		else
+		{
+			b->m_flags &= ~b2Body::e_awakeFlag;
+		}
+	}
+
+	// Restore the broad-phase. The fat AABBs decide which pairs are found so they are
+	// restored exactly rather than recomputed from the body transforms.
+	broadPhase.BeginBulkMove();
+	ps = proxies;
+	for (b2Body* b = m_bodyList; b; b = b->m_next)
+	{
+		for (b2Fixture* f = b->m_fixtureList; f; f = f->m_next)
+		{
+			for (int32 i = 0; i < f->m_proxyCount; ++i, ++ps)
+			{
+				f->m_proxies[i].aabb = ps->aabb;
+				broadPhase.SetFatAABB(ps->proxyId, ps->fatAABB);
+			}
+		}
+	}
+	broadPhase.EndBulkMove();
+	broadPhase.SetMoveBuffer(moves, header->moveCount);
+
+	// Restore the joints.
+	js = joints;
+	for (b2Joint* j = m_jointList; j; j = j->m_next, ++js)
+	{
+		j->LoadWarmStart(js->warmStart);
+	}
+
+	// The contacts can be updated in place if the list is unchanged, which is the
+	// common case when rolling back a few steps.
+	bool contactsMatch = header->contactCount == m_contactManager.m_contactCount;
+	b2Contact* c = m_contactManager.m_contactList;
+	for (int32 i = 0; contactsMatch && i < header->contactCount; ++i, c = c->m_next)
+	{
+		contactsMatch = contacts[i].proxyIdA == c->m_fixtureA->m_proxies[c->m_indexA].proxyId &&
+						contacts[i].proxyIdB == c->m_fixtureB->m_proxies[c->m_indexB].proxyId;
+	}
+
+	if (contactsMatch == false)
+	{
+		// Destroy the contacts without reporting them as ended.
+		c = m_contactManager.m_contactList;
+		while (c)
+		{
+			b2Contact* c0 = c;
+			c = c->m_next;
+			c0->m_flags &= ~b2Contact::e_touchingFlag;
+			m_contactManager.Destroy(c0);
+		}
+
+		// Recreate the contacts last to first. Contacts are pushed onto the front of the
+		// world and body lists so this restores the original ordering of both.
+		for (int32 i = header->contactCount - 1; i >= 0; --i)
+		{
+			const b2ContactSnapshot& cs = contacts[i];
+			b2FixtureProxy* proxyA = (b2FixtureProxy*)broadPhase.GetUserData(cs.proxyIdA);
+			b2FixtureProxy* proxyB = (b2FixtureProxy*)broadPhase.GetUserData(cs.proxyIdB);
+			m_contactManager.AddContact(proxyA->fixture, proxyA->childIndex, proxyB->fixture, proxyB->childIndex);
+		}
+	}
+
+	c = m_contactManager.m_contactList;
+	for (int32 i = 0; i < header->contactCount && c; ++i, c = c->m_next)
+	{
+		const b2ContactSnapshot& cs = contacts[i];
+		c->m_flags = cs.flags;
+		c->m_toiCount = cs.toiCount;
+		c->m_toi = cs.toi;
+		c->m_friction = cs.friction;
+		c->m_restitution = cs.restitution;
+		c->m_tangentSpeed = cs.tangentSpeed;
+		c->m_manifold = cs.manifold;
+	}
+
+	return true;
+}
+
 void b2World::Dump()
 {
 	if ((m_flags & e_locked) == e_locked)
@@ -34,6 +34,7 @@ class b2Body;
 class b2Draw;
 class b2Fixture;
 class b2Joint;
+struct b2IslandSlot;
 
 /// The world class manages all physics entities, dynamic simulation,
 /// and asynchronous queries. The world also contains efficient memory
@@ -43,7 +44,9 @@ class b2World
 public:
 	/// Construct a world object.
 	/// @param gravity the world gravity vector.
-	b2World(const b2Vec2& gravity);
+	/// @param allocator the allocator for bodies, fixtures, shapes, contacts and joints. This
+	/// must outlive the world. The world uses its own b2BlockAllocator if this is NULL.
+	b2World(const b2Vec2& gravity, b2Allocator* allocator = NULL);
 
 	/// Destruct the world. All physics entities are destroyed and all heap memory is released.
 	~b2World();
@@ -61,6 +64,32 @@ public:
 	/// remain in scope.
 	void SetContactListener(b2ContactListener* listener);
 
+	/// Register an executor used to solve independent islands concurrently. The executor
+	/// is owned by you and must remain in scope. Pass NULL to solve islands serially on the
+	/// stepping thread (the default). The results and the order of the contact listener
+	/// callbacks are the same either way.
+	void SetParallelExecutor(b2ParallelExecutor* executor);
+
+	/// Enable/disable solving islands with the parallel executor.
+	void SetParallelIslands(bool flag) { m_parallelIslands = flag; }
+	bool GetParallelIslands() const { return m_parallelIslands; }
+
+	/// Enable/disable moving the broad-phase proxies in bulk each step. The tree is refit
+	/// rather than updated incrementally and rebuilt once it degrades. This is faster when
+	/// many bodies move every step.
+	void SetBulkBroadPhase(bool flag) { m_bulkBroadPhase = flag; }
+	bool GetBulkBroadPhase() const { return m_bulkBroadPhase; }
+
+	/// Use a uniform spatial hash broad-phase with the specified cell size rather than the
+	/// dynamic tree. This suits many similarly sized bodies. A cell size of zero restores the
+	/// tree. This can only be changed before any fixtures are created.
+	void SetSpatialHash(float32 cellSize) { m_contactManager.m_broadPhase.SetSpatialHash(cellSize); }
+	float32 GetSpatialHash() const { return m_contactManager.m_broadPhase.GetSpatialHash(); }
+
+	/// Enable/disable computing contact manifolds with the parallel executor.
+	void SetParallelContacts(bool flag);
+	bool GetParallelContacts() const { return m_parallelContacts; }
+
 	/// Register a routine for debug drawing. The debug draw functions are called
 	/// inside with b2World::DrawDebugData method. The debug draw object is owned
 	/// by you and must remain in scope.
@@ -157,6 +186,20 @@ public:
 	void SetSubStepping(bool flag) { m_subStepping = flag; }
 	bool GetSubStepping() const { return m_subStepping; }
 
+	/// Limit the continuous physics work done in a single step. Once either the number of
+	/// TOI sub-steps or the time spent (in milliseconds) is exceeded, the remaining TOI
+	/// events are skipped for that step. Zero disables the respective limit.
+	/// The time limit is ignored when B2_DETERMINISTIC is defined.
+	void SetTOIBudget(int32 maxSubSteps, float32 maxTime) { m_toiMaxSubSteps = maxSubSteps; m_toiMaxTime = maxTime; }
+	int32 GetTOIMaxSubSteps() const { return m_toiMaxSubSteps; }
+	float32 GetTOIMaxTime() const { return m_toiMaxTime; }
+
+	/// Get the number of TOI sub-steps solved during the last step.
+	int32 GetTOISubStepCount() const { return m_toiSubStepCount; }
+
+	/// Get the number of steps that have exhausted the TOI budget.
+	int32 GetTOIBudgetExhaustedCount() const { return m_toiBudgetExhaustedCount; }
+
 	/// Get the number of broad-phase proxies.
 	int32 GetProxyCount() const;
 
@@ -199,12 +242,30 @@ public:
 	/// @param newOrigin the new origin with respect to the old origin
 	void ShiftOrigin(const b2Vec2& newOrigin);
 
+	/// Get the number of bytes SaveSnapshot needs for the current state of the world.
+	int32 GetSnapshotSize() const;
+
+	/// Save the body, broad-phase, joint and contact state needed to resume stepping
+	/// exactly from this point into a caller owned (four byte aligned) buffer.
+	/// @warning this should be called outside of a time step.
+	/// @return the number of bytes written or zero if the buffer is too small.
+	int32 SaveSnapshot(void* buffer, int32 bufferSize) const;
+
+	/// Restore a snapshot saved whilst the world had the same bodies, fixtures and joints.
+	/// Contacts are recreated as they were without any contact listener callbacks.
+	/// @warning this should be called outside of a time step.
+	/// @return false and leaves the world unchanged if the snapshot does not match the world.
+	bool LoadSnapshot(const void* buffer, int32 bufferSize);
+
 	/// Get the contact manager for testing.
 	const b2ContactManager& GetContactManager() const;
 
 	/// Get the current profile.
 	const b2Profile& GetProfile() const;
 
+	/// Get the allocator used for bodies, fixtures, shapes, contacts and joints.
+	const b2Allocator* GetAllocator() const { return m_allocator; }
+
 	/// Dump the world into the log file.
 	/// @warning this should be called outside of a time step.
 	void Dump();
@@ -225,12 +286,14 @@ private:
 	friend class b2Controller;
 
 	void Solve(const b2TimeStep& step);
+	void SolveIslandSlots(int32 slotCount, const b2TimeStep& step);
 	void SolveTOI(const b2TimeStep& step);
 
 	void DrawJoint(b2Joint* joint);
 	void DrawShape(b2Fixture* shape, const b2Transform& xf, const b2Color& color);
 
 	b2BlockAllocator m_blockAllocator;
+	b2Allocator* m_allocator;
 	b2StackAllocator m_stackAllocator;
 
 	int32 m_flags;
@@ -249,6 +312,12 @@ private:
 	b2DestructionListener* m_destructionListener;
 	b2Draw* m_debugDraw;
 
+	b2ParallelExecutor* m_parallelExecutor;
+	b2IslandSlot* m_islandSlots;
+	bool m_parallelIslands;
+	bool m_parallelContacts;
+	bool m_bulkBroadPhase;
+
 	// This is used to compute the time step ratio to
 	// support a variable time step.
 	float32 m_inv_dt0;
@@ -258,6 +327,11 @@ private:
 	bool m_continuousPhysics;
 	bool m_subStepping;
 
+	int32 m_toiMaxSubSteps;
+	float32 m_toiMaxTime;
+	int32 m_toiSubStepCount;
+	int32 m_toiBudgetExhaustedCount;
+
 	bool m_stepComplete;
 
 	b2Profile m_profile;
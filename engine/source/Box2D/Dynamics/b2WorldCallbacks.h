@@ -152,4 +152,20 @@ public:
 									const b2Vec2& normal, float32 fraction) = 0;
 };
 
+/// Processes the items in the range [start, end).
+typedef void (*b2ParallelRangeCallback)(void* context, int32 start, int32 end);
+
+/// Implement this class to solve independent islands concurrently.
+/// See b2World::SetParallelExecutor
+class b2ParallelExecutor
+{
+public:
+	virtual ~b2ParallelExecutor() {}
+
+	/// Called to process the items in the range [0, count). The range can be split and
+	/// the callback invoked from several threads at once but this must not return until
+	/// every item has been processed.
+	virtual void ParallelFor(b2ParallelRangeCallback callback, void* context, int32 count) = 0;
+};
+
 #endif
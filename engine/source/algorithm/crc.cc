@@ -28,9 +28,10 @@
 #endif
 
 //-----------------------------------------------------------------------------
-// simple crc function - generates lookup table on first call
+// slicing-by-8 crc function - processes eight bytes per step using eight lookup
+// tables.  The tables are built on first call.
 
-static U32 crcTable[256];
+static U32 crcTable[8][256];
 static bool crcTableValid;
 
 static void calculateCRCTable()
@@ -47,12 +48,26 @@ static void calculateCRCTable()
          else
             val = val >> 1;
       }
-      crcTable[i] = val;
+      crcTable[0][i] = val;
+   }
+
+   // Each further table advances the crc of a table entry by another zero byte.
+   for(S32 i = 0; i < 256; i++)
+   {
+      for(S32 k = 1; k < 8; k++)
+         crcTable[k][i] = (crcTable[k - 1][i] >> 8) ^ crcTable[0][crcTable[k - 1][i] & 0xff];
    }
 
    crcTableValid = true;
 }
 
+// Build the tables during static initialization so that threads calculating crcs
+// never race to build them.
+static struct CRCTableInitializer
+{
+   CRCTableInitializer() { calculateCRCTable(); }
+} sgCRCTableInitializer;
+
 
 //-----------------------------------------------------------------------------
 
@@ -62,10 +77,25 @@ U32 calculateCRC(const void * buffer, S32 len, U32 crcVal )
    if(!crcTableValid)
       calculateCRCTable();
 
-   // now calculate the crc
-   char * buf = (char*)buffer;
+   const U8 * buf = (const U8*)buffer;
+
+   // calculate the crc eight bytes at a time
+   // (the bytes are assembled individually so this is independent of endian and alignment)
+   while(len >= 8)
+   {
+      const U32 one = crcVal ^ (U32(buf[0]) | (U32(buf[1]) << 8) | (U32(buf[2]) << 16) | (U32(buf[3]) << 24));
+      const U32 two = U32(buf[4]) | (U32(buf[5]) << 8) | (U32(buf[6]) << 16) | (U32(buf[7]) << 24);
+
+      crcVal = crcTable[7][one & 0xff] ^ crcTable[6][(one >> 8) & 0xff] ^ crcTable[5][(one >> 16) & 0xff] ^ crcTable[4][one >> 24] ^
+               crcTable[3][two & 0xff] ^ crcTable[2][(two >> 8) & 0xff] ^ crcTable[1][(two >> 16) & 0xff] ^ crcTable[0][two >> 24];
+
+      buf += 8;
+      len -= 8;
+   }
+
+   // calculate the crc of the remaining bytes
    for(S32 i = 0; i < len; i++)
-      crcVal = crcTable[(crcVal ^ buf[i]) & 0xff] ^ (crcVal >> 8);
+      crcVal = crcTable[0][(crcVal ^ buf[i]) & 0xff] ^ (crcVal >> 8);
    return(crcVal);
 }
 
@@ -78,13 +108,13 @@ U32 calculateCRCStream(Stream *stream, U32 crcVal )
    // now calculate the crc
    stream->setPosition(0);
    S32 len = stream->getStreamSize();
-   U8 buf[4096];
+   U8 buf[16384];
 
-   S32 segCount = (len + 4095) / 4096;
+   S32 segCount = (len + 16383) / 16384;
 
    for(S32 j = 0; j < segCount; j++)
    {
-      S32 slen = getMin(4096, len - (j * 4096));
+      S32 slen = getMin(16384, len - (j * 16384));
       stream->read(slen, buf);
       crcVal = calculateCRC(buf, slen, crcVal);
    }
@@ -102,6 +102,15 @@ public:
 
     virtual bool            isAssetValid( void ) const                          { return true; }
 
+    /// Whether the asset is still loading any of its data in the background.
+    virtual bool            isAssetLoadPending( void ) const                    { return false; }
+
+    /// Block until any data the asset is loading in the background has loaded.
+    virtual void            finishAssetLoad( void ) {}
+
+    /// An estimate of the memory used by the loaded asset, used to budget idle assets.
+    virtual U32             getAssetMemorySize( void ) const                    { return 0; }
+
     void                    refreshAsset( void );
 
     /// Declare Console Object.
@@ -54,6 +54,18 @@
 #include "console/consoleTypes.h"
 #endif
 
+#ifndef _CONSOLE_VARIABLE_REF_H_
+#include "console/consoleVariableRef.h"
+#endif
+
+#ifndef _FILE_PREFETCH_H_
+#include "io/filePrefetch.h"
+#endif
+
+#ifndef _STRINGUNIT_H_
+#include "string/stringUnit.h"
+#endif
+
 // Script bindings.
 #include "assetManager_ScriptBinding.h"
 
@@ -67,6 +79,11 @@ AssetManager AssetDatabase;
 
 //-----------------------------------------------------------------------------
 
+/// Milliseconds spent loading the assets of asynchronous acquisitions per call to processAsyncAcquires().
+static Con::VariableRef<F32>        sgAsyncAcquireBudget( "pref::AssetManager::asyncAcquireBudget", 4.0f );
+
+//-----------------------------------------------------------------------------
+
 AssetManager::AssetManager() :
     mLoadedInternalAssetsCount( 0 ),
     mLoadedExternalAssetsCount( 0 ),
@@ -75,6 +92,17 @@ AssetManager::AssetManager() :
     mMaxLoadedExternalAssetsCount( 0 ),
     mMaxLoadedPrivateAssetsCount( 0 ),
     mAcquiredReferenceCount( 0 ),
+    mNextAsyncAcquireId( 0 ),
+    mAsyncAcquireDepth( 0 ),
+    mAsyncAcquiring( false ),
+    mIdleUnloadDelay( 0 ),
+    mIdleMemoryBudget( 0 ),
+    mHotReloadInterval( 0 ),
+    mWatchedFilesDirty( true ),
+    mAssetIndexesDirty( true ),
+    mScanCacheFile( StringTable->EmptyString ),
+    mScanCacheLoaded( false ),
+    mScanCacheValidateFiles( true ),
     mEchoInfo( false ),
     mIgnoreAutoUnload( false )
 {
@@ -95,6 +123,12 @@ bool AssetManager::onAdd()
 
 void AssetManager::onRemove()
 {
+    // Release any asynchronous acquisitions.
+    while( mAsyncAcquires.size() > 0 )
+    {
+        releaseAsyncAcquire( mAsyncAcquires.last()->mRequestId );
+    }
+
     // Do we have an asset tags manifest?
     if ( !mAssetTagsManifest.isNull() )
     {
@@ -102,6 +136,13 @@ void AssetManager::onRemove()
         mAssetTagsManifest->deleteObject();
     }
 
+    // Stop watching for changed files.
+    mFileWatcher.stop();
+
+    // Save the declared asset scan cache if it has changed.
+    if ( mScanCacheFile != StringTable->EmptyString && mScanCache.isDirty() )
+        mScanCache.save( mScanCacheFile );
+
     // Call parent.
     Parent::onRemove();
 }
@@ -115,6 +156,11 @@ void AssetManager::initPersistFields()
 
     addField( "EchoInfo", TypeBool, Offset(mEchoInfo, AssetManager), "Whether the asset manager echos extra information to the console or not." );
     addField( "IgnoreAutoUnload", TypeBool, Offset(mIgnoreAutoUnload, AssetManager), "Whether the asset manager should ignore unloading of auto-unload assets or not." );
+    addField( "IdleUnloadDelay", TypeS32, Offset(mIdleUnloadDelay, AssetManager), "The time (in milliseconds) a released auto-unload asset is kept loaded before it can be unloaded.  Zero unloads assets immediately when released unless an idle memory budget is set." );
+    addField( "IdleMemoryBudget", TypeS32, Offset(mIdleMemoryBudget, AssetManager), "The memory (in KB) that released auto-unload assets may keep loaded whilst idle.  Zero unloads all idle assets once the idle unload delay has passed." );
+    addField( "HotReloadInterval", TypeS32, Offset(mHotReloadInterval, AssetManager), "The time (in milliseconds) between checks for changed asset files.  Assets whose files have changed are refreshed automatically.  Zero disables hot reloading." );
+    addField( "ScanCacheFile", TypeString, Offset(mScanCacheFile, AssetManager), "The file used to cache declared asset scans so that unchanged asset files are not parsed again.  Caching is disabled if empty." );
+    addField( "ScanCacheValidateFiles", TypeBool, Offset(mScanCacheValidateFiles, AssetManager), "Whether each cached asset file is checked for changes even when its directory is unchanged.  Disable this when asset files are never modified in place." );
 }
 
 //-----------------------------------------------------------------------------
@@ -298,6 +344,7 @@ StringTableEntry AssetManager::addPrivateAsset( AssetBase* pAssetBase )
 
     // Store in declared assets.
     mDeclaredAssets.insert( pAssetDefinition->mAssetId, pAssetDefinition );
+    mAssetIndexesDirty = true;
 
     // Increase the private loaded asset count.
     if ( ++mLoadedPrivateAssetsCount > mMaxLoadedPrivateAssetsCount )
@@ -393,6 +440,8 @@ bool AssetManager::removeDeclaredAsset( const char* pAssetId )
 
     // Remove from declared assets.
     mDeclaredAssets.erase( declaredAssetItr );
+    mWatchedFilesDirty = true;
+    mAssetIndexesDirty = true;
 
     // Info.
     if ( mEchoInfo )
@@ -810,6 +859,8 @@ bool AssetManager::renameDeclaredAsset( const char* pAssetIdFrom, const char* pA
     // Reinsert declared asset.
     mDeclaredAssets.erase( assetIdFrom );
     mDeclaredAssets.insert( assetIdTo, pAssetDefinition );
+    mWatchedFilesDirty = true;
+    mAssetIndexesDirty = true;
 
     // Info.
     if ( mEchoInfo )
@@ -931,6 +982,21 @@ bool AssetManager::releaseAsset( const char* pAssetId )
                 Con::printf( "Asset Manager: > Releasing to idle state." );
             }
         }
+        // Are we deferring the unload?
+        else if ( (mIdleUnloadDelay > 0 || mIdleMemoryBudget > 0) && !pAssetDefinition->mAssetPrivate )
+        {
+            // Yes, so info.
+            if ( mEchoInfo )
+            {
+                Con::printf( "Asset Manager: > Releasing to idle state for a deferred unload." );
+            }
+
+            // Queue the asset as idle.
+            IdleAsset idleAsset;
+            idleAsset.mAssetId = pAssetDefinition->mAssetId;
+            idleAsset.mReleaseTime = Platform::getRealMilliseconds();
+            mIdleAssets.push_back( idleAsset );
+        }
         else
         {
             // No, so info.
@@ -994,6 +1060,9 @@ void AssetManager::purgeAssets( void )
         unloadAsset( pAssetDefinition );
     }
 
+    // All idle assets have been unloaded.
+    mIdleAssets.clear();
+
     // Info.
     if ( mEchoInfo )
     {
@@ -1003,6 +1072,332 @@ void AssetManager::purgeAssets( void )
 
 //-----------------------------------------------------------------------------
 
+void AssetManager::processIdleAssets( void )
+{
+    // Finish if there are no idle assets.
+    if ( mIdleAssets.size() == 0 )
+        return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_ProcessIdleAssets);
+
+    // Remove any idle assets that have since been unloaded or acquired and total the memory used by the rest.
+    U32 idleMemory = 0;
+    for( S32 index = 0; index < mIdleAssets.size(); )
+    {
+        AssetDefinition* pAssetDefinition = findAsset( mIdleAssets[index].mAssetId );
+
+        if (    pAssetDefinition == NULL ||
+                pAssetDefinition->mpAssetBase == NULL ||
+                pAssetDefinition->mpAssetBase->getAcquiredReferenceCount() > 0 )
+        {
+            mIdleAssets.erase( index );
+            continue;
+        }
+
+        idleMemory += pAssetDefinition->mpAssetBase->getAssetMemorySize();
+        index++;
+    }
+
+    const U32 currentTime = Platform::getRealMilliseconds();
+    const U32 memoryBudget = mIdleMemoryBudget * 1024;
+
+    // Unload the oldest idle assets.
+    while( mIdleAssets.size() > 0 )
+    {
+        const IdleAsset& idleAsset = mIdleAssets.front();
+
+        // Finish if the oldest asset has not been idle long enough.
+        // NOTE: This stops assets that are released and then quickly re-acquired from being reloaded.
+        if ( currentTime - idleAsset.mReleaseTime < mIdleUnloadDelay )
+            break;
+
+        // Finish if the idle assets are within the memory budget.
+        if ( mIdleMemoryBudget > 0 && idleMemory <= memoryBudget )
+            break;
+
+        AssetDefinition* pAssetDefinition = findAsset( idleAsset.mAssetId );
+        mIdleAssets.pop_front();
+
+        // Info.
+        if ( mEchoInfo )
+        {
+            Con::printf( "Asset Manager: Unloading idle asset Id '%s'.", pAssetDefinition->mAssetId );
+        }
+
+        // Unload the asset.
+        const U32 assetMemory = pAssetDefinition->mpAssetBase->getAssetMemorySize();
+        idleMemory = assetMemory < idleMemory ? idleMemory - assetMemory : 0;
+        unloadAsset( pAssetDefinition );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::removeIdleAsset( StringTableEntry assetId )
+{
+    for( typeIdleAssetVector::iterator idleItr = mIdleAssets.begin(); idleItr != mIdleAssets.end(); ++idleItr )
+    {
+        if ( idleItr->mAssetId != assetId )
+            continue;
+
+        mIdleAssets.erase( idleItr );
+        return;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+U32 AssetManager::acquireAssetAsync( const char* pAssetId )
+{
+    // Sanity!
+    AssertFatal( pAssetId != NULL, "Cannot acquire NULL asset Id." );
+
+    Vector<StringTableEntry> assetIds;
+    assetIds.push_back( StringTable->insert( pAssetId ) );
+
+    return preloadAssets( assetIds );
+}
+
+//-----------------------------------------------------------------------------
+
+U32 AssetManager::preloadAssets( const Vector<StringTableEntry>& assetIds )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_PreloadAssets);
+
+    // Create the request.
+    AsyncAcquireRequest* pRequest = new AsyncAcquireRequest();
+    pRequest->mLoadIndex = 0;
+    pRequest->mFailed = false;
+    pRequest->mReleased = false;
+
+    // Compile the load order of the assets.
+    typeAssetIdVisitedHash visitedAssets;
+    for ( Vector<StringTableEntry>::const_iterator assetIdItr = assetIds.begin(); assetIdItr != assetIds.end(); ++assetIdItr )
+    {
+        typeAssetId assetId = *assetIdItr;
+
+        // Skip empty asset Ids.
+        if ( *assetId == 0 )
+            continue;
+
+        // Skip the asset if it does not exist.
+        if ( findAsset( assetId ) == NULL )
+        {
+            // Warn.
+            Con::warnf( "Asset Manager: Failed to acquire asset Id '%s' asynchronously as it does not exist.", assetId );
+            continue;
+        }
+
+        // Skip the asset if it has already been requested.
+        if ( pRequest->mAssetIds.contains( assetId ) )
+            continue;
+
+        pRequest->mAssetIds.push_back( assetId );
+        compileAsyncLoadOrder( pRequest, assetId, true, visitedAssets );
+    }
+
+    // Finish if there is nothing to acquire.
+    if ( pRequest->mAssetIds.size() == 0 )
+    {
+        delete pRequest;
+        return 0;
+    }
+
+    // Read the files of the assets that need loading in the background.
+    for ( Vector<typeAssetId>::iterator assetIdItr = pRequest->mLoadOrder.begin(); assetIdItr != pRequest->mLoadOrder.end(); ++assetIdItr )
+    {
+        AssetDefinition* pAssetDefinition = findAsset( *assetIdItr );
+
+        U32 prefetchSequence = 0;
+        if ( pAssetDefinition->mpAssetBase == NULL )
+        {
+            prefetchSequence = FilePrefetch::queue( pAssetDefinition->mAssetBaseFilePath );
+
+            for ( Vector<StringTableEntry>::iterator looseFileItr = pAssetDefinition->mAssetLooseFiles.begin(); looseFileItr != pAssetDefinition->mAssetLooseFiles.end(); ++looseFileItr )
+            {
+                prefetchSequence = FilePrefetch::queue( *looseFileItr );
+            }
+        }
+
+        pRequest->mPrefetchSequences.push_back( prefetchSequence );
+    }
+
+    // Allocate the request Id, skipping zero.
+    if ( ++mNextAsyncAcquireId == 0 )
+        mNextAsyncAcquireId = 1;
+
+    pRequest->mRequestId = mNextAsyncAcquireId;
+    mAsyncAcquires.push_back( pRequest );
+
+    // Info.
+    if ( mEchoInfo )
+    {
+        Con::printf( "Asset Manager: Started asynchronous acquisition Id '%d' of %d asset(s) loading %d asset(s).",
+            pRequest->mRequestId, pRequest->mAssetIds.size(), pRequest->mLoadOrder.size() );
+    }
+
+    return pRequest->mRequestId;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetManager::isAsyncAcquireComplete( const U32 requestId )
+{
+    // Find the request.
+    AsyncAcquireRequest* pRequest = findAsyncAcquire( requestId );
+
+    // Finish if the request was not found.
+    if ( pRequest == NULL )
+        return false;
+
+    // Finish if assets are still to be loaded.
+    if ( pRequest->mLoadIndex < pRequest->mLoadOrder.size() )
+        return false;
+
+    // Finish if any of the assets are still loading in the background.
+    for ( Vector<typeAssetId>::iterator assetIdItr = pRequest->mLoadOrder.begin(); assetIdItr != pRequest->mLoadOrder.end(); ++assetIdItr )
+    {
+        AssetDefinition* pAssetDefinition = findAsset( *assetIdItr );
+
+        if ( pAssetDefinition != NULL && pAssetDefinition->mpAssetBase != NULL && pAssetDefinition->mpAssetBase->isAssetLoadPending() )
+            return false;
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetManager::isAsyncAcquireFailed( const U32 requestId )
+{
+    // Find the request.
+    AsyncAcquireRequest* pRequest = findAsyncAcquire( requestId );
+
+    return pRequest != NULL && pRequest->mFailed;
+}
+
+//-----------------------------------------------------------------------------
+
+F32 AssetManager::getAsyncAcquireProgress( const U32 requestId )
+{
+    // Find the request.
+    AsyncAcquireRequest* pRequest = findAsyncAcquire( requestId );
+
+    // Finish if the request was not found.
+    if ( pRequest == NULL )
+        return 0.0f;
+
+    return (F32)pRequest->mLoadIndex / (F32)pRequest->mLoadOrder.size();
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetManager::finishAsyncAcquire( const U32 requestId )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_FinishAsyncAcquire);
+
+    // Find the request.
+    AsyncAcquireRequest* pRequest = findAsyncAcquire( requestId );
+
+    // Finish if the request was not found.
+    if ( pRequest == NULL )
+        return false;
+
+    // Load all the remaining assets.
+    U32 loadedCount = 0;
+    mAsyncAcquireDepth++;
+    loadAsyncAcquire( pRequest, true, 0, 0.0f, loadedCount );
+    mAsyncAcquireDepth--;
+
+    // Finish any assets still loading in the background.
+    for ( Vector<typeAssetId>::iterator assetIdItr = pRequest->mLoadOrder.begin(); assetIdItr != pRequest->mLoadOrder.end(); ++assetIdItr )
+    {
+        AssetDefinition* pAssetDefinition = findAsset( *assetIdItr );
+
+        if ( pAssetDefinition != NULL && pAssetDefinition->mpAssetBase != NULL && pAssetDefinition->mpAssetBase->isAssetLoadPending() )
+            pAssetDefinition->mpAssetBase->finishAssetLoad();
+    }
+
+    const bool failed = pRequest->mFailed;
+
+    // Delete any requests released whilst loading.
+    purgeAsyncAcquires();
+
+    return !failed;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetManager::releaseAsyncAcquire( const U32 requestId )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_ReleaseAsyncAcquire);
+
+    // Find the request.
+    AsyncAcquireRequest* pRequest = findAsyncAcquire( requestId );
+
+    // Finish if the request was not found.
+    if ( pRequest == NULL )
+        return false;
+
+    // Flag the request as released.
+    pRequest->mReleased = true;
+
+    // Release the acquired assets.
+    for ( Vector<typeAssetId>::iterator assetIdItr = pRequest->mAcquiredAssetIds.begin(); assetIdItr != pRequest->mAcquiredAssetIds.end(); ++assetIdItr )
+    {
+        releaseAsset( *assetIdItr );
+    }
+    pRequest->mAcquiredAssetIds.clear();
+
+    // Delete the request unless assets are being loaded.
+    purgeAsyncAcquires();
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::processAsyncAcquires( const bool ignoreBudget )
+{
+    // Finish if there are no asynchronous acquisitions.
+    if ( mAsyncAcquires.size() == 0 )
+        return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_ProcessAsyncAcquires);
+
+    // Fetch the budget.
+    const U32 startTime = Platform::getRealMilliseconds();
+    const F32 budget = sgAsyncAcquireBudget;
+
+    // Flag as acquiring asynchronously unless the budget is ignored.
+    const bool asyncAcquiring = mAsyncAcquiring;
+    mAsyncAcquiring = !ignoreBudget;
+    mAsyncAcquireDepth++;
+
+    // Load the assets of each request in turn.
+    // NOTE: Loading assets can run script which may start or release requests so requests are indexed and only deleted afterwards.
+    U32 loadedCount = 0;
+    for ( S32 index = 0; index < mAsyncAcquires.size(); ++index )
+    {
+        // Finish if the budget has been used.
+        if ( !loadAsyncAcquire( mAsyncAcquires[index], ignoreBudget, startTime, budget, loadedCount ) )
+            break;
+    }
+
+    mAsyncAcquireDepth--;
+    mAsyncAcquiring = asyncAcquiring;
+
+    // Delete any requests released whilst loading.
+    purgeAsyncAcquires();
+}
+
+//-----------------------------------------------------------------------------
+
 bool AssetManager::deleteAsset( const char* pAssetId, const bool deleteLooseFiles, const bool deleteDependencies )
 {
     // Debug Profiling.
@@ -1150,6 +1545,9 @@ bool AssetManager::refreshAsset( const char* pAssetId )
     // Fetch asset Id.
     StringTableEntry assetId = StringTable->insert( pAssetId );
 
+    // The asset category may have changed.
+    mAssetIndexesDirty = true;
+
     // Is the asset private?
     if ( pAssetDefinition->mAssetPrivate )
     {
@@ -1185,56 +1583,13 @@ bool AssetManager::refreshAsset( const char* pAssetId )
             // Save asset.
             mTaml.write( pAssetBase, pAssetDefinition->mAssetBaseFilePath );
         
-            // Remove asset dependencies.
-            removeAssetDependencies( pAssetId );
-
-            // Find any new dependencies.
-            TamlAssetDeclaredVisitor assetDeclaredVisitor;
-
-            // Parse the filename.
-            if ( !mTaml.parse( pAssetDefinition->mAssetBaseFilePath, assetDeclaredVisitor ) )
-            {
-                // Warn.
-                Con::warnf( "Asset Manager: Failed to parse file containing asset declaration: '%s'.\nDependencies are now incorrect!", pAssetDefinition->mAssetBaseFilePath );
+            // Update asset dependencies.
+            if ( !updateAssetDependencies( pAssetDefinition ) )
                 return false;
-            }
-
-            // Fetch asset dependencies.
-            TamlAssetDeclaredVisitor::typeAssetIdVector& assetDependencies = assetDeclaredVisitor.getAssetDependencies();
-
-            // Are there any asset dependences?
-            if ( assetDependencies.size() > 0 )
-            {
-                // Yes, so iterate dependencies.
-                for( TamlAssetDeclaredVisitor::typeAssetIdVector::iterator assetDependencyItr = assetDependencies.begin(); assetDependencyItr != assetDependencies.end(); ++assetDependencyItr )
-                {
-                    // Fetch dependency asset Id.
-                    StringTableEntry dependencyAssetId = *assetDependencyItr;
-
-                    // Insert depends-on.
-                    mAssetDependsOn.insertEqual( assetId, dependencyAssetId );
-
-                    // Insert is-depended-on.
-                    mAssetIsDependedOn.insertEqual( dependencyAssetId, assetId );
-                }
-            }
-
-            // Fetch asset loose files.
-            TamlAssetDeclaredVisitor::typeLooseFileVector& assetLooseFiles = assetDeclaredVisitor.getAssetLooseFiles();
 
-            // Clear any existing loose files.
-            pAssetDefinition->mAssetLooseFiles.clear();
-
-            // Are there any loose files?
-            if ( assetLooseFiles.size() > 0 )
-            {
-                // Yes, so iterate loose files.
-                for( TamlAssetDeclaredVisitor::typeLooseFileVector::iterator assetLooseFileItr = assetLooseFiles.begin(); assetLooseFileItr != assetLooseFiles.end(); ++assetLooseFileItr )
-                {
-                    // Store loose file.
-                    pAssetDefinition->mAssetLooseFiles.push_back( *assetLooseFileItr );
-                }
-            }
+            // The asset file was saved by the refresh so don't treat it as having changed.
+            if ( mFileWatcher.isRunning() )
+                mFileWatcher.resetFile( pAssetDefinition->mAssetBaseFilePath );
 
             // Asset refresh notifications.
             for( typeAssetPtrRefreshHash::iterator refreshNotifyItr = mAssetPtrRefreshNotifications.begin(); refreshNotifyItr != mAssetPtrRefreshNotifications.end(); ++refreshNotifyItr )
@@ -1357,45 +1712,218 @@ void AssetManager::refreshAllAssets( const bool includeUnloaded )
 
 //-----------------------------------------------------------------------------
 
-void AssetManager::registerAssetPtrRefreshNotify( AssetPtrBase* pAssetPtrBase, AssetPtrCallback* pCallback )
+void AssetManager::refreshAssets( const Vector<StringTableEntry>& assetIds )
 {
-    // Find an existing notification iterator.
-    typeAssetPtrRefreshHash::iterator notificationItr = mAssetPtrRefreshNotifications.find( pAssetPtrBase );
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_RefreshAssets);
 
-    // Do we have one?
-    if ( notificationItr != mAssetPtrRefreshNotifications.end() )
+    // Gather the assets to refresh.
+    Vector<typeAssetId> refreshAssetIds;
+    typeAssetIdVisitedHash visitedAssets;
+    for( Vector<StringTableEntry>::const_iterator assetIdItr = assetIds.begin(); assetIdItr != assetIds.end(); ++assetIdItr )
     {
-        // Yes, so update the callback.
-        notificationItr->value = pCallback;
-        return;
-    }
+        // Fetch asset Id.
+        typeAssetId assetId = StringTable->insert( *assetIdItr );
 
-    // No, so add one.
-    mAssetPtrRefreshNotifications.insert( pAssetPtrBase, pCallback );
-}
+        // Skip if already gathered.
+        if ( visitedAssets.find( assetId ) != visitedAssets.end() )
+            continue;
 
-//-----------------------------------------------------------------------------
+        // Skip if the asset does not exist.
+        if ( findAsset( assetId ) == NULL )
+        {
+            // Warn.
+            Con::warnf( "Asset Manager: Failed to refresh asset Id '%s' as it does not exist.", assetId );
+            continue;
+        }
 
-void AssetManager::unregisterAssetPtrRefreshNotify( AssetPtrBase* pAssetPtrBase )
-{
-    mAssetPtrRefreshNotifications.erase( pAssetPtrBase );
-}
+        visitedAssets.insert( assetId, true );
+        refreshAssetIds.push_back( assetId );
+    }
 
-//-----------------------------------------------------------------------------
+    // Gather the assets that depend on them, directly or indirectly.
+    // NOTE: The assets are gathered breadth-first so dependencies are generally refreshed before the assets that depend on them.
+    for( S32 index = 0; index < refreshAssetIds.size(); ++index )
+    {
+        // Fetch asset Id.
+        typeAssetId assetId = refreshAssetIds[index];
 
-bool AssetManager::loadAssetTags( ModuleDefinition* pModuleDefinition )
-{
-    // Sanity!
-    AssertFatal( pModuleDefinition != NULL, "Cannot load asset tags manifest using a NULL module definition" );
+        // Iterate the assets that depend on this asset.
+        for( typeAssetIsDependedOnHash::iterator isDependedOnItr = mAssetIsDependedOn.find( assetId ); isDependedOnItr != mAssetIsDependedOn.end() && isDependedOnItr->key == assetId; ++isDependedOnItr )
+        {
+            // Fetch the dependent asset Id.
+            typeAssetId dependentAssetId = isDependedOnItr->value;
 
-    // Expand manifest location.
-    char assetTagsManifestFilePathBuffer[1024];
-    Con::expandPath( assetTagsManifestFilePathBuffer, sizeof(assetTagsManifestFilePathBuffer), pModuleDefinition->getAssetTagsManifest() );
+            // Skip if already gathered.
+            if ( visitedAssets.find( dependentAssetId ) != visitedAssets.end() )
+                continue;
 
-    // Do we already have a manifest?
-    if ( !mAssetTagsManifest.isNull() )
-    {
-        // Yes, so warn.
+            visitedAssets.insert( dependentAssetId, true );
+            refreshAssetIds.push_back( dependentAssetId );
+        }
+    }
+
+    // Finish if nothing to refresh.
+    if ( refreshAssetIds.size() == 0 )
+        return;
+
+    // Info.
+    if ( mEchoInfo )
+    {
+        Con::printSeparator();
+        Con::printf( "Asset Manager: Started refreshing %d assets...", refreshAssetIds.size() );
+    }
+
+    // Notify the loaded assets of the refresh.
+    for( Vector<typeAssetId>::iterator assetIdItr = refreshAssetIds.begin(); assetIdItr != refreshAssetIds.end(); ++assetIdItr )
+    {
+        // Fetch asset definition.
+        AssetDefinition* pAssetDefinition = findAsset( *assetIdItr );
+
+        // Skip if the asset is not loaded or is not allowed to refresh.
+        if ( pAssetDefinition == NULL || pAssetDefinition->mpAssetBase == NULL || !(pAssetDefinition->mAssetPrivate || pAssetDefinition->mAssetRefreshEnable) )
+            continue;
+
+        // Info.
+        if ( mEchoInfo )
+        {
+            Con::printf( "Asset Manager: > Refreshing asset Id '%s'.", *assetIdItr );
+        }
+
+        // Notify asset of asset refresh.
+        pAssetDefinition->mpAssetBase->onAssetRefresh();
+    }
+
+    // Asset refresh notifications.
+    for( typeAssetPtrRefreshHash::iterator refreshNotifyItr = mAssetPtrRefreshNotifications.begin(); refreshNotifyItr != mAssetPtrRefreshNotifications.end(); ++refreshNotifyItr )
+    {
+        // Fetch pointed asset.
+        StringTableEntry pointedAsset = refreshNotifyItr->key->getAssetId();
+
+        // Ignore if the pointed asset was not refreshed.
+        if ( pointedAsset == StringTable->EmptyString || visitedAssets.find( pointedAsset ) == visitedAssets.end() )
+            continue;
+
+        // Perform refresh notification callback.
+        refreshNotifyItr->value->onAssetRefreshed( refreshNotifyItr->key );
+    }
+
+    // Info.
+    if ( mEchoInfo )
+    {
+        Con::printSeparator();
+        Con::printf( "Asset Manager: Finished refreshing %d assets.", refreshAssetIds.size() );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::processFileChanges( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_ProcessFileChanges);
+
+    // Is hot reloading enabled?
+    if ( mHotReloadInterval == 0 )
+    {
+        // No, so stop watching files.
+        if ( mFileWatcher.isRunning() )
+        {
+            mFileWatcher.stop();
+            mWatchedFilesDirty = true;
+        }
+
+        return;
+    }
+
+    // Update the watched files if the declared assets have changed.
+    if ( mWatchedFilesDirty )
+        updateWatchedFiles();
+
+    // Start watching (this does nothing if already watching at the same interval).
+    mFileWatcher.start( mHotReloadInterval );
+
+    // Fetch the changed files.
+    Vector<StringTableEntry> changedFiles;
+    if ( !mFileWatcher.getChangedFiles( changedFiles ) )
+        return;
+
+    // Gather the assets using the changed files.
+    Vector<StringTableEntry> changedAssetIds;
+    for( Vector<StringTableEntry>::iterator fileItr = changedFiles.begin(); fileItr != changedFiles.end(); ++fileItr )
+    {
+        // Fetch file.
+        StringTableEntry file = *fileItr;
+
+        // Info.
+        if ( mEchoInfo )
+        {
+            Con::printf( "Asset Manager: File '%s' has changed.", file );
+        }
+
+        for( typeWatchedFilesHash::iterator watchedItr = mWatchedFiles.find( file ); watchedItr != mWatchedFiles.end() && watchedItr->key == file; ++watchedItr )
+        {
+            // Fetch asset definition.
+            AssetDefinition* pAssetDefinition = findAsset( watchedItr->value );
+
+            // Skip if the asset no longer exists.
+            if ( pAssetDefinition == NULL )
+                continue;
+
+            // Read the asset declaration back if it has changed.
+            if ( pAssetDefinition->mAssetBaseFilePath == file )
+                reloadAssetDeclaration( pAssetDefinition );
+
+            if ( !changedAssetIds.contains( pAssetDefinition->mAssetId ) )
+                changedAssetIds.push_back( pAssetDefinition->mAssetId );
+        }
+    }
+
+    // Refresh the changed assets and their dependents together.
+    refreshAssets( changedAssetIds );
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::registerAssetPtrRefreshNotify( AssetPtrBase* pAssetPtrBase, AssetPtrCallback* pCallback )
+{
+    // Find an existing notification iterator.
+    typeAssetPtrRefreshHash::iterator notificationItr = mAssetPtrRefreshNotifications.find( pAssetPtrBase );
+
+    // Do we have one?
+    if ( notificationItr != mAssetPtrRefreshNotifications.end() )
+    {
+        // Yes, so update the callback.
+        notificationItr->value = pCallback;
+        return;
+    }
+
+    // No, so add one.
+    mAssetPtrRefreshNotifications.insert( pAssetPtrBase, pCallback );
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::unregisterAssetPtrRefreshNotify( AssetPtrBase* pAssetPtrBase )
+{
+    mAssetPtrRefreshNotifications.erase( pAssetPtrBase );
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetManager::loadAssetTags( ModuleDefinition* pModuleDefinition )
+{
+    // Sanity!
+    AssertFatal( pModuleDefinition != NULL, "Cannot load asset tags manifest using a NULL module definition" );
+
+    // Expand manifest location.
+    char assetTagsManifestFilePathBuffer[1024];
+    Con::expandPath( assetTagsManifestFilePathBuffer, sizeof(assetTagsManifestFilePathBuffer), pModuleDefinition->getAssetTagsManifest() );
+
+    // Do we already have a manifest?
+    if ( !mAssetTagsManifest.isNull() )
+    {
+        // Yes, so warn.
         Con::warnf( "Asset Manager: Cannot load asset tags manifest from module '%s' as one is already loaded.", pModuleDefinition->getSignature() );
         return false;
     }
@@ -1662,56 +2190,8 @@ S32 AssetManager::findAssetCategory( AssetQuery* pAssetQuery, const char* pAsset
     // Fetch asset category.
     StringTableEntry assetCategory = StringTable->insert( pAssetCategory );
 
-    // Reset result count.
-    S32 resultCount = 0;
-
-    // Use asset-query as the source?
-    if ( assetQueryAsSource )
-    {
-        AssetQuery filteredAssets;
-
-        // Yes, so iterate asset query.
-        for( Vector<StringTableEntry>::iterator assetItr = pAssetQuery->begin(); assetItr != pAssetQuery->end(); ++assetItr )
-        {
-            // Fetch asset definition.
-            AssetDefinition* pAssetDefinition = findAsset( *assetItr );
-
-            // Skip if this is not the asset we want.
-            if (    pAssetDefinition == NULL ||
-                    pAssetDefinition->mAssetCategory != assetCategory )
-                        continue;
-
-            // Store as result.
-            filteredAssets.push_back( pAssetDefinition->mAssetId );
-
-            // Increase result count.
-            resultCount++;
-        }
-
-        // Set asset query.
-        pAssetQuery->set( filteredAssets );
-    }
-    else
-    {
-        // No, so iterate declared assets.
-        for( typeDeclaredAssetsHash::iterator assetItr = mDeclaredAssets.begin(); assetItr != mDeclaredAssets.end(); ++assetItr )
-        {
-            // Fetch asset definition.
-            AssetDefinition* pAssetDefinition = assetItr->value;
-
-            // Skip if this is not the asset we want.
-            if ( assetCategory != pAssetDefinition->mAssetCategory )
-                continue;
-
-            // Store as result.
-            pAssetQuery->push_back( pAssetDefinition->mAssetId );
-
-            // Increase result count.
-            resultCount++;
-        }
-    }
-
-    return resultCount;
+    // Find the assets.
+    return findIndexedAssets( pAssetQuery, mAssetCategoryIndex, assetCategory, assetQueryAsSource );
 }
 
 S32 AssetManager::findAssetAutoUnload( AssetQuery* pAssetQuery, const bool assetAutoUnload, const bool assetQueryAsSource )
@@ -1912,56 +2392,8 @@ S32 AssetManager::findAssetType( AssetQuery* pAssetQuery, const char* pAssetType
     // Fetch asset type.
     StringTableEntry assetType = StringTable->insert( pAssetType );
 
-    // Reset result count.
-    S32 resultCount = 0;
-
-    // Use asset-query as the source?
-    if ( assetQueryAsSource )
-    {
-        AssetQuery filteredAssets;
-
-        // Yes, so iterate asset query.
-        for( Vector<StringTableEntry>::iterator assetItr = pAssetQuery->begin(); assetItr != pAssetQuery->end(); ++assetItr )
-        {
-            // Fetch asset definition.
-            AssetDefinition* pAssetDefinition = findAsset( *assetItr );
-
-            // Skip if this is not the asset we want.
-            if (    pAssetDefinition == NULL ||
-                    pAssetDefinition->mAssetType != assetType )
-                        continue;
-
-            // Store as result.
-            filteredAssets.push_back( pAssetDefinition->mAssetId );
-
-            // Increase result count.
-            resultCount++;
-        }
-
-        // Set asset query.
-        pAssetQuery->set( filteredAssets );
-    }
-    else
-    {
-        // No, so iterate declared assets.
-        for( typeDeclaredAssetsHash::iterator assetItr = mDeclaredAssets.begin(); assetItr != mDeclaredAssets.end(); ++assetItr )
-        {
-            // Fetch asset definition.
-            AssetDefinition* pAssetDefinition = assetItr->value;
-
-            // Skip if this is not the asset we want.
-            if ( assetType != pAssetDefinition->mAssetType )
-                continue;
-
-            // Store as result.
-            pAssetQuery->push_back( pAssetDefinition->mAssetId );
-
-            // Increase result count.
-            resultCount++;
-        }
-    }
-
-    return resultCount;
+    // Find the assets.
+    return findIndexedAssets( pAssetQuery, mAssetTypeIndex, assetType, assetQueryAsSource );
 }
 
 //-----------------------------------------------------------------------------
@@ -2131,9 +2563,24 @@ S32 AssetManager::findTaggedAssets( AssetQuery* pAssetQuery, const char* pAssetT
     // Use asset-query as the source?
     if ( assetQueryAsSource )
     {
+        // Yes, so gather the tagged assets.
+        typeAssetIdVisitedHash taggedAssets;
+        for ( Vector<AssetTagsManifest::AssetTag*>::iterator assetTagItr = assetTags.begin(); assetTagItr != assetTags.end(); ++assetTagItr )
+        {
+            // Fetch asset tag.
+            AssetTagsManifest::AssetTag* pAssetTag = *assetTagItr;
+
+            // Iterate tagged assets.
+            for ( Vector<typeAssetId>::iterator assetItr = pAssetTag->mAssets.begin(); assetItr != pAssetTag->mAssets.end(); ++assetItr )
+            {
+                taggedAssets.insert( *assetItr, true );
+            }
+        }
+
         AssetQuery filteredAssets;
+        typeAssetIdVisitedHash filteredAssetIds;
 
-        // Yes, so iterate asset query.
+        // Iterate asset query.
         for( Vector<StringTableEntry>::iterator assetItr = pAssetQuery->begin(); assetItr != pAssetQuery->end(); ++assetItr )
         {
             // Fetch asset Id.
@@ -2143,37 +2590,20 @@ S32 AssetManager::findTaggedAssets( AssetQuery* pAssetQuery, const char* pAssetT
             if ( !isDeclaredAsset( assetId ) )
                 continue;
 
-            // Reset matched flag.
-            bool assetTagMatched = false;
-
-            // Iterate asset tags.
-            for ( Vector<AssetTagsManifest::AssetTag*>::iterator assetTagItr = assetTags.begin(); assetTagItr != assetTags.end(); ++assetTagItr )
-            {
-                // Fetch asset tag.
-                AssetTagsManifest::AssetTag* pAssetTag = *assetTagItr;
+            // Skip if asset is not tagged.
+            if ( taggedAssets.find( assetId ) == taggedAssets.end() )
+                continue;
 
-                // Skip if asset is not tagged.
-                if ( !pAssetTag->containsAsset( assetId ) )
-                    continue;
-                
-                // Flag as matched.
-                assetTagMatched = true;
-                break;
-            }
+            // Skip if asset is already present.
+            if ( filteredAssetIds.find( assetId ) != filteredAssetIds.end() )
+                continue;
 
-            // Did we find a match?
-            if ( assetTagMatched )
-            {
-                // Yes, so is asset already present?
-                if ( !filteredAssets.containsAsset( assetId ) )
-                {
-                    // No, so store as result.
-                    filteredAssets.push_back( assetId );
+            // Store as result.
+            filteredAssets.push_back( assetId );
+            filteredAssetIds.insert( assetId, true );
 
-                    // Increase result count.
-                    resultCount++;
-                }
-            }
+            // Increase result count.
+            resultCount++;
         }
 
         // Set asset query.
@@ -2181,6 +2611,13 @@ S32 AssetManager::findTaggedAssets( AssetQuery* pAssetQuery, const char* pAssetT
     }
     else
     {
+        // Note the assets already present.
+        typeAssetIdVisitedHash presentAssetIds;
+        for( Vector<StringTableEntry>::iterator assetItr = pAssetQuery->begin(); assetItr != pAssetQuery->end(); ++assetItr )
+        {
+            presentAssetIds.insert( *assetItr, true );
+        }
+
         // Iterate asset tags.
         for ( Vector<AssetTagsManifest::AssetTag*>::iterator assetTagItr = assetTags.begin(); assetTagItr != assetTags.end(); ++assetTagItr )
         {
@@ -2194,9 +2631,11 @@ S32 AssetManager::findTaggedAssets( AssetQuery* pAssetQuery, const char* pAssetT
                 StringTableEntry assetId = *assetItr;
 
                 // Skip if asset Id is already present.
-                if ( pAssetQuery->containsAsset( assetId ) )
+                if ( presentAssetIds.find( assetId ) != presentAssetIds.end() )
                     continue;
 
+                presentAssetIds.insert( assetId, true );
+
                 // Store as result.
                 pAssetQuery->push_back( assetId );
 
@@ -2227,89 +2666,16 @@ S32 AssetManager::findAssetLooseFile( AssetQuery* pAssetQuery, const char* pLoos
     // Fetch asset loose file.
     StringTableEntry looseFile = StringTable->insert( looseFileBuffer );
 
-    // Reset result count.
-    S32 resultCount = 0;
+    // Find the assets.
+    return findIndexedAssets( pAssetQuery, mAssetLooseFileIndex, looseFile, assetQueryAsSource );
+}
 
-    // Use asset-query as the source?
-    if ( assetQueryAsSource )
-    {
-        AssetQuery filteredAssets;
+//-----------------------------------------------------------------------------
 
-        // Yes, so iterate asset query.
-        for( Vector<StringTableEntry>::iterator assetItr = pAssetQuery->begin(); assetItr != pAssetQuery->end(); ++assetItr )
-        {
-            // Fetch asset definition.
-            AssetDefinition* pAssetDefinition = findAsset( *assetItr );
-
-            // Fetch loose files.
-            Vector<StringTableEntry>& assetLooseFiles = pAssetDefinition->mAssetLooseFiles;
-
-            // Skip if this asset has no loose files.
-            if ( assetLooseFiles.size() == 0 )
-                continue;
-
-            // Search the assets loose files.
-            for( Vector<StringTableEntry>::iterator looseFileItr = assetLooseFiles.begin(); looseFileItr != assetLooseFiles.end(); ++looseFileItr )
-            {
-                // Is this the loose file we are searching for?
-                if ( *looseFileItr != looseFile )
-                    continue;
-
-                // Store as result.
-                filteredAssets.push_back( pAssetDefinition->mAssetId );
-
-                // Increase result count.
-                resultCount++;
-
-                break;
-            }
-        }
-
-        // Set asset query.
-        pAssetQuery->set( filteredAssets );
-    }
-    else
-    {
-        // No, so iterate declared assets.
-        for( typeDeclaredAssetsHash::iterator assetItr = mDeclaredAssets.begin(); assetItr != mDeclaredAssets.end(); ++assetItr )
-        {
-            // Fetch asset definition.
-            AssetDefinition* pAssetDefinition = assetItr->value;
-
-            // Fetch loose files.
-            Vector<StringTableEntry>& assetLooseFiles = pAssetDefinition->mAssetLooseFiles;
-
-            // Skip if this asset has no loose files.
-            if ( assetLooseFiles.size() == 0 )
-                continue;
-
-            // Search the assets loose files.
-            for( Vector<StringTableEntry>::iterator looseFileItr = assetLooseFiles.begin(); looseFileItr != assetLooseFiles.end(); ++looseFileItr )
-            {
-                // Is this the loose file we are searching for?
-                if ( *looseFileItr != looseFile )
-                    continue;
-
-                // Store as result.
-                pAssetQuery->push_back( pAssetDefinition->mAssetId );
-
-                // Increase result count.
-                resultCount++;
-
-                break;
-            }
-        }
-    }
-
-    return resultCount;
-}
-
-//-----------------------------------------------------------------------------
-
-bool AssetManager::scanDeclaredAssets( const char* pPath, const char* pExtension, const bool recurse, ModuleDefinition* pModuleDefinition )
-{
-    // Debug Profiling.
-    PROFILE_SCOPE(AssetManager_ScanDeclaredAssets);
+bool AssetManager::scanDeclaredAssets( const char* pPath, const char* pExtension, const bool recurse, ModuleDefinition* pModuleDefinition )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_ScanDeclaredAssets);
 
     // Sanity!
     AssertFatal( pPath != NULL, "Cannot scan declared assets with NULL path." );
@@ -2319,15 +2685,30 @@ bool AssetManager::scanDeclaredAssets( const char* pPath, const char* pExtension
     char pathBuffer[1024];
     Con::expandPath( pathBuffer, sizeof(pathBuffer), pPath );
 
+    // Is the scan cache in use?
+    const bool useScanCache = mScanCacheFile != StringTable->EmptyString;
+
+    // Load the scan cache if it's not been loaded.
+    if ( useScanCache && !mScanCacheLoaded )
+    {
+        mScanCache.load( mScanCacheFile );
+        mScanCacheLoaded = true;
+    }
+
     // Find files.
+    // NOTE: The scan cache reuses the files found previously if none of the directories have changed.
     Vector<Platform::FileInfo> files;
-    if ( !Platform::dumpPath( pathBuffer, files, recurse ? -1 : 0 ) )
+    bool filesCached = false;
+    if ( !(useScanCache ? mScanCache.getDirectoryCache().dumpPath( pathBuffer, files, recurse ? -1 : 0, &filesCached ) : Platform::dumpPath( pathBuffer, files, recurse ? -1 : 0 )) )
     {
         // Failed so warn.
         Con::warnf( "Asset Manager: Failed to scan declared assets in directory '%s'.", pathBuffer );
         return false;
     }
 
+    // Trust the cached scan results of files in unchanged directories unless validating files.
+    const bool trustScanCache = filesCached && !mScanCacheValidateFiles;
+
     // Is the asset file-path located within the specified module?
     if ( !Con::isBasePath( pathBuffer, pModuleDefinition->getModulePath() ) )
     {
@@ -2380,12 +2761,28 @@ bool AssetManager::scanDeclaredAssets( const char* pPath, const char* pExtension
         char assetFileBuffer[1024];
         dSprintf( assetFileBuffer, sizeof(assetFileBuffer), "%s/%s", fileInfo.pFullPath, fileInfo.pFileName );
 
-        // Parse the filename.
-        if ( !mTaml.parse( assetFileBuffer, assetDeclaredVisitor ) )
+        // Fetch the asset file-path.
+        StringTableEntry assetFilePath = StringTable->insert( assetFileBuffer );
+
+        // Fetch the modified time if the scan cache is in use and the file needs checking.
+        FileTime modifiedTime;
+        const bool trustedScan = trustScanCache && mScanCache.find( assetFilePath, assetDeclaredVisitor );
+        const bool scanCacheable = !trustedScan && useScanCache && Platform::getFileTimes( assetFilePath, NULL, &modifiedTime );
+
+        // Are the scan results for the file cached?
+        if ( !trustedScan && (!scanCacheable || !mScanCache.find( assetFilePath, fileInfo.fileSize, modifiedTime, assetDeclaredVisitor )) )
         {
-            // Warn.
-            Con::warnf( "Asset Manager: Failed to parse file containing asset declaration: '%s'.", assetFileBuffer );
-            continue;
+            // No, so parse the filename.
+            if ( !mTaml.parse( assetFileBuffer, assetDeclaredVisitor ) )
+            {
+                // Warn.
+                Con::warnf( "Asset Manager: Failed to parse file containing asset declaration: '%s'.", assetFileBuffer );
+                continue;
+            }
+
+            // Cache the scan results.
+            if ( scanCacheable )
+                mScanCache.insert( assetFilePath, fileInfo.fileSize, modifiedTime, assetDeclaredVisitor );
         }
 
         // Fetch asset definition.
@@ -2429,6 +2826,8 @@ bool AssetManager::scanDeclaredAssets( const char* pPath, const char* pExtension
 
         // Store in declared assets.
         mDeclaredAssets.insert( pAssetDefinition->mAssetId, pAssetDefinition );
+        mWatchedFilesDirty = true;
+        mAssetIndexesDirty = true;
 
         // Store in module assets.
         moduleAssets.push_back( pAssetDefinition );
@@ -2625,6 +3024,131 @@ bool AssetManager::scanReferencedAssets( const char* pPath, const char* pExtensi
 
 //-----------------------------------------------------------------------------
 
+void AssetManager::compileAsyncLoadOrder( AsyncAcquireRequest* pRequest, typeAssetId assetId, const bool requested, typeAssetIdVisitedHash& visitedAssets )
+{
+    // Finish if the asset has already been visited.
+    if ( visitedAssets.find( assetId ) != visitedAssets.end() )
+        return;
+
+    // Fetch asset definition.
+    AssetDefinition* pAssetDefinition = findAsset( assetId );
+
+    // Finish if a dependency does not exist or is already loaded as its own dependencies will be too.
+    if ( !requested && (pAssetDefinition == NULL || pAssetDefinition->mpAssetBase != NULL) )
+        return;
+
+    visitedAssets.insert( assetId, true );
+
+    // Add the dependencies before the asset.
+    for ( typeAssetDependsOnHash::iterator dependencyItr = mAssetDependsOn.find( assetId ); dependencyItr != mAssetDependsOn.end() && dependencyItr->key == assetId; ++dependencyItr )
+    {
+        compileAsyncLoadOrder( pRequest, dependencyItr->value, false, visitedAssets );
+    }
+
+    pRequest->mLoadOrder.push_back( assetId );
+}
+
+//-----------------------------------------------------------------------------
+
+AssetManager::AsyncAcquireRequest* AssetManager::findAsyncAcquire( const U32 requestId )
+{
+    for ( typeAsyncAcquireVector::iterator requestItr = mAsyncAcquires.begin(); requestItr != mAsyncAcquires.end(); ++requestItr )
+    {
+        if ( (*requestItr)->mRequestId == requestId && !(*requestItr)->mReleased )
+            return *requestItr;
+    }
+
+    // Warn.
+    Con::warnf( "Asset Manager: Cannot find asynchronous acquisition Id '%d'.", requestId );
+    return NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetManager::loadAsyncAcquire( AsyncAcquireRequest* pRequest, const bool ignoreBudget, const U32 startTime, const F32 budget, U32& loadedCount )
+{
+    // Fetch the files read so far.
+    const U32 prefetchedSequence = FilePrefetch::getCompletedSequence();
+
+    while ( !pRequest->mReleased && pRequest->mLoadIndex < pRequest->mLoadOrder.size() )
+    {
+        if ( !ignoreBudget )
+        {
+            // Finish if the budget has been used.
+            // NOTE: At least one asset is always loaded so that progress is made.
+            if ( loadedCount > 0 && (F32)(Platform::getRealMilliseconds() - startTime) >= budget )
+                return false;
+
+            // Move onto the next request if the asset files haven't been read yet.
+            if ( pRequest->mPrefetchSequences[pRequest->mLoadIndex] > prefetchedSequence )
+                return true;
+        }
+
+        // Acquire the asset.
+        typeAssetId assetId = pRequest->mLoadOrder[pRequest->mLoadIndex++];
+        const bool requested = pRequest->mAssetIds.contains( assetId );
+        loadedCount++;
+        if ( acquireAsset<AssetBase>( assetId ) == NULL )
+        {
+            // Flag as failed if a requested asset could not be acquired.
+            if ( requested )
+                pRequest->mFailed = true;
+
+            continue;
+        }
+
+        // Release the asset immediately if the request was released whilst it was loading.
+        if ( pRequest->mReleased )
+        {
+            releaseAsset( assetId );
+            break;
+        }
+
+        pRequest->mAcquiredAssetIds.push_back( assetId );
+
+        // Skip if assets are still to be loaded.
+        if ( pRequest->mLoadIndex < pRequest->mLoadOrder.size() )
+            continue;
+
+        // Release the dependencies as they are now held by the assets that depend on them.
+        for ( S32 index = pRequest->mAcquiredAssetIds.size()-1; index >= 0; --index )
+        {
+            typeAssetId acquiredAssetId = pRequest->mAcquiredAssetIds[index];
+
+            if ( pRequest->mAssetIds.contains( acquiredAssetId ) )
+                continue;
+
+            pRequest->mAcquiredAssetIds.erase( index );
+            releaseAsset( acquiredAssetId );
+        }
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::purgeAsyncAcquires( void )
+{
+    // Finish if assets are being loaded.
+    if ( mAsyncAcquireDepth > 0 )
+        return;
+
+    // Delete the released requests.
+    for ( S32 index = mAsyncAcquires.size()-1; index >= 0; --index )
+    {
+        AsyncAcquireRequest* pRequest = mAsyncAcquires[index];
+
+        if ( !pRequest->mReleased )
+            continue;
+
+        mAsyncAcquires.erase( index );
+        delete pRequest;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 AssetDefinition* AssetManager::findAsset( const char* pAssetId )
 {
     // Debug Profiling.
@@ -2926,6 +3450,263 @@ void AssetManager::removeAssetDependencies( const char* pAssetId )
 
 //-----------------------------------------------------------------------------
 
+bool AssetManager::updateAssetDependencies( AssetDefinition* pAssetDefinition )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_UpdateAssetDependencies);
+
+    // Fetch asset Id.
+    StringTableEntry assetId = pAssetDefinition->mAssetId;
+
+    // Remove asset dependencies.
+    removeAssetDependencies( assetId );
+
+    // Find any new dependencies.
+    TamlAssetDeclaredVisitor assetDeclaredVisitor;
+
+    // Parse the filename.
+    if ( !mTaml.parse( pAssetDefinition->mAssetBaseFilePath, assetDeclaredVisitor ) )
+    {
+        // Warn.
+        Con::warnf( "Asset Manager: Failed to parse file containing asset declaration: '%s'.\nDependencies are now incorrect!", pAssetDefinition->mAssetBaseFilePath );
+        return false;
+    }
+
+    // Fetch asset dependencies.
+    TamlAssetDeclaredVisitor::typeAssetIdVector& assetDependencies = assetDeclaredVisitor.getAssetDependencies();
+
+    // Are there any asset dependences?
+    if ( assetDependencies.size() > 0 )
+    {
+        // Yes, so iterate dependencies.
+        for( TamlAssetDeclaredVisitor::typeAssetIdVector::iterator assetDependencyItr = assetDependencies.begin(); assetDependencyItr != assetDependencies.end(); ++assetDependencyItr )
+        {
+            // Fetch dependency asset Id.
+            StringTableEntry dependencyAssetId = *assetDependencyItr;
+
+            // Insert depends-on.
+            mAssetDependsOn.insertEqual( assetId, dependencyAssetId );
+
+            // Insert is-depended-on.
+            mAssetIsDependedOn.insertEqual( dependencyAssetId, assetId );
+        }
+    }
+
+    // Fetch asset loose files.
+    TamlAssetDeclaredVisitor::typeLooseFileVector& assetLooseFiles = assetDeclaredVisitor.getAssetLooseFiles();
+
+    // Clear any existing loose files.
+    pAssetDefinition->mAssetLooseFiles.clear();
+
+    // Are there any loose files?
+    if ( assetLooseFiles.size() > 0 )
+    {
+        // Yes, so iterate loose files.
+        for( TamlAssetDeclaredVisitor::typeLooseFileVector::iterator assetLooseFileItr = assetLooseFiles.begin(); assetLooseFileItr != assetLooseFiles.end(); ++assetLooseFileItr )
+        {
+            // Store loose file.
+            pAssetDefinition->mAssetLooseFiles.push_back( *assetLooseFileItr );
+        }
+    }
+
+    // The loose files may have changed.
+    mWatchedFilesDirty = true;
+    mAssetIndexesDirty = true;
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetManager::reloadAssetDeclaration( AssetDefinition* pAssetDefinition )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_ReloadAssetDeclaration);
+
+    // Fetch the asset.
+    AssetBase* pAssetBase = pAssetDefinition->mpAssetBase;
+
+    // Is the asset loaded?
+    if ( pAssetBase != NULL && !pAssetDefinition->mAssetPrivate )
+    {
+        // Yes, so read the changed asset declaration.
+        SimObject* pSimObject = mTaml.read( pAssetDefinition->mAssetBaseFilePath );
+        AssetBase* pChangedAssetBase = dynamic_cast<AssetBase*>( pSimObject );
+
+        // Is it still the same type of asset?
+        if ( pChangedAssetBase == NULL || pChangedAssetBase->getClassRep() != pAssetBase->getClassRep() )
+        {
+            // No, so warn.
+            Con::warnf( "Asset Manager: Failed to reload asset Id '%s' as its file '%s' no longer declares the same type of asset.",
+                pAssetDefinition->mAssetId, pAssetDefinition->mAssetBaseFilePath );
+
+            if ( pSimObject != NULL )
+                pSimObject->deleteObject();
+
+            return false;
+        }
+
+        // Copy the changed fields into the loaded asset.
+        // NOTE: The asset is flagged as uninitialized whilst copying so that each field does not refresh (and save) the asset.
+        pAssetBase->mAssetInitialized = false;
+        pChangedAssetBase->copyTo( pAssetBase );
+        pAssetBase->mAssetInitialized = true;
+
+        // Delete the changed asset.
+        pChangedAssetBase->deleteObject();
+    }
+
+    // Update asset dependencies.
+    return updateAssetDependencies( pAssetDefinition );
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::updateWatchedFiles( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_UpdateWatchedFiles);
+
+    mWatchedFiles.clear();
+
+    // Gather the declaration and loose files of the declared assets.
+    Vector<StringTableEntry> files;
+    for( typeDeclaredAssetsHash::iterator assetItr = mDeclaredAssets.begin(); assetItr != mDeclaredAssets.end(); ++assetItr )
+    {
+        // Fetch asset definition.
+        AssetDefinition* pAssetDefinition = assetItr->value;
+
+        // Skip private assets as they have no files.
+        if ( pAssetDefinition->mAssetPrivate )
+            continue;
+
+        // Add the declaration file.
+        if ( mWatchedFiles.find( pAssetDefinition->mAssetBaseFilePath ) == mWatchedFiles.end() )
+            files.push_back( pAssetDefinition->mAssetBaseFilePath );
+        mWatchedFiles.insertEqual( pAssetDefinition->mAssetBaseFilePath, assetItr->key );
+
+        // Add the loose files.
+        for( Vector<StringTableEntry>::iterator looseFileItr = pAssetDefinition->mAssetLooseFiles.begin(); looseFileItr != pAssetDefinition->mAssetLooseFiles.end(); ++looseFileItr )
+        {
+            if ( mWatchedFiles.find( *looseFileItr ) == mWatchedFiles.end() )
+                files.push_back( *looseFileItr );
+            mWatchedFiles.insertEqual( *looseFileItr, assetItr->key );
+        }
+    }
+
+    mFileWatcher.setFiles( files );
+    mWatchedFilesDirty = false;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::updateAssetIndexes( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_UpdateAssetIndexes);
+
+    mAssetTypeIndex.clear();
+    mAssetCategoryIndex.clear();
+    mAssetLooseFileIndex.clear();
+
+    // Iterate declared assets.
+    for( typeDeclaredAssetsHash::iterator assetItr = mDeclaredAssets.begin(); assetItr != mDeclaredAssets.end(); ++assetItr )
+    {
+        // Fetch asset definition.
+        AssetDefinition* pAssetDefinition = assetItr->value;
+
+        // Index the type and category.
+        mAssetTypeIndex.insertEqual( pAssetDefinition->mAssetType, pAssetDefinition->mAssetId );
+        mAssetCategoryIndex.insertEqual( pAssetDefinition->mAssetCategory, pAssetDefinition->mAssetId );
+
+        // Fetch loose files.
+        Vector<StringTableEntry>& assetLooseFiles = pAssetDefinition->mAssetLooseFiles;
+
+        // Index the loose files.
+        for( U32 looseFileIndex = 0; looseFileIndex < (U32)assetLooseFiles.size(); ++looseFileIndex )
+        {
+            // Fetch loose file.
+            StringTableEntry looseFile = assetLooseFiles[looseFileIndex];
+
+            // Skip if the asset has already been indexed with this loose file.
+            bool duplicate = false;
+            for( U32 previousIndex = 0; previousIndex < looseFileIndex && !duplicate; ++previousIndex )
+                duplicate = assetLooseFiles[previousIndex] == looseFile;
+
+            if ( duplicate )
+                continue;
+
+            mAssetLooseFileIndex.insertEqual( looseFile, pAssetDefinition->mAssetId );
+        }
+    }
+
+    mAssetIndexesDirty = false;
+}
+
+//-----------------------------------------------------------------------------
+
+S32 AssetManager::findIndexedAssets( AssetQuery* pAssetQuery, typeAssetIndexHash& assetIndex, StringTableEntry key, const bool assetQueryAsSource )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_FindIndexedAssets);
+
+    // Update the indexes if the declared assets have changed.
+    if ( mAssetIndexesDirty )
+        updateAssetIndexes();
+
+    // Reset result count.
+    S32 resultCount = 0;
+
+    // Find the first indexed asset.
+    typeAssetIndexHash::iterator indexItr = assetIndex.find( key );
+
+    // Use asset-query as the source?
+    if ( assetQueryAsSource )
+    {
+        // Yes, so gather the indexed assets.
+        typeAssetIdVisitedHash indexedAssets;
+        for( ; indexItr != assetIndex.end() && indexItr->key == key; ++indexItr )
+        {
+            indexedAssets.insert( indexItr->value, true );
+        }
+
+        AssetQuery filteredAssets;
+
+        // Iterate asset query.
+        for( Vector<StringTableEntry>::iterator assetItr = pAssetQuery->begin(); assetItr != pAssetQuery->end(); ++assetItr )
+        {
+            // Skip if this is not an asset we want.
+            if ( indexedAssets.find( *assetItr ) == indexedAssets.end() )
+                continue;
+
+            // Store as result.
+            filteredAssets.push_back( *assetItr );
+
+            // Increase result count.
+            resultCount++;
+        }
+
+        // Set asset query.
+        pAssetQuery->set( filteredAssets );
+    }
+    else
+    {
+        // No, so iterate the indexed assets.
+        for( ; indexItr != assetIndex.end() && indexItr->key == key; ++indexItr )
+        {
+            // Store as result.
+            pAssetQuery->push_back( indexItr->value );
+
+            // Increase result count.
+            resultCount++;
+        }
+    }
+
+    return resultCount;
+}
+
+//-----------------------------------------------------------------------------
+
 void AssetManager::unloadAsset( AssetDefinition* pAssetDefinition )
 {
     // Debug Profiling.
@@ -59,6 +59,14 @@
 #include "assets/assetFieldTypes.h"
 #endif
 
+#ifndef _ASSET_SCAN_CACHE_H_
+#include "assets/assetScanCache.h"
+#endif
+
+#ifndef _FILE_WATCHER_H_
+#include "io/fileWatcher.h"
+#endif
+
 // Debug Profiling.
 #include "debug/profiler.h"
 
@@ -81,10 +89,42 @@ private:
     typedef HashTable<typeAssetId, typeAssetId> typeAssetDependsOnHash;
     typedef HashTable<typeAssetId, typeAssetId> typeAssetIsDependedOnHash;
     typedef HashMap<AssetPtrBase*, AssetPtrCallback*> typeAssetPtrRefreshHash;
+    typedef HashMap<typeAssetId, bool> typeAssetIdVisitedHash;
+    typedef HashTable<StringTableEntry, typeAssetId> typeWatchedFilesHash;
+    typedef HashTable<StringTableEntry, typeAssetId> typeAssetIndexHash;
+
+    /// An asynchronous acquisition of assets and all their dependencies.
+    struct AsyncAcquireRequest
+    {
+        U32                     mRequestId;
+        Vector<typeAssetId>     mAssetIds;              ///< The assets requested.
+        Vector<typeAssetId>     mLoadOrder;             ///< The assets to load with dependencies before the assets that depend on them.
+        Vector<U32>             mPrefetchSequences;     ///< The prefetch sequence each asset in the load order waits for.
+        Vector<typeAssetId>     mAcquiredAssetIds;      ///< The assets this request holds references to.
+        S32                     mLoadIndex;
+        bool                    mFailed;
+        bool                    mReleased;
+    };
+    typedef Vector<AsyncAcquireRequest*> typeAsyncAcquireVector;
+
+    /// Asset released to the idle state awaiting a deferred unload.
+    struct IdleAsset
+    {
+        StringTableEntry        mAssetId;
+        U32                     mReleaseTime;
+    };
+    typedef Vector<IdleAsset> typeIdleAssetVector;
 
     /// Declared assets.
     typeDeclaredAssetsHash              mDeclaredAssets;
 
+    /// Declared asset indexes by type, category and loose file.
+    /// These are rebuilt when next used after the declared assets have changed.
+    typeAssetIndexHash                  mAssetTypeIndex;
+    typeAssetIndexHash                  mAssetCategoryIndex;
+    typeAssetIndexHash                  mAssetLooseFileIndex;
+    bool                                mAssetIndexesDirty;
+
     /// Referenced assets.
     typeReferencedAssetsHash            mReferencedAssets;
 
@@ -99,6 +139,29 @@ private:
     /// Asset pointer refresh notifications.
     typeAssetPtrRefreshHash             mAssetPtrRefreshNotifications;
 
+    /// Asynchronous acquisitions.
+    typeAsyncAcquireVector              mAsyncAcquires;
+    U32                                 mNextAsyncAcquireId;
+    U32                                 mAsyncAcquireDepth;
+    bool                                mAsyncAcquiring;
+
+    /// Idle assets (oldest release first).
+    typeIdleAssetVector                 mIdleAssets;
+    U32                                 mIdleUnloadDelay;
+    U32                                 mIdleMemoryBudget;
+
+    /// Hot reloading of changed asset files.
+    FileWatcher                         mFileWatcher;
+    typeWatchedFilesHash                mWatchedFiles;
+    U32                                 mHotReloadInterval;
+    bool                                mWatchedFilesDirty;
+
+    /// Declared asset scan cache.
+    AssetScanCache                      mScanCache;
+    StringTableEntry                    mScanCacheFile;
+    bool                                mScanCacheLoaded;
+    bool                                mScanCacheValidateFiles;
+
     /// Miscellaneous.
     bool                                mEchoInfo;
     bool                                mIgnoreAutoUnload;
@@ -268,6 +331,9 @@ public:
             {
                 Con::printf( "Asset Manager: > Acquiring from idle state." );
             }
+
+            // Remove any deferred unload.
+            removeIdleAsset( pAssetDefinition->mAssetId );
         }
 
         // Set acquired asset.
@@ -322,12 +388,52 @@ public:
     bool releaseAsset( const char* pAssetId );
     void purgeAssets( void );
 
+    /// Deferred unloading of idle assets.
+    /// Auto-unload assets that are released are kept loaded, idle, so that re-acquiring them shortly after is free.
+    /// Idle assets are unloaded, oldest first, once they have been idle for "IdleUnloadDelay" and only whilst the
+    /// memory used by idle assets exceeds "IdleMemoryBudget".
+    void processIdleAssets( void );
+    inline U32 getIdleAssetCount( void ) const { return mIdleAssets.size(); }
+
+    /// Asynchronous asset acquisition.
+    /// The asset files and those of all their dependencies are read in the background then the assets are loaded,
+    /// dependencies first, a slice at a time by processAsyncAcquires().  The request holds a reference to the requested
+    /// assets until it is released so they can then be acquired without loading.
+    /// @return The request Id or zero if none of the assets are declared.
+    U32 acquireAssetAsync( const char* pAssetId );
+    U32 preloadAssets( const Vector<StringTableEntry>& assetIds );
+    bool isAsyncAcquireComplete( const U32 requestId );
+    bool isAsyncAcquireFailed( const U32 requestId );
+    F32 getAsyncAcquireProgress( const U32 requestId );
+    bool finishAsyncAcquire( const U32 requestId );
+    bool releaseAsyncAcquire( const U32 requestId );
+    inline U32 getAsyncAcquireCount( void ) const { return (U32)mAsyncAcquires.size(); }
+
+    /// Load the assets of asynchronous acquisitions.
+    /// Loading stops once "$pref::AssetManager::asyncAcquireBudget" milliseconds have elapsed unless the budget is ignored.
+    void processAsyncAcquires( const bool ignoreBudget = false );
+
+    /// Whether assets are currently being loaded for an asynchronous acquisition.
+    /// Assets can use this to defer their own expensive work such as decoding textures.
+    inline bool isAcquiringAsync( void ) const { return mAsyncAcquiring; }
+
     /// Asset deletion.
     bool deleteAsset( const char* pAssetId, const bool deleteLooseFiles, const bool deleteDependencies );
 
     // Asset refresh notification.
     bool refreshAsset( const char* pAssetId );
     void refreshAllAssets( const bool includeUnloaded = false );
+
+    /// Refresh several assets together along with all the assets that depend upon them.
+    /// Unlike refreshAsset(), the assets are not saved and each asset and asset pointer is only refreshed once
+    /// no matter how many of the assets it depends upon.
+    void refreshAssets( const Vector<StringTableEntry>& assetIds );
+
+    /// Hot reloading.
+    /// Whilst "HotReloadInterval" is non-zero, the declaration and loose files of declared assets are watched for
+    /// changes on a background thread.  The assets whose files have changed are refreshed together, once each file
+    /// has stopped changing, with changed declaration files being read back into loaded assets.
+    void processFileChanges( void );
     void registerAssetPtrRefreshNotify( AssetPtrBase* pAssetPtrBase, AssetPtrCallback* pCallback );
     void unregisterAssetPtrRefreshNotify( AssetPtrBase* pAssetPtrBase );
 
@@ -380,7 +486,17 @@ private:
     void renameAssetDependencies( StringTableEntry assetIdFrom, StringTableEntry assetIdTo );
     void removeAssetDependencies( const char* pAssetId );
     void removeAssetLooseFiles( const char* pAssetId );
+    bool updateAssetDependencies( AssetDefinition* pAssetDefinition );
+    bool reloadAssetDeclaration( AssetDefinition* pAssetDefinition );
+    void updateWatchedFiles( void );
+    void updateAssetIndexes( void );
+    S32 findIndexedAssets( AssetQuery* pAssetQuery, typeAssetIndexHash& assetIndex, StringTableEntry key, const bool assetQueryAsSource );
     void unloadAsset( AssetDefinition* pAssetDefinition );
+    void removeIdleAsset( StringTableEntry assetId );
+    void compileAsyncLoadOrder( AsyncAcquireRequest* pRequest, typeAssetId assetId, const bool requested, typeAssetIdVisitedHash& visitedAssets );
+    AsyncAcquireRequest* findAsyncAcquire( const U32 requestId );
+    bool loadAsyncAcquire( AsyncAcquireRequest* pRequest, const bool ignoreBudget, const U32 startTime, const F32 budget, U32& loadedCount );
+    void purgeAsyncAcquires( void );
 
     /// Module callbacks.
     virtual void onModulePreLoad( ModuleDefinition* pModuleDefinition );
@@ -369,6 +369,96 @@ ConsoleMethodWithDocs( AssetManager, releaseAsset, ConsoleBool, 3, 3, (assetId))
 
 //-----------------------------------------------------------------------------
 
+/*! Start acquiring the specified asset Id and its dependencies asynchronously.
+    The asset files are read in the background and the assets loaded a slice at a time each frame.
+    You must release the acquisition once you're finished with it using 'releaseAsyncAcquire'.
+    @param assetId The selected asset Id.
+    @return The acquisition Id or zero if the asset does not exist.
+*/
+ConsoleMethodWithDocs( AssetManager, acquireAssetAsync, ConsoleInt, 3, 3, (assetId))
+{
+    return object->acquireAssetAsync( argv[2] );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Start acquiring the specified asset Ids and their dependencies asynchronously.
+    You must release the acquisition once you're finished with it using 'releaseAsyncAcquire'.
+    @param assetIds A space-separated list of asset Ids.
+    @return The acquisition Id or zero if none of the assets exist.
+*/
+ConsoleMethodWithDocs( AssetManager, preloadAssets, ConsoleInt, 3, 3, (assetIds))
+{
+    // Fetch asset Ids.
+    const char* pAssetIds = argv[2];
+    const U32 assetIdCount = StringUnit::getUnitCount( pAssetIds, " \t\n" );
+
+    Vector<StringTableEntry> assetIds;
+    for ( U32 index = 0; index < assetIdCount; ++index )
+    {
+        assetIds.push_back( StringUnit::getStringTableUnit( pAssetIds, index, " \t\n" ) );
+    }
+
+    return object->preloadAssets( assetIds );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Check whether an asynchronous acquisition has finished loading all its assets.
+    @param acquireId The acquisition Id.
+    @return Whether the acquisition is complete or not.
+*/
+ConsoleMethodWithDocs( AssetManager, isAsyncAcquireComplete, ConsoleBool, 3, 3, (acquireId))
+{
+    return object->isAsyncAcquireComplete( dAtoi(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Check whether any of the assets of an asynchronous acquisition could not be acquired.
+    @param acquireId The acquisition Id.
+    @return Whether the acquisition failed or not.
+*/
+ConsoleMethodWithDocs( AssetManager, isAsyncAcquireFailed, ConsoleBool, 3, 3, (acquireId))
+{
+    return object->isAsyncAcquireFailed( dAtoi(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the fraction of the assets an asynchronous acquisition has loaded.
+    @param acquireId The acquisition Id.
+    @return The progress from zero to one.
+*/
+ConsoleMethodWithDocs( AssetManager, getAsyncAcquireProgress, ConsoleFloat, 3, 3, (acquireId))
+{
+    return object->getAsyncAcquireProgress( dAtoi(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Block until an asynchronous acquisition has loaded all its assets.
+    @param acquireId The acquisition Id.
+    @return Whether all the assets were acquired or not.
+*/
+ConsoleMethodWithDocs( AssetManager, finishAsyncAcquire, ConsoleBool, 3, 3, (acquireId))
+{
+    return object->finishAsyncAcquire( dAtoi(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Release an asynchronous acquisition and the assets it has acquired.
+    @param acquireId The acquisition Id.
+    @return Whether the acquisition was released or not.
+*/
+ConsoleMethodWithDocs( AssetManager, releaseAsyncAcquire, ConsoleBool, 3, 3, (acquireId))
+{
+    return object->releaseAsyncAcquire( dAtoi(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Purge all assets that are not referenced even if they are set to not auto-unload.
     Assets can be in this state because they are either set to not auto-unload or the asset manager has/is disabling auto-unload.
     @return No return value.
@@ -381,6 +471,27 @@ ConsoleMethodWithDocs( AssetManager, purgeAssets, ConsoleVoid, 2, 2, ())
 
 //-----------------------------------------------------------------------------
 
+/*! Unload any idle assets that are due to be unloaded.
+    This happens automatically each frame but can be called to apply a changed idle unload delay or idle memory budget immediately.
+    @return No return value.
+*/
+ConsoleMethodWithDocs( AssetManager, processIdleAssets, ConsoleVoid, 2, 2, ())
+{
+    object->processIdleAssets();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of released assets that are being kept loaded whilst idle.
+    @return The number of idle assets.
+*/
+ConsoleMethodWithDocs( AssetManager, getIdleAssetCount, ConsoleInt, 2, 2, ())
+{
+    return object->getIdleAssetCount();
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Deletes the specified asset Id and optionally its loose files and asset dependencies.
     @param assetId The selected asset Id.
     @param deleteLooseFiles Whether to delete an assets loose files or not.
@@ -415,6 +526,26 @@ ConsoleMethodWithDocs( AssetManager, refreshAsset, ConsoleVoid, 3, 3, (assetId))
 
 //-----------------------------------------------------------------------------
 
+/*! Refresh the specified asset Ids together along with all the assets that depend upon them.
+    Unlike refreshAsset, the assets are not saved and each asset is only refreshed once.
+    @param assetIds A space-separated list of asset Ids.
+    @return No return value.
+*/
+ConsoleMethodWithDocs( AssetManager, refreshAssets, ConsoleVoid, 3, 3, (assetIds))
+{
+    // Fetch asset Ids.
+    Vector<StringTableEntry> assetIds;
+    const U32 assetIdCount = StringUnit::getUnitCount( argv[2], " \t\n" );
+    for ( U32 index = 0; index < assetIdCount; ++index )
+    {
+        assetIds.push_back( StringUnit::getStringTableUnit( argv[2], index, " \t\n" ) );
+    }
+
+    object->refreshAssets( assetIds );
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Refresh all declared assets.
     @param Whether to include currently unloaded assets in the refresh or not.  Optional: Defaults to false.
     Refreshing all assets can be an expensive (time-consuming) operation to perform.
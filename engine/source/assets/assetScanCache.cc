@@ -0,0 +1,291 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _ASSET_SCAN_CACHE_H_
+#include "assetScanCache.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+#define ASSET_SCAN_CACHE_SIGNATURE  "AssetScanCache"
+#define ASSET_SCAN_CACHE_VERSION    2
+#define ASSET_SCAN_CACHE_MAX_STRING 1023
+
+//-----------------------------------------------------------------------------
+
+static StringTableEntry readCacheString( Stream& stream )
+{
+    char stringBuffer[ASSET_SCAN_CACHE_MAX_STRING+1];
+    stringBuffer[0] = 0;
+    stream.readLongString( ASSET_SCAN_CACHE_MAX_STRING, stringBuffer );
+    return StringTable->insert( stringBuffer );
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetScanCache::load( const char* pCacheFilePath )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetScanCache_Load);
+
+    // Sanity!
+    AssertFatal( pCacheFilePath != NULL, "Cannot load asset scan cache using a NULL file-path." );
+
+    // Remove any existing entries.
+    clear();
+
+    // Expand the file-path.
+    char filePathBuffer[1024];
+    Con::expandPath( filePathBuffer, sizeof(filePathBuffer), pCacheFilePath );
+
+    // Finish if there is no cache yet.
+    FileStream stream;
+    if ( !stream.open( filePathBuffer, FileStream::Read ) )
+        return false;
+
+    // Is the signature and version correct?
+    U32 versionId = 0;
+    if ( stream.readSTString( true ) != StringTable->insert( ASSET_SCAN_CACHE_SIGNATURE, true ) || !stream.read( &versionId ) || versionId != ASSET_SCAN_CACHE_VERSION )
+    {
+        // No, so ignore the cache.
+        Con::warnf( "Asset Scan Cache: Ignoring cache file '%s' as it is not a compatible cache.", filePathBuffer );
+        return false;
+    }
+
+    // Read the entry count.
+    U32 entryCount = 0;
+    stream.read( &entryCount );
+
+    // Read the entries.
+    for ( U32 entryIndex = 0; entryIndex < entryCount && stream.getStatus() == Stream::Ok; ++entryIndex )
+    {
+        Entry* pEntry = new Entry();
+
+        StringTableEntry assetFilePath = readCacheString( stream );
+        stream.read( &pEntry->mFileSize );
+        stream.read( sizeof(FileTime), &pEntry->mModifiedTime );
+        pEntry->mAssetType = readCacheString( stream );
+        pEntry->mAssetName = readCacheString( stream );
+        pEntry->mAssetDescription = readCacheString( stream );
+        pEntry->mAssetCategory = readCacheString( stream );
+        stream.read( &pEntry->mAssetAutoUnload );
+        stream.read( &pEntry->mAssetInternal );
+
+        U32 dependencyCount = 0;
+        stream.read( &dependencyCount );
+        for ( U32 index = 0; index < dependencyCount && stream.getStatus() == Stream::Ok; ++index )
+            pEntry->mAssetDependencies.push_back( readCacheString( stream ) );
+
+        U32 looseFileCount = 0;
+        stream.read( &looseFileCount );
+        for ( U32 index = 0; index < looseFileCount && stream.getStatus() == Stream::Ok; ++index )
+            pEntry->mAssetLooseFiles.push_back( readCacheString( stream ) );
+
+        mEntries.insert( assetFilePath, pEntry );
+    }
+
+    // Read the directory scans.
+    if ( stream.getStatus() == Stream::Ok )
+        mDirectoryCache.read( stream );
+
+    // Was the cache read completely?
+    if ( stream.getStatus() != Stream::Ok && stream.getStatus() != Stream::EOS )
+    {
+        // No, so ignore the cache.
+        Con::warnf( "Asset Scan Cache: Ignoring cache file '%s' as it is corrupt.", filePathBuffer );
+        clear();
+        return false;
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetScanCache::save( const char* pCacheFilePath )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetScanCache_Save);
+
+    // Sanity!
+    AssertFatal( pCacheFilePath != NULL, "Cannot save asset scan cache using a NULL file-path." );
+
+    // Expand the file-path.
+    char filePathBuffer[1024];
+    Con::expandPath( filePathBuffer, sizeof(filePathBuffer), pCacheFilePath );
+
+    FileStream stream;
+
+    // File open for write?
+    if ( !stream.open( filePathBuffer, FileStream::Write ) )
+    {
+        // No, so warn.
+        Con::warnf( "Asset Scan Cache: Could not open cache file '%s' for write.", filePathBuffer );
+        return false;
+    }
+
+    // Write the signature, version and entry count.
+    stream.writeString( ASSET_SCAN_CACHE_SIGNATURE );
+    stream.write( (U32)ASSET_SCAN_CACHE_VERSION );
+    stream.write( (U32)mEntries.size() );
+
+    // Write the entries.
+    for( typeEntryHash::iterator entryItr = mEntries.begin(); entryItr != mEntries.end(); ++entryItr )
+    {
+        const Entry* pEntry = entryItr->value;
+
+        stream.writeLongString( ASSET_SCAN_CACHE_MAX_STRING, entryItr->key );
+        stream.write( pEntry->mFileSize );
+        stream.write( sizeof(FileTime), &pEntry->mModifiedTime );
+        stream.writeLongString( ASSET_SCAN_CACHE_MAX_STRING, pEntry->mAssetType );
+        stream.writeLongString( ASSET_SCAN_CACHE_MAX_STRING, pEntry->mAssetName );
+        stream.writeLongString( ASSET_SCAN_CACHE_MAX_STRING, pEntry->mAssetDescription );
+        stream.writeLongString( ASSET_SCAN_CACHE_MAX_STRING, pEntry->mAssetCategory );
+        stream.write( pEntry->mAssetAutoUnload );
+        stream.write( pEntry->mAssetInternal );
+
+        stream.write( (U32)pEntry->mAssetDependencies.size() );
+        for ( U32 index = 0; index < (U32)pEntry->mAssetDependencies.size(); ++index )
+            stream.writeLongString( ASSET_SCAN_CACHE_MAX_STRING, pEntry->mAssetDependencies[index] );
+
+        stream.write( (U32)pEntry->mAssetLooseFiles.size() );
+        for ( U32 index = 0; index < (U32)pEntry->mAssetLooseFiles.size(); ++index )
+            stream.writeLongString( ASSET_SCAN_CACHE_MAX_STRING, pEntry->mAssetLooseFiles[index] );
+    }
+
+    // Write the directory scans.
+    mDirectoryCache.write( stream );
+
+    // Close the stream.
+    stream.close();
+
+    // Flag as not dirty.
+    mDirty = false;
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetScanCache::clear( void )
+{
+    // Delete the entries.
+    for( typeEntryHash::iterator entryItr = mEntries.begin(); entryItr != mEntries.end(); ++entryItr )
+        delete entryItr->value;
+
+    mEntries.clear();
+    mDirectoryCache.clear();
+    mDirty = false;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetScanCache::find( StringTableEntry assetFilePath, const U32 fileSize, const FileTime& modifiedTime, TamlAssetDeclaredVisitor& assetDeclaredVisitor )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetScanCache_Find);
+
+    // Find the entry.
+    typeEntryHash::iterator entryItr = mEntries.find( assetFilePath );
+
+    // Finish if there's no entry.
+    if ( entryItr == mEntries.end() )
+        return false;
+
+    // Fetch the entry.
+    const Entry* pEntry = entryItr->value;
+
+    // Finish if the file has changed.
+    if ( pEntry->mFileSize != fileSize || Platform::compareFileTimes( pEntry->mModifiedTime, modifiedTime ) != 0 )
+        return false;
+
+    // Store the scan results.
+    assetDeclaredVisitor.clear();
+    AssetDefinition& assetDefinition = assetDeclaredVisitor.getAssetDefinition();
+    assetDefinition.mAssetBaseFilePath = assetFilePath;
+    assetDefinition.mAssetType = pEntry->mAssetType;
+    assetDefinition.mAssetName = pEntry->mAssetName;
+    assetDefinition.mAssetDescription = pEntry->mAssetDescription;
+    assetDefinition.mAssetCategory = pEntry->mAssetCategory;
+    assetDefinition.mAssetAutoUnload = pEntry->mAssetAutoUnload;
+    assetDefinition.mAssetInternal = pEntry->mAssetInternal;
+    assetDeclaredVisitor.getAssetDependencies() = pEntry->mAssetDependencies;
+    assetDeclaredVisitor.getAssetLooseFiles() = pEntry->mAssetLooseFiles;
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetScanCache::find( StringTableEntry assetFilePath, TamlAssetDeclaredVisitor& assetDeclaredVisitor )
+{
+    // Find the entry.
+    typeEntryHash::iterator entryItr = mEntries.find( assetFilePath );
+
+    // Finish if there's no entry.
+    if ( entryItr == mEntries.end() )
+        return false;
+
+    // Use the scan results as they are.
+    return find( assetFilePath, entryItr->value->mFileSize, entryItr->value->mModifiedTime, assetDeclaredVisitor );
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetScanCache::insert( StringTableEntry assetFilePath, const U32 fileSize, const FileTime& modifiedTime, TamlAssetDeclaredVisitor& assetDeclaredVisitor )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetScanCache_Insert);
+
+    // Find any existing entry.
+    typeEntryHash::iterator entryItr = mEntries.find( assetFilePath );
+
+    // Fetch or create the entry.
+    Entry* pEntry = entryItr != mEntries.end() ? entryItr->value : new Entry();
+
+    // Store the scan results.
+    const AssetDefinition& assetDefinition = assetDeclaredVisitor.getAssetDefinition();
+    pEntry->mFileSize = fileSize;
+    pEntry->mModifiedTime = modifiedTime;
+    pEntry->mAssetType = assetDefinition.mAssetType;
+    pEntry->mAssetName = assetDefinition.mAssetName;
+    pEntry->mAssetDescription = assetDefinition.mAssetDescription;
+    pEntry->mAssetCategory = assetDefinition.mAssetCategory;
+    pEntry->mAssetAutoUnload = assetDefinition.mAssetAutoUnload;
+    pEntry->mAssetInternal = assetDefinition.mAssetInternal;
+    pEntry->mAssetDependencies = assetDeclaredVisitor.getAssetDependencies();
+    pEntry->mAssetLooseFiles = assetDeclaredVisitor.getAssetLooseFiles();
+
+    // Insert a new entry.
+    if ( entryItr == mEntries.end() )
+        mEntries.insert( assetFilePath, pEntry );
+
+    // Flag as dirty.
+    mDirty = true;
+}
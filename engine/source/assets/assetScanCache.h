@@ -0,0 +1,97 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _ASSET_SCAN_CACHE_H_
+#define _ASSET_SCAN_CACHE_H_
+
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
+#ifndef _TAML_ASSET_DECLARED_VISITOR_H_
+#include "assets/tamlAssetDeclaredVisitor.h"
+#endif
+
+#ifndef _DIRECTORY_SCAN_CACHE_H_
+#include "io/directoryScanCache.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// Holds what was found when scanning each asset declaration file so that unchanged files
+/// don't need parsing again.  Each file is keyed on its file-path, size and modified time.
+/// The files found in each declared asset path are also cached so that unchanged directories
+/// don't need walking again.
+class AssetScanCache
+{
+private:
+    struct Entry
+    {
+        U32                 mFileSize;
+        FileTime            mModifiedTime;
+        StringTableEntry    mAssetType;
+        StringTableEntry    mAssetName;
+        StringTableEntry    mAssetDescription;
+        StringTableEntry    mAssetCategory;
+        bool                mAssetAutoUnload;
+        bool                mAssetInternal;
+        TamlAssetDeclaredVisitor::typeAssetIdVector     mAssetDependencies;
+        TamlAssetDeclaredVisitor::typeLooseFileVector   mAssetLooseFiles;
+    };
+
+    typedef HashMap<StringTableEntry, Entry*> typeEntryHash;
+
+    typeEntryHash       mEntries;
+    DirectoryScanCache  mDirectoryCache;
+    bool                mDirty;
+
+public:
+    AssetScanCache() : mDirty( false ) {}
+    virtual ~AssetScanCache() { clear(); }
+
+    /// Load the cache from a file.  Any existing entries are removed.
+    bool load( const char* pCacheFilePath );
+
+    /// Save the cache to a file.
+    bool save( const char* pCacheFilePath );
+
+    /// Remove all the entries.
+    void clear( void );
+
+    /// Find the scan results for an asset file and store them in the visitor.
+    /// @return Whether the file has unchanged scan results.
+    bool find( StringTableEntry assetFilePath, const U32 fileSize, const FileTime& modifiedTime, TamlAssetDeclaredVisitor& assetDeclaredVisitor );
+
+    /// Find the scan results for an asset file without checking whether the file has changed.
+    bool find( StringTableEntry assetFilePath, TamlAssetDeclaredVisitor& assetDeclaredVisitor );
+
+    /// Store the scan results for an asset file from the visitor.
+    void insert( StringTableEntry assetFilePath, const U32 fileSize, const FileTime& modifiedTime, TamlAssetDeclaredVisitor& assetDeclaredVisitor );
+
+    /// Whether the entries have changed since the cache was loaded or saved.
+    inline bool isDirty( void ) const { return mDirty || mDirectoryCache.isDirty(); }
+
+    /// The cache of the files found in declared asset paths.
+    inline DirectoryScanCache& getDirectoryCache( void ) { return mDirectoryCache; }
+};
+
+#endif // _ASSET_SCAN_CACHE_H_
@@ -98,6 +98,7 @@ AudioAsset::AudioAsset()
    mDescription.mConeOutsideVolume   = 1.0f;
    mDescription.mConeVector.set(0, 0, 1);
 
+   mDecodeOnPlay                     = false;
 }
 
 //--------------------------------------------------------------------------
@@ -111,6 +112,7 @@ void AudioAsset::initPersistFields()
    addProtectedField("VolumeChannel", TypeS32, Offset(mDescription.mVolumeChannel, AudioAsset), &setVolumeChannel, &defaultProtectedGetFn, &writeVolumeChannel, "");
    addProtectedField("Looping", TypeBool, Offset(mDescription.mIsLooping, AudioAsset), &setLooping, &defaultProtectedGetFn, &writeLooping, "");
    addProtectedField("Streaming", TypeBool, Offset(mDescription.mIsStreaming, AudioAsset), &setStreaming, &defaultProtectedGetFn, &writeStreaming, "");
+   addProtectedField("DecodeOnPlay", TypeBool, Offset(mDecodeOnPlay, AudioAsset), &setDecodeOnPlay, &defaultProtectedGetFn, &writeDecodeOnPlay, "Whether to keep the audio file in memory and decode it only when played.");
 
    //addField("is3D",              TypeBool,    Offset(mDescription.mIs3D, AudioAsset));
    //addField("referenceDistance", TypeF32,     Offset(mDescription.mReferenceDistance, AudioAsset));
@@ -141,6 +143,7 @@ void AudioAsset::copyTo(SimObject* object)
     pAsset->setVolumeChannel( getVolumeChannel() );
     pAsset->setLooping( getLooping() );
     pAsset->setStreaming( getStreaming() );
+    pAsset->setDecodeOnPlay( getDecodeOnPlay() );
 }
 
 //--------------------------------------------------------------------------
@@ -156,6 +159,26 @@ void AudioAsset::initializeAsset( void )
     // Asset should never auto-unload.
     setAssetAutoUnload( false );
 
+    // Release any buffer kept in memory.
+    mResidentBuffer.unlock();
+
+    // Decode the audio now so that playing it (or preloading the asset) doesn't read it later.
+    // NOTE: The buffer is shared by assets using the same file and is cached once it is no longer in use.
+    // A headless server never plays audio so only keeps the description.
+    if ( !mDescription.mIsStreaming && mAudioFile != StringTable->EmptyString && !Platform::isHeadless() )
+    {
+        Resource<AudioBuffer> buffer = AudioBuffer::find( mAudioFile );
+        if ( (bool)buffer )
+        {
+            // Keep the file in memory to decode when played if requested.
+            // NOTE: The buffer is held so that the file stays in memory whilst the asset is loaded.
+            if ( mDecodeOnPlay && buffer->loadFileData() )
+                mResidentBuffer = buffer;
+            else
+                buffer->getALBuffer();
+        }
+    }
+
     // Clamp these for now.
     if (mDescription.mIs3D)
     {
@@ -253,6 +276,21 @@ void AudioAsset::setStreaming( const bool streaming )
 
 //--------------------------------------------------------------------------
 
+void AudioAsset::setDecodeOnPlay( const bool decodeOnPlay )
+{
+    // Ignore no change.
+    if ( decodeOnPlay == mDecodeOnPlay )
+        return;
+
+    // Update.
+    mDecodeOnPlay = decodeOnPlay;
+
+    // Refresh the asset.
+    refreshAsset();
+}
+
+//--------------------------------------------------------------------------
+
 void AudioAsset::setDescription( const Audio::Description& audioDescription )
 {
     // Update.
@@ -59,6 +59,10 @@ private:
 
    StringTableEntry mAudioFile;
    Audio::Description mDescription;
+   bool mDecodeOnPlay;
+
+   /// The buffer kept in memory when decoding on play.
+   Resource<AudioBuffer> mResidentBuffer;
 
 public:
    AudioAsset();
@@ -80,6 +84,11 @@ public:
    void setStreaming( const bool streaming );
    inline bool getStreaming( void ) const { return mDescription.mIsStreaming; }
 
+   /// Keep the audio file in memory (compressed if the file is compressed) and decode it only when played.
+   /// This sits between decoding when loaded and streaming and suits banks of short sounds.
+   void setDecodeOnPlay( const bool decodeOnPlay );
+   inline bool getDecodeOnPlay( void ) const { return mDecodeOnPlay; }
+
    void setDescription( const Audio::Description& audioDescription );
    inline const Audio::Description& getAudioDescription( void ) const { return mDescription; }
 
@@ -107,6 +116,9 @@ protected:
 
     static bool setStreaming( void* obj, const char* data )                     { static_cast<AudioAsset*>(obj)->setStreaming(dAtob(data)); return false; }
     static bool writeStreaming( void* obj, StringTableEntry pFieldName )        { return static_cast<AudioAsset*>(obj)->getStreaming() == true; }
+
+    static bool setDecodeOnPlay( void* obj, const char* data )                  { static_cast<AudioAsset*>(obj)->setDecodeOnPlay(dAtob(data)); return false; }
+    static bool writeDecodeOnPlay( void* obj, StringTableEntry pFieldName )     { return static_cast<AudioAsset*>(obj)->getDecodeOnPlay() == true; }
 };
 
 #endif  // _AUDIO_ASSET_H_
@@ -28,6 +28,8 @@
 #include "game/gameConnection.h"
 #include "io/fileStream.h"
 #include "audio/audioStreamSourceFactory.h"
+#include "platform/threads/thread.h"
+#include "platform/threads/mutex.h"
 
 #ifdef TORQUE_OS_IOS
 #include "platformiOS/SoundEngine.h"
@@ -49,6 +51,7 @@ extern ALvoid  alcMacOSXMixerOutputRateProc(const ALdouble value);
 #define MIN_GAIN              0.05f             // anything with lower gain will not be started
 #define MIN_UNCULL_PERIOD     500               // time before buffer is checked to be unculled
 #define MIN_UNCULL_GAIN       0.1f              // min gain of source to be unculled
+#define STREAM_UPDATE_PERIOD  10                // time between stream buffer refills on the audio thread
 
 #define ALX_DEF_SAMPLE_RATE      44100          // default values for mixer
 #define ALX_DEF_SAMPLE_BITS      16
@@ -81,6 +84,8 @@ struct LoopingImage
    F32                     mPitch;
    F32                     mScore;
    U32                     mCullTime;
+   U32                     mStartTime;          // virtual voices only: when the sound (would have) started
+   U32                     mDuration;           // virtual voices only: length of the sound
 
    LoopingImage()  { clear(); }
 
@@ -95,6 +100,8 @@ struct LoopingImage
       mPitch = 1.f;
       mScore = 0.f;
       mCullTime = 0;
+      mStartTime = 0;
+      mDuration = 0;
    }
 };
 
@@ -108,6 +115,7 @@ static Resource<AudioBuffer>  mBuffer[MAX_AUDIOSOURCES];                   // ea
 static F32                    mScore[MAX_AUDIOSOURCES];                    // for figuring out which sources to cull/uncull
 static F32                    mSourceVolume[MAX_AUDIOSOURCES];             // the samples current un-attenuated gain (not scaled by master/channel gains)
 static U32                    mType[MAX_AUDIOSOURCES];                     // the channel which this source belongs
+static Audio::Description     mSourceDescription[MAX_AUDIOSOURCES];        // description of the sound (needed to virtualize a culled one-shot)
 
 static AudioSampleEnvironment*        mSampleEnvironment[MAX_AUDIOSOURCES];           // currently playing sample environments
 static bool                           mEnvironmentEnabled = false;                    // environment enabled?
@@ -134,6 +142,9 @@ static LoopingList mLoopingList;                 // all the looping sources
 static LoopingList mLoopingFreeList;             // free store
 static LoopingList mLoopingInactiveList;         // sources which have not been played yet
 static LoopingList mLoopingCulledList;           // sources which have been culled (alxPlay called)
+static LoopingList mVirtualList;                 // one-shots without a source, tracked until they would have finished
+
+static U32 mMemoryPressureCallbackKey = 0;       // flushes unused buffers under memory pressure
 
 // StreamingList and StreamingFreeList own the images
 static StreamingList mStreamingList;                 // all the streaming sources
@@ -141,6 +152,10 @@ static StreamingList mStreamingList;                 // all the streaming source
 static StreamingList mStreamingInactiveList;         // sources which have not been played yet
 static StreamingList mStreamingCulledList;           // sources which have been culled (alxPlay called)
 
+static Mutex mAudioMutex;                            // guards the streaming sources against the audio thread
+static Thread* mpAudioThread = NULL;                 // refills the stream buffers
+static volatile bool mAudioThreadStop = false;
+
 #define AUDIOHANDLE_LOOPING_BIT  (0x80000000)
 #define AUDIOHANDLE_STREAMING_BIT  (0x40000000)
 #define AUDIOHANDLE_INACTIVE_BIT (0x20000000)
@@ -186,8 +201,8 @@ inline S32 QSORT_CALLBACK loopingImageSort(const void * p1, const void * p2)
    const LoopingImage * ip1 = *(const LoopingImage**)p1;
    const LoopingImage * ip2 = *(const LoopingImage**)p2;
 
-   // min->max
-   return (S32)(ip2->mScore - ip1->mScore);
+   // max->min (scores are fractional so don't truncate the difference)
+   return (ip2->mScore > ip1->mScore) ? 1 : ((ip2->mScore < ip1->mScore) ? -1 : 0);
 }
 
 void LoopingList::sort()
@@ -218,8 +233,8 @@ inline S32 QSORT_CALLBACK streamingSourceSort(const void * p1, const void * p2)
    const AudioStreamSource * ip1 = *(const AudioStreamSource**)p1;
    const AudioStreamSource * ip2 = *(const AudioStreamSource**)p2;
 
-   // min->max
-   return (S32)(ip2->mScore - ip1->mScore);
+   // max->min (scores are fractional so don't truncate the difference)
+   return (ip2->mScore > ip1->mScore) ? 1 : ((ip2->mScore < ip1->mScore) ? -1 : 0);
 }
 
 void StreamingList::sort()
@@ -241,6 +256,26 @@ LoopingImage * createLoopingImage()
    return(image);
 }
 
+//-------------------------------------------------------------------------
+// Virtual voices
+//-------------------------------------------------------------------------
+static LoopingList::iterator findVirtualVoice(AUDIOHANDLE handle)
+{
+   for(LoopingList::iterator itr = mVirtualList.begin(); itr != mVirtualList.end(); itr++)
+   {
+      if(areEqualHandles((*itr)->mHandle, handle))
+         return(itr);
+   }
+   return(0);
+}
+
+static void freeVirtualVoice(LoopingList::iterator itr)
+{
+   (*itr)->clear();
+   mLoopingFreeList.push_back(*itr);
+   mVirtualList.erase_fast(itr);
+}
+
 //-------------------------------------------------------------------------
 AudioStreamSource * createStreamingSource(const char* filename)
 {
@@ -263,7 +298,9 @@ static AUDIOHANDLE getNewHandle()
 // function declarations
 void alxLoopingUpdate();
 void alxStreamingUpdate();
+void alxVirtualUpdate();
 void alxUpdateScores(bool);
+ALuint alxGetWaveLen(ALuint buffer);
 
 static bool findFreeSource(U32 *index)
 {
@@ -341,6 +378,37 @@ static bool cullSource(U32 *index, F32 volume)
       }
    }
 
+   // virtualize a playing one-shot so it can resume if a source becomes available
+   if(!itr && !itr2 && !(mHandle[best] & AUDIOHANDLE_INACTIVE_BIT) && bool(mBuffer[best]))
+   {
+      ALint state = AL_STOPPED;
+      alGetSourcei(mSource[best], AL_SOURCE_STATE, &state);
+
+      if(state == AL_PLAYING)
+      {
+         ALfloat offset = 0.f;
+         alGetSourcef(mSource[best], AL_SEC_OFFSET, &offset);
+
+         LoopingImage * image = createLoopingImage();
+         image->mHandle = mHandle[best];
+         image->mBuffer = mBuffer[best];
+         image->mDescription = mSourceDescription[best];
+         image->mEnvironment = mSampleEnvironment[best];
+         image->mScore = mScore[best];
+         image->mCullTime = Platform::getRealMilliseconds();
+         image->mStartTime = image->mCullTime - (U32)(offset * 1000.f);
+         image->mDuration = alxGetWaveLen(mBuffer[best]->getALBuffer());
+
+         if(image->mDescription.mIs3D)
+         {
+            alGetSourcefv(mSource[best], AL_POSITION, (ALfloat*)((F32*)image->mPosition));
+            image->mDirection = image->mDescription.mConeVector;
+         }
+
+         mVirtualList.push_back(image);
+      }
+   }
+
    alSourceStop(mSource[best]);
    mHandle[best] = NULL_AUDIOHANDLE;
    mBuffer[best] = 0;
@@ -417,6 +485,9 @@ bool alxIsValidHandle(AUDIOHANDLE handle)
    if(mStreamingList.findImage(handle))
       return(true);
 
+   if(findVirtualVoice(handle))
+      return(true);
+
    return(false);
 }
 
@@ -642,9 +713,15 @@ AUDIOHANDLE alxCreateSource(const Audio::Description& desc,
    if (!mContext)
       return NULL_AUDIOHANDLE;
 
+   // Attribute allocations to audio.
+   Memory::TagScope memoryTag(Memory::TagAudio);
+
    if( filename == NULL || filename == StringTable->EmptyString )
       return NULL_AUDIOHANDLE;
 
+   MutexHandle mutexHandle;
+   mutexHandle.lock(&mAudioMutex, true);
+
    F32 volume = desc.mVolume;
 
    // calculate an approximate attenuation for 3d sounds
@@ -719,6 +796,32 @@ AUDIOHANDLE alxCreateSource(const Audio::Description& desc,
          mLoopingInactiveList.push_back(image);
          return(image->mHandle & RETURN_MASK);
       }
+      else if(!desc.mIsStreaming)
+      {
+         Resource<AudioBuffer> buffer = AudioBuffer::find(filename);
+         if(!(bool)buffer)
+            return(NULL_AUDIOHANDLE);
+
+         // no source is available so track the one-shot as a virtual voice
+         LoopingImage * image = createLoopingImage();
+
+         image->mHandle = getNewHandle() | AUDIOHANDLE_INACTIVE_BIT;
+         image->mBuffer = buffer;
+         image->mDescription = desc;
+         image->mScore = volume;
+         image->mEnvironment = sampleEnvironment;
+         image->mDuration = alxGetWaveLen(buffer->getALBuffer());
+
+         // grab position/direction if 3d source
+         if(transform)
+         {
+            transform->getColumn(3, &image->mPosition);
+            transform->getColumn(1, &image->mDirection);
+         }
+
+         mVirtualList.push_back(image);
+         return(image->mHandle & RETURN_MASK);
+      }
       else
          return(NULL_AUDIOHANDLE);
    }
@@ -779,6 +882,7 @@ AUDIOHANDLE alxCreateSource(const Audio::Description& desc,
    }
    mScore[index] = volume;
    mSourceVolume[index] = desc.mVolume;
+   mSourceDescription[index] = desc;
    mSampleEnvironment[index] = sampleEnvironment;
 
    ALuint source = mSource[index];
@@ -877,6 +981,9 @@ extern void threadPlay(AudioBuffer * buffer, AUDIOHANDLE handle);
 
 AUDIOHANDLE alxPlay(AUDIOHANDLE handle)
 {
+   MutexHandle mutexHandle;
+   mutexHandle.lock(&mAudioMutex, true);
+
    U32 index = alxFindIndex(handle);
 
    if(index != MAX_AUDIOSOURCES)
@@ -903,6 +1010,19 @@ AUDIOHANDLE alxPlay(AUDIOHANDLE handle)
    }
    else
    {
+      // start the clock on virtual voices, they are given a source when one is available
+      LoopingList::iterator virtualItr = findVirtualVoice(handle);
+      if(virtualItr)
+      {
+         if((*virtualItr)->mHandle & AUDIOHANDLE_INACTIVE_BIT)
+         {
+            (*virtualItr)->mHandle &= ~AUDIOHANDLE_INACTIVE_BIT;
+            (*virtualItr)->mStartTime = Platform::getRealMilliseconds();
+            (*virtualItr)->mCullTime = (*virtualItr)->mStartTime;
+         }
+         return(handle);
+      }
+
       // move inactive loopers to the culled list, try to start the sound
       LoopingList::iterator itr = mLoopingInactiveList.findImage(handle);
       if(itr)
@@ -1002,6 +1122,9 @@ void alxUnPause( AUDIOHANDLE handle )
 //--------------------------------------------------------------------------
 void alxStop(AUDIOHANDLE handle)
 {
+   MutexHandle mutexHandle;
+   mutexHandle.lock(&mAudioMutex, true);
+
    U32 index = alxFindIndex(handle);
 
    // stop it
@@ -1077,6 +1200,11 @@ void alxStop(AUDIOHANDLE handle)
       delete(*itr2);
       mStreamingList.erase_fast(itr2);
    }
+
+   // remove virtual voice
+   LoopingList::iterator itr3 = findVirtualVoice(handle);
+   if(itr3)
+      freeVirtualVoice(itr3);
 }
 
 //--------------------------------------------------------------------------
@@ -1094,6 +1222,10 @@ void alxStopAll()
 // stop all streaming sources
    while(mStreamingList.size())
       alxStop(mStreamingList.last()->mHandle);
+
+   // stop all virtual voices
+   while(mVirtualList.size())
+      alxStop(mVirtualList.last()->mHandle);
 }
 
 void alxLoopSourcef(AUDIOHANDLE handle, ALenum pname, ALfloat value)
@@ -1808,10 +1940,9 @@ void alxLoopingUpdate()
    }
 }
 
-void alxStreamingUpdate()
+static void alxStreamingRefill()
 {
    // update buffer queues on active streamers
-   // update the loopers
    for(StreamingList::iterator itr = mStreamingList.begin(); itr != mStreamingList.end(); itr++)
    {
       if((*itr)->mHandle & AUDIOHANDLE_INACTIVE_BIT)
@@ -1819,6 +1950,45 @@ void alxStreamingUpdate()
 
       (*itr)->updateBuffers();
    }
+}
+
+//--------------------------------------------------------------------------
+// - refills the stream buffers so that a hitch on the main thread
+//   does not starve the streams
+static void alxAudioThreadFunction(void*)
+{
+   while(!mAudioThreadStop)
+   {
+      Platform::sleep(STREAM_UPDATE_PERIOD);
+
+      MutexHandle mutexHandle;
+      mutexHandle.lock(&mAudioMutex, true);
+      alxStreamingRefill();
+   }
+}
+
+static void alxStartAudioThread()
+{
+#if !defined(TORQUE_OS_EMSCRIPTEN)
+   // threads are not available on all platforms so fall back to refilling from alxUpdate()
+   mAudioThreadStop = false;
+   mpAudioThread = new Thread(alxAudioThreadFunction, NULL, true);
+#endif
+}
+
+static void alxStopAudioThread()
+{
+   mAudioThreadStop = true;
+   delete mpAudioThread;
+   mpAudioThread = NULL;
+}
+
+//--------------------------------------------------------------------------
+void alxStreamingUpdate()
+{
+   // the audio thread refills the buffers when it is running
+   if(mpAudioThread == NULL)
+      alxStreamingRefill();
 
    static StreamingList culledList;
 
@@ -1908,6 +2078,110 @@ void alxStreamingUpdate()
    }
 }
 
+//--------------------------------------------------------------------------
+// - expire virtual voices that would have finished and give the loudest
+//   of the rest a source (starting part way through) when one is available
+void alxVirtualUpdate()
+{
+   static LoopingList virtualList;
+
+   U32 updateTime = Platform::getRealMilliseconds();
+
+   // expire the finished voices (voices which have not been played yet are kept)
+   for(S32 i = mVirtualList.size() - 1; i >= 0; i--)
+   {
+      LoopingImage * image = mVirtualList[i];
+      if(image->mHandle & AUDIOHANDLE_INACTIVE_BIT)
+         continue;
+
+      if((updateTime - image->mStartTime) >= image->mDuration)
+         freeVirtualVoice(mVirtualList.begin() + i);
+   }
+
+   if(!mVirtualList.size())
+      return;
+
+   Point3F listener;
+   alxGetListenerPoint3F(AL_POSITION, &listener);
+
+   // score the playing voices
+   virtualList.clear();
+   for(LoopingList::iterator itr = mVirtualList.begin(); itr != mVirtualList.end(); itr++)
+   {
+      if((*itr)->mHandle & AUDIOHANDLE_INACTIVE_BIT)
+         continue;
+
+      if((updateTime - (*itr)->mCullTime) < MIN_UNCULL_PERIOD)
+         continue;
+
+      (*itr)->mScore = (*itr)->mDescription.mVolume;
+      if((*itr)->mDescription.mIs3D)
+      {
+         Point3F pos = (*itr)->mPosition - listener;
+         F32 dist = pos.magnitudeSafe();
+
+         F32 min = (*itr)->mDescription.mReferenceDistance;
+         F32 max = (*itr)->mDescription.mMaxDistance;
+
+         if(dist >= max)
+            (*itr)->mScore = 0.f;
+         else if(dist > min)
+            (*itr)->mScore *= (max-dist) / (max-min);
+      }
+
+      // attenuate by the channel gain
+      (*itr)->mScore *= mAudioChannelVolumes[(*itr)->mDescription.mVolumeChannel];
+
+      if((*itr)->mScore > MIN_UNCULL_GAIN)
+         virtualList.push_back(*itr);
+   }
+
+   if(!virtualList.size())
+      return;
+
+   if(virtualList.size() > 1)
+      virtualList.sort();
+
+   // promote the loudest voices
+   for(LoopingList::iterator itr = virtualList.begin(); itr != virtualList.end(); itr++)
+   {
+      U32 index = MAX_AUDIOSOURCES;
+      if(!findFreeSource(&index))
+      {
+         // score does not include master volume
+         if(!cullSource(&index, (*itr)->mScore))
+            break;
+      }
+
+      LoopingImage * image = *itr;
+
+      // restore all state data
+      mHandle[index] = image->mHandle | AUDIOHANDLE_INACTIVE_BIT;
+      mBuffer[index] = image->mBuffer;
+      mScore[index] = image->mScore;
+      mSourceVolume[index] = image->mDescription.mVolume;
+      mSourceDescription[index] = image->mDescription;
+      mType[index] = image->mDescription.mVolumeChannel;
+      mSampleEnvironment[index] = image->mEnvironment;
+
+      ALuint source = mSource[index];
+
+      // setup play info and resume where the sound would be
+      alGetError();
+
+      alxSourcePlay(source, image);
+      alSourcef(source, AL_SEC_OFFSET, F32(updateTime - image->mStartTime) / 1000.f);
+      if(mEnvironmentEnabled)
+         alxSourceEnvironment(source, image);
+
+      LoopingList::iterator tmp = findVirtualVoice(image->mHandle);
+      AssertFatal(tmp, "alxVirtualUpdate: failed to find virtual voice");
+      freeVirtualVoice(tmp);
+
+      alxPlay(mHandle[index]);
+   }
+}
+
 //--------------------------------------------------------------------------
 void alxCloseHandles()
 {
@@ -2123,6 +2397,12 @@ void alxUpdateMaxDistance()
 //--------------------------------------------------------------------------
 void alxUpdate()
 {
+   // Attribute allocations to audio.
+   Memory::TagScope memoryTag(Memory::TagAudio);
+
+   MutexHandle mutexHandle;
+   mutexHandle.lock(&mAudioMutex, true);
+
    //if(mForceMaxDistanceUpdate)
       alxUpdateMaxDistance();
 
@@ -2130,6 +2410,7 @@ void alxUpdate()
    alxUpdateScores(false);
    alxLoopingUpdate();
    alxStreamingUpdate();
+   alxVirtualUpdate();
 
 #ifdef TORQUE_GATHER_METRICS
    alxGatherMetrics();
@@ -2433,6 +2714,13 @@ void shutdownContext()
 }
 
 
+//--------------------------------------------------------------------------
+static void audioMemoryPressureCallback(const Memory::Tag tag, const Memory::Pressure pressure, void* pUserData)
+{
+   if (tag == Memory::TagAudio && pressure != Memory::PressureNone)
+      AudioBuffer::purgeUnused();
+}
+
 //--------------------------------------------------------------------------
 bool OpenALInit()
 {
@@ -2543,12 +2831,26 @@ bool OpenALInit()
    alDistanceModel(AL_INVERSE_DISTANCE);
    alListenerf(AL_GAIN_LINEAR, 1.f);
 
+   // Flush unused buffers under memory pressure.
+   mMemoryPressureCallbackKey = Memory::registerPressureCallback(audioMemoryPressureCallback, NULL);
+
+   // Refill the stream buffers away from the main thread.
+   alxStartAudioThread();
+
    return true;
 }
 
 //--------------------------------------------------------------------------
 void OpenALShutdown()
 {
+   alxStopAudioThread();
+
+   if (mMemoryPressureCallbackKey != 0)
+   {
+      Memory::unregisterPressureCallback(mMemoryPressureCallbackKey);
+      mMemoryPressureCallbackKey = 0;
+   }
+
    alxStopAll();
 
    //if(mInitialized)
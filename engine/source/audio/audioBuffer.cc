@@ -22,7 +22,9 @@
 
 #include "platform/platformAL.h"
 #include "audio/audioBuffer.h"
+#include "audio/imaAdpcm.h"
 #include "io/stream.h"
+#include "io/memstream.h"
 #include "console/console.h"
 #include "memory/frameAllocator.h"
 
@@ -96,6 +98,13 @@ struct WAVChunkHdr
 
 #define CHUNKSIZE 4096
 
+#define DEFAULT_CACHE_BUDGET  32                // megabytes of decoded audio kept for buffers not in use
+#define DEFAULT_DECODED_BUDGET 4                // megabytes of decoded audio kept for buffers decoded on play
+
+U32 AudioBuffer::smCacheSize = 0;
+U32 AudioBuffer::smDecodedSize = 0;
+Vector<AudioBuffer*> AudioBuffer::smDecodedBuffers;
+
 
 
 //--------------------------------------
@@ -106,10 +115,27 @@ AudioBuffer::AudioBuffer(StringTableEntry filename)
    mFilename = filename;
    mLoading = false;
    malBuffer = 0;
+   mDataSize = 0;
+   mpFileData = NULL;
+   mFileDataSize = 0;
 }
 
 AudioBuffer::~AudioBuffer()
 {
+   if (mpFileData != NULL)
+   {
+      const S32 index = smDecodedBuffers.find_next(this);
+      if (index != -1)
+         smDecodedBuffers.erase(index);
+
+      smDecodedSize -= mDataSize;
+      delete [] mpFileData;
+   }
+   else
+   {
+      smCacheSize -= mDataSize;
+   }
+
    if( alIsBuffer(malBuffer) )
   {
     alGetError();
@@ -143,6 +169,112 @@ AudioBuffer::~AudioBuffer()
   }
 }
 
+//--------------------------------------
+void AudioBuffer::purgeUnused()
+{
+   if (ResourceManager)
+      ResourceManager->purgeCreatedBy(AudioBuffer::construct);
+}
+
+//--------------------------------------
+void AudioBuffer::enforceCacheBudget()
+{
+   if (!ResourceManager)
+      return;
+
+   const S32 budget = Con::getIntVariable("$pref::Audio::bufferCacheBudget", DEFAULT_CACHE_BUDGET);
+   const U32 budgetSize = (U32)getMax(budget, 0) * 1024 * 1024;
+
+   // Buffers in use are locked so only the unused ones can be deleted.
+   while (smCacheSize > budgetSize && ResourceManager->purgeOldestCreatedBy(AudioBuffer::construct))
+   {
+   }
+}
+
+//--------------------------------------
+void AudioBuffer::enforceDecodedBudget()
+{
+   const S32 budget = Con::getIntVariable("$pref::Audio::decodedBufferBudget", DEFAULT_DECODED_BUDGET);
+   const U32 budgetSize = (U32)getMax(budget, 0) * 1024 * 1024;
+
+   // Release the least recently played first but never the most recent as it is about to be played.
+   for (S32 index = 0; smDecodedSize > budgetSize && index < smDecodedBuffers.size() - 1; )
+   {
+      // Buffers attached to a source cannot be released.
+      if (!smDecodedBuffers[index]->releaseALBuffer())
+      {
+         index++;
+         continue;
+      }
+
+      smDecodedBuffers.erase(index);
+   }
+}
+
+//--------------------------------------
+bool AudioBuffer::releaseALBuffer()
+{
+   if (malBuffer == 0)
+      return true;
+
+   // The buffer cannot be deleted whilst it is attached to a source.
+   alGetError();
+   alDeleteBuffers(1, &malBuffer);
+   if (alGetError() != AL_NO_ERROR)
+      return false;
+
+   smDecodedSize -= mDataSize;
+   malBuffer = 0;
+   mDataSize = 0;
+   return true;
+}
+
+//--------------------------------------
+bool AudioBuffer::loadFileData()
+{
+   if (mpFileData != NULL)
+      return true;
+
+   // Only WAV files can be decoded from memory.
+   S32 len = dStrlen(mFilename);
+   if (len < 4 || dStricmp(mFilename + len - 4, ".wav"))
+      return false;
+
+   ResourceObject * obj = ResourceManager->find(mFilename);
+   if (!obj)
+      return false;
+
+   Stream *stream = ResourceManager->openStream(obj);
+   if (!stream)
+      return false;
+
+   // Read the whole file.
+   const U32 fileDataSize = stream->getStreamSize();
+   U8* pFileData = new U8[fileDataSize];
+   const bool readSuccess = stream->read(fileDataSize, pFileData);
+   ResourceManager->closeStream(stream);
+
+   if (!readSuccess)
+   {
+      delete [] pFileData;
+      return false;
+   }
+
+   mpFileData = pFileData;
+   mFileDataSize = fileDataSize;
+
+   // Move any data already decoded into the pool.
+   if (malBuffer != 0)
+   {
+      smCacheSize -= mDataSize;
+      smDecodedSize += mDataSize;
+      smDecodedBuffers.push_back(this);
+      enforceDecodedBudget();
+   }
+
+   return true;
+}
+
 //--------------------------------------
 Resource<AudioBuffer> AudioBuffer::find(const char *filename)
 {
@@ -195,6 +327,9 @@ ResourceInstance* AudioBuffer::construct(Stream &)
 //-----------------------------------------------------------------
 ALuint AudioBuffer::getALBuffer()
 {
+   // Attribute allocations to audio.
+   Memory::TagScope memoryTag(Memory::TagAudio);
+
    if (!alcGetCurrentContext())
       return 0;
 
@@ -204,12 +339,47 @@ ALuint AudioBuffer::getALBuffer()
    // Intangir> fix for newest openAL from creative (it returns true, yea right 0 is not a valid buffer)
    // it MIGHT not work at all for all i know.
    if (malBuffer && alIsBuffer(malBuffer))
+   {
+      // Mark the buffer as the most recently played.
+      if (mpFileData != NULL)
+      {
+         const S32 index = smDecodedBuffers.find_next(this);
+         if (index != -1 && index != smDecodedBuffers.size() - 1)
+         {
+            smDecodedBuffers.erase(index);
+            smDecodedBuffers.push_back(this);
+         }
+      }
+
       return malBuffer;
+   }
 
    alGenBuffers(1, &malBuffer);
    if(alGetError() != AL_NO_ERROR)
       return 0;
 
+   // Decode the file kept in memory.
+   if (mpFileData != NULL)
+   {
+      MemStream stream(mFileDataSize, mpFileData, true, false);
+      if (readWAV(&stream))
+      {
+         // Account for the decoded data and make room for it.
+         ALint size = 0;
+         alGetBufferi(malBuffer, AL_SIZE, &size);
+         mDataSize = (U32)getMax(size, 0);
+         smDecodedSize += mDataSize;
+         smDecodedBuffers.push_back(this);
+         enforceDecodedBudget();
+
+         return(malBuffer);
+      }
+
+      alDeleteBuffers(1, &malBuffer);
+      malBuffer = 0;
+      return 0;
+   }
+
    ResourceObject * obj = ResourceManager->find(mFilename);
    if(obj)
    {
@@ -221,7 +391,12 @@ ALuint AudioBuffer::getALBuffer()
 #ifdef LOG_SOUND_LOADS
          Con::printf("Reading WAV: %s\n", mFilename);
 #endif
-         readSuccess = readWAV(obj);
+         Stream *stream = ResourceManager->openStream(obj);
+         if (stream)
+         {
+            readSuccess = readWAV(stream);
+            ResourceManager->closeStream(stream);
+         }
       }
 #ifdef TORQUE_OS_IOS
        //-Mat lod a caf file on iPhone only
@@ -237,17 +412,26 @@ ALuint AudioBuffer::getALBuffer()
        }
 #endif
       if(readSuccess)
+      {
+         // Account for the decoded data and make room for it.
+         ALint size = 0;
+         alGetBufferi(malBuffer, AL_SIZE, &size);
+         mDataSize = (U32)getMax(size, 0);
+         smCacheSize += mDataSize;
+         enforceCacheBudget();
+
          return(malBuffer);
+      }
    }
 
    alDeleteBuffers(1, &malBuffer);
    return 0;
 }
 
-/*!   The Read a WAV file from the given ResourceObject and initialize
+/*!   The Read a WAV file from the given stream and initialize
       an alBuffer with it.
 */
-bool AudioBuffer::readWAV(ResourceObject *obj)
+bool AudioBuffer::readWAV(Stream *stream)
 {
    WAVChunkHdr chunkHdr;
    WAVFmtExHdr fmtExHdr;
@@ -261,10 +445,6 @@ bool AudioBuffer::readWAV(ResourceObject *obj)
    ALsizei freq   = 22050;
    ALboolean loop = AL_FALSE;
 
-   Stream *stream = ResourceManager->openStream(obj);
-   if (!stream)
-      return false;
-
    stream->read(4, &fileHdr.id[0]);
    stream->read(&fileHdr.size);
    stream->read(4, &fileHdr.type[0]);
@@ -298,8 +478,13 @@ bool AudioBuffer::readWAV(ResourceObject *obj)
          }
          else
          {
-            stream->read(sizeof(WAVFmtExHdr), &fmtExHdr);
-            chunkRemaining -= sizeof(WAVFmtExHdr);
+            stream->read(&fmtExHdr.size);
+            stream->read(&fmtExHdr.samplesPerBlock);
+            chunkRemaining -= sizeof(WAVFmtHdr) + sizeof(WAVFmtExHdr);
+
+            // IMA ADPCM is decoded to 16-bit samples.
+            format = (fmtHdr.channels==1 ? AL_FORMAT_MONO16 : AL_FORMAT_STEREO16);
+            freq=fmtHdr.samplesPerSec;
          }
       }
       // WAV Format header
@@ -334,9 +519,23 @@ bool AudioBuffer::readWAV(ResourceObject *obj)
             else
                break;
          }
-         else if (fmtHdr.format==0x0011)
+         else if (fmtHdr.format==ImaAdpcm::FormatTag && (fmtHdr.channels==1 || fmtHdr.channels==2) && fmtHdr.blockAlign > 4*fmtHdr.channels)
          {
             //IMA ADPCM
+            U8* blocks = new U8[chunkHdr.size];
+            stream->read(chunkHdr.size, blocks);
+            chunkRemaining -= chunkHdr.size;
+
+            // Decode the blocks (the last block may be short).
+            const U32 blockCount = (chunkHdr.size + fmtHdr.blockAlign - 1) / fmtHdr.blockAlign;
+            data = new char[blockCount * ImaAdpcm::getBlockSamples(fmtHdr.blockAlign, fmtHdr.channels) * fmtHdr.channels * sizeof(S16)];
+            for (U32 blockOffset = 0; blockOffset < chunkHdr.size; blockOffset += fmtHdr.blockAlign)
+            {
+               const U32 blockSize = getMin((U32)fmtHdr.blockAlign, chunkHdr.size - blockOffset);
+               const U32 samples = ImaAdpcm::decodeBlock(blocks + blockOffset, blockSize, fmtHdr.channels, (S16*)(data + size));
+               size += samples * fmtHdr.channels * sizeof(S16);
+            }
+            delete [] blocks;
          }
          else if (fmtHdr.format==0x0055)
          {
@@ -374,7 +573,6 @@ bool AudioBuffer::readWAV(ResourceObject *obj)
       chunkRemaining = chunkHdr.size + (chunkHdr.size&1);
    }
 
-   ResourceManager->closeStream(stream);
    if (data)
    {
       alBufferData(malBuffer, format, data, size, freq);
@@ -43,9 +43,17 @@ private:
    StringTableEntry  mFilename;
    bool              mLoading;
    ALuint            malBuffer;
+   U32               mDataSize;
+   U8*               mpFileData;
+   U32               mFileDataSize;
+
+   static U32        smCacheSize;
+   static U32        smDecodedSize;
+   static Vector<AudioBuffer*> smDecodedBuffers;
 
    bool readRIFFchunk(Stream &s, const char *seekLabel, U32 *size);
-   bool readWAV(ResourceObject *obj);
+   bool readWAV(Stream *stream);
+   bool releaseALBuffer();
 
 public:
    AudioBuffer(StringTableEntry filename);
@@ -56,6 +64,35 @@ public:
    static Resource<AudioBuffer> find(const char *filename);
    static ResourceInstance* construct(Stream& stream);
 
+   /// Delete the buffers that are no longer in use.
+   static void purgeUnused();
+
+   /// Get the size of the decoded audio data.
+   U32 getDataSize() const { return mDataSize; }
+
+   /// Get the total size of the decoded audio data of all the buffers.
+   /// Buffers that are no longer in use stay cached until the size exceeds the
+   /// budget ($pref::Audio::bufferCacheBudget megabytes) and are then deleted least
+   /// recently used first.
+   static U32 getCacheSize() { return smCacheSize; }
+
+   /// Delete buffers that are no longer in use until the cache is within its budget.
+   static void enforceCacheBudget();
+
+   /// Keep the audio file in memory and decode it only when it is played.
+   /// The decoded data of these buffers is pooled separately and, once the pool exceeds
+   /// its budget ($pref::Audio::decodedBufferBudget megabytes), the least recently played
+   /// buffers not attached to a source are released to be decoded again when next played.
+   bool loadFileData();
+   bool isDecodedOnPlay() const { return mpFileData != NULL; }
+   U32 getFileDataSize() const { return mFileDataSize; }
+
+   /// Get the total size of the decoded audio data of the buffers decoded on play.
+   static U32 getDecodedSize() { return smDecodedSize; }
+
+   /// Release the decoded audio data of buffers decoded on play until the pool is within its budget.
+   static void enforceDecodedBudget();
+
 };
 
 
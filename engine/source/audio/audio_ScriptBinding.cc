@@ -168,11 +168,15 @@ ConsoleFunctionGroupBegin(Audio, "Functions dealing with the OpenAL audio layer.
 
 /*! Use the OpenALInitDriver function to initialize the OpenAL driver.
     This must be done before all other OpenAL operations.
-    @return Returns true on successful initialization, false otherwise.
+    @return Returns true on successful initialization, false otherwise (always false when headless).
     @sa OpenALShutdownDriver
 */
 ConsoleFunctionWithDocs(OpenALInitDriver, ConsoleBool, 1, 1, ())
 {
+   // A headless server has no audio.
+   if (Platform::isHeadless())
+      return false;
+
    if (Audio::OpenALInit())
    {
       static bool registered = false;
@@ -0,0 +1,128 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#include "audio/imaAdpcm.h"
+
+#ifndef _MMATH_H_
+#include "math/mMath.h"
+#endif
+
+//--------------------------------------------------------------------------
+
+static const S32 imaIndexTable[16] =
+{
+   -1, -1, -1, -1, 2, 4, 6, 8,
+   -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+static const S32 imaStepTable[89] =
+{
+   7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+   19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+   50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+   130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+   337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+   876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+   2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+   5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+   15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+//--------------------------------------------------------------------------
+
+static inline S16 decodeNibble( const U8 nibble, S32& predictor, S32& stepIndex )
+{
+   const S32 step = imaStepTable[stepIndex];
+
+   S32 difference = step >> 3;
+   if ( nibble & 4 )
+      difference += step;
+   if ( nibble & 2 )
+      difference += step >> 1;
+   if ( nibble & 1 )
+      difference += step >> 2;
+
+   if ( nibble & 8 )
+      predictor -= difference;
+   else
+      predictor += difference;
+
+   predictor = mClamp( predictor, -32768, 32767 );
+   stepIndex = mClamp( stepIndex + imaIndexTable[nibble], 0, 88 );
+
+   return (S16)predictor;
+}
+
+//--------------------------------------------------------------------------
+
+U32 ImaAdpcm::getBlockSamples( const U32 blockSize, const U32 channels )
+{
+   const U32 headerSize = 4 * channels;
+
+   if ( channels == 0 || blockSize < headerSize )
+      return 0;
+
+   // Samples are stored in groups of 4 bytes (8 samples) per channel.
+   const U32 groups = (blockSize - headerSize) / headerSize;
+
+   return 1 + groups * 8;
+}
+
+//--------------------------------------------------------------------------
+
+U32 ImaAdpcm::decodeBlock( const U8* pBlock, const U32 blockSize, const U32 channels, S16* pOutput )
+{
+   const U32 samples = getBlockSamples( blockSize, channels );
+
+   if ( samples == 0 )
+      return 0;
+
+   for ( U32 channel = 0; channel < channels; ++channel )
+   {
+      // Read the channel header.
+      const U8* pHeader = pBlock + channel * 4;
+      S32 predictor = (S16)(pHeader[0] | (pHeader[1] << 8));
+      S32 stepIndex = mClamp( (S32)pHeader[2], 0, 88 );
+
+      // The first sample is stored in the header.
+      S16* pChannelOutput = pOutput + channel;
+      *pChannelOutput = (S16)predictor;
+      pChannelOutput += channels;
+
+      // Decode the groups for this channel.
+      const U8* pData = pBlock + channels * 4 + channel * 4;
+      for ( U32 sample = 1; sample < samples; sample += 8, pData += channels * 4 )
+      {
+         for ( U32 byte = 0; byte < 4; ++byte )
+         {
+            // The low nibble is the earlier sample.
+            *pChannelOutput = decodeNibble( pData[byte] & 0x0f, predictor, stepIndex );
+            pChannelOutput += channels;
+            *pChannelOutput = decodeNibble( pData[byte] >> 4, predictor, stepIndex );
+            pChannelOutput += channels;
+         }
+      }
+   }
+
+   return samples;
+}
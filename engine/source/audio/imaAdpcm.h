@@ -0,0 +1,57 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#ifndef _IMA_ADPCM_H_
+#define _IMA_ADPCM_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+//--------------------------------------------------------------------------
+
+/// Decoder for IMA ADPCM (WAV format 0x0011) audio blocks.
+///
+/// IMA ADPCM stores 4 bits per sample so a WAV file is a quarter of the size
+/// of the same 16-bit PCM data.  Each block starts with a 4 byte header per channel
+/// holding the first sample and the step index followed by the encoded samples,
+/// interleaved per channel in groups of 4 bytes.
+class ImaAdpcm
+{
+public:
+   enum
+   {
+      FormatTag = 0x0011
+   };
+
+   /// Get the number of samples (per channel) a block of the specified size decodes to.
+   static U32 getBlockSamples( const U32 blockSize, const U32 channels );
+
+   /// Decode a block to interleaved 16-bit PCM samples.
+   /// The block may be shorter than the block alignment of the file (the last block usually is).
+   /// @param pOutput Must hold getBlockSamples( blockSize, channels ) * channels samples.
+   /// @return The number of samples (per channel) decoded.
+   static U32 decodeBlock( const U8* pBlock, const U32 blockSize, const U32 channels, S16* pOutput );
+};
+
+#endif // _IMA_ADPCM_H_
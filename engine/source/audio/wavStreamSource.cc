@@ -28,6 +28,8 @@
 //--------------------------------------
 
 #include "audio/wavStreamSource.h"
+#include "audio/imaAdpcm.h"
+#include "console/console.h"
 
 #define BUFFERSIZE 32768
 
@@ -111,6 +113,9 @@ WavStreamSource::WavStreamSource(const char *filename)  {
    bIsValid = false;
    bBuffersAllocated = false;
    mBufferList[0] = 0;
+   mpData = NULL;
+   mpBlocks = NULL;
+   mDataBufferSize = 0;
    clear();
 
    mFilename = filename;
@@ -150,47 +155,29 @@ void WavStreamSource::clear()
 }
 
 bool WavStreamSource::initStream() {
-   WAVChunkHdr chunkHdr;
-   WAVFileHdr  fileHdr;
-   WAVFmtHdr   fmtHdr;
-
    ALint			error;
 
    bFinished = false;
 
-   char   data[BUFFERSIZE];
-
    alSourceStop(mSource);
    alSourcei(mSource, AL_BUFFER, 0);
 
     stream = ResourceManager->openStream(mFilename);
     if(stream != NULL) {
-       stream->read(4, &fileHdr.id[0]);
-       stream->read(&fileHdr.size);
-       stream->read(4, &fileHdr.type[0]);
-
-       stream->read(4, &chunkHdr.id[0]);
-       stream->read(&chunkHdr.size);
-
-       // WAV Format header
-        stream->read(&fmtHdr.format);
-        stream->read(&fmtHdr.channels);
-        stream->read(&fmtHdr.samplesPerSec);
-        stream->read(&fmtHdr.bytesPerSec);
-        stream->read(&fmtHdr.blockAlign);
-        stream->read(&fmtHdr.bitsPerSample);
-
-        format=(fmtHdr.channels==1?
-           (fmtHdr.bitsPerSample==8?AL_FORMAT_MONO8:AL_FORMAT_MONO16):
-           (fmtHdr.bitsPerSample==8?AL_FORMAT_STEREO8:AL_FORMAT_STEREO16));
-        freq=fmtHdr.samplesPerSec;
+        if(!readHeader())
+            return false;
 
-         stream->read(4, &chunkHdr.id[0]);
-         stream->read(&chunkHdr.size);
+        // Size the data buffer to hold whole decoded blocks.
+        ALuint blockDataSize = 1;
+        if(mFormatTag == ImaAdpcm::FormatTag)
+            blockDataSize = ImaAdpcm::getBlockSamples(mBlockAlign, mChannels) * mChannels * sizeof(S16);
+        const U32 blocksPerBuffer = getMax((U32)(BUFFERSIZE / blockDataSize), (U32)1);
 
-        DataSize = chunkHdr.size;
-        DataLeft = DataSize;
-        dataStart = stream->getPosition();
+        delete [] mpData;
+        delete [] mpBlocks;
+        mDataBufferSize = blocksPerBuffer * blockDataSize;
+        mpData = new char[mDataBufferSize];
+        mpBlocks = mFormatTag == ImaAdpcm::FormatTag ? new U8[blocksPerBuffer * mBlockAlign] : NULL;
 
         // Clear Error Code
         alGetError();
@@ -205,13 +192,8 @@ bool WavStreamSource::initStream() {
         int numBuffers = 0;
         for(int loop = 0; loop < NUMBUFFERS; loop++)
         {
-            ALuint DataToRead = (DataLeft > BUFFERSIZE) ? BUFFERSIZE : DataLeft;
-
-            if (DataToRead == DataLeft)
-                bFinished = AL_TRUE;
-            stream->read(DataToRead, data);
-            DataLeft -= DataToRead;
-            alBufferData(mBufferList[loop], format, data, DataToRead, freq);	
+            const ALuint dataSize = readData();
+            alBufferData(mBufferList[loop], format, mpData, dataSize, freq);	
             if ((error = alGetError()) != AL_NO_ERROR) {
                 return false;
             }
@@ -239,12 +221,120 @@ bool WavStreamSource::initStream() {
    return true;
 }
 
+bool WavStreamSource::readHeader() {
+    WAVChunkHdr chunkHdr;
+    WAVFileHdr  fileHdr;
+    WAVFmtHdr   fmtHdr;
+    bool        formatRead = false;
+
+    stream->read(4, &fileHdr.id[0]);
+    stream->read(&fileHdr.size);
+    stream->read(4, &fileHdr.type[0]);
+
+    if(dStrncmp((const char*)fileHdr.id, "RIFF", 4) || dStrncmp((const char*)fileHdr.type, "WAVE", 4)) {
+        Con::warnf("WavStreamSource - '%s' is not a WAV file.", mFilename);
+        return false;
+    }
+
+    // Walk the chunks until the data is found.
+    while(stream->getStatus() == Stream::Ok) {
+        stream->read(4, &chunkHdr.id[0]);
+        stream->read(&chunkHdr.size);
+        if(stream->getStatus() != Stream::Ok)
+            break;
+
+        // Chunks are word aligned.
+        const U32 chunkEnd = stream->getPosition() + chunkHdr.size + (chunkHdr.size & 1);
+
+        // WAV Format header
+        if(!dStrncmp((const char*)chunkHdr.id, "fmt ", 4)) {
+            stream->read(&fmtHdr.format);
+            stream->read(&fmtHdr.channels);
+            stream->read(&fmtHdr.samplesPerSec);
+            stream->read(&fmtHdr.bytesPerSec);
+            stream->read(&fmtHdr.blockAlign);
+            stream->read(&fmtHdr.bitsPerSample);
+
+            if(fmtHdr.format == 0x0001) {
+                format=(fmtHdr.channels==1?
+                   (fmtHdr.bitsPerSample==8?AL_FORMAT_MONO8:AL_FORMAT_MONO16):
+                   (fmtHdr.bitsPerSample==8?AL_FORMAT_STEREO8:AL_FORMAT_STEREO16));
+            }
+            else if(fmtHdr.format == ImaAdpcm::FormatTag && fmtHdr.blockAlign > 4 * fmtHdr.channels) {
+                // IMA ADPCM is decoded to 16-bit samples.
+                format = fmtHdr.channels == 1 ? AL_FORMAT_MONO16 : AL_FORMAT_STEREO16;
+            }
+            else {
+                Con::warnf("WavStreamSource - '%s' uses an unsupported WAV format (%d).", mFilename, fmtHdr.format);
+                return false;
+            }
+
+            if(fmtHdr.channels != 1 && fmtHdr.channels != 2) {
+                Con::warnf("WavStreamSource - '%s' has an unsupported number of channels (%d).", mFilename, fmtHdr.channels);
+                return false;
+            }
+
+            freq = fmtHdr.samplesPerSec;
+            mFormatTag = fmtHdr.format;
+            mChannels = fmtHdr.channels;
+            mBlockAlign = fmtHdr.blockAlign;
+            formatRead = true;
+        }
+        // WAV Data
+        else if(!dStrncmp((const char*)chunkHdr.id, "data", 4)) {
+            if(!formatRead)
+                break;
+
+            DataSize = chunkHdr.size;
+            DataLeft = DataSize;
+            dataStart = stream->getPosition();
+            return true;
+        }
+
+        // Skip the remainder of the chunk.
+        stream->setPosition(chunkEnd);
+    }
+
+    Con::warnf("WavStreamSource - Could not find the format and data in '%s'.", mFilename);
+    return false;
+}
+
+ALuint WavStreamSource::readData() {
+    ALuint dataSize;
+
+    if(mFormatTag == ImaAdpcm::FormatTag) {
+        // Read whole blocks (the last block may be short) and decode them.
+        const ALuint blockDataSize = ImaAdpcm::getBlockSamples(mBlockAlign, mChannels) * mChannels * sizeof(S16);
+        const ALuint blocksSize = (mDataBufferSize / blockDataSize) * mBlockAlign;
+        const ALuint DataToRead = (DataLeft > blocksSize) ? blocksSize : DataLeft;
+
+        stream->read(DataToRead, mpBlocks);
+        DataLeft -= DataToRead;
+
+        dataSize = 0;
+        for(ALuint blockOffset = 0; blockOffset < DataToRead; blockOffset += mBlockAlign) {
+            const ALuint blockSize = getMin((ALuint)mBlockAlign, DataToRead - blockOffset);
+            const U32 samples = ImaAdpcm::decodeBlock(mpBlocks + blockOffset, blockSize, mChannels, (S16*)(mpData + dataSize));
+            dataSize += samples * mChannels * sizeof(S16);
+        }
+    }
+    else {
+        dataSize = (DataLeft > mDataBufferSize) ? mDataBufferSize : DataLeft;
+        stream->read(dataSize, mpData);
+        DataLeft -= dataSize;
+    }
+
+    if(DataLeft == 0)
+        bFinished = AL_TRUE;
+
+    return dataSize;
+}
+
 bool WavStreamSource::updateBuffers() {
 
     ALint			processed;
     ALuint			BufferID;
     ALint			error;
-    char data[BUFFERSIZE];
 
     // don't do anything if buffer isn't initialized
     if(!bIsValid)
@@ -272,16 +362,9 @@ bool WavStreamSource::updateBuffers() {
 
             if (!bFinished)
             {
-                ALuint DataToRead = (DataLeft > BUFFERSIZE) ? BUFFERSIZE : DataLeft;
-
-                if (DataToRead == DataLeft) {
-                    bFinished = AL_TRUE;
-                }
-                    
-                stream->read(DataToRead, data);
-                DataLeft -= DataToRead;
+                const ALuint dataSize = readData();
                     
-                alBufferData(BufferID, format, data, DataToRead, freq);
+                alBufferData(BufferID, format, mpData, dataSize, freq);
                 if ((error = alGetError()) != AL_NO_ERROR)
                     return false;
 
@@ -321,6 +404,11 @@ void WavStreamSource::freeStream() {
         ResourceManager->closeStream(stream);
     stream = NULL;
 
+    delete [] mpData;
+    delete [] mpBlocks;
+    mpData = NULL;
+    mpBlocks = NULL;
+
     if(bBuffersAllocated) {
         if(mBufferList[0] != 0)
             alDeleteBuffers(NUMBUFFERS, mBufferList);
@@ -337,8 +425,6 @@ void WavStreamSource::resetStream() {
     bFinished = AL_FALSE;
 }
 
-#include "console/console.h"
-
 F32 WavStreamSource::getElapsedTime()
 {
    Con::warnf( "GetElapsedTime not implemented in WaveStreams yet" );
@@ -59,8 +59,20 @@ class WavStreamSource: public AudioStreamSource
 
         bool			bBuffersAllocated;
 
+        // Source data format.
+        ALushort        mFormatTag;
+        ALushort        mChannels;
+        ALushort        mBlockAlign;
+
+        // Decoded data for a buffer and (for IMA ADPCM) the blocks it is decoded from.
+        char           *mpData;
+        U8             *mpBlocks;
+        U32             mDataBufferSize;
+
         void clear();
         void resetStream();
+        bool readHeader();
+        ALuint readData();
 };
 
 #endif // _AUDIOSTREAMSOURCE_H_
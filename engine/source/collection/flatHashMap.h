@@ -0,0 +1,504 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#ifndef _FLAT_HASH_MAP_H_
+#define _FLAT_HASH_MAP_H_
+
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
+/// A HashMap template class stored in a single flat array.
+///
+/// Entries live in one array rather than in a node per entry so a lookup usually touches
+/// a couple of cache lines and inserts never allocate unless the table grows.  Collisions
+/// are resolved with Robin Hood linear probing: an insert displaces any entry nearer its
+/// home slot than the entry being inserted, keeping probes short, and an erase shifts the
+/// following entries back so no tombstones are left behind.  Clearing keeps the storage.
+///
+/// The interface matches HashMap so a caller migrates by changing its typedef, but note that
+/// iteration order is unspecified and any insert or erase invalidates iterators and pointers
+/// to entries.  Keys are hashed and compared the same way as HashTable.
+/// @ingroup UtilContainers
+template<typename Key, typename Value>
+class FlatHashMap
+{
+public:
+   typedef typename HashTable<Key,Value>::Pair Pair;
+
+private:
+   enum
+   {
+      MinCapacity = 8,              ///< Smallest table allocated.
+      MaxDistance = 255             ///< Longest probe before the table is grown.
+   };
+
+   Pair* mPairs;                    ///< Entry slots.
+   U8* mDistances;                  ///< Probe distance + 1 of each slot or zero if the slot is empty.
+   U32 mCapacity;                   ///< Slot count, always zero or a power of two.
+   U32 mShift;                      ///< Shift taking a mixed hash to a slot index.
+   U32 mSize;                       ///< Number of entries in the map.
+
+   U32 _home(const Key& key) const;
+   U32 _next(U32 index) const;
+   S32 _findIndex(const Key& key) const;
+   S32 _place(Pair& pair);
+   U32 _insert(const Pair& pair);
+   void _eraseIndex(U32 index);
+   void _allocate(U32 capacity);
+   void _resize(U32 capacity);
+   void _destroy();
+
+public:
+   // iterator support
+   template<typename U, typename M>
+   class _Iterator {
+      friend class FlatHashMap;
+      M* mMap;
+      U32 mIndex;
+   public:
+      typedef U  ValueType;
+      typedef U* Pointer;
+      typedef U& Reference;
+
+      _Iterator() : mMap(0), mIndex(0) {}
+      _Iterator(M* map, U32 index) : mMap(map), mIndex(index) {}
+
+      _Iterator& operator++()
+      {
+         mIndex = mMap->_next(mIndex + 1);
+         return *this;
+      }
+
+      _Iterator operator++(int)
+      {
+         _Iterator itr(*this);
+         ++(*this);
+         return itr;
+      }
+
+      bool operator==(const _Iterator& b) const
+      {
+         return mMap == b.mMap && mIndex == b.mIndex;
+      }
+
+      bool operator!=(const _Iterator& b) const
+      {
+         return !(*this == b);
+      }
+
+      U* operator->() const
+      {
+         return &mMap->mPairs[mIndex];
+      }
+
+      U& operator*() const
+      {
+         return mMap->mPairs[mIndex];
+      }
+   };
+
+   // Types
+   typedef Pair        ValueType;
+   typedef Pair&       Reference;
+   typedef const Pair& ConstReference;
+   typedef S32         DifferenceType;
+   typedef U32         SizeType;
+
+   typedef _Iterator<Pair,FlatHashMap>  iterator;
+   typedef _Iterator<const Pair,const FlatHashMap>  const_iterator;
+
+   // Initialization
+   FlatHashMap();
+   ~FlatHashMap();
+   FlatHashMap(const FlatHashMap& p);
+
+   // Management
+   U32  size() const;                  ///< Return the number of elements
+   U32  tableSize() const;             ///< Return the number of slots
+   void clear();                       ///< Empty the map but keep the storage
+   void reserve(U32 size);             ///< Size the table to hold the given number of elements without growing
+   bool isEmpty() const;               ///< Returns true if the map is empty
+
+   // Insert & erase elements
+   iterator insert(const Key& key, const Value&); // Documented below...
+   void erase(iterator);               ///< Erase the given entry
+   void erase(const Key& key);         ///< Erase the key from the map
+
+   // Lookup
+   iterator find(const Key&);          ///< Find entry for the given key
+   const_iterator find(const Key&) const;    ///< Find entry for the given key
+   bool contains(const Key& key) const { return _findIndex(key) >= 0; }
+
+   // Forward iterator access
+   iterator       begin();             ///< iterator to first element
+   const_iterator begin() const;       ///< iterator to first element
+   iterator       end();               ///< iterator to last element + 1
+   const_iterator end() const;         ///< iterator to last element + 1
+
+   // Operators
+   Value& operator[](const Key&);      ///< Index using the given key. If the key is not currently in the map it is added.
+   void operator=(const FlatHashMap& p);
+};
+
+template<typename Key, typename Value> FlatHashMap<Key,Value>::FlatHashMap()
+{
+   mPairs = NULL;
+   mDistances = NULL;
+   mCapacity = 0;
+   mShift = 32;
+   mSize = 0;
+}
+
+template<typename Key, typename Value> FlatHashMap<Key,Value>::FlatHashMap(const FlatHashMap& p)
+{
+   mPairs = NULL;
+   mDistances = NULL;
+   mCapacity = 0;
+   mShift = 32;
+   mSize = 0;
+   *this = p;
+}
+
+template<typename Key, typename Value> FlatHashMap<Key,Value>::~FlatHashMap()
+{
+   _destroy();
+}
+
+
+//-----------------------------------------------------------------------------
+
+template<typename Key, typename Value>
+inline U32 FlatHashMap<Key,Value>::_home(const Key& key) const
+{
+   // Mix the hash so sequential keys and aligned pointers spread over the table.
+   return (U32)(Hash::hash(key) * 2654435761u) >> mShift;
+}
+
+template<typename Key, typename Value>
+inline U32 FlatHashMap<Key,Value>::_next(U32 index) const
+{
+   while (index < mCapacity && mDistances[index] == 0)
+      index++;
+   return index;
+}
+
+template<typename Key, typename Value>
+S32 FlatHashMap<Key,Value>::_findIndex(const Key& key) const
+{
+   if (!mSize)
+      return -1;
+
+   // Entries are ordered by probe distance so stop at the first slot nearer its home than the key would be.
+   const U32 mask = mCapacity - 1;
+   U32 index = _home(key);
+   for (U32 distance = 1; mDistances[index] >= distance; distance++, index = (index + 1) & mask)
+      if (mDistances[index] == distance && tKeyCompare::equals<Key>( mPairs[index].key, key ))
+         return (S32)index;
+   return -1;
+}
+
+/// Place a pair whose key is not in the map.
+/// Returns the slot the pair was placed in or -1 if a probe ran too long, in which case
+/// the pair is left holding whichever entry was displaced and still needs a slot.
+template<typename Key, typename Value>
+S32 FlatHashMap<Key,Value>::_place(Pair& pair)
+{
+   const U32 mask = mCapacity - 1;
+   U32 index = _home(pair.key);
+   S32 result = -1;
+   for (U32 distance = 1; distance < MaxDistance; distance++, index = (index + 1) & mask)
+   {
+      const U32 slotDistance = mDistances[index];
+      if (slotDistance == 0)
+      {
+         mPairs[index] = pair;
+         mDistances[index] = (U8)distance;
+         mSize++;
+         return result >= 0 ? result : (S32)index;
+      }
+
+      // Take the slot from an entry nearer its home and carry on placing that entry.
+      if (slotDistance < distance)
+      {
+         Pair displaced = mPairs[index];
+         mPairs[index] = pair;
+         pair = displaced;
+         mDistances[index] = (U8)distance;
+         distance = slotDistance;
+         if (result < 0)
+            result = (S32)index;
+      }
+   }
+   return -1;
+}
+
+template<typename Key, typename Value>
+U32 FlatHashMap<Key,Value>::_insert(const Pair& pair)
+{
+   // Keep the load below 7/8.
+   if ((mSize + 1) * 8 > mCapacity * 7)
+      _resize(getMax(mCapacity * 2, (U32)MinCapacity));
+
+   Pair current = pair;
+   const S32 index = _place(current);
+   if (index >= 0)
+      return (U32)index;
+
+   // A probe ran too long so grow until the entry in hand fits then find where the new entry went.
+   do
+   {
+      _resize(mCapacity * 2);
+   } while (_place(current) < 0);
+   return (U32)_findIndex(pair.key);
+}
+
+template<typename Key, typename Value>
+void FlatHashMap<Key,Value>::_eraseIndex(U32 index)
+{
+   // Shift the following entries back a slot until one is at its home or the slot is empty.
+   const U32 mask = mCapacity - 1;
+   U32 next = (index + 1) & mask;
+   while (mDistances[next] > 1)
+   {
+      mPairs[index] = mPairs[next];
+      mDistances[index] = mDistances[next] - 1;
+      index = next;
+      next = (next + 1) & mask;
+   }
+   mPairs[index] = Pair();
+   mDistances[index] = 0;
+   mSize--;
+}
+
+template<typename Key, typename Value>
+void FlatHashMap<Key,Value>::_allocate(U32 capacity)
+{
+   mCapacity = capacity;
+   mShift = 32;
+   while (capacity > 1)
+   {
+      capacity >>= 1;
+      mShift--;
+   }
+   mPairs = new Pair[mCapacity];
+   mDistances = new U8[mCapacity];
+   dMemset(mDistances, 0, mCapacity);
+   mSize = 0;
+}
+
+template<typename Key, typename Value>
+void FlatHashMap<Key,Value>::_resize(U32 capacity)
+{
+   Pair* pairs = mPairs;
+   U8* distances = mDistances;
+   const U32 currentCapacity = mCapacity;
+
+   // Place the entries in the new table, growing it further should a probe run too long.
+   for (;;)
+   {
+      _allocate(capacity);
+
+      bool placed = true;
+      for (U32 i = 0; i < currentCapacity && placed; i++)
+         if (distances[i])
+         {
+            Pair pair = pairs[i];
+            placed = _place(pair) >= 0;
+         }
+
+      if (placed)
+         break;
+
+      _destroy();
+      capacity *= 2;
+   }
+
+   delete[] pairs;
+   delete[] distances;
+}
+
+template<typename Key, typename Value>
+void FlatHashMap<Key,Value>::_destroy()
+{
+   delete[] mPairs;
+   delete[] mDistances;
+   mPairs = NULL;
+   mDistances = NULL;
+   mCapacity = 0;
+   mShift = 32;
+   mSize = 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// management
+
+template<typename Key, typename Value>
+inline U32 FlatHashMap<Key,Value>::size() const
+{
+   return mSize;
+}
+
+template<typename Key, typename Value>
+inline U32 FlatHashMap<Key,Value>::tableSize() const
+{
+   return mCapacity;
+}
+
+template<typename Key, typename Value>
+void FlatHashMap<Key,Value>::clear()
+{
+   if (!mSize)
+      return;
+
+   for (U32 i = 0; i < mCapacity; i++)
+      if (mDistances[i])
+         mPairs[i] = Pair();
+   dMemset(mDistances, 0, mCapacity);
+   mSize = 0;
+}
+
+template<typename Key, typename Value>
+void FlatHashMap<Key,Value>::reserve(U32 size)
+{
+   U32 capacity = MinCapacity;
+   while (size * 8 > capacity * 7)
+      capacity *= 2;
+   if (capacity > mCapacity)
+      _resize(capacity);
+}
+
+template<typename Key, typename Value>
+inline bool FlatHashMap<Key,Value>::isEmpty() const
+{
+   return mSize == 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// add & remove elements
+
+/// Insert the key value pair but don't allow duplicates.
+/// The map does not allow duplicate keys. If the key already exists in
+/// the map the function will fail and return end().
+template<typename Key, typename Value>
+typename FlatHashMap<Key,Value>::iterator FlatHashMap<Key,Value>::insert(const Key& key, const Value& x)
+{
+   if (_findIndex(key) >= 0)
+      return end();
+   return iterator(this,_insert(Pair(key,x)));
+}
+
+template<typename Key, typename Value>
+void FlatHashMap<Key,Value>::erase(const Key& key)
+{
+   const S32 index = _findIndex(key);
+   if (index >= 0)
+      _eraseIndex((U32)index);
+}
+
+template<typename Key, typename Value>
+void FlatHashMap<Key,Value>::erase(iterator node)
+{
+   if (node.mIndex < mCapacity && mDistances[node.mIndex])
+      _eraseIndex(node.mIndex);
+}
+
+
+//-----------------------------------------------------------------------------
+// Searching
+
+template<typename Key, typename Value>
+typename FlatHashMap<Key,Value>::iterator FlatHashMap<Key,Value>::find(const Key& key)
+{
+   const S32 index = _findIndex(key);
+   return index >= 0 ? iterator(this,(U32)index) : end();
+}
+
+template<typename Key, typename Value>
+typename FlatHashMap<Key,Value>::const_iterator FlatHashMap<Key,Value>::find(const Key& key) const
+{
+   const S32 index = _findIndex(key);
+   return index >= 0 ? const_iterator(this,(U32)index) : end();
+}
+
+
+//-----------------------------------------------------------------------------
+// iterator access
+
+template<typename Key, typename Value>
+inline typename FlatHashMap<Key,Value>::iterator FlatHashMap<Key,Value>::begin()
+{
+   return iterator(this,_next(0));
+}
+
+template<typename Key, typename Value>
+inline typename FlatHashMap<Key,Value>::const_iterator FlatHashMap<Key,Value>::begin() const
+{
+   return const_iterator(this,_next(0));
+}
+
+template<typename Key, typename Value>
+inline typename FlatHashMap<Key,Value>::iterator FlatHashMap<Key,Value>::end()
+{
+   return iterator(this,mCapacity);
+}
+
+template<typename Key, typename Value>
+inline typename FlatHashMap<Key,Value>::const_iterator FlatHashMap<Key,Value>::end() const
+{
+   return const_iterator(this,mCapacity);
+}
+
+
+//-----------------------------------------------------------------------------
+// operators
+
+template<typename Key, typename Value>
+Value& FlatHashMap<Key,Value>::operator[](const Key& key)
+{
+   S32 index = _findIndex(key);
+   if (index < 0)
+      index = (S32)_insert(Pair(key,Value()));
+   return mPairs[index].value;
+}
+
+template<typename Key, typename Value>
+void FlatHashMap<Key,Value>::operator=(const FlatHashMap& p)
+{
+   if (this == &p)
+      return;
+
+   _destroy();
+   if (!p.mCapacity)
+      return;
+
+   _allocate(p.mCapacity);
+   for (U32 i = 0; i < mCapacity; i++)
+      mPairs[i] = p.mPairs[i];
+   dMemcpy(mDistances, p.mDistances, mCapacity);
+   mSize = p.mSize;
+}
+
+#endif // _FLAT_HASH_MAP_H_
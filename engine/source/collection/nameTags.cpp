@@ -49,6 +49,7 @@ NameTags::NameTags() :
 
 NameTags::~NameTags()
 {
+    clearIndex();
     mHashTagMap.clear();
     mTagNameMap.clear();
 }
@@ -109,6 +110,75 @@ bool NameTags::onAdd()
 
 //-----------------------------------------------------------------------------
 
+void NameTags::onRemove()
+{
+    // Call parent.
+    Parent::onRemove();
+
+    // The objects are no longer in the set.
+    clearIndex();
+}
+
+//-----------------------------------------------------------------------------
+
+void NameTags::addObject( SimObject* pObject )
+{
+    // Finish if already in the set.
+    if ( pObject->findSetMembership( this ) != NULL )
+        return;
+
+    // Call parent.
+    Parent::addObject( pObject );
+
+    indexObject( pObject );
+}
+
+//-----------------------------------------------------------------------------
+
+void NameTags::removeObject( SimObject* pObject )
+{
+    // Finish if not in the set.
+    if ( pObject->findSetMembership( this ) == NULL )
+        return;
+
+    // Call parent.
+    Parent::removeObject( pObject );
+
+    unindexObject( pObject );
+}
+
+//-----------------------------------------------------------------------------
+
+void NameTags::pushObject( SimObject* pObject )
+{
+    // Call parent.
+    Parent::pushObject( pObject );
+
+    indexObject( pObject );
+}
+
+//-----------------------------------------------------------------------------
+
+void NameTags::popObject()
+{
+    // Finish if the set is empty.
+    if ( size() == 0 )
+    {
+        Parent::popObject();
+        return;
+    }
+
+    // Fetch the last object.
+    SimObject* pObject = last();
+
+    // Call parent.
+    Parent::popObject();
+
+    unindexObject( pObject );
+}
+
+//-----------------------------------------------------------------------------
+
 NameTags::TagId NameTags::createTag( const char* pTagName )
 {
     // Sanity!
@@ -191,9 +261,17 @@ NameTags::TagId NameTags::deleteTag( const NameTags::TagId tagId )
     }
 
     // Remove tag.
-    mHashTagMap.erase( tagId );
+    mHashTagMap.erase( StringTable->hashString( itr->value ) );
     mTagNameMap.erase( tagId );
 
+    // Remove the tag index.
+    tagIndexType::iterator indexItr = mTagIndex.find( tagId );
+    if ( indexItr != mTagIndex.end() )
+    {
+        delete indexItr->value;
+        mTagIndex.erase( indexItr );
+    }
+
     return tagId;
 }
 
@@ -292,6 +370,16 @@ bool NameTags::tag( const SimObjectId objId, const TagId tagId )
     // Update field.
     pSimObject->setDataField( mNameTagsFieldEntry, NULL, newTagsBuffer );
 
+    // Index the tag if the object is in the set.
+    if ( pSimObject->findSetMembership( this ) != NULL )
+    {
+        queryType*& pTaggedObjects = mTagIndex[tagId];
+        if ( pTaggedObjects == NULL )
+            pTaggedObjects = new queryType;
+
+        pTaggedObjects->insert( objId, pSimObject );
+    }
+
     return true;
 }
 
@@ -338,6 +426,11 @@ bool NameTags::untag( const SimObjectId objId, const TagId tagId )
             // Update field.
             pSimObject->setDataField( mNameTagsFieldEntry, NULL, pNewTags );
 
+            // Remove from the tag index.
+            tagIndexType::iterator indexItr = mTagIndex.find( tagId );
+            if ( indexItr != mTagIndex.end() )
+                indexItr->value->erase( objId );
+
             // Done.
             return true;
         }
@@ -390,30 +483,16 @@ bool NameTags::hasTag( const SimObjectId objId, const TagId tagId ) const
 
 //-----------------------------------------------------------------------------
 
-void NameTags::queryTags( const char* pTags )
+void NameTags::queryTags( const char* pTags, const bool excluded )
 {
-    Vector<NameTags::TagId> tags;
-    Vector<SimObjectId> transfers;
-
     // Clear queries.
     mIncludedQueryMap.clear();
     mExcludedQueryMap.clear();
 
-    // Reset excluded.
-    for( Parent::iterator itr = begin(); itr != end(); ++itr )
-    {
-        SimObject* pSimObject = (*itr);
-        mExcludedQueryMap.insert( pSimObject->getId(), pSimObject );
-    }
-
     // Fetch tag count.
     const U32 tagCount = StringUnit::getUnitCount( pTags, " \t\n" );
 
-    // Finish if no tags specified.
-    if ( tagCount == 0 )
-        return;
-
-    // Get tags.
+    // Include the objects indexed under each tag.
     for ( U32 index = 0; index < tagCount; ++index )
     {   
         // Fetch tag Id.
@@ -426,63 +505,96 @@ void NameTags::queryTags( const char* pTags )
             continue;
         }
 
-        // Fetch tag Id.
-        tags.push_back( tagId );
+        // Fetch the tagged objects.
+        const queryType* pTaggedObjects = getTaggedObjects( tagId );
+
+        // Skip if none.
+        if ( pTaggedObjects == NULL )
+            continue;
+
+        // Include the tagged objects.
+        for( queryType::const_iterator itr = pTaggedObjects->begin(); itr != pTaggedObjects->end(); ++itr )
+            mIncludedQueryMap.insert( itr->key, itr->value );
     }
 
-    // Iterate tag Ids.
-    for ( U32 tagIndex = 0; tagIndex < tagCount; ++tagIndex )
-    {   
+    // Finish if the excluded objects are not needed.
+    if ( !excluded )
+        return;
+
+    // Exclude any other objects.
+    for( Parent::iterator itr = begin(); itr != end(); ++itr )
+    {
+        SimObject* pSimObject = (*itr);
+        if ( mIncludedQueryMap.find( pSimObject->getId() ) == mIncludedQueryMap.end() )
+            mExcludedQueryMap.insert( pSimObject->getId(), pSimObject );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+const NameTags::queryType* NameTags::getTaggedObjects( const TagId tagId ) const
+{
+    // Find the tag index.
+    tagIndexType::const_iterator indexItr = mTagIndex.find( tagId );
+
+    return indexItr == mTagIndex.end() ? NULL : indexItr->value;
+}
+
+//-----------------------------------------------------------------------------
+
+void NameTags::indexObject( SimObject* pSimObject )
+{
+    // Fetch tags.
+    const char* pFieldTags = pSimObject->getDataField( mNameTagsFieldEntry, NULL );
+
+    // Finish if no tags.
+    if ( dStrlen( pFieldTags ) == 0 )
+        return;
+
+    // Fetch element count.
+    const U32 elementCount = StringUnit::getUnitCount( pFieldTags, " \t\n" );
+
+    // Iterate elements.
+    for ( U32 index = 0; index < elementCount; ++index )
+    {
         // Fetch tag Id.
-        const NameTags::TagId tagId = tags[tagIndex];
+        const TagId tagId = dAtoi( StringUnit::getUnit( pFieldTags, index, " \t\n" ) );
 
-        // Iterate excluded objects.
-        for( queryType::iterator itr = mExcludedQueryMap.begin(); itr != mExcludedQueryMap.end(); ++itr )
-        {
-            // Fetch object.
-            const SimObjectId objectId = itr->key;
-            SimObject* pSimObject = itr->value;
-
-            // Fetch tags.
-            const char* pFieldTags = pSimObject->getDataField( mNameTagsFieldEntry, NULL );
-
-            // Any field tags?
-            if ( dStrlen( pFieldTags ) > 0 )
-            {
-                // Yes, so fetch element count.
-                const U32 elementCount = StringUnit::getUnitCount( pFieldTags, " \t\n" );
-
-                // Iterate elements.
-                for ( U32 index = 0; index < elementCount; ++index )
-                {
-                    // Fetch element.
-                    const char* pElement = StringUnit::getUnit( pFieldTags, index, " \t\n" );
-
-                    // Found tag?
-                    if ( dAtoi( pElement ) == tagId )                        
-                    {
-                        // Yes, so add to transfers.
-                        transfers.push_back( objectId );
-                        mIncludedQueryMap.insert( objectId, pSimObject );
-                        break;
-                    }
-                }
-            }
-        }
+        // Skip if invalid.
+        if ( tagId == 0 )
+            continue;
 
-        // Adjust excluded objects.
-        for( U32 transferIndex = 0; transferIndex < (U32)transfers.size(); ++transferIndex )
-        {
-            mExcludedQueryMap.erase( transfers[transferIndex] );
-        }
+        // Index the object.
+        queryType*& pTaggedObjects = mTagIndex[tagId];
+        if ( pTaggedObjects == NULL )
+            pTaggedObjects = new queryType;
 
-        // Clear transfers.
-        transfers.clear();
+        pTaggedObjects->insert( pSimObject->getId(), pSimObject );
     }
 }
 
 //-----------------------------------------------------------------------------
 
+void NameTags::unindexObject( SimObject* pSimObject )
+{
+    // Remove from every tag as the field may have changed since the object was indexed.
+    const SimObjectId objectId = pSimObject->getId();
+    for( tagIndexType::iterator indexItr = mTagIndex.begin(); indexItr != mTagIndex.end(); ++indexItr )
+        indexItr->value->erase( objectId );
+}
+
+//-----------------------------------------------------------------------------
+
+void NameTags::clearIndex( void )
+{
+    for( tagIndexType::iterator indexItr = mTagIndex.begin(); indexItr != mTagIndex.end(); ++indexItr )
+        delete indexItr->value;
+
+    mTagIndex.clear();
+}
+
+//-----------------------------------------------------------------------------
+
 S32 NameTags::formatTags( char* pBuffer, U32 bufferLength )
 {
     // Sanity!
@@ -33,6 +33,12 @@
 
 //-----------------------------------------------------------------------------
 
+/// Named tags for the objects added to the set.
+///
+/// An object's tags are held in its "NameTags" field.  The set also keeps an index from each
+/// tag to the objects in the set with that tag so queries never walk the whole set.  The index
+/// is updated as objects are added and removed and as they are tagged and untagged here so an
+/// object's tags should not be changed by editing its field whilst it is in the set.
 class NameTags : public SimSet
 {
     typedef SimSet      Parent;
@@ -41,6 +47,7 @@ public:
     NameTags();
     virtual ~NameTags();
     virtual bool onAdd();
+    virtual void onRemove();
 
     /// Tag type-definitions.
     typedef U32                                 TagId;
@@ -48,6 +55,13 @@ public:
     typedef HashMap<HashId, TagId>             hashTagMapType;
     typedef HashMap<TagId, StringTableEntry>   tagNameMapType;
     typedef HashMap<SimObjectId, SimObject*>   queryType;
+    typedef HashMap<TagId, queryType*>         tagIndexType;
+
+    /// Set management.
+    virtual void        addObject( SimObject* pObject );
+    virtual void        removeObject( SimObject* pObject );
+    virtual void        pushObject( SimObject* pObject );
+    virtual void        popObject();
 
     /// Tag accessor.
     TagId               createTag( const char* pTagName );
@@ -64,7 +78,9 @@ public:
     bool                hasTag( const SimObjectId objId, const TagId tagId ) const;
 
     /// Tag query.
-    void                queryTags( const char* pTags );
+    /// The included objects are those with any of the tags.  The excluded objects are only found if asked for.
+    void                queryTags( const char* pTags, const bool excluded = false );
+    const queryType*    getTaggedObjects( const TagId tagId ) const;
 
     /// Tag format.
     S32                 formatTags( char* pBuffer, U32 bufferLength );
@@ -79,8 +95,13 @@ public:
     queryType           mExcludedQueryMap;
 
 private:
+    void                indexObject( SimObject* pSimObject );
+    void                unindexObject( SimObject* pSimObject );
+    void                clearIndex( void );
+
     hashTagMapType      mHashTagMap;
     tagNameMapType      mTagNameMap;
+    tagIndexType        mTagIndex;
 
     TagId               mMasterTagId;
     StringTableEntry    mNameTagsFieldEntry;
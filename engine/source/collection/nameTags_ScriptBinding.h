@@ -279,21 +279,14 @@ ConsoleMethodWithDocs(NameTags, queryTags, ConsoleString, 3, 4, (tagIds, [exclud
     }
 
     // Query tags.
-    object->queryTags( argv[2] );
+    const bool excluded = argc > 3;
+    object->queryTags( argv[2], excluded );
 
     // Fetch appropriate results.
-    NameTags::queryType results;
-    if ( argc < 4 )
-    {
-        results = object->mIncludedQueryMap;
-    }
-    else
-    {
-        results = object->mExcludedQueryMap;
-    }    
+    NameTags::queryType& results = excluded ? object->mExcludedQueryMap : object->mIncludedQueryMap;
 
-    // Format results.
-    U32 bufferSize = 8192;
+    // Format results (an object Id and a space for each result).
+    U32 bufferSize = results.size() * 12 + 1;
     char* pReturnBuffer = Con::getReturnBuffer( bufferSize );
     dSprintf(pReturnBuffer, bufferSize * sizeof(char), "%s", "");
     char* pBuffer = pReturnBuffer;
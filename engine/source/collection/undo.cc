@@ -32,6 +32,7 @@
 //-----------------------------------------------------------------------------
 IMPLEMENT_CONOBJECT(UndoAction);
 IMPLEMENT_CONOBJECT(UndoScriptAction);
+IMPLEMENT_CONOBJECT(UndoDeltaAction);
 
 UndoAction::UndoAction( const UTF8* actionName)
 {
@@ -89,6 +90,16 @@ void UndoAction::addQuietSubAction(UndoAction * quietSubAction)
    mQuietSubActions.push_back(quietSubAction);
 }
 
+//-----------------------------------------------------------------------------
+U32 UndoAction::getMemorySize() const
+{
+   U32 size = sizeof(UndoAction) + mQuietSubActions.memSize();
+   for (U32 i = 0; i < (U32)mQuietSubActions.size(); i++)
+      size += mQuietSubActions[i]->getMemorySize();
+
+   return size;
+}
+
 //-----------------------------------------------------------------------------
 void UndoAction::addToManager(UndoManager* theMan)
 {
@@ -104,6 +115,156 @@ void UndoAction::addToManager(UndoManager* theMan)
    }
 }
 
+//-----------------------------------------------------------------------------
+// UndoDeltaAction
+//-----------------------------------------------------------------------------
+UndoDeltaAction::UndoDeltaAction( const UTF8* actionName) : UndoAction(actionName)
+{
+   mLastChangeTime = 0;
+   mRecording = true;
+}
+
+//-----------------------------------------------------------------------------
+U32 UndoDeltaAction::storeValue(Vector<char>& values, const char* value)
+{
+   if (!value)
+      value = "";
+
+   // Values are stored null terminated one after another.
+   const U32 offset = values.size();
+   const U32 length = dStrlen(value) + 1;
+   values.increment(length);
+   dMemcpy(values.address() + offset, value, length);
+
+   return offset;
+}
+
+//-----------------------------------------------------------------------------
+void UndoDeltaAction::recordField(SimObject* object, StringTableEntry fieldName, const char* array, const char* beforeValue)
+{
+   AssertFatal(mRecording, "UndoDeltaAction::recordField() - Cannot record a field once recording has ended.");
+
+   if (!object || !fieldName)
+      return;
+
+   FieldDelta delta;
+   delta.mObjectId = object->getId();
+   delta.mFieldName = fieldName;
+   delta.mArray = array ? StringTable->insert(array) : NULL;
+   delta.mBeforeOffset = storeValue(mValues, beforeValue ? beforeValue : object->getDataField(fieldName, array));
+   delta.mAfterOffset = delta.mBeforeOffset;
+   mDeltas.push_back(delta);
+}
+
+//-----------------------------------------------------------------------------
+void UndoDeltaAction::endRecording()
+{
+   if (!mRecording)
+      return;
+
+   mRecording = false;
+   mLastChangeTime = Platform::getRealMilliseconds();
+
+   // Take the after values, dropping any field that did not change (or whose object has gone).
+   Vector<FieldDelta> deltas;
+   Vector<char> values;
+   deltas.reserve(mDeltas.size());
+   values.reserve(mValues.size() * 2);
+   for (U32 i = 0; i < (U32)mDeltas.size(); i++)
+   {
+      FieldDelta delta = mDeltas[i];
+      SimObject* object = Sim::findObject(delta.mObjectId);
+      if (!object)
+         continue;
+
+      const char* beforeValue = getValue(delta.mBeforeOffset);
+      const char* afterValue = object->getDataField(delta.mFieldName, delta.mArray);
+      if (!afterValue)
+         afterValue = "";
+      if (dStrcmp(beforeValue, afterValue) == 0)
+         continue;
+
+      delta.mBeforeOffset = storeValue(values, beforeValue);
+      delta.mAfterOffset = storeValue(values, afterValue);
+      deltas.push_back(delta);
+   }
+
+   mDeltas = deltas;
+   mValues = values;
+   mDeltas.compact();
+   mValues.compact();
+}
+
+//-----------------------------------------------------------------------------
+bool UndoDeltaAction::coalesce(const UndoDeltaAction* later)
+{
+   AssertFatal(!mRecording && !later->mRecording, "UndoDeltaAction::coalesce() - Cannot coalesce actions whilst recording.");
+
+   // Only actions changing the same fields are coalesced.
+   if (later->mDeltas.size() != mDeltas.size())
+      return false;
+
+   for (U32 i = 0; i < (U32)mDeltas.size(); i++)
+   {
+      const FieldDelta& delta = mDeltas[i];
+      const FieldDelta& laterDelta = later->mDeltas[i];
+      if (delta.mObjectId != laterDelta.mObjectId || delta.mFieldName != laterDelta.mFieldName || delta.mArray != laterDelta.mArray)
+         return false;
+   }
+
+   // Keep our before values and take the later after values.
+   Vector<char> values;
+   values.reserve(mValues.size());
+   for (U32 i = 0; i < (U32)mDeltas.size(); i++)
+   {
+      FieldDelta& delta = mDeltas[i];
+      delta.mBeforeOffset = storeValue(values, getValue(delta.mBeforeOffset));
+      delta.mAfterOffset = storeValue(values, later->getValue(later->mDeltas[i].mAfterOffset));
+   }
+
+   mValues = values;
+   mValues.compact();
+   mLastChangeTime = later->mLastChangeTime;
+
+   return true;
+}
+
+//-----------------------------------------------------------------------------
+void UndoDeltaAction::applyDelta(const FieldDelta& delta, const bool before) const
+{
+   SimObject* object = Sim::findObject(delta.mObjectId);
+   if (!object)
+      return;
+
+   object->inspectPreApply();
+   object->setDataField(delta.mFieldName, delta.mArray, getValue(before ? delta.mBeforeOffset : delta.mAfterOffset));
+   object->inspectPostApply();
+}
+
+//-----------------------------------------------------------------------------
+void UndoDeltaAction::undo()
+{
+   for (S32 i = mDeltas.size() - 1; i >= 0; i--)
+      applyDelta(mDeltas[i], true);
+
+   Parent::undo();
+}
+
+//-----------------------------------------------------------------------------
+void UndoDeltaAction::redo()
+{
+   for (U32 i = 0; i < (U32)mDeltas.size(); i++)
+      applyDelta(mDeltas[i], false);
+
+   Parent::redo();
+}
+
+//-----------------------------------------------------------------------------
+U32 UndoDeltaAction::getMemorySize() const
+{
+   return Parent::getMemorySize() + (sizeof(UndoDeltaAction) - sizeof(UndoAction)) + mDeltas.memSize() + mValues.memSize();
+}
+
 //-----------------------------------------------------------------------------
 // UndoManager
 //-----------------------------------------------------------------------------
@@ -112,6 +273,10 @@ IMPLEMENT_CONOBJECT(UndoManager);
 UndoManager::UndoManager(U32 levels)
 {
    mNumLevels = levels;
+   mMemoryBudget = 0;
+   mCoalesceTime = kDefaultCoalesceTime;
+   mPendingDelta = NULL;
+   mCoalesceOpen = false;
    // levels can be arbitrarily high, so we don't really want to reserve(levels).
    mUndoStack.reserve(10);
    mRedoStack.reserve(10);
@@ -120,6 +285,7 @@ UndoManager::UndoManager(U32 levels)
 //-----------------------------------------------------------------------------
 UndoManager::~UndoManager()
 {
+   delete mPendingDelta;
    clearStack(mUndoStack);
    clearStack(mRedoStack);
 }
@@ -128,6 +294,8 @@ UndoManager::~UndoManager()
 void UndoManager::initPersistFields()
 {
    addField("numLevels", TypeS32, Offset(mNumLevels, UndoManager), "Number of undo & redo levels.");
+   addField("memoryBudget", TypeS32, Offset(mMemoryBudget, UndoManager), "Bytes of history kept before the oldest actions are dropped (zero for no budget).");
+   addField("coalesceTime", TypeS32, Offset(mCoalesceTime, UndoManager), "Milliseconds within which consecutive delta actions of the same name are coalesced (zero for never).");
    // arrange for the default undo manager to exist.
 //   UndoManager &def = getDefaultManager();
 //   Con::printf("def = %s undo manager created", def.getName());
@@ -151,9 +319,20 @@ UndoManager& UndoManager::getDefaultManager()
 void UndoManager::clearAll()
 {
    clearStack(mUndoStack); clearStack(mRedoStack);
+   mCoalesceOpen = false;
    Con::executef(this, 1, "onClear");
 }
 
+//-----------------------------------------------------------------------------
+void UndoManager::deleteAction(UndoAction* action)
+{
+   // Don't delete script created undos.
+   if (dynamic_cast<UndoScriptAction*>(action))
+      action->deleteObject();
+   else
+      delete action;
+}
+
 //-----------------------------------------------------------------------------
 void UndoManager::clearStack(Vector<UndoAction*> &stack)
 {
@@ -162,11 +341,7 @@ void UndoManager::clearStack(Vector<UndoAction*> &stack)
    {
       UndoAction* undo = stack.first();
       stack.pop_front();
-      // Don't delete script created undos.
-      if (dynamic_cast<UndoScriptAction*>(undo))
-         undo->deleteObject();
-      else
-         delete undo;
+      deleteAction(undo);
    }
    stack.clear();
 }
@@ -178,15 +353,39 @@ void UndoManager::clampStack(Vector<UndoAction*> &stack)
    {
       UndoAction *act = stack.front();
       stack.pop_front();
+      deleteAction(act);
+   }
+}
+
+//-----------------------------------------------------------------------------
+void UndoManager::trimToBudget()
+{
+   if (mMemoryBudget == 0)
+      return;
 
-      UndoScriptAction* scriptAction = dynamic_cast<UndoScriptAction*>(act);
-      if (scriptAction)
-         scriptAction->deleteObject();
-      else
-         delete act;
+   // Drop the oldest history first but always keep the latest action.
+   U32 usage = getMemoryUsage();
+   while (usage > mMemoryBudget && mUndoStack.size() > 1)
+   {
+      UndoAction *act = mUndoStack.front();
+      mUndoStack.pop_front();
+      usage -= getMin(usage, act->getMemorySize());
+      deleteAction(act);
    }
 }
 
+//-----------------------------------------------------------------------------
+U32 UndoManager::getMemoryUsage() const
+{
+   U32 usage = 0;
+   for (U32 i = 0; i < (U32)mUndoStack.size(); i++)
+      usage += mUndoStack[i]->getMemorySize();
+   for (U32 i = 0; i < (U32)mRedoStack.size(); i++)
+      usage += mRedoStack[i]->getMemorySize();
+
+   return usage;
+}
+
 void UndoManager::removeAction(UndoAction *action)
 {
    Vector<UndoAction*>::iterator itr = mUndoStack.begin();
@@ -198,6 +397,7 @@ void UndoManager::removeAction(UndoAction *action)
          mUndoStack.erase(itr);
          if (!dynamic_cast<UndoScriptAction*>(deleteAction))
             delete deleteAction;
+         mCoalesceOpen = false;
          Con::executef(this, 1, "onRemoveUndo");
          return;
       }
@@ -233,8 +433,8 @@ void UndoManager::undo()
    
    // add it to the redo stack
    mRedoStack.push_back(act);
-   if((U32)mRedoStack.size() > mNumLevels)
-      mRedoStack.pop_front();
+   clampStack(mRedoStack);
+   mCoalesceOpen = false;
    
    Con::executef(this, 1, "onUndo");
 
@@ -255,8 +455,8 @@ void UndoManager::redo()
    
    // add it to the undo stack
    mUndoStack.push_back(react);
-   if((U32)mUndoStack.size() > mNumLevels)
-      mUndoStack.pop_front();
+   clampStack(mUndoStack);
+   mCoalesceOpen = false;
    
    Con::executef(this, 1, "onRedo");
    
@@ -310,11 +510,74 @@ void UndoManager::addAction(UndoAction* action)
 {
    // push the incoming action onto the stack, move old data off the end if necessary.
    mUndoStack.push_back(action);
-   if((U32)mUndoStack.size() > mNumLevels)
-      mUndoStack.pop_front();
+   clampStack(mUndoStack);
+   mCoalesceOpen = false;
    
    Con::executef(this, 1, "onAddUndo");
 
    // clear the redo stack
    clearStack(mRedoStack);
+
+   // keep the history within the memory budget.
+   trimToBudget();
+}
+
+//-----------------------------------------------------------------------------
+bool UndoManager::beginDeltaAction(const char* actionName)
+{
+   if (mPendingDelta)
+   {
+      Con::warnf("UndoManager::beginDeltaAction() - Already recording the delta action '%s'.", mPendingDelta->mActionName);
+      return false;
+   }
+
+   mPendingDelta = new UndoDeltaAction(actionName);
+   return true;
+}
+
+//-----------------------------------------------------------------------------
+void UndoManager::recordField(SimObject* object, StringTableEntry fieldName, const char* array, const char* beforeValue)
+{
+   if (!mPendingDelta)
+   {
+      Con::warnf("UndoManager::recordField() - Not recording a delta action.");
+      return;
+   }
+
+   mPendingDelta->recordField(object, fieldName, array, beforeValue);
+}
+
+//-----------------------------------------------------------------------------
+void UndoManager::endDeltaAction()
+{
+   if (!mPendingDelta)
+      return;
+
+   UndoDeltaAction* delta = mPendingDelta;
+   mPendingDelta = NULL;
+   delta->endRecording();
+
+   // Nothing changed so there's nothing to undo.
+   if (delta->getDeltaCount() == 0)
+   {
+      delete delta;
+      return;
+   }
+
+   // Coalesce into the previous delta action if it's the same edit continuing.
+   if (mCoalesceOpen && mCoalesceTime > 0 && mUndoStack.size() > 0)
+   {
+      UndoDeltaAction* previous = dynamic_cast<UndoDeltaAction*>(mUndoStack.last());
+      if (previous && previous->mActionName == delta->mActionName &&
+          delta->getLastChangeTime() - previous->getLastChangeTime() <= mCoalesceTime &&
+          previous->coalesce(delta))
+      {
+         delete delta;
+         trimToBudget();
+         return;
+      }
+   }
+
+   delta->addToManager(this);
+   mCoalesceOpen = true;
 }
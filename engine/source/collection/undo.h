@@ -61,11 +61,69 @@ public:
 
    // Adds a "quiet (hidden from user)" sub action [KNM | 08/10/11 | ITGB-152]
    void addQuietSubAction(UndoAction * quietSubAction);
+
+   /// An estimate of the memory the action holds, used to keep the history within a manager's memory budget.
+   virtual U32 getMemorySize() const;
    
    /// Adds the action to the undo stack of the default UndoManager, or the provided manager.
    void addToManager(UndoManager* theMan = NULL);
 };
 
+//-----------------------------------------------------------------------------
+/// An undo action holding field level changes to any number of objects as compact native records.
+///
+/// Each record is the object Id, the field and offsets of its before and after values in a single
+/// value buffer so an edit touching thousands of objects costs two allocations rather than an undo
+/// object (and its script state) per object.  Undo restores the before values in reverse order and
+/// redo applies the after values in order.  Objects deleted since are skipped.
+class UndoDeltaAction : public UndoAction
+{
+private:
+   struct FieldDelta
+   {
+      SimObjectId       mObjectId;
+      StringTableEntry  mFieldName;
+      StringTableEntry  mArray;
+      U32               mBeforeOffset;
+      U32               mAfterOffset;
+   };
+
+   Vector<FieldDelta> mDeltas;
+   Vector<char> mValues;
+   U32 mLastChangeTime;
+   bool mRecording;
+
+   static U32 storeValue(Vector<char>& values, const char* value);
+   inline const char* getValue(const U32 offset) const { return mValues.address() + offset; }
+   void applyDelta(const FieldDelta& delta, const bool before) const;
+
+public:
+   typedef UndoAction Parent;
+   DECLARE_CONOBJECT(UndoDeltaAction);
+
+   UndoDeltaAction( const UTF8* actionName = " ");
+
+   /// Record the current value of an object field (or the specified value) as its value before the change.
+   /// The value after the change is taken when recording ends.
+   void recordField(SimObject* object, StringTableEntry fieldName, const char* array = NULL, const char* beforeValue = NULL);
+
+   /// Finish recording by taking the value of every recorded field after the change.
+   /// Fields that did not change are dropped and the records compacted.
+   void endRecording();
+   inline bool isRecording() const { return mRecording; }
+
+   inline U32 getDeltaCount() const { return (U32)mDeltas.size(); }
+   inline U32 getLastChangeTime() const { return mLastChangeTime; }
+
+   /// Merge a later action changing the same fields (in the same order) into this one.
+   /// The before values of this action are kept along with the after values of the later one.
+   bool coalesce(const UndoDeltaAction* later);
+
+   virtual void undo();
+   virtual void redo();
+   virtual U32 getMemorySize() const;
+};
+
 //-----------------------------------------------------------------------------
 class UndoManager : public SimObject
 {
@@ -73,20 +131,39 @@ private:
    /// Default number of undo & redo levels.
    const static U32 kDefaultNumLevels = 100;
 
+   /// Default milliseconds within which consecutive delta actions of the same name are coalesced.
+   const static U32 kDefaultCoalesceTime = 500;
+
    /// The stacks of undo & redo actions. They will be capped at size mNumLevels.
    Vector<UndoAction*> mUndoStack;
    Vector<UndoAction*> mRedoStack;
+
+   /// The delta action being recorded, if any.
+   UndoDeltaAction* mPendingDelta;
+
+   /// Whether the top of the undo stack may have a later delta action coalesced into it.
+   bool mCoalesceOpen;
    
    /// Deletes all the UndoActions in a stack, then clears it.
    void clearStack(Vector<UndoAction*> &stack);
    /// Clamps a Vector to mNumLevels entries.
    void clampStack(Vector<UndoAction*> &stack);
+   /// Deletes the oldest actions until the history is within the memory budget.
+   void trimToBudget();
+   /// Deletes an action, leaving script created actions to be deleted as objects.
+   static void deleteAction(UndoAction* action);
    
 public:
    /// Number of undo & redo levels.
    // not private because we're exposing it to the console.
    U32 mNumLevels;
 
+   /// Bytes of history kept before the oldest actions are dropped (zero for no budget).
+   U32 mMemoryBudget;
+
+   /// Milliseconds within which consecutive delta actions of the same name are coalesced (zero for never).
+   U32 mCoalesceTime;
+
    // Required in all ConsoleObject subclasses.
    typedef SimObject Parent;
    DECLARE_CONOBJECT(UndoManager);
@@ -119,6 +196,16 @@ public:
    /// Add an action to the top of the undo stack, and clear the redo stack.
    void addAction(UndoAction* action);
    void removeAction(UndoAction* action);
+
+   /// Start recording a delta action.  Fields are recorded before they are changed and
+   /// the action is added (or coalesced into the previous one) when recording ends.
+   bool beginDeltaAction(const char* actionName);
+   void recordField(SimObject* object, StringTableEntry fieldName, const char* array = NULL, const char* beforeValue = NULL);
+   void endDeltaAction();
+   inline bool isRecordingDelta() const { return mPendingDelta != NULL; }
+
+   /// The estimated memory held by the undo & redo history.
+   U32 getMemoryUsage() const;
 };
 
 // Script Undo Action Creation
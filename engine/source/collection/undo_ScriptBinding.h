@@ -121,4 +121,60 @@ ConsoleMethodWithDocs(UndoManager, getNextRedoName, ConsoleString, 2, 2, ())
    return ret;
 }
 
+/*! Starts recording a delta action.
+    Record each field with recordField() before changing it then call endDeltaAction() once the change is made.
+    The changes are kept as compact native records rather than an undo object per change, and consecutive
+    delta actions of the same name over the same fields within the coalesce time become a single action.
+    @param actionName The name of the action for display.
+    @return Whether recording started or not (it does not if a delta action is already being recorded).
+*/
+ConsoleMethodWithDocs(UndoManager, beginDeltaAction, ConsoleBool, 3, 3, (actionName))
+{
+   return object->beginDeltaAction(argv[2]);
+}
+
+/*! Records a field of an object in the delta action being recorded.
+    @param object The object whose field is about to change.
+    @param fieldName The field about to change.
+    @param beforeValue The value before the change (optional, the current value is used if not specified).
+    @return No Return Value
+*/
+ConsoleMethodWithDocs(UndoManager, recordField, ConsoleVoid, 4, 5, (object, fieldName, [beforeValue]))
+{
+   SimObject* pObject = Sim::findObject(argv[2]);
+   if (!pObject)
+   {
+      Con::warnf("UndoManager::recordField() - Could not find object '%s'.", argv[2]);
+      return;
+   }
+
+   object->recordField(pObject, StringTable->insert(argv[3]), NULL, argc > 4 ? argv[4] : NULL);
+}
+
+/*! Finishes recording the delta action and adds it to the undo stack (or coalesces it into the previous one).
+    Fields that did not change are dropped and nothing is added if none changed.
+    @return No Return Value
+*/
+ConsoleMethodWithDocs(UndoManager, endDeltaAction, ConsoleVoid, 2, 2, ())
+{
+   object->endDeltaAction();
+}
+
+/*! Gets whether a delta action is being recorded.
+    @return Whether a delta action is being recorded or not.
+*/
+ConsoleMethodWithDocs(UndoManager, isRecordingDelta, ConsoleBool, 2, 2, ())
+{
+   return object->isRecordingDelta();
+}
+
+/*! Gets the estimated memory held by the undo & redo history.
+    Once this exceeds the "memoryBudget" field (if set) the oldest actions are dropped.
+    @return The estimated bytes held.
+*/
+ConsoleMethodWithDocs(UndoManager, getMemoryUsage, ConsoleInt, 2, 2, ())
+{
+   return (S32)object->getMemoryUsage();
+}
+
 ConsoleMethodGroupEndWithDocs(UndoManager)
@@ -36,16 +36,14 @@ bool VectorResize(U32 *aSize, U32 *aCount, void **arrayPtr, U32 newCount, U32 el
          blocks++;
       S32 mem_size = blocks * VectorBlockSize * elemSize;
 
-      const char* pUseFileName = fileName != NULL ? fileName : __FILE__;
-      U32 useLineNum           = fileName != NULL ? lineNum  : __LINE__;
-
+      // Small arrays are kept in the small-block pool.
       if (*arrayPtr != NULL)
       {
-         *arrayPtr = dRealloc_r(*arrayPtr, mem_size, pUseFileName, useLineNum);
+         *arrayPtr = Memory::reallocateSmall(*arrayPtr, mem_size, fileName ? fileName : __FILE__, lineNum);
       }
       else
       {
-         *arrayPtr = dMalloc_r(mem_size, pUseFileName, useLineNum);
+         *arrayPtr = Memory::allocateSmall(mem_size, fileName ? fileName : __FILE__, lineNum);
       }
 
       *aCount = newCount;
@@ -73,8 +71,9 @@ bool VectorResize(U32 *aSize, U32 *aCount, void **arrayPtr, U32 newCount, U32 el
       if (newCount % VectorBlockSize)
          blocks++;
       S32 mem_size = blocks * VectorBlockSize * elemSize;
-      *arrayPtr = *arrayPtr ? dRealloc(*arrayPtr,mem_size) :
-         dMalloc(mem_size);
+      // Small arrays are kept in the small-block pool.
+      *arrayPtr = *arrayPtr ? Memory::reallocateSmall(*arrayPtr,mem_size,__FILE__,__LINE__) :
+         Memory::allocateSmall(mem_size,__FILE__,__LINE__);
 
       *aCount = newCount;
       *aSize = blocks * VectorBlockSize;
@@ -733,9 +733,10 @@ bool BehaviorComponent::raise( BehaviorInstance* pOutputBehavior, StringTableEnt
             return false;
         }
 #endif
-        // Execute a callback for the input.
+        // Let a native behavior handle the input otherwise execute a callback for the input.
         // NOTE: This callback should not delete behaviors otherwise strange things can happen!
-        Con::executef( pInputBehavior, 3, pInputName, pOutputBehavior->getIdString(), pOutputName );
+        if ( !pInputBehavior->getTemplate()->onBehaviorInput( pInputBehavior, pInputName, pOutputBehavior, pOutputName ) )
+            Con::executef( pInputBehavior, 3, pInputName, pOutputBehavior->getIdString(), pOutputName );
     }
 
     return true;
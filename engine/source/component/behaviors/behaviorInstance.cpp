@@ -38,7 +38,8 @@ IMPLEMENT_CONOBJECT(BehaviorInstance);
 BehaviorInstance::BehaviorInstance( BehaviorTemplate* pTemplate ) :
     mTemplate( pTemplate ),
     mBehaviorOwner( NULL ),
-    mBehaviorId( 0 )
+    mBehaviorId( 0 ),
+    mTemplateIndex( -1 )
 {
     if ( pTemplate != NULL )
     {
@@ -67,6 +68,10 @@ bool BehaviorInstance::onAdd()
    // Store this object's namespace
    mNameSpace = Namespace::global()->find( getTemplateName() );
 
+   // Let the template track this instance.
+   if ( mTemplate != NULL )
+      mTemplate->onAddInstance( this );
+
    return true;
 }
 
@@ -74,6 +79,11 @@ bool BehaviorInstance::onAdd()
 
 void BehaviorInstance::onRemove()
 {
+   // Stop the template tracking this instance.
+   // NOTE: The index is reset if the template is removed first so it's not touched here.
+   if ( mTemplateIndex >= 0 )
+      mTemplate->onRemoveInstance( this );
+
    Parent::onRemove();
 }
 
@@ -65,12 +65,17 @@ public:
     inline void setBehaviorId( const U32 id ) { mBehaviorId = id; }
     inline U32 getBehaviorId( void ) const { return mBehaviorId; }
 
+    /// Index in the instances tracked by a native template or -1 if not tracked.
+    inline void setTemplateIndex( const S32 index ) { mTemplateIndex = index; }
+    inline S32 getTemplateIndex( void ) const { return mTemplateIndex; }
+
     DECLARE_CONOBJECT(BehaviorInstance);
 
 protected:
     BehaviorTemplate*   mTemplate;
     BehaviorComponent*  mBehaviorOwner;
     U32                 mBehaviorId;
+    S32                 mTemplateIndex;
 
     // Set "Owner" via the field does nothing.
     static bool setOwner( void* obj, const char* data ) { return true; }
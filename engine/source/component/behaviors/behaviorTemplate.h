@@ -100,6 +100,15 @@ public:
     /// Create a BehaviorInstance from this template
     BehaviorInstance* createInstance( void );
 
+    /// Instances.
+    /// Native templates track their instances here, script templates do nothing.
+    virtual void onAddInstance( BehaviorInstance* pInstance ) {}
+    virtual void onRemoveInstance( BehaviorInstance* pInstance ) {}
+
+    /// Handle an input raised on an instance by a behavior connection.
+    /// @return Whether the input was handled natively, if not the script input callback is executed.
+    virtual bool onBehaviorInput( BehaviorInstance* pInputBehavior, StringTableEntry pInputName, BehaviorInstance* pOutputBehavior, StringTableEntry pOutputName ) { return false; }
+
     /// Template.
     inline StringTableEntry getFriendlyName( void ) const { return mFriendlyName; }
     inline StringTableEntry getDescription( void ) const { return mDescription; }
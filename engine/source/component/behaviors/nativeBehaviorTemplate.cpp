@@ -0,0 +1,96 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#include "component/behaviors/nativeBehaviorTemplate.h"
+
+//-----------------------------------------------------------------------------
+
+NativeBehaviorTemplate::NativeBehaviorTemplate()
+{
+    // Only tick when there are instances.
+    setProcessTicks( false );
+}
+
+//-----------------------------------------------------------------------------
+
+void NativeBehaviorTemplate::onRemove()
+{
+    // Stop tracking the instances as they may outlive the template.
+    for( Vector<BehaviorInstance*>::iterator itr = mInstances.begin(); itr != mInstances.end(); ++itr )
+    {
+        (*itr)->setTemplateIndex( -1 );
+    }
+    mInstances.clear();
+    setProcessTicks( false );
+
+    Parent::onRemove();
+}
+
+//-----------------------------------------------------------------------------
+
+void NativeBehaviorTemplate::onAddInstance( BehaviorInstance* pInstance )
+{
+    // Sanity!
+    AssertFatal( pInstance->getTemplateIndex() < 0, "NativeBehaviorTemplate::onAddInstance() - Instance is already tracked." );
+
+    // Track the instance.
+    const U32 index = mInstances.size();
+    pInstance->setTemplateIndex( index );
+    mInstances.push_back( pInstance );
+
+    // Start ticking.
+    setProcessTicks( true );
+
+    onInstanceAdded( index );
+}
+
+//-----------------------------------------------------------------------------
+
+void NativeBehaviorTemplate::onRemoveInstance( BehaviorInstance* pInstance )
+{
+    // Fetch the instance index.
+    const U32 index = pInstance->getTemplateIndex();
+
+    // Sanity!
+    AssertFatal( index < (U32)mInstances.size() && mInstances[index] == pInstance, "NativeBehaviorTemplate::onRemoveInstance() - Instance is not tracked." );
+
+    // Move the last instance into the removed slot.
+    mInstances.erase_fast( index );
+    if ( index < (U32)mInstances.size() )
+        mInstances[index]->setTemplateIndex( index );
+    pInstance->setTemplateIndex( -1 );
+
+    onInstanceRemoved( index );
+
+    // Stop ticking if there are no instances.
+    if ( mInstances.size() == 0 )
+        setProcessTicks( false );
+}
+
+//-----------------------------------------------------------------------------
+
+void NativeBehaviorTemplate::processTick()
+{
+    if ( mInstances.size() > 0 )
+        updateInstances( mInstances.address(), mInstances.size(), Tickable::smTickSec );
+}
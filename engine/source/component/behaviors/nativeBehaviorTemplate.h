@@ -0,0 +1,87 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#ifndef _NATIVE_BEHAVIORTEMPLATE_H_
+#define _NATIVE_BEHAVIORTEMPLATE_H_
+
+#ifndef _BEHAVIORTEMPLATE_H_
+#include "component/behaviors/behaviorTemplate.h"
+#endif
+
+#ifndef _TICKABLE_H_
+#include "platform/Tickable.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// A behavior template implemented in C++.
+///
+/// Rather than each instance being called from script, a native template tracks all of its
+/// instances and updates them together in a single call every tick so their state can be
+/// kept in contiguous arrays.  Instances are otherwise ordinary behavior instances so any
+/// script methods in the template's namespace still work, as do script handlers for any
+/// inputs the native template doesn't handle in onBehaviorInput().
+///
+/// A native behavior derives from this class, declares itself a console object and adds its
+/// fields, inputs and outputs when constructed.  Script then creates the template by its
+/// class name:
+/// @code
+/// %template = new MoveTowardsBehavior( MoveTowards );
+/// @endcode
+class NativeBehaviorTemplate : public BehaviorTemplate, public virtual Tickable
+{
+    typedef BehaviorTemplate Parent;
+
+public:
+    NativeBehaviorTemplate();
+    virtual ~NativeBehaviorTemplate() {}
+
+    virtual void onRemove();
+
+    /// Instances.
+    virtual void onAddInstance( BehaviorInstance* pInstance );
+    virtual void onRemoveInstance( BehaviorInstance* pInstance );
+    inline U32 getInstanceCount( void ) const { return mInstances.size(); }
+    inline BehaviorInstance* getInstance( const U32 index ) const { return mInstances[index]; }
+
+protected:
+    /// Update all the instances for a tick.
+    /// NOTE: Instances must not be removed during the update, defer any deletion instead.
+    virtual void updateInstances( BehaviorInstance** pInstances, const U32 instanceCount, const F32 elapsedTime ) = 0;
+
+    /// Called when an instance is added at the end of the instances or removed from the specified index.
+    /// The last instance is moved into the removed index so per-instance state kept in a vector
+    /// should be updated with increment() and erase_fast() to stay in step.
+    virtual void onInstanceAdded( const U32 index ) {}
+    virtual void onInstanceRemoved( const U32 index ) {}
+
+    /// Tickable.
+    virtual void interpolateTick( F32 delta ) {}
+    virtual void processTick();
+    virtual void advanceTime( F32 timeDelta ) {}
+
+private:
+    Vector<BehaviorInstance*> mInstances;
+};
+
+#endif // _NATIVE_BEHAVIORTEMPLATE_H_
@@ -146,7 +146,7 @@ public:
    inline SimComponent *getComponent( const U32 index ) { return mComponentList[index]; }
 
    static bool setEnabled( void* obj, const char* data ) { static_cast<SimComponent*>(obj)->setEnabled( dAtob( data ) ); return false; };
-   virtual void setEnabled( const bool enabled ) { mEnabled = enabled; }
+   virtual void setEnabled( const bool enabled ) { mEnabled = enabled; setTamlModified(); }
    bool isEnabled() const { return mEnabled; }
    static bool writeEnabled( void* obj, StringTableEntry pFieldName ) { return static_cast<SimComponent*>(obj)->mEnabled == false; }
 
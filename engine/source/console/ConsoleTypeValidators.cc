@@ -36,7 +36,7 @@ void ConsoleTypeValidator::consoleError(SimObject *object, const char *format, .
    va_end(argptr);
 
    AbstractClassRep *rep = object->getClassRep();
-   AbstractClassRep::Field &fld = rep->mFieldList[fieldIndex];
+   AbstractClassRep::Field &fld = rep->getFieldList()[fieldIndex];
    const char *objectName = object->getName();
    if(!objectName)
       objectName = "unnamed";
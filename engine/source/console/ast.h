@@ -158,7 +158,8 @@ struct BinaryExprNode : ExprNode
 
 struct FloatBinaryExprNode : BinaryExprNode
 {
-   static FloatBinaryExprNode *alloc(S32 op, ExprNode *left, ExprNode *right);
+   /// Allocates the expression, or a FloatNode if the operands are constants.
+   static ExprNode *alloc(S32 op, ExprNode *left, ExprNode *right);
    U32 precompile(TypeReq type);
    U32 compile(U32 *codeStream, U32 ip, TypeReq type);
    TypeReq getPreferredType();
@@ -93,8 +93,48 @@ LoopStmtNode *LoopStmtNode::alloc(S32 lineNumber, ExprNode *initExpr, ExprNode *
    return ret;
 }
 
-FloatBinaryExprNode *FloatBinaryExprNode::alloc(S32 op, ExprNode *left, ExprNode *right)
+static bool getConstantNumber(ExprNode *node, F64 &value)
 {
+   if(IntNode *intNode = dynamic_cast<IntNode *>(node))
+   {
+      value = intNode->value;
+      return true;
+   }
+   if(FloatNode *floatNode = dynamic_cast<FloatNode *>(node))
+   {
+      value = floatNode->value;
+      return true;
+   }
+   return false;
+}
+
+ExprNode *FloatBinaryExprNode::alloc(S32 op, ExprNode *left, ExprNode *right)
+{
+   // Fold constant operands.  Only results that a FloatNode converts to an
+   // integer the same way the interpreter would are folded.
+   F64 leftValue, rightValue;
+   if(getConstantNumber(left, leftValue) && getConstantNumber(right, rightValue))
+   {
+      F64 value = -1;
+      switch(op)
+      {
+      case '+':
+         value = leftValue + rightValue;
+         break;
+      case '-':
+         value = leftValue - rightValue;
+         break;
+      case '/':
+         value = leftValue / rightValue;
+         break;
+      case '*':
+         value = leftValue * rightValue;
+         break;
+      }
+      if(value >= 0 && value < 4294967296.0)
+         return FloatNode::alloc(value);
+   }
+
    FloatBinaryExprNode *ret = (FloatBinaryExprNode *) consoleAlloc(sizeof(FloatBinaryExprNode));
    constructInPlace(ret);
 
@@ -789,6 +789,11 @@ U32 VarNode::precompile(TypeReq type)
    // OP_SETCURVAR_ARRAY
    // OP_LOADVAR (type)
 
+   // else if it's a local variable in a function
+   // OP_LOADVAR_LOCAL (type)
+   // varName
+   // slot
+
    // else
    // OP_SETCURVAR
    // varName
@@ -808,6 +813,26 @@ U32 VarNode::compile(U32 *codeStream, U32 ip, TypeReq type)
    if(type == TypeReqNone)
       return ip;
 
+   if(!arrayIndex && usesLocalVariableSlot(varName))
+   {
+      switch(type)
+      {
+      case TypeReqUInt:
+         codeStream[ip++] = OP_LOADVAR_LOCAL_UINT;
+         break;
+      case TypeReqFloat:
+         codeStream[ip++] = OP_LOADVAR_LOCAL_FLT;
+         break;
+      default:
+         codeStream[ip++] = OP_LOADVAR_LOCAL_STR;
+         break;
+      }
+      STEtoCode(varName, ip, codeStream);
+      ip += 2;
+      codeStream[ip++] = getLocalVariableSlot(varName);
+      return ip;
+   }
+
    codeStream[ip++] = arrayIndex ? OP_LOADIMMED_IDENT : OP_SETCURVAR;
    STEtoCode(varName, ip, codeStream);
    ip += 2;
@@ -1050,6 +1075,12 @@ U32 AssignExprNode::precompile(TypeReq type)
    // OP_TERMINATE_REWIND_STR
    // OP_SAVEVAR
 
+   //else if it's a local variable in a function
+   // eval expr
+   // OP_SAVEVAR_LOCAL
+   // varname
+   // slot
+
    //else
    // eval expr
    // OP_SETCURVAR_CREATE
@@ -1090,6 +1121,27 @@ U32 AssignExprNode::compile(U32 *codeStream, U32 ip, TypeReq type)
       if(subType == TypeReqString)
          codeStream[ip++] = OP_TERMINATE_REWIND_STR;
    }
+   else if(usesLocalVariableSlot(varName))
+   {
+      switch(subType)
+      {
+      case TypeReqUInt:
+         codeStream[ip++] = OP_SAVEVAR_LOCAL_UINT;
+         break;
+      case TypeReqFloat:
+         codeStream[ip++] = OP_SAVEVAR_LOCAL_FLT;
+         break;
+      default:
+         codeStream[ip++] = OP_SAVEVAR_LOCAL_STR;
+         break;
+      }
+      STEtoCode(varName, ip, codeStream);
+      ip += 2;
+      codeStream[ip++] = getLocalVariableSlot(varName);
+      if(type != subType)
+         codeStream[ip++] = conversionOp(subType, type);
+      return ip;
+   }
    else
    {
       codeStream[ip++] = OP_SETCURVAR_CREATE;
@@ -1197,7 +1249,7 @@ U32 AssignOpExprNode::precompile(TypeReq type)
    if(type != subType)
       size++;
    if(!arrayIndex)
-      return size + 6;
+      return size + (usesLocalVariableSlot(varName) ? 7 : 6);
    else
    {
       size += arrayIndex->precompile(TypeReqString);
@@ -1210,9 +1262,12 @@ U32 AssignOpExprNode::compile(U32 *codeStream, U32 ip, TypeReq type)
    ip = expr->compile(codeStream, ip, subType);
    if(!arrayIndex)
    {
-      codeStream[ip++] = OP_SETCURVAR_CREATE;
+      const bool localSlot = usesLocalVariableSlot(varName);
+      codeStream[ip++] = localSlot ? OP_SETCURVAR_LOCAL_CREATE : OP_SETCURVAR_CREATE;
       STEtoCode(varName, ip, codeStream);
       ip += 2;
+      if(localSlot)
+         codeStream[ip++] = getLocalVariableSlot(varName);
    }
    else
    {
@@ -1770,6 +1825,7 @@ U32 FunctionDeclStmtNode::compileStmt(U32 *codeStream, U32 ip, U32, U32)
       ip += 2;
    }
    CodeBlock::smInFunction = true;
+   resetLocalVariableSlots();
    ip = compileBlock(stmts, codeStream, ip, 0, 0);
 
    #ifdef TORQUE_EXTRA_BREAKLINES      
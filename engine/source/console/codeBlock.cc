@@ -348,49 +348,59 @@ void CodeBlock::calcBreakList()
        pRemoteDebugger->addCodeBlock( this );
 }
 
-bool CodeBlock::read(StringTableEntry fileName, Stream &st)
+//-------------------------------------------------------------------------
+
+/// Reads values from a DSO held in memory the same way Stream would.
+struct DSOMemoryReader
 {
-   const StringTableEntry exePath = Platform::getMainDotCsDir();
-   const StringTableEntry cwd = Platform::getCurrentDirectory();
+   const U8 *mCursor;
+   const U8 *mEnd;
 
-   name = fileName;
+   DSOMemoryReader(const U8 *buffer, U32 size) : mCursor(buffer), mEnd(buffer + size) {}
 
-   if(fileName)
+   inline bool read(U32 size, void *dst)
    {
-      fullPath = NULL;
-
-      if(Platform::isFullPath(fileName))
-         fullPath = fileName;
-
-      if(dStrnicmp(exePath, fileName, dStrlen(exePath)) == 0)
-         name = StringTable->insert(fileName + dStrlen(exePath) + 1, true);
-      else if(dStrnicmp(cwd, fileName, dStrlen(cwd)) == 0)
-         name = StringTable->insert(fileName + dStrlen(cwd) + 1, true);
-
-      if(fullPath == NULL)
+      if(U32(mEnd - mCursor) < size)
       {
-         char buf[1024];
-         fullPath = StringTable->insert(Platform::makeFullPathName(fileName, buf, sizeof(buf)), true);
+         dMemset(dst, 0, size);
+         mCursor = mEnd;
+         return false;
       }
-
-      modPath = Con::getModNameFromPath(fileName);
+      dMemcpy(dst, mCursor, size);
+      mCursor += size;
+      return true;
    }
-   
-   //
-   if (name)
+
+   inline bool read(U8 *value)
    {
-      if (const char *slash = dStrchr(this->name, '/'))
+      if(mCursor == mEnd)
       {
-         char root[512];
-         dStrncpy(root, this->name, slash-this->name);
-         root[slash-this->name] = 0;
-         mRoot = StringTable->insert(root);
+         *value = 0;
+         return false;
       }
+      *value = *mCursor++;
+      return true;
    }
 
-   //
-   addToCodeList();
+   inline bool read(U32 *value)
+   {
+      U32 temp;
+      const bool success = read(sizeof(temp), &temp);
+      *value = convertLEndianToHost(temp);
+      return success;
+   }
+
+   inline bool read(F64 *value)
+   {
+      F64 temp;
+      const bool success = read(sizeof(temp), &temp);
+      *value = convertLEndianToHost(temp);
+      return success;
+   }
+};
 
+template<class T> void CodeBlock::readCode(T &st)
+{
    U32 globalSize,size,i;
    st.read(&size);
    if(size)
@@ -468,6 +478,74 @@ bool CodeBlock::read(StringTableEntry fileName, Stream &st)
       }
    }
 
+}
+
+bool CodeBlock::read(StringTableEntry fileName, Stream &st)
+{
+   const StringTableEntry exePath = Platform::getMainDotCsDir();
+   const StringTableEntry cwd = Platform::getCurrentDirectory();
+
+   name = fileName;
+
+   if(fileName)
+   {
+      fullPath = NULL;
+
+      if(Platform::isFullPath(fileName))
+         fullPath = fileName;
+
+      if(dStrnicmp(exePath, fileName, dStrlen(exePath)) == 0)
+         name = StringTable->insert(fileName + dStrlen(exePath) + 1, true);
+      else if(dStrnicmp(cwd, fileName, dStrlen(cwd)) == 0)
+         name = StringTable->insert(fileName + dStrlen(cwd) + 1, true);
+
+      if(fullPath == NULL)
+      {
+         char buf[1024];
+         fullPath = StringTable->insert(Platform::makeFullPathName(fileName, buf, sizeof(buf)), true);
+      }
+
+      modPath = Con::getModNameFromPath(fileName);
+   }
+   
+   //
+   if (name)
+   {
+      if (const char *slash = dStrchr(this->name, '/'))
+      {
+         char root[512];
+         dStrncpy(root, this->name, slash-this->name);
+         root[slash-this->name] = 0;
+         mRoot = StringTable->insert(root);
+      }
+   }
+
+   //
+   addToCodeList();
+
+   // Read the rest of the DSO in one go and decode it from memory rather
+   // than making a stream call for every byte of code.
+   const U32 position = st.getPosition();
+   const U32 streamSize = st.getStreamSize();
+   bool readFromMemory = false;
+   if(streamSize > position)
+   {
+      const U32 size = streamSize - position;
+      U8 *buffer = new U8[size];
+      if(st.read(size, buffer))
+      {
+         DSOMemoryReader reader(buffer, size);
+         readCode(reader);
+         readFromMemory = true;
+      }
+      else
+         st.setPosition(position);
+      delete [] buffer;
+   }
+
+   if(!readFromMemory)
+      readCode(st);
+
    if(lineBreakPairCount)
       calcBreakList();
 
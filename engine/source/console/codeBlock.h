@@ -26,6 +26,10 @@
 #include "console/compiler.h"
 #include "console/consoleParser.h"
 
+#ifndef _CONSOLE_NAMESPACE_H
+#include "console/consoleNamespace.h"
+#endif
+
 class Stream;
 
 
@@ -82,6 +86,22 @@ public:
    CodeBlock *nextFile;
    StringTableEntry mRoot;
 
+   /// The namespace entry a method call site last resolved to.
+   ///
+   /// Method call sites don't use their namespace code slot so it holds the
+   /// one based index of the call site's cache, allocated when first executed.
+   struct MethodCallCache
+   {
+      Namespace *ns;
+      U32 cacheSequence;
+      Namespace::Entry *entry;
+   };
+
+   Vector<MethodCallCache> methodCallCaches;
+
+   /// Lookup a method for the call site whose cache index is at the specified ip.
+   Namespace::Entry *lookupMethod(U32 cacheIp, Namespace *ns, StringTableEntry fnName);
+
 
    void addToCodeList();
    void removeFromCodeList();
@@ -105,6 +125,9 @@ public:
    const char *getFileLine(U32 ip);
 
    bool read(StringTableEntry fileName, Stream &st);
+
+   /// Reads the tables and code of a compiled block from a Stream or a DSOMemoryReader.
+   template<class T> void readCode(T &st);
    bool compile(const char *dsoName, StringTableEntry fileName, const char *script);
 
    void incRefCount();
@@ -41,6 +41,7 @@
 #include "memory/frameAllocator.h"
 
 #include "debug/telnetDebugger.h"
+#include "debug/scriptProfiler.h"
 
 #ifndef _REMOTE_DEBUGGER_BASE_H_
 #include "debug/remote/RemoteDebuggerBase.h"
@@ -74,7 +75,7 @@ static const char *getNamespaceList(Namespace *ns)
    U32 size = 1;
    Namespace * walk;
    for(walk = ns; walk; walk = walk->mParent)
-      size += dStrlen(walk->mName) + 4;
+      size += _StringTable::getEntryLength(walk->mName) + 4;
    char *ret = Con::getReturnBuffer(size);
    ret[0] = 0;
    for(walk = ns; walk; walk = walk->mParent)
@@ -304,6 +305,32 @@ static void setUnit(const char *string, U32 index, const char *replace, const ch
 
 //-----------------------------------------------------------------------------
 
+inline Namespace::Entry *CodeBlock::lookupMethod(U32 cacheIp, Namespace *ns, StringTableEntry fnName)
+{
+   // Allocate the call site a cache the first time it's executed.
+   U32 cacheIndex = code[cacheIp];
+   if(!cacheIndex)
+   {
+      methodCallCaches.increment();
+      methodCallCaches.last().ns = NULL;
+      cacheIndex = methodCallCaches.size();
+      code[cacheIp] = cacheIndex;
+   }
+
+   // The namespace cache sequence changes whenever packages are (de)activated
+   // or functions are defined so it invalidates every call site at once.
+   MethodCallCache &cache = methodCallCaches[cacheIndex - 1];
+   if(cache.ns != ns || cache.cacheSequence != Namespace::mCacheSequence)
+   {
+      cache.ns = ns;
+      cache.cacheSequence = Namespace::mCacheSequence;
+      cache.entry = ns->lookup(fnName);
+   }
+   return cache.entry;
+}
+
+//-----------------------------------------------------------------------------
+
 static bool isDigitsOnly( const char* pString )
 {
     // Sanity.
@@ -449,6 +476,9 @@ static void setFieldComponent( SimObject* object, StringTableEntry field, const
 
 const char *CodeBlock::exec(U32 ip, const char *functionName, Namespace *thisNamespace, U32 argc, const char **argv, bool noCalls, StringTableEntry packageName, S32 setFrame)
 {
+   // Attribute allocations to script.
+   Memory::TagScope memoryTag(Memory::TagScript);
+
 #ifdef TORQUE_DEBUG
    U32 stackStart = STR.mStartStackSize;
 #endif
@@ -457,9 +487,15 @@ const char *CodeBlock::exec(U32 ip, const char *functionName, Namespace *thisNam
    U32 i;
 
    incRefCount();
+   ScriptProfiler::enterScript();
    F64 *curFloatTable;
    char *curStringTable;
    STR.clearFunctionOffset();
+
+   // Entries of the local variables with slots, looked up when first used.
+   Dictionary::Entry *localVariables[MaxLocalVariableSlots];
+   dMemset(localVariables, 0, sizeof(localVariables));
+
    StringTableEntry thisFunctionName = NULL;
    bool popFrame = false;
    if(argv)
@@ -582,6 +618,10 @@ const char *CodeBlock::exec(U32 ip, const char *functionName, Namespace *thisNam
    
    for(;;)
    {
+      // Record a profiler sample if one is due.
+      if(ScriptProfiler::isSamplePending())
+         ScriptProfiler::sample(this, ip, thisFunctionName != NULL);
+
       U32 instruction = code[ip++];
 breakContinue:
       switch(instruction)
@@ -1116,6 +1156,56 @@ breakContinue:
             curNSDocBlock = NULL;
             break;
 
+         case OP_SETCURVAR_LOCAL:
+         case OP_SETCURVAR_LOCAL_CREATE:
+         case OP_LOADVAR_LOCAL_UINT:
+         case OP_LOADVAR_LOCAL_FLT:
+         case OP_LOADVAR_LOCAL_STR:
+         case OP_SAVEVAR_LOCAL_UINT:
+         case OP_SAVEVAR_LOCAL_FLT:
+         case OP_SAVEVAR_LOCAL_STR:
+         {
+            var = CodeToSTE(code, ip);
+            const U32 slot = code[ip+2];
+            ip += 3;
+
+            // See OP_SETCURVAR
+            prevField = NULL;
+            prevObject = NULL;
+            curObject = NULL;
+
+            if(slot < MaxLocalVariableSlots && localVariables[slot])
+            {
+               gEvalState.currentVariable = localVariables[slot];
+            }
+            else
+            {
+               if(instruction == OP_SETCURVAR_LOCAL || (instruction >= OP_LOADVAR_LOCAL_UINT && instruction <= OP_LOADVAR_LOCAL_STR))
+                  gEvalState.setCurVarName(var);
+               else
+                  gEvalState.setCurVarNameCreate(var);
+
+               if(slot < MaxLocalVariableSlots)
+                  localVariables[slot] = gEvalState.currentVariable;
+            }
+
+            // See OP_SETCURVAR for why we do this.
+            curFNDocBlock = NULL;
+            curNSDocBlock = NULL;
+
+            // The fused instructions go on to load or save the variable.
+            switch(instruction)
+            {
+               case OP_LOADVAR_LOCAL_UINT: instruction = OP_LOADVAR_UINT; goto breakContinue;
+               case OP_LOADVAR_LOCAL_FLT:  instruction = OP_LOADVAR_FLT;  goto breakContinue;
+               case OP_LOADVAR_LOCAL_STR:  instruction = OP_LOADVAR_STR;  goto breakContinue;
+               case OP_SAVEVAR_LOCAL_UINT: instruction = OP_SAVEVAR_UINT; goto breakContinue;
+               case OP_SAVEVAR_LOCAL_FLT:  instruction = OP_SAVEVAR_FLT;  goto breakContinue;
+               case OP_SAVEVAR_LOCAL_STR:  instruction = OP_SAVEVAR_STR;  goto breakContinue;
+            }
+            break;
+         }
+
          case OP_SETCURVAR_ARRAY:
             var = STR.getSTValue();
 
@@ -1157,6 +1247,24 @@ breakContinue:
             break;
 
          case OP_LOADVAR_STR:
+            // Numeric variables pushed as call arguments are only formatted
+            // if the callee needs them as strings.
+            if(code[ip] == OP_PUSH && gEvalState.currentVariable)
+            {
+               const S32 varType = gEvalState.currentVariable->type;
+               if(varType == Dictionary::Entry::TypeInternalInt)
+               {
+                  ip++;
+                  STR.pushNumeric(StringStack::NumericArgInt, (F64)(S32)gEvalState.currentVariable->ival);
+                  break;
+               }
+               else if(varType == Dictionary::Entry::TypeInternalFloat)
+               {
+                  ip++;
+                  STR.pushNumeric(StringStack::NumericArgFloat, gEvalState.currentVariable->fval);
+                  break;
+               }
+            }
             val = gEvalState.getStringVariable();
             STR.setStringValue(val);
             break;
@@ -1332,7 +1440,13 @@ breakContinue:
             break;
 
          case OP_FLT_TO_STR:
-            STR.setFloatValue(floatStack[FLT]);
+            if(code[ip] == OP_PUSH)
+            {
+               ip++;
+               STR.pushNumeric(StringStack::NumericArgFloat, floatStack[FLT]);
+            }
+            else
+               STR.setFloatValue(floatStack[FLT]);
             FLT--;
             break;
 
@@ -1347,7 +1461,13 @@ breakContinue:
             break;
 
          case OP_UINT_TO_STR:
-            STR.setIntValue((U32)intStack[UINT]);
+            if(code[ip] == OP_PUSH)
+            {
+               ip++;
+               STR.pushNumeric(StringStack::NumericArgInt, (F64)(S32)(U32)intStack[UINT]);
+            }
+            else
+               STR.setIntValue((U32)intStack[UINT]);
             UINT--;
             break;
 
@@ -1461,7 +1581,9 @@ breakContinue:
             U32 callType = code[ip+4];
 
             ip += 5;
-            STR.getArgcArgv(fnName, &callArgc, &callArgv);
+
+            // Numeric arguments are formatted once we know the callee needs strings.
+            STR.getArgcArgv(fnName, &callArgc, &callArgv, false, false);
 
             if(callType == FuncCallExprNode::FunctionCall) 
             {
@@ -1475,6 +1597,7 @@ breakContinue:
             else if(callType == FuncCallExprNode::MethodCall)
             {
                saveObject = gEvalState.thisObject;
+               STR.formatNumericArg(1);
                gEvalState.thisObject = Sim::findObject(callArgv[1]);
                if(!gEvalState.thisObject)
                {
@@ -1491,12 +1614,15 @@ breakContinue:
                {
                   DynamicConsoleMethodComponent *pComponent = dynamic_cast<DynamicConsoleMethodComponent*>( gEvalState.thisObject );
                   if( pComponent )
+                  {
+                     STR.formatNumericArgs();
                      pComponent->callMethodArgList( callArgc, callArgv, false );
+                  }
                }
                
                ns = gEvalState.thisObject->getNamespace();
                if(ns)
-                  nsEntry = ns->lookup(fnName);
+                  nsEntry = lookupMethod(ip-3, ns, fnName);
                else
                   nsEntry = NULL;
             }
@@ -1548,14 +1674,32 @@ breakContinue:
                STR.setStringValue("");
                break;
             }
+
+            // Only typed methods take their numeric arguments unformatted.
+            if(nsEntry->mType != Namespace::Entry::TypedCallbackType)
+               STR.formatNumericArgs();
+
             if(nsEntry->mType == Namespace::Entry::ScriptFunctionType)
             {
                const char *ret = "";
+               U32 retType = StringStack::NumericArgNone;
+               F64 retValue = 0;
                if(nsEntry->mFunctionOffset)
+               {
                   ret = nsEntry->mCode->exec(nsEntry->mFunctionOffset, fnName, nsEntry->mNamespace, callArgc, callArgv, false, nsEntry->mPackage);
+
+                  // Keep a numeric return value as a number.
+                  retType = STR.getValueType();
+                  retValue = STR.mValue;
+               }
                
                STR.popFrame();
-               STR.setStringValue(ret);
+               if(retType == StringStack::NumericArgInt)
+                  STR.setIntValue((U32)(S32)retValue);
+               else if(retType == StringStack::NumericArgFloat)
+                  STR.setFloatValue(retValue);
+               else
+                  STR.setStringValue(ret);
             }
             else
             {
@@ -1654,6 +1798,69 @@ breakContinue:
                            STR.setIntValue(result);
                         break;
                      }
+                     case Namespace::Entry::TypedCallbackType:
+                     {
+                        const ConsoleTypedBinding* pBinding = nsEntry->cb.mTypedBinding;
+
+                        // Pass numeric arguments as numbers and everything else as strings.
+                        ConsoleTypedValue typedArgv[StringStack::MaxArgs];
+                        const S32 typedArgc = getMin( (S32)callArgc - 2, (S32)StringStack::MaxArgs );
+                        for( S32 i = 0; i < typedArgc; i++ )
+                        {
+                           const U32 numericType = STR.getArgNumericType( i + 2 );
+                           if( numericType == StringStack::NumericArgInt )
+                              typedArgv[i].setInt( (S32)STR.getArgNumericValue( i + 2 ) );
+                           else if( numericType == StringStack::NumericArgFloat )
+                              typedArgv[i].setFloat( STR.getArgNumericValue( i + 2 ) );
+                           else
+                              typedArgv[i].setString( callArgv[i + 2] );
+
+                           // The argument slot doubles as the buffer a numeric argument is formatted into.
+                           typedArgv[i].mString = (char*)callArgv[i + 2];
+                        }
+
+                        ConsoleTypedValue result;
+                        result.setNone();
+                        pBinding->call( gEvalState.thisObject, typedArgv, result );
+                        STR.popFrame();
+
+                        if( pBinding->getReturnType() == ConsoleTypedValue::ValueNone )
+                        {
+                           if(code[ip] != OP_STR_TO_NONE)
+                              Con::warnf(ConsoleLogEntry::General, "%s: Call to %s in %s uses result of void function call.", getFileLine(ip-6), fnName, functionName);
+                           STR.setStringValue("");
+                        }
+                        else if( result.isNumeric() )
+                        {
+                           if(code[ip] == OP_STR_TO_UINT)
+                           {
+                              ip++;
+                              intStack[++UINT] = result.getInt();
+                              break;
+                           }
+                           else if(code[ip] == OP_STR_TO_FLT)
+                           {
+                              ip++;
+                              floatStack[++FLT] = result.getFloat();
+                              break;
+                           }
+                           else if(code[ip] == OP_STR_TO_NONE)
+                              ip++;
+                           else if( result.mType == ConsoleTypedValue::ValueInt )
+                              STR.setIntValue( result.getInt() );
+                           else
+                              STR.setFloatValue( result.getFloat() );
+                        }
+                        else
+                        {
+                           const char *ret = result.mType == ConsoleTypedValue::ValueString ? result.mString : "";
+                           if(ret != STR.getStringValue())
+                              STR.setStringValue(ret);
+                           else
+                              STR.setLen(dStrlen(ret));
+                        }
+                        break;
+                     }
                   }
                }
             }
@@ -1773,6 +1980,7 @@ execFinished:
       Con::gCurrentRoot = saveCodeBlock->mRoot;
    }
 
+   ScriptProfiler::leaveScript();
    decRefCount();
 
 #ifdef TORQUE_DEBUG
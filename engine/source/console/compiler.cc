@@ -63,6 +63,7 @@ namespace Compiler
    DataChunker          gConsoleAllocator;
    CompilerIdentTable   gIdentTable;
    CodeBlock           *gCurBreakBlock;
+   Vector<StringTableEntry> gLocalVariableSlots;
 
    //------------------------------------------------------------
 
@@ -128,6 +129,30 @@ namespace Compiler
       getIdentTable().reset();
    }
 
+   //------------------------------------------------------------
+
+   bool usesLocalVariableSlot(StringTableEntry varName)
+   {
+      return CodeBlock::smInFunction && varName[0] == '%';
+   }
+
+   U32 getLocalVariableSlot(StringTableEntry varName)
+   {
+      for(U32 i = 0; i < (U32)gLocalVariableSlots.size(); i++)
+         if(gLocalVariableSlots[i] == varName)
+            return i;
+
+      gLocalVariableSlots.push_back(varName);
+      return gLocalVariableSlots.size() - 1;
+   }
+
+   void resetLocalVariableSlots()
+   {
+      gLocalVariableSlots.clear();
+   }
+
+   //------------------------------------------------------------
+
    void *consoleAlloc(U32 size) { return gConsoleAllocator.alloc(size);  }
    void consoleAllocReset()     { gConsoleAllocator.freeBlocks(); }
 
@@ -84,6 +84,14 @@ namespace Compiler
       OP_SETCURVAR_CREATE,
       OP_SETCURVAR_ARRAY,
       OP_SETCURVAR_ARRAY_CREATE,
+      OP_SETCURVAR_LOCAL,
+      OP_SETCURVAR_LOCAL_CREATE,
+      OP_LOADVAR_LOCAL_UINT,
+      OP_LOADVAR_LOCAL_FLT,
+      OP_LOADVAR_LOCAL_STR,
+      OP_SAVEVAR_LOCAL_UINT,
+      OP_SAVEVAR_LOCAL_FLT,
+      OP_SAVEVAR_LOCAL_STR,
 
       OP_LOADVAR_UINT,
       OP_LOADVAR_FLT,
@@ -152,6 +160,18 @@ namespace Compiler
 
    //------------------------------------------------------------
 
+   /// Local variables in functions are given slots so that the interpreter can
+   /// keep their entries in a frame array rather than looking them up by name
+   /// every time.  Variables with slots beyond MaxLocalVariableSlots still use
+   /// the frame dictionary.
+   enum { MaxLocalVariableSlots = 32 };
+
+   bool usesLocalVariableSlot(StringTableEntry varName);
+   U32 getLocalVariableSlot(StringTableEntry varName);
+   void resetLocalVariableSlots();
+
+   //------------------------------------------------------------
+
    struct CompilerIdentTable
    {
       struct Entry
@@ -25,6 +25,8 @@
 #include "platform/threads/thread.h"
 #include "console/console.h"
 #include "console/consoleInternal.h"
+#include "console/consoleVariableRef.h"
+#include "console/consoleLogWriter.h"
 #include "console/consoleObject.h"
 #include "io/fileStream.h"
 #include "io/resource/resourceManager.h"
@@ -99,7 +101,7 @@ void ConsoleConstructor::init(const char *cName, const char *fName, const char *
    funcName = fName;
    usage = usg;
    className = cName;
-   sc = 0; fc = 0; vc = 0; bc = 0; ic = 0;
+   sc = 0; fc = 0; vc = 0; bc = 0; ic = 0; tb = 0;
    group = false;
    next = first;
    ns = false;
@@ -120,6 +122,8 @@ void ConsoleConstructor::setup()
          Con::addCommand(walk->className, walk->funcName, walk->vc, walk->usage, walk->mina, walk->maxa);
       else if(walk->bc)
          Con::addCommand(walk->className, walk->funcName, walk->bc, walk->usage, walk->mina, walk->maxa);
+      else if(walk->tb)
+         Con::addCommand(walk->className, walk->funcName, walk->tb, walk->usage, walk->mina, walk->maxa);
       else if(walk->group)
          Con::markCommandGroup(walk->className, walk->funcName, walk->usage);
       else if(walk->overload)
@@ -165,6 +169,14 @@ ConsoleConstructor::ConsoleConstructor(const char *className, const char *funcNa
    bc = bfunc;
 }
 
+ConsoleConstructor::ConsoleConstructor(const char *className, const char *funcName, const ConsoleTypedBinding *tfunc, const char *usage)
+{
+   // The function name and object are followed by exactly the typed arguments.
+   const S32 argCount = (S32)tfunc->getArgCount() + 2;
+   init(className, funcName, usage, argCount, argCount);
+   tb = tfunc;
+}
+
 ConsoleConstructor::ConsoleConstructor(const char* className, const char* groupName, const char* aUsage)
 {
    init(className, groupName, usage, -1, -2);
@@ -197,8 +209,9 @@ static DataChunker consoleLogChunker;
 static Vector<ConsoleLogEntry> consoleLog(__FILE__, __LINE__);
 static bool consoleLogLocked;
 static bool logBufferEnabled=true;
+static bool collapseRepeatedWarnings = true;
+static S32 maxWarningsPerSecond = 0;
 static S32 printLevel = 10;
-static FileStream consoleLogFile;
 static const char *defLogFileName = "console.log";
 static S32 consoleLogMode = 0;
 static bool active = false;
@@ -252,6 +265,8 @@ void init()
    setVariable("Con::prompt", "% ");
    addVariable("Con::logBufferEnabled", TypeBool, &logBufferEnabled);
    addVariable("Con::printLevel", TypeS32, &printLevel);
+   addVariable("Con::collapseRepeatedWarnings", TypeBool, &collapseRepeatedWarnings);
+   addVariable("Con::maxWarningsPerSecond", TypeS32, &maxWarningsPerSecond);
    addVariable("Con::warnUndefinedVariables", TypeBool, &gWarnUndefinedScriptVariables);
 
    // Current script file name and root
@@ -272,7 +287,7 @@ void shutdown()
    AssertFatal(active == true, "Con::shutdown should only be called once.");
    active = false;
 
-   consoleLogFile.close();
+   ConsoleLogWriter::shutdown();
    Namespace::shutdown();
 
    SAFE_DELETE( sLogMutex );
@@ -433,16 +448,8 @@ static void log(const char *string)
       return;
    }
 
-   // In mode 1, we open, append, close on each log write.
-   if ((consoleLogMode & 0x3) == 1) 
-   {
-      consoleLogFile.open(defLogFileName, FileStream::ReadWrite);
-   }
-
-   // Write to the log if its status is hunky-dory.
-   if ((consoleLogFile.getStatus() == Stream::Ok) || (consoleLogFile.getStatus() == Stream::EOS)) 
+   // The text is queued and written to the file by the log writer's thread.
    {
-      consoleLogFile.setPosition(consoleLogFile.getStreamSize());
       // If this is the first write...
       if (newLogFile) 
       {
@@ -457,7 +464,7 @@ static void log(const char *string)
                lt.hour,
                lt.min,
                lt.sec);
-         consoleLogFile.write(dStrlen(buffer), buffer);
+         ConsoleLogWriter::write(buffer, dStrlen(buffer));
          newLogFile = false;
          if (consoleLogMode & 0x4) 
          {
@@ -468,20 +475,15 @@ static void log(const char *string)
             getLockLog(log, size);
             for (line = 0; line < size; line++) 
             {
-               consoleLogFile.write(dStrlen(log[line].mString), log[line].mString);
-               consoleLogFile.write(2, "\r\n");
+               ConsoleLogWriter::write(log[line].mString, dStrlen(log[line].mString));
+               ConsoleLogWriter::write("\r\n", 2);
             }
             unlockLog();
          }
       }
       // Now write what we came here to write.
-      consoleLogFile.write(dStrlen(string), string);
-      consoleLogFile.write(2, "\r\n");
-   }
-
-   if ((consoleLogMode & 0x3) == 1) 
-   {
-      consoleLogFile.close();
+      ConsoleLogWriter::write(string, dStrlen(string));
+      ConsoleLogWriter::write("\r\n", 2);
    }
 }
 
@@ -524,7 +526,97 @@ static void _outputDebugString(char* pString)
 
 //------------------------------------------------------------------------------
 
+// The last warning or error printed and how many times it has been repeated since.
+static char sLastWarning[512] = { 0 };
+static U32 sLastWarningRepeats = 0;
+
+// Warnings and errors printed and held back in the current rate limiting period.
+static U32 sWarningPeriodStart = 0;
+static U32 sWarningPeriodCount = 0;
+static U32 sWarningsSuppressed = 0;
+
+/// Collapses consecutive identical warnings and errors and limits how many are printed per second.
+/// @param pSummary Filled with a note of any messages held back that should be printed first, or an empty string.
+/// @return Whether the message should be printed.
+static bool _filterWarning(ConsoleLogEntry::Level level, const char* pMessage, char* pSummary, U32 summarySize)
+{
+   pSummary[0] = 0;
+
+   MutexHandle mutex;
+   if( sLogMutex )
+      mutex.lock( sLogMutex, true );
+
+   const bool warning = level != ConsoleLogEntry::Normal;
+
+   // Count the message if it repeats the last warning.
+   if(warning && collapseRepeatedWarnings && sLastWarning[0] && dStrcmp(pMessage, sLastWarning) == 0)
+   {
+      sLastWarningRepeats++;
+      return false;
+   }
+
+   // Note any repeats now a different message is being printed.
+   if(sLastWarningRepeats > 0)
+   {
+      dSprintf(pSummary, summarySize, "(Last warning repeated %d times)", sLastWarningRepeats);
+      sLastWarningRepeats = 0;
+   }
+
+   if(!warning)
+   {
+      sLastWarning[0] = 0;
+      return true;
+   }
+
+   // Messages too long to store are never collapsed.
+   if(dStrlen(pMessage) < sizeof(sLastWarning))
+      dStrcpy(sLastWarning, pMessage);
+   else
+      sLastWarning[0] = 0;
+
+   if(maxWarningsPerSecond > 0)
+   {
+      // Start a new period, noting anything held back in the last one.
+      const U32 currentTime = Platform::getRealMilliseconds();
+      if(currentTime - sWarningPeriodStart >= 1000)
+      {
+         if(sWarningsSuppressed > 0 && pSummary[0] == 0)
+            dSprintf(pSummary, summarySize, "(%d warnings suppressed, $Con::maxWarningsPerSecond is %d)", sWarningsSuppressed, maxWarningsPerSecond);
+
+         sWarningPeriodStart = currentTime;
+         sWarningPeriodCount = 0;
+         sWarningsSuppressed = 0;
+      }
+
+      if(sWarningPeriodCount >= (U32)maxWarningsPerSecond)
+      {
+         sWarningsSuppressed++;
+         return false;
+      }
+
+      sWarningPeriodCount++;
+   }
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+
+static void _printMessage(ConsoleLogEntry::Level level, ConsoleLogEntry::Type type, const char* fmt);
+
 static void _printf(ConsoleLogEntry::Level level, ConsoleLogEntry::Type type, const char* fmt)
+{
+   char summary[128];
+   const bool print = _filterWarning(level, fmt, summary, sizeof(summary));
+
+   if(summary[0])
+      _printMessage(ConsoleLogEntry::Warning, ConsoleLogEntry::General, summary);
+
+   if(print)
+      _printMessage(level, type, fmt);
+}
+
+static void _printMessage(ConsoleLogEntry::Level level, ConsoleLogEntry::Type type, const char* fmt)
 {
    Con::active = false; 
 
@@ -843,6 +935,18 @@ F32 getFloatVariable(const char *varName, F32 def)
 
 //---------------------------------------------------------------------------
 
+StringTableEntry getGlobalVariableName(const char *name)
+{
+   return StringTable->insert(prependDollar(name));
+}
+
+Dictionary::Entry *lookupGlobalVariable(StringTableEntry name)
+{
+   return gEvalState.globalVars.lookup(name);
+}
+
+//---------------------------------------------------------------------------
+
 bool addVariable(const char *name, S32 t, void *dp)
 {
    gEvalState.globalVars.addVariable(name, t, dp);
@@ -887,6 +991,12 @@ void addCommand(const char *nsName, const char *name,BoolCallback cb, const char
    ns->addCommand(StringTable->insert(name), cb, usage, minArgs, maxArgs);
 }
 
+void addCommand(const char *nsName, const char *name,const ConsoleTypedBinding *cb, const char *usage, S32 minArgs, S32 maxArgs)
+{
+   Namespace *ns = lookupNamespace(nsName);
+   ns->addCommand(StringTable->insert(name), cb, usage, minArgs, maxArgs);
+}
+
 void markCommandGroup(const char * nsName, const char *name, const char* usage)
 {
    Namespace *ns = lookupNamespace(nsName);
@@ -1001,7 +1111,7 @@ const char *execute(S32 argc, const char *argv[])
    {
       SimConsoleThreadExecCallback cb;
       SimConsoleThreadExecEvent *evt = new SimConsoleThreadExecEvent(argc, argv, false, &cb);
-      Sim::postEvent(Sim::getRootGroup(), evt, Sim::getCurrentTime());
+      Sim::postThreadEvent(RootGroupId, evt);
       
       return cb.waitForResult();
    }
@@ -1011,60 +1121,85 @@ const char *execute(S32 argc, const char *argv[])
 //------------------------------------------------------------------------------
 const char *execute(SimObject *object, S32 argc, const char *argv[],bool thisCallOnly)
 {
-   static char idBuf[16];
    if(argc < 2)
       return "";
 
+   if(object->getNamespace())
+   {
+      StringTableEntry funcName = StringTable->insert(argv[0]);
+      Namespace::Entry *ent = object->getNamespace()->lookup(funcName);
+
+      return executeEntry(object, ent, argc, argv, thisCallOnly);
+   }
+
    // [neo, 10/05/2007 - #3010]
    // Make sure we don't get recursive calls, respect the flag!   
-   // Should we be calling handlesMethod() first?
    if( !thisCallOnly )
    {
       DynamicConsoleMethodComponent *com = dynamic_cast<DynamicConsoleMethodComponent *>(object);
       if(com)
          com->callMethodArgList(argc, argv, false);
    }
-   
-   if(object->getNamespace())
-   {
-      StringTableEntry funcName = StringTable->insert(argv[0]);
-      Namespace::Entry *ent = object->getNamespace()->lookup(funcName);
 
-      if(ent == NULL)
-      {
-         //warnf(ConsoleLogEntry::Script, "%s: undefined for object '%s' - id %d", funcName, object->getName(), object->getId());
+   warnf(ConsoleLogEntry::Script, "Con::execute - %d has no namespace: %s", object->getId(), argv[0]);
+   return "";
+}
 
-         // Clean up arg buffers, if any.
-         STR.clearFunctionOffset();
-         return "";
-      }
+//------------------------------------------------------------------------------
+const char *executeEntry(SimObject *object, Namespace::Entry *ent, S32 argc, const char *argv[], bool thisCallOnly)
+{
+   if(argc < 2)
+      return "";
 
-      // Twiddle %this argument
-      const char *oldArg1 = argv[1];
+   // [neo, 10/05/2007 - #3010]
+   // Make sure we don't get recursive calls, respect the flag!   
+   // Should we be calling handlesMethod() first?
+   if( !thisCallOnly )
+   {
+      DynamicConsoleMethodComponent *com = dynamic_cast<DynamicConsoleMethodComponent *>(object);
+      if(com)
+         com->callMethodArgList(argc, argv, false);
+   }
+
+   if(ent == NULL)
+   {
+      // Clean up arg buffers, if any.
+      STR.clearFunctionOffset();
+      return "";
+   }
+
+   // Twiddle %this argument (registered objects have a cached id string)
+   static char idBuf[16];
+   const char *oldArg1 = argv[1];
+   if(object->isProperlyAdded())
+   {
+      argv[1] = object->getIdString();
+   }
+   else
+   {
       dSprintf(idBuf, sizeof(idBuf), "%d", object->getId());
       argv[1] = idBuf;
+   }
 
-      object->pushScriptCallbackGuard();
+   object->pushScriptCallbackGuard();
 
-      SimObject *save = gEvalState.thisObject;
-      gEvalState.thisObject = object;
-      const char *ret = ent->execute(argc, argv, &gEvalState);
-      gEvalState.thisObject = save;
+   SimObject *save = gEvalState.thisObject;
+   gEvalState.thisObject = object;
+   const char *ret = ent->execute(argc, argv, &gEvalState);
+   gEvalState.thisObject = save;
 
-      object->popScriptCallbackGuard();
+   object->popScriptCallbackGuard();
 
-      // Twiddle it back
-      argv[1] = oldArg1;
+   // Twiddle it back
+   argv[1] = oldArg1;
 
-      // Reset the function offset so the stack
-      // doesn't continue to grow unnecessarily
-      STR.clearFunctionOffset();
+   // Reset the function offset so the stack
+   // doesn't continue to grow unnecessarily
+   STR.clearFunctionOffset();
 
-      return ret;
-   }
-   warnf(ConsoleLogEntry::Script, "Con::execute - %d has no namespace: %s", object->getId(), argv[0]);
-   return "";
+   return ret;
 }
+
 const char *executef(SimObject *object, S32 argc, ...)
 {
    const char *argv[128];
@@ -1114,16 +1249,8 @@ void setLogMode(S32 newMode)
          // Enabling logging when it was previously disabled.
          newLogFile = true;
       }
-      if ((consoleLogMode & 0x3) == 2)
-      {
-         // Changing away from mode 2, must close logfile.
-         consoleLogFile.close();
-      }
-      else if ((newMode & 0x3) == 2)
-      {
-         // Starting mode 2, must open logfile.
-         consoleLogFile.open(defLogFileName, FileStream::Write);
-      }
+      // The log writer closes the log file when leaving mode 2 and opens it when starting mode 2.
+      ConsoleLogWriter::setFileMode(defLogFileName, (ConsoleLogWriter::FileMode)(newMode & 0x3));
       consoleLogMode = newMode;
    }
 }
@@ -29,6 +29,9 @@
 #ifndef _BITSET_H_
 #include "collection/bitSet.h"
 #endif
+#ifndef _CONSOLE_TYPED_BINDING_H_
+#include "console/consoleTypedBinding.h"
+#endif
 #include <stdarg.h>
 
 class SimObject;
@@ -202,7 +205,9 @@ namespace Con
       //  02/16/07 - PAUP - 41->42 DSOs are read with a pointer before every string(ASTnodes changed). Namespace and HashTable revamped
       //  05/17/10 - Luma - 42-43 Adding proper sceneObject physics flags, fixes in general
       //  02/07/13 - JU   - 43->44 Expanded the width of stringtable entries to  64bits 
-      DSOVersion = 44,
+      //  44->45 Added local variable slot opcodes
+      //  45->46 Added fused local variable load/save opcodes, constant folding
+      DSOVersion = 46,
       MaxLineLength = 512,  ///< Maximum length of a line of console input.
       MaxDataTypes = 256    ///< Maximum number of registered data types.
    };
@@ -457,6 +462,7 @@ namespace Con
    void addCommand(const char *nameSpace, const char *name,FloatCallback cb,  const char *usage, S32 minArgs, S32 maxArgs); ///< @copydoc addCommand(const char*, const char *, StringCallback, const char *, S32, S32)
    void addCommand(const char *nameSpace, const char *name,VoidCallback cb,   const char *usage, S32 minArgs, S32 maxArgs); ///< @copydoc addCommand(const char*, const char *, StringCallback, const char *, S32, S32)
    void addCommand(const char *nameSpace, const char *name,BoolCallback cb,   const char *usage, S32 minArgs, S32 maxArgs); ///< @copydoc addCommand(const char*, const char *, StringCallback, const char *, S32, S32)
+   void addCommand(const char *nameSpace, const char *name,const ConsoleTypedBinding *cb, const char *usage, S32 minArgs, S32 maxArgs); ///< @copydoc addCommand(const char*, const char *, StringCallback, const char *, S32, S32)
    /// @}
 
    /// @name Special Purpose Registration
@@ -664,6 +670,7 @@ public:
    FloatCallback fc;    ///< A function/method that returns a float.
    VoidCallback vc;     ///< A function/method that returns nothing.
    BoolCallback bc;     ///< A function/method that returns a bool.
+   const ConsoleTypedBinding *tb; ///< A method with typed arguments and return value.
    bool group;          ///< Indicates that this is a group marker.
    bool overload;       ///< Indicates that this is an overload marker.
    bool ns;             ///< Indicates that this is a namespace marker.
@@ -751,6 +758,7 @@ public:
    ConsoleConstructor(const char *className, const char *funcName, FloatCallback  ffunc, const char* usage,  S32 minArgs, S32 maxArgs);
    ConsoleConstructor(const char *className, const char *funcName, VoidCallback   vfunc, const char* usage,  S32 minArgs, S32 maxArgs);
    ConsoleConstructor(const char *className, const char *funcName, BoolCallback   bfunc, const char* usage,  S32 minArgs, S32 maxArgs);
+   ConsoleConstructor(const char *className, const char *funcName, const ConsoleTypedBinding *tfunc, const char* usage);
    /// @}
 
    /// @name Magic Console Constructors
@@ -867,6 +875,23 @@ public:
 	  className##name##obj(#className,#name,c##className##name##caster,#argString,minArgs,maxArgs);        \
       static inline returnType c##className##name(S32 argc, const char **argv)
 
+/// Define a console method with typed arguments and return value.
+///
+/// The argument list is a C++ parameter list starting with the object.  Numeric
+/// arguments and return values are passed to and from the interpreter without
+/// being converted to and from strings.
+///
+/// @code
+///      ConsoleTypedMethodWithDocs(SceneObject, setAngle, void, (SceneObject* object, F32 angle), (float angle))
+///      {
+///         object->setAngle( mDegToRad( angle ) );
+///      }
+/// @endcode
+#  define ConsoleTypedMethodWithDocs(className,name,returnType,args,argString)                                       \
+      static inline returnType c##className##name args;                                                           \
+      static ConsoleConstructor className##name##obj(#className,#name,ConsoleTypedBinding::create(&c##className##name),#argString); \
+      static inline returnType c##className##name args
+
 #  define ConsoleMethodGroupEnd(className, groupName) \
       static ConsoleConstructor className##groupName##__GroupEnd(#className,#groupName,NULL);
 
@@ -906,6 +931,11 @@ public:
          className##name##obj(#className,#name,c##className##name##caster,"",minArgs,maxArgs);        \
       static inline returnType c##className##name(S32 argc, const char **argv)
 
+#  define ConsoleTypedMethodWithDocs(className,name,returnType,args,argString)                                       \
+      static inline returnType c##className##name args;                                                           \
+      static ConsoleConstructor className##name##obj(#className,#name,ConsoleTypedBinding::create(&c##className##name),""); \
+      static inline returnType c##className##name args
+
 
 #endif
 
@@ -21,6 +21,7 @@
 //-----------------------------------------------------------------------------
 
 #include "console/consoleDictionary.h"
+#include "console/consoleExprEvalState.h"
 #include "console/consoleNamespace.h"
 
 #include "platform/platform.h"
@@ -236,8 +237,13 @@ void Dictionary::remove(Dictionary::Entry *ent)
    *walk = (ent->nextEntry);
    delete ent;
    hashTable->count--;
+
+   if ( this == &gEvalState.globalVars )
+      smGlobalRemoveSequence++;
 }
 
+U32 Dictionary::smGlobalRemoveSequence = 0;
+
 Dictionary::Dictionary()
    :  hashTable( NULL ),
       exprState( NULL ),
@@ -306,6 +312,9 @@ void Dictionary::reset()
    }
    hashTable->size = ST_INIT_SIZE;
    hashTable->count = 0;
+
+   if ( this == &gEvalState.globalVars )
+      smGlobalRemoveSequence++;
 }
 
 
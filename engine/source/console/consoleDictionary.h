@@ -170,6 +170,10 @@ public:
     void addVariable(const char *name, S32 type, void *dataPtr);
     bool removeVariable(StringTableEntry name);
 
+    /// Incremented whenever entries are deleted from the global dictionary so that
+    /// cached entries (see Con::VariableRef) know to look themselves up again.
+    static U32 smGlobalRemoveSequence;
+
     /// Return the best tab completion for prevText, with the length
     /// of the pre-tab string in baseLen.
     const char *tabComplete(const char *prevText, S32 baseLen, bool);
@@ -203,6 +203,7 @@ void Namespace::printNamespaceEntries(Namespace * g, bool dumpScript, bool dumpE
       char buffer[1024]; //< This will bite you in the butt someday.
       int eType = ewalk->mType;
       const char * funcName = ewalk->mFunctionName;
+      const Entry * typeEntry = ewalk;
 
       if( ( eType == Entry::ScriptFunctionType ) && !dumpScript )
          continue;
@@ -225,6 +226,7 @@ void Namespace::printNamespaceEntries(Namespace * g, bool dumpScript, bool dumpE
                if(!dStrcmp(eseek->mFunctionName, ewalk->cb.mGroupName))
                {
                   eType = eseek->mType;
+                  typeEntry = eseek;
                   break;
                }
             }
@@ -232,6 +234,9 @@ void Namespace::printNamespaceEntries(Namespace * g, bool dumpScript, bool dumpE
             funcName = ewalk->cb.mGroupName;
          }
 
+         // Typed methods know their own return type.
+         const char *retType = eType == Entry::TypedCallbackType ? typeEntry->cb.mTypedBinding->getReturnTypeName() : typeNames[eType];
+
          // A quick note  - if your usage field starts with a (, then it's auto-integrated into
          // the script docs! Use this HEAVILY!
 
@@ -258,7 +263,7 @@ void Namespace::printNamespaceEntries(Namespace * g, bool dumpScript, bool dumpE
             dStrncpy(buffer, use, len);
             buffer[len] = 0;
 
-            printClassMethod(true, typeNames[eType], funcName, buffer, end+1);
+            printClassMethod(true, retType, funcName, buffer, end+1);
 
             continue; // Skip to next one.
          }
@@ -273,7 +278,7 @@ void Namespace::printNamespaceEntries(Namespace * g, bool dumpScript, bool dumpE
             buffer[len] = 0;
 
             // Then let's do the heuristic-trick
-            printClassMethod(true, typeNames[eType], funcName, buffer, end+1);
+            printClassMethod(true, retType, funcName, buffer, end+1);
             continue; // Get to next item.
          }
 
@@ -285,12 +290,12 @@ void Namespace::printNamespaceEntries(Namespace * g, bool dumpScript, bool dumpE
             dStrncpy(buffer, bgn+1, len);
             buffer[len] = 0;
 
-            printClassMethod(true, typeNames[eType], funcName, buffer, end+1);
+            printClassMethod(true, retType, funcName, buffer, end+1);
             continue;
          }
 
          // Default...
-         printClassMethod(true, typeNames[eType], funcName, "", ewalk->mUsage);
+         printClassMethod(true, retType, funcName, "", ewalk->mUsage);
       }
       else if(ewalk->mType == Entry::GroupMarker)
       {
@@ -426,10 +431,10 @@ void Namespace::dumpClasses( bool dumpScript, bool dumpEngine )
          // Get information about the parent's fields...
          AbstractClassRep *parentRep = vec[i]->mParent ? vec[i]->mParent->mClassRep : NULL;
          if(parentRep)
-            parentList = &(parentRep->mFieldList);
+            parentList = &(parentRep->getFieldList());
 
          // Get information about our fields
-         fieldList = &(rep->mFieldList);
+         fieldList = &(rep->getFieldList());
 
          // Go through all our fields...
          for(U32 j = 0; j < (U32)fieldList->size(); j++)
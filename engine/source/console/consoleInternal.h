@@ -27,4 +27,16 @@
 #include "consoleDictionary.h"
 #include "consoleExprEvalState.h"
 
+class SimObject;
+
+namespace Con
+{
+   /// Call a method on an object using a method entry already looked up in the object's namespace.
+   ///
+   /// This is equivalent to Con::execute() (including behavior/component dispatch) but avoids the
+   /// method name and namespace lookups so callers issuing the same callback many times can resolve it once.
+   /// A NULL entry only performs the behavior/component dispatch.
+   const char *executeEntry(SimObject *object, Namespace::Entry *entry, S32 argc, const char *argv[], bool thisCallOnly = false);
+}
+
 #endif // _CONSOLEINTERNAL_H_
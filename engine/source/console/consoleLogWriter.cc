@@ -0,0 +1,245 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#include "console/consoleLogWriter.h"
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_MUTEX_H_
+#include "platform/threads/mutex.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_ATOMIC_H_
+#include "platform/threads/atomic.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+#ifndef _STRINGTABLE_H_
+#include "string/stringTable.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+// Emscripten builds without pthreads cannot start threads so the log is written immediately.
+#if defined(TORQUE_OS_EMSCRIPTEN) && !defined(__EMSCRIPTEN_PTHREADS__)
+#define CONSOLE_LOG_SYNCHRONOUS
+#endif
+
+//-----------------------------------------------------------------------------
+
+ConsoleLogWriter::FileMode ConsoleLogWriter::smFileMode = ConsoleLogWriter::FileClosed;
+
+// The ring.  The writer only advances the tail and the flush only advances the head.
+static char sRing[ConsoleLogWriter::RingSize];
+static volatile U32 sRingHead = 0;
+static volatile U32 sRingTail = 0;
+
+// Guards the file and serializes flushes.
+static Mutex* sFileMutex = NULL;
+static FileStream sLogFile;
+static StringTableEntry sLogFileName = NULL;
+
+static Thread* sFlushThread = NULL;
+static volatile bool sFlushRequested = false;
+
+//-----------------------------------------------------------------------------
+
+void ConsoleLogWriter::setFileMode( const char* pFileName, const FileMode fileMode )
+{
+   if ( sFileMutex == NULL )
+      sFileMutex = new Mutex;
+
+   MutexHandle mutexHandle;
+   mutexHandle.lock( sFileMutex, true );
+
+   // Finish writing in the old mode.
+   flushLocked();
+
+   if ( smFileMode == FileOpen )
+      sLogFile.close();
+
+   smFileMode = fileMode;
+   sLogFileName = StringTable->insert( pFileName );
+
+   if ( smFileMode == FileOpen )
+      sLogFile.open( sLogFileName, FileStream::Write );
+
+#ifndef CONSOLE_LOG_SYNCHRONOUS
+   // Start the flush thread the first time a file is used.
+   if ( smFileMode != FileClosed && sFlushThread == NULL )
+   {
+      // NOTE: The thread is started only once it's assigned as the thread function uses it.
+      sFlushThread = new Thread( flushThreadFunction, NULL, false );
+      sFlushThread->start();
+   }
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+void ConsoleLogWriter::write( const char* pText, const U32 length )
+{
+   if ( smFileMode == FileClosed )
+      return;
+
+   U32 remaining = length;
+   while ( remaining > 0 )
+   {
+      const U32 tail = sRingTail;
+      const U32 space = RingSize - (tail - sRingHead);
+
+      // Write the ring out here if it is full.
+      if ( space == 0 )
+      {
+         flush();
+         continue;
+      }
+
+      // Copy as much as fits, wrapping around the end of the ring.
+      const U32 count = getMin( remaining, space );
+      const U32 offset = tail & (RingSize - 1);
+      const U32 firstCount = getMin( count, (U32)RingSize - offset );
+      dMemcpy( sRing + offset, pText, firstCount );
+      dMemcpy( sRing, pText + firstCount, count - firstCount );
+
+      // Publish the text only once it is completely copied.
+      dMemoryBarrier();
+      sRingTail = tail + count;
+
+      pText += count;
+      remaining -= count;
+   }
+
+   // Without a flush thread the text is written immediately.
+   if ( sFlushThread == NULL )
+   {
+      flush();
+      return;
+   }
+
+   // Ask for an early flush if the ring is filling up.
+   if ( sRingTail - sRingHead >= RingSize / 2 )
+      sFlushRequested = true;
+}
+
+//-----------------------------------------------------------------------------
+
+void ConsoleLogWriter::flush( void )
+{
+   if ( sFileMutex == NULL )
+      return;
+
+   MutexHandle mutexHandle;
+   mutexHandle.lock( sFileMutex, true );
+
+   flushLocked();
+}
+
+//-----------------------------------------------------------------------------
+
+void ConsoleLogWriter::flushLocked( void )
+{
+   const U32 head = sRingHead;
+   const U32 tail = sRingTail;
+   if ( head == tail )
+      return;
+
+   // Make sure the text up to the tail is visible.
+   dMemoryBarrier();
+
+   if ( smFileMode == FileAppend )
+   {
+      sLogFile.open( sLogFileName, FileStream::ReadWrite );
+      sLogFile.setPosition( sLogFile.getStreamSize() );
+   }
+
+   // Write the text in one batch, or two if it wraps around the end of the ring.
+   if ( sLogFile.getStatus() == Stream::Ok || sLogFile.getStatus() == Stream::EOS )
+   {
+      const U32 count = tail - head;
+      const U32 offset = head & (RingSize - 1);
+      const U32 firstCount = getMin( count, (U32)RingSize - offset );
+      sLogFile.write( firstCount, sRing + offset );
+      if ( count > firstCount )
+         sLogFile.write( count - firstCount, sRing );
+   }
+
+   if ( smFileMode == FileAppend )
+      sLogFile.close();
+
+   // Release the space only once the text has been written.
+   dMemoryBarrier();
+   sRingHead = tail;
+}
+
+//-----------------------------------------------------------------------------
+
+void ConsoleLogWriter::flushThreadFunction( void* pData )
+{
+   // Poll in short steps so requests for an early flush are seen promptly.
+   const U32 pollPeriod = 10;
+
+   while ( !sFlushThread->checkForStop() )
+   {
+      for ( U32 waited = 0; waited < FlushPeriod && !sFlushRequested && !sFlushThread->checkForStop(); waited += pollPeriod )
+         Platform::sleep( pollPeriod );
+
+      sFlushRequested = false;
+      flush();
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+void ConsoleLogWriter::shutdown( void )
+{
+   if ( sFlushThread != NULL )
+   {
+      sFlushThread->stop();
+      sFlushThread->join();
+      delete sFlushThread;
+      sFlushThread = NULL;
+   }
+
+   if ( sFileMutex == NULL )
+      return;
+
+   flush();
+
+   if ( smFileMode == FileOpen )
+      sLogFile.close();
+
+   smFileMode = FileClosed;
+
+   delete sFileMutex;
+   sFileMutex = NULL;
+}
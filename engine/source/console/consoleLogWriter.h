@@ -0,0 +1,79 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#ifndef _CONSOLE_LOG_WRITER_H_
+#define _CONSOLE_LOG_WRITER_H_
+
+#ifndef _TORQUE_TYPES_H_
+#include "platform/types.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// Writes the console log file from a background thread.
+///
+/// Log text is copied into a ring buffer and the flush thread writes whatever has accumulated
+/// in one batch every FlushPeriod milliseconds, so printing never waits on file I/O unless the
+/// ring fills up.  A full ring is flushed on the thread that is writing so no text is lost.
+/// Writers must be serialized by the caller.  The text is written in the order it was given.
+///
+/// The flush thread is only started once a log file is opened.  Builds that cannot start
+/// threads write to the file immediately.
+class ConsoleLogWriter
+{
+public:
+   enum
+   {
+      RingSize       = 256 * 1024,  ///< Bytes of text that can be waiting to be written.  Must be a power of two.
+      FlushPeriod    = 100          ///< Milliseconds between flushes.
+   };
+
+   /// The ways the log file can be kept, matching the low bits of the console log mode.
+   enum FileMode
+   {
+      FileClosed     = 0,           ///< Text is discarded.
+      FileAppend     = 1,           ///< The file is opened, appended to and closed for every flush.
+      FileOpen       = 2            ///< The file is truncated and kept open.
+   };
+
+   /// Change how the log file is kept.  Anything already written is flushed in the old mode first.
+   static void setFileMode( const char* pFileName, const FileMode fileMode );
+   static inline FileMode getFileMode( void ) { return smFileMode; }
+
+   /// Queue text to be written.
+   static void write( const char* pText, const U32 length );
+
+   /// Write everything queued now.  Safe to call from any thread.
+   static void flush( void );
+
+   /// Flush, stop the flush thread and close the log file.
+   static void shutdown( void );
+
+private:
+   static void flushLocked( void );
+   static void flushThreadFunction( void* pData );
+
+   static FileMode smFileMode;
+};
+
+#endif // _CONSOLE_LOG_WRITER_H_
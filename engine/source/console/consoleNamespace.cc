@@ -42,6 +42,16 @@ DataChunker Namespace::mAllocator;
 Namespace *Namespace::mNamespaceList = NULL;
 Namespace *Namespace::mGlobalNamespace = NULL;
 
+// The namespaces hashed by name and package.  There is a namespace per class and script class
+// so this keeps registering the console commands at start-up from being quadratic.
+static Vector<Namespace *> sNamespaceBuckets(__FILE__, __LINE__);
+static U32 sNamespaceCount = 0;
+
+static inline U32 getNamespaceBucket(StringTableEntry name, StringTableEntry package)
+{
+   const U32 hash = ((U32)(dsize_t)name >> 2) * 2654435761u ^ ((U32)(dsize_t)package >> 2);
+   return hash & (sNamespaceBuckets.size() - 1);
+}
 
 
 Namespace::Entry::Entry()
@@ -74,6 +84,7 @@ Namespace::Namespace()
    mName = NULL;
    mParent = NULL;
    mNext = NULL;
+   mNextInBucket = NULL;
    mEntryList = NULL;
    mHashSize = 0;
    mHashTable = 0;
@@ -100,9 +111,12 @@ void Namespace::clearEntries()
 
 Namespace *Namespace::find(StringTableEntry name, StringTableEntry package)
 {
-   for(Namespace *walk = mNamespaceList; walk; walk = walk->mNext)
-      if(walk->mName == name && walk->mPackage == package)
-         return walk;
+   if(sNamespaceBuckets.size())
+   {
+      for(Namespace *walk = sNamespaceBuckets[getNamespaceBucket(name, package)]; walk; walk = walk->mNextInBucket)
+         if(walk->mName == name && walk->mPackage == package)
+            return walk;
+   }
 
    Namespace *ret = (Namespace *) mAllocator.alloc(sizeof(Namespace));
    constructInPlace(ret);
@@ -110,6 +124,26 @@ Namespace *Namespace::find(StringTableEntry name, StringTableEntry package)
    ret->mName = name;
    ret->mNext = mNamespaceList;
    mNamespaceList = ret;
+
+   // Rehash all the namespaces when the buckets are full.
+   if(++sNamespaceCount > (U32)sNamespaceBuckets.size())
+   {
+      sNamespaceBuckets.setSize(getMax((U32)256, (U32)sNamespaceBuckets.size() * 2));
+      dMemset(sNamespaceBuckets.address(), 0, sNamespaceBuckets.size() * sizeof(Namespace *));
+      for(Namespace *walk = mNamespaceList; walk; walk = walk->mNext)
+      {
+         Namespace *&bucket = sNamespaceBuckets[getNamespaceBucket(walk->mName, walk->mPackage)];
+         walk->mNextInBucket = bucket;
+         bucket = walk;
+      }
+   }
+   else
+   {
+      Namespace *&bucket = sNamespaceBuckets[getNamespaceBucket(name, package)];
+      ret->mNextInBucket = bucket;
+      bucket = ret;
+   }
+
    return ret;
 }
 
@@ -422,6 +456,19 @@ void Namespace::addCommand(StringTableEntry name,BoolCallback cb, const char *us
    ent->cb.mBoolCallbackFunc = cb;
 }
 
+void Namespace::addCommand(StringTableEntry name,const ConsoleTypedBinding *cb, const char *usage, S32 minArgs, S32 maxArgs)
+{
+   Entry *ent = createLocalEntry(name);
+   trashCache();
+
+   ent->mUsage = usage;
+   ent->mMinArgs = minArgs;
+   ent->mMaxArgs = maxArgs;
+
+   ent->mType = Entry::TypedCallbackType;
+   ent->cb.mTypedBinding = cb;
+}
+
 void Namespace::addOverload(const char * name, const char *altUsage)
 {
    static U32 uid=0;
@@ -505,6 +552,8 @@ const char *Namespace::Entry::execute(S32 argc, const char **argv, ExprEvalState
          dSprintf(returnBuffer, sizeof(returnBuffer), "%d",
             (U32)cb.mBoolCallbackFunc(state->thisObject, argc, argv));
          return returnBuffer;
+      case TypedCallbackType:
+         return cb.mTypedBinding->execute(state->thisObject, argc, argv);
    }
 
    return "";
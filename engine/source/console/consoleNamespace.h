@@ -38,6 +38,7 @@
 class ExprEvalState;
 class CodeBlock;
 class AbstractClassRep;
+class ConsoleTypedBinding;
 
 //-----------------------------------------------------------------------------
 
@@ -56,6 +57,7 @@ public:
 
     Namespace *mParent;
     Namespace *mNext;
+    Namespace *mNextInBucket;
     AbstractClassRep *mClassRep;
     U32 mRefCountToParent;
     const char* mUsage;
@@ -74,7 +76,8 @@ public:
             IntCallbackType,
             FloatCallbackType,
             VoidCallbackType,
-            BoolCallbackType
+            BoolCallbackType,
+            TypedCallbackType
         };
 
         Namespace *mNamespace;
@@ -94,6 +97,7 @@ public:
             VoidCallback mVoidCallbackFunc;
             FloatCallback mFloatCallbackFunc;
             BoolCallback mBoolCallbackFunc;
+            const ConsoleTypedBinding* mTypedBinding;
             const char* mGroupName;
         } cb;
         Entry();
@@ -117,6 +121,7 @@ public:
     void addCommand(StringTableEntry name,FloatCallback, const char *usage, S32 minArgs, S32 maxArgs);
     void addCommand(StringTableEntry name,VoidCallback, const char *usage, S32 minArgs, S32 maxArgs);
     void addCommand(StringTableEntry name,BoolCallback, const char *usage, S32 minArgs, S32 maxArgs);
+    void addCommand(StringTableEntry name,const ConsoleTypedBinding*, const char *usage, S32 minArgs, S32 maxArgs);
 
     void addOverload(const char *name, const char* altUsage);
 
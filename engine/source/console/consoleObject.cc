@@ -42,9 +42,10 @@ bool                               AbstractClassRep::initialized = false;
 //--------------------------------------
 const AbstractClassRep::Field *AbstractClassRep::findField(StringTableEntry name) const
 {
-   for(U32 i = 0; i < (U32)mFieldList.size(); i++)
-      if(mFieldList[i].pFieldname == name)
-         return &mFieldList[i];
+   const FieldList& fieldList = getFieldList();
+   for(U32 i = 0; i < (U32)fieldList.size(); i++)
+      if(fieldList[i].pFieldname == name)
+         return &fieldList[i];
 
    return NULL;
 }
@@ -182,28 +183,11 @@ void AbstractClassRep::initialize()
       walk->mNamespace->mClassRep = walk;
    }
 
-   // Initialize field lists... (and perform other console registration).
+   // Perform console registration.
+   // NOTE: The field lists are initialized when first used.
    for (walk = classLinkList; walk; walk = walk->nextClass)
-   {
-      // sg_tempFieldList is used as a staging area for field lists
-      // (see addField, addGroup, etc.)
-      sg_tempFieldList.setSize(0);
-
       walk->init();
 
-      // So if we have things in it, copy it over...
-      if (sg_tempFieldList.size() != 0)
-      {
-         if( !walk->mFieldList.size())
-            walk->mFieldList = sg_tempFieldList;
-         else
-            destroyFieldValidators( sg_tempFieldList );
-      }
-
-      // And of course delete it every round.
-      sg_tempFieldList.clear();
-   }
-
    // Calculate counts and bit sizes for the various NetClasses.
    for (U32 group = 0; group < NetClassGroupsCount; group++)
    {
@@ -250,6 +234,32 @@ void AbstractClassRep::initialize()
 
 }
 
+void AbstractClassRep::initializeFieldList()
+{
+   AssertFatal(!mFieldListInitialized, "AbstractClassRep::initializeFieldList() - The field list is already initialized.");
+   AssertFatal(sg_tempFieldList.size() == 0, "AbstractClassRep::initializeFieldList() - Cannot initialize a field list whilst initializing another.");
+
+   mFieldListInitialized = true;
+
+   // sg_tempFieldList is used as a staging area for field lists
+   // (see addField, addGroup, etc.)
+   initFields();
+
+   // So if we have things in it, copy it over...
+   if (sg_tempFieldList.size() != 0)
+   {
+      if( !mFieldList.size())
+         mFieldList = sg_tempFieldList;
+      else
+         destroyFieldValidators( sg_tempFieldList );
+   }
+
+   // And of course delete it every round.
+   sg_tempFieldList.clear();
+}
+
+//--------------------------------------
+
 void AbstractClassRep::destroyFieldValidators( AbstractClassRep::FieldList &mFieldList )
 {
    for(S32 i = mFieldList.size()-1; i>=0; i-- )
@@ -174,8 +174,9 @@ class ConsoleTypeValidator;
 ///      - Sets up a Namespace for each class.
 ///      - Call the init() method on each ConcreteClassRep. This method:
 ///         - Links namespaces between parent and child classes, using Con::classLinkNamespaces.
-///         - Calls initPersistFields() and consoleInit().
-///      - As a result of calling initPersistFields, the field list for the class is populated.
+///         - Calls consoleInit().
+///      - The field list for a class is populated by calling its initPersistFields() when the
+///        list is first used (see getFieldList()) so classes that are never used cost nothing at start-up.
 ///      - Assigns network IDs for classes based on their NetGroup membership. Determines
 ///        bit allocations for network ID fields.
 ///
@@ -239,8 +240,13 @@ public:
     };
     typedef Vector<Field> FieldList;
 
+protected:
     FieldList mFieldList;
+    bool mFieldListInitialized;
+
+    void initializeFieldList();
 
+public:
     bool mDynamicGroupExpand;
 
     static U32  NetClassCount [NetClassGroupsCount][NetClassTypesCount];
@@ -255,7 +261,9 @@ public:
     AbstractClassRep() 
     {
         VECTOR_SET_ASSOCIATION(mFieldList);
+        mFieldListInitialized = false;
         parentClass  = NULL;
+        mTamlModifyTracked = false;
     }
     virtual ~AbstractClassRep() { }
 
@@ -274,6 +282,12 @@ public:
     virtual AbstractClassRep*    getContainerChildClass( const bool recurse ) = 0;
     virtual WriteCustomTamlSchema getCustomTamlSchema( void ) = 0;
 
+    /// Whether instances of exactly this class record every change to their persisted state.
+    /// This is not inherited as derived classes usually have state that changes without using fields.
+    /// @see SimObject::isTamlModifiedSince()
+    inline void setTamlModifyTracked( const bool tracked ) { mTamlModifyTracked = tracked; }
+    inline bool isTamlModifyTracked( void ) const { return mTamlModifyTracked; }
+
     /// Helper class to see if we are a given class, or a subclass thereof.
     bool                       isClass(AbstractClassRep  *acr)
     {
@@ -293,12 +307,21 @@ public:
 
 public:
     virtual ConsoleObject* create() const = 0;
+
+    /// Fetch the persistent fields of the class, building them with initPersistFields() on first use.
+    /// @note Like the rest of the console this is not thread-safe.
+    inline FieldList& getFieldList()                { if ( !mFieldListInitialized ) initializeFieldList(); return mFieldList; }
+    inline const FieldList& getFieldList() const    { return const_cast<AbstractClassRep*>(this)->getFieldList(); }
+
     const Field *findField(StringTableEntry fieldName) const;
     AbstractClassRep* findFieldRoot( StringTableEntry fieldName );
     AbstractClassRep* findContainerChildRoot( AbstractClassRep* pChild );
 
 protected:
     virtual void init() const = 0;
+    virtual void initFields() const = 0;
+
+    bool mTamlModifyTracked;
 };
 
 //-----------------------------------------------------------------------------
@@ -398,7 +421,7 @@ public:
 
     /// Perform class specific initialization tasks.
     ///
-    /// Link namespaces, call initPersistFields() and consoleInit().
+    /// Link namespaces and call consoleInit().
     void init() const
     {
         // Get handle to our parent class, if any, and ourselves (we are our parent's child).
@@ -410,10 +433,15 @@ public:
             Con::classLinkNamespaces(parent->getNameSpace(), child->getNameSpace());
 
         // Finally, do any class specific initialization...
-        T::initPersistFields();
         T::consoleInit();
     }
 
+    /// Populate the field list.
+    void initFields() const
+    {
+        T::initPersistFields();
+    }
+
     /// Wrap constructor.
     ConsoleObject* create() const { return new T; }
 };
@@ -815,14 +843,14 @@ inline ConsoleObject* ConsoleObject::create(const U32 groupId, const U32 typeId,
 
 inline const AbstractClassRep::FieldList& ConsoleObject::getFieldList() const
 {
-    return getClassRep()->mFieldList;
+    return getClassRep()->getFieldList();
 }
 
 //-----------------------------------------------------------------------------
 
 inline AbstractClassRep::FieldList& ConsoleObject::getModifiableFieldList()
 {
-    return getClassRep()->mFieldList;
+    return getClassRep()->getFieldList();
 }
 
 //-----------------------------------------------------------------------------
@@ -0,0 +1,73 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#include "console/consoleTypedBinding.h"
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _STRINGSTACK_H_
+#include "string/stringStack.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+const char* ConsoleTypedBinding::getReturnTypeName( void ) const
+{
+    switch( mReturnType )
+    {
+        case ConsoleTypedValue::ValueString:    return "string";
+        case ConsoleTypedValue::ValueInt:       return "int";
+        case ConsoleTypedValue::ValueFloat:     return "float";
+    }
+
+    return "void";
+}
+
+//-----------------------------------------------------------------------------
+
+const char* ConsoleTypedBinding::execute( SimObject* object, S32 argc, const char** argv ) const
+{
+    // Sanity!
+    AssertFatal( argc >= 2 && argc - 2 <= StringStack::MaxArgs, "ConsoleTypedBinding::execute() - Invalid argument count." );
+
+    // Wrap the string arguments.
+    ConsoleTypedValue typedArgv[StringStack::MaxArgs];
+    for ( S32 index = 2; index < argc; ++index )
+        typedArgv[index-2].setString( argv[index] );
+
+    // Call the binding.
+    ConsoleTypedValue ret;
+    ret.setNone();
+    call( object, typedArgv, ret );
+
+    // Finish if a string or nothing was returned.
+    if ( !ret.isNumeric() )
+        return ret.mType == ConsoleTypedValue::ValueString && ret.mString != NULL ? ret.mString : "";
+
+    // Format the number the same way the interpreter would have.
+    char* pReturnBuffer = Con::getReturnBuffer( ConsoleTypedValue::NumericBufferSize );
+    ret.mString = pReturnBuffer;
+    return ret.getString();
+}
@@ -0,0 +1,256 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#ifndef _CONSOLE_TYPED_BINDING_H_
+#define _CONSOLE_TYPED_BINDING_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class SimObject;
+
+//-----------------------------------------------------------------------------
+
+/// A console value passed to or returned from a typed binding.
+///
+/// Arguments the interpreter already holds as numbers are passed as numbers so typed bindings
+/// don't have to parse them back out of strings.  A numeric argument carries a buffer that it
+/// is only formatted into if the binding asks for it as a string.
+struct ConsoleTypedValue
+{
+    enum
+    {
+        ValueNone,
+        ValueString,
+        ValueInt,
+        ValueFloat,
+    };
+
+    enum
+    {
+        NumericBufferSize = 32
+    };
+
+    U32         mType;
+    char*       mString;
+    F64         mNumber;
+
+    inline void setNone( void )                     { mType = ValueNone; mString = NULL; }
+    inline void setString( const char* pString )    { mType = ValueString; mString = const_cast<char*>(pString); }
+    inline void setInt( const S32 value )           { mType = ValueInt; mNumber = (F64)value; }
+    inline void setFloat( const F64 value )         { mType = ValueFloat; mNumber = value; }
+
+    inline bool isNumeric( void ) const             { return mType == ValueInt || mType == ValueFloat; }
+
+    inline S32 getInt( void ) const                 { return isNumeric() ? (S32)mNumber : mType == ValueString ? dAtoi(mString) : 0; }
+    inline F64 getFloat( void ) const               { return isNumeric() ? mNumber : mType == ValueString ? dAtof(mString) : 0.0; }
+    inline bool getBool( void ) const               { return isNumeric() ? mNumber != 0.0 : mType == ValueString ? dAtob(mString) : false; }
+
+    /// Fetch the value as a string, formatting a numeric value into its buffer if needed.
+    const char* getString( void )
+    {
+        // Finish if already a string.
+        if ( mType == ValueString )
+            return mString;
+
+        // Finish if there's no value.
+        if ( mType == ValueNone || mString == NULL )
+            return "";
+
+        // Format the number the same way the interpreter would have.
+        if ( mType == ValueInt )
+            dSprintf( mString, NumericBufferSize, "%d", (S32)mNumber );
+        else
+            dSprintf( mString, NumericBufferSize, "%.9g", mNumber );
+
+        // It's now a string.
+        mType = ValueString;
+        return mString;
+    }
+};
+
+//-----------------------------------------------------------------------------
+
+/// Converts a console value to a typed binding argument.
+/// Specialize this for any other argument types a typed binding should accept.
+template<class T> struct ConsoleTypedArg;
+
+template<class T> struct ConsoleTypedArg<const T&> : public ConsoleTypedArg<T> {};
+template<class T> struct ConsoleTypedArg<const T> : public ConsoleTypedArg<T> {};
+
+template<> struct ConsoleTypedArg<S32>          { static inline S32 get( ConsoleTypedValue& value ) { return value.getInt(); } };
+template<> struct ConsoleTypedArg<U32>          { static inline U32 get( ConsoleTypedValue& value ) { return (U32)value.getInt(); } };
+template<> struct ConsoleTypedArg<F32>          { static inline F32 get( ConsoleTypedValue& value ) { return (F32)value.getFloat(); } };
+template<> struct ConsoleTypedArg<F64>          { static inline F64 get( ConsoleTypedValue& value ) { return value.getFloat(); } };
+template<> struct ConsoleTypedArg<bool>         { static inline bool get( ConsoleTypedValue& value ) { return value.getBool(); } };
+template<> struct ConsoleTypedArg<const char*>  { static inline const char* get( ConsoleTypedValue& value ) { return value.getString(); } };
+
+//-----------------------------------------------------------------------------
+
+/// Converts a typed binding return value to a console value.
+/// Specialize this for any other return types a typed binding should return.
+template<class T> struct ConsoleTypedReturn;
+
+template<class T> struct ConsoleTypedReturn<const T&> : public ConsoleTypedReturn<T> {};
+template<class T> struct ConsoleTypedReturn<const T> : public ConsoleTypedReturn<T> {};
+
+template<> struct ConsoleTypedReturn<void>          { enum { Type = ConsoleTypedValue::ValueNone }; };
+template<> struct ConsoleTypedReturn<S32>           { enum { Type = ConsoleTypedValue::ValueInt };    static inline void set( ConsoleTypedValue& ret, const S32 value ) { ret.setInt( value ); } };
+template<> struct ConsoleTypedReturn<U32>           { enum { Type = ConsoleTypedValue::ValueInt };    static inline void set( ConsoleTypedValue& ret, const U32 value ) { ret.setInt( (S32)value ); } };
+template<> struct ConsoleTypedReturn<bool>          { enum { Type = ConsoleTypedValue::ValueInt };    static inline void set( ConsoleTypedValue& ret, const bool value ) { ret.setInt( value ? 1 : 0 ); } };
+template<> struct ConsoleTypedReturn<F32>           { enum { Type = ConsoleTypedValue::ValueFloat };  static inline void set( ConsoleTypedValue& ret, const F32 value ) { ret.setFloat( value ); } };
+template<> struct ConsoleTypedReturn<F64>           { enum { Type = ConsoleTypedValue::ValueFloat };  static inline void set( ConsoleTypedValue& ret, const F64 value ) { ret.setFloat( value ); } };
+template<> struct ConsoleTypedReturn<const char*>   { enum { Type = ConsoleTypedValue::ValueString }; static inline void set( ConsoleTypedValue& ret, const char* value ) { ret.setString( value ); } };
+
+//-----------------------------------------------------------------------------
+
+/// Calls a typed binding function with arguments converted from console values.
+template<class R> struct ConsoleTypedCaller
+{
+    template<class T>
+    static inline void call( R (*pFunction)(T*), T* object, ConsoleTypedValue*, ConsoleTypedValue& ret )
+    { ConsoleTypedReturn<R>::set( ret, pFunction( object ) ); }
+
+    template<class T, class A1>
+    static inline void call( R (*pFunction)(T*, A1), T* object, ConsoleTypedValue* argv, ConsoleTypedValue& ret )
+    { ConsoleTypedReturn<R>::set( ret, pFunction( object, ConsoleTypedArg<A1>::get(argv[0]) ) ); }
+
+    template<class T, class A1, class A2>
+    static inline void call( R (*pFunction)(T*, A1, A2), T* object, ConsoleTypedValue* argv, ConsoleTypedValue& ret )
+    { ConsoleTypedReturn<R>::set( ret, pFunction( object, ConsoleTypedArg<A1>::get(argv[0]), ConsoleTypedArg<A2>::get(argv[1]) ) ); }
+
+    template<class T, class A1, class A2, class A3>
+    static inline void call( R (*pFunction)(T*, A1, A2, A3), T* object, ConsoleTypedValue* argv, ConsoleTypedValue& ret )
+    { ConsoleTypedReturn<R>::set( ret, pFunction( object, ConsoleTypedArg<A1>::get(argv[0]), ConsoleTypedArg<A2>::get(argv[1]), ConsoleTypedArg<A3>::get(argv[2]) ) ); }
+
+    template<class T, class A1, class A2, class A3, class A4>
+    static inline void call( R (*pFunction)(T*, A1, A2, A3, A4), T* object, ConsoleTypedValue* argv, ConsoleTypedValue& ret )
+    { ConsoleTypedReturn<R>::set( ret, pFunction( object, ConsoleTypedArg<A1>::get(argv[0]), ConsoleTypedArg<A2>::get(argv[1]), ConsoleTypedArg<A3>::get(argv[2]), ConsoleTypedArg<A4>::get(argv[3]) ) ); }
+};
+
+template<> struct ConsoleTypedCaller<void>
+{
+    template<class T>
+    static inline void call( void (*pFunction)(T*), T* object, ConsoleTypedValue*, ConsoleTypedValue& ret )
+    { pFunction( object ); ret.setNone(); }
+
+    template<class T, class A1>
+    static inline void call( void (*pFunction)(T*, A1), T* object, ConsoleTypedValue* argv, ConsoleTypedValue& ret )
+    { pFunction( object, ConsoleTypedArg<A1>::get(argv[0]) ); ret.setNone(); }
+
+    template<class T, class A1, class A2>
+    static inline void call( void (*pFunction)(T*, A1, A2), T* object, ConsoleTypedValue* argv, ConsoleTypedValue& ret )
+    { pFunction( object, ConsoleTypedArg<A1>::get(argv[0]), ConsoleTypedArg<A2>::get(argv[1]) ); ret.setNone(); }
+
+    template<class T, class A1, class A2, class A3>
+    static inline void call( void (*pFunction)(T*, A1, A2, A3), T* object, ConsoleTypedValue* argv, ConsoleTypedValue& ret )
+    { pFunction( object, ConsoleTypedArg<A1>::get(argv[0]), ConsoleTypedArg<A2>::get(argv[1]), ConsoleTypedArg<A3>::get(argv[2]) ); ret.setNone(); }
+
+    template<class T, class A1, class A2, class A3, class A4>
+    static inline void call( void (*pFunction)(T*, A1, A2, A3, A4), T* object, ConsoleTypedValue* argv, ConsoleTypedValue& ret )
+    { pFunction( object, ConsoleTypedArg<A1>::get(argv[0]), ConsoleTypedArg<A2>::get(argv[1]), ConsoleTypedArg<A3>::get(argv[2]), ConsoleTypedArg<A4>::get(argv[3]) ); ret.setNone(); }
+};
+
+//-----------------------------------------------------------------------------
+
+/// A console method whose argument and return types are deduced from its C++ signature.
+///
+/// The interpreter calls typed bindings with the values it already holds rather than with
+/// strings so numeric arguments and return values skip the string round-trip.  Bindings are
+/// created with create() (see the ConsoleTypedMethodWithDocs() macro) and live for the
+/// lifetime of the console.
+class ConsoleTypedBinding
+{
+protected:
+    U32     mArgCount;
+    U32     mReturnType;
+
+    ConsoleTypedBinding( const U32 argCount, const U32 returnType ) : mArgCount( argCount ), mReturnType( returnType ) {}
+
+public:
+    virtual ~ConsoleTypedBinding() {}
+
+    /// The number of arguments excluding the function name and object.
+    inline U32 getArgCount( void ) const { return mArgCount; }
+
+    /// The ConsoleTypedValue type returned.
+    inline U32 getReturnType( void ) const { return mReturnType; }
+    const char* getReturnTypeName( void ) const;
+
+    /// Call the binding.  The arguments start after the function name and object.
+    virtual void call( SimObject* object, ConsoleTypedValue* argv, ConsoleTypedValue& ret ) const = 0;
+
+    /// Call the binding with string arguments (function name and object included) returning a string.
+    const char* execute( SimObject* object, S32 argc, const char** argv ) const;
+
+    template<class R, class T> static ConsoleTypedBinding* create( R (*pFunction)(T*) );
+    template<class R, class T, class A1> static ConsoleTypedBinding* create( R (*pFunction)(T*, A1) );
+    template<class R, class T, class A1, class A2> static ConsoleTypedBinding* create( R (*pFunction)(T*, A1, A2) );
+    template<class R, class T, class A1, class A2, class A3> static ConsoleTypedBinding* create( R (*pFunction)(T*, A1, A2, A3) );
+    template<class R, class T, class A1, class A2, class A3, class A4> static ConsoleTypedBinding* create( R (*pFunction)(T*, A1, A2, A3, A4) );
+};
+
+//-----------------------------------------------------------------------------
+
+template<class F, class R, class T>
+class ConsoleTypedMethodBinding : public ConsoleTypedBinding
+{
+private:
+    F       mpFunction;
+
+public:
+    ConsoleTypedMethodBinding( F pFunction, const U32 argCount ) : ConsoleTypedBinding( argCount, ConsoleTypedReturn<R>::Type ), mpFunction( pFunction ) {}
+
+    virtual void call( SimObject* object, ConsoleTypedValue* argv, ConsoleTypedValue& ret ) const
+    {
+        AssertFatal( dynamic_cast<T*>( object ), "ConsoleTypedMethodBinding::call() - Object is not of the bound type." );
+        ConsoleTypedCaller<R>::call( mpFunction, static_cast<T*>( object ), argv, ret );
+    }
+};
+
+//-----------------------------------------------------------------------------
+
+template<class R, class T>
+ConsoleTypedBinding* ConsoleTypedBinding::create( R (*pFunction)(T*) )
+{ return new ConsoleTypedMethodBinding<R (*)(T*), R, T>( pFunction, 0 ); }
+
+template<class R, class T, class A1>
+ConsoleTypedBinding* ConsoleTypedBinding::create( R (*pFunction)(T*, A1) )
+{ return new ConsoleTypedMethodBinding<R (*)(T*, A1), R, T>( pFunction, 1 ); }
+
+template<class R, class T, class A1, class A2>
+ConsoleTypedBinding* ConsoleTypedBinding::create( R (*pFunction)(T*, A1, A2) )
+{ return new ConsoleTypedMethodBinding<R (*)(T*, A1, A2), R, T>( pFunction, 2 ); }
+
+template<class R, class T, class A1, class A2, class A3>
+ConsoleTypedBinding* ConsoleTypedBinding::create( R (*pFunction)(T*, A1, A2, A3) )
+{ return new ConsoleTypedMethodBinding<R (*)(T*, A1, A2, A3), R, T>( pFunction, 3 ); }
+
+template<class R, class T, class A1, class A2, class A3, class A4>
+ConsoleTypedBinding* ConsoleTypedBinding::create( R (*pFunction)(T*, A1, A2, A3, A4) )
+{ return new ConsoleTypedMethodBinding<R (*)(T*, A1, A2, A3, A4), R, T>( pFunction, 4 ); }
+
+#endif // _CONSOLE_TYPED_BINDING_H_
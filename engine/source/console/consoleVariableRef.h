@@ -0,0 +1,119 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _CONSOLE_VARIABLE_REF_H_
+#define _CONSOLE_VARIABLE_REF_H_
+
+#ifndef _CONSOLE_DICTIONARY_H_
+#include "console/consoleDictionary.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+namespace Con
+{
+   /// Get the name of a global variable as used by the global dictionary (prefixed with '$').
+   StringTableEntry getGlobalVariableName( const char* pName );
+
+   /// Find the global dictionary entry for a variable, if it exists.
+   Dictionary::Entry* lookupGlobalVariable( StringTableEntry name );
+
+   /// A handle to a global console variable for code that reads it often.
+   ///
+   /// Reading a variable with Con::getFloatVariable() and friends inserts the name into
+   /// the string table, looks it up in the global dictionary and parses its string value.
+   /// A VariableRef resolves its dictionary entry once and reads the numeric value the
+   /// entry already holds, so script writes are seen immediately.  The entry is looked
+   /// up again only if global variables have been deleted since it was resolved.
+   ///
+   /// @code
+   /// static Con::VariableRef<F32> sFramePeriod( "fps::framePeriod", 0.0f );
+   /// const F32 framePeriod = sFramePeriod;
+   /// @endcode
+   ///
+   /// Like the Con::get*Variable() functions, the default value is returned if the
+   /// variable does not exist or is an empty string.
+   template< typename T > class VariableRef
+   {
+   public:
+      VariableRef( const char* pName, const T defaultValue ) :
+         mpName( pName ),
+         mName( NULL ),
+         mpEntry( NULL ),
+         mRemoveSequence( 0 ),
+         mDefaultValue( defaultValue )
+      {
+      }
+
+      inline T get( void )
+      {
+         Dictionary::Entry* pEntry = resolve();
+
+         // Use the default if the variable does not exist or is empty.
+         if ( pEntry == NULL || (pEntry->type == Dictionary::Entry::TypeInternalString && pEntry->sval[0] == 0) )
+            return mDefaultValue;
+
+         return getEntryValue( pEntry );
+      }
+
+      inline operator T( void ) { return get(); }
+
+   private:
+      inline Dictionary::Entry* resolve( void )
+      {
+         // Look the entry up if it is unresolved or may have been deleted.
+         if ( mpEntry == NULL || mRemoveSequence != Dictionary::smGlobalRemoveSequence )
+         {
+            if ( mName == NULL )
+               mName = getGlobalVariableName( mpName );
+
+            mpEntry = lookupGlobalVariable( mName );
+            mRemoveSequence = Dictionary::smGlobalRemoveSequence;
+         }
+
+         return mpEntry;
+      }
+
+      static T getEntryValue( Dictionary::Entry* pEntry );
+
+      const char*         mpName;
+      StringTableEntry    mName;
+      Dictionary::Entry*  mpEntry;
+      U32                 mRemoveSequence;
+      T                   mDefaultValue;
+   };
+
+   template<> inline F32 VariableRef<F32>::getEntryValue( Dictionary::Entry* pEntry ) { return pEntry->getFloatValue(); }
+   template<> inline S32 VariableRef<S32>::getEntryValue( Dictionary::Entry* pEntry ) { return (S32)pEntry->getIntValue(); }
+   template<> inline U32 VariableRef<U32>::getEntryValue( Dictionary::Entry* pEntry ) { return pEntry->getIntValue(); }
+
+   template<> inline bool VariableRef<bool>::getEntryValue( Dictionary::Entry* pEntry )
+   {
+      // Strings such as "true" have no numeric value so parse them as booleans.
+      if ( pEntry->type == Dictionary::Entry::TypeInternalString )
+         return dAtob( pEntry->sval );
+
+      return pEntry->getIntValue() != 0;
+   }
+}
+
+#endif // _CONSOLE_VARIABLE_REF_H_
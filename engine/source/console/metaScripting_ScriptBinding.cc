@@ -27,6 +27,7 @@
 #include "io/resource/resourceManager.h"
 #include "io/fileStream.h"
 #include "console/compiler.h"
+#include "platform/threads/threadPool.h"
 
 #if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_OSX)
 #include <ifaddrs.h>
@@ -79,28 +80,14 @@ ConsoleFunctionWithDocs(getDSOPath, ConsoleString, 2, 2, (scriptFileName))
    return filename;
 }
 
-/*! Use the compile function to pre-compile a script file without executing the contents.
-    @param fileName A path to the script to compile.
-    @return Returns 1 if the script compiled without errors and 0 if the file did not compile correctly or if the path is wrong. Also, ff the path is invalid, an error will print to the console.
-    @sa exec
-*/
-ConsoleFunctionWithDocs(compile, ConsoleBool, 2, 2, ( fileName ))
+static void getCompiledScriptName(const char *scriptPath, char *nameBuffer, U32 nameBufferSize)
 {
-   TORQUE_UNUSED( argc );
-   char nameBuffer[512];
-   char* script = NULL;
-   U32 scriptSize = 0;
-
-   FileTime comModifyTime, scrModifyTime;
-
-   Con::expandPath(pathBuffer, sizeof(pathBuffer), argv[1]);
-
    // Figure out where to put DSOs
-   StringTableEntry dsoPath = getDSOPath(pathBuffer);
+   StringTableEntry dsoPath = getDSOPath(scriptPath);
 
    // If the script file extention is '.ed.cs' then compile it to a different compiled extention
    bool isEditorScript = false;
-   const char *ext = dStrrchr( pathBuffer, '.' );
+   const char *ext = dStrrchr( scriptPath, '.' );
    if( ext && ( dStricmp( ext, ".cs" ) == 0 ) )
    {
       const char* ext2 = ext - 3;
@@ -114,73 +101,169 @@ ConsoleFunctionWithDocs(compile, ConsoleBool, 2, 2, ( fileName ))
          isEditorScript = true;
    }
 
-   const char *filenameOnly = dStrrchr(pathBuffer, '/');
+   const char *filenameOnly = dStrrchr(scriptPath, '/');
    if(filenameOnly)
       ++filenameOnly;
    else
-      filenameOnly = pathBuffer;
+      filenameOnly = scriptPath;
 
    if( isEditorScript )
-      dStrcpyl(nameBuffer, sizeof(nameBuffer), dsoPath, "/", filenameOnly, ".edso", NULL);
+      dStrcpyl(nameBuffer, nameBufferSize, dsoPath, "/", filenameOnly, ".edso", NULL);
    else
-      dStrcpyl(nameBuffer, sizeof(nameBuffer), dsoPath, "/", filenameOnly, ".dso", NULL);
-   
-   ResourceObject *rScr = ResourceManager->find(pathBuffer);
-   ResourceObject *rCom = ResourceManager->find(nameBuffer);
-
-   if(rCom)
-      rCom->getFileTimes(NULL, &comModifyTime);
-   if(rScr)
-      rScr->getFileTimes(NULL, &scrModifyTime);
-
-   Stream *s = ResourceManager->openStream(pathBuffer);
-   if(s)
-   {
-      scriptSize = ResourceManager->getSize(pathBuffer);
-      script = new char [scriptSize+1];
-      s->read(scriptSize, script);
-      ResourceManager->closeStream(s);
-      script[scriptSize] = 0;
-   }
+      dStrcpyl(nameBuffer, nameBufferSize, dsoPath, "/", filenameOnly, ".dso", NULL);
+}
 
+static bool compileScript(const char *scriptPath, const char *script, U32 scriptSize)
+{
    if (!scriptSize || !script)
    {
-      delete [] script;
-      Con::errorf(ConsoleLogEntry::Script, "compile: invalid script file %s.", pathBuffer);
+      Con::errorf(ConsoleLogEntry::Script, "compile: invalid script file %s.", scriptPath);
       return false;
    }
+
+   char nameBuffer[512];
+   getCompiledScriptName(scriptPath, nameBuffer, sizeof(nameBuffer));
+
    // compile this baddie.
 // -Mat reducing console noise
 #if defined(TORQUE_DEBUG)
-   Con::printf("Compiling %s...", pathBuffer);
+   Con::printf("Compiling %s...", scriptPath);
 #endif
    CodeBlock *code = new CodeBlock();
-   code->compile(nameBuffer, pathBuffer, script);
+   code->compile(nameBuffer, StringTable->insert(scriptPath), script);
    delete code;
    code = NULL;
 
-   delete[] script;
    return true;
 }
 
-/*! 
+/*! Use the compile function to pre-compile a script file without executing the contents.
+    @param fileName A path to the script to compile.
+    @return Returns 1 if the script compiled without errors and 0 if the file did not compile correctly or if the path is wrong. Also, ff the path is invalid, an error will print to the console.
+    @sa exec
+*/
+ConsoleFunctionWithDocs(compile, ConsoleBool, 2, 2, ( fileName ))
+{
+   TORQUE_UNUSED( argc );
+   char* script = NULL;
+   U32 scriptSize = 0;
+
+   Con::expandPath(pathBuffer, sizeof(pathBuffer), argv[1]);
+
+   Stream *s = ResourceManager->openStream(pathBuffer);
+   if(s)
+   {
+      scriptSize = ResourceManager->getSize(pathBuffer);
+      script = new char [scriptSize+1];
+      s->read(scriptSize, script);
+      ResourceManager->closeStream(s);
+      script[scriptSize] = 0;
+   }
+
+   const bool compiled = compileScript(pathBuffer, script, scriptSize);
+   delete[] script;
+   return compiled;
+}
+
+//-----------------------------------------------------------------------------
+
+/// A script being loaded by compilePath().
+struct ScriptLoad
+{
+   StringTableEntry  scriptPath;
+   char              diskPath[1024];
+   bool              onDisk;
+   char*             script;
+   U32               scriptSize;
+};
+
+static void loadScriptRange( void* pContext, const U32 start, const U32 end )
+{
+   ScriptLoad* pLoads = static_cast<ScriptLoad*>( pContext );
+
+   for( U32 index = start; index < end; ++index )
+   {
+      ScriptLoad& load = pLoads[index];
+
+      // Scripts in zips are loaded on the main thread.
+      if ( !load.onDisk )
+         continue;
+
+      File file;
+      if ( file.open( load.diskPath, File::Read ) != File::Ok )
+         continue;
+
+      const U32 size = file.getSize();
+      char* pScript = new char[size + 1];
+      U32 bytesRead = 0;
+      if ( file.read( size, pScript, &bytesRead ) == File::IOError || bytesRead != size )
+      {
+         delete [] pScript;
+         continue;
+      }
+      pScript[size] = 0;
+
+      load.script = pScript;
+      load.scriptSize = size;
+   }
+}
+
+/*! Compiles all the scripts matching a path pattern without executing them.
+    The scripts are loaded from disk in parallel and then compiled in turn.
+    @param path The path pattern of the scripts to compile.
+    @return Returns the number of scripts that failed to compile and the total number of scripts.
 */
 ConsoleFunctionWithDocs(compilePath, ConsoleString, 2, 2, ( path ))
 {
     if ( !Con::expandPath(pathBuffer, sizeof(pathBuffer), argv[1]) )
         return "-1 0";
     
-    const char *compileArgs[2] = { "compile", NULL };
-    
+    // Gather the scripts.
+    Vector<ScriptLoad> loads;
+    const char *scriptPath = NULL;
+    ResourceObject *match = NULL;
+    while ( (match = ResourceManager->findMatch( pathBuffer, &scriptPath, match )) )
+    {
+        loads.increment();
+        ScriptLoad& load = loads.last();
+        load.scriptPath = StringTable->insert( scriptPath );
+        load.onDisk = (match->flags & ResourceObject::File) != 0;
+        load.script = NULL;
+        load.scriptSize = 0;
+        if ( load.onDisk )
+            Platform::makeFullPathName( match->name, load.diskPath, sizeof(load.diskPath), match->path );
+    }
+
+    // Load the scripts in parallel.  The compiler isn't re-entrant so they're compiled serially.
+    if ( loads.size() > 1 )
+        ThreadPool::getGlobal()->parallelFor( loadScriptRange, loads.address(), (U32)loads.size(), 1 );
+    else
+        loadScriptRange( loads.address(), 0, (U32)loads.size() );
+
     S32 failedScripts = 0;
     S32 totalScripts = 0;
-    ResourceObject *match = NULL;
-    
-    while ( (match = ResourceManager->findMatch( pathBuffer, &compileArgs[1], match )) )
+    for ( S32 index = 0; index < loads.size(); ++index )
     {
-        if ( !ccompile( NULL, 1, compileArgs ) )
+        ScriptLoad& load = loads[index];
+
+        // Load anything the workers couldn't.
+        if ( !load.script )
+        {
+            Stream *s = ResourceManager->openStream( load.scriptPath );
+            if ( s )
+            {
+                load.scriptSize = ResourceManager->getSize( load.scriptPath );
+                load.script = new char[load.scriptSize + 1];
+                s->read( load.scriptSize, load.script );
+                ResourceManager->closeStream( s );
+                load.script[load.scriptSize] = 0;
+            }
+        }
+
+        if ( !compileScript( load.scriptPath, load.script, load.scriptSize ) )
             failedScripts++;
-        
+
+        delete [] load.script;
         totalScripts++;
     }
     
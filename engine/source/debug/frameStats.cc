@@ -0,0 +1,223 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "debug/frameStats.h"
+#include "console/console.h"
+#include "platform/platformMemory.h"
+#include "math/mMathFn.h"
+
+#include "Box2D/Common/b2Timer.h"
+
+#include "frameStats_ScriptBinding.h"
+
+//-----------------------------------------------------------------------------
+
+F32 FrameStats::smCurrent[FrameStats::StatCount];
+F32 FrameStats::smFrames[FrameStats::FrameCapacity][FrameStats::StatCount];
+U32 FrameStats::smFrameIndex = 0;
+U32 FrameStats::smFrameTotal = 0;
+U64 FrameStats::smLastAllocations = 0;
+
+static b2Timer sFrameTimer;
+
+static const char* sStatNames[FrameStats::StatCount] =
+{
+   "frameTime",
+   "simTime",
+   "renderTime",
+   "drawCalls",
+   "batchFlushes",
+   "triangles",
+   "tickedObjects",
+   "contacts",
+   "particles",
+   "allocations",
+   "gpuTime",
+   "gpuSceneTime",
+   "gpuBatchTime",
+};
+
+//-----------------------------------------------------------------------------
+
+static U64 getTotalAllocations( void )
+{
+   U64 totalAllocations = 0;
+   for ( S32 tag = 0; tag < Memory::TagCount; ++tag )
+   {
+      Memory::TagStats stats;
+      Memory::getTagStats( (Memory::Tag)tag, stats );
+      totalAllocations += stats.totalAllocations;
+   }
+   return totalAllocations;
+}
+
+static S32 QSORT_CALLBACK compareSamples( const void* a, const void* b )
+{
+   const F32 sampleA = *(const F32*)a;
+   const F32 sampleB = *(const F32*)b;
+   return sampleA < sampleB ? -1 : sampleA > sampleB ? 1 : 0;
+}
+
+//-----------------------------------------------------------------------------
+
+void FrameStats::beginFrame( void )
+{
+   sFrameTimer.Reset();
+}
+
+//-----------------------------------------------------------------------------
+
+void FrameStats::endFrame( void )
+{
+   // Finish the frame.
+   smCurrent[StatFrameTime] = sFrameTimer.GetMilliseconds();
+
+   const U64 totalAllocations = getTotalAllocations();
+   smCurrent[StatAllocations] = smLastAllocations == 0 ? 0.0f : (F32)(totalAllocations - smLastAllocations);
+   smLastAllocations = totalAllocations;
+
+   // Commit it to the ring.
+   dMemcpy( smFrames[smFrameIndex], smCurrent, sizeof(smCurrent) );
+   smFrameIndex = (smFrameIndex + 1) % FrameCapacity;
+   if ( smFrameTotal < FrameCapacity ) smFrameTotal++;
+
+   // Start the next frame.
+   dMemset( smCurrent, 0, sizeof(smCurrent) );
+}
+
+//-----------------------------------------------------------------------------
+
+void FrameStats::reset( void )
+{
+   smFrameIndex = 0;
+   smFrameTotal = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+F32 FrameStats::getLast( const Stat stat )
+{
+   AssertFatal( stat >= 0 && stat < StatCount, "FrameStats::getLast() - Invalid statistic." );
+
+   if ( smFrameTotal == 0 )
+      return 0.0f;
+
+   return smFrames[(smFrameIndex + FrameCapacity - 1) % FrameCapacity][stat];
+}
+
+//-----------------------------------------------------------------------------
+
+F32 FrameStats::getAverage( const Stat stat )
+{
+   AssertFatal( stat >= 0 && stat < StatCount, "FrameStats::getAverage() - Invalid statistic." );
+
+   if ( smFrameTotal == 0 )
+      return 0.0f;
+
+   F64 total = 0.0;
+   for ( U32 frame = 0; frame < smFrameTotal; ++frame )
+      total += smFrames[frame][stat];
+
+   return (F32)(total / smFrameTotal);
+}
+
+//-----------------------------------------------------------------------------
+
+F32 FrameStats::getPercentile( const Stat stat, const F32 percentile )
+{
+   AssertFatal( stat >= 0 && stat < StatCount, "FrameStats::getPercentile() - Invalid statistic." );
+
+   // Finish if no frames.
+   if ( smFrameTotal == 0 )
+      return 0.0f;
+
+   // Sort a copy of the samples.
+   F32 sortedSamples[FrameCapacity];
+   for ( U32 frame = 0; frame < smFrameTotal; ++frame )
+      sortedSamples[frame] = smFrames[frame][stat];
+   dQsort( sortedSamples, smFrameTotal, sizeof(F32), compareSamples );
+
+   // Fetch the nearest-rank sample.
+   const F32 clampedPercentile = percentile < 0.0f ? 0.0f : percentile > 100.0f ? 100.0f : percentile;
+   const U32 rank = (U32)mCeil( (clampedPercentile / 100.0f) * smFrameTotal );
+   return sortedSamples[ rank == 0 ? 0 : rank - 1 ];
+}
+
+//-----------------------------------------------------------------------------
+
+const char* FrameStats::getStatName( const Stat stat )
+{
+   if ( stat < 0 || stat >= StatCount )
+      return "";
+
+   return sStatNames[stat];
+}
+
+//-----------------------------------------------------------------------------
+
+FrameStats::Stat FrameStats::getStatFromName( const char* pName )
+{
+   for ( S32 stat = 0; stat < StatCount; ++stat )
+   {
+      if ( dStricmp( sStatNames[stat], pName ) == 0 )
+         return (Stat)stat;
+   }
+
+   return StatInvalid;
+}
+
+//-----------------------------------------------------------------------------
+
+void FrameStats::formatSummary( char* pBuffer, const U32 bufferSize )
+{
+   AssertFatal( bufferSize > 0, "FrameStats::formatSummary() - Invalid buffer size." );
+
+   // Each statistic is written as "name=median/p95/max".
+   dSprintf( pBuffer, bufferSize, "FrameStats frames=%d", smFrameTotal );
+   for ( S32 stat = 0; stat < StatCount; ++stat )
+   {
+      const U32 length = dStrlen( pBuffer );
+      dSprintf( pBuffer + length, bufferSize - length, " %s=%.2f/%.2f/%.2f",
+         sStatNames[stat],
+         getPercentile( (Stat)stat, 50.0f ),
+         getPercentile( (Stat)stat, 95.0f ),
+         getPercentile( (Stat)stat, 100.0f ) );
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+void FrameStats::dumpToConsole( void )
+{
+   Con::printf( "Frame Stats over %d frames:", smFrameTotal );
+   Con::printf( "  %-16s %10s %10s %10s %10s %10s", "Stat", "Average", "Median", "95%", "99%", "Max" );
+   for ( S32 stat = 0; stat < StatCount; ++stat )
+   {
+      Con::printf( "  %-16s %10.2f %10.2f %10.2f %10.2f %10.2f",
+         sStatNames[stat],
+         getAverage( (Stat)stat ),
+         getPercentile( (Stat)stat, 50.0f ),
+         getPercentile( (Stat)stat, 95.0f ),
+         getPercentile( (Stat)stat, 99.0f ),
+         getPercentile( (Stat)stat, 100.0f ) );
+   }
+}
@@ -0,0 +1,120 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _FRAME_STATS_H_
+#define _FRAME_STATS_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+/// FrameStats keeps a handful of cheap measurements for each of the most recent frames.
+///
+/// Unlike the profiler, it is always on (including shipping builds) so that percentiles
+/// of the frame, simulation and render times can be queried at any time.  Subsystems add
+/// their counts to the current frame as they go and the frame is committed to a ring of
+/// the most recent frames when it ends.
+///
+/// Examples of script use:
+/// @code
+/// getFrameStat("frameTime", 95);      // 95th percentile of the recent frame times
+/// getFrameStat("drawCalls");          // draw calls in the last frame
+/// getFrameStats(99);                  // 99th percentile of every statistic
+/// dumpFrameStats();                   // dump the recent statistics to the console
+/// telnetStreamFrameStats(1000);       // send a summary to telnet clients every second
+/// @endcode
+class FrameStats
+{
+public:
+   /// Statistics recorded for each frame.
+   enum Stat
+   {
+      StatInvalid = -1,
+
+      StatFrameTime,       ///< Milliseconds spent working on the frame (excluding any pacing sleep).
+      StatSimTime,         ///< Milliseconds spent advancing the simulation.
+      StatRenderTime,      ///< Milliseconds spent rendering.
+      StatDrawCalls,       ///< Batched draw calls.
+      StatBatchFlushes,    ///< Batch flushes.
+      StatTriangles,       ///< Batched triangles drawn.
+      StatTickedObjects,   ///< Scene objects ticked (over all the ticks and scenes of the frame).
+      StatContacts,        ///< Physics contacts (over all the ticks and scenes of the frame).
+      StatParticles,       ///< Particles active at the end of the frame.
+      StatAllocations,     ///< Engine allocations made during the frame.
+      StatGpuTime,         ///< GPU milliseconds of a recent canvas render (see GpuTimer).
+      StatGpuSceneTime,    ///< GPU milliseconds of the scenes in a recent canvas render.
+      StatGpuBatchTime,    ///< GPU milliseconds of the batch flushes in a recent canvas render.
+
+      StatCount
+   };
+
+   enum
+   {
+      FrameCapacity = 256
+   };
+
+   /// Add to a statistic of the current frame.
+   static inline void addCount( const Stat stat, const U32 count ) { smCurrent[stat] += (F32)count; }
+   static inline void addTime( const Stat stat, const F32 milliseconds ) { smCurrent[stat] += milliseconds; }
+
+   /// Set a statistic of the current frame.
+   static inline void setValue( const Stat stat, const F32 value ) { smCurrent[stat] = value; }
+
+   /// Start timing a frame.  Called once at the start of every frame.
+   static void beginFrame( void );
+
+   /// Commit the current frame to the ring.  Called once at the end of every frame.
+   static void endFrame( void );
+
+   /// Discard the recorded frames.
+   static void reset( void );
+
+   /// The number of frames recorded (up to the capacity).
+   static U32 getFrameCount( void ) { return smFrameTotal; }
+
+   /// Fetch a statistic of the most recent frame.
+   static F32 getLast( const Stat stat );
+
+   /// Fetch the average of a statistic over the recorded frames.
+   static F32 getAverage( const Stat stat );
+
+   /// Fetch the percentile (0 to 100) of a statistic over the recorded frames.
+   static F32 getPercentile( const Stat stat, const F32 percentile );
+
+   static const char* getStatName( const Stat stat );
+   static Stat getStatFromName( const char* pName );
+
+   /// Format a single line summarizing the median, 95th percentile and maximum of each statistic.
+   static void formatSummary( char* pBuffer, const U32 bufferSize );
+
+   /// Dump the average, percentiles and maximum of each statistic to the console.
+   static void dumpToConsole( void );
+
+private:
+   static F32 smCurrent[StatCount];
+   static F32 smFrames[FrameCapacity][StatCount];
+   static U32 smFrameIndex;
+   static U32 smFrameTotal;
+   static U64 smLastAllocations;
+};
+
+#endif // _FRAME_STATS_H_
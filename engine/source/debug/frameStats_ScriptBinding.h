@@ -0,0 +1,92 @@
+﻿//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+ConsoleFunctionGroupBegin( FrameStats, "Frame statistics functionality.");
+
+/*! @defgroup FrameStatsFunctions Frame Stats
+	@ingroup TorqueScriptFunctions
+	@{
+*/
+
+/*! Gets a statistic over the recent frames.
+    @param stat The statistic, one of: frameTime, simTime, renderTime, drawCalls, batchFlushes, triangles, tickedObjects, contacts, particles, allocations, gpuTime, gpuSceneTime or gpuBatchTime.
+    @param percentile The percentile (0 to 100) of the statistic over the recent frames (optional, the last frame is used if not specified).
+    @return The statistic.
+*/
+ConsoleFunctionWithDocs(getFrameStat, ConsoleFloat, 2, 3, (stat, [percentile]))
+{
+   const FrameStats::Stat stat = FrameStats::getStatFromName( argv[1] );
+   if ( stat == FrameStats::StatInvalid )
+   {
+      Con::warnf( "getFrameStat() - Unknown statistic '%s'.", argv[1] );
+      return 0.0f;
+   }
+
+   return argc > 2 ? FrameStats::getPercentile( stat, dAtof(argv[2]) ) : FrameStats::getLast( stat );
+}
+
+/*! Gets the percentile of every statistic over the recent frames.
+    @param percentile The percentile (0 to 100) over the recent frames (optional, defaults to 50).
+    @return The statistics, space separated, in the order: frameTime, simTime, renderTime, drawCalls, batchFlushes, triangles, tickedObjects, contacts, particles, allocations, gpuTime, gpuSceneTime and gpuBatchTime.
+*/
+ConsoleFunctionWithDocs(getFrameStats, ConsoleString, 1, 2, ([percentile]))
+{
+   const F32 percentile = argc > 1 ? dAtof(argv[1]) : 50.0f;
+
+   char* pBuffer = Con::getReturnBuffer( 512 );
+   pBuffer[0] = 0;
+   for ( S32 stat = 0; stat < FrameStats::StatCount; ++stat )
+   {
+      const U32 length = dStrlen( pBuffer );
+      dSprintf( pBuffer + length, 512 - length, stat == 0 ? "%g" : " %g", FrameStats::getPercentile( (FrameStats::Stat)stat, percentile ) );
+   }
+
+   return pBuffer;
+}
+
+/*! Gets the number of frames the statistics are gathered over.
+    @return The number of recent frames recorded.
+*/
+ConsoleFunctionWithDocs(getFrameStatsCount, ConsoleInt, 1, 1, ())
+{
+   return FrameStats::getFrameCount();
+}
+
+/*! Discards the recorded frame statistics.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(resetFrameStats, ConsoleVoid, 1, 1, ())
+{
+   FrameStats::reset();
+}
+
+/*! Dumps the average, percentiles and maximum of each statistic over the recent frames to the console.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(dumpFrameStats, ConsoleVoid, 1, 1, ())
+{
+   FrameStats::dumpToConsole();
+}
+
+ConsoleFunctionGroupEnd( FrameStats );
+
+/*! @} */ // group FrameStatsFunctions
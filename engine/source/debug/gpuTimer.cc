@@ -0,0 +1,303 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "debug/gpuTimer.h"
+#include "debug/frameStats.h"
+#include "console/console.h"
+
+#ifdef GPUTIMER_QUERIES
+#include "platform/platformGL.h"
+#endif
+
+#include "gpuTimer_ScriptBinding.h"
+
+//-----------------------------------------------------------------------------
+
+const char* const GpuTimer::SectionGui = "gui";
+const char* const GpuTimer::SectionScene = "scene";
+const char* const GpuTimer::SectionBatchFlush = "batchFlush";
+
+bool GpuTimer::smEnabled = false;
+F32 GpuTimer::smFrameTime = 0.0f;
+U32 GpuTimer::smResultCount = 0;
+const char* GpuTimer::smResultNames[GpuTimer::MaxResults];
+F32 GpuTimer::smResultTimes[GpuTimer::MaxResults];
+
+#ifdef GPUTIMER_QUERIES
+
+// A timed section of a frame.
+struct GpuTimerSection
+{
+   const char* mpName;
+   U32 mBeginTimestamp;
+   U32 mEndTimestamp;
+};
+
+// The queries and sections of a timed frame.
+struct GpuTimerFrame
+{
+   GLuint mQueries[GpuTimer::MaxTimestamps];
+   GpuTimerSection mSections[GpuTimer::MaxTimestamps / 2];
+   U32 mTimestampCount;
+   U32 mSectionCount;
+   bool mPending;
+};
+
+static GpuTimerFrame sFrames[GpuTimer::FrameLatency];
+static U32 sFrameSlot = 0;
+static U32 sReservedTimestamps = 0;
+static bool sTimingFrame = false;
+static bool sQueriesCreated = false;
+
+//-----------------------------------------------------------------------------
+
+static void issueTimestamp( GpuTimerFrame& frame )
+{
+   glQueryCounter( frame.mQueries[frame.mTimestampCount++], GL_TIMESTAMP );
+}
+
+#endif // GPUTIMER_QUERIES
+
+//-----------------------------------------------------------------------------
+
+bool GpuTimer::isSupported( void )
+{
+#ifdef GPUTIMER_QUERIES
+   return dglDoesSupportARBTimerQuery();
+#else
+   return false;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+void GpuTimer::setEnabled( const bool enabled )
+{
+   if ( enabled == smEnabled )
+      return;
+
+   smEnabled = enabled && isSupported();
+
+   // Forget the last results.
+   smFrameTime = 0.0f;
+   smResultCount = 0;
+
+#ifdef GPUTIMER_QUERIES
+   sTimingFrame = false;
+   sReservedTimestamps = 0;
+
+   for ( U32 slot = 0; slot < FrameLatency; ++slot )
+   {
+      sFrames[slot].mTimestampCount = 0;
+      sFrames[slot].mSectionCount = 0;
+      sFrames[slot].mPending = false;
+   }
+
+   if ( smEnabled && !sQueriesCreated )
+   {
+      for ( U32 slot = 0; slot < FrameLatency; ++slot )
+         glGenQueries( MaxTimestamps, sFrames[slot].mQueries );
+
+      sQueriesCreated = true;
+   }
+   else if ( !smEnabled && sQueriesCreated )
+   {
+      for ( U32 slot = 0; slot < FrameLatency; ++slot )
+         glDeleteQueries( MaxTimestamps, sFrames[slot].mQueries );
+
+      sQueriesCreated = false;
+   }
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+void GpuTimer::beginFrame( void )
+{
+#ifdef GPUTIMER_QUERIES
+   if ( !smEnabled )
+      return;
+
+   GpuTimerFrame& frame = sFrames[sFrameSlot];
+
+   // Collect the frame that last used this slot if the GPU has finished with it.
+   if ( frame.mPending )
+   {
+      GLuint available = 0;
+      glGetQueryObjectuiv( frame.mQueries[frame.mTimestampCount-1], GL_QUERY_RESULT_AVAILABLE, &available );
+
+      // Don't time this frame rather than wait for the GPU.
+      if ( available == 0 )
+         return;
+
+      resolveFrame( sFrameSlot );
+   }
+
+   frame.mTimestampCount = 0;
+   frame.mSectionCount = 0;
+
+   // Reserve the timestamp that ends the frame.
+   sReservedTimestamps = 1;
+   sTimingFrame = true;
+
+   issueTimestamp( frame );
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+void GpuTimer::endFrame( void )
+{
+#ifdef GPUTIMER_QUERIES
+   if ( !sTimingFrame )
+      return;
+
+   GpuTimerFrame& frame = sFrames[sFrameSlot];
+   issueTimestamp( frame );
+   frame.mPending = true;
+
+   sTimingFrame = false;
+   sReservedTimestamps = 0;
+   sFrameSlot = (sFrameSlot + 1) % FrameLatency;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+S32 GpuTimer::beginSection( const char* pName )
+{
+#ifdef GPUTIMER_QUERIES
+   if ( !sTimingFrame )
+      return -1;
+
+   GpuTimerFrame& frame = sFrames[sFrameSlot];
+
+   // Don't time the section if its timestamps would leave no room for those already reserved.
+   if ( frame.mTimestampCount + sReservedTimestamps + 2 > MaxTimestamps )
+      return -1;
+
+   const U32 section = frame.mSectionCount++;
+   frame.mSections[section].mpName = pName;
+   frame.mSections[section].mBeginTimestamp = frame.mTimestampCount;
+   frame.mSections[section].mEndTimestamp = frame.mTimestampCount;
+
+   // Reserve the timestamp that ends the section.
+   sReservedTimestamps++;
+
+   issueTimestamp( frame );
+
+   return (S32)section;
+#else
+   return -1;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+void GpuTimer::endSection( const S32 section )
+{
+#ifdef GPUTIMER_QUERIES
+   if ( !sTimingFrame )
+      return;
+
+   GpuTimerFrame& frame = sFrames[sFrameSlot];
+
+   AssertFatal( section >= 0 && (U32)section < frame.mSectionCount, "GpuTimer::endSection() - Invalid section." );
+
+   frame.mSections[section].mEndTimestamp = frame.mTimestampCount;
+   sReservedTimestamps--;
+
+   issueTimestamp( frame );
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+const char* GpuTimer::getResultName( const U32 index )
+{
+   return index < smResultCount ? smResultNames[index] : "";
+}
+
+//-----------------------------------------------------------------------------
+
+F32 GpuTimer::getResultTime( const U32 index )
+{
+   return index < smResultCount ? smResultTimes[index] : 0.0f;
+}
+
+//-----------------------------------------------------------------------------
+
+F32 GpuTimer::getResultTime( const char* pName )
+{
+   for ( U32 index = 0; index < smResultCount; ++index )
+   {
+      if ( dStricmp( smResultNames[index], pName ) == 0 )
+         return smResultTimes[index];
+   }
+
+   return 0.0f;
+}
+
+//-----------------------------------------------------------------------------
+
+void GpuTimer::resolveFrame( const U32 frameSlot )
+{
+#ifdef GPUTIMER_QUERIES
+   GpuTimerFrame& frame = sFrames[frameSlot];
+   frame.mPending = false;
+
+   GLuint64 timestamps[MaxTimestamps];
+   for ( U32 index = 0; index < frame.mTimestampCount; ++index )
+      glGetQueryObjectui64v( frame.mQueries[index], GL_QUERY_RESULT, &timestamps[index] );
+
+   // Timestamps are in nanoseconds.
+   smFrameTime = (F32)(timestamps[frame.mTimestampCount-1] - timestamps[0]) / 1000000.0f;
+
+   // Sum the sections by name.
+   smResultCount = 0;
+   for ( U32 section = 0; section < frame.mSectionCount; ++section )
+   {
+      const GpuTimerSection& record = frame.mSections[section];
+      const F32 time = (F32)(timestamps[record.mEndTimestamp] - timestamps[record.mBeginTimestamp]) / 1000000.0f;
+
+      U32 index = 0;
+      while ( index < smResultCount && smResultNames[index] != record.mpName && dStrcmp( smResultNames[index], record.mpName ) != 0 )
+         ++index;
+
+      if ( index == smResultCount )
+      {
+         if ( smResultCount == MaxResults )
+            continue;
+
+         smResultNames[index] = record.mpName;
+         smResultTimes[index] = 0.0f;
+         smResultCount++;
+      }
+
+      smResultTimes[index] += time;
+   }
+
+   FrameStats::addTime( FrameStats::StatGpuTime, smFrameTime );
+   FrameStats::addTime( FrameStats::StatGpuSceneTime, getResultTime( SectionScene ) );
+   FrameStats::addTime( FrameStats::StatGpuBatchTime, getResultTime( SectionBatchFlush ) );
+#endif
+}
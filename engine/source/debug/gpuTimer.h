@@ -0,0 +1,121 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _GPU_TIMER_H_
+#define _GPU_TIMER_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+// Timer queries need ARB_timer_query which only the Win32 and Linux GL loaders expose.
+#if defined(TORQUE_OS_WIN32) || defined(TORQUE_OS_LINUX)
+#define GPUTIMER_QUERIES
+#endif
+
+/// GpuTimer measures how long the GPU spends on sections of the canvas render.
+///
+/// A GL timestamp query is issued at the start and end of each section and the results are
+/// read back a few frames later, once the GPU has finished with them, so timing never stalls
+/// the pipeline (a frame is simply not timed if an old frame is still outstanding).  Sections
+/// may nest and sections with the same name are summed over the frame, so the cost of every
+/// scene layer is reported along with the cost of all the batch flushes within them.
+///
+/// The latest results are added to the frame stats and shown in the scene metrics overlay.
+/// Timing is off by default and does nothing where timer queries are unsupported.
+///
+/// Examples of script use:
+/// @code
+/// setGpuTimingEnabled(true);
+/// getGpuTime();                   // GPU milliseconds of the last timed frame
+/// getGpuTime("layer5");           // GPU milliseconds of scene layer 5
+/// getGpuTimes();                  // every section with its GPU milliseconds
+/// @endcode
+class GpuTimer
+{
+public:
+   enum
+   {
+      FrameLatency   = 4,      ///< Frames of results that can be outstanding.
+      MaxTimestamps  = 1024,   ///< Timestamps per frame, sections beyond this are not timed.
+      MaxResults     = 64      ///< Distinct section names reported per frame.
+   };
+
+   /// Names of the sections the engine times.
+   static const char* const SectionGui;
+   static const char* const SectionScene;
+   static const char* const SectionBatchFlush;
+
+   static bool isSupported( void );
+
+   static void setEnabled( const bool enabled );
+   static inline bool getEnabled( void ) { return smEnabled; }
+
+   /// Start and finish timing a frame.  Results that have arrived are collected when a frame starts.
+   static void beginFrame( void );
+   static void endFrame( void );
+
+   /// Start and finish timing a section of the current frame.
+   /// The name is not copied so must be a literal or a StringTableEntry.
+   /// @return The section handle to finish or -1 if the section is not timed.
+   static S32 beginSection( const char* pName );
+   static void endSection( const S32 section );
+
+   /// Fetch the results of the last timed frame.
+   static inline F32 getFrameTime( void ) { return smFrameTime; }
+   static inline U32 getResultCount( void ) { return smResultCount; }
+   static const char* getResultName( const U32 index );
+   static F32 getResultTime( const U32 index );
+   static F32 getResultTime( const char* pName );
+
+private:
+   static void resolveFrame( const U32 frameSlot );
+
+   static bool smEnabled;
+   static F32 smFrameTime;
+   static U32 smResultCount;
+   static const char* smResultNames[MaxResults];
+   static F32 smResultTimes[MaxResults];
+};
+
+//-----------------------------------------------------------------------------
+
+/// Times the GPU cost of a scope if GPU timing is enabled.  A NULL name times nothing.
+class GpuTimerScope
+{
+public:
+   GpuTimerScope( const char* pName ) :
+      mSection( pName != NULL && GpuTimer::getEnabled() ? GpuTimer::beginSection( pName ) : -1 )
+   {
+   }
+
+   ~GpuTimerScope()
+   {
+      if ( mSection >= 0 )
+         GpuTimer::endSection( mSection );
+   }
+
+private:
+   S32 mSection;
+};
+
+#endif // _GPU_TIMER_H_
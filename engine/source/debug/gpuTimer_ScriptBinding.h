@@ -0,0 +1,91 @@
+﻿//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+ConsoleFunctionGroupBegin( GpuTimer, "GPU timing functionality.");
+
+/*! @defgroup GpuTimerFunctions GPU Timer
+	@ingroup TorqueScriptFunctions
+	@{
+*/
+
+/*! Sets whether the GPU cost of rendering is timed.
+    Results arrive a few frames after timing is enabled.
+    @param enabled Whether to time the GPU cost of rendering.
+    @return Whether GPU timing is enabled (it cannot be where it is unsupported).
+*/
+ConsoleFunctionWithDocs(setGpuTimingEnabled, ConsoleBool, 2, 2, (bool enabled))
+{
+   GpuTimer::setEnabled( dAtob(argv[1]) );
+
+   if ( dAtob(argv[1]) && !GpuTimer::getEnabled() )
+      Con::warnf( "setGpuTimingEnabled() - GPU timing is not supported." );
+
+   return GpuTimer::getEnabled();
+}
+
+/*! Gets whether the GPU cost of rendering is timed.
+    @return Whether GPU timing is enabled.
+*/
+ConsoleFunctionWithDocs(getGpuTimingEnabled, ConsoleBool, 1, 1, ())
+{
+   return GpuTimer::getEnabled();
+}
+
+/*! Gets whether GPU timing is supported.
+    @return Whether GPU timing is supported.
+*/
+ConsoleFunctionWithDocs(isGpuTimingSupported, ConsoleBool, 1, 1, ())
+{
+   return GpuTimer::isSupported();
+}
+
+/*! Gets the GPU time of the last timed frame.
+    @param section The section, for example gui, scene, batchFlush or layer0 to layer31 (optional, the whole frame is used if not specified).
+    @return The GPU milliseconds of the section or frame.
+*/
+ConsoleFunctionWithDocs(getGpuTime, ConsoleFloat, 1, 2, ([section]))
+{
+   if ( argc < 2 )
+      return GpuTimer::getFrameTime();
+
+   return GpuTimer::getResultTime( argv[1] );
+}
+
+/*! Gets the GPU time of every section of the last timed frame.
+    @return A tab separated list of "section milliseconds" pairs.
+*/
+ConsoleFunctionWithDocs(getGpuTimes, ConsoleString, 1, 1, ())
+{
+   char* pBuffer = Con::getReturnBuffer( 2048 );
+   pBuffer[0] = 0;
+   for ( U32 index = 0; index < GpuTimer::getResultCount(); ++index )
+   {
+      const U32 length = dStrlen( pBuffer );
+      dSprintf( pBuffer + length, 2048 - length, index == 0 ? "%s %.3f" : "\t%s %.3f", GpuTimer::getResultName(index), GpuTimer::getResultTime(index) );
+   }
+
+   return pBuffer;
+}
+
+ConsoleFunctionGroupEnd( GpuTimer );
+
+/*! @} */ // group GpuTimerFunctions
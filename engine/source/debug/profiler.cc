@@ -29,6 +29,7 @@
 #include "collection/vector.h"
 #include "io/fileStream.h"
 #include "platform/threads/thread.h"
+#include "platform/threads/atomic.h"
 
 #include "profiler_ScriptBinding.h"
 
@@ -158,77 +159,285 @@ U32 endHighResolutionTimer(U32 time[2])
 
 #endif
 
-Profiler::Profiler()
+//-----------------------------------------------------------------------------
+// Timeline capture.
+//-----------------------------------------------------------------------------
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define PROFILER_THREAD_LOCAL __declspec(thread)
+#else
+#define PROFILER_THREAD_LOCAL __thread
+#endif
+
+#if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_OSX)
+#include <mach/mach_time.h>
+#endif
+
+// 64-bit timeline clock.  Ticks are converted to microseconds using the real
+// time that passed whilst capturing so the clock needn't have a known rate.
+static inline U64 readTimelineClock()
 {
-   mMaxStackDepth = MaxStackDepth;
-   mCurrentHash = 0;
-
-   mCurrentProfilerData = (ProfilerData *) malloc(sizeof(ProfilerData));
-   mCurrentProfilerData->mRoot = NULL;
-   mCurrentProfilerData->mNextForRoot = NULL;
-   mCurrentProfilerData->mNextProfilerData = NULL;
-   mCurrentProfilerData->mNextHash = NULL;
-   mCurrentProfilerData->mParent = NULL;
-   mCurrentProfilerData->mNextSibling = NULL;
-   mCurrentProfilerData->mFirstChild = NULL;
-   mCurrentProfilerData->mLastSeenProfiler = NULL;
-   mCurrentProfilerData->mHash = 0;
-   mCurrentProfilerData->mSubDepth = 0;
-   mCurrentProfilerData->mInvokeCount = 0;
-   mCurrentProfilerData->mTotalTime = 0;
-   mCurrentProfilerData->mSubTime = 0;
-   mRootProfilerData = mCurrentProfilerData;
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+   return __rdtsc();
+#elif defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+   U32 lo, hi;
+   __asm__ __volatile__("rdtsc" : "=a" (lo), "=d" (hi));
+   return ((U64)hi << 32) | lo;
+#elif defined(TORQUE_OS_IOS) || defined(TORQUE_OS_OSX)
+   return mach_absolute_time();
+#else
+   return Platform::getRealMilliseconds();
+#endif
+}
+
+/// A timeline event.  A NULL root marks the end of the innermost scope.
+struct ProfilerTimelineEvent
+{
+   ProfilerRootData *mRoot;
+   U64 mTicks;
+};
+
+/// A ring of timeline events written only by its own thread.
+struct ProfilerTimelineBuffer
+{
+   enum {
+      EventCapacity = 65536
+   };
+
+   ProfilerTimelineEvent mEvents[EventCapacity];
+   volatile U32 mCount;             ///< Events written since the capture started.
+   U32 mSequence;                   ///< Order the buffer was created in (used as the trace thread id).
+   bool mMainThread;
+   ProfilerTimelineBuffer *mNext;
+};
+
+static ProfilerTimelineBuffer* volatile sTimelineBuffers = NULL;
+static U32 sTimelineBufferCount = 0;
+static PROFILER_THREAD_LOCAL ProfilerTimelineBuffer *stTimelineBuffer = NULL;
+
+//-----------------------------------------------------------------------------
+// Per-thread profiling.
+//-----------------------------------------------------------------------------
+
+/// The profile tree and scope stack of a thread.
+struct ProfilerThreadState
+{
+   ProfilerData *mRootProfilerData;
+   ProfilerData *mCurrentProfilerData;
+   ProfilerData *mProfileList;   ///< All the profiler data allocated by the thread.
+   S32 mStackDepth;
+   bool mEnabled;                ///< Only changes when the thread is outside all scopes.
+   U32 mResetSequence;           ///< The profiler reset the tree was last cleared for.
+   bool mMainThread;
+   void* volatile mLock;         ///< Held whilst the tree is changed by its thread or merged by a dump.
+   ProfilerThreadState *mNext;
+};
+
+static ProfilerThreadState* volatile sThreadStates = NULL;
+static PROFILER_THREAD_LOCAL ProfilerThreadState *stThreadState = NULL;
+
+static inline void lockThreadState(ProfilerThreadState *state)
+{
+   while(dCompareAndSwapPointer(&state->mLock, NULL, state) != NULL)
+      ;
+}
 
+static inline void unlockThreadState(ProfilerThreadState *state)
+{
+   dExchangePointer(&state->mLock, NULL);
+}
+
+static ProfilerData *allocProfilerData(ProfilerRootData *root, ProfilerData *parent, ProfilerData **list)
+{
+   ProfilerData *data = (ProfilerData *) malloc(sizeof(ProfilerData));
    for(U32 i = 0; i < ProfilerData::HashTableSize; i++)
-      mCurrentProfilerData->mChildHash[i] = 0;
+      data->mChildHash[i] = 0;
+
+   data->mRoot = root;
+   data->mNextProfilerData = NULL;
+   data->mNextHash = NULL;
+   data->mParent = parent;
+   data->mNextSibling = NULL;
+   data->mFirstChild = NULL;
+   data->mLastSeenProfiler = NULL;
+   data->mHash = root ? root->mNameHash : 0;
+   data->mSubDepth = 0;
+   data->mInvokeCount = 0;
+   data->mTotalTime = 0;
+   data->mSubTime = 0;
+
+   if(list)
+   {
+      data->mNextProfilerData = *list;
+      *list = data;
+   }
+
+   if(parent)
+   {
+      U32 index = root->mNameHash & (ProfilerData::HashTableSize - 1);
+      data->mNextHash = parent->mChildHash[index];
+      parent->mChildHash[index] = data;
 
-   mProfileList = NULL;
+      data->mNextSibling = parent->mFirstChild;
+      parent->mFirstChild = data;
+   }
+   return data;
+}
+
+static ProfilerData *findProfilerData(ProfilerData *parent, ProfilerRootData *root)
+{
+   ProfilerData *data = parent->mChildHash[root->mNameHash & (ProfilerData::HashTableSize - 1)];
+   while(data && data->mRoot != root)
+      data = data->mNextHash;
+   return data;
+}
+
+static void freeProfilerDataList(ProfilerData *list)
+{
+   while(list)
+   {
+      ProfilerData *next = list->mNextProfilerData;
+      free(list);
+      list = next;
+   }
+}
+
+/// Add the counters of one tree into another then clear them.
+static void mergeProfilerData(ProfilerData *dest, ProfilerData *src, ProfilerData **list)
+{
+   dest->mInvokeCount += src->mInvokeCount;
+   dest->mTotalTime += src->mTotalTime;
+   dest->mSubTime += src->mSubTime;
+   src->mInvokeCount = 0;
+   src->mTotalTime = 0;
+   src->mSubTime = 0;
+
+   for(ProfilerData *child = src->mFirstChild; child; child = child->mNextSibling)
+   {
+      ProfilerData *destChild = findProfilerData(dest, child->mRoot);
+      if(!destChild)
+         destChild = allocProfilerData(child->mRoot, dest, list);
+      mergeProfilerData(destChild, child, list);
+   }
+}
+
+/// Gather the totals of each marker from a merged tree.
+static void accumulateRootData(ProfilerData *data)
+{
+   for(ProfilerData *child = data->mFirstChild; child; child = child->mNextSibling)
+   {
+      child->mRoot->mTotalTime += child->mTotalTime;
+      child->mRoot->mTotalInvokeCount += child->mInvokeCount;
+      if(data->mRoot)
+         data->mRoot->mSubTime += child->mTotalTime; // mark it in the parent as well...
+      accumulateRootData(child);
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+Profiler::Profiler()
+{
+   mMaxStackDepth = MaxStackDepth;
 
    mEnabled = false;
-   mStackDepth = 0;
    mNextEnable = false;
+   mResetSequence = 0;
    gProfiler = this;
    mDumpToConsole   = false;
    mDumpToFile      = false;
    mDumpFileName[0] = '\0';
+   mTimelineCapture = false;
+   mTimelineStartTicks = 0;
+   mTimelineStartTime = 0;
 
-#ifdef TORQUE_MULTITHREAD
    gMainThread = ThreadManager::getCurrentThreadId();
-#endif
 }
 
 Profiler::~Profiler()
 {
    reset();
-   free(mRootProfilerData);
+   while(sThreadStates)
+   {
+      ProfilerThreadState *state = sThreadStates;
+      sThreadStates = state->mNext;
+      freeProfilerDataList(state->mProfileList);
+      free(state->mRootProfilerData);
+      free(state);
+   }
+   stThreadState = NULL;
    gProfiler = NULL;
 }
 
-void Profiler::reset()
+ProfilerThreadState *Profiler::getThreadState()
 {
-   mEnabled = false; // in case we're in a profiler call.
-   while(mProfileList)
+   ProfilerThreadState *state = stThreadState;
+   if(state)
+      return state;
+
+   // Create the state on the thread's first profile scope.
+   state = (ProfilerThreadState *) malloc(sizeof(ProfilerThreadState));
+   state->mRootProfilerData = allocProfilerData(NULL, NULL, NULL);
+   state->mCurrentProfilerData = state->mRootProfilerData;
+   state->mProfileList = NULL;
+   state->mStackDepth = 0;
+   state->mEnabled = false;
+   state->mResetSequence = mResetSequence;
+   state->mMainThread = ThreadManager::isCurrentThread(gMainThread);
+   state->mLock = NULL;
+
+   // Link the state in without locking.
+   ProfilerThreadState *head;
+   do
    {
-      free(mProfileList);
-      mProfileList = NULL;
+      head = sThreadStates;
+      state->mNext = head;
    }
+   while(dCompareAndSwapPointer((void* volatile*)&sThreadStates, head, state) != head);
+
+   stThreadState = state;
+   return state;
+}
+
+void Profiler::resetThreadState(ProfilerThreadState *state)
+{
+   lockThreadState(state);
+
+   freeProfilerDataList(state->mProfileList);
+   state->mProfileList = NULL;
+
+   ProfilerData *root = state->mRootProfilerData;
+   root->mFirstChild = 0;
+   for(U32 i = 0; i < ProfilerData::HashTableSize; i++)
+      root->mChildHash[i] = 0;
+   root->mInvokeCount = 0;
+   root->mTotalTime = 0;
+   root->mSubTime = 0;
+   root->mSubDepth = 0;
+   root->mLastSeenProfiler = 0;
+   state->mCurrentProfilerData = root;
+   state->mResetSequence = mResetSequence;
+
+   unlockThreadState(state);
+}
+
+void Profiler::reset()
+{
+   mEnabled = false; // in case we're in a profiler call.
+
+   // Other threads clear their trees when they are next outside all scopes.
+   mResetSequence++;
+   ProfilerThreadState *state = getThreadState();
+   resetThreadState(state);
+   state->mEnabled = false;
+
    for(ProfilerRootData *walk = ProfilerRootData::sRootList; walk; walk = walk->mNextRoot)
    {
-      walk->mFirstProfilerData = 0;
       walk->mTotalTime = 0;
       walk->mSubTime = 0;
       walk->mTotalInvokeCount = 0;
    }
-   mCurrentProfilerData = mRootProfilerData;
-   mCurrentProfilerData->mNextForRoot = 0;
-   mCurrentProfilerData->mFirstChild = 0;
-   for(U32 i = 0; i < ProfilerData::HashTableSize; i++)
-      mCurrentProfilerData->mChildHash[i] = 0;
-   mCurrentProfilerData->mInvokeCount = 0;
-   mCurrentProfilerData->mTotalTime = 0;
-   mCurrentProfilerData->mSubTime = 0;
-   mCurrentProfilerData->mSubDepth = 0;
-   mCurrentProfilerData->mLastSeenProfiler = 0;
 }
 
 static Profiler aProfiler; // allocate the global profiler
@@ -244,19 +453,17 @@ ProfilerRootData::ProfilerRootData(const char *name)
    mNextRoot = sRootList;
    sRootList = this;
    mTotalTime = 0;
+   mSubTime = 0;
    mTotalInvokeCount = 0;
-   mFirstProfilerData = NULL;
    mEnabled = true;
 }
 
 void Profiler::validate()
 {
-   for(ProfilerRootData *walk = ProfilerRootData::sRootList; walk; walk = walk->mNextRoot)
+   for(ProfilerThreadState *state = sThreadStates; state; state = state->mNext)
    {
-      for(ProfilerData *dp = walk->mFirstProfilerData; dp; dp = dp->mNextForRoot)
+      for(ProfilerData *dp = state->mProfileList; dp; dp = dp->mNextProfilerData)
       {
-         if(dp->mRoot != walk)
-            Platform::debugBreak();
          // check if it's in the parent's list...
          ProfilerData *wk;
          for(wk = dp->mParent->mFirstChild; wk; wk = wk->mNextSibling)
@@ -264,7 +471,7 @@ void Profiler::validate()
                break;
          if(!wk)
             Platform::debugBreak();
-         for(wk = dp->mParent->mChildHash[walk->mNameHash & (ProfilerData::HashTableSize - 1)] ;
+         for(wk = dp->mParent->mChildHash[dp->mRoot->mNameHash & (ProfilerData::HashTableSize - 1)] ;
                wk; wk = wk->mNextHash)
             if(wk == dp)
                break;
@@ -276,73 +483,54 @@ void Profiler::validate()
 
 void Profiler::hashPush(ProfilerRootData *root)
 {
-#ifdef TORQUE_MULTITHREAD
-   // Ignore non-main-thread profiler activity.
-   if(! ThreadManager::isCurrentThread(gMainThread) )
-      return;
-#endif
+   // Record the timeline on every thread.
+   if(mTimelineCapture)
+      recordTimelineEvent(root);
 
-   mStackDepth++;
-   AssertFatal(mStackDepth <= (S32)mMaxStackDepth,
+   ProfilerThreadState *state = getThreadState();
+
+   // Pick up any reset or change of enable outside all scopes.
+   if(state->mStackDepth == 0)
+   {
+      if(state->mResetSequence != mResetSequence)
+         resetThreadState(state);
+      state->mEnabled = mEnabled;
+   }
+
+   state->mStackDepth++;
+   AssertFatal(state->mStackDepth <= (S32)mMaxStackDepth,
                   "Stack overflow in profiler.  You may have mismatched PROFILE_START and PROFILE_ENDs");
-   if(!mEnabled)
+   if(!state->mEnabled)
       return;
 
+   ProfilerData *currentProfiler = state->mCurrentProfilerData;
    ProfilerData *nextProfiler = NULL;
-   if(!root->mEnabled || mCurrentProfilerData->mRoot == root)
+   if(!root->mEnabled || currentProfiler->mRoot == root)
    {
-      mCurrentProfilerData->mSubDepth++;
+      currentProfiler->mSubDepth++;
       return;
    }
 
-   if(mCurrentProfilerData->mLastSeenProfiler &&
-            mCurrentProfilerData->mLastSeenProfiler->mRoot == root)
-      nextProfiler = mCurrentProfilerData->mLastSeenProfiler;
+   if(currentProfiler->mLastSeenProfiler &&
+            currentProfiler->mLastSeenProfiler->mRoot == root)
+      nextProfiler = currentProfiler->mLastSeenProfiler;
 
    if(!nextProfiler)
    {
       // first see if it's in the hash table...
-      U32 index = root->mNameHash & (ProfilerData::HashTableSize - 1);
-      nextProfiler = mCurrentProfilerData->mChildHash[index];
-      while(nextProfiler)
-      {
-         if(nextProfiler->mRoot == root)
-            break;
-         nextProfiler = nextProfiler->mNextHash;
-      }
+      nextProfiler = findProfilerData(currentProfiler, root);
       if(!nextProfiler)
       {
-         nextProfiler = (ProfilerData *) malloc(sizeof(ProfilerData));
-         for(U32 i = 0; i < ProfilerData::HashTableSize; i++)
-            nextProfiler->mChildHash[i] = 0;
-
-         nextProfiler->mRoot = root;
-         nextProfiler->mNextForRoot = root->mFirstProfilerData;
-         root->mFirstProfilerData = nextProfiler;
-
-         nextProfiler->mNextProfilerData = mProfileList;
-         mProfileList = nextProfiler;
-
-         nextProfiler->mNextHash = mCurrentProfilerData->mChildHash[index];
-         mCurrentProfilerData->mChildHash[index] = nextProfiler;
-
-         nextProfiler->mParent = mCurrentProfilerData;
-         nextProfiler->mNextSibling = mCurrentProfilerData->mFirstChild;
-         mCurrentProfilerData->mFirstChild = nextProfiler;
-         nextProfiler->mFirstChild = NULL;
-         nextProfiler->mLastSeenProfiler = NULL;
-         nextProfiler->mHash = root->mNameHash;
-         nextProfiler->mInvokeCount = 0;
-         nextProfiler->mTotalTime = 0;
-         nextProfiler->mSubTime = 0;
-         nextProfiler->mSubDepth = 0;
+         // The tree may be being merged by a dump on the main thread.
+         lockThreadState(state);
+         nextProfiler = allocProfilerData(root, currentProfiler, &state->mProfileList);
+         unlockThreadState(state);
       }
    }
-   root->mTotalInvokeCount++;
    nextProfiler->mInvokeCount++;
    startHighResolutionTimer(nextProfiler->mStartTime);
-   mCurrentProfilerData->mLastSeenProfiler = nextProfiler;
-   mCurrentProfilerData = nextProfiler;
+   currentProfiler->mLastSeenProfiler = nextProfiler;
+   state->mCurrentProfilerData = nextProfiler;
 }
 
 void Profiler::enable(bool enabled)
@@ -372,39 +560,39 @@ void Profiler::dumpToFile(const char* fileName)
 
 void Profiler::hashPop()
 {
-#ifdef TORQUE_MULTITHREAD
-   // Ignore non-main-thread profiler activity.
-   if(! ThreadManager::isCurrentThread(gMainThread) )
-      return;
-#endif
+   // Record the timeline on every thread.
+   if(mTimelineCapture)
+      recordTimelineEvent(NULL);
 
-   mStackDepth--;
-   AssertFatal(mStackDepth >= 0, "Stack underflow in profiler.  You may have mismatched PROFILE_START and PROFILE_ENDs");
-   if(mEnabled)
+   ProfilerThreadState *state = getThreadState();
+
+   state->mStackDepth--;
+   AssertFatal(state->mStackDepth >= 0, "Stack underflow in profiler.  You may have mismatched PROFILE_START and PROFILE_ENDs");
+   if(state->mEnabled)
    {
-      if(mCurrentProfilerData->mSubDepth)
+      ProfilerData *currentProfiler = state->mCurrentProfilerData;
+      if(currentProfiler->mSubDepth)
       {
-         mCurrentProfilerData->mSubDepth--;
+         currentProfiler->mSubDepth--;
          return;
       }
-      F64 fElapsed = endHighResolutionTimer(mCurrentProfilerData->mStartTime);
-      mCurrentProfilerData->mTotalTime += fElapsed;
-      mCurrentProfilerData->mParent->mSubTime += fElapsed; // mark it in the parent as well...
-      mCurrentProfilerData->mRoot->mTotalTime += fElapsed;
-      if(mCurrentProfilerData->mParent->mRoot)
-         mCurrentProfilerData->mParent->mRoot->mSubTime += fElapsed; // mark it in the parent as well...
-      mCurrentProfilerData = mCurrentProfilerData->mParent;
+      F64 fElapsed = endHighResolutionTimer(currentProfiler->mStartTime);
+      currentProfiler->mTotalTime += fElapsed;
+      currentProfiler->mParent->mSubTime += fElapsed; // mark it in the parent as well...
+      state->mCurrentProfilerData = currentProfiler->mParent;
    }
-   if(mStackDepth == 0)
+
+   // The main thread applies dumps and enabling between frames.
+   if(state->mStackDepth == 0 && state->mMainThread)
    {
       // apply the next enable...
       if(mDumpToConsole || mDumpToFile)
       {
          dump();
-         startHighResolutionTimer(mCurrentProfilerData->mStartTime);
+         startHighResolutionTimer(state->mCurrentProfilerData->mStartTime);
       }
       if(!mEnabled && mNextEnable)
-         startHighResolutionTimer(mCurrentProfilerData->mStartTime);
+         startHighResolutionTimer(state->mCurrentProfilerData->mStartTime);
       mEnabled = mNextEnable;
    }
 }
@@ -496,11 +684,33 @@ static void profilerDataDumpRecurseFile(ProfilerData *data, char *buffer, U32 bu
 
 void Profiler::dump()
 {
-   bool enableSave = mEnabled;
-   mEnabled = false;
-   mStackDepth++;
+   ProfilerThreadState *mainState = getThreadState();
+   bool enableSave = mainState->mEnabled;
+   mainState->mEnabled = false;
+   mainState->mStackDepth++;
    // may have some profiled calls... gotta turn em off.
 
+   // Merge the trees of all the threads.
+   // NOTE: Other threads keep profiling whilst their counters are cleared so a
+   // sample in flight may be lost.
+   ProfilerData *mergedList = NULL;
+   ProfilerData *mergedRoot = allocProfilerData(NULL, NULL, NULL);
+   for(ProfilerThreadState *state = sThreadStates; state; state = state->mNext)
+   {
+      lockThreadState(state);
+      mergeProfilerData(mergedRoot, state->mRootProfilerData, &mergedList);
+      unlockThreadState(state);
+   }
+   mergedRoot->mTotalTime = endHighResolutionTimer(mainState->mRootProfilerData->mStartTime);
+
+   for(ProfilerRootData *walk = ProfilerRootData::sRootList; walk; walk = walk->mNextRoot)
+   {
+      walk->mTotalTime = 0;
+      walk->mSubTime = 0;
+      walk->mTotalInvokeCount = 0;
+   }
+   accumulateRootData(mergedRoot);
+
    Vector<ProfilerRootData *> rootVector;
    F64 totalTime = 0;
    for(ProfilerRootData *walk = ProfilerRootData::sRootList; walk; walk = walk->mNextRoot)
@@ -532,13 +742,9 @@ void Profiler::dump()
       Con::printf("Ordered by stack trace total time -");
       Con::printf("%% Time  %% NSTime  Invoke #  Name");
 
-      mCurrentProfilerData->mTotalTime = endHighResolutionTimer(mCurrentProfilerData->mStartTime);
-
       char depthBuffer[MaxStackDepth * 2 + 1];
       depthBuffer[0] = 0;
-      profilerDataDumpRecurse(mCurrentProfilerData, depthBuffer, 0, totalTime);
-      mEnabled = enableSave;
-      mStackDepth--;
+      profilerDataDumpRecurse(mergedRoot, depthBuffer, 0, totalTime);
    }
    else if (mDumpToFile == true && mDumpFileName[0] != '\0')
    {
@@ -572,17 +778,18 @@ void Profiler::dump()
          dStrcpy(buffer, "%%NSTime  %% Time  Invoke #  Name\n");
          fws.write(dStrlen(buffer), buffer);
 
-      mCurrentProfilerData->mTotalTime = endHighResolutionTimer(mCurrentProfilerData->mStartTime);
-
       char depthBuffer[MaxStackDepth * 2 + 1];
       depthBuffer[0] = 0;
-      profilerDataDumpRecurseFile(mCurrentProfilerData, depthBuffer, 0, totalTime, fws);
-      mEnabled = enableSave;
-      mStackDepth--;
+      profilerDataDumpRecurseFile(mergedRoot, depthBuffer, 0, totalTime, fws);
 
       fws.close();
    }
 
+   freeProfilerDataList(mergedList);
+   free(mergedRoot);
+   mainState->mEnabled = enableSave;
+   mainState->mStackDepth--;
+
    mDumpToConsole = false;
    mDumpToFile    = false;
    mDumpFileName[0] = '\0';
@@ -611,4 +818,144 @@ void Profiler::enableMarker(const char *marker, bool enable)
    }
 }
 
+void Profiler::recordTimelineEvent(ProfilerRootData *root)
+{
+   // Fetch this thread's buffer, creating it on first use.
+   ProfilerTimelineBuffer *buffer = stTimelineBuffer;
+   if(!buffer)
+   {
+      buffer = (ProfilerTimelineBuffer *) malloc(sizeof(ProfilerTimelineBuffer));
+      buffer->mCount = 0;
+      buffer->mMainThread = ThreadManager::isCurrentThread(gMainThread);
+
+      // Link the buffer in without locking.
+      ProfilerTimelineBuffer *head;
+      do
+      {
+         head = sTimelineBuffers;
+         buffer->mNext = head;
+         buffer->mSequence = head ? head->mSequence + 1 : 0;
+      }
+      while(dCompareAndSwapPointer((void* volatile*)&sTimelineBuffers, head, buffer) != head);
+
+      stTimelineBuffer = buffer;
+   }
+
+   // Write the event then publish it.
+   // NOTE: The count is only read by another thread once capturing has stopped.
+   const U32 count = buffer->mCount;
+   ProfilerTimelineEvent &event = buffer->mEvents[count & (ProfilerTimelineBuffer::EventCapacity - 1)];
+   event.mRoot = root;
+   event.mTicks = readTimelineClock();
+   buffer->mCount = count + 1;
+}
+
+void Profiler::startTimeline()
+{
+   if(mTimelineCapture)
+      return;
+
+   // Discard any previous capture.
+   for(ProfilerTimelineBuffer *buffer = sTimelineBuffers; buffer; buffer = buffer->mNext)
+      buffer->mCount = 0;
+
+   mTimelineStartTime = Platform::getRealMilliseconds();
+   mTimelineStartTicks = readTimelineClock();
+   dMemoryBarrier();
+   mTimelineCapture = true;
+
+   Con::printf("Profiler timeline capture started.");
+}
+
+static void writeTimelineEvent(FileStream &fws, bool &first, const char *event)
+{
+   if(!first)
+      fws.write(2, ",\n");
+   first = false;
+   fws.write(dStrlen(event), event);
+}
+
+bool Profiler::stopTimeline(const char *fileName)
+{
+   if(!mTimelineCapture)
+   {
+      Con::warnf("Profiler::stopTimeline() - No timeline is being captured.");
+      return false;
+   }
+
+   // Stop capturing.
+   mTimelineCapture = false;
+   const U64 endTicks = readTimelineClock();
+   const U32 endTime = Platform::getRealMilliseconds();
+   dMemoryBarrier();
+
+   // Calibrate the clock against the real time captured.
+   const F64 microsecondsPerTick = endTicks > mTimelineStartTicks ? F64(endTime - mTimelineStartTime) * 1000.0 / F64(endTicks - mTimelineStartTicks) : 0.0;
+   const F64 endTimestamp = F64(endTicks - mTimelineStartTicks) * microsecondsPerTick;
+
+   FileStream fws;
+   if(!fws.open(fileName, FileStream::Write))
+   {
+      Con::warnf("Profiler::stopTimeline() - Cannot write the timeline to '%s'.", fileName);
+      return false;
+   }
+
+   char buffer[512];
+   dStrcpy(buffer, "{\"traceEvents\":[\n");
+   fws.write(dStrlen(buffer), buffer);
+
+   bool first = true;
+   for(ProfilerTimelineBuffer *timeline = sTimelineBuffers; timeline; timeline = timeline->mNext)
+   {
+      const U32 count = timeline->mCount;
+      if(count == 0)
+         continue;
+
+      // Name the thread.
+      if(timeline->mMainThread)
+         dSprintf(buffer, sizeof(buffer), "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%d,\"args\":{\"name\":\"Main\"}}", timeline->mSequence);
+      else
+         dSprintf(buffer, sizeof(buffer), "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%d,\"args\":{\"name\":\"Thread %d\"}}", timeline->mSequence, timeline->mSequence);
+      writeTimelineEvent(fws, first, buffer);
+
+      // Write the events still in the ring.
+      // Ends whose beginning was overwritten (or preceded the capture) are skipped.
+      const U32 start = count > ProfilerTimelineBuffer::EventCapacity ? count - ProfilerTimelineBuffer::EventCapacity : 0;
+      S32 depth = 0;
+      for(U32 i = start; i < count; i++)
+      {
+         const ProfilerTimelineEvent &event = timeline->mEvents[i & (ProfilerTimelineBuffer::EventCapacity - 1)];
+         const F64 timestamp = event.mTicks > mTimelineStartTicks ? F64(event.mTicks - mTimelineStartTicks) * microsecondsPerTick : 0.0;
+
+         if(event.mRoot)
+         {
+            dSprintf(buffer, sizeof(buffer), "{\"name\":\"%s\",\"ph\":\"B\",\"pid\":0,\"tid\":%d,\"ts\":%.3f}", event.mRoot->mName, timeline->mSequence, timestamp);
+            depth++;
+         }
+         else
+         {
+            if(depth == 0)
+               continue;
+            dSprintf(buffer, sizeof(buffer), "{\"ph\":\"E\",\"pid\":0,\"tid\":%d,\"ts\":%.3f}", timeline->mSequence, timestamp);
+            depth--;
+         }
+         writeTimelineEvent(fws, first, buffer);
+      }
+
+      // End any scopes still open when capturing stopped.
+      for(; depth > 0; depth--)
+      {
+         dSprintf(buffer, sizeof(buffer), "{\"ph\":\"E\",\"pid\":0,\"tid\":%d,\"ts\":%.3f}", timeline->mSequence, endTimestamp);
+         writeTimelineEvent(fws, first, buffer);
+      }
+   }
+
+   dStrcpy(buffer, "\n],\"displayTimeUnit\":\"ms\"}\n");
+   fws.write(dStrlen(buffer), buffer);
+   fws.close();
+
+   Con::printf("Profiler timeline written to '%s'.", fileName);
+   return true;
+}
+
 #endif
@@ -29,6 +29,8 @@
 
 struct ProfilerData;
 struct ProfilerRootData;
+struct ProfilerThreadState;
+struct ProfilerTimelineBuffer;
 /// The Profiler is used to see how long a specific chunk of code takes to execute.
 /// All values outputted by the profiler are percentages of the time that it takes
 /// to run entire main loop.
@@ -41,8 +43,16 @@ struct ProfilerRootData;
 /// profilerDump();                                         //dumps all profiler data to the console
 /// profilerDumpToFile(string filename);                    //dumps all profiler data to a given file
 /// profilerMarkerEnable((string markerName, bool enable);  //enables or disables a given profile tag
+/// profilerTimelineStart();                                //starts recording a timeline of every profile scope
+/// profilerTimelineStop(string filename);                  //stops recording and writes the timeline to a file
 /// @endcode
 ///
+/// The timeline records when each profile scope begins and ends on every thread, not just
+/// the main thread, so individual frame spikes and the interleaving of worker threads can be
+/// seen.  Each thread records into its own ring buffer without locking; if a buffer fills, its
+/// oldest events are overwritten.  The file is written in the Chrome trace event format and
+/// can be opened with chrome://tracing or Perfetto.
+///
 /// The C++ code side of the profiler uses pairs of PROFILE_START() and PROFILE_END().
 ///
 /// When using these macros, make sure there is a PROFILE_END() for every PROFILE_START
@@ -55,6 +65,9 @@ struct ProfilerRootData;
 /// of the main loop, it is possible to benchmark any given code to see if changes made will
 /// actually improve performance.
 ///
+/// Each thread profiles into its own tree so the macros can be used on any thread.  The
+/// trees of all the threads are merged when the profile is dumped.
+///
 /// Here are some examples:
 /// @code
 /// PROFILE_START(TerrainRender);
@@ -71,21 +84,22 @@ class Profiler
       MaxStackDepth = 256,
       DumpFileNameLength = 256
    };
-   U32 mCurrentHash;
-
-   ProfilerData *mCurrentProfilerData;
-   ProfilerData *mProfileList;
-   ProfilerData *mRootProfilerData;
 
    bool mEnabled;
-   S32 mStackDepth;
    bool mNextEnable;
+   volatile U32 mResetSequence;
    U32 mMaxStackDepth;
    bool mDumpToConsole;
    bool mDumpToFile;
    char mDumpFileName[DumpFileNameLength];
+   volatile bool mTimelineCapture;
+   U64 mTimelineStartTicks;
+   U32 mTimelineStartTime;
    void dump();
    void validate();
+   ProfilerThreadState *getThreadState();
+   void resetThreadState(ProfilerThreadState *state);
+   void recordTimelineEvent(ProfilerRootData *root);
 public:
    Profiler();
    ~Profiler();
@@ -105,6 +119,14 @@ public:
    void hashPop();
    /// Enable a profiler marker
    void enableMarker(const char *marker, bool enabled);
+   /// Start recording a timeline of every profile scope on every thread
+   void startTimeline();
+   /// Stop recording the timeline and write it as a Chrome trace
+   /// @param fileName filename to write the timeline to
+   /// @return Whether the file was written
+   bool stopTimeline(const char *fileName);
+   /// Gets whether a timeline is being recorded
+   bool isTimelineCapturing() const { return mTimelineCapture; }
 };
 
 extern Profiler *gProfiler;
@@ -113,11 +135,10 @@ struct ProfilerRootData
 {
    const char *mName;
    U32 mNameHash;
-   ProfilerData *mFirstProfilerData;
    ProfilerRootData *mNextRoot;
-   F64 mTotalTime;
-   F64 mSubTime;
-   U32 mTotalInvokeCount;
+   F64 mTotalTime;         ///< Gathered from all the threads when dumping.
+   F64 mSubTime;           ///< Gathered from all the threads when dumping.
+   U32 mTotalInvokeCount;  ///< Gathered from all the threads when dumping.
    bool mEnabled;
 
    static ProfilerRootData *sRootList;
@@ -128,8 +149,7 @@ struct ProfilerRootData
 struct ProfilerData
 {
    ProfilerRootData *mRoot; ///< link to root node.
-   ProfilerData *mNextForRoot; ///< links together all ProfilerData's for a particular root
-   ProfilerData *mNextProfilerData; ///< links all the profilerDatas
+   ProfilerData *mNextProfilerData; ///< links all the profilerDatas of a thread
    ProfilerData *mNextHash;
    ProfilerData *mParent;
    ProfilerData *mNextSibling;
@@ -156,13 +176,15 @@ if(gProfiler) gProfiler->hashPush(& pdata##name##obj )
 #undef PROFILE_END
 #define PROFILE_END() if(gProfiler) gProfiler->hashPop()
 
+/// Disabled markers are skipped entirely so they cost a single branch.
 class ScopedProfiler {
+   bool mPushed;
 public:
-   ScopedProfiler(ProfilerRootData *data) {
-      if (gProfiler) gProfiler->hashPush(data);
+   ScopedProfiler(ProfilerRootData *data) : mPushed(gProfiler != NULL && data->mEnabled) {
+      if (mPushed) gProfiler->hashPush(data);
    }
    ~ScopedProfiler() {
-      if (gProfiler) gProfiler->hashPop();
+      if (mPushed) gProfiler->hashPop();
    }
 };
 
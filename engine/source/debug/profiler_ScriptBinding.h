@@ -77,6 +77,29 @@ ConsoleFunctionWithDocs(profilerReset, ConsoleVoid, 1, 1, ())
       gProfiler->reset();
 }
 
+/*! Starts recording a timeline of when every profile scope begins and ends on every thread.
+    Any previous recording is discarded.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(profilerTimelineStart, ConsoleVoid, 1, 1, ())
+{
+   if(gProfiler)
+      gProfiler->startTimeline();
+}
+
+/*! Stops recording the timeline and writes it to a file in the Chrome trace event format.
+    The file can be opened with chrome://tracing or Perfetto.
+    @param filename The file to write the timeline to.
+    @return Whether the timeline was written or not.
+*/
+ConsoleFunctionWithDocs(profilerTimelineStop, ConsoleBool, 2, 2, (string filename))
+{
+   if(gProfiler)
+      return gProfiler->stopTimeline(argv[1]);
+
+   return false;
+}
+
 ConsoleFunctionGroupEnd( Profiler );
 
 /*! @} */ // group ProfilerFunctions
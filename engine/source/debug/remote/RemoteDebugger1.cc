@@ -28,6 +28,10 @@
 #include "console/compiler.h"
 #endif
 
+#ifndef _SCRIPT_PROFILER_H_
+#include "debug/scriptProfiler.h"
+#endif
+
 // Script bindings.
 #include "debug/remote/RemoteDebugger1_ScriptBinding.h"
 
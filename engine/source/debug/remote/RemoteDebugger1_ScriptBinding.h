@@ -56,4 +56,51 @@ ConsoleMethodWithDocs( RemoteDebugger1, setNextStatementBreak, ConsoleVoid, 3, 3
     object->setNextStatementBreak( enabled );
 }
 
+//-----------------------------------------------------------------------------
+
+/*! Start the script profiler sampling script execution.
+    @param sampleInterval The interval between samples in milliseconds (optional, defaults to 1).
+    @return No return value.
+*/
+ConsoleMethodWithDocs( RemoteDebugger1, startScriptProfiler, ConsoleVoid, 2, 3, ([sampleInterval]))
+{
+    ScriptProfiler::start( argc > 2 ? dAtoi(argv[2]) : ScriptProfiler::DefaultSampleInterval );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Stop the script profiler sampling script execution.
+    @param reset Whether to also discard the gathered samples (optional, defaults to false).
+    @return No return value.
+*/
+ConsoleMethodWithDocs( RemoteDebugger1, stopScriptProfiler, ConsoleVoid, 2, 3, ([reset]))
+{
+    ScriptProfiler::stop();
+
+    if ( argc > 2 && dAtob(argv[2]) )
+        ScriptProfiler::reset();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Get the script profiler samples as call stacks in the folded flame graph format.
+    @return One line per unique call stack in the form "outer;inner;leaf count".
+*/
+ConsoleMethodWithDocs( RemoteDebugger1, getScriptProfile, ConsoleString, 2, 2, ())
+{
+    // Fetch a return buffer.  This may be excessive but it avoids reallocation code.
+    S32 bufferSize = 1024 * 65;
+    char* pBuffer = Con::getReturnBuffer( bufferSize );
+
+    // Get the folded call stacks.
+    if ( !ScriptProfiler::getFoldedStacks( pBuffer, bufferSize ) )
+    {
+        // Warn.
+        Con::warnf( "Fetching the script profile resulted in a buffer overflow." );
+        return NULL;
+    }
+
+    return pBuffer;
+}
+
 ConsoleMethodGroupEndWithDocs(RemoteDebugger1)
@@ -0,0 +1,517 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "debug/scriptProfiler.h"
+#include "console/console.h"
+#include "console/consoleInternal.h"
+#include "console/codeBlock.h"
+#include "collection/vector.h"
+#include "io/fileStream.h"
+#include "platform/threads/thread.h"
+
+#include "scriptProfiler_ScriptBinding.h"
+
+extern ExprEvalState gEvalState;
+
+//-----------------------------------------------------------------------------
+
+Thread* ScriptProfiler::smpSampleThread = NULL;
+volatile bool ScriptProfiler::smSampleThreadStop = false;
+volatile bool ScriptProfiler::smSamplePending = false;
+volatile S32 ScriptProfiler::smScriptDepth = 0;
+U32 ScriptProfiler::smSampleInterval = ScriptProfiler::DefaultSampleInterval;
+U32 ScriptProfiler::smSampleCount = 0;
+
+//-----------------------------------------------------------------------------
+
+namespace
+{
+   enum
+   {
+      HashTableSize = 1024,
+      MaxFrameLabelLength = 256
+   };
+
+   // A sampled stack frame.  Functions use the namespace and function name, code
+   // executing outside of a function uses the code file.
+   struct ProfileFrame
+   {
+      StringTableEntry mNamespace;
+      StringTableEntry mFunction;
+      StringTableEntry mCodeFile;
+   };
+
+   // Samples of a unique call stack.
+   struct StackRecord
+   {
+      U32 mHash;
+      U32 mFrameStart;
+      U32 mFrameCount;
+      U32 mSampleCount;
+      S32 mNext;
+   };
+
+   // Samples of a function.
+   struct FunctionRecord
+   {
+      ProfileFrame mFrame;
+      U32 mHash;
+      U32 mSelfCount;
+      U32 mTotalCount;
+      U32 mLastSample;
+      S32 mNext;
+   };
+
+   // Samples of a line.
+   struct LineRecord
+   {
+      StringTableEntry mCodeFile;
+      U32 mLine;
+      U32 mHash;
+      U32 mSampleCount;
+      S32 mNext;
+   };
+
+   Vector<ProfileFrame> gStackFrames;
+   Vector<StackRecord> gStackRecords;
+   Vector<FunctionRecord> gFunctionRecords;
+   Vector<LineRecord> gLineRecords;
+   S32 gStackBuckets[HashTableSize];
+   S32 gFunctionBuckets[HashTableSize];
+   S32 gLineBuckets[HashTableSize];
+   bool gBucketsInitialized = false;
+
+   // The frames of the sample being recorded.
+   Vector<ProfileFrame> gSampleFrames;
+
+   //-----------------------------------------------------------------------------
+
+   inline U32 hashPointer( U32 hash, const void* pPointer )
+   {
+      return hash * 31 + (U32)((dsize_t)pPointer >> 2);
+   }
+
+   inline U32 hashFrame( const ProfileFrame& frame )
+   {
+      return hashPointer( hashPointer( hashPointer( 0, frame.mNamespace ), frame.mFunction ), frame.mCodeFile );
+   }
+
+   inline bool isSameFrame( const ProfileFrame& frameA, const ProfileFrame& frameB )
+   {
+      return frameA.mNamespace == frameB.mNamespace && frameA.mFunction == frameB.mFunction && frameA.mCodeFile == frameB.mCodeFile;
+   }
+
+   //-----------------------------------------------------------------------------
+
+   void resetBuckets( void )
+   {
+      for ( U32 index = 0; index < HashTableSize; ++index )
+      {
+         gStackBuckets[index] = -1;
+         gFunctionBuckets[index] = -1;
+         gLineBuckets[index] = -1;
+      }
+
+      gBucketsInitialized = true;
+   }
+
+   //-----------------------------------------------------------------------------
+
+   FunctionRecord& findFunctionRecord( const ProfileFrame& frame )
+   {
+      const U32 hash = hashFrame( frame );
+      S32& bucket = gFunctionBuckets[hash % HashTableSize];
+
+      for ( S32 index = bucket; index != -1; index = gFunctionRecords[index].mNext )
+      {
+         FunctionRecord& record = gFunctionRecords[index];
+         if ( record.mHash == hash && isSameFrame( record.mFrame, frame ) )
+            return record;
+      }
+
+      FunctionRecord record;
+      record.mFrame = frame;
+      record.mHash = hash;
+      record.mSelfCount = 0;
+      record.mTotalCount = 0;
+      record.mLastSample = U32_MAX;
+      record.mNext = bucket;
+      bucket = gFunctionRecords.size();
+      gFunctionRecords.push_back( record );
+      return gFunctionRecords.last();
+   }
+
+   //-----------------------------------------------------------------------------
+
+   LineRecord& findLineRecord( StringTableEntry codeFile, const U32 line )
+   {
+      const U32 hash = hashPointer( line, codeFile );
+      S32& bucket = gLineBuckets[hash % HashTableSize];
+
+      for ( S32 index = bucket; index != -1; index = gLineRecords[index].mNext )
+      {
+         LineRecord& record = gLineRecords[index];
+         if ( record.mCodeFile == codeFile && record.mLine == line )
+            return record;
+      }
+
+      LineRecord record;
+      record.mCodeFile = codeFile;
+      record.mLine = line;
+      record.mHash = hash;
+      record.mSampleCount = 0;
+      record.mNext = bucket;
+      bucket = gLineRecords.size();
+      gLineRecords.push_back( record );
+      return gLineRecords.last();
+   }
+
+   //-----------------------------------------------------------------------------
+
+   StackRecord& findStackRecord( const Vector<ProfileFrame>& frames )
+   {
+      U32 hash = 0;
+      for ( S32 frameIndex = 0; frameIndex < frames.size(); ++frameIndex )
+         hash = hash * 31 + hashFrame( frames[frameIndex] );
+
+      S32& bucket = gStackBuckets[hash % HashTableSize];
+
+      for ( S32 index = bucket; index != -1; index = gStackRecords[index].mNext )
+      {
+         StackRecord& record = gStackRecords[index];
+         if ( record.mHash != hash || record.mFrameCount != (U32)frames.size() )
+            continue;
+
+         bool match = true;
+         for ( U32 frameIndex = 0; frameIndex < record.mFrameCount; ++frameIndex )
+         {
+            if ( !isSameFrame( gStackFrames[record.mFrameStart + frameIndex], frames[frameIndex] ) )
+            {
+               match = false;
+               break;
+            }
+         }
+
+         if ( match )
+            return record;
+      }
+
+      StackRecord record;
+      record.mHash = hash;
+      record.mFrameStart = gStackFrames.size();
+      record.mFrameCount = frames.size();
+      record.mSampleCount = 0;
+      record.mNext = bucket;
+      bucket = gStackRecords.size();
+      gStackRecords.push_back( record );
+
+      for ( S32 frameIndex = 0; frameIndex < frames.size(); ++frameIndex )
+         gStackFrames.push_back( frames[frameIndex] );
+
+      return gStackRecords.last();
+   }
+
+   //-----------------------------------------------------------------------------
+
+   void formatFrame( const ProfileFrame& frame, char* pBuffer, U32 bufferSize )
+   {
+      if ( frame.mFunction == NULL )
+         dSprintf( pBuffer, bufferSize, "<%s>", frame.mCodeFile ? frame.mCodeFile : "eval" );
+      else if ( frame.mNamespace != NULL )
+         dSprintf( pBuffer, bufferSize, "%s::%s", frame.mNamespace, frame.mFunction );
+      else
+         dSprintf( pBuffer, bufferSize, "%s", frame.mFunction );
+   }
+
+   //-----------------------------------------------------------------------------
+
+   // Format a stack record as a folded line.  Returns the formatted length or -1 if the buffer is too small.
+   S32 formatStackRecord( const StackRecord& record, char* pBuffer, S32 bufferSize )
+   {
+      char frameBuffer[MaxFrameLabelLength];
+      S32 length = 0;
+
+      for ( U32 frameIndex = 0; frameIndex < record.mFrameCount; ++frameIndex )
+      {
+         formatFrame( gStackFrames[record.mFrameStart + frameIndex], frameBuffer, sizeof(frameBuffer) );
+
+         const S32 frameLength = dStrlen( frameBuffer ) + 1;
+         if ( length + frameLength >= bufferSize )
+            return -1;
+
+         dSprintf( pBuffer + length, bufferSize - length, frameIndex == 0 ? "%s" : ";%s", frameBuffer );
+         length += frameIndex == 0 ? frameLength - 1 : frameLength;
+      }
+
+      char countBuffer[32];
+      dSprintf( countBuffer, sizeof(countBuffer), " %d\n", record.mSampleCount );
+      const S32 countLength = dStrlen( countBuffer );
+      if ( length + countLength >= bufferSize )
+         return -1;
+
+      dStrcpy( pBuffer + length, countBuffer );
+      return length + countLength;
+   }
+
+   //-----------------------------------------------------------------------------
+
+   S32 QSORT_CALLBACK compareFunctionRecords( const void* a, const void* b )
+   {
+      const FunctionRecord* pRecordA = *(const FunctionRecord**)a;
+      const FunctionRecord* pRecordB = *(const FunctionRecord**)b;
+
+      if ( pRecordA->mSelfCount != pRecordB->mSelfCount )
+         return pRecordA->mSelfCount < pRecordB->mSelfCount ? 1 : -1;
+
+      return pRecordA->mTotalCount < pRecordB->mTotalCount ? 1 : pRecordA->mTotalCount > pRecordB->mTotalCount ? -1 : 0;
+   }
+
+   S32 QSORT_CALLBACK compareLineRecords( const void* a, const void* b )
+   {
+      const LineRecord* pRecordA = *(const LineRecord**)a;
+      const LineRecord* pRecordB = *(const LineRecord**)b;
+
+      return pRecordA->mSampleCount < pRecordB->mSampleCount ? 1 : pRecordA->mSampleCount > pRecordB->mSampleCount ? -1 : 0;
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+void ScriptProfiler::start( const U32 sampleInterval )
+{
+   // Restart if already running so the new interval is used.
+   if ( isRunning() )
+      stop();
+
+   if ( !gBucketsInitialized )
+      resetBuckets();
+
+   smSampleInterval = getMax( (U32)1, getMin( sampleInterval, (U32)MaxSampleInterval ) );
+   smSampleThreadStop = false;
+   smSamplePending = false;
+   smpSampleThread = new Thread( sampleThreadFunction, NULL, true );
+}
+
+//-----------------------------------------------------------------------------
+
+void ScriptProfiler::stop( void )
+{
+   if ( !isRunning() )
+      return;
+
+   // Flag the sampler to stop and wait for it (deleting the thread joins it).
+   smSampleThreadStop = true;
+   delete smpSampleThread;
+   smpSampleThread = NULL;
+   smSamplePending = false;
+}
+
+//-----------------------------------------------------------------------------
+
+void ScriptProfiler::reset( void )
+{
+   gStackFrames.clear();
+   gStackRecords.clear();
+   gFunctionRecords.clear();
+   gLineRecords.clear();
+   resetBuckets();
+   smSampleCount = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+void ScriptProfiler::sampleThreadFunction( void* pArg )
+{
+   while ( !smSampleThreadStop )
+   {
+      Platform::sleep( smSampleInterval );
+
+      // Only flag a sample whilst script is executing.  Anything else is engine time
+      // that would otherwise be attributed to whichever script happened to run next.
+      if ( smScriptDepth > 0 )
+         smSamplePending = true;
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+void ScriptProfiler::sample( CodeBlock* pCodeBlock, const U32 ip, const bool inFunction )
+{
+   smSamplePending = false;
+
+   // Ignore samples that arrive after stopping.
+   if ( !isRunning() )
+      return;
+
+   // Gather the call stack, outermost first.
+   gSampleFrames.clear();
+   for ( S32 stackIndex = 0; stackIndex < gEvalState.stack.size(); ++stackIndex )
+   {
+      const Dictionary* pFrame = gEvalState.stack[stackIndex];
+
+      ProfileFrame frame;
+      frame.mNamespace = pFrame->scopeNamespace ? pFrame->scopeNamespace->mName : NULL;
+      frame.mFunction = pFrame->scopeName;
+      frame.mCodeFile = NULL;
+      gSampleFrames.push_back( frame );
+   }
+
+   // Code executing outside of a function has no frame of its own.
+   if ( !inFunction || gSampleFrames.empty() )
+   {
+      ProfileFrame frame;
+      frame.mNamespace = NULL;
+      frame.mFunction = NULL;
+      frame.mCodeFile = pCodeBlock->name;
+      gSampleFrames.push_back( frame );
+   }
+
+   const U32 sampleIndex = smSampleCount++;
+
+   // Attribute the sample to the call stack.
+   findStackRecord( gSampleFrames ).mSampleCount++;
+
+   // Attribute the sample to the functions.  Recursive functions are only counted once.
+   for ( S32 frameIndex = 0; frameIndex < gSampleFrames.size(); ++frameIndex )
+   {
+      FunctionRecord& record = findFunctionRecord( gSampleFrames[frameIndex] );
+      if ( record.mLastSample != sampleIndex )
+      {
+         record.mLastSample = sampleIndex;
+         record.mTotalCount++;
+      }
+
+      if ( frameIndex == gSampleFrames.size() - 1 )
+         record.mSelfCount++;
+   }
+
+   // Attribute the sample to the line being executed.
+   U32 line;
+   U32 instruction;
+   pCodeBlock->findBreakLine( ip, line, instruction );
+   findLineRecord( pCodeBlock->name, line ).mSampleCount++;
+}
+
+//-----------------------------------------------------------------------------
+
+void ScriptProfiler::dumpToConsole( const U32 maxEntries )
+{
+   if ( smSampleCount == 0 )
+   {
+      Con::printf( "Script Profiler: No samples." );
+      return;
+   }
+
+   const F32 sampleScale = 100.0f / (F32)smSampleCount;
+
+   // Sort the functions by self samples.
+   Vector<FunctionRecord*> functions;
+   for ( S32 index = 0; index < gFunctionRecords.size(); ++index )
+      functions.push_back( &gFunctionRecords[index] );
+   dQsort( functions.address(), functions.size(), sizeof(FunctionRecord*), compareFunctionRecords );
+
+   Con::printf( "Script Profiler: %d samples at %dms intervals.", smSampleCount, smSampleInterval );
+   Con::printf( "" );
+   Con::printf( "Functions ordered by self samples -" );
+   Con::printf( " %%Self  %%Total    Self#   Total#  Function" );
+
+   char frameBuffer[MaxFrameLabelLength];
+   for ( S32 index = 0; index < functions.size() && (U32)index < maxEntries; ++index )
+   {
+      const FunctionRecord* pRecord = functions[index];
+      formatFrame( pRecord->mFrame, frameBuffer, sizeof(frameBuffer) );
+      Con::printf( "%7.3f %7.3f %8d %8d  %s",
+         pRecord->mSelfCount * sampleScale, pRecord->mTotalCount * sampleScale,
+         pRecord->mSelfCount, pRecord->mTotalCount, frameBuffer );
+   }
+
+   // Sort the lines by samples.
+   Vector<LineRecord*> lines;
+   for ( S32 index = 0; index < gLineRecords.size(); ++index )
+      lines.push_back( &gLineRecords[index] );
+   dQsort( lines.address(), lines.size(), sizeof(LineRecord*), compareLineRecords );
+
+   Con::printf( "" );
+   Con::printf( "Lines ordered by samples -" );
+   Con::printf( " %%Self    Self#  Line" );
+
+   for ( S32 index = 0; index < lines.size() && (U32)index < maxEntries; ++index )
+   {
+      const LineRecord* pRecord = lines[index];
+      Con::printf( "%7.3f %8d  %s:%d",
+         pRecord->mSampleCount * sampleScale, pRecord->mSampleCount,
+         pRecord->mCodeFile ? pRecord->mCodeFile : "<eval>", pRecord->mLine );
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+bool ScriptProfiler::dumpFoldedStacks( const char* pFileName )
+{
+   FileStream fileStream;
+   if ( !fileStream.open( pFileName, FileStream::Write ) )
+   {
+      Con::warnf( "ScriptProfiler::dumpFoldedStacks() - Could not open '%s' for write.", pFileName );
+      return false;
+   }
+
+   char lineBuffer[4096];
+   for ( S32 index = 0; index < gStackRecords.size(); ++index )
+   {
+      const S32 length = formatStackRecord( gStackRecords[index], lineBuffer, sizeof(lineBuffer) );
+      if ( length < 0 )
+      {
+         Con::warnf( "ScriptProfiler::dumpFoldedStacks() - Skipping a call stack too deep to format." );
+         continue;
+      }
+
+      fileStream.write( length, lineBuffer );
+   }
+
+   fileStream.close();
+   return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool ScriptProfiler::getFoldedStacks( char* pBuffer, S32 bufferSize )
+{
+   // Sanity!
+   AssertFatal( bufferSize > 0, "ScriptProfiler::getFoldedStacks() - Invalid buffer size." );
+
+   pBuffer[0] = 0;
+
+   for ( S32 index = 0; index < gStackRecords.size(); ++index )
+   {
+      const S32 length = formatStackRecord( gStackRecords[index], pBuffer, bufferSize );
+      if ( length < 0 )
+      {
+         pBuffer[0] = 0;
+         return false;
+      }
+
+      pBuffer += length;
+      bufferSize -= length;
+   }
+
+   return true;
+}
@@ -0,0 +1,107 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCRIPT_PROFILER_H_
+#define _SCRIPT_PROFILER_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+class CodeBlock;
+class Thread;
+
+/// The ScriptProfiler is a sampling profiler for script execution.
+///
+/// Whilst running, a sampler thread periodically flags that a sample is due.  The
+/// interpreter notices the flag between instructions and records the current script
+/// call stack along with the code file and line being executed.  Samples are aggregated
+/// per function (self and total), per line and per unique call stack.  Time spent
+/// outside of any script is not sampled.
+///
+/// Examples of script use:
+/// @code
+/// scriptProfilerStart(1);                         // start sampling every millisecond
+/// scriptProfilerStop();                           // stop sampling
+/// scriptProfilerReset();                          // clear the gathered samples
+/// scriptProfilerDump(20);                         // dump the top 20 functions and lines to the console
+/// scriptProfilerDumpFolded("profile.folded");     // dump call stacks for flame graph tools
+/// @endcode
+///
+/// The folded output has one line per unique call stack in the form "outer;inner;leaf count"
+/// which is the input format of the common flame graph tools.
+class ScriptProfiler
+{
+public:
+   enum
+   {
+      DefaultSampleInterval = 1,
+      MaxSampleInterval = 1000
+   };
+
+   /// Start sampling at the specified interval (in milliseconds).
+   static void start( const U32 sampleInterval = DefaultSampleInterval );
+
+   /// Stop sampling.  The gathered samples are retained.
+   static void stop( void );
+
+   /// Discard all the gathered samples.
+   static void reset( void );
+
+   static bool isRunning( void ) { return smpSampleThread != NULL; }
+   static U32 getSampleCount( void ) { return smSampleCount; }
+
+   /// Dump the functions and lines with the most samples to the console.
+   static void dumpToConsole( const U32 maxEntries );
+
+   /// Write the sampled call stacks to a file in the folded flame graph format.
+   static bool dumpFoldedStacks( const char* pFileName );
+
+   /// Format the sampled call stacks in the folded flame graph format.
+   /// @return Whether the buffer was large enough.
+   static bool getFoldedStacks( char* pBuffer, S32 bufferSize );
+
+   /// Called by the interpreter when entering and leaving script execution.
+   static inline void enterScript( void ) { smScriptDepth++; }
+   static inline void leaveScript( void ) { if ( --smScriptDepth == 0 ) smSamplePending = false; }
+
+   /// Called by the interpreter between instructions.
+   static inline bool isSamplePending( void ) { return smSamplePending; }
+
+   /// Record a sample of the current script call stack.
+   /// @param pCodeBlock The code block being executed.
+   /// @param ip The instruction pointer within the code block.
+   /// @param inFunction Whether the code block is executing a function (with its own stack frame).
+   static void sample( CodeBlock* pCodeBlock, const U32 ip, const bool inFunction );
+
+private:
+   static void sampleThreadFunction( void* pArg );
+
+   static Thread* smpSampleThread;
+   static volatile bool smSampleThreadStop;
+   static volatile bool smSamplePending;
+   static volatile S32 smScriptDepth;
+   static U32 smSampleInterval;
+   static U32 smSampleCount;
+};
+
+#endif // _SCRIPT_PROFILER_H_
@@ -0,0 +1,85 @@
+﻿//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+ConsoleFunctionGroupBegin( ScriptProfiler, "Script sampling profiler functionality.");
+
+/*! @defgroup ScriptProfilerFunctions Script Profiler
+	@ingroup TorqueScriptFunctions
+	@{
+*/
+
+/*! Starts sampling script execution.
+    @param sampleInterval The interval between samples in milliseconds (optional, defaults to 1).
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(scriptProfilerStart, ConsoleVoid, 1, 2, ([sampleInterval]))
+{
+   ScriptProfiler::start( argc > 1 ? dAtoi(argv[1]) : ScriptProfiler::DefaultSampleInterval );
+}
+
+/*! Stops sampling script execution.  The gathered samples are retained.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(scriptProfilerStop, ConsoleVoid, 1, 1, ())
+{
+   ScriptProfiler::stop();
+}
+
+/*! Gets whether the script profiler is sampling.
+    @return Whether the script profiler is sampling.
+*/
+ConsoleFunctionWithDocs(scriptProfilerIsRunning, ConsoleBool, 1, 1, ())
+{
+   return ScriptProfiler::isRunning();
+}
+
+/*! Resets the script profiler, clearing all of its samples.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(scriptProfilerReset, ConsoleVoid, 1, 1, ())
+{
+   ScriptProfiler::reset();
+}
+
+/*! Dumps the functions and lines with the most samples to the console.
+    @param maxEntries The maximum number of functions and lines to dump (optional, defaults to 20).
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(scriptProfilerDump, ConsoleVoid, 1, 2, ([maxEntries]))
+{
+   ScriptProfiler::dumpToConsole( argc > 1 ? dAtoi(argv[1]) : 20 );
+}
+
+/*! Dumps the sampled call stacks to a file in the folded format used by flame graph tools.
+    @param filename The file to write.
+    @return Whether the file was written or not.
+*/
+ConsoleFunctionWithDocs(scriptProfilerDumpFolded, ConsoleBool, 2, 2, (string filename))
+{
+   char pathBuffer[1024];
+   Con::expandPath( pathBuffer, sizeof(pathBuffer), argv[1] );
+   return ScriptProfiler::dumpFoldedStacks( pathBuffer );
+}
+
+ConsoleFunctionGroupEnd( ScriptProfiler );
+
+/*! @} */ // group ScriptProfilerFunctions
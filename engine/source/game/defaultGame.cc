@@ -43,6 +43,7 @@
 #include "network/connectionProtocol.h"
 #include "io/bitStream.h"
 #include "network/telnetConsole.h"
+#include "network/httpRequest.h"
 #include "debug/telnetDebugger.h"
 #include "console/consoleTypes.h"
 #include "math/mathTypes.h"
@@ -53,11 +54,15 @@
 #include "memory/frameAllocator.h"
 #include "game/version.h"
 #include "debug/profiler.h"
+#include "debug/frameStats.h"
 #include "network/serverQuery.h"
 #include "game/defaultGame.h"
 #include "platform/nativeDialogs/msgBox.h"
 #include "platform/nativeDialogs/fileDialog.h"
 #include "memory/safeDelete.h"
+#include "io/filePrefetch.h"
+#include "io/asyncFileIO.h"
+#include "Box2D/Common/b2Timer.h"
 
 #include <stdio.h>
 
@@ -81,6 +86,22 @@
 #include "2d/core/ParticleSystem.h"
 #endif
 
+#ifndef _PLATFORM_THREADS_THREADPOOL_H_
+#include "platform/threads/threadPool.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_JOBSYSTEM_H_
+#include "platform/threads/jobSystem.h"
+#endif
+
+#ifndef _SCENE_SCHEDULER_H_
+#include "2d/scene/SceneScheduler.h"
+#endif
+
+#ifndef _DISPATCHER_H_
+#include "messaging/dispatcher.h"
+#endif
+
 #ifdef TORQUE_OS_IOS
 #include "platformiOS/iOSProfiler.h"
 #endif
@@ -129,27 +150,38 @@ bool initializeLibraries()
 #if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_ANDROID) || defined(TORQUE_OS_EMSCRIPTEN)
    //3MB default is way too big for iPhone!!!
 #ifdef	TORQUE_SHIPPING
-    FrameAllocator::init(256 * 1024);	//256KB for now... but let's test and see!
+    FrameAllocator::init(256 * 1024, 256 * 1024);	//256KB for now... but let's test and see!
 #else
-    FrameAllocator::init(512 * 1024);	//512KB for now... but let's test and see!
+    FrameAllocator::init(512 * 1024, 256 * 1024);	//512KB for now... but let's test and see!
 #endif	//TORQUE_SHIPPING
 #else
     FrameAllocator::init(3 << 20);      // 3 meg frame allocator buffer
 #endif	//TORQUE_OS_IOS
 
-    TextureManager::create();
     ResManager::create();
 
-    // Register known file types here
-    ResourceManager->registerExtension(".jpg", constructBitmapJPEG);
-    ResourceManager->registerExtension(".jpeg", constructBitmapJPEG);
-    ResourceManager->registerExtension(".png", constructBitmapPNG);
-    ResourceManager->registerExtension(".uft", constructNewFont);
-    ResourceManager->registerExtension(".fnt", constructBMFont);
+    // A headless server never renders so has no textures, bitmaps or fonts.
+    if ( Platform::isHeadless() )
+    {
+        TextureManager::mDGLRender = false;
+    }
+    else
+    {
+        TextureManager::create();
+
+        // Register known file types here
+        ResourceManager->registerExtension(".jpg", constructBitmapJPEG);
+        ResourceManager->registerExtension(".jpeg", constructBitmapJPEG);
+        ResourceManager->registerExtension(".png", constructBitmapPNG);
+        ResourceManager->registerExtension(".ktx", constructBitmapKTX);
+        ResourceManager->registerExtension(".dds", constructBitmapDDS);
+        ResourceManager->registerExtension(".uft", constructNewFont);
+        ResourceManager->registerExtension(".fnt", constructBMFont);
 
 #ifdef TORQUE_OS_IOS
-    ResourceManager->registerExtension(".pvr", constructBitmapPVR);
+        ResourceManager->registerExtension(".pvr", constructBitmapPVR);
 #endif	
+    }
    
     Platform::initConsole();
     NetStringTable::create();
@@ -160,6 +192,11 @@ bool initializeLibraries()
     Processor::init();
     Math::init();
 
+#ifdef TORQUE_DEBUG
+    // Check the math functions chosen for this CPU against the C versions.
+    Math::verify();
+#endif
+
     Platform::init();    // platform specific initialization
 
     // Initialize the particle system.
@@ -182,15 +219,26 @@ void shutdownLibraries()
 
     TelnetDebugger::destroy();
     TelnetConsole::destroy();
+    HTTPRequest::shutdown();
 
     Sim::shutdown();
     Platform::shutdown();
 
+    // Destroy the global scene scheduler.
+    SceneScheduler::destroyGlobal();
+
+    // Destroy the global thread pool.
+    ThreadPool::destroyGlobal();
+
+    // Destroy the global job system.
+    JobSystem::destroyGlobal();
+
     NetStringTable::destroy();
     Con::shutdown();
 
     ResManager::destroy();
-    TextureManager::destroy();
+    if ( TextureManager::getManagerState() != TextureManager::NotInitialized )
+        TextureManager::destroy();
 
     // Destroy the stock colors.
     StockColor::destroy();
@@ -336,14 +384,34 @@ void shutdownGame()
 
     // Unregister the asset database.
     AssetDatabase.unregisterObject();
+
+    // Stop prefetching files.
+    FilePrefetch::shutdown();
+
+    // Stop reading files asynchronously.
+    AsyncFileIO::shutdown();
 }
 
 //--------------------------------------------------------------------------
 
 bool DefaultGame::mainInitialize(int argc, const char **argv)
 {
+    // Note the start-up time.
+    const U32 startupTime = Platform::getRealMilliseconds();
+
+    // Is this a headless server?
+    for ( S32 argIndex = 1; argIndex < argc; ++argIndex )
+    {
+        if ( dStricmp( argv[argIndex], "-headless" ) == 0 )
+            Platform::setHeadless( true );
+    }
+
     if(!initializeLibraries())
         return false;
+
+    // Record how long the engine took to initialize before any scripts ran.
+    const U32 librariesTime = Platform::getRealMilliseconds() - startupTime;
+    Con::setIntVariable("$Engine::LibrariesInitTime", librariesTime);
     
 #ifdef TORQUE_OS_EMSCRIPTEN
     // temp hack
@@ -364,6 +432,11 @@ bool DefaultGame::mainInitialize(int argc, const char **argv)
         return false;
     }
 
+    // Report the start-up time.
+    const U32 initializeTime = Platform::getRealMilliseconds() - startupTime;
+    Con::setIntVariable("$Engine::InitTime", initializeTime);
+    Con::printf("Engine initialized in %dms (libraries %dms, game scripts %dms).", initializeTime, librariesTime, initializeTime - librariesTime);
+
     // Start processing ticks.
     setProcessTicks( true );
 
@@ -482,6 +555,11 @@ void DefaultGame::mainLoop( void )
          PROFILE_START(GameProcessEvents);
     Game->processEvents(); // process all non-sim posted events.
          PROFILE_END();
+
+    // Run any jobs that must run on the main thread.
+    if ( JobSystem::hasGlobal() )
+        JobSystem::getGlobal()->processMainThreadJobs();
+
          PROFILE_END();
     
 #ifdef TORQUE_OS_IOS_PROFILE
@@ -524,7 +602,7 @@ void DefaultGame::gameReactivate( void )
    if ( !Input::isActive() )
       Input::reactivate();
 
-   TextureManager::mDGLRender = true;
+   TextureManager::mDGLRender = !Platform::isHeadless();
    if ( Canvas )
       Canvas->resetUpdateRegions();
 }
@@ -599,6 +677,15 @@ void DefaultGame::processTimeEvent(TimeEvent *event)
    Platform::advanceTime(elapsedTime);
    bool tickPass;
 
+   // Start a new frame on the main thread's frame allocator arena.
+   FrameAllocator::resetThreadArena();
+
+   // Raise any memory pressure callbacks.
+   Memory::checkBudgets();
+
+   // Time the simulation and rendering for the frame stats.
+   b2Timer statsTimer;
+
     PROFILE_START(ServerProcess);
 #ifdef TORQUE_OS_IOS_PROFILE
 iPhoneProfilerStart("SERVER_PROC");
@@ -637,6 +724,27 @@ AndroidProfilerStart("SERVER_PROC");
 #endif
     PROFILE_END();
 
+    FrameStats::addTime( FrameStats::StatSimTime, statsTimer.GetMilliseconds() );
+
+    PROFILE_START(DispatchQueuedMessages);
+    Dispatcher::processQueuedMessages();
+    PROFILE_END();
+
+    // Deliver any files read asynchronously.
+    AsyncFileIO::processCompletions();
+
+    // Load a slice of any assets being acquired asynchronously.
+    AssetDatabase.processAsyncAcquires();
+
+    // Unload any idle assets that are due.
+    AssetDatabase.processIdleAssets();
+
+    // Refresh any assets whose files have changed.
+    AssetDatabase.processFileChanges();
+
+    // Load the next modules of any module groups being loaded asynchronously.
+    ModuleDatabase.processAsyncGroupLoads();
+
    PROFILE_START(ClientProcess);
 #ifdef TORQUE_OS_IOS_PROFILE
     iPhoneProfilerStart("CLIENT_PROC");
@@ -646,7 +754,9 @@ AndroidProfilerStart("SERVER_PROC");
 #endif
 
    PROFILE_START(TickableAdvanceTime);
+   statsTimer.Reset();
    Tickable::advanceTime(elapsedTime);	
+   FrameStats::addTime( FrameStats::StatSimTime, statsTimer.GetMilliseconds() );
    PROFILE_END();
 
    // Milliseconds between audio updates.
@@ -656,7 +766,7 @@ AndroidProfilerStart("SERVER_PROC");
    // though it does need to be updated in real time
    static U32 lastAudioUpdate = 0;
    U32 realTime = Platform::getRealMilliseconds();
-   if((realTime - lastAudioUpdate) >= AudioUpdatePeriod)
+   if(!Platform::isHeadless() && (realTime - lastAudioUpdate) >= AudioUpdatePeriod)
    {
       alxUpdate();
       lastAudioUpdate = realTime;
@@ -686,7 +796,9 @@ AndroidProfilerStart("GL_RENDER");
          preRenderOnly = true;
 
       PROFILE_START(RenderFrame);
+      statsTimer.Reset();
       Canvas->renderFrame(preRenderOnly);
+      FrameStats::addTime( FrameStats::StatRenderTime, statsTimer.GetMilliseconds() );
       PROFILE_END();
       gFrameCount++;
 #ifdef TORQUE_OS_IOS_PROFILE
@@ -702,6 +814,15 @@ AndroidProfilerEnd("GL_RENDER");
     updateVolume();
 #endif
    PROFILE_END();
+
+   // Record the frame stats.
+   FrameStats::endFrame();
+
+   // Wait for the next frame (outside of the profile so sleeping isn't counted as work).
+   // Frames that render nothing can wait for the next simulation work.
+   paceFrame( !(Canvas && TextureManager::mDGLRender) );
+
+   FrameStats::beginFrame();
 }
 
 //--------------------------------------------------------------------------
@@ -26,6 +26,8 @@
 #include "io/fileStream.h"
 #include "console/console.h"
 #include "platform/threads/mutex.h"
+#include "platform/Tickable.h"
+#include "sim/simBase.h"
 
 // Script binding.
 #include "game/gameInterface_ScriptBinding.h"
@@ -54,9 +56,70 @@ GameInterface::GameInterface()
    mJournalMode = JournalOff;
    mRunning = true;
    mRequiresRestart = false;
+   mTargetFrameRate = 0;
+   mNextFrameTime = 0.0;
+   mFrameStartTime = 0;
+   mFrameWorkTime = 0.0f;
+   mMaxIdleSleep = 100;
    if(!gGameEventQueueMutex)
       gGameEventQueueMutex = Mutex::createMutex();
    eventQueue = &eventQueue1;
+   mCoalesceMoves = true;
+   moveHistory = &moveHistory1;
+   frameMoveHistory = &moveHistory2;
+}
+
+//-----------------------------------------------------------------------------
+
+void GameInterface::paceFrame( const bool idle )
+{
+   // Milliseconds before the frame is due at which to stop sleeping and start yielding.
+   // Sleeps are only accurate to the scheduler granularity so yielding for the remainder avoids overshooting.
+   const U32 spinPeriod = 2;
+
+   const U32 currentTime = Platform::getRealMilliseconds();
+
+   // Record the time spent working on this frame.
+   if ( mFrameStartTime != 0 )
+      mFrameWorkTime = (F32)(currentTime - mFrameStartTime);
+
+   U32 dueTime = currentTime;
+
+   if ( mTargetFrameRate > 0 )
+   {
+      const F64 framePeriod = 1000.0 / (F64)mTargetFrameRate;
+
+      // Schedule the next frame.
+      // NOTE: Restart the schedule if we've fallen more than a frame behind so that we don't race to catch up.
+      mNextFrameTime += framePeriod;
+      if ( mNextFrameTime + framePeriod < (F64)currentTime || mNextFrameTime > (F64)currentTime + framePeriod )
+         mNextFrameTime = (F64)currentTime + framePeriod;
+
+      dueTime = (U32)mNextFrameTime;
+   }
+
+   // An idle frame has nothing to do until the next tick or scheduled event so can wait for them.
+   if ( idle && mMaxIdleSleep > 0 )
+   {
+      const U32 idleTime = getMin( mMaxIdleSleep, getMin( Tickable::getTimeToNextTick(), Sim::getTimeToNextEvent() ) );
+      if ( (S32)(currentTime + idleTime - dueTime) > 0 )
+         dueTime = currentTime + idleTime;
+   }
+
+   if ( dueTime != currentTime )
+   {
+      // Sleep for most of the remaining time.
+      const S32 remainingTime = (S32)(dueTime - currentTime);
+      if ( remainingTime > (S32)spinPeriod )
+         Platform::sleep( remainingTime - spinPeriod );
+
+      // Yield until the frame is due.
+      while ( (S32)(dueTime - Platform::getRealMilliseconds()) > 0 )
+         Platform::sleep( 0 );
+   }
+
+   // The next frame starts now.
+   mFrameStartTime = Platform::getRealMilliseconds();
 }
 
 //-----------------------------------------------------------------------------
@@ -133,6 +196,14 @@ void GameInterface::postEvent(Event &event)
    }
 #endif //TORQUE_ALLOW_JOURNALING 
 
+   // Merge moves into those already queued.
+   // NOTE: Journals record every event and are played back without coalescing so they are not merged.
+   if(mCoalesceMoves && mJournalMode == JournalOff && coalesceEvent(event))
+   {
+      Mutex::unlockMutex(gGameEventQueueMutex);
+      return;
+   }
+
    // Create a deep copy of event, and save a pointer to the copy in a vector.
    Event* copy = (Event*)dMalloc(event.size);
    dMemcpy(copy, &event, event.size);
@@ -141,6 +212,101 @@ void GameInterface::postEvent(Event &event)
    Mutex::unlockMutex(gGameEventQueueMutex);   
 }
 
+bool GameInterface::coalesceEvent(const Event &event)
+{
+   if(event.type == MouseMoveEventType)
+   {
+      const MouseMoveEvent &moveEvent = static_cast<const MouseMoveEvent&>(event);
+      MoveSample sample = { MouseMoveId, moveEvent.xPos, moveEvent.yPos };
+      moveHistory->push_back(sample);
+
+      // Only the last queued event can be replaced so that moves stay in order with button presses.
+      if(eventQueue->size() == 0 || eventQueue->last()->type != MouseMoveEventType)
+         return false;
+
+      MouseMoveEvent *queued = static_cast<MouseMoveEvent*>(eventQueue->last());
+      if(queued->modifier != moveEvent.modifier)
+         return false;
+
+      *queued = moveEvent;
+      return true;
+   }
+
+   if(event.type == ScreenTouchEventType)
+   {
+      const ScreenTouchEvent &touchEvent = static_cast<const ScreenTouchEvent&>(event);
+      if(touchEvent.action != SI_MOVE)
+         return false;
+
+      MoveSample sample = { touchEvent.touchID, touchEvent.xPos, touchEvent.yPos };
+      moveHistory->push_back(sample);
+
+      // Look back through the touch moves queued since any other event for one from the same touch.
+      for(S32 i = eventQueue->size() - 1; i >= 0; i--)
+      {
+         if((*eventQueue)[i]->type != ScreenTouchEventType)
+            return false;
+
+         ScreenTouchEvent *queued = static_cast<ScreenTouchEvent*>((*eventQueue)[i]);
+         if(queued->action != SI_MOVE)
+            return false;
+
+         if(queued->touchID == touchEvent.touchID)
+         {
+            *queued = touchEvent;
+            return true;
+         }
+      }
+
+      return false;
+   }
+
+   if(event.type == InputEventType)
+   {
+      // Touch moves for the action maps carry every moving finger so only those for the same fingers are replaced.
+      const InputEvent &inputEvent = static_cast<const InputEvent&>(event);
+      if(inputEvent.deviceType != ScreenTouchDeviceType || inputEvent.objType != SI_TOUCHMOVE)
+         return false;
+
+      if(eventQueue->size() == 0 || eventQueue->last()->type != InputEventType)
+         return false;
+
+      InputEvent *queued = static_cast<InputEvent*>(eventQueue->last());
+      if(queued->deviceType != ScreenTouchDeviceType || queued->objType != SI_TOUCHMOVE || dStrcmp(queued->fingerIDs, inputEvent.fingerIDs) != 0)
+         return false;
+
+      *queued = inputEvent;
+      return true;
+   }
+
+   return false;
+}
+
+void GameInterface::getMoveHistory(const S32 id, Vector<Point2I>& positions) const
+{
+   positions.clear();
+
+   for(S32 i = 0; i < frameMoveHistory->size(); i++)
+   {
+      const MoveSample &sample = (*frameMoveHistory)[i];
+      if(sample.id == id)
+         positions.push_back(Point2I(sample.x, sample.y));
+   }
+}
+
+void GameInterface::dispatchEvent(Event &event)
+{
+#ifdef TORQUE_ALLOW_JOURNALING
+   if(mJournalMode != JournalOff)
+   {
+      postEvent(event);
+      return;
+   }
+#endif //TORQUE_ALLOW_JOURNALING
+
+   processEvent(&event);
+}
+
 
 
 
@@ -157,6 +323,12 @@ void GameInterface::processEvents()
          eventQueue = &eventQueue2;
       else
          eventQueue = &eventQueue1;
+
+      // The history of the moves being processed is kept until the next events are.
+      Vector<MoveSample> *fullMoveHistory = moveHistory;
+      moveHistory = frameMoveHistory;
+      moveHistory->clear();
+      frameMoveHistory = fullMoveHistory;
    Mutex::unlockMutex(gGameEventQueueMutex);
 
    // Walk the event queue in fifo order, processing the events, then clear the queue.
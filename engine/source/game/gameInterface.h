@@ -25,6 +25,7 @@
 
 #include "platform/event.h"
 #include "collection/vector.h"
+#include "math/mPoint.h"
 
 class FileStream;
 
@@ -41,8 +42,29 @@ private:
    bool mJournalBreak;
    bool mRequiresRestart;
 
+   /// Frame pacing.
+   U32 mTargetFrameRate;
+   F64 mNextFrameTime;
+   U32 mFrameStartTime;
+   F32 mFrameWorkTime;
+   U32 mMaxIdleSleep;
+
    /// Events are stored here by any thread, for processing by the main thread.
    Vector<Event*> eventQueue1, eventQueue2, *eventQueue;
+
+   /// A position reported by a mouse or touch move.
+   struct MoveSample
+   {
+      S32 id;
+      S32 x, y;
+   };
+
+   /// Move coalescing.
+   bool mCoalesceMoves;
+   Vector<MoveSample> moveHistory1, moveHistory2, *moveHistory, *frameMoveHistory;
+
+   /// Replace a queued move with a newer one from the same source.  The queue must be locked.
+   bool coalesceEvent(const Event &event);
    
 public:
    GameInterface();
@@ -67,10 +89,32 @@ public:
    /// Place an event in Game's event queue.
    virtual void postEvent(Event &event);
 
+   /// Process an event raised on the main thread immediately rather than queuing it.
+   ///
+   /// This avoids copying the event into the queue.  Whilst journaling, the event is
+   /// posted instead so that it is recorded and played back in order.
+   void dispatchEvent(Event &event);
+
    /// Process all the events in Game's event queue. Only the main thread should call this.
    virtual void processEvents();
    /// @}
 
+   /// @name Move Coalescing
+   /// Devices can report moves far more often than frames are rendered.  When coalescing, a
+   /// move replaces one from the same mouse or touch that is still queued so that only the
+   /// latest position each frame is processed.  Every position is kept in the move history.
+   /// @{
+
+   /// The id of mouse moves in the move history.  Touch moves use their touch id.
+   enum { MouseMoveId = -1 };
+
+   inline void setCoalesceMoves( const bool coalesce ) { mCoalesceMoves = coalesce; }
+   inline bool getCoalesceMoves( void ) const { return mCoalesceMoves; }
+
+   /// Fetch the positions, oldest first, reported by a mouse or touch in the events being processed.
+   void getMoveHistory( const S32 id, Vector<Point2I>& positions ) const;
+   /// @}
+
    /// @name Event Handlers
    /// default event behavior with journaling support
    /// default handler forwards events to appropriate routines
@@ -97,6 +141,29 @@ public:
    inline bool requiresRestart( void ) const { return mRequiresRestart; }
    /// @}
 
+   /// @name Frame Pacing
+   /// Caps the frame rate by sleeping at the end of each frame until the next frame is due.
+   /// Frames that render nothing, such as those of a dedicated server, also sleep until the
+   /// next tick or scheduled event is due so an idle process uses almost no CPU.
+   /// @{
+
+   /// Set the frame rate to cap at or zero for no cap.
+   inline void setTargetFrameRate( const U32 frameRate ) { mTargetFrameRate = frameRate; mNextFrameTime = 0.0; }
+   inline U32 getTargetFrameRate( void ) const { return mTargetFrameRate; }
+
+   /// Fetch the milliseconds spent working on the last frame i.e. excluding any pacing sleep.
+   inline F32 getFrameWorkTime( void ) const { return mFrameWorkTime; }
+
+   /// Set the longest an idle frame may sleep for or zero to never sleep on idle frames.
+   /// This bounds the latency of work that isn't scheduled, such as network packets and console input.
+   inline void setMaxIdleSleep( const U32 milliseconds ) { mMaxIdleSleep = milliseconds; }
+   inline U32 getMaxIdleSleep( void ) const { return mMaxIdleSleep; }
+
+   /// Sleep until the next frame is due.  Called once at the end of every frame.
+   /// @param idle Whether the frame rendered nothing so can sleep until the next simulation work is due.
+   void paceFrame( const bool idle );
+   /// @}
+
    /// @name Journaling
    ///
    /// Journaling is used in order to make a "demo" of the actual game.  It logs
@@ -46,3 +46,94 @@ ConsoleFunctionWithDocs( playJournal, ConsoleVoid, 2, 3, ( namedFile , doBreak )
 }
 
 #endif //TORQUE_ALLOW_JOURNALING
+
+//-----------------------------------------------------------------------------
+
+/*! Sets the frame rate to cap at.
+    At the end of each frame the engine sleeps until the next frame is due which saves power and gives an even frame cadence.
+    @param frameRate The frame rate to cap at or zero for no cap.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs( setTargetFrameRate, ConsoleVoid, 2, 2, ( frameRate ))
+{
+   const S32 frameRate = dAtoi(argv[1]);
+   Game->setTargetFrameRate( frameRate > 0 ? (U32)frameRate : 0 );
+}
+
+/*! Gets the frame rate to cap at.
+    @return The frame rate to cap at or zero for no cap.
+*/
+ConsoleFunctionWithDocs( getTargetFrameRate, ConsoleInt, 1, 1, ())
+{
+   return Game->getTargetFrameRate();
+}
+
+/*! Sets the longest a frame that renders nothing, such as a frame of a dedicated server, may sleep for.
+    Such frames sleep until the next tick or scheduled event is due, or this long if sooner, so an idle process uses almost no CPU.
+    @param milliseconds The longest an idle frame may sleep for or zero to never sleep on idle frames.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs( setMaxIdleSleep, ConsoleVoid, 2, 2, ( milliseconds ))
+{
+   const S32 milliseconds = dAtoi(argv[1]);
+   Game->setMaxIdleSleep( milliseconds > 0 ? (U32)milliseconds : 0 );
+}
+
+/*! Gets the longest a frame that renders nothing may sleep for.
+    @return The longest an idle frame may sleep for in milliseconds or zero if idle frames never sleep.
+*/
+ConsoleFunctionWithDocs( getMaxIdleSleep, ConsoleInt, 1, 1, ())
+{
+   return Game->getMaxIdleSleep();
+}
+
+/*! Gets the time spent working on the last frame excluding any frame pacing sleep.
+    @return The time spent working on the last frame in milliseconds.
+*/
+ConsoleFunctionWithDocs( getFrameWorkTime, ConsoleFloat, 1, 1, ())
+{
+   return Game->getFrameWorkTime();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets whether mouse and touch moves reported faster than the frame rate are merged so that only the latest position each frame is processed.
+    Every position reported remains available from getMoveHistory().  Moves are not merged whilst journaling.
+    @param coalesce Whether to merge moves (on by default).
+    @return No return value.
+*/
+ConsoleFunctionWithDocs( setCoalesceMoves, ConsoleVoid, 2, 2, ( coalesce ))
+{
+   Game->setCoalesceMoves( dAtob(argv[1]) );
+}
+
+/*! Gets whether mouse and touch moves are merged.
+    @return Whether moves are merged.
+*/
+ConsoleFunctionWithDocs( getCoalesceMoves, ConsoleBool, 1, 1, ())
+{
+   return Game->getCoalesceMoves();
+}
+
+/*! Gets every position reported by the mouse or a touch in the events being processed this frame, including those merged into later moves.
+    @param touchId The touch id or -1 for the mouse (the default).
+    @return The positions, oldest first, as a space separated list of "x y" pairs.
+*/
+ConsoleFunctionWithDocs( getMoveHistory, ConsoleString, 1, 2, ( [touchId] ))
+{
+   Vector<Point2I> positions;
+   Game->getMoveHistory( argc > 1 ? dAtoi(argv[1]) : GameInterface::MouseMoveId, positions );
+
+   // Each position needs at most 24 characters.
+   const U32 bufferSize = positions.size() * 24 + 1;
+   char* pBuffer = Con::getReturnBuffer( bufferSize );
+   pBuffer[0] = 0;
+
+   U32 length = 0;
+   for( S32 i = 0; i < positions.size(); i++ )
+   {
+      length += dSprintf( pBuffer + length, bufferSize - length, i == 0 ? "%d %d" : " %d %d", positions[i].x, positions[i].y );
+   }
+
+   return pBuffer;
+}
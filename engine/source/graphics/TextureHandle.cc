@@ -22,6 +22,7 @@
 
 #include "graphics/TextureHandle.h"
 #include "graphics/TextureManager.h"
+#include "graphics/dgl.h"
 #include "platform/platformAssert.h"
 
 //-----------------------------------------------------------------------------
@@ -86,6 +87,20 @@ bool TextureHandle::set( const char* pTextureKey, GBitmap *bmp, TextureHandleTyp
 
 //-----------------------------------------------------------------------------
 
+bool TextureHandle::setAsync( const char* pTextureKey, bool clampToEdge )
+{
+    TextureObject* newObject = TextureManager::loadTexture(pTextureKey, BitmapTexture, clampToEdge, false, false, true );
+    if (newObject != object)
+    {
+        unlock();
+        object = newObject;
+        lock();
+    }
+    return (object != NULL);
+}
+
+//-----------------------------------------------------------------------------
+
 void TextureHandle::refresh( void )
 {
     TextureManager::refresh(object);
@@ -114,6 +129,13 @@ U32 TextureHandle::getHeight( void ) const
 
 //-----------------------------------------------------------------------------
 
+U32 TextureHandle::getResidentSize( void ) const
+{
+    return (object ? (U32)object->mTextureResidentSize : 0);
+}
+
+//-----------------------------------------------------------------------------
+
 GBitmap* TextureHandle::getBitmap( void )
 {
     return (object ? object->mpBitmap : NULL);
@@ -130,7 +152,14 @@ const GBitmap* TextureHandle::getBitmap( void ) const
 
 U32 TextureHandle::getGLName( void ) const
 {
-    return object == NULL ? 0 : object->mGLTextureName;
+    return object == NULL ? 0 : object->getGLTextureName();
+}
+
+//-----------------------------------------------------------------------------
+
+bool TextureHandle::getPending( void ) const
+{
+    return object == NULL ? false : object->mPending;
 }
 
 //-----------------------------------------------------------------------------
@@ -148,10 +177,63 @@ void TextureHandle::setFilter( const GLuint filter )
     if ( object->mGLTextureName == 0 )
         return;
 
+    // Reload the texture if the filter samples a mip chain that hasn't been uploaded.
+    if ( TextureManager::isMipFilter( filter ) && object->mMipLevelCount <= 1 && object->mMipCapable && TextureManager::reloadTexture( object ) )
+        return;
+
     // Set texture state.
-    glBindTexture( GL_TEXTURE_2D, object->mGLTextureName );
-    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter );
-    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter );
+    // Fall back to the equivalent filter if there's no mip chain.
+    dglBindTexture( GL_TEXTURE_2D, object->mGLTextureName );
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, TextureManager::getNonMipFilter( filter ) );
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, object->mMipLevelCount > 1 ? filter : TextureManager::getNonMipFilter( filter ) );
+}
+
+//-----------------------------------------------------------------------------
+
+void TextureHandle::setMipStreaming( const bool streaming )
+{
+    // Finish if no object or no change.
+    if ( object == NULL || object->mMipStreaming == streaming )
+        return;
+
+    // Set streaming.
+    object->mMipStreaming = streaming;
+    object->mMipRequiredLevel = TextureObject::MipLevelUnused;
+    object->mMipCoarserTime = 0;
+
+    // Restore the top level if streaming had dropped it.
+    if ( !streaming && object->mMipBaseLevel > 0 )
+    {
+        object->mMipBaseLevel = 0;
+
+        if ( object->mGLTextureName != 0 )
+            TextureManager::reloadTexture( object );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+bool TextureHandle::getMipStreaming( void ) const
+{
+    return object == NULL ? false : object->mMipStreaming;
+}
+
+//-----------------------------------------------------------------------------
+
+void TextureHandle::setCritical( const bool critical )
+{
+    // Finish if no object.
+    if ( object == NULL )
+        return;
+
+    TextureManager::setTextureCritical( object, critical );
+}
+
+//-----------------------------------------------------------------------------
+
+bool TextureHandle::getCritical( void ) const
+{
+    return object == NULL ? false : object->mCritical;
 }
 
 //-----------------------------------------------------------------------------
@@ -170,7 +252,7 @@ void TextureHandle::setClamp( const bool clamp )
         return;
 
     // Set texture state.
-    glBindTexture(GL_TEXTURE_2D, object->mGLTextureName);
+    dglBindTexture(GL_TEXTURE_2D, object->mGLTextureName);
     GLenum glClamp;
     if ( clamp )
         glClamp = dglDoesSupportEdgeClamp() ? GL_CLAMP_TO_EDGE : GL_CLAMP;
@@ -105,6 +105,11 @@ class TextureObject;
 ///
 /// Also note the operator TextureObject*, as you can actually cast
 /// a TextureHandle to a TextureObject* if necessary.
+///
+/// If "$pref::OpenGL::asyncTextureLoading" is set then bitmap textures
+/// are decoded in the background and uploaded over subsequent frames.
+/// Until then the handle is pending; its dimensions are valid but it
+/// binds a transparent placeholder texture.
 class TextureHandle
 {    
 public:
@@ -156,6 +161,9 @@ public:
 
     bool set(const char* pTextureKey, GBitmap *bmp, TextureHandleType type, bool clampToEdge = false);
 
+    /// Sets a bitmap texture that is decoded in the background whether or not asynchronous loading is on.
+    bool setAsync(const char* pTextureKey, bool clampToEdge = false);
+
     bool operator==( const TextureHandle& handle ) const { return handle.object == object; }
 
     bool operator!=( const TextureHandle& handle ) const { return handle.object != object; }
@@ -164,6 +172,15 @@ public:
 
     void setFilter( const GLuint filter );
 
+    /// Sets whether only the mip levels needed for the on-screen texel density are uploaded.
+    void setMipStreaming( const bool streaming );
+    bool getMipStreaming( void ) const;
+
+    /// Sets whether a compressed copy of the bitmap is kept so the texture can be restored without reading its file.
+    /// Critical textures are also restored immediately after the context is lost rather than when next used.
+    void setCritical( const bool critical );
+    bool getCritical( void ) const;
+
     void clear( void ) { unlock(); }
 
     void refresh( void );
@@ -177,6 +194,8 @@ public:
     GBitmap* getBitmap( void );
     const GBitmap* getBitmap( void ) const;
     U32 getGLName( void ) const;
+    U32 getResidentSize( void ) const;
+    bool getPending( void ) const;
 
 private:
     void lock( void );
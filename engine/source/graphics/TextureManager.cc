@@ -24,6 +24,7 @@
 
 #include "platform/platformAssert.h"
 #include "platform/platformGL.h"
+#include "graphics/dgl.h"
 #include "platform/platform.h"
 #include "collection/vector.h"
 #include "io/resource/resourceManager.h"
@@ -32,7 +33,16 @@
 #include "console/consoleInternal.h"
 #include "console/consoleTypes.h"
 #include "memory/safeDelete.h"
+#include "memory/frameAllocator.h"
+#include "memory/factoryCache.h"
 #include "math/mMath.h"
+#include "io/memstream.h"
+#include "platform/threads/thread.h"
+#include "platform/threads/mutex.h"
+#include "platform/threads/semaphore.h"
+#include "debug/profiler.h"
+
+#include "zlib.h"
 
 #include "TextureManager_ScriptBinding.h"
 
@@ -44,6 +54,20 @@ bool TextureManager::mDGLRender = true;
 bool TextureManager::mForce16BitTexture = false;
 bool TextureManager::mAllowTextureCompression = false;
 bool TextureManager::mDisableTextureSubImageUpdates = false;
+bool TextureManager::mAsyncTextureLoading = false;
+S32 TextureManager::mTextureUploadBudget = 4 * 1024 * 1024;
+S32 TextureManager::mTextureDecodeThreads = 2;
+S32 TextureManager::mTexturePendingCount = 0;
+S32 TextureManager::mTextureBudget = 0;
+F32 TextureManager::mTextureEvictionDelay = 30.0f;
+S32 TextureManager::mTextureEvictedCount = 0;
+U32 TextureManager::mLastEvictionTime = 0;
+F32 TextureManager::mMipStreamingDelay = 2.0f;
+bool TextureManager::mLazyTextureResurrection = true;
+S32 TextureManager::mTextureResurrectingCount = 0;
+S32 TextureManager::mRestoreResidentSize = 0;
+GLuint TextureObject::smPendingGLTextureName = 0;
+U32 TextureObject::smUsageTime = 0;
 GLenum TextureManager::mTextureCompressionHint = GL_FASTEST;
 S32 TextureManager::mBitmapResidentSize = 0;
 S32 TextureManager::mTextureResidentSize = 0;
@@ -75,6 +99,43 @@ static const char* extArray[EXT_ARRAY_SIZE] = { "", ".jpg", ".png"};
 
 //---------------------------------------------------------------------------------------------------------------------
 
+// Compressed uploads use the core entry-point on GLES and OSX and the ARB extension elsewhere.
+#if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_ANDROID) || defined(TORQUE_OS_OSX)
+#define COMPRESSED_TEX_IMAGE_2D glCompressedTexImage2D
+#else
+#define COMPRESSED_TEX_IMAGE_2D glCompressedTexImage2DARB
+#endif
+
+#ifndef GL_NUM_COMPRESSED_TEXTURE_FORMATS
+#define GL_NUM_COMPRESSED_TEXTURE_FORMATS   0x86A2
+#define GL_COMPRESSED_TEXTURE_FORMATS       0x86A3
+#endif
+
+/// Compressed container variants are named "<image>.<family>.<container>" e.g. "tiles.astc.ktx"
+/// and are tried in this order of preference if the device supports the family's format.
+struct CompressedFamily
+{
+    const char*             mpName;
+    GBitmap::BitmapFormat   mFormat;
+};
+
+static const CompressedFamily sgCompressedFamilies[] =
+{
+    { "astc",   GBitmap::ASTC4x4 },
+    { "bc",     GBitmap::BC3 },
+    { "etc2",   GBitmap::ETC2A },
+    { "etc1",   GBitmap::ETC1 },
+};
+#define COMPRESSED_FAMILY_COUNT (sizeof(sgCompressedFamilies) / sizeof(CompressedFamily))
+
+#define COMPRESSED_EXT_ARRAY_SIZE 2
+static const char* compressedExtArray[COMPRESSED_EXT_ARRAY_SIZE] = { ".ktx", ".dds" };
+
+static Vector<S32> sgCompressedGLFormats(__FILE__, __LINE__);
+static bool sgCompressedGLFormatsQueried = false;
+
+//---------------------------------------------------------------------------------------------------------------------
+
 struct EventCallbackEntry
 {
     TextureManager::TextureEventCallback callback;
@@ -85,6 +146,183 @@ struct EventCallbackEntry
 static U32                        sgCurrCallbackKey = 0;
 
 static Vector<EventCallbackEntry> sgEventCallbacks(__FILE__, __LINE__);
+static U32                        sgMemoryPressureCallbackKey = 0;
+
+/// Whether the first frame since resurrection has yet to restore the textures it draws.
+static bool                       sgResurrectionDeferred = false;
+
+//--------------------------------------------------------------------------------------------------------------------
+
+/// A bitmap texture being decoded in the background.
+/// The decoder threads only ever touch the file data, the bitmap and the flags (under the pending mutex).
+struct PendingTextureLoad
+{
+    TextureObject*  mpTextureObject;    ///< NULL if the texture was freed before the load completed.
+    U8*             mpFileData;
+    U32             mFileSize;
+    bool            mForce16Bit;
+    bool            mDecoding;
+    bool            mDecoded;
+    GBitmap*        mpBitmap;           ///< NULL if the bitmap could not be decoded.
+};
+
+static Vector<PendingTextureLoad*>  sgPendingLoads(__FILE__, __LINE__);
+static Mutex*                       sgpPendingMutex = NULL;
+static Semaphore*                   sgpDecodeSemaphore = NULL;
+static Vector<Thread*>              sgDecodeThreads(__FILE__, __LINE__);
+static bool                         sgDecodeShutdown = false;
+
+//--------------------------------------------------------------------------------------------------------------------
+
+static inline U32 readBigEndian16( const U8* pData ) { return (pData[0] << 8) | pData[1]; }
+static inline U32 readBigEndian32( const U8* pData ) { return (pData[0] << 24) | (pData[1] << 16) | (pData[2] << 8) | pData[3]; }
+
+//--------------------------------------------------------------------------------------------------------------------
+
+static bool readImageHeader( const U8* pData, const U32 size, U32& width, U32& height, bool& paletted )
+{
+    static const U8 pngSignature[8] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+
+    paletted = false;
+
+    // PNG: the IHDR chunk always immediately follows the signature.
+    if ( size >= 26 && dMemcmp( pData, pngSignature, sizeof(pngSignature) ) == 0 )
+    {
+        width = readBigEndian32( pData + 16 );
+        height = readBigEndian32( pData + 20 );
+        paletted = pData[25] == 3;
+        return width > 0 && height > 0;
+    }
+
+    // Finish if not a JPEG.
+    if ( size < 4 || pData[0] != 0xFF || pData[1] != 0xD8 )
+        return false;
+
+    // JPEG: walk the markers to the start-of-frame.
+    U32 position = 2;
+    while ( position + 4 <= size )
+    {
+        // Finish if the marker is corrupt.
+        if ( pData[position] != 0xFF )
+            return false;
+
+        const U8 marker = pData[position+1];
+
+        // Skip padding and markers without a length.
+        if ( marker == 0xFF )
+        {
+            position++;
+            continue;
+        }
+        if ( marker == 0x01 || (marker >= 0xD0 && marker <= 0xD8) )
+        {
+            position += 2;
+            continue;
+        }
+
+        // Is this a start-of-frame marker?
+        if ( marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC )
+        {
+            if ( position + 9 > size )
+                return false;
+
+            height = readBigEndian16( pData + position + 5 );
+            width = readBigEndian16( pData + position + 7 );
+            return width > 0 && height > 0;
+        }
+
+        position += 2 + readBigEndian16( pData + position + 2 );
+    }
+
+    return false;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+static void decodeThreadFunction( void* )
+{
+    // Attribute allocations on this thread to textures.
+    Memory::setCurrentTag( Memory::TagTextures );
+
+    while( true )
+    {
+        // Wait for work.
+        sgpDecodeSemaphore->acquire();
+
+        // Fetch the next load to decode.
+        sgpPendingMutex->lock();
+
+        // Finish if shutting down.
+        if ( sgDecodeShutdown )
+        {
+            sgpPendingMutex->unlock();
+            FrameAllocator::releaseThreadArena();
+            FactoryCacheBase::releaseThreadCaches();
+            return;
+        }
+
+        PendingTextureLoad* pLoad = NULL;
+        for ( S32 index = 0; index < sgPendingLoads.size(); ++index )
+        {
+            PendingTextureLoad* pProbe = sgPendingLoads[index];
+
+            if ( pProbe->mDecoding || pProbe->mDecoded )
+                continue;
+
+            // Don't bother decoding cancelled loads.
+            if ( pProbe->mpTextureObject == NULL )
+            {
+                pProbe->mDecoded = true;
+                continue;
+            }
+
+            pProbe->mDecoding = true;
+            pLoad = pProbe;
+            break;
+        }
+        sgpPendingMutex->unlock();
+
+        if ( pLoad == NULL )
+            continue;
+
+        // Decode the bitmap.
+        // NOTE: The console is not thread-safe so PNG preferences are applied when the load was queued.
+        MemStream stream( pLoad->mFileSize, pLoad->mpFileData, true, false );
+        GBitmap* pBitmap = new GBitmap();
+        const bool isPNG = pLoad->mpFileData[0] == 137;
+        if ( !(isPNG ? pBitmap->readPNG( stream, false ) : pBitmap->readJPEG( stream )) )
+        {
+            SAFE_DELETE( pBitmap );
+        }
+
+        // Release the file data.
+        dFree( pLoad->mpFileData );
+        pLoad->mpFileData = NULL;
+
+        // Discard any frame allocations made by the decode.
+        FrameAllocator::resetThreadArena();
+
+        // Complete the load.
+        sgpPendingMutex->lock();
+        pLoad->mpBitmap = pBitmap;
+        pLoad->mDecoding = false;
+        pLoad->mDecoded = true;
+        sgpPendingMutex->unlock();
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+static void textureMemoryPressureCallback( const Memory::Tag tag, const Memory::Pressure pressure, void* pUserData )
+{
+    if ( tag != Memory::TagTextures || pressure == Memory::PressureNone )
+        return;
+
+    // Evict the textures that have not been used for the eviction delay or, under hard pressure, that were not used in the last second.
+    const U32 unusedTime = pressure == Memory::PressureHard ? 1000 : (U32)(getMax( TextureManager::getTextureEvictionDelay(), 0.0f ) * 1000.0f);
+    TextureManager::evictUnusedTextures( unusedTime, 0 );
+    Memory::setTagExternalBytes( Memory::TagTextures, TextureManager::getTextureResidentSize() );
+}
 
 //--------------------------------------------------------------------------------------------------------------------
 
@@ -155,6 +393,16 @@ void TextureManager::create()
     Con::addVariable("$pref::OpenGL::force16BitTexture", TypeBool, &TextureManager::mForce16BitTexture);
     Con::addVariable("$pref::OpenGL::allowTextureCompression", TypeBool, &TextureManager::mAllowTextureCompression);
     Con::addVariable("$pref::OpenGL::disableTextureSubImageUpdates", TypeBool, &TextureManager::mDisableTextureSubImageUpdates);
+    Con::addVariable("$pref::OpenGL::asyncTextureLoading", TypeBool, &TextureManager::mAsyncTextureLoading);
+    Con::addVariable("$pref::OpenGL::textureUploadBudget", TypeS32, &TextureManager::mTextureUploadBudget);
+    Con::addVariable("$pref::OpenGL::textureDecodeThreads", TypeS32, &TextureManager::mTextureDecodeThreads);
+    Con::addVariable("$pref::OpenGL::textureBudget", TypeS32, &TextureManager::mTextureBudget);
+    Con::addVariable("$pref::OpenGL::textureEvictionDelay", TypeF32, &TextureManager::mTextureEvictionDelay);
+    Con::addVariable("$pref::OpenGL::mipStreamingDelay", TypeF32, &TextureManager::mMipStreamingDelay);
+    Con::addVariable("$pref::OpenGL::lazyTextureResurrection", TypeBool, &TextureManager::mLazyTextureResurrection);
+
+    // Evict textures under memory pressure.
+    sgMemoryPressureCallbackKey = Memory::registerPressureCallback( textureMemoryPressureCallback, NULL );
 
     // Flag as alive.
     mManagerState = Alive;
@@ -166,14 +414,53 @@ void TextureManager::destroy()
 {
     AssertISV(mManagerState != NotInitialized, "TextureManager::destroy - nothing to destroy!");
 
+    // Stop the decoders.
+    if ( sgDecodeThreads.size() > 0 )
+    {
+        sgpPendingMutex->lock();
+        sgDecodeShutdown = true;
+        sgpPendingMutex->unlock();
+        for ( S32 index = 0; index < sgDecodeThreads.size(); ++index )
+            sgpDecodeSemaphore->release();
+        for ( S32 index = 0; index < sgDecodeThreads.size(); ++index )
+            delete sgDecodeThreads[index];
+        sgDecodeThreads.clear();
+    }
+
+    // Stop evicting textures under memory pressure.
+    Memory::unregisterPressureCallback( sgMemoryPressureCallbackKey );
+    Memory::setTagExternalBytes( Memory::TagTextures, 0 );
+
     // Destroy the texture dictionary.
     TextureDictionary::destroy();
 
+    // Destroy any loads still pending.
+    for ( S32 index = 0; index < sgPendingLoads.size(); ++index )
+    {
+        PendingTextureLoad* pLoad = sgPendingLoads[index];
+        if ( pLoad->mpFileData != NULL )
+            dFree( pLoad->mpFileData );
+        SAFE_DELETE( pLoad->mpBitmap );
+        delete pLoad;
+    }
+    sgPendingLoads.clear();
+    SAFE_DELETE( sgpPendingMutex );
+    SAFE_DELETE( sgpDecodeSemaphore );
+
+    // Delete the pending texture.
+    if ( mDGLRender && TextureObject::smPendingGLTextureName != 0 )
+        dglDeleteTextures(1, &TextureObject::smPendingGLTextureName);
+    TextureObject::smPendingGLTextureName = 0;
+
     // Reset state.
     mBitmapResidentSize = 0;
     mTextureResidentSize = 0;
     mTextureResidentWasteSize = 0;
     mTextureResidentCount = 0;
+    mTexturePendingCount = 0;
+    mTextureEvictedCount = 0;
+    mTextureResurrectingCount = 0;
+    mRestoreResidentSize = 0;
     mMasterTextureKeyIndex = 0;
 
     // Flag as not initialized.
@@ -194,29 +481,45 @@ void TextureManager::killManager()
     // Post zombie event.
     postTextureEvent(BeginZombification);
 
+    // Cancel any pending loads as resurrection loads them immediately.
+    cancelPendingTextures();
+
     Vector<GLuint> deleteNames(4096);
 
+    if (TextureObject::smPendingGLTextureName != 0)
+    {
+        deleteNames.push_back(TextureObject::smPendingGLTextureName);
+        TextureObject::smPendingGLTextureName = 0;
+    }
+
     TextureObject* probe = TextureDictionary::TextureObjectChain;
     while (probe) 
     {
         if (probe->mGLTextureName != 0)
         {
             deleteNames.push_back(probe->mGLTextureName);
+
+            // Adjust metrics.
+            mTextureResidentCount--;
+            mTextureResidentSize -= probe->mTextureResidentSize;
+            probe->mTextureResidentSize = 0;
+            mTextureResidentWasteSize -= probe->mTextureResidentWasteSize;
+            probe->mTextureResidentWasteSize = 0;
         }
         probe->mGLTextureName = 0;
-        
-        // Adjust metrics.
-        mTextureResidentCount--;
-        mTextureResidentSize -= probe->mTextureResidentSize;
-        probe->mTextureResidentSize = 0;
-        mTextureResidentWasteSize -= probe->mTextureResidentWasteSize;
-        probe->mTextureResidentWasteSize = 0;
+
+        // Resurrection reloads evicted textures too unless they're restored when next used anyway.
+        if (probe->mEvicted && !mLazyTextureResurrection)
+        {
+            probe->mEvicted = false;
+            mTextureEvictedCount--;
+        }
 
         probe = probe->next;
     }
 
     // Delete all textures.
-    glDeleteTextures(deleteNames.size(), deleteNames.address());
+    dglDeleteTextures(deleteNames.size(), deleteNames.address());
 }
 
 //--------------------------------------------------------------------------------------------------------------------
@@ -233,6 +536,9 @@ void TextureManager::resurrectManager( void )
     // Post begin resurrection event.
     postTextureEvent(BeginResurrection);
 
+    // Leave the first frame to restore the textures it draws.
+    sgResurrectionDeferred = true;
+
     // Resurrect textures.
     TextureObject* probe = TextureDictionary::TextureObjectChain;
     while (probe) 
@@ -244,12 +550,30 @@ void TextureManager::resurrectManager( void )
                     // Sanity!
                     AssertISV( probe->mTextureKey != NULL && probe->mTextureKey != StringTable->EmptyString, "Encountered a bitmap texture that didn't specify its bitmap." );
 
-                    // Load the bitmap.
-                    GBitmap* pBitmap = loadBitmap( probe->mTextureKey );
+                    // Leave evicted textures to be restored when next used.
+                    if ( probe->mEvicted )
+                        break;
+
+                    // Leave textures that can be read again to be restored when next used unless they're critical.
+                    if ( mLazyTextureResurrection && !probe->mCritical && (probe->mReloadable || probe->mpRestoreData != NULL) )
+                    {
+                        probe->mEvicted = true;
+                        mTextureEvictedCount++;
+                        probe->mResurrecting = true;
+                        mTextureResurrectingCount++;
+                        break;
+                    }
+
+                    // Restore from any compressed copy otherwise load the bitmap.
+                    GBitmap* pBitmap = probe->mpRestoreData != NULL ? createRestoreBitmap( probe ) : NULL;
+                    if ( pBitmap == NULL )
+                        pBitmap = loadBitmap( probe->mTextureKey );
 
                     // Sanity!
                     AssertISV(pBitmap != NULL, "Error resurrecting the texture cache.\n""Possible cause: a bitmap was deleted during the course of gameplay.");
 
+                    pBitmap->mForce16Bit = probe->mForce16Bit;
+
                     // Register texture.
                     TextureObject* pTextureObject;
                     pTextureObject = registerTexture(probe->mTextureKey, pBitmap, probe->mHandleType, probe->mClamp);
@@ -308,6 +632,7 @@ GBitmap* TextureManager::createPowerOfTwoBitmap(GBitmap* pBitmap)
 {    
     // Sanity!
     AssertISV( pBitmap->getFormat() != GBitmap::Palettized, "Paletted bitmaps are not supported." );
+    AssertISV( !pBitmap->isCompressed() || (isPow2(pBitmap->getWidth()) && isPow2(pBitmap->getHeight())), "Compressed bitmaps must be a power-of-two in dimension." );
 
     // Finish if already a power-of-two in dimension.
     if (isPow2(pBitmap->getWidth()) && isPow2(pBitmap->getHeight()))
@@ -352,9 +677,21 @@ GBitmap* TextureManager::createPowerOfTwoBitmap(GBitmap* pBitmap)
 
 void TextureManager::freeTexture( TextureObject* pTextureObject )
 {
+    // Cancel any pending load.
+    cancelPendingTexture( pTextureObject );
+
+    // Forget any eviction.
+    if ( pTextureObject->mEvicted )
+        mTextureEvictedCount--;
+    if ( pTextureObject->mResurrecting )
+        mTextureResurrectingCount--;
+
+    // Delete any compressed copy.
+    freeRestoreData( pTextureObject );
+
     if((mDGLRender || mManagerState == Resurrecting) && pTextureObject->mGLTextureName)
     {
-        glDeleteTextures(1, (const GLuint*)&pTextureObject->mGLTextureName);
+        dglDeleteTextures(1, (const GLuint*)&pTextureObject->mGLTextureName);
 
         // Adjust metrics.
         mTextureResidentCount--;
@@ -381,6 +718,14 @@ void TextureManager::getSourceDestByteFormat(GBitmap *pBitmap, U32 *sourceFormat
 {
     *byteFormat = GL_UNSIGNED_BYTE;
     U32 byteSize = 1;
+
+    // Compressed bitmaps are uploaded as-is.
+    if ( pBitmap->isCompressed() )
+    {
+        *sourceFormat = *destFormat = GBitmap::getCompressedGLFormat( pBitmap->getFormat() );
+        *texelSize = byteSize; // Incorrect but the resident size is taken from the bitmap.
+        return;
+    }
 #if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_ANDROID) || defined(TORQUE_OS_EMSCRIPTEN)
     switch(pBitmap->getFormat()) 
     {
@@ -590,6 +935,10 @@ void TextureManager::refresh( TextureObject* pTextureObject )
     if (!(mDGLRender || mManagerState == Resurrecting))
         return;
 
+    // Finish if the bitmap is still loading.
+    if ( pTextureObject->mPending )
+        return;
+
     // Sanity!
     AssertISV( pTextureObject->mGLTextureName != 0, "Refreshing texture but no texture created." );
     AssertISV( pTextureObject->mpBitmap != 0, "Refreshing texture but no bitmap available." );
@@ -623,6 +972,26 @@ void TextureManager::refresh( TextureObject* pTextureObject )
     bool isCompressed = (pNewBitmap->getFormat() >= GBitmap::PVR2) && (pNewBitmap->getFormat() <= GBitmap::PVR4A);
 #endif
 
+    // Bind texture.
+    dglBindTexture( GL_TEXTURE_2D, pTextureObject->mGLTextureName );
+
+    // Only a single level is uploaded unless a mip chain is uploaded below.
+    pTextureObject->mMipLevelCount = 1;
+    pTextureObject->mMipCapable = false;
+
+    // Is the bitmap block-compressed?
+    if ( pNewBitmap->isCompressed() )
+    {
+        // Yes, so upload as-is.
+        COMPRESSED_TEX_IMAGE_2D(GL_TEXTURE_2D,
+            0,
+            destFormat,
+            pNewBitmap->getWidth(), pNewBitmap->getHeight(),
+            0,
+            pNewBitmap->byteSize,
+            pNewBitmap->getBits());
+    }
+    else
 #if defined(TORQUE_OS_IOS)
     if (isCompressed) {
         switch (pNewBitmap->getFormat()) {
@@ -643,49 +1012,87 @@ void TextureManager::refresh( TextureObject* pTextureObject )
     } else 
 #endif
 
-    // Bind texture.
-    glBindTexture( GL_TEXTURE_2D, pTextureObject->mGLTextureName );
-
-    // Are we forcing to 16-bit?
-    if( pSourceBitmap->mForce16Bit )
     {
-        // Yes, so generate a 16-bit texture.
-        GLint GLformat;
-        GLint GLdata_type;
+        // Only full-color bitmaps can be extruded into a mip chain.
+        const GBitmap::BitmapFormat format = pNewBitmap->getFormat();
+        pTextureObject->mMipCapable = format == GBitmap::RGB || format == GBitmap::RGBA;
+
+        // Extrude a mip chain if the filter samples one or if streaming starts below the top level.
+        const bool uploadMipChain = pTextureObject->mMipCapable && isMipFilter( pTextureObject->mFilter );
+        const U32 mipBaseLevel = pTextureObject->mMipStreaming && pTextureObject->mMipCapable ? pTextureObject->mMipBaseLevel : 0;
+        if ( uploadMipChain || mipBaseLevel > 0 )
+        {
+            // Don't extrude into the source bitmap as it may be kept.
+            if ( pNewBitmap == pSourceBitmap )
+                pNewBitmap = new GBitmap( *pSourceBitmap );
 
-        U16* pBitmap16 = create16BitBitmap( pNewBitmap, pNewBitmap->getWritableBits(), pNewBitmap->getFormat(), 
-                                                &GLformat, &GLdata_type,
-                                                pNewBitmap->getWidth(), pNewBitmap->getHeight() );
+            pNewBitmap->extrudeMipLevels();
+        }
 
-        glTexImage2D(GL_TEXTURE_2D, 
-                        0,
-                        GLformat,
-                        pNewBitmap->getWidth(), pNewBitmap->getHeight(), 
-                        0,
-                        GLformat, 
-                        GLdata_type,
-                        pBitmap16
-                    );
+        // Upload from the base level down to either the last level or just the base level.
+        const U32 firstLevel = getMin( mipBaseLevel, pNewBitmap->getNumMipLevels() - 1 );
+        const U32 lastLevel = uploadMipChain ? pNewBitmap->getNumMipLevels() - 1 : firstLevel;
+        U32 uploadedTexels = 0;
 
-        //copy new texture_data into pBits
-        delete [] pBitmap16;
-    }
-    else
-    {
-        // No, so upload as-is.
-        glTexImage2D(GL_TEXTURE_2D,
-            0,
-            destFormat,
-            pNewBitmap->getWidth(), pNewBitmap->getHeight(),
-            0,
-            sourceFormat,
-            byteFormat,
-            bits);
+        for ( U32 level = firstLevel; level <= lastLevel; ++level )
+        {
+            const U32 levelWidth = pNewBitmap->getWidth( level );
+            const U32 levelHeight = pNewBitmap->getHeight( level );
+            uploadedTexels += levelWidth * levelHeight;
+
+            // Are we forcing to 16-bit?
+            if( pSourceBitmap->mForce16Bit )
+            {
+                // Yes, so generate a 16-bit texture.
+                GLint GLformat;
+                GLint GLdata_type;
+
+                U16* pBitmap16 = create16BitBitmap( pNewBitmap, pNewBitmap->getWritableBits( level ), pNewBitmap->getFormat(), 
+                                                        &GLformat, &GLdata_type,
+                                                        levelWidth, levelHeight );
+
+                glTexImage2D(GL_TEXTURE_2D, 
+                                level - firstLevel,
+                                GLformat,
+                                levelWidth, levelHeight, 
+                                0,
+                                GLformat, 
+                                GLdata_type,
+                                pBitmap16
+                            );
+
+                //copy new texture_data into pBits
+                delete [] pBitmap16;
+            }
+            else
+            {
+                // No, so upload as-is.
+                glTexImage2D(GL_TEXTURE_2D,
+                    level - firstLevel,
+                    destFormat,
+                    levelWidth, levelHeight,
+                    0,
+                    sourceFormat,
+                    byteFormat,
+                    lumBits != NULL ? bits : pNewBitmap->getBits( level ));
+            }
+        }
+
+        pTextureObject->mMipLevelCount = lastLevel - firstLevel + 1;
+
+        // Adjust metrics for the levels actually uploaded.
+        mTextureResidentSize -= pTextureObject->mTextureResidentSize;
+        mTextureResidentWasteSize -= pTextureObject->mTextureResidentWasteSize;
+        pTextureObject->mTextureResidentSize = uploadedTexels * texelSize;
+        pTextureObject->mTextureResidentWasteSize = (((pTextureObject->mTextureWidth * pTextureObject->mTextureHeight)-(pTextureObject->mBitmapWidth * pTextureObject->mBitmapHeight)) >> (firstLevel * 2)) * texelSize;
+        mTextureResidentSize += pTextureObject->mTextureResidentSize;
+        mTextureResidentWasteSize += pTextureObject->mTextureResidentWasteSize;
     }
 
+    // Fall back to the equivalent filter if no mip chain was uploaded.
     const GLuint filter = pTextureObject->getFilter();
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, getNonMipFilter( filter ));
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, pTextureObject->mMipLevelCount > 1 ? filter : getNonMipFilter( filter ));
 
     GLenum glClamp;
     if ( pTextureObject->getClamp() )
@@ -723,6 +1130,10 @@ void TextureManager::refresh( const char *textureName )
     if ( pTextureObject->getHandleType() == TextureHandle::BitmapKeepTexture )
         return;
 
+    // Finish if the bitmap is still loading as it's being read from the file anyway.
+    if ( pTextureObject->mPending )
+        return;
+
     // Load the bitmap.
     GBitmap* pBitmap = loadBitmap( pTextureObject->mTextureKey );
 
@@ -730,6 +1141,9 @@ void TextureManager::refresh( const char *textureName )
     if ( pBitmap == NULL )
         return;
 
+    // Replace any compressed copy with one of the refreshed bitmap.
+    freeRestoreData( pTextureObject );
+
     // Register texture.
     TextureObject* pNewTextureObject;
     pNewTextureObject = registerTexture(pTextureObject->mTextureKey, pBitmap, pTextureObject->mHandleType, pTextureObject->mClamp);
@@ -760,9 +1174,18 @@ void TextureManager::createGLName( TextureObject* pTextureObject )
 
     // Adjust metrics.
     mTextureResidentCount++;
-    pTextureObject->mTextureResidentSize = pTextureObject->mTextureWidth * pTextureObject->mTextureHeight * texelSize;
+    if ( pTextureObject->mpBitmap->isCompressed() )
+    {
+        // Compressed bitmaps are always a power-of-two so there's no waste.
+        pTextureObject->mTextureResidentSize = pTextureObject->mpBitmap->byteSize;
+        pTextureObject->mTextureResidentWasteSize = 0;
+    }
+    else
+    {
+        pTextureObject->mTextureResidentSize = pTextureObject->mTextureWidth * pTextureObject->mTextureHeight * texelSize;
+        pTextureObject->mTextureResidentWasteSize = ((pTextureObject->mTextureWidth * pTextureObject->mTextureHeight)-(pTextureObject->mBitmapWidth * pTextureObject->mBitmapHeight)) * texelSize;
+    }
     mTextureResidentSize += pTextureObject->mTextureResidentSize;
-    pTextureObject->mTextureResidentWasteSize = ((pTextureObject->mTextureWidth * pTextureObject->mTextureHeight)-(pTextureObject->mBitmapWidth * pTextureObject->mBitmapHeight)) * texelSize;
     mTextureResidentWasteSize += pTextureObject->mTextureResidentWasteSize;
 
     // Refresh the texture.
@@ -773,9 +1196,19 @@ void TextureManager::createGLName( TextureObject* pTextureObject )
 
 TextureObject* TextureManager::registerTexture(const char* pTextureKey, GBitmap* pNewBitmap, TextureHandle::TextureHandleType type, bool clampToEdge)
 {
+    // Attribute allocations to textures.
+    Memory::TagScope memoryTag( Memory::TagTextures );
+
     // Sanity!
     AssertISV( type != TextureHandle::InvalidTexture, "Invalid texture type." );
 
+    // Finish if there are no textures such as in a headless server.
+    if ( mManagerState == NotInitialized )
+    {
+        delete pNewBitmap;
+        return NULL;
+    }
+
     TextureObject* pTextureObject = NULL;
 
     // Fetch texture key.
@@ -802,7 +1235,7 @@ TextureObject* TextureManager::registerTexture(const char* pTextureKey, GBitmap*
         // Remove any texture name.
         if ( pTextureObject->mGLTextureName != 0 )
         {
-            glDeleteTextures(1, (const GLuint*)&pTextureObject->mGLTextureName);
+            dglDeleteTextures(1, (const GLuint*)&pTextureObject->mGLTextureName);
             pTextureObject->mGLTextureName = 0;
 
             // Adjust metrics.
@@ -836,6 +1269,7 @@ TextureObject* TextureManager::registerTexture(const char* pTextureKey, GBitmap*
     pTextureObject->mTextureWidth      = getNextPow2(pNewBitmap->getWidth());
     pTextureObject->mTextureHeight     = getNextPow2(pNewBitmap->getHeight());
     pTextureObject->mClamp             = clampToEdge;
+    pTextureObject->mForce16Bit        = pNewBitmap->mForce16Bit;
 
     // Generate a GL texture name if one is not ready.
     if( pTextureObject->mGLTextureName == 0) 
@@ -843,6 +1277,10 @@ TextureObject* TextureManager::registerTexture(const char* pTextureKey, GBitmap*
         createGLName(pTextureObject);
     }
 
+    // Keep a compressed copy of critical textures so they can be restored without reading the file.
+    if ( pTextureObject->mCritical && pTextureObject->mpRestoreData == NULL && pTextureObject->mHandleType == TextureHandle::BitmapTexture )
+        storeRestoreData( pTextureObject, pTextureObject->mpBitmap );
+
     // Delete bitmap if we're not keeping it.
     if ( pTextureObject->mHandleType != TextureHandle::BitmapKeepTexture ) 
     {
@@ -855,13 +1293,16 @@ TextureObject* TextureManager::registerTexture(const char* pTextureKey, GBitmap*
 
 //--------------------------------------------------------------------------------------------------------------------
 
-TextureObject *TextureManager::loadTexture(const char* pTextureKey, TextureHandle::TextureHandleType type, bool clampToEdge, bool checkOnly, bool force16Bit )
+TextureObject *TextureManager::loadTexture(const char* pTextureKey, TextureHandle::TextureHandleType type, bool clampToEdge, bool checkOnly, bool force16Bit, bool async )
 {
+    // Attribute allocations to textures.
+    Memory::TagScope memoryTag( Memory::TagTextures );
+
     // Sanity!
     AssertISV( type != TextureHandle::InvalidTexture, "Invalid texture type." );
 
-    // Finish if texture key is invalid.
-    if( pTextureKey == NULL || *pTextureKey == 0)
+    // Finish if texture key is invalid or there are no textures such as in a headless server.
+    if( pTextureKey == NULL || *pTextureKey == 0 || mManagerState == NotInitialized )
         return NULL;
 
     // Fetch texture key.
@@ -871,6 +1312,12 @@ TextureObject *TextureManager::loadTexture(const char* pTextureKey, TextureHandl
 
     GBitmap *bmp = NULL;
 
+    if( ret == NULL && (mAsyncTextureLoading || async) && type == TextureHandle::BitmapTexture )
+    {
+        // Load in the background if possible.
+        ret = loadTextureAsync(textureKey, clampToEdge, force16Bit);
+    }
+
     if( ret == NULL )
     {
         // Ok, no hit - is it in the current dir? If so then let's grab it
@@ -880,7 +1327,9 @@ TextureObject *TextureManager::loadTexture(const char* pTextureKey, TextureHandl
         if(bmp)
         {
             bmp->mForce16Bit = force16Bit;
-            return registerTexture(textureKey, bmp, type, clampToEdge);
+            ret = registerTexture(textureKey, bmp, type, clampToEdge);
+            ret->mReloadable = true;
+            return ret;
         }
     }
 
@@ -902,13 +1351,23 @@ TextureObject *TextureManager::loadTexture(const char* pTextureKey, TextureHandl
     }
     bmp->mForce16Bit = force16Bit;
 
-    return registerTexture(textureKey, bmp, type, clampToEdge);
+    ret = registerTexture(textureKey, bmp, type, clampToEdge);
+    ret->mReloadable = true;
+    return ret;
 }
 
 //--------------------------------------------------------------------------------------------------------------------
 
 GBitmap *TextureManager::loadBitmap( const char* pTextureKey, bool recurse, bool nocompression )
 {
+    // Use a compressed container in preference if allowed.
+    if ( mAllowTextureCompression && !nocompression )
+    {
+        GBitmap* pBitmap = loadCompressedBitmap( pTextureKey );
+        if ( pBitmap != NULL )
+            return pBitmap;
+    }
+
     char fileNameBuffer[512];
     Con::expandPath( fileNameBuffer, sizeof(fileNameBuffer), pTextureKey );
     GBitmap *bmp = NULL;
@@ -940,6 +1399,824 @@ GBitmap *TextureManager::loadBitmap( const char* pTextureKey, bool recurse, bool
 
 //--------------------------------------------------------------------------------------------------------------------
 
+bool TextureManager::loadBitmapSize( const char* pTextureKey, U32& width, U32& height )
+{
+    // The start-of-frame of a JPEG follows any metadata so allow for a reasonable amount of it.
+    const U32 maximumHeaderSize = 64 * 1024;
+
+    char fileNameBuffer[512];
+    Con::expandPath( fileNameBuffer, sizeof(fileNameBuffer), pTextureKey );
+    Stream* pStream = NULL;
+
+    // Loop through the supported extensions to find the file.
+    U32 len = dStrlen(fileNameBuffer);
+    for (U32 i = 0; i < EXT_ARRAY_SIZE && pStream == NULL; i++)
+    {
+        dStrcpy(fileNameBuffer + len, extArray[i]);
+        pStream = ResourceManager->openStream(fileNameBuffer);
+    }
+
+    // Finish if the file could not be found.
+    if ( pStream == NULL )
+        return false;
+
+    // Read the start of the file.
+    const U32 headerSize = getMin( (U32)pStream->getStreamSize(), maximumHeaderSize );
+    U8* pHeaderData = (U8*)dMalloc( headerSize );
+    const bool headerRead = pStream->read( headerSize, pHeaderData );
+    ResourceManager->closeStream( pStream );
+
+    // Fetch the image dimensions from its header.
+    bool paletted;
+    const bool sizeRead = headerRead && readImageHeader( pHeaderData, headerSize, width, height, paletted );
+    dFree( pHeaderData );
+
+    return sizeRead;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+TextureObject* TextureManager::loadTextureAsync( StringTableEntry textureKey, bool clampToEdge, bool force16Bit )
+{
+    // Finish if not appropriate.
+    if ( !mDGLRender || mManagerState != Alive )
+        return NULL;
+
+    // Compressed bitmaps need no decoding so load them immediately.
+    if ( mAllowTextureCompression )
+    {
+        GBitmap* pBitmap = loadCompressedBitmap( textureKey );
+        if ( pBitmap != NULL )
+        {
+            pBitmap->mForce16Bit = force16Bit;
+            TextureObject* pTextureObject = registerTexture( textureKey, pBitmap, TextureHandle::BitmapTexture, clampToEdge );
+            pTextureObject->mReloadable = true;
+            return pTextureObject;
+        }
+    }
+
+    char fileNameBuffer[512];
+    Con::expandPath( fileNameBuffer, sizeof(fileNameBuffer), textureKey );
+    Stream* pStream = NULL;
+
+    // Loop through the supported extensions to find the file.
+    U32 len = dStrlen(fileNameBuffer);
+    for (U32 i = 0; i < EXT_ARRAY_SIZE && pStream == NULL; i++)
+    {
+        dStrcpy(fileNameBuffer + len, extArray[i]);
+        pStream = ResourceManager->openStream(fileNameBuffer);
+    }
+
+    // Finish if the file could not be found.
+    if ( pStream == NULL )
+        return NULL;
+
+    // Read the file.
+    // NOTE: The resource manager is not thread-safe so the file itself is read here rather than by the decoder.
+    const U32 fileSize = pStream->getStreamSize();
+    U8* pFileData = (U8*)dMalloc( fileSize );
+    const bool fileRead = pStream->read( fileSize, pFileData );
+    ResourceManager->closeStream( pStream );
+
+    // Fetch the image dimensions from its header.
+    // If this isn't possible then the caller will fall back to loading the bitmap immediately.
+    U32 bitmapWidth;
+    U32 bitmapHeight;
+    bool paletted;
+    if ( !fileRead ||
+        !readImageHeader( pFileData, fileSize, bitmapWidth, bitmapHeight, paletted ) ||
+        bitmapWidth > MaximumProductSupportedTextureWidth ||
+        bitmapHeight > MaximumProductSupportedTextureHeight )
+    {
+        dFree( pFileData );
+        return NULL;
+    }
+
+    // The decoder cannot query the console so apply the paletted 16-bit preference here.
+    if ( paletted && dAtob( Con::getVariable("$pref::iPhone::ForcePalletedPNGsTo16Bit") ) )
+        force16Bit = true;
+
+    // Create the texture bound whilst loading.
+    createPendingGLName();
+
+    // Create a pending texture object.
+    // The dimensions are known up-front so users can calculate their frames before the bitmap arrives.
+    TextureObject* pTextureObject = new TextureObject();
+    pTextureObject->mTextureKey     = textureKey;
+    pTextureObject->mHandleType     = TextureHandle::BitmapTexture;
+    pTextureObject->mBitmapWidth    = bitmapWidth;
+    pTextureObject->mBitmapHeight   = bitmapHeight;
+    pTextureObject->mTextureWidth   = getNextPow2( bitmapWidth );
+    pTextureObject->mTextureHeight  = getNextPow2( bitmapHeight );
+    pTextureObject->mClamp          = clampToEdge;
+    pTextureObject->mPending        = true;
+    pTextureObject->mReloadable     = true;
+    pTextureObject->mForce16Bit     = force16Bit;
+    TextureDictionary::insert(pTextureObject);
+    mTexturePendingCount++;
+
+    // Start the decoders if required.
+    // Each decoder claims the next load waiting so images are decoded concurrently.
+    if ( sgDecodeThreads.size() == 0 )
+    {
+        sgpPendingMutex = new Mutex();
+        sgpDecodeSemaphore = new Semaphore( 0 );
+        sgDecodeShutdown = false;
+        const S32 decodeThreadCount = getMax( mTextureDecodeThreads, 1 );
+        for ( S32 index = 0; index < decodeThreadCount; ++index )
+            sgDecodeThreads.push_back( new Thread( decodeThreadFunction, NULL, true ) );
+    }
+
+    // Queue the load.
+    PendingTextureLoad* pLoad = new PendingTextureLoad();
+    pLoad->mpTextureObject  = pTextureObject;
+    pLoad->mpFileData       = pFileData;
+    pLoad->mFileSize        = fileSize;
+    pLoad->mForce16Bit      = force16Bit;
+    pLoad->mDecoding        = false;
+    pLoad->mDecoded         = false;
+    pLoad->mpBitmap         = NULL;
+
+    sgpPendingMutex->lock();
+    sgPendingLoads.push_back( pLoad );
+    sgpPendingMutex->unlock();
+
+    // Wake a decoder.
+    sgpDecodeSemaphore->release();
+
+    return pTextureObject;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::processPendingTextures( const bool ignoreBudget )
+{
+    // Finish if nothing is pending.
+    // NOTE: Only this thread adds or removes loads so the size can be read without the lock.
+    if ( sgPendingLoads.size() == 0 )
+        return;
+
+    // Attribute allocations to textures.
+    Memory::TagScope memoryTag( Memory::TagTextures );
+
+    // Debug Profiling.
+    PROFILE_SCOPE(TextureManager_ProcessPendingTextures);
+
+    Vector<PendingTextureLoad*> completedLoads;
+    S32 uploadSize = 0;
+
+    // Collect the decoded loads in the order they were requested.
+    sgpPendingMutex->lock();
+    for ( S32 index = 0; index < sgPendingLoads.size(); )
+    {
+        PendingTextureLoad* pLoad = sgPendingLoads[index];
+
+        // Skip if not decoded yet.
+        if ( !pLoad->mDecoded )
+        {
+            index++;
+            continue;
+        }
+
+        // Stop uploading once the budget is spent (cancelled loads can always be retired).
+        // At least one texture is always uploaded so that a large texture cannot stall loading.
+        if ( pLoad->mpTextureObject != NULL )
+        {
+            if ( !ignoreBudget && mTextureUploadBudget > 0 && uploadSize > 0 && uploadSize >= mTextureUploadBudget )
+            {
+                index++;
+                continue;
+            }
+
+            uploadSize += pLoad->mpBitmap == NULL ? 0 : pLoad->mpBitmap->byteSize;
+        }
+
+        completedLoads.push_back( pLoad );
+        sgPendingLoads.erase( index );
+    }
+    sgpPendingMutex->unlock();
+
+    // Upload the textures.
+    for ( S32 index = 0; index < completedLoads.size(); ++index )
+    {
+        PendingTextureLoad* pLoad = completedLoads[index];
+
+        if ( pLoad->mpTextureObject != NULL )
+        {
+            uploadPendingTexture( pLoad->mpTextureObject, pLoad->mpBitmap, pLoad->mForce16Bit );
+        }
+        else
+        {
+            SAFE_DELETE( pLoad->mpBitmap );
+        }
+
+        delete pLoad;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::finishPendingTextures( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TextureManager_FinishPendingTextures);
+
+    while( mTexturePendingCount > 0 )
+    {
+        // Upload everything decoded so far.
+        processPendingTextures( true );
+
+        // Wait for the decoders if there's still more to do.
+        if ( mTexturePendingCount > 0 )
+            Platform::sleep( 1 );
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::uploadPendingTexture( TextureObject* pTextureObject, GBitmap* pBitmap, const bool force16Bit )
+{
+    // Sanity!
+    AssertFatal( pTextureObject->mPending, "TextureManager::uploadPendingTexture() - Texture is not pending." );
+
+    // Flag as no longer pending.
+    pTextureObject->mPending = false;
+    mTexturePendingCount--;
+
+    // Finish if the bitmap could not be decoded.
+    if ( pBitmap == NULL )
+    {
+        Con::warnf( "TextureManager::uploadPendingTexture() - Could not decode texture: %s", pTextureObject->mTextureKey );
+        return;
+    }
+
+    // Warn if the decoded dimensions don't match the header.
+    if ( pBitmap->getWidth() != pTextureObject->mBitmapWidth || pBitmap->getHeight() != pTextureObject->mBitmapHeight )
+    {
+        Con::warnf( "TextureManager::uploadPendingTexture() - Texture '%s' decoded as (%d-%d) but its header specified (%d-%d).",
+            pTextureObject->mTextureKey, pBitmap->getWidth(), pBitmap->getHeight(), pTextureObject->mBitmapWidth, pTextureObject->mBitmapHeight );
+    }
+
+    pBitmap->mForce16Bit = force16Bit;
+
+    // Register texture.
+    TextureObject* pNewTextureObject;
+    pNewTextureObject = registerTexture(pTextureObject->mTextureKey, pBitmap, pTextureObject->mHandleType, pTextureObject->mClamp);
+
+    // Sanity!
+    AssertFatal(pNewTextureObject == pTextureObject, "A new texture was returned when uploading a pending texture.");
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::cancelPendingTexture( TextureObject* pTextureObject )
+{
+    // Finish if not pending.
+    if ( !pTextureObject->mPending )
+        return;
+
+    // Detach the load from the texture.
+    // NOTE: The load itself is retired once the decoder has finished with it.
+    sgpPendingMutex->lock();
+    for ( S32 index = 0; index < sgPendingLoads.size(); ++index )
+    {
+        if ( sgPendingLoads[index]->mpTextureObject == pTextureObject )
+        {
+            sgPendingLoads[index]->mpTextureObject = NULL;
+            break;
+        }
+    }
+    sgpPendingMutex->unlock();
+
+    // Flag as no longer pending.
+    pTextureObject->mPending = false;
+    mTexturePendingCount--;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::cancelPendingTextures( void )
+{
+    // Finish if nothing is pending.
+    if ( sgPendingLoads.size() == 0 )
+        return;
+
+    // Detach all the loads from their textures.
+    sgpPendingMutex->lock();
+    for ( S32 index = 0; index < sgPendingLoads.size(); ++index )
+    {
+        PendingTextureLoad* pLoad = sgPendingLoads[index];
+
+        if ( pLoad->mpTextureObject == NULL )
+            continue;
+
+        pLoad->mpTextureObject->mPending = false;
+        pLoad->mpTextureObject = NULL;
+        mTexturePendingCount--;
+    }
+    sgpPendingMutex->unlock();
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::createPendingGLName( void )
+{
+    // Finish if already created.
+    if ( TextureObject::smPendingGLTextureName != 0 )
+        return;
+
+    // Generate a single transparent texel so that loading textures simply don't appear.
+    const U8 pendingTexel[4] = { 0, 0, 0, 0 };
+
+    glGenTextures(1, &TextureObject::smPendingGLTextureName);
+    dglBindTexture( GL_TEXTURE_2D, TextureObject::smPendingGLTextureName );
+    glTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, pendingTexel );
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST );
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST );
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+static S32 QSORT_CALLBACK compareTextureLastUsed( const void* a, const void* b )
+{
+    const U32 lastUsedA = (*(TextureObject**)a)->getLastUsedTime();
+    const U32 lastUsedB = (*(TextureObject**)b)->getLastUsedTime();
+
+    return lastUsedA < lastUsedB ? -1 : lastUsedA > lastUsedB ? 1 : 0;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::enforceTextureBudget( void )
+{
+    // Update the usage time.
+    const U32 currentTime = Platform::getRealMilliseconds();
+    TextureObject::smUsageTime = currentTime;
+
+    // Count the resident textures against the memory budget.
+    Memory::setTagExternalBytes( Memory::TagTextures, mTextureResidentSize );
+
+    // Finish if not appropriate.
+    if ( mTextureBudget <= 0 || mTextureResidentSize <= mTextureBudget || !mDGLRender || mManagerState != Alive )
+        return;
+
+    // Finish if we've checked recently.
+    if ( (currentTime - mLastEvictionTime) < 1000 )
+        return;
+
+    mLastEvictionTime = currentTime;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(TextureManager_EnforceTextureBudget);
+
+    evictUnusedTextures( (U32)(getMax( mTextureEvictionDelay, 0.0f ) * 1000.0f), mTextureBudget );
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::evictUnusedTextures( const U32 unusedTime, const S32 targetResidentSize )
+{
+    // Finish if not appropriate.
+    if ( mTextureResidentSize <= targetResidentSize || !mDGLRender || mManagerState != Alive )
+        return;
+
+    // Gather the textures that can be reloaded and have not been used recently.
+    const U32 currentTime = Platform::getRealMilliseconds();
+    Vector<TextureObject*> candidates;
+    for ( TextureObject* pProbe = TextureDictionary::TextureObjectChain; pProbe != NULL; pProbe = pProbe->next )
+    {
+        if ( pProbe->mHandleType != TextureHandle::BitmapTexture ||
+            (!pProbe->mReloadable && pProbe->mpRestoreData == NULL) ||
+            pProbe->mPending ||
+            pProbe->mEvicted ||
+            pProbe->mGLTextureName == 0 ||
+            (currentTime - pProbe->mLastUsedTime) < unusedTime )
+            continue;
+
+        candidates.push_back( pProbe );
+    }
+
+    // Evict the least-recently-used textures first until within budget.
+    dQsort( candidates.address(), candidates.size(), sizeof(TextureObject*), compareTextureLastUsed );
+    for ( S32 index = 0; index < candidates.size() && mTextureResidentSize > targetResidentSize; ++index )
+    {
+        evictTexture( candidates[index] );
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::evictTexture( TextureObject* pTextureObject )
+{
+    // Sanity!
+    AssertFatal( pTextureObject->mReloadable && !pTextureObject->mEvicted, "TextureManager::evictTexture() - Texture cannot be evicted." );
+
+    // Delete the texture name.
+    dglDeleteTextures(1, (const GLuint*)&pTextureObject->mGLTextureName);
+    pTextureObject->mGLTextureName = 0;
+
+    // Adjust metrics.
+    mTextureResidentCount--;
+    mTextureResidentSize -= pTextureObject->mTextureResidentSize;
+    pTextureObject->mTextureResidentSize = 0;
+    mTextureResidentWasteSize -= pTextureObject->mTextureResidentWasteSize;
+    pTextureObject->mTextureResidentWasteSize = 0;
+
+    // Flag as evicted.
+    pTextureObject->mEvicted = true;
+    mTextureEvictedCount++;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::restoreTexture( TextureObject* pTextureObject )
+{
+    // Finish if not evicted.
+    if ( !pTextureObject->mEvicted )
+        return;
+
+    // Flag as no longer evicted.
+    pTextureObject->mEvicted = false;
+    mTextureEvictedCount--;
+
+    // Flag as resurrected.
+    if ( pTextureObject->mResurrecting )
+    {
+        pTextureObject->mResurrecting = false;
+        mTextureResurrectingCount--;
+    }
+
+    // Finish if not appropriate.
+    if ( !mDGLRender || mManagerState != Alive )
+        return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(TextureManager_RestoreTexture);
+
+    // Reload the texture.
+    if ( !reloadTexture( pTextureObject ) )
+        Con::warnf( "TextureManager::restoreTexture() - Could not reload evicted texture: %s", pTextureObject->mTextureKey );
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+bool TextureManager::reloadTexture( TextureObject* pTextureObject )
+{
+    // Kept bitmaps can simply be uploaded again.
+    if ( pTextureObject->mHandleType == TextureHandle::BitmapKeepTexture )
+    {
+        // Finish if no texture name or bitmap.
+        if ( pTextureObject->mGLTextureName == 0 || pTextureObject->mpBitmap == NULL )
+            return false;
+
+        refresh( pTextureObject );
+        return true;
+    }
+
+    // Finish if the texture can't be read again or is still loading.
+    if ( (!pTextureObject->mReloadable && pTextureObject->mpRestoreData == NULL) || pTextureObject->mPending )
+        return false;
+
+    // Restore from any compressed copy otherwise load the bitmap.
+    GBitmap* pBitmap = pTextureObject->mpRestoreData != NULL ? createRestoreBitmap( pTextureObject ) : NULL;
+    if ( pBitmap == NULL && pTextureObject->mReloadable )
+        pBitmap = loadBitmap( pTextureObject->mTextureKey );
+
+    // Finish if the bitmap has gone.
+    if ( pBitmap == NULL )
+        return false;
+
+    pBitmap->mForce16Bit = pTextureObject->mForce16Bit;
+
+    // Register texture.
+    TextureObject* pNewTextureObject;
+    pNewTextureObject = registerTexture(pTextureObject->mTextureKey, pBitmap, pTextureObject->mHandleType, pTextureObject->mClamp);
+
+    // Sanity!
+    AssertFatal(pNewTextureObject == pTextureObject, "A new texture was returned when reloading a texture.");
+
+    return true;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::processResurrectingTextures( void )
+{
+    // Finish if not appropriate.
+    if ( mTextureResurrectingCount == 0 || !mDGLRender || mManagerState != Alive )
+        return;
+
+    // Finish if the first frame hasn't restored the textures it draws yet.
+    if ( sgResurrectionDeferred )
+    {
+        sgResurrectionDeferred = false;
+        return;
+    }
+
+    // Debug Profiling.
+    PROFILE_SCOPE(TextureManager_ProcessResurrectingTextures);
+
+    // Gather the textures still to be restored.
+    Vector<TextureObject*> candidates;
+    for ( TextureObject* pProbe = TextureDictionary::TextureObjectChain; pProbe != NULL; pProbe = pProbe->next )
+    {
+        if ( pProbe->mResurrecting )
+            candidates.push_back( pProbe );
+    }
+
+    // Restore the most-recently-used textures first until the budget is spent.
+    // At least one texture is always restored so that a large texture cannot stall restoring.
+    dQsort( candidates.address(), candidates.size(), sizeof(TextureObject*), compareTextureLastUsed );
+    S32 uploadSize = 0;
+    for ( S32 index = candidates.size() - 1; index >= 0; --index )
+    {
+        if ( mTextureUploadBudget > 0 && uploadSize > 0 && uploadSize >= mTextureUploadBudget )
+            break;
+
+        restoreTexture( candidates[index] );
+        uploadSize += candidates[index]->mTextureResidentSize;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::setTextureCritical( TextureObject* pTextureObject, const bool critical )
+{
+    // Finish if no change.
+    if ( pTextureObject->mCritical == critical )
+        return;
+
+    pTextureObject->mCritical = critical;
+
+    // Delete any compressed copy if no longer critical.
+    if ( !critical )
+    {
+        freeRestoreData( pTextureObject );
+        return;
+    }
+
+    // Finish if the bitmap is kept anyway, is still loading (the copy is stored when it's uploaded) or has no file to read.
+    if ( pTextureObject->mHandleType != TextureHandle::BitmapTexture || pTextureObject->mPending || !pTextureObject->mReloadable )
+        return;
+
+    // Attribute allocations to textures.
+    Memory::TagScope memoryTag( Memory::TagTextures );
+
+    // Read the bitmap once more to store its copy.
+    GBitmap* pBitmap = loadBitmap( pTextureObject->mTextureKey );
+    if ( pBitmap == NULL )
+        return;
+
+    storeRestoreData( pTextureObject, pBitmap );
+    delete pBitmap;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::storeRestoreData( TextureObject* pTextureObject, const GBitmap* pBitmap )
+{
+    // Sanity!
+    AssertFatal( pTextureObject->mpRestoreData == NULL, "TextureManager::storeRestoreData() - Texture already has a compressed copy." );
+
+    // Finish if the bitmap is block-compressed or paletted.
+    // NOTE: Block-compressed containers are uploaded as-is so reading them again is already cheap.
+    const GBitmap::BitmapFormat format = pBitmap->getFormat();
+    if ( pBitmap->isCompressed() || format == GBitmap::Palettized )
+        return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(TextureManager_StoreRestoreData);
+
+    // Compress the top level only as any mip chain is extruded again when uploaded.
+    const uLong bitsSize = pBitmap->getWidth() * pBitmap->getHeight() * pBitmap->bytesPerPixel;
+    uLongf compressedSize = compressBound( bitsSize );
+    U8* pCompressed = new U8[compressedSize];
+    if ( compress2( pCompressed, &compressedSize, pBitmap->getBits(), bitsSize, Z_BEST_SPEED ) != Z_OK )
+    {
+        // Warn.
+        Con::warnf( "TextureManager::storeRestoreData() - Could not compress a copy of texture: %s", pTextureObject->mTextureKey );
+        delete [] pCompressed;
+        return;
+    }
+
+    // Keep only the compressed bytes.
+    pTextureObject->mpRestoreData = new U8[compressedSize];
+    dMemcpy( pTextureObject->mpRestoreData, pCompressed, compressedSize );
+    delete [] pCompressed;
+
+    pTextureObject->mRestoreDataSize = (U32)compressedSize;
+    pTextureObject->mRestoreFormat = format;
+
+    // Adjust metrics.
+    mRestoreResidentSize += pTextureObject->mRestoreDataSize;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::freeRestoreData( TextureObject* pTextureObject )
+{
+    // Finish if no compressed copy.
+    if ( pTextureObject->mpRestoreData == NULL )
+        return;
+
+    delete [] pTextureObject->mpRestoreData;
+    pTextureObject->mpRestoreData = NULL;
+
+    // Adjust metrics.
+    mRestoreResidentSize -= pTextureObject->mRestoreDataSize;
+    pTextureObject->mRestoreDataSize = 0;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+GBitmap* TextureManager::createRestoreBitmap( TextureObject* pTextureObject )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TextureManager_CreateRestoreBitmap);
+
+    // Decompress the copy.
+    GBitmap* pBitmap = new GBitmap( pTextureObject->mBitmapWidth, pTextureObject->mBitmapHeight, false, pTextureObject->mRestoreFormat );
+    uLongf bitsSize = pBitmap->byteSize;
+    if ( uncompress( pBitmap->getWritableBits(), &bitsSize, pTextureObject->mpRestoreData, pTextureObject->mRestoreDataSize ) != Z_OK || bitsSize != pBitmap->byteSize )
+    {
+        // Warn.
+        Con::warnf( "TextureManager::createRestoreBitmap() - Could not decompress the copy of texture: %s", pTextureObject->mTextureKey );
+        delete pBitmap;
+        return NULL;
+    }
+
+    pBitmap->mForce16Bit = pTextureObject->mForce16Bit;
+
+    return pBitmap;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::updateMipStreaming( void )
+{
+    // Finish if not appropriate.
+    if ( !mDGLRender || mManagerState != Alive )
+        return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(TextureManager_UpdateMipStreaming);
+
+    const U32 currentTime = Platform::getRealMilliseconds();
+    const U32 coarserDelay = (U32)(getMax( mMipStreamingDelay, 0.0f ) * 1000.0f);
+    bool uploaded = false;
+
+    for ( TextureObject* pProbe = TextureDictionary::TextureObjectChain; pProbe != NULL; pProbe = pProbe->next )
+    {
+        // Skip if not streaming.
+        if ( !pProbe->mMipStreaming )
+            continue;
+
+        // Fetch and reset the level required since the last update.
+        const U32 requiredLevel = pProbe->mMipRequiredLevel;
+        pProbe->mMipRequiredLevel = TextureObject::MipLevelUnused;
+
+        // Skip if not drawn, not resident or not mip-capable.
+        if ( requiredLevel == TextureObject::MipLevelUnused ||
+            pProbe->mPending ||
+            pProbe->mEvicted ||
+            pProbe->mGLTextureName == 0 ||
+            !pProbe->mMipCapable )
+            continue;
+
+        // Limit the level to the smallest dimension of the chain.
+        U32 targetLevel = 0;
+        while ( targetLevel < requiredLevel && (pProbe->mTextureWidth >> (targetLevel+1)) > 0 && (pProbe->mTextureHeight >> (targetLevel+1)) > 0 )
+            targetLevel++;
+
+        // Only drop levels once they've been unnecessary for a while so zooming doesn't thrash uploads.
+        if ( targetLevel > pProbe->mMipBaseLevel )
+        {
+            if ( pProbe->mMipCoarserTime == 0 )
+                pProbe->mMipCoarserTime = currentTime;
+
+            if ( (currentTime - pProbe->mMipCoarserTime) < coarserDelay )
+                continue;
+        }
+        else
+        {
+            pProbe->mMipCoarserTime = 0;
+        }
+
+        // Skip if no change or we've already uploaded a texture this update.
+        if ( targetLevel == pProbe->mMipBaseLevel || uploaded )
+            continue;
+
+        // Upload the new base level.
+        pProbe->mMipBaseLevel = targetLevel;
+        pProbe->mMipCoarserTime = 0;
+        uploaded = reloadTexture( pProbe );
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureObject::restoreEvicted( void )
+{
+    TextureManager::restoreTexture( this );
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+GBitmap* TextureManager::loadCompressedBitmap( const char* pTextureKey )
+{
+    // Finish if not rendering as there's no device to ask about formats.
+    if ( !mDGLRender )
+        return NULL;
+
+    char fileNameBuffer[512];
+    Con::expandPath( fileNameBuffer, sizeof(fileNameBuffer), pTextureKey );
+
+    // Remove any extension.
+    char* pExtension = dStrrchr( fileNameBuffer, '.' );
+    const char* pSlash = dStrrchr( fileNameBuffer, '/' );
+    if ( pExtension != NULL && (pSlash == NULL || pExtension > pSlash) )
+        *pExtension = 0;
+
+    // Try the families the device supports in order of preference then any unqualified container.
+    const U32 len = dStrlen(fileNameBuffer);
+    for ( U32 familyIndex = 0; familyIndex <= COMPRESSED_FAMILY_COUNT; ++familyIndex )
+    {
+        const bool qualified = familyIndex < COMPRESSED_FAMILY_COUNT;
+
+        // Skip if the family isn't supported.
+        if ( qualified && !isCompressedFormatSupported( sgCompressedFamilies[familyIndex].mFormat ) )
+            continue;
+
+        for ( U32 extIndex = 0; extIndex < COMPRESSED_EXT_ARRAY_SIZE; ++extIndex )
+        {
+            if ( qualified )
+                dSprintf( fileNameBuffer + len, sizeof(fileNameBuffer) - len, ".%s%s", sgCompressedFamilies[familyIndex].mpName, compressedExtArray[extIndex] );
+            else
+                dStrcpy( fileNameBuffer + len, compressedExtArray[extIndex] );
+
+            // Skip if the file doesn't exist.
+            if ( ResourceManager->find( fileNameBuffer ) == NULL )
+                continue;
+
+            GBitmap* pBitmap = (GBitmap*)ResourceManager->loadInstance( fileNameBuffer );
+            if ( pBitmap == NULL )
+                continue;
+
+            // Validate the bitmap.
+            if ( !isCompressedFormatSupported( pBitmap->getFormat() ) )
+            {
+                Con::warnf( "TextureManager::loadCompressedBitmap() - Cannot load bitmap '%s' as this device does not support its compressed format.", fileNameBuffer );
+            }
+            else if ( !isPow2( pBitmap->getWidth() ) || !isPow2( pBitmap->getHeight() ) )
+            {
+                Con::warnf( "TextureManager::loadCompressedBitmap() - Cannot load bitmap '%s' as compressed bitmaps must be a power-of-two in dimension.", fileNameBuffer );
+            }
+            else if ( pBitmap->getWidth() > MaximumProductSupportedTextureWidth || pBitmap->getHeight() > MaximumProductSupportedTextureHeight )
+            {
+                Con::warnf( "TextureManager::loadCompressedBitmap() - Cannot load bitmap '%s' as its dimensions exceed the maximum product-supported texture dimension.", fileNameBuffer );
+            }
+            else
+            {
+                return pBitmap;
+            }
+
+            delete pBitmap;
+        }
+    }
+
+    return NULL;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+bool TextureManager::isCompressedFormatSupported( const GBitmap::BitmapFormat format )
+{
+    // Query the compressed formats the device supports.
+    if ( !sgCompressedGLFormatsQueried )
+    {
+        GLint formatCount = 0;
+        glGetIntegerv( GL_NUM_COMPRESSED_TEXTURE_FORMATS, &formatCount );
+        sgCompressedGLFormats.setSize( formatCount );
+        if ( formatCount > 0 )
+            glGetIntegerv( GL_COMPRESSED_TEXTURE_FORMATS, (GLint*)sgCompressedGLFormats.address() );
+        sgCompressedGLFormatsQueried = true;
+    }
+
+    const S32 glFormat = (S32)GBitmap::getCompressedGLFormat( format );
+    if ( glFormat == 0 )
+        return false;
+
+    for ( S32 index = 0; index < sgCompressedGLFormats.size(); ++index )
+    {
+        if ( sgCompressedGLFormats[index] == glFormat )
+            return true;
+    }
+
+    return false;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
 void TextureManager::dumpMetrics( void )
 {
     S32 textureResidentCount = 0;
@@ -989,11 +2266,16 @@ void TextureManager::dumpMetrics( void )
 
     // Info.
     Con::printf( "Metrics Totals:" );
-    Con::printf( "TextureCount: %d, TextureSize: %d, TextureWasteSize: %d, BitmapSize: %d, ResidentFraction: %g",
+    Con::printf( "TextureCount: %d, TextureSize: %d, TextureWasteSize: %d, BitmapSize: %d, RestoreSize: %d, PendingCount: %d, EvictedCount: %d, ResurrectingCount: %d, TextureBudget: %d, ResidentFraction: %g",
         mTextureResidentCount,
         mTextureResidentSize,
         mTextureResidentWasteSize,
         mBitmapResidentSize,
+        mRestoreResidentSize,
+        mTexturePendingCount,
+        mTextureEvictedCount,
+        mTextureResurrectingCount,
+        mTextureBudget,
         getResidentFraction() );
 
     Con::printBlankLine();
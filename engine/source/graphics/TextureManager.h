@@ -80,6 +80,18 @@ private:
     static bool mForce16BitTexture;
     static bool mAllowTextureCompression;
     static bool mDisableTextureSubImageUpdates;
+    static bool mAsyncTextureLoading;
+    static S32 mTextureUploadBudget;
+    static S32 mTextureDecodeThreads;
+    static S32 mTexturePendingCount;
+    static S32 mTextureBudget;
+    static F32 mTextureEvictionDelay;
+    static S32 mTextureEvictedCount;
+    static U32 mLastEvictionTime;
+    static F32 mMipStreamingDelay;
+    static bool mLazyTextureResurrection;
+    static S32 mTextureResurrectingCount;
+    static S32 mRestoreResidentSize;
 
 public:
     static bool mDGLRender;
@@ -98,12 +110,66 @@ public:
     static S32 getTextureResidentSize( void ) { return mTextureResidentSize; }
     static S32 getTextureResidentWasteSize( void ) { return mTextureResidentWasteSize; }
     static S32 getTextureResidentCount( void ) { return mTextureResidentCount; }
+    static S32 getRestoreResidentSize( void ) { return mRestoreResidentSize; }
 
     static U32  registerEventCallback(TextureEventCallback, void *userData);
     static void unregisterEventCallback(const U32 callbackKey);
 
     static StringTableEntry getUniqueTextureKey( void );
 
+    static GBitmap* loadBitmap(const char *textureName, bool recurse = true, bool nocompression = false);
+
+    /// Fetch the dimensions of a PNG or JPEG bitmap from its file header without decoding it.
+    static bool loadBitmapSize( const char* pTextureKey, U32& width, U32& height );
+
+    /// Upload any bitmap textures that have finished decoding in the background.
+    /// At most "$pref::OpenGL::textureUploadBudget" bytes are uploaded per call unless the budget is ignored.
+    static void processPendingTextures( const bool ignoreBudget = false );
+
+    /// Block until all pending bitmap textures have been decoded and uploaded.
+    static void finishPendingTextures( void );
+    static S32 getPendingTextureCount( void ) { return mTexturePendingCount; }
+
+    /// Whether bitmap textures are decoded in the background ("$pref::OpenGL::asyncTextureLoading").
+    /// Up to "$pref::OpenGL::textureDecodeThreads" bitmaps are decoded at once.
+    static void setAsyncTextureLoading( const bool asyncTextureLoading ) { mAsyncTextureLoading = asyncTextureLoading; }
+    static bool getAsyncTextureLoading( void ) { return mAsyncTextureLoading; }
+
+    /// Evict the least-recently-used bitmap textures whilst the resident size exceeds "$pref::OpenGL::textureBudget".
+    /// Only textures unused for "$pref::OpenGL::textureEvictionDelay" seconds are evicted; they are reloaded when next used.
+    static void enforceTextureBudget( void );
+
+    /// Evict the least-recently-used bitmap textures unused for the specified time (in milliseconds) whilst the resident size exceeds the target.
+    static void evictUnusedTextures( const U32 unusedTime, const S32 targetResidentSize );
+
+    /// Reload an evicted texture from its file.
+    static void restoreTexture( TextureObject* pTextureObject );
+    static S32 getTextureBudget( void ) { return mTextureBudget; }
+    static F32 getTextureEvictionDelay( void ) { return mTextureEvictionDelay; }
+    static S32 getTextureEvictedCount( void ) { return mTextureEvictedCount; }
+
+    /// Re-upload mip-streamed textures whose on-screen texel density needs a different base mip level.
+    /// Finer levels are uploaded immediately whereas coarser levels wait "$pref::OpenGL::mipStreamingDelay" seconds.
+    static void updateMipStreaming( void );
+
+    /// Restore the textures left to be restored lazily after the context was lost ("$pref::OpenGL::lazyTextureResurrection").
+    /// Textures are restored as they are drawn so, after the first frame, the most-recently-used of the rest are restored
+    /// here until "$pref::OpenGL::textureUploadBudget" bytes have been uploaded.
+    static void processResurrectingTextures( void );
+    static S32 getTextureResurrectingCount( void ) { return mTextureResurrectingCount; }
+
+    /// Gets whether the filter samples mip levels.
+    static inline bool isMipFilter( const GLuint filter )
+    {
+        return filter == GL_NEAREST_MIPMAP_NEAREST || filter == GL_LINEAR_MIPMAP_NEAREST || filter == GL_NEAREST_MIPMAP_LINEAR || filter == GL_LINEAR_MIPMAP_LINEAR;
+    }
+
+    /// Gets the filter to use when no mip levels are available (also the magnification filter).
+    static inline GLuint getNonMipFilter( const GLuint filter )
+    {
+        return (filter == GL_NEAREST || filter == GL_NEAREST_MIPMAP_NEAREST || filter == GL_NEAREST_MIPMAP_LINEAR) ? GL_NEAREST : GL_LINEAR;
+    }
+
     static void dumpMetrics( void );
 
 private:
@@ -111,11 +177,23 @@ private:
 
     static void createGLName( TextureObject* pTextureObject );
     static TextureObject* registerTexture(const char *textureName, GBitmap* pNewBitmap, TextureHandle::TextureHandleType type, bool clampToEdge);
-    static TextureObject* loadTexture(const char *textureName, TextureHandle::TextureHandleType type, bool clampToEdge, bool checkOnly = false, bool force16Bit = false );
+    static TextureObject* loadTexture(const char *textureName, TextureHandle::TextureHandleType type, bool clampToEdge, bool checkOnly = false, bool force16Bit = false, bool async = false );
+    static TextureObject* loadTextureAsync( StringTableEntry textureKey, bool clampToEdge, bool force16Bit );
+    static void uploadPendingTexture( TextureObject* pTextureObject, GBitmap* pBitmap, const bool force16Bit );
+    static void cancelPendingTexture( TextureObject* pTextureObject );
+    static void cancelPendingTextures( void );
+    static void evictTexture( TextureObject* pTextureObject );
+    static bool reloadTexture( TextureObject* pTextureObject );
+    static void createPendingGLName( void );
+    static GBitmap* loadCompressedBitmap( const char* pTextureKey );
+    static bool isCompressedFormatSupported( const GBitmap::BitmapFormat format );
     static void freeTexture( TextureObject* pTextureObject );
+    static void setTextureCritical( TextureObject* pTextureObject, const bool critical );
+    static void storeRestoreData( TextureObject* pTextureObject, const GBitmap* pBitmap );
+    static void freeRestoreData( TextureObject* pTextureObject );
+    static GBitmap* createRestoreBitmap( TextureObject* pTextureObject );
     static void refresh(TextureObject* pTextureObject);
 
-    static GBitmap* loadBitmap(const char *textureName, bool recurse = true, bool nocompression = false);
     static GBitmap* createPowerOfTwoBitmap( GBitmap* pBitmap );
     static U16* create16BitBitmap( GBitmap *pDL, U8 *in_source8, GBitmap::BitmapFormat alpha_info, GLint *GLformat, GLint *GLdata_type, U32 width, U32 height );
     static void getSourceDestByteFormat(GBitmap *pBitmap, U32 *sourceFormat, U32 *destFormat, U32 *byteFormat, U32* texelSize);
@@ -72,4 +72,25 @@ ConsoleFunctionWithDocs( dumpTextureManagerMetrics, ConsoleVoid, 1, 1, ())
     return TextureManager::dumpMetrics();
 }
 
+//--------------------------------------------------------------------------------------------------------------------
+
+/*! Gets the number of bitmap textures still loading in the background.
+    Background loading is enabled with "$pref::OpenGL::asyncTextureLoading".
+    @return The number of pending textures.
+*/
+ConsoleFunctionWithDocs( getPendingTextureCount, ConsoleInt, 1, 1, ())
+{
+    return TextureManager::getPendingTextureCount();
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+/*! Blocks until all bitmap textures loading in the background have been uploaded.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs( finishPendingTextures, ConsoleVoid, 1, 1, ())
+{
+    TextureManager::finishPendingTextures();
+}
+
 /*! @} */ // group TextureManagerFunctions
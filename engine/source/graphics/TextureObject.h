@@ -71,10 +71,37 @@ private:
     U32                 mBitmapHeight;
     GLuint              mFilter;
     bool                mClamp;
+    bool                mPending;
+    bool                mReloadable;
+    bool                mEvicted;
+    bool                mForce16Bit;
+    U32                 mLastUsedTime;
+    U32                 mMipLevelCount;
+    U32                 mMipBaseLevel;
+    U32                 mMipRequiredLevel;
+    U32                 mMipCoarserTime;
+    bool                mMipCapable;
+    bool                mMipStreaming;
+    bool                mCritical;
+    bool                mResurrecting;
+    U8*                 mpRestoreData;
+    U32                 mRestoreDataSize;
+    GBitmap::BitmapFormat mRestoreFormat;
 
     TextureHandle::TextureHandleType mHandleType;
 
+    /// Texture bound in place of any texture whose bitmap is still loading.
+    static GLuint       smPendingGLTextureName;
+
+    /// Time stamped on textures as they are used.
+    static U32          smUsageTime;
+
+    void restoreEvicted( void );
+
 public:
+    /// Required mip level of a texture that hasn't been drawn since it was last streamed.
+    static const U32    MipLevelUnused = 0xFFFFFFFF;
+
     TextureObject() :
         next( NULL ), prev( NULL ), hashNext( NULL ),
         mTextureResidentWasteSize( 0 ),
@@ -90,12 +117,36 @@ public:
         mBitmapHeight( 0 ),
         mFilter( GL_NEAREST ),
         mClamp( false ),
+        mPending( false ),
+        mReloadable( false ),
+        mEvicted( false ),
+        mForce16Bit( false ),
+        mLastUsedTime( smUsageTime ),
+        mMipLevelCount( 0 ),
+        mMipBaseLevel( 0 ),
+        mMipRequiredLevel( MipLevelUnused ),
+        mMipCoarserTime( 0 ),
+        mMipCapable( true ),
+        mMipStreaming( false ),
+        mCritical( false ),
+        mResurrecting( false ),
+        mpRestoreData( NULL ),
+        mRestoreDataSize( 0 ),
+        mRestoreFormat( GBitmap::RGBA ),
         mHandleType( TextureHandle::InvalidTexture )
     {
     }
 
     inline StringTableEntry getTextureKey( void ) { return mTextureKey; }
-    inline GLuint getGLTextureName( void ) { return mGLTextureName; }
+    inline GLuint getGLTextureName( void )
+    {
+        // Stamp usage and restore if evicted.
+        mLastUsedTime = smUsageTime;
+        if ( mEvicted )
+            restoreEvicted();
+
+        return mPending ? smPendingGLTextureName : mGLTextureName;
+    }
     inline const GBitmap* getBitmap( void ) { return mpBitmap; }
     inline U32 getTextureWidth( void ) { return mTextureWidth; }
     inline U32 getTextureHeight( void ) { return mTextureHeight; }
@@ -103,9 +154,21 @@ public:
     inline U32 getBitmapHeight( void ) { return mBitmapHeight; }
     inline GLuint getFilter( void ) { return mFilter; }
     inline bool getClamp( void ) { return mClamp; }
+    inline bool getPending( void ) { return mPending; }
+    inline bool getEvicted( void ) { return mEvicted; }
+    inline U32 getLastUsedTime( void ) const { return mLastUsedTime; }
+    inline U32 getMipLevelCount( void ) const { return mMipLevelCount; }
+    inline U32 getMipBaseLevel( void ) const { return mMipBaseLevel; }
+    inline bool getMipStreaming( void ) const { return mMipStreaming; }
+    inline bool getCritical( void ) const { return mCritical; }
+    inline bool getResurrecting( void ) const { return mResurrecting; }
+
+    /// Note the finest mip level needed to draw the texture at its current on-screen texel density.
+    inline void requireMipLevel( const U32 mipLevel ) { if ( mipLevel < mMipRequiredLevel ) mMipRequiredLevel = mipLevel; }
     
     inline S32 getTextureResidentSize( void ) const { return mTextureResidentSize; }
     inline S32 getBitmapResidentSize( void ) const { return mBitmapResidentSize; }
+    inline U32 getRestoreDataSize( void ) const { return mRestoreDataSize; }
     inline TextureHandle::TextureHandleType getHandleType( void ) { return mHandleType; }
 };
 
@@ -0,0 +1,289 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "graphics/gBitmap.h"
+#include "io/stream.h"
+#include "console/console.h"
+#include "math/mMathFn.h"
+
+//-----------------------------------------------------------------------------
+
+// OpenGL internal formats for the supported block-compressed formats.
+#define COMPRESSED_GL_RGB_S3TC_DXT1         0x83F0
+#define COMPRESSED_GL_RGBA_S3TC_DXT1        0x83F1
+#define COMPRESSED_GL_RGBA_S3TC_DXT3        0x83F2
+#define COMPRESSED_GL_RGBA_S3TC_DXT5        0x83F3
+#define COMPRESSED_GL_ETC1_RGB8             0x8D64
+#define COMPRESSED_GL_RGB8_ETC2             0x9274
+#define COMPRESSED_GL_RGBA8_ETC2_EAC        0x9278
+#define COMPRESSED_GL_RGBA_ASTC_4x4         0x93B0
+#define COMPRESSED_GL_RGBA_ASTC_5x5         0x93B2
+#define COMPRESSED_GL_RGBA_ASTC_6x6         0x93B4
+#define COMPRESSED_GL_RGBA_ASTC_8x8         0x93B7
+
+// DDS definitions.
+#define DDS_MAGIC                           0x20534444  // 'D''D''S'' '
+#define DDS_HEADER_SIZE                     124
+#define DDS_PIXELFORMAT_ALPHAPIXELS         0x1
+#define DDS_PIXELFORMAT_FOURCC              0x4
+#define DDS_FOURCC( a, b, c, d )            ((U32)(a) | ((U32)(b) << 8) | ((U32)(c) << 16) | ((U32)(d) << 24))
+#define DDS_DXGI_FORMAT_BC1_UNORM           71
+#define DDS_DXGI_FORMAT_BC2_UNORM           74
+#define DDS_DXGI_FORMAT_BC3_UNORM           77
+#define DDS_DIMENSION_TEXTURE2D             3
+
+// KTX definitions.
+#define KTX_ENDIANNESS                      0x04030201
+
+static const U8 sgKtxIdentifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+//-----------------------------------------------------------------------------
+
+bool GBitmap::isCompressedFormat( const BitmapFormat format )
+{
+   return format >= BC1 && format <= ASTC8x8;
+}
+
+//-----------------------------------------------------------------------------
+
+bool GBitmap::getCompressedBlockInfo( const BitmapFormat format, U32& blockWidth, U32& blockHeight, U32& blockBytes )
+{
+   blockWidth = blockHeight = 4;
+   blockBytes = 16;
+
+   switch( format )
+   {
+      case BC1:
+      case BC1A:
+      case ETC1:
+      case ETC2:     blockBytes = 8;
+         break;
+      case BC2:
+      case BC3:
+      case ETC2A:
+      case ASTC4x4:
+         break;
+      case ASTC5x5:  blockWidth = blockHeight = 5;
+         break;
+      case ASTC6x6:  blockWidth = blockHeight = 6;
+         break;
+      case ASTC8x8:  blockWidth = blockHeight = 8;
+         break;
+      default:
+         return false;
+   }
+
+   return true;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 GBitmap::getCompressedGLFormat( const BitmapFormat format )
+{
+   switch( format )
+   {
+      case BC1:      return COMPRESSED_GL_RGB_S3TC_DXT1;
+      case BC1A:     return COMPRESSED_GL_RGBA_S3TC_DXT1;
+      case BC2:      return COMPRESSED_GL_RGBA_S3TC_DXT3;
+      case BC3:      return COMPRESSED_GL_RGBA_S3TC_DXT5;
+      case ETC1:     return COMPRESSED_GL_ETC1_RGB8;
+      case ETC2:     return COMPRESSED_GL_RGB8_ETC2;
+      case ETC2A:    return COMPRESSED_GL_RGBA8_ETC2_EAC;
+      case ASTC4x4:  return COMPRESSED_GL_RGBA_ASTC_4x4;
+      case ASTC5x5:  return COMPRESSED_GL_RGBA_ASTC_5x5;
+      case ASTC6x6:  return COMPRESSED_GL_RGBA_ASTC_6x6;
+      case ASTC8x8:  return COMPRESSED_GL_RGBA_ASTC_8x8;
+      default:       return 0;
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+static bool readCompressedImage( GBitmap* pBitmap, Stream& stream, const GBitmap::BitmapFormat format, const U32 width, const U32 height, const U32 imageSize )
+{
+   U32 blockWidth, blockHeight, blockBytes;
+   GBitmap::getCompressedBlockInfo( format, blockWidth, blockHeight, blockBytes );
+
+   // Calculate the size of the top-level image.
+   const U32 expectedSize = ((width + blockWidth - 1) / blockWidth) * ((height + blockHeight - 1) / blockHeight) * blockBytes;
+
+   // Finish if the image size is wrong.
+   if ( imageSize != 0 && imageSize != expectedSize )
+   {
+      Con::warnf( "GBitmap - Compressed image has size %d but expected %d.", imageSize, expectedSize );
+      return false;
+   }
+
+   pBitmap->deleteImage();
+
+   // Read the top-level image only; textures are never mip-mapped.
+   pBitmap->pBits = new U8[expectedSize];
+   if ( !stream.read( expectedSize, pBitmap->pBits ) )
+   {
+      pBitmap->deleteImage();
+      return false;
+   }
+
+   pBitmap->internalFormat     = format;
+   pBitmap->byteSize           = expectedSize;
+   pBitmap->width              = width;
+   pBitmap->height             = height;
+   pBitmap->bytesPerPixel      = 0; // no provision for sub 1 bytesPerPixel, so set it to 0
+   pBitmap->numMipLevels       = 1;
+   pBitmap->mipLevelOffsets[0] = 0;
+
+   return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool GBitmap::readKTX( Stream& stream )
+{
+   // Check the identifier.
+   U8 identifier[sizeof(sgKtxIdentifier)];
+   if ( !stream.read( sizeof(identifier), identifier ) || dMemcmp( identifier, sgKtxIdentifier, sizeof(identifier) ) != 0 )
+   {
+      Con::warnf( "GBitmap::readKTX() - Stream doesn't contain a KTX." );
+      return false;
+   }
+
+   // Read the header.
+   U32 header[13];
+   for ( U32 index = 0; index < 13; ++index )
+      stream.read( &header[index] );
+
+   const U32 endianness       = header[0];
+   const U32 glType           = header[1];
+   const U32 glInternalFormat = header[4];
+   const U32 pixelWidth       = header[6];
+   const U32 pixelHeight      = header[7];
+   const U32 pixelDepth       = header[8];
+   const U32 arrayElements    = header[9];
+   const U32 faces            = header[10];
+   const U32 keyValueBytes    = header[12];
+
+   // Only native-endian, compressed, 2D textures are supported.
+   if ( endianness != KTX_ENDIANNESS || glType != 0 || pixelDepth > 1 || arrayElements > 1 || faces != 1 || pixelWidth == 0 || pixelHeight == 0 )
+   {
+      Con::warnf( "GBitmap::readKTX() - Only little-endian, compressed, 2D textures are supported." );
+      return false;
+   }
+
+   // Find the format.
+   BitmapFormat format = Palettized;
+   for ( U32 probe = BC1; probe <= ASTC8x8; ++probe )
+   {
+      if ( getCompressedGLFormat( BitmapFormat(probe) ) == glInternalFormat )
+      {
+         format = BitmapFormat(probe);
+         break;
+      }
+   }
+
+   if ( !isCompressedFormat( format ) )
+   {
+      Con::warnf( "GBitmap::readKTX() - Unsupported internal format 0x%x.", glInternalFormat );
+      return false;
+   }
+
+   // Skip the key/value data.
+   stream.setPosition( stream.getPosition() + keyValueBytes );
+
+   // Read the top-level image.
+   U32 imageSize;
+   stream.read( &imageSize );
+   return readCompressedImage( this, stream, format, pixelWidth, pixelHeight, imageSize );
+}
+
+//-----------------------------------------------------------------------------
+
+bool GBitmap::readDDS( Stream& stream )
+{
+   // Check the magic.
+   U32 magic;
+   if ( !stream.read( &magic ) || magic != DDS_MAGIC )
+   {
+      Con::warnf( "GBitmap::readDDS() - Stream doesn't contain a DDS." );
+      return false;
+   }
+
+   // Read the header.
+   U32 header[DDS_HEADER_SIZE / sizeof(U32)];
+   for ( U32 index = 0; index < DDS_HEADER_SIZE / sizeof(U32); ++index )
+      stream.read( &header[index] );
+
+   const U32 headerSize  = header[0];
+   const U32 height      = header[2];
+   const U32 width       = header[3];
+   const U32 pixelFlags  = header[19];
+   const U32 fourCC      = header[20];
+
+   if ( headerSize != DDS_HEADER_SIZE || (pixelFlags & DDS_PIXELFORMAT_FOURCC) == 0 || width == 0 || height == 0 )
+   {
+      Con::warnf( "GBitmap::readDDS() - Only block-compressed textures are supported." );
+      return false;
+   }
+
+   // Find the format.
+   BitmapFormat format = Palettized;
+   if ( fourCC == DDS_FOURCC('D','X','T','1') )
+   {
+      format = (pixelFlags & DDS_PIXELFORMAT_ALPHAPIXELS) ? BC1A : BC1;
+   }
+   else if ( fourCC == DDS_FOURCC('D','X','T','3') )
+   {
+      format = BC2;
+   }
+   else if ( fourCC == DDS_FOURCC('D','X','T','5') )
+   {
+      format = BC3;
+   }
+   else if ( fourCC == DDS_FOURCC('D','X','1','0') )
+   {
+      // Read the extended header.
+      U32 dxgiFormat, dimension, miscFlags, arraySize, miscFlags2;
+      stream.read( &dxgiFormat );
+      stream.read( &dimension );
+      stream.read( &miscFlags );
+      stream.read( &arraySize );
+      stream.read( &miscFlags2 );
+
+      if ( dimension == DDS_DIMENSION_TEXTURE2D && arraySize <= 1 )
+      {
+         switch( dxgiFormat )
+         {
+            case DDS_DXGI_FORMAT_BC1_UNORM: format = BC1A; break;
+            case DDS_DXGI_FORMAT_BC2_UNORM: format = BC2;  break;
+            case DDS_DXGI_FORMAT_BC3_UNORM: format = BC3;  break;
+         }
+      }
+   }
+
+   if ( !isCompressedFormat( format ) )
+   {
+      Con::warnf( "GBitmap::readDDS() - Unsupported pixel format." );
+      return false;
+   }
+
+   // Read the top-level image (the size is implied).
+   return readCompressedImage( this, stream, format, width, height, 0 );
+}
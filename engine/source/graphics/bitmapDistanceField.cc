@@ -0,0 +1,176 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "graphics/gBitmap.h"
+#include "collection/vector.h"
+#include "math/mMathFn.h"
+
+//-----------------------------------------------------------------------------
+
+// Offset used for texels that have no nearest seed (yet).
+#define DISTANCE_FIELD_FAR  8192
+
+namespace
+{
+
+struct NearestSeed
+{
+    S32 mOffsetX;
+    S32 mOffsetY;
+
+    inline U32 distanceSquared( void ) const { return (U32)(mOffsetX * mOffsetX + mOffsetY * mOffsetY); }
+};
+
+//-----------------------------------------------------------------------------
+
+inline void compareSeed( Vector<NearestSeed>& seeds, const S32 width, const S32 height, const S32 x, const S32 y, const S32 offsetX, const S32 offsetY )
+{
+    const S32 otherX = x + offsetX;
+    const S32 otherY = y + offsetY;
+
+    // Ignore outside the bitmap.
+    if ( otherX < 0 || otherY < 0 || otherX >= width || otherY >= height )
+        return;
+
+    NearestSeed& seed = seeds[(y * width) + x];
+    const NearestSeed& other = seeds[(otherY * width) + otherX];
+
+    NearestSeed candidate;
+    candidate.mOffsetX = other.mOffsetX + offsetX;
+    candidate.mOffsetY = other.mOffsetY + offsetY;
+
+    if ( candidate.distanceSquared() < seed.distanceSquared() )
+        seed = candidate;
+}
+
+//-----------------------------------------------------------------------------
+
+/// Find the nearest seed of every texel using the two-pass 8-point sequential Euclidean distance transform.
+void findNearestSeeds( Vector<NearestSeed>& seeds, const S32 width, const S32 height )
+{
+    // Forward pass.
+    for ( S32 y = 0; y < height; ++y )
+    {
+        for ( S32 x = 0; x < width; ++x )
+        {
+            compareSeed( seeds, width, height, x, y, -1,  0 );
+            compareSeed( seeds, width, height, x, y,  0, -1 );
+            compareSeed( seeds, width, height, x, y, -1, -1 );
+            compareSeed( seeds, width, height, x, y,  1, -1 );
+        }
+
+        for ( S32 x = width - 1; x >= 0; --x )
+            compareSeed( seeds, width, height, x, y, 1, 0 );
+    }
+
+    // Backward pass.
+    for ( S32 y = height - 1; y >= 0; --y )
+    {
+        for ( S32 x = width - 1; x >= 0; --x )
+        {
+            compareSeed( seeds, width, height, x, y,  1,  0 );
+            compareSeed( seeds, width, height, x, y,  0,  1 );
+            compareSeed( seeds, width, height, x, y, -1,  1 );
+            compareSeed( seeds, width, height, x, y,  1,  1 );
+        }
+
+        for ( S32 x = 0; x < width; ++x )
+            compareSeed( seeds, width, height, x, y, -1, 0 );
+    }
+}
+
+} // namespace
+
+//-----------------------------------------------------------------------------
+
+bool GBitmap::convertToDistanceField( const U32 spread )
+{
+    // Fetch the alpha and color layout.
+    U32 alphaByte;
+    U32 colorBytes;
+    switch( getFormat() )
+    {
+        case Alpha:             alphaByte = 0; colorBytes = 0; break;
+        case LuminanceAlpha:    alphaByte = 1; colorBytes = 1; break;
+        case RGBA:              alphaByte = 3; colorBytes = 3; break;
+
+        default:
+            // Only formats with an alpha channel are supported.
+            return false;
+    }
+
+    AssertFatal( spread > 0, "GBitmap::convertToDistanceField() - Invalid spread." );
+
+    const S32 width = (S32)getWidth();
+    const S32 height = (S32)getHeight();
+    const U32 texelCount = (U32)(width * height);
+    U8* pBits = getWritableBits();
+
+    // Seed the nearest inside and outside texels.
+    NearestSeed seedHere;
+    seedHere.mOffsetX = seedHere.mOffsetY = 0;
+    NearestSeed seedFar;
+    seedFar.mOffsetX = seedFar.mOffsetY = DISTANCE_FIELD_FAR;
+
+    Vector<NearestSeed> nearestInside;
+    Vector<NearestSeed> nearestOutside;
+    nearestInside.setSize( texelCount );
+    nearestOutside.setSize( texelCount );
+    for ( U32 index = 0; index < texelCount; ++index )
+    {
+        const bool inside = pBits[(index * bytesPerPixel) + alphaByte] >= 128;
+        nearestInside[index] = inside ? seedHere : seedFar;
+        nearestOutside[index] = inside ? seedFar : seedHere;
+    }
+
+    findNearestSeeds( nearestInside, width, height );
+    findNearestSeeds( nearestOutside, width, height );
+
+    // Encode the signed distance with the edge at half alpha.
+    const F32 scale = 0.5f / (F32)spread;
+    for ( S32 y = 0; y < height; ++y )
+    {
+        for ( S32 x = 0; x < width; ++x )
+        {
+            const U32 index = (U32)((y * width) + x);
+            const NearestSeed& inside = nearestInside[index];
+            const F32 distance = mSqrt( (F32)nearestOutside[index].distanceSquared() ) - mSqrt( (F32)inside.distanceSquared() );
+            const F32 edgeDistance = distance > 0.0f ? distance - 0.5f : distance + 0.5f;
+
+            U8* pTexel = pBits + (index * bytesPerPixel);
+            pTexel[alphaByte] = (U8)mClampF( (0.5f + edgeDistance * scale) * 255.0f + 0.5f, 0.0f, 255.0f );
+
+            // Outside texels take the color of the nearest inside texel so that filtering around the edge doesn't darken it.
+            if ( colorBytes > 0 && distance < 0.0f && inside.mOffsetX != DISTANCE_FIELD_FAR )
+            {
+                const U8* pNearest = pBits + ((((y + inside.mOffsetY) * width) + x + inside.mOffsetX) * bytesPerPixel);
+                dMemcpy( pTexel, pNearest, colorBytes );
+            }
+        }
+    }
+
+    // Rebuild any mip levels from the field.
+    if ( numMipLevels > 1 )
+        extrudeMipLevels();
+
+    return true;
+}
@@ -45,33 +45,55 @@ bool sgForcePalletedPNGsTo16Bit= false;
 
 // Our chunk signatures...
 
-static const U32 csgMaxRowPointers = (1 << GBitmap::c_maxMipLevels) - 1; ///< 2^11 = 2048, 12 mip levels (see c_maxMipLievels)
-static png_bytep sRowPointers[csgMaxRowPointers];
-
-//-------------------------------------- Instead of using the user_ptr,
-//                                        we use a global pointer, we
-//                                        need to ensure that only one thread
-//                                        at once may be using the variable.
-//                                       NOTE: Removed mutex for g_varAccess.
-//                                        may have to re-thread safe this.
+//-------------------------------------- Writing uses a global pointer rather
+//                                        than the user_ptr so only one thread
+//                                        at once may be writing.  Reading
+//                                        uses the io_ptr instead so that it
+//                                        can be done from a worker thread.
 static Stream* sg_pStream = NULL;
 
 //-------------------------------------- Replacement I/O for standard LIBPng
 //                                        functions.  we don't wanna use
 //                                        FILE*'s...
-static void pngReadDataFn(png_structp  /*png_ptr*/,
+static void pngReadDataFn(png_structp  png_ptr,
                           png_bytep   data,
                           png_size_t  length)
 {
-   AssertFatal(sg_pStream != NULL, "No stream?");
+   Stream* pStream = (Stream*)png_get_io_ptr(png_ptr);
+   AssertFatal(pStream != NULL, "No stream?");
 
    bool success;
-   success = sg_pStream->read((U32)length, data);
+   success = pStream->read((U32)length, data);
     
    AssertFatal(success, "PNG read catastrophic error!");
 }
 
 
+//-------------------------------------- Reading from a copy of the stream in
+//                                        memory avoids a stream call for each
+//                                        chunk libpng reads.
+struct PngMemorySource
+{
+   const U8* mpData;
+   U32       mSize;
+   U32       mPosition;
+};
+
+static void pngReadMemoryFn(png_structp  png_ptr,
+                            png_bytep   data,
+                            png_size_t  length)
+{
+   PngMemorySource* pSource = (PngMemorySource*)png_get_io_ptr(png_ptr);
+   AssertFatal(pSource != NULL, "No source?");
+
+   if (length > pSource->mSize - pSource->mPosition)
+      png_error(png_ptr, "Read past the end of the PNG data.");
+
+   dMemcpy(data, pSource->mpData + pSource->mPosition, length);
+   pSource->mPosition += (U32)length;
+}
+
+
 //--------------------------------------
 static void pngWriteDataFn(png_structp /*png_ptr*/,
                            png_bytep   data,
@@ -105,6 +127,18 @@ static void pngFreeFn(png_structp /*png_ptr*/, png_voidp mem)
 #endif
 }
 
+//-------------------------------------- Reading allocates from the heap as the
+//                                        frame allocator is not thread-safe.
+static png_voidp pngReadMallocFn(png_structp /*png_ptr*/, png_size_t size)
+{
+   return (png_voidp)dMalloc(size);
+}
+
+static void pngReadFreeFn(png_structp /*png_ptr*/, png_voidp mem)
+{
+   dFree(mem);
+}
+
 
 //--------------------------------------
 static void pngFatalErrorFn(png_structp     /*png_ptr*/,
@@ -122,7 +156,7 @@ static void pngWarningFn(png_structp, png_const_charp pMessage)
 
 
 //--------------------------------------
-bool GBitmap::readPNG(Stream& io_rStream)
+bool GBitmap::readPNG(Stream& io_rStream, const bool queryPreferences)
 {
    static const U32 cs_headerBytesChecked = 8;
 
@@ -136,16 +170,14 @@ bool GBitmap::readPNG(Stream& io_rStream)
       return false;
    }
 
-   U32 prevWaterMark = FrameAllocator::getWaterMark();
-
 #if defined(PNG_USER_MEM_SUPPORTED)
    png_structp png_ptr = png_create_read_struct_2(PNG_LIBPNG_VER_STRING,
                                                 NULL,
                                                 pngFatalErrorFn,
                                                 pngWarningFn,
                                                 NULL,
-                                                pngMallocFn,
-                                                pngFreeFn);
+                                                pngReadMallocFn,
+                                                pngReadFreeFn);
 #else
    png_structp png_ptr = png_create_read_struct(PNG_LIBPNG_VER_STRING,
                                                 NULL,
@@ -155,7 +187,6 @@ bool GBitmap::readPNG(Stream& io_rStream)
 
    if (png_ptr == NULL) 
    {
-      FrameAllocator::setWaterMark(prevWaterMark);
       return false;
    }
 
@@ -164,7 +195,6 @@ bool GBitmap::readPNG(Stream& io_rStream)
       png_destroy_read_struct(&png_ptr,
                               (png_infopp)NULL,
                               (png_infopp)NULL);
-      FrameAllocator::setWaterMark(prevWaterMark);
       return false;
    }
 
@@ -173,12 +203,42 @@ bool GBitmap::readPNG(Stream& io_rStream)
       png_destroy_read_struct(&png_ptr,
                               &info_ptr,
                               (png_infopp)NULL);
-      FrameAllocator::setWaterMark(prevWaterMark);
       return false;
    }
 
-   sg_pStream = &io_rStream;
-   png_set_read_fn(png_ptr, NULL, pngReadDataFn);
+   // Read the rest of the stream into memory if it can be repositioned
+   //  afterwards (a PNG can be embedded in another file e.g. a font).
+   //
+   PngMemorySource memorySource;
+   U8* pStreamData = NULL;
+   U32 startPosition = 0;
+   if (io_rStream.hasCapability(Stream::StreamPosition)) {
+      startPosition = io_rStream.getPosition();
+      const U32 streamSize = io_rStream.getStreamSize();
+      if (streamSize > startPosition) {
+         pStreamData = (U8*)dMalloc(streamSize - startPosition);
+         if (io_rStream.read(streamSize - startPosition, pStreamData)) {
+            memorySource.mpData    = pStreamData;
+            memorySource.mSize     = streamSize - startPosition;
+            memorySource.mPosition = 0;
+         } else {
+            dFree(pStreamData);
+            pStreamData = NULL;
+            io_rStream.setPosition(startPosition);
+         }
+      }
+   }
+
+   if (pStreamData != NULL)
+      png_set_read_fn(png_ptr, &memorySource, pngReadMemoryFn);
+   else
+      png_set_read_fn(png_ptr, &io_rStream, pngReadDataFn);
+
+   // Skip the chunk CRCs as zlib still checks the image data itself, and
+   //  inflate the image data in larger blocks.
+   //
+   png_set_crc_action(png_ptr, PNG_CRC_QUIET_USE, PNG_CRC_QUIET_USE);
+   png_set_compression_buffer_size(png_ptr, 64 * 1024);
 
    // Read off the info on the image.
    png_set_sig_bytes(png_ptr, cs_headerBytesChecked);
@@ -270,8 +330,7 @@ bool GBitmap::readPNG(Stream& io_rStream)
                   format);          // use determined format...
 
    // Set up the row pointers...
-   AssertISV(height <= csgMaxRowPointers, "Error, cannot load pngs taller than 2048 pixels!");
-   png_bytep* rowPointers = sRowPointers;
+   png_bytep* rowPointers = (png_bytep*)dMalloc(height * sizeof(png_bytep));
    U8* pBase = (U8*)getBits();
    for (U32 i = 0; i < height; i++)
       rowPointers[i] = pBase + (i * rowBytes);
@@ -285,7 +344,13 @@ bool GBitmap::readPNG(Stream& io_rStream)
    png_read_end(png_ptr, NULL);
    png_destroy_read_struct(&png_ptr, &info_ptr, &end_info);
 
-   sg_pStream = NULL;
+   dFree(rowPointers);
+
+   // Leave the stream positioned just after the PNG.
+   if (pStreamData != NULL) {
+      io_rStream.setPosition(startPosition + memorySource.mPosition);
+      dFree(pStreamData);
+   }
 
    // Ok, the image is read in, now we need to finish up the initialization,
    //  which means: setting up the detailing members, init'ing the palette
@@ -293,11 +358,10 @@ bool GBitmap::readPNG(Stream& io_rStream)
    //
    // actually, all of that was handled by allocateBitmap, so we're outta here
    //
-   FrameAllocator::setWaterMark(prevWaterMark);
 
     //
    //-Mat if all palleted images are to be converted, set mForce16bit
-   if( color_type == PNG_COLOR_TYPE_PALETTE ) {
+   if( queryPreferences && color_type == PNG_COLOR_TYPE_PALETTE ) {
        sgForcePalletedPNGsTo16Bit = dAtob( Con::getVariable("$pref::iPhone::ForcePalletedPNGsTo16Bit") );
        if( sgForcePalletedPNGsTo16Bit ) {
            mForce16Bit = true;
@@ -78,6 +78,298 @@ void dglSetTextAnchorColor(const ColorF& in_rColor)
 }
 
 
+//--------------------------------------------------------------------------
+// GUI batching
+
+namespace {
+
+/// Maximum number of quads held in the batch before it is flushed.
+const U32 sg_batchQuadLimit = 1024;
+
+struct BatchVertex
+{
+   Point2F p;
+   Point2F t;
+   ColorI c;
+};
+
+BatchVertex sg_batchVertices[sg_batchQuadLimit * 4];
+GLushort sg_batchIndices[sg_batchQuadLimit * 6];
+bool sg_batchIndicesBuilt = false;
+U32 sg_batchQuadCount = 0;
+GLuint sg_batchTexture = 0;
+bool sg_batchSilhouette = false;
+ColorI sg_batchSilhouetteColor(0, 0, 0, 0);
+Point2F sg_batchMin;
+Point2F sg_batchMax;
+bool sg_batchUseViewport = false;
+bool sg_batchFlushing = false;
+
+void applyClipRect(const RectI &clipRect)
+{
+   glMatrixMode(GL_PROJECTION);
+   glLoadIdentity();
+
+   U32 screenHeight = Platform::getWindowSize().y;
+
+#if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_ANDROID)
+   glOrthof(clipRect.point.x, clipRect.point.x + clipRect.extent.x,
+           clipRect.extent.y, 0,
+           0, 1);
+#else
+   glOrtho(clipRect.point.x, clipRect.point.x + clipRect.extent.x,
+           clipRect.extent.y, 0,
+           0, 1);
+#endif
+
+   glTranslatef(0.0f, (F32)-clipRect.point.y, 0.0f);
+
+   glMatrixMode(GL_MODELVIEW);
+   glLoadIdentity();
+
+   glViewport(clipRect.point.x, screenHeight - (clipRect.point.y + clipRect.extent.y),
+              clipRect.extent.x, clipRect.extent.y);
+}
+
+void beginBatchQuad(const GLuint texture, const ColorI& color, const bool silhouette)
+{
+   // Flush if the quad can't share the state of the batched quads.
+   if (sg_batchQuadCount > 0 &&
+      (sg_batchTexture != texture || sg_batchSilhouette != silhouette || (silhouette && sg_batchSilhouetteColor != color)))
+      dglFlushBatch();
+
+   // Flush if the batch is full.
+   if (sg_batchQuadCount == sg_batchQuadLimit)
+      dglFlushBatch();
+
+   sg_batchTexture = texture;
+   sg_batchSilhouette = silhouette;
+   sg_batchSilhouetteColor = color;
+}
+
+void appendBatchQuad(const Point2F* pPoints, const Point2F* pTexCoords, const ColorI& color)
+{
+   // Reset the bounds for the first quad.
+   if (sg_batchQuadCount == 0)
+   {
+      sg_batchMin = pPoints[0];
+      sg_batchMax = pPoints[0];
+   }
+
+   BatchVertex* pVertex = sg_batchVertices + (sg_batchQuadCount * 4);
+   for (U32 i = 0; i < 4; i++, pVertex++)
+   {
+      pVertex->p = pPoints[i];
+      pVertex->t = pTexCoords[i];
+      pVertex->c = color;
+
+      sg_batchMin.setMin(pPoints[i]);
+      sg_batchMax.setMax(pPoints[i]);
+   }
+
+   sg_batchQuadCount++;
+}
+
+} // namespace {}
+
+void dglBatchRect(const GLuint texture,
+                  const Point2F& upperL,
+                  const Point2F& lowerR,
+                  const Point2F& texUpperL,
+                  const Point2F& texLowerR,
+                  const ColorI&  color,
+                  const bool     silhouette)
+{
+   const F32 clipLeft   = (F32)sgCurrentClipRect.point.x;
+   const F32 clipTop    = (F32)sgCurrentClipRect.point.y;
+   const F32 clipRight  = (F32)(sgCurrentClipRect.point.x + sgCurrentClipRect.extent.x);
+   const F32 clipBottom = (F32)(sgCurrentClipRect.point.y + sgCurrentClipRect.extent.y);
+
+   // Finish if the rect is empty or entirely clipped.
+   if (upperL.x >= lowerR.x || upperL.y >= lowerR.y ||
+       upperL.x >= clipRight || upperL.y >= clipBottom ||
+       lowerR.x <= clipLeft || lowerR.y <= clipTop)
+      return;
+
+   Point2F upper = upperL;
+   Point2F lower = lowerR;
+   Point2F texUpper = texUpperL;
+   Point2F texLower = texLowerR;
+
+   // Clip the rect moving the texture coordinates in proportion.
+   const Point2F texScale((texLower.x - texUpper.x) / (lower.x - upper.x), (texLower.y - texUpper.y) / (lower.y - upper.y));
+   if (upper.x < clipLeft)
+   {
+      texUpper.x += (clipLeft - upper.x) * texScale.x;
+      upper.x = clipLeft;
+   }
+   if (upper.y < clipTop)
+   {
+      texUpper.y += (clipTop - upper.y) * texScale.y;
+      upper.y = clipTop;
+   }
+   if (lower.x > clipRight)
+   {
+      texLower.x -= (lower.x - clipRight) * texScale.x;
+      lower.x = clipRight;
+   }
+   if (lower.y > clipBottom)
+   {
+      texLower.y -= (lower.y - clipBottom) * texScale.y;
+      lower.y = clipBottom;
+   }
+
+   const Point2F points[4] = { upper, Point2F(lower.x, upper.y), Point2F(upper.x, lower.y), lower };
+   const Point2F texCoords[4] = { texUpper, Point2F(texLower.x, texUpper.y), Point2F(texUpper.x, texLower.y), texLower };
+
+   beginBatchQuad(texture, color, silhouette);
+   appendBatchQuad(points, texCoords, color);
+}
+
+void dglBatchQuad(const GLuint   texture,
+                  const Point2F* pPoints,
+                  const Point2F* pTexCoords,
+                  const ColorI&  color,
+                  const bool     silhouette)
+{
+   // Calculate the quad bounds.
+   Point2F quadMin = pPoints[0];
+   Point2F quadMax = pPoints[0];
+   for (U32 i = 1; i < 4; i++)
+   {
+      quadMin.setMin(pPoints[i]);
+      quadMax.setMax(pPoints[i]);
+   }
+
+   const F32 clipLeft   = (F32)sgCurrentClipRect.point.x;
+   const F32 clipTop    = (F32)sgCurrentClipRect.point.y;
+   const F32 clipRight  = (F32)(sgCurrentClipRect.point.x + sgCurrentClipRect.extent.x);
+   const F32 clipBottom = (F32)(sgCurrentClipRect.point.y + sgCurrentClipRect.extent.y);
+
+   // Finish if the quad is entirely clipped.
+   if (quadMin.x >= clipRight || quadMin.y >= clipBottom || quadMax.x <= clipLeft || quadMax.y <= clipTop)
+      return;
+
+   // Is the quad entirely within the clip rect?
+   if (quadMin.x >= clipLeft && quadMin.y >= clipTop && quadMax.x <= clipRight && quadMax.y <= clipBottom)
+   {
+      // Yes, so batch it.
+      beginBatchQuad(texture, color, silhouette);
+      appendBatchQuad(pPoints, pTexCoords, color);
+      return;
+   }
+
+   // No, so it can't be clipped here and must be drawn on its own using the clip rect viewport.
+   dglFlushBatch();
+   beginBatchQuad(texture, color, silhouette);
+   appendBatchQuad(pPoints, pTexCoords, color);
+   sg_batchUseViewport = true;
+   dglFlushBatch();
+}
+
+void dglFlushBatch()
+{
+   // Finish if there's nothing to draw or the batch is already being flushed.
+   if (sg_batchQuadCount == 0 || sg_batchFlushing)
+      return;
+
+   PROFILE_START(DGL_FlushBatch);
+
+   // Flag as flushing so that the state changes below don't flush again.
+   sg_batchFlushing = true;
+
+   // Build the quad indices once.
+   if (!sg_batchIndicesBuilt)
+   {
+      for (U32 quad = 0; quad < sg_batchQuadLimit; quad++)
+      {
+         GLushort* pIndex = sg_batchIndices + (quad * 6);
+         const GLushort vertex = (GLushort)(quad * 4);
+         pIndex[0] = vertex;
+         pIndex[1] = vertex + 1;
+         pIndex[2] = vertex + 2;
+         pIndex[3] = vertex + 2;
+         pIndex[4] = vertex + 1;
+         pIndex[5] = vertex + 3;
+      }
+      sg_batchIndicesBuilt = true;
+   }
+
+   // Quads were clipped as they were batched but the clip rect may have changed since
+   // so draw across the whole window if any lie outside the current clip rect.
+   const bool fullWindow = !sg_batchUseViewport &&
+      (sg_batchMin.x < (F32)sgCurrentClipRect.point.x ||
+       sg_batchMin.y < (F32)sgCurrentClipRect.point.y ||
+       sg_batchMax.x > (F32)(sgCurrentClipRect.point.x + sgCurrentClipRect.extent.x) ||
+       sg_batchMax.y > (F32)(sgCurrentClipRect.point.y + sgCurrentClipRect.extent.y));
+
+   if (fullWindow)
+   {
+      const Point2I windowSize = Platform::getWindowSize();
+      applyClipRect(RectI(0, 0, windowSize.x, windowSize.y));
+   }
+
+   dglDisable(GL_LIGHTING);
+
+   if (sg_batchTexture != 0)
+   {
+      dglEnable(GL_TEXTURE_2D);
+      dglBindTexture(GL_TEXTURE_2D, sg_batchTexture);
+
+      if (sg_batchSilhouette)
+      {
+         glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_BLEND);
+
+         const ColorF silhouetteColor = sg_batchSilhouetteColor;
+         glTexEnvfv(GL_TEXTURE_ENV, GL_TEXTURE_ENV_COLOR, silhouetteColor.address());
+      }
+      else
+      {
+         glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+      }
+
+      dglEnableClientState(GL_TEXTURE_COORD_ARRAY);
+      glTexCoordPointer(2, GL_FLOAT, sizeof(BatchVertex), &(sg_batchVertices[0].t));
+   }
+   else
+   {
+      dglDisable(GL_TEXTURE_2D);
+      dglDisableClientState(GL_TEXTURE_COORD_ARRAY);
+   }
+
+   dglEnable(GL_BLEND);
+   dglBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+   dglEnableClientState(GL_VERTEX_ARRAY);
+   dglEnableClientState(GL_COLOR_ARRAY);
+   glVertexPointer(2, GL_FLOAT, sizeof(BatchVertex), &(sg_batchVertices[0].p));
+   glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(BatchVertex), &(sg_batchVertices[0].c));
+
+   glDrawElements(GL_TRIANGLES, sg_batchQuadCount * 6, GL_UNSIGNED_SHORT, sg_batchIndices);
+
+   if (sg_batchSilhouette)
+   {
+      glTexEnvfv(GL_TEXTURE_ENV, GL_TEXTURE_ENV_COLOR, ColorF(0.0f, 0.0f, 0.0f, 0.0f).address());
+   }
+
+   // Leave the vertex array enabled as the immediate drawing has always expected.
+   dglDisableClientState(GL_COLOR_ARRAY);
+   dglDisableClientState(GL_TEXTURE_COORD_ARRAY);
+
+   dglDisable(GL_BLEND);
+   dglDisable(GL_TEXTURE_2D);
+
+   // Restore the clip rect.
+   if (fullWindow)
+      applyClipRect(sgCurrentClipRect);
+
+   sg_batchQuadCount = 0;
+   sg_batchUseViewport = false;
+   sg_batchFlushing = false;
+
+   PROFILE_END();
+}
+
 //--------------------------------------------------------------------------
 void dglDrawBitmapStretchSR(TextureObject* texture,
                        const RectI&   dstRect,
@@ -92,70 +384,10 @@ void dglDrawBitmapStretchSR(TextureObject* texture,
    AssertFatal(srcRect.isValidRect() == true,
                "GSurface::drawBitmapStretchSR: routines assume normal rects");
 
-   glDisable(GL_LIGHTING);
-
-   glEnable(GL_TEXTURE_2D);
-   glBindTexture(GL_TEXTURE_2D, texture->getGLTextureName());
-   //glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
-
-   if (bSilhouette)
-   {
-      glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_BLEND);
-   
-      ColorF kModulationColor;
-      dglGetBitmapModulation(&kModulationColor);
-      glTexEnvfv(GL_TEXTURE_ENV, GL_TEXTURE_ENV_COLOR, kModulationColor.address());
-   }
-   else
-   {
-      glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
-   }
-   glEnable(GL_BLEND);
-   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
    F32 texLeft   = F32(srcRect.point.x)                    / F32(texture->getTextureWidth());
    F32 texRight  = F32(srcRect.point.x + srcRect.extent.x) / F32(texture->getTextureWidth());
    F32 texTop    = F32(srcRect.point.y)                    / F32(texture->getTextureHeight());
    F32 texBottom = F32(srcRect.point.y + srcRect.extent.y) / F32(texture->getTextureHeight());
-     Point2F scrPoints[4];
-   if(fSpin == 0.0f)
-   {
-            scrPoints[0].x = (F32)dstRect.point.x;
-            scrPoints[0].y = (F32)dstRect.point.y;
-            scrPoints[1].x = (F32)(dstRect.point.x + dstRect.extent.x);
-            scrPoints[1].y = (F32)dstRect.point.y;
-            scrPoints[2].x = (F32)dstRect.point.x;
-            scrPoints[2].y = (F32)(dstRect.point.y + dstRect.extent.y);
-            scrPoints[3].x = (F32)(dstRect.point.x + dstRect.extent.x);
-            scrPoints[3].y = (F32)(dstRect.point.y + dstRect.extent.y);
-            //screenLeft   = dstRect.point.x;
-            //screenRight  = dstRect.point.x + dstRect.extent.x;
-            //screenTop    = dstRect.point.y;
-            //screenBottom = dstRect.point.y + dstRect.extent.y;
-        }
-        else
-   {
-     //WE NEED TO IMPLEMENT A FAST 2D ROTATION -- NOT THIS SLOWER 3D ROTATION
-     MatrixF rotMatrix( EulerF( 0.0, 0.0, mDegToRad(fSpin) ) );
-
-     Point3F offset( dstRect.point.x + dstRect.extent.x / 2.0f,
-                                         dstRect.point.y + dstRect.extent.y / 2.0f, 0.0 );
-         Point3F points[4];
-   
-     points[0] = Point3F(-dstRect.extent.x / 2.0f,  dstRect.extent.y / 2.0f, 0.0);
-     points[1] = Point3F( dstRect.extent.x / 2.0f,  dstRect.extent.y / 2.0f, 0.0);
-     points[2] = Point3F(-dstRect.extent.x / 2.0f, -dstRect.extent.y / 2.0f, 0.0);
-     points[3] = Point3F( dstRect.extent.x / 2.0f, -dstRect.extent.y / 2.0f, 0.0);
-
-     for( int i=0; i<4; i++ )
-     {
-        rotMatrix.mulP( points[i] );
-        points[i] += offset;
-        scrPoints[i].x = points[i].x;
-        scrPoints[i].y = points[i].y;
-     }
-   }
-  
 
    if(in_flip & GFlip_X)
    {
@@ -170,59 +402,48 @@ void dglDrawBitmapStretchSR(TextureObject* texture,
       texBottom = temp;
    }
 
-   glColor4ub(sg_bitmapModulation.red,
-             sg_bitmapModulation.green,
-             sg_bitmapModulation.blue,
-             sg_bitmapModulation.alpha);
-
-#if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_ANDROID) || defined(TORQUE_OS_EMSCRIPTEN)
-
-    GLfloat verts[] = {
-        (GLfloat)scrPoints[0].x, (GLfloat)scrPoints[0].y,
-        (GLfloat)scrPoints[1].x, (GLfloat)scrPoints[1].y,
-        (GLfloat)scrPoints[2].x, (GLfloat)scrPoints[2].y,
-        (GLfloat)scrPoints[3].x, (GLfloat)scrPoints[3].y,
-    };
-    GLfloat texVerts[] = {
-        (GLfloat)texLeft, (GLfloat)texTop,
-        (GLfloat)texRight, (GLfloat)texTop,		
-        (GLfloat)texLeft, (GLfloat)texBottom,
-        (GLfloat)texRight, (GLfloat)texBottom,
-    };
-    
-    
-    glDisableClientState(GL_COLOR_ARRAY);
-    //glDisableClientState(GL_POINT_SIZE_ARRAY_OES);
-    glEnableClientState(GL_VERTEX_ARRAY);
-    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-    
-    glVertexPointer(2, GL_FLOAT, 0, verts);
-    glTexCoordPointer(2, GL_FLOAT, 0, texVerts);
-    
-    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+   // Unrotated bitmaps are clipped and batched directly.
+   if(fSpin == 0.0f)
+   {
+      dglBatchRect(texture->getGLTextureName(),
+                   Point2F((F32)dstRect.point.x, (F32)dstRect.point.y),
+                   Point2F((F32)(dstRect.point.x + dstRect.extent.x), (F32)(dstRect.point.y + dstRect.extent.y)),
+                   Point2F(texLeft, texTop),
+                   Point2F(texRight, texBottom),
+                   sg_bitmapModulation,
+                   bSilhouette);
+      return;
+   }
 
-#else
-   glBegin(GL_TRIANGLE_FAN);
-      glTexCoord2f(texLeft, texBottom);
-      glVertex2f(scrPoints[2].x, scrPoints[2].y);
+   //WE NEED TO IMPLEMENT A FAST 2D ROTATION -- NOT THIS SLOWER 3D ROTATION
+   MatrixF rotMatrix( EulerF( 0.0, 0.0, mDegToRad(fSpin) ) );
 
-      glTexCoord2f(texRight, texBottom);
-      glVertex2f(scrPoints[3].x, scrPoints[3].y);
+   Point3F offset( dstRect.point.x + dstRect.extent.x / 2.0f,
+                   dstRect.point.y + dstRect.extent.y / 2.0f, 0.0 );
+   Point3F points[4];
 
-      glTexCoord2f(texRight, texTop);
-      glVertex2f(scrPoints[1].x, scrPoints[1].y);
+   points[0] = Point3F(-dstRect.extent.x / 2.0f,  dstRect.extent.y / 2.0f, 0.0);
+   points[1] = Point3F( dstRect.extent.x / 2.0f,  dstRect.extent.y / 2.0f, 0.0);
+   points[2] = Point3F(-dstRect.extent.x / 2.0f, -dstRect.extent.y / 2.0f, 0.0);
+   points[3] = Point3F( dstRect.extent.x / 2.0f, -dstRect.extent.y / 2.0f, 0.0);
 
-      glTexCoord2f(texLeft, texTop);
-      glVertex2f(scrPoints[0].x, scrPoints[0].y);
-   glEnd();
-#endif
-   if (bSilhouette)
+   Point2F scrPoints[4];
+   for( int i=0; i<4; i++ )
    {
-      glTexEnvfv(GL_TEXTURE_ENV, GL_TEXTURE_ENV_COLOR, ColorF(0.0f, 0.0f, 0.0f, 0.0f).address());
+      rotMatrix.mulP( points[i] );
+      points[i] += offset;
+      scrPoints[i].x = points[i].x;
+      scrPoints[i].y = points[i].y;
    }
 
-   glDisable(GL_BLEND);
-   glDisable(GL_TEXTURE_2D);
+   const Point2F texCoords[4] = {
+      Point2F(texLeft, texTop),
+      Point2F(texRight, texTop),
+      Point2F(texLeft, texBottom),
+      Point2F(texRight, texBottom)
+   };
+
+   dglBatchQuad(texture->getGLTextureName(), scrPoints, texCoords, sg_bitmapModulation, bSilhouette);
 }
 
 void dglDrawBitmap(TextureObject* texture, const Point2I& in_rAt, const U32 in_flip)
@@ -308,22 +529,6 @@ U32 dglDrawText(GFont*   font,
    return dglDrawTextN(font, ptDraw, in_string, dStrlen((const UTF8 *) in_string), colorTable, maxColorIndex, rot);
 }
 
-struct TextVertex
-{
-   Point2F p;
-   Point2F t;
-   ColorI c;
-    TextVertex() { set( 0.0f, 0.0f, 0.0f, 0.0f, ColorI(0, 0, 0) ); }
-   void set(F32 x, F32 y, F32 tx, F32 ty, ColorI color)
-   {
-      p.x = x;
-      p.y = y;
-      t.x = tx;
-      t.y = ty;
-      c = color;
-   }
-};
-
 //------------------------------------------------------------------------------
 
 U32 dglDrawTextN(GFont*          font,
@@ -348,7 +553,6 @@ U32 dglDrawTextN(GFont*          font,
 
 //-----------------------------------------------------------------------------
 
-#if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_ANDROID) || defined(TORQUE_OS_EMSCRIPTEN)
 U32 dglDrawTextN(GFont*          font,
                  const Point2I&  ptDraw,
                  const UTF16*    in_string,
@@ -356,230 +560,65 @@ U32 dglDrawTextN(GFont*          font,
                  const ColorI*   colorTable,
                  const U32       maxColorIndex,
                  F32             rot)
-
 {
    // return on zero length strings
    if( n < 1 )
       return ptDraw.x;
+   PROFILE_START(DrawText);
 
-
-   MatrixF rotMatrix( EulerF( 0.0, 0.0, mDegToRad( rot ) ) );
-   Point3F offset( ptDraw.x, ptDraw.y, 0.0 );
-   Point3F points[4];
-
-   U32 nCharCount = 0;
-
-   Point2I     pt;
-   UTF16       c;
-   pt.x                 = 0;
-
-   ColorI                  currentColor;
-   S32                     currentPt = 0;
-
-   TextureObject *lastTexture = NULL;
-
-   currentColor      = sg_bitmapModulation;
-
-   FrameTemp<TextVertex> vert(4*n);
-
-   glDisable(GL_LIGHTING);
-
-   glEnable(GL_TEXTURE_2D);
-   glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
-   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-   glEnable(GL_BLEND);
-
-   //Luma: Optimise by setting states once before inner loop
-   glEnableClientState ( GL_VERTEX_ARRAY );
-   glEnableClientState ( GL_COLOR_ARRAY );
-   glEnableClientState ( GL_TEXTURE_COORD_ARRAY );
-   glVertexPointer     ( 2, GL_FLOAT, sizeof(TextVertex), &(vert[0].p) );
-   glColorPointer      ( 4, GL_UNSIGNED_BYTE, sizeof(TextVertex), &(vert[0].c) );
-   glTexCoordPointer   ( 2, GL_FLOAT, sizeof(TextVertex), &(vert[0].t) );
-
-   // first build the point, color, and coord arrays
-   U32 i;
-
-   for(i = 0,c = in_string[i];in_string[i] && i < n;i++,c = in_string[i])
+   // unrotated text is drawn from the font's cached layout
+   if ( rot == 0.0f )
    {
-      nCharCount++;
-      if(nCharCount > n)
-          break;
+      const GFont::GlyphRun* pRun = font->getGlyphRun(in_string, n);
+      const Point2F origin( (F32)ptDraw.x, (F32)ptDraw.y );
+      ColorI currentColor = sg_bitmapModulation;
 
-      // We have to do a little dance here since \t = 0x9, \n = 0xa, and \r = 0xd
-      if ((c >=  1 && c <=  7) ||
-         (c >= 11 && c <= 12) ||
-         (c == 14))
+      for ( S32 i = 0; i < pRun->mOps.size(); i++ )
       {
-         // Color code
-         if (colorTable)
+         const GFont::GlyphRunOp& op = pRun->mOps[i];
+         switch( op.mType )
          {
-            static U8 remap[15] =
+         case GFont::GlyphRunOp::Glyph:
             {
-               0x0, // 0 special null terminator
-               0x0, // 1 ascii start-of-heading??
-               0x1, 
-               0x2, 
-               0x3, 
-               0x4, 
-               0x5, 
-               0x6, 
-               0x0, // 8 special backspace
-               0x0, // 9 special tab
-               0x0, // a special \n
-               0x7, 
-               0x8,
-               0x0, // a special \r
-               0x9 
-            };
+               TextureObject *glyphTexture = font->getTextureHandle(op.mSheet);
+               dglBatchRect(glyphTexture->getGLTextureName(), origin + op.mUpperL, origin + op.mLowerR, op.mTexUpperL, op.mTexLowerR, currentColor);
+            }
+            break;
 
-            U8 remapped = remap[c];
+         case GFont::GlyphRunOp::SetColor:
             // Ignore if the color is greater than the specified max index:
-            if ( remapped <= maxColorIndex )
+            if ( colorTable && op.mColorIndex <= maxColorIndex )
             {
-               const ColorI &clr = colorTable[remapped];
-               sg_bitmapModulation = clr;
-               currentColor = clr;
+               currentColor = colorTable[op.mColorIndex];
+               sg_bitmapModulation = currentColor;
             }
-         }
-         continue;
-      }
-
-      // reset color?
-      if ( c == 15 )
-      {
-         currentColor = sg_textAnchorColor;
-         sg_bitmapModulation = sg_textAnchorColor;
-         continue;
-      }
+            break;
 
-      // push color:
-      if ( c == 16 )
-      {
-         sg_stackColor = sg_bitmapModulation;
-         continue;
-      }
+         case GFont::GlyphRunOp::ResetColor:
+            currentColor = sg_textAnchorColor;
+            sg_bitmapModulation = sg_textAnchorColor;
+            break;
 
-      // pop color:
-      if ( c == 17 )
-      {
-         currentColor = sg_stackColor;
-         sg_bitmapModulation = sg_stackColor;
-         continue;
-      }
+         case GFont::GlyphRunOp::PushColor:
+            sg_stackColor = sg_bitmapModulation;
+            break;
 
-      // Tab character
-      if ( c == dT('\t') ) 
-      {
-          const PlatformFont::CharInfo &ci = font->getCharInfo( dT(' ') );
-          pt.x += ci.xIncrement * GFont::TabWidthInSpaces;
-          continue;
-      }
-
-      if( !font->isValidChar( c ) )  
-         continue;
-
-      const PlatformFont::CharInfo &ci = font->getCharInfo(c);
-
-      if(ci.bitmapIndex == -1)
-      {
-         pt.x += ci.xOrigin + ci.xIncrement;
-         continue;
-      }
-
-      TextureObject *newObj = font->getTextureHandle(ci.bitmapIndex);
-      if(newObj != lastTexture)
-      {
-         if(currentPt)
-         {
-            glBindTexture(GL_TEXTURE_2D, lastTexture->getGLTextureName());
-
-            //Luma:	More optimal rendering
-            for (S32 i=0; i<currentPt; i+=4) 
-            {
-                glDrawArrays(GL_TRIANGLE_STRIP, i, 4);
-            }
-            currentPt = 0;
+         case GFont::GlyphRunOp::PopColor:
+            currentColor = sg_stackColor;
+            sg_bitmapModulation = sg_stackColor;
+            break;
          }
-         lastTexture = newObj;
       }
-      if(ci.width != 0 && ci.height != 0)
-      {
-         pt.y = font->getBaseline() - ci.yOrigin;
-         pt.x += ci.xOrigin;
-
-         F32 texLeft   = F32(ci.xOffset)             / F32(lastTexture->getTextureWidth());
-         F32 texRight  = F32(ci.xOffset + ci.width)  / F32(lastTexture->getTextureWidth());
-         F32 texTop    = F32(ci.yOffset)             / F32(lastTexture->getTextureHeight());
-         F32 texBottom = F32(ci.yOffset + ci.height) / F32(lastTexture->getTextureHeight());
-
-         F32 screenLeft   = pt.x;
-         F32 screenRight  = pt.x + ci.width;
-         F32 screenTop    = pt.y;
-         F32 screenBottom = pt.y + ci.height;
 
-         points[0] = Point3F(screenLeft, screenTop, 0.0);
-         points[1] = Point3F(screenRight,  screenTop, 0.0);
-         points[2] = Point3F( screenLeft,  screenBottom, 0.0);
-         points[3] = Point3F( screenRight, screenBottom, 0.0);
-
-         for( int i=0; i<4; i++ )
-         {
-            rotMatrix.mulP( points[i] );
-            points[i] += offset;
-         }
-         vert[currentPt++].set(points[0].x, points[0].y, texLeft, texTop, currentColor);
-         vert[currentPt++].set(points[1].x, points[1].y, texRight, texTop, currentColor);
-         vert[currentPt++].set(points[2].x, points[2].y, texLeft, texBottom, currentColor);
-         vert[currentPt++].set(points[3].x, points[3].y, texRight, texBottom, currentColor);
-         pt.x += ci.xIncrement - ci.xOrigin;
-      }
-      else
-         pt.x += ci.xIncrement;
-   }
-   if(currentPt)
-   {
-       //Luma:	More optimal rendering
-       glBindTexture(GL_TEXTURE_2D, lastTexture->getGLTextureName());
-       for (S32 i=0; i<currentPt; i+=4) 
-       {
-            glDrawArrays(GL_TRIANGLE_STRIP, i, 4);
-       }
+      PROFILE_END();
+      return pRun->mAdvance;
    }
 
-   glDisableClientState ( GL_VERTEX_ARRAY );
-   glDisableClientState ( GL_COLOR_ARRAY );
-   glDisableClientState ( GL_TEXTURE_COORD_ARRAY );
-
-   glDisable(GL_BLEND);
-   glDisable(GL_TEXTURE_2D);
-
-   pt.x += ptDraw.x; // DAW: Account for the fact that we removed the drawing point from the text start at the beginning.
-
-   AssertFatal(pt.x >= ptDraw.x, "How did this happen?");
-   PROFILE_END();
-
-   return pt.x - ptDraw.x;
-}
-
-#else
-
-U32 dglDrawTextN(GFont*          font,
-                 const Point2I&  ptDraw,
-                 const UTF16*    in_string,
-                 U32             n,
-                 const ColorI*   colorTable,
-                 const U32       maxColorIndex,
-                 F32             rot)
-{
-   // return on zero length strings
-   if( n < 1 )
-      return ptDraw.x;
-   PROFILE_START(DrawText);
-
    MatrixF rotMatrix( EulerF( 0.0, 0.0, mDegToRad( rot ) ) );
    Point3F offset( (F32)ptDraw.x, (F32)ptDraw.y, 0.0f );
    Point3F points[4];
+   Point2F scrPoints[4];
+   Point2F texCoords[4];
 
    U32 nCharCount = 0;
 
@@ -588,31 +627,10 @@ U32 dglDrawTextN(GFont*          font,
    pt.x                 = 0;
 
    ColorI                  currentColor;
-   S32                     currentPt = 0;
-
-   TextureObject *lastTexture = NULL;
 
    currentColor      = sg_bitmapModulation;
 
-   FrameTemp<TextVertex> vert(4*n);
-
-   glDisable(GL_LIGHTING);
-
-   glEnable(GL_TEXTURE_2D);
-   glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
-   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-   glEnable(GL_BLEND);
-
-   glEnableClientState ( GL_VERTEX_ARRAY );
-   glVertexPointer     ( 2, GL_FLOAT, sizeof(TextVertex), &(vert[0].p) );
-
-   glEnableClientState ( GL_COLOR_ARRAY );
-   glColorPointer      ( 4, GL_UNSIGNED_BYTE, sizeof(TextVertex), &(vert[0].c) );
-
-   glEnableClientState ( GL_TEXTURE_COORD_ARRAY );
-   glTexCoordPointer   ( 2, GL_FLOAT, sizeof(TextVertex), &(vert[0].t) );
-
-   // first build the point, color, and coord arrays
+   // rotated text is laid out here each time
    U32 i;
 
    for(i = 0,c = in_string[i];in_string[i] && i < n;i++,c = in_string[i])
@@ -702,64 +720,47 @@ U32 dglDrawTextN(GFont*          font,
          continue;
       }
 
-      TextureObject *newObj = font->getTextureHandle(ci.bitmapIndex);
-      if(newObj != lastTexture)
-      {
-         if(currentPt)
-         {
-            glBindTexture(GL_TEXTURE_2D, lastTexture->getGLTextureName());
-            glDrawArrays( GL_QUADS, 0, currentPt );
-            currentPt = 0;
-         }
-         lastTexture = newObj;
-      }
       if(ci.width != 0 && ci.height != 0)
       {
+         TextureObject *glyphTexture = font->getTextureHandle(ci.bitmapIndex);
+
          pt.y = font->getBaseline() - ci.yOrigin;
          pt.x += ci.xOrigin;
 
-         F32 texLeft   = F32(ci.xOffset)             / F32(lastTexture->getTextureWidth());
-         F32 texRight  = F32(ci.xOffset + ci.width)  / F32(lastTexture->getTextureWidth());
-         F32 texTop    = F32(ci.yOffset)             / F32(lastTexture->getTextureHeight());
-         F32 texBottom = F32(ci.yOffset + ci.height) / F32(lastTexture->getTextureHeight());
+         F32 texLeft   = F32(ci.xOffset)             / F32(glyphTexture->getTextureWidth());
+         F32 texRight  = F32(ci.xOffset + ci.width)  / F32(glyphTexture->getTextureWidth());
+         F32 texTop    = F32(ci.yOffset)             / F32(glyphTexture->getTextureHeight());
+         F32 texBottom = F32(ci.yOffset + ci.height) / F32(glyphTexture->getTextureHeight());
 
          F32 screenLeft   = (F32)pt.x;
          F32 screenRight  = (F32)(pt.x + ci.width);
          F32 screenTop    = (F32)pt.y;
          F32 screenBottom = (F32)(pt.y + ci.height);
 
-         points[0] = Point3F(screenLeft, screenBottom, 0.0);
-         points[1] = Point3F(screenRight,  screenBottom, 0.0);
-         points[2] = Point3F( screenRight,  screenTop, 0.0);
-         points[3] = Point3F( screenLeft, screenTop, 0.0);
+         points[0] = Point3F(screenLeft, screenTop, 0.0);
+         points[1] = Point3F(screenRight,  screenTop, 0.0);
+         points[2] = Point3F( screenLeft,  screenBottom, 0.0);
+         points[3] = Point3F( screenRight, screenBottom, 0.0);
 
          for( int i=0; i<4; i++ )
          {
             rotMatrix.mulP( points[i] );
             points[i] += offset;
+            scrPoints[i].set(points[i].x, points[i].y);
          }
 
-         vert[currentPt++].set(points[0].x, points[0].y, texLeft, texBottom, currentColor);
-         vert[currentPt++].set(points[1].x, points[1].y, texRight, texBottom, currentColor);
-         vert[currentPt++].set(points[2].x, points[2].y, texRight, texTop, currentColor);
-         vert[currentPt++].set(points[3].x, points[3].y, texLeft, texTop, currentColor);
+         texCoords[0].set(texLeft, texTop);
+         texCoords[1].set(texRight, texTop);
+         texCoords[2].set(texLeft, texBottom);
+         texCoords[3].set(texRight, texBottom);
+
+         dglBatchQuad(glyphTexture->getGLTextureName(), scrPoints, texCoords, currentColor);
+
          pt.x += ci.xIncrement - ci.xOrigin;
       }
       else
          pt.x += ci.xIncrement;
    }
-   if(currentPt)
-   {
-      glBindTexture(GL_TEXTURE_2D, lastTexture->getGLTextureName());
-      glDrawArrays( GL_QUADS, 0, currentPt );
-   }
-
-   glDisableClientState ( GL_VERTEX_ARRAY );
-   glDisableClientState ( GL_COLOR_ARRAY );
-   glDisableClientState ( GL_TEXTURE_COORD_ARRAY );
-
-   glDisable(GL_BLEND);
-   glDisable(GL_TEXTURE_2D);
 
    pt.x += ptDraw.x; // DAW: Account for the fact that we removed the drawing point from the text start at the beginning.
 
@@ -768,16 +769,18 @@ U32 dglDrawTextN(GFont*          font,
 
    return pt.x - ptDraw.x;
 }
-#endif
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=- //
 // Drawing primitives
 
 void dglDrawLine(S32 x1, S32 y1, S32 x2, S32 y2, const ColorI &color)
 {
-   glEnable(GL_BLEND);
-   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-   glDisable(GL_TEXTURE_2D);
+   // draw after any batched quads
+   dglFlushBatch();
+
+   dglEnable(GL_BLEND);
+   dglBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+   dglDisable(GL_TEXTURE_2D);
 
    glColor4ub(color.red, color.green, color.blue, color.alpha);
 #if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_ANDROID) || defined(TORQUE_OS_EMSCRIPTEN)
@@ -807,9 +810,12 @@ void dglDrawLine(const Point2I &startPt, const Point2I &endPt, const ColorI &col
 
 void dglDrawRect(const Point2I &upperL, const Point2I &lowerR, const ColorI &color, const float &lineWidth)
 {
-   glEnable(GL_BLEND);
-   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-   glDisable(GL_TEXTURE_2D);
+   // draw after any batched quads
+   dglFlushBatch();
+
+   dglEnable(GL_BLEND);
+   dglBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+   dglDisable(GL_TEXTURE_2D);
 
    glLineWidth(lineWidth);
 
@@ -848,26 +854,16 @@ void dglDrawRect(const RectI &rect, const ColorI &color, const float &lineWidth)
 
 void dglDrawRectFill(const Point2I &upperL, const Point2I &lowerR, const ColorI &color)
 {
-   glEnable(GL_BLEND);
-   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-   glDisable(GL_TEXTURE_2D);
+   Point2F upper((F32)upperL.x, (F32)upperL.y);
+   Point2F lower((F32)lowerR.x, (F32)lowerR.y);
 
-   glColor4ub(color.red, color.green, color.blue, color.alpha);
-#if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_ANDROID) || defined(TORQUE_OS_EMSCRIPTEN)
-    GLfloat vertices[] = {
-        (GLfloat)upperL.x, (GLfloat)upperL.y,
-        (GLfloat)upperL.x, (GLfloat)lowerR.y,
-        (GLfloat)lowerR.x, (GLfloat)upperL.y,
-        (GLfloat)lowerR.x, (GLfloat)lowerR.y,
-    };
-    
-    glVertexPointer(2, GL_FLOAT, 0, vertices);
-    glEnableClientState(GL_VERTEX_ARRAY);
+   // Normalize the corners as the fill has never required them to be ordered.
+   if (upper.x > lower.x)
+      mSwap(upper.x, lower.x);
+   if (upper.y > lower.y)
+      mSwap(upper.y, lower.y);
 
-    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-#else
-   glRecti((S32)upperL.x, (S32)upperL.y, (S32)lowerR.x, (S32)lowerR.y);
-#endif
+   dglBatchRect(0, upper, lower, Point2F(0.0f, 0.0f), Point2F(0.0f, 0.0f), color);
 }
 void dglDrawRectFill(const RectI &rect, const ColorI &color)
 {
@@ -877,6 +873,9 @@ void dglDrawRectFill(const RectI &rect, const ColorI &color)
 
 void dglDraw2DSquare( const Point2F &screenPoint, F32 width, F32 spinAngle )
 {
+   // draw after any batched quads
+   dglFlushBatch();
+
    width *= 0.5;
 
    MatrixF rotMatrix( EulerF( 0.0, 0.0, spinAngle ) );
@@ -910,10 +909,10 @@ void dglDraw2DSquare( const Point2F &screenPoint, F32 width, F32 spinAngle )
         (GLfloat)points[2].x, (GLfloat)points[2].y,
     };
     
-    glDisableClientState(GL_COLOR_ARRAY);
+    dglDisableClientState(GL_COLOR_ARRAY);
     //glDisableClientState(GL_POINT_SIZE_ARRAY_OES);
-    glEnableClientState(GL_VERTEX_ARRAY);
-    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    dglEnableClientState(GL_VERTEX_ARRAY);
+    dglEnableClientState(GL_TEXTURE_COORD_ARRAY);
     
     glVertexPointer(2, GL_FLOAT, 0, verts);
     glTexCoordPointer(2, GL_FLOAT, 0, texVerts);
@@ -937,6 +936,9 @@ void dglDraw2DSquare( const Point2F &screenPoint, F32 width, F32 spinAngle )
 
 void dglDrawBillboard( const Point3F &position, F32 width, F32 spinAngle )
 {
+   // draw after any batched quads
+   dglFlushBatch();
+
    MatrixF modelview;
    dglGetModelview( &modelview );
    modelview.transpose();
@@ -975,10 +977,10 @@ void dglDrawBillboard( const Point3F &position, F32 width, F32 spinAngle )
         (GLfloat)points[2].x, (GLfloat)points[2].y,
     };
     
-    glDisableClientState(GL_COLOR_ARRAY);
+    dglDisableClientState(GL_COLOR_ARRAY);
     //glDisableClientState(GL_POINT_SIZE_ARRAY_OES);
-    glEnableClientState(GL_VERTEX_ARRAY);
-    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    dglEnableClientState(GL_VERTEX_ARRAY);
+    dglEnableClientState(GL_TEXTURE_COORD_ARRAY);
     
     glVertexPointer(2, GL_FLOAT, 0, verts);
     glTexCoordPointer(2, GL_FLOAT, 0, texVerts);
@@ -1002,6 +1004,9 @@ void dglDrawBillboard( const Point3F &position, F32 width, F32 spinAngle )
 
 void dglWireCube(const Point3F & extent, const Point3F & center)
 {
+   // draw after any batched quads
+   dglFlushBatch();
+
    static Point3F cubePoints[8] =
    {
       Point3F(-1, -1, -1), Point3F(-1, -1,  1), Point3F(-1,  1, -1), Point3F(-1,  1,  1),
@@ -1014,7 +1019,7 @@ void dglWireCube(const Point3F & extent, const Point3F & center)
       { 3, 2, 6, 7 }, { 7, 6, 4, 5 }, { 3, 7, 5, 1 }
    };
 
-   glDisable(GL_CULL_FACE);
+   dglDisable(GL_CULL_FACE);
 
 #if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_ANDROID) || defined(TORQUE_OS_EMSCRIPTEN)
 //PUAP -Mat untested
@@ -1059,6 +1064,9 @@ void dglWireCube(const Point3F & extent, const Point3F & center)
 
 void dglSolidCube(const Point3F & extent, const Point3F & center)
 {
+   // draw after any batched quads
+   dglFlushBatch();
+
    static Point3F cubePoints[8] =
    {
       Point3F(-1, -1, -1), Point3F(-1, -1,  1), Point3F(-1,  1, -1), Point3F(-1,  1,  1),
@@ -1113,28 +1121,8 @@ void dglSolidCube(const Point3F & extent, const Point3F & center)
 
 void dglSetClipRect(const RectI &clipRect)
 {
-   glMatrixMode(GL_PROJECTION);
-   glLoadIdentity();
-
-   U32 screenHeight = Platform::getWindowSize().y;
-
-#if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_ANDROID)
-   glOrthof(clipRect.point.x, clipRect.point.x + clipRect.extent.x,
-           clipRect.extent.y, 0,
-           0, 1);
-#else
-   glOrtho(clipRect.point.x, clipRect.point.x + clipRect.extent.x,
-           clipRect.extent.y, 0,
-           0, 1);
-#endif
-
-   glTranslatef(0.0f, (F32)-clipRect.point.y, 0.0f);
-
-   glMatrixMode(GL_MODELVIEW);
-   glLoadIdentity();
-
-   glViewport(clipRect.point.x, screenHeight - (clipRect.point.y + clipRect.extent.y),
-              clipRect.extent.x, clipRect.extent.y);
+   // batched quads are clipped as they are added so don't need flushing here
+   applyClipRect(clipRect);
 
    sgCurrentClipRect = clipRect;
 }
@@ -1300,6 +1288,9 @@ bool dglIsInCanonicalState()
 
 void dglSetCanonicalState()
 {
+   // draw after any batched quads
+   dglFlushBatch();
+
 #if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_ANDROID) || defined(TORQUE_OS_EMSCRIPTEN)
 // PUAP -Mat removed unsupported textureARB and Fog stuff
    glDisable(GL_BLEND);
@@ -1348,6 +1339,9 @@ void dglSetCanonicalState()
    if (dglDoesSupportFogCoord())
       glDisableClientState(GL_FOG_COORDINATE_ARRAY_EXT);
 #endif
+
+   // The state was set directly so forget anything shadowed.
+   dglInvalidateState();
 }
 
 void dglGetTransformState(S32* mvDepth,
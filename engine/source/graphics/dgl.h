@@ -194,6 +194,65 @@ void dglWireCube(const Point3F &extent, const Point3F &center);
 /// Draws a solid cube around "center" with size "extent"
 void dglSolidCube(const Point3F &extent, const Point3F & enter);
 /// @}
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=- //
+// State cache functions
+
+/// @defgroup dgl_state_cache State Cache Functions
+/// @ingroup dgl
+/// These functions shadow the GL state the engine changes most often and only call into GL when the
+/// state actually changes.  All engine rendering should use these rather than the raw GL calls otherwise
+/// the shadowed state becomes stale; code that must use the raw calls should call dglInvalidateState() afterwards.
+/// @note Only texture unit zero is shadowed.
+/// @{
+
+/// enables a server-side GL capability, similar to glEnable()
+void dglEnable(GLenum cap);
+/// disables a server-side GL capability, similar to glDisable()
+void dglDisable(GLenum cap);
+/// enables a client-side vertex array, similar to glEnableClientState()
+void dglEnableClientState(GLenum array);
+/// disables a client-side vertex array, similar to glDisableClientState()
+void dglDisableClientState(GLenum array);
+/// sets the blend factors, similar to glBlendFunc()
+void dglBlendFunc(GLenum srcFactor, GLenum dstFactor);
+/// sets the alpha test function, similar to glAlphaFunc()
+void dglAlphaFunc(GLenum func, GLclampf ref);
+/// binds a texture, similar to glBindTexture()
+void dglBindTexture(GLenum target, GLuint texture);
+/// deletes textures forgetting any shadowed binding of them, similar to glDeleteTextures()
+void dglDeleteTextures(GLsizei count, const GLuint* pTextures);
+/// forgets all the shadowed state so that the next change of each is always issued
+void dglInvalidateState();
+/// returns the number of state calls issued to GL since the metrics were reset
+U32 dglGetStateCallsIssued();
+/// returns the number of redundant state calls avoided since the metrics were reset
+U32 dglGetStateCallsAvoided();
+/// resets the state cache metrics
+void dglResetStateMetrics();
+/// @}
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=- //
+// GUI batch functions
+
+/// @defgroup dgl_batch GUI Batch Functions
+/// @ingroup dgl
+/// The bitmap, text and filled rect functions don't draw immediately but add screen-space quads to a batch
+/// which is drawn when the texture changes, the batch fills or any other drawing or state change occurs.
+/// Quads are clipped against the clip rect as they are added so changing the clip rect doesn't break the batch.
+/// The state cache and the other dgl drawing functions flush the batch themselves; code that draws with the
+/// raw GL calls must call dglFlushBatch() first so that batched quads are drawn in order.
+/// @{
+
+/// batches an axis-aligned quad clipping it (and its texture coordinates) against the clip rect.
+/// A texture of zero batches an untextured quad.
+void dglBatchRect(const GLuint texture, const Point2F& upperL, const Point2F& lowerR, const Point2F& texUpperL, const Point2F& texLowerR, const ColorI& color, const bool silhouette = false);
+/// batches an arbitrary quad given as upper-left, upper-right, lower-left and lower-right points.
+/// A quad crossing the clip rect can't be clipped and is drawn on its own.
+void dglBatchQuad(const GLuint texture, const Point2F* pPoints, const Point2F* pTexCoords, const ColorI& color, const bool silhouette = false);
+/// draws and empties the batch
+void dglFlushBatch();
+/// @}
+
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=- //
 // Matrix functions
 
@@ -345,10 +404,10 @@ gTextureVerts[4] = (GLfloat)(tX3);							\
 gTextureVerts[5] = (GLfloat)(tY3);							\
 gTextureVerts[6] = (GLfloat)(tX4);							\
 gTextureVerts[7] = (GLfloat)(tY4);							\
-glDisableClientState(GL_COLOR_ARRAY);						\
-glDisableClientState(GL_POINT_SIZE_ARRAY_OES);				\
-glEnableClientState(GL_VERTEX_ARRAY);						\
-glEnableClientState(GL_TEXTURE_COORD_ARRAY);				\
+dglDisableClientState(GL_COLOR_ARRAY);						\
+dglDisableClientState(GL_POINT_SIZE_ARRAY_OES);				\
+dglEnableClientState(GL_VERTEX_ARRAY);						\
+dglEnableClientState(GL_TEXTURE_COORD_ARRAY);				\
 glVertexPointer(2, GL_FLOAT, 0, gVertexFloats);				\
 glTexCoordPointer(2, GL_FLOAT, 0, gTextureVerts);			\
 glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
@@ -26,6 +26,7 @@
 
 void dglLoadMatrix(const MatrixF *m)
 {
+   dglFlushBatch();
    //F32 mat[16];
    //m->transposeTo(mat);
    const_cast<MatrixF*>(m)->transpose();
@@ -35,6 +36,7 @@ void dglLoadMatrix(const MatrixF *m)
 
 void dglMultMatrix(const MatrixF *m)
 {
+   dglFlushBatch();
    //F32 mat[16];
    //m->transposeTo(mat);
 //   const F32* mp = *m;
@@ -82,6 +84,8 @@ static bool isOrtho;
 
 void dglSetFrustum(F64 left, F64 right, F64 bottom, F64 top, F64 nearPlane, F64 farPlane, bool ortho)
 {
+   dglFlushBatch();
+
    // this converts from a coord system looking down the pos-y axis
    // to ogl's down neg z axis.
    // it's stored in OGL matrix form
@@ -131,6 +135,8 @@ bool dglIsOrtho()
 
 void dglSetViewport(const RectI &aViewPort)
 {
+   dglFlushBatch();
+
    viewPort = aViewPort;
    U32 screenHeight = Platform::getWindowSize().y;
    //glViewport(viewPort.point.x, viewPort.point.y + viewPort.extent.y,
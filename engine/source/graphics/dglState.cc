@@ -0,0 +1,245 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "graphics/dgl.h"
+#include "console/console.h"
+
+//------------------------------------------------------------------------------
+
+/// Shadowed states are unknown until they are first set (or after being invalidated).
+#define DGL_STATE_UNKNOWN     -1
+#define DGL_STATE_DISABLED    0
+#define DGL_STATE_ENABLED     1
+
+/// Maximum number of distinct capabilities and client arrays shadowed.
+/// Any beyond these are simply passed through to GL.
+#define DGL_MAX_SHADOW_STATES 16
+
+struct ShadowStateTable
+{
+   GLenum   mNames[DGL_MAX_SHADOW_STATES];
+   S32      mStates[DGL_MAX_SHADOW_STATES];
+   U32      mCount;
+};
+
+static ShadowStateTable sCapabilities = { {0}, {0}, 0 };
+static ShadowStateTable sClientArrays = { {0}, {0}, 0 };
+
+static bool    sBlendFuncKnown = false;
+static GLenum  sSrcBlendFactor = GL_ONE;
+static GLenum  sDstBlendFactor = GL_ZERO;
+
+static bool    sAlphaFuncKnown = false;
+static GLenum  sAlphaFunc = GL_ALWAYS;
+static GLclampf sAlphaRef = 0.0f;
+
+static bool    sBoundTextureKnown = false;
+static GLuint  sBoundTexture = 0;
+
+static U32     sStateCallsIssued = 0;
+static U32     sStateCallsAvoided = 0;
+
+//------------------------------------------------------------------------------
+
+static S32* findShadowState(ShadowStateTable& table, const GLenum name)
+{
+   // Find the existing state.
+   for (U32 i = 0; i < table.mCount; i++)
+   {
+      if (table.mNames[i] == name)
+         return &table.mStates[i];
+   }
+
+   // Finish if the table is full.
+   if (table.mCount == DGL_MAX_SHADOW_STATES)
+      return NULL;
+
+   // Start shadowing the state.
+   table.mNames[table.mCount] = name;
+   table.mStates[table.mCount] = DGL_STATE_UNKNOWN;
+   return &table.mStates[table.mCount++];
+}
+
+//------------------------------------------------------------------------------
+
+static bool changeShadowState(ShadowStateTable& table, const GLenum name, const S32 state)
+{
+   S32* pState = findShadowState(table, name);
+
+   // Is the state already set?
+   if (pState != NULL && *pState == state)
+   {
+      // Yes, so the call is redundant.
+      sStateCallsAvoided++;
+      return false;
+   }
+
+   // Draw any batched quads with the current state.
+   dglFlushBatch();
+
+   // Note the new state.
+   if (pState != NULL)
+      *pState = state;
+
+   sStateCallsIssued++;
+   return true;
+}
+
+//------------------------------------------------------------------------------
+
+void dglEnable(GLenum cap)
+{
+   if (changeShadowState(sCapabilities, cap, DGL_STATE_ENABLED))
+      glEnable(cap);
+}
+
+void dglDisable(GLenum cap)
+{
+   if (changeShadowState(sCapabilities, cap, DGL_STATE_DISABLED))
+      glDisable(cap);
+}
+
+void dglEnableClientState(GLenum array)
+{
+   if (changeShadowState(sClientArrays, array, DGL_STATE_ENABLED))
+      glEnableClientState(array);
+}
+
+void dglDisableClientState(GLenum array)
+{
+   if (changeShadowState(sClientArrays, array, DGL_STATE_DISABLED))
+      glDisableClientState(array);
+}
+
+//------------------------------------------------------------------------------
+
+void dglBlendFunc(GLenum srcFactor, GLenum dstFactor)
+{
+   if (sBlendFuncKnown && sSrcBlendFactor == srcFactor && sDstBlendFactor == dstFactor)
+   {
+      sStateCallsAvoided++;
+      return;
+   }
+
+   dglFlushBatch();
+   sBlendFuncKnown = true;
+   sSrcBlendFactor = srcFactor;
+   sDstBlendFactor = dstFactor;
+   sStateCallsIssued++;
+   glBlendFunc(srcFactor, dstFactor);
+}
+
+void dglAlphaFunc(GLenum func, GLclampf ref)
+{
+   if (sAlphaFuncKnown && sAlphaFunc == func && sAlphaRef == ref)
+   {
+      sStateCallsAvoided++;
+      return;
+   }
+
+   dglFlushBatch();
+   sAlphaFuncKnown = true;
+   sAlphaFunc = func;
+   sAlphaRef = ref;
+   sStateCallsIssued++;
+   glAlphaFunc(func, ref);
+}
+
+//------------------------------------------------------------------------------
+
+void dglBindTexture(GLenum target, GLuint texture)
+{
+   // Only 2D textures are shadowed.
+   if (target != GL_TEXTURE_2D)
+   {
+      dglFlushBatch();
+      sStateCallsIssued++;
+      glBindTexture(target, texture);
+      return;
+   }
+
+   if (sBoundTextureKnown && sBoundTexture == texture)
+   {
+      sStateCallsAvoided++;
+      return;
+   }
+
+   dglFlushBatch();
+   sBoundTextureKnown = true;
+   sBoundTexture = texture;
+   sStateCallsIssued++;
+   glBindTexture(target, texture);
+}
+
+void dglDeleteTextures(GLsizei count, const GLuint* pTextures)
+{
+   // Draw any batched quads before their texture goes.
+   dglFlushBatch();
+
+   // Deleting a bound texture reverts the binding to zero.
+   if (sBoundTextureKnown)
+   {
+      for (GLsizei i = 0; i < count; i++)
+      {
+         if (pTextures[i] == sBoundTexture)
+         {
+            sBoundTexture = 0;
+            break;
+         }
+      }
+   }
+
+   glDeleteTextures(count, pTextures);
+}
+
+//------------------------------------------------------------------------------
+
+void dglInvalidateState()
+{
+   for (U32 i = 0; i < sCapabilities.mCount; i++)
+      sCapabilities.mStates[i] = DGL_STATE_UNKNOWN;
+
+   for (U32 i = 0; i < sClientArrays.mCount; i++)
+      sClientArrays.mStates[i] = DGL_STATE_UNKNOWN;
+
+   sBlendFuncKnown = false;
+   sAlphaFuncKnown = false;
+   sBoundTextureKnown = false;
+}
+
+//------------------------------------------------------------------------------
+
+U32 dglGetStateCallsIssued()
+{
+   return sStateCallsIssued;
+}
+
+U32 dglGetStateCallsAvoided()
+{
+   return sStateCallsAvoided;
+}
+
+void dglResetStateMetrics()
+{
+   sStateCallsIssued = 0;
+   sStateCallsAvoided = 0;
+}
@@ -215,3 +215,28 @@ ConsoleFunctionWithDocs(png2jpg, ConsoleInt, 2, 3, ( pngFilename, [quality ]? ))
 }
 
 /*! @} */ // end group ImageFileManipulation
+
+/*! @defgroup RenderStateCache Render State Cache
+	@ingroup TorqueScriptFunctions
+	@{
+*/
+
+/*! Gets the render state cache metrics.
+    @return The number of state calls issued to GL followed by the number of redundant state calls avoided since the metrics were last reset.
+*/
+ConsoleFunctionWithDocs(getRenderStateMetrics, ConsoleString, 1, 1, ())
+{
+   char* pBuffer = Con::getReturnBuffer(32);
+   dSprintf(pBuffer, 32, "%d %d", dglGetStateCallsIssued(), dglGetStateCallsAvoided());
+   return pBuffer;
+}
+
+/*! Resets the render state cache metrics.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(resetRenderStateMetrics, ConsoleVoid, 1, 1, ())
+{
+   dglResetStateMetrics();
+}
+
+/*! @} */ // end group RenderStateCache
@@ -446,6 +446,7 @@ void GBitmap::extrudeMipLevels(bool clearBorders)
       case PVR4:
       case PVR4A:
 #endif
+      default:
           break;
 
    }
@@ -935,6 +936,30 @@ ResourceInstance* constructBitmapBMP(Stream &stream)
    }
 }
 
+ResourceInstance* constructBitmapKTX(Stream &stream)
+{
+   GBitmap *bmp = new GBitmap;
+   if(bmp->readKTX(stream))
+      return bmp;
+   else
+   {
+      delete bmp;
+      return NULL;
+   }
+}
+
+ResourceInstance* constructBitmapDDS(Stream &stream)
+{
+   GBitmap *bmp = new GBitmap;
+   if(bmp->readDDS(stream))
+      return bmp;
+   else
+   {
+      delete bmp;
+      return NULL;
+   }
+}
+
 #ifdef TORQUE_OS_IOS
 ResourceInstance* constructBitmapPVR(Stream &stream)
 {
@@ -42,6 +42,8 @@ class RectI;
 extern ResourceInstance* constructBitmapBMP(Stream& stream);
 extern ResourceInstance* constructBitmapPNG(Stream& stream);
 extern ResourceInstance* constructBitmapJPEG(Stream& stream);
+extern ResourceInstance* constructBitmapKTX(Stream& stream);
+extern ResourceInstance* constructBitmapDDS(Stream& stream);
 
 #ifdef TORQUE_OS_IOS
 extern ResourceInstance* constructBitmapPVR(Stream& stream);
@@ -74,6 +76,19 @@ class GBitmap: public ResourceInstance
        PVR4 = 11,
        PVR4A = 12
 #endif
+      /// Block-compressed formats (see bitmapCompressed.cc).
+      /// These are uploaded as-is and only the top-level image is kept.
+      , BC1      = 13,
+      BC1A       = 14,
+      BC2        = 15,
+      BC3        = 16,
+      ETC1       = 17,
+      ETC2       = 18,
+      ETC2A      = 19,
+      ASTC4x4    = 20,
+      ASTC5x5    = 21,
+      ASTC6x6    = 22,
+      ASTC8x8    = 23
    };
 
    enum Constants {
@@ -101,6 +116,12 @@ class GBitmap: public ResourceInstance
    void extrudeMipLevels(bool clearBorders = false);
    void extrudeMipLevelsDetail();
 
+   /// Replace the alpha channel with a signed distance field of the shape it covers (located in bitmapDistanceField.cc).
+   /// Distances up to "spread" texels either side of the edge are encoded with the edge itself at half alpha
+   /// so that the shape can be drawn crisply at any scale with linear filtering and an alpha test.
+   /// Only the Alpha, LuminanceAlpha and RGBA formats are supported.
+   bool convertToDistanceField(const U32 spread);
+
    GBitmap *createPowerOfTwoBitmap();
 
    void copyRect(const GBitmap *src, const RectI &srcRect, const Point2I &dstPoint);
@@ -154,10 +175,20 @@ class GBitmap: public ResourceInstance
    bool readJPEG(Stream& io_rStream);              // located in bitmapJpeg.cc
    bool writeJPEG(Stream& io_rStream) const;
 
-   bool readPNG(Stream& io_rStream);               // located in bitmapPng.cc
+   /// Reading is thread-safe when "queryPreferences" is false; the paletted 16-bit preference is then left to the caller.
+   bool readPNG(Stream& io_rStream, const bool queryPreferences = true); // located in bitmapPng.cc
    bool writePNG(Stream& io_rStream, const bool compressHard = false) const;
    bool writePNGUncompressed(Stream& io_rStream) const;
 
+   bool readKTX(Stream& io_rStream);               // located in bitmapCompressed.cc
+   bool readDDS(Stream& io_rStream);               // located in bitmapCompressed.cc
+
+   /// Block-compressed format helpers (located in bitmapCompressed.cc).
+   static bool isCompressedFormat(const BitmapFormat format);
+   static bool getCompressedBlockInfo(const BitmapFormat format, U32& blockWidth, U32& blockHeight, U32& blockBytes);
+   static U32  getCompressedGLFormat(const BitmapFormat format);
+   inline bool isCompressed() const { return isCompressedFormat(internalFormat); }
+
    bool readMSBmp(Stream& io_rStream);             // located in bitmapMS.cc
    bool writeMSBmp(Stream& io_rStream) const;      // located in bitmapMS.cc
 
@@ -161,6 +161,10 @@ GFont::GFont()
    mSize = 0;
    mCharSet = 0;
    mNeedSave = false;
+
+   for (U32 i = 0; i < GlyphRunBucketCount; i++)
+      mGlyphRunBuckets[i] = NULL;
+   mGlyphRunCount = 0;
    
    mMutex = Mutex::createMutex();
 }
@@ -180,6 +184,8 @@ GFont::~GFont()
       }
    }
    
+   clearGlyphRuns();
+
    S32 i;
 
    for(i = 0;i < mCharInfoList.size();i++)
@@ -222,6 +228,7 @@ void GFont::dumpInfo()
    else
       Con::printf("      - No mapped codepoints.", mapBegin, mapEnd);
    Con::printf("      - Platform font is %s.", (mPlatformFont ? "present" : "not present") );
+   Con::printf("      - %d cached glyph runs.", mGlyphRunCount);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -537,6 +544,161 @@ U32 GFont::getBreakPos(const UTF16 *str16, U32 slen, U32 width, bool breakOnWhit
    return ret;
 }
 
+//////////////////////////////////////////////////////////////////////////
+
+const GFont::GlyphRun* GFont::getGlyphRun(const UTF16* string, U32 n)
+{
+   AssertFatal(string != NULL, "GFont::getGlyphRun: String is NULL");
+
+   // Find the run length and hash.
+   U32 length = 0;
+   U32 hash = 2166136261u;
+   while (length < n && string[length] != 0)
+   {
+      hash = (hash ^ string[length]) * 16777619u;
+      length++;
+   }
+
+   // Find the cached run.
+   GlyphRun** ppBucket = mGlyphRunBuckets + (hash % GlyphRunBucketCount);
+   for (GlyphRun* pRun = *ppBucket; pRun != NULL; pRun = pRun->mpNext)
+   {
+      if (pRun->mHash == hash && (U32)pRun->mString.size() == length &&
+         (length == 0 || dMemcmp(pRun->mString.address(), string, length * sizeof(UTF16)) == 0))
+         return pRun;
+   }
+
+   PROFILE_SCOPE(GFont_BuildGlyphRun);
+
+   // Discard all the runs if the cache is full.
+   if (mGlyphRunCount >= GlyphRunCacheLimit)
+      clearGlyphRuns();
+
+   GlyphRun* pRun = new GlyphRun();
+   pRun->mString.setSize(length);
+   if (length != 0)
+      dMemcpy(pRun->mString.address(), string, length * sizeof(UTF16));
+   pRun->mHash = hash;
+
+   // Lay out the run.  This must match the immediate layout in dglDrawTextN().
+   static U8 remap[15] =
+   {
+      0x0, // 0 special null terminator
+      0x0, // 1 ascii start-of-heading??
+      0x1, 
+      0x2, 
+      0x3, 
+      0x4, 
+      0x5, 
+      0x6, 
+      0x0, // 8 special backspace
+      0x0, // 9 special tab
+      0x0, // a special \n
+      0x7, 
+      0x8,
+      0x0, // a special \r
+      0x9 
+   };
+
+   GlyphRunOp op;
+   dMemset(&op, 0, sizeof(op));
+
+   S32 x = 0;
+   for (U32 i = 0; i < length; i++)
+   {
+      const UTF16 c = string[i];
+
+      // Color code.
+      if ((c >= 1 && c <= 7) || (c >= 11 && c <= 12) || (c == 14))
+      {
+         op.mType = GlyphRunOp::SetColor;
+         op.mColorIndex = remap[c];
+         pRun->mOps.push_back(op);
+         continue;
+      }
+
+      // Reset, push or pop color.
+      if (c == 15 || c == 16 || c == 17)
+      {
+         op.mType = c == 15 ? GlyphRunOp::ResetColor : c == 16 ? GlyphRunOp::PushColor : GlyphRunOp::PopColor;
+         pRun->mOps.push_back(op);
+         continue;
+      }
+
+      // Tab character.
+      if (c == dT('\t'))
+      {
+         x += getCharInfo(dT(' ')).xIncrement * TabWidthInSpaces;
+         continue;
+      }
+
+      if (!isValidChar(c))
+         continue;
+
+      const PlatformFont::CharInfo& ci = getCharInfo(c);
+
+      if (ci.bitmapIndex == -1)
+      {
+         x += ci.xOrigin + ci.xIncrement;
+         continue;
+      }
+
+      if (ci.width == 0 || ci.height == 0)
+      {
+         x += ci.xIncrement;
+         continue;
+      }
+
+      TextureObject* pSheet = mTextureSheets[ci.bitmapIndex];
+      const F32 sheetWidth = (F32)pSheet->getTextureWidth();
+      const F32 sheetHeight = (F32)pSheet->getTextureHeight();
+
+      x += ci.xOrigin;
+      const S32 y = (S32)mBaseline - ci.yOrigin;
+
+      op.mType = GlyphRunOp::Glyph;
+      op.mSheet = (S16)ci.bitmapIndex;
+      op.mUpperL.set((F32)x, (F32)y);
+      op.mLowerR.set((F32)(x + ci.width), (F32)(y + ci.height));
+      op.mTexUpperL.set(F32(ci.xOffset) / sheetWidth, F32(ci.yOffset) / sheetHeight);
+      op.mTexLowerR.set(F32(ci.xOffset + ci.width) / sheetWidth, F32(ci.yOffset + ci.height) / sheetHeight);
+      pRun->mOps.push_back(op);
+
+      x += ci.xIncrement - ci.xOrigin;
+   }
+
+   AssertFatal(x >= 0, "GFont::getGlyphRun: Negative advance.");
+   pRun->mAdvance = (U32)x;
+
+   // Cache the run.
+   pRun->mpNext = *ppBucket;
+   *ppBucket = pRun;
+   mGlyphRunCount++;
+
+   return pRun;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void GFont::clearGlyphRuns()
+{
+   for (U32 i = 0; i < GlyphRunBucketCount; i++)
+   {
+      GlyphRun* pRun = mGlyphRunBuckets[i];
+      while (pRun != NULL)
+      {
+         GlyphRun* pNext = pRun->mpNext;
+         delete pRun;
+         pRun = pNext;
+      }
+      mGlyphRunBuckets[i] = NULL;
+   }
+
+   mGlyphRunCount = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 void GFont::wrapString(const UTF8 *txt, U32 lineWidth, Vector<U32> &startLineOffset, Vector<U32> &lineLen)
 {
    Con::errorf("GFont::wrapString(): Not yet converted to be UTF-8 safe");
@@ -884,9 +1046,10 @@ void GFont::importStrip(const char *fileName, U32 padding, U32 kerning)
    // Also deal with kerning.
    // Also, we may have to load RGBA instead of RGB.
 
-   // Wipe our texture sheets.
+   // Wipe our texture sheets (and the glyph runs that reference them).
    mCurSheet = mCurX = mCurY = 0;
    mTextureSheets.clear();
+   clearGlyphRuns();
 
    //  Now, load the font strip.
    GBitmap *strip = GBitmap::load(fileName);
@@ -71,6 +71,41 @@ public:
    {
       TabWidthInSpaces = 3,
       TextureSheetSize = 256,
+      GlyphRunBucketCount = 256,
+      GlyphRunCacheLimit = 1024,
+   };
+
+   /// A single step in a glyph run; either a glyph quad or one of the inline color codes.
+   struct GlyphRunOp
+   {
+      enum Type
+      {
+         Glyph,
+         SetColor,
+         ResetColor,
+         PushColor,
+         PopColor
+      };
+
+      U8       mType;
+      U8       mColorIndex;         ///< Remapped color table index (SetColor only).
+      S16      mSheet;              ///< Texture sheet index (Glyph only).
+      Point2F  mUpperL;             ///< Glyph quad relative to the draw point.
+      Point2F  mLowerR;
+      Point2F  mTexUpperL;
+      Point2F  mTexLowerR;
+   };
+
+   /// A string laid out into glyph quads relative to its draw point.
+   /// Runs are cached by the font so that static text (labels, chat lines, scoreboards)
+   /// is only laid out once and is then simply offset and batched each time it's drawn.
+   struct GlyphRun
+   {
+      Vector<UTF16>        mString;
+      U32                  mHash;
+      U32                  mAdvance;
+      Vector<GlyphRunOp>   mOps;
+      GlyphRun*            mpNext;
    };
 
 
@@ -98,6 +133,9 @@ private:
                                           //    be accessed through the getCharInfo(U32)
                                           //    function to account for remapping...
    S32             mRemapTable[65536];    // - Index remapping
+
+   GlyphRun*       mGlyphRunBuckets[GlyphRunBucketCount];
+   U32             mGlyphRunCount;
 public:
    GFont();
    virtual ~GFont();
@@ -134,6 +172,16 @@ public:
 
    U32 getBreakPos(const UTF16 *string, U32 strlen, U32 width, bool breakOnWhitespace);
 
+   /// Fetch the laid-out glyph run for the first "n" characters of the string (or up to its terminator).
+   /// Runs are built on first use and are cached until the cache limit is reached when all are discarded.
+   const GlyphRun* getGlyphRun(const UTF16* string, U32 n);
+
+   /// Discard all the cached glyph runs.
+   void clearGlyphRuns();
+
+   /// Fetch the number of cached glyph runs.
+   inline U32 getGlyphRunCount() const { return mGlyphRunCount; }
+
    /// These are the preferred width functions.
    U32 getStrNWidth(const UTF16*, U32 n);
    U32 getStrNWidthPrecise(const UTF16*, U32 n);
@@ -139,19 +139,28 @@ void GuiDynamicCtrlArrayControl::resize(const Point2I &newPosition, const Point2
       parent->childResized(this);
    setUpdate();
 
-   updateChildControls();
+   // Arrange the children before rendering unless this is them being arranged.
+   if (!mResizing)
+      setLayoutDirty();
 }
 
 void GuiDynamicCtrlArrayControl::addObject(SimObject *obj)
 {
    Parent::addObject(obj);
 
-   updateChildControls();
+   setLayoutDirty();
 }
 
 void GuiDynamicCtrlArrayControl::childResized(GuiControl *child)
 {
    Parent::childResized(child);
 
+   // Children are resized whilst they are arranged so ignore that.
+   if (!mResizing)
+      setLayoutDirty();
+}
+
+void GuiDynamicCtrlArrayControl::onLayout()
+{
    updateChildControls();
 }
\ No newline at end of file
@@ -53,6 +53,7 @@ public:
    void addObject(SimObject *obj);
 
    void childResized(GuiControl *child);
+   void onLayout();
 
    void inspectPostApply();
 
@@ -31,6 +31,7 @@ IMPLEMENT_CONOBJECT(GuiGridControl);
 GuiGridControl::GuiGridControl()
 {
 	mIsContainer = true;
+	mLayoutExtent.set(-1, -1);
 }
 
 //------------------------------------------------------------------------------
@@ -64,6 +65,8 @@ void GuiGridControl::onSleep()
 
 void GuiGridControl::inspectPostApply()
 {
+    // The rows or columns may have changed so lay the children out again.
+    mLayoutExtent.set(-1, -1);
     resize(getPosition(), getExtent());
 }
 
@@ -144,9 +147,17 @@ void GuiGridControl::removeObject(SimObject *obj)
 
 void GuiGridControl::resize(const Point2I &newPosition, const Point2I &newExtent)
 {
+	Point2I actualNewExtent = Point2I(  getMax(mMinExtent.x, newExtent.x), getMax(mMinExtent.y, newExtent.y));
+
+	// The children are placed relative to the grid so only lay them out again when its size changes.
+	if (actualNewExtent == mBounds.extent && actualNewExtent == mLayoutExtent)
+	{
+		mBounds.point = newPosition;
+		return;
+	}
+
 	setUpdate();
 
-	Point2I actualNewExtent = Point2I(  getMax(mMinExtent.x, newExtent.x), getMax(mMinExtent.y, newExtent.y));
 	mBounds.set(newPosition, actualNewExtent);
 
 	bool bFirstResize = false;
@@ -198,6 +209,8 @@ void GuiGridControl::resize(const Point2I &newPosition, const Point2I &newExtent
 		}
 	}
 
+	mLayoutExtent = mBounds.extent;
+
 	GuiControl *parent = getParent();
 
 	if (parent)
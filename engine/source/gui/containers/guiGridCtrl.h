@@ -30,6 +30,7 @@ private:
 	Vector<S32> mRowSizes;
 	Vector<S32> mColSizes;
 	Vector<Point2I> mOrginalControlPos;
+	Point2I mLayoutExtent; ///< The extent the children were last laid out for.
 
 	void AdjustGrid(const Point2I& newExtent);
 	void AdjustGridItems(S32 size, Vector<StringTableEntry>& strItems, Vector<S32>& items);
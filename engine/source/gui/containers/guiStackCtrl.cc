@@ -293,33 +293,42 @@ void GuiStackControl::resize(const Point2I &newPosition, const Point2I &newExten
       parent->childResized(this);
    setUpdate();
 
-   updatePanes();
+   // Restack before rendering unless this is the stack fitting its children.
+   if (!mResizing)
+      setLayoutDirty();
 }
 
 void GuiStackControl::addObject(SimObject *obj)
 {
    Parent::addObject(obj);
 
-   updatePanes();
+   setLayoutDirty();
 }
 
 void GuiStackControl::removeObject(SimObject *obj)
 {
    Parent::removeObject(obj);
 
-   updatePanes();
+   setLayoutDirty();
 }
 
 bool GuiStackControl::reOrder(SimObject* obj, SimObject* target)
 {
    bool ret = Parent::reOrder(obj, target);
    if (ret)
-      updatePanes();
+      setLayoutDirty();
 
    return ret;
 }
 
 void GuiStackControl::childResized(GuiControl *child)
+{
+   // Children are resized whilst stacking so ignore that.
+   if (!mResizing)
+      setLayoutDirty();
+}
+
+void GuiStackControl::onLayout()
 {
    updatePanes();
 }
\ No newline at end of file
@@ -37,6 +37,9 @@
 /// resized, then the stack is resized to fit. The order of the stack is
 /// determined by the internal order of the children (ie, order of addition).
 ///
+/// Changes are stacked once before the stack is next rendered.  Use updateStack()
+/// to stack the controls immediately.
+///
 ///
 /// @todo Make this support horizontal right to left stacks.
 class GuiStackControl : public GuiControl
@@ -66,6 +69,7 @@ public:
 
    void resize(const Point2I &newPosition, const Point2I &newExtent);
    void childResized(GuiControl *child);
+   void onLayout();
    /// prevent resizing. useful when adding many items.
    void freeze(bool);
 
@@ -77,12 +77,12 @@ void GuiGraphCtrl::onRender(Point2I offset, const RectI &updateRect)
 		dglDrawRect(rect, mProfile->mBorderColor);
 	}
 
-	glBlendFunc(GL_SRC_COLOR, GL_ONE_MINUS_SRC_COLOR);
-	glEnable(GL_BLEND);
+	dglBlendFunc(GL_SRC_COLOR, GL_ONE_MINUS_SRC_COLOR);
+	dglEnable(GL_BLEND);
 	ColorF color(1.0, 1.0, 1.0, 0.5);
 	dglDrawRectFill(updateRect, color);
-	glDisable(GL_BLEND);
-	glBlendFunc(GL_ONE, GL_ZERO);
+	dglDisable(GL_BLEND);
+	dglBlendFunc(GL_ONE, GL_ZERO);
 
 	for (int k = 0; k < MaxPlots; k++)
 	{
@@ -102,6 +102,7 @@ void GuiGraphCtrl::onRender(Point2I offset, const RectI &updateRect)
 		if (mPlots[k].mGraphData.size() == 0)
 			continue;
 
+		dglFlushBatch();
 #if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_ANDROID) || defined(TORQUE_OS_EMSCRIPTEN)
 		// Bar graph
 		if(mPlots[k].mGraphType == Bar)
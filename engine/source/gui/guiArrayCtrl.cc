@@ -218,7 +218,11 @@ void GuiArrayCtrl::onRender(Point2I offset, const RectI &updateRect)
    //save the original for clipping the row headers
    RectI origClipRect = clipRect;
 
-   for (j = 0; j < mSize.y; j++)
+   //start at the first visible row and column rather than stepping over every cell above and to the left
+   S32 firstRow = mCellSize.y > 0 ? getMax(0, (updateRect.point.y - offset.y) / mCellSize.y - 1) : 0;
+   S32 firstColumn = mCellSize.x > 0 ? getMax(0, (updateRect.point.x - offset.x) / mCellSize.x - 1) : 0;
+
+   for (j = firstRow; j < mSize.y; j++)
    {
       //skip until we get to a visible row
       if ((j + 1) * mCellSize.y + offset.y < updateRect.point.y)
@@ -247,7 +251,7 @@ void GuiArrayCtrl::onRender(Point2I offset, const RectI &updateRect)
       }
 
       //render the cells for the row
-      for (i = 0; i < mSize.x; i++)
+      for (i = firstColumn; i < mSize.x; i++)
       {
          //skip past columns off the left edge
          if ((i + 1) * mCellSize.x + offset.x < updateRect.point.x)
@@ -22,8 +22,11 @@
 
 #include "torqueConfig.h"
 #include "console/consoleInternal.h"
+#include "console/consoleVariableRef.h"
 #include "debug/profiler.h"
+#include "debug/gpuTimer.h"
 #include "graphics/dgl.h"
+#include "graphics/TextureManager.h"
 #include "platform/event.h"
 #include "platform/platform.h"
 #include "platform/platformVideo.h"
@@ -34,6 +37,11 @@
 
 #include "guiCanvas_ScriptBinding.h"
 
+static Con::VariableRef<bool> sNoClampCursorToWindowVariable( "$pref::Gui::noClampTorqueCursorToWindow", true );
+
+// Laying out a container can resize it and so require its parent to lay out again.
+static const U32 MaxLayoutPasses = 4;
+
 extern int _AndroidGetScreenWidth();
 extern int _AndroidGetScreenHeight();
 
@@ -60,6 +68,9 @@ GuiCanvas::GuiCanvas()
 
    lastCursorON = false;
    rLastFrameTime = 0.0f;
+   mSkipIdleFrames = false;
+   mIdleSleepTime = 16;
+   mSkippedFrameCount = 0;
 
    mMouseCapturedControl = NULL;
    mMouseControl = NULL;
@@ -115,6 +126,8 @@ void GuiCanvas::initPersistFields()
     // Physics.
     addField("UseBackgroundColor", TypeBool, Offset(mUseBackgroundColor, GuiCanvas), "" );
     addField("BackgroundColor", TypeColorF, Offset(mBackgroundColor, GuiCanvas), "" );
+    addField("SkipIdleFrames", TypeBool, Offset(mSkipIdleFrames, GuiCanvas), "Skip frames entirely when no control has requested an update." );
+    addField("IdleSleepTime", TypeS32, Offset(mIdleSleepTime, GuiCanvas), "Milliseconds to sleep in place of a skipped frame." );
 }
 
 //------------------------------------------------------------------------------
@@ -247,7 +260,7 @@ void GuiCanvas::processMouseMoveEvent(const MouseMoveEvent *event)
       cursorPt.y += ( F32(event->yPos - cursorPt.y) * mPixelsPerMickey);
 
       // clamp the cursor to the window, or not
-      if( ! Con::getBoolVariable( "$pref::Gui::noClampTorqueCursorToWindow", true ))
+      if( ! sNoClampCursorToWindowVariable.get() )
       {
          cursorPt.x =(F32) getMax(0, getMin((S32)cursorPt.x, mBounds.extent.x - 1));
          cursorPt.y = (F32)getMax(0, getMin((S32)cursorPt.y, mBounds.extent.y - 1));
@@ -278,6 +291,9 @@ void GuiCanvas::processMouseMoveEvent(const MouseMoveEvent *event)
 
 bool GuiCanvas::processInputEvent(const InputEvent *event)
 {
+    // Attribute allocations to the GUI.
+    Memory::TagScope memoryTag( Memory::TagGui );
+
     // First call the general input handler (on the extremely off-chance that it will be handled):
     if ( mFirstResponder )
    {
@@ -1161,6 +1177,9 @@ void GuiCanvas::maintainSizing()
 
 void GuiCanvas::renderFrame(bool preRenderOnly, bool bufferSwap /* = true */)
 {
+   // Attribute allocations to the GUI.
+   Memory::TagScope memoryTag(Memory::TagGui);
+
    PROFILE_START(CanvasPreRender);
 
 #if !defined TORQUE_OS_IOS && !defined TORQUE_OS_ANDROID && !defined TORQUE_OS_EMSCRIPTEN
@@ -1187,13 +1206,33 @@ void GuiCanvas::renderFrame(bool preRenderOnly, bool bufferSwap /* = true */)
 
    //preRender (recursive) all controls
    preRender();
+
+   // Lay out the controls that have changed, again if that changes their parents.
+   for(U32 pass = 0; pass < MaxLayoutPasses && isLayoutDirty(); pass++)
+      layout();
    PROFILE_END();
    if(preRenderOnly)
       return;
 
-   // for now, just always reset the update regions - this is a
-   // fix for FSAA on ATI cards
-   resetUpdateRegions();
+   // forget any GL state shadowed last frame in case it was changed
+   // behind the state cache's back (e.g. the context was recreated)
+   dglInvalidateState();
+
+   // upload any textures that have finished loading in the background
+   // and repaint if any arrived as they were drawn with a placeholder
+   const S32 pendingTextureCount = TextureManager::getPendingTextureCount();
+   TextureManager::processPendingTextures();
+   if (TextureManager::getPendingTextureCount() != pendingTextureCount)
+      resetUpdateRegions();
+
+   // restore textures left to be restored lazily after the context was lost
+   TextureManager::processResurrectingTextures();
+
+   // evict textures that haven't been used recently if over the texture budget
+   TextureManager::enforceTextureBudget();
+
+   // stream the mip levels needed by last frame's texel densities
+   TextureManager::updateMipStreaming();
 
 // Moved this below object integration for performance reasons. -JDD
 //   // finish the gl render so we don't get too far ahead of ourselves
@@ -1218,14 +1257,16 @@ void GuiCanvas::renderFrame(bool preRenderOnly, bool bufferSwap /* = true */)
    if(!mouseCursor)
       mouseCursor = defaultCursor;
 
-   if(lastCursorON && lastCursor)
+   // only repaint the cursor areas if the cursor changed
+   const bool cursorChanged = lastCursorON != cursorVisible || lastCursor != mouseCursor || lastCursorPt != cursorPos;
+   if(cursorChanged && lastCursorON && lastCursor)
    {
       Point2I spot = lastCursor->getHotSpot();
       Point2I cext = lastCursor->getExtent();
       Point2I pos = lastCursorPt - spot;
       addUpdateRegion(pos - Point2I(2, 2), Point2I(cext.x + 4, cext.y + 4));
    }
-   if(cursorVisible && mouseCursor)
+   if(cursorChanged && cursorVisible && mouseCursor)
    {
       Point2I spot = mouseCursor->getHotSpot();
       Point2I cext = mouseCursor->getExtent();
@@ -1238,10 +1279,36 @@ void GuiCanvas::renderFrame(bool preRenderOnly, bool bufferSwap /* = true */)
     lastCursor = mouseCursor;
     lastCursorPt = cursorPos;
 
+   // keep repainting whilst a tooltip is waiting to appear
+   if(bool(mMouseControl) && hoverControl == mMouseControl && !hoverPositionSet && mMouseControl->getTooltip() != NULL && *mMouseControl->getTooltip())
+      mMouseControl->setUpdate();
+
+   // skip the frame entirely if nothing needs updating
+   if(mSkipIdleFrames && !isUpdatePending())
+   {
+      PROFILE_END();
+      mSkippedFrameCount++;
+
+      // nothing will throttle the loop without a swap
+      if(mIdleSleepTime > 0)
+         Platform::sleep(mIdleSleepTime);
+
+      return;
+   }
+
+   // time the GPU cost of the frame if enabled
+   GpuTimer::beginFrame();
+
+   // always repaint the whole canvas as the contents of the back buffer
+   // are undefined after a swap - this is also a fix for FSAA on ATI cards
+   resetUpdateRegions();
+
    RectI updateUnion;
    buildUpdateUnion(&updateUnion);
    if (updateUnion.intersect(screenRect))
    {
+      GpuTimerScope guiTimerScope(GpuTimer::SectionGui);
+
     // Clear the background color if requested.
     if ( mUseBackgroundColor )
     {
@@ -1255,8 +1322,8 @@ void GuiCanvas::renderFrame(bool preRenderOnly, bool bufferSwap /* = true */)
       {
          GuiControl *contentCtrl = static_cast<GuiControl*>(*i);
          dglSetClipRect(updateUnion);
-         glDisable( GL_CULL_FACE );
-         contentCtrl->onRender(contentCtrl->getPosition(), updateUnion);
+         dglDisable( GL_CULL_FACE );
+         contentCtrl->renderControl(contentCtrl->getPosition(), updateUnion);
       }
 
       // Tooltip resource
@@ -1297,6 +1364,7 @@ void GuiCanvas::renderFrame(bool preRenderOnly, bool bufferSwap /* = true */)
       //temp draw the mouse
       if (cursorON && mShowCursor && !mouseCursor)
       {
+         dglFlushBatch();
 #if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_ANDROID) || defined(TORQUE_OS_EMSCRIPTEN)
          glColor4ub(255, 0, 0, 255);
          GLfloat vertices[] = {
@@ -1305,7 +1373,7 @@ void GuiCanvas::renderFrame(bool preRenderOnly, bool bufferSwap /* = true */)
               (GLfloat)(cursorPt.x + 2),(GLfloat)(cursorPt.y + 2),
               (GLfloat)(cursorPt.x),(GLfloat)(cursorPt.y + 2),
           };
-          glEnableClientState(GL_VERTEX_ARRAY);
+          dglEnableClientState(GL_VERTEX_ARRAY);
           glVertexPointer(2, GL_FLOAT, 0, vertices);
           glDrawArrays(GL_LINE_LOOP, 0, 4);
 #else
@@ -1331,6 +1399,11 @@ void GuiCanvas::renderFrame(bool preRenderOnly, bool bufferSwap /* = true */)
       }
    }
 
+   // draw whatever remains batched
+   dglFlushBatch();
+
+   GpuTimer::endFrame();
+
    PROFILE_END();
 
 
@@ -91,6 +91,9 @@ protected:
    RectI      mOldUpdateRects[2];
    RectI      mCurUpdateRect;
    F32        rLastFrameTime;
+   bool       mSkipIdleFrames;  ///< Skip rendering (and swapping) frames when no update region was added.
+   S32        mIdleSleepTime;   ///< Milliseconds to sleep in place of a skipped frame.
+   U32        mSkippedFrameCount;
    /// @}
 
    /// @name Cursor Properties
@@ -200,6 +203,12 @@ public:
    /// repaint the whole canvas
    virtual void resetUpdateRegions();
 
+   /// Gets whether any update region has been added since the last rendered frame.
+   bool isUpdatePending() const { return mCurUpdateRect.extent.x > 0 && mCurUpdateRect.extent.y > 0; }
+
+   /// Gets the number of frames skipped because nothing needed updating.
+   U32 getSkippedFrameCount() const { return mSkippedFrameCount; }
+
    /// Resizes the content control to match the canvas size.
    void maintainSizing();
 
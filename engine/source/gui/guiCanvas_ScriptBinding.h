@@ -374,16 +374,31 @@ ConsoleMethodWithDocs(GuiCanvas, getUseBackgroundColor, ConsoleBool, 2, 2, (...)
     return object->getUseBackgroundColor();
 }
 
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of frames skipped because no control requested an update.
+    Frames are only skipped when the canvas "SkipIdleFrames" field is set.
+    @return The number of skipped frames.
+*/
+ConsoleMethodWithDocs(GuiCanvas, getSkippedFrameCount, ConsoleInt, 2, 2, ())
+{
+    return object->getSkippedFrameCount();
+}
+
 ConsoleMethodGroupEndWithDocs(GuiCanvas)
 
 /*! Use the createCanvas function to initialize the canvas.
-    @return Returns true on success, false on failure.
+    @return Returns true on success, false on failure or when headless.
     @sa createEffectCanvas
 */
 ConsoleFunctionWithDocs( createCanvas, ConsoleBool, 2, 2, ( WindowTitle ))
 {
     AssertISV(!Canvas, "CreateCanvas: canvas has already been instantiated");
 
+    // A headless server has no window to draw the canvas in.
+    if (Platform::isHeadless())
+        return false;
+
     Platform::initWindow(Point2I(MIN_RESOLUTION_X, MIN_RESOLUTION_Y), argv[1]);
 
 
@@ -103,12 +103,13 @@ void GuiColorPickerCtrl::initPersistFields()
 #if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_ANDROID) || defined(TORQUE_OS_EMSCRIPTEN)
 void dglDrawBlendBox(RectI &bounds, ColorF &c1, ColorF &c2, ColorF &c3, ColorF &c4)
 {
+   dglFlushBatch();
    S32 left = bounds.point.x, right = bounds.point.x + bounds.extent.x - 1;
    S32 top = bounds.point.y, bottom = bounds.point.y + bounds.extent.y - 1;
    
-   glEnable(GL_BLEND);
-   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-   glDisable(GL_TEXTURE_2D);
+   dglEnable(GL_BLEND);
+   dglBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+   dglDisable(GL_TEXTURE_2D);
     
     const GLfloat verts[] = {
         left, top,
@@ -123,9 +124,9 @@ void dglDrawBlendBox(RectI &bounds, ColorF &c1, ColorF &c2, ColorF &c3, ColorF &
         255 * c4.red, 255 * c4.green, 255 * c4.blue, 255 * c4.alpha,
     };
     glVertexPointer(2, GL_FLOAT, 0, verts);
-    glEnableClientState(GL_VERTEX_ARRAY);
+    dglEnableClientState(GL_VERTEX_ARRAY);
     glColorPointer(4, GL_UNSIGNED_BYTE, 0, squareColors);
-    glEnableClientState(GL_COLOR_ARRAY);
+    dglEnableClientState(GL_COLOR_ARRAY);
     
     glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
 }
@@ -134,6 +135,7 @@ void dglDrawBlendBox(RectI &bounds, ColorF &c1, ColorF &c2, ColorF &c3, ColorF &
 /// Function to draw a set of boxes blending throughout an array of colors
 void dglDrawBlendRangeBox(RectI &bounds, bool vertical, U8 numColors, ColorI *colors)
 {
+   dglFlushBatch();
    S32 left = bounds.point.x, right = bounds.point.x + bounds.extent.x - 1;
    S32 top = bounds.point.y, bottom = bounds.point.y + bounds.extent.y - 1;
 
@@ -142,9 +144,9 @@ void dglDrawBlendRangeBox(RectI &bounds, bool vertical, U8 numColors, ColorI *co
    S32 y_inc = S32(mFloor((bottom - top) / (numColors-1)));
    
 
-   glEnable(GL_BLEND);
-   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-   glDisable(GL_TEXTURE_2D);
+   dglEnable(GL_BLEND);
+   dglBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+   dglDisable(GL_TEXTURE_2D);
 
     GLfloat verts[] = {
         0.0f,	0.0f,	0.0f,	0.0f,
@@ -152,7 +154,7 @@ void dglDrawBlendRangeBox(RectI &bounds, bool vertical, U8 numColors, ColorI *co
     };	
     
     glVertexPointer(2, GL_FLOAT, 0, verts);
-    glEnableClientState(GL_VERTEX_ARRAY);
+    dglEnableClientState(GL_VERTEX_ARRAY);
 
     for (U16 i=0;i<numColors-1;i++) 
     {
@@ -274,14 +276,15 @@ void GuiColorPickerCtrl::renderColorBox(RectI &bounds)
 
 void dglDrawBlendBox(RectI &bounds, ColorF &c1, ColorF &c2, ColorF &c3, ColorF &c4)
 {
+   dglFlushBatch();
    F32 l = (F32)(bounds.point.x + 1);
    F32 r =(F32)(bounds.point.x + bounds.extent.x - 2);
    F32 t = (F32)(bounds.point.y + 1);
    F32 b = (F32)(bounds.point.y + bounds.extent.y - 2);
    
-   glEnable(GL_BLEND);
-   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-   glDisable(GL_TEXTURE_2D);
+   dglEnable(GL_BLEND);
+   dglBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+   dglDisable(GL_TEXTURE_2D);
 
    glBegin(GL_QUADS);
 
@@ -393,6 +396,7 @@ void dglDrawBlendBox(RectI &bounds, ColorF &c1, ColorF &c2, ColorF &c3, ColorF &
 /// Function to draw a set of boxes blending throughout an array of colors
 void dglDrawBlendRangeBox(RectI &bounds, bool vertical, U8 numColors, ColorI *colors)
 {
+   dglFlushBatch();
    F32 l = (F32)bounds.point.x;
    F32 r = (F32)(bounds.point.x + bounds.extent.x - 1);
    F32 t = (F32)bounds.point.y + 1;
@@ -402,9 +406,9 @@ void dglDrawBlendRangeBox(RectI &bounds, bool vertical, U8 numColors, ColorI *co
    F32 x_inc = F32((r - l) / (numColors-1));
    F32 y_inc = F32((b - t) / (numColors-1));
    
-   glEnable(GL_BLEND);
-   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-   glDisable(GL_TEXTURE_2D);
+   dglEnable(GL_BLEND);
+   dglBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+   dglDisable(GL_TEXTURE_2D);
 
    glBegin(GL_QUADS);
       if (!vertical)  // Horizontal (+x)
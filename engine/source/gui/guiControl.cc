@@ -41,6 +41,9 @@
 #include "memory/frameAllocator.h"
 #endif
 
+// Debug Profiling.
+#include "debug/profiler.h"
+
 //------------------------------------------------------------------------------
 
 IMPLEMENT_CONOBJECT_CHILDREN(GuiControl);
@@ -82,6 +85,14 @@ GuiControl::GuiControl()
    mTipHoverTime        = 1000;
    mTooltipWidth		= 250;
    mIsContainer         = false;
+   mLayoutDirty         = false;
+   mChildLayoutDirty    = false;
+   mCacheAsBitmap       = false;
+   mCacheState          = CacheDirty;
+   mCacheTexture        = 0;
+   mCacheTextureSize.set(0, 0);
+   mCacheCallbackKey    = 0;
+   mCacheCallbackRegistered = false;
 }
 
 GuiControl::~GuiControl()
@@ -168,6 +179,7 @@ void GuiControl::initPersistFields()
    addField("AltCommand",        TypeString,		Offset(mAltConsoleCommand, GuiControl));
    addField("Accelerator",       TypeString,		Offset(mAcceleratorKey, GuiControl));
    addField("Active",			 TypeBool,			Offset(mActive, GuiControl));
+   addField("cacheAsBitmap",     TypeBool,			Offset(mCacheAsBitmap, GuiControl));
    endGroup("GuiControl");	
 
    addGroup("ToolTip");
@@ -238,6 +250,8 @@ void GuiControl::addObject(SimObject *object)
   if( parent )
      parent->onChildAdded( ctrl );
 
+   invalidateCache();
+
 
 }
 
@@ -247,6 +261,8 @@ void GuiControl::removeObject(SimObject *object)
    if (mAwake)
       static_cast<GuiControl*>(object)->sleep();
     Parent::removeObject(object);
+
+   invalidateCache();
 }
 
 GuiControl *GuiControl::getParent()
@@ -395,6 +411,40 @@ void GuiControl::childResized(GuiControl *child)
    // default to do nothing...
 }
 
+void GuiControl::setLayoutDirty()
+{
+   mLayoutDirty = true;
+
+   // Flag the parents so the layout pass only visits the controls that need it.
+   for(GuiControl *parent = getParent(); parent != NULL && !parent->mChildLayoutDirty; parent = parent->getParent())
+      parent->mChildLayoutDirty = true;
+}
+
+void GuiControl::layout()
+{
+   if(!mAwake)
+      return;
+
+   if(mLayoutDirty)
+   {
+      mLayoutDirty = false;
+      onLayout();
+   }
+
+   if(mChildLayoutDirty)
+   {
+      mChildLayoutDirty = false;
+
+      iterator i;
+      for(i = begin(); i != end(); i++)
+      {
+         GuiControl *ctrl = static_cast<GuiControl *>(*i);
+         if(ctrl->isLayoutDirty())
+            ctrl->layout();
+      }
+   }
+}
+
 void GuiControl::parentResized(const Point2I &oldParentExtent, const Point2I &newParentExtent)
 {
    Point2I newPosition = getPosition();
@@ -637,8 +687,8 @@ void GuiControl::renderChildControls(Point2I offset, const RectI &updateRect)
          if (childClip.intersect(clipRect))
          {
             dglSetClipRect(childClip);
-            glDisable(GL_CULL_FACE);
-            ctrl->onRender(childPosition, childClip);
+            dglDisable(GL_CULL_FACE);
+            ctrl->renderControl(childPosition, childClip);
          }
       }
       size_cpy = objectList.size(); //	CHRIS: i know its wierd but the size of the list changes sometimes during execution of this loop
@@ -652,6 +702,8 @@ void GuiControl::renderChildControls(Point2I offset, const RectI &updateRect)
 
 void GuiControl::setUpdateRegion(Point2I pos, Point2I ext)
 {
+   invalidateCache();
+
    Point2I upos = localToGlobalCoord(pos);
    GuiCanvas *root = getRoot();
    if (root)
@@ -667,6 +719,220 @@ void GuiControl::setUpdate()
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=- //
 
+void GuiControl::renderControl(Point2I offset, const RectI &updateRect)
+{
+   if (mCacheAsBitmap)
+   {
+      renderCached(offset, updateRect);
+      return;
+   }
+
+   // The cache is no longer wanted.
+   if (mCacheTexture != 0)
+      freeCache();
+
+   onRender(offset, updateRect);
+}
+
+void GuiControl::invalidateCache()
+{
+   for (GuiControl *walk = this; walk; walk = walk->getParent())
+   {
+      if (walk->mCacheAsBitmap)
+         walk->mCacheState = CacheDirty;
+   }
+}
+
+void GuiControl::renderCached(Point2I offset, const RectI &updateRect)
+{
+   // The cache holds the visible part of the control.
+   RectI cacheRect(offset, mBounds.extent);
+   if (!cacheRect.intersect(updateRect))
+      return;
+
+   // Moving or clipping the control differently changes what the cache must hold.
+   if (cacheRect != mCacheRect || offset != mCacheOffset || mCacheTexture == 0)
+   {
+      if (mCacheState == CacheValid)
+         mCacheState = CacheSettling;
+
+      mCacheRect = cacheRect;
+      mCacheOffset = offset;
+   }
+
+   // A control that changes every frame is rendered directly as building its cache each
+   // frame would cost more, so the cache is only built once it has gone a frame unchanged.
+   // NOTE: The state is changed before rendering so that changes made whilst rendering count.
+   if (mCacheState == CacheDirty)
+   {
+      mCacheState = CacheSettling;
+      onRender(offset, updateRect);
+      return;
+   }
+
+   if (mCacheState == CacheSettling)
+   {
+      mCacheState = CacheValid;
+      buildCache(offset, updateRect, cacheRect);
+   }
+
+   drawCache(cacheRect);
+}
+
+void GuiControl::buildCache(Point2I offset, const RectI &updateRect, const RectI &cacheRect)
+{
+   PROFILE_SCOPE(GuiControl_BuildCache);
+
+   // Create the texture if it is too small.
+   const U32 textureWidth = getNextPow2(cacheRect.extent.x);
+   const U32 textureHeight = getNextPow2(cacheRect.extent.y);
+   if (mCacheTexture == 0 || textureWidth > (U32)mCacheTextureSize.x || textureHeight > (U32)mCacheTextureSize.y)
+   {
+      if (mCacheTexture != 0)
+         dglDeleteTextures(1, (const GLuint*)&mCacheTexture);
+
+      glGenTextures(1, (GLuint*)&mCacheTexture);
+      dglBindTexture(GL_TEXTURE_2D, mCacheTexture);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, dglDoesSupportEdgeClamp() ? GL_CLAMP_TO_EDGE : GL_CLAMP);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, dglDoesSupportEdgeClamp() ? GL_CLAMP_TO_EDGE : GL_CLAMP);
+      glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, textureWidth, textureHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+      mCacheTextureSize.set(textureWidth, textureHeight);
+
+      // The texture is lost along with the context.
+      if (!mCacheCallbackRegistered)
+      {
+         mCacheCallbackKey = TextureManager::registerEventCallback(cacheTextureEventCallback, this);
+         mCacheCallbackRegistered = true;
+      }
+   }
+
+   // Draw anything batched before reading the back buffer.
+   dglFlushBatch();
+
+   // The cache area in window coordinates.
+   const S32 x = cacheRect.point.x;
+   const S32 y = Platform::getWindowSize().y - (cacheRect.point.y + cacheRect.extent.y);
+   const S32 width = cacheRect.extent.x;
+   const S32 height = cacheRect.extent.y;
+
+   // Keep what is beneath the control so that it can be restored.
+   dglBindTexture(GL_TEXTURE_2D, mCacheTexture);
+   glCopyTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, x, y, width, height);
+
+   // The back buffer may have no alpha so the control is rendered over black and then over white.
+   // Whatever it blends, black gives its colour premultiplied by its coverage and the difference
+   // from white gives how much of the background shows through.
+   // NOTE: A whole-screen control is too large for the frame allocator.
+   U8 *black = new U8[width * height * 4 * 2];
+   U8 *white = black + width * height * 4;
+
+   GLfloat clearColor[4];
+   glGetFloatv(GL_COLOR_CLEAR_VALUE, clearColor);
+   glScissor(x, y, width, height);
+
+   for (U32 pass = 0; pass < 2; pass++)
+   {
+      dglEnable(GL_SCISSOR_TEST);
+      glClearColor((F32)pass, (F32)pass, (F32)pass, (F32)pass);
+      glClear(GL_COLOR_BUFFER_BIT);
+      dglDisable(GL_SCISSOR_TEST);
+
+      dglSetClipRect(updateRect);
+      onRender(offset, updateRect);
+      dglFlushBatch();
+
+      glReadPixels(x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pass == 0 ? black : white);
+   }
+
+   glClearColor(clearColor[0], clearColor[1], clearColor[2], clearColor[3]);
+
+   // Restore what was beneath the control.
+   dglSetClipRect(cacheRect);
+   dglDisable(GL_BLEND);
+   drawCache(cacheRect);
+   dglEnable(GL_BLEND);
+
+   // Combine the renders into premultiplied colour and alpha.
+   for (S32 i = 0; i < width * height * 4; i += 4)
+   {
+      black[i + 3] = (U8)mClamp(255 - ((S32)white[i + 1] - (S32)black[i + 1]), 0, 255);
+   }
+
+   dglBindTexture(GL_TEXTURE_2D, mCacheTexture);
+   glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, black);
+
+   delete [] black;
+}
+
+void GuiControl::drawCache(const RectI &cacheRect)
+{
+   // NOTE: The texture rows run bottom-up whereas the GUI runs top-down.
+   const F32 left = (F32)cacheRect.point.x;
+   const F32 top = (F32)cacheRect.point.y;
+   const F32 right = (F32)(cacheRect.point.x + cacheRect.extent.x);
+   const F32 bottom = (F32)(cacheRect.point.y + cacheRect.extent.y);
+   const F32 texRight = (F32)cacheRect.extent.x / (F32)mCacheTextureSize.x;
+   const F32 texTop = (F32)cacheRect.extent.y / (F32)mCacheTextureSize.y;
+
+   const GLfloat vertices[] = { left, top, right, top, left, bottom, right, bottom };
+   const GLfloat texCoords[] = { 0.0f, texTop, texRight, texTop, 0.0f, 0.0f, texRight, 0.0f };
+
+   dglFlushBatch();
+
+   // The cache holds premultiplied colour.
+   dglBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+   dglEnable(GL_TEXTURE_2D);
+   dglBindTexture(GL_TEXTURE_2D, mCacheTexture);
+   glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_REPLACE);
+   glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
+
+   dglEnableClientState(GL_VERTEX_ARRAY);
+   dglEnableClientState(GL_TEXTURE_COORD_ARRAY);
+   dglDisableClientState(GL_COLOR_ARRAY);
+   glVertexPointer(2, GL_FLOAT, 0, vertices);
+   glTexCoordPointer(2, GL_FLOAT, 0, texCoords);
+   glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+
+   dglDisableClientState(GL_TEXTURE_COORD_ARRAY);
+   glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+   dglDisable(GL_TEXTURE_2D);
+   dglBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+}
+
+void GuiControl::freeCache()
+{
+   if (mCacheCallbackRegistered)
+   {
+      TextureManager::unregisterEventCallback(mCacheCallbackKey);
+      mCacheCallbackRegistered = false;
+   }
+
+   if (mCacheTexture != 0)
+   {
+      dglDeleteTextures(1, (const GLuint*)&mCacheTexture);
+      mCacheTexture = 0;
+   }
+
+   mCacheTextureSize.set(0, 0);
+   mCacheState = CacheDirty;
+}
+
+void GuiControl::cacheTextureEventCallback(const TextureManager::TextureEventCode eventCode, void *userData)
+{
+   // The texture is lost along with the context so forget it.
+   if (eventCode == TextureManager::BeginZombification)
+   {
+      GuiControl *ctrl = static_cast<GuiControl*>(userData);
+      ctrl->mCacheTexture = 0;
+      ctrl->mCacheTextureSize.set(0, 0);
+      ctrl->mCacheState = CacheDirty;
+   }
+}
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=- //
+
 void GuiControl::awaken()
 {
    AssertFatal(!mAwake, "GuiControl::awaken: control is already awake");
@@ -691,8 +957,16 @@ void GuiControl::awaken()
          Con::errorf(ConsoleLogEntry::General, "GuiControl::awaken: failed onWake for obj: %s", getName());
          AssertFatal(0, "GuiControl::awaken: failed onWake");
          deleteObject();
+         return;
       }
    }
+
+   // Layout requested whilst asleep wasn't seen by our new parents so flag them now.
+   if(isLayoutDirty())
+   {
+      for(GuiControl *parent = getParent(); parent != NULL && !parent->mChildLayoutDirty; parent = parent->getParent())
+         parent->mChildLayoutDirty = true;
+   }
 }
 
 void GuiControl::sleep()
@@ -827,6 +1101,8 @@ void GuiControl::onSleep()
    if( isMethod("onSleep") )
       Con::executef(this, 1, "onSleep");
 
+   freeCache();
+
    // Set Flag
    mAwake = false;
 }
@@ -906,6 +1182,7 @@ void GuiControl::write(Stream &stream, U32 tabStop, U32 flags)
 void GuiControl::onRemove()
 {
    clearFirstResponder();
+   freeCache();
 
    Parent::onRemove();
 
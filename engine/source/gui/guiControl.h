@@ -51,6 +51,10 @@
 #ifndef _LANG_H_
 #include "gui/language/lang.h"
 #endif
+
+#ifndef _TEXTURE_MANAGER_H_
+#include "graphics/TextureManager.h"
+#endif
 class GuiCanvas;
 class GuiEditCtrl;
 
@@ -113,6 +117,9 @@ public:
     bool    mSetFirstResponder;
     bool    mCanSave;
     bool    mIsContainer; ///< if true, then the GuiEditor can drag other controls into this one.
+    bool    mLayoutDirty; ///< This control must lay out its children before it is next rendered.
+    bool    mChildLayoutDirty; ///< A control below this one must lay out its children before it is next rendered.
+    bool    mCacheAsBitmap; ///< This control and its children are drawn from a texture until they change.
 
     S32     mLayer;
     static S32     smCursorChanged; ///< Has this control modified the cursor? -1 or type
@@ -169,6 +176,40 @@ protected:
 
     /// @}
 
+    /// @name Bitmap Cache
+    /// @{
+
+    enum CacheState
+    {
+        CacheDirty,     ///< The cache must not be used and the control has changed.
+        CacheSettling,  ///< The control was rendered directly and has not changed since.
+        CacheValid      ///< The cache holds the control as it would render.
+    };
+
+    U32     mCacheState;
+    U32     mCacheTexture;
+    Point2I mCacheTextureSize;
+    RectI   mCacheRect;         ///< The screen area the cache was built from.
+    Point2I mCacheOffset;       ///< The control position the cache was built at.
+    U32     mCacheCallbackKey;
+    bool    mCacheCallbackRegistered;
+
+    /// Renders this control from its cache, building the cache first if needed.
+    void renderCached(Point2I offset, const RectI &updateRect);
+
+    /// Renders this control into its cache.
+    void buildCache(Point2I offset, const RectI &updateRect, const RectI &cacheRect);
+
+    /// Draws the cache with premultiplied alpha.
+    void drawCache(const RectI &cacheRect);
+
+    /// Deletes the cache texture.
+    void freeCache();
+
+    static void cacheTextureEventCallback(const TextureManager::TextureEventCode eventCode, void *userData);
+
+    /// @}
+
     /// @name Console
     /// The console variable collection of functions allows a console variable to be bound to the GUI control.
     ///
@@ -369,6 +410,19 @@ public:
     /// @param   oldParentExtent   The old size of the parent object
     /// @param   newParentExtent   The new size of the parent object
     virtual void parentResized(const Point2I &oldParentExtent, const Point2I &newParentExtent);
+
+    /// Requests that this control lays out its children before it is next rendered.
+    /// Containers use this so that many changes within a frame cause only one layout.
+    void setLayoutDirty();
+
+    /// Returns true if this control or one below it must lay out its children.
+    inline bool isLayoutDirty() const { return mLayoutDirty || mChildLayoutDirty; }
+
+    /// Lays out this control and those below it that have requested it.
+    void layout();
+
+    /// Called once before rendering after setLayoutDirty() to lay out the children
+    virtual void onLayout() {}
     /// @}
 
     /// @name Rendering
@@ -384,11 +438,23 @@ public:
     /// @param   tipText     optional alternate tip to be rendered
     virtual bool renderTooltip(Point2I cursorPos, const char* tipText = NULL );
 
+    /// Gets the tooltip text of this control
+    inline StringTableEntry getTooltip() const { return mTooltip; }
+
     /// Called when this control should render its children
     /// @param   offset   The location this control is to begin rendering
     /// @param   updateRect   The screen area this control has drawing access to
     void renderChildControls(Point2I offset, const RectI &updateRect);
 
+    /// Renders this control, from its bitmap cache if it has one
+    /// @param   offset   The location this control is to begin rendering
+    /// @param   updateRect   The screen area this control has drawing access to
+    void renderControl(Point2I offset, const RectI &updateRect);
+
+    /// Forces the bitmap cache of this control and any above it to be rebuilt.
+    /// Changes that call setUpdate() do this already.
+    void invalidateCache();
+
     /// Sets the area (local coordinates) this control wants refreshed each frame
     /// @param   pos   UpperLeft point on rectangle of refresh area
     /// @param   ext   Extent of update rect
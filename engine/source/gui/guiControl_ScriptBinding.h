@@ -143,6 +143,14 @@ ConsoleMethodWithDocs( GuiControl, makeFirstResponder, ConsoleVoid, 3, 3, ( isFi
    object->makeFirstResponder(dAtob(argv[2]));
 }
 
+/*! Use the invalidateCache method to redraw a control with cacheAsBitmap set, or one of its children, that has changed without updating itself.
+    @return No return value
+*/
+ConsoleMethodWithDocs( GuiControl, invalidateCache, ConsoleVoid, 2, 2, ())
+{
+   object->invalidateCache();
+}
+
 /*! Use the isVisible method to determine if this control is visible.
     This can return true, even if the entire control covered by another. This merely means that the control will render if not covered
     @return Returns true if the control is visible.
@@ -31,6 +31,8 @@ GuiListBoxCtrl::GuiListBoxCtrl()
    mFitParentWidth = true;
    mItemSize = Point2I(10,20);
    mLastClickItem = NULL;
+   mMaxItemWidth = -1;
+   mMeasuredFont = NULL;
 }
 
 GuiListBoxCtrl::~GuiListBoxCtrl()
@@ -76,12 +78,13 @@ ConsoleMethod( GuiListBoxCtrl, clearItems, void, 2, 2, "() Clears all the items
 void GuiListBoxCtrl::clearItems()
 {
    // Free item list allocated memory
-   while( mItems.size() )
-      deleteItem( 0 );
+   for( S32 i = 0; i < mItems.size(); i++ )
+      delete mItems[i];
 
    // Free our vector lists
    mItems.clear();
    mSelectedItems.clear();
+   mMaxItemWidth = -1;
 }
 
 
@@ -510,6 +513,7 @@ S32 GuiListBoxCtrl::insertItem( S32 index, StringTableEntry text, void *itemData
    newItem->itemData    = itemData;
    newItem->isSelected  = false;
    newItem->hasColor    = false;
+   addItemWidth( newItem );
 
    // Add to list
    mItems.insert(index);
@@ -555,6 +559,7 @@ S32 GuiListBoxCtrl::insertItemWithColor( S32 index, StringTableEntry text, Color
    newItem->isSelected  = false;
    newItem->hasColor    = true;
    newItem->color       = color;
+   addItemWidth( newItem );
 
    // Add to list
    mItems.insert(index);
@@ -607,6 +612,7 @@ void  GuiListBoxCtrl::deleteItem( S32 index )
 
    // Remove it from the list
    mItems.erase( &mItems[ index ] );
+   removeItemWidth( item );
 
    // Free the memory associated with it
    delete item;
@@ -653,7 +659,9 @@ void GuiListBoxCtrl::setItemText( S32 index, StringTableEntry text )
       return;
    }
 
+   removeItemWidth( mItems[ index ] );
    mItems[ index ]->itemText = StringTable->insert( text );
+   addItemWidth( mItems[ index ] );
 }
 //////////////////////////////////////////////////////////////////////////
 // Sizing Functions
@@ -670,15 +678,29 @@ void GuiListBoxCtrl::updateSize()
       mItemSize.x = parent->getContentExtent().x;
    else
    {
-      // Find the maximum width cell:
-      S32 maxWidth = 1;
-      for ( U32 i = 0; i < (U32)mItems.size(); i++ )
+      // Measure every item again if the font has changed.
+      if( font != mMeasuredFont )
       {
-         S32 width = font->getStrWidth( mItems[i]->itemText );
-         if( width > maxWidth )
-            maxWidth = width;
+         mMeasuredFont = font;
+         for ( U32 i = 0; i < (U32)mItems.size(); i++ )
+            mItems[i]->width = -1;
+
+         mMaxItemWidth = -1;
       }
-      mItemSize.x = maxWidth + 6;
+
+      // Find the maximum width cell, measuring only the items that have changed:
+      if( mMaxItemWidth < 0 )
+      {
+         mMaxItemWidth = 1;
+         for ( U32 i = 0; i < (U32)mItems.size(); i++ )
+         {
+            if( mItems[i]->width < 0 )
+               mItems[i]->width = font->getStrWidth( mItems[i]->itemText );
+
+            mMaxItemWidth = getMax( mMaxItemWidth, mItems[i]->width );
+         }
+      }
+      mItemSize.x = mMaxItemWidth + 6;
    }
 
    mItemSize.y = font->getHeight() + 2;
@@ -688,6 +710,25 @@ void GuiListBoxCtrl::updateSize()
 
 }
 
+void GuiListBoxCtrl::addItemWidth( LBItem *item )
+{
+   item->width = -1;
+
+   // Measure the item now only if the widest item is known, otherwise it is measured when that is found.
+   if( mMaxItemWidth < 0 || mMeasuredFont == NULL )
+      return;
+
+   item->width = mMeasuredFont->getStrWidth( item->itemText );
+   mMaxItemWidth = getMax( mMaxItemWidth, item->width );
+}
+
+void GuiListBoxCtrl::removeItemWidth( LBItem *item )
+{
+   // Find the widest item again if this was it.
+   if( item->width < 0 || item->width >= mMaxItemWidth )
+      mMaxItemWidth = -1;
+}
+
 void GuiListBoxCtrl::parentResized(const Point2I &oldParentExtent, const Point2I &newParentExtent)
 {
    Parent::parentResized( oldParentExtent, newParentExtent );
@@ -708,7 +749,10 @@ void GuiListBoxCtrl::onRender( Point2I offset, const RectI &updateRect )
    // Save our original clip rect
    RectI oldClipRect = clipRect;
 
-   for ( S32 i = 0; i < mItems.size(); i++)
+   // Start at the first visible item rather than stepping over every item above it
+   S32 firstItem = mItemSize.y > 0 ? getMax( 0, ( updateRect.point.y - offset.y ) / mItemSize.y - 1 ) : 0;
+
+   for ( S32 i = firstItem; i < mItems.size(); i++)
    {
       S32 colorBoxSize = 0;
       ColorI boxColor = ColorI(0, 0, 0);
@@ -60,6 +60,7 @@ public:
       void*             itemData;
       ColorF            color;
       bool              hasColor;
+      S32               width;         ///< Cached text width or -1 if it has not been measured.
    };
 
    VectorPtr<LBItem*>   mItems;
@@ -69,6 +70,11 @@ public:
    bool                 mFitParentWidth;
    LBItem*              mLastClickItem;
 
+   /// The widest item or -1 if it must be found again.  Items are only measured
+   /// when they change so resizing the list doesn't measure every item.
+   S32                  mMaxItemWidth;
+   GFont*               mMeasuredFont;
+
    // Persistence
    static void       initPersistFields();   
 
@@ -104,6 +110,8 @@ public:
 
    // Sizing
    void              updateSize();
+   void              addItemWidth( LBItem *item );
+   void              removeItemWidth( LBItem *item );
    virtual void      parentResized(const Point2I &oldParentExtent, const Point2I &newParentExtent);
    virtual bool      onWake();
 
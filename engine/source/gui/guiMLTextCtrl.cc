@@ -130,6 +130,8 @@ GuiMLTextCtrl::GuiMLTextCtrl()
    mHitURL = 0;
    mActive = true;
    mAlpha = 1.0;
+   mReflowCheckpoint.scanPos = 0;
+   mAppendOnly = false;
 }
 
 //--------------------------------------------------------------------------
@@ -331,6 +333,7 @@ void GuiMLTextCtrl::freeLineBuffers()
    mTagList = NULL;
    mHitURL = 0;
    mDirty = true;
+   mReflowCheckpoint.scanPos = 0;
 }
 
 //--------------------------------------------------------------------------
@@ -370,6 +373,10 @@ void GuiMLTextCtrl::inspectPostApply()
 
    if ((S32)mLineSpacingPixels < 0)
       mLineSpacingPixels = 0;
+
+   // The line spacing may have changed.
+   mAppendOnly = false;
+   mDirty = true;
 }
 
 //--------------------------------------------------------------------------
@@ -445,6 +452,7 @@ void GuiMLTextCtrl::setText(const char* textBuffer, const U32 numChars)
    setCursorPosition(0);
    clearSelection();
    mDirty = true;
+   mAppendOnly = false;
    scrollToTop();
 }
 
@@ -742,6 +750,7 @@ void GuiMLTextCtrl::insertChars(const char* inputChars,
 
    AssertFatal(mCursorPosition <= mTextBuffer.length(), "GuiMLTextCtrl::insertChars: bad cursor position");
    mDirty = true;
+   mAppendOnly = false;
 }
 
 //--------------------------------------------------------------------------
@@ -775,6 +784,7 @@ void GuiMLTextCtrl::deleteChars(const U32 rangeStart,
 
    AssertFatal(mCursorPosition <= mTextBuffer.length(), "GuiMLTextCtrl::deleteChars: bad cursor position");
    mDirty = true;
+   mAppendOnly = false;
 }
 
 //--------------------------------------------------------------------------
@@ -1416,56 +1426,134 @@ GuiMLTextCtrl::Style *GuiMLTextCtrl::allocStyle(GuiMLTextCtrl::Style *style)
 }
 
 //--------------------------------------------------------------------------
-void GuiMLTextCtrl::reflow()
+void GuiMLTextCtrl::saveReflowCheckpoint()
 {
-   AssertFatal(mAwake, "Can't reflow a sleeping control.");
-   freeLineBuffers();
-   mDirty = false;
-   mScanPos = 0;
+   // Only a plain line break can be flowed on from; bitmaps may still be blocking the lines below.
+   if(mBlockList != &mSentinel || mEmitAtoms != NULL || mLineAtoms != NULL)
+      return;
 
-   mLineList = NULL;
-   mLineInsert = &mLineList;
+   // Text after here must not change this style in place.
+   mCurStyle->used = true;
 
-   mCurStyle = allocStyle(NULL);
-   mCurStyle->font = allocFont((char *) mProfile->mFontType, dStrlen(mProfile->mFontType), mProfile->mFontSize);
-   if(!mCurStyle->font)
-      return;
-   mCurStyle->color = mProfile->mFontColor;
-   mCurStyle->shadowColor = mProfile->mFontColor;
-   mCurStyle->shadowOffset.set(0,0);
-   mCurStyle->linkColor = mProfile->mFontColors[GuiControlProfile::ColorUser0];
-   mCurStyle->linkColorHL = mProfile->mFontColors[GuiControlProfile::ColorUser1];
+   mReflowCheckpoint.scanPos = mScanPos;
+   mReflowCheckpoint.width = mBounds.extent.x;
+   mReflowCheckpoint.lineInsert = mLineInsert;
+   mReflowCheckpoint.style = mCurStyle;
+   mReflowCheckpoint.lMargin = mCurLMargin;
+   mReflowCheckpoint.rMargin = mCurRMargin;
+   mReflowCheckpoint.justify = mCurJustify;
+   mReflowCheckpoint.y = mCurY;
+   mReflowCheckpoint.maxY = mMaxY;
+   mReflowCheckpoint.lineStart = mLineStart;
+   mReflowCheckpoint.tabStops = mTabStops;
+   mReflowCheckpoint.tabStopCount = mTabStopCount;
+   mReflowCheckpoint.url = mCurURL;
+   mReflowCheckpoint.bitmapRefList = mBitmapRefList;
+   mReflowCheckpoint.tagList = mTagList;
+}
 
-   U32 width = mBounds.extent.x;
+//--------------------------------------------------------------------------
+bool GuiMLTextCtrl::restoreReflowCheckpoint()
+{
+   if(!mAppendOnly || mReflowCheckpoint.scanPos == 0 || mReflowCheckpoint.width != (U32)mBounds.extent.x ||
+      mReflowCheckpoint.scanPos > mTextBuffer.length())
+      return false;
+
+   // Discard the lines after the checkpoint.  Their memory is reclaimed by the next full reflow.
+   mScanPos = mReflowCheckpoint.scanPos;
+   mLineInsert = mReflowCheckpoint.lineInsert;
+   *mLineInsert = NULL;
 
-   mCurLMargin = 0;
-   mCurRMargin = width;
-   mCurJustify = LeftJustify;
+   mCurStyle = mReflowCheckpoint.style;
+   mCurLMargin = mReflowCheckpoint.lMargin;
+   mCurRMargin = mReflowCheckpoint.rMargin;
+   mCurJustify = mReflowCheckpoint.justify;
    mCurDiv = 0;
-   mCurY = 0;
-   mCurX = 0;
+   mCurY = mReflowCheckpoint.y;
+   mCurX = mCurLMargin;
    mCurClipX = 0;
+   mMaxY = mReflowCheckpoint.maxY;
+   mLineStart = mReflowCheckpoint.lineStart;
    mLineAtoms = NULL;
    mLineAtomPtr = &mLineAtoms;
-
-   mSentinel.point.x = width;
-   mSentinel.point.y = 0;
-   mSentinel.extent.x = 0;
-   mSentinel.extent.y = 0x7FFFFF;
-   mSentinel.nextBlocker = NULL;
-   mLineStart = 0;
    mEmitAtoms = 0;
-   mMaxY = 0;
    mEmitAtomPtr = &mEmitAtoms;
-
+   mSentinel.nextBlocker = NULL;
    mBlockList = &mSentinel;
+   mTabStops = mReflowCheckpoint.tabStops;
+   mTabStopCount = mReflowCheckpoint.tabStopCount;
+   mCurTabStop = 0;
+   mCurURL = mReflowCheckpoint.url;
+   mBitmapRefList = mReflowCheckpoint.bitmapRefList;
+   mTagList = mReflowCheckpoint.tagList;
+   mHitURL = 0;
+
+   return true;
+}
+
+//--------------------------------------------------------------------------
+void GuiMLTextCtrl::reflow()
+{
+   AssertFatal(mAwake, "Can't reflow a sleeping control.");
+
+   U32 width = mBounds.extent.x;
+
+   // Flow appended text on from the last line break, otherwise start again.
+   if(restoreReflowCheckpoint())
+   {
+      mDirty = false;
+   }
+   else
+   {
+      freeLineBuffers();
+      mDirty = false;
+      mScanPos = 0;
+
+      mLineList = NULL;
+      mLineInsert = &mLineList;
+
+      mCurStyle = allocStyle(NULL);
+      mCurStyle->font = allocFont((char *) mProfile->mFontType, dStrlen(mProfile->mFontType), mProfile->mFontSize);
+      if(!mCurStyle->font)
+         return;
+      mCurStyle->color = mProfile->mFontColor;
+      mCurStyle->shadowColor = mProfile->mFontColor;
+      mCurStyle->shadowOffset.set(0,0);
+      mCurStyle->linkColor = mProfile->mFontColors[GuiControlProfile::ColorUser0];
+      mCurStyle->linkColorHL = mProfile->mFontColors[GuiControlProfile::ColorUser1];
+
+      mCurLMargin = 0;
+      mCurRMargin = width;
+      mCurJustify = LeftJustify;
+      mCurDiv = 0;
+      mCurY = 0;
+      mCurX = 0;
+      mCurClipX = 0;
+      mLineAtoms = NULL;
+      mLineAtomPtr = &mLineAtoms;
+
+      mSentinel.point.x = width;
+      mSentinel.point.y = 0;
+      mSentinel.extent.x = 0;
+      mSentinel.extent.y = 0x7FFFFF;
+      mSentinel.nextBlocker = NULL;
+      mLineStart = 0;
+      mEmitAtoms = 0;
+      mMaxY = 0;
+      mEmitAtomPtr = &mEmitAtoms;
+
+      mBlockList = &mSentinel;
+
+      mTabStops = 0;
+      mCurTabStop = 0;
+      mTabStopCount = 0;
+      mCurURL = 0;
+   }
+
+   mAppendOnly = true;
 
    Font *nextFont;
    LineTag *nextTag;
-   mTabStops = 0;
-   mCurTabStop = 0;
-   mTabStopCount = 0;
-   mCurURL = 0;
    Style *newStyle;
 
    U32 textStart;
@@ -1488,6 +1576,7 @@ void GuiMLTextCtrl::reflow()
          processEmitAtoms();
          emitNewLine(textStart);
          mCurDiv = 0;
+         saveReflowCheckpoint();
          continue;
       }
 
@@ -200,6 +200,32 @@ class GuiMLTextCtrl : public GuiControl
 
    URL *mHitURL;
 
+   /// The layout state after the last line break of the previous reflow.  When text
+   /// has only been appended since then the next reflow carries on from here rather
+   /// than parsing and measuring all the text again.
+   struct ReflowCheckpoint
+   {
+      U32 scanPos;         ///< Zero if there is no checkpoint.
+      U32 width;
+      Line **lineInsert;
+      Style *style;
+      U32 lMargin;
+      U32 rMargin;
+      U32 justify;
+      U32 y;
+      U32 maxY;
+      U32 lineStart;
+      U32 *tabStops;
+      U32 tabStopCount;
+      URL *url;
+      BitmapRef *bitmapRefList;
+      LineTag *tagList;
+   } mReflowCheckpoint;
+   bool mAppendOnly;       ///< Text has only been appended since the last reflow.
+
+   void saveReflowCheckpoint();
+   bool restoreReflowCheckpoint();
+
    void freeLineBuffers();
    void freeResources();
 
@@ -45,6 +45,12 @@ void GuiMouseEventCtrl::initPersistFields()
 {
    Parent::initPersistFields();
    addField("lockMouse", TypeBool, Offset(mLockMouse, GuiMouseEventCtrl));
+}
+
+//------------------------------------------------------------------------------
+void GuiMouseEventCtrl::consoleInit()
+{
+   Parent::consoleInit();
 
    Con::setIntVariable("$EventModifier::LSHIFT",      SI_LSHIFT);
    Con::setIntVariable("$EventModifier::RSHIFT",      SI_RSHIFT);
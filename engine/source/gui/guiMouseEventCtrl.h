@@ -56,6 +56,7 @@ class GuiMouseEventCtrl : public GuiControl
       void onRightMouseDragged(const GuiEvent & event);
 
       static void initPersistFields();
+      static void consoleInit();
 
       DECLARE_CONOBJECT(GuiMouseEventCtrl);
 };
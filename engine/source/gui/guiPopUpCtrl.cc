@@ -470,18 +470,18 @@ ConsoleMethod( GuiPopUpMenuCtrl, setEnumContent, void, 4, 4, "(string class, str
 
    // walk the fields to check for this one (findField checks StringTableEntry ptrs...)
    U32 i;
-   for(i = 0; i < (U32)classRep->mFieldList.size(); i++)
-      if(!dStricmp(classRep->mFieldList[i].pFieldname, argv[3]))
+   for(i = 0; i < (U32)classRep->getFieldList().size(); i++)
+      if(!dStricmp(classRep->getFieldList()[i].pFieldname, argv[3]))
          break;
 
    // found it?   
-   if(i == classRep->mFieldList.size())
+   if(i == classRep->getFieldList().size())
    {   
       Con::warnf(ConsoleLogEntry::General, "failed to locate field '%s' for class '%s'", argv[3], argv[2]);
       return;
    }
 
-   const AbstractClassRep::Field & field = classRep->mFieldList[i];
+   const AbstractClassRep::Field & field = classRep->getFieldList()[i];
 
    // check the type
    if(field.type != TypeEnum)
@@ -1106,6 +1106,7 @@ void GuiPopUpMenuCtrl::onRender(Point2I offset, const RectI &updateRect)
          F32 top = (F32)(r.extent.y / 2 + r.point.y - 4);
          F32 bottom = (F32)(top + 8);
 
+         dglFlushBatch();
          glBegin(GL_TRIANGLES);
          glColor3i(mProfile->mFontColor.red,mProfile->mFontColor.green,mProfile->mFontColor.blue);
          glVertex2fv( Point3F(left,top,0) );
@@ -505,18 +505,18 @@ ConsoleMethod( GuiPopUpMenuCtrlEx, setEnumContent, void, 4, 4, "(string class, s
 
    // walk the fields to check for this one (findField checks StringTableEntry ptrs...)
    U32 i;
-   for(i = 0; i < (U32)classRep->mFieldList.size(); i++)
-      if(!dStricmp(classRep->mFieldList[i].pFieldname, argv[3]))
+   for(i = 0; i < (U32)classRep->getFieldList().size(); i++)
+      if(!dStricmp(classRep->getFieldList()[i].pFieldname, argv[3]))
          break;
    
    // found it?   
-   if(i == classRep->mFieldList.size())
+   if(i == classRep->getFieldList().size())
    {   
       Con::warnf(ConsoleLogEntry::General, "failed to locate field '%s' for class '%s'", argv[3], argv[2]);
       return;
    }
    
-   const AbstractClassRep::Field & field = classRep->mFieldList[i];
+   const AbstractClassRep::Field & field = classRep->getFieldList()[i];
 
    // check the type
    if(field.type != TypeEnum)
@@ -1082,6 +1082,7 @@ void GuiPopUpMenuCtrlEx::onRender(Point2I offset, const RectI &updateRect)
       F32 top = (F32)(r.extent.y / 2 + r.point.y - 4);
       F32 bottom = (F32)(top + 8);
 
+      dglFlushBatch();
 #if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_ANDROID) || defined(TORQUE_OS_EMSCRIPTEN)
 // PUAP -Mat untested
        glColor4ub(mProfile->mFontColor.red,mProfile->mFontColor.green,mProfile->mFontColor.blue, 255);
@@ -252,6 +252,7 @@ void GuiSliderCtrl::onRender(Point2I offset, const RectI &updateRect)
             Point2I mid(ext.x, ext.y / 2);
             Point2I oldpos = pos;
             pos += Point2I(1, 0);
+            dglFlushBatch();
             glColor4f(0, 0, 0, 1);
 
 #if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_ANDROID) || defined(TORQUE_OS_EMSCRIPTEN)
@@ -353,6 +354,7 @@ void GuiSliderCtrl::onRender(Point2I offset, const RectI &updateRect)
             if (mDisplayValue)
                 mid.set(ext.x, mThumbSize.y / 2);
 
+            dglFlushBatch();
             glColor4f(0, 0, 0, 1);
 #if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_ANDROID) || defined(TORQUE_OS_EMSCRIPTEN)
             // tick marks
@@ -70,6 +70,7 @@ GuiTextListCtrl::GuiTextListCtrl()
 {
    VECTOR_SET_ASSOCIATION(mList);
    VECTOR_SET_ASSOCIATION(mColumnOffsets);
+   VECTOR_SET_ASSOCIATION(mMeasuredColumnOffsets);
 
    mActive = true;
    mEnumerate = false;
@@ -78,6 +79,8 @@ GuiTextListCtrl::GuiTextListCtrl()
    mColumnOffsets.push_back(0);
    mFitParentWidth = true;
    mClipColumnText = false;
+   mMaxRowWidth = -1;
+   mMeasuredFont = NULL;
 }
 
 void GuiTextListCtrl::initPersistFields()
@@ -405,12 +408,32 @@ U32 GuiTextListCtrl::getRowWidth(Entry *row)
    return width;
 }
 
+void GuiTextListCtrl::addRowWidth(Entry &row)
+{
+   row.width = -1;
+
+   // Measure the row now only if the widest row is known, otherwise it is measured when that is found.
+   if(mMaxRowWidth < 0 || !bool(mFont))
+      return;
+
+   row.width = getRowWidth(&row);
+   mMaxRowWidth = getMax(mMaxRowWidth, row.width);
+}
+
+void GuiTextListCtrl::removeRowWidth(const Entry &row)
+{
+   // Find the widest row again if this was it.
+   if(row.width < 0 || row.width >= mMaxRowWidth)
+      mMaxRowWidth = -1;
+}
+
 void GuiTextListCtrl::insertEntry(U32 id, const char *text, S32 index)
 {
    Entry e;
    e.text = dStrdup(text);
    e.id = id;
    e.active = true;
+   addRowWidth(e);
    if(!mList.size())
       mList.push_back(e);
    else
@@ -430,6 +453,7 @@ void GuiTextListCtrl::addEntry(U32 id, const char *text)
    e.text = dStrdup(text);
    e.id = id;
    e.active = true;
+   addRowWidth(e);
    mList.push_back(e);
    setSize(Point2I(1, mList.size()));
 }
@@ -442,7 +466,9 @@ void GuiTextListCtrl::setEntry(U32 id, const char *text)
    else
    {
       dFree(mList[e].text);
+      removeRowWidth(mList[e]);
       mList[e].text = dStrdup(text);
+      addRowWidth(mList[e]);
 
       // Still have to call this to make sure cells are wide enough for new values:
       setSize( Point2I( 1, mList.size() ) );
@@ -508,16 +534,33 @@ void GuiTextListCtrl::setSize(Point2I newSize)
       }
       else
       {
-         // Find the maximum width cell:
-         S32 maxWidth = 1;
-         for ( U32 i = 0; i < (U32)mList.size(); i++ )
+         // Measure every row again if the font or columns have changed.
+         if ( mMeasuredFont != (GFont*)mFont || mMeasuredColumnOffsets.size() != mColumnOffsets.size() ||
+              ( mColumnOffsets.size() > 0 && dMemcmp( mMeasuredColumnOffsets.address(), mColumnOffsets.address(), mColumnOffsets.size() * sizeof(S32) ) != 0 ) )
+         {
+            mMeasuredFont = mFont;
+            mMeasuredColumnOffsets = mColumnOffsets;
+
+            for ( U32 i = 0; i < (U32)mList.size(); i++ )
+               mList[i].width = -1;
+
+            mMaxRowWidth = -1;
+         }
+
+         // Find the maximum width cell, measuring only the rows that have changed:
+         if ( mMaxRowWidth < 0 )
          {
-            U32 rWidth = getRowWidth( &mList[i] );
-            if ( rWidth > (U32)maxWidth )
-               maxWidth = rWidth;
+            mMaxRowWidth = 1;
+            for ( U32 i = 0; i < (U32)mList.size(); i++ )
+            {
+               if ( mList[i].width < 0 )
+                  mList[i].width = getRowWidth( &mList[i] );
+
+               mMaxRowWidth = getMax( mMaxRowWidth, mList[i].width );
+            }
          }
 
-         mCellSize.x = maxWidth + 8;
+         mCellSize.x = mMaxRowWidth + 8;
       }
 
       mCellSize.y = mFont->getHeight() + 2;
@@ -529,8 +572,15 @@ void GuiTextListCtrl::setSize(Point2I newSize)
 
 void GuiTextListCtrl::clear()
 {
-   while (mList.size())
-      removeEntry(mList[0].id);
+   if ( mList.size() )
+   {
+      for ( U32 i = 0; i < (U32)mList.size(); i++ )
+         dFree(mList[i].text);
+
+      mList.clear();
+      mMaxRowWidth = -1;
+      setSize(Point2I(1, 0));
+   }
 
    mMouseOverCell.set( -1, -1 );
    setSelectedCell(Point2I(-1, -1));
@@ -571,6 +621,7 @@ void GuiTextListCtrl::removeEntryByIndex(S32 index)
    if(index < 0 || index >= mList.size())
       return;
    dFree(mList[index].text);
+   removeRowWidth(mList[index]);
    mList.erase(index);
 
    setSize(Point2I( 1, mList.size()));
@@ -38,6 +38,7 @@ class GuiTextListCtrl : public GuiArrayCtrl
       char *text;
       U32 id;
       bool active;
+      S32 width;  ///< Cached row width or -1 if it has not been measured.
    };
 
    Vector<Entry> mList;
@@ -59,7 +60,15 @@ class GuiTextListCtrl : public GuiArrayCtrl
    bool  mFitParentWidth;
    bool  mClipColumnText;
 
+   /// The widest row or -1 if it must be found again.  Rows are only measured
+   /// when they change so resizing the list doesn't measure every row.
+   S32 mMaxRowWidth;
+   GFont *mMeasuredFont;
+   Vector<S32> mMeasuredColumnOffsets;
+
    U32 getRowWidth(Entry *row);
+   void addRowWidth(Entry &row);
+   void removeRowWidth(const Entry &row);
    void onCellSelected(Point2I cell);
 
   public:
@@ -41,7 +41,7 @@ GuiTreeViewCtrl::Item::Item( GuiControlProfile *pProfile )
    mId                  = -1;
    mTabLevel            = 0;
    mIcon                = 0;
-   mDataRenderWidth     = 0;
+   mDataRenderWidth     = -1;
    mScriptInfo.mText    = NULL;
    mScriptInfo.mValue   = NULL;
    mInspectorInfo.mObject = NULL;
@@ -102,11 +102,8 @@ void GuiTreeViewCtrl::Item::setText(char *txt)
 
    mScriptInfo.mText = txt;
 
-
-   // Update Render Data
-   if( !mProfile.isNull() )
-      mDataRenderWidth = getDisplayTextWidth( mProfile->mFont );
-
+   // Measure again when next built.
+   mDataRenderWidth = -1;
 }
 
 void GuiTreeViewCtrl::Item::setValue(const char *val)
@@ -119,10 +116,8 @@ void GuiTreeViewCtrl::Item::setValue(const char *val)
 
    mScriptInfo.mValue = const_cast<char*>(val); // mValue really ought to be a StringTableEntry
 
-   // Update Render Data
-   if( !mProfile.isNull() )
-      mDataRenderWidth = getDisplayTextWidth( mProfile->mFont );
-
+   // Measure again when next built.
+   mDataRenderWidth = -1;
 }
 
 const S8 GuiTreeViewCtrl::Item::getNormalImage() const
@@ -179,10 +174,8 @@ void GuiTreeViewCtrl::Item::setObject(SimObject *obj)
 
    mInspectorInfo.mObject = obj;
 
-   // Update Render Data
-   if( !mProfile.isNull() )
-      mDataRenderWidth = getDisplayTextWidth( mProfile->mFont );
-
+   // Measure again when next built.
+   mDataRenderWidth = -1;
 }
 
 SimObject *GuiTreeViewCtrl::Item::getObject()
@@ -255,11 +248,12 @@ const S32 GuiTreeViewCtrl::Item::getDisplayTextWidth(GFont *font)
       return 0;
 
    FrameAllocatorMarker txtAlloc;
-   U32 bufLen = getDisplayTextLength();
-   if( bufLen == 0 )
+   U32 bufLen = getDisplayTextLength() + 1;
+   if( bufLen == 1 )
       return 0;
 
    char *buf = (char*)txtAlloc.alloc(bufLen);
+   buf[bufLen-1] = 0;
    getDisplayText(bufLen, buf);
 
    return font->getStrWidth(buf);
@@ -357,6 +351,7 @@ GuiTreeViewCtrl::GuiTreeViewCtrl()
    VECTOR_SET_ASSOCIATION(mSelected);
 
    mItemFreeList  =  NULL;
+   mLastInsertedItem = NULL;
    mRoot          =  NULL;
    mInstantGroup  =  0;
    mItemCount     =  0;
@@ -543,6 +538,9 @@ void GuiTreeViewCtrl::destroyItem(Item * item)
    if( item->mParent && ( item->mParent->mChild == item ) )
       item->mParent->mChild = item->mNext;
 
+   if( item == mLastInsertedItem )
+      mLastInsertedItem = NULL;
+
    // remove from vector
    mItems[item->mId-1] = 0;
 
@@ -586,6 +584,7 @@ void GuiTreeViewCtrl::destroyTree()
    //
    mRoot          = NULL;
    mItemFreeList  = NULL;
+   mLastInsertedItem = NULL;
    mItemCount     = 0;
    mSelectedItem  = 0;
    mDraggedToItem = 0;
@@ -618,7 +617,12 @@ void GuiTreeViewCtrl::buildItem( Item* item, U32 tabLevel, bool bForceFullUpdate
 
    if ( mProfile != NULL && !mProfile->mFont.isNull() )
    {
-      S32 width = ( tabLevel + 1 ) * mTabSize + item->getDisplayTextWidth(mProfile->mFont);
+      // Only measure the text when it has changed.  Inspector items are measured
+      // each time as their object may have been renamed.
+      if ( item->mDataRenderWidth < 0 || item->isInspectorData() )
+         item->mDataRenderWidth = item->getDisplayTextWidth(mProfile->mFont);
+
+      S32 width = ( tabLevel + 1 ) * mTabSize + item->mDataRenderWidth;
       if ( mProfile->mBitmapArrayRects.size() > 0 )
          width += mProfile->mBitmapArrayRects[0].extent.x;
       
@@ -679,6 +683,63 @@ void GuiTreeViewCtrl::buildVisibleTree(bool bForceFullUpdate)
 
 //------------------------------------------------------------------------------
 
+void GuiTreeViewCtrl::updateVisibleChildren( Item *item )
+{
+   // Rebuild everything if that is already due or if the children may change as they are built.
+   if( mFlags.test( RebuildVisible ) || mFlags.test( BuildingVisTree ) || item->mState.test( Item::VirtualParent ) || item->isInspectorData() )
+   {
+      buildVisibleTree();
+      return;
+   }
+
+   // Find the item's row.  If it isn't shown then neither are its children.
+   S32 index = 0;
+   while( index < mVisibleItems.size() && mVisibleItems[index] != item )
+      index++;
+
+   if( index == mVisibleItems.size() )
+      return;
+
+   // Find the rows following the item's children.
+   S32 end = index + 1;
+   while( end < mVisibleItems.size() && mVisibleItems[end]->mTabLevel > item->mTabLevel )
+      end++;
+
+   Vector<Item*> following;
+   if( end < mVisibleItems.size() )
+      following.increment( &mVisibleItems[end], mVisibleItems.size() - end );
+
+   // Replace the children's rows.
+   mFlags.set( BuildingVisTree, true );
+
+   mVisibleItems.setSize( index + 1 );
+
+   if( item->isExpanded() )
+   {
+      Item *child = item->mChild;
+      while( child )
+      {
+         Item *pChildTemp = child;
+         child = child->mNext;
+
+         buildItem( pChildTemp, item->mTabLevel + 1 );
+      }
+   }
+
+   if( following.size() > 0 )
+      mVisibleItems.increment( following.address(), following.size() );
+
+   // The widest row may have been hidden but the width is only reduced
+   // when the tree is next rebuilt, which saves measuring every row.
+   mCellSize.set(mMaxWidth+1, mItemHeight);
+   setSize(Point2I(1, mVisibleItems.size()));
+   syncSelection();
+
+   mFlags.clear( BuildingVisTree );
+}
+
+//------------------------------------------------------------------------------
+
 bool GuiTreeViewCtrl::scrollVisible( S32 itemId )
 {
    Item* item = getItem(itemId);
@@ -691,12 +752,16 @@ bool GuiTreeViewCtrl::scrollVisible( Item *item )
 {
    // Now, make sure it's visible (ie, all parents expanded)
    Item *parent = item->mParent;
+   bool expandedParent = false;
 
    if( !item->isInspectorData() && item->mState.test(Item::VirtualParent) )
       onVirtualParentExpand(item);
 
    while(parent)
    {
+      if( !parent->isExpanded() )
+         expandedParent = true;
+
       parent->setExpanded(true);
 
       if( !parent->isInspectorData() && parent->mState.test(Item::VirtualParent) )
@@ -715,7 +780,8 @@ bool GuiTreeViewCtrl::scrollVisible( Item *item )
    }
 
    // And now, build the visible tree so we know where we have to scroll.
-   buildVisibleTree();
+   if( expandedParent || mFlags.test( RebuildVisible ) )
+      buildVisibleTree();
 
    // All done, let's figure out where we have to scroll...
    for(S32 i=0; i<mVisibleItems.size(); i++)
@@ -775,11 +841,24 @@ S32 GuiTreeViewCtrl::insertItem(S32 parentId, const char * text, const char * va
    pNewItem->setNormalImage( (S8)normalImage );
    pNewItem->setExpandedImage( (S8)expandedImage );
 
+   // Items are usually added in order so start from the last one added when it is still the last sibling.
+   Item * pParentItem = ( parentId == 0 ) ? NULL : mItems[parentId-1];
+   Item * pLastSibling = NULL;
+   if( mLastInsertedItem != NULL && mLastInsertedItem != pNewItem && mLastInsertedItem->mParent == pParentItem && mLastInsertedItem->mNext == NULL )
+      pLastSibling = mLastInsertedItem;
+
+   mLastInsertedItem = pNewItem;
+
    // root level?
    if(parentId == 0)
    {
       // insert back
-      if( mRoot != NULL )
+      if( pLastSibling != NULL )
+      {
+         pLastSibling->mNext = pNewItem;
+         pNewItem->mPrevious = pLastSibling;
+      }
+      else if( mRoot != NULL )
       {
          Item * pTreeTraverse = mRoot;
          while( pTreeTraverse != NULL && pTreeTraverse->mNext != NULL )
@@ -795,10 +874,13 @@ S32 GuiTreeViewCtrl::insertItem(S32 parentId, const char * text, const char * va
    }
    else if( mItems.size() >= ( parentId - 1 ) )
    {
-      Item * pParentItem = mItems[parentId-1];
-
       // insert back
-      if( pParentItem != NULL && pParentItem->mChild)
+      if( pLastSibling != NULL )
+      {
+         pLastSibling->mNext = pNewItem;
+         pNewItem->mPrevious = pLastSibling;
+      }
+      else if( pParentItem != NULL && pParentItem->mChild)
       {
          Item * pTreeTraverse = pParentItem->mChild;
          while( pTreeTraverse != NULL && pTreeTraverse->mNext != NULL )
@@ -816,10 +898,7 @@ S32 GuiTreeViewCtrl::insertItem(S32 parentId, const char * text, const char * va
          mFlags.set(RebuildVisible);
    }
 
-   //
-   if(mFlags.test(RebuildVisible))
-      buildVisibleTree();
-
+   // The visible tree is rebuilt before the next render so adding many items doesn't rebuild it for each one.
    return pNewItem->mId;
 }
 
@@ -1113,6 +1192,14 @@ bool GuiTreeViewCtrl::onWake()
       mItemHeight = getMax((S32)mFont->getHeight(), (S32)mProfile->mBitmapArrayRects[0].extent.y);
    }
 
+   // The font may have changed so measure the items again.
+   for(S32 i = 0; i < mItems.size(); i++)
+   {
+      if(mItems[i] != NULL)
+         mItems[i]->mDataRenderWidth = -1;
+   }
+   mFlags.set(RebuildVisible);
+
    return true;
 }
 
@@ -1182,7 +1269,7 @@ void GuiTreeViewCtrl::onPreRender()
 
    mTicksPassed++;
 
-   if( mTicksPassed > mTreeRefreshInterval ) 
+   if( mTicksPassed > mTreeRefreshInterval || mFlags.test(RebuildVisible) ) 
    {
       // Update every render in case new objects are added
       buildVisibleTree();
@@ -1688,13 +1775,18 @@ bool GuiTreeViewCtrl::setItemExpanded(S32 itemId, bool expand)
    // expand parents
    if(expand)
    {
-      while(item)
+      Item * parent = item;
+      while(parent)
       {
-         if(item->mState.test(Item::VirtualParent))
-            onVirtualParentExpand(item);
+         // Expanding a collapsed parent shows more than this item's children.
+         if(parent != item && !parent->isExpanded())
+            mFlags.set(RebuildVisible);
 
-         item->setExpanded(true);
-         item = item->mParent;
+         if(parent->mState.test(Item::VirtualParent))
+            onVirtualParentExpand(parent);
+
+         parent->setExpanded(true);
+         parent = parent->mParent;
       }
    }
    else
@@ -1704,6 +1796,8 @@ bool GuiTreeViewCtrl::setItemExpanded(S32 itemId, bool expand)
 
       item->setExpanded(false);
    }
+
+   updateVisibleChildren(item);
    return(true);
 }
 
@@ -2865,6 +2959,7 @@ void GuiTreeViewCtrl::onMouseDown(const GuiEvent & event)
       item->setExpanded(!item->isExpanded());
       if( !item->isInspectorData() && item->mState.test(Item::VirtualParent) )
          onVirtualParentExpand(item);
+      updateVisibleChildren(item);
       scrollVisible(item);
    }
 }
@@ -3181,7 +3276,7 @@ void GuiTreeViewCtrl::onRenderCell(Point2I offset, Point2I cell, bool, bool )
 
    // Ok, now we're off to rendering the actual data for the treeview item.
 
-   U32 bufLen = item->mDataRenderWidth + 1;
+   U32 bufLen = item->getDisplayTextLength() + 1;
    char *displayText = (char *)txtBuff.alloc(bufLen);
    displayText[bufLen-1] = 0;
    item->getDisplayText(bufLen, displayText);
@@ -63,7 +63,7 @@ class GuiTreeViewCtrl : public GuiArrayCtrl
 
          BitSet32                mState;
          SimObjectPtr<GuiControlProfile> mProfile;
-         S16                     mId;
+         S32                     mId;
          U16                     mTabLevel;
          Item *                  mParent;
          Item *                  mChild;
@@ -73,7 +73,7 @@ class GuiTreeViewCtrl : public GuiArrayCtrl
          S32                     mDataRenderWidth; /// this stores the pixel width needed
                                                    /// to render the item's data in the 
                                                    /// onRenderCell function to optimize
-                                                   /// for speed.
+                                                   /// for speed.  -1 until it is measured.
 
 
          Item( GuiControlProfile *pProfile );
@@ -99,7 +99,7 @@ class GuiTreeViewCtrl : public GuiArrayCtrl
          const S8 getExpandedImage() const;
          char *getText();
          char *getValue();
-         inline const S16 getID() const { return mId; };
+         inline const S32 getID() const { return mId; };
          SimObject *getObject();
          const U32 getDisplayTextLength();
          const S32 getDisplayTextWidth(GFont *font);
@@ -244,6 +244,7 @@ public:
                                              ///  we want to be able to recycle
                                              ///  item ids and do some other clever
                                              ///  things.
+      Item *                  mLastInsertedItem; ///< Used to append items without finding the last sibling.
       Item *                  mRoot;
       S32                     mInstantGroup;
       S32                     mMaxWidth;
@@ -297,6 +298,10 @@ protected:
 
       void buildItem(Item * item, U32 tabLevel, bool bForceFullUpdate = false);
 
+      /// Update the rows below an item after it has been expanded or collapsed
+      /// without rebuilding the rest of the visible tree.
+      void updateVisibleChildren(Item * item);
+
       bool hitTest(const Point2I & pnt, Item* & item, BitSet32 & flags);
 
       virtual bool onVirtualParentBuild(Item *item, bool bForceFullUpdate = false);
@@ -0,0 +1,470 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#ifndef _ASYNC_FILE_IO_H_
+#include "io/asyncFileIO.h"
+#endif
+
+#ifndef _PACK_FILE_H_
+#include "io/packFile.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_MUTEX_H_
+#include "platform/threads/mutex.h"
+#endif
+
+#ifndef _PLATFORM_THREAD_SEMAPHORE_H_
+#include "platform/threads/semaphore.h"
+#endif
+
+#ifndef _STRINGTABLE_H_
+#include "string/stringTable.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#include "platform/platformFileIO.h"
+#include "memory/safeDelete.h"
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+struct AsyncFileRequest
+{
+    U32                             mRequestId;
+    StringTableEntry                mFilePath;
+    AsyncFileIO::CompletionCallback mpCallback;
+    void*                           mpContext;
+    Stream*                         mpStream;
+    bool                            mCancelled;
+};
+
+typedef Vector<AsyncFileRequest*> typeAsyncFileRequestVector;
+
+static typeAsyncFileRequestVector   sgQueuedRequests[AsyncFileIO::PriorityCount];
+static typeAsyncFileRequestVector   sgActiveRequests;
+static typeAsyncFileRequestVector   sgCompletedRequests;
+static Mutex*                       sgpRequestMutex = NULL;
+static Semaphore*                   sgpRequestSemaphore = NULL;
+static Thread*                      sgpWorkers[AsyncFileIO::WorkerCount] = { NULL };
+static bool                         sgShutdown = false;
+static U32                          sgNextRequestId = 0;
+
+//-----------------------------------------------------------------------------
+
+static Stream* readFile( StringTableEntry filePath )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AsyncFileIO_ReadFile);
+
+    File file;
+    if ( file.open( filePath, File::Read ) != File::Ok )
+        return NULL;
+
+    // Read the whole file.
+    const U32 size = file.getSize();
+    U8* pData = (U8*)dMalloc( size > 0 ? size : 1 );
+    U32 bytesRead = 0;
+    if ( size > 0 && (file.read( size, (char*)pData, &bytesRead ) != File::Ok || bytesRead != size) )
+    {
+        dFree( pData );
+        return NULL;
+    }
+
+    return new PackFileStream( pData, size, true );
+}
+
+//-----------------------------------------------------------------------------
+
+static AsyncFileRequest* dequeueRequest( void )
+{
+    // Take the oldest request of the highest priority.
+    for ( S32 priority = AsyncFileIO::PriorityCount - 1; priority >= 0; --priority )
+    {
+        typeAsyncFileRequestVector& queue = sgQueuedRequests[priority];
+        if ( queue.size() == 0 )
+            continue;
+
+        AsyncFileRequest* pRequest = queue.front();
+        queue.pop_front();
+        return pRequest;
+    }
+
+    return NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+static void workerThreadFunction( void* )
+{
+    while( true )
+    {
+        // Wait for work.
+        sgpRequestSemaphore->acquire();
+
+        sgpRequestMutex->lock();
+
+        // Finish if shutting down.
+        if ( sgShutdown )
+        {
+            sgpRequestMutex->unlock();
+            return;
+        }
+
+        // Fetch the next request.
+        AsyncFileRequest* pRequest = dequeueRequest();
+        if ( pRequest == NULL )
+        {
+            sgpRequestMutex->unlock();
+            continue;
+        }
+        sgActiveRequests.push_back( pRequest );
+        sgpRequestMutex->unlock();
+
+        // Read the file.
+        Stream* pStream = readFile( pRequest->mFilePath );
+
+        // Publish the request as complete.
+        sgpRequestMutex->lock();
+        pRequest->mpStream = pStream;
+        for ( S32 index = 0; index < sgActiveRequests.size(); ++index )
+        {
+            if ( sgActiveRequests[index] == pRequest )
+            {
+                sgActiveRequests.erase( index );
+                break;
+            }
+        }
+        sgCompletedRequests.push_back( pRequest );
+        sgpRequestMutex->unlock();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static AsyncFileRequest* removeRequest( typeAsyncFileRequestVector& requests, const U32 requestId )
+{
+    for ( S32 index = 0; index < requests.size(); ++index )
+    {
+        AsyncFileRequest* pRequest = requests[index];
+        if ( pRequest->mRequestId != requestId )
+            continue;
+
+        requests.erase( index );
+        return pRequest;
+    }
+
+    return NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+static AsyncFileRequest* findRequest( typeAsyncFileRequestVector& requests, const U32 requestId )
+{
+    for ( S32 index = 0; index < requests.size(); ++index )
+    {
+        if ( requests[index]->mRequestId == requestId )
+            return requests[index];
+    }
+
+    return NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+static void deliverRequest( AsyncFileRequest* pRequest )
+{
+    // Call the callback unless cancelled.
+    if ( pRequest->mCancelled )
+    {
+        SAFE_DELETE( pRequest->mpStream );
+    }
+    else if ( pRequest->mpCallback != NULL )
+    {
+        pRequest->mpCallback( pRequest->mpContext, pRequest->mRequestId, pRequest->mpStream );
+    }
+    else
+    {
+        SAFE_DELETE( pRequest->mpStream );
+    }
+
+    delete pRequest;
+}
+
+//-----------------------------------------------------------------------------
+
+static AsyncFileRequest* createRequest( AsyncFileIO::CompletionCallback pCallback, void* pContext )
+{
+    // Start the workers on first use.
+    if ( sgpRequestMutex == NULL )
+    {
+        sgShutdown = false;
+        sgpRequestMutex = new Mutex();
+        sgpRequestSemaphore = new Semaphore( 0 );
+        for ( U32 index = 0; index < AsyncFileIO::WorkerCount; ++index )
+            sgpWorkers[index] = new Thread( workerThreadFunction, NULL, true );
+    }
+
+    AsyncFileRequest* pRequest = new AsyncFileRequest();
+    pRequest->mRequestId = 0;
+    pRequest->mFilePath = StringTable->EmptyString;
+    pRequest->mpCallback = pCallback;
+    pRequest->mpContext = pContext;
+    pRequest->mpStream = NULL;
+    pRequest->mCancelled = false;
+
+    return pRequest;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 AsyncFileIO::read( const char* pFilePath, const Priority priority, CompletionCallback pCallback, void* pContext )
+{
+    // Sanity!
+    AssertFatal( pFilePath != NULL, "AsyncFileIO::read() - Cannot read a NULL file-path." );
+    AssertFatal( priority >= PriorityLow && priority < PriorityCount, "AsyncFileIO::read() - Invalid priority." );
+
+    AsyncFileRequest* pRequest = createRequest( pCallback, pContext );
+    pRequest->mFilePath = StringTable->insert( pFilePath );
+
+    // Queue the request.
+    sgpRequestMutex->lock();
+    pRequest->mRequestId = ++sgNextRequestId;
+    sgQueuedRequests[priority].push_back( pRequest );
+    sgpRequestMutex->unlock();
+    sgpRequestSemaphore->release();
+
+    return pRequest->mRequestId;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 AsyncFileIO::complete( Stream* pStream, CompletionCallback pCallback, void* pContext )
+{
+    AsyncFileRequest* pRequest = createRequest( pCallback, pContext );
+    pRequest->mpStream = pStream;
+
+    // Queue the request as completed.
+    sgpRequestMutex->lock();
+    pRequest->mRequestId = ++sgNextRequestId;
+    sgCompletedRequests.push_back( pRequest );
+    sgpRequestMutex->unlock();
+
+    return pRequest->mRequestId;
+}
+
+//-----------------------------------------------------------------------------
+
+AsyncFileIO::Status AsyncFileIO::getStatus( const U32 requestId )
+{
+    // Finish if nothing has been requested.
+    if ( sgpRequestMutex == NULL )
+        return StatusUnknown;
+
+    Status status = StatusUnknown;
+
+    sgpRequestMutex->lock();
+    AsyncFileRequest* pRequest = findRequest( sgCompletedRequests, requestId );
+    if ( pRequest != NULL )
+    {
+        status = pRequest->mpStream != NULL ? StatusComplete : StatusFailed;
+    }
+    else if ( findRequest( sgActiveRequests, requestId ) != NULL )
+    {
+        status = StatusPending;
+    }
+    else
+    {
+        for ( U32 priority = 0; priority < PriorityCount; ++priority )
+        {
+            if ( findRequest( sgQueuedRequests[priority], requestId ) != NULL )
+            {
+                status = StatusPending;
+                break;
+            }
+        }
+    }
+    sgpRequestMutex->unlock();
+
+    return status;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AsyncFileIO::cancel( const U32 requestId )
+{
+    // Finish if nothing has been requested.
+    if ( sgpRequestMutex == NULL )
+        return false;
+
+    bool found = false;
+
+    sgpRequestMutex->lock();
+
+    // Remove the request if it has not started.
+    for ( U32 priority = 0; priority < PriorityCount && !found; ++priority )
+    {
+        AsyncFileRequest* pRequest = removeRequest( sgQueuedRequests[priority], requestId );
+        if ( pRequest != NULL )
+        {
+            delete pRequest;
+            found = true;
+        }
+    }
+
+    // Flag the request as cancelled if it has started.
+    if ( !found )
+    {
+        AsyncFileRequest* pRequest = findRequest( sgActiveRequests, requestId );
+        if ( pRequest == NULL )
+            pRequest = findRequest( sgCompletedRequests, requestId );
+
+        if ( pRequest != NULL )
+        {
+            pRequest->mCancelled = true;
+            found = true;
+        }
+    }
+
+    sgpRequestMutex->unlock();
+
+    return found;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AsyncFileIO::finish( const U32 requestId )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AsyncFileIO_Finish);
+
+    // Finish if nothing has been requested.
+    if ( sgpRequestMutex == NULL )
+        return false;
+
+    while( true )
+    {
+        sgpRequestMutex->lock();
+
+        // Has the request completed?
+        AsyncFileRequest* pRequest = removeRequest( sgCompletedRequests, requestId );
+        if ( pRequest != NULL )
+        {
+            // Yes, so deliver it.
+            sgpRequestMutex->unlock();
+            deliverRequest( pRequest );
+            return true;
+        }
+
+        // Has the request not started?
+        for ( U32 priority = 0; priority < PriorityCount && pRequest == NULL; ++priority )
+            pRequest = removeRequest( sgQueuedRequests[priority], requestId );
+
+        if ( pRequest != NULL )
+        {
+            // Yes, so read it here rather than waiting for a worker.
+            sgpRequestMutex->unlock();
+            pRequest->mpStream = readFile( pRequest->mFilePath );
+            deliverRequest( pRequest );
+            return true;
+        }
+
+        // Finish if the request is unknown.
+        const bool active = findRequest( sgActiveRequests, requestId ) != NULL;
+        sgpRequestMutex->unlock();
+        if ( !active )
+            return false;
+
+        // Wait for the worker to finish the request.
+        Platform::sleep( 1 );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void AsyncFileIO::processCompletions( void )
+{
+    // Finish if nothing has been requested.
+    if ( sgpRequestMutex == NULL )
+        return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(AsyncFileIO_ProcessCompletions);
+
+    // Take the completed requests.
+    // NOTE: The callbacks are called without the lock so they can make further requests.
+    typeAsyncFileRequestVector completedRequests;
+    sgpRequestMutex->lock();
+    completedRequests = sgCompletedRequests;
+    sgCompletedRequests.clear();
+    sgpRequestMutex->unlock();
+
+    for ( S32 index = 0; index < completedRequests.size(); ++index )
+        deliverRequest( completedRequests[index] );
+}
+
+//-----------------------------------------------------------------------------
+
+void AsyncFileIO::shutdown( void )
+{
+    // Finish if the workers aren't running.
+    if ( sgpRequestMutex == NULL )
+        return;
+
+    // Stop the workers.
+    sgpRequestMutex->lock();
+    sgShutdown = true;
+    sgpRequestMutex->unlock();
+    for ( U32 index = 0; index < WorkerCount; ++index )
+        sgpRequestSemaphore->release();
+    for ( U32 index = 0; index < WorkerCount; ++index )
+    {
+        SAFE_DELETE( sgpWorkers[index] );
+    }
+
+    // Discard any outstanding requests.
+    for ( U32 priority = 0; priority < PriorityCount; ++priority )
+    {
+        for ( S32 index = 0; index < sgQueuedRequests[priority].size(); ++index )
+            delete sgQueuedRequests[priority][index];
+        sgQueuedRequests[priority].clear();
+    }
+    for ( S32 index = 0; index < sgCompletedRequests.size(); ++index )
+    {
+        delete sgCompletedRequests[index]->mpStream;
+        delete sgCompletedRequests[index];
+    }
+    sgCompletedRequests.clear();
+    sgActiveRequests.clear();
+
+    SAFE_DELETE( sgpRequestMutex );
+    SAFE_DELETE( sgpRequestSemaphore );
+}
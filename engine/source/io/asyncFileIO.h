@@ -0,0 +1,108 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#ifndef _ASYNC_FILE_IO_H_
+#define _ASYNC_FILE_IO_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+class Stream;
+
+//-----------------------------------------------------------------------------
+
+/// Reads files on background worker threads and hands the results back on the main thread.
+///
+/// Each read is given a priority; higher priority reads are started first and reads of the
+/// same priority are started in the order they were requested.  When a read finishes its file
+/// is held in memory until processCompletions() (called each frame) calls its completion
+/// callback with a stream onto the data.  The callback owns the stream and must delete it.
+/// The stream is NULL if the file could not be read.
+///
+/// @code
+/// static void onFileRead( void* pContext, const U32 requestId, Stream* pStream )
+/// {
+///     if ( pStream == NULL )
+///         return;
+///
+///     static_cast<MyLoader*>(pContext)->load( *pStream );
+///     delete pStream;
+/// }
+///
+/// AsyncFileIO::read( pFilePath, AsyncFileIO::PriorityNormal, onFileRead, this );
+/// @endcode
+///
+/// ResManager::openStreamAsync() resolves files through the resource manager first so that
+/// files in zips and packs can be read the same way.
+class AsyncFileIO
+{
+public:
+    enum Priority
+    {
+        PriorityLow,
+        PriorityNormal,
+        PriorityHigh,
+
+        PriorityCount
+    };
+
+    enum Status
+    {
+        StatusUnknown,
+        StatusPending,
+        StatusComplete,
+        StatusFailed,
+    };
+
+    typedef void (*CompletionCallback)( void* pContext, const U32 requestId, Stream* pStream );
+
+    /// Queue a file to be read.
+    /// @return The request Id.
+    static U32 read( const char* pFilePath, const Priority priority, CompletionCallback pCallback, void* pContext );
+
+    /// Queue a stream that is already available so that it is delivered like a completed read.
+    /// @return The request Id.
+    static U32 complete( Stream* pStream, CompletionCallback pCallback, void* pContext );
+
+    /// Get the status of a request.  Requests are unknown once their callback has been called.
+    static Status getStatus( const U32 requestId );
+
+    /// Cancel a request.  Its callback is not called.
+    /// @return Whether the request was found.
+    static bool cancel( const U32 requestId );
+
+    /// Wait for a request to finish, reading it on the calling thread if it has not started, then call its callback.
+    /// @return Whether the request was found.
+    static bool finish( const U32 requestId );
+
+    /// Call the callbacks of the finished requests.  This must be called on the main thread.
+    static void processCompletions( void );
+
+    /// Stop the worker threads.  Any requests not yet delivered are discarded.
+    static void shutdown( void );
+
+    enum { WorkerCount = 2 };
+};
+
+#endif // _ASYNC_FILE_IO_H_
@@ -212,17 +212,41 @@ void BitStream::writeBits(S32 bitCount, const void *bitPtr)
       return;
    }
 
-   // [tom, 8/17/2006] This is probably a lot lamer then it needs to be. However,
-   // at least it doesnt clobber data or overrun the buffer like the old code did.
    const U8 *ptr = (U8 *)bitPtr;
 
-   for(S32 srcBitNum = 0;srcBitNum < bitCount;srcBitNum++)
+   // Byte aligned so copy the whole bytes directly.
+   if((bitNum & 0x7) == 0)
    {
-      if((*(ptr + (srcBitNum >> 3)) & (1 << (srcBitNum & 0x7))) != 0)
-         *(dataPtr + (bitNum >> 3)) |= (1 << (bitNum & 0x7));
-      else
-         *(dataPtr + (bitNum >> 3)) &= ~(1 << (bitNum & 0x7));
-      bitNum++;
+      const S32 byteCount = bitCount >> 3;
+      dMemcpy(dataPtr + (bitNum >> 3), ptr, byteCount);
+      bitNum += byteCount << 3;
+      ptr += byteCount;
+      bitCount &= 0x7;
+   }
+
+   // Merge up to 32 source bits at a time into the destination through a 64-bit accumulator,
+   // only touching the destination bits being written (as the old bit-at-a-time loop did).
+   while(bitCount > 0)
+   {
+      const S32 chunkBits = getMin(bitCount, 32);
+      const S32 shift = bitNum & 0x7;
+
+      U64 bits = 0;
+      const S32 srcBytes = (chunkBits + 7) >> 3;
+      for(S32 i = 0; i < srcBytes; i++)
+         bits |= U64(ptr[i]) << (i << 3);
+
+      const U64 mask = ((U64(1) << chunkBits) - 1) << shift;
+      bits = (bits << shift) & mask;
+
+      U8 *dstPtr = dataPtr + (bitNum >> 3);
+      const S32 dstBytes = (shift + chunkBits + 7) >> 3;
+      for(S32 i = 0; i < dstBytes; i++)
+         dstPtr[i] = (dstPtr[i] & ~U8(mask >> (i << 3))) | U8(bits >> (i << 3));
+
+      ptr += 4;
+      bitNum += chunkBits;
+      bitCount -= chunkBits;
    }
 }
 
@@ -266,23 +290,41 @@ void BitStream::readBits(S32 bitCount, void *bitPtr)
       AssertWarn(false, "Out of range read");
       return;
    }
-   U8 *stPtr = dataPtr + (bitNum >> 3);
-   S32 byteCount = (bitCount + 7) >> 3;
-
    U8 *ptr = (U8 *) bitPtr;
 
-   S32 downShift = bitNum & 0x7;
-   S32 upShift = 8 - downShift;
-
-   U8 curB = *stPtr;
-   while(byteCount--)
+   // Byte aligned so copy the whole bytes directly.
+   if((bitNum & 0x7) == 0)
    {
-      U8 nextB = *++stPtr;
-      *ptr++ = (curB >> downShift) | (nextB << upShift);
-      curB = nextB;
+      const S32 byteCount = bitCount >> 3;
+      dMemcpy(ptr, dataPtr + (bitNum >> 3), byteCount);
+      bitNum += byteCount << 3;
+      ptr += byteCount;
+      bitCount &= 0x7;
    }
 
-   bitNum += bitCount;
+   // Extract up to 32 bits at a time through a 64-bit accumulator.  Only the bytes holding
+   // the bits being read are touched and any unused bits of the last output byte are zero.
+   while(bitCount > 0)
+   {
+      const S32 chunkBits = getMin(bitCount, 32);
+      const S32 shift = bitNum & 0x7;
+
+      const U8 *srcPtr = dataPtr + (bitNum >> 3);
+      const S32 srcBytes = (shift + chunkBits + 7) >> 3;
+      U64 bits = 0;
+      for(S32 i = 0; i < srcBytes; i++)
+         bits |= U64(srcPtr[i]) << (i << 3);
+
+      bits = (bits >> shift) & ((U64(1) << chunkBits) - 1);
+
+      const S32 dstBytes = (chunkBits + 7) >> 3;
+      for(S32 i = 0; i < dstBytes; i++)
+         ptr[i] = U8(bits >> (i << 3));
+
+      ptr += 4;
+      bitNum += chunkBits;
+      bitCount -= chunkBits;
+   }
 }
 
 bool BitStream::_read(U32 size, void *dataPtr)
@@ -335,6 +377,170 @@ F32 BitStream::readSignedFloat(S32 bitCount)
    return readInt(bitCount) * 2 / F32((1 << bitCount) - 1) - 1.0f;
 }
 
+// Bits are packed a block at a time so the stream sees one write per block rather than one per value.
+#define BITSTREAM_PACK_BLOCK_SIZE   64
+
+void BitStream::writeInts(const U32 *values, U32 count, S32 bitCount)
+{
+   AssertFatal(bitCount > 0 && bitCount <= 32, "BitStream::writeInts() - Invalid bit count.");
+
+   const U64 mask = (U64(1) << bitCount) - 1;
+   U8 block[BITSTREAM_PACK_BLOCK_SIZE];
+   U32 blockBytes = 0;
+   U64 bits = 0;
+   S32 bitsHeld = 0;
+
+   for(U32 i = 0; i < count; i++)
+   {
+      bits |= (U64(values[i]) & mask) << bitsHeld;
+      bitsHeld += bitCount;
+
+      // Move the whole bytes into the block, writing it once full.
+      while(bitsHeld >= 8)
+      {
+         block[blockBytes++] = U8(bits);
+         bits >>= 8;
+         bitsHeld -= 8;
+
+         if(blockBytes == BITSTREAM_PACK_BLOCK_SIZE)
+         {
+            writeBits(BITSTREAM_PACK_BLOCK_SIZE << 3, block);
+            blockBytes = 0;
+         }
+      }
+   }
+
+   // Write what's left including any partial byte.
+   block[blockBytes] = U8(bits);
+   writeBits((blockBytes << 3) + bitsHeld, block);
+}
+
+void BitStream::readInts(U32 *values, U32 count, S32 bitCount)
+{
+   AssertFatal(bitCount > 0 && bitCount <= 32, "BitStream::readInts() - Invalid bit count.");
+
+   const U64 mask = (U64(1) << bitCount) - 1;
+   U8 block[BITSTREAM_PACK_BLOCK_SIZE];
+   U32 blockBytes = 0;
+   U32 blockIndex = 0;
+   U32 bitsRemaining = count * bitCount;
+   U64 bits = 0;
+   S32 bitsHeld = 0;
+
+   for(U32 i = 0; i < count; i++)
+   {
+      // Refill from the block, reading the next block once it's used.
+      // NOTE: Only the final block can end in a partial byte and its unused bits are never consumed.
+      while(bitsHeld < bitCount)
+      {
+         if(blockIndex == blockBytes)
+         {
+            const U32 blockBits = getMin(bitsRemaining, U32(BITSTREAM_PACK_BLOCK_SIZE << 3));
+            readBits(blockBits, block);
+            blockBytes = (blockBits + 7) >> 3;
+            blockIndex = 0;
+            bitsRemaining -= blockBits;
+         }
+
+         bits |= U64(block[blockIndex++]) << bitsHeld;
+         bitsHeld += 8;
+      }
+
+      values[i] = U32(bits & mask);
+      bits >>= bitCount;
+      bitsHeld -= bitCount;
+   }
+}
+
+void BitStream::writeFloats(const F32 *values, U32 count, S32 bitCount)
+{
+   U32 quantized[BITSTREAM_PACK_BLOCK_SIZE];
+   const F32 scale = F32((1 << bitCount) - 1);
+
+   for(U32 first = 0; first < count; first += BITSTREAM_PACK_BLOCK_SIZE)
+   {
+      const U32 blockCount = getMin(count - first, U32(BITSTREAM_PACK_BLOCK_SIZE));
+      for(U32 i = 0; i < blockCount; i++)
+         quantized[i] = U32(S32(values[first + i] * scale));
+      writeInts(quantized, blockCount, bitCount);
+   }
+}
+
+void BitStream::readFloats(F32 *values, U32 count, S32 bitCount)
+{
+   U32 quantized[BITSTREAM_PACK_BLOCK_SIZE];
+   const F32 scale = F32((1 << bitCount) - 1);
+
+   for(U32 first = 0; first < count; first += BITSTREAM_PACK_BLOCK_SIZE)
+   {
+      const U32 blockCount = getMin(count - first, U32(BITSTREAM_PACK_BLOCK_SIZE));
+      readInts(quantized, blockCount, bitCount);
+      for(U32 i = 0; i < blockCount; i++)
+         values[first + i] = S32(quantized[i]) / scale;
+   }
+}
+
+void BitStream::writeSignedFloats(const F32 *values, U32 count, S32 bitCount)
+{
+   U32 quantized[BITSTREAM_PACK_BLOCK_SIZE];
+   const S32 scale = (1 << bitCount) - 1;
+
+   for(U32 first = 0; first < count; first += BITSTREAM_PACK_BLOCK_SIZE)
+   {
+      const U32 blockCount = getMin(count - first, U32(BITSTREAM_PACK_BLOCK_SIZE));
+      for(U32 i = 0; i < blockCount; i++)
+         quantized[i] = U32(S32(((values[first + i] + 1) * .5) * scale));
+      writeInts(quantized, blockCount, bitCount);
+   }
+}
+
+void BitStream::readSignedFloats(F32 *values, U32 count, S32 bitCount)
+{
+   U32 quantized[BITSTREAM_PACK_BLOCK_SIZE];
+   const F32 scale = F32((1 << bitCount) - 1);
+
+   for(U32 first = 0; first < count; first += BITSTREAM_PACK_BLOCK_SIZE)
+   {
+      const U32 blockCount = getMin(count - first, U32(BITSTREAM_PACK_BLOCK_SIZE));
+      readInts(quantized, blockCount, bitCount);
+      for(U32 i = 0; i < blockCount; i++)
+         values[first + i] = S32(quantized[i]) * 2 / scale - 1.0f;
+   }
+}
+
+void BitStream::writeRangedF32s(const F32 *values, U32 count, F32 min, F32 max, U32 numBits)
+{
+   U32 quantized[BITSTREAM_PACK_BLOCK_SIZE];
+
+   for(U32 first = 0; first < count; first += BITSTREAM_PACK_BLOCK_SIZE)
+   {
+      const U32 blockCount = getMin(count - first, U32(BITSTREAM_PACK_BLOCK_SIZE));
+      for(U32 i = 0; i < blockCount; i++)
+      {
+         const F32 value = ( mClampF( values[first + i], min, max ) - min ) / ( max - min );
+         quantized[i] = U32(S32(value * ( (1 << numBits) - 1 )));
+      }
+      writeInts(quantized, blockCount, numBits);
+   }
+}
+
+void BitStream::readRangedF32s(F32 *values, U32 count, F32 min, F32 max, U32 numBits)
+{
+   U32 quantized[BITSTREAM_PACK_BLOCK_SIZE];
+
+   for(U32 first = 0; first < count; first += BITSTREAM_PACK_BLOCK_SIZE)
+   {
+      const U32 blockCount = getMin(count - first, U32(BITSTREAM_PACK_BLOCK_SIZE));
+      readInts(quantized, blockCount, numBits);
+      for(U32 i = 0; i < blockCount; i++)
+      {
+         F32 value = (F32)S32(quantized[i]);
+         value /= F32( ( 1 << numBits ) - 1 );
+         values[first + i] = min + value * ( max - min );
+      }
+   }
+}
+
 void BitStream::writeSignedInt(S32 value, S32 bitCount)
 {
    if(writeFlag(value < 0))
@@ -126,6 +126,11 @@ public:
    void writeSignedInt(S32 value, S32 bitCount);
    S32  readSignedInt(S32 bitCount);
 
+   /// Writes and reads an array of unsigned integers of the given bit count.
+   /// The values are packed in blocks so the bits are identical to calling writeInt for each.
+   void writeInts(const U32 *values, U32 count, S32 bitCount);
+   void readInts(U32 *values, U32 count, S32 bitCount);
+
    void writeRangedU32(U32 value, U32 rangeStart, U32 rangeEnd);
    U32  readRangedU32(U32 rangeStart, U32 rangeEnd);
    
@@ -144,6 +149,12 @@ public:
    void writeFloat(F32 f, S32 bitCount);
    void writeSignedFloat(F32 f, S32 bitCount);
 
+   /// Array versions of the float reads and writes, bit identical to their single value versions.
+   void readFloats(F32 *values, U32 count, S32 bitCount);
+   void readSignedFloats(F32 *values, U32 count, S32 bitCount);
+   void writeFloats(const F32 *values, U32 count, S32 bitCount);
+   void writeSignedFloats(const F32 *values, U32 count, S32 bitCount);
+
    /// Writes a clamped floating point value to the 
    /// stream with the desired bits of precision.
    void writeRangedF32( F32 value, F32 min, F32 max, U32 numBits );
@@ -151,6 +162,10 @@ public:
    /// Reads a ranged floating point value written with writeRangedF32.
    F32 readRangedF32( F32 min, F32 max, U32 numBits );
 
+   /// Array versions of writeRangedF32 and readRangedF32.
+   void writeRangedF32s( const F32 *values, U32 count, F32 min, F32 max, U32 numBits );
+   void readRangedF32s( F32 *values, U32 count, F32 min, F32 max, U32 numBits );
+
    void writeClassId(U32 classId, U32 classType, U32 classGroup);
    S32 readClassId(U32 classType, U32 classGroup); // returns -1 if the class type is out of range
 
@@ -0,0 +1,406 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#ifndef _DIRECTORY_SCAN_CACHE_H_
+#include "io/directoryScanCache.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+#define DIRECTORY_SCAN_CACHE_SIGNATURE  "DirectoryScanCache"
+#define DIRECTORY_SCAN_CACHE_VERSION    1
+#define DIRECTORY_SCAN_CACHE_MAX_STRING 1023
+
+//-----------------------------------------------------------------------------
+
+static StringTableEntry readCacheString( Stream& stream )
+{
+    char stringBuffer[DIRECTORY_SCAN_CACHE_MAX_STRING+1];
+    stringBuffer[0] = 0;
+    stream.readLongString( DIRECTORY_SCAN_CACHE_MAX_STRING, stringBuffer );
+    return StringTable->insert( stringBuffer );
+}
+
+//-----------------------------------------------------------------------------
+
+bool DirectoryScanCache::load( const char* pCacheFilePath )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(DirectoryScanCache_Load);
+
+    // Sanity!
+    AssertFatal( pCacheFilePath != NULL, "Cannot load directory scan cache using a NULL file-path." );
+
+    // Remove any existing scans.
+    clear();
+
+    // Expand the file-path.
+    char filePathBuffer[1024];
+    Con::expandPath( filePathBuffer, sizeof(filePathBuffer), pCacheFilePath );
+
+    // Finish if there is no cache yet.
+    FileStream stream;
+    if ( !stream.open( filePathBuffer, FileStream::Read ) )
+        return false;
+
+    // Is the signature and version correct?
+    U32 versionId = 0;
+    if ( stream.readSTString( true ) != StringTable->insert( DIRECTORY_SCAN_CACHE_SIGNATURE, true ) || !stream.read( &versionId ) || versionId != DIRECTORY_SCAN_CACHE_VERSION )
+    {
+        // No, so ignore the cache.
+        Con::warnf( "Directory Scan Cache: Ignoring cache file '%s' as it is not a compatible cache.", filePathBuffer );
+        return false;
+    }
+
+    // Read the scans.
+    if ( !read( stream ) )
+    {
+        // Warn.
+        Con::warnf( "Directory Scan Cache: Ignoring cache file '%s' as it is corrupt.", filePathBuffer );
+        return false;
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool DirectoryScanCache::save( const char* pCacheFilePath )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(DirectoryScanCache_Save);
+
+    // Sanity!
+    AssertFatal( pCacheFilePath != NULL, "Cannot save directory scan cache using a NULL file-path." );
+
+    // Expand the file-path.
+    char filePathBuffer[1024];
+    Con::expandPath( filePathBuffer, sizeof(filePathBuffer), pCacheFilePath );
+
+    FileStream stream;
+
+    // File open for write?
+    if ( !stream.open( filePathBuffer, FileStream::Write ) )
+    {
+        // No, so warn.
+        Con::warnf( "Directory Scan Cache: Could not open cache file '%s' for write.", filePathBuffer );
+        return false;
+    }
+
+    // Write the signature, version and scans.
+    stream.writeString( DIRECTORY_SCAN_CACHE_SIGNATURE );
+    stream.write( (U32)DIRECTORY_SCAN_CACHE_VERSION );
+    write( stream );
+
+    // Close the stream.
+    stream.close();
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool DirectoryScanCache::read( Stream& stream )
+{
+    // Remove any existing scans.
+    clear();
+
+    // Read the scan count.
+    U32 scanCount = 0;
+    stream.read( &scanCount );
+
+    // Read the scans.
+    for ( U32 scanIndex = 0; scanIndex < scanCount && stream.getStatus() == Stream::Ok; ++scanIndex )
+    {
+        Scan* pScan = new Scan();
+
+        StringTableEntry scanKey = readCacheString( stream );
+
+        U32 directoryCount = 0;
+        stream.read( &directoryCount );
+        for ( U32 index = 0; index < directoryCount && stream.getStatus() == Stream::Ok; ++index )
+        {
+            FileTime directoryTime;
+            pScan->mDirectories.push_back( readCacheString( stream ) );
+            stream.read( sizeof(FileTime), &directoryTime );
+            pScan->mDirectoryTimes.push_back( directoryTime );
+        }
+
+        U32 fileCount = 0;
+        stream.read( &fileCount );
+        for ( U32 index = 0; index < fileCount && stream.getStatus() == Stream::Ok; ++index )
+        {
+            U32 fileSize = 0;
+            pScan->mFilePaths.push_back( readCacheString( stream ) );
+            pScan->mFileNames.push_back( readCacheString( stream ) );
+            stream.read( &fileSize );
+            pScan->mFileSizes.push_back( fileSize );
+        }
+
+        mScans.insert( scanKey, pScan );
+    }
+
+    // Was the cache read completely?
+    if ( stream.getStatus() != Stream::Ok && stream.getStatus() != Stream::EOS )
+    {
+        // No, so discard it.
+        clear();
+        return false;
+    }
+
+    mDirty = false;
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void DirectoryScanCache::write( Stream& stream )
+{
+    // Write the scan count.
+    stream.write( (U32)mScans.size() );
+
+    // Write the scans.
+    for( typeScanHash::iterator scanItr = mScans.begin(); scanItr != mScans.end(); ++scanItr )
+    {
+        const Scan* pScan = scanItr->value;
+
+        stream.writeLongString( DIRECTORY_SCAN_CACHE_MAX_STRING, scanItr->key );
+
+        stream.write( (U32)pScan->mDirectories.size() );
+        for ( U32 index = 0; index < (U32)pScan->mDirectories.size(); ++index )
+        {
+            stream.writeLongString( DIRECTORY_SCAN_CACHE_MAX_STRING, pScan->mDirectories[index] );
+            stream.write( sizeof(FileTime), &pScan->mDirectoryTimes[index] );
+        }
+
+        stream.write( (U32)pScan->mFilePaths.size() );
+        for ( U32 index = 0; index < (U32)pScan->mFilePaths.size(); ++index )
+        {
+            stream.writeLongString( DIRECTORY_SCAN_CACHE_MAX_STRING, pScan->mFilePaths[index] );
+            stream.writeLongString( DIRECTORY_SCAN_CACHE_MAX_STRING, pScan->mFileNames[index] );
+            stream.write( pScan->mFileSizes[index] );
+        }
+    }
+
+    // Flag as not dirty.
+    mDirty = false;
+}
+
+//-----------------------------------------------------------------------------
+
+void DirectoryScanCache::clear( void )
+{
+    // Delete the scans.
+    for( typeScanHash::iterator scanItr = mScans.begin(); scanItr != mScans.end(); ++scanItr )
+        delete scanItr->value;
+
+    mScans.clear();
+    mDirty = false;
+}
+
+//-----------------------------------------------------------------------------
+
+bool DirectoryScanCache::dumpPath( const char* pPath, Vector<Platform::FileInfo>& files, const S32 depth, bool* pCached )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(DirectoryScanCache_DumpPath);
+
+    // Sanity!
+    AssertFatal( pPath != NULL, "Cannot dump a NULL path." );
+
+    if ( pCached != NULL )
+        *pCached = false;
+
+    // Fetch the scan key.
+    StringTableEntry scanKey = getScanKey( 'f', pPath, depth );
+
+    // Is the scan cached?
+    Scan* pScan = findScan( scanKey );
+    if ( pScan != NULL )
+    {
+        // Yes, so use the cached files.
+        for ( U32 index = 0; index < (U32)pScan->mFilePaths.size(); ++index )
+        {
+            Platform::FileInfo fileInfo;
+            fileInfo.pFullPath = pScan->mFilePaths[index];
+            fileInfo.pFileName = pScan->mFileNames[index];
+            fileInfo.fileSize = pScan->mFileSizes[index];
+            files.push_back( fileInfo );
+        }
+
+        if ( pCached != NULL )
+            *pCached = true;
+
+        return true;
+    }
+
+    // Find the directories so they can be checked for changes later.
+    // NOTE: The files are found afterwards so any change whilst scanning is seen next time.
+    Vector<StringTableEntry> directories;
+    const bool cacheable = Platform::dumpDirectories( pPath, directories, depth );
+    if ( cacheable )
+        pScan = createScan( scanKey, directories );
+
+    // Find the files.
+    const S32 startIndex = files.size();
+    if ( !Platform::dumpPath( pPath, files, depth ) )
+        return false;
+
+    // Finish if the scan cannot be cached.
+    if ( pScan == NULL )
+        return true;
+
+    // Store the files.
+    for ( S32 index = startIndex; index < files.size(); ++index )
+    {
+        const Platform::FileInfo& fileInfo = files[index];
+        pScan->mFilePaths.push_back( StringTable->insert( fileInfo.pFullPath ) );
+        pScan->mFileNames.push_back( StringTable->insert( fileInfo.pFileName ) );
+        pScan->mFileSizes.push_back( fileInfo.fileSize );
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool DirectoryScanCache::dumpDirectories( const char* pPath, Vector<StringTableEntry>& directories, const S32 depth )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(DirectoryScanCache_DumpDirectories);
+
+    // Sanity!
+    AssertFatal( pPath != NULL, "Cannot dump a NULL path." );
+
+    // Fetch the scan key.
+    StringTableEntry scanKey = getScanKey( 'd', pPath, depth );
+
+    // Is the scan cached?
+    Scan* pScan = findScan( scanKey );
+    if ( pScan != NULL )
+    {
+        // Yes, so use the cached directories.
+        for ( U32 index = 0; index < (U32)pScan->mDirectories.size(); ++index )
+            directories.push_back( pScan->mDirectories[index] );
+
+        return true;
+    }
+
+    // Find the directories.
+    Vector<StringTableEntry> foundDirectories;
+    if ( !Platform::dumpDirectories( pPath, foundDirectories, depth ) )
+        return false;
+
+    // Cache the scan.
+    createScan( scanKey, foundDirectories );
+
+    for ( U32 index = 0; index < (U32)foundDirectories.size(); ++index )
+        directories.push_back( foundDirectories[index] );
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+DirectoryScanCache::Scan* DirectoryScanCache::findScan( StringTableEntry scanKey )
+{
+    // Find the scan.
+    typeScanHash::iterator scanItr = mScans.find( scanKey );
+
+    // Finish if there's no scan.
+    if ( scanItr == mScans.end() )
+        return NULL;
+
+    Scan* pScan = scanItr->value;
+
+    // Finish if any of the directories have changed.
+    for ( U32 index = 0; index < (U32)pScan->mDirectories.size(); ++index )
+    {
+        FileTime directoryTime;
+        if ( !Platform::getFileTimes( pScan->mDirectories[index], NULL, &directoryTime ) || Platform::compareFileTimes( directoryTime, pScan->mDirectoryTimes[index] ) != 0 )
+            return NULL;
+    }
+
+    return pScan;
+}
+
+//-----------------------------------------------------------------------------
+
+DirectoryScanCache::Scan* DirectoryScanCache::createScan( StringTableEntry scanKey, const Vector<StringTableEntry>& directories )
+{
+    Scan* pScan = new Scan();
+
+    // Store the directories and their modified times.
+    for ( U32 index = 0; index < (U32)directories.size(); ++index )
+    {
+        FileTime directoryTime;
+
+        // Don't cache the scan if a directory has no modified time.
+        if ( !Platform::getFileTimes( directories[index], NULL, &directoryTime ) )
+        {
+            delete pScan;
+            return NULL;
+        }
+
+        pScan->mDirectories.push_back( directories[index] );
+        pScan->mDirectoryTimes.push_back( directoryTime );
+    }
+
+    // Replace any existing scan.
+    typeScanHash::iterator scanItr = mScans.find( scanKey );
+    if ( scanItr != mScans.end() )
+    {
+        delete scanItr->value;
+        scanItr->value = pScan;
+    }
+    else
+    {
+        mScans.insert( scanKey, pScan );
+    }
+
+    // Flag as dirty.
+    mDirty = true;
+
+    return pScan;
+}
+
+//-----------------------------------------------------------------------------
+
+StringTableEntry DirectoryScanCache::getScanKey( const char type, const char* pPath, const S32 depth )
+{
+    char keyBuffer[1024];
+    dSprintf( keyBuffer, sizeof(keyBuffer), "%c%d:%s", type, depth, pPath );
+    return StringTable->insert( keyBuffer );
+}
@@ -0,0 +1,97 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#ifndef _DIRECTORY_SCAN_CACHE_H_
+#define _DIRECTORY_SCAN_CACHE_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
+class Stream;
+
+//-----------------------------------------------------------------------------
+
+/// Holds the results of directory scans so that unchanged directories don't need walking again.
+///
+/// Each scan records the directories it walked along with their modified times.  Adding, removing
+/// or renaming an entry changes the modified time of its directory so, whilst none of them have
+/// changed, the files and directories found by the previous scan are returned without walking.
+/// Changes to the contents of existing files are not detected so callers needing them should
+/// still check the modified time of each file.
+class DirectoryScanCache
+{
+private:
+    struct Scan
+    {
+        Vector<StringTableEntry>    mDirectories;
+        Vector<FileTime>            mDirectoryTimes;
+        Vector<StringTableEntry>    mFilePaths;
+        Vector<StringTableEntry>    mFileNames;
+        Vector<U32>                 mFileSizes;
+    };
+
+    typedef HashMap<StringTableEntry, Scan*> typeScanHash;
+
+    typeScanHash    mScans;
+    bool            mDirty;
+
+public:
+    DirectoryScanCache() : mDirty( false ) {}
+    virtual ~DirectoryScanCache() { clear(); }
+
+    /// Load the cache from a file.  Any existing scans are removed.
+    bool load( const char* pCacheFilePath );
+
+    /// Save the cache to a file.
+    bool save( const char* pCacheFilePath );
+
+    /// Read and write the cache as part of another stream.
+    /// The cache is no longer dirty once written.
+    bool read( Stream& stream );
+    void write( Stream& stream );
+
+    /// Remove all the scans.
+    void clear( void );
+
+    /// Find the files in a path as Platform::dumpPath() does.
+    /// @param pCached Set to whether the files were found without walking the directories.
+    bool dumpPath( const char* pPath, Vector<Platform::FileInfo>& files, const S32 depth, bool* pCached = NULL );
+
+    /// Find the directories in a path as Platform::dumpDirectories() does.
+    bool dumpDirectories( const char* pPath, Vector<StringTableEntry>& directories, const S32 depth );
+
+    /// Whether the scans have changed since the cache was loaded or saved.
+    inline bool isDirty( void ) const { return mDirty; }
+
+private:
+    Scan* findScan( StringTableEntry scanKey );
+    Scan* createScan( StringTableEntry scanKey, const Vector<StringTableEntry>& directories );
+    static StringTableEntry getScanKey( const char type, const char* pPath, const S32 depth );
+};
+
+#endif // _DIRECTORY_SCAN_CACHE_H_
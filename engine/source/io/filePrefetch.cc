@@ -0,0 +1,268 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#ifndef _FILE_PREFETCH_H_
+#include "io/filePrefetch.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_MUTEX_H_
+#include "platform/threads/mutex.h"
+#endif
+
+#ifndef _PLATFORM_THREAD_SEMAPHORE_H_
+#include "platform/threads/semaphore.h"
+#endif
+
+#include "platform/platformFileIO.h"
+#include "memory/safeDelete.h"
+
+#if defined(TORQUE_OS_EMSCRIPTEN)
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#include <emscripten/emscripten.h>
+
+//-----------------------------------------------------------------------------
+
+// On the web the files are already in memory so there is nothing to read ahead.  Instead, builds
+// that stream their assets (TORQUE_STREAM_ASSETS) only preload the scripts and fetch any other
+// file that is missing from the server, into the same path of the virtual file system.  Fetches
+// finish out of order on the main thread so the completed sequence is only advanced over
+// contiguous finished files.  A failed fetch is still finished, the load then reports the error.
+
+static Vector<bool>                 sgPrefetchFinished(__FILE__, __LINE__);
+static U32                          sgPrefetchQueuedSequence = 0;
+static U32                          sgPrefetchedSequence = 0;
+
+//-----------------------------------------------------------------------------
+
+static void finishPrefetch( const U32 sequence )
+{
+    // Ignore fetches that finish after a shutdown.
+    if ( sequence <= sgPrefetchedSequence )
+        return;
+
+    sgPrefetchFinished[sequence - sgPrefetchedSequence - 1] = true;
+
+    // Advance over the contiguous finished files.
+    while( sgPrefetchFinished.size() > 0 && sgPrefetchFinished.front() )
+    {
+        sgPrefetchFinished.pop_front();
+        sgPrefetchedSequence++;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+#if defined(TORQUE_STREAM_ASSETS)
+static void onPrefetchLoaded( unsigned, void* pArg, const char* )
+{
+    finishPrefetch( (U32)(size_t)pArg );
+}
+
+//-----------------------------------------------------------------------------
+
+static void onPrefetchFailed( unsigned, void* pArg, int status )
+{
+    const U32 sequence = (U32)(size_t)pArg;
+    Con::warnf( "FilePrefetch - Failed to stream file (HTTP status %d).", status );
+    finishPrefetch( sequence );
+}
+#endif
+
+//-----------------------------------------------------------------------------
+
+U32 FilePrefetch::queue( StringTableEntry filePath )
+{
+    // Sanity!
+    AssertFatal( filePath != NULL, "FilePrefetch::queue() - Cannot queue a NULL file-path." );
+
+    const U32 sequence = ++sgPrefetchQueuedSequence;
+    sgPrefetchFinished.push_back( false );
+
+#if defined(TORQUE_STREAM_ASSETS)
+    // Fetch the file if it was not preloaded.
+    if ( !Platform::isFile( filePath ) )
+    {
+        // The stream URL is relative to the page unless it is set to a full URL.
+        const char* pStreamUrl = Con::getVariable( "$pref::Web::AssetStreamUrl" );
+        if ( *pStreamUrl == 0 )
+            pStreamUrl = "stream";
+
+        char url[2048];
+        dSprintf( url, sizeof(url), "%s%s%s", pStreamUrl, *filePath == '/' ? "" : "/", filePath );
+        emscripten_async_wget2( url, filePath, "GET", "", (void*)(size_t)sequence, onPrefetchLoaded, onPrefetchFailed, NULL );
+        return sequence;
+    }
+#endif
+
+    finishPrefetch( sequence );
+    return sequence;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 FilePrefetch::getCompletedSequence( void )
+{
+    return sgPrefetchedSequence;
+}
+
+//-----------------------------------------------------------------------------
+
+void FilePrefetch::shutdown( void )
+{
+    // Treat any files not fetched as fetched.
+    sgPrefetchFinished.clear();
+    sgPrefetchedSequence = sgPrefetchQueuedSequence;
+}
+
+#else
+
+//-----------------------------------------------------------------------------
+
+static Vector<StringTableEntry>     sgPrefetchFiles(__FILE__, __LINE__);
+static Mutex*                       sgpPrefetchMutex = NULL;
+static Semaphore*                   sgpPrefetchSemaphore = NULL;
+static Thread*                      sgpPrefetchThread = NULL;
+static bool                         sgPrefetchShutdown = false;
+static U32                          sgPrefetchQueuedSequence = 0;
+static U32                          sgPrefetchedSequence = 0;
+
+//-----------------------------------------------------------------------------
+
+static void prefetchThreadFunction( void* )
+{
+    char buffer[16384];
+
+    while( true )
+    {
+        // Wait for work.
+        sgpPrefetchSemaphore->acquire();
+
+        // Fetch the next file to read.
+        sgpPrefetchMutex->lock();
+
+        // Finish if shutting down.
+        if ( sgPrefetchShutdown )
+        {
+            sgpPrefetchMutex->unlock();
+            return;
+        }
+
+        StringTableEntry filePath = NULL;
+        if ( sgPrefetchFiles.size() > 0 )
+        {
+            filePath = sgPrefetchFiles.front();
+            sgPrefetchFiles.pop_front();
+        }
+        sgpPrefetchMutex->unlock();
+
+        if ( filePath == NULL )
+            continue;
+
+        // Read the file so that it is cached when it is loaded.
+        File file;
+        if ( file.open( filePath, File::Read ) == File::Ok )
+        {
+            U32 bytesRead = 0;
+            while( file.read( sizeof(buffer), buffer, &bytesRead ) == File::Ok && bytesRead > 0 ) {}
+            file.close();
+        }
+
+        // Publish the file as read.
+        sgpPrefetchMutex->lock();
+        sgPrefetchedSequence++;
+        sgpPrefetchMutex->unlock();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+U32 FilePrefetch::queue( StringTableEntry filePath )
+{
+    // Sanity!
+    AssertFatal( filePath != NULL, "FilePrefetch::queue() - Cannot queue a NULL file-path." );
+
+    // Start the prefetch thread on first use.
+    if ( sgpPrefetchThread == NULL )
+    {
+        sgPrefetchShutdown = false;
+        sgpPrefetchMutex = new Mutex();
+        sgpPrefetchSemaphore = new Semaphore( 0 );
+        sgpPrefetchThread = new Thread( prefetchThreadFunction, NULL, true );
+    }
+
+    // Queue the file.
+    sgpPrefetchMutex->lock();
+    sgPrefetchFiles.push_back( filePath );
+    const U32 sequence = ++sgPrefetchQueuedSequence;
+    sgpPrefetchMutex->unlock();
+    sgpPrefetchSemaphore->release();
+
+    return sequence;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 FilePrefetch::getCompletedSequence( void )
+{
+    // Finish if the prefetch thread isn't running.
+    if ( sgpPrefetchThread == NULL )
+        return sgPrefetchedSequence;
+
+    sgpPrefetchMutex->lock();
+    const U32 sequence = sgPrefetchedSequence;
+    sgpPrefetchMutex->unlock();
+
+    return sequence;
+}
+
+//-----------------------------------------------------------------------------
+
+void FilePrefetch::shutdown( void )
+{
+    // Finish if the prefetch thread isn't running.
+    if ( sgpPrefetchThread == NULL )
+        return;
+
+    // Stop the prefetch thread.
+    sgpPrefetchMutex->lock();
+    sgPrefetchShutdown = true;
+    sgpPrefetchMutex->unlock();
+    sgpPrefetchSemaphore->release();
+    SAFE_DELETE( sgpPrefetchThread );
+
+    // Treat any files not read as read.
+    sgPrefetchFiles.clear();
+    sgPrefetchedSequence = sgPrefetchQueuedSequence;
+    SAFE_DELETE( sgpPrefetchMutex );
+    SAFE_DELETE( sgpPrefetchSemaphore );
+}
+
+#endif // TORQUE_OS_EMSCRIPTEN
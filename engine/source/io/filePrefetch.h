@@ -0,0 +1,62 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#ifndef _FILE_PREFETCH_H_
+#define _FILE_PREFETCH_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// Reads files on a background thread so that they are cached before they are loaded.
+///
+/// Each queued file is given a sequence number.  Files are read in the order they are queued
+/// so a file has been read once the completed sequence reaches its sequence number.  The
+/// prefetch thread only ever reads the files; what is done with them is up to the caller.
+///
+/// @code
+/// const U32 sequence = FilePrefetch::queue( StringTable->insert( pFilePath ) );
+/// ...
+/// if ( FilePrefetch::isComplete( sequence ) )
+///     loadFile( pFilePath );
+/// @endcode
+class FilePrefetch
+{
+public:
+    /// Queue a file to be read, starting the prefetch thread if needed.
+    /// @return The sequence number of the file.
+    static U32 queue( StringTableEntry filePath );
+
+    /// Get the sequence number of the last file read.
+    static U32 getCompletedSequence( void );
+
+    /// Whether the file with the specified sequence number has been read.
+    static inline bool isComplete( const U32 sequence ) { return sequence <= getCompletedSequence(); }
+
+    /// Stop the prefetch thread.  Any files not yet read are treated as read.
+    static void shutdown( void );
+};
+
+#endif // _FILE_PREFETCH_H_
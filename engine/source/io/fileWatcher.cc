@@ -0,0 +1,280 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#ifndef _FILE_WATCHER_H_
+#include "io/fileWatcher.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
+#include "platform/platformFileIO.h"
+#include "memory/safeDelete.h"
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+FileWatcher::FileWatcher() :
+    mpWatchThread( NULL ),
+    mStopWatching( false ),
+    mPollInterval( 0 ),
+    mFilesSequence( 0 )
+{
+}
+
+//-----------------------------------------------------------------------------
+
+FileWatcher::~FileWatcher()
+{
+    stop();
+}
+
+//-----------------------------------------------------------------------------
+
+void FileWatcher::setFiles( const Vector<StringTableEntry>& files )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(FileWatcher_SetFiles);
+
+    Vector<WatchedFile> watchedFiles;
+    watchedFiles.reserve( files.size() );
+
+    MutexHandle mutexHandle;
+    mutexHandle.lock( &mMutex, true );
+
+    // Index the existing files.
+    HashMap<StringTableEntry, U32> existingFiles;
+    for ( U32 index = 0; index < (U32)mFiles.size(); ++index )
+        existingFiles.insert( mFiles[index].mFile, index );
+
+    for ( Vector<StringTableEntry>::const_iterator fileItr = files.begin(); fileItr != files.end(); ++fileItr )
+    {
+        // Keep the state of existing files.
+        HashMap<StringTableEntry, U32>::iterator existingItr = existingFiles.find( *fileItr );
+        if ( existingItr != existingFiles.end() )
+        {
+            watchedFiles.push_back( mFiles[existingItr->value] );
+            continue;
+        }
+
+        // New files are read by the watch thread.
+        WatchedFile watchedFile;
+        watchedFile.mFile = *fileItr;
+        watchedFile.mSize = -1;
+        dMemset( &watchedFile.mModifyTime, 0, sizeof(watchedFile.mModifyTime) );
+        watchedFile.mKnown = false;
+        watchedFile.mPending = false;
+        watchedFiles.push_back( watchedFile );
+    }
+
+    mFiles = watchedFiles;
+
+    // Discard the results of any poll in progress.
+    mFilesSequence++;
+}
+
+//-----------------------------------------------------------------------------
+
+void FileWatcher::start( const U32 pollInterval )
+{
+    // Restart if the poll interval has changed.
+    if ( isRunning() )
+    {
+        if ( pollInterval == mPollInterval )
+            return;
+
+        stop();
+    }
+
+    mPollInterval = getMax( pollInterval, (U32)1 );
+    mStopWatching = false;
+    mpWatchThread = new Thread( watchThreadFunction, this, true );
+}
+
+//-----------------------------------------------------------------------------
+
+void FileWatcher::stop( void )
+{
+    if ( !isRunning() )
+        return;
+
+    // Deleting the thread waits for it to finish.
+    mStopWatching = true;
+    SAFE_DELETE( mpWatchThread );
+}
+
+//-----------------------------------------------------------------------------
+
+bool FileWatcher::getChangedFiles( Vector<StringTableEntry>& files )
+{
+    MutexHandle mutexHandle;
+    mutexHandle.lock( &mMutex, true );
+
+    if ( mChangedFiles.size() == 0 )
+        return false;
+
+    files.merge( mChangedFiles );
+    mChangedFiles.clear();
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void FileWatcher::resetFile( StringTableEntry file )
+{
+    MutexHandle mutexHandle;
+    mutexHandle.lock( &mMutex, true );
+
+    for ( Vector<WatchedFile>::iterator fileItr = mFiles.begin(); fileItr != mFiles.end(); ++fileItr )
+    {
+        if ( fileItr->mFile != file )
+            continue;
+
+        readFileState( *fileItr );
+        fileItr->mPending = false;
+        mFilesSequence++;
+        break;
+    }
+
+    // Forget any change already reported.
+    for ( S32 index = 0; index < mChangedFiles.size(); ++index )
+    {
+        if ( mChangedFiles[index] == file )
+        {
+            mChangedFiles.erase_fast( index );
+            break;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void FileWatcher::readFileState( WatchedFile& watchedFile )
+{
+    // A missing file is treated as having a negative size so that deleting and recreating it are changes.
+    watchedFile.mSize = Platform::getFileSize( watchedFile.mFile );
+    dMemset( &watchedFile.mModifyTime, 0, sizeof(watchedFile.mModifyTime) );
+    if ( watchedFile.mSize >= 0 )
+        Platform::getFileTimes( watchedFile.mFile, NULL, &watchedFile.mModifyTime );
+
+    watchedFile.mKnown = true;
+    watchedFile.mPending = false;
+}
+
+//-----------------------------------------------------------------------------
+
+void FileWatcher::watchThreadFunction( void* pFileWatcher )
+{
+    FileWatcher* pWatcher = static_cast<FileWatcher*>( pFileWatcher );
+
+    while ( !pWatcher->mStopWatching )
+    {
+        // Sleep in short steps so that stopping doesn't wait for a whole poll interval.
+        U32 sleepTime = 0;
+        while ( sleepTime < pWatcher->mPollInterval && !pWatcher->mStopWatching )
+        {
+            const U32 sleepStep = getMin( pWatcher->mPollInterval - sleepTime, (U32)50 );
+            Platform::sleep( sleepStep );
+            sleepTime += sleepStep;
+        }
+
+        if ( !pWatcher->mStopWatching )
+            pWatcher->poll();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void FileWatcher::poll( void )
+{
+    // Take a copy of the files so that the owner isn't blocked whilst the files are read.
+    Vector<WatchedFile> files;
+    U32 filesSequence;
+    {
+        MutexHandle mutexHandle;
+        mutexHandle.lock( &mMutex, true );
+        files = mFiles;
+        filesSequence = mFilesSequence;
+    }
+
+    // Read the current state of each file.
+    Vector<StringTableEntry> changedFiles;
+    bool filesUpdated = false;
+    for ( Vector<WatchedFile>::iterator fileItr = files.begin(); fileItr != files.end(); ++fileItr )
+    {
+        // Read the initial state of new files.
+        if ( !fileItr->mKnown )
+        {
+            readFileState( *fileItr );
+            filesUpdated = true;
+            continue;
+        }
+
+        WatchedFile currentState;
+        currentState.mFile = fileItr->mFile;
+        readFileState( currentState );
+
+        if ( currentState.mSize != fileItr->mSize || Platform::compareFileTimes( currentState.mModifyTime, fileItr->mModifyTime ) != 0 )
+        {
+            // The file has changed but it may still be being written so wait until it settles.
+            fileItr->mSize = currentState.mSize;
+            fileItr->mModifyTime = currentState.mModifyTime;
+            fileItr->mPending = true;
+            filesUpdated = true;
+        }
+        else if ( fileItr->mPending )
+        {
+            // The file has settled so report the change.
+            fileItr->mPending = false;
+            changedFiles.push_back( fileItr->mFile );
+            filesUpdated = true;
+        }
+    }
+
+    if ( !filesUpdated )
+        return;
+
+    MutexHandle mutexHandle;
+    mutexHandle.lock( &mMutex, true );
+
+    // Discard the results if the files were changed whilst they were being read.
+    if ( filesSequence != mFilesSequence )
+        return;
+
+    mFiles = files;
+
+    // Add the changed files, ignoring any already reported.
+    for ( Vector<StringTableEntry>::iterator fileItr = changedFiles.begin(); fileItr != changedFiles.end(); ++fileItr )
+    {
+        if ( !mChangedFiles.contains( *fileItr ) )
+            mChangedFiles.push_back( *fileItr );
+    }
+}
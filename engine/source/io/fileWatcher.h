@@ -0,0 +1,110 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#ifndef _FILE_WATCHER_H_
+#define _FILE_WATCHER_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_MUTEX_H_
+#include "platform/threads/mutex.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+class Thread;
+
+//-----------------------------------------------------------------------------
+
+/// Watches a set of files for changes on a background thread.
+///
+/// The watch thread checks the size and modification time of each file every poll interval.
+/// A change is only reported once the file has stayed the same for a whole poll interval so
+/// that the several writes made whilst a file is being saved are coalesced into one change.
+/// Changes are collected until the owner fetches them, typically once per tick:
+///
+/// @code
+/// mFileWatcher.setFiles( files );
+/// mFileWatcher.start( 500 );
+/// ...
+/// Vector<StringTableEntry> changedFiles;
+/// mFileWatcher.getChangedFiles( changedFiles );
+/// @endcode
+///
+/// Polling is used as it works identically on every platform and for files within any
+/// directory, and the cost is only that of the watch thread reading the file attributes.
+class FileWatcher
+{
+public:
+    FileWatcher();
+    ~FileWatcher();
+
+    /// Set the files to watch.
+    /// Files that were already being watched keep their state so changes are not lost or reported again.
+    void setFiles( const Vector<StringTableEntry>& files );
+
+    /// Start watching, checking the files every "pollInterval" milliseconds.
+    void start( const U32 pollInterval );
+
+    /// Stop watching.  Changes not yet fetched are kept.
+    void stop( void );
+
+    inline bool isRunning( void ) const { return mpWatchThread != NULL; }
+    inline U32 getPollInterval( void ) const { return mPollInterval; }
+
+    /// Fetch (and clear) the files that have changed.
+    /// @return Whether any files have changed.
+    bool getChangedFiles( Vector<StringTableEntry>& files );
+
+    /// Accept the current state of a file without reporting it as changed.
+    /// This is used to ignore changes made by the owner itself, such as saving a file.
+    void resetFile( StringTableEntry file );
+
+private:
+    struct WatchedFile
+    {
+        StringTableEntry    mFile;
+        S32                 mSize;
+        FileTime            mModifyTime;
+        bool                mKnown;
+        bool                mPending;
+    };
+
+    static void watchThreadFunction( void* pFileWatcher );
+    static void readFileState( WatchedFile& watchedFile );
+    void poll( void );
+
+    Vector<WatchedFile>         mFiles;
+    Vector<StringTableEntry>    mChangedFiles;
+    Mutex                       mMutex;
+    Thread*                     mpWatchThread;
+    volatile bool               mStopWatching;
+    U32                         mPollInterval;
+    U32                         mFilesSequence;
+};
+
+#endif // _FILE_WATCHER_H_
@@ -0,0 +1,611 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#ifndef _PACK_FILE_H_
+#include "io/packFile.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+#ifndef _STRINGTABLE_H_
+#include "string/stringTable.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _PLATFORM_FILEIO_H_
+#include "platform/platformFileIO.h"
+#endif
+
+#include "zlib.h"
+
+#if defined(TORQUE_OS_WIN32)
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+struct PackFileMapping
+{
+#if defined(TORQUE_OS_WIN32)
+    HANDLE  mFile;
+    HANDLE  mMapping;
+#endif
+    void*   mpView;
+    U32     mSize;
+};
+
+//-----------------------------------------------------------------------------
+
+static PackFileMapping* mapFile( const char* pFilePath )
+{
+#if defined(TORQUE_OS_WIN32)
+    HANDLE file = CreateFileA( pFilePath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+    if ( file == INVALID_HANDLE_VALUE )
+        return NULL;
+
+    const DWORD size = GetFileSize( file, NULL );
+    HANDLE mapping = size == 0 || size == INVALID_FILE_SIZE ? NULL : CreateFileMappingA( file, NULL, PAGE_READONLY, 0, 0, NULL );
+    if ( mapping == NULL )
+    {
+        CloseHandle( file );
+        return NULL;
+    }
+
+    void* pView = MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 );
+    if ( pView == NULL )
+    {
+        CloseHandle( mapping );
+        CloseHandle( file );
+        return NULL;
+    }
+
+    PackFileMapping* pMapping = new PackFileMapping();
+    pMapping->mFile = file;
+    pMapping->mMapping = mapping;
+    pMapping->mpView = pView;
+    pMapping->mSize = (U32)size;
+    return pMapping;
+#else
+    const int file = ::open( pFilePath, O_RDONLY );
+    if ( file < 0 )
+        return NULL;
+
+    struct stat fileStat;
+    if ( fstat( file, &fileStat ) != 0 || fileStat.st_size == 0 )
+    {
+        ::close( file );
+        return NULL;
+    }
+
+    // NOTE: The mapping remains valid once the file is closed.
+    void* pView = mmap( NULL, (size_t)fileStat.st_size, PROT_READ, MAP_PRIVATE, file, 0 );
+    ::close( file );
+    if ( pView == MAP_FAILED )
+        return NULL;
+
+    PackFileMapping* pMapping = new PackFileMapping();
+    pMapping->mpView = pView;
+    pMapping->mSize = (U32)fileStat.st_size;
+    return pMapping;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+static void unmapFile( PackFileMapping* pMapping )
+{
+#if defined(TORQUE_OS_WIN32)
+    UnmapViewOfFile( pMapping->mpView );
+    CloseHandle( pMapping->mMapping );
+    CloseHandle( pMapping->mFile );
+#else
+    munmap( pMapping->mpView, pMapping->mSize );
+#endif
+    delete pMapping;
+}
+
+//-----------------------------------------------------------------------------
+
+static inline U32 readU32( const U8* pData )
+{
+    return (U32)pData[0] | ((U32)pData[1] << 8) | ((U32)pData[2] << 16) | ((U32)pData[3] << 24);
+}
+
+//-----------------------------------------------------------------------------
+
+static S32 QSORT_CALLBACK compareEntries( const void* a, const void* b )
+{
+    const PackFile::Entry* pEntryA = (const PackFile::Entry*)a;
+    const PackFile::Entry* pEntryB = (const PackFile::Entry*)b;
+
+    if ( pEntryA->mHash != pEntryB->mHash )
+        return pEntryA->mHash < pEntryB->mHash ? -1 : 1;
+
+    return dStricmp( pEntryA->mpPath, pEntryB->mpPath );
+}
+
+//-----------------------------------------------------------------------------
+
+PackFile::PackFile() :
+    mPackFile( StringTable->EmptyString ),
+    mpData( NULL ),
+    mDataSize( 0 ),
+    mpMapping( NULL )
+{
+}
+
+//-----------------------------------------------------------------------------
+
+PackFile::~PackFile()
+{
+    close();
+}
+
+//-----------------------------------------------------------------------------
+
+bool PackFile::open( const char* pPackFile )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(PackFile_Open);
+
+    // Sanity!
+    AssertFatal( pPackFile != NULL, "PackFile::open() - Cannot open a NULL pack file." );
+
+    close();
+
+    mPackFile = StringTable->insert( pPackFile );
+
+    // Map the pack.
+    PackFileMapping* pMapping = mapFile( pPackFile );
+    if ( pMapping != NULL )
+    {
+        mpMapping = pMapping;
+        mpData = (const U8*)pMapping->mpView;
+        mDataSize = pMapping->mSize;
+    }
+    else
+    {
+        // The pack could not be mapped (it may be inside an application bundle) so read it instead.
+        File file;
+        if ( file.open( pPackFile, File::Read ) != File::Ok )
+        {
+            Con::warnf( "PackFile::open() - Could not open the pack file '%s'.", pPackFile );
+            return false;
+        }
+
+        const U32 size = file.getSize();
+        U8* pData = size > 0 ? (U8*)dMalloc( size ) : NULL;
+        U32 bytesRead = 0;
+        if ( pData == NULL || file.read( size, (char*)pData, &bytesRead ) != File::Ok || bytesRead != size )
+        {
+            Con::warnf( "PackFile::open() - Could not read the pack file '%s'.", pPackFile );
+            if ( pData != NULL )
+                dFree( pData );
+            return false;
+        }
+
+        mpData = pData;
+        mDataSize = size;
+    }
+
+    // Read the directory.
+    if ( !readDirectory() )
+    {
+        Con::warnf( "PackFile::open() - The file '%s' is not a valid pack file.", pPackFile );
+        close();
+        return false;
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void PackFile::close( void )
+{
+    mEntries.clear();
+
+    if ( mpMapping != NULL )
+    {
+        unmapFile( (PackFileMapping*)mpMapping );
+        mpMapping = NULL;
+    }
+    else if ( mpData != NULL )
+    {
+        dFree( (void*)mpData );
+    }
+
+    mpData = NULL;
+    mDataSize = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+bool PackFile::readDirectory( void )
+{
+    // Check the header.
+    if ( mDataSize < HeaderSize || readU32( mpData ) != Signature || readU32( mpData + 4 ) != Version )
+        return false;
+
+    const U32 entryCount = readU32( mpData + 8 );
+    const U32 directoryOffset = readU32( mpData + 12 );
+    const U32 namesOffset = readU32( mpData + 16 );
+    const U32 namesSize = readU32( mpData + 20 );
+
+    // Check the directory and names are within the pack and the names are terminated.
+    if (    directoryOffset > mDataSize || entryCount > (mDataSize - directoryOffset) / EntrySize ||
+            namesOffset > mDataSize || namesSize > mDataSize - namesOffset ||
+            (namesSize > 0 && mpData[namesOffset + namesSize - 1] != 0) )
+        return false;
+
+    // Read the entries.
+    mEntries.setSize( entryCount );
+    const U8* pDirectory = mpData + directoryOffset;
+    for ( U32 index = 0; index < entryCount; ++index, pDirectory += EntrySize )
+    {
+        Entry& entry = mEntries[index];
+        const U32 nameOffset = readU32( pDirectory + 4 );
+        entry.mHash = readU32( pDirectory );
+        entry.mDataOffset = readU32( pDirectory + 8 );
+        entry.mSize = readU32( pDirectory + 12 );
+        entry.mStoredSize = readU32( pDirectory + 16 );
+        entry.mFlags = readU32( pDirectory + 20 );
+
+        // Check the entry is within the pack.
+        if ( nameOffset >= namesSize || entry.mDataOffset > mDataSize || entry.mStoredSize > mDataSize - entry.mDataOffset )
+            return false;
+
+        // Stored entries must be stored at their full size.
+        if ( (entry.mFlags & EntryDeflated) == 0 && entry.mStoredSize != entry.mSize )
+            return false;
+
+        entry.mpPath = (const char*)mpData + namesOffset + nameOffset;
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+const PackFile::Entry* PackFile::find( const char* pPath ) const
+{
+    // Sanity!
+    AssertFatal( pPath != NULL, "PackFile::find() - Cannot find a NULL path." );
+
+    const U32 hash = hashPath( pPath );
+
+    // Find the first entry with the hash.
+    S32 low = 0;
+    S32 high = mEntries.size();
+    while ( low < high )
+    {
+        const S32 middle = (low + high) / 2;
+        if ( mEntries[middle].mHash < hash )
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    // Find the path amongst the entries with the hash.
+    for ( S32 index = low; index < mEntries.size() && mEntries[index].mHash == hash; ++index )
+    {
+        if ( dStricmp( mEntries[index].mpPath, pPath ) == 0 )
+            return &mEntries[index];
+    }
+
+    return NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+Stream* PackFile::openStream( const Entry* pEntry ) const
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(PackFile_OpenStream);
+
+    // Sanity!
+    AssertFatal( pEntry != NULL, "PackFile::openStream() - Cannot open a NULL entry." );
+    AssertFatal( isOpen(), "PackFile::openStream() - The pack is not open." );
+
+    const U8* pStoredData = mpData + pEntry->mDataOffset;
+
+    // Is the entry stored?
+    if ( (pEntry->mFlags & EntryDeflated) == 0 )
+    {
+        // Yes, so read it directly from the pack.
+        return new PackFileStream( pStoredData, pEntry->mSize, false );
+    }
+
+    // No, so inflate it.
+    U8* pData = (U8*)dMalloc( pEntry->mSize > 0 ? pEntry->mSize : 1 );
+    uLongf size = pEntry->mSize;
+    if ( uncompress( pData, &size, pStoredData, pEntry->mStoredSize ) != Z_OK || size != pEntry->mSize )
+    {
+        Con::warnf( "PackFile::openStream() - Could not inflate '%s' from the pack file '%s'.", pEntry->mpPath, mPackFile );
+        dFree( pData );
+        return NULL;
+    }
+
+    return new PackFileStream( pData, pEntry->mSize, true );
+}
+
+//-----------------------------------------------------------------------------
+
+bool PackFile::build( const char* pPackFile, const char* pSourcePath, const bool deflate )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(PackFile_Build);
+
+    // Sanity!
+    AssertFatal( pPackFile != NULL, "PackFile::build() - Cannot build a NULL pack file." );
+    AssertFatal( pSourcePath != NULL, "PackFile::build() - Cannot build a pack from a NULL path." );
+
+    char packFileBuffer[1024];
+    char sourcePathBuffer[1024];
+    Platform::makeFullPathName( pPackFile, packFileBuffer, sizeof(packFileBuffer) );
+    Platform::makeFullPathName( pSourcePath, sourcePathBuffer, sizeof(sourcePathBuffer) );
+    const U32 sourcePathLength = dStrlen( sourcePathBuffer );
+
+    // Find the files.
+    Vector<Platform::FileInfo> files;
+    if ( !Platform::dumpPath( sourcePathBuffer, files ) )
+    {
+        Con::warnf( "PackFile::build() - Could not find the files in '%s'.", sourcePathBuffer );
+        return false;
+    }
+
+    FileStream packStream;
+    if ( !packStream.open( packFileBuffer, FileStream::Write ) )
+    {
+        Con::warnf( "PackFile::build() - Could not open the pack file '%s' for writing.", packFileBuffer );
+        return false;
+    }
+
+    // Reserve the header.
+    const U8 padding[HeaderSize] = { 0 };
+    packStream.write( HeaderSize, padding );
+
+    Vector<Entry> entries;
+    Vector<char*> paths;
+    Vector<U8> data;
+    Vector<U8> deflatedData;
+    char filePathBuffer[1024];
+
+    // Write the file data.
+    for ( S32 index = 0; index < files.size(); ++index )
+    {
+        const Platform::FileInfo& fileInfo = files[index];
+        dSprintf( filePathBuffer, sizeof(filePathBuffer), "%s/%s", fileInfo.pFullPath, fileInfo.pFileName );
+
+        // Skip the pack itself.
+        if ( dStricmp( filePathBuffer, packFileBuffer ) == 0 )
+            continue;
+
+        // Fetch the path relative to the source path.
+        const char* pRelativePath = filePathBuffer + sourcePathLength;
+        while ( *pRelativePath == '/' )
+            pRelativePath++;
+
+        // Read the file.
+        File file;
+        U32 bytesRead = 0;
+        if ( file.open( filePathBuffer, File::Read ) != File::Ok )
+        {
+            Con::warnf( "PackFile::build() - Could not read '%s', skipping it.", filePathBuffer );
+            continue;
+        }
+        data.setSize( file.getSize() );
+        if ( data.size() > 0 && (file.read( data.size(), (char*)data.address(), &bytesRead ) != File::Ok || bytesRead != (U32)data.size()) )
+        {
+            Con::warnf( "PackFile::build() - Could not read '%s', skipping it.", filePathBuffer );
+            continue;
+        }
+        file.close();
+
+        Entry entry;
+        entry.mHash = hashPath( pRelativePath );
+        entry.mpPath = NULL;
+        entry.mSize = data.size();
+        entry.mStoredSize = data.size();
+        entry.mFlags = 0;
+        const U8* pStoredData = data.address();
+
+        // Deflate the file if requested and it is worthwhile.
+        if ( deflate && data.size() > 0 )
+        {
+            uLongf deflatedSize = compressBound( data.size() );
+            deflatedData.setSize( (U32)deflatedSize );
+            if ( compress2( deflatedData.address(), &deflatedSize, data.address(), data.size(), Z_BEST_COMPRESSION ) == Z_OK && deflatedSize < (uLongf)data.size() )
+            {
+                entry.mStoredSize = (U32)deflatedSize;
+                entry.mFlags |= EntryDeflated;
+                pStoredData = deflatedData.address();
+            }
+        }
+
+        // Align and write the data.
+        const U32 alignment = packStream.getPosition() % DataAlignment;
+        if ( alignment != 0 )
+            packStream.write( DataAlignment - alignment, padding );
+        entry.mDataOffset = packStream.getPosition();
+        if ( entry.mStoredSize > 0 )
+            packStream.write( entry.mStoredSize, pStoredData );
+
+        paths.push_back( dStrdup( pRelativePath ) );
+        entry.mpPath = paths.last();
+        entries.push_back( entry );
+    }
+
+    // Sort the directory.
+    if ( entries.size() > 1 )
+        dQsort( entries.address(), entries.size(), sizeof(Entry), compareEntries );
+
+    // Write the names.
+    const U32 namesOffset = packStream.getPosition();
+    Vector<U32> nameOffsets;
+    for ( S32 index = 0; index < entries.size(); ++index )
+    {
+        nameOffsets.push_back( packStream.getPosition() - namesOffset );
+        packStream.write( dStrlen( entries[index].mpPath ) + 1, entries[index].mpPath );
+    }
+    const U32 namesSize = packStream.getPosition() - namesOffset;
+
+    // Write the directory.
+    const U32 directoryOffset = packStream.getPosition();
+    for ( S32 index = 0; index < entries.size(); ++index )
+    {
+        const Entry& entry = entries[index];
+        packStream.write( entry.mHash );
+        packStream.write( nameOffsets[index] );
+        packStream.write( entry.mDataOffset );
+        packStream.write( entry.mSize );
+        packStream.write( entry.mStoredSize );
+        packStream.write( entry.mFlags );
+    }
+
+    // Write the header.
+    packStream.setPosition( 0 );
+    packStream.write( (U32)Signature );
+    packStream.write( (U32)Version );
+    packStream.write( (U32)entries.size() );
+    packStream.write( directoryOffset );
+    packStream.write( namesOffset );
+    packStream.write( namesSize );
+
+    const bool written = packStream.getStatus() == Stream::Ok;
+    packStream.close();
+
+    for ( S32 index = 0; index < paths.size(); ++index )
+        dFree( paths[index] );
+
+    if ( !written )
+    {
+        Con::warnf( "PackFile::build() - Could not write the pack file '%s'.", packFileBuffer );
+        return false;
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 PackFile::hashPath( const char* pPath )
+{
+    // FNV-1a of the lower-case path.
+    U32 hash = 2166136261u;
+    for ( const char* pChar = pPath; *pChar != 0; ++pChar )
+    {
+        hash ^= (U8)dTolower( *pChar );
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+//-----------------------------------------------------------------------------
+
+PackFileStream::PackFileStream( const U8* pData, const U32 size, const bool ownData ) :
+    mpData( pData ),
+    mSize( size ),
+    mPosition( 0 ),
+    mOwnData( ownData )
+{
+    setStatus( Ok );
+}
+
+//-----------------------------------------------------------------------------
+
+PackFileStream::~PackFileStream()
+{
+    if ( mOwnData )
+        dFree( (void*)mpData );
+
+    setStatus( Closed );
+}
+
+//-----------------------------------------------------------------------------
+
+bool PackFileStream::hasCapability( const Capability capability ) const
+{
+    return getStatus() != Closed && (U32(capability) & (U32(StreamRead) | U32(StreamPosition))) != 0;
+}
+
+//-----------------------------------------------------------------------------
+
+bool PackFileStream::setPosition( const U32 position )
+{
+    if ( position > mSize )
+    {
+        setStatus( UnknownError );
+        return false;
+    }
+
+    mPosition = position;
+    setStatus( mPosition == mSize ? EOS : Ok );
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool PackFileStream::_read( const U32 size, void* pBuffer )
+{
+    if ( size == 0 )
+        return true;
+
+    // Read what is available.
+    const U32 available = mSize - mPosition;
+    const U32 readSize = size < available ? size : available;
+    dMemcpy( pBuffer, mpData + mPosition, readSize );
+    mPosition += readSize;
+
+    if ( readSize < size )
+    {
+        setStatus( EOS );
+        return false;
+    }
+
+    setStatus( Ok );
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool PackFileStream::_write( const U32 size, const void* pBuffer )
+{
+    AssertWarn( false, "PackFileStream::_write() - Pack streams are read-only." );
+    setStatus( IllegalCall );
+    return false;
+}
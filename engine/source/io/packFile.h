@@ -0,0 +1,151 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#ifndef _PACK_FILE_H_
+#define _PACK_FILE_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _STREAM_H_
+#include "io/stream.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// A read-only archive of many files held in a single file.
+///
+/// A pack is mapped into memory when it is opened so reading an entry needs no file
+/// access at all.  Entries are either stored, in which case their streams read directly
+/// from the mapped pack, or deflated, in which case they are inflated when opened.
+///
+/// The directory is sorted by path hash so finding an entry is a binary search.  Paths
+/// are relative to the directory the pack is in and are matched case-insensitively.
+///
+/// The layout (all little-endian) is:
+/// - Header: signature, version, entry count, directory offset, names offset and names size.
+/// - The entry data, each aligned to DataAlignment bytes.
+/// - The entry paths as NUL terminated strings.
+/// - The directory: hash, name offset, data offset, size, stored size and flags for each entry.
+///
+/// Packs are created with build() or the "createPackFile()" console function.
+class PackFile
+{
+public:
+    enum Constants
+    {
+        Signature       = 0x50443254,   // 'T2DP'
+        Version         = 1,
+        DataAlignment   = 16,
+        HeaderSize      = 24,
+        EntrySize       = 24,
+    };
+
+    enum EntryFlags
+    {
+        EntryDeflated   = BIT(0),
+    };
+
+    struct Entry
+    {
+        U32         mHash;
+        const char* mpPath;
+        U32         mDataOffset;
+        U32         mSize;
+        U32         mStoredSize;
+        U32         mFlags;
+    };
+
+public:
+    PackFile();
+    ~PackFile();
+
+    bool open( const char* pPackFile );
+    void close( void );
+
+    inline bool isOpen( void ) const                            { return mpData != NULL; }
+    inline bool isMapped( void ) const                          { return mpMapping != NULL; }
+    inline StringTableEntry getPackFile( void ) const           { return mPackFile; }
+
+    /// Find an entry by its path relative to the pack.
+    const Entry* find( const char* pPath ) const;
+
+    inline U32 getEntryCount( void ) const                      { return (U32)mEntries.size(); }
+    inline const Entry& getEntry( const U32 index ) const       { return mEntries[index]; }
+
+    /// Open a stream on an entry.
+    /// The stream must be deleted when finished with.
+    Stream* openStream( const Entry* pEntry ) const;
+
+    /// Create a pack of all the files in a directory.
+    static bool build( const char* pPackFile, const char* pSourcePath, const bool deflate );
+
+    static U32 hashPath( const char* pPath );
+
+private:
+    bool readDirectory( void );
+
+    StringTableEntry    mPackFile;
+    const U8*           mpData;
+    U32                 mDataSize;
+    void*               mpMapping;
+    Vector<Entry>       mEntries;
+};
+
+//-----------------------------------------------------------------------------
+
+/// A read-only stream onto a block of memory such as a pack entry.
+/// The stream can optionally own the memory, freeing it when deleted.
+class PackFileStream : public Stream
+{
+    typedef Stream Parent;
+
+public:
+    PackFileStream( const U8* pData, const U32 size, const bool ownData );
+    virtual ~PackFileStream();
+
+    /// Access the memory directly rather than reading it.
+    inline const U8* getData( void ) const                      { return mpData; }
+
+    virtual bool hasCapability( const Capability capability ) const;
+    virtual U32 getPosition( void ) const                       { return mPosition; }
+    virtual bool setPosition( const U32 position );
+    virtual U32 getStreamSize( void )                           { return mSize; }
+
+protected:
+    virtual bool _read( const U32 size, void* pBuffer );
+    virtual bool _write( const U32 size, const void* pBuffer );
+
+private:
+    const U8*   mpData;
+    U32         mSize;
+    U32         mPosition;
+    bool        mOwnData;
+};
+
+#endif // _PACK_FILE_H_
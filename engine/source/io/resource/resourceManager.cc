@@ -30,6 +30,7 @@
 #include "memory/frameAllocator.h"
 
 #include "io/zip/zipArchive.h"
+#include "io/packFile.h"
 
 #include "io/resource/resourceManager.h"
 #include "string/findMatch.h"
@@ -39,6 +40,9 @@
 
 #include "memory/safeDelete.h"
 
+// Debug Profiling.
+#include "debug/profiler.h"
+
 #include "resourceManager_ScriptBinding.h"
 
 ResManager *ResourceManager = NULL;
@@ -54,6 +58,13 @@ ResourceObject::ResourceObject ()
   mInstance = NULL;
   mZipArchive = NULL;
   mCentralDir = NULL;
+  mPackFile = NULL;
+  mPackEntry = NULL;
+  mCrcCached = false;
+  mCachedCrc = InvalidCRC;
+  mCachedCrcInitialVal = INITIAL_CRC_VALUE;
+  mCachedCrcFileSize = 0;
+  dMemset(&mCachedCrcModifyTime, 0, sizeof(mCachedCrcModifyTime));
 }
 
 void ResourceObject::destruct ()
@@ -68,6 +79,7 @@ void ResourceObject::destruct ()
       // [tom, 10/26/2006] We don't want to delete if it's a volume block since
       // the archive will be freed when the zip file resource object is freed.
       SAFE_DELETE(mZipArchive);
+      SAFE_DELETE(mPackFile);
    }
 }
 
@@ -417,6 +429,48 @@ bool ResManager::scanZip (ResourceObject * zipObject)
 
 //------------------------------------------------------------------------------
 
+bool ResManager::scanPack (ResourceObject * packObject)
+{
+   if(packObject->mPackFile == NULL)
+   {
+      packObject->mPackFile = new PackFile;
+      if(! packObject->mPackFile->open(buildPath(packObject->path, packObject->name)))
+      {
+         SAFE_DELETE(packObject->mPackFile);
+         return false;
+      }
+   }
+
+   PackFile *pack = packObject->mPackFile;
+   char buf[1024];
+
+   for(U32 i = 0;i < pack->getEntryCount();++i)
+   {
+      const PackFile::Entry &entry = pack->getEntry(i);
+
+      // Entries are relative to the directory the pack is in.
+      dSprintf(buf, sizeof(buf), "%s/%s", packObject->path, entry.mpPath);
+
+      StringTableEntry path, file;
+      getPaths(buf, path, file);
+
+      ResourceObject *ro = createZipResource(path, file, packObject->path, packObject->name);
+
+      ro->flags = ResourceObject::VolumeBlock;
+      ro->fileSize = entry.mSize;
+      ro->compressedFileSize = entry.mStoredSize;
+      ro->fileOffset = entry.mDataOffset;
+      ro->mPackFile = pack;
+      ro->mPackEntry = &entry;
+
+      dictionary.pushBehind (ro, ResourceObject::File);
+   }
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+
 void ResManager::searchPath (const char *path, bool noDups /* = false */, bool ignoreZips /* = false */ )
 {
    AssertFatal (path != NULL, "No path to dump?");
@@ -456,6 +510,10 @@ void ResManager::searchPath (const char *path, bool noDups /* = false */, bool i
          ro->zipPath = rInfo.pFullPath;
          scanZip(ro);
       }
+      else if (extension && !dStricmp (extension, ".pack") && !ignoreZips )
+      {
+         scanPack(ro);
+      }
    }
 
    // Clear Exclusion list
@@ -760,12 +818,82 @@ void ResManager::unlock (ResourceObject * obj)
       obj->linkAfter (&timeoutList);
 }
 
+//------------------------------------------------------------------------------
+
+bool ResManager::getCrcFileStamp (ResourceObject * obj, S32 & fileSize, FileTime & modifyTime)
+{
+   const char *fileName;
+
+   if (obj->flags & ResourceObject::VolumeBlock)
+   {
+      // The zip or pack is only read when it is mounted so the entry size can be used
+      // but the archive may be replaced when it is mounted again.
+      if (!obj->zipPath || !obj->zipName)
+         return false;
+
+      fileName = buildPath (obj->zipPath, obj->zipName);
+      fileSize = obj->fileSize;
+   }
+   else
+   {
+      if (!obj->path || !obj->name)
+         return false;
+
+      fileName = buildPath (obj->path, obj->name);
+      fileSize = Platform::getFileSize (fileName);
+      if (fileSize < 0)
+         return false;
+   }
+
+   return Platform::getFileTimes (fileName, NULL, &modifyTime);
+}
+
+//------------------------------------------------------------------------------
+
+bool ResManager::findCachedCrc (ResourceObject * obj, const U32 crcInitialVal, U32 & crcVal)
+{
+   // The zip central directory already has the crc of each file.
+   if (obj->mCentralDir && crcInitialVal == INITIAL_CRC_VALUE)
+   {
+      crcVal = obj->mCentralDir->mCRC32 ^ CRC_POSTCOND_VALUE;
+      return true;
+   }
+
+   if (!obj->mCrcCached || obj->mCachedCrcInitialVal != crcInitialVal)
+      return false;
+
+   // Has the file changed?
+   S32 fileSize;
+   FileTime modifyTime;
+   if (!getCrcFileStamp (obj, fileSize, modifyTime) ||
+       fileSize != obj->mCachedCrcFileSize ||
+       Platform::compareFileTimes (modifyTime, obj->mCachedCrcModifyTime) != 0)
+   {
+      obj->mCrcCached = false;
+      return false;
+   }
+
+   crcVal = obj->mCachedCrc;
+   return true;
+}
+
+//------------------------------------------------------------------------------
+
+void ResManager::cacheCrc (ResourceObject * obj, const U32 crcInitialVal, const U32 crcVal)
+{
+   obj->mCrcCached = getCrcFileStamp (obj, obj->mCachedCrcFileSize, obj->mCachedCrcModifyTime);
+   obj->mCachedCrc = crcVal;
+   obj->mCachedCrcInitialVal = crcInitialVal;
+}
+
 //------------------------------------------------------------------------------
 // gets the crc of the file, ignores the stream type
 
 bool ResManager::getCrc (const char *fileName, U32 & crcVal,
    const U32 crcInitialVal)
 {
+   PROFILE_SCOPE(ResManager_GetCrc);
+
    ResourceObject *obj = find (fileName);
    if (!obj)
       return (false);
@@ -773,6 +901,10 @@ bool ResManager::getCrc (const char *fileName, U32 & crcVal,
    // check if in a volume
    if (obj->flags & (ResourceObject::VolumeBlock | ResourceObject::File))
    {
+      // use the cached crc if the file hasn't changed
+      if (findCachedCrc (obj, crcInitialVal, crcVal))
+         return (true);
+
       // can't crc locked resources...
       if (obj->lockCount)
          return false;
@@ -801,6 +933,7 @@ bool ResManager::getCrc (const char *fileName, U32 & crcVal,
 
       // get the crc value
       crcVal = calculateCRC (buffer, obj->fileSize, crcInitialVal);
+      cacheCrc (obj, crcInitialVal, crcVal);
       if (waterMark == 0xFFFFFFFF)
          delete[]buffer;
       else
@@ -872,7 +1005,13 @@ ResourceInstance * ResManager::loadInstance (ResourceObject * obj, bool computeC
    }
 
    if (computeCRC)
-      obj->crc = calculateCRCStream (stream, InvalidCRC);
+   {
+      if (!findCachedCrc (obj, InvalidCRC, obj->crc))
+      {
+         obj->crc = calculateCRCStream (stream, InvalidCRC);
+         cacheCrc (obj, InvalidCRC, obj->crc);
+      }
+   }
    else
       obj->crc = InvalidCRC;
 
@@ -931,6 +1070,12 @@ Stream * ResManager::openStream (ResourceObject * obj)
 
    // if zip file
 
+   if ((obj->flags & ResourceObject::VolumeBlock) && obj->mPackFile != NULL)
+   {
+      // Pack entries are read directly from the mapped pack.
+      return obj->mPackFile->openStream((const PackFile::Entry*)obj->mPackEntry);
+   }
+
    if (obj->flags & ResourceObject::VolumeBlock)
    {
       AssertFatal(obj->mZipArchive, "mZipArchive is NULL");
@@ -945,6 +1090,25 @@ Stream * ResManager::openStream (ResourceObject * obj)
 
 //------------------------------------------------------------------------------
 
+U32 ResManager::openStreamAsync (const char *fileName, AsyncFileIO::Priority priority, AsyncFileIO::CompletionCallback callback, void *context)
+{
+   ResourceObject *obj = find (fileName);
+   if (!obj)
+      return 0;
+
+   if (echoFileNames)
+      Con::printf ("FILE ACCESS (ASYNC): %s/%s", obj->path, obj->name);
+
+   // Read disk files in the background.
+   if (obj->flags & ResourceObject::File)
+      return AsyncFileIO::read (buildPath (obj->path, obj->name), priority, callback, context);
+
+   // Volume files are already in memory or read through their archive so open them now.
+   return AsyncFileIO::complete (openStream (obj), callback, context);
+}
+
+//------------------------------------------------------------------------------
+
 void ResManager::closeStream(Stream* stream)
 {
    // FIXME [tom, 10/26/2006] Note that this should really hand off to ZipArchive if it's
@@ -1072,6 +1236,49 @@ void ResManager::purge ()
 
 //------------------------------------------------------------------------------
 
+void ResManager::purgeCreatedBy (RESOURCE_CREATE_FN createFn)
+{
+   ResourceObject *obj = timeoutList.getNext ();
+   while (obj)
+   {
+      ResourceObject *temp = obj;
+      obj = obj->next;
+
+      if (getCreateFunction (temp->name) != createFn)
+         continue;
+
+      temp->unlink ();
+      temp->destruct ();
+      if (temp->flags & ResourceObject::Added)
+         freeResource (temp);
+   }
+}
+
+//------------------------------------------------------------------------------
+
+bool ResManager::purgeOldestCreatedBy (RESOURCE_CREATE_FN createFn)
+{
+   // Resources are linked at the head of the timeoutList when unlocked so the oldest is the last found.
+   ResourceObject *oldest = NULL;
+   for (ResourceObject *obj = timeoutList.getNext (); obj; obj = obj->next)
+   {
+      if (getCreateFunction (obj->name) == createFn)
+         oldest = obj;
+   }
+
+   if (!oldest)
+      return false;
+
+   oldest->unlink ();
+   oldest->destruct ();
+   if (oldest->flags & ResourceObject::Added)
+      freeResource (oldest);
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+
 void ResManager::purge (ResourceObject * obj)
 {
    AssertFatal (obj->lockCount == 0,
@@ -1254,6 +1461,8 @@ ResourceObject * ResManager::createZipResource (StringTableEntry path, StringTab
    newRO->crc = InvalidCRC;
    newRO->mZipArchive = NULL;
    newRO->mCentralDir = NULL;
+   newRO->mPackFile = NULL;
+   newRO->mPackEntry = NULL;
 
    return newRO;
 }
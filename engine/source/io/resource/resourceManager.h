@@ -40,11 +40,16 @@
 #include "algorithm/crc.h"
 #endif
 
+#ifndef _ASYNC_FILE_IO_H_
+#include "io/asyncFileIO.h"
+#endif
+
 class Stream;
 class FileStream;
 class ZipSubRStream;
 class ResManager;
 class FindMatch;
+class PackFile;
 
 namespace Zip
 {
@@ -169,9 +174,25 @@ public:
    S32 lockCount;                ///< Lock count; used to control load/unload of resource from memory.
    U32 crc;                      ///< CRC of resource.
 
+   /// @name CRC Cache
+   /// The CRC of the file contents is cached and reused whilst the size and
+   /// modification time of the file (or the zip or pack containing it) are unchanged.
+   /// @{
+
+   ///
+   bool mCrcCached;              ///< Is there a cached CRC?
+   U32 mCachedCrc;               ///< Cached CRC of resource.
+   U32 mCachedCrcInitialVal;     ///< Initial value the cached CRC was calculated with.
+   S32 mCachedCrcFileSize;       ///< File size when the CRC was cached.
+   FileTime mCachedCrcModifyTime;///< Modification time when the CRC was cached.
+   /// @}
+
    Zip::ZipArchive *mZipArchive; ///< The zip archive for reading from zips
    const Zip::CentralDir *mCentralDir; ///< The central directory for this file in the zip
 
+   PackFile *mPackFile;             ///< The pack file for reading from packs
+   const void *mPackEntry;          ///< The pack entry (a PackFile::Entry) for this file in the pack
+
    ResourceObject();
    ~ResourceObject() { unlink(); }
 
@@ -330,6 +351,8 @@ public:
 ///      - ResManager scans directory tree under listed base directories
 ///      - Any volume (.zip) file in the root directory of a mod is scanned
 ///        for resources.
+///      - Any pack (.pack) file found is mounted with its entries relative to
+///        the directory it is in.  Loose files override pack entries.
 ///      - Any files currently in the resource manager become memory resources.
 ///      - They can be "reattached" to the first file that matches the file name.
 ///
@@ -366,6 +389,9 @@ private:
    /// Scan a zip file for resources.
    bool scanZip(ResourceObject *zipObject);
 
+   /// Mount a pack file's entries as resources.
+   bool scanPack(ResourceObject *packObject);
+
    /// Create a ResourceObject from the given file.
    ResourceObject* createResource(StringTableEntry path, StringTableEntry file);
 
@@ -388,6 +414,15 @@ private:
 
    RegisteredExtension *registeredList;
 
+   /// Fetch the size and modification time used to validate a cached CRC.
+   bool getCrcFileStamp(ResourceObject *obj, S32 &fileSize, FileTime &modifyTime);
+
+   /// Fetch the cached CRC of a resource if it is still valid.
+   bool findCachedCrc(ResourceObject *obj, const U32 crcInitialVal, U32 &crcVal);
+
+   /// Cache the CRC of a resource.
+   void cacheCrc(ResourceObject *obj, const U32 crcInitialVal, const U32 crcVal);
+
    static const char *smExcludedDirectories;
    ResManager();
 public:
@@ -430,6 +465,12 @@ public:
    ResourceObject* load(const char * fileName, bool computeCRC = false);   ///< loads an instance of an object
    Stream*  openStream(const char * fileName);        ///< Opens a stream for an object
    Stream*  openStream(ResourceObject *object);       ///< Opens a stream for an object
+
+   /// Opens a stream for an object without blocking.  Loose files are read by AsyncFileIO on a
+   /// worker thread whereas files in zips and packs are opened immediately.  Either way the
+   /// callback is called, with the stream or NULL, from AsyncFileIO::processCompletions().
+   /// @return The AsyncFileIO request Id or zero if the file is not known.
+   U32      openStreamAsync(const char *fileName, AsyncFileIO::Priority priority, AsyncFileIO::CompletionCallback callback, void *context);
    void     closeStream(Stream *stream);              ///< Closes the stream
 
    /// Decrements the lock count of an object.  If the lock count is zero post-decrement,
@@ -457,6 +498,8 @@ public:
 
    void purge();                                      ///< Goes through the timeoutList and deletes it all.  BURN!!!
    void purge( ResourceObject *obj );                 ///< Deletes one resource object.
+   void purgeCreatedBy( RESOURCE_CREATE_FN createFn );///< Deletes the resources on the timeoutList created by the given function.
+   bool purgeOldestCreatedBy( RESOURCE_CREATE_FN createFn );///< Deletes the least recently used resource on the timeoutList created by the given function.
    void freeResource(ResourceObject *resObject);      ///< Frees a resource!
    void serialize(VectorPtr<const char *> &filenames);///< Sorts the resource objects
 
@@ -469,6 +512,7 @@ public:
    /// Computes the CRC of a file.
    ///
    /// By passing a different crcInitialVal, you can take the CRC of multiple files.
+   /// The CRC is cached and is not calculated again until the file changes.
    bool getCrc(const char * fileName, U32 & crcVal, const U32 crcInitialVal = INITIAL_CRC_VALUE );
 
    void setWriteablePath(const char *path);           ///< Sets the writable path for a file to the one given.
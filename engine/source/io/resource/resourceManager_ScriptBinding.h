@@ -51,6 +51,23 @@ ConsoleFunctionWithDocs(addResPath, ConsoleVoid, 2, 3, (path, [ignoreZips=false]
 }
 
 
+/*! Create a pack file of all the files in a directory.
+    A pack found by the resource manager is mounted with its entries relative to the directory it is in and is read directly from memory.
+    @param packFile The pack file to create.
+    @param sourcePath The directory to pack.
+    @param deflate Whether to deflate the entries that become smaller when deflated.
+    @return Whether the pack file was created or not.
+*/
+ConsoleFunctionWithDocs(createPackFile, ConsoleBool, 3, 4, (packFile, sourcePath, [deflate=false]?))
+{
+   char packFileBuffer[1024];
+   char sourcePathBuffer[1024];
+   Con::expandPath(packFileBuffer, sizeof(packFileBuffer), argv[1]);
+   Con::expandPath(sourcePathBuffer, sizeof(sourcePathBuffer), argv[2]);
+
+   return PackFile::build(packFileBuffer, sourcePathBuffer, argc > 3 ? dAtob(argv[3]) : false);
+}
+
 /*! Remove a path from the resource manager. Path is an expression as in findFirstFile()
 */
 ConsoleFunctionWithDocs(removeResPath, ConsoleVoid, 2, 2, (pathExpression))
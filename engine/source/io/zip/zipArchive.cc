@@ -34,6 +34,12 @@
 #include "io/zip/compressor.h"
 #include "io/zip/zipTempStream.h"
 #include "io/zip/zipStatFilter.h"
+#include "io/packFile.h"
+
+#include "platform/threads/threadPool.h"
+#include "debug/profiler.h"
+
+#include "zlib.h"
 
 #ifdef TORQUE_ZIP_AES
 #include "core/zipAESCryptStream.h"
@@ -73,6 +79,7 @@ ZipArchive::~ZipArchive()
 bool ZipArchive::readCentralDirectory()
 {
    mEntries.clear();
+   mEntryIndex.clear();
    SAFE_DELETE(mRoot);
    mRoot = new ZipEntry;
    mRoot->mName = StringTable->EmptyString;
@@ -145,10 +152,12 @@ void ZipArchive::insertEntry(ZipEntry *ze)
             newEntry = new ZipEntry;
             newEntry->mParent = root;
             newEntry->mName = StringTable->insert(ptr, true);
+            newEntry->mPath = StringTable->insert(path, true);
             newEntry->mIsDirectory = true;
             newEntry->mCD.setFilename(path);
 
             root->mChildren.insert(newEntry, ptr);
+            mEntryIndex[newEntry->mPath] = newEntry;
          }
 
          root = newEntry;
@@ -163,9 +172,11 @@ void ZipArchive::insertEntry(ZipEntry *ze)
          {
             ze->mIsDirectory = false;
             ze->mName = StringTable->insert(ptr, true);
+            ze->mPath = StringTable->insert(path, true);
             ze->mParent = root;
             root->mChildren.insert(ze, ptr);
             mEntries.push_back(ze);
+            mEntryIndex[ze->mPath] = ze;
          }
          else
          {
@@ -205,6 +216,11 @@ void ZipArchive::removeEntry(ZipEntry *ze)
       }
    }
    
+   // Remove from the index
+   typeEntryIndexHash::iterator indexItr = mEntryIndex.find(ze->mPath);
+   if(indexItr != mEntryIndex.end() && indexItr->value == ze)
+      mEntryIndex.erase(indexItr);
+
    // Remove from the tree
    VectorPtr<ZipEntry *>::iterator j;
    for(j = mEntries.begin();j != mEntries.end();++j)
@@ -242,35 +258,13 @@ ZipArchive::ZipEntry *ZipArchive::findZipEntry(const char *filename)
          path[i] = '/';
    }
 
-   ZipEntry *root = mRoot;
-
-   char *ptr = path, *slash = NULL;
-   do
-   {
-      slash = dStrchr(ptr, '/');
-      if(slash)
-      {
-         // Find the directory
-         *slash = 0;
-
-         ZipEntry *newEntry;
-         if((newEntry = root->mChildren.retrieve(ptr)) == NULL)
-            return NULL;
-
-         root = newEntry;
-
-         ptr = slash + 1;
-      }
-      else
-      {
-         // Find the file
-         ZipEntry *ze;
-         if((ze = root->mChildren.retrieve(ptr)) != NULL)
-            return ze;
-      }
-   } while(slash);
+   // If the path isn't in the string table then it can't be in the index either
+   StringTableEntry key = StringTable->lookup(path, true);
+   if(key == NULL)
+      return NULL;
 
-   return NULL;
+   typeEntryIndexHash::iterator itr = mEntryIndex.find(key);
+   return itr != mEntryIndex.end() ? itr->value : NULL;
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -598,6 +592,7 @@ void ZipArchive::closeArchive()
    SAFE_FREE(mFilename);
    SAFE_DELETE(mRoot);
    mEntries.clear();
+   mEntryIndex.clear();
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -762,6 +757,156 @@ Stream *ZipArchive::openFileForRead(const CentralDir *fileCD)
 
 //////////////////////////////////////////////////////////////////////////
 
+struct InflateJob
+{
+   const CentralDir *mCD;
+   U8 *mCompressed;
+   U8 *mData;
+   bool mSuccess;
+};
+
+static void inflateFilesRange(void *context, const U32 start, const U32 end)
+{
+   InflateJob *jobs = static_cast<InflateJob *>(context);
+
+   for(U32 i = start;i < end;++i)
+   {
+      InflateJob &job = jobs[i];
+      const CentralDir *cd = job.mCD;
+
+      if(cd->mCompressMethod == Stored)
+      {
+         // Stored files don't need inflating so just take the buffer
+         if(cd->mCompressedSize != cd->mUncompressedSize)
+            continue;
+
+         job.mData = job.mCompressed;
+         job.mCompressed = NULL;
+      }
+      else
+      {
+         // Inflate the whole file in one call as both buffers are in memory
+         job.mData = new U8[cd->mUncompressedSize > 0 ? cd->mUncompressedSize : 1];
+
+         z_stream zs;
+         dMemset(&zs, 0, sizeof(zs));
+         zs.next_in = job.mCompressed;
+         zs.avail_in = cd->mCompressedSize;
+         zs.next_out = job.mData;
+         zs.avail_out = cd->mUncompressedSize;
+
+         if(inflateInit2(&zs, -MAX_WBITS) != Z_OK)
+            continue;
+
+         const S32 ret = inflate(&zs, Z_FINISH);
+         inflateEnd(&zs);
+
+         if(ret != Z_STREAM_END || zs.total_out != cd->mUncompressedSize)
+            continue;
+      }
+
+      job.mSuccess = (calculateCRC(job.mData, cd->mUncompressedSize) ^ CRC_POSTCOND_VALUE) == cd->mCRC32;
+   }
+}
+
+U32 ZipArchive::readFiles(const Vector<const CentralDir *> &files, Vector<Stream *> &streams)
+{
+   PROFILE_SCOPE(ZipArchive_ReadFiles);
+
+   streams.setSize(files.size());
+   for(S32 i = 0;i < streams.size();++i)
+      streams[i] = NULL;
+
+   if(mMode != Read && mMode != ReadWrite)
+      return 0;
+
+   U32 readCount = 0;
+
+   // Read the compressed data. The zip stream isn't thread safe so this is
+   // done serially and only the inflating is done in parallel.
+   Vector<InflateJob> jobs;
+   Vector<S32> jobFiles;
+   for(S32 i = 0;i < files.size();++i)
+   {
+      const CentralDir *cd = files[i];
+
+      if((cd->mInternalFlags & (CDFileDeleted | CDFileOpen)) != 0)
+         continue;
+
+      if((cd->mInternalFlags & CDFileDirty) || (cd->mFlags & Encrypted) ||
+         (cd->mCompressMethod != Stored && cd->mCompressMethod != Deflated))
+      {
+         // Read anything we can't inflate directly through the usual streams
+         Stream *stream = openFileForRead(cd);
+         if(stream == NULL)
+            continue;
+
+         U8 *data = new U8[cd->mUncompressedSize > 0 ? cd->mUncompressedSize : 1];
+         if(stream->read(cd->mUncompressedSize, data))
+         {
+            streams[i] = new PackFileStream(data, cd->mUncompressedSize, true);
+            ++readCount;
+         }
+         else
+            delete [] data;
+
+         closeFile(stream);
+         continue;
+      }
+
+      FileHeader fh;
+      if(! mStream->setPosition(cd->mLocalHeadOffset) || ! fh.read(mStream))
+      {
+         if(isVerbose())
+            Con::errorf("ZipArchive::readFiles - %s: Could not read local header for file %s", mFilename ? mFilename : "<no filename>", cd->mFilename);
+         continue;
+      }
+
+      InflateJob job;
+      job.mCD = cd;
+      job.mCompressed = new U8[cd->mCompressedSize > 0 ? cd->mCompressedSize : 1];
+      job.mData = NULL;
+      job.mSuccess = false;
+
+      if(! mStream->read(cd->mCompressedSize, job.mCompressed))
+      {
+         if(isVerbose())
+            Con::errorf("ZipArchive::readFiles - %s: Could not read data for file %s", mFilename ? mFilename : "<no filename>", cd->mFilename);
+         delete [] job.mCompressed;
+         continue;
+      }
+
+      jobs.push_back(job);
+      jobFiles.push_back(i);
+   }
+
+   if(jobs.size() == 0)
+      return readCount;
+
+   ThreadPool::getGlobal()->parallelFor(inflateFilesRange, jobs.address(), jobs.size(), 1);
+
+   for(S32 i = 0;i < jobs.size();++i)
+   {
+      InflateJob &job = jobs[i];
+      delete [] job.mCompressed;
+
+      if(! job.mSuccess)
+      {
+         if(isVerbose())
+            Con::errorf("ZipArchive::readFiles - %s: Could not inflate file %s or it failed the CRC check", mFilename ? mFilename : "<no filename>", job.mCD->mFilename);
+         delete [] job.mData;
+         continue;
+      }
+
+      streams[jobFiles[i]] = new PackFileStream(job.mData, job.mCD->mUncompressedSize, true);
+      ++readCount;
+   }
+
+   return readCount;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 bool ZipArchive::addFile(const char *filename, const char *pathInZip, bool replace /* = true */)
 {
    Stream *source = ResourceManager->openStream(filename);
@@ -833,6 +978,60 @@ bool ZipArchive::extractFile(const char *pathInZip, const char *filename, bool *
    return ret;
 }
 
+U32 ZipArchive::extractAll(const char *path)
+{
+   PROFILE_SCOPE(ZipArchive_ExtractAll);
+
+   // Limit how much is held in memory at once
+   const U32 batchSizeLimit = 16 * 1024 * 1024;
+
+   U32 extractCount = 0;
+   S32 index = 0;
+
+   while(index < mEntries.size())
+   {
+      // Gather a batch of files
+      Vector<const CentralDir *> files;
+      U32 batchSize = 0;
+      while(index < mEntries.size() && (files.size() == 0 || batchSize < batchSizeLimit))
+      {
+         const CentralDir *cd = &mEntries[index++]->mCD;
+         files.push_back(cd);
+         batchSize += cd->mUncompressedSize;
+      }
+
+      Vector<Stream *> streams;
+      readFiles(files, streams);
+
+      // Write the batch out
+      for(S32 i = 0;i < files.size();++i)
+      {
+         if(streams[i] == NULL)
+            continue;
+
+         char filename[1024];
+         dSprintf(filename, sizeof(filename), "%s/%s", path, files[i]->mFilename);
+
+         FileStream dest;
+         if(ResourceManager->openFileForWrite(dest, filename))
+         {
+            if(dest.copyFrom(streams[i]))
+               ++extractCount;
+            else if(isVerbose())
+               Con::errorf("ZipArchive::extractAll - Could not write file %s", filename);
+
+            dest.close();
+         }
+         else if(isVerbose())
+            Con::errorf("ZipArchive::extractAll - Could not open file %s for writing", filename);
+
+         delete streams[i];
+      }
+   }
+
+   return extractCount;
+}
+
 bool ZipArchive::deleteFile(const char *filename)
 {
    if(mMode != Write && mMode != ReadWrite)
@@ -27,6 +27,7 @@
 #include "io/fileStream.h"
 
 #include "collection/simpleHashTable.h"
+#include "collection/hashTable.h"
 #include "collection/vector.h"
 
 #ifndef _ZIPARCHIVE_H_
@@ -282,6 +283,7 @@ protected:
       ZipEntry *mParent;
       
       StringTableEntry mName;
+      StringTableEntry mPath;
 
       bool mIsDirectory;
       CentralDir mCD;
@@ -291,6 +293,7 @@ protected:
       ZipEntry()
       {
          mName = "";
+         mPath = NULL;
          mIsDirectory = false;
       }
    };
@@ -303,9 +306,14 @@ protected:
 
    // mRoot forms a tree of entries for fast queries given a file path
    // mEntries allows easy iteration of the entire file list
+   // mEntryIndex maps the full path of every file and directory to its entry
+   // so that lookups don't have to walk the tree
    ZipEntry *mRoot;
    VectorPtr<ZipEntry *> mEntries;
 
+   typedef HashMap<StringTableEntry, ZipEntry *> typeEntryIndexHash;
+   typeEntryIndexHash mEntryIndex;
+
    const char *mFilename;
 
    VectorPtr<ZipTempStream *> mTempFiles;
@@ -477,6 +485,26 @@ public:
    /// @see ZipArchive::openFile(const char *, AccessMode), ZipArchive::closeFile()
    //////////////////////////////////////////////////////////////////////////
    Stream *openFileForRead(const CentralDir *fileCD);
+
+   //////////////////////////////////////////////////////////////////////////
+   /// @brief Read several files from the zip into memory
+   ///
+   /// The compressed data for each file is read from the zip first and the
+   /// files are then inflated in parallel on the global thread pool. This is
+   /// much faster than opening each file in turn when preloading many files.
+   ///
+   /// Each file is CRC checked. Files that are encrypted or have been modified
+   /// since the zip was opened are read serially through openFileForRead().
+   ///
+   /// The returned streams are memory streams owned by the caller and must be
+   /// deleted directly rather than through closeFile().
+   ///
+   /// @param files Central directories of the files to read
+   /// @param streams Receives a stream for each file or NULL if the file could not be read
+   /// @return Number of files successfully read
+   /// @see ZipArchive::openFileForRead(), ZipArchive::extractAll()
+   //////////////////////////////////////////////////////////////////////////
+   U32 readFiles(const Vector<const CentralDir *> &files, Vector<Stream *> &streams);
    // @}
 
    /// @name Archiver Style File Access Methods
@@ -525,6 +553,19 @@ public:
    //////////////////////////////////////////////////////////////////////////
    bool extractFile(const char *pathInZip, const char *filename, bool *crcFail = NULL);
 
+   //////////////////////////////////////////////////////////////////////////
+   /// @brief Extract every file in the zip
+   ///
+   /// Files are read in batches with readFiles() so that they are inflated in
+   /// parallel, then written below the specified path through the resource
+   /// manager.
+   ///
+   /// @param path Path on the local file system to extract to
+   /// @return Number of files extracted
+   /// @see ZipArchive::extractFile(), ZipArchive::readFiles()
+   //////////////////////////////////////////////////////////////////////////
+   U32 extractAll(const char *path);
+
    //////////////////////////////////////////////////////////////////////////
    /// @brief Delete a file from the zip
    ///
@@ -173,6 +173,11 @@ bool ZipObject::extractFile(const char *pathInZip, const char *filename)
    return mZipArchive->extractFile(pathInZip, filename);
 }
 
+S32 ZipObject::extractAll(const char *path)
+{
+   return mZipArchive->extractAll(path);
+}
+
 bool ZipObject::deleteFile(const char *filename)
 {
    return mZipArchive->deleteFile(filename);
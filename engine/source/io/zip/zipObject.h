@@ -70,6 +70,8 @@ public:
    bool addFile(const char *filename, const char *pathInZip, bool replace = true);
    /// @see Zip::ZipArchive::extractFile()
    bool extractFile(const char *pathInZip, const char *filename);
+   /// @see Zip::ZipArchive::extractAll()
+   S32 extractAll(const char *path);
    /// @see Zip::ZipArchive::deleteFile()
    bool deleteFile(const char *filename);
 
@@ -137,6 +137,16 @@ ConsoleMethodWithDocs(ZipObject, extractFile, ConsoleBool, 4, 4, (pathInZip, fil
    return object->extractFile(argv[2], argv[3]);
 }
 
+/*! Extract every file in the zip.
+    Files are inflated in parallel so this is much faster than extracting each file in turn.
+    @param path The path to extract the files to
+    @return Returns the number of files extracted
+*/
+ConsoleMethodWithDocs(ZipObject, extractAll, ConsoleInt, 3, 3, (path))
+{
+   return object->extractAll(argv[2]);
+}
+
 /*! Delete a file from the zip 
     @param pathInZip The full internal path of the file
     @return Returns true on success and false otherwise.
@@ -25,7 +25,7 @@
 
 
 const U32 ZipSubRStream::csm_streamCaps      = U32(Stream::StreamRead) | U32(Stream::StreamPosition);
-const U32 ZipSubRStream::csm_inputBufferSize = 4096;
+const U32 ZipSubRStream::csm_inputBufferSize = 64 * 1024;
 
 const U32 ZipSubWStream::csm_streamCaps      = U32(Stream::StreamWrite);
 const U32 ZipSubWStream::csm_bufferSize      = (2048 * 1024);
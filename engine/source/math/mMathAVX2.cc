@@ -0,0 +1,361 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "math/mMathFn.h"
+
+// The AVX2 versions are built with a per-function target so the rest of the engine can still run on
+// any x86 CPU.  They're only installed when the CPU (and OS) report AVX2 support.
+#if defined(_MSC_VER) && (_MSC_VER >= 1700) && (defined(_M_IX86) || defined(_M_X64))
+#define ADD_AVX2_FN
+#define AVX2_TARGET
+#elif (defined(__clang__) || (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)))) && (defined(__i386__) || defined(__x86_64__))
+#define ADD_AVX2_FN
+#define AVX2_TARGET __attribute__((target("avx2")))
+#endif
+
+#if defined(ADD_AVX2_FN)
+#include <immintrin.h>
+
+extern void m_spatial2F_bulk_interpolate_C(const F32* preTickX, const F32* preTickY, const F32* preTickAngle,
+                                           const F32* tickX, const F32* tickY, const F32* tickAngle,
+                                           const U8* dirty, const U32 count, const F32 factor,
+                                           F32* renderX, F32* renderY, F32* renderAngle);
+
+extern void m_point2F_bulk_dot_C(const F32* refVector, const F32* dotPoints, const U32 numPoints, F32* output);
+
+extern void m_f32_bulk_scale_clamp_C(const F32* values, const F32* scales, const U32 count, const F32 minValue, const F32 maxValue, F32* output);
+
+extern void m_point2F_bulk_scale_clamp_C(const F32* points, const F32* scalesX, const F32* scalesY, const U32 count,
+                                         const F32* minimum, const F32* maximum, F32* output);
+
+extern void m_particle2F_bulk_integrate_C(F32* positions, F32* velocities, const F32* speeds, const F32* forces,
+                                          const F32* forceDirection, const F32 forceScale, const U32 count, const F32 elapsedTime);
+
+extern void m_point2F_bulk_transform_C(const F32* transform, const F32* points, const U32 count, F32* output);
+
+extern U32 m_aabb2F_bulk_overlap_C(const F32* aabbs, const U32 count, const F32* queryAABB, U8* results);
+
+/// AVX2 2D point transform.
+/// Eight points are de-interleaved, transformed and re-interleaved at a time.  The de-interleave
+/// leaves the points in lane order which the re-interleave undoes so no cross-lane permute is needed.
+AVX2_TARGET void AVX2_Point2F_Bulk_Transform(const F32* transform,
+                                             const F32* points,
+                                             const U32  count,
+                                             F32*       output)
+{
+   const __m256 vTranslateX = _mm256_set1_ps(transform[0]);
+   const __m256 vTranslateY = _mm256_set1_ps(transform[1]);
+   const __m256 vSin = _mm256_set1_ps(transform[2]);
+   const __m256 vCos = _mm256_set1_ps(transform[3]);
+
+   const U32 vectorCount = count & ~7;
+   U32 i = 0;
+   for (; i < vectorCount; i += 8)
+   {
+      const __m256 vPoints0123 = _mm256_loadu_ps(points + i*2);
+      const __m256 vPoints4567 = _mm256_loadu_ps(points + i*2 + 8);
+      const __m256 vX = _mm256_shuffle_ps(vPoints0123, vPoints4567, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vY = _mm256_shuffle_ps(vPoints0123, vPoints4567, _MM_SHUFFLE(3, 1, 3, 1));
+
+      const __m256 vResultX = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(vCos, vX), _mm256_mul_ps(vSin, vY)), vTranslateX);
+      const __m256 vResultY = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vSin, vX), _mm256_mul_ps(vCos, vY)), vTranslateY);
+
+      _mm256_storeu_ps(output + i*2,     _mm256_unpacklo_ps(vResultX, vResultY));
+      _mm256_storeu_ps(output + i*2 + 8, _mm256_unpackhi_ps(vResultX, vResultY));
+   }
+
+   // Remaining points.
+   if (i < count)
+      m_point2F_bulk_transform_C(transform, points + i*2, count - i, output + i*2);
+}
+
+/// AVX2 AABB overlap.
+/// Eight AABBs are transposed into separate bound vectors and tested at a time.
+AVX2_TARGET U32 AVX2_AABB2F_Bulk_Overlap(const F32* aabbs,
+                                         const U32  count,
+                                         const F32* queryAABB,
+                                         U8*        results)
+{
+   const __m256 vQueryLowerX = _mm256_set1_ps(queryAABB[0]);
+   const __m256 vQueryLowerY = _mm256_set1_ps(queryAABB[1]);
+   const __m256 vQueryUpperX = _mm256_set1_ps(queryAABB[2]);
+   const __m256 vQueryUpperY = _mm256_set1_ps(queryAABB[3]);
+
+   U32 overlapCount = 0;
+
+   const U32 vectorCount = count & ~7;
+   U32 i = 0;
+   for (; i < vectorCount; i += 8)
+   {
+      __m128 vLowerX0 = _mm_loadu_ps(aabbs + i*4);
+      __m128 vLowerY0 = _mm_loadu_ps(aabbs + i*4 + 4);
+      __m128 vUpperX0 = _mm_loadu_ps(aabbs + i*4 + 8);
+      __m128 vUpperY0 = _mm_loadu_ps(aabbs + i*4 + 12);
+      _MM_TRANSPOSE4_PS(vLowerX0, vLowerY0, vUpperX0, vUpperY0);
+
+      __m128 vLowerX1 = _mm_loadu_ps(aabbs + i*4 + 16);
+      __m128 vLowerY1 = _mm_loadu_ps(aabbs + i*4 + 20);
+      __m128 vUpperX1 = _mm_loadu_ps(aabbs + i*4 + 24);
+      __m128 vUpperY1 = _mm_loadu_ps(aabbs + i*4 + 28);
+      _MM_TRANSPOSE4_PS(vLowerX1, vLowerY1, vUpperX1, vUpperY1);
+
+      const __m256 vLowerX = _mm256_insertf128_ps(_mm256_castps128_ps256(vLowerX0), vLowerX1, 1);
+      const __m256 vLowerY = _mm256_insertf128_ps(_mm256_castps128_ps256(vLowerY0), vLowerY1, 1);
+      const __m256 vUpperX = _mm256_insertf128_ps(_mm256_castps128_ps256(vUpperX0), vUpperX1, 1);
+      const __m256 vUpperY = _mm256_insertf128_ps(_mm256_castps128_ps256(vUpperY0), vUpperY1, 1);
+
+      const __m256 vOverlap = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(vLowerX, vQueryUpperX, _CMP_LE_OQ), _mm256_cmp_ps(vLowerY, vQueryUpperY, _CMP_LE_OQ)),
+                                            _mm256_and_ps(_mm256_cmp_ps(vUpperX, vQueryLowerX, _CMP_GE_OQ), _mm256_cmp_ps(vUpperY, vQueryLowerY, _CMP_GE_OQ)));
+
+      const S32 mask = _mm256_movemask_ps(vOverlap);
+      for (U32 n = 0; n < 8; n++)
+      {
+         results[i+n] = (U8)((mask >> n) & 1);
+         overlapCount += results[i+n];
+      }
+   }
+
+   // Remaining AABBs.
+   if (i < count)
+      overlapCount += m_aabb2F_bulk_overlap_C(aabbs + i*4, count - i, queryAABB, results + i);
+
+   return overlapCount;
+}
+
+/// AVX2 scale and clamp.
+/// Eight values are scaled and clamped at a time.
+AVX2_TARGET void AVX2_F32_Bulk_Scale_Clamp(const F32* values,
+                                           const F32* scales,
+                                           const U32  count,
+                                           const F32  minValue,
+                                           const F32  maxValue,
+                                           F32*       output)
+{
+   const __m256 vMin = _mm256_set1_ps(minValue);
+   const __m256 vMax = _mm256_set1_ps(maxValue);
+
+   const U32 vectorCount = count & ~7;
+   U32 i = 0;
+   for (; i < vectorCount; i += 8)
+   {
+      const __m256 vScaled = _mm256_mul_ps(_mm256_loadu_ps(values + i), _mm256_loadu_ps(scales + i));
+      _mm256_storeu_ps(output + i, _mm256_min_ps(_mm256_max_ps(vScaled, vMin), vMax));
+   }
+
+   // Remaining values.
+   if (i < count)
+      m_f32_bulk_scale_clamp_C(values + i, scales + i, count - i, minValue, maxValue, output + i);
+}
+
+/// AVX2 2D point scale and clamp.
+/// Eight points are scaled and clamped at a time with the x/y scales interleaved to match the points.
+AVX2_TARGET void AVX2_Point2F_Bulk_Scale_Clamp(const F32* points,
+                                               const F32* scalesX,
+                                               const F32* scalesY,
+                                               const U32  count,
+                                               const F32* minimum,
+                                               const F32* maximum,
+                                               F32*       output)
+{
+   const __m256 vMin = _mm256_setr_ps(minimum[0], minimum[1], minimum[0], minimum[1], minimum[0], minimum[1], minimum[0], minimum[1]);
+   const __m256 vMax = _mm256_setr_ps(maximum[0], maximum[1], maximum[0], maximum[1], maximum[0], maximum[1], maximum[0], maximum[1]);
+
+   const U32 vectorCount = count & ~7;
+   U32 i = 0;
+   for (; i < vectorCount; i += 8)
+   {
+      // Interleave the scales (the unpacks work per 128-bit lane so the halves are swapped back into order).
+      const __m256 vScaleX = _mm256_loadu_ps(scalesX + i);
+      const __m256 vScaleY = _mm256_loadu_ps(scalesY + i);
+      const __m256 vScaleLow = _mm256_unpacklo_ps(vScaleX, vScaleY);
+      const __m256 vScaleHigh = _mm256_unpackhi_ps(vScaleX, vScaleY);
+      const __m256 vScale0123 = _mm256_permute2f128_ps(vScaleLow, vScaleHigh, 0x20);
+      const __m256 vScale4567 = _mm256_permute2f128_ps(vScaleLow, vScaleHigh, 0x31);
+
+      const __m256 vScaled0123 = _mm256_mul_ps(_mm256_loadu_ps(points + i*2),     vScale0123);
+      const __m256 vScaled4567 = _mm256_mul_ps(_mm256_loadu_ps(points + i*2 + 8), vScale4567);
+      _mm256_storeu_ps(output + i*2,     _mm256_min_ps(_mm256_max_ps(vScaled0123, vMin), vMax));
+      _mm256_storeu_ps(output + i*2 + 8, _mm256_min_ps(_mm256_max_ps(vScaled4567, vMin), vMax));
+   }
+
+   // Remaining points.
+   if (i < count)
+      m_point2F_bulk_scale_clamp_C(points + i*2, scalesX + i, scalesY + i, count - i, minimum, maximum, output + i*2);
+}
+
+/// AVX2 particle integration.
+/// Eight particles are integrated at a time with the per-particle force and speed duplicated across each x/y pair.
+AVX2_TARGET void AVX2_Particle2F_Bulk_Integrate(F32*       positions,
+                                                F32*       velocities,
+                                                const F32* speeds,
+                                                const F32* forces,
+                                                const F32* forceDirection,
+                                                const F32  forceScale,
+                                                const U32  count,
+                                                const F32  elapsedTime)
+{
+   const __m256 vDirection = _mm256_setr_ps(forceDirection[0], forceDirection[1], forceDirection[0], forceDirection[1],
+                                            forceDirection[0], forceDirection[1], forceDirection[0], forceDirection[1]);
+   const __m256 vForceScale = _mm256_set1_ps(forceScale);
+   const __m256 vElapsedTime = _mm256_set1_ps(elapsedTime);
+
+   const U32 vectorCount = count & ~7;
+   U32 i = 0;
+   for (; i < vectorCount; i += 8)
+   {
+      // Time-integrated force and speed.
+      const __m256 vForce = _mm256_mul_ps(_mm256_mul_ps(_mm256_loadu_ps(forces + i), vForceScale), vElapsedTime);
+      const __m256 vSpeed = _mm256_mul_ps(_mm256_loadu_ps(speeds + i), vElapsedTime);
+
+      // Duplicate across the x/y pairs.
+      const __m256 vForceLow = _mm256_unpacklo_ps(vForce, vForce);
+      const __m256 vForceHigh = _mm256_unpackhi_ps(vForce, vForce);
+      const __m256 vSpeedLow = _mm256_unpacklo_ps(vSpeed, vSpeed);
+      const __m256 vSpeedHigh = _mm256_unpackhi_ps(vSpeed, vSpeed);
+      const __m256 vForce0123 = _mm256_permute2f128_ps(vForceLow, vForceHigh, 0x20);
+      const __m256 vForce4567 = _mm256_permute2f128_ps(vForceLow, vForceHigh, 0x31);
+      const __m256 vSpeed0123 = _mm256_permute2f128_ps(vSpeedLow, vSpeedHigh, 0x20);
+      const __m256 vSpeed4567 = _mm256_permute2f128_ps(vSpeedLow, vSpeedHigh, 0x31);
+
+      // Velocity.
+      const __m256 vVelocity0123 = _mm256_add_ps(_mm256_loadu_ps(velocities + i*2),     _mm256_mul_ps(vDirection, vForce0123));
+      const __m256 vVelocity4567 = _mm256_add_ps(_mm256_loadu_ps(velocities + i*2 + 8), _mm256_mul_ps(vDirection, vForce4567));
+      _mm256_storeu_ps(velocities + i*2,     vVelocity0123);
+      _mm256_storeu_ps(velocities + i*2 + 8, vVelocity4567);
+
+      // Position.
+      _mm256_storeu_ps(positions + i*2,     _mm256_add_ps(_mm256_loadu_ps(positions + i*2),     _mm256_mul_ps(vVelocity0123, vSpeed0123)));
+      _mm256_storeu_ps(positions + i*2 + 8, _mm256_add_ps(_mm256_loadu_ps(positions + i*2 + 8), _mm256_mul_ps(vVelocity4567, vSpeed4567)));
+   }
+
+   // Remaining particles.
+   if (i < count)
+      m_particle2F_bulk_integrate_C(positions + i*2, velocities + i*2, speeds + i, forces + i, forceDirection, forceScale, count - i, elapsedTime);
+}
+
+/// AVX2 2D point dot products.
+/// Eight points are de-interleaved and dotted at a time.  The de-interleave leaves pairs of results
+/// out of order across the 128-bit lanes so they're permuted back before storing.
+AVX2_TARGET void AVX2_Point2F_Bulk_Dot(const F32* refVector,
+                                       const F32* dotPoints,
+                                       const U32  numPoints,
+                                       F32*       output)
+{
+   const __m256 vRefX = _mm256_set1_ps(refVector[0]);
+   const __m256 vRefY = _mm256_set1_ps(refVector[1]);
+
+   const U32 vectorCount = numPoints & ~7;
+   U32 i = 0;
+   for (; i < vectorCount; i += 8)
+   {
+      const __m256 vPoints0123 = _mm256_loadu_ps(dotPoints + i*2);
+      const __m256 vPoints4567 = _mm256_loadu_ps(dotPoints + i*2 + 8);
+      const __m256 vX = _mm256_shuffle_ps(vPoints0123, vPoints4567, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vY = _mm256_shuffle_ps(vPoints0123, vPoints4567, _MM_SHUFFLE(3, 1, 3, 1));
+
+      // The results are in the order 0, 1, 4, 5, 2, 3, 6, 7.
+      const __m256 vDot = _mm256_add_ps(_mm256_mul_ps(vX, vRefX), _mm256_mul_ps(vY, vRefY));
+      _mm256_storeu_ps(output + i, _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(vDot), _MM_SHUFFLE(3, 1, 2, 0))));
+   }
+
+   // Remaining points.
+   if (i < numPoints)
+      m_point2F_bulk_dot_C(refVector, dotPoints + i*2, numPoints - i, output + i);
+}
+
+/// AVX2 spatial interpolation.
+/// Eight entries are blended at a time and merged into the render arrays using the dirty flags as a mask.
+/// Groups of eight clean entries (typically sleeping objects) are skipped entirely.
+AVX2_TARGET void AVX2_Spatial2F_Bulk_Interpolate(const F32* preTickX,
+                                                 const F32* preTickY,
+                                                 const F32* preTickAngle,
+                                                 const F32* tickX,
+                                                 const F32* tickY,
+                                                 const F32* tickAngle,
+                                                 const U8*  dirty,
+                                                 const U32  count,
+                                                 const F32  factor,
+                                                 F32*       renderX,
+                                                 F32*       renderY,
+                                                 F32*       renderAngle)
+{
+   // The start of the tick is a straight copy so leave it to the C version.
+   if (factor >= 1.0f)
+   {
+      m_spatial2F_bulk_interpolate_C(preTickX, preTickY, preTickAngle, tickX, tickY, tickAngle, dirty, count, factor, renderX, renderY, renderAngle);
+      return;
+   }
+
+   const __m256 vFactor  = _mm256_set1_ps(factor);
+   const __m256 vPi      = _mm256_set1_ps(M_PI_F);
+   const __m256 vNegPi   = _mm256_set1_ps(-M_PI_F);
+   const __m256 v2Pi     = _mm256_set1_ps(M_2PI_F);
+
+   const U32 vectorCount = count & ~7;
+   U32 i = 0;
+   for (; i < vectorCount; i += 8)
+   {
+      // Skip if nothing is dirty.
+      const __m128i vDirtyBytes = _mm_loadl_epi64((const __m128i*)(dirty + i));
+      if ((_mm_movemask_epi8(_mm_cmpeq_epi8(vDirtyBytes, _mm_setzero_si128())) & 0xFF) == 0xFF)
+         continue;
+
+      const __m256 vMask = _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_cvtepu8_epi32(vDirtyBytes), _mm256_setzero_si256()));
+
+      // Position.
+      const __m256 vTickX = _mm256_loadu_ps(tickX + i);
+      const __m256 vTickY = _mm256_loadu_ps(tickY + i);
+      const __m256 vRenderX = _mm256_sub_ps(vTickX, _mm256_mul_ps(_mm256_sub_ps(vTickX, _mm256_loadu_ps(preTickX + i)), vFactor));
+      const __m256 vRenderY = _mm256_sub_ps(vTickY, _mm256_mul_ps(_mm256_sub_ps(vTickY, _mm256_loadu_ps(preTickY + i)), vFactor));
+
+      // Angle (shortest arc).
+      const __m256 vTickAngle = _mm256_loadu_ps(tickAngle + i);
+      __m256 vRelative = _mm256_sub_ps(vTickAngle, _mm256_loadu_ps(preTickAngle + i));
+      vRelative = _mm256_sub_ps(vRelative, _mm256_and_ps(_mm256_cmp_ps(vRelative, vPi, _CMP_GT_OQ), v2Pi));
+      vRelative = _mm256_add_ps(vRelative, _mm256_and_ps(_mm256_cmp_ps(vRelative, vNegPi, _CMP_LT_OQ), v2Pi));
+      const __m256 vRenderAngle = _mm256_sub_ps(vTickAngle, _mm256_mul_ps(vRelative, vFactor));
+
+      // Merge the dirty entries.
+      _mm256_storeu_ps(renderX + i,     _mm256_blendv_ps(_mm256_loadu_ps(renderX + i),     vRenderX,     vMask));
+      _mm256_storeu_ps(renderY + i,     _mm256_blendv_ps(_mm256_loadu_ps(renderY + i),     vRenderY,     vMask));
+      _mm256_storeu_ps(renderAngle + i, _mm256_blendv_ps(_mm256_loadu_ps(renderAngle + i), vRenderAngle, vMask));
+   }
+
+   // Remaining entries.
+   if (i < count)
+      m_spatial2F_bulk_interpolate_C(preTickX + i, preTickY + i, preTickAngle + i, tickX + i, tickY + i, tickAngle + i, dirty + i, count - i, factor, renderX + i, renderY + i, renderAngle + i);
+}
+#endif
+
+
+void mInstall_Library_AVX2()
+{
+#if defined(ADD_AVX2_FN)
+   m_spatial2F_bulk_interpolate = AVX2_Spatial2F_Bulk_Interpolate;
+   m_point2F_bulk_dot = AVX2_Point2F_Bulk_Dot;
+   m_f32_bulk_scale_clamp = AVX2_F32_Bulk_Scale_Clamp;
+   m_point2F_bulk_scale_clamp = AVX2_Point2F_Bulk_Scale_Clamp;
+   m_particle2F_bulk_integrate = AVX2_Particle2F_Bulk_Integrate;
+   m_point2F_bulk_transform = AVX2_Point2F_Bulk_Transform;
+   m_aabb2F_bulk_overlap = AVX2_AABB2F_Bulk_Overlap;
+#endif
+}
@@ -70,6 +70,12 @@ extern void (*m_point3F_bulk_dot)(const F32* refVector,
                                   const U32  numPoints,
                                   const U32  pointStride,
                                   F32*       output);
+// Dots "numPoints" tightly packed 2D points with "refVector".
+// Every version multiplies then adds without fusing so the results are bitwise identical to the C version.
+extern void (*m_point2F_bulk_dot)(const F32* refVector,
+                                  const F32* dotPoints,
+                                  const U32  numPoints,
+                                  F32*       output);
 extern void (*m_point3F_bulk_dot_indexed)(const F32* refVector,
                                           const F32* dotPoints,
                                           const U32  numPoints,
@@ -77,6 +83,79 @@ extern void (*m_point3F_bulk_dot_indexed)(const F32* refVector,
                                           const U32* pointIndices,
                                           F32*       output);
 
+// Interpolates separate x/y/angle arrays from the "tick" spatials back towards the "pre-tick" spatials by "factor".
+// Only entries whose "dirty" flag is set are written.  Angles are blended along the shortest arc.
+extern void (*m_spatial2F_bulk_interpolate)(const F32* preTickX,
+                                            const F32* preTickY,
+                                            const F32* preTickAngle,
+                                            const F32* tickX,
+                                            const F32* tickY,
+                                            const F32* tickAngle,
+                                            const U8*  dirty,
+                                            const U32  count,
+                                            const F32  factor,
+                                            F32*       renderX,
+                                            F32*       renderY,
+                                            F32*       renderAngle);
+
+// Scales "count" values by their matching scales clamping the results to [minValue, maxValue].
+extern void (*m_f32_bulk_scale_clamp)(const F32* values,
+                                      const F32* scales,
+                                      const U32  count,
+                                      const F32  minValue,
+                                      const F32  maxValue,
+                                      F32*       output);
+
+// Scales "count" tightly packed 2D points by separate x/y scales clamping each component to [minimum, maximum].
+extern void (*m_point2F_bulk_scale_clamp)(const F32* points,
+                                          const F32* scalesX,
+                                          const F32* scalesY,
+                                          const U32  count,
+                                          const F32* minimum,
+                                          const F32* maximum,
+                                          F32*       output);
+
+// Time-integrates "count" tightly packed 2D particle positions and velocities.
+// The fixed "forceDirection" scaled by each force is added to the velocity which is then scaled by each speed and added to the position.
+extern void (*m_particle2F_bulk_integrate)(F32*       positions,
+                                           F32*       velocities,
+                                           const F32* speeds,
+                                           const F32* forces,
+                                           const F32* forceDirection,
+                                           const F32  forceScale,
+                                           const U32  count,
+                                           const F32  elapsedTime);
+
+// Transforms "count" tightly packed 2D points by a single transform laid out as a b2Transform (x, y, sin, cos).
+// The output may be the input.
+extern void (*m_point2F_bulk_transform)(const F32* transform,
+                                        const F32* points,
+                                        const U32  count,
+                                        F32*       output);
+
+// Calculates "count" OOBBs, each being the four "localVertices" scaled by the item's size then transformed by the item's transform.
+// Sizes are tightly packed 2D points and transforms are laid out as b2Transforms (x, y, sin, cos).
+// Each OOBB is written as four tightly packed 2D points.
+extern void (*m_oobb2F_bulk_calculate)(const F32* localVertices,
+                                       const F32* sizes,
+                                       const F32* transforms,
+                                       const U32  count,
+                                       F32*       output);
+
+// Calculates the AABB of "count" OOBBs, each given as four tightly packed 2D points.
+// Each AABB is written laid out as a b2AABB (lower x, lower y, upper x, upper y).
+extern void (*m_oobb2F_bulk_aabb)(const F32* oobbs,
+                                  const U32  count,
+                                  F32*       output);
+
+// Tests "count" AABBs for overlap with "queryAABB", all laid out as b2AABBs, writing one for each overlap and zero otherwise.
+// Touching AABBs overlap, as with b2TestOverlap().
+// Returns the number of overlaps.
+extern U32  (*m_aabb2F_bulk_overlap)(const F32* aabbs,
+                                     const U32  count,
+                                     const F32* queryAABB,
+                                     U8*        results);
+
 extern void (*m_quatF_set_matF)( F32 x, F32 y, F32 z, F32 w, F32* m );
 
 extern void (*m_matF_set_euler)(const F32 *e, F32 *result);
@@ -0,0 +1,380 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "math/mMathFn.h"
+
+// The NEON versions are only built when the compiler targets NEON (e.g. "armeabi-v7a" built with NEON or arm64).
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#define ADD_NEON_FN
+#include <arm_neon.h>
+
+extern void m_spatial2F_bulk_interpolate_C(const F32* preTickX, const F32* preTickY, const F32* preTickAngle,
+                                           const F32* tickX, const F32* tickY, const F32* tickAngle,
+                                           const U8* dirty, const U32 count, const F32 factor,
+                                           F32* renderX, F32* renderY, F32* renderAngle);
+
+extern void m_point2F_bulk_dot_C(const F32* refVector, const F32* dotPoints, const U32 numPoints, F32* output);
+
+extern void m_f32_bulk_scale_clamp_C(const F32* values, const F32* scales, const U32 count, const F32 minValue, const F32 maxValue, F32* output);
+
+extern void m_point2F_bulk_scale_clamp_C(const F32* points, const F32* scalesX, const F32* scalesY, const U32 count,
+                                         const F32* minimum, const F32* maximum, F32* output);
+
+extern void m_particle2F_bulk_integrate_C(F32* positions, F32* velocities, const F32* speeds, const F32* forces,
+                                          const F32* forceDirection, const F32 forceScale, const U32 count, const F32 elapsedTime);
+
+extern void m_point2F_bulk_transform_C(const F32* transform, const F32* points, const U32 count, F32* output);
+
+extern U32 m_aabb2F_bulk_overlap_C(const F32* aabbs, const U32 count, const F32* queryAABB, U8* results);
+
+/// NEON matrix multiply.
+/// Each result row is the rows of B scaled by the elements of the matching row of A, summed in the
+/// same order as the C version.
+void NEON_MatrixF_x_MatrixF(const F32* matA,
+                            const F32* matB,
+                            F32*       result)
+{
+   const float32x4_t vRowB0 = vld1q_f32(matB);
+   const float32x4_t vRowB1 = vld1q_f32(matB + 4);
+   const float32x4_t vRowB2 = vld1q_f32(matB + 8);
+   const float32x4_t vRowB3 = vld1q_f32(matB + 12);
+
+   for (U32 row = 0; row < 4; row++)
+   {
+      const F32* rowA = matA + row*4;
+      float32x4_t vResult = vmulq_n_f32(vRowB0, rowA[0]);
+      vResult = vaddq_f32(vResult, vmulq_n_f32(vRowB1, rowA[1]));
+      vResult = vaddq_f32(vResult, vmulq_n_f32(vRowB2, rowA[2]));
+      vResult = vaddq_f32(vResult, vmulq_n_f32(vRowB3, rowA[3]));
+      vst1q_f32(result + row*4, vResult);
+   }
+}
+
+/// NEON 2D point transform.
+/// Four points are de-interleaved, transformed and re-interleaved at a time.  Separate multiplies
+/// and adds are used so each lane rounds exactly like the C version.
+void NEON_Point2F_Bulk_Transform(const F32* transform,
+                                 const F32* points,
+                                 const U32  count,
+                                 F32*       output)
+{
+   const float32x4_t vTranslateX = vdupq_n_f32(transform[0]);
+   const float32x4_t vTranslateY = vdupq_n_f32(transform[1]);
+
+   const U32 vectorCount = count & ~3;
+   U32 i = 0;
+   for (; i < vectorCount; i += 4)
+   {
+      const float32x4x2_t vPoints = vld2q_f32(points + i*2);
+
+      float32x4x2_t vResult;
+      vResult.val[0] = vaddq_f32(vsubq_f32(vmulq_n_f32(vPoints.val[0], transform[3]), vmulq_n_f32(vPoints.val[1], transform[2])), vTranslateX);
+      vResult.val[1] = vaddq_f32(vaddq_f32(vmulq_n_f32(vPoints.val[0], transform[2]), vmulq_n_f32(vPoints.val[1], transform[3])), vTranslateY);
+      vst2q_f32(output + i*2, vResult);
+   }
+
+   // Remaining points.
+   if (i < count)
+      m_point2F_bulk_transform_C(transform, points + i*2, count - i, output + i*2);
+}
+
+/// NEON OOBB calculation.
+/// The four vertices of each OOBB are scaled and transformed together.
+void NEON_OOBB2F_Bulk_Calculate(const F32* localVertices,
+                                const F32* sizes,
+                                const F32* transforms,
+                                const U32  count,
+                                F32*       output)
+{
+   // De-interleave the local vertices once.
+   const float32x4x2_t vLocal = vld2q_f32(localVertices);
+
+   for (U32 i = 0; i < count; i++)
+   {
+      const F32* transform = transforms + i*4;
+      const float32x4_t vX = vmulq_n_f32(vLocal.val[0], sizes[i*2]);
+      const float32x4_t vY = vmulq_n_f32(vLocal.val[1], sizes[i*2+1]);
+
+      float32x4x2_t vResult;
+      vResult.val[0] = vaddq_f32(vsubq_f32(vmulq_n_f32(vX, transform[3]), vmulq_n_f32(vY, transform[2])), vdupq_n_f32(transform[0]));
+      vResult.val[1] = vaddq_f32(vaddq_f32(vmulq_n_f32(vX, transform[2]), vmulq_n_f32(vY, transform[3])), vdupq_n_f32(transform[1]));
+      vst2q_f32(output + i*8, vResult);
+   }
+}
+
+/// NEON OOBB to AABB.
+/// The x/y minimum and maximum of each OOBB are found together.
+void NEON_OOBB2F_Bulk_AABB(const F32* oobbs,
+                           const U32  count,
+                           F32*       output)
+{
+   for (U32 i = 0; i < count; i++)
+   {
+      const float32x4_t vVertices01 = vld1q_f32(oobbs + i*8);
+      const float32x4_t vVertices23 = vld1q_f32(oobbs + i*8 + 4);
+
+      // Reduce the four vertices to the x/y extremes.
+      const float32x4_t vMin = vminq_f32(vVertices01, vVertices23);
+      const float32x4_t vMax = vmaxq_f32(vVertices01, vVertices23);
+      vst1q_f32(output + i*4, vcombine_f32(vmin_f32(vget_low_f32(vMin), vget_high_f32(vMin)), vmax_f32(vget_low_f32(vMax), vget_high_f32(vMax))));
+   }
+}
+
+/// NEON AABB overlap.
+/// Four AABBs are de-interleaved into separate bound vectors and tested at a time.
+U32 NEON_AABB2F_Bulk_Overlap(const F32* aabbs,
+                             const U32  count,
+                             const F32* queryAABB,
+                             U8*        results)
+{
+   const float32x4_t vQueryLowerX = vdupq_n_f32(queryAABB[0]);
+   const float32x4_t vQueryLowerY = vdupq_n_f32(queryAABB[1]);
+   const float32x4_t vQueryUpperX = vdupq_n_f32(queryAABB[2]);
+   const float32x4_t vQueryUpperY = vdupq_n_f32(queryAABB[3]);
+
+   U32 overlapCount = 0;
+
+   const U32 vectorCount = count & ~3;
+   U32 i = 0;
+   for (; i < vectorCount; i += 4)
+   {
+      // The lanes are lower x, lower y, upper x and upper y.
+      const float32x4x4_t vBounds = vld4q_f32(aabbs + i*4);
+
+      const uint32x4_t vOverlap = vandq_u32(vandq_u32(vcleq_f32(vBounds.val[0], vQueryUpperX), vcleq_f32(vBounds.val[1], vQueryUpperY)),
+                                            vandq_u32(vcgeq_f32(vBounds.val[2], vQueryLowerX), vcgeq_f32(vBounds.val[3], vQueryLowerY)));
+
+      U32 lanes[4];
+      vst1q_u32(lanes, vshrq_n_u32(vOverlap, 31));
+      results[i]   = (U8)lanes[0];
+      results[i+1] = (U8)lanes[1];
+      results[i+2] = (U8)lanes[2];
+      results[i+3] = (U8)lanes[3];
+      overlapCount += lanes[0] + lanes[1] + lanes[2] + lanes[3];
+   }
+
+   // Remaining AABBs.
+   if (i < count)
+      overlapCount += m_aabb2F_bulk_overlap_C(aabbs + i*4, count - i, queryAABB, results + i);
+
+   return overlapCount;
+}
+
+/// NEON scale and clamp.
+/// Four values are scaled and clamped at a time.
+void NEON_F32_Bulk_Scale_Clamp(const F32* values,
+                               const F32* scales,
+                               const U32  count,
+                               const F32  minValue,
+                               const F32  maxValue,
+                               F32*       output)
+{
+   const float32x4_t vMin = vdupq_n_f32(minValue);
+   const float32x4_t vMax = vdupq_n_f32(maxValue);
+
+   const U32 vectorCount = count & ~3;
+   U32 i = 0;
+   for (; i < vectorCount; i += 4)
+   {
+      const float32x4_t vScaled = vmulq_f32(vld1q_f32(values + i), vld1q_f32(scales + i));
+      vst1q_f32(output + i, vminq_f32(vmaxq_f32(vScaled, vMin), vMax));
+   }
+
+   // Remaining values.
+   if (i < count)
+      m_f32_bulk_scale_clamp_C(values + i, scales + i, count - i, minValue, maxValue, output + i);
+}
+
+/// NEON 2D point scale and clamp.
+/// Four points are scaled and clamped at a time with the x/y scales interleaved to match the points.
+void NEON_Point2F_Bulk_Scale_Clamp(const F32* points,
+                                   const F32* scalesX,
+                                   const F32* scalesY,
+                                   const U32  count,
+                                   const F32* minimum,
+                                   const F32* maximum,
+                                   F32*       output)
+{
+   const F32 minimumLanes[4] = { minimum[0], minimum[1], minimum[0], minimum[1] };
+   const F32 maximumLanes[4] = { maximum[0], maximum[1], maximum[0], maximum[1] };
+   const float32x4_t vMin = vld1q_f32(minimumLanes);
+   const float32x4_t vMax = vld1q_f32(maximumLanes);
+
+   const U32 vectorCount = count & ~3;
+   U32 i = 0;
+   for (; i < vectorCount; i += 4)
+   {
+      // Interleave the scales.
+      const float32x4x2_t vScale = vzipq_f32(vld1q_f32(scalesX + i), vld1q_f32(scalesY + i));
+
+      const float32x4_t vScaled01 = vmulq_f32(vld1q_f32(points + i*2),     vScale.val[0]);
+      const float32x4_t vScaled23 = vmulq_f32(vld1q_f32(points + i*2 + 4), vScale.val[1]);
+      vst1q_f32(output + i*2,     vminq_f32(vmaxq_f32(vScaled01, vMin), vMax));
+      vst1q_f32(output + i*2 + 4, vminq_f32(vmaxq_f32(vScaled23, vMin), vMax));
+   }
+
+   // Remaining points.
+   if (i < count)
+      m_point2F_bulk_scale_clamp_C(points + i*2, scalesX + i, scalesY + i, count - i, minimum, maximum, output + i*2);
+}
+
+/// NEON particle integration.
+/// Four particles are integrated at a time with the per-particle force and speed duplicated across each x/y pair.
+void NEON_Particle2F_Bulk_Integrate(F32*       positions,
+                                    F32*       velocities,
+                                    const F32* speeds,
+                                    const F32* forces,
+                                    const F32* forceDirection,
+                                    const F32  forceScale,
+                                    const U32  count,
+                                    const F32  elapsedTime)
+{
+   const F32 directionLanes[4] = { forceDirection[0], forceDirection[1], forceDirection[0], forceDirection[1] };
+   const float32x4_t vDirection = vld1q_f32(directionLanes);
+
+   const U32 vectorCount = count & ~3;
+   U32 i = 0;
+   for (; i < vectorCount; i += 4)
+   {
+      // Time-integrated force and speed.
+      const float32x4_t vForce = vmulq_n_f32(vmulq_n_f32(vld1q_f32(forces + i), forceScale), elapsedTime);
+      const float32x4_t vSpeed = vmulq_n_f32(vld1q_f32(speeds + i), elapsedTime);
+      const float32x4x2_t vForcePairs = vzipq_f32(vForce, vForce);
+      const float32x4x2_t vSpeedPairs = vzipq_f32(vSpeed, vSpeed);
+
+      // Velocity.
+      const float32x4_t vVelocity01 = vaddq_f32(vld1q_f32(velocities + i*2),     vmulq_f32(vDirection, vForcePairs.val[0]));
+      const float32x4_t vVelocity23 = vaddq_f32(vld1q_f32(velocities + i*2 + 4), vmulq_f32(vDirection, vForcePairs.val[1]));
+      vst1q_f32(velocities + i*2,     vVelocity01);
+      vst1q_f32(velocities + i*2 + 4, vVelocity23);
+
+      // Position.
+      vst1q_f32(positions + i*2,     vaddq_f32(vld1q_f32(positions + i*2),     vmulq_f32(vVelocity01, vSpeedPairs.val[0])));
+      vst1q_f32(positions + i*2 + 4, vaddq_f32(vld1q_f32(positions + i*2 + 4), vmulq_f32(vVelocity23, vSpeedPairs.val[1])));
+   }
+
+   // Remaining particles.
+   if (i < count)
+      m_particle2F_bulk_integrate_C(positions + i*2, velocities + i*2, speeds + i, forces + i, forceDirection, forceScale, count - i, elapsedTime);
+}
+
+/// NEON 2D point dot products.
+/// Four points are de-interleaved and dotted at a time.  A separate multiply and add is used (rather
+/// than a multiply-accumulate) so each lane rounds exactly like the C version.
+void NEON_Point2F_Bulk_Dot(const F32* refVector,
+                           const F32* dotPoints,
+                           const U32  numPoints,
+                           F32*       output)
+{
+   const U32 vectorCount = numPoints & ~3;
+   U32 i = 0;
+   for (; i < vectorCount; i += 4)
+   {
+      const float32x4x2_t vPoints = vld2q_f32(dotPoints + i*2);
+      vst1q_f32(output + i, vaddq_f32(vmulq_n_f32(vPoints.val[0], refVector[0]), vmulq_n_f32(vPoints.val[1], refVector[1])));
+   }
+
+   // Remaining points.
+   if (i < numPoints)
+      m_point2F_bulk_dot_C(refVector, dotPoints + i*2, numPoints - i, output + i);
+}
+
+/// NEON spatial interpolation.
+/// Four entries are blended at a time and merged into the render arrays using the dirty flags as a mask.
+/// Groups of four clean entries (typically sleeping objects) are skipped entirely.
+void NEON_Spatial2F_Bulk_Interpolate(const F32* preTickX,
+                                     const F32* preTickY,
+                                     const F32* preTickAngle,
+                                     const F32* tickX,
+                                     const F32* tickY,
+                                     const F32* tickAngle,
+                                     const U8*  dirty,
+                                     const U32  count,
+                                     const F32  factor,
+                                     F32*       renderX,
+                                     F32*       renderY,
+                                     F32*       renderAngle)
+{
+   // The start of the tick is a straight copy so leave it to the C version.
+   if (factor >= 1.0f)
+   {
+      m_spatial2F_bulk_interpolate_C(preTickX, preTickY, preTickAngle, tickX, tickY, tickAngle, dirty, count, factor, renderX, renderY, renderAngle);
+      return;
+   }
+
+   const float32x4_t vPi    = vdupq_n_f32(M_PI_F);
+   const float32x4_t vNegPi = vdupq_n_f32(-M_PI_F);
+   const float32x4_t v2Pi   = vdupq_n_f32(M_2PI_F);
+   const float32x4_t vZero  = vdupq_n_f32(0.0f);
+
+   const U32 vectorCount = count & ~3;
+   U32 i = 0;
+   for (; i < vectorCount; i += 4)
+   {
+      // Skip if nothing is dirty.
+      if ((dirty[i] | dirty[i+1] | dirty[i+2] | dirty[i+3]) == 0)
+         continue;
+
+      const U32 dirtyLanes[4] = { dirty[i], dirty[i+1], dirty[i+2], dirty[i+3] };
+      const uint32x4_t vMask = vtstq_u32(vld1q_u32(dirtyLanes), vld1q_u32(dirtyLanes));
+
+      // Position.
+      const float32x4_t vTickX = vld1q_f32(tickX + i);
+      const float32x4_t vTickY = vld1q_f32(tickY + i);
+      const float32x4_t vRenderX = vmlsq_n_f32(vTickX, vsubq_f32(vTickX, vld1q_f32(preTickX + i)), factor);
+      const float32x4_t vRenderY = vmlsq_n_f32(vTickY, vsubq_f32(vTickY, vld1q_f32(preTickY + i)), factor);
+
+      // Angle (shortest arc).
+      const float32x4_t vTickAngle = vld1q_f32(tickAngle + i);
+      float32x4_t vRelative = vsubq_f32(vTickAngle, vld1q_f32(preTickAngle + i));
+      vRelative = vsubq_f32(vRelative, vbslq_f32(vcgtq_f32(vRelative, vPi), v2Pi, vZero));
+      vRelative = vaddq_f32(vRelative, vbslq_f32(vcltq_f32(vRelative, vNegPi), v2Pi, vZero));
+      const float32x4_t vRenderAngle = vmlsq_n_f32(vTickAngle, vRelative, factor);
+
+      // Merge the dirty entries.
+      vst1q_f32(renderX + i,     vbslq_f32(vMask, vRenderX,     vld1q_f32(renderX + i)));
+      vst1q_f32(renderY + i,     vbslq_f32(vMask, vRenderY,     vld1q_f32(renderY + i)));
+      vst1q_f32(renderAngle + i, vbslq_f32(vMask, vRenderAngle, vld1q_f32(renderAngle + i)));
+   }
+
+   // Remaining entries.
+   if (i < count)
+      m_spatial2F_bulk_interpolate_C(preTickX + i, preTickY + i, preTickAngle + i, tickX + i, tickY + i, tickAngle + i, dirty + i, count - i, factor, renderX + i, renderY + i, renderAngle + i);
+}
+#endif
+
+
+void mInstall_Library_NEON()
+{
+#if defined(ADD_NEON_FN)
+   m_matF_x_matF = NEON_MatrixF_x_MatrixF;
+   m_spatial2F_bulk_interpolate = NEON_Spatial2F_Bulk_Interpolate;
+   m_point2F_bulk_dot = NEON_Point2F_Bulk_Dot;
+   m_f32_bulk_scale_clamp = NEON_F32_Bulk_Scale_Clamp;
+   m_point2F_bulk_scale_clamp = NEON_Point2F_Bulk_Scale_Clamp;
+   m_particle2F_bulk_integrate = NEON_Particle2F_Bulk_Integrate;
+   m_point2F_bulk_transform = NEON_Point2F_Bulk_Transform;
+   m_oobb2F_bulk_calculate = NEON_OOBB2F_Bulk_Calculate;
+   m_oobb2F_bulk_aabb = NEON_OOBB2F_Bulk_AABB;
+   m_aabb2F_bulk_overlap = NEON_AABB2F_Bulk_Overlap;
+#endif
+}
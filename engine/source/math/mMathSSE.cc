@@ -121,6 +121,373 @@ void SSE_MatrixF_x_MatrixF(const F32 *matA, const F32 *matB, F32 *result)
 #endif
 
 
+// The intrinsic versions only need the compiler to target SSE; they're still only
+// installed when the CPU reports SSE support.
+#if defined(__SSE__) || (defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64)))
+#define ADD_SSE_INTRINSIC_FN
+#include <xmmintrin.h>
+
+extern void m_spatial2F_bulk_interpolate_C(const F32* preTickX, const F32* preTickY, const F32* preTickAngle,
+                                           const F32* tickX, const F32* tickY, const F32* tickAngle,
+                                           const U8* dirty, const U32 count, const F32 factor,
+                                           F32* renderX, F32* renderY, F32* renderAngle);
+
+extern void m_point2F_bulk_dot_C(const F32* refVector, const F32* dotPoints, const U32 numPoints, F32* output);
+
+extern void m_f32_bulk_scale_clamp_C(const F32* values, const F32* scales, const U32 count, const F32 minValue, const F32 maxValue, F32* output);
+
+extern void m_point2F_bulk_scale_clamp_C(const F32* points, const F32* scalesX, const F32* scalesY, const U32 count,
+                                         const F32* minimum, const F32* maximum, F32* output);
+
+extern void m_particle2F_bulk_integrate_C(F32* positions, F32* velocities, const F32* speeds, const F32* forces,
+                                          const F32* forceDirection, const F32 forceScale, const U32 count, const F32 elapsedTime);
+
+extern void m_point2F_bulk_transform_C(const F32* transform, const F32* points, const U32 count, F32* output);
+
+extern U32 m_aabb2F_bulk_overlap_C(const F32* aabbs, const U32 count, const F32* queryAABB, U8* results);
+
+/// SSE matrix multiply.
+/// Each result row is the rows of B scaled by the elements of the matching row of A, summed in the
+/// same order as the C version so the results match it exactly.  This replaces the assembly version.
+void SSE_MatrixF_x_MatrixF_Intrinsic(const F32* matA,
+                                     const F32* matB,
+                                     F32*       result)
+{
+   const __m128 vRowB0 = _mm_loadu_ps(matB);
+   const __m128 vRowB1 = _mm_loadu_ps(matB + 4);
+   const __m128 vRowB2 = _mm_loadu_ps(matB + 8);
+   const __m128 vRowB3 = _mm_loadu_ps(matB + 12);
+
+   for (U32 row = 0; row < 4; row++)
+   {
+      const F32* rowA = matA + row*4;
+      __m128 vResult = _mm_mul_ps(_mm_set1_ps(rowA[0]), vRowB0);
+      vResult = _mm_add_ps(vResult, _mm_mul_ps(_mm_set1_ps(rowA[1]), vRowB1));
+      vResult = _mm_add_ps(vResult, _mm_mul_ps(_mm_set1_ps(rowA[2]), vRowB2));
+      vResult = _mm_add_ps(vResult, _mm_mul_ps(_mm_set1_ps(rowA[3]), vRowB3));
+      _mm_storeu_ps(result + row*4, vResult);
+   }
+}
+
+/// SSE 2D point transform.
+/// Four points are de-interleaved, transformed and re-interleaved at a time.
+void SSE_Point2F_Bulk_Transform(const F32* transform,
+                                const F32* points,
+                                const U32  count,
+                                F32*       output)
+{
+   const __m128 vTranslateX = _mm_set1_ps(transform[0]);
+   const __m128 vTranslateY = _mm_set1_ps(transform[1]);
+   const __m128 vSin = _mm_set1_ps(transform[2]);
+   const __m128 vCos = _mm_set1_ps(transform[3]);
+
+   const U32 vectorCount = count & ~3;
+   U32 i = 0;
+   for (; i < vectorCount; i += 4)
+   {
+      // De-interleave the points.
+      const __m128 vPoints01 = _mm_loadu_ps(points + i*2);
+      const __m128 vPoints23 = _mm_loadu_ps(points + i*2 + 4);
+      const __m128 vX = _mm_shuffle_ps(vPoints01, vPoints23, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m128 vY = _mm_shuffle_ps(vPoints01, vPoints23, _MM_SHUFFLE(3, 1, 3, 1));
+
+      const __m128 vResultX = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(vCos, vX), _mm_mul_ps(vSin, vY)), vTranslateX);
+      const __m128 vResultY = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vSin, vX), _mm_mul_ps(vCos, vY)), vTranslateY);
+
+      _mm_storeu_ps(output + i*2,     _mm_unpacklo_ps(vResultX, vResultY));
+      _mm_storeu_ps(output + i*2 + 4, _mm_unpackhi_ps(vResultX, vResultY));
+   }
+
+   // Remaining points.
+   if (i < count)
+      m_point2F_bulk_transform_C(transform, points + i*2, count - i, output + i*2);
+}
+
+/// SSE OOBB calculation.
+/// The four vertices of each OOBB are scaled and transformed together.
+void SSE_OOBB2F_Bulk_Calculate(const F32* localVertices,
+                               const F32* sizes,
+                               const F32* transforms,
+                               const U32  count,
+                               F32*       output)
+{
+   // De-interleave the local vertices once.
+   const __m128 vLocal01 = _mm_loadu_ps(localVertices);
+   const __m128 vLocal23 = _mm_loadu_ps(localVertices + 4);
+   const __m128 vLocalX = _mm_shuffle_ps(vLocal01, vLocal23, _MM_SHUFFLE(2, 0, 2, 0));
+   const __m128 vLocalY = _mm_shuffle_ps(vLocal01, vLocal23, _MM_SHUFFLE(3, 1, 3, 1));
+
+   for (U32 i = 0; i < count; i++)
+   {
+      const F32* transform = transforms + i*4;
+      const __m128 vSin = _mm_set1_ps(transform[2]);
+      const __m128 vCos = _mm_set1_ps(transform[3]);
+
+      const __m128 vX = _mm_mul_ps(vLocalX, _mm_set1_ps(sizes[i*2]));
+      const __m128 vY = _mm_mul_ps(vLocalY, _mm_set1_ps(sizes[i*2+1]));
+
+      const __m128 vResultX = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(vCos, vX), _mm_mul_ps(vSin, vY)), _mm_set1_ps(transform[0]));
+      const __m128 vResultY = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vSin, vX), _mm_mul_ps(vCos, vY)), _mm_set1_ps(transform[1]));
+
+      _mm_storeu_ps(output + i*8,     _mm_unpacklo_ps(vResultX, vResultY));
+      _mm_storeu_ps(output + i*8 + 4, _mm_unpackhi_ps(vResultX, vResultY));
+   }
+}
+
+/// SSE OOBB to AABB.
+/// The x/y minimum and maximum of each OOBB are found together.
+void SSE_OOBB2F_Bulk_AABB(const F32* oobbs,
+                          const U32  count,
+                          F32*       output)
+{
+   for (U32 i = 0; i < count; i++)
+   {
+      const __m128 vVertices01 = _mm_loadu_ps(oobbs + i*8);
+      const __m128 vVertices23 = _mm_loadu_ps(oobbs + i*8 + 4);
+
+      // Reduce the four vertices to the x/y extremes in the low lanes.
+      __m128 vMin = _mm_min_ps(vVertices01, vVertices23);
+      __m128 vMax = _mm_max_ps(vVertices01, vVertices23);
+      vMin = _mm_min_ps(vMin, _mm_movehl_ps(vMin, vMin));
+      vMax = _mm_max_ps(vMax, _mm_movehl_ps(vMax, vMax));
+
+      _mm_storeu_ps(output + i*4, _mm_movelh_ps(vMin, vMax));
+   }
+}
+
+/// SSE AABB overlap.
+/// Four AABBs are transposed into separate bound vectors and tested at a time.
+U32 SSE_AABB2F_Bulk_Overlap(const F32* aabbs,
+                            const U32  count,
+                            const F32* queryAABB,
+                            U8*        results)
+{
+   const __m128 vQueryLowerX = _mm_set1_ps(queryAABB[0]);
+   const __m128 vQueryLowerY = _mm_set1_ps(queryAABB[1]);
+   const __m128 vQueryUpperX = _mm_set1_ps(queryAABB[2]);
+   const __m128 vQueryUpperY = _mm_set1_ps(queryAABB[3]);
+
+   U32 overlapCount = 0;
+
+   const U32 vectorCount = count & ~3;
+   U32 i = 0;
+   for (; i < vectorCount; i += 4)
+   {
+      __m128 vLowerX = _mm_loadu_ps(aabbs + i*4);
+      __m128 vLowerY = _mm_loadu_ps(aabbs + i*4 + 4);
+      __m128 vUpperX = _mm_loadu_ps(aabbs + i*4 + 8);
+      __m128 vUpperY = _mm_loadu_ps(aabbs + i*4 + 12);
+      _MM_TRANSPOSE4_PS(vLowerX, vLowerY, vUpperX, vUpperY);
+
+      const __m128 vOverlap = _mm_and_ps(_mm_and_ps(_mm_cmple_ps(vLowerX, vQueryUpperX), _mm_cmple_ps(vLowerY, vQueryUpperY)),
+                                         _mm_and_ps(_mm_cmpge_ps(vUpperX, vQueryLowerX), _mm_cmpge_ps(vUpperY, vQueryLowerY)));
+
+      const S32 mask = _mm_movemask_ps(vOverlap);
+      results[i]   = (U8)(mask & 1);
+      results[i+1] = (U8)((mask >> 1) & 1);
+      results[i+2] = (U8)((mask >> 2) & 1);
+      results[i+3] = (U8)((mask >> 3) & 1);
+      overlapCount += results[i] + results[i+1] + results[i+2] + results[i+3];
+   }
+
+   // Remaining AABBs.
+   if (i < count)
+      overlapCount += m_aabb2F_bulk_overlap_C(aabbs + i*4, count - i, queryAABB, results + i);
+
+   return overlapCount;
+}
+
+/// SSE scale and clamp.
+/// Four values are scaled and clamped at a time.
+void SSE_F32_Bulk_Scale_Clamp(const F32* values,
+                              const F32* scales,
+                              const U32  count,
+                              const F32  minValue,
+                              const F32  maxValue,
+                              F32*       output)
+{
+   const __m128 vMin = _mm_set1_ps(minValue);
+   const __m128 vMax = _mm_set1_ps(maxValue);
+
+   const U32 vectorCount = count & ~3;
+   U32 i = 0;
+   for (; i < vectorCount; i += 4)
+   {
+      const __m128 vScaled = _mm_mul_ps(_mm_loadu_ps(values + i), _mm_loadu_ps(scales + i));
+      _mm_storeu_ps(output + i, _mm_min_ps(_mm_max_ps(vScaled, vMin), vMax));
+   }
+
+   // Remaining values.
+   if (i < count)
+      m_f32_bulk_scale_clamp_C(values + i, scales + i, count - i, minValue, maxValue, output + i);
+}
+
+/// SSE 2D point scale and clamp.
+/// Four points are scaled and clamped at a time with the x/y scales interleaved to match the points.
+void SSE_Point2F_Bulk_Scale_Clamp(const F32* points,
+                                  const F32* scalesX,
+                                  const F32* scalesY,
+                                  const U32  count,
+                                  const F32* minimum,
+                                  const F32* maximum,
+                                  F32*       output)
+{
+   const __m128 vMin = _mm_setr_ps(minimum[0], minimum[1], minimum[0], minimum[1]);
+   const __m128 vMax = _mm_setr_ps(maximum[0], maximum[1], maximum[0], maximum[1]);
+
+   const U32 vectorCount = count & ~3;
+   U32 i = 0;
+   for (; i < vectorCount; i += 4)
+   {
+      // Interleave the scales.
+      const __m128 vScaleX = _mm_loadu_ps(scalesX + i);
+      const __m128 vScaleY = _mm_loadu_ps(scalesY + i);
+      const __m128 vScale01 = _mm_unpacklo_ps(vScaleX, vScaleY);
+      const __m128 vScale23 = _mm_unpackhi_ps(vScaleX, vScaleY);
+
+      const __m128 vScaled01 = _mm_mul_ps(_mm_loadu_ps(points + i*2),     vScale01);
+      const __m128 vScaled23 = _mm_mul_ps(_mm_loadu_ps(points + i*2 + 4), vScale23);
+      _mm_storeu_ps(output + i*2,     _mm_min_ps(_mm_max_ps(vScaled01, vMin), vMax));
+      _mm_storeu_ps(output + i*2 + 4, _mm_min_ps(_mm_max_ps(vScaled23, vMin), vMax));
+   }
+
+   // Remaining points.
+   if (i < count)
+      m_point2F_bulk_scale_clamp_C(points + i*2, scalesX + i, scalesY + i, count - i, minimum, maximum, output + i*2);
+}
+
+/// SSE particle integration.
+/// Four particles are integrated at a time with the per-particle force and speed duplicated across each x/y pair.
+void SSE_Particle2F_Bulk_Integrate(F32*       positions,
+                                   F32*       velocities,
+                                   const F32* speeds,
+                                   const F32* forces,
+                                   const F32* forceDirection,
+                                   const F32  forceScale,
+                                   const U32  count,
+                                   const F32  elapsedTime)
+{
+   const __m128 vDirection = _mm_setr_ps(forceDirection[0], forceDirection[1], forceDirection[0], forceDirection[1]);
+   const __m128 vForceScale = _mm_set1_ps(forceScale);
+   const __m128 vElapsedTime = _mm_set1_ps(elapsedTime);
+
+   const U32 vectorCount = count & ~3;
+   U32 i = 0;
+   for (; i < vectorCount; i += 4)
+   {
+      // Time-integrated force and speed.
+      const __m128 vForce = _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps(forces + i), vForceScale), vElapsedTime);
+      const __m128 vSpeed = _mm_mul_ps(_mm_loadu_ps(speeds + i), vElapsedTime);
+
+      // Velocity.
+      const __m128 vVelocity01 = _mm_add_ps(_mm_loadu_ps(velocities + i*2),     _mm_mul_ps(vDirection, _mm_unpacklo_ps(vForce, vForce)));
+      const __m128 vVelocity23 = _mm_add_ps(_mm_loadu_ps(velocities + i*2 + 4), _mm_mul_ps(vDirection, _mm_unpackhi_ps(vForce, vForce)));
+      _mm_storeu_ps(velocities + i*2,     vVelocity01);
+      _mm_storeu_ps(velocities + i*2 + 4, vVelocity23);
+
+      // Position.
+      _mm_storeu_ps(positions + i*2,     _mm_add_ps(_mm_loadu_ps(positions + i*2),     _mm_mul_ps(vVelocity01, _mm_unpacklo_ps(vSpeed, vSpeed))));
+      _mm_storeu_ps(positions + i*2 + 4, _mm_add_ps(_mm_loadu_ps(positions + i*2 + 4), _mm_mul_ps(vVelocity23, _mm_unpackhi_ps(vSpeed, vSpeed))));
+   }
+
+   // Remaining particles.
+   if (i < count)
+      m_particle2F_bulk_integrate_C(positions + i*2, velocities + i*2, speeds + i, forces + i, forceDirection, forceScale, count - i, elapsedTime);
+}
+
+/// SSE 2D point dot products.
+/// Four points are de-interleaved and dotted at a time.
+void SSE_Point2F_Bulk_Dot(const F32* refVector,
+                          const F32* dotPoints,
+                          const U32  numPoints,
+                          F32*       output)
+{
+   const __m128 vRefX = _mm_set1_ps(refVector[0]);
+   const __m128 vRefY = _mm_set1_ps(refVector[1]);
+
+   const U32 vectorCount = numPoints & ~3;
+   U32 i = 0;
+   for (; i < vectorCount; i += 4)
+   {
+      // De-interleave the points.
+      const __m128 vPoints01 = _mm_loadu_ps(dotPoints + i*2);
+      const __m128 vPoints23 = _mm_loadu_ps(dotPoints + i*2 + 4);
+      const __m128 vX = _mm_shuffle_ps(vPoints01, vPoints23, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m128 vY = _mm_shuffle_ps(vPoints01, vPoints23, _MM_SHUFFLE(3, 1, 3, 1));
+
+      _mm_storeu_ps(output + i, _mm_add_ps(_mm_mul_ps(vX, vRefX), _mm_mul_ps(vY, vRefY)));
+   }
+
+   // Remaining points.
+   if (i < numPoints)
+      m_point2F_bulk_dot_C(refVector, dotPoints + i*2, numPoints - i, output + i);
+}
+
+/// SSE spatial interpolation.
+/// Four entries are blended at a time and merged into the render arrays using the dirty flags as a mask.
+/// Groups of four clean entries (typically sleeping objects) are skipped entirely.
+void SSE_Spatial2F_Bulk_Interpolate(const F32* preTickX,
+                                    const F32* preTickY,
+                                    const F32* preTickAngle,
+                                    const F32* tickX,
+                                    const F32* tickY,
+                                    const F32* tickAngle,
+                                    const U8*  dirty,
+                                    const U32  count,
+                                    const F32  factor,
+                                    F32*       renderX,
+                                    F32*       renderY,
+                                    F32*       renderAngle)
+{
+   // The start of the tick is a straight copy so leave it to the C version.
+   if (factor >= 1.0f)
+   {
+      m_spatial2F_bulk_interpolate_C(preTickX, preTickY, preTickAngle, tickX, tickY, tickAngle, dirty, count, factor, renderX, renderY, renderAngle);
+      return;
+   }
+
+   const __m128 vFactor  = _mm_set1_ps(factor);
+   const __m128 vPi      = _mm_set1_ps(M_PI_F);
+   const __m128 vNegPi   = _mm_set1_ps(-M_PI_F);
+   const __m128 v2Pi     = _mm_set1_ps(M_2PI_F);
+   const __m128 vZero    = _mm_setzero_ps();
+
+   const U32 vectorCount = count & ~3;
+   U32 i = 0;
+   for (; i < vectorCount; i += 4)
+   {
+      // Skip if nothing is dirty.
+      if ((dirty[i] | dirty[i+1] | dirty[i+2] | dirty[i+3]) == 0)
+         continue;
+
+      const __m128 vMask = _mm_cmpneq_ps(_mm_set_ps((F32)dirty[i+3], (F32)dirty[i+2], (F32)dirty[i+1], (F32)dirty[i]), vZero);
+
+      // Position.
+      const __m128 vTickX = _mm_loadu_ps(tickX + i);
+      const __m128 vTickY = _mm_loadu_ps(tickY + i);
+      const __m128 vRenderX = _mm_sub_ps(vTickX, _mm_mul_ps(_mm_sub_ps(vTickX, _mm_loadu_ps(preTickX + i)), vFactor));
+      const __m128 vRenderY = _mm_sub_ps(vTickY, _mm_mul_ps(_mm_sub_ps(vTickY, _mm_loadu_ps(preTickY + i)), vFactor));
+
+      // Angle (shortest arc).
+      const __m128 vTickAngle = _mm_loadu_ps(tickAngle + i);
+      __m128 vRelative = _mm_sub_ps(vTickAngle, _mm_loadu_ps(preTickAngle + i));
+      vRelative = _mm_sub_ps(vRelative, _mm_and_ps(_mm_cmpgt_ps(vRelative, vPi), v2Pi));
+      vRelative = _mm_add_ps(vRelative, _mm_and_ps(_mm_cmplt_ps(vRelative, vNegPi), v2Pi));
+      const __m128 vRenderAngle = _mm_sub_ps(vTickAngle, _mm_mul_ps(vRelative, vFactor));
+
+      // Merge the dirty entries.
+      _mm_storeu_ps(renderX + i,     _mm_or_ps(_mm_and_ps(vMask, vRenderX),     _mm_andnot_ps(vMask, _mm_loadu_ps(renderX + i))));
+      _mm_storeu_ps(renderY + i,     _mm_or_ps(_mm_and_ps(vMask, vRenderY),     _mm_andnot_ps(vMask, _mm_loadu_ps(renderY + i))));
+      _mm_storeu_ps(renderAngle + i, _mm_or_ps(_mm_and_ps(vMask, vRenderAngle), _mm_andnot_ps(vMask, _mm_loadu_ps(renderAngle + i))));
+   }
+
+   // Remaining entries.
+   if (i < count)
+      m_spatial2F_bulk_interpolate_C(preTickX + i, preTickY + i, preTickAngle + i, tickX + i, tickY + i, tickAngle + i, dirty + i, count - i, factor, renderX + i, renderY + i, renderAngle + i);
+}
+#endif
+
+
 void mInstall_Library_SSE()
 {
 #if defined(ADD_SSE_FN)
@@ -128,4 +495,17 @@ void mInstall_Library_SSE()
    // m_matF_x_point3F = Athlon_MatrixF_x_Point3F;
    // m_matF_x_vectorF = Athlon_MatrixF_x_VectorF;
 #endif
+
+#if defined(ADD_SSE_INTRINSIC_FN)
+   m_matF_x_matF = SSE_MatrixF_x_MatrixF_Intrinsic;
+   m_spatial2F_bulk_interpolate = SSE_Spatial2F_Bulk_Interpolate;
+   m_point2F_bulk_dot = SSE_Point2F_Bulk_Dot;
+   m_f32_bulk_scale_clamp = SSE_F32_Bulk_Scale_Clamp;
+   m_point2F_bulk_scale_clamp = SSE_Point2F_Bulk_Scale_Clamp;
+   m_particle2F_bulk_integrate = SSE_Particle2F_Bulk_Integrate;
+   m_point2F_bulk_transform = SSE_Point2F_Bulk_Transform;
+   m_oobb2F_bulk_calculate = SSE_OOBB2F_Bulk_Calculate;
+   m_oobb2F_bulk_aabb = SSE_OOBB2F_Bulk_AABB;
+   m_aabb2F_bulk_overlap = SSE_AABB2F_Bulk_Overlap;
+#endif
 }
@@ -0,0 +1,232 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "platform/platform.h"
+#include "console/console.h"
+#include "math/mMathFn.h"
+#include "math/mRandom.h"
+
+//-----------------------------------------------------------------------------
+
+// The C versions the installed versions are checked against.
+extern void default_matF_x_matF_C(const F32 *a, const F32 *b, F32 *mresult);
+
+extern void m_spatial2F_bulk_interpolate_C(const F32* preTickX, const F32* preTickY, const F32* preTickAngle,
+                                           const F32* tickX, const F32* tickY, const F32* tickAngle,
+                                           const U8* dirty, const U32 count, const F32 factor,
+                                           F32* renderX, F32* renderY, F32* renderAngle);
+
+extern void m_point2F_bulk_dot_C(const F32* refVector, const F32* dotPoints, const U32 numPoints, F32* output);
+
+extern void m_f32_bulk_scale_clamp_C(const F32* values, const F32* scales, const U32 count, const F32 minValue, const F32 maxValue, F32* output);
+
+extern void m_point2F_bulk_scale_clamp_C(const F32* points, const F32* scalesX, const F32* scalesY, const U32 count,
+                                         const F32* minimum, const F32* maximum, F32* output);
+
+extern void m_particle2F_bulk_integrate_C(F32* positions, F32* velocities, const F32* speeds, const F32* forces,
+                                          const F32* forceDirection, const F32 forceScale, const U32 count, const F32 elapsedTime);
+
+extern void m_point2F_bulk_transform_C(const F32* transform, const F32* points, const U32 count, F32* output);
+
+extern void m_oobb2F_bulk_calculate_C(const F32* localVertices, const F32* sizes, const F32* transforms, const U32 count, F32* output);
+
+extern void m_oobb2F_bulk_aabb_C(const F32* oobbs, const U32 count, F32* output);
+
+extern U32 m_aabb2F_bulk_overlap_C(const F32* aabbs, const U32 count, const F32* queryAABB, U8* results);
+
+//-----------------------------------------------------------------------------
+
+// An odd count so both the vector loops and the remainders are exercised.
+#define MATH_VERIFY_COUNT       67
+
+// The SIMD versions are written to match the C versions exactly but a compiler is free to fuse
+// a multiply and add in the C versions so a small relative error is allowed.
+#define MATH_VERIFY_TOLERANCE   1.0e-5f
+
+//-----------------------------------------------------------------------------
+
+static bool verifyResults( const char* pFunctionName, const F32* pExpected, const F32* pActual, const U32 count )
+{
+   for ( U32 index = 0; index < count; ++index )
+   {
+      if ( mFabs( pActual[index] - pExpected[index] ) <= MATH_VERIFY_TOLERANCE * getMax( 1.0f, mFabs( pExpected[index] ) ) )
+         continue;
+
+      Con::errorf( "Math::verify() - '%s' differs from the C version at element %d (%g rather than %g).", pFunctionName, index, pActual[index], pExpected[index] );
+      return false;
+   }
+
+   return true;
+}
+
+//-----------------------------------------------------------------------------
+
+static void fillRandom( RandomLCG& random, F32* pValues, const U32 count, const F32 minValue, const F32 maxValue )
+{
+   for ( U32 index = 0; index < count; ++index )
+      pValues[index] = random.randRangeF( minValue, maxValue );
+}
+
+//-----------------------------------------------------------------------------
+
+bool Math::verify( void )
+{
+   const U32 count = MATH_VERIFY_COUNT;
+
+   RandomLCG random( 0x5EED );
+
+   F32 inputA[count*8];
+   F32 inputB[count*8];
+   F32 inputC[count*8];
+   F32 expected[count*8];
+   F32 actual[count*8];
+
+   U32 failedCount = 0;
+
+   // Matrix multiply.
+   {
+      fillRandom( random, inputA, 16, -10.0f, 10.0f );
+      fillRandom( random, inputB, 16, -10.0f, 10.0f );
+      default_matF_x_matF_C( inputA, inputB, expected );
+      m_matF_x_matF( inputA, inputB, actual );
+      failedCount += verifyResults( "m_matF_x_matF", expected, actual, 16 ) ? 0 : 1;
+   }
+
+   // Point dot products.
+   {
+      const F32 refVector[2] = { 0.6f, -0.8f };
+      fillRandom( random, inputA, count*2, -100.0f, 100.0f );
+      m_point2F_bulk_dot_C( refVector, inputA, count, expected );
+      m_point2F_bulk_dot( refVector, inputA, count, actual );
+      failedCount += verifyResults( "m_point2F_bulk_dot", expected, actual, count ) ? 0 : 1;
+   }
+
+   // Scale and clamp.
+   {
+      fillRandom( random, inputA, count, -10.0f, 10.0f );
+      fillRandom( random, inputB, count, 0.0f, 2.0f );
+      m_f32_bulk_scale_clamp_C( inputA, inputB, count, -5.0f, 5.0f, expected );
+      m_f32_bulk_scale_clamp( inputA, inputB, count, -5.0f, 5.0f, actual );
+      failedCount += verifyResults( "m_f32_bulk_scale_clamp", expected, actual, count ) ? 0 : 1;
+   }
+
+   // Point scale and clamp.
+   {
+      const F32 minimum[2] = { 0.0f, -2.0f };
+      const F32 maximum[2] = { 4.0f, 8.0f };
+      fillRandom( random, inputA, count*2, -10.0f, 10.0f );
+      fillRandom( random, inputB, count, 0.0f, 2.0f );
+      fillRandom( random, inputC, count, 0.0f, 2.0f );
+      m_point2F_bulk_scale_clamp_C( inputA, inputB, inputC, count, minimum, maximum, expected );
+      m_point2F_bulk_scale_clamp( inputA, inputB, inputC, count, minimum, maximum, actual );
+      failedCount += verifyResults( "m_point2F_bulk_scale_clamp", expected, actual, count*2 ) ? 0 : 1;
+   }
+
+   // Particle integration.
+   // NOTE:-   The positions are held in the first half of the buffers and the velocities in the second.
+   {
+      const F32 forceDirection[2] = { 0.0f, -1.0f };
+      fillRandom( random, expected, count*4, -50.0f, 50.0f );
+      dMemcpy( actual, expected, sizeof(F32) * count*4 );
+      fillRandom( random, inputA, count, 0.0f, 10.0f );
+      fillRandom( random, inputB, count, -5.0f, 5.0f );
+      m_particle2F_bulk_integrate_C( expected, expected + count*2, inputA, inputB, forceDirection, 2.0f, count, 1.0f / 60.0f );
+      m_particle2F_bulk_integrate( actual, actual + count*2, inputA, inputB, forceDirection, 2.0f, count, 1.0f / 60.0f );
+      failedCount += verifyResults( "m_particle2F_bulk_integrate", expected, actual, count*4 ) ? 0 : 1;
+   }
+
+   // Spatial interpolation.
+   // NOTE:-   The x, y and angle are held in thirds of the buffers and the dirty flags include clean runs.
+   {
+      U8 dirty[count];
+      for ( U32 index = 0; index < count; ++index )
+         dirty[index] = (index & 16) ? 0 : (U8)(random.randI() & 1);
+
+      fillRandom( random, inputA, count*3, -M_2PI_F, M_2PI_F );
+      fillRandom( random, inputB, count*3, -M_2PI_F, M_2PI_F );
+      fillRandom( random, expected, count*3, -1.0f, 1.0f );
+      dMemcpy( actual, expected, sizeof(F32) * count*3 );
+      m_spatial2F_bulk_interpolate_C( inputA, inputA + count, inputA + count*2, inputB, inputB + count, inputB + count*2, dirty, count, 0.3f, expected, expected + count, expected + count*2 );
+      m_spatial2F_bulk_interpolate( inputA, inputA + count, inputA + count*2, inputB, inputB + count, inputB + count*2, dirty, count, 0.3f, actual, actual + count, actual + count*2 );
+      failedCount += verifyResults( "m_spatial2F_bulk_interpolate", expected, actual, count*3 ) ? 0 : 1;
+   }
+
+   // Point transform.
+   {
+      const F32 angle = random.randRangeF( 0.0f, M_2PI_F );
+      const F32 transform[4] = { 3.0f, -7.0f, mSin( angle ), mCos( angle ) };
+      fillRandom( random, inputA, count*2, -100.0f, 100.0f );
+      m_point2F_bulk_transform_C( transform, inputA, count, expected );
+      m_point2F_bulk_transform( transform, inputA, count, actual );
+      failedCount += verifyResults( "m_point2F_bulk_transform", expected, actual, count*2 ) ? 0 : 1;
+   }
+
+   // OOBB calculation.
+   {
+      const F32 localVertices[8] = { -0.5f, -0.5f, 0.5f, -0.5f, 0.5f, 0.5f, -0.5f, 0.5f };
+      fillRandom( random, inputA, count*2, 0.1f, 4.0f );
+      for ( U32 index = 0; index < count; ++index )
+      {
+         const F32 angle = random.randRangeF( 0.0f, M_2PI_F );
+         inputB[index*4]   = random.randRangeF( -100.0f, 100.0f );
+         inputB[index*4+1] = random.randRangeF( -100.0f, 100.0f );
+         inputB[index*4+2] = mSin( angle );
+         inputB[index*4+3] = mCos( angle );
+      }
+      m_oobb2F_bulk_calculate_C( localVertices, inputA, inputB, count, expected );
+      m_oobb2F_bulk_calculate( localVertices, inputA, inputB, count, actual );
+      failedCount += verifyResults( "m_oobb2F_bulk_calculate", expected, actual, count*8 ) ? 0 : 1;
+   }
+
+   // OOBB to AABB.
+   // NOTE:-   The OOBBs calculated above are reused.
+   {
+      dMemcpy( inputC, expected, sizeof(F32) * count*8 );
+      m_oobb2F_bulk_aabb_C( inputC, count, expected );
+      m_oobb2F_bulk_aabb( inputC, count, actual );
+      failedCount += verifyResults( "m_oobb2F_bulk_aabb", expected, actual, count*4 ) ? 0 : 1;
+   }
+
+   // AABB overlap.
+   // NOTE:-   The AABBs calculated above are reused and the results must match exactly.
+   {
+      const F32 queryAABB[4] = { -50.0f, -50.0f, 50.0f, 50.0f };
+      U8 expectedResults[count];
+      U8 actualResults[count];
+      const U32 expectedOverlaps = m_aabb2F_bulk_overlap_C( expected, count, queryAABB, expectedResults );
+      const U32 actualOverlaps = m_aabb2F_bulk_overlap( expected, count, queryAABB, actualResults );
+      if ( expectedOverlaps != actualOverlaps || dMemcmp( expectedResults, actualResults, sizeof(expectedResults) ) != 0 )
+      {
+         Con::errorf( "Math::verify() - 'm_aabb2F_bulk_overlap' differs from the C version (%d overlaps rather than %d).", actualOverlaps, expectedOverlaps );
+         failedCount++;
+      }
+   }
+
+   if ( failedCount > 0 )
+   {
+      Con::errorf( "Math::verify() - %d math function(s) differ from the C versions.", failedCount );
+      return false;
+   }
+
+   Con::printf( "Math::verify() - The installed math functions match the C versions." );
+   return true;
+}
@@ -725,6 +725,15 @@ void m_point3F_bulk_dot_C(const F32* refVector,
    }
 }
 
+void m_point2F_bulk_dot_C(const F32* refVector,
+                          const F32* dotPoints,
+                          const U32  numPoints,
+                          F32*       output)
+{
+   for (U32 i = 0; i < numPoints; i++)
+      output[i] = (dotPoints[i*2+0] * refVector[0]) + (dotPoints[i*2+1] * refVector[1]);
+}
+
 void m_point3F_bulk_dot_indexed_C(const F32* refVector,
                                   const F32* dotPoints,
                                   const U32  numPoints,
@@ -741,6 +750,176 @@ void m_point3F_bulk_dot_indexed_C(const F32* refVector,
    }
 }
 
+void m_spatial2F_bulk_interpolate_C(const F32* preTickX,
+                                    const F32* preTickY,
+                                    const F32* preTickAngle,
+                                    const F32* tickX,
+                                    const F32* tickY,
+                                    const F32* tickAngle,
+                                    const U8*  dirty,
+                                    const U32  count,
+                                    const F32  factor,
+                                    F32*       renderX,
+                                    F32*       renderY,
+                                    F32*       renderAngle)
+{
+   // At (or beyond) the start of the tick so use the pre-tick spatials directly.
+   if (factor >= 1.0f)
+   {
+      for (U32 i = 0; i < count; i++)
+      {
+         if (!dirty[i])
+            continue;
+
+         renderX[i]     = preTickX[i];
+         renderY[i]     = preTickY[i];
+         renderAngle[i] = preTickAngle[i];
+      }
+      return;
+   }
+
+   for (U32 i = 0; i < count; i++)
+   {
+      if (!dirty[i])
+         continue;
+
+      renderX[i] = tickX[i] - ((tickX[i] - preTickX[i]) * factor);
+      renderY[i] = tickY[i] - ((tickY[i] - preTickY[i]) * factor);
+
+      F32 relativeAngle = tickAngle[i] - preTickAngle[i];
+      if (relativeAngle > M_PI_F)
+         relativeAngle -= M_2PI_F;
+      else if (relativeAngle < -M_PI_F)
+         relativeAngle += M_2PI_F;
+      renderAngle[i] = tickAngle[i] - (relativeAngle * factor);
+   }
+}
+
+void m_f32_bulk_scale_clamp_C(const F32* values,
+                              const F32* scales,
+                              const U32  count,
+                              const F32  minValue,
+                              const F32  maxValue,
+                              F32*       output)
+{
+   for (U32 i = 0; i < count; i++)
+      output[i] = getMin(getMax(values[i] * scales[i], minValue), maxValue);
+}
+
+void m_point2F_bulk_scale_clamp_C(const F32* points,
+                                  const F32* scalesX,
+                                  const F32* scalesY,
+                                  const U32  count,
+                                  const F32* minimum,
+                                  const F32* maximum,
+                                  F32*       output)
+{
+   for (U32 i = 0; i < count; i++)
+   {
+      output[i*2]   = getMin(getMax(points[i*2]   * scalesX[i], minimum[0]), maximum[0]);
+      output[i*2+1] = getMin(getMax(points[i*2+1] * scalesY[i], minimum[1]), maximum[1]);
+   }
+}
+
+void m_particle2F_bulk_integrate_C(F32*       positions,
+                                   F32*       velocities,
+                                   const F32* speeds,
+                                   const F32* forces,
+                                   const F32* forceDirection,
+                                   const F32  forceScale,
+                                   const U32  count,
+                                   const F32  elapsedTime)
+{
+   for (U32 i = 0; i < count; i++)
+   {
+      const F32 force = (forces[i] * forceScale) * elapsedTime;
+      velocities[i*2]   += forceDirection[0] * force;
+      velocities[i*2+1] += forceDirection[1] * force;
+
+      const F32 speed = speeds[i] * elapsedTime;
+      positions[i*2]   += velocities[i*2]   * speed;
+      positions[i*2+1] += velocities[i*2+1] * speed;
+   }
+}
+
+void m_point2F_bulk_transform_C(const F32* transform,
+                                const F32* points,
+                                const U32  count,
+                                F32*       output)
+{
+   // Matches b2Mul( b2Transform, b2Vec2 ).
+   const F32 x = transform[0];
+   const F32 y = transform[1];
+   const F32 s = transform[2];
+   const F32 c = transform[3];
+
+   for (U32 i = 0; i < count; i++)
+   {
+      const F32 px = points[i*2];
+      const F32 py = points[i*2+1];
+      output[i*2]   = (c * px - s * py) + x;
+      output[i*2+1] = (s * px + c * py) + y;
+   }
+}
+
+void m_oobb2F_bulk_calculate_C(const F32* localVertices,
+                               const F32* sizes,
+                               const F32* transforms,
+                               const U32  count,
+                               F32*       output)
+{
+   for (U32 i = 0; i < count; i++)
+   {
+      const F32* transform = transforms + i*4;
+      const F32 x = transform[0];
+      const F32 y = transform[1];
+      const F32 s = transform[2];
+      const F32 c = transform[3];
+
+      for (U32 v = 0; v < 4; v++)
+      {
+         const F32 px = localVertices[v*2]   * sizes[i*2];
+         const F32 py = localVertices[v*2+1] * sizes[i*2+1];
+         output[i*8 + v*2]   = (c * px - s * py) + x;
+         output[i*8 + v*2+1] = (s * px + c * py) + y;
+      }
+   }
+}
+
+void m_oobb2F_bulk_aabb_C(const F32* oobbs,
+                          const U32  count,
+                          F32*       output)
+{
+   for (U32 i = 0; i < count; i++)
+   {
+      const F32* oobb = oobbs + i*8;
+      F32* aabb = output + i*4;
+
+      aabb[0] = getMin(getMin(oobb[0], oobb[2]), getMin(oobb[4], oobb[6]));
+      aabb[1] = getMin(getMin(oobb[1], oobb[3]), getMin(oobb[5], oobb[7]));
+      aabb[2] = getMax(getMax(oobb[0], oobb[2]), getMax(oobb[4], oobb[6]));
+      aabb[3] = getMax(getMax(oobb[1], oobb[3]), getMax(oobb[5], oobb[7]));
+   }
+}
+
+U32 m_aabb2F_bulk_overlap_C(const F32* aabbs,
+                            const U32  count,
+                            const F32* queryAABB,
+                            U8*        results)
+{
+   U32 overlapCount = 0;
+
+   for (U32 i = 0; i < count; i++)
+   {
+      const F32* aabb = aabbs + i*4;
+      const bool overlap = aabb[0] <= queryAABB[2] && aabb[1] <= queryAABB[3] && aabb[2] >= queryAABB[0] && aabb[3] >= queryAABB[1];
+      results[i] = overlap ? 1 : 0;
+      overlapCount += results[i];
+   }
+
+   return overlapCount;
+}
+
 
 //------------------------------------------------------------------------------
 // Math function pointer declarations
@@ -767,6 +946,10 @@ void (*m_point3F_bulk_dot)(const F32* refVector,
                            const U32  numPoints,
                            const U32  pointStride,
                            F32*       output) = m_point3F_bulk_dot_C;
+void (*m_point2F_bulk_dot)(const F32* refVector,
+                           const F32* dotPoints,
+                           const U32  numPoints,
+                           F32*       output) = m_point2F_bulk_dot_C;
 void (*m_point3F_bulk_dot_indexed)(const F32* refVector,
                                    const F32* dotPoints,
                                    const U32  numPoints,
@@ -774,6 +957,63 @@ void (*m_point3F_bulk_dot_indexed)(const F32* refVector,
                                    const U32* pointIndices,
                                    F32*       output) = m_point3F_bulk_dot_indexed_C;
 
+void (*m_spatial2F_bulk_interpolate)(const F32* preTickX,
+                                     const F32* preTickY,
+                                     const F32* preTickAngle,
+                                     const F32* tickX,
+                                     const F32* tickY,
+                                     const F32* tickAngle,
+                                     const U8*  dirty,
+                                     const U32  count,
+                                     const F32  factor,
+                                     F32*       renderX,
+                                     F32*       renderY,
+                                     F32*       renderAngle) = m_spatial2F_bulk_interpolate_C;
+
+void (*m_f32_bulk_scale_clamp)(const F32* values,
+                               const F32* scales,
+                               const U32  count,
+                               const F32  minValue,
+                               const F32  maxValue,
+                               F32*       output) = m_f32_bulk_scale_clamp_C;
+
+void (*m_point2F_bulk_scale_clamp)(const F32* points,
+                                   const F32* scalesX,
+                                   const F32* scalesY,
+                                   const U32  count,
+                                   const F32* minimum,
+                                   const F32* maximum,
+                                   F32*       output) = m_point2F_bulk_scale_clamp_C;
+
+void (*m_particle2F_bulk_integrate)(F32*       positions,
+                                    F32*       velocities,
+                                    const F32* speeds,
+                                    const F32* forces,
+                                    const F32* forceDirection,
+                                    const F32  forceScale,
+                                    const U32  count,
+                                    const F32  elapsedTime) = m_particle2F_bulk_integrate_C;
+
+void (*m_point2F_bulk_transform)(const F32* transform,
+                                 const F32* points,
+                                 const U32  count,
+                                 F32*       output) = m_point2F_bulk_transform_C;
+
+void (*m_oobb2F_bulk_calculate)(const F32* localVertices,
+                                const F32* sizes,
+                                const F32* transforms,
+                                const U32  count,
+                                F32*       output) = m_oobb2F_bulk_calculate_C;
+
+void (*m_oobb2F_bulk_aabb)(const F32* oobbs,
+                           const U32  count,
+                           F32*       output) = m_oobb2F_bulk_aabb_C;
+
+U32  (*m_aabb2F_bulk_overlap)(const F32* aabbs,
+                              const U32  count,
+                              const F32* queryAABB,
+                              U8*        results) = m_aabb2F_bulk_overlap_C;
+
 void (*m_quatF_set_matF)( F32 x, F32 y, F32 z, F32 w, F32* m ) = m_quatF_set_matF_C;
 
 void (*m_matF_set_euler)(const F32 *e, F32 *result) = m_matF_set_euler_C;
@@ -814,6 +1054,15 @@ void mInstallLibrary_C()
 
    m_point3F_bulk_dot      = m_point3F_bulk_dot_C;
    m_point3F_bulk_dot_indexed = m_point3F_bulk_dot_indexed_C;
+   m_point2F_bulk_dot      = m_point2F_bulk_dot_C;
+   m_spatial2F_bulk_interpolate = m_spatial2F_bulk_interpolate_C;
+   m_f32_bulk_scale_clamp  = m_f32_bulk_scale_clamp_C;
+   m_point2F_bulk_scale_clamp = m_point2F_bulk_scale_clamp_C;
+   m_particle2F_bulk_integrate = m_particle2F_bulk_integrate_C;
+   m_point2F_bulk_transform = m_point2F_bulk_transform_C;
+   m_oobb2F_bulk_calculate = m_oobb2F_bulk_calculate_C;
+   m_oobb2F_bulk_aabb      = m_oobb2F_bulk_aabb_C;
+   m_aabb2F_bulk_overlap   = m_aabb2F_bulk_overlap_C;
 
    m_quatF_set_matF        = m_quatF_set_matF_C;
 
@@ -0,0 +1,217 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "memory/factoryCache.h"
+
+#ifndef _PLATFORM_THREADS_ATOMIC_H_
+#include "platform/threads/atomic.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#if defined(_MSC_VER)
+#define FACTORY_THREAD_LOCAL __declspec(thread)
+#else
+#define FACTORY_THREAD_LOCAL __thread
+#endif
+
+/// Factory caches by slot.  Slots are never reused so a thread cache always belongs to the same factory.
+static FactoryCacheBase* volatile spFactoryCaches[FactoryCacheBase::MaxFactoryCaches];
+static U32 sFactoryCacheCount = 0;
+static void* volatile spFactoryCachesLock = NULL;
+
+static FACTORY_THREAD_LOCAL void* stpThreadCaches[FactoryCacheBase::MaxFactoryCaches];
+
+//-----------------------------------------------------------------------------
+
+static inline void lockSpin( void* volatile* pLock )
+{
+    while ( dCompareAndSwapPointer( pLock, NULL, (void*)1 ) != NULL )
+    {
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static inline void unlockSpin( void* volatile* pLock )
+{
+    dExchangePointer( pLock, NULL );
+}
+
+//-----------------------------------------------------------------------------
+
+FactoryCacheBase::FactoryCacheBase( const char* pName ) :
+    mpName( pName ),
+    mSlot( -1 ),
+    mLock( NULL ),
+    mConstructed( 0 ),
+    mHighWater( 0 ),
+    mRetainCount( 0 )
+{
+    // Allocate a slot.  Factories without a slot use the shared cache only.
+    lockSpin( &spFactoryCachesLock );
+    if ( sFactoryCacheCount < MaxFactoryCaches )
+    {
+        mSlot = (S32)sFactoryCacheCount++;
+        spFactoryCaches[mSlot] = this;
+    }
+    unlockSpin( &spFactoryCachesLock );
+}
+
+//-----------------------------------------------------------------------------
+
+FactoryCacheBase::~FactoryCacheBase()
+{
+    if ( mSlot < 0 )
+        return;
+
+    lockSpin( &spFactoryCachesLock );
+    spFactoryCaches[mSlot] = NULL;
+    unlockSpin( &spFactoryCachesLock );
+
+    // Free the calling thread's cache.  The derived factory has already emptied it.
+    ThreadCache* pThreadCache = (ThreadCache*)stpThreadCaches[mSlot];
+    if ( pThreadCache != NULL )
+    {
+        delete pThreadCache;
+        stpThreadCaches[mSlot] = NULL;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+FactoryCacheBase::ThreadCache* FactoryCacheBase::getThreadCache( void )
+{
+    if ( mSlot < 0 )
+        return NULL;
+
+    ThreadCache* pThreadCache = (ThreadCache*)stpThreadCaches[mSlot];
+    if ( pThreadCache != NULL )
+        return pThreadCache;
+
+    // Create the cache for this thread.
+    pThreadCache = new ThreadCache;
+    pThreadCache->mCount = 0;
+    stpThreadCaches[mSlot] = pThreadCache;
+    return pThreadCache;
+}
+
+//-----------------------------------------------------------------------------
+
+void FactoryCacheBase::lock( void )
+{
+    lockSpin( &mLock );
+}
+
+//-----------------------------------------------------------------------------
+
+void FactoryCacheBase::unlock( void )
+{
+    unlockSpin( &mLock );
+}
+
+//-----------------------------------------------------------------------------
+
+void FactoryCacheBase::getStats( Stats& stats )
+{
+    lock();
+    stats.constructed = mConstructed;
+    stats.highWater = mHighWater;
+    stats.sharedCached = getSharedCachedCount();
+    stats.retainCount = mRetainCount;
+    unlock();
+}
+
+//-----------------------------------------------------------------------------
+
+void FactoryCacheBase::trimAll( void )
+{
+    for ( U32 slot = 0; slot < MaxFactoryCaches; ++slot )
+    {
+        lockSpin( &spFactoryCachesLock );
+        FactoryCacheBase* pFactoryCache = spFactoryCaches[slot];
+        unlockSpin( &spFactoryCachesLock );
+
+        // NOTE: Factory caches are not destroyed whilst in use so it is safe to trim outside of the lock.
+        if ( pFactoryCache != NULL )
+            pFactoryCache->trim();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void FactoryCacheBase::releaseThreadCaches( void )
+{
+    for ( U32 slot = 0; slot < MaxFactoryCaches; ++slot )
+    {
+        ThreadCache* pThreadCache = (ThreadCache*)stpThreadCaches[slot];
+        if ( pThreadCache == NULL )
+            continue;
+
+        lockSpin( &spFactoryCachesLock );
+        FactoryCacheBase* pFactoryCache = spFactoryCaches[slot];
+        unlockSpin( &spFactoryCachesLock );
+
+        // Return the objects to the shared cache.
+        if ( pFactoryCache != NULL )
+            pFactoryCache->flushThreadCache( pThreadCache, 0 );
+
+        delete pThreadCache;
+        stpThreadCaches[slot] = NULL;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void FactoryCacheBase::dumpStats( void )
+{
+    Con::printf( "Factory Caches:" );
+    Con::printf( "  %-24s %12s %12s %12s %12s", "Name", "Constructed", "HighWater", "Cached", "Retain" );
+
+    for ( U32 slot = 0; slot < MaxFactoryCaches; ++slot )
+    {
+        lockSpin( &spFactoryCachesLock );
+        FactoryCacheBase* pFactoryCache = spFactoryCaches[slot];
+        unlockSpin( &spFactoryCachesLock );
+
+        if ( pFactoryCache == NULL )
+            continue;
+
+        Stats stats;
+        pFactoryCache->getStats( stats );
+
+        Con::printf( "  %-24s %12d %12d %12d %12d",
+            pFactoryCache->getName(),
+            stats.constructed,
+            stats.highWater,
+            stats.sharedCached,
+            stats.retainCount );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+#include "factoryCache_ScriptBinding.h"
@@ -37,11 +37,99 @@ public:
 
 //-----------------------------------------------------------------------------
 
+/// The non-template part of a factory cache.
+///
+/// Each factory cache keeps a shared list of cached objects along with a small cache for
+/// each thread that uses it so that objects can be created and cached without contention.
+/// Thread caches are bounded so the memory they hold is bounded too.  Threads other than
+/// the main thread should call releaseThreadCaches() before they exit so that the objects
+/// in their caches are returned to the shared lists.
+///
+/// The shared lists grow to the high-water mark of the objects in use.  Call trimAll() at
+/// level transitions to free cached objects beyond the count each cache retains.
+class FactoryCacheBase
+{
+public:
+    enum
+    {
+        ThreadCacheSize = 32,
+        MaxFactoryCaches = 64
+    };
+
+    /// Statistics for a factory cache.
+    struct Stats
+    {
+        U32 constructed;    ///< Objects currently constructed, whether in use or cached.
+        U32 highWater;      ///< The most objects constructed at once.
+        U32 sharedCached;   ///< Objects in the shared cache.
+        U32 retainCount;    ///< Objects kept in the shared cache when trimmed.
+    };
+
+    FactoryCacheBase( const char* pName );
+    virtual ~FactoryCacheBase();
+
+    inline const char* getName( void ) const { return mpName; }
+
+    /// Set the number of cached objects kept when the cache is trimmed.
+    inline void setRetainCount( const U32 retainCount ) { mRetainCount = retainCount; }
+    inline U32 getRetainCount( void ) const { return mRetainCount; }
+
+    /// Delete cached objects beyond the retain count.
+    virtual void trim( void ) = 0;
+
+    void getStats( Stats& stats );
+
+    /// Trim all the factory caches.
+    static void trimAll( void );
+
+    /// Return the objects in the calling thread's caches to the shared caches.
+    static void releaseThreadCaches( void );
+
+    /// Dump the statistics of all the factory caches to the console.
+    static void dumpStats( void );
+
+protected:
+    struct ThreadCache
+    {
+        void*   mpObjects[ThreadCacheSize];
+        U32     mCount;
+    };
+
+    /// Get the calling thread's cache, or NULL if the factory has no thread caches.
+    ThreadCache* getThreadCache( void );
+
+    /// Move objects from a thread cache to the shared cache, leaving the specified count.
+    virtual void flushThreadCache( ThreadCache* pThreadCache, const U32 keepCount ) = 0;
+
+    void lock( void );
+    void unlock( void );
+
+    /// Update the count of constructed objects.  The lock must be held.
+    inline void addConstructed( const S32 count )
+    {
+        mConstructed += count;
+        if ( mConstructed > mHighWater )
+            mHighWater = mConstructed;
+    }
+
+    virtual U32 getSharedCachedCount( void ) const = 0;
+
+private:
+    const char*     mpName;
+    S32             mSlot;
+    void* volatile  mLock;
+    U32             mConstructed;
+    U32             mHighWater;
+    U32             mRetainCount;
+};
+
+//-----------------------------------------------------------------------------
+
 template<class T>
-class FactoryCache : private Vector<T*>
+class FactoryCache : public FactoryCacheBase
 {
 public:
-    FactoryCache()
+    FactoryCache( const char* pName = "Unnamed" ) : FactoryCacheBase( pName )
     {
     }
 
@@ -52,35 +140,136 @@ public:
 
     T* createObject( void )
     {
-        // Create a new object if cache is empty.
-        if ( this->size() == 0 )
-            return new T();
+        // Use the thread cache if possible.
+        ThreadCache* pThreadCache = getThreadCache();
+        if ( pThreadCache != NULL && pThreadCache->mCount > 0 )
+            return static_cast<T*>( pThreadCache->mpObjects[--pThreadCache->mCount] );
+
+        lock();
 
         // Return a cached object.
-        T* pObject = this->back();
-        this->pop_back();
-        return pObject;
+        if ( mObjects.size() > 0 )
+        {
+            T* pObject = mObjects.back();
+            mObjects.pop_back();
+            unlock();
+            return pObject;
+        }
+
+        addConstructed( 1 );
+        unlock();
+
+        // Create a new object if cache is empty.
+        return new T();
     }
 
     void cacheObject( T* pObject )
     {
-        // Cache object.
-        this->push_back( pObject );
-
         // Reset object state if available.
         IFactoryObjectReset* pResetStateObject = dynamic_cast<IFactoryObjectReset*>( pObject );
         if ( pResetStateObject != NULL )
             pResetStateObject->resetState();
+
+        // Cache object on this thread if possible.
+        ThreadCache* pThreadCache = getThreadCache();
+        if ( pThreadCache != NULL )
+        {
+            // Make room by moving half the thread cache to the shared cache.
+            if ( pThreadCache->mCount == ThreadCacheSize )
+                flushThreadCache( pThreadCache, ThreadCacheSize / 2 );
+
+            pThreadCache->mpObjects[pThreadCache->mCount++] = pObject;
+            return;
+        }
+
+        lock();
+        mObjects.push_back( pObject );
+        unlock();
+    }
+
+    /// Create objects so that at least the specified count are cached and retain them when trimmed.
+    void preallocate( const U32 count )
+    {
+        if ( count > getRetainCount() )
+            setRetainCount( count );
+
+        lock();
+        const U32 cachedCount = (U32)mObjects.size();
+        if ( cachedCount < count )
+            addConstructed( count - cachedCount );
+        unlock();
+
+        for ( U32 index = cachedCount; index < count; ++index )
+        {
+            T* pObject = new T();
+
+            lock();
+            mObjects.push_back( pObject );
+            unlock();
+        }
+    }
+
+    virtual void trim( void )
+    {
+        deleteCachedObjects( getRetainCount() );
     }
 
     void purgeCache( void )
     {
-        while( this->size() > 0 )
+        deleteCachedObjects( 0 );
+    }
+
+protected:
+    virtual void flushThreadCache( ThreadCache* pThreadCache, const U32 keepCount )
+    {
+        lock();
+        while( pThreadCache->mCount > keepCount )
+            mObjects.push_back( static_cast<T*>( pThreadCache->mpObjects[--pThreadCache->mCount] ) );
+        unlock();
+    }
+
+    virtual U32 getSharedCachedCount( void ) const
+    {
+        return (U32)mObjects.size();
+    }
+
+private:
+    void deleteCachedObjects( const U32 keepCount )
+    {
+        // Include the calling thread's cached objects.
+        ThreadCache* pThreadCache = getThreadCache();
+        if ( pThreadCache != NULL )
+            flushThreadCache( pThreadCache, 0 );
+
+        // NOTE: Objects are deleted outside of the lock as their destructors may use factory caches.
+        while( true )
+        {
+            lock();
+            if ( (U32)mObjects.size() <= keepCount )
+            {
+                unlock();
+                break;
+            }
+
+            T* pObject = mObjects.back();
+            mObjects.pop_back();
+            addConstructed( -1 );
+            unlock();
+
+            delete pObject;
+        }
+
+        // Release the shared cache storage when it is empty.
+        if ( keepCount == 0 )
         {
-            delete this->back();
-            this->pop_back();
+            lock();
+            if ( mObjects.size() == 0 )
+                mObjects.compact();
+            unlock();
         }
     }
+
+    Vector<T*> mObjects;
 };
 
-#endif // _FACTORY_CACHE_H_
\ No newline at end of file
+#endif // _FACTORY_CACHE_H_
@@ -0,0 +1,49 @@
+﻿//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+/*! @defgroup FactoryCacheFunctions Factory Caches
+	@ingroup TorqueScriptFunctions
+	@{
+*/
+
+//-----------------------------------------------------------------------------
+
+/*! Frees the cached objects of all the engine factory caches beyond the count each one retains.
+    Call this at level transitions to release the memory used by the previous level.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs( trimFactoryCaches, ConsoleVoid, 1, 1, () )
+{
+    FactoryCacheBase::trimAll();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Dumps the object counts and high-water marks of all the engine factory caches to the console.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs( dumpFactoryCacheStats, ConsoleVoid, 1, 1, () )
+{
+    FactoryCacheBase::dumpStats();
+}
+
+/*! @} */ // group FactoryCacheFunctions
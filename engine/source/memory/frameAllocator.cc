@@ -0,0 +1,360 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "memory/frameAllocator.h"
+
+#ifndef _PLATFORM_THREADS_ATOMIC_H_
+#include "platform/threads/atomic.h"
+#endif
+
+#ifndef _MMATHFN_H_
+#include "math/mMathFn.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#if defined(_MSC_VER)
+#define FRAME_THREAD_LOCAL __declspec(thread)
+#else
+#define FRAME_THREAD_LOCAL __thread
+#endif
+
+/// A frame arena.  Only the thread using the arena changes its watermark.
+struct FrameArena
+{
+   U8*         mBuffer;
+   U32         mFrameSize;
+   U32         mWaterMark;
+   U32         mFramePeak;
+   U32         mLastFramePeak;
+   U32         mPeak;
+   bool        mInUse;
+   bool        mMainThread;
+   FrameArena* mpNext;
+};
+
+static FrameArena* volatile spArenas = NULL;
+static void* volatile spArenasLock = NULL;
+static U32 sThreadFrameSize = FrameAllocator::DefaultThreadFrameSize;
+static bool sInitialized = false;
+
+static FRAME_THREAD_LOCAL FrameArena* stpThreadArena = NULL;
+
+//-----------------------------------------------------------------------------
+
+static inline void lockArenas()
+{
+   while ( dCompareAndSwapPointer( &spArenasLock, NULL, (void*)1 ) != NULL )
+   {
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+static inline void unlockArenas()
+{
+   dExchangePointer( &spArenasLock, NULL );
+}
+
+//-----------------------------------------------------------------------------
+
+static FrameArena* acquireArena( const U32 frameSize, const bool mainThread )
+{
+   FrameArena* pArena = NULL;
+
+   // Reuse a released arena if one is large enough.
+   lockArenas();
+   for ( FrameArena* pProbe = spArenas; pProbe != NULL; pProbe = pProbe->mpNext )
+   {
+      if ( !pProbe->mInUse && pProbe->mFrameSize >= frameSize )
+      {
+         pProbe->mInUse = true;
+         pProbe->mMainThread = mainThread;
+         pArena = pProbe;
+         break;
+      }
+   }
+   unlockArenas();
+
+   if ( pArena != NULL )
+      return pArena;
+
+   // Create a new arena.
+   pArena = new FrameArena;
+   pArena->mBuffer = new U8[frameSize];
+   pArena->mFrameSize = frameSize;
+   pArena->mWaterMark = 0;
+   pArena->mFramePeak = 0;
+   pArena->mLastFramePeak = 0;
+   pArena->mPeak = 0;
+   pArena->mInUse = true;
+   pArena->mMainThread = mainThread;
+
+   lockArenas();
+   pArena->mpNext = spArenas;
+   spArenas = pArena;
+   unlockArenas();
+
+   return pArena;
+}
+
+//-----------------------------------------------------------------------------
+
+static inline FrameArena* getThreadArena()
+{
+   FrameArena* pArena = stpThreadArena;
+   if ( pArena != NULL )
+      return pArena;
+
+   AssertFatal( sInitialized, "Error, not initialized" );
+
+   // This is the first use on this thread.
+   pArena = acquireArena( sThreadFrameSize, false );
+   stpThreadArena = pArena;
+   return pArena;
+}
+
+//-----------------------------------------------------------------------------
+
+#ifdef TORQUE_DEBUG
+static inline void checkGuard( const FrameArena* pArena )
+{
+   if ( pArena->mWaterMark >= 4 )
+   {
+      const U32* flag = (const U32*)&pArena->mBuffer[pArena->mWaterMark-4];
+      AssertFatal( *flag == (0xdeadbeef ^ pArena->mWaterMark), "FrameAllocator guard overwritten!" );
+   }
+}
+#endif
+
+//-----------------------------------------------------------------------------
+
+void FrameAllocator::init(const U32 frameSize, const U32 threadFrameSize)
+{
+   AssertFatal( !sInitialized, "Error, already initialized" );
+
+   sThreadFrameSize = threadFrameSize;
+   sInitialized = true;
+
+   // The initializing thread is the main thread.
+   stpThreadArena = acquireArena( frameSize, true );
+}
+
+//-----------------------------------------------------------------------------
+
+void FrameAllocator::destroy()
+{
+   AssertFatal( sInitialized, "Error, not initialized" );
+
+   // NOTE: Any other threads that used the allocator must have finished by now.
+   lockArenas();
+   FrameArena* pArena = spArenas;
+   spArenas = NULL;
+   unlockArenas();
+
+   while ( pArena != NULL )
+   {
+      FrameArena* pNext = pArena->mpNext;
+      delete [] pArena->mBuffer;
+      delete pArena;
+      pArena = pNext;
+   }
+
+   stpThreadArena = NULL;
+   sInitialized = false;
+}
+
+//-----------------------------------------------------------------------------
+
+void* FrameAllocator::alloc(const U32 allocSize)
+{
+   FrameArena* pArena = getThreadArena();
+
+   U32 _allocSize = allocSize;
+#ifdef TORQUE_DEBUG
+   _allocSize+=4;
+#endif
+
+   // Keep all frame allocator allocations aligned to DWORD boundries on the 360
+   // Add 3, mask out the lower 3 bits.
+   const U32 waterMark = ( pArena->mWaterMark + ( TORQUE_BYTE_ALIGNMENT - 1 ) ) & (~( TORQUE_BYTE_ALIGNMENT - 1 ));
+   AssertFatal( waterMark + _allocSize <= pArena->mFrameSize, "Error alloc too large, increase frame size!" );
+
+   U8* p = &pArena->mBuffer[waterMark];
+   pArena->mWaterMark = waterMark + _allocSize;
+
+   if ( pArena->mWaterMark > pArena->mFramePeak )
+      pArena->mFramePeak = pArena->mWaterMark;
+
+#ifdef TORQUE_DEBUG
+   U32 *flag = (U32*) &pArena->mBuffer[pArena->mWaterMark-4];
+   *flag = 0xdeadbeef ^ pArena->mWaterMark;
+#endif
+   return p;
+}
+
+//-----------------------------------------------------------------------------
+
+void FrameAllocator::setWaterMark(const U32 waterMark)
+{
+   FrameArena* pArena = getThreadArena();
+
+   AssertFatal( waterMark <= pArena->mFrameSize, "Error, invalid waterMark" );
+
+#ifdef TORQUE_DEBUG
+   checkGuard( pArena );
+#endif
+   pArena->mWaterMark = waterMark;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 FrameAllocator::getWaterMark()
+{
+   return getThreadArena()->mWaterMark;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 FrameAllocator::getHighWaterMark()
+{
+   return getThreadArena()->mFrameSize;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 FrameAllocator::getPeakWaterMark()
+{
+   const FrameArena* pArena = getThreadArena();
+   return getMax( pArena->mPeak, pArena->mFramePeak );
+}
+
+//-----------------------------------------------------------------------------
+
+void FrameAllocator::resetThreadArena()
+{
+   // Nothing to do if this thread has not used the allocator.
+   FrameArena* pArena = stpThreadArena;
+   if ( pArena == NULL )
+      return;
+
+#ifdef TORQUE_DEBUG
+   checkGuard( pArena );
+#endif
+
+   // Record the high-water mark for the frame.
+   pArena->mLastFramePeak = pArena->mFramePeak;
+   if ( pArena->mFramePeak > pArena->mPeak )
+      pArena->mPeak = pArena->mFramePeak;
+
+   pArena->mFramePeak = 0;
+   pArena->mWaterMark = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+void FrameAllocator::releaseThreadArena()
+{
+   FrameArena* pArena = stpThreadArena;
+   if ( pArena == NULL )
+      return;
+
+   resetThreadArena();
+   stpThreadArena = NULL;
+
+   lockArenas();
+   pArena->mInUse = false;
+   pArena->mMainThread = false;
+   unlockArenas();
+}
+
+//-----------------------------------------------------------------------------
+
+U32 FrameAllocator::getArenaCount()
+{
+   U32 count = 0;
+
+   lockArenas();
+   for ( FrameArena* pArena = spArenas; pArena != NULL; pArena = pArena->mpNext )
+      count++;
+   unlockArenas();
+
+   return count;
+}
+
+//-----------------------------------------------------------------------------
+
+bool FrameAllocator::getArenaStats(const U32 index, ArenaStats& stats)
+{
+   bool found = false;
+
+   // NOTE: Arenas in use by other threads may change whilst they are read so their statistics are approximate.
+   lockArenas();
+   U32 arenaIndex = 0;
+   for ( FrameArena* pArena = spArenas; pArena != NULL; pArena = pArena->mpNext, arenaIndex++ )
+   {
+      if ( arenaIndex != index )
+         continue;
+
+      stats.frameSize = pArena->mFrameSize;
+      stats.waterMark = pArena->mWaterMark;
+      stats.framePeak = pArena->mFramePeak;
+      stats.lastFramePeak = pArena->mLastFramePeak;
+      stats.peak = getMax( pArena->mPeak, pArena->mFramePeak );
+      stats.inUse = pArena->mInUse;
+      stats.mainThread = pArena->mMainThread;
+      found = true;
+      break;
+   }
+   unlockArenas();
+
+   return found;
+}
+
+//-----------------------------------------------------------------------------
+
+void FrameAllocator::dumpStats()
+{
+   const U32 arenaCount = getArenaCount();
+
+   Con::printf( "FrameAllocator: %d arena(s)", arenaCount );
+
+   for ( U32 index = 0; index < arenaCount; ++index )
+   {
+      ArenaStats stats;
+      if ( !getArenaStats( index, stats ) )
+         break;
+
+      Con::printf( "  Arena %d (%s): size %d, current %d, frame peak %d, last frame peak %d, peak %d",
+         index,
+         stats.mainThread ? "main" : stats.inUse ? "worker" : "free",
+         stats.frameSize,
+         stats.waterMark,
+         stats.framePeak,
+         stats.lastFramePeak,
+         stats.peak );
+   }
+}
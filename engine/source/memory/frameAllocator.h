@@ -43,44 +43,64 @@
 ///   // Free frameAllocator memory
 ///   FrameAllocator::setWaterMark(waterMark);
 /// @endcode
+///
+/// Each thread allocates from its own arena so the FrameAllocator (and therefore
+/// FrameTemp and FrameAllocatorMarker) can be used from worker threads without locking.
+/// The thread that calls init() uses an arena of the specified frame size.  Other threads
+/// are given an arena of the thread frame size the first time they use the allocator.
+/// Watermarks are only meaningful on the thread that obtained them.
+///
+/// A thread calls resetThreadArena() at its frame boundary, when it holds no frame
+/// allocations, to discard anything left allocated and to record the high-water mark for
+/// the frame.  The game does this for the main thread every frame and the thread pool
+/// workers do it after each batch of work.  Threads that exit should call releaseThreadArena()
+/// so that their arena can be reused by another thread.
 class FrameAllocator
 {
-   static U8*   smBuffer;
-   static U32   smHighWaterMark;
-   static U32   smWaterMark;
+public:
+   enum
+   {
+      DefaultThreadFrameSize = 512 * 1024
+   };
 
-  public:
-   inline static void init(const U32 frameSize);
-   inline static void destroy();
+   /// Statistics for a thread arena.
+   struct ArenaStats
+   {
+      U32   frameSize;
+      U32   waterMark;
+      U32   framePeak;
+      U32   lastFramePeak;
+      U32   peak;
+      bool  inUse;
+      bool  mainThread;
+   };
 
-   inline static void* alloc(const U32 allocSize);
+   static void init(const U32 frameSize, const U32 threadFrameSize = DefaultThreadFrameSize);
+   static void destroy();
 
-   inline static void setWaterMark(const U32);
-   inline static U32  getWaterMark();
-   inline static U32  getHighWaterMark();
-};
+   static void* alloc(const U32 allocSize);
 
-#if defined(TORQUE_DEBUG)
-static U32 sgMaxFrameAllocation = 0;
-#endif
+   static void setWaterMark(const U32);
+   static U32  getWaterMark();
 
-void FrameAllocator::init(const U32 frameSize)
-{
-   AssertFatal(smBuffer == NULL, "Error, already initialized");
-   smBuffer = new U8[frameSize];
-   smWaterMark = 0;
-   smHighWaterMark = frameSize;
-}
+   /// Get the size of the calling thread's arena.
+   static U32  getHighWaterMark();
 
-void FrameAllocator::destroy()
-{
-   AssertFatal(smBuffer != NULL, "Error, not initialized");
+   /// Get the highest watermark the calling thread's arena has reached.
+   static U32  getPeakWaterMark();
 
-   delete [] smBuffer;
-   smBuffer = NULL;
-   smWaterMark = 0;
-   smHighWaterMark = 0;
-}
+   /// Discard all allocations on the calling thread's arena and record its frame high-water mark.
+   static void resetThreadArena();
+
+   /// Return the calling thread's arena for reuse by other threads.
+   static void releaseThreadArena();
+
+   /// Get statistics for the arenas of all threads.
+   static U32  getArenaCount();
+   static bool getArenaStats(const U32 index, ArenaStats& stats);
+
+   static void dumpStats();
+};
 
 /// This #define is used by the FrameAllocator to align starting addresses to
 /// be byte aligned to this value. This is important on the 360 and possibly
@@ -91,63 +111,6 @@ void FrameAllocator::destroy()
 /// memory which is allocated and expected to be contiguous.
 #define TORQUE_BYTE_ALIGNMENT 4
 
-
-void* FrameAllocator::alloc(const U32 allocSize)
-{
-   U32 _allocSize = allocSize;
-#ifdef TORQUE_DEBUG
-   _allocSize+=4;
-#endif
-   AssertFatal(smBuffer != NULL, "Error, no buffer!");
-   AssertFatal(smWaterMark + _allocSize <= smHighWaterMark, "Error alloc too large, increase frame size!");
-
-   // Keep all frame allocator allocations aligned to DWORD boundries on the 360
-   // Add 3, mask out the lower 3 bits.
-   smWaterMark = ( smWaterMark + ( TORQUE_BYTE_ALIGNMENT - 1 ) ) & (~( TORQUE_BYTE_ALIGNMENT - 1 ));
-
-   // Sanity check.
-   AssertFatal( !( smWaterMark & ( TORQUE_BYTE_ALIGNMENT - 1 ) ), "Frame allocation is not on a 4-byte boundry." );
-
-   U8* p = &smBuffer[smWaterMark];
-   smWaterMark += _allocSize;
-
-#if defined(TORQUE_DEBUG)
-   if (smWaterMark > sgMaxFrameAllocation)
-      sgMaxFrameAllocation = smWaterMark;
-#endif
-
-#ifdef TORQUE_DEBUG
-   U32 *flag = (U32*) &smBuffer[smWaterMark-4];
-   *flag = 0xdeadbeef ^ smWaterMark;
-#endif
-   return p;
-}
-
-
-void FrameAllocator::setWaterMark(const U32 waterMark)
-{
-   AssertFatal(waterMark < smHighWaterMark, "Error, invalid waterMark");
-
-#ifdef TORQUE_DEBUG
-   if(smWaterMark >= 4 )
-   {
-      U32 *flag = (U32*) &smBuffer[smWaterMark-4];
-      AssertFatal( *flag == (0xdeadbeef ^ smWaterMark), "FrameAllocator guard overwritten!");
-   }
-#endif
-   smWaterMark = waterMark;
-}
-
-U32 FrameAllocator::getWaterMark()
-{
-   return smWaterMark;
-}
-
-U32 FrameAllocator::getHighWaterMark()
-{
-   return smHighWaterMark;
-}
-
 /// Helper class to deal with FrameAllocator usage.
 ///
 /// The purpose of this class is to make it simpler and more reliable to use the
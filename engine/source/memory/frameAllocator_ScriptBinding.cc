@@ -23,24 +23,33 @@
 #include "frameAllocator.h"
 #include "console/console.h"
 
-U8*   FrameAllocator::smBuffer = NULL;
-U32   FrameAllocator::smWaterMark = 0;
-U32   FrameAllocator::smHighWaterMark = 0;
-
-#if defined(TORQUE_DEBUG)
-
 /*! @defgroup MemoryFrameAllocation Memory Frames
 	@ingroup TorqueScriptFunctions
 	@{
 */
 
-/*!
+/*! Gets the highest frame allocator watermark reached by the main thread.
+    @return The peak frame allocation in bytes.
 */
 ConsoleFunctionWithDocs(getMaxFrameAllocation, S32, 1,1, ())
 {
-   return sgMaxFrameAllocation;
+   const U32 arenaCount = FrameAllocator::getArenaCount();
+   for ( U32 index = 0; index < arenaCount; ++index )
+   {
+      FrameAllocator::ArenaStats stats;
+      if ( FrameAllocator::getArenaStats( index, stats ) && stats.mainThread )
+         return stats.peak;
+   }
+
+   return 0;
 }
 
-/*! @} */ // end group MemoryFrameAllocation
+/*! Dumps the size and high-water marks of the frame allocator arenas of all threads to the console.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(dumpFrameAllocatorStats, void, 1,1, ())
+{
+   FrameAllocator::dumpStats();
+}
 
-#endif
+/*! @} */ // end group MemoryFrameAllocation
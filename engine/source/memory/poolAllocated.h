@@ -0,0 +1,68 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _POOL_ALLOCATED_H_
+#define _POOL_ALLOCATED_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// Allocates instances of a small, frequently created class from the small-block pool
+/// rather than the general heap.  Derive the class from this, passing the class itself:
+///
+/// @code
+/// class SceneRenderRequest : public PoolAllocated<SceneRenderRequest>
+/// @endcode
+///
+/// Instances larger than the pool's largest size class are allocated from the heap as usual.
+/// @see Memory::allocateSmall()
+template<class T>
+class PoolAllocated
+{
+public:
+    static void* operator new( size_t size )
+    {
+        void* ptr = Memory::allocateSmall( (dsize_t)size );
+        AssertISV( ptr != NULL, "PoolAllocated - Out of memory." );
+        return ptr;
+    }
+
+    static void operator delete( void* ptr )
+    {
+        dFree( ptr );
+    }
+
+    // Placement forms, as declaring the above hides the global ones.
+    static void* operator new( size_t, void* ptr )
+    {
+        return ptr;
+    }
+
+    static void operator delete( void*, void* )
+    {
+    }
+};
+
+#endif // _POOL_ALLOCATED_H_
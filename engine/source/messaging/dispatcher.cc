@@ -87,7 +87,13 @@ static struct _DispatchData
    void *mMutex;
    SimpleHashTable<MessageQueue> mQueues;
 
-   _DispatchData()
+   /// Queues with messages waiting for processQueuedMessages().
+   Vector<MessageQueue *> mPendingQueues;
+
+   /// Incremented whenever a queue is unregistered so QueueRefs know to look their queue up again.
+   U32 mUnregisterSequence;
+
+   _DispatchData() : mUnregisterSequence(0)
    {
       mMutex = Mutex::createMutex();
    }
@@ -107,6 +113,119 @@ static struct _DispatchData
    }
 } gDispatchData;
 
+//////////////////////////////////////////////////////////////////////////
+// MessageQueue Methods
+//////////////////////////////////////////////////////////////////////////
+
+void MessageQueue::queueMessage(const char* event, const char* data)
+{
+   QueuedMessage queued;
+   queued.mEvent = StringTable->insert(event);
+   queued.mDataOffset = mQueuedData.size();
+   queued.mMessage = NULL;
+   mQueuedMessages.push_back(queued);
+
+   // Copy the data, including the terminator.
+   mQueuedData.increment(data, dStrlen(data) + 1);
+
+   if(! mPending)
+   {
+      mPending = true;
+      gDispatchData.mPendingQueues.push_back(this);
+   }
+}
+
+void MessageQueue::queueMessageObject(Message *msg)
+{
+   QueuedMessage queued;
+   queued.mEvent = NULL;
+   queued.mDataOffset = 0;
+   queued.mMessage = msg;
+   mQueuedMessages.push_back(queued);
+
+   // The reference is freed once the message has been delivered.
+   msg->addReference();
+
+   if(! mPending)
+   {
+      mPending = true;
+      gDispatchData.mPendingQueues.push_back(this);
+   }
+}
+
+void MessageQueue::clearQueuedMessages()
+{
+   for(S32 i = 0;i < mQueuedMessages.size();i++)
+   {
+      if(mQueuedMessages[i].mMessage)
+         mQueuedMessages[i].mMessage->freeReference();
+   }
+
+   mQueuedMessages.clear();
+   mQueuedData.clear();
+}
+
+void MessageQueue::dispatchQueuedMessages()
+{
+   // Take the queued messages so any posted by the listeners wait for the next tick.
+   Vector<QueuedMessage> messages(mQueuedMessages);
+   Vector<char> data(mQueuedData);
+   mQueuedMessages.clear();
+   mQueuedData.clear();
+
+   // Messages a listener has returned false for aren't passed to later listeners.
+   Vector<bool> consumed;
+   consumed.setSize(messages.size());
+   for(S32 i = 0;i < consumed.size();i++)
+      consumed[i] = false;
+
+   mDispatching = true;
+
+   // Deliver all the messages to each listener in turn.
+   for(S32 i = 0;i < mListeners.size() && ! mRemoved;i++)
+   {
+      IMessageListener *listener = mListeners[i];
+
+      for(S32 j = 0;j < messages.size();j++)
+      {
+         if(consumed[j])
+            continue;
+
+         const QueuedMessage &queued = messages[j];
+         const bool result = queued.mMessage ?
+            listener->onMessageObjectReceived(mQueueName, queued.mMessage) :
+            listener->onMessageReceived(mQueueName, queued.mEvent, &data[queued.mDataOffset]);
+
+         if(! result)
+            consumed[j] = true;
+      }
+   }
+
+   mDispatching = false;
+
+   for(S32 i = 0;i < messages.size();i++)
+   {
+      if(messages[i].mMessage)
+         messages[i].mMessage->freeReference();
+   }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// QueueRef Methods
+//////////////////////////////////////////////////////////////////////////
+
+MessageQueue *QueueRef::resolve()
+{
+   // Look the queue up if it isn't resolved or may have been unregistered.
+   if(mQueue == NULL || mUnregisterSequence != gDispatchData.mUnregisterSequence)
+   {
+      mQueue = mName != NULL ? gDispatchData.mQueues.retrieve(mName) : NULL;
+      mUnregisterSequence = gDispatchData.mUnregisterSequence;
+   }
+
+   return mQueue;
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Queue Registration
 //////////////////////////////////////////////////////////////////////////
@@ -146,12 +265,22 @@ void unregisterMessageQueue(const char *name)
       if(queue == NULL)
          return;
 
+      gDispatchData.mUnregisterSequence++;
+
       // Tell the listeners about it
       for(S32 i = 0;i < queue->mListeners.size();i++)
       {
          queue->mListeners[i]->onRemoveFromQueue(name);
       }
 
+      // Queues waiting for or in processQueuedMessages() are deleted by it.
+      if(queue->mPending || queue->mDispatching)
+      {
+         queue->clearQueuedMessages();
+         queue->mRemoved = true;
+         return;
+      }
+
       delete queue;
    }
 }
@@ -217,6 +346,21 @@ void unregisterMessageListener(const char *queue, IMessageListener *listener)
 // Dispatcher
 //////////////////////////////////////////////////////////////////////////
 
+// [tom, 8/19/2006] Make sure that the message is registered with the sim, since
+// when it's ref count is zero it'll be deleted with deleteObject()
+static bool registerMessageObject(Message *msg)
+{
+   if(msg->isProperlyAdded())
+      return true;
+
+   SimObjectId id = Message::getNextMessageID();
+   if(id != 0xffffffff)
+      return msg->registerObject(id);
+
+   Con::errorf("dispatchMessageObject: Message was not registered and no more object IDs are available for messages");
+   return false;
+}
+
 bool dispatchMessage(const char *queue, const char *msg, const char *data)
 {
    MutexHandle mh;
@@ -258,20 +402,62 @@ bool dispatchMessageObject(const char *queue, Message *msg)
       return true;
    }
 
-   // [tom, 8/19/2006] Make sure that the message is registered with the sim, since
-   // when it's ref count is zero it'll be deleted with deleteObject()
-   if(! msg->isProperlyAdded())
+   if(! registerMessageObject(msg))
    {
-      SimObjectId id = Message::getNextMessageID();
-      if(id != 0xffffffff)
-         msg->registerObject(id);
-      else
-      {
-         Con::errorf("dispatchMessageObject: Message was not registered and no more object IDs are available for messages");
+      msg->freeReference();
+      return false;
+   }
 
-         msg->freeReference();
-         return false;
-      }
+   bool bResult = q->dispatchMessageObject(msg);
+   msg->freeReference();
+
+   return bResult;
+}
+
+bool dispatchMessage(QueueRef &queue, const char *msg, const char *data)
+{
+   MutexHandle mh;
+
+   if(! mh.lock(gDispatchData.mMutex, true))
+      return true;
+
+   MessageQueue *q = queue.resolve();
+   if(q == NULL)
+   {
+      Con::errorf("Dispatcher::dispatchMessage - Attempting to dispatch to unknown queue '%s'", queue.getName());
+      return true;
+   }
+
+   return q->dispatchMessage(msg, data);
+}
+
+bool dispatchMessageObject(QueueRef &queue, Message *msg)
+{
+   MutexHandle mh;
+
+   if(msg == NULL)
+      return true;
+
+   msg->addReference();
+
+   if(! mh.lock(gDispatchData.mMutex, true))
+   {
+      msg->freeReference();
+      return true;
+   }
+
+   MessageQueue *q = queue.resolve();
+   if(q == NULL)
+   {
+      Con::errorf("Dispatcher::dispatchMessage - Attempting to dispatch to unknown queue '%s'", queue.getName());
+      msg->freeReference();
+      return true;
+   }
+
+   if(! registerMessageObject(msg))
+   {
+      msg->freeReference();
+      return false;
    }
 
    bool bResult = q->dispatchMessageObject(msg);
@@ -280,6 +466,80 @@ bool dispatchMessageObject(const char *queue, Message *msg)
    return bResult;
 }
 
+//////////////////////////////////////////////////////////////////////////
+// Queued Messages
+//////////////////////////////////////////////////////////////////////////
+
+bool postMessage(QueueRef &queue, const char *msg, const char *data)
+{
+   MutexHandle mh;
+
+   if(! mh.lock(gDispatchData.mMutex, true))
+      return false;
+
+   MessageQueue *q = queue.resolve();
+   if(q == NULL)
+   {
+      Con::errorf("Dispatcher::postMessage - Attempting to post to unknown queue '%s'", queue.getName());
+      return false;
+   }
+
+   q->queueMessage(msg, data != NULL ? data : "");
+   return true;
+}
+
+bool postMessageObject(QueueRef &queue, Message *msg)
+{
+   MutexHandle mh;
+
+   if(msg == NULL)
+      return false;
+
+   if(! mh.lock(gDispatchData.mMutex, true))
+      return false;
+
+   MessageQueue *q = queue.resolve();
+   if(q == NULL)
+   {
+      Con::errorf("Dispatcher::postMessageObject - Attempting to post to unknown queue '%s'", queue.getName());
+      return false;
+   }
+
+   // Register the message now as the caller may free its own reference before it is delivered.
+   msg->addReference();
+   const bool registered = registerMessageObject(msg);
+   if(registered)
+      q->queueMessageObject(msg);
+
+   msg->freeReference();
+   return registered;
+}
+
+void processQueuedMessages()
+{
+   MutexHandle mh;
+
+   if(! mh.lock(gDispatchData.mMutex, true))
+      return;
+
+   // Take the pending queues so any posted to by the listeners wait for the next tick.
+   Vector<MessageQueue *> pendingQueues(gDispatchData.mPendingQueues);
+   gDispatchData.mPendingQueues.clear();
+
+   for(S32 i = 0;i < pendingQueues.size();i++)
+   {
+      MessageQueue *q = pendingQueues[i];
+      q->mPending = false;
+
+      if(! q->mRemoved)
+         q->dispatchQueuedMessages();
+
+      // Delete the queue if it was unregistered and isn't pending again.
+      if(q->mRemoved && ! q->mPending)
+         delete q;
+   }
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Internal Functions
 //////////////////////////////////////////////////////////////////////////
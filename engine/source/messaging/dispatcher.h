@@ -122,15 +122,85 @@ public:
    virtual void onRemoveFromQueue(StringTableEntry queue);
 };
 
+//////////////////////////////////////////////////////////////////////////
+/// @brief Listener that forwards messages to member functions of a native object
+///
+/// This allows a native class to receive messages without implementing
+/// IMessageListener itself, and without the script callbacks made by
+/// ScriptMsgListener. Message objects are only forwarded if they are of
+/// type MsgT, other message objects are passed on to the next listener.
+/// Either callback may be NULL to ignore that kind of message.
+///
+/// @code
+/// class MyController
+/// {
+///    Dispatcher::NativeMsgListener<MyController, MyMessage> mListener;
+///
+///    bool onMessage(StringTableEntry queue, const char *event, const char *data);
+///    bool onMyMessage(StringTableEntry queue, MyMessage *msg);
+///
+/// public:
+///    MyController() : mListener(this, &MyController::onMessage, &MyController::onMyMessage) {}
+/// };
+/// @endcode
+//////////////////////////////////////////////////////////////////////////
+template <class T, class MsgT = Message> class NativeMsgListener : public IMessageListener
+{
+public:
+   typedef bool (T::*MessageCallback)(StringTableEntry queue, const char *event, const char *data);
+   typedef bool (T::*MessageObjectCallback)(StringTableEntry queue, MsgT *msg);
+
+   NativeMsgListener(T *object, MessageCallback messageCallback, MessageObjectCallback messageObjectCallback = NULL) :
+      mObject(object),
+      mMessageCallback(messageCallback),
+      mMessageObjectCallback(messageObjectCallback)
+   {
+   }
+
+   virtual bool onMessageReceived(StringTableEntry queue, const char *event, const char *data)
+   {
+      return mMessageCallback == NULL || (mObject->*mMessageCallback)(queue, event, data);
+   }
+
+   virtual bool onMessageObjectReceived(StringTableEntry queue, Message *msg)
+   {
+      if(mMessageObjectCallback == NULL)
+         return true;
+
+      MsgT *typedMsg = dynamic_cast<MsgT *>(msg);
+      return typedMsg == NULL || (mObject->*mMessageObjectCallback)(queue, typedMsg);
+   }
+
+private:
+   T *mObject;
+   MessageCallback mMessageCallback;
+   MessageObjectCallback mMessageObjectCallback;
+};
+
 //////////////////////////////////////////////////////////////////////////
 /// @brief Internal class for tracking message queues
 //////////////////////////////////////////////////////////////////////////
 struct MessageQueue
 {
+   /// A message posted to the queue with postMessage() or postMessageObject().
+   struct QueuedMessage
+   {
+      StringTableEntry mEvent;   ///< Message type, or NULL for a message object.
+      U32 mDataOffset;           ///< Offset of the message data in #mQueuedData.
+      Message *mMessage;         ///< Message object, or NULL.
+   };
+
    StringTableEntry mQueueName;
    VectorPtr<IMessageListener *> mListeners;
 
-   MessageQueue() : mQueueName("")
+   Vector<QueuedMessage> mQueuedMessages;
+   Vector<char> mQueuedData;
+
+   bool mPending;       ///< Whether the queue is waiting for processQueuedMessages().
+   bool mDispatching;   ///< Whether queued messages are being delivered.
+   bool mRemoved;       ///< Whether the queue was unregistered whilst pending or dispatching.
+
+   MessageQueue() : mQueueName(""), mPending(false), mDispatching(false), mRemoved(false)
    {
    }
 
@@ -155,6 +225,63 @@ struct MessageQueue
       }
       return true;
    }
+
+   bool hasQueuedMessages()   { return mQueuedMessages.size() != 0; }
+
+   void queueMessage(const char* event, const char* data);
+   void queueMessageObject(Message *msg);
+   void clearQueuedMessages();
+
+   /// Deliver the queued messages grouped by listener.
+   void dispatchQueuedMessages();
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// @brief Pre-resolved reference to a message queue
+///
+/// Dispatching by queue name hashes the name to find the queue each time.
+/// A QueueRef finds the queue the first time it is used and only looks it
+/// up again if a queue has been unregistered since, so code that sends
+/// many messages to the same queue should keep one around. The name is
+/// added to the string table so a QueueRef must not be constructed with a
+/// name before the string table exists.
+///
+/// @code
+/// static Dispatcher::QueueRef sGameEvents("GameEvents");   // in a function
+/// Dispatcher::dispatchMessage(sGameEvents, "onScore", "10");
+/// @endcode
+//////////////////////////////////////////////////////////////////////////
+class QueueRef
+{
+public:
+   QueueRef() : mName(NULL), mQueue(NULL), mUnregisterSequence(0)
+   {
+   }
+
+   explicit QueueRef(const char *name) : mName(NULL), mQueue(NULL), mUnregisterSequence(0)
+   {
+      setName(name);
+   }
+
+   void setName(const char *name)
+   {
+      mName = name != NULL && *name ? StringTable->insert(name) : NULL;
+      mQueue = NULL;
+   }
+
+   StringTableEntry getName() const  { return mName != NULL ? mName : ""; }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// @brief Find the queue. Dispatcher mutex must be locked.
+   /// 
+   /// @return Message queue or NULL if it is not registered
+   //////////////////////////////////////////////////////////////////////////
+   MessageQueue *resolve();
+
+private:
+   StringTableEntry mName;
+   MessageQueue *mQueue;
+   U32 mUnregisterSequence;
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -234,6 +361,57 @@ extern bool dispatchMessage(const char *queue, const char *msg, const char *data
 //////////////////////////////////////////////////////////////////////////
 extern bool dispatchMessageObject(const char *queue, Message *msg);
 
+//////////////////////////////////////////////////////////////////////////
+/// @brief Dispatch a message to a pre-resolved queue
+/// @see dispatchMessage(), QueueRef
+//////////////////////////////////////////////////////////////////////////
+extern bool dispatchMessage(QueueRef &queue, const char *msg, const char *data);
+
+//////////////////////////////////////////////////////////////////////////
+/// @brief Dispatch a message object to a pre-resolved queue
+/// @see dispatchMessageObject(), QueueRef
+//////////////////////////////////////////////////////////////////////////
+extern bool dispatchMessageObject(QueueRef &queue, Message *msg);
+
+// @}
+
+/// @name Queued Messages
+/// Messages posted to a queue are held until processQueuedMessages() is called
+/// once per tick. They are then delivered grouped by listener, so each listener
+/// receives all of the queue's messages for the tick in the order they were
+/// posted before the next listener is called. As with dispatchMessage(), a
+/// listener returning false stops that message reaching later listeners.
+// @{
+
+//////////////////////////////////////////////////////////////////////////
+/// @brief Post a message to a queue for delivery on the next tick
+/// 
+/// @param queue Queue to post the message to
+/// @param msg Message to post
+/// @param data Data for message, which is copied
+/// @return true for success, false if the queue is not registered
+/// @see processQueuedMessages()
+//////////////////////////////////////////////////////////////////////////
+extern bool postMessage(QueueRef &queue, const char *msg, const char *data);
+
+//////////////////////////////////////////////////////////////////////////
+/// @brief Post a message object to a queue for delivery on the next tick
+/// 
+/// @param queue Queue to post the message to
+/// @param msg Message to post, which is referenced until it is delivered
+/// @return true for success, false otherwise
+/// @see processQueuedMessages()
+//////////////////////////////////////////////////////////////////////////
+extern bool postMessageObject(QueueRef &queue, Message *msg);
+
+//////////////////////////////////////////////////////////////////////////
+/// @brief Deliver all the messages posted since the last call
+/// 
+/// Messages posted by listeners whilst this is running are delivered by the
+/// next call.
+//////////////////////////////////////////////////////////////////////////
+extern void processQueuedMessages();
+
 // @}
 
 //////////////////////////////////////////////////////////////////////////
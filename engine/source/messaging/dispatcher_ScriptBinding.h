@@ -119,4 +119,36 @@ ConsoleFunctionWithDocs(dispatchMessageObject, ConsoleBool, 3, 3, (queueName, me
    return dispatchMessageObject(argv[1], msg);
 }
 
+//////////////////////////////////////////////////////////////////////////
+
+/*! Posts a message to given message queue for delivery on the next tick
+    @param queueName The queue to post to
+    @param event The message you are passing
+    @param data Data
+    @return Returns true on success and false otherwise
+*/
+ConsoleFunctionWithDocs(postMessage, ConsoleBool, 3, 4, (queueName, event, data))
+{
+   QueueRef queue(argv[1]);
+   return postMessage(queue, argv[2], argc > 3 ? argv[3] : "" );
+}
+
+/*! Posts a message object to the given queue for delivery on the next tick
+    @param queueName The name of the queue to post object to
+    @param message The message object
+    @return Returns true on success and false otherwise
+*/
+ConsoleFunctionWithDocs(postMessageObject, ConsoleBool, 3, 3, (queueName, message))
+{
+   Message *msg = dynamic_cast<Message *>(Sim::findObject(argv[2]));
+   if(msg == NULL)
+   {
+      Con::errorf("postMessageObject - Unable to find message object");
+      return false;
+   }
+
+   QueueRef queue(argv[1]);
+   return postMessageObject(queue, msg);
+}
+
 /*! @} */ // group MessageQueueFunctions
@@ -108,6 +108,8 @@ void EventManager::setMessageQueue( const char* queue )
       Dispatcher::registerMessageListener( queue, &mListener );
       mQueue = StringTable->insert( queue );
    }
+
+   mQueueRef.setName( queue );
 }
 
 //-----------------------------------------------------------------------------
@@ -210,7 +212,19 @@ void EventManager::unregisterEvent( const char* event )
 //-----------------------------------------------------------------------------
 bool EventManager::postEvent( const char* event, const char* data )
 {
-   return Dispatcher::dispatchMessage( mQueue, event, data );
+   return Dispatcher::dispatchMessage( mQueueRef, event, data );
+}
+
+//-----------------------------------------------------------------------------
+/// Queue an event to be posted to the EventManager's queue on the next tick.
+/// 
+/// @param event The event to post.
+/// @param data Various data associated with the event.
+/// @return Whether or not the message was queued successfully.
+//-----------------------------------------------------------------------------
+bool EventManager::queueEvent( const char* event, const char* data )
+{
+   return Dispatcher::postMessage( mQueueRef, event, data );
 }
 
 //-----------------------------------------------------------------------------
@@ -92,6 +92,8 @@ class EventManager : public SimObject
 private:
    /// The name of the message queue.
    StringTableEntry mQueue;
+   /// The message queue resolved for posting events.
+   Dispatcher::QueueRef mQueueRef;
    /// Registered events.
    Vector<StringTableEntry> mEvents;
 
@@ -137,6 +139,8 @@ public:
 
    /// Triggers an event.
    bool postEvent( const char* eventName, const char* data );
+   /// Queues an event to be triggered on the next tick.
+   bool queueEvent( const char* eventName, const char* data );
    /// Adds a subscription to an event.
    bool subscribe( SimObject *callbackObj, const char* event, const char* callback = NULL );
    /// Remove a subscriber from an event.
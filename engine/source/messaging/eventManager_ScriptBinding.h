@@ -62,6 +62,17 @@ ConsoleMethodWithDocs( EventManager, postEvent, ConsoleBool, 3, 4, ( String even
    return object->postEvent( argv[2], argc > 3 ? argv[3] : "" );
 }
 
+/*! 
+    Queue an event to be triggered on the next tick.  Queued events are delivered together, grouped by listener.
+    @param event The event to trigger.
+    @param data The data associated with the event.
+    @return Whether or not the event was queued successfully.
+*/
+ConsoleMethodWithDocs( EventManager, queueEvent, ConsoleBool, 3, 4, ( String event, String data ))
+{
+   return object->queueEvent( argv[2], argc > 3 ? argv[3] : "" );
+}
+
 /*! 
     Subscribe a listener to an event.
     @param listener The listener to subscribe.
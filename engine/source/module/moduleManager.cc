@@ -38,6 +38,17 @@
 #include "console/consoleTypes.h"
 #endif
 
+#ifndef _CONSOLE_VARIABLE_REF_H_
+#include "console/consoleVariableRef.h"
+#endif
+
+#ifndef _FILE_PREFETCH_H_
+#include "io/filePrefetch.h"
+#endif
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
 // Script bindings.
 #include "moduleManager_ScriptBinding.h"
 
@@ -51,6 +62,11 @@ ModuleManager ModuleDatabase;
 
 //-----------------------------------------------------------------------------
 
+/// Milliseconds spent loading the modules of asynchronous group loads per call to processAsyncGroupLoads().
+static Con::VariableRef<F32> sgAsyncLoadBudget( "pref::ModuleManager::asyncLoadBudget", 8.0f );
+
+//-----------------------------------------------------------------------------
+
 S32 QSORT_CALLBACK moduleDefinitionVersionIdSort( const void* a, const void* b )
 {
     // Fetch module definitions.
@@ -68,6 +84,8 @@ S32 QSORT_CALLBACK moduleDefinitionVersionIdSort( const void* a, const void* b )
 //-----------------------------------------------------------------------------
 
 ModuleManager::ModuleManager() :
+    mScanCacheFile( StringTable->EmptyString ),
+    mScanCacheLoaded( false ),
     mEnforceDependencies(true),
     mEchoInfo(true),
     mDatabaseLocks( 0 )
@@ -99,6 +117,10 @@ void ModuleManager::onRemove()
     // Unregister object.
     mNotificationListeners.unregisterObject();
 
+    // Save the module scan cache if it has changed.
+    if ( mScanCacheFile != StringTable->EmptyString && mScanCache.isDirty() )
+        mScanCache.save( mScanCacheFile );
+
     // Call parent.
     Parent::onRemove();
 }
@@ -112,6 +134,7 @@ void ModuleManager::initPersistFields()
 
     addField( "EnforceDependencies", TypeBool, Offset(mEnforceDependencies, ModuleManager), "Whether the module manager enforces any dependencies on module definitions it discovers or not." );
     addField( "EchoInfo", TypeBool, Offset(mEchoInfo, ModuleManager), "Whether the module manager echos extra information to the console or not." );
+    addField( "ScanCacheFile", TypeString, Offset(mScanCacheFile, ModuleManager), "The file used to cache module scans so that unchanged directories are not walked again.  Caching is disabled if empty." );
 }
 
 //-----------------------------------------------------------------------------
@@ -180,10 +203,21 @@ bool ModuleManager::scanModules( const char* pPath, const bool rootOnly )
         Con::printf( "Module Manager: Started scanning '%s'...", pathBuffer );
     }
 
+    // Is the scan cache in use?
+    const bool useScanCache = mScanCacheFile != StringTable->EmptyString;
+
+    // Load the scan cache if it's not been loaded.
+    if ( useScanCache && !mScanCacheLoaded )
+    {
+        mScanCache.load( mScanCacheFile );
+        mScanCacheLoaded = true;
+    }
+
     Vector<StringTableEntry> directories;
 
     // Find directories.
-    if ( !Platform::dumpDirectories( pathBuffer, directories, rootOnly ? 1 : -1 ) )
+    // NOTE: The scan cache reuses the directories and files found previously if the directories haven't changed.
+    if ( !(useScanCache ? mScanCache.dumpDirectories( pathBuffer, directories, rootOnly ? 1 : -1 ) : Platform::dumpDirectories( pathBuffer, directories, rootOnly ? 1 : -1 )) )
     {
         // Failed so warn.
         Con::warnf( "Module Manager: Failed to scan module directories in path '%s'.", pathBuffer );
@@ -207,7 +241,7 @@ bool ModuleManager::scanModules( const char* pPath, const bool rootOnly )
 
         // Find files.
         files.clear();
-        if ( !Platform::dumpPath( basePath, files, 0 ) )
+        if ( !(useScanCache ? mScanCache.dumpPath( basePath, files, 0 ) : Platform::dumpPath( basePath, files, 0 )) )
         {
             // Failed so warn.
             Con::warnf( "Module Manager: Failed to scan modules files in directory '%s'.", basePath );
@@ -262,7 +296,6 @@ bool ModuleManager::loadModuleGroup( const char* pModuleGroup )
     // Sanity!
     AssertFatal( pModuleGroup != NULL, "Cannot load module group with NULL group name." );
 
-    typeModuleLoadEntryVector   moduleResolvingQueue;
     typeModuleLoadEntryVector   moduleReadyQueue;
 
     // Fetch module group.
@@ -275,184 +308,211 @@ bool ModuleManager::loadModuleGroup( const char* pModuleGroup )
         Con::printf( "Module Manager: Loading group '%s':" ,moduleGroup );
     }
 
-    // Is the module group already loaded?
-    if ( findGroupLoaded( moduleGroup ) != NULL )
-    {
-        // Yes, so warn.
-        Con::warnf( "Module Manager: Cannot load group '%s' as it is already loaded.", moduleGroup );
+    // Finish if we could not resolve the modules to load.
+    if ( !resolveModuleGroupLoad( moduleGroup, moduleReadyQueue ) )
         return false;
-    }
 
-    // Find module group.
-    typeGroupModuleHash::iterator moduleGroupItr = mGroupModules.find( moduleGroup );
+    // Finish if there are no modules in the group.
+    if ( moduleReadyQueue.size() == 0 )
+        return true;
 
-    // Did we find the module group?
-    if ( moduleGroupItr == mGroupModules.end() )
+    // Add module group.
+    mGroupsLoaded.push_back( moduleGroup );
+
+    // Reset modules loaded count.
+    U32 modulesLoadedCount = 0;
+
+    // Iterate the modules, executing their script files and call their create function.
+    for ( typeModuleLoadEntryVector::iterator moduleReadyItr = moduleReadyQueue.begin(); moduleReadyItr != moduleReadyQueue.end(); ++moduleReadyItr )
     {
-        // No, so info.
-        if ( mEchoInfo )
-        {
-            Con::printf( "Module Manager: No modules found for module group '%s'.", moduleGroup );
-        }
-        
-        return true;
+        // Load the module, bumping the modules loaded count if it was not already loaded.
+        if ( loadReadyModule( moduleGroup, *moduleReadyItr ) )
+            modulesLoadedCount++;
     }
 
-    // Yes, so fetch the module Ids.
-    typeModuleIdVector* pModuleIds = moduleGroupItr->value;
-
-    // Iterate module groups.
-    for( typeModuleIdVector::iterator moduleIdItr = pModuleIds->begin(); moduleIdItr != pModuleIds->end(); ++moduleIdItr )
+    // Info.
+    if ( mEchoInfo )
     {
-        // Fetch module Id.
-        StringTableEntry moduleId = *moduleIdItr;
+        Con::printSeparator();
+        Con::printf( "Module Manager: Finish loading '%d' module(s) for group '%s'.", modulesLoadedCount, moduleGroup );
+        Con::printSeparator();
+    }
 
-        // Finish if we could not resolve the dependencies for module Id (of any version Id).
-        if ( !resolveModuleDependencies( moduleId, 0, moduleGroup, false, moduleResolvingQueue, moduleReadyQueue ) )
-            return false;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool ModuleManager::loadModuleGroupAsync( const char* pModuleGroup )
+{
+    // Lock database.
+    LockDatabase( this );
+
+    // Sanity!
+    AssertFatal( pModuleGroup != NULL, "Cannot load module group with NULL group name." );
+
+    typeModuleLoadEntryVector   moduleReadyQueue;
+
+    // Fetch module group.
+    StringTableEntry moduleGroup = StringTable->insert( pModuleGroup );
+
+    // Info.
+    if ( mEchoInfo )
+    {
+        Con::printSeparator();
+        Con::printf( "Module Manager: Loading group '%s' asynchronously:" ,moduleGroup );
     }
 
-    // Check the modules we want to load to ensure that we do not have incompatible modules loaded already.
+    // Finish if we could not resolve the modules to load.
+    if ( !resolveModuleGroupLoad( moduleGroup, moduleReadyQueue ) )
+        return false;
+
+    // Finish if there are no modules in the group.
+    if ( moduleReadyQueue.size() == 0 )
+        return true;
+
+    // Add module group.
+    // NOTE: The group is treated as loaded immediately so that it cannot be loaded again whilst its modules are loading.
+    mGroupsLoaded.push_back( moduleGroup );
+
+    // Create the asynchronous load.
+    AsyncGroupLoad* pGroupLoad = new AsyncGroupLoad();
+    pGroupLoad->mModuleGroup = moduleGroup;
+    pGroupLoad->mModuleReadyQueue = moduleReadyQueue;
+    pGroupLoad->mLoadIndex = 0;
+    pGroupLoad->mModulesLoadedCount = 0;
+    mAsyncGroupLoads.push_back( pGroupLoad );
+
+    // Prefetch the script files of the modules in the order they will be loaded.
+    // NOTE: Only the files are read in the background.  The scripts are compiled and executed when each module is loaded.
+    char dsoPathBuffer[1024];
     for ( typeModuleLoadEntryVector::iterator moduleReadyItr = moduleReadyQueue.begin(); moduleReadyItr != moduleReadyQueue.end(); ++moduleReadyItr )
     {
-        // Fetch load ready module definition.
-        ModuleDefinition* pLoadReadyModuleDefinition = moduleReadyItr->mpModuleDefinition;;
+        // Fetch the module script file-path.
+        StringTableEntry scriptFilePath = moduleReadyItr->mpModuleDefinition->getModuleScriptFilePath();
 
-        // Fetch the module Id loaded entry.
-        ModuleLoadEntry* pLoadedModuleEntry = findModuleLoaded( pLoadReadyModuleDefinition->getModuleId() );
+        U32 prefetchSequence = 0;
 
-        // Did we find a loaded entry?
-        if ( pLoadedModuleEntry != NULL )
+        // Do we have a script file-path specified?
+        if ( scriptFilePath != StringTable->EmptyString )
         {
-            // Yes, so is it the one we need to load?
-            if ( pLoadedModuleEntry->mpModuleDefinition != pLoadReadyModuleDefinition )
-            {
-                // Yes, so warn.
-                Con::warnf( "Module Manager: Cannot load module group '%s' as the module Id '%s' at version Id '%d' is required but the module Id is already loaded but at version Id '%d'.",
-                    moduleGroup, pLoadReadyModuleDefinition->getModuleId(), pLoadReadyModuleDefinition->getVersionId(), pLoadedModuleEntry->mpModuleDefinition->getVersionId() );
-                return false;
-            }
+            // Yes, so prefetch the compiled script if it exists otherwise the script itself.
+            dSprintf( dsoPathBuffer, sizeof(dsoPathBuffer), "%s.dso", scriptFilePath );
+            prefetchSequence = FilePrefetch::queue( Platform::isFile( dsoPathBuffer ) ? StringTable->insert( dsoPathBuffer ) : scriptFilePath );
         }
+
+        pGroupLoad->mPrefetchSequences.push_back( prefetchSequence );
     }
 
-    // Info.
-    if ( mEchoInfo )
-    {
-        // Info.
-        Con::printf( "Module Manager: Group '%s' and its dependencies is comprised of the following '%d' module(s):", moduleGroup, moduleReadyQueue.size() );
+    return true;
+}
 
-        // Iterate the modules echoing them.
-        for ( typeModuleLoadEntryVector::iterator moduleReadyItr = moduleReadyQueue.begin(); moduleReadyItr != moduleReadyQueue.end(); ++moduleReadyItr )
-        {
-            // Fetch the ready entry.
-            ModuleDefinition* pModuleDefinition = moduleReadyItr->mpModuleDefinition;
+//-----------------------------------------------------------------------------
 
-            // Info.
-            Con::printf( "> module Id '%s' at version Id '%d':", pModuleDefinition->getModuleId(), pModuleDefinition->getVersionId() );
-        }
-    }
+bool ModuleManager::isModuleGroupLoading( const char* pModuleGroup )
+{
+    // Sanity!
+    AssertFatal( pModuleGroup != NULL, "Cannot query module group with NULL group name." );
 
-    // Add module group.
-    mGroupsLoaded.push_back( moduleGroup );
+    return findAsyncGroupLoad( StringTable->insert( pModuleGroup ) ) != NULL;
+}
 
-    // Reset modules loaded count.
-    U32 modulesLoadedCount = 0;
+//-----------------------------------------------------------------------------
 
-    // Iterate the modules, executing their script files and call their create function.
-    for ( typeModuleLoadEntryVector::iterator moduleReadyItr = moduleReadyQueue.begin(); moduleReadyItr != moduleReadyQueue.end(); ++moduleReadyItr )
+F32 ModuleManager::getModuleGroupLoadProgress( const char* pModuleGroup )
+{
+    // Sanity!
+    AssertFatal( pModuleGroup != NULL, "Cannot query module group with NULL group name." );
+
+    // Fetch module group.
+    StringTableEntry moduleGroup = StringTable->insert( pModuleGroup );
+
+    // Find the asynchronous load.
+    typeAsyncGroupLoadVector::iterator groupLoadItr = findAsyncGroupLoad( moduleGroup );
+
+    // Is the group still loading?
+    if ( groupLoadItr == NULL )
     {
-        // Fetch the ready entry.
-        ModuleLoadEntry* pReadyEntry = moduleReadyItr;
+        // No, so the group is either loaded or not loaded at all.
+        return findGroupLoaded( moduleGroup ) != NULL ? 1.0f : 0.0f;
+    }
 
-        // Fetch load ready module definition.
-        ModuleDefinition* pLoadReadyModuleDefinition = pReadyEntry->mpModuleDefinition;
+    // Yes, so calculate the progress.
+    const AsyncGroupLoad* pGroupLoad = *groupLoadItr;
+    return (F32)pGroupLoad->mLoadIndex / (F32)pGroupLoad->mModuleReadyQueue.size();
+}
 
-        // Fetch any loaded entry for the module Id.
-        ModuleLoadEntry* pLoadedEntry = findModuleLoaded( pLoadReadyModuleDefinition->getModuleId() );
+//-----------------------------------------------------------------------------
 
-        // Is the module already loaded.
-        if ( pLoadedEntry != NULL )
-        {
-            // Yes, so increase load count.
-            pLoadedEntry->mpModuleDefinition->increaseLoadCount();
+bool ModuleManager::finishModuleGroupLoad( const char* pModuleGroup )
+{
+    // Sanity!
+    AssertFatal( pModuleGroup != NULL, "Cannot finish loading module group with NULL group name." );
 
-            // Skip.
-            continue;
-        }
+    // Find the asynchronous load.
+    typeAsyncGroupLoadVector::iterator groupLoadItr = findAsyncGroupLoad( StringTable->insert( pModuleGroup ) );
 
-        // No, so info.
-        if ( mEchoInfo )
-        {
-            Con::printSeparator();
-            Con::printf( "Module Manager: Loading group '%s' : module Id '%s' at version Id '%d' in group '%s' using the script file '%s'.",
-                moduleGroup, pLoadReadyModuleDefinition->getModuleId(), pLoadReadyModuleDefinition->getVersionId(), pLoadReadyModuleDefinition->getModuleGroup(), pLoadReadyModuleDefinition->getModuleScriptFilePath() );
-        }
+    // Finish if the group is not loading.
+    if ( groupLoadItr == NULL )
+        return false;
 
-        // Is the module deprecated?
-        if ( pLoadReadyModuleDefinition->getDeprecated() )
-        {
-            // Yes, so warn.
-            Con::warnf( "Module Manager: Caution: module Id '%s' at version Id '%d' in group '%s' is deprecated.  You should use a newer version!",
-                pLoadReadyModuleDefinition->getModuleId(), pLoadReadyModuleDefinition->getVersionId(), pLoadReadyModuleDefinition->getModuleGroup() );
-        }
+    // Load the remaining modules.
+    AsyncGroupLoad* pGroupLoad = *groupLoadItr;
+    mAsyncGroupLoads.erase( groupLoadItr );
+    completeAsyncGroupLoad( pGroupLoad );
 
-        // Add the path expando for module.
-        Con::addPathExpando( pLoadReadyModuleDefinition->getModuleId(), pLoadReadyModuleDefinition->getModulePath() );
+    return true;
+}
 
-        // Create a scope set.
-        SimSet* pScopeSet = new SimSet;
-        pScopeSet->registerObject( pLoadReadyModuleDefinition->getModuleId() );
-        pReadyEntry->mpModuleDefinition->mScopeSet = pScopeSet->getId();
+//-----------------------------------------------------------------------------
 
-        // Increase load count.
-        pReadyEntry->mpModuleDefinition->increaseLoadCount();
+void ModuleManager::processAsyncGroupLoads( const bool ignoreBudget )
+{
+    // Finish if there is nothing loading.
+    if ( mAsyncGroupLoads.size() == 0 )
+        return;
 
-        // Queue module loaded.
-        mModulesLoaded.push_back( *pReadyEntry );
+    // Debug Profiling.
+    PROFILE_SCOPE(ModuleManager_ProcessAsyncGroupLoads);
 
-        // Bump modules loaded count.
-        modulesLoadedCount++;
+    // Lock database.
+    LockDatabase( this );
 
-        // Raise notifications.
-        raiseModulePreLoadNotifications( pLoadReadyModuleDefinition );
+    // Fetch the budget.
+    const U32 startTime = Platform::getRealMilliseconds();
+    const F32 budget = sgAsyncLoadBudget;
+    const U32 prefetchedSequence = FilePrefetch::getCompletedSequence();
 
-        // Do we have a script file-path specified?
-        if ( pLoadReadyModuleDefinition->getModuleScriptFilePath() != StringTable->EmptyString )
-        {
-            // Yes, so execute the script file.
-            const bool scriptFileExecuted = dAtob( Con::executef(2, "exec", pLoadReadyModuleDefinition->getModuleScriptFilePath() ) );
+    // Load modules in the order the groups were requested.
+    while ( mAsyncGroupLoads.size() > 0 )
+    {
+        // Fetch the oldest group load.
+        AsyncGroupLoad* pGroupLoad = mAsyncGroupLoads.front();
 
-            // Did we execute the script file?
-            if ( scriptFileExecuted )
-            {
-                // Yes, so is the create method available?
-                if ( pScopeSet->isMethod( pLoadReadyModuleDefinition->getCreateFunction() ) )
-                {
-                    // Yes, so call the create method.
-                    Con::executef( pScopeSet, 1, pLoadReadyModuleDefinition->getCreateFunction() );
-                }
-            }
-            else
-            {
-                // No, so warn.
-                Con::errorf( "Module Manager: Cannot load module group '%s' as the module Id '%s' at version Id '%d' as it failed to have the script file '%s' loaded.",
-                    moduleGroup, pLoadReadyModuleDefinition->getModuleId(), pLoadReadyModuleDefinition->getVersionId(), pLoadReadyModuleDefinition->getModuleScriptFilePath() );
-            }
+        // Has the group finished loading?
+        if ( pGroupLoad->mLoadIndex == (U32)pGroupLoad->mModuleReadyQueue.size() )
+        {
+            // Yes, so complete it.
+            mAsyncGroupLoads.pop_front();
+            completeAsyncGroupLoad( pGroupLoad );
+            continue;
         }
 
-        // Raise notifications.
-        raiseModulePostLoadNotifications( pLoadReadyModuleDefinition );
-    }
+        // Finish if the next module script file has not been read yet, unless we are ignoring the budget.
+        if ( !ignoreBudget && pGroupLoad->mPrefetchSequences[pGroupLoad->mLoadIndex] > prefetchedSequence )
+            break;
 
-    // Info.
-    if ( mEchoInfo )
-    {
-        Con::printSeparator();
-        Con::printf( "Module Manager: Finish loading '%d' module(s) for group '%s'.", modulesLoadedCount, moduleGroup );
-        Con::printSeparator();
-    }
+        // Load the next module.
+        if ( loadReadyModule( pGroupLoad->mModuleGroup, pGroupLoad->mModuleReadyQueue[pGroupLoad->mLoadIndex] ) )
+            pGroupLoad->mModulesLoadedCount++;
 
-    return true;
+        pGroupLoad->mLoadIndex++;
+
+        // Finish if we have used the budget.
+        // NOTE: At least one module is loaded each time so that loading always progresses.
+        if ( !ignoreBudget && (F32)(Platform::getRealMilliseconds() - startTime) >= budget )
+            break;
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -478,6 +538,10 @@ bool ModuleManager::unloadModuleGroup( const char* pModuleGroup )
         Con::printf( "Module Manager: Unloading group '%s':" , moduleGroup );
     }
 
+    // Finish loading the module group if it is loading asynchronously.
+    // NOTE: The modules of the group are then unloaded as if the group was loaded normally.
+    finishModuleGroupLoad( moduleGroup );
+
     // Find the group loaded iterator.
     typeGroupVector::iterator groupLoadedItr = findGroupLoaded( moduleGroup );
 
@@ -565,7 +629,7 @@ bool ModuleManager::unloadModuleGroup( const char* pModuleGroup )
             if ( mEchoInfo )
             {
                 Con::printf( "Module Manager: Unloading group '%s' but could not unload module Id '%s' at version Id '%d'.",
-                    moduleGroup, pLoadedEntry->mpModuleDefinition->getModuleId(), pLoadedEntry->mpModuleDefinition->getVersionId() );
+                    moduleGroup, pLoadReadyModuleDefinition->getModuleId(), pLoadReadyModuleDefinition->getVersionId() );
             }
             // Skip.
             continue;
@@ -1808,6 +1872,21 @@ bool ModuleManager::removeModuleDefinition( ModuleDefinition* pModuleDefinition
         return false;
     }
 
+    // Is the module definition waiting to be loaded asynchronously?
+    for ( typeAsyncGroupLoadVector::iterator groupLoadItr = mAsyncGroupLoads.begin(); groupLoadItr != mAsyncGroupLoads.end(); ++groupLoadItr )
+    {
+        const AsyncGroupLoad* pGroupLoad = *groupLoadItr;
+        for ( U32 index = pGroupLoad->mLoadIndex; index < (U32)pGroupLoad->mModuleReadyQueue.size(); ++index )
+        {
+            if ( pGroupLoad->mModuleReadyQueue[index].mpModuleDefinition != pModuleDefinition )
+                continue;
+
+            // Yes, so warn.
+            Con::warnf("Cannot remove module definition '%s' as it is waiting to be loaded by module group '%s'.", moduleId, pGroupLoad->mModuleGroup );
+            return false;
+        }
+    }
+
     // Find module Id.
     typeModuleIdDatabaseHash::iterator moduleItr = mModuleIdDatabase.find( moduleId );
 
@@ -2433,6 +2512,219 @@ bool ModuleManager::resolveModuleDependencies( StringTableEntry moduleId, const
 
 //-----------------------------------------------------------------------------
 
+bool ModuleManager::resolveModuleGroupLoad( StringTableEntry moduleGroup, typeModuleLoadEntryVector& moduleReadyQueue )
+{
+    typeModuleLoadEntryVector   moduleResolvingQueue;
+
+    // Is the module group already loaded?
+    if ( findGroupLoaded( moduleGroup ) != NULL )
+    {
+        // Yes, so warn.
+        Con::warnf( "Module Manager: Cannot load group '%s' as it is already loaded.", moduleGroup );
+        return false;
+    }
+
+    // Find module group.
+    typeGroupModuleHash::iterator moduleGroupItr = mGroupModules.find( moduleGroup );
+
+    // Did we find the module group?
+    if ( moduleGroupItr == mGroupModules.end() )
+    {
+        // No, so info.
+        if ( mEchoInfo )
+        {
+            Con::printf( "Module Manager: No modules found for module group '%s'.", moduleGroup );
+        }
+        
+        return true;
+    }
+
+    // Yes, so fetch the module Ids.
+    typeModuleIdVector* pModuleIds = moduleGroupItr->value;
+
+    // Iterate module groups.
+    for( typeModuleIdVector::iterator moduleIdItr = pModuleIds->begin(); moduleIdItr != pModuleIds->end(); ++moduleIdItr )
+    {
+        // Fetch module Id.
+        StringTableEntry moduleId = *moduleIdItr;
+
+        // Finish if we could not resolve the dependencies for module Id (of any version Id).
+        if ( !resolveModuleDependencies( moduleId, 0, moduleGroup, false, moduleResolvingQueue, moduleReadyQueue ) )
+            return false;
+    }
+
+    // Check the modules we want to load to ensure that we do not have incompatible modules loaded already.
+    for ( typeModuleLoadEntryVector::iterator moduleReadyItr = moduleReadyQueue.begin(); moduleReadyItr != moduleReadyQueue.end(); ++moduleReadyItr )
+    {
+        // Fetch load ready module definition.
+        ModuleDefinition* pLoadReadyModuleDefinition = moduleReadyItr->mpModuleDefinition;;
+
+        // Fetch the module Id loaded entry.
+        ModuleLoadEntry* pLoadedModuleEntry = findModuleLoaded( pLoadReadyModuleDefinition->getModuleId() );
+
+        // Did we find a loaded entry?
+        if ( pLoadedModuleEntry != NULL )
+        {
+            // Yes, so is it the one we need to load?
+            if ( pLoadedModuleEntry->mpModuleDefinition != pLoadReadyModuleDefinition )
+            {
+                // Yes, so warn.
+                Con::warnf( "Module Manager: Cannot load module group '%s' as the module Id '%s' at version Id '%d' is required but the module Id is already loaded but at version Id '%d'.",
+                    moduleGroup, pLoadReadyModuleDefinition->getModuleId(), pLoadReadyModuleDefinition->getVersionId(), pLoadedModuleEntry->mpModuleDefinition->getVersionId() );
+                return false;
+            }
+        }
+    }
+
+    // Info.
+    if ( mEchoInfo )
+    {
+        // Info.
+        Con::printf( "Module Manager: Group '%s' and its dependencies is comprised of the following '%d' module(s):", moduleGroup, moduleReadyQueue.size() );
+
+        // Iterate the modules echoing them.
+        for ( typeModuleLoadEntryVector::iterator moduleReadyItr = moduleReadyQueue.begin(); moduleReadyItr != moduleReadyQueue.end(); ++moduleReadyItr )
+        {
+            // Fetch the ready entry.
+            ModuleDefinition* pModuleDefinition = moduleReadyItr->mpModuleDefinition;
+
+            // Info.
+            Con::printf( "> module Id '%s' at version Id '%d':", pModuleDefinition->getModuleId(), pModuleDefinition->getVersionId() );
+        }
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool ModuleManager::loadReadyModule( StringTableEntry moduleGroup, ModuleLoadEntry& readyEntry )
+{
+    // Fetch load ready module definition.
+    ModuleDefinition* pLoadReadyModuleDefinition = readyEntry.mpModuleDefinition;
+
+    // Fetch any loaded entry for the module Id.
+    ModuleLoadEntry* pLoadedEntry = findModuleLoaded( pLoadReadyModuleDefinition->getModuleId() );
+
+    // Is the module already loaded.
+    if ( pLoadedEntry != NULL )
+    {
+        // Yes, so increase load count.
+        pLoadedEntry->mpModuleDefinition->increaseLoadCount();
+
+        return false;
+    }
+
+    // No, so info.
+    if ( mEchoInfo )
+    {
+        Con::printSeparator();
+        Con::printf( "Module Manager: Loading group '%s' : module Id '%s' at version Id '%d' in group '%s' using the script file '%s'.",
+            moduleGroup, pLoadReadyModuleDefinition->getModuleId(), pLoadReadyModuleDefinition->getVersionId(), pLoadReadyModuleDefinition->getModuleGroup(), pLoadReadyModuleDefinition->getModuleScriptFilePath() );
+    }
+
+    // Is the module deprecated?
+    if ( pLoadReadyModuleDefinition->getDeprecated() )
+    {
+        // Yes, so warn.
+        Con::warnf( "Module Manager: Caution: module Id '%s' at version Id '%d' in group '%s' is deprecated.  You should use a newer version!",
+            pLoadReadyModuleDefinition->getModuleId(), pLoadReadyModuleDefinition->getVersionId(), pLoadReadyModuleDefinition->getModuleGroup() );
+    }
+
+    // Add the path expando for module.
+    Con::addPathExpando( pLoadReadyModuleDefinition->getModuleId(), pLoadReadyModuleDefinition->getModulePath() );
+
+    // Create a scope set.
+    SimSet* pScopeSet = new SimSet;
+    pScopeSet->registerObject( pLoadReadyModuleDefinition->getModuleId() );
+    pLoadReadyModuleDefinition->mScopeSet = pScopeSet->getId();
+
+    // Increase load count.
+    pLoadReadyModuleDefinition->increaseLoadCount();
+
+    // Queue module loaded.
+    mModulesLoaded.push_back( readyEntry );
+
+    // Raise notifications.
+    raiseModulePreLoadNotifications( pLoadReadyModuleDefinition );
+
+    // Do we have a script file-path specified?
+    if ( pLoadReadyModuleDefinition->getModuleScriptFilePath() != StringTable->EmptyString )
+    {
+        // Yes, so execute the script file.
+        const bool scriptFileExecuted = dAtob( Con::executef(2, "exec", pLoadReadyModuleDefinition->getModuleScriptFilePath() ) );
+
+        // Did we execute the script file?
+        if ( scriptFileExecuted )
+        {
+            // Yes, so is the create method available?
+            if ( pScopeSet->isMethod( pLoadReadyModuleDefinition->getCreateFunction() ) )
+            {
+                // Yes, so call the create method.
+                Con::executef( pScopeSet, 1, pLoadReadyModuleDefinition->getCreateFunction() );
+            }
+        }
+        else
+        {
+            // No, so warn.
+            Con::errorf( "Module Manager: Cannot load module group '%s' as the module Id '%s' at version Id '%d' as it failed to have the script file '%s' loaded.",
+                moduleGroup, pLoadReadyModuleDefinition->getModuleId(), pLoadReadyModuleDefinition->getVersionId(), pLoadReadyModuleDefinition->getModuleScriptFilePath() );
+        }
+    }
+
+    // Raise notifications.
+    raiseModulePostLoadNotifications( pLoadReadyModuleDefinition );
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void ModuleManager::completeAsyncGroupLoad( AsyncGroupLoad* pGroupLoad )
+{
+    // Lock database.
+    LockDatabase( this );
+
+    // Load any remaining modules.
+    while ( pGroupLoad->mLoadIndex < (U32)pGroupLoad->mModuleReadyQueue.size() )
+    {
+        if ( loadReadyModule( pGroupLoad->mModuleGroup, pGroupLoad->mModuleReadyQueue[pGroupLoad->mLoadIndex] ) )
+            pGroupLoad->mModulesLoadedCount++;
+
+        pGroupLoad->mLoadIndex++;
+    }
+
+    // Info.
+    if ( mEchoInfo )
+    {
+        Con::printSeparator();
+        Con::printf( "Module Manager: Finish loading '%d' module(s) for group '%s'.", pGroupLoad->mModulesLoadedCount, pGroupLoad->mModuleGroup );
+        Con::printSeparator();
+    }
+
+    StringTableEntry moduleGroup = pGroupLoad->mModuleGroup;
+    delete pGroupLoad;
+
+    // Perform the group loaded callback.
+    if ( isMethod( "onModuleGroupLoaded" ) )
+        Con::executef( this, 2, "onModuleGroupLoaded", moduleGroup );
+}
+
+//-----------------------------------------------------------------------------
+
+ModuleManager::typeAsyncGroupLoadVector::iterator ModuleManager::findAsyncGroupLoad( StringTableEntry moduleGroup )
+{
+    for ( typeAsyncGroupLoadVector::iterator groupLoadItr = mAsyncGroupLoads.begin(); groupLoadItr != mAsyncGroupLoads.end(); ++groupLoadItr )
+    {
+        if ( (*groupLoadItr)->mModuleGroup == moduleGroup )
+            return groupLoadItr;
+    }
+
+    return NULL;
+}
+
+//-----------------------------------------------------------------------------
+
 ModuleManager::ModuleLoadEntry* ModuleManager::findModuleResolving( StringTableEntry moduleId, typeModuleLoadEntryVector& moduleResolvingQueue )
 {
     // Iterate module load resolving queue.
@@ -43,6 +43,10 @@
 #include "moduleDefinition.h"
 #endif
 
+#ifndef _DIRECTORY_SCAN_CACHE_H_
+#include "io/directoryScanCache.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 #define MODULE_MANAGER_MERGE_FILE                   "module.merge"
@@ -107,6 +111,25 @@ private:
     typeGroupVector             mGroupsLoaded;
     typeModuleLoadEntryVector   mModulesLoaded;
 
+    /// Asynchronous module group load.
+    struct AsyncGroupLoad
+    {
+        StringTableEntry            mModuleGroup;
+        typeModuleLoadEntryVector   mModuleReadyQueue;
+        Vector<U32>                 mPrefetchSequences;
+        U32                         mLoadIndex;
+        U32                         mModulesLoadedCount;
+    };
+
+    /// Asynchronous module group loading.
+    typedef Vector<AsyncGroupLoad*> typeAsyncGroupLoadVector;
+    typeAsyncGroupLoadVector    mAsyncGroupLoads;
+
+    /// Module scan cache.
+    DirectoryScanCache          mScanCache;
+    StringTableEntry            mScanCacheFile;
+    bool                        mScanCacheLoaded;
+
     /// Miscellaneous.
     bool                        mEnforceDependencies;
     bool                        mEchoInfo;
@@ -163,6 +186,16 @@ public:
     bool loadModuleExplicit( const char* pModuleId, const U32 versionId = 0 );
     bool unloadModuleExplicit( const char* pModuleId );
 
+    /// Asynchronous module group loading.
+    /// The script files of the modules are read in the background then the modules are loaded, in dependency order,
+    /// a few at a time by processAsyncGroupLoads().  Compiling and executing scripts always happens on the main thread.
+    bool loadModuleGroupAsync( const char* pModuleGroup );
+    bool isModuleGroupLoading( const char* pModuleGroup );
+    F32 getModuleGroupLoadProgress( const char* pModuleGroup );
+    bool finishModuleGroupLoad( const char* pModuleGroup );
+    void processAsyncGroupLoads( const bool ignoreBudget = false );
+    inline U32 getAsyncGroupLoadCount( void ) const { return mAsyncGroupLoads.size(); }
+
     /// Module type enumeration.
     ModuleDefinition* findModule( const char* pModuleId, const U32 versionId );
     ModuleDefinition* findLoadedModule( const char* pModuleId );
@@ -194,6 +227,10 @@ private:
 
     ModuleDefinitionEntry* findModuleId( StringTableEntry moduleId );
     ModuleDefinitionEntry::iterator findModuleDefinition( StringTableEntry moduleId, const U32 versionId );
+    bool resolveModuleGroupLoad( StringTableEntry moduleGroup, typeModuleLoadEntryVector& moduleReadyQueue );
+    bool loadReadyModule( StringTableEntry moduleGroup, ModuleLoadEntry& readyEntry );
+    void completeAsyncGroupLoad( AsyncGroupLoad* pGroupLoad );
+    typeAsyncGroupLoadVector::iterator findAsyncGroupLoad( StringTableEntry moduleGroup );
     bool resolveModuleDependencies( StringTableEntry moduleId, const U32 versionId, StringTableEntry moduleGroup, bool synchronizedOnly, typeModuleLoadEntryVector& moduleResolvingQueue, typeModuleLoadEntryVector& moduleReadyQueue );
     ModuleLoadEntry* findModuleResolving( StringTableEntry moduleId, typeModuleLoadEntryVector& moduleResolvingQueue );
     ModuleLoadEntry* findModuleReady( StringTableEntry moduleId, typeModuleLoadEntryVector& moduleReadyQueue );
@@ -103,6 +103,53 @@ ConsoleMethodWithDocs(ModuleManager, unloadGroup, ConsoleBool, 3, 3, (moduleGrou
 
 //-----------------------------------------------------------------------------
 
+/*! Load the specified module group asynchronously.
+    The script files of the modules are read in the background and the modules are then loaded, in dependency order, a few each frame.
+    The group is treated as loaded immediately and "onModuleGroupLoaded(moduleGroup)" is called on the module manager when all its modules have loaded.
+    @param moduleGroup The module group to load.
+    @return Whether the module group load was started or not.
+*/
+ConsoleMethodWithDocs(ModuleManager, loadGroupAsync, ConsoleBool, 3, 3, (moduleGroup))
+{
+    // Load module group asynchronously.
+    return object->loadModuleGroupAsync( argv[2] );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Check whether the specified module group is still loading asynchronously.
+    @param moduleGroup The module group to check.
+    @return Whether the module group is still loading or not.
+*/
+ConsoleMethodWithDocs(ModuleManager, isGroupLoading, ConsoleBool, 3, 3, (moduleGroup))
+{
+    return object->isModuleGroupLoading( argv[2] );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Get the progress of loading the specified module group.
+    @param moduleGroup The module group to check.
+    @return The fraction (0 to 1) of the modules in the group that have been loaded.
+*/
+ConsoleMethodWithDocs(ModuleManager, getGroupLoadProgress, ConsoleFloat, 3, 3, (moduleGroup))
+{
+    return object->getModuleGroupLoadProgress( argv[2] );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Load any remaining modules of the specified module group immediately.
+    @param moduleGroup The module group to finish loading.
+    @return Whether the module group was loading or not.
+*/
+ConsoleMethodWithDocs(ModuleManager, finishGroupLoad, ConsoleBool, 3, 3, (moduleGroup))
+{
+    return object->finishModuleGroupLoad( argv[2] );
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Load the specified module explicitly.
     @param moduleId The module Id to load.
     @param versionId The version Id to load.  Optional:  Will load the latest version.
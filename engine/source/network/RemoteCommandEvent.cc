@@ -42,6 +42,202 @@ char RemoteCommandEvent::mBuf[1024];
 
 IMPLEMENT_CO_NETEVENT_V1(RemoteCommandEvent);
 
+RemoteCommandEvent::RemoteCommandEvent(S32 argc, const char **argv, NetConnection *conn)
+{
+   mCommandCount = 0;
+   mArgBytes = 0;
+   if(argc)
+      addCommand(argc, argv, conn);
+}
+
+RemoteCommandEvent::~RemoteCommandEvent()
+{
+   for(S32 c = 0; c < mCommandCount; c++)
+   {
+      for(S32 i = 0; i < mCommands[c].mArgc; i++)
+         dFree(mCommands[c].mArgv[i+1]);
+   }
+}
+
+bool RemoteCommandEvent::addCommand(S32 argc, const char **argv, NetConnection *conn)
+{
+   // Keep the event small enough to share a packet with others.
+   S32 argBytes = 0;
+   for(S32 i = 0; i < argc; i++)
+      argBytes += dStrlen(argv[i]);
+
+   if(mCommandCount == MaxBatchCommands || (mCommandCount > 0 && mArgBytes + argBytes > MaxBatchArgBytes))
+      return false;
+
+   mArgBytes += argBytes;
+
+   Command &command = mCommands[mCommandCount++];
+   command.mArgc = argc;
+   for(S32 i = 0; i < argc; i++)
+   {
+      if(argv[i][0] == StringTagPrefixByte)
+      {
+         char buffer[256];
+         command.mTagv[i+1] = NetStringHandle(dAtoi(argv[i]+1));
+         if(conn)
+         {
+            dSprintf(buffer + 1, sizeof(buffer) - 1, "%d", conn->getNetSendId(command.mTagv[i+1]));
+            buffer[0] = StringTagPrefixByte;
+            command.mArgv[i+1] = dStrdup(buffer);
+         }
+         else
+            command.mArgv[i+1] = dStrdup(argv[i]);
+      }
+      else
+         command.mArgv[i+1] = dStrdup(argv[i]);
+   }
+   return true;
+}
+
+void RemoteCommandEvent::packArg(NetConnection *conn, BitStream *bstream, S32 commandIndex, S32 argIndex)
+{
+   const char *arg = mCommands[commandIndex].mArgv[argIndex+1];
+
+   // Repeated from the previous command?
+   if(commandIndex > 0)
+   {
+      const Command &previous = mCommands[commandIndex - 1];
+      if(argIndex < previous.mArgc && !dStrcmp(arg, previous.mArgv[argIndex+1]))
+      {
+         bstream->writeInt(ArgRepeat, ArgCodeBits);
+         return;
+      }
+   }
+
+   // A float which formats back to the same string?  Integers are packed better as strings.
+   if((arg[0] == '-' || arg[0] == '.' || (arg[0] >= '0' && arg[0] <= '9')) && dStrchr(arg, '.'))
+   {
+      char buf[32];
+      F32 value = dAtof(arg);
+      dSprintf(buf, sizeof(buf), "%g", value);
+      if(!dStrcmp(buf, arg))
+      {
+         bstream->writeInt(ArgFloat, ArgCodeBits);
+         bstream->write(value);
+         return;
+      }
+   }
+
+   bstream->writeInt(ArgString, ArgCodeBits);
+   conn->packString(bstream, arg);
+}
+
+void RemoteCommandEvent::unpackArg(NetConnection *conn, BitStream *bstream, S32 commandIndex, S32 argIndex)
+{
+   switch(bstream->readInt(ArgCodeBits))
+   {
+      case ArgRepeat:
+      {
+         const Command &previous = mCommands[commandIndex > 0 ? commandIndex - 1 : 0];
+         mBuf[0] = 0;
+         if(commandIndex > 0 && argIndex < previous.mArgc)
+            dStrcpy(mBuf, previous.mArgv[argIndex+1]);
+         break;
+      }
+      case ArgFloat:
+      {
+         F32 value;
+         bstream->read(&value);
+         dSprintf(mBuf, sizeof(mBuf), "%g", value);
+         break;
+      }
+      default:
+         conn->unpackString(bstream, mBuf);
+         break;
+   }
+   mCommands[commandIndex].mArgv[argIndex+1] = dStrdup(mBuf);
+}
+
+void RemoteCommandEvent::pack(NetConnection* conn, BitStream *bstream)
+{
+   bstream->writeInt(mCommandCount - 1, BatchCommandsBits);
+   for(S32 c = 0; c < mCommandCount; c++)
+   {
+      bstream->writeInt(mCommands[c].mArgc, CommandArgsBits);
+      for(S32 i = 0; i < mCommands[c].mArgc; i++)
+         packArg(conn, bstream, c, i);
+   }
+}
+
+void RemoteCommandEvent::write(NetConnection* conn, BitStream *bstream)
+{
+   pack(conn, bstream);
+}
+
+void RemoteCommandEvent::unpack(NetConnection* conn, BitStream *bstream)
+{
+   mCommandCount = bstream->readInt(BatchCommandsBits) + 1;
+   for(S32 c = 0; c < mCommandCount; c++)
+   {
+      mCommands[c].mArgc = bstream->readInt(CommandArgsBits);
+      for(S32 i = 0; i < mCommands[c].mArgc; i++)
+         unpackArg(conn, bstream, c, i);
+   }
+}
+
+void RemoteCommandEvent::process(NetConnection *conn)
+{
+   for(S32 c = 0; c < mCommandCount; c++)
+      processCommand(conn, mCommands[c]);
+}
+
+void RemoteCommandEvent::processCommand(NetConnection *conn, Command &command)
+{
+   static char idBuf[10];
+   S32 argc = command.mArgc;
+   char **argv = command.mArgv;
+
+   // de-tag the command name
+
+   for(S32 i = argc - 1; i >= 0; i--)
+   {
+      char *arg = argv[i+1];
+      if(*arg == StringTagPrefixByte)
+      {
+         // it's a tag:
+         U32 localTag = dAtoi(arg + 1);
+         NetStringHandle tag = conn->translateRemoteStringId(localTag);
+         NetStringTable::expandString( tag,
+                                       mBuf,
+                                       sizeof(mBuf),
+                                       (argc - 1) - i,
+                                       (const char**)(argv + i + 2) );
+         dFree(argv[i+1]);
+         argv[i+1] = dStrdup(mBuf);
+      }
+   }
+   const char *rmtCommandName = dStrchr(argv[1], ' ') + 1;
+   if(conn->isConnectionToServer())
+   {
+      dStrcpy(mBuf, "clientCmd");
+      dStrcat(mBuf, rmtCommandName);
+
+      char *temp = argv[1];
+      argv[1] = mBuf;
+
+      Con::execute(argc, (const char **) argv+1);
+      argv[1] = temp;
+   }
+   else
+   {
+      dStrcpy(mBuf, "serverCmd");
+      dStrcat(mBuf, rmtCommandName);
+      char *temp = argv[1];
+
+      dSprintf(idBuf, sizeof(idBuf), "%d", conn->getId());
+      argv[0] = mBuf;
+      argv[1] = idBuf;
+
+      Con::execute(argc+1, (const char **) argv);
+      argv[1] = temp;
+   }
+}
+
 static void sendRemoteCommand(NetConnection *conn, S32 argc, const char **argv)
 {
    if(U8(argv[0][0]) != StringTagPrefixByte)
@@ -56,8 +252,17 @@ static void sendRemoteCommand(NetConnection *conn, S32 argc, const char **argv)
          break;
       argc = i;
    }
+
+   // Fetch the previous command event before any tagged strings are posted.
+   RemoteCommandEvent *pending = dynamic_cast<RemoteCommandEvent *>(conn->getUnsentOrderedEvent());
+
    for(i = 0; i < argc; i++)
       conn->validateSendString(argv[i]);
+
+   // Add to the previous command event if nothing has been posted since.
+   if(pending && pending == conn->getUnsentOrderedEvent() && pending->addCommand(argc, argv, conn))
+      return;
+
    RemoteCommandEvent *cevt = new RemoteCommandEvent(argc, argv, conn);
    conn->postNetEvent(cevt);
 }
@@ -23,133 +23,70 @@
 #ifndef _H_REMOTECOMMANDEVENT
 #define _H_REMOTECOMMANDEVENT
 
+/// Sends commandToServer() and commandToClient() calls.
+///
+/// Commands issued to a connection before its previous command event has been sent are
+/// added to that event, so a burst of commands costs a single guaranteed-ordered event.
+/// Arguments are written in a typed form: floats as 32-bit values, integers and tags
+/// by NetConnection::packString(), and any argument equal to the same argument of the
+/// previous command in the event as a single code.
 class RemoteCommandEvent : public NetEvent
 {
 public:
    enum {
       MaxRemoteCommandArgs = 20,
-      CommandArgsBits = 5
+      CommandArgsBits = 5,
+      MaxBatchCommands = 8,
+      BatchCommandsBits = 3,
+      MaxBatchArgBytes = 256,    ///< Commands are only added whilst the arguments total fewer bytes than this.
+   };
+
+   /// Argument codes.
+   enum {
+      ArgRepeat,                 ///< Same as the argument of the previous command.
+      ArgFloat,                  ///< A float that formats back to the same string.
+      ArgString,                 ///< Written with NetConnection::packString().
+      ArgCodeBits = 2
    };
 
 private:
-   S32 mArgc;
-   char *mArgv[MaxRemoteCommandArgs + 1];
-   NetStringHandle mTagv[MaxRemoteCommandArgs + 1];
+   struct Command
+   {
+      S32 mArgc;
+      char *mArgv[MaxRemoteCommandArgs + 1];
+      NetStringHandle mTagv[MaxRemoteCommandArgs + 1];
+   };
+
+   Command mCommands[MaxBatchCommands];
+   S32 mCommandCount;
+   S32 mArgBytes;
    static char mBuf[1024];
+
+   void packArg(NetConnection *conn, BitStream *bstream, S32 commandIndex, S32 argIndex);
+   void unpackArg(NetConnection *conn, BitStream *bstream, S32 commandIndex, S32 argIndex);
+   void processCommand(NetConnection *conn, Command &command);
+
 public:
-   RemoteCommandEvent(S32 argc=0, const char **argv=NULL, NetConnection *conn = NULL)
-   {
-      mArgc = argc;
-      for(S32 i = 0; i < argc; i++)
-      {
-         if(argv[i][0] == StringTagPrefixByte)
-         {
-            char buffer[256];
-            mTagv[i+1] = NetStringHandle(dAtoi(argv[i]+1));
-            if(conn)
-            {
-               dSprintf(buffer + 1, sizeof(buffer) - 1, "%d", conn->getNetSendId(mTagv[i+1]));
-               buffer[0] = StringTagPrefixByte;
-               mArgv[i+1] = dStrdup(buffer);
-            }
-         }
-         else
-            mArgv[i+1] = dStrdup(argv[i]);
-      }
-   }
+   RemoteCommandEvent(S32 argc=0, const char **argv=NULL, NetConnection *conn = NULL);
+   ~RemoteCommandEvent();
+
+   /// Add a command to this event.
+   /// @return Whether the command was added.
+   bool addCommand(S32 argc, const char **argv, NetConnection *conn);
 
 #ifdef TORQUE_DEBUG_NET
    const char *getDebugName()
    {
       static char buffer[256];
-      dSprintf(buffer, sizeof(buffer), "%s [%s]", getClassName(), gNetStringTable->lookupString(dAtoi(mArgv[1] + 1)) );
+      dSprintf(buffer, sizeof(buffer), "%s [%s]", getClassName(), gNetStringTable->lookupString(dAtoi(mCommands[0].mArgv[1] + 1)) );
       return buffer;
    }
 #endif
 
-   ~RemoteCommandEvent()
-   {
-      for(S32 i = 0; i < mArgc; i++)
-         dFree(mArgv[i+1]);
-   }
-
-   virtual void pack(NetConnection* conn, BitStream *bstream)
-   {
-      bstream->writeInt(mArgc, CommandArgsBits);
-      // write it out reversed... why?
-      // automatic string substitution with later arguments -
-      // handled automatically by the system.
-
-      for(S32 i = 0; i < mArgc; i++)
-         conn->packString(bstream, mArgv[i+1]);
-   }
-
-   virtual void write(NetConnection* conn, BitStream *bstream)
-   {
-      pack(conn, bstream);
-   }
-
-   virtual void unpack(NetConnection* conn, BitStream *bstream)
-   {
-
-      mArgc = bstream->readInt(CommandArgsBits);
-      // read it out backwards
-      for(S32 i = 0; i < mArgc; i++)
-      {
-         conn->unpackString(bstream, mBuf);
-         mArgv[i+1] = dStrdup(mBuf);
-      }
-   }
-
-   virtual void process(NetConnection *conn)
-   {
-      static char idBuf[10];
-
-      // de-tag the command name
-
-      for(S32 i = mArgc - 1; i >= 0; i--)
-      {
-         char *arg = mArgv[i+1];
-         if(*arg == StringTagPrefixByte)
-         {
-            // it's a tag:
-            U32 localTag = dAtoi(arg + 1);
-            NetStringHandle tag = conn->translateRemoteStringId(localTag);
-            NetStringTable::expandString( tag,
-                                          mBuf,
-                                          sizeof(mBuf),
-                                          (mArgc - 1) - i,
-                                          (const char**)(mArgv + i + 2) );
-            dFree(mArgv[i+1]);
-            mArgv[i+1] = dStrdup(mBuf);
-         }
-      }
-      const char *rmtCommandName = dStrchr(mArgv[1], ' ') + 1;
-      if(conn->isConnectionToServer())
-      {
-         dStrcpy(mBuf, "clientCmd");
-         dStrcat(mBuf, rmtCommandName);
-
-         char *temp = mArgv[1];
-         mArgv[1] = mBuf;
-
-         Con::execute(mArgc, (const char **) mArgv+1);
-         mArgv[1] = temp;
-      }
-      else
-      {
-         dStrcpy(mBuf, "serverCmd");
-         dStrcat(mBuf, rmtCommandName);
-         char *temp = mArgv[1];
-
-         dSprintf(idBuf, sizeof(idBuf), "%d", conn->getId());
-         mArgv[0] = mBuf;
-         mArgv[1] = idBuf;
-
-         Con::execute(mArgc+1, (const char **) mArgv);
-         mArgv[1] = temp;
-      }
-   }
+   virtual void pack(NetConnection* conn, BitStream *bstream);
+   virtual void write(NetConnection* conn, BitStream *bstream);
+   virtual void unpack(NetConnection* conn, BitStream *bstream);
+   virtual void process(NetConnection *conn);
 
    DECLARE_CONOBJECT(RemoteCommandEvent);
 };
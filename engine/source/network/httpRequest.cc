@@ -0,0 +1,909 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "network/httpRequest.h"
+
+#ifndef _PLATFORM_NETWORK_H_
+#include "platform/platformNetwork.h"
+#endif
+#ifndef _EVENT_H_
+#include "platform/event.h"
+#endif
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+#ifndef _PLATFORM_THREADS_MUTEX_H_
+#include "platform/threads/mutex.h"
+#endif
+#ifndef _PLATFORM_THREADS_SEMAPHORE_H_
+#include "platform/threads/semaphore.h"
+#endif
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+#ifndef _CONSOLE_VARIABLE_REF_H_
+#include "console/consoleVariableRef.h"
+#endif
+
+#include "httpRequest_ScriptBinding.h"
+
+IMPLEMENT_CONOBJECT(HTTPRequest);
+
+//--------------------------------------------------------------------------
+
+/// A request whilst it is in progress.
+///
+/// The request text is composed on the main thread and the response is read into the job by
+/// a worker thread.  The job is then handed back to the main thread in an HTTPRequestEvent,
+/// which owns it from then on.
+struct HTTPRequestJob
+{
+   SimObjectId mRequestId;
+   char mHost[256];
+   U16 mPort;
+   Vector<char> mRequest;
+   bool mHeadRequest;
+   char mFile[1024];
+   volatile bool mCancelled;
+
+   S32 mStatus;
+   Vector<char> mResponseHeaders;
+   U8 *mpBody;
+   U32 mBodySize;
+   U32 mBodyCapacity;
+   const char *mpError;
+
+   HTTPRequestJob()
+   {
+      mRequestId = 0;
+      mHost[0] = 0;
+      mPort = 80;
+      mHeadRequest = false;
+      mFile[0] = 0;
+      mCancelled = false;
+      mStatus = 0;
+      mpBody = NULL;
+      mBodySize = 0;
+      mBodyCapacity = 0;
+      mpError = NULL;
+   }
+
+   ~HTTPRequestJob()
+   {
+      dFree(mpBody);
+   }
+
+   void appendBody(const U8 *data, U32 size)
+   {
+      // Grow geometrically, keeping room for a terminator.
+      if(mBodySize + size + 1 > mBodyCapacity)
+      {
+         mBodyCapacity = getMax(mBodyCapacity * 2, mBodySize + size + 1);
+         mpBody = (U8 *)dRealloc(mpBody, mBodyCapacity);
+      }
+      dMemcpy(mpBody + mBodySize, data, size);
+      mBodySize += size;
+   }
+};
+
+//--------------------------------------------------------------------------
+
+/// Hands a finished job back to its request on the main thread.
+class HTTPRequestEvent : public SimEvent
+{
+   HTTPRequestJob *mpJob;
+
+public:
+   HTTPRequestEvent(HTTPRequestJob *job) : mpJob(job) {}
+   ~HTTPRequestEvent() { delete mpJob; }
+
+   void process(SimObject *object)
+   {
+      static_cast<HTTPRequest *>(object)->onFinished(mpJob);
+   }
+};
+
+//--------------------------------------------------------------------------
+
+/// Reads an HTTP/1.1 response from a blocking socket into a job.
+class HTTPResponseReader
+{
+   enum
+   {
+      BufferSize = 16384,
+      MaxLineSize = 4096,
+   };
+
+   NetSocket mSocket;
+   HTTPRequestJob *mpJob;
+   FileStream *mpFile;
+   U8 mBuffer[BufferSize];
+   U32 mStart;
+   U32 mEnd;
+   bool mReceived;
+   bool mKeepAlive;
+
+public:
+   HTTPResponseReader(NetSocket socket, HTTPRequestJob *job)
+   {
+      mSocket = socket;
+      mpJob = job;
+      mpFile = NULL;
+      mStart = 0;
+      mEnd = 0;
+      mReceived = false;
+      mKeepAlive = false;
+   }
+
+   ~HTTPResponseReader()
+   {
+      delete mpFile;
+   }
+
+   /// Whether any of the response was received.
+   inline bool hasReceived() const { return mReceived; }
+
+   /// Whether the connection can be used for another request.
+   inline bool isKeepAlive() const { return mKeepAlive; }
+
+   bool read();
+
+private:
+   bool fill();
+   bool readLine(char *line);
+   bool readBody(U32 size);
+   bool readUntilClose();
+   bool readChunked();
+   bool writeBody(const U8 *data, U32 size);
+   bool fail(const char *error);
+};
+
+//--------------------------------------------------------------------------
+
+bool HTTPResponseReader::fail(const char *error)
+{
+   mpJob->mpError = mpJob->mCancelled ? "Cancelled." : error;
+   mKeepAlive = false;
+   return false;
+}
+
+//--------------------------------------------------------------------------
+
+bool HTTPResponseReader::fill()
+{
+   if(mpJob->mCancelled)
+      return false;
+
+   // Move what is left to the front of the buffer.
+   if(mStart > 0)
+   {
+      dMemmove(mBuffer, mBuffer + mStart, mEnd - mStart);
+      mEnd -= mStart;
+      mStart = 0;
+   }
+
+   if(mEnd == BufferSize)
+      return false;
+
+   S32 bytesRead = 0;
+   if(Net::recv(mSocket, mBuffer + mEnd, BufferSize - mEnd, &bytesRead) != Net::NoError || bytesRead <= 0)
+      return false;
+
+   mEnd += bytesRead;
+   mReceived = true;
+   return true;
+}
+
+//--------------------------------------------------------------------------
+
+bool HTTPResponseReader::readLine(char *line)
+{
+   for(;;)
+   {
+      // Look for the end of the line in what has been received.
+      for(U32 i = mStart; i < mEnd; i++)
+      {
+         if(mBuffer[i] != '\n')
+            continue;
+
+         U32 length = i - mStart;
+         if(length > 0 && mBuffer[i - 1] == '\r')
+            length--;
+         if(length >= MaxLineSize)
+            return false;
+
+         dMemcpy(line, mBuffer + mStart, length);
+         line[length] = 0;
+         mStart = i + 1;
+         return true;
+      }
+
+      if(mEnd - mStart >= MaxLineSize || !fill())
+         return false;
+   }
+}
+
+//--------------------------------------------------------------------------
+
+bool HTTPResponseReader::writeBody(const U8 *data, U32 size)
+{
+   if(mpFile)
+      return mpFile->write(size, data);
+
+   mpJob->appendBody(data, size);
+   return true;
+}
+
+//--------------------------------------------------------------------------
+
+bool HTTPResponseReader::readBody(U32 size)
+{
+   while(size > 0)
+   {
+      if(mStart == mEnd && !fill())
+         return false;
+
+      const U32 count = getMin(size, mEnd - mStart);
+      if(!writeBody(mBuffer + mStart, count))
+         return false;
+      mStart += count;
+      size -= count;
+   }
+   return true;
+}
+
+//--------------------------------------------------------------------------
+
+bool HTTPResponseReader::readUntilClose()
+{
+   for(;;)
+   {
+      if(mStart < mEnd)
+      {
+         if(!writeBody(mBuffer + mStart, mEnd - mStart))
+            return false;
+         mStart = mEnd;
+      }
+
+      if(!fill())
+         return !mpJob->mCancelled;
+   }
+}
+
+//--------------------------------------------------------------------------
+
+bool HTTPResponseReader::readChunked()
+{
+   char line[MaxLineSize];
+   for(;;)
+   {
+      // Each chunk starts with its size in hex, optionally followed by extensions.
+      if(!readLine(line))
+         return false;
+
+      U32 size = 0;
+      for(const char *walk = line; ; walk++)
+      {
+         const char c = dTolower(*walk);
+         if(dIsdigit(c))
+            size = (size << 4) | (c - '0');
+         else if(c >= 'a' && c <= 'f')
+            size = (size << 4) | (c - 'a' + 10);
+         else
+            break;
+      }
+
+      if(size == 0)
+         break;
+
+      if(!readBody(size) || !readLine(line))
+         return false;
+   }
+
+   // Skip the trailer.
+   do
+   {
+      if(!readLine(line))
+         return false;
+   }
+   while(line[0] != 0);
+
+   return true;
+}
+
+//--------------------------------------------------------------------------
+
+bool HTTPResponseReader::read()
+{
+   char line[MaxLineSize];
+
+   // Status line, e.g. "HTTP/1.1 200 OK".  Interim (1xx) responses are skipped.
+   do
+   {
+      if(!readLine(line))
+         return fail("No response.");
+
+      if(dStrnicmp(line, "HTTP/", 5) || !dStrchr(line, ' '))
+         return fail("Invalid response.");
+
+      mpJob->mStatus = dAtoi(dStrchr(line, ' ') + 1);
+      mKeepAlive = dStrnicmp(line, "HTTP/1.0", 8) != 0;
+      mpJob->mResponseHeaders.clear();
+
+      // Headers.
+      for(;;)
+      {
+         if(!readLine(line))
+            return fail("Invalid response.");
+
+         if(line[0] == 0)
+            break;
+
+         mpJob->mResponseHeaders.increment(line, dStrlen(line));
+         mpJob->mResponseHeaders.increment((const char *)"\r\n", 2);
+      }
+   }
+   while(mpJob->mStatus >= 100 && mpJob->mStatus < 200);
+
+   mpJob->mResponseHeaders.push_back(0);
+
+   // Find the headers that affect how the body is read.
+   S32 contentLength = -1;
+   bool chunked = false;
+   for(char *header = mpJob->mResponseHeaders.address(); *header; )
+   {
+      char *next = dStrstr(header, (char *)"\r\n");
+      char *value = dStrchr(header, ':');
+      if(value && value < next)
+      {
+         const U32 nameLength = value - header;
+         for(value++; *value == ' ' || *value == '\t'; value++)
+            ;
+         const U32 valueLength = next - value;
+
+         if(nameLength == 14 && !dStrnicmp(header, "Content-Length", 14))
+            contentLength = dAtoi(value);
+         else if(nameLength == 17 && !dStrnicmp(header, "Transfer-Encoding", 17))
+            chunked = valueLength >= 7 && !dStrnicmp(next - 7, "chunked", 7);
+         else if(nameLength == 10 && !dStrnicmp(header, "Connection", 10))
+         {
+            if(valueLength == 5 && !dStrnicmp(value, "close", 5))
+               mKeepAlive = false;
+            else if(valueLength == 10 && !dStrnicmp(value, "keep-alive", 10))
+               mKeepAlive = true;
+         }
+      }
+      header = next + 2;
+   }
+
+   // Only successful responses are written to the file.
+   const bool success = mpJob->mStatus >= 200 && mpJob->mStatus < 300;
+   if(success && mpJob->mFile[0])
+   {
+      mpFile = new FileStream;
+      if(!mpFile->open(mpJob->mFile, FileStream::Write))
+         return fail("Could not open the file.");
+   }
+
+   // Read the body.
+   if(mpJob->mHeadRequest || mpJob->mStatus == 204 || mpJob->mStatus == 304)
+      return true;
+
+   if(chunked)
+   {
+      if(!readChunked())
+         return fail("Invalid chunked body.");
+   }
+   else if(contentLength >= 0)
+   {
+      if(!readBody(contentLength))
+         return fail("Connection closed before the end of the body.");
+   }
+   else
+   {
+      // The body ends when the server closes the connection.
+      mKeepAlive = false;
+      if(!readUntilClose())
+         return fail("Connection closed before the end of the body.");
+   }
+
+   if(mpFile)
+      mpFile->close();
+
+   return true;
+}
+
+//--------------------------------------------------------------------------
+
+/// The worker threads and kept alive connections shared by all requests.
+class HTTPRequestPool
+{
+   enum
+   {
+      MaxIdleConnections = 8,
+      IdleConnectionTimeout = 15000,
+   };
+
+   struct Connection
+   {
+      char mHost[256];
+      U16 mPort;
+      NetSocket mSocket;
+      U32 mIdleTime;
+   };
+
+   Vector<Thread *> mThreads;
+   Vector<HTTPRequestJob *> mJobs;
+   Vector<Connection> mConnections;
+   U32 mBusyThreads;
+   void *mMutex;
+   void *mResolveMutex;
+   Semaphore mJobSemaphore;
+   volatile bool mStopping;
+
+   static void workerThread(void *arg);
+
+   HTTPRequestJob *waitForJob();
+   NetSocket openConnection(HTTPRequestJob *job, bool &reused);
+   void keepConnection(HTTPRequestJob *job, NetSocket socket);
+   void perform(HTTPRequestJob *job);
+
+public:
+   HTTPRequestPool();
+   ~HTTPRequestPool();
+
+   void submit(HTTPRequestJob *job);
+};
+
+static HTTPRequestPool *gHTTPRequestPool = NULL;
+
+static Con::VariableRef<S32> sMaxParallelRequests("pref::HTTP::MaxParallelRequests", HTTPRequest::DefaultParallelRequests);
+
+//--------------------------------------------------------------------------
+
+HTTPRequestPool::HTTPRequestPool() : mJobSemaphore(0)
+{
+   mBusyThreads = 0;
+   mMutex = Mutex::createMutex();
+   mResolveMutex = Mutex::createMutex();
+   mStopping = false;
+}
+
+//--------------------------------------------------------------------------
+
+HTTPRequestPool::~HTTPRequestPool()
+{
+   Mutex::lockMutex(mMutex);
+   mStopping = true;
+
+   // Hand back the jobs that were not started.
+   for(S32 i = 0; i < mJobs.size(); i++)
+   {
+      mJobs[i]->mpError = "Cancelled.";
+      Sim::postThreadEvent(mJobs[i]->mRequestId, new HTTPRequestEvent(mJobs[i]));
+   }
+   mJobs.clear();
+   Mutex::unlockMutex(mMutex);
+
+   // Wake the workers so they stop.  Requests in progress are allowed to finish.
+   for(S32 i = 0; i < mThreads.size(); i++)
+      mJobSemaphore.release();
+
+   for(S32 i = 0; i < mThreads.size(); i++)
+   {
+      mThreads[i]->join();
+      delete mThreads[i];
+   }
+
+   for(S32 i = 0; i < mConnections.size(); i++)
+      Net::closeSocket(mConnections[i].mSocket);
+
+   Mutex::destroyMutex(mResolveMutex);
+   Mutex::destroyMutex(mMutex);
+}
+
+//--------------------------------------------------------------------------
+
+void HTTPRequestPool::submit(HTTPRequestJob *job)
+{
+   Mutex::lockMutex(mMutex);
+   mJobs.push_back(job);
+
+   // Start another worker if all of them are busy.
+   const S32 maxThreads = mClamp(sMaxParallelRequests, 1, HTTPRequest::MaxParallelRequests);
+   if(mThreads.size() < maxThreads && mBusyThreads + mJobs.size() > (U32)mThreads.size())
+      mThreads.push_back(new Thread(workerThread, this));
+
+   Mutex::unlockMutex(mMutex);
+
+   mJobSemaphore.release();
+}
+
+//--------------------------------------------------------------------------
+
+HTTPRequestJob *HTTPRequestPool::waitForJob()
+{
+   mJobSemaphore.acquire();
+
+   Mutex::lockMutex(mMutex);
+   HTTPRequestJob *job = NULL;
+   if(!mStopping && mJobs.size() > 0)
+   {
+      job = mJobs.front();
+      mJobs.pop_front();
+      mBusyThreads++;
+   }
+   Mutex::unlockMutex(mMutex);
+
+   return job;
+}
+
+//--------------------------------------------------------------------------
+
+void HTTPRequestPool::workerThread(void *arg)
+{
+   HTTPRequestPool *pool = static_cast<HTTPRequestPool *>(arg);
+
+   while(HTTPRequestJob *job = pool->waitForJob())
+   {
+      pool->perform(job);
+
+      // Hand the job back to the main thread.
+      Sim::postThreadEvent(job->mRequestId, new HTTPRequestEvent(job));
+
+      Mutex::lockMutex(pool->mMutex);
+      pool->mBusyThreads--;
+      Mutex::unlockMutex(pool->mMutex);
+   }
+}
+
+//--------------------------------------------------------------------------
+
+NetSocket HTTPRequestPool::openConnection(HTTPRequestJob *job, bool &reused)
+{
+   // Reuse the most recent idle connection to the host if it has not timed out.
+   const U32 time = Platform::getRealMilliseconds();
+   NetSocket socket = InvalidSocket;
+
+   Mutex::lockMutex(mMutex);
+   for(S32 i = mConnections.size() - 1; i >= 0; i--)
+   {
+      Connection &connection = mConnections[i];
+      if(time - connection.mIdleTime > IdleConnectionTimeout)
+      {
+         Net::closeSocket(connection.mSocket);
+         mConnections.erase(i);
+      }
+      else if(socket == InvalidSocket && connection.mPort == job->mPort && !dStricmp(connection.mHost, job->mHost))
+      {
+         socket = connection.mSocket;
+         mConnections.erase(i);
+      }
+   }
+   Mutex::unlockMutex(mMutex);
+
+   reused = socket != InvalidSocket;
+   if(reused)
+      return socket;
+
+   // Host lookups are not thread safe.
+   char addressString[sizeof(job->mHost) + 8];
+   dSprintf(addressString, sizeof(addressString), "ip:%s:%d", job->mHost, job->mPort);
+
+   NetAddress address;
+   Mutex::lockMutex(mResolveMutex);
+   const bool resolved = Net::stringToAddress(addressString, &address);
+   Mutex::unlockMutex(mResolveMutex);
+
+   if(!resolved)
+      return InvalidSocket;
+
+   socket = Net::openSocket();
+   if(socket == InvalidSocket)
+      return InvalidSocket;
+
+   Net::setBlocking(socket, true);
+   if(Net::connect(socket, &address) != Net::NoError)
+   {
+      Net::closeSocket(socket);
+      return InvalidSocket;
+   }
+
+   return socket;
+}
+
+//--------------------------------------------------------------------------
+
+void HTTPRequestPool::keepConnection(HTTPRequestJob *job, NetSocket socket)
+{
+   Mutex::lockMutex(mMutex);
+
+   // Close the oldest connection if there are too many.
+   if(mConnections.size() >= MaxIdleConnections)
+   {
+      Net::closeSocket(mConnections.front().mSocket);
+      mConnections.pop_front();
+   }
+
+   mConnections.increment();
+   Connection &connection = mConnections.last();
+   dStrcpy(connection.mHost, job->mHost);
+   connection.mPort = job->mPort;
+   connection.mSocket = socket;
+   connection.mIdleTime = Platform::getRealMilliseconds();
+
+   Mutex::unlockMutex(mMutex);
+}
+
+//--------------------------------------------------------------------------
+
+void HTTPRequestPool::perform(HTTPRequestJob *job)
+{
+   for(U32 attempt = 0; attempt < 2; attempt++)
+   {
+      if(job->mCancelled)
+      {
+         job->mpError = "Cancelled.";
+         break;
+      }
+
+      bool reused;
+      NetSocket socket = openConnection(job, reused);
+      if(socket == InvalidSocket)
+      {
+         job->mpError = "Could not connect.";
+         break;
+      }
+
+      job->mpError = NULL;
+      HTTPResponseReader reader(socket, job);
+      if(Net::send(socket, (const U8 *)job->mRequest.address(), job->mRequest.size()) != Net::NoError)
+         job->mpError = "Could not send the request.";
+      else if(reader.read())
+      {
+         if(reader.isKeepAlive())
+            keepConnection(job, socket);
+         else
+            Net::closeSocket(socket);
+         return;
+      }
+
+      Net::closeSocket(socket);
+
+      // The server may have closed a kept alive connection whilst it was idle so try once more
+      // on a new connection if nothing was received.
+      if(!reused || reader.hasReceived())
+         break;
+   }
+
+   // Don't leave part of the body in the file.
+   if(job->mFile[0])
+      Platform::fileDelete(job->mFile);
+}
+
+//--------------------------------------------------------------------------
+
+HTTPRequest::HTTPRequest()
+{
+   mpJob = NULL;
+   mStatus = 0;
+   mpResponseHeaders = NULL;
+   mpBody = NULL;
+   mBodySize = 0;
+}
+
+//--------------------------------------------------------------------------
+
+HTTPRequest::~HTTPRequest()
+{
+   clearResponse();
+}
+
+//--------------------------------------------------------------------------
+
+void HTTPRequest::onRemove()
+{
+   cancel();
+
+   Parent::onRemove();
+}
+
+//--------------------------------------------------------------------------
+
+void HTTPRequest::clearResponse()
+{
+   mStatus = 0;
+   dFree(mpResponseHeaders);
+   mpResponseHeaders = NULL;
+   dFree(mpBody);
+   mpBody = NULL;
+   mBodySize = 0;
+}
+
+//--------------------------------------------------------------------------
+
+void HTTPRequest::addHeader(const char *name, const char *value)
+{
+   mHeaders.increment(name, dStrlen(name));
+   mHeaders.increment((const char *)": ", 2);
+   mHeaders.increment(value, dStrlen(value));
+   mHeaders.increment((const char *)"\r\n", 2);
+}
+
+//--------------------------------------------------------------------------
+
+bool HTTPRequest::send(const char *method, const char *url, const char *contentType, const U8 *body, U32 bodySize, const char *file)
+{
+   if(mpJob)
+   {
+      Con::warnf("HTTPRequest::send() - A request is already in progress.");
+      return false;
+   }
+
+   // Split the URL into the host, port and path.
+   if(dStrnicmp(url, "http://", 7))
+   {
+      Con::warnf("HTTPRequest::send() - Only 'http://' URLs are supported: '%s'.", url);
+      return false;
+   }
+
+   const char *host = url + 7;
+   const char *path = dStrchr(host, '/');
+   if(!path)
+      path = host + dStrlen(host);
+
+   HTTPRequestJob *job = new HTTPRequestJob;
+   const char *port = dStrchr(host, ':');
+   if(port && port < path)
+      job->mPort = dAtoi(port + 1);
+   else
+      port = path;
+
+   const U32 hostLength = port - host;
+   if(hostLength == 0 || hostLength >= sizeof(job->mHost) || job->mPort == 0)
+   {
+      Con::warnf("HTTPRequest::send() - Invalid URL '%s'.", url);
+      delete job;
+      return false;
+   }
+   dStrncpy(job->mHost, host, hostLength);
+   job->mHost[hostLength] = 0;
+
+   if(file && *file)
+   {
+      Con::expandPath(job->mFile, sizeof(job->mFile), file);
+      Platform::createPath(job->mFile);
+   }
+
+   // Compose the request.
+   Vector<char> &request = job->mRequest;
+   request.increment(method, dStrlen(method));
+   request.push_back(' ');
+   if(*path)
+      request.increment(path, dStrlen(path));
+   else
+      request.push_back('/');
+   request.increment((const char *)" HTTP/1.1\r\nHost: ", 17);
+   request.increment(host, path - host);
+   request.increment((const char *)"\r\nConnection: keep-alive\r\n", 26);
+   request.merge(mHeaders);
+   if(body)
+   {
+      char contentHeaders[256];
+      dSprintf(contentHeaders, sizeof(contentHeaders), "Content-Type: %s\r\nContent-Length: %d\r\n", contentType, bodySize);
+      request.increment(contentHeaders, dStrlen(contentHeaders));
+   }
+   request.increment((const char *)"\r\n", 2);
+   if(body)
+      request.increment((const char *)body, bodySize);
+
+   job->mRequestId = getId();
+   job->mHeadRequest = !dStricmp(method, "HEAD");
+   mHeaders.clear();
+
+   clearResponse();
+   mpJob = job;
+
+   if(!gHTTPRequestPool)
+      gHTTPRequestPool = new HTTPRequestPool;
+   gHTTPRequestPool->submit(job);
+   return true;
+}
+
+//--------------------------------------------------------------------------
+
+void HTTPRequest::cancel()
+{
+   if(!mpJob)
+      return;
+
+   // The worker stops reading and the job is deleted when it is handed back.
+   mpJob->mCancelled = true;
+   mpJob = NULL;
+}
+
+//--------------------------------------------------------------------------
+
+void HTTPRequest::onFinished(HTTPRequestJob *job)
+{
+   // Ignore jobs that were cancelled.
+   if(job != mpJob)
+      return;
+
+   mpJob = NULL;
+
+   if(job->mpError)
+   {
+      Con::executef(this, 2, "onFailed", job->mpError);
+      return;
+   }
+
+   // Take the response from the job.
+   mStatus = job->mStatus;
+   mpResponseHeaders = (char *)dMalloc(job->mResponseHeaders.size());
+   dMemcpy(mpResponseHeaders, job->mResponseHeaders.address(), job->mResponseHeaders.size());
+   if(job->mpBody)
+   {
+      mpBody = job->mpBody;
+      mpBody[job->mBodySize] = 0;
+      mBodySize = job->mBodySize;
+      job->mpBody = NULL;
+   }
+
+   Con::executef(this, 2, "onComplete", Con::getIntArg(mStatus));
+}
+
+//--------------------------------------------------------------------------
+
+const char *HTTPRequest::getResponseHeader(const char *name) const
+{
+   if(!mpResponseHeaders)
+      return "";
+
+   const U32 nameLength = dStrlen(name);
+   for(const char *header = mpResponseHeaders; *header; )
+   {
+      const char *next = dStrstr(header, "\r\n");
+      if(!dStrnicmp(header, name, nameLength) && header[nameLength] == ':')
+      {
+         const char *value = header + nameLength + 1;
+         while(*value == ' ' || *value == '\t')
+            value++;
+
+         const U32 valueLength = next - value;
+         char *ret = Con::getReturnBuffer(valueLength + 1);
+         dStrncpy(ret, value, valueLength);
+         ret[valueLength] = 0;
+         return ret;
+      }
+      header = next + 2;
+   }
+   return "";
+}
+
+//--------------------------------------------------------------------------
+
+void HTTPRequest::shutdown()
+{
+   delete gHTTPRequestPool;
+   gHTTPRequestPool = NULL;
+}
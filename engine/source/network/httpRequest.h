@@ -0,0 +1,111 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _HTTPREQUEST_H_
+#define _HTTPREQUEST_H_
+
+#ifndef _SIMBASE_H_
+#include "sim/simBase.h"
+#endif
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+struct HTTPRequestJob;
+
+/// An HTTP/1.1 request performed asynchronously.
+///
+/// Unlike HTTPObject, which parses the response line by line through script callbacks on
+/// the main thread, the request is sent and its response read by a pool of worker threads.
+/// Up to $pref::HTTP::MaxParallelRequests requests (4 by default) are performed at once and
+/// connections are kept alive and reused for later requests to the same host.  Chunked
+/// responses are decoded and the body is kept in memory or written straight to a file.
+/// The "onComplete" callback is made on the main thread once the whole response has been
+/// received, or "onFailed" if no response could be received.
+///
+/// Only plain "http://" URLs are supported.
+///
+/// @code
+/// %request = new HTTPRequest() { class = "LeaderboardRequest"; };
+/// %request.get( "http://example.com/leaderboard?top=10" );
+///
+/// function LeaderboardRequest::onComplete( %this, %status )
+/// {
+///    if ( %status == 200 )
+///       echo( %this.getBody() );
+///
+///    %this.delete();
+/// }
+/// @endcode
+class HTTPRequest : public SimObject
+{
+   typedef SimObject Parent;
+
+public:
+   enum
+   {
+      DefaultParallelRequests = 4,
+      MaxParallelRequests = 16,
+   };
+
+private:
+   HTTPRequestJob *mpJob;
+   Vector<char> mHeaders;
+   S32 mStatus;
+   char *mpResponseHeaders;
+   U8 *mpBody;
+   U32 mBodySize;
+
+   void clearResponse();
+
+public:
+   HTTPRequest();
+   virtual ~HTTPRequest();
+   virtual void onRemove();
+
+   /// Add a header to be sent with the next request.
+   void addHeader(const char *name, const char *value);
+
+   /// Start a request.
+   /// @param file The file to write the response body to or NULL to keep it in memory.
+   /// @return Whether the request was started.
+   bool send(const char *method, const char *url, const char *contentType, const U8 *body, U32 bodySize, const char *file);
+
+   /// Cancel the request in progress.  No callback is made.
+   void cancel();
+
+   inline bool isPending() const { return mpJob != NULL; }
+   inline S32 getStatus() const { return mStatus; }
+   inline const U8 *getBody() const { return mpBody; }
+   inline U32 getBodySize() const { return mBodySize; }
+   const char *getResponseHeader(const char *name) const;
+
+   /// Called on the main thread when the worker has finished with the request.
+   void onFinished(HTTPRequestJob *job);
+
+   /// Stop the worker threads and close any kept alive connections.
+   static void shutdown();
+
+   DECLARE_CONOBJECT(HTTPRequest);
+};
+
+#endif  // _HTTPREQUEST_H_
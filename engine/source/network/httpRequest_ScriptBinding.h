@@ -0,0 +1,120 @@
+﻿//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+ConsoleMethodGroupBeginWithDocs(HTTPRequest, SimObject)
+
+/*! Starts a GET request.
+    @param url The URL to request, e.g. "http://example.com/leaderboard?top=10".
+    @param file Optional file to write the response body to.  The body is kept in memory if not specified.
+    @return Whether the request was started.
+*/
+ConsoleMethodWithDocs( HTTPRequest, get, ConsoleBool, 3, 4, (string url, [string file]))
+{
+   return object->send("GET", argv[2], NULL, NULL, 0, argc > 3 ? argv[3] : NULL);
+}
+
+/*! Starts a POST request.
+    @param url The URL to post to.
+    @param contentType The type of the body, e.g. "application/x-www-form-urlencoded".
+    @param body The body to post.
+    @param file Optional file to write the response body to.  The body is kept in memory if not specified.
+    @return Whether the request was started.
+*/
+ConsoleMethodWithDocs( HTTPRequest, post, ConsoleBool, 5, 6, (string url, string contentType, string body, [string file]))
+{
+   return object->send("POST", argv[2], argv[3], (const U8 *)argv[4], dStrlen(argv[4]), argc > 5 ? argv[5] : NULL);
+}
+
+/*! Starts a request with any method.
+    @param method The method, e.g. "PUT" or "DELETE".
+    @param url The URL to request.
+    @param contentType Optional type of the body.
+    @param body Optional body to send.
+    @param file Optional file to write the response body to.  The body is kept in memory if not specified.
+    @return Whether the request was started.
+*/
+ConsoleMethodWithDocs( HTTPRequest, send, ConsoleBool, 4, 7, (string method, string url, [string contentType, string body, string file]))
+{
+   const bool hasBody = argc > 5 && *argv[5];
+   return object->send(argv[2], argv[3], argc > 4 ? argv[4] : "", hasBody ? (const U8 *)argv[5] : NULL, hasBody ? dStrlen(argv[5]) : 0, argc > 6 ? argv[6] : NULL);
+}
+
+/*! Adds a header to send with the next request.
+    @param name The header name, e.g. "Authorization".
+    @param value The header value.
+    @return No return value.
+*/
+ConsoleMethodWithDocs( HTTPRequest, addHeader, ConsoleVoid, 4, 4, (string name, string value))
+{
+   object->addHeader(argv[2], argv[3]);
+}
+
+/*! Cancels the request in progress.  Neither callback is made.
+    @return No return value.
+*/
+ConsoleMethodWithDocs( HTTPRequest, cancel, ConsoleVoid, 2, 2, ())
+{
+   object->cancel();
+}
+
+/*! Gets whether a request is in progress.
+    @return Whether a request is in progress.
+*/
+ConsoleMethodWithDocs( HTTPRequest, isPending, ConsoleBool, 2, 2, ())
+{
+   return object->isPending();
+}
+
+/*! Gets the status code of the last response.
+    @return The status code, e.g. 200, or 0 if there is no response.
+*/
+ConsoleMethodWithDocs( HTTPRequest, getStatus, ConsoleInt, 2, 2, ())
+{
+   return object->getStatus();
+}
+
+/*! Gets the body of the last response if it was kept in memory.
+    @return The response body.
+*/
+ConsoleMethodWithDocs( HTTPRequest, getBody, ConsoleString, 2, 2, ())
+{
+   return object->getBody() ? (const char *)object->getBody() : "";
+}
+
+/*! Gets the size of the body of the last response if it was kept in memory.
+    @return The size of the response body in bytes.
+*/
+ConsoleMethodWithDocs( HTTPRequest, getBodySize, ConsoleInt, 2, 2, ())
+{
+   return object->getBodySize();
+}
+
+/*! Gets a header of the last response.
+    @param name The header name, e.g. "Content-Type".
+    @return The header value or an empty string if it was not in the response.
+*/
+ConsoleMethodWithDocs( HTTPRequest, getHeader, ConsoleString, 3, 3, (string name))
+{
+   return object->getResponseHeader(argv[2]);
+}
+
+ConsoleMethodGroupEndWithDocs(HTTPRequest)
@@ -0,0 +1,408 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "network/netBenchmark.h"
+
+#ifndef _NETCONNECTION_H_
+#include "network/netConnection.h"
+#endif
+#ifndef _NETOBJECT_H_
+#include "network/netObject.h"
+#endif
+#ifndef _BITSTREAM_H_
+#include "io/bitStream.h"
+#endif
+#ifndef _MPOINT_H_
+#include "math/mPoint.h"
+#endif
+
+#include "Box2D/Common/b2Timer.h"
+
+#include "netBenchmark_ScriptBinding.h"
+
+//--------------------------------------------------------------------------
+
+/// Measures the packets written and read by one side of a benchmark client.
+///
+/// The written figures are updated by whichever thread builds the packet and the read
+/// figures whilst the packet is processed; both are only collected by the main thread
+/// between packets.
+class NetBenchmarkConnection : public NetConnection
+{
+   typedef NetConnection Parent;
+
+public:
+   struct Stats
+   {
+      U32 packetsWritten;
+      U32 bytesWritten;
+      F32 writeTime;
+      U32 packetsRead;
+      F32 readTime;
+      U32 objectUpdates;
+      U32 objectBits;
+      U32 latencyCount;
+      U32 latencyTotal;
+      U32 latencyMax;
+
+      Stats() { dMemset(this, 0, sizeof(Stats)); }
+
+      void add(const Stats &stats)
+      {
+         packetsWritten += stats.packetsWritten;
+         bytesWritten += stats.bytesWritten;
+         writeTime += stats.writeTime;
+         packetsRead += stats.packetsRead;
+         readTime += stats.readTime;
+         objectUpdates += stats.objectUpdates;
+         objectBits += stats.objectBits;
+         latencyCount += stats.latencyCount;
+         latencyTotal += stats.latencyTotal;
+         latencyMax = getMax(latencyMax, stats.latencyMax);
+      }
+   };
+
+   Stats mStats;
+
+   void writePacket(BitStream *bstream, PacketNotify *note)
+   {
+      b2Timer timer;
+      Parent::writePacket(bstream, note);
+      mStats.writeTime += timer.GetMilliseconds();
+      mStats.packetsWritten++;
+      mStats.bytesWritten += bstream->getPosition();
+   }
+
+   void readPacket(BitStream *bstream)
+   {
+      b2Timer timer;
+      Parent::readPacket(bstream);
+      mStats.readTime += timer.GetMilliseconds();
+      mStats.packetsRead++;
+   }
+
+   DECLARE_CONOBJECT(NetBenchmarkConnection);
+};
+
+IMPLEMENT_CONOBJECT(NetBenchmarkConnection);
+
+//--------------------------------------------------------------------------
+
+/// An object that moves every tick, stamping each update with the time it moved.
+class NetBenchmarkObject : public NetObject
+{
+   typedef NetObject Parent;
+
+public:
+   enum
+   {
+      MoveMask = BIT(0),
+   };
+
+   Point2F mPosition;
+   Point2F mVelocity;
+   U32 mMoveTime;
+
+   NetBenchmarkObject()
+   {
+      mNetFlags.set(ScopeAlways | Ghostable);
+      mPosition.set(0.0f, 0.0f);
+      mVelocity.set(0.0f, 0.0f);
+      mMoveTime = 0;
+   }
+
+   void move(const F32 elapsedTime)
+   {
+      // Bounce around a fixed area.
+      mPosition += mVelocity * elapsedTime;
+      if(mFabs(mPosition.x) > 100.0f)
+         mVelocity.x = -mVelocity.x;
+      if(mFabs(mPosition.y) > 100.0f)
+         mVelocity.y = -mVelocity.y;
+
+      mMoveTime = Sim::getCurrentTime();
+      setMaskBits(MoveMask);
+   }
+
+   U32 packUpdate(NetConnection *conn, U32 mask, BitStream *stream)
+   {
+      const S32 start = stream->getCurPos();
+      if(stream->writeFlag(mask & MoveMask))
+      {
+         stream->write(mPosition.x);
+         stream->write(mPosition.y);
+         stream->write(mMoveTime);
+      }
+
+      NetBenchmarkConnection::Stats &stats = static_cast<NetBenchmarkConnection *>(conn)->mStats;
+      stats.objectUpdates++;
+      stats.objectBits += stream->getCurPos() - start;
+      return 0;
+   }
+
+   void unpackUpdate(NetConnection *conn, BitStream *stream)
+   {
+      if(stream->readFlag())
+      {
+         stream->read(&mPosition.x);
+         stream->read(&mPosition.y);
+         stream->read(&mMoveTime);
+
+         // The server and client share the sim clock.
+         const U32 latency = Sim::getCurrentTime() - mMoveTime;
+         NetBenchmarkConnection::Stats &stats = static_cast<NetBenchmarkConnection *>(conn)->mStats;
+         stats.latencyCount++;
+         stats.latencyTotal += latency;
+         stats.latencyMax = getMax(stats.latencyMax, latency);
+      }
+   }
+
+   DECLARE_CONOBJECT(NetBenchmarkObject);
+};
+
+IMPLEMENT_CO_NETOBJECT_V1(NetBenchmarkObject);
+
+//--------------------------------------------------------------------------
+
+class NetBenchmarkTickEvent : public SimEvent
+{
+public:
+   void process(SimObject *)
+   {
+      NetBenchmark::tick();
+   }
+};
+
+//--------------------------------------------------------------------------
+
+// Holds the connections and objects whilst running.
+static SimObjectPtr<SimGroup> gBenchmarkGroup;
+
+static U32 gBenchmarkClientCount = 0;
+static U32 gBenchmarkStartTime = 0;
+static U32 gBenchmarkEndTime = 0;
+static U32 gBenchmarkLastTick = 0;
+static U32 gBenchmarkLastReport = 0;
+static NetBenchmarkConnection::Stats gBenchmarkTotals;
+
+//--------------------------------------------------------------------------
+
+static void collectStats(NetBenchmarkConnection::Stats &stats)
+{
+   for(SimGroup::iterator itr = gBenchmarkGroup->begin(); itr != gBenchmarkGroup->end(); itr++)
+   {
+      NetBenchmarkConnection *connection = dynamic_cast<NetBenchmarkConnection *>(*itr);
+      if(!connection)
+         continue;
+
+      // Only count the server writing and the client reading.
+      NetBenchmarkConnection::Stats connectionStats = connection->mStats;
+      if(connection->isConnectionToServer())
+      {
+         connectionStats.packetsWritten = 0;
+         connectionStats.bytesWritten = 0;
+         connectionStats.writeTime = 0.0f;
+      }
+      else
+      {
+         connectionStats.packetsRead = 0;
+         connectionStats.readTime = 0.0f;
+      }
+      stats.add(connectionStats);
+      connection->mStats = NetBenchmarkConnection::Stats();
+   }
+}
+
+//--------------------------------------------------------------------------
+
+static void printStats(const char *label, const NetBenchmarkConnection::Stats &stats, const U32 elapsedTime)
+{
+   const F32 seconds = getMax(elapsedTime, (U32)1) / 1000.0f;
+   const F32 clients = (F32)getMax(gBenchmarkClientCount, (U32)1);
+
+   Con::printf("NetBenchmark %s: %.2f KB/s per client, %.1f packets/s per client, latency %.1f ms (max %d ms), write %.4f ms/packet, read %.4f ms/packet, %.1f bits/object update",
+      label,
+      stats.bytesWritten / 1024.0f / seconds / clients,
+      stats.packetsWritten / seconds / clients,
+      stats.latencyCount ? (F32)stats.latencyTotal / stats.latencyCount : 0.0f,
+      stats.latencyMax,
+      stats.packetsWritten ? stats.writeTime / stats.packetsWritten : 0.0f,
+      stats.packetsRead ? stats.readTime / stats.packetsRead : 0.0f,
+      stats.objectUpdates ? (F32)stats.objectBits / stats.objectUpdates : 0.0f);
+}
+
+//--------------------------------------------------------------------------
+
+bool NetBenchmark::start(const U32 clientCount, const U32 objectCount, const U32 duration, const F32 packetLoss, const U32 ping)
+{
+   if(isRunning())
+   {
+      Con::warnf("NetBenchmark::start() - The benchmark is already running.");
+      return false;
+   }
+
+   if(clientCount == 0 || clientCount > MaxClients || objectCount > MaxObjects)
+   {
+      Con::warnf("NetBenchmark::start() - Invalid client count %d or object count %d.", clientCount, objectCount);
+      return false;
+   }
+
+   gBenchmarkGroup = new SimGroup;
+   gBenchmarkGroup->registerObject();
+
+   // Create the objects before ghosting is activated so they are all ghosted at once.
+   for(U32 i = 0; i < objectCount; i++)
+   {
+      NetBenchmarkObject *object = new NetBenchmarkObject;
+      object->mPosition.set(Platform::getRandom() * 200.0f - 100.0f, Platform::getRandom() * 200.0f - 100.0f);
+      object->mVelocity.set(Platform::getRandom() * 20.0f - 10.0f, Platform::getRandom() * 20.0f - 10.0f);
+      object->registerObject();
+      gBenchmarkGroup->addObject(object);
+   }
+
+   // Connect each client to the server in the same way as NetConnection::connectLocal().
+   BitStream *stream = BitStream::getPacketStream();
+   for(U32 i = 0; i < clientCount; i++)
+   {
+      NetBenchmarkConnection *client = new NetBenchmarkConnection;
+      NetBenchmarkConnection *server = new NetBenchmarkConnection;
+      client->registerObject();
+      server->registerObject();
+      gBenchmarkGroup->addObject(client);
+      gBenchmarkGroup->addObject(server);
+
+      server->setSequence(0);
+      client->setSequence(0);
+      client->setRemoteConnectionObject(server);
+      server->setRemoteConnectionObject(client);
+
+      const char *error = NULL;
+      stream->setPosition(0);
+      client->writeConnectRequest(stream);
+      stream->setPosition(0);
+      server->readConnectRequest(stream, &error);
+      stream->setPosition(0);
+      server->writeConnectAccept(stream);
+      stream->setPosition(0);
+      client->readConnectAccept(stream, &error);
+
+      client->setEstablished();
+      server->setEstablished();
+      client->setConnectSequence(0);
+      server->setConnectSequence(0);
+
+      client->setIsConnectionToServer();
+      client->setGhostTo(true);
+      client->setSendingEvents(true);
+      server->setGhostFrom(true);
+      server->setSendingEvents(true);
+
+      client->setSimulatedNetParams(packetLoss, ping);
+      server->setSimulatedNetParams(packetLoss, ping);
+
+      server->activateGhosting();
+   }
+
+   gBenchmarkClientCount = clientCount;
+   gBenchmarkStartTime = Sim::getCurrentTime();
+   gBenchmarkEndTime = gBenchmarkStartTime + duration * 1000;
+   gBenchmarkLastTick = gBenchmarkStartTime;
+   gBenchmarkLastReport = gBenchmarkStartTime;
+   gBenchmarkTotals = NetBenchmarkConnection::Stats();
+
+   Con::printf("NetBenchmark: %d clients, %d objects, %d seconds, %.0f%% packet loss, %d ms ping.", clientCount, objectCount, duration, packetLoss * 100.0f, ping);
+
+   Sim::postEvent(gBenchmarkGroup, new NetBenchmarkTickEvent, gBenchmarkStartTime + TickInterval);
+   return true;
+}
+
+//--------------------------------------------------------------------------
+
+void NetBenchmark::stop()
+{
+   if(!isRunning())
+      return;
+
+   // Report the totals.
+   const U32 time = Sim::getCurrentTime();
+   collectStats(gBenchmarkTotals);
+   printStats("total", gBenchmarkTotals, time - gBenchmarkStartTime);
+
+   const F32 seconds = getMax(time - gBenchmarkStartTime, (U32)1) / 1000.0f;
+   const NetBenchmarkConnection::Stats &stats = gBenchmarkTotals;
+   Con::setFloatVariable("NetBenchmark::BytesPerClient", stats.bytesWritten / seconds / gBenchmarkClientCount);
+   Con::setFloatVariable("NetBenchmark::PacketsPerClient", stats.packetsWritten / seconds / gBenchmarkClientCount);
+   Con::setFloatVariable("NetBenchmark::Latency", stats.latencyCount ? (F32)stats.latencyTotal / stats.latencyCount : 0.0f);
+   Con::setIntVariable("NetBenchmark::LatencyMax", stats.latencyMax);
+   Con::setFloatVariable("NetBenchmark::WriteTime", stats.packetsWritten ? stats.writeTime / stats.packetsWritten : 0.0f);
+   Con::setFloatVariable("NetBenchmark::ReadTime", stats.packetsRead ? stats.readTime / stats.packetsRead : 0.0f);
+   Con::setFloatVariable("NetBenchmark::BitsPerObject", stats.objectUpdates ? (F32)stats.objectBits / stats.objectUpdates : 0.0f);
+
+   // Deleting the group deletes the connections, their ghosts and the objects.
+   gBenchmarkGroup->deleteObject();
+   gBenchmarkGroup = NULL;
+   gBenchmarkClientCount = 0;
+}
+
+//--------------------------------------------------------------------------
+
+bool NetBenchmark::isRunning()
+{
+   return !gBenchmarkGroup.isNull();
+}
+
+//--------------------------------------------------------------------------
+
+void NetBenchmark::tick()
+{
+   const U32 time = Sim::getCurrentTime();
+   if(time >= gBenchmarkEndTime)
+   {
+      stop();
+      return;
+   }
+
+   // Move the objects.
+   const F32 elapsedTime = (time - gBenchmarkLastTick) / 1000.0f;
+   gBenchmarkLastTick = time;
+   for(SimGroup::iterator itr = gBenchmarkGroup->begin(); itr != gBenchmarkGroup->end(); itr++)
+   {
+      NetBenchmarkObject *object = dynamic_cast<NetBenchmarkObject *>(*itr);
+      if(object)
+         object->move(elapsedTime);
+   }
+
+   // Report the last interval.
+   if(time - gBenchmarkLastReport >= ReportInterval)
+   {
+      NetBenchmarkConnection::Stats stats;
+      collectStats(stats);
+      gBenchmarkTotals.add(stats);
+
+      char label[32];
+      dSprintf(label, sizeof(label), "%ds", (time - gBenchmarkStartTime) / 1000);
+      printStats(label, stats, time - gBenchmarkLastReport);
+      gBenchmarkLastReport = time;
+   }
+
+   Sim::postEvent(gBenchmarkGroup, new NetBenchmarkTickEvent, time + TickInterval);
+}
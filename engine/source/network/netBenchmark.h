@@ -0,0 +1,72 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _NETBENCHMARK_H_
+#define _NETBENCHMARK_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+/// A network throughput benchmark that runs a server and clients in-process.
+///
+/// Each simulated client is a pair of local connections, so packets are built, sent
+/// through the simulated packet loss and latency of setSimulatedNetParams() then read
+/// without touching a socket.  The server ghosts a number of objects that move every
+/// tick to all the clients.  Once a second (and when it finishes) the benchmark reports
+/// the bandwidth per client, the latency from an object moving to the clients reading
+/// the update, the CPU time spent writing and reading each packet and the bits written
+/// for each object update.
+///
+/// Run it headless from a script so the numbers are reproducible:
+/// @code
+/// netBenchmarkStart(16, 500, 30, 0.05, 100);   // 16 clients, 500 objects, 30 seconds, 5% loss, 100ms ping
+/// @endcode
+///
+/// The final figures are also stored in the $NetBenchmark:: variables.
+class NetBenchmark
+{
+public:
+   enum
+   {
+      TickInterval = 32,
+      ReportInterval = 1000,
+      MaxClients = 256,
+      MaxObjects = 4096,
+   };
+
+   /// Start the benchmark.
+   /// @param duration How long to run in seconds.
+   /// @param packetLoss The simulated packet loss (0-1) of each connection.
+   /// @param ping The simulated latency (ms) of each connection.
+   static bool start(const U32 clientCount, const U32 objectCount, const U32 duration, const F32 packetLoss, const U32 ping);
+
+   /// Stop the benchmark and report the totals.
+   static void stop();
+
+   static bool isRunning();
+
+   /// Called every tick whilst running.
+   static void tick();
+};
+
+#endif // _NETBENCHMARK_H_
@@ -0,0 +1,61 @@
+﻿//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+ConsoleFunctionGroupBegin( NetBenchmark, "In-process network benchmark functionality.");
+
+/*! @defgroup NetBenchmarkFunctions Network Benchmark
+	@ingroup TorqueScriptFunctions
+	@{
+*/
+
+/*! Starts the network benchmark.
+    @param clientCount The number of simulated clients.
+    @param objectCount The number of moving objects to ghost to each client.
+    @param duration How long to run in seconds (optional, defaults to 10).
+    @param packetLoss The simulated packet loss of each connection from 0 to 1 (optional, defaults to 0).
+    @param ping The simulated latency of each connection in milliseconds (optional, defaults to 0).
+    @return Whether the benchmark was started.
+*/
+ConsoleFunctionWithDocs(netBenchmarkStart, ConsoleBool, 3, 6, (clientCount, objectCount, [duration], [packetLoss], [ping]))
+{
+   return NetBenchmark::start( dAtoi(argv[1]), dAtoi(argv[2]), argc > 3 ? dAtoi(argv[3]) : 10, argc > 4 ? dAtof(argv[4]) : 0.0f, argc > 5 ? dAtoi(argv[5]) : 0 );
+}
+
+/*! Stops the network benchmark early and reports the totals.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(netBenchmarkStop, ConsoleVoid, 1, 1, ())
+{
+   NetBenchmark::stop();
+}
+
+/*! Gets whether the network benchmark is running.
+    @return Whether the network benchmark is running.
+*/
+ConsoleFunctionWithDocs(netBenchmarkIsRunning, ConsoleBool, 1, 1, ())
+{
+   return NetBenchmark::isRunning();
+}
+
+ConsoleFunctionGroupEnd( NetBenchmark );
+
+/*! @} */ // group NetBenchmarkFunctions
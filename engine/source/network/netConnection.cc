@@ -160,12 +160,16 @@ static U32 gPacketRateToServer = 32;
 static U32 gPacketUpdateDelayToServer = 32;
 static U32 gPacketRateToClient = 10;
 static U32 gPacketSize = 200;
+static bool gAdaptiveRate = true;
+
+const F32 NetConnection::MinSendRateScale = 0.125f;
 
 void NetConnection::consoleInit()
 {
    Con::addVariable("pref::Net::PacketRateToServer",  TypeS32, &gPacketRateToServer);
    Con::addVariable("pref::Net::PacketRateToClient",  TypeS32, &gPacketRateToClient);
    Con::addVariable("pref::Net::PacketSize",          TypeS32, &gPacketSize);
+   Con::addVariable("pref::Net::AdaptiveRate",        TypeBool, &gAdaptiveRate);
    Con::addVariable("Stats::netBitsSent",       TypeS32, &gNetBitsSent);
    Con::addVariable("Stats::netBitsReceived",   TypeS32, &gNetBitsReceived);
    Con::addVariable("Stats::netGhostUpdates",   TypeS32, &gGhostUpdates);
@@ -202,6 +206,79 @@ void NetConnection::checkMaxRate()
    }
 }
 
+U32 NetConnection::getSendDelay()
+{
+   U32 delay = isConnectionToServer() ? gPacketUpdateDelayToServer : mCurRate.updateDelay;
+   if(!gAdaptiveRate)
+      return delay;
+
+   // Congestion lowers the packet rate...
+   return getMin(U32(delay / mSendRateFactor), U32(MaxSendDelay));
+}
+
+S32 NetConnection::getSendPacketSize()
+{
+   if(!gAdaptiveRate)
+      return mCurRate.packetSize;
+
+   // ...and the packet size.
+   return getMax(S32(mCurRate.packetSize * mSendRateFactor), getMin(mCurRate.packetSize, S32(MinSendPacketSize)));
+}
+
+void NetConnection::updateSendRate(bool recvd, U32 roundTripTime, U32 sendSize, U32 curTime)
+{
+   // Running average of the proportion of packets lost.
+   mPacketLoss = mPacketLoss * 0.95f + (recvd ? 0.0f : 0.05f);
+
+   if(recvd)
+   {
+      // Estimate the bandwidth from the bytes acknowledged each second.
+      mBandwidthBytes += sendSize;
+      U32 elapsed = curTime - mBandwidthSampleTime;
+      if(elapsed >= 1000)
+      {
+         F32 bandwidth = mBandwidthBytes * 1000.0f / elapsed;
+         mBandwidth = mBandwidth == 0 ? bandwidth : mBandwidth * 0.75f + bandwidth * 0.25f;
+         mBandwidthBytes = 0;
+         mBandwidthSampleTime = curTime;
+      }
+
+      // Track the smallest round trip, letting it rise slowly in case the route changes.
+      if(mMinRoundTripTime == 0 || roundTripTime < mMinRoundTripTime)
+         mMinRoundTripTime = F32(roundTripTime);
+      else
+         mMinRoundTripTime += (roundTripTime - mMinRoundTripTime) * 0.01f;
+   }
+
+   if(!gAdaptiveRate || !isNetworkConnection())
+      return;
+
+   // A dropped packet, or a round trip well above the smallest seen, means packets are
+   // queuing somewhere.  The other side only acks when it next sends so allow for its delay.
+   U32 remoteDelay = isConnectionToServer() ? mCurRate.updateDelay : gPacketUpdateDelayToServer;
+   bool congested = !recvd || roundTripTime > mMinRoundTripTime * 2 + remoteDelay + CongestionDelaySlack;
+
+   if(congested)
+   {
+      // Back off multiplicatively, but only once per round trip as a burst of drops is
+      // one congestion event.
+      if(curTime - mLastCongestionTime <= U32(mRoundTripTime))
+         return;
+      mLastCongestionTime = curTime;
+      mSendRateScale = getMax(mSendRateScale * (recvd ? 0.85f : 0.7f), MinSendRateScale);
+   }
+   else if(mSendRateScale < 1.0f)
+   {
+      // Probe for more bandwidth additively.
+      mSendRateScale = getMin(mSendRateScale + 0.01f, 1.0f);
+   }
+   else
+      return;
+
+   // The rate and size each take half of the scale.
+   mSendRateFactor = mSqrt(mSendRateScale);
+}
+
 void NetConnection::setSendingEvents(bool sending)
 {
    AssertFatal(!mEstablished, "Error, cannot change event behavior after a connection has been established.");
@@ -241,6 +318,13 @@ NetConnection::NetConnection()
    mEstablished = false;
    mLastUpdateTime = 0;
    mRoundTripTime = 0;
+   mMinRoundTripTime = 0;
+   mSendRateScale = 1.0f;
+   mSendRateFactor = 1.0f;
+   mLastCongestionTime = 0;
+   mBandwidth = 0;
+   mBandwidthBytes = 0;
+   mBandwidthSampleTime = Platform::getVirtualMilliseconds();
    mPacketLoss = 0;
    mNextTableHash = NULL;
    mSendDelayCredit = 0;
@@ -255,6 +339,9 @@ NetConnection::NetConnection()
    mNotifyQueueHead = NULL;
    mNotifyQueueTail = NULL;
 
+   mPacketBuildBuffer = new U8[MaxPacketDataSize];
+   mPacketBuildStream = new BitStream(mPacketBuildBuffer, MaxPacketDataSize);
+
    mCurRate.updateDelay = 102;
    mCurRate.packetSize = 200;
    mCurRate.changed = false;
@@ -282,6 +369,7 @@ NetConnection::NetConnection()
    mGhostingSequence = 0;
    mGhosting = false;
    mScoping = false;
+   mGhostScoped = false;
    mGhostArray = NULL;
    mGhostRefs = NULL;
    mGhostLookupTable = NULL;
@@ -317,6 +405,9 @@ NetConnection::~NetConnection()
    delete[] mGhostLookupTable;
    delete[] mGhostRefs;
    delete[] mGhostArray;
+
+   delete mPacketBuildStream;
+   delete[] mPacketBuildBuffer;
    delete mStringTable;
    if(mDemoWriteStream)
       delete mDemoWriteStream;
@@ -329,6 +420,7 @@ NetConnection::PacketNotify::PacketNotify()
    rateChanged = false;
    maxRateChanged = false;
    sendTime = 0;
+   sendSize = 0;
    eventList = 0;
    ghostList = 0;
 }
@@ -430,16 +522,18 @@ void NetConnection::handleNotify(bool recvd)
    if(note->maxRateChanged && !recvd)
       mMaxRate.changed = true;
 
+   U32 curTime = Platform::getVirtualMilliseconds();
    if(recvd) 
    {
       // Running average of roundTrip time
-      U32 curTime = Platform::getVirtualMilliseconds();
       mRoundTripTime = (mRoundTripTime + (curTime - note->sendTime)) * 0.5f;
       packetReceived(note);
    }
    else
       packetDropped(note);
 
+   updateSendRate(recvd, curTime - note->sendTime, note->sendSize, curTime);
+
    delete note;
 }
 
@@ -518,14 +612,24 @@ public:
 };
 
 void NetConnection::checkPacketSend(bool force)
+{
+   if(!beginPacketSend(force))
+      return;
+
+   BitStream *stream = BitStream::getPacketStream(getSendPacketSize());
+   buildPacket(stream);
+   endPacketSend(stream);
+}
+
+bool NetConnection::beginPacketSend(bool force)
 {
    U32 curTime = Platform::getVirtualMilliseconds();
-   U32 delay = isConnectionToServer() ? gPacketUpdateDelayToServer : mCurRate.updateDelay;
+   U32 delay = getSendDelay();
 
    if(!force)
    {
       if(curTime < mLastUpdateTime + delay - mSendDelayCredit)
-         return;
+         return false;
 
       mSendDelayCredit = curTime - (mLastUpdateTime + delay - mSendDelayCredit);
       if(mSendDelayCredit > 1000)
@@ -535,13 +639,12 @@ void NetConnection::checkPacketSend(bool force)
          recordBlock(BlockTypeSendPacket, 0, 0);
    }
    if(windowFull())
-      return;
-
-   BitStream *stream = BitStream::getPacketStream(mCurRate.packetSize);
-   buildSendPacketHeader(stream);
+      return false;
 
    mLastUpdateTime = curTime;
 
+   // The notify is allocated here rather than when the packet is built
+   // as the packet may be built on a worker thread.
    PacketNotify *note = allocNotify();
    if(!mNotifyQueueHead)
       mNotifyQueueHead = note;
@@ -551,6 +654,14 @@ void NetConnection::checkPacketSend(bool force)
    note->nextPacket = NULL;
    note->sendTime = curTime;
 
+   return true;
+}
+
+void NetConnection::buildPacket(BitStream *stream)
+{
+   buildSendPacketHeader(stream);
+
+   PacketNotify *note = mNotifyQueueTail;
    note->rateChanged = mCurRate.changed;
    note->maxRateChanged = mMaxRate.changed;
 
@@ -569,6 +680,20 @@ void NetConnection::checkPacketSend(bool force)
    DEBUG_LOG(("PKLOG %d START", getId()) );
    writePacket(stream, note);
    DEBUG_LOG(("PKLOG %d END - %d", getId(), stream->getCurPos() - start) );
+}
+
+BitStream *NetConnection::buildPacketStream()
+{
+   mPacketBuildStream->setBuffer(mPacketBuildBuffer, getSendPacketSize(), MaxPacketDataSize);
+   mPacketBuildStream->setPosition(0);
+   buildPacket(mPacketBuildStream);
+   return mPacketBuildStream;
+}
+
+void NetConnection::endPacketSend(BitStream *stream)
+{
+   mNotifyQueueTail->sendSize = stream->getPosition();
+
    if(mSimulatedPacketLoss && Platform::getRandom() < mSimulatedPacketLoss)
    {
       //Con::printf("NET  %d: SENDDROP - %d", getId(), mLastSendSeq);
@@ -481,6 +481,10 @@ private:
     U32 mLastUpdateTime;
     F32 mRoundTripTime;
     F32 mPacketLoss;
+    F32 mMinRoundTripTime;      ///< Smallest recent round trip, used to detect queuing.
+    F32 mBandwidth;             ///< Estimated bytes per second delivered to the other side.
+    U32 mBandwidthBytes;        ///< Bytes acknowledged since mBandwidthSampleTime.
+    U32 mBandwidthSampleTime;
     U32 mSimulatedPing;
     F32 mSimulatedPacketLoss;
 
@@ -507,6 +511,30 @@ private:
     NetRate mCurRate;
     NetRate mMaxRate;
 
+    /// @name Adaptive Rate
+    ///
+    /// The negotiated rate is the most this side will send.  When $pref::Net::AdaptiveRate
+    /// is enabled, dropped packets and rising round trips scale the packet rate and size
+    /// down multiplicatively and acknowledged packets scale them back up additively.
+    /// @{
+
+    enum AdaptiveRateConstants
+    {
+        MaxSendDelay = 1024,         ///< Never send less than one packet a second.
+        MinSendPacketSize = 100,     ///< Never shrink packets below this many bytes.
+        CongestionDelaySlack = 50,   ///< Round trip variation (ms) not treated as queuing.
+    };
+
+    F32 mSendRateScale;         ///< Proportion of the negotiated bandwidth being used.
+    F32 mSendRateFactor;        ///< Square root of mSendRateScale, applied to both the rate and the size.
+    U32 mLastCongestionTime;
+
+    static const F32 MinSendRateScale;
+
+    void updateSendRate(bool recvd, U32 roundTripTime, U32 sendSize, U32 curTime);
+
+    /// @}
+
     /// If we're doing a "short circuited" connection, this stores
     /// a pointer to the other side.
     SimObjectPtr<NetConnection> mRemoteConnection;
@@ -586,6 +614,14 @@ public:
     U32 getProtocolVersion()                     { return mProtocolVersion; }
     F32 getRoundTripTime()                       { return mRoundTripTime; }
     F32 getPacketLoss()                          { return( mPacketLoss ); }
+    F32 getBandwidth()                           { return mBandwidth; }
+    F32 getSendRateScale()                       { return mSendRateScale; }
+
+    /// Get the delay (ms) between packets sent on this connection.
+    U32 getSendDelay();
+
+    /// Get the size of packets sent on this connection.
+    S32 getSendPacketSize();
 
     static char mErrorBuffer[256];
     static void setLastError(const char *fmt,...);
@@ -601,6 +637,9 @@ public:
     void setNetAddress(const NetAddress *address);
     Net::Error sendPacket(BitStream *stream);
 
+    U8 *mPacketBuildBuffer;          ///< Packet data written by buildPacketStream().
+    BitStream *mPacketBuildStream;   ///< Stream over mPacketBuildBuffer.
+
 private:
     void netAddressTableInsert();
     void netAddressTableRemove();
@@ -613,6 +652,31 @@ public:
 
     void checkPacketSend(bool force);
 
+    /// @name Packet Building
+    ///
+    /// checkPacketSend() is split into three steps so that NetInterface can build the
+    /// packets for several connections at once on the thread pool.  Only buildPacket()
+    /// may run on a worker thread; it writes the queued events and ghost updates so
+    /// NetEvent::pack(), NetObject::packUpdate() and NetObject::getUpdatePriority()
+    /// must not touch state shared with other connections when
+    /// $pref::Net::ParallelPacketBuild is enabled.
+    /// @{
+
+    /// Check whether a packet is due and, if so, queue its notify.
+    /// @return Whether a packet should be built and sent.
+    bool beginPacketSend(bool force);
+
+    /// Write the packet started by beginPacketSend() to a stream.
+    void buildPacket(BitStream *stream);
+
+    /// Build the packet into this connection's own stream.
+    BitStream *buildPacketStream();
+
+    /// Send a packet built by buildPacket().
+    void endPacketSend(BitStream *stream);
+
+    /// @}
+
     bool missionPathsSent() const          { return mMissionPathsSent; }
     void setMissionPathsSent(const bool s) { mMissionPathsSent = s; }
 
@@ -659,6 +723,7 @@ public:
         bool rateChanged;       ///< Did the rate change on this packet?
         bool maxRateChanged;    ///< Did the max rate change on this packet?
         U32  sendTime;          ///< Timestampe, when we sent this packet.
+        U32  sendSize;          ///< Size of the packet in bytes.
 
         NetEventNote *eventList;    ///< Linked list of events sent over this packet.
         GhostRef *ghostList;    ///< Linked list of ghost updates we sent in this packet.
@@ -717,6 +782,9 @@ public:
     /// Post an event to this connection.
     bool postNetEvent(NetEvent *event);
 
+    /// Get the most recently posted guaranteed ordered event if it has not yet been sent.
+    NetEvent *getUnsentOrderedEvent() { return mSendEventQueueTail ? mSendEventQueueTail->mEvent : NULL; }
+
     /// @}
 
     //----------------------------------------------------------------
@@ -766,6 +834,12 @@ protected:
     U32 mGhostZeroUpdateIndex;  ///< Index in mGhostArray of first ghost with 0 update mask.
     U32 mGhostFreeIndex;        ///< Index in mGhostArray of first free ghost.
 
+    Vector<GhostInfo*> mGhostSortBuffer;  ///< Scratch used when ordering the ghosts being updated by priority.
+    Vector<U8> mGhostSortBuckets;         ///< Scratch holding the priority bucket of each ghost being sorted.
+
+    CameraScopeQuery mCameraScope;  ///< The scope query of the packet being written.
+    bool mGhostScoped;              ///< Has ghostScopePacket() been called for the packet being written?
+
     U32 mGhostsActive;			///- Track actve ghosts on client side
 
     bool mGhosting;             ///< Am I currently ghosting objects?
@@ -793,6 +867,23 @@ protected:
 
     void ghostWritePacket(BitStream *bstream, PacketNotify *notify);
     void ghostReadPacket(BitStream *bstream);
+
+public:
+    /// Scope the ghosts for the next packet written.
+    ///
+    /// Scoping attaches and detaches objects which are shared with other connections
+    /// so it is always performed on the main thread.  ghostWritePacket() calls this
+    /// itself unless it has already been called for the packet.
+    void ghostScopePacket();
+
+protected:
+    /// Order the ghosts being updated by ascending priority.
+    ///
+    /// Rather than fully sorting, the ghosts are distributed into GhostPriorityBuckets
+    /// buckets spanning the range of priorities which takes linear time.  Ghosts being
+    /// killed always go in the highest bucket.  Ghosts whose priorities fall in the same
+    /// bucket keep their existing relative order.
+    void sortGhostsByPriority();
     void freeGhostInfo(GhostInfo *);
 
     void ghostWriteStartBlock(ResizeBitStream *stream);
@@ -55,8 +55,8 @@ ConsoleMethodWithDocs( NetConnection, getPing, ConsoleInt, 2, 2, ())
    return( S32( object->getRoundTripTime() ) );
 }
 
-/*! Use the getPacketLoss method to determine the current packetLoss count for this connection.
-    @return Returns an integer value between 0 and inf, indicating the number of packets that have been lost to date on this net connection.
+/*! Use the getPacketLoss method to determine the recent packet loss for this connection.
+    @return Returns an integer value between 0 and 100, indicating the percentage of recently sent packets that have been lost on this net connection.
     @sa getPing
 */
 ConsoleMethodWithDocs( NetConnection, getPacketLoss, ConsoleInt, 2, 2, ())
@@ -64,6 +64,27 @@ ConsoleMethodWithDocs( NetConnection, getPacketLoss, ConsoleInt, 2, 2, ())
    return( S32( 100 * object->getPacketLoss() ) );
 }
 
+/*! Use the getSendRate method to determine the rate this connection is currently sending at.
+    When $pref::Net::AdaptiveRate is enabled, the rate is lowered from the negotiated rate whilst the connection is congested.
+    @return Returns a string of the form "packetsPerSecond packetSize scale" where scale is the proportion (0.125 to 1) of the negotiated bandwidth being used.
+    @sa getBandwidth, getPacketLoss
+*/
+ConsoleMethodWithDocs( NetConnection, getSendRate, ConsoleString, 2, 2, ())
+{
+   char *buffer = Con::getReturnBuffer(64);
+   dSprintf(buffer, 64, "%g %d %g", 1024.0f / object->getSendDelay(), object->getSendPacketSize(), object->getSendRateScale());
+   return buffer;
+}
+
+/*! Use the getBandwidth method to determine the estimated bandwidth delivered over this connection.
+    @return Returns the number of bytes per second the other side has acknowledged receiving, averaged over recent seconds.
+    @sa getSendRate
+*/
+ConsoleMethodWithDocs( NetConnection, getBandwidth, ConsoleFloat, 2, 2, ())
+{
+   return object->getBandwidth();
+}
+
 /*! Use the checkMaxRate method to retrieve the current maximum packet rate for this connection.
     The period may not neccesarily be one second. To adjust packet rates, see the preference variables above
     @return Returns an integer value representing the maximum number of packets that can be transmitted by this connection per transmission period.
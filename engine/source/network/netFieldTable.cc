@@ -0,0 +1,175 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "network/netFieldTable.h"
+#include "io/bitStream.h"
+#include "math/mMathFn.h"
+
+//-----------------------------------------------------------------------------
+
+void NetFieldTable::addBool(const U32 offset, const U32 mask)
+{
+   AssertFatal(mask != 0, "NetFieldTable::addBool - a field must have a state mask.");
+
+   Field field;
+   field.offset = offset;
+   field.type = FieldBool;
+   field.mask = mask;
+   field.minInt = 0;
+   field.maxInt = 1;
+   field.minFloat = 0.0f;
+   field.maxFloat = 0.0f;
+   field.bits = 1;
+   mFields.push_back(field);
+}
+
+void NetFieldTable::addRangedS32(const U32 offset, const U32 mask, const S32 min, const S32 max)
+{
+   AssertFatal(mask != 0, "NetFieldTable::addRangedS32 - a field must have a state mask.");
+   AssertFatal(max > min, "NetFieldTable::addRangedS32 - invalid range.");
+
+   Field field;
+   field.offset = offset;
+   field.type = FieldRangedS32;
+   field.mask = mask;
+   field.minInt = min;
+   field.maxInt = max;
+   field.minFloat = 0.0f;
+   field.maxFloat = 0.0f;
+   field.bits = getBinLog2(getNextPow2(U32(max - min) + 1));
+   mFields.push_back(field);
+}
+
+void NetFieldTable::addRangedF32(const U32 offset, const U32 mask, const F32 min, const F32 max, const U32 bits)
+{
+   AssertFatal(mask != 0, "NetFieldTable::addRangedF32 - a field must have a state mask.");
+   AssertFatal(max > min, "NetFieldTable::addRangedF32 - invalid range.");
+   AssertFatal(bits > 0 && bits < 32, "NetFieldTable::addRangedF32 - invalid bit count.");
+
+   Field field;
+   field.offset = offset;
+   field.type = FieldRangedF32;
+   field.mask = mask;
+   field.minInt = 0;
+   field.maxInt = 0;
+   field.minFloat = min;
+   field.maxFloat = max;
+   field.bits = bits;
+   mFields.push_back(field);
+}
+
+//-----------------------------------------------------------------------------
+
+U32 NetFieldTable::quantize(const Field &field, const void *object) const
+{
+   const U8 *data = (const U8 *) object + field.offset;
+
+   switch(field.type)
+   {
+   case FieldBool:
+      return *(const bool *) data ? 1 : 0;
+
+   case FieldRangedS32:
+      return U32(mClamp(*(const S32 *) data, field.minInt, field.maxInt) - field.minInt);
+
+   case FieldRangedF32:
+      {
+         const F32 value = (mClampF(*(const F32 *) data, field.minFloat, field.maxFloat) - field.minFloat) / (field.maxFloat - field.minFloat);
+         return U32(value * F32((1 << field.bits) - 1) + 0.5f);
+      }
+   }
+
+   return 0;
+}
+
+void NetFieldTable::dequantize(const Field &field, const U32 value, void *object) const
+{
+   U8 *data = (U8 *) object + field.offset;
+
+   switch(field.type)
+   {
+   case FieldBool:
+      *(bool *) data = value != 0;
+      break;
+
+   case FieldRangedS32:
+      *(S32 *) data = S32(value) + field.minInt;
+      break;
+
+   case FieldRangedF32:
+      *(F32 *) data = field.minFloat + (F32(value) / F32((1 << field.bits) - 1)) * (field.maxFloat - field.minFloat);
+      break;
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+U32 NetFieldTable::updateSnapshot(const void *object, U32 *snapshot) const
+{
+   U32 changed = 0;
+
+   for(S32 i = 0; i < mFields.size(); i++)
+   {
+      const U32 value = quantize(mFields[i], object);
+      if(value != snapshot[i])
+      {
+         snapshot[i] = value;
+         changed |= mFields[i].mask;
+      }
+   }
+
+   return changed;
+}
+
+void NetFieldTable::pack(const void *object, const U32 mask, BitStream *stream) const
+{
+   bool writing = false;
+
+   for(S32 i = 0; i < mFields.size(); i++)
+   {
+      const Field &field = mFields[i];
+
+      // write a flag at the start of each run of fields with the same mask
+      if(i == 0 || field.mask != mFields[i - 1].mask)
+         writing = stream->writeFlag((mask & field.mask) != 0);
+
+      if(writing)
+         stream->writeInt(S32(quantize(field, object)), S32(field.bits));
+   }
+}
+
+void NetFieldTable::unpack(void *object, BitStream *stream) const
+{
+   bool reading = false;
+
+   for(S32 i = 0; i < mFields.size(); i++)
+   {
+      const Field &field = mFields[i];
+
+      // read the flag at the start of each run of fields with the same mask
+      if(i == 0 || field.mask != mFields[i - 1].mask)
+         reading = stream->readFlag();
+
+      if(reading)
+         dequantize(field, U32(stream->readInt(S32(field.bits))), object);
+   }
+}
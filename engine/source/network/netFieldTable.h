@@ -0,0 +1,118 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _NET_FIELD_TABLE_H_
+#define _NET_FIELD_TABLE_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+class BitStream;
+
+//-----------------------------------------------------------------------------
+/// A declarative description of the replicated fields of a NetObject class.
+///
+/// Rather than hand-writing the bit encoding in packUpdate() and unpackUpdate(), a class
+/// declares each replicated field once with the state mask that covers it and the range
+/// it is quantized to.  The table then packs and unpacks the fields for a state mask and
+/// detects which states have changed by comparing the quantized values against a snapshot
+/// of those last replicated, so changes too small to survive quantization send nothing.
+///
+/// Fields sharing a state mask should be added consecutively as a single flag is written
+/// for each run of fields with the same mask.
+///
+/// @code
+///    static NetFieldTable sFields;
+///    U32 mFieldSnapshot[3];
+///
+///    // once, when the class is initialized
+///    sFields.addRangedF32(Offset(mPosition.x, MyObject), PositionMask, -1000.0f, 1000.0f, 20);
+///    sFields.addRangedF32(Offset(mPosition.y, MyObject), PositionMask, -1000.0f, 1000.0f, 20);
+///    sFields.addRangedS32(Offset(mHealth, MyObject), HealthMask, 0, 100);
+///
+///    // on the server, once per tick (the snapshot starting as U32_MAX so every state is sent first)
+///    const U32 changed = sFields.updateSnapshot(this, mFieldSnapshot);
+///    if(changed)
+///       setMaskBits(changed);
+///
+///    // in packUpdate() and unpackUpdate()
+///    sFields.pack(this, mask, stream);
+///    sFields.unpack(this, stream);
+/// @endcode
+///
+/// Only the states a client has not acknowledged are resent as the ghost manager sets the
+/// mask bits of a dropped update again, so each client receives the fields that changed
+/// since its last acknowledged update.
+class NetFieldTable
+{
+public:
+   enum FieldType
+   {
+      FieldBool,
+      FieldRangedS32,
+      FieldRangedF32,
+   };
+
+   struct Field
+   {
+      U32 offset;       ///< Offset of the field within the object.
+      FieldType type;   ///< Type of the field.
+      U32 mask;         ///< State mask covering the field.
+      S32 minInt;       ///< Range of an integer field.
+      S32 maxInt;
+      F32 minFloat;     ///< Range of a float field.
+      F32 maxFloat;
+      U32 bits;         ///< Bits written for the field.
+   };
+
+   void addBool(const U32 offset, const U32 mask);
+   void addRangedS32(const U32 offset, const U32 mask, const S32 min, const S32 max);
+   void addRangedF32(const U32 offset, const U32 mask, const F32 min, const F32 max, const U32 bits);
+
+   /// Get the number of fields which is also the number of entries a snapshot needs.
+   U32 getFieldCount() const { return mFields.size(); }
+   const Field& getField(const U32 index) const { return mFields[index]; }
+
+   /// Quantize the fields of an object and compare them against a snapshot of the
+   /// values last replicated.  The snapshot is updated with the new values and should
+   /// start filled with U32_MAX so that every state is reported as changed at first.
+   /// @return The state masks of the fields whose quantized value changed.
+   U32 updateSnapshot(const void *object, U32 *snapshot) const;
+
+   /// Write the fields of an object covered by the state mask.
+   void pack(const void *object, const U32 mask, BitStream *stream) const;
+
+   /// Read the fields written by pack() into an object.
+   void unpack(void *object, BitStream *stream) const;
+
+private:
+   U32 quantize(const Field &field, const void *object) const;
+   void dequantize(const Field &field, const U32 value, void *object) const;
+
+   Vector<Field> mFields;
+};
+
+#endif // _NET_FIELD_TABLE_H_
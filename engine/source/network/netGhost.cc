@@ -265,41 +265,66 @@ struct UpdateQueueEntry
       { priority = in_priority; obj = in_obj; }
 };
 
-static S32 QSORT_CALLBACK UQECompare(const void *a,const void *b)
+#define GhostPriorityBuckets 64
+
+void NetConnection::sortGhostsByPriority()
 {
-   GhostInfo *ga = *((GhostInfo **) a);
-   GhostInfo *gb = *((GhostInfo **) b);
+   const S32 count = mGhostZeroUpdateIndex;
+   if(count < 2)
+      return;
 
-   F32 ret = ga->priority - gb->priority;
-   return (ret < 0) ? -1 : ((ret > 0) ? 1 : 0);
-}
+   // find the range of priorities of the ghosts not being killed
+   F32 minPriority = F32_MAX;
+   F32 maxPriority = -F32_MAX;
+   S32 i;
+   for(i = 0; i < count; i++)
+   {
+      GhostInfo *walk = mGhostArray[i];
+      if(walk->flags & GhostInfo::KillGhost)
+         continue;
+      minPriority = getMin(minPriority, walk->priority);
+      maxPriority = getMax(maxPriority, walk->priority);
+   }
 
-void NetConnection::ghostWritePacket(BitStream *bstream, PacketNotify *notify)
-{
-#ifdef    TORQUE_DEBUG_NET
-   bstream->writeInt(DebugChecksum, 32);
-#endif
+   // the top bucket is reserved for ghosts being killed
+   const F32 bucketScale = maxPriority > minPriority ? F32(GhostPriorityBuckets - 2) / (maxPriority - minPriority) : 0.0f;
 
-   notify->ghostList = NULL;
+   mGhostSortBuckets.setSize(count);
+   U8 *buckets = mGhostSortBuckets.address();
+   U32 bucketStart[GhostPriorityBuckets + 1];
+   dMemset(bucketStart, 0, sizeof(bucketStart));
 
-   if(!isGhostingFrom())
-      return;
+   // count the ghosts in each bucket
+   for(i = 0; i < count; i++)
+   {
+      GhostInfo *walk = mGhostArray[i];
+      if(walk->flags & GhostInfo::KillGhost)
+         buckets[i] = GhostPriorityBuckets - 1;
+      else
+         buckets[i] = U8(mClamp(S32((walk->priority - minPriority) * bucketScale), 0, GhostPriorityBuckets - 2));
+      bucketStart[buckets[i] + 1]++;
+   }
 
-   if(!bstream->writeFlag(mGhosting))
-      return;
+   // turn the counts into the start of each bucket
+   for(i = 1; i <= GhostPriorityBuckets; i++)
+      bucketStart[i] += bucketStart[i - 1];
 
-   // fill a packet (or two) with ghosting data
+   // distribute the ghosts into their buckets and copy them back
+   mGhostSortBuffer.setSize(count);
+   for(i = 0; i < count; i++)
+      mGhostSortBuffer[bucketStart[buckets[i]]++] = mGhostArray[i];
 
-   // first step is to check all our polled ghosts:
+   dMemcpy(mGhostArray, mGhostSortBuffer.address(), count * sizeof(GhostInfo *));
+}
 
-   // 1. Scope query - find if any new objects have come into
-   //    scope and if any have gone out.
-   // 2. call scoped objects' priority functions if the flag set is nonzero
-   //    A removed ghost is assumed to have a high priority
-   // 3. call updates based on sorted priority until the packet is
-   //    full.  set flags to zero for all updated objects
+void NetConnection::ghostScopePacket()
+{
+   mGhostScoped = true;
+
+   if(!isGhostingFrom() || !mGhosting)
+      return;
 
-   CameraScopeQuery camInfo;
+   CameraScopeQuery &camInfo = mCameraScope;
 
    camInfo.camera = NULL;
    camInfo.pos.set(0,0,0);
@@ -312,7 +337,6 @@ void NetConnection::ghostWritePacket(BitStream *bstream, PacketNotify *notify)
    GhostInfo *walk;
 
    // only need to worry about the ghosts that have update masks set...
-   S32 maxIndex = 0;
    S32 i;
    for(i = 0; i < (S32)mGhostZeroUpdateIndex; i++)
    {
@@ -332,32 +356,73 @@ void NetConnection::ghostWritePacket(BitStream *bstream, PacketNotify *notify)
          detachObject(mGhostArray[i]);
    }
 
+   // clear out any kill objects that haven't been ghosted yet
+   for(i = mGhostZeroUpdateIndex - 1; i >= 0; i--)
+   {
+      walk = mGhostArray[i];
+      if((walk->flags & GhostInfo::KillGhost) && (walk->flags & GhostInfo::NotYetGhosted))
+         freeGhostInfo(walk);
+   }
+}
+
+void NetConnection::ghostWritePacket(BitStream *bstream, PacketNotify *notify)
+{
+#ifdef    TORQUE_DEBUG_NET
+   bstream->writeInt(DebugChecksum, 32);
+#endif
+
+   notify->ghostList = NULL;
+
+   const bool scoped = mGhostScoped;
+   mGhostScoped = false;
+
+   if(!isGhostingFrom())
+      return;
+
+   if(!bstream->writeFlag(mGhosting))
+      return;
+
+   // fill a packet (or two) with ghosting data
+
+   // first step is to check all our polled ghosts:
+
+   // 1. Scope query - find if any new objects have come into
+   //    scope and if any have gone out.  This is done by ghostScopePacket()
+   //    unless it has already been called for this packet.
+   // 2. call scoped objects' priority functions if the flag set is nonzero
+   //    A removed ghost is assumed to have a high priority
+   // 3. call updates based on sorted priority until the packet is
+   //    full.  set flags to zero for all updated objects
+
+   if(!scoped)
+      ghostScopePacket();
+   mGhostScoped = false;
+
+   GhostInfo *walk;
+
+   // only need to worry about the ghosts that have update masks set...
+   S32 maxIndex = 0;
+   S32 i;
    for(i = mGhostZeroUpdateIndex - 1; i >= 0; i--)
    {
       walk = mGhostArray[i];
       if(walk->index > (U32)maxIndex)
          maxIndex = walk->index;
 
-      // clear out any kill objects that haven't been ghosted yet
-      if((walk->flags & GhostInfo::KillGhost) && (walk->flags & GhostInfo::NotYetGhosted))
-      {
-         freeGhostInfo(walk);
-         continue;
-      }
       // don't do any ghost processing on objects that are being killed
       // or in the process of ghosting
-      else if(!(walk->flags & (GhostInfo::KillingGhost | GhostInfo::Ghosting)))
+      if(!(walk->flags & (GhostInfo::KillingGhost | GhostInfo::Ghosting)))
       {
          if(walk->flags & GhostInfo::KillGhost)
             walk->priority = 10000;
          else
-            walk->priority = walk->obj->getUpdatePriority(&camInfo, walk->updateMask, walk->updateSkipCount);
+            walk->priority = walk->obj->getUpdatePriority(&mCameraScope, walk->updateMask, walk->updateSkipCount);
       }
       else
          walk->priority = 0;
    }
    GhostRef *updateList = NULL;
-   dQsort(mGhostArray, mGhostZeroUpdateIndex, sizeof(GhostInfo *), UQECompare);
+   sortGhostsByPriority();
 
    // reset the array indices...
    for(i = mGhostZeroUpdateIndex - 1; i >= 0; i--)
@@ -27,6 +27,8 @@
 #include "io/bitStream.h"
 #include "math/mRandom.h"
 #include "game/gameInterface.h"
+#include "console/consoleVariableRef.h"
+#include "platform/threads/threadPool.h"
 
 #include "netInterface_ScriptBinding.h"
 
@@ -413,24 +415,62 @@ void NetInterface::handleInfoPacket(const NetAddress *address, U8 packetType, Bi
 
 void NetInterface::processClient()
 {
-   NetObject::collapseDirtyList(); // collapse all the mask bits...
-   for(NetConnection *walk = NetConnection::getConnectionList();
-      walk; walk = walk->getNext())
-   {
-      if(walk->isConnectionToServer() && (walk->isLocalConnection() || walk->isNetworkConnection()))
-         walk->checkPacketSend(false);
-   }
+   processConnections(true);
 }
 
 void NetInterface::processServer()
 {
+   processConnections(false);
+}
+
+static void buildPacketRange(void *context, U32 start, U32 end)
+{
+   NetConnection **connections = (NetConnection **) context;
+   for(U32 i = start; i < end; i++)
+      connections[i]->buildPacketStream();
+}
+
+void NetInterface::processConnections(bool toServer)
+{
+   static Con::VariableRef<bool> sParallelPacketBuild("pref::Net::ParallelPacketBuild", false);
+
    NetObject::collapseDirtyList(); // collapse all the mask bits...
+
+   if(!sParallelPacketBuild)
+   {
+      for(NetConnection *walk = NetConnection::getConnectionList();
+         walk; walk = walk->getNext())
+      {
+         if(walk->isConnectionToServer() == toServer && (walk->isLocalConnection() || walk->isNetworkConnection()))
+            walk->checkPacketSend(false);
+      }
+      return;
+   }
+
+   // Start the packets that are due and scope their ghosts on this thread...
+   mPacketSends.clear();
    for(NetConnection *walk = NetConnection::getConnectionList();
       walk; walk = walk->getNext())
    {
-      if(!walk->isConnectionToServer() && (walk->isLocalConnection() || walk->isNetworkConnection()))
-         walk->checkPacketSend(false);
+      if(walk->isConnectionToServer() == toServer && (walk->isLocalConnection() || walk->isNetworkConnection()))
+      {
+         if(walk->beginPacketSend(false))
+         {
+            walk->ghostScopePacket();
+            mPacketSends.push_back(walk);
+         }
+      }
    }
+
+   // ...build them in parallel, each into its connection's own stream...
+   if(mPacketSends.size() > 1)
+      ThreadPool::getGlobal()->parallelFor(buildPacketRange, mPacketSends.address(), mPacketSends.size(), 1);
+   else if(mPacketSends.size() == 1)
+      mPacketSends[0]->buildPacketStream();
+
+   // ...then send them in order.
+   for(S32 i = 0; i < mPacketSends.size(); i++)
+      mPacketSends[i]->endPacketSend(mPacketSends[i]->mPacketBuildStream);
 }
 
 void NetInterface::startConnection(NetConnection *conn)
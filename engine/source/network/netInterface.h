@@ -62,6 +62,7 @@ protected:
    U32                     mRandomHashData[12];    ///< Data that gets hashed with connect challenge requests to prevent connection spoofing.
    bool                    mRandomDataInitialized; ///< Have we initialized our random number generator?
    bool                    mAllowConnections;      ///< Is this NetInterface allowing connections at this time?
+   Vector<NetConnection *> mPacketSends;           ///< Connections whose packets are being built this update.
 
    enum NetInterfaceConstants
    {
@@ -127,6 +128,12 @@ public:
    /// Checks all connections marked as server to client for packet sends.
    void processServer();
 
+   /// Checks the connections in one direction for packet sends.
+   ///
+   /// When $pref::Net::ParallelPacketBuild is enabled, the packets that are due are
+   /// built concurrently on the thread pool and then sent in order from this thread.
+   void processConnections(bool toServer);
+
    /// Begins the connection handshaking process for a connection.
    void startConnection(NetConnection *conn);
 
@@ -33,6 +33,7 @@ IMPLEMENT_CONOBJECT(NetObject);
 
 //----------------------------------------------------------------------------
 NetObject *NetObject::mDirtyList = NULL;
+Vector<NetObject*> NetObject::smScopeList;
 
 NetObject::NetObject()
 {
@@ -42,6 +43,7 @@ NetObject::NetObject()
    mPrevDirtyList = NULL;
    mNextDirtyList = NULL;
    mDirtyMaskBits = 0;
+   mScopeListIndex = -1;
 }
 
 NetObject::~NetObject()
@@ -187,7 +189,17 @@ bool NetObject::onAdd()
    if(mNetFlags.test(ScopeAlways))
       setScopeAlways();
 
-   return Parent::onAdd();
+   if(!Parent::onAdd())
+      return false;
+
+   // track server objects for the default scope query
+   if(!mNetFlags.test(IsGhost))
+   {
+      mScopeListIndex = smScopeList.size();
+      smScopeList.push_back(this);
+   }
+
+   return true;
 }
 
 void NetObject::onRemove()
@@ -195,6 +207,16 @@ void NetObject::onRemove()
    while(mFirstObjectRef)
       mFirstObjectRef->connection->detachObject(mFirstObjectRef);
 
+   // remove from the scope list by moving the last object into our slot
+   if(mScopeListIndex != -1)
+   {
+      NetObject *last = smScopeList.last();
+      smScopeList[mScopeListIndex] = last;
+      last->mScopeListIndex = mScopeListIndex;
+      smScopeList.pop_back();
+      mScopeListIndex = -1;
+   }
+
    Parent::onRemove();
 }
 
@@ -219,22 +241,17 @@ void NetObject::onCameraScopeQuery(NetConnection *cr, CameraScopeQuery* /*camInf
    // default behavior -
    // ghost everything that is ghostable
 
-   for (SimSetIterator obj(Sim::getRootGroup()); *obj; ++obj)
+   for (S32 i = 0; i < smScopeList.size(); i++)
    {
-        NetObject* nobj = dynamic_cast<NetObject*>(*obj);
-        if (nobj)
-        {
-            AssertFatal(!nobj->mNetFlags.test(NetObject::Ghostable) || !nobj->mNetFlags.test(NetObject::IsGhost),
-               "NetObject::onCameraScopeQuery: object marked both ghostable and as ghost");
-
-            // Some objects don't ever want to be ghosted
-            if (!nobj->mNetFlags.test(NetObject::Ghostable))
-                continue;
-         if (!nobj->mNetFlags.test(NetObject::ScopeAlways))
-         {
-            // it's in scope...
-            cr->objectInScope(nobj);
-         }
+      NetObject* nobj = smScopeList[i];
+
+      // Some objects don't ever want to be ghosted
+      if (!nobj->mNetFlags.test(NetObject::Ghostable))
+         continue;
+      if (!nobj->mNetFlags.test(NetObject::ScopeAlways))
+      {
+         // it's in scope...
+         cr->objectInScope(nobj);
       }
    }
 }
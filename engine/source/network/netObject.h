@@ -253,6 +253,21 @@ private:
    NetObject *mNextDirtyList;
 
    /// @}
+
+   /// @name Scope List
+   ///
+   /// Every registered server object is kept in a list so that the default
+   /// scope query visits only the objects that could be ghosted rather than
+   /// walking every object in the simulation on every packet.
+   /// @{
+
+   /// Static list of the registered server objects.
+   static Vector<NetObject*> smScopeList;
+
+   /// Index of this object in the scope list or -1 if not in the list.
+   S32 mScopeListIndex;
+
+   /// @}
 protected:
 
    /// Pointer to the server object; used only when we are doing "short-circuited" networking.
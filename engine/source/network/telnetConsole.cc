@@ -24,6 +24,7 @@
 #include "platform/event.h"
 #include "network/telnetConsole.h"
 #include "game/gameInterface.h"
+#include "debug/frameStats.h"
 
 #include "telnetConsole_ScriptBinding.h"
 
@@ -54,6 +55,8 @@ TelnetConsole::TelnetConsole()
    mAcceptPort = -1;
    mClientList = NULL;
    mRemoteEchoEnabled = false;
+   mFrameStatsPeriod = 0;
+   mFrameStatsLastTime = 0;
 }
 
 TelnetConsole::~TelnetConsole()
@@ -97,6 +100,12 @@ void TelnetConsole::setTelnetParameters(S32 port, const char *telnetPassword, co
    dStrncpy(mListenPassword, listenPassword, PasswordMaxLength);
 }
 
+void TelnetConsole::setFrameStatsStreamPeriod(U32 period)
+{
+   mFrameStatsPeriod = period;
+   mFrameStatsLastTime = Platform::getRealMilliseconds();
+}
+
 void TelnetConsole::processConsoleLine(const char *consoleLine)
 {
    if (mClientList==NULL) return;  // just escape early.  don't even do another step...
@@ -297,4 +306,18 @@ void TelnetConsole::process()
       else
          walk = &cl->nextClient;
    }
+
+   // stream the frame stats...
+   if(mFrameStatsPeriod && mClientList)
+   {
+      U32 currentTime = Platform::getRealMilliseconds();
+      if(currentTime - mFrameStatsLastTime >= mFrameStatsPeriod)
+      {
+         mFrameStatsLastTime = currentTime;
+
+         char summary[1024];
+         FrameStats::formatSummary(summary, sizeof(summary));
+         processConsoleLine(summary);
+      }
+   }
 }
@@ -65,6 +65,9 @@ class TelnetConsole
    char mListenPassword[PasswordMaxLength+1];
    ConsoleEvent mPostEvent;
 
+   U32 mFrameStatsPeriod;     ///< Milliseconds between frame stats summaries (zero when not streaming).
+   U32 mFrameStatsLastTime;
+
    /// State of a TelnetClient.
    enum State
    {
@@ -106,6 +109,14 @@ public:
    /// @param    remoteEcho     Enable/disable echoing input back to the client
    void setTelnetParameters(S32 port, const char *telnetPassword, const char *listenPassword, bool remoteEcho = false);
 
+   /// Send a summary of the frame stats to the connected clients periodically.
+   ///
+   /// The summary is only sent to the telnet clients and is not printed to the console.
+   ///
+   /// @param    period         Milliseconds between summaries or zero to stop streaming.
+   /// @see FrameStats
+   void setFrameStatsStreamPeriod(U32 period);
+
    /// Callback to handle a line from the console.
    ///
    /// @note This is used internally by the class; you
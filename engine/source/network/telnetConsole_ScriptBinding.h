@@ -44,4 +44,16 @@ ConsoleFunctionWithDocs( telnetSetParameters, ConsoleVoid, 4, 5, (int port, stri
    }
 }
 
+/*! 
+    Send a summary of the recent frame stats to the telnet console clients periodically.
+    Each statistic is sent as its median, 95th percentile and maximum over the recent frames.
+    @param period  Milliseconds between summaries (0 stops streaming).
+    @return No return value
+*/
+ConsoleFunctionWithDocs( telnetStreamFrameStats, ConsoleVoid, 2, 2, (int period))
+{
+   if (TelConsole)
+      TelConsole->setFrameStatsStreamPeriod(getMax(dAtoi(argv[1]), 0));
+}
+
 /*! @} */ // end group TelnetConsole
@@ -36,6 +36,7 @@ IMPLEMENT_CONOBJECT(SimXMLDocument);
 // -----------------------------------------------------------------------------
 SimXMLDocument::SimXMLDocument():
 m_qDocument(0),
+m_UseArena(true),
 m_CurrentAttribute(0)
 {
 }
@@ -88,9 +89,10 @@ void SimXMLDocument::onRemove()
    Parent::onRemove();
    if(m_qDocument)
    {
-      m_qDocument->Clear();
       delete(m_qDocument);
+      m_qDocument = NULL;
    }
+   m_Arena.FreeAll();
 }
 
 // -----------------------------------------------------------------------------
@@ -99,6 +101,8 @@ void SimXMLDocument::onRemove()
 void SimXMLDocument::initPersistFields()
 {
    Parent::initPersistFields();
+
+   addField("UseArena", TypeBool, Offset(m_UseArena, SimXMLDocument), "Whether the nodes and strings of the document are allocated from a single region released when it is cleared.  Faster for documents that are read or written in one go, but memory from removed nodes is only reclaimed when the document is cleared.");
 }
 
 // -----------------------------------------------------------------------------
@@ -106,7 +110,11 @@ void SimXMLDocument::initPersistFields()
 // -----------------------------------------------------------------------------
 void SimXMLDocument::reset(void)
 {
-   m_qDocument->Clear();
+   // Delete the document before releasing the arena its nodes and strings came from.
+   delete m_qDocument;
+   m_Arena.FreeAll();
+   m_qDocument = new TiXmlDocument();
+
    m_paNode.clear();
    m_CurrentAttribute = 0;
 }
@@ -118,6 +126,7 @@ S32 SimXMLDocument::loadFile(const char* rFileName)
 {
    reset();
 
+   TiXmlArena::Scope arenaScope( getArena() );
    return m_qDocument->LoadFile(rFileName);
 }
 
@@ -153,6 +162,8 @@ S32 SimXMLDocument::saveFile(const char* rFileName)
 S32 SimXMLDocument::parse(const char* rText)
 {
    reset();
+
+   TiXmlArena::Scope arenaScope( getArena() );
    m_qDocument->Parse( rText );
    return 1;
 }
@@ -347,12 +358,9 @@ const char* SimXMLDocument::attribute(const char* rAttribute)
       return StringTable->EmptyString;
    }
 
-   if(!pNode->Attribute(rAttribute))
-   {
-      return StringTable->EmptyString;
-   }
-
-   return pNode->Attribute(rAttribute);
+   // Return the value held by the node rather than a copy.
+   const char* pValue = pNode->Attribute(rAttribute);
+   return pValue ? pValue : StringTable->EmptyString;
 }
 
 // -----------------------------------------------------------------------------
@@ -483,6 +491,8 @@ const char* SimXMLDocument::prevAttribute()
 // -----------------------------------------------------------------------------
 void SimXMLDocument::setAttribute(const char* rAttribute, const char* rVal)
 {
+   TiXmlArena::Scope arenaScope( getArena() );
+
    if(m_paNode.empty())
    {
       return;
@@ -503,6 +513,8 @@ void SimXMLDocument::setAttribute(const char* rAttribute, const char* rVal)
 // -----------------------------------------------------------------------------
 void SimXMLDocument::setObjectAttributes(const char* objectID)
 {
+   TiXmlArena::Scope arenaScope( getArena() );
+
    if( !objectID || !objectID[0] )
       return;
 
@@ -625,6 +637,8 @@ void SimXMLDocument::setObjectAttributes(const char* objectID)
 // -----------------------------------------------------------------------------
 void SimXMLDocument::pushNewElement(const char* rName)
 {    
+   TiXmlArena::Scope arenaScope( getArena() );
+
    TiXmlElement cElement( rName );
    TiXmlElement* pStackTop = 0;
    if(m_paNode.empty())
@@ -656,6 +670,8 @@ void SimXMLDocument::pushNewElement(const char* rName)
 // -----------------------------------------------------------------------------
 void SimXMLDocument::addNewElement(const char* rName)
 {    
+   TiXmlArena::Scope arenaScope( getArena() );
+
    TiXmlElement cElement( rName );
    TiXmlElement* pStackTop = 0;
    if(m_paNode.empty())
@@ -708,12 +724,16 @@ void SimXMLDocument::addNewElement(const char* rName)
 // -----------------------------------------------------------------------------
 void SimXMLDocument::addHeader(void)
 {
+   TiXmlArena::Scope arenaScope( getArena() );
+
    TiXmlDeclaration cDeclaration("1.0", "utf-8", "yes");
    m_qDocument->InsertEndChild(cDeclaration);
 }
 
 void SimXMLDocument::addComment(const char* comment)
 {
+   TiXmlArena::Scope arenaScope( getArena() );
+
    TiXmlComment cComment;
    cComment.SetValue(comment);
 
@@ -789,6 +809,8 @@ const char* SimXMLDocument::readComment( S32 index )
 
 void SimXMLDocument::addText(const char* text)
 {
+   TiXmlArena::Scope arenaScope( getArena() );
+
    if(m_paNode.empty())
       return;
 
@@ -837,6 +859,8 @@ void SimXMLDocument::removeText()
 
 void SimXMLDocument::addData(const char* text)
 {
+   TiXmlArena::Scope arenaScope( getArena() );
+
    if(m_paNode.empty())
       return;
 
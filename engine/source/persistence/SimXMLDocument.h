@@ -89,6 +89,7 @@ class SimXMLDocument: public SimObject
       void popElement(void);
 
       // Get attribute from top element on element stack.
+      // The value is owned by the document and is valid until it is changed.
       const char* attribute(const char* rAttribute);
 
       // Does the attribute exist in the current element
@@ -132,8 +133,15 @@ class SimXMLDocument: public SimObject
       const char* getData();
       
    private:
+      // Get the arena to allocate document nodes and strings from, if any.
+      inline TiXmlArena* getArena(void) { return m_UseArena ? &m_Arena : NULL; }
+
       // Document.
       TiXmlDocument* m_qDocument;
+      // Region the document nodes and strings are allocated from, released when the document is cleared.
+      TiXmlArena m_Arena;
+      // Whether to allocate from the arena.
+      bool m_UseArena;
       // Stack of nodes.
       Vector<TiXmlElement*> m_paNode;
       // The current attribute
@@ -138,12 +138,8 @@ ConsoleMethodWithDocs(SimXMLDocument, popElement, ConsoleVoid, 2, 2, ())
 */
 ConsoleMethodWithDocs(SimXMLDocument, attribute, ConsoleString, 3, 3, (string attribute))
 {
-   // Create Returnable Buffer (because duration of attribute is unknown).
-   char* pBuffer = Con::getReturnBuffer(256);
-   // Format Buffer.
-   dSprintf(pBuffer, 256, "%s", object->attribute( argv[2] ));
-   // Return Velocity.
-   return pBuffer;
+   // The value is owned by the document and is copied by the console on return.
+   return object->attribute( argv[2] );
 }
 
 /*! Get attribute value if it exists.
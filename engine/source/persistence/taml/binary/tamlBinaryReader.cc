@@ -21,14 +21,83 @@
 //-----------------------------------------------------------------------------
 
 #include "persistence/taml/binary/tamlBinaryReader.h"
+#include "persistence/taml/tamlVisitor.h"
 
 #ifndef _ZIPSUBSTREAM_H_
 #include "io/zip/zipSubStream.h"
 #endif
 
+#ifndef _THREADPOOL_H_
+#include "platform/threads/threadPool.h"
+#endif
+
+#ifndef _VECTOR2_H_
+#include "2d/core/Vector2.h"
+#endif
+
+#ifndef _MATHTYPES_H_
+#include "math/mathTypes.h"
+#endif
+
+#ifndef _COLOR_H_
+#include "graphics/color.h"
+#endif
+
 // Debug Profiling.
 #include "debug/profiler.h"
 
+#include "zlib.h"
+
+//-----------------------------------------------------------------------------
+
+/// The blocks of an image being decompressed in parallel.
+struct TamlBinaryDecompressBlocks
+{
+    const U8* mpCompressed;
+    U8* mpImage;
+    U32 mImageSize;
+    U32 mBlockSize;
+    Vector<U32> mBlockOffsets;
+    Vector<U32> mBlockSizes;
+    volatile bool mFailed;
+};
+
+//-----------------------------------------------------------------------------
+
+static void decompressBlockRange( void* pContext, const U32 start, const U32 end )
+{
+    TamlBinaryDecompressBlocks* pBlocks = static_cast<TamlBinaryDecompressBlocks*>( pContext );
+
+    for( U32 index = start; index < end; ++index )
+    {
+        // Fetch the compressed block.
+        const U8* pSource = pBlocks->mpCompressed + pBlocks->mBlockOffsets[index];
+        const U32 sourceSize = pBlocks->mBlockSizes[index] & ~TamlBinaryWriter::StoredBlockFlag;
+
+        // Fetch where the block belongs in the image.
+        const U32 offset = index * pBlocks->mBlockSize;
+        const U32 size = getMin( pBlocks->mImageSize - offset, pBlocks->mBlockSize );
+        U8* pDestination = pBlocks->mpImage + offset;
+
+        // Is the block stored?
+        if ( (pBlocks->mBlockSizes[index] & TamlBinaryWriter::StoredBlockFlag) != 0 )
+        {
+            // Yes, so copy it.
+            if ( sourceSize != size )
+                pBlocks->mFailed = true;
+            else
+                dMemcpy( pDestination, pSource, size );
+
+            continue;
+        }
+
+        // Decompress the block.
+        uLongf decompressedSize = size;
+        if ( uncompress( pDestination, &decompressedSize, pSource, sourceSize ) != Z_OK || decompressedSize != size )
+            pBlocks->mFailed = true;
+    }
+}
+
 //-----------------------------------------------------------------------------
 
 SimObject* TamlBinaryReader::read( FileStream& stream )
@@ -36,6 +105,107 @@ SimObject* TamlBinaryReader::read( FileStream& stream )
     // Debug Profiling.
     PROFILE_SCOPE(TamlBinaryReader_Read);
 
+    // Read the header.
+    U32 versionId;
+    bool compressed;
+    if ( !readHeader( stream, versionId, compressed ) )
+        return NULL;
+
+    // Does the file have a schema?
+    if ( versionId >= 3 )
+    {
+        // Yes, so read the body size.
+        U32 imageSize;
+        stream.read( &imageSize );
+
+        // Read image.
+        return readImage( stream, versionId, compressed, imageSize );
+    }
+
+    SimObject* pSimObject = NULL;
+
+    // Is the stream compressed?
+    if ( compressed )
+    {
+        // Yes, so attach zip stream.
+        ZipSubRStream zipStream;
+        zipStream.attachStream( &stream );
+
+        // Parse element.
+        pSimObject = parseElement( zipStream, versionId );
+
+        // Detach zip stream.
+        zipStream.detachStream();
+    }
+    else
+    {
+        // No, so parse element.
+        pSimObject = parseElement( stream, versionId );
+    }
+
+    return pSimObject;
+}
+
+//-----------------------------------------------------------------------------
+
+bool TamlBinaryReader::accept( FileStream& stream, const TamlParser& parser, TamlVisitor& visitor )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryReader_Accept);
+
+    // Read the header.
+    U32 versionId;
+    bool compressed;
+    if ( !readHeader( stream, versionId, compressed ) )
+        return false;
+
+    // Does the file have a schema?
+    if ( versionId < 3 )
+    {
+        // No, so warn.
+        Con::warnf( "Taml: Cannot parse binary file as version '%d' is not supported by the parser.", versionId );
+        return false;
+    }
+
+    // Read the body size.
+    U32 imageSize;
+    stream.read( &imageSize );
+
+    // Load the image.
+    U8* pImage = loadImage( stream, versionId, compressed, imageSize );
+    if ( pImage == NULL )
+        return false;
+
+    // Reset the parse.
+    resetParse();
+
+    // Set the image.
+    mpImageStart = pImage;
+    mpImageCursor = pImage;
+    mpImageEnd = pImage + imageSize;
+
+    // Visit the root element.
+    if ( parseImageSchema() )
+        visitImageElement( parser, visitor, true );
+
+    const bool imageError = mImageError;
+
+    // Warn if the image was malformed.
+    if ( imageError )
+        Con::warnf( "Taml: Binary file is malformed." );
+
+    // Reset the parse.
+    resetParse();
+
+    delete [] pImage;
+
+    return !imageError;
+}
+
+//-----------------------------------------------------------------------------
+
+bool TamlBinaryReader::readHeader( FileStream& stream, U32& versionId, bool& compressed )
+{
     // Read Taml signature.
     StringTableEntry tamlSignature = stream.readSTString();
 
@@ -44,39 +214,119 @@ SimObject* TamlBinaryReader::read( FileStream& stream )
     {
         // Warn.
         Con::warnf("Taml: Cannot read binary file as signature is incorrect '%s'.", tamlSignature );
-        return NULL;
+        return false;
     }
 
     // Read version Id.
-    U32 versionId;
     stream.read( &versionId );
 
     // Read compressed flag.
-    bool compressed;
     stream.read( &compressed );
 
-    SimObject* pSimObject = NULL;
+    return true;
+}
 
-    // Is the stream compressed?
-    if ( compressed )
+//-----------------------------------------------------------------------------
+
+U8* TamlBinaryReader::loadImage( FileStream& stream, const U32 versionId, const bool compressed, const U32 imageSize )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryReader_LoadImage);
+
+    // Load the whole body into a single image.
+    // NOTE: The image is parsed in place so a mapped view of an uncompressed file can be parsed the same way.
+    U8* pImage = new U8[imageSize];
+
+    bool imageRead;
+
+    // Is the stream compressed into blocks?
+    if ( compressed && versionId >= 4 )
+    {
+        // Yes, so read the blocks.
+        imageRead = loadCompressedBlocks( stream, pImage, imageSize );
+    }
+    else if ( compressed )
     {
         // Yes, so attach zip stream.
         ZipSubRStream zipStream;
         zipStream.attachStream( &stream );
 
-        // Parse element.
-        pSimObject = parseElement( zipStream, versionId );
+        // Read image.
+        imageRead = zipStream.read( imageSize, pImage );
 
         // Detach zip stream.
         zipStream.detachStream();
     }
     else
     {
-        // No, so parse element.
-        pSimObject = parseElement( stream, versionId );
+        // No, so read image.
+        imageRead = stream.read( imageSize, pImage );
     }
 
-    return pSimObject;
+    // Was the image read?
+    if ( !imageRead )
+    {
+        // No, so warn.
+        Con::warnf( "Taml: Cannot read binary file as it is truncated." );
+        delete [] pImage;
+        return NULL;
+    }
+
+    return pImage;
+}
+
+//-----------------------------------------------------------------------------
+
+bool TamlBinaryReader::loadCompressedBlocks( FileStream& stream, U8* pImage, const U32 imageSize )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryReader_LoadCompressedBlocks);
+
+    TamlBinaryDecompressBlocks blocks;
+    blocks.mpImage = pImage;
+    blocks.mImageSize = imageSize;
+    blocks.mFailed = false;
+
+    // Read the block table.
+    U32 blockCount;
+    if ( !stream.read( &blocks.mBlockSize ) || !stream.read( &blockCount ) )
+        return false;
+
+    // Is the block table consistent with the image?
+    if ( blocks.mBlockSize == 0 || blockCount != (imageSize + blocks.mBlockSize - 1) / blocks.mBlockSize )
+    {
+        // No, so warn.
+        Con::warnf( "Taml: Cannot read binary file as its compressed block table is malformed." );
+        return false;
+    }
+
+    blocks.mBlockOffsets.setSize( blockCount );
+    blocks.mBlockSizes.setSize( blockCount );
+    U32 compressedSize = 0;
+    for( U32 index = 0; index < blockCount; ++index )
+    {
+        if ( !stream.read( &blocks.mBlockSizes[index] ) )
+            return false;
+
+        blocks.mBlockOffsets[index] = compressedSize;
+        compressedSize += blocks.mBlockSizes[index] & ~TamlBinaryWriter::StoredBlockFlag;
+    }
+
+    // Read all the compressed blocks.
+    U8* pCompressed = new U8[compressedSize];
+    if ( !stream.read( compressedSize, pCompressed ) )
+    {
+        delete [] pCompressed;
+        return false;
+    }
+
+    // Decompress the blocks in parallel.
+    blocks.mpCompressed = pCompressed;
+    ThreadPool::getGlobal()->parallelFor( decompressBlockRange, &blocks, blockCount, 1 );
+
+    delete [] pCompressed;
+
+    return !blocks.mFailed;
 }
 
 //-----------------------------------------------------------------------------
@@ -88,6 +338,772 @@ void TamlBinaryReader::resetParse( void )
 
     // Clear object reference map.
     mObjectReferenceMap.clear();
+
+    // Clear the schema.
+    mStrings.clear();
+    mSchemaClasses.clear();
+    mSchemaFields.clear();
+
+    // Clear the image.
+    mpImageStart = NULL;
+    mpImageCursor = NULL;
+    mpImageEnd = NULL;
+    mImageError = false;
+}
+
+//-----------------------------------------------------------------------------
+
+SimObject* TamlBinaryReader::readImage( FileStream& stream, const U32 versionId, const bool compressed, const U32 imageSize )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryReader_ReadImage);
+
+    // Load the image.
+    U8* pImage = loadImage( stream, versionId, compressed, imageSize );
+    if ( pImage == NULL )
+        return NULL;
+
+    // Reset the parse.
+    resetParse();
+
+    // Set the image.
+    mpImageStart = pImage;
+    mpImageCursor = pImage;
+    mpImageEnd = pImage + imageSize;
+
+    SimObject* pSimObject = NULL;
+
+    // Parse the schema and root element.
+    if ( parseImageSchema() )
+        pSimObject = parseImageElement();
+
+    // Warn if the image was malformed.
+    if ( mImageError )
+        Con::warnf( "Taml: Binary file is malformed." );
+
+    // Reset the parse.
+    resetParse();
+
+    delete [] pImage;
+
+    return pSimObject;
+}
+
+//-----------------------------------------------------------------------------
+
+bool TamlBinaryReader::parseImageSchema( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryReader_ParseImageSchema);
+
+    // Read the strings.
+    const U32 stringCount = readImageU32();
+    mStrings.reserve( stringCount );
+    for ( U32 index = 0; index < stringCount && !mImageError; ++index )
+    {
+        mStrings.push_back( StringTable->insert( readImageText() ) );
+    }
+
+    // Read the classes.
+    const U32 classCount = readImageU32();
+    mSchemaClasses.reserve( classCount );
+    for ( U32 classIndex = 0; classIndex < classCount && !mImageError; ++classIndex )
+    {
+        SchemaClass schemaClass;
+        schemaClass.mClassName = readImageString();
+        schemaClass.mpClassRep = AbstractClassRep::findClassRep( schemaClass.mClassName );
+        schemaClass.mFirstField = (U32)mSchemaFields.size();
+        schemaClass.mFieldCount = readImageU32();
+
+        // Resolve the class fields once for the whole file.
+        for ( U32 fieldIndex = 0; fieldIndex < schemaClass.mFieldCount && !mImageError; ++fieldIndex )
+        {
+            SchemaField schemaField;
+            schemaField.mName = readImageString();
+            schemaField.mpField = schemaClass.mpClassRep != NULL ? schemaClass.mpClassRep->findField( schemaField.mName ) : NULL;
+            schemaField.mEncoding = TamlBinaryWriter::getFieldEncoding( schemaField.mpField );
+            mSchemaFields.push_back( schemaField );
+        }
+
+        mSchemaClasses.push_back( schemaClass );
+    }
+
+    return !mImageError;
+}
+
+//-----------------------------------------------------------------------------
+
+SimObject* TamlBinaryReader::parseImageElement( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryReader_ParseImageElement);
+
+    // Fetch the schema class.
+    const U32 classId = readImageU32();
+    if ( mImageError || classId >= (U32)mSchemaClasses.size() )
+    {
+        mImageError = true;
+        return NULL;
+    }
+    const SchemaClass& schemaClass = mSchemaClasses[classId];
+    StringTableEntry typeName = schemaClass.mClassName;
+
+#ifdef TORQUE_DEBUG
+    // Format the type location.
+    char typeLocationBuffer[64];
+    dSprintf( typeLocationBuffer, sizeof(typeLocationBuffer), "Taml [format='binary' offset=%u]", (U32)(mpImageCursor - mpImageStart) );
+#endif
+
+    // Fetch object name.
+    StringTableEntry objectName = readImageString();
+
+    // Read references.
+    const U32 tamlRefId = readImageU32();
+    const U32 tamlRefToId = readImageU32();
+
+    // Finish if the image is malformed.
+    if ( mImageError )
+        return NULL;
+
+    // Do we have a reference to Id?
+    if ( tamlRefToId != 0 )
+    {
+        // Yes, so fetch reference.
+        typeObjectReferenceHash::iterator referenceItr = mObjectReferenceMap.find( tamlRefToId );
+
+        // Did we find the reference?
+        if ( referenceItr == mObjectReferenceMap.end() )
+        {
+            // No, so warn.
+            Con::warnf( "Taml: Could not find a reference Id of '%d'", tamlRefToId );
+            return NULL;
+        }
+
+        // Return object.
+        return referenceItr->value;
+    }
+
+#ifdef TORQUE_DEBUG
+    // Create type.
+    SimObject* pSimObject = Taml::createType( typeName, mpTaml, typeLocationBuffer );
+#else
+    // Create type.
+    SimObject* pSimObject = Taml::createType( typeName, mpTaml );
+#endif
+
+    // Finish if we couldn't create the type.
+    if ( pSimObject == NULL )
+        return NULL;
+
+    // Find Taml callbacks.
+    TamlCallbacks* pCallbacks = dynamic_cast<TamlCallbacks*>( pSimObject );
+
+    // Are there any Taml callbacks?
+    if ( pCallbacks != NULL )
+    {
+        // Yes, so call it.
+        mpTaml->tamlPreRead( pCallbacks );
+    }
+
+    // Parse attributes.
+    parseImageAttributes( pSimObject, schemaClass );
+
+    // Does the object require a name?
+    if ( objectName == StringTable->EmptyString )
+    {
+        // No, so just register anonymously.
+        pSimObject->registerObject();
+    }
+    else
+    {
+        // Yes, so register a named object.
+        pSimObject->registerObject( objectName );
+
+        // Was the name assigned?
+        if ( pSimObject->getName() != objectName )
+        {
+            // No, so warn that the name was rejected.
+#ifdef TORQUE_DEBUG
+            Con::warnf( "Taml::parseElement() - Registered an instance of type '%s' but a request to name it '%s' was rejected.  This is typically because an object of that name already exists.  '%s'", typeName, objectName, typeLocationBuffer );
+#else
+            Con::warnf( "Taml::parseElement() - Registered an instance of type '%s' but a request to name it '%s' was rejected.  This is typically because an object of that name already exists.", typeName, objectName );
+#endif
+        }
+    }
+
+    // Do we have a reference Id?
+    if ( tamlRefId != 0 )
+    {
+        // Yes, so insert reference.
+        mObjectReferenceMap.insert( tamlRefId, pSimObject );
+    }
+
+    // Parse custom elements.
+    TamlCustomNodes customProperties;
+
+    // Parse children.
+    parseImageChildren( pCallbacks, pSimObject );
+
+    // Parse custom elements.
+    parseImageCustomElements( pCallbacks, customProperties );
+
+    // Are there any Taml callbacks?
+    if ( pCallbacks != NULL )
+    {
+        // Yes, so call it.
+        mpTaml->tamlPostRead( pCallbacks, customProperties );
+    }
+
+    // Return object.
+    return pSimObject;
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryReader::parseImageAttributes( SimObject* pSimObject, const SchemaClass& schemaClass )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryReader_ParseImageAttributes);
+
+    // Sanity!
+    AssertFatal( pSimObject != NULL, "Taml: Cannot parse attributes on a NULL object." );
+
+    // Fetch attribute count.
+    const U32 attributeCount = readImageU32();
+
+    // Fields can only be stored directly if the object is exactly the schema class.
+    const bool directFields = pSimObject->getClassRep() == schemaClass.mpClassRep && pSimObject->isModStaticFields();
+
+    // Iterate attributes.
+    for ( U32 index = 0; index < attributeCount && !mImageError; ++index )
+    {
+        // Fetch the field slot and encoding.
+        const U32 fieldSlot = readImageU32();
+        const U8 encoding = readImageU8();
+
+        // Is the attribute valid?
+        if ( fieldSlot >= schemaClass.mFieldCount || encoding > TamlBinaryWriter::ColorIEncoding )
+        {
+            // No, so flag as malformed.
+            mImageError = true;
+            return;
+        }
+
+        // Fetch the schema field.
+        const SchemaField& schemaField = mSchemaFields[schemaClass.mFirstField + fieldSlot];
+
+        // Is the value text?
+        if ( encoding == TamlBinaryWriter::TextEncoding )
+        {
+            // Yes, so set the field in the usual way.
+            const char* pValue = readImageText();
+            if ( !mImageError )
+                pSimObject->setPrefixedDataField( schemaField.mName, NULL, pValue );
+
+            continue;
+        }
+
+        // Can the value be stored directly into the object?
+        if ( directFields && schemaField.mEncoding == encoding )
+        {
+            // Yes, so store it without any string conversion.
+            readImageTypedValue( (TamlBinaryWriter::FieldEncoding)encoding, ((U8*)pSimObject) + schemaField.mpField->offset );
+            pSimObject->onStaticModified( schemaField.mName );
+            continue;
+        }
+
+        // No, so read the value and set it as text.
+        F32 valueStorage[4];
+        readImageTypedValue( (TamlBinaryWriter::FieldEncoding)encoding, valueStorage );
+        if ( !mImageError )
+            pSimObject->setPrefixedDataField( schemaField.mName, NULL, Con::getData( TamlBinaryWriter::getEncodingType( (TamlBinaryWriter::FieldEncoding)encoding ), valueStorage, 0 ) );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryReader::parseImageChildren( TamlCallbacks* pCallbacks, SimObject* pSimObject )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryReader_ParseImageChildren);
+
+    // Sanity!
+    AssertFatal( pSimObject != NULL, "Taml: Cannot parse children on a NULL object." );
+
+    // Fetch children count.
+    const U32 childrenCount = readImageU32();
+
+    // Finish if no children.
+    if ( childrenCount == 0 || mImageError )
+        return;
+
+    // Fetch the Taml children.
+    TamlChildren* pChildren = dynamic_cast<TamlChildren*>( pSimObject );
+
+    // Is this a sim set?
+    if ( pChildren == NULL )
+    {
+        // No, so warn.
+        Con::warnf("Taml: Child element found under parent but object cannot have children." );
+        mImageError = true;
+        return;
+    }
+
+    // Fetch any container child class specifier.
+    AbstractClassRep* pContainerChildClass = pSimObject->getClassRep()->getContainerChildClass( true );
+
+    // Iterate children.
+    for ( U32 index = 0; index < childrenCount; ++ index )
+    {
+        // Parse child element.
+        SimObject* pChildSimObject = parseImageElement();
+
+        // Finish if child failed.
+        if ( pChildSimObject == NULL )
+        {
+            // The rest of the image cannot be located so stop parsing.
+            mImageError = true;
+            return;
+        }
+
+        // Do we have a container child class?
+        if ( pContainerChildClass != NULL )
+        {
+            // Yes, so is the child object the correctly derived type?
+            if ( !pChildSimObject->getClassRep()->isClass( pContainerChildClass ) )
+            {
+                // No, so warn.
+                Con::warnf("Taml: Child element '%s' found under parent '%s' but object is restricted to children of type '%s'.",
+                    pChildSimObject->getClassName(),
+                    pSimObject->getClassName(),
+                    pContainerChildClass->getClassName() );
+
+                // NOTE: We can't delete the object as it may be referenced elsewhere!
+                pChildSimObject = NULL;
+
+                // Skip.
+                continue;
+            }
+        }
+
+        // Add child.
+        pChildren->addTamlChild( pChildSimObject );
+
+        // Find Taml callbacks for child.
+        TamlCallbacks* pChildCallbacks = dynamic_cast<TamlCallbacks*>( pChildSimObject );
+
+        // Do we have callbacks on the child?
+        if ( pChildCallbacks != NULL )
+        {
+            // Yes, so perform callback.
+            mpTaml->tamlAddParent( pChildCallbacks, pSimObject );
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryReader::parseImageCustomElements( TamlCallbacks* pCallbacks, TamlCustomNodes& customNodes )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryReader_ParseImageCustomElements);
+
+    // Read custom node count.
+    const U32 customNodeCount = readImageU32();
+
+    // Finish if no custom nodes.
+    if ( customNodeCount == 0 || mImageError )
+        return;
+
+    // Iterate custom nodes.
+    for ( U32 nodeIndex = 0; nodeIndex < customNodeCount && !mImageError; ++nodeIndex )
+    {
+        // Read custom node name.
+        StringTableEntry nodeName = readImageString();
+
+        // Add custom node.
+        TamlCustomNode* pCustomNode = customNodes.addNode( nodeName );
+
+        // Parse the custom node children.
+        const U32 childNodeCount = readImageU32();
+        for ( U32 childIndex = 0; childIndex < childNodeCount && !mImageError; ++childIndex )
+        {
+            parseImageCustomNode( pCustomNode );
+        }
+    }
+
+    // Do we have callbacks?
+    if ( pCallbacks == NULL )
+    {
+        // No, so warn.
+        Con::warnf( "Taml: Encountered custom data but object does not support custom data." );
+        return;
+    }
+
+    // Custom read callback.
+    mpTaml->tamlCustomRead( pCallbacks, customNodes );
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryReader::parseImageCustomNode( TamlCustomNode* pCustomNode )
+{
+    // Is this a proxy object?
+    if ( readImageU8() != 0 )
+    {
+        // Yes, so parse proxy object.
+        SimObject* pProxyObject = parseImageElement();
+
+        // Add child node.
+        if ( pProxyObject != NULL )
+            pCustomNode->addNode( pProxyObject );
+
+        return;
+    }
+
+    // No, so read custom node name.
+    StringTableEntry nodeName = readImageString();
+
+    // Read child node text.
+    const char* pNodeText = readImageText();
+
+    // Finish if the image is malformed.
+    if ( mImageError )
+        return;
+
+    // Add child node.
+    TamlCustomNode* pChildNode = pCustomNode->addNode( nodeName );
+    pChildNode->setNodeText( pNodeText );
+
+    // Parse children nodes.
+    const U32 childNodeCount = readImageU32();
+    for( U32 childIndex = 0; childIndex < childNodeCount && !mImageError; ++childIndex )
+    {
+        parseImageCustomNode( pChildNode );
+    }
+
+    // Parse child fields.
+    const U32 childFieldCount = readImageU32();
+    for( U32 childFieldIndex = 0; childFieldIndex < childFieldCount && !mImageError; ++childFieldIndex )
+    {
+        // Read field name and value.
+        StringTableEntry fieldName = readImageString();
+        const char* pFieldValue = readImageText();
+
+        // Add field.
+        if ( !mImageError )
+            pChildNode->addField( fieldName, pFieldValue );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+bool TamlBinaryReader::visitImageElement( const TamlParser& parser, TamlVisitor& visitor, const bool isRoot )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryReader_VisitImageElement);
+
+    // Fetch the schema class.
+    const U32 classId = readImageU32();
+    if ( mImageError || classId >= (U32)mSchemaClasses.size() )
+    {
+        mImageError = true;
+        return false;
+    }
+    const SchemaClass& schemaClass = mSchemaClasses[classId];
+
+    // Skip the object name and reference Id.
+    readImageString();
+    readImageU32();
+
+    // Finish if this is a reference to another element as it has nothing else stored.
+    if ( readImageU32() != 0 || mImageError )
+        return !mImageError;
+
+    // Create a visitor property state.
+    TamlVisitor::PropertyState propertyState;
+    propertyState.setObjectName( schemaClass.mClassName, isRoot );
+
+    // Iterate attributes.
+    const U32 attributeCount = readImageU32();
+    for ( U32 index = 0; index < attributeCount && !mImageError; ++index )
+    {
+        // Fetch the field slot and encoding.
+        const U32 fieldSlot = readImageU32();
+        const U8 encoding = readImageU8();
+
+        // Is the attribute valid?
+        if ( fieldSlot >= schemaClass.mFieldCount || encoding > TamlBinaryWriter::ColorIEncoding )
+        {
+            // No, so flag as malformed.
+            mImageError = true;
+            return false;
+        }
+
+        const char* pValue;
+
+        // Is the value text?
+        if ( encoding == TamlBinaryWriter::TextEncoding )
+        {
+            // Yes, so use it as it is.
+            pValue = readImageText();
+        }
+        else
+        {
+            // No, so format it as text.
+            F32 valueStorage[4];
+            readImageTypedValue( (TamlBinaryWriter::FieldEncoding)encoding, valueStorage );
+            pValue = Con::getData( TamlBinaryWriter::getEncodingType( (TamlBinaryWriter::FieldEncoding)encoding ), valueStorage, 0 );
+        }
+
+        // Finish if the image is malformed.
+        if ( mImageError )
+            return false;
+
+        // Configure property state.
+        propertyState.setProperty( mSchemaFields[schemaClass.mFirstField + fieldSlot].mName, pValue );
+
+        // Visit this attribute (stop processing if instructed).
+        if ( !visitor.visit( parser, propertyState ) )
+            return false;
+    }
+
+    // Finish if only the root is needed.
+    if ( visitor.wantsRootOnly() )
+        return false;
+
+    // Visit children.
+    const U32 childrenCount = readImageU32();
+    for ( U32 index = 0; index < childrenCount && !mImageError; ++index )
+    {
+        if ( !visitImageElement( parser, visitor, false ) )
+            return false;
+    }
+
+    // Visit custom nodes.
+    const U32 customNodeCount = readImageU32();
+    for ( U32 nodeIndex = 0; nodeIndex < customNodeCount && !mImageError; ++nodeIndex )
+    {
+        // Skip the custom node name.
+        readImageString();
+
+        // Visit the custom node children.
+        const U32 childNodeCount = readImageU32();
+        for ( U32 childIndex = 0; childIndex < childNodeCount && !mImageError; ++childIndex )
+        {
+            if ( !visitImageCustomNode( parser, visitor ) )
+                return false;
+        }
+    }
+
+    return !mImageError;
+}
+
+//-----------------------------------------------------------------------------
+
+bool TamlBinaryReader::visitImageCustomNode( const TamlParser& parser, TamlVisitor& visitor )
+{
+    // Is this a proxy object?
+    if ( readImageU8() != 0 )
+    {
+        // Yes, so visit proxy object.
+        return visitImageElement( parser, visitor, false );
+    }
+
+    // No, so read custom node name and skip its text.
+    StringTableEntry nodeName = readImageString();
+    readImageText();
+
+    // Visit children nodes.
+    const U32 childNodeCount = readImageU32();
+    for( U32 childIndex = 0; childIndex < childNodeCount && !mImageError; ++childIndex )
+    {
+        if ( !visitImageCustomNode( parser, visitor ) )
+            return false;
+    }
+
+    // Create a visitor property state.
+    TamlVisitor::PropertyState propertyState;
+    propertyState.setObjectName( nodeName, false );
+
+    // Visit child fields.
+    const U32 childFieldCount = readImageU32();
+    for( U32 childFieldIndex = 0; childFieldIndex < childFieldCount && !mImageError; ++childFieldIndex )
+    {
+        // Read field name and value.
+        StringTableEntry fieldName = readImageString();
+        const char* pFieldValue = readImageText();
+
+        // Finish if the image is malformed.
+        if ( mImageError )
+            return false;
+
+        // Configure property state.
+        propertyState.setProperty( fieldName, pFieldValue );
+
+        // Visit this field (stop processing if instructed).
+        if ( !visitor.visit( parser, propertyState ) )
+            return false;
+    }
+
+    return !mImageError;
+}
+
+//-----------------------------------------------------------------------------
+
+const void* TamlBinaryReader::readImageBytes( const U32 size )
+{
+    // Flag as malformed if there's not enough data left.
+    if ( mImageError || (U32)(mpImageEnd - mpImageCursor) < size )
+    {
+        mImageError = true;
+        return NULL;
+    }
+
+    // Consume the bytes.
+    const U8* pBytes = mpImageCursor;
+    mpImageCursor += size;
+    return pBytes;
+}
+
+//-----------------------------------------------------------------------------
+
+U8 TamlBinaryReader::readImageU8( void )
+{
+    const U8* pBytes = (const U8*)readImageBytes( sizeof(U8) );
+    return pBytes == NULL ? 0 : *pBytes;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 TamlBinaryReader::readImageU32( void )
+{
+    const void* pBytes = readImageBytes( sizeof(U32) );
+    if ( pBytes == NULL )
+        return 0;
+
+    // The image is not aligned.
+    U32 value;
+    dMemcpy( &value, pBytes, sizeof(value) );
+    return convertLEndianToHost( value );
+}
+
+//-----------------------------------------------------------------------------
+
+F32 TamlBinaryReader::readImageF32( void )
+{
+    const void* pBytes = readImageBytes( sizeof(F32) );
+    if ( pBytes == NULL )
+        return 0.0f;
+
+    // The image is not aligned.
+    F32 value;
+    dMemcpy( &value, pBytes, sizeof(value) );
+    return convertLEndianToHost( value );
+}
+
+//-----------------------------------------------------------------------------
+
+const char* TamlBinaryReader::readImageText( void )
+{
+    // Fetch the text length.
+    const U32 length = readImageU32();
+
+    // Fetch the text (including its terminator).
+    const char* pText = (const char*)readImageBytes( length + 1 );
+
+    // Check the text is terminated.
+    if ( pText == NULL || pText[length] != 0 )
+    {
+        mImageError = true;
+        return StringTable->EmptyString;
+    }
+
+    return pText;
+}
+
+//-----------------------------------------------------------------------------
+
+StringTableEntry TamlBinaryReader::readImageString( void )
+{
+    // Fetch the string Id.
+    const U32 stringId = readImageU32();
+
+    // Is the string Id valid?
+    if ( stringId >= (U32)mStrings.size() )
+    {
+        mImageError = true;
+        return StringTable->EmptyString;
+    }
+
+    return mStrings[stringId];
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryReader::readImageTypedValue( const TamlBinaryWriter::FieldEncoding encoding, void* pData )
+{
+    switch( encoding )
+    {
+        case TamlBinaryWriter::S32Encoding:
+            *(S32*)pData = (S32)readImageU32();
+            break;
+
+        case TamlBinaryWriter::F32Encoding:
+            *(F32*)pData = readImageF32();
+            break;
+
+        case TamlBinaryWriter::BoolEncoding:
+            *(bool*)pData = readImageU8() != 0;
+            break;
+
+        case TamlBinaryWriter::Vector2Encoding:
+        {
+            Vector2* pVector = (Vector2*)pData;
+            pVector->x = readImageF32();
+            pVector->y = readImageF32();
+            break;
+        }
+
+        case TamlBinaryWriter::Point2IEncoding:
+        {
+            Point2I* pPoint = (Point2I*)pData;
+            pPoint->x = (S32)readImageU32();
+            pPoint->y = (S32)readImageU32();
+            break;
+        }
+
+        case TamlBinaryWriter::Point2FEncoding:
+        {
+            Point2F* pPoint = (Point2F*)pData;
+            pPoint->x = readImageF32();
+            pPoint->y = readImageF32();
+            break;
+        }
+
+        case TamlBinaryWriter::ColorFEncoding:
+        {
+            ColorF* pColor = (ColorF*)pData;
+            pColor->red = readImageF32();
+            pColor->green = readImageF32();
+            pColor->blue = readImageF32();
+            pColor->alpha = readImageF32();
+            break;
+        }
+
+        case TamlBinaryWriter::ColorIEncoding:
+        {
+            ColorI* pColor = (ColorI*)pData;
+            pColor->red = readImageU8();
+            pColor->green = readImageU8();
+            pColor->blue = readImageU8();
+            pColor->alpha = readImageU8();
+            break;
+        }
+
+        default:
+            mImageError = true;
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -31,6 +31,18 @@
 #include "persistence/taml/taml.h"
 #endif
 
+#ifndef _TAML_BINARYWRITER_H_
+#include "persistence/taml/binary/tamlBinaryWriter.h"
+#endif
+
+#ifndef _TAML_PARSER_H_
+#include "persistence/taml/tamlParser.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class TamlVisitor;
+
 //-----------------------------------------------------------------------------
 
 /// @ingroup tamlGroup
@@ -39,7 +51,11 @@ class TamlBinaryReader
 {
 public:
     TamlBinaryReader( Taml* pTaml ) :
-        mpTaml( pTaml )
+        mpTaml( pTaml ),
+        mpImageStart( NULL ),
+        mpImageCursor( NULL ),
+        mpImageEnd( NULL ),
+        mImageError( false )
     {
     }
 
@@ -48,6 +64,10 @@ public:
     /// Read.
     SimObject* read( FileStream& stream );
 
+    /// Visit the properties in the stream without creating any objects.
+    /// Only files with a schema (version 3 onwards) can be visited.
+    bool accept( FileStream& stream, const TamlParser& parser, TamlVisitor& visitor );
+
 private:
     Taml* mpTaml;
 
@@ -55,8 +75,55 @@ private:
 
     typeObjectReferenceHash mObjectReferenceMap;
 
+    /// A field in the file schema resolved against its class.
+    struct SchemaField
+    {
+        StringTableEntry mName;
+        const AbstractClassRep::Field* mpField;
+        TamlBinaryWriter::FieldEncoding mEncoding;
+    };
+
+    /// A class in the file schema.
+    struct SchemaClass
+    {
+        StringTableEntry mClassName;
+        AbstractClassRep* mpClassRep;
+        U32 mFirstField;
+        U32 mFieldCount;
+    };
+
+    Vector<StringTableEntry> mStrings;
+    Vector<SchemaClass> mSchemaClasses;
+    Vector<SchemaField> mSchemaFields;
+
+    const U8* mpImageStart;
+    const U8* mpImageCursor;
+    const U8* mpImageEnd;
+    bool mImageError;
+
 private:
     void resetParse( void );
+    bool readHeader( FileStream& stream, U32& versionId, bool& compressed );
+    U8* loadImage( FileStream& stream, const U32 versionId, const bool compressed, const U32 imageSize );
+    bool loadCompressedBlocks( FileStream& stream, U8* pImage, const U32 imageSize );
+
+    SimObject* readImage( FileStream& stream, const U32 versionId, const bool compressed, const U32 imageSize );
+    bool parseImageSchema( void );
+    SimObject* parseImageElement( void );
+    void parseImageAttributes( SimObject* pSimObject, const SchemaClass& schemaClass );
+    void parseImageChildren( TamlCallbacks* pCallbacks, SimObject* pSimObject );
+    void parseImageCustomElements( TamlCallbacks* pCallbacks, TamlCustomNodes& customNodes );
+    void parseImageCustomNode( TamlCustomNode* pCustomNode );
+    bool visitImageElement( const TamlParser& parser, TamlVisitor& visitor, const bool isRoot );
+    bool visitImageCustomNode( const TamlParser& parser, TamlVisitor& visitor );
+
+    const void* readImageBytes( const U32 size );
+    U8 readImageU8( void );
+    U32 readImageU32( void );
+    F32 readImageF32( void );
+    const char* readImageText( void );
+    StringTableEntry readImageString( void );
+    void readImageTypedValue( const TamlBinaryWriter::FieldEncoding encoding, void* pData );
 
     SimObject* parseElement( Stream& stream, const U32 versionId );
     void parseAttributes( Stream& stream, SimObject* pSimObject, const U32 versionId );
@@ -22,19 +22,133 @@
 
 #include "persistence/taml/binary/tamlBinaryWriter.h"
 
-#ifndef _ZIPSUBSTREAM_H_
-#include "io/zip/zipSubStream.h"
+#ifndef _THREADPOOL_H_
+#include "platform/threads/threadPool.h"
+#endif
+
+#ifndef _CONSOLETYPES_H_
+#include "console/consoleTypes.h"
+#endif
+
+#ifndef _VECTOR2_H_
+#include "2d/core/Vector2.h"
+#endif
+
+#ifndef _MATHTYPES_H_
+#include "math/mathTypes.h"
+#endif
+
+#ifndef _COLOR_H_
+#include "graphics/color.h"
 #endif
 
 // Debug Profiling.
 #include "debug/profiler.h"
 
+#include "zlib.h"
+
+//-----------------------------------------------------------------------------
+
+/// A growable memory stream the body is written to before it is compressed into blocks.
+class TamlBinaryImageStream : public Stream
+{
+public:
+    TamlBinaryImageStream() : mPosition( 0 ) { setStatus( Ok ); }
+
+    virtual bool hasCapability( const Capability capability ) const { return true; }
+    virtual U32 getPosition() const { return mPosition; }
+    virtual bool setPosition( const U32 position ) { if ( position > (U32)mImage.size() ) return false; mPosition = position; return true; }
+    virtual U32 getStreamSize() { return (U32)mImage.size(); }
+
+    inline const U8* getImage( void ) const { return mImage.address(); }
+    inline U32 getImageSize( void ) const { return (U32)mImage.size(); }
+
+protected:
+    virtual bool _read( const U32 size, void* pBuffer ) { return false; }
+
+    virtual bool _write( const U32 size, const void* pBuffer )
+    {
+        if ( mPosition + size > (U32)mImage.size() )
+        {
+            // Grow geometrically to avoid reallocating for every write.
+            if ( mPosition + size > (U32)mImage.capacity() )
+                mImage.reserve( getMax( mPosition + size, (U32)mImage.capacity() * 2 ) );
+
+            mImage.setSize( mPosition + size );
+        }
+
+        dMemcpy( mImage.address() + mPosition, pBuffer, size );
+        mPosition += size;
+        return true;
+    }
+
+private:
+    Vector<U8> mImage;
+    U32 mPosition;
+};
+
+//-----------------------------------------------------------------------------
+
+/// The blocks of an image being compressed in parallel.
+struct TamlBinaryCompressBlocks
+{
+    const U8* mpImage;
+    U32 mImageSize;
+    Vector<U8*> mBlocks;
+    Vector<U32> mBlockSizes;
+};
+
+//-----------------------------------------------------------------------------
+
+static void compressBlockRange( void* pContext, const U32 start, const U32 end )
+{
+    TamlBinaryCompressBlocks* pBlocks = static_cast<TamlBinaryCompressBlocks*>( pContext );
+
+    for( U32 index = start; index < end; ++index )
+    {
+        // Fetch the uncompressed block.
+        const U32 offset = index * TamlBinaryWriter::CompressionBlockSize;
+        const U32 size = getMin( pBlocks->mImageSize - offset, (U32)TamlBinaryWriter::CompressionBlockSize );
+        const U8* pSource = pBlocks->mpImage + offset;
+
+        // Compress the block.
+        uLongf compressedSize = compressBound( size );
+        U8* pBlock = new U8[compressedSize];
+        if ( compress2( pBlock, &compressedSize, pSource, size, Z_DEFAULT_COMPRESSION ) != Z_OK || compressedSize >= size )
+        {
+            // Store the block if it couldn't be compressed.
+            dMemcpy( pBlock, pSource, size );
+            compressedSize = size | TamlBinaryWriter::StoredBlockFlag;
+        }
+
+        pBlocks->mBlocks[index] = pBlock;
+        pBlocks->mBlockSizes[index] = (U32)compressedSize;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TamlBinaryWriter::~TamlBinaryWriter()
+{
+    // Reset the schema.
+    resetSchema();
+}
+
 //-----------------------------------------------------------------------------
 
 bool TamlBinaryWriter::write( FileStream& stream, const TamlWriteNode* pTamlWriteNode, const bool compressed )
 {
     // Debug Profiling.
     PROFILE_SCOPE(TamlBinaryWriter_Write);
+
+    // Reset the schema.
+    resetSchema();
+
+    // The empty string is always the first string.
+    addString( StringTable->EmptyString );
+
+    // Compile the schema.
+    compileSchema( pTamlWriteNode );
  
     // Write Taml signature.
     stream.writeString( StringTable->insert( TAML_SIGNATURE ) );
@@ -45,26 +159,381 @@ bool TamlBinaryWriter::write( FileStream& stream, const TamlWriteNode* pTamlWrit
     // Write compressed flag.
     stream.write( compressed );
 
+    // Write a placeholder body size.
+    const U32 bodySizePosition = stream.getPosition();
+    stream.write( (U32)0 );
+
+    U32 bodySize;
+
     // Are we compressed?
     if ( compressed )
     {
-        // yes, so attach zip stream.
-        ZipSubWStream zipStream;
-        zipStream.attachStream( &stream );
+        // Yes, so write schema and element into an image.
+        TamlBinaryImageStream imageStream;
+        writeSchema( imageStream );
+        writeElement( imageStream, pTamlWriteNode );
 
-        // Write element.
-        writeElement( zipStream, pTamlWriteNode );
+        // Fetch the uncompressed body size.
+        bodySize = imageStream.getImageSize();
 
-        // Detach zip stream.
-        zipStream.detachStream();
+        // Write the image as compressed blocks.
+        writeCompressedBlocks( stream, imageStream.getImage(), bodySize );
     }
     else
     {
-        // No, so write element.
+        // No, so write schema and element.
+        const U32 bodyPosition = stream.getPosition();
+        writeSchema( stream );
         writeElement( stream, pTamlWriteNode );
+
+        // Fetch the body size.
+        bodySize = stream.getPosition() - bodyPosition;
+    }
+
+    // Write the body size.
+    const U32 endPosition = stream.getPosition();
+    stream.setPosition( bodySizePosition );
+    stream.write( bodySize );
+    stream.setPosition( endPosition );
+
+    // Reset the schema.
+    resetSchema();
+
+    return stream.getStatus() == Stream::Ok;
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryWriter::writeCompressedBlocks( Stream& stream, const U8* pImage, const U32 imageSize )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryWriter_WriteCompressedBlocks);
+
+    // Compress the blocks in parallel.
+    TamlBinaryCompressBlocks blocks;
+    blocks.mpImage = pImage;
+    blocks.mImageSize = imageSize;
+    const U32 blockCount = (imageSize + CompressionBlockSize - 1) / CompressionBlockSize;
+    blocks.mBlocks.setSize( blockCount );
+    blocks.mBlockSizes.setSize( blockCount );
+    ThreadPool::getGlobal()->parallelFor( compressBlockRange, &blocks, blockCount, 1 );
+
+    // Write the block table.
+    stream.write( (U32)CompressionBlockSize );
+    stream.write( blockCount );
+    for( U32 index = 0; index < blockCount; ++index )
+    {
+        stream.write( blocks.mBlockSizes[index] );
+    }
+
+    // Write the blocks.
+    for( U32 index = 0; index < blockCount; ++index )
+    {
+        stream.write( blocks.mBlockSizes[index] & ~StoredBlockFlag, blocks.mBlocks[index] );
+        delete [] blocks.mBlocks[index];
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TamlBinaryWriter::FieldEncoding TamlBinaryWriter::getFieldEncoding( const AbstractClassRep::Field* pField )
+{
+    // Only single element fields that are set and fetched directly can use a native encoding.
+    if ( pField == NULL ||
+        pField->elementCount != 1 ||
+        pField->table != NULL ||
+        pField->validator != NULL ||
+        pField->setDataFn != &defaultProtectedSetFn ||
+        pField->getDataFn != &defaultProtectedGetFn )
+        return TextEncoding;
+
+    // Fetch the field type.
+    const S32 fieldType = (S32)pField->type;
+
+    if ( fieldType == TypeS32 )
+        return S32Encoding;
+
+    if ( fieldType == TypeF32 )
+        return F32Encoding;
+
+    if ( fieldType == TypeBool )
+        return BoolEncoding;
+
+    if ( fieldType == TypeVector2 )
+        return Vector2Encoding;
+
+    if ( fieldType == TypePoint2I )
+        return Point2IEncoding;
+
+    if ( fieldType == TypePoint2F )
+        return Point2FEncoding;
+
+    if ( fieldType == TypeColorF )
+        return ColorFEncoding;
+
+    if ( fieldType == TypeColorI )
+        return ColorIEncoding;
+
+    return TextEncoding;
+}
+
+//-----------------------------------------------------------------------------
+
+S32 TamlBinaryWriter::getEncodingType( const FieldEncoding encoding )
+{
+    switch( encoding )
+    {
+        case S32Encoding:       return TypeS32;
+        case F32Encoding:       return TypeF32;
+        case BoolEncoding:      return TypeBool;
+        case Vector2Encoding:   return TypeVector2;
+        case Point2IEncoding:   return TypePoint2I;
+        case Point2FEncoding:   return TypePoint2F;
+        case ColorFEncoding:    return TypeColorF;
+        case ColorIEncoding:    return TypeColorI;
+
+        default:
+            return -1;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryWriter::resetSchema( void )
+{
+    // Delete the schema classes.
+    for( Vector<SchemaClass*>::iterator itr = mSchemaClasses.begin(); itr != mSchemaClasses.end(); ++itr )
+    {
+        delete (*itr);
     }
 
-    return true;
+    mSchemaClasses.clear();
+    mSchemaClassMap.clear();
+    mStrings.clear();
+    mStringIds.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+U32 TamlBinaryWriter::addString( StringTableEntry string )
+{
+    // Use the existing Id if the string is already in the dictionary.
+    typeStringIdHash::iterator stringItr = mStringIds.find( string );
+    if ( stringItr != mStringIds.end() )
+        return stringItr->value;
+
+    // Add the string.
+    const U32 stringId = (U32)mStrings.size();
+    mStrings.push_back( string );
+    mStringIds.insert( string, stringId );
+
+    return stringId;
+}
+
+//-----------------------------------------------------------------------------
+
+TamlBinaryWriter::SchemaClass* TamlBinaryWriter::addSchemaClass( StringTableEntry className )
+{
+    // Use the existing class if it is already in the schema.
+    typeSchemaClassHash::iterator classItr = mSchemaClassMap.find( className );
+    if ( classItr != mSchemaClassMap.end() )
+        return classItr->value;
+
+    // Add the class.
+    SchemaClass* pSchemaClass = new SchemaClass();
+    pSchemaClass->mClassId = (U32)mSchemaClasses.size();
+    pSchemaClass->mNameId = addString( className );
+    mSchemaClasses.push_back( pSchemaClass );
+    mSchemaClassMap.insert( className, pSchemaClass );
+
+    return pSchemaClass;
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryWriter::compileSchema( const TamlWriteNode* pTamlWriteNode )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryWriter_CompileSchema);
+
+    // Add the class.
+    SchemaClass* pSchemaClass = addSchemaClass( StringTable->insert( pTamlWriteNode->mpSimObject->getClassName() ) );
+
+    // Add the object name.
+    if ( pTamlWriteNode->mpObjectName != NULL )
+        addString( StringTable->insert( pTamlWriteNode->mpObjectName ) );
+
+    // Finish if this is a reference to another node.
+    if ( pTamlWriteNode->mRefToNode != NULL )
+        return;
+
+    // Add the fields.
+    const Vector<TamlWriteNode::FieldValuePair*>& fields = pTamlWriteNode->mFields;
+    for( Vector<TamlWriteNode::FieldValuePair*>::const_iterator itr = fields.begin(); itr != fields.end(); ++itr )
+    {
+        StringTableEntry fieldName = (*itr)->mName;
+
+        if ( pSchemaClass->mFieldSlots.find( fieldName ) != pSchemaClass->mFieldSlots.end() )
+            continue;
+
+        pSchemaClass->mFieldSlots.insert( fieldName, (U32)pSchemaClass->mFields.size() );
+        pSchemaClass->mFields.push_back( fieldName );
+        addString( fieldName );
+    }
+
+    // Add the children.
+    Vector<TamlWriteNode*>* pChildren = pTamlWriteNode->mChildren;
+    if ( pChildren != NULL )
+    {
+        for( Vector<TamlWriteNode*>::iterator itr = pChildren->begin(); itr != pChildren->end(); ++itr )
+        {
+            compileSchema( (*itr) );
+        }
+    }
+
+    // Add the custom nodes.
+    const TamlCustomNodeVector& nodes = pTamlWriteNode->mCustomNodes.getNodes();
+    for( TamlCustomNodeVector::const_iterator itr = nodes.begin(); itr != nodes.end(); ++itr )
+    {
+        compileSchemaCustomNode( *itr );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryWriter::compileSchemaCustomNode( const TamlCustomNode* pCustomNode )
+{
+    // Is the node a proxy object?
+    if ( pCustomNode->isProxyObject() )
+    {
+        // Yes, so add the proxy element.
+        compileSchema( pCustomNode->getProxyWriteNode() );
+        return;
+    }
+
+    // Add the node name.
+    addString( pCustomNode->getNodeName() );
+
+    // Add the children.
+    const TamlCustomNodeVector& nodeChildren = pCustomNode->getChildren();
+    for( TamlCustomNodeVector::const_iterator itr = nodeChildren.begin(); itr != nodeChildren.end(); ++itr )
+    {
+        compileSchemaCustomNode( *itr );
+    }
+
+    // Add the field names.
+    const TamlCustomFieldVector& fields = pCustomNode->getFields();
+    for ( TamlCustomFieldVector::const_iterator itr = fields.begin(); itr != fields.end(); ++itr )
+    {
+        addString( (*itr)->getFieldName() );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryWriter::writeSchema( Stream& stream )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryWriter_WriteSchema);
+
+    // Write the strings.
+    stream.write( (U32)mStrings.size() );
+    for( Vector<StringTableEntry>::iterator itr = mStrings.begin(); itr != mStrings.end(); ++itr )
+    {
+        writeText( stream, *itr );
+    }
+
+    // Write the classes.
+    stream.write( (U32)mSchemaClasses.size() );
+    for( Vector<SchemaClass*>::iterator itr = mSchemaClasses.begin(); itr != mSchemaClasses.end(); ++itr )
+    {
+        SchemaClass* pSchemaClass = *itr;
+
+        stream.write( pSchemaClass->mNameId );
+        stream.write( (U32)pSchemaClass->mFields.size() );
+
+        for( Vector<StringTableEntry>::iterator fieldItr = pSchemaClass->mFields.begin(); fieldItr != pSchemaClass->mFields.end(); ++fieldItr )
+        {
+            stream.write( addString( *fieldItr ) );
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryWriter::writeText( Stream& stream, const char* pText )
+{
+    // Write the length and the text including its terminator so it can be used in place when read.
+    const U32 length = dStrlen( pText );
+    stream.write( length );
+    stream.write( length + 1, pText );
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryWriter::writeTypedValue( Stream& stream, const FieldEncoding encoding, const void* pData )
+{
+    switch( encoding )
+    {
+        case S32Encoding:
+            stream.write( *(const S32*)pData );
+            break;
+
+        case F32Encoding:
+            stream.write( *(const F32*)pData );
+            break;
+
+        case BoolEncoding:
+            stream.write( (U8)(*(const bool*)pData ? 1 : 0) );
+            break;
+
+        case Vector2Encoding:
+        {
+            const Vector2* pVector = (const Vector2*)pData;
+            stream.write( pVector->x );
+            stream.write( pVector->y );
+            break;
+        }
+
+        case Point2IEncoding:
+        {
+            const Point2I* pPoint = (const Point2I*)pData;
+            stream.write( pPoint->x );
+            stream.write( pPoint->y );
+            break;
+        }
+
+        case Point2FEncoding:
+        {
+            const Point2F* pPoint = (const Point2F*)pData;
+            stream.write( pPoint->x );
+            stream.write( pPoint->y );
+            break;
+        }
+
+        case ColorFEncoding:
+        {
+            const ColorF* pColor = (const ColorF*)pData;
+            stream.write( pColor->red );
+            stream.write( pColor->green );
+            stream.write( pColor->blue );
+            stream.write( pColor->alpha );
+            break;
+        }
+
+        case ColorIEncoding:
+        {
+            const ColorI* pColor = (const ColorI*)pData;
+            stream.write( pColor->red );
+            stream.write( pColor->green );
+            stream.write( pColor->blue );
+            stream.write( pColor->alpha );
+            break;
+        }
+
+        default:
+            AssertFatal( false, "Taml: Invalid field encoding." );
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -77,17 +546,17 @@ void TamlBinaryWriter::writeElement( Stream& stream, const TamlWriteNode* pTamlW
     // Fetch object.
     SimObject* pSimObject = pTamlWriteNode->mpSimObject;
 
-    // Fetch element name.
-    const char* pElementName = pSimObject->getClassName();
+    // Fetch the schema class.
+    SchemaClass* pSchemaClass = addSchemaClass( StringTable->insert( pSimObject->getClassName() ) );
 
-    // Write element name.
-    stream.writeString( pElementName );
+    // Write the class Id.
+    stream.write( pSchemaClass->mClassId );
 
     // Fetch object name.
     const char* pObjectName = pTamlWriteNode->mpObjectName;
 
-    // Write object name.
-    stream.writeString( pObjectName != NULL ? pObjectName : StringTable->EmptyString );
+    // Write object name Id.
+    stream.write( addString( pObjectName != NULL ? StringTable->insert( pObjectName ) : StringTable->EmptyString ) );
 
     // Fetch reference Id.
     const U32 tamlRefId = pTamlWriteNode->mRefId;
@@ -112,10 +581,10 @@ void TamlBinaryWriter::writeElement( Stream& stream, const TamlWriteNode* pTamlW
     }
 
     // No, so write no reference to Id.
-    stream.write( 0 );
+    stream.write( (U32)0 );
 
     // Write attributes.
-    writeAttributes( stream, pTamlWriteNode );
+    writeAttributes( stream, pTamlWriteNode, pSchemaClass );
 
     // Write children.
     writeChildren( stream, pTamlWriteNode );
@@ -126,7 +595,7 @@ void TamlBinaryWriter::writeElement( Stream& stream, const TamlWriteNode* pTamlW
 
 //-----------------------------------------------------------------------------
 
-void TamlBinaryWriter::writeAttributes( Stream& stream, const TamlWriteNode* pTamlWriteNode )
+void TamlBinaryWriter::writeAttributes( Stream& stream, const TamlWriteNode* pTamlWriteNode, SchemaClass* pSchemaClass )
 {
     // Debug Profiling.
     PROFILE_SCOPE(TamlBinaryWriter_WriteAttributes);
@@ -134,25 +603,45 @@ void TamlBinaryWriter::writeAttributes( Stream& stream, const TamlWriteNode* pTa
     // Fetch fields.
     const Vector<TamlWriteNode::FieldValuePair*>& fields = pTamlWriteNode->mFields;
 
-    // Write placeholder attribute count.
+    // Write attribute count.
     stream.write( (U32)fields.size() );
 
     // Finish if no fields.
     if ( fields.size() == 0 )
         return;
 
+    // Fetch the object data.
+    const U8* pObjectData = (const U8*)pTamlWriteNode->mpSimObject;
+
     // Iterate fields.
     for( Vector<TamlWriteNode::FieldValuePair*>::const_iterator itr = fields.begin(); itr != fields.end(); ++itr )
     {
         // Fetch field/value pair.
         TamlWriteNode::FieldValuePair* pFieldValue = (*itr);
 
-        // Write attribute.
-        stream.writeString( pFieldValue->mName );
-        stream.writeLongString( 4096, pFieldValue->mpValue );
+        // Fetch the field slot.
+        typeStringIdHash::iterator slotItr = pSchemaClass->mFieldSlots.find( pFieldValue->mName );
+
+        // Sanity!
+        AssertFatal( slotItr != pSchemaClass->mFieldSlots.end(), "Taml: Field was not compiled into the schema." );
+
+        // Fetch the field encoding.
+        const FieldEncoding encoding = getFieldEncoding( pFieldValue->mpField );
+
+        // Write the field slot and encoding.
+        stream.write( slotItr->value );
+        stream.write( (U8)encoding );
+
+        // Write the value.
+        if ( encoding == TextEncoding )
+            writeText( stream, pFieldValue->mpValue );
+        else
+            writeTypedValue( stream, encoding, pObjectData + pFieldValue->mpField->offset );
     }
 }
 
+//-----------------------------------------------------------------------------
+
 void TamlBinaryWriter::writeChildren( Stream& stream, const TamlWriteNode* pTamlWriteNode )
 {
     // Debug Profiling.
@@ -206,12 +695,15 @@ void TamlBinaryWriter::writeCustomElements( Stream& stream, const TamlWriteNode*
         // Fetch the custom node.
         TamlCustomNode* pCustomNode = *customNodesItr;
 
-        // Write custom node name.
-        stream.writeString( pCustomNode->getNodeName() );
+        // Write custom node name Id.
+        stream.write( addString( pCustomNode->getNodeName() ) );
 
         // Fetch node children.
         const TamlCustomNodeVector& nodeChildren = pCustomNode->getChildren();
 
+        // Write child node count.
+        stream.write( (U32)nodeChildren.size() );
+
         // Iterate children nodes.
         for( TamlCustomNodeVector::const_iterator childNodeItr = nodeChildren.begin(); childNodeItr != nodeChildren.end(); ++childNodeItr )
         {
@@ -242,11 +734,11 @@ void TamlBinaryWriter::writeCustomNode( Stream& stream, const TamlCustomNode* pC
     // No, so flag as custom node.
     stream.write( false );
 
-    // Write custom node name.
-    stream.writeString( pCustomNode->getNodeName() );
+    // Write custom node name Id.
+    stream.write( addString( pCustomNode->getNodeName() ) );
 
     // Write custom node text.
-    stream.writeLongString(MAX_TAML_NODE_FIELDVALUE_LENGTH, pCustomNode->getNodeTextField().getFieldValue());
+    writeText( stream, pCustomNode->getNodeTextField().getFieldValue() );
 
     // Fetch node children.
     const TamlCustomNodeVector& nodeChildren = pCustomNode->getChildren();
@@ -290,8 +782,8 @@ void TamlBinaryWriter::writeCustomNode( Stream& stream, const TamlCustomNode* pC
             const TamlCustomField* pField = *fieldItr;
 
             // Write the node field.
-            stream.writeString( pField->getFieldName() );
-            stream.writeLongString( MAX_TAML_NODE_FIELDVALUE_LENGTH, pField->getFieldValue() );
+            stream.write( addString( pField->getFieldName() ) );
+            writeText( stream, pField->getFieldValue() );
         }
     }
-}
\ No newline at end of file
+}
@@ -27,30 +27,107 @@
 #include "persistence/taml/taml.h"
 #endif
 
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
+/// Binary Taml files from version 3 start with a per-file string dictionary and
+/// a schema listing each class along with the fields written for it.  Elements then
+/// refer to classes and fields by their schema index rather than by name.
+///
+/// Static fields of simple types (S32, F32, bool, vectors, points and colors) that have
+/// no custom setter, getter or validator are written in their native binary encoding so
+/// the reader can store them straight into the object without any string conversion.
+/// All other fields are written as text.
+///
+/// The body is preceded by its (uncompressed) size so that the reader can load it
+/// into a single memory image and parse it in place.
+///
+/// From version 4, a compressed body is split into blocks of CompressionBlockSize bytes
+/// that are each compressed independently.  A table of the compressed block sizes precedes
+/// the blocks so they can be decompressed in parallel, or individually by readers that
+/// only need part of the image.
+///
 /// @ingroup tamlGroup
 /// @see tamlGroup
 class TamlBinaryWriter
 {
+public:
+    /// Field value encodings.
+    enum FieldEncoding
+    {
+        TextEncoding,
+        S32Encoding,
+        F32Encoding,
+        BoolEncoding,
+        Vector2Encoding,
+        Point2IEncoding,
+        Point2FEncoding,
+        ColorFEncoding,
+        ColorIEncoding
+    };
+
+    enum
+    {
+        /// The uncompressed size of each compressed block (other than the last).
+        CompressionBlockSize = 256 * 1024,
+
+        /// Flags a block in the block table as stored without compression.
+        StoredBlockFlag = 0x80000000
+    };
+
 public:
     TamlBinaryWriter( Taml* pTaml ) :
         mpTaml( pTaml ),
-        mVersionId(2)
+        mVersionId(4)
     {
     }
-    virtual ~TamlBinaryWriter() {}
+    virtual ~TamlBinaryWriter();
 
     /// Write.
     bool write( FileStream& stream, const TamlWriteNode* pTamlWriteNode, const bool compressed );
 
+    /// Get the native encoding used for a static field or TextEncoding if it must be written as text.
+    static FieldEncoding getFieldEncoding( const AbstractClassRep::Field* pField );
+
+    /// Get the console type of a native field encoding.
+    static S32 getEncodingType( const FieldEncoding encoding );
+
 private:
+    struct SchemaClass
+    {
+        U32 mClassId;
+        U32 mNameId;
+        Vector<StringTableEntry> mFields;
+        HashMap<StringTableEntry, U32> mFieldSlots;
+    };
+
+    typedef HashMap<StringTableEntry, U32> typeStringIdHash;
+    typedef HashMap<StringTableEntry, SchemaClass*> typeSchemaClassHash;
+
     Taml* mpTaml;
     const U32 mVersionId;
 
+    Vector<StringTableEntry> mStrings;
+    typeStringIdHash mStringIds;
+    Vector<SchemaClass*> mSchemaClasses;
+    typeSchemaClassHash mSchemaClassMap;
+
 private:
+    void resetSchema( void );
+    U32 addString( StringTableEntry string );
+    SchemaClass* addSchemaClass( StringTableEntry className );
+    void compileSchema( const TamlWriteNode* pTamlWriteNode );
+    void compileSchemaCustomNode( const TamlCustomNode* pCustomNode );
+    void writeSchema( Stream& stream );
+    void writeCompressedBlocks( Stream& stream, const U8* pImage, const U32 imageSize );
+    void writeText( Stream& stream, const char* pText );
+    void writeTypedValue( Stream& stream, const FieldEncoding encoding, const void* pData );
+
     void writeElement( Stream& stream, const TamlWriteNode* pTamlWriteNode );
-    void writeAttributes( Stream& stream, const TamlWriteNode* pTamlWriteNode );
+    void writeAttributes( Stream& stream, const TamlWriteNode* pTamlWriteNode, SchemaClass* pSchemaClass );
     void writeChildren( Stream& stream, const TamlWriteNode* pTamlWriteNode );
     void writeCustomElements( Stream& stream, const TamlWriteNode* pTamlWriteNode );
     void writeCustomNode( Stream& stream, const TamlCustomNode* pCustomNode );
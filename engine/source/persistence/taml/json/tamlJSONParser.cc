@@ -25,12 +25,213 @@
 #include "console/console.h"
 #include "io/fileStream.h"
 #include "memory/frameAllocator.h"
+#include "collection/vector.h"
 
 // Debug Profiling.
 #include "debug/profiler.h"
 
 //-----------------------------------------------------------------------------
 
+/// A JSON string stream that ends as soon as the handler has stopped.
+class TamlJSONVisitStream
+{
+public:
+    typedef char Ch;
+
+    TamlJSONVisitStream( const char* pText, const bool* pStopped ) : mpCursor( pText ), mpStart( pText ), mpStopped( pStopped ) {}
+
+    inline Ch Peek( void ) const { return *mpStopped ? 0 : *mpCursor; }
+    inline Ch Take( void ) { return *mpStopped ? 0 : *mpCursor++; }
+    inline size_t Tell( void ) const { return mpCursor - mpStart; }
+
+    Ch* PutBegin( void ) { return NULL; }
+    void Put( Ch ) {}
+    size_t PutEnd( Ch* ) { return 0; }
+
+private:
+    const char* mpCursor;
+    const char* mpStart;
+    const bool* mpStopped;
+};
+
+//-----------------------------------------------------------------------------
+
+/// Passes the properties of a JSON document to a visitor as they are read so no document is built.
+/// The types are visited in the order they appear which is the same order the writer produces.
+class TamlJSONVisitHandler
+{
+public:
+    typedef char Ch;
+
+    TamlJSONVisitHandler( const TamlParser& parser, TamlVisitor& visitor ) :
+        mParser( parser ),
+        mVisitor( visitor ),
+        mKey( StringTable->EmptyString ),
+        mKeyPending( false ),
+        mSkipDepth( 0 ),
+        mRootParsed( false ),
+        mStopped( false )
+    {
+    }
+
+    inline const bool* getStoppedFlag( void ) const { return &mStopped; }
+    inline bool getStopped( void ) const { return mStopped; }
+
+    void Null( void ) { unknownValue(); }
+    void Bool( bool value ) { formatValue( "%d", (S32)value ); }
+    void Int( int value ) { formatValue( "%d", (S32)value ); }
+    void Uint( unsigned value ) { formatValue( "%d", (S32)value ); }
+    void Int64( int64_t value ) { formatValue( "%d", (S32)value ); }
+    void Uint64( uint64_t value ) { formatValue( "%d", (S32)value ); }
+
+    void Double( double value )
+    {
+        char valueBuffer[64];
+        dSprintf( valueBuffer, sizeof(valueBuffer), "%f", value );
+        visitValue( valueBuffer );
+    }
+
+    void String( const Ch* pString, rapidjson::SizeType, bool )
+    {
+        // Ignore anything being skipped.
+        if ( mSkipDepth > 0 )
+            return;
+
+        // Is this a member name?
+        if ( mKeyPending )
+        {
+            // Yes, so note it for the value.
+            mKey = StringTable->insert( pString );
+            mKeyPending = false;
+            return;
+        }
+
+        visitValue( pString );
+    }
+
+    void StartObject( void )
+    {
+        // Skip nested objects if skipping.
+        if ( mSkipDepth > 0 )
+        {
+            mSkipDepth++;
+            return;
+        }
+
+        // Is this the document itself?
+        if ( mTypes.size() == 0 )
+        {
+            // Yes, so it has no type.
+            mTypes.push_back( StringTable->EmptyString );
+            mKeyPending = true;
+            return;
+        }
+
+        // Skip anything other than the root type or anything under the root if only the root is needed.
+        if ( (mTypes.size() == 1 && mRootParsed) || (mTypes.size() > 1 && mVisitor.wantsRootOnly()) )
+        {
+            mSkipDepth = 1;
+            return;
+        }
+
+        // Start the type.
+        mTypes.push_back( mKey );
+        mRootParsed = true;
+        mKeyPending = true;
+    }
+
+    void EndObject( rapidjson::SizeType )
+    {
+        // Finish the skipped object.
+        if ( mSkipDepth > 0 )
+        {
+            if ( --mSkipDepth == 0 )
+                mKeyPending = true;
+
+            return;
+        }
+
+        // End the type.
+        mTypes.pop_back();
+        mKeyPending = true;
+
+        // Stop once the root type has ended.
+        if ( mTypes.size() == 1 )
+            mStopped = true;
+    }
+
+    void StartArray( void )
+    {
+        // Skip nested arrays if skipping.
+        if ( mSkipDepth > 0 )
+        {
+            mSkipDepth++;
+            return;
+        }
+
+        // Arrays aren't used so skip it.
+        unknownValue();
+        mSkipDepth = 1;
+    }
+
+    void EndArray( rapidjson::SizeType )
+    {
+        // Finish the skipped array.
+        if ( --mSkipDepth == 0 )
+            mKeyPending = true;
+    }
+
+private:
+    inline void formatValue( const char* pFormat, const S32 value )
+    {
+        char valueBuffer[32];
+        dSprintf( valueBuffer, sizeof(valueBuffer), pFormat, value );
+        visitValue( valueBuffer );
+    }
+
+    inline void unknownValue( void )
+    {
+        // Ignore anything being skipped or outside of a type.
+        if ( mSkipDepth == 0 && mTypes.size() > 1 )
+            Con::warnf( "Taml: Encountered a field '%s' but its value is an unknown type.", mKey );
+
+        mKeyPending = true;
+    }
+
+    void visitValue( const char* pValue )
+    {
+        // Ignore anything being skipped.
+        if ( mSkipDepth > 0 )
+            return;
+
+        mKeyPending = true;
+
+        // Ignore values outside of a type.
+        if ( mTypes.size() < 2 )
+            return;
+
+        // Configure property state.
+        mPropertyState.setObjectName( mTypes.last(), mTypes.size() == 2 );
+        mPropertyState.setProperty( mKey, pValue );
+
+        // Visit this property (stop processing if instructed).
+        if ( !mVisitor.visit( mParser, mPropertyState ) )
+            mStopped = true;
+    }
+
+    const TamlParser&           mParser;
+    TamlVisitor&                mVisitor;
+    TamlVisitor::PropertyState  mPropertyState;
+    Vector<StringTableEntry>    mTypes;
+    StringTableEntry            mKey;
+    bool                        mKeyPending;
+    U32                         mSkipDepth;
+    bool                        mRootParsed;
+    bool                        mStopped;
+};
+
+//-----------------------------------------------------------------------------
+
 bool TamlJSONParser::accept( const char* pFilename, TamlVisitor& visitor )
 {
     // Debug Profiling.
@@ -63,9 +264,43 @@ bool TamlJSONParser::accept( const char* pFilename, TamlVisitor& visitor )
         return false;
     }
 
+    // Terminate the text.
+    jsonText[streamSize] = 0;
+
+    // Does the visitor change properties?
+    if ( !visitor.wantsPropertyChanges() )
+    {
+        // No, so close the stream.
+        stream.close();
+
+        // Set parsing filename.
+        setParsingFilename( filenameBuffer );
+
+        // Stream the document through the visitor.
+        TamlJSONVisitHandler handler( *this, visitor );
+        TamlJSONVisitStream inputStream( jsonText, handler.getStoppedFlag() );
+        rapidjson::Reader reader;
+        const bool parsed = reader.Parse<0>( inputStream, handler );
+
+        // Reset parsing filename.
+        setParsingFilename( StringTable->EmptyString );
+
+        // Did the document parse?
+        // NOTE: Stopping early is reported by the reader as an error as the rest of the document is not read.
+        if ( !parsed && !handler.getStopped() )
+        {
+            // No, so warn.
+            Con::warnf("TamlJSONParser::parse() - Load Taml JSON file from stream but was invalid.");
+            return false;
+        }
+
+        return true;
+    }
+
     // Create JSON document.
+    // NOTE: The document is parsed in-situ so its strings refer to the text which remains until the document is written.
     rapidjson::Document inputDocument;
-    inputDocument.Parse<0>( jsonText );
+    inputDocument.ParseInsitu<0>( jsonText );
 
     // Close the stream.
     stream.close();
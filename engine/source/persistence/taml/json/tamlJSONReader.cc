@@ -25,6 +25,7 @@
 #include "io/fileStream.h"
 #include "string/stringUnit.h"
 #include "memory/frameAllocator.h"
+#include "persistence/taml/tamlTemplates.h"
 
 // Debug Profiling.
 #include "debug/profiler.h"
@@ -48,8 +49,9 @@ SimObject* TamlJSONReader::read( FileStream& stream )
     jsonText[streamSize] = NULL;
 
     // Create JSON document.
+    // NOTE: The document is parsed in-situ so its strings refer to the text rather than being copied.
     rapidjson::Document document;
-    document.Parse<0>( jsonText );
+    document.ParseInsitu<0>( jsonText );
 
     // Check the document is valid.
     if ( document.GetType() != rapidjson::kObjectType )
@@ -101,8 +103,12 @@ SimObject* TamlJSONReader::parseType( const rapidjson::Value::ConstMemberIterato
     // Fetch engine type name (demangled).
     StringTableEntry engineTypeName = getDemangledName( typeName.GetString() );
 
+    // Fetch the Taml attributes.
+    TamlAttributes tamlAttributes;
+    getTamlAttributes( typeValue, tamlAttributes );
+
     // Fetch reference to Id.
-    const U32 tamlRefToId = getTamlRefToId( typeValue );
+    const U32 tamlRefToId = tamlAttributes.mRefToId;
 
     // Do we have a reference to Id?
     if ( tamlRefToId != 0 )
@@ -123,7 +129,15 @@ SimObject* TamlJSONReader::parseType( const rapidjson::Value::ConstMemberIterato
     }
 
     // No, so fetch reference Id.
-    const U32 tamlRefId = getTamlRefId( typeValue );
+    const U32 tamlRefId = tamlAttributes.mRefId;
+
+    // Fetch any template.
+    const char* pTemplateFile = tamlAttributes.mpTemplateFile;
+    const TamlWriteNode* pTemplate = pTemplateFile != NULL ? TamlTemplates::findTemplate( pTemplateFile ) : NULL;
+
+    // Use the template type if we have a template.
+    if ( pTemplate != NULL )
+        engineTypeName = TamlTemplates::getTypeName( pTemplate );
 
     // Create type.
     SimObject* pSimObject = Taml::createType( engineTypeName, mpTaml );
@@ -144,6 +158,10 @@ SimObject* TamlJSONReader::parseType( const rapidjson::Value::ConstMemberIterato
         mpTaml->tamlPreRead( pCallbacks );
     }
 
+    // Apply any template fields.
+    if ( pTemplate != NULL )
+        TamlTemplates::applyFields( pSimObject, pTemplate );
+
     // Parse field members.
     for( rapidjson::Value::ConstMemberIterator fieldMemberItr = typeValue.MemberBegin(); fieldMemberItr != typeValue.MemberEnd(); ++fieldMemberItr )
     {
@@ -159,7 +177,7 @@ SimObject* TamlJSONReader::parseType( const rapidjson::Value::ConstMemberIterato
     }
 
     // Fetch object name.
-    StringTableEntry objectName = StringTable->insert( getTamlObjectName( typeValue ) );
+    StringTableEntry objectName = StringTable->insert( tamlAttributes.mpObjectName );
 
     // Does the object require a name?
     if ( objectName == StringTable->EmptyString )
@@ -188,6 +206,10 @@ SimObject* TamlJSONReader::parseType( const rapidjson::Value::ConstMemberIterato
         mObjectReferenceMap.insert( tamlRefId, pSimObject );
     }
 
+    // Add any template children.
+    if ( pTemplate != NULL )
+        TamlTemplates::addChildren( mpTaml, pSimObject, pTemplate );
+
     // Parse children and custom node members.
     for( rapidjson::Value::ConstMemberIterator objectMemberItr = typeValue.MemberBegin(); objectMemberItr != typeValue.MemberEnd(); ++objectMemberItr )
     {
@@ -217,8 +239,8 @@ SimObject* TamlJSONReader::parseType( const rapidjson::Value::ConstMemberIterato
     // Call custom read.
     if ( pCallbacks )
     {
-        mpTaml->tamlCustomRead( pCallbacks, customNodes );
-        mpTaml->tamlPostRead( pCallbacks, customNodes );
+        mpTaml->tamlCustomRead( pCallbacks, TamlTemplates::getCustomNodes( pTemplate, customNodes ) );
+        mpTaml->tamlPostRead( pCallbacks, TamlTemplates::getCustomNodes( pTemplate, customNodes ) );
     }
 
     // Return object.
@@ -242,9 +264,17 @@ inline void TamlJSONReader::parseField( rapidjson::Value::ConstMemberIterator& m
     // Ignore if this is a Taml attribute.
     if (    fieldName == tamlRefIdName ||
             fieldName == tamlRefToIdName ||
-            fieldName == tamlNamedObjectName )
+            fieldName == tamlNamedObjectName ||
+            fieldName == tamlTemplateName )
             return;
 
+    // Set string fields directly.
+    if ( value.IsString() )
+    {
+        pSimObject->setPrefixedDataField( fieldName, NULL, value.GetString() );
+        return;
+    }
+
     // Get field value.
     char valueBuffer[4096];
     if ( !parseStringValue( valueBuffer, sizeof(valueBuffer), value, fieldName ) )
@@ -371,8 +401,12 @@ inline void TamlJSONReader::parseCustomNode( rapidjson::Value::ConstMemberIterat
     // Is the value an object?
     if ( value.IsObject() )
     {
-        // Yes, so is the node a proxy object?
-        if (  getTamlRefId( value ) != 0 || getTamlRefToId( value ) != 0 )
+        // Yes, so fetch the Taml attributes.
+        TamlAttributes tamlAttributes;
+        getTamlAttributes( value, tamlAttributes );
+
+        // Is the node a proxy object?
+        if ( tamlAttributes.mRefId != 0 || tamlAttributes.mRefToId != 0 )
         {
             // Yes, so parse proxy object.
             SimObject* pProxyObject = parseType( memberItr );
@@ -489,6 +523,10 @@ inline StringTableEntry TamlJSONReader::getDemangledName( const char* pMangledNa
     // Debug Profiling.
     PROFILE_SCOPE(TamlJSONReader_GetDemangledName);
 
+    // Use all the type name if it cannot be mangled.
+    if ( pMangledName[dStrcspn( pMangledName, JSON_RFC4627_NAME_MANGLING_CHARACTERS )] == 0 )
+        return StringTable->insert( pMangledName );
+
     // Is the type name mangled?
     if ( StringUnit::getUnitCount( pMangledName, JSON_RFC4627_NAME_MANGLING_CHARACTERS ) > 1 )
     {
@@ -561,126 +599,76 @@ inline bool TamlJSONReader::parseStringValue( char* pBuffer, const S32 bufferSiz
 
 //-----------------------------------------------------------------------------
 
-inline U32 TamlJSONReader::getTamlRefId( const rapidjson::Value& value )
+inline void TamlJSONReader::getTamlAttributes( const rapidjson::Value& value, TamlAttributes& attributes )
 {
     // Debug Profiling.
-    PROFILE_SCOPE(TamlJSONReader_GetTamlRefId);
+    PROFILE_SCOPE(TamlJSONReader_GetTamlAttributes);
 
-    // Is the value an object?
-    if ( !value.IsObject()  )
-    {
-        // No, so warn.
-        Con::warnf( "Taml::getTamlRefId() - Cannot get '%s' member as value is not an object.", tamlRefIdName );
-        return 0;
-    }
+    // Reset the attributes.
+    attributes.mRefId = 0;
+    attributes.mRefToId = 0;
+    attributes.mpObjectName = NULL;
+    attributes.mpTemplateFile = NULL;
 
     // Iterate members.
+    // NOTE: The member names are compared directly as inserting every name into the string-table is expensive.
     for( rapidjson::Value::ConstMemberIterator memberItr = value.MemberBegin(); memberItr != value.MemberEnd(); ++memberItr )
     {
-        // Insert member name.
-        StringTableEntry attributeName = StringTable->insert( memberItr->name.GetString() );
+        // Fetch the member name.
+        const char* pAttributeName = memberItr->name.GetString();
+        const rapidjson::Value& attributeValue = memberItr->value;
 
-        // Skip if not the correct attribute.
-        if ( attributeName != tamlRefIdName )
-            continue;
-
-        // Is the value an integer?
-        if ( !memberItr->value.IsInt() )
+        // Is this the reference Id?
+        if ( dStrcmp( pAttributeName, tamlRefIdName ) == 0 )
         {
-            // No, so warn.
-            Con::warnf( "Taml::getTamlRefId() - Found '%s' member but it is not an integer.", tamlRefIdName );
-            return 0;
-        }
-
-        // Return it.
-        return (U32)memberItr->value.GetInt();
-    }
-
-    // Not found.
-    return 0;
-}
-
-//-----------------------------------------------------------------------------
-
-inline U32 TamlJSONReader::getTamlRefToId( const rapidjson::Value& value )
-{
-    // Debug Profiling.
-    PROFILE_SCOPE(TamlJSONReader_GetTamlRefToId);
-
-    // Is the value an object?
-    if ( !value.IsObject()  )
-    {
-        // No, so warn.
-        Con::warnf( "Taml::getTamlRefToId() - Cannot get '%s' member as value is not an object.", tamlRefToIdName );
-        return 0;
-    }
-
-    // Iterate members.
-    for( rapidjson::Value::ConstMemberIterator memberItr = value.MemberBegin(); memberItr != value.MemberEnd(); ++memberItr )
-    {
-        // Insert member name.
-        StringTableEntry attributeName = StringTable->insert( memberItr->name.GetString() );
-
-        // Skip if not the correct attribute.
-        if ( attributeName != tamlRefToIdName )
-            continue;
+            // Yes, so is the value an integer?
+            if ( !attributeValue.IsInt() )
+            {
+                // No, so warn.
+                Con::warnf( "Taml::getTamlAttributes() - Found '%s' member but it is not an integer.", tamlRefIdName );
+                continue;
+            }
 
-        // Is the value an integer?
-        if ( !memberItr->value.IsInt() )
-        {
-            // No, so warn.
-            Con::warnf( "Taml::getTamlRefToId() - Found '%s' member but it is not an integer.", tamlRefToIdName );
-            return 0;
+            attributes.mRefId = (U32)attributeValue.GetInt();
         }
+        // Is this the reference to Id?
+        else if ( dStrcmp( pAttributeName, tamlRefToIdName ) == 0 )
+        {
+            // Yes, so is the value an integer?
+            if ( !attributeValue.IsInt() )
+            {
+                // No, so warn.
+                Con::warnf( "Taml::getTamlAttributes() - Found '%s' member but it is not an integer.", tamlRefToIdName );
+                continue;
+            }
 
-        // Return it.
-        return (U32)memberItr->value.GetInt();
-    }
-
-    // Not found.
-    return 0;
-}
-
-//-----------------------------------------------------------------------------
-
-inline const char* TamlJSONReader::getTamlObjectName( const rapidjson::Value& value )
-{
-    // Debug Profiling.
-    PROFILE_SCOPE(TamlJSONReader_GetTamlObjectName);
-
-    // Is the value an object?
-    if ( !value.IsObject()  )
-    {
-        // No, so warn.
-        Con::warnf( "Taml::getTamlObjectName() - Cannot get '%s' member as value is not an object.", tamlNamedObjectName );
-        return 0;
-    }
-
-    // Iterate members.
-    for( rapidjson::Value::ConstMemberIterator memberItr = value.MemberBegin(); memberItr != value.MemberEnd(); ++memberItr )
-    {
-        // Insert member name.
-        StringTableEntry attributeName = StringTable->insert( memberItr->name.GetString() );
-
-        // Skip if not the correct attribute.
-        if ( attributeName != tamlNamedObjectName )
-            continue;
-
-        // Is the value an integer?
-        if ( !memberItr->value.IsString() )
+            attributes.mRefToId = (U32)attributeValue.GetInt();
+        }
+        // Is this the object name?
+        else if ( dStrcmp( pAttributeName, tamlNamedObjectName ) == 0 )
         {
-            // No, so warn.
-            Con::warnf( "Taml::getTamlObjectName() - Found '%s' member but it is not a string.", tamlNamedObjectName );
-            return NULL;
+            // Yes, so is the value a string?
+            if ( !attributeValue.IsString() )
+            {
+                // No, so warn.
+                Con::warnf( "Taml::getTamlAttributes() - Found '%s' member but it is not a string.", tamlNamedObjectName );
+                continue;
+            }
+
+            attributes.mpObjectName = attributeValue.GetString();
         }
+        // Is this the template file?
+        else if ( dStrcmp( pAttributeName, tamlTemplateName ) == 0 )
+        {
+            // Yes, so is the value a string?
+            if ( !attributeValue.IsString() )
+            {
+                // No, so warn.
+                Con::warnf( "Taml::getTamlAttributes() - Found '%s' member but it is not a string.", tamlTemplateName );
+                continue;
+            }
 
-        // Return it.
-        return memberItr->value.GetString();
+            attributes.mpTemplateFile = attributeValue.GetString();
+        }
     }
-
-    // Not found.
-    return NULL;
 }
-
-
-
@@ -57,6 +57,15 @@ private:
     typedef HashMap<SimObjectId, SimObject*> typeObjectReferenceHash;
     typeObjectReferenceHash mObjectReferenceMap;
 
+    /// The Taml attributes of a type.
+    struct TamlAttributes
+    {
+        U32 mRefId;
+        U32 mRefToId;
+        const char* mpObjectName;
+        const char* mpTemplateFile;
+    };
+
 private:
     void resetParse( void );
 
@@ -68,9 +77,7 @@ private:
 
     inline StringTableEntry getDemangledName( const char* pMangledName );
     inline bool parseStringValue( char* pBuffer, const S32 bufferSize, const rapidjson::Value& value, const char* pName );
-    inline U32 getTamlRefId( const rapidjson::Value& value );
-    inline U32 getTamlRefToId( const rapidjson::Value& value );
-    inline const char* getTamlObjectName( const rapidjson::Value& value );   
+    inline void getTamlAttributes( const rapidjson::Value& value, TamlAttributes& attributes );   
 };
 
 #endif // _TAML_JSONREADER_H_
\ No newline at end of file
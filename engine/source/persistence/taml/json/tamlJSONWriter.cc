@@ -79,6 +79,144 @@ bool TamlJSONWriter::write( FileStream& stream, const TamlWriteNode* pTamlWriteN
 
 //-----------------------------------------------------------------------------
 
+void TamlJSONWriter::beginWrite( FileStream& stream )
+{
+    // Create the writer.
+    mpStream = &stream;
+    delete mpStreamWriter;
+    mpStreamWriter = new rapidjson::PrettyWriter<FileStream>( stream );
+    mMemberIndices.clear();
+
+    // Start the document.
+    mpStreamWriter->StartObject();
+}
+
+//-----------------------------------------------------------------------------
+
+bool TamlJSONWriter::endWrite( void )
+{
+    // Sanity!
+    AssertFatal( mMemberIndices.size() == 0, "TamlJSONWriter::endWrite() - Types are still open." );
+
+    // Finish the document.
+    mpStreamWriter->EndObject();
+
+    delete mpStreamWriter;
+    mpStreamWriter = NULL;
+
+    const bool status = mpStream->getStatus() == Stream::Ok;
+    mpStream = NULL;
+
+    return status;
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlJSONWriter::beginNode( const TamlWriteNode* pTamlWriteNode )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlJSONWriter_BeginNode);
+
+    // Fetch the member index within the parent type (the root has no member index).
+    const S32 memberIndex = mMemberIndices.size() == 0 ? -1 : mMemberIndices.last()++;
+
+    // Fetch object.
+    SimObject* pSimObject = pTamlWriteNode->mpSimObject;
+
+    // Fetch JSON strict flag (don't use it if member index is set to not use it).
+    const bool jsonStrict = memberIndex == -1 ? false : mpTaml->getJSONStrict();
+
+    // Fetch element name (mangled or not).
+    StringTableEntry elementName = jsonStrict ? getManagedName( pSimObject->getClassName(), memberIndex ) : pSimObject->getClassName();
+
+    // Start the type.
+    // NOTE: The members are written in the same order as compileType() adds them.
+    mpStreamWriter->String( elementName );
+    mpStreamWriter->StartObject();
+    mMemberIndices.push_back( 0 );
+
+    // Fetch reference Id.
+    const U32 referenceId = pTamlWriteNode->mRefId;
+
+    // Do we have a reference Id?
+    if ( referenceId != 0 )
+    {
+        // Yes, so write reference Id.
+        mpStreamWriter->String( tamlRefIdName );
+        mpStreamWriter->Int( referenceId );
+    }
+    // Do we have a reference to node?
+    else if ( pTamlWriteNode->mRefToNode != NULL )
+    {
+        // Yes, so fetch reference to Id.
+        const U32 referenceToId = pTamlWriteNode->mRefToNode->mRefId;
+
+        // Sanity!
+        AssertFatal( referenceToId != 0, "Taml: Invalid reference to Id." );
+
+        // Write reference to Id.
+        mpStreamWriter->String( tamlRefToIdName );
+        mpStreamWriter->Int( referenceToId );
+
+        // Finish because we're a reference to another object.
+        return;
+    }
+
+    // Fetch object name.
+    const char* pObjectName = pTamlWriteNode->mpObjectName;
+
+    // Do we have a name?
+    if ( pObjectName != NULL )
+    {
+        // Yes, so write name.
+        mpStreamWriter->String( tamlNamedObjectName );
+        mpStreamWriter->String( pObjectName );
+    }
+
+    // Fetch fields.
+    const Vector<TamlWriteNode::FieldValuePair*>& fields = pTamlWriteNode->mFields;
+
+    // Write fields.
+    for( Vector<TamlWriteNode::FieldValuePair*>::const_iterator itr = fields.begin(); itr != fields.end(); ++itr )
+    {
+        mpStreamWriter->String( (*itr)->mName );
+        mpStreamWriter->String( (*itr)->mpValue );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlJSONWriter::endNode( const TamlWriteNode* pTamlWriteNode )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlJSONWriter_EndNode);
+
+    // Sanity!
+    AssertFatal( mMemberIndices.size() > 0, "TamlJSONWriter::endNode() - No type is open." );
+
+    // Do we have any custom nodes?
+    if ( pTamlWriteNode->mCustomNodes.getNodes().size() > 0 )
+    {
+        // Yes, so compile them.
+        rapidjson::Document document;
+        rapidjson::Value customValue(rapidjson::kObjectType);
+        compileCustom( document, &customValue, pTamlWriteNode );
+
+        // Write them.
+        for( rapidjson::Value::ConstMemberIterator itr = customValue.MemberBegin(); itr != customValue.MemberEnd(); ++itr )
+        {
+            mpStreamWriter->String( itr->name.GetString(), itr->name.GetStringLength() );
+            itr->value.Accept( *mpStreamWriter );
+        }
+    }
+
+    // Finish the type.
+    mMemberIndices.pop_back();
+    mpStreamWriter->EndObject();
+}
+
+//-----------------------------------------------------------------------------
+
 void TamlJSONWriter::compileType( rapidjson::Document& document, rapidjson::Value* pTypeValue, rapidjson::Value* pParentValue, const TamlWriteNode* pTamlWriteNode, const S32 memberIndex )
 {
     // Debug Profiling.
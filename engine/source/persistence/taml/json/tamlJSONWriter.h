@@ -40,20 +40,33 @@ extern StringTableEntry JSON_RFC4627_NAME_MANGLING_FORMAT;
 
 /// @ingroup tamlGroup
 /// @see tamlGroup
-class TamlJSONWriter
+class TamlJSONWriter : public TamlStreamWriter
 {
 public:
     TamlJSONWriter( Taml* pTaml ) :
-        mpTaml( pTaml )
+        mpTaml( pTaml ),
+        mpStream( NULL ),
+        mpStreamWriter( NULL )
     {}
-    virtual ~TamlJSONWriter() {}
+    virtual ~TamlJSONWriter() { delete mpStreamWriter; }
 
     /// Write.
     bool write( FileStream& stream, const TamlWriteNode* pTamlWriteNode );
 
+    /// Stream write.
+    virtual void beginWrite( FileStream& stream );
+    virtual bool endWrite( void );
+    virtual void beginNode( const TamlWriteNode* pTamlWriteNode );
+    virtual void endNode( const TamlWriteNode* pTamlWriteNode );
+
 private:
     Taml* mpTaml;
 
+    /// The stream being written and the next member index within each open type.
+    FileStream* mpStream;
+    rapidjson::PrettyWriter<FileStream>* mpStreamWriter;
+    Vector<S32> mMemberIndices;
+
 private:
     void compileType( rapidjson::Document& document, rapidjson::Value* pTypeValue, rapidjson::Value* pParentValue, const TamlWriteNode* pTamlWriteNode, const S32 memberIndex );
     void compileFields( rapidjson::Document& document, rapidjson::Value* pTypeValue, const TamlWriteNode* pTamlWriteNode );
@@ -42,6 +42,10 @@
 #include "persistence/taml/binary/tamlBinaryReader.h"
 #endif
 
+#ifndef _TAML_BINARYPARSER_H_
+#include "persistence/taml/binary/tamlBinaryParser.h"
+#endif
+
 #ifndef _TAML_JSONWRITER_H_
 #include "persistence/taml/json/tamlJSONWriter.h"
 #endif
@@ -54,6 +58,10 @@
 #include "persistence/taml/json/tamlJSONParser.h"
 #endif
 
+#ifndef _TAML_TEMPLATES_H_
+#include "persistence/taml/tamlTemplates.h"
+#endif
+
 #ifndef _FRAMEALLOCATOR_H_
 #include "memory/frameAllocator.h"
 #endif
@@ -105,6 +113,7 @@ IMPLEMENT_CONOBJECT( Taml );
 StringTableEntry tamlRefIdName          = StringTable->insert( "TamlId" );
 StringTableEntry tamlRefToIdName        = StringTable->insert( "TamlRefId" );
 StringTableEntry tamlNamedObjectName    = StringTable->insert( "Name" );
+StringTableEntry tamlTemplateName       = StringTable->insert( "TamlTemplate" );
 
 //-----------------------------------------------------------------------------
 
@@ -160,6 +169,12 @@ Taml::Taml() :
     mBinaryCompression(true),
     mWriteDefaults(false),
     mProgenitorUpdate(true),    
+    mIncrementalWrite(false),
+    mIncrementalWriteCount(0),
+    mIncrementalWriteDefaults(false),
+    mpStreamWriter(NULL),
+    mStreamNodes(false),
+    mStreamWrite(false),
     mAutoFormat(true),
     mAutoFormatXmlExtension("taml"),    
     mAutoFormatBinaryExtension("baml"),
@@ -181,6 +196,8 @@ void Taml::initPersistFields()
     addField("BinaryCompression", TypeBool, Offset(mBinaryCompression, Taml), "Whether ZIP compression is used on binary formatting or not.\n");
     addField("WriteDefaults", TypeBool, Offset(mWriteDefaults, Taml), "Whether to write static fields that are at their default or not.\n");
     addField("ProgenitorUpdate", TypeBool, Offset(mProgenitorUpdate, Taml), "Whether to update each type instances file-progenitor or not.\n");
+    addField("IncrementalWrite", TypeBool, Offset(mIncrementalWrite, Taml), "Whether to reuse the fields compiled for objects that haven't changed since the previous write or not.\n");
+    addField("StreamWrite", TypeBool, Offset(mStreamWrite, Taml), "Whether XML and JSON writes are written as each object is compiled rather than once all objects are compiled or not.\n");
     addField("AutoFormat", TypeBool, Offset(mAutoFormat, Taml), "Whether the format type is automatically determined by the filename extension or not.\n");
     addField("AutoFormatXmlExtension", TypeString, Offset(mAutoFormatXmlExtension, Taml), "When using auto-format, this is the extension (end of filename) used to detect the XML format.\n");
     addField("AutoFormatBinaryExtension", TypeString, Offset(mAutoFormatBinaryExtension, Taml), "When using auto-format, this is the extension (end of filename) used to detect the BINARY format.\n");
@@ -211,6 +228,9 @@ void Taml::onRemove()
     // Reset the compilation.
     resetCompilation();
 
+    // Reset the incremental write state.
+    resetIncrementalFields();
+
     // Call parent.
     Parent::onRemove();
 }
@@ -259,6 +279,23 @@ bool Taml::write( SimObject* pSimObject, const char* pFilename )
 
 //-----------------------------------------------------------------------------
 
+const TamlWriteNode* Taml::compile( SimObject* pSimObject )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Taml_Compile);
+
+    // Sanity!
+    AssertFatal( pSimObject != NULL, "Cannot compile a NULL object." );
+
+    // Reset the compilation.
+    resetCompilation();
+
+    // Compile nodes.
+    return compileObject( pSimObject );
+}
+
+//-----------------------------------------------------------------------------
+
 SimObject* Taml::read( const char* pFilename )
 {
     // Debug Profiling.
@@ -312,9 +349,41 @@ bool Taml::write( FileStream& stream, SimObject* pSimObject, const TamlFormatMod
     // Sanity!
     AssertFatal( pSimObject != NULL, "Cannot write a NULL object." );
 
+    // Is the incremental write state still valid?
+    if ( !mIncrementalWrite || mIncrementalWriteDefaults != mWriteDefaults )
+    {
+        // No, so reset it.
+        resetIncrementalFields();
+        mIncrementalWriteDefaults = mWriteDefaults;
+    }
+
+    // Start a new incremental write.
+    mIncrementalWriteCount++;
+
+    // Are we streaming the write?
+    if ( mStreamWrite )
+    {
+        // Yes, so stream formats that can be written as the nodes are compiled.
+        if ( formatMode == XmlFormat )
+        {
+            TamlXmlWriter writer( this );
+            return writeStreamed( stream, pSimObject, writer );
+        }
+
+        if ( formatMode == JSONFormat )
+        {
+            TamlJSONWriter writer( this );
+            return writeStreamed( stream, pSimObject, writer );
+        }
+    }
+
     // Compile nodes.
     TamlWriteNode* pRootNode = compileObject( pSimObject );
 
+    // Prune the incremental state of objects no longer written.
+    if ( mIncrementalWrite )
+        pruneIncrementalFields();
+
     // Format appropriately.
     switch( formatMode )
     {
@@ -364,6 +433,35 @@ bool Taml::write( FileStream& stream, SimObject* pSimObject, const TamlFormatMod
 
 //-----------------------------------------------------------------------------
 
+bool Taml::writeStreamed( FileStream& stream, SimObject* pSimObject, TamlStreamWriter& streamWriter )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Taml_WriteStreamed);
+
+    // Find the objects that need reference Ids as they must be known when each object is written.
+    scanSharedObjects( pSimObject );
+
+    // Compile and write nodes.
+    mpStreamWriter = &streamWriter;
+    mStreamNodes = true;
+    streamWriter.beginWrite( stream );
+    releaseStreamedNode( compileObject( pSimObject ) );
+    const bool status = streamWriter.endWrite();
+    mpStreamWriter = NULL;
+    mStreamNodes = false;
+
+    // Clear the shared objects.
+    mSharedObjects.clear();
+
+    // Prune the incremental state of objects no longer written.
+    if ( mIncrementalWrite )
+        pruneIncrementalFields();
+
+    return status;
+}
+
+//-----------------------------------------------------------------------------
+
 SimObject* Taml::read( FileStream& stream, const TamlFormatMode formatMode )
 {
     // Format appropriately.
@@ -462,6 +560,21 @@ bool Taml::parse( const char* pFilename, TamlVisitor& visitor )
         }
 
         case BinaryFormat:
+        {
+            // Parse with the visitor.
+            TamlBinaryParser parser;
+
+            // Are property changes needed but not supported?
+            if ( visitor.wantsPropertyChanges() && !parser.canChangeProperty() )
+            {
+                // Yes, so warn.
+                Con::warnf( "Taml::parse() - Cannot parse '%s' file-type for filename '%s' as a specified visitor requires property changes which are not supported by the parser.", getFormatModeDescription(formatMode), pFilename );
+                return false;
+            }
+
+            return parser.accept( pFilename, visitor );
+        }
+
         default:
             break;
     }
@@ -501,6 +614,187 @@ void Taml::resetCompilation( void )
 
 //-----------------------------------------------------------------------------
 
+void Taml::resetIncrementalFields( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Taml_ResetIncrementalFields);
+
+    // Delete the fields of all objects.
+    for( typeIncrementalHash::iterator itr = mIncrementalFields.begin(); itr != mIncrementalFields.end(); ++itr )
+    {
+        delete itr->value;
+    }
+    mIncrementalFields.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void Taml::pruneIncrementalFields( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Taml_PruneIncrementalFields);
+
+    Vector<SimObjectId> staleObjects(__FILE__, __LINE__);
+
+    // Find the objects that were not written this time.
+    for( typeIncrementalHash::iterator itr = mIncrementalFields.begin(); itr != mIncrementalFields.end(); ++itr )
+    {
+        if ( itr->value->mWriteCount != mIncrementalWriteCount )
+            staleObjects.push_back( itr->key );
+    }
+
+    // Delete their fields.
+    for( Vector<SimObjectId>::iterator itr = staleObjects.begin(); itr != staleObjects.end(); ++itr )
+    {
+        typeIncrementalHash::iterator fieldsItr = mIncrementalFields.find( *itr );
+        delete fieldsItr->value;
+        mIncrementalFields.erase( fieldsItr );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Taml::releaseStreamedNode( TamlWriteNode* pTamlWriteNode )
+{
+    // Fetch the reference Id.
+    const U32 refId = pTamlWriteNode->mRefId;
+
+    // Reset the node.
+    pTamlWriteNode->resetNode();
+
+    // Delete the node if nothing can refer to it.
+    if ( refId == 0 )
+    {
+        delete pTamlWriteNode;
+        return;
+    }
+
+    // Keep the reference Id for later references.
+    pTamlWriteNode->mRefId = refId;
+    mCompiledNodes.push_back( pTamlWriteNode );
+}
+
+//-----------------------------------------------------------------------------
+
+void Taml::releaseCompiledNodes( const U32 startIndex )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Taml_ReleaseCompiledNodes);
+
+    U32 keepIndex = startIndex;
+
+    for( U32 index = startIndex; index < (U32)mCompiledNodes.size(); ++index )
+    {
+        TamlWriteNode* pNode = mCompiledNodes[index];
+
+        // Detach the children as they are released individually.
+        // NOTE: Resetting the node would otherwise reset the reference Ids of its children.
+        if ( pNode->mChildren != NULL )
+        {
+            delete pNode->mChildren;
+            pNode->mChildren = NULL;
+        }
+
+        // Fetch the reference Id.
+        const U32 refId = pNode->mRefId;
+
+        // Reset the node.
+        pNode->resetNode();
+
+        // Delete the node if nothing can refer to it.
+        if ( refId == 0 )
+        {
+            delete pNode;
+            continue;
+        }
+
+        // Keep the reference Id for later references.
+        pNode->mRefId = refId;
+        mCompiledNodes[keepIndex++] = pNode;
+    }
+
+    mCompiledNodes.setSize( keepIndex );
+}
+
+//-----------------------------------------------------------------------------
+
+void Taml::scanSharedObjects( SimObject* pSimObject, const bool forceId )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Taml_ScanSharedObjects);
+
+    // Fetch object Id.
+    const SimObjectId objectId = pSimObject->getId();
+
+    // Have we already found this object?
+    typeSharedHash::iterator sharedItr = mSharedObjects.find( objectId );
+    if ( sharedItr != mSharedObjects.end() )
+    {
+        // Yes, so it will be referred to so allocate a reference Id if it doesn't have one.
+        if ( sharedItr->value == 0 )
+            sharedItr->value = ++mMasterNodeId;
+
+        return;
+    }
+
+    // Add the object, allocating a reference Id if one is being forced.
+    mSharedObjects.insert( objectId, forceId ? ++mMasterNodeId : 0 );
+
+    // Scan the Taml children.
+    TamlChildren* pChildren = dynamic_cast<TamlChildren*>( pSimObject );
+    if ( pChildren != NULL )
+    {
+        const U32 childCount = pChildren->getTamlChildCount();
+        for ( U32 childIndex = 0; childIndex < childCount; childIndex++ )
+        {
+            scanSharedObjects( pChildren->getTamlChild(childIndex) );
+        }
+    }
+
+    // Finish if there are no Taml callbacks so no custom state.
+    TamlCallbacks* pCallbacks = dynamic_cast<TamlCallbacks*>( pSimObject );
+    if ( pCallbacks == NULL )
+        return;
+
+    // Fetch the custom state.
+    TamlCustomNodes customNodes;
+    tamlPreWrite( pCallbacks );
+    tamlCustomWrite( pCallbacks, customNodes );
+    tamlPostWrite( pCallbacks );
+
+    // Scan the proxy objects in the custom state.
+    const TamlCustomNodeVector& nodes = customNodes.getNodes();
+    for( TamlCustomNodeVector::const_iterator customNodesItr = nodes.begin(); customNodesItr != nodes.end(); ++customNodesItr )
+    {
+        scanSharedCustomNode( *customNodesItr );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Taml::scanSharedCustomNode( const TamlCustomNode* pCustomNode )
+{
+    // Fetch proxy object.
+    SimObject* pProxyObject = pCustomNode->getProxyObject<SimObject>(false);
+
+    // Is there a proxy object?
+    if ( pProxyObject != NULL )
+    {
+        // Yes, so scan it.  Proxy objects are always given an Id (see Taml::compileCustomNodeState()).
+        scanSharedObjects( pProxyObject, true );
+        return;
+    }
+
+    // Scan the children.
+    const TamlCustomNodeVector& children = pCustomNode->getChildren();
+    for( TamlCustomNodeVector::const_iterator childItr = children.begin(); childItr != children.end(); ++childItr )
+    {
+        scanSharedCustomNode( *childItr );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 Taml::TamlFormatMode Taml::getFileAutoFormatMode( const char* pFilename )
 {
     // Sanity!
@@ -565,7 +859,10 @@ TamlWriteNode* Taml::compileObject( SimObject* pSimObject, const bool forceId )
         // Is a reference Id already present?
         if ( compiledNode->mRefId == 0 )
         {
-            // No, so allocate one.
+            // No, so sanity!
+            AssertFatal( mpStreamWriter == NULL, "Taml::compileObject() - A streamed node was referenced without a reference Id." );
+
+            // Allocate one.
             compiledNode->mRefId = ++mMasterNodeId;
         }
 
@@ -576,8 +873,18 @@ TamlWriteNode* Taml::compileObject( SimObject* pSimObject, const bool forceId )
         // Set reference node.
         pNewNode->mRefToNode = compiledNode;
 
-        // Push new node.
-        mCompiledNodes.push_back( pNewNode );
+        // Are we streaming nodes?
+        if ( mStreamNodes )
+        {
+            // Yes, so write it.
+            mpStreamWriter->beginNode( pNewNode );
+            mpStreamWriter->endNode( pNewNode );
+        }
+        else
+        {
+            // No, so push new node.
+            mCompiledNodes.push_back( pNewNode );
+        }
 
         return pNewNode;
     }
@@ -586,18 +893,31 @@ TamlWriteNode* Taml::compileObject( SimObject* pSimObject, const bool forceId )
     TamlWriteNode* pNewNode = new TamlWriteNode();
     pNewNode->set( pSimObject );
 
+    // Is this a streamed write?
+    if ( mpStreamWriter != NULL )
+    {
+        // Yes, so use the reference Id found when scanning for shared objects.
+        typeSharedHash::iterator sharedItr = mSharedObjects.find( objectId );
+        if ( sharedItr != mSharedObjects.end() )
+            pNewNode->mRefId = sharedItr->value;
+        else if ( forceId )
+            pNewNode->mRefId = ++mMasterNodeId;
+    }
     // Is an Id being forced for this object?
-    if ( forceId )
+    else if ( forceId )
     {
         // Yes, so allocate one.
         pNewNode->mRefId = ++mMasterNodeId;
     }
 
-    // Push new node.
-    mCompiledNodes.push_back( pNewNode );
+    // Push new node unless it is streamed.
+    if ( !mStreamNodes )
+        mCompiledNodes.push_back( pNewNode );
 
     // Insert compiled object.
-    mCompiledObjects.insert( objectId, pNewNode );
+    // NOTE: Streamed writes only refer to objects found to be shared.
+    if ( mpStreamWriter == NULL || pNewNode->mRefId != 0 )
+        mCompiledObjects.insert( objectId, pNewNode );
 
     // Are there any Taml callbacks?
     if ( pNewNode->mpTamlCallbacks != NULL )
@@ -607,14 +927,33 @@ TamlWriteNode* Taml::compileObject( SimObject* pSimObject, const bool forceId )
     }
 
     // Compile static and dynamic fields.
-    compileStaticFields( pNewNode );
-    compileDynamicFields( pNewNode );
+    if ( mIncrementalWrite )
+    {
+        compileIncrementalFields( pNewNode );
+    }
+    else
+    {
+        compileStaticFields( pNewNode );
+        compileDynamicFields( pNewNode );
+    }
+
+    // Are we streaming nodes?
+    const bool streamNode = mStreamNodes;
+    if ( streamNode )
+    {
+        // Yes, so write it.
+        mpStreamWriter->beginNode( pNewNode );
+    }
 
     // Compile children.
     compileChildren( pNewNode );
 
     // Compile custom state.
+    // NOTE: Proxy objects are compiled as part of the custom state rather than streamed.
+    const U32 customStateIndex = mCompiledNodes.size();
+    mStreamNodes = false;
     compileCustomState( pNewNode );
+    mStreamNodes = streamNode;
 
     // Are there any Taml callbacks?
     if ( pNewNode->mpTamlCallbacks != NULL )
@@ -623,6 +962,14 @@ TamlWriteNode* Taml::compileObject( SimObject* pSimObject, const bool forceId )
         tamlPostWrite( pNewNode->mpTamlCallbacks );
     }
 
+    // Are we streaming nodes?
+    if ( streamNode )
+    {
+        // Yes, so finish writing it and release its custom state.
+        mpStreamWriter->endNode( pNewNode );
+        releaseCompiledNodes( customStateIndex );
+    }
+
     return pNewNode;
 }
 
@@ -703,7 +1050,7 @@ void Taml::compileStaticFields( TamlWriteNode* pTamlWriteNode )
             }
 
             // Save field/value.
-            TamlWriteNode::FieldValuePair* pFieldValuePair = new TamlWriteNode::FieldValuePair( fieldName, pFieldValue );
+            TamlWriteNode::FieldValuePair* pFieldValuePair = new TamlWriteNode::FieldValuePair( fieldName, pFieldValue, elementCount == 1 ? pField : NULL );
             pTamlWriteNode->mFields.push_back( pFieldValuePair );
         }
     }    
@@ -751,28 +1098,28 @@ void Taml::compileDynamicFields( TamlWriteNode* pTamlWriteNode )
     Vector<SimFieldDictionary::Entry*> dynamicFieldList(__FILE__, __LINE__);
 
     // Ensure the dynamic field doesn't conflict with static field.
-    for( U32 hashIndex = 0; hashIndex < SimFieldDictionary::HashTableSize; ++hashIndex )
+    for( SimFieldDictionaryIterator fieldItr( pFieldDictionary ); *fieldItr; ++fieldItr )
     {
-        for( SimFieldDictionary::Entry* pEntry = pFieldDictionary->mHashTable[hashIndex]; pEntry; pEntry = pEntry->next )
+        // Fetch entry.
+        SimFieldDictionary::Entry* pEntry = *fieldItr;
+
+        // Iterate static fields.
+        U32 fieldIndex;
+        for( fieldIndex = 0; fieldIndex < fieldCount; ++fieldIndex )
         {
-            // Iterate static fields.
-            U32 fieldIndex;
-            for( fieldIndex = 0; fieldIndex < fieldCount; ++fieldIndex )
-            {
-                if( fieldList[fieldIndex].pFieldname == pEntry->slotName)
-                    break;
-            }
+            if( fieldList[fieldIndex].pFieldname == pEntry->slotName)
+                break;
+        }
 
-            // Skip if found.
-            if( fieldIndex != (U32)fieldList.size() )
-                continue;
+        // Skip if found.
+        if( fieldIndex != (U32)fieldList.size() )
+            continue;
 
-            // Skip if not writing field.
-            if ( !pSimObject->writeField( pEntry->slotName, pEntry->value) )
-                continue;
+        // Skip if not writing field.
+        if ( !pSimObject->writeField( pEntry->slotName, pEntry->value) )
+            continue;
 
-            dynamicFieldList.push_back( pEntry );
-        }
+        dynamicFieldList.push_back( pEntry );
     }
 
     // Sort Entries to prevent version control conflicts
@@ -793,6 +1140,67 @@ void Taml::compileDynamicFields( TamlWriteNode* pTamlWriteNode )
 
 //-----------------------------------------------------------------------------
 
+void Taml::compileIncrementalFields( TamlWriteNode* pTamlWriteNode )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Taml_CompileIncrementalFields);
+
+    // Sanity!
+    AssertFatal( pTamlWriteNode != NULL, "Cannot compile incremental fields on a NULL node." );
+    AssertFatal( pTamlWriteNode->mpSimObject != NULL, "Cannot compile incremental fields on a node with no object." );
+
+    // Fetch object.
+    SimObject* pSimObject = pTamlWriteNode->mpSimObject;
+
+    // Find the fields from a previous write.
+    typeIncrementalHash::iterator fieldsItr = mIncrementalFields.find( pSimObject->getId() );
+
+    IncrementalFields* pIncrementalFields;
+
+    // Were the fields previously compiled?
+    if ( fieldsItr != mIncrementalFields.end() )
+    {
+        // Yes, so fetch them.
+        pIncrementalFields = fieldsItr->value;
+
+        // Flag as written.
+        pIncrementalFields->mWriteCount = mIncrementalWriteCount;
+
+        // Has the object changed since?
+        // NOTE: An object reusing the Id of a deleted one is always modified since it was constructed.
+        if ( !pSimObject->isTamlModifiedSince( pIncrementalFields->mSequence ) )
+        {
+            // No, so reuse the fields.
+            pTamlWriteNode->mFields = pIncrementalFields->mFields;
+            pTamlWriteNode->mSharedFields = true;
+            return;
+        }
+
+        // Discard the stale fields.
+        pIncrementalFields->resetFields();
+    }
+    else
+    {
+        // No, so create them.
+        pIncrementalFields = new IncrementalFields();
+        pIncrementalFields->mWriteCount = mIncrementalWriteCount;
+        mIncrementalFields.insert( pSimObject->getId(), pIncrementalFields );
+    }
+
+    // Note the modification sequence before compiling so any change from here on is detected.
+    pIncrementalFields->mSequence = SimObject::getTamlModifySequence();
+
+    // Compile static and dynamic fields.
+    compileStaticFields( pTamlWriteNode );
+    compileDynamicFields( pTamlWriteNode );
+
+    // Keep the fields for the next write.
+    pIncrementalFields->mFields = pTamlWriteNode->mFields;
+    pTamlWriteNode->mSharedFields = true;
+}
+
+//-----------------------------------------------------------------------------
+
 void Taml::compileChildren( TamlWriteNode* pTamlWriteNode )
 {
     // Debug Profiling.
@@ -812,12 +1220,24 @@ void Taml::compileChildren( TamlWriteNode* pTamlWriteNode )
     if ( pChildren == NULL || pChildren->getTamlChildCount() == 0 )
         return;
 
-    // Create children vector.
-    pTamlWriteNode->mChildren = new typeNodeVector();
-
     // Fetch the child count.
     const U32 childCount = pChildren->getTamlChildCount();
 
+    // Are we streaming nodes?
+    if ( mStreamNodes )
+    {
+        // Yes, so compile and release the children in turn.
+        for ( U32 childIndex = 0; childIndex < childCount; childIndex++ )
+        {
+            releaseStreamedNode( compileObject( pChildren->getTamlChild(childIndex) ) );
+        }
+
+        return;
+    }
+
+    // Create children vector.
+    pTamlWriteNode->mChildren = new typeNodeVector();
+
     // Iterate children.
     for ( U32 childIndex = 0; childIndex < childCount; childIndex++ )
     {
@@ -1323,7 +1743,7 @@ bool Taml::generateTamlSchema()
         pSchemaElement->LinkEndChild( pFieldAttributeGroupElement );
 
         // Fetch field list.
-        const AbstractClassRep::FieldList& fields = pType->mFieldList;
+        const AbstractClassRep::FieldList& fields = pType->getFieldList();
 
         // Fetcj field count.
         const S32 fieldCount = fields.size();
@@ -60,6 +60,7 @@
 extern StringTableEntry tamlRefIdName;
 extern StringTableEntry tamlRefToIdName;
 extern StringTableEntry tamlNamedObjectName;
+extern StringTableEntry tamlTemplateName;
 
 //-----------------------------------------------------------------------------
 
@@ -87,8 +88,33 @@ private:
     typedef Vector<TamlWriteNode*>                  typeNodeVector;
     typedef HashMap<SimObjectId, TamlWriteNode*>    typeCompiledHash;
 
+    /// The fields compiled for an object by a previous incremental write.
+    struct IncrementalFields
+    {
+        ~IncrementalFields() { resetFields(); }
+
+        void resetFields( void )
+        {
+            for( Vector<TamlWriteNode::FieldValuePair*>::iterator itr = mFields.begin(); itr != mFields.end(); ++itr )
+                delete (*itr);
+            mFields.clear();
+        }
+
+        U32 mSequence;
+        U32 mWriteCount;
+        Vector<TamlWriteNode::FieldValuePair*> mFields;
+    };
+    typedef HashMap<SimObjectId, IncrementalFields*> typeIncrementalHash;
+    typedef HashMap<SimObjectId, U32>               typeSharedHash;
+
     typeNodeVector      mCompiledNodes;
     typeCompiledHash    mCompiledObjects;
+    typeIncrementalHash mIncrementalFields;
+    U32                 mIncrementalWriteCount;
+    bool                mIncrementalWriteDefaults;
+    typeSharedHash      mSharedObjects;
+    TamlStreamWriter*   mpStreamWriter;
+    bool                mStreamNodes;
     U32                 mMasterNodeId;
     TamlFormatMode      mFormatMode;
     StringTableEntry    mAutoFormatXmlExtension;
@@ -99,19 +125,30 @@ private:
     bool                mAutoFormat;
     bool                mWriteDefaults;
     bool                mProgenitorUpdate;
+    bool                mIncrementalWrite;
+    bool                mStreamWrite;
     char                mFilePathBuffer[1024];
 
 private:
     void resetCompilation( void );
+    void resetIncrementalFields( void );
+    void pruneIncrementalFields( void );
+    void releaseStreamedNode( TamlWriteNode* pTamlWriteNode );
+    void releaseCompiledNodes( const U32 startIndex );
+
+    void scanSharedObjects( SimObject* pSimObject, const bool forceId = false );
+    void scanSharedCustomNode( const TamlCustomNode* pCustomNode );
 
     TamlWriteNode* compileObject( SimObject* pSimObject, const bool forceId = false );
     void compileStaticFields( TamlWriteNode* pTamlWriteNode );
     void compileDynamicFields( TamlWriteNode* pTamlWriteNode );
+    void compileIncrementalFields( TamlWriteNode* pTamlWriteNode );
     void compileChildren( TamlWriteNode* pTamlWriteNode );
     void compileCustomState( TamlWriteNode* pTamlWriteNode );
     void compileCustomNodeState( TamlCustomNode* pCustomNode );
 
     bool write( FileStream& stream, SimObject* pSimObject, const TamlFormatMode formatMode );
+    bool writeStreamed( FileStream& stream, SimObject* pSimObject, TamlStreamWriter& streamWriter );
     SimObject* read( FileStream& stream, const TamlFormatMode formatMode );
     template<typename T> inline T* read( FileStream& stream, const TamlFormatMode formatMode )
     {
@@ -127,7 +164,7 @@ private:
 
 public:
     Taml();
-    virtual ~Taml() {}
+    virtual ~Taml() { resetIncrementalFields(); }
 
     virtual bool onAdd();
     virtual void onRemove();
@@ -149,6 +186,19 @@ public:
     inline void setProgenitorUpdate( const bool progenitorUpdate ) { mProgenitorUpdate = progenitorUpdate; }
     inline bool getProgenitorUpdate( void ) const { return mProgenitorUpdate; }
 
+    /// Incremental write.
+    /// When on, the fields compiled for each object are kept between writes and reused for objects that haven't
+    /// changed since (see SimObject::isTamlModifiedSince()).  Complete documents are always written.
+    inline void setIncrementalWrite( const bool incrementalWrite ) { mIncrementalWrite = incrementalWrite; if ( !incrementalWrite ) resetIncrementalFields(); }
+    inline bool getIncrementalWrite( void ) const { return mIncrementalWrite; }
+
+    /// Stream write.
+    /// When on, XML and JSON writes pass each node to the format writer as it is compiled and release it
+    /// afterwards rather than compiling the whole tree first.  Objects are scanned beforehand to find those
+    /// that need reference Ids.  Binary writes always compile the whole tree as the schema precedes the body.
+    inline void setStreamWrite( const bool streamWrite ) { mStreamWrite = streamWrite; }
+    inline bool getStreamWrite( void ) const { return mStreamWrite; }
+
     /// Auto-format extensions.
     inline void setAutoFormatXmlExtension( const char* pExtension ) { mAutoFormatXmlExtension = StringTable->insert( pExtension ); }
     inline StringTableEntry getAutoFormatXmlExtension( void ) const { return mAutoFormatXmlExtension; }
@@ -170,6 +220,10 @@ public:
     /// Write.
     bool write( SimObject* pSimObject, const char* pFilename );
 
+    /// Compile an object without writing it.
+    /// The compiled nodes remain valid until the next compile, read or write.
+    const TamlWriteNode* compile( SimObject* pSimObject );
+
     /// Read.
     template<typename T> inline T* read( const char* pFilename )
     {
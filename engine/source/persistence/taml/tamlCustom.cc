@@ -28,8 +28,8 @@
 
 //-----------------------------------------------------------------------------
 
-FactoryCache<TamlCustomField> TamlCustomFieldFactory;
-FactoryCache<TamlCustomNode> TamlCustomNodeFactory;
+FactoryCache<TamlCustomField> TamlCustomFieldFactory( "TamlCustomField" );
+FactoryCache<TamlCustomNode> TamlCustomNodeFactory( "TamlCustomNode" );
 
 //-----------------------------------------------------------------------------
 
@@ -0,0 +1,266 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "persistence/taml/tamlTemplates.h"
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+TamlTemplates::typeTemplateHash TamlTemplates::smTemplates;
+
+//-----------------------------------------------------------------------------
+
+const TamlWriteNode* TamlTemplates::findTemplate( const char* pTemplateFile )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlTemplates_FindTemplate);
+
+    // Sanity!
+    AssertFatal( pTemplateFile != NULL, "TamlTemplates::findTemplate() - Cannot find a NULL template file." );
+
+    // Expand the template file.
+    char templateFileBuffer[1024];
+    Con::expandPath( templateFileBuffer, sizeof(templateFileBuffer), pTemplateFile );
+    StringTableEntry templateFile = StringTable->insert( templateFileBuffer );
+
+    // Is the template already cached?
+    typeTemplateHash::iterator templateItr = smTemplates.find( templateFile );
+    if ( templateItr != smTemplates.end() )
+        return templateItr->value->mpRootNode;
+
+    // No, so create it.
+    // NOTE: The template is cached even if it could not be read so it isn't read again for each instance.
+    Template* pTemplate = new Template();
+    pTemplate->mpTemplateObject = NULL;
+    pTemplate->mpRootNode = NULL;
+    smTemplates.insert( templateFile, pTemplate );
+
+    // Create a Taml instance to read and compile the template.
+    pTemplate->mpTaml = new Taml();
+    pTemplate->mpTaml->registerObject();
+
+    // Read the template.
+    pTemplate->mpTemplateObject = pTemplate->mpTaml->read( templateFile );
+    if ( pTemplate->mpTemplateObject == NULL )
+    {
+        // Warn.
+        Con::warnf( "TamlTemplates::findTemplate() - Could not read the template file '%s'.", templateFile );
+        return NULL;
+    }
+
+    // Compile the template.
+    const TamlWriteNode* pRootNode = pTemplate->mpTaml->compile( pTemplate->mpTemplateObject );
+
+    // Is the template supported?
+    if ( !isSupported( pRootNode ) )
+    {
+        // No, so warn.
+        Con::warnf( "TamlTemplates::findTemplate() - Cannot use the file '%s' as a template as it has reference Ids or custom nodes holding objects.", templateFile );
+        return NULL;
+    }
+
+    pTemplate->mpRootNode = pRootNode;
+
+    return pRootNode;
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlTemplates::clear( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlTemplates_Clear);
+
+    // Delete the templates.
+    for( typeTemplateHash::iterator templateItr = smTemplates.begin(); templateItr != smTemplates.end(); ++templateItr )
+    {
+        Template* pTemplate = templateItr->value;
+
+        // Delete the Taml instance first as its compiled nodes refer to the template objects.
+        pTemplate->mpTaml->deleteObject();
+
+        if ( pTemplate->mpTemplateObject != NULL )
+            pTemplate->mpTemplateObject->deleteObject();
+
+        delete pTemplate;
+    }
+    smTemplates.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlTemplates::applyFields( SimObject* pSimObject, const TamlWriteNode* pTemplate )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlTemplates_ApplyFields);
+
+    // Set the fields.
+    for( Vector<TamlWriteNode::FieldValuePair*>::const_iterator fieldItr = pTemplate->mFields.begin(); fieldItr != pTemplate->mFields.end(); ++fieldItr )
+    {
+        pSimObject->setPrefixedDataField( (*fieldItr)->mName, NULL, (*fieldItr)->mpValue );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlTemplates::addChildren( Taml* pTaml, SimObject* pSimObject, const TamlWriteNode* pTemplate )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlTemplates_AddChildren);
+
+    // Finish if the template has no children.
+    if ( pTemplate->mChildren == NULL )
+        return;
+
+    // Fetch the Taml children.
+    TamlChildren* pChildren = dynamic_cast<TamlChildren*>( pSimObject );
+
+    // Finish if the object cannot have children.
+    if ( pChildren == NULL )
+    {
+        // Warn.
+        Con::warnf( "TamlTemplates::addChildren() - Template of type '%s' has children but the instance of type '%s' cannot have children.",
+            getTypeName( pTemplate ), pSimObject->getClassName() );
+        return;
+    }
+
+    // Add instances of the children.
+    for( Vector<TamlWriteNode*>::const_iterator childItr = pTemplate->mChildren->begin(); childItr != pTemplate->mChildren->end(); ++childItr )
+    {
+        // Create the child.
+        SimObject* pChildSimObject = createInstance( pTaml, *childItr );
+
+        // Skip if the child was not created.
+        if ( pChildSimObject == NULL )
+            continue;
+
+        // Add child.
+        pChildren->addTamlChild( pChildSimObject );
+
+        // Find Taml callbacks for child.
+        TamlCallbacks* pChildCallbacks = dynamic_cast<TamlCallbacks*>( pChildSimObject );
+
+        // Do we have callbacks on the child?
+        if ( pChildCallbacks != NULL )
+        {
+            // Yes, so perform callback.
+            pTaml->tamlAddParent( pChildCallbacks, pSimObject );
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+SimObject* TamlTemplates::createInstance( Taml* pTaml, const TamlWriteNode* pTemplate )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlTemplates_CreateInstance);
+
+    // Create type.
+    SimObject* pSimObject = Taml::createType( getTypeName( pTemplate ), pTaml );
+
+    // Finish if we couldn't create the type.
+    if ( pSimObject == NULL )
+        return NULL;
+
+    // Find Taml callbacks.
+    TamlCallbacks* pCallbacks = dynamic_cast<TamlCallbacks*>( pSimObject );
+
+    // Are there any Taml callbacks?
+    if ( pCallbacks != NULL )
+    {
+        // Yes, so call it.
+        pTaml->tamlPreRead( pCallbacks );
+    }
+
+    // Apply the fields and register.
+    applyFields( pSimObject, pTemplate );
+    pSimObject->registerObject();
+
+    // Add the children.
+    addChildren( pTaml, pSimObject, pTemplate );
+
+    // Are there any Taml callbacks?
+    if ( pCallbacks != NULL )
+    {
+        // Yes, so call them.
+        pTaml->tamlCustomRead( pCallbacks, pTemplate->mCustomNodes );
+        pTaml->tamlPostRead( pCallbacks, pTemplate->mCustomNodes );
+    }
+
+    return pSimObject;
+}
+
+//-----------------------------------------------------------------------------
+
+bool TamlTemplates::isSupported( const TamlWriteNode* pTemplate )
+{
+    // Reference Ids are not supported.
+    if ( pTemplate->mRefId != 0 || pTemplate->mRefToNode != NULL )
+        return false;
+
+    // Check the custom nodes.
+    const TamlCustomNodeVector& customNodes = pTemplate->mCustomNodes.getNodes();
+    for( TamlCustomNodeVector::const_iterator customNodeItr = customNodes.begin(); customNodeItr != customNodes.end(); ++customNodeItr )
+    {
+        if ( !isSupported( *customNodeItr ) )
+            return false;
+    }
+
+    // Finish if there are no children.
+    if ( pTemplate->mChildren == NULL )
+        return true;
+
+    // Check the children.
+    for( Vector<TamlWriteNode*>::const_iterator childItr = pTemplate->mChildren->begin(); childItr != pTemplate->mChildren->end(); ++childItr )
+    {
+        if ( !isSupported( *childItr ) )
+            return false;
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool TamlTemplates::isSupported( const TamlCustomNode* pCustomNode )
+{
+    // Custom nodes holding objects are not supported.
+    if ( pCustomNode->isProxyObject() )
+        return false;
+
+    // Check the children.
+    const TamlCustomNodeVector& children = pCustomNode->getChildren();
+    for( TamlCustomNodeVector::const_iterator childItr = children.begin(); childItr != children.end(); ++childItr )
+    {
+        if ( !isSupported( *childItr ) )
+            return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,95 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _TAML_TEMPLATES_H_
+#define _TAML_TEMPLATES_H_
+
+#ifndef _TAML_H_
+#include "persistence/taml/taml.h"
+#endif
+
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// Templates allow a Taml element to be an instance of an object stored in another Taml file.
+///
+/// The element names the template file with the "TamlTemplate" attribute.  The template file
+/// is read and compiled once then each instance is created from its compiled fields, children
+/// and custom nodes without parsing the file again.  Any other attributes on the element are
+/// applied afterwards as overrides and any child elements are added after the template children:
+///
+/// @code
+/// <CompositeSprite TamlTemplate="^MyModule/prefabs/crate.taml" Position="10 4" />
+/// @endcode
+///
+/// Template objects are kept whilst the template is cached so they should not be named.
+/// Reference Ids within a template and custom nodes holding objects are not supported.
+///
+/// @ingroup tamlGroup
+/// @see tamlGroup
+class TamlTemplates
+{
+public:
+    /// Find a template, reading and compiling it on first use.
+    /// @return The compiled template or NULL if the file could not be used as a template.
+    static const TamlWriteNode* findTemplate( const char* pTemplateFile );
+
+    /// Discard all the cached templates so they are read again when next used.
+    static void clear( void );
+
+    /// Get the type an instance of the template should be created as.
+    static inline StringTableEntry getTypeName( const TamlWriteNode* pTemplate ) { return StringTable->insert( pTemplate->mpSimObject->getClassName() ); }
+
+    /// Apply the fields of a template to an instance that has not yet been registered.
+    static void applyFields( SimObject* pSimObject, const TamlWriteNode* pTemplate );
+
+    /// Add instances of the template children to a registered instance.
+    static void addChildren( Taml* pTaml, SimObject* pSimObject, const TamlWriteNode* pTemplate );
+
+    /// Fetch the custom nodes an instance should read.
+    /// Custom nodes on the instance element replace those of the template.
+    static inline const TamlCustomNodes& getCustomNodes( const TamlWriteNode* pTemplate, const TamlCustomNodes& customNodes )
+    {
+        return pTemplate == NULL || customNodes.getNodes().size() > 0 ? customNodes : pTemplate->mCustomNodes;
+    }
+
+private:
+    struct Template
+    {
+        Taml* mpTaml;
+        SimObject* mpTemplateObject;
+        const TamlWriteNode* mpRootNode;
+    };
+
+    typedef HashMap<StringTableEntry, Template*> typeTemplateHash;
+
+    static typeTemplateHash smTemplates;
+
+    static SimObject* createInstance( Taml* pTaml, const TamlWriteNode* pTemplate );
+    static bool isSupported( const TamlWriteNode* pTemplate );
+    static bool isSupported( const TamlCustomNode* pCustomNode );
+};
+
+#endif // _TAML_TEMPLATES_H_
@@ -33,11 +33,16 @@ void TamlWriteNode::resetNode( void )
     PROFILE_SCOPE(TamlWriteNode_ResetNode);
 
     // Clear fields.
-    for( Vector<TamlWriteNode::FieldValuePair*>::iterator itr = mFields.begin(); itr != mFields.end(); ++itr )
+    // NOTE: Shared fields are owned by the incremental write state of Taml.
+    if ( !mSharedFields )
     {
-        delete (*itr)->mpValue;
+        for( Vector<TamlWriteNode::FieldValuePair*>::iterator itr = mFields.begin(); itr != mFields.end(); ++itr )
+        {
+            delete (*itr);
+        }
     }
     mFields.clear();
+    mSharedFields = false;
 
     // Clear children.
     if ( mChildren != NULL )
@@ -35,33 +35,46 @@
 #include "collection/vector.h"
 #endif
 
+#ifndef _POOL_ALLOCATED_H_
+#include "memory/poolAllocated.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 class TamlCallbacks;
+class FileStream;
 
 //-----------------------------------------------------------------------------
 
 /// @ingroup tamlGroup
 /// @see tamlGroup
-class TamlWriteNode
+class TamlWriteNode : public PoolAllocated<TamlWriteNode>
 {
 public:
     class FieldValuePair
     {
     public:        
-        FieldValuePair( StringTableEntry name, const char* pValue )
+        FieldValuePair( StringTableEntry name, const char* pValue, const AbstractClassRep::Field* pField = NULL )
         {
             // Set the field name.
             mName = name;
 
+            // Set the static field (if any).
+            mpField = pField;
+
             // Allocate and copy the value.
             mpValue = new char[ dStrlen(pValue)+1 ];
             dStrcpy( (char *)mpValue, pValue );
         }
-        
+
+        ~FieldValuePair()
+        {
+            delete [] mpValue;
+        }
 
         StringTableEntry    mName;
         const char*         mpValue;
+        const AbstractClassRep::Field* mpField;
     };
 
 public:
@@ -73,6 +86,7 @@ public:
         mpTamlCallbacks = NULL;
         mpObjectName = NULL;
         mChildren = NULL;
+        mSharedFields = false;
 
         resetNode();
     }
@@ -111,8 +125,39 @@ public:
     TamlCallbacks*              mpTamlCallbacks;
     const char*                 mpObjectName;
     Vector<TamlWriteNode::FieldValuePair*> mFields;
+    bool                        mSharedFields;
     Vector<TamlWriteNode*>*     mChildren;
     TamlCustomNodes             mCustomNodes;
 };
 
+//-----------------------------------------------------------------------------
+
+/// A format writer that writes nodes as they are compiled rather than from a complete compiled tree.
+///
+/// Nodes are passed depth-first: a node is begun once its fields are compiled and ended once
+/// its children and custom state are compiled.  The children of a node are begun and ended in
+/// between and are not available from TamlWriteNode::mChildren.  Each node is released once
+/// it has been ended.  Reference Ids are known when a node is begun.
+///
+/// @ingroup tamlGroup
+/// @see tamlGroup
+class TamlStreamWriter
+{
+public:
+    virtual ~TamlStreamWriter() {}
+
+    /// Start writing to the stream.
+    virtual void beginWrite( FileStream& stream ) = 0;
+
+    /// Finish writing.
+    /// @return Whether the write succeeded or not.
+    virtual bool endWrite( void ) = 0;
+
+    /// Write a node whose fields are compiled.
+    virtual void beginNode( const TamlWriteNode* pTamlWriteNode ) = 0;
+
+    /// Finish writing a node whose children and custom state are compiled.
+    virtual void endNode( const TamlWriteNode* pTamlWriteNode ) = 0;
+};
+
 #endif // _TAML_WRITE_NODE_H_
\ No newline at end of file
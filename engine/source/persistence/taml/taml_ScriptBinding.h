@@ -366,3 +366,13 @@ ConsoleFunctionWithDocs(GenerateTamlSchema, ConsoleBool, 1, 1, ())
     // Generate the schema.
     return Taml::generateTamlSchema();
 }
+
+//-----------------------------------------------------------------------------
+
+/*! Discard all the cached Taml templates so that they are read again when next instanced.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(ClearTamlTemplates, ConsoleVoid, 1, 1, ())
+{
+    TamlTemplates::clear();
+}
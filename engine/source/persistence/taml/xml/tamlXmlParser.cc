@@ -57,6 +57,41 @@ bool TamlXmlParser::accept( const char* pFilename, TamlVisitor& visitor )
         return false;
     }
 
+    // Does the visitor want to change properties?
+    if ( !visitor.wantsPropertyChanges() )
+    {
+        // No, so stream the document as the document doesn't need to be saved.
+        TamlXmlTokenizer tokenizer( stream );
+
+        // Set parsing filename.
+        setParsingFilename( filenameBuffer );
+
+        // Find the root element.
+        TamlXmlTokenizer::Token token = tokenizer.next();
+        while ( token == TamlXmlTokenizer::TextToken )
+            token = tokenizer.next();
+
+        // Parse root element.
+        if ( token == TamlXmlTokenizer::StartElementToken )
+            parseStreamElement( tokenizer, visitor, true );
+
+        // Reset parsing filename.
+        setParsingFilename( StringTable->EmptyString );
+
+        // Close the stream.
+        stream.close();
+
+        // Did the document parse?
+        if ( token != TamlXmlTokenizer::StartElementToken || tokenizer.getError() != NULL )
+        {
+            // No, so warn.
+            Con::warnf("TamlXmlParser: Could not load Taml XML file from stream.");
+            return false;
+        }
+
+        return true;
+    }
+
     TiXmlDocument xmlDocument;
 
     // Load document from stream.
@@ -143,6 +178,48 @@ inline bool TamlXmlParser::parseElement( TiXmlElement* pXmlElement, TamlVisitor&
 
 //-----------------------------------------------------------------------------
 
+bool TamlXmlParser::parseStreamElement( TamlXmlTokenizer& tokenizer, TamlVisitor& visitor, const bool isRoot )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlXmlParser_ParseStreamElement);
+
+    // Create a visitor property state.
+    TamlVisitor::PropertyState propertyState;
+    propertyState.setObjectName( tokenizer.getName(), isRoot );
+
+    // Iterate attributes.
+    const U32 attributeCount = tokenizer.getAttributeCount();
+    for ( U32 index = 0; index < attributeCount; ++index )
+    {
+        // Configure property state.
+        propertyState.setProperty( tokenizer.getAttributeName( index ), tokenizer.getAttributeValue( index ) );
+
+        // Visit this attribute (stop processing if instructed).
+        if ( !visitor.visit( *this, propertyState ) )
+            return false;
+    }
+
+    // Finish if only the root is needed.
+    if ( visitor.wantsRootOnly() )
+        return false;
+
+    // Iterate children as they are read.
+    for ( TamlXmlTokenizer::Token token = tokenizer.next(); token != TamlXmlTokenizer::EndElementToken; token = tokenizer.next() )
+    {
+        // Finish if the document is malformed.
+        if ( token == TamlXmlTokenizer::ErrorToken || token == TamlXmlTokenizer::EndOfDocumentToken )
+            return false;
+
+        // Parse element (stop processing if instructed).
+        if ( token == TamlXmlTokenizer::StartElementToken && !parseStreamElement( tokenizer, visitor, false ) )
+            return false;
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
 inline bool TamlXmlParser::parseAttributes( TiXmlElement* pXmlElement, TamlVisitor& visitor )
 {
     // Debug Profiling.
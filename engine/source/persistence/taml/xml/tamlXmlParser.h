@@ -31,8 +31,15 @@
 #include "persistence/tinyXML/tinyxml.h"
 #endif
 
+#ifndef _TAML_XMLTOKENIZER_H_
+#include "persistence/taml/xml/tamlXmlTokenizer.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
+/// Visitors that don't change properties are given the document as it is streamed
+/// so that parsing stops as soon as the visitor has what it needs.
+///
 /// @ingroup tamlGroup
 /// @see tamlGroup
 class TamlXmlParser : public TamlParser
@@ -50,6 +57,7 @@ public:
 private:
     inline bool parseElement( TiXmlElement* pXmlElement, TamlVisitor& visitor );
     inline bool parseAttributes( TiXmlElement* pXmlElement, TamlVisitor& visitor );
+    bool parseStreamElement( TamlXmlTokenizer& tokenizer, TamlVisitor& visitor, const bool isRoot );
 
     bool mDocumentDirty;
 };
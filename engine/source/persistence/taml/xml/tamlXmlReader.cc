@@ -22,16 +22,211 @@
 
 #include "persistence/taml/xml/tamlXmlReader.h"
 
+#ifndef _PLATFORM_THREADS_THREADPOOL_H_
+#include "platform/threads/threadPool.h"
+#endif
+
+#ifndef _CONSOLE_VARIABLE_REF_H_
+#include "console/consoleVariableRef.h"
+#endif
+
+#ifndef _TAML_TEMPLATES_H_
+#include "persistence/taml/tamlTemplates.h"
+#endif
+
 // Debug Profiling.
 #include "debug/profiler.h"
 
 //-----------------------------------------------------------------------------
 
+static Con::VariableRef<S32> sParallelReadSizeVariable( "pref::Taml::parallelReadSize", 32768 );
+static Con::VariableRef<bool> sStreamingReadVariable( "pref::Taml::streamingRead", true );
+
+//-----------------------------------------------------------------------------
+
+/// A span of document text.
+struct TamlXmlSpan
+{
+    const char* mpStart;
+    const char* mpEnd;
+};
+
+//-----------------------------------------------------------------------------
+
+/// The child element subtrees of a document being parsed in parallel.
+struct TamlXmlSubtrees
+{
+    Vector<TamlXmlSpan> mSpans;
+    Vector<TiXmlDocument*> mDocuments;
+    TiXmlEncoding mEncoding;
+};
+
+//-----------------------------------------------------------------------------
+
+static const char* skipXmlPast( const char* pText, const char* pTerminator )
+{
+    // Find the terminator.
+    const char* pFound = dStrstr( pText, pTerminator );
+
+    // Return the text following it.
+    return pFound == NULL ? NULL : pFound + dStrlen( pTerminator );
+}
+
+//-----------------------------------------------------------------------------
+
+static const char* skipXmlTag( const char* pText, bool& selfClosing )
+{
+    // Skip to the end of the tag respecting quoted attribute values.
+    char quote = 0;
+    for ( ; *pText != 0; ++pText )
+    {
+        if ( quote != 0 )
+        {
+            if ( *pText == quote )
+                quote = 0;
+        }
+        else if ( *pText == '"' || *pText == '\'' )
+        {
+            quote = *pText;
+        }
+        else if ( *pText == '>' )
+        {
+            selfClosing = *(pText-1) == '/';
+            return pText + 1;
+        }
+    }
+
+    return NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+static const char* skipXmlMarkup( const char* pText )
+{
+    // Skip any comment, processing instruction, CDATA or declaration.
+    if ( dStrncmp( pText, "<!--", 4 ) == 0 )
+        return skipXmlPast( pText + 4, "-->" );
+
+    if ( dStrncmp( pText, "<![CDATA[", 9 ) == 0 )
+        return skipXmlPast( pText + 9, "]]>" );
+
+    if ( dStrncmp( pText, "<?", 2 ) == 0 )
+        return skipXmlPast( pText + 2, "?>" );
+
+    if ( dStrncmp( pText, "<!", 2 ) == 0 )
+        return skipXmlPast( pText + 2, ">" );
+
+    return pText;
+}
+
+//-----------------------------------------------------------------------------
+
+static const char* skipXmlElement( const char* pText )
+{
+    // Skip the start tag.
+    bool selfClosing = false;
+    pText = skipXmlTag( pText, selfClosing );
+    if ( pText == NULL || selfClosing )
+        return pText;
+
+    // Skip the content to the matching end tag.
+    U32 depth = 1;
+    while ( pText != NULL && *pText != 0 )
+    {
+        // Skip text.
+        if ( *pText != '<' )
+        {
+            ++pText;
+            continue;
+        }
+
+        // Is this an end tag?
+        if ( pText[1] == '/' )
+        {
+            pText = skipXmlPast( pText, ">" );
+            if ( --depth == 0 )
+                return pText;
+
+            continue;
+        }
+
+        // Skip any other markup.
+        const char* pMarkupEnd = skipXmlMarkup( pText );
+        if ( pMarkupEnd != pText )
+        {
+            pText = pMarkupEnd;
+            continue;
+        }
+
+        // Skip the child start tag.
+        pText = skipXmlTag( pText, selfClosing );
+        if ( !selfClosing )
+            ++depth;
+    }
+
+    return NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+static const char* skipXmlSpace( const char* pText )
+{
+    while ( *pText == ' ' || *pText == '\t' || *pText == '\n' || *pText == '\r' )
+        ++pText;
+
+    return pText;
+}
+
+//-----------------------------------------------------------------------------
+
+static bool hasXmlByteOrderMark( const char* pText )
+{
+    // Check for the UTF-8 byte order mark.
+    const U8* pBytes = (const U8*)pText;
+    return pBytes[0] == 0xef && pBytes[1] == 0xbb && pBytes[2] == 0xbf;
+}
+
+//-----------------------------------------------------------------------------
+
+static void parseXmlSubtreeRange( void* pContext, const U32 start, const U32 end )
+{
+    TamlXmlSubtrees* pSubtrees = (TamlXmlSubtrees*)pContext;
+
+    for ( U32 index = start; index < end; ++index )
+    {
+        // Copy the subtree text.
+        const TamlXmlSpan& span = pSubtrees->mSpans[index];
+        const U32 length = (U32)(span.mpEnd - span.mpStart);
+        char* pBuffer = new char[length + 1];
+        dMemcpy( pBuffer, span.mpStart, length );
+        pBuffer[length] = 0;
+
+        // Parse the subtree as its own document.
+        TiXmlDocument* pDocument = new TiXmlDocument();
+        pDocument->Parse( pBuffer, NULL, pSubtrees->mEncoding );
+        pSubtrees->mDocuments[index] = pDocument;
+
+        delete [] pBuffer;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 SimObject* TamlXmlReader::read( FileStream& stream )
 {
     // Debug Profiling.
     PROFILE_SCOPE(TamlXmlReader_Read);
 
+    // Use the pipeline for large documents if there are workers to share the parsing.
+    const U32 streamSize = stream.getStreamSize();
+    const S32 parallelReadSize = sParallelReadSizeVariable;
+    if ( parallelReadSize > 0 && streamSize >= (U32)parallelReadSize && ThreadPool::getGlobal()->getWorkerCount() > 0 )
+        return readPipelined( stream, streamSize );
+
+    // Stream the document if configured.
+    if ( sStreamingReadVariable )
+        return readStreaming( stream );
+
     // Create document.
     TiXmlDocument xmlDocument;
 
@@ -54,6 +249,580 @@ SimObject* TamlXmlReader::read( FileStream& stream )
 
 //-----------------------------------------------------------------------------
 
+SimObject* TamlXmlReader::readPipelined( FileStream& stream, const U32 streamSize )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlXmlReader_ReadPipelined);
+
+    // Read the document text.
+    char* pText = new char[streamSize + 1];
+    if ( !stream.read( streamSize, pText ) )
+    {
+        // Warn!
+        Con::warnf("Taml: Could not load Taml XML file from stream.");
+        delete [] pText;
+        return NULL;
+    }
+
+    // Normalize new lines in place as the document loader does.
+    const char* pRead = pText;
+    char* pWrite = pText;
+    const char* pTextEnd = pText + streamSize;
+    while ( pRead < pTextEnd )
+    {
+        if ( *pRead == '\r' )
+        {
+            *pWrite++ = '\n';
+            if ( ++pRead < pTextEnd && *pRead == '\n' )
+                ++pRead;
+            continue;
+        }
+
+        *pWrite++ = *pRead++;
+    }
+    *pWrite = 0;
+
+    // Skip the prolog.
+    const char* pRootStart = skipXmlSpace( pText );
+    if ( hasXmlByteOrderMark( pRootStart ) )
+        pRootStart = skipXmlSpace( pRootStart + 3 );
+    while ( pRootStart != NULL && *pRootStart == '<' && pRootStart[1] != 0 && (pRootStart[1] == '?' || pRootStart[1] == '!') )
+        pRootStart = skipXmlSpace( skipXmlMarkup( pRootStart ) );
+
+    // Find the root start tag.
+    bool rootSelfClosing = true;
+    const char* pRootContent = pRootStart != NULL && *pRootStart == '<' ? skipXmlTag( pRootStart, rootSelfClosing ) : NULL;
+
+    // Find the root child subtrees.
+    TamlXmlSubtrees subtrees;
+    const char* pScan = rootSelfClosing ? NULL : pRootContent;
+    while ( pScan != NULL && *pScan != 0 )
+    {
+        // Skip text.
+        if ( *pScan != '<' )
+        {
+            ++pScan;
+            continue;
+        }
+
+        // Finish at the root end tag.
+        if ( pScan[1] == '/' )
+            break;
+
+        // Skip comments and processing instructions.
+        const char* pMarkupEnd = skipXmlMarkup( pScan );
+        if ( pMarkupEnd != pScan )
+        {
+            // Text content under the root can't be split out so stop.
+            if ( dStrncmp( pScan, "<![CDATA[", 9 ) == 0 )
+                pMarkupEnd = NULL;
+
+            pScan = pMarkupEnd;
+            continue;
+        }
+
+        // Add the child subtree.
+        TamlXmlSpan span;
+        span.mpStart = pScan;
+        span.mpEnd = pScan = skipXmlElement( pScan );
+        if ( span.mpEnd != NULL )
+            subtrees.mSpans.push_back( span );
+    }
+
+    // Fall back to parsing the whole document if it could not be split.
+    if ( pScan == NULL || *pScan == 0 || subtrees.mSpans.size() < 2 )
+    {
+        TiXmlDocument xmlDocument;
+        xmlDocument.Parse( pText );
+        delete [] pText;
+
+        // Did the document parse?
+        if ( xmlDocument.Error() || xmlDocument.RootElement() == NULL )
+        {
+            // No, so warn.
+            Con::warnf("Taml: Could not load Taml XML file from stream.");
+            return NULL;
+        }
+
+        // Parse root element.
+        SimObject* pSimObject = parseElement( xmlDocument.RootElement() );
+
+        // Reset parse.
+        resetParse();
+
+        return pSimObject;
+    }
+
+    // Parse the prolog and an empty root element.
+    TiXmlDocument rootDocument;
+    {
+        const char* pRootNameEnd = pRootStart + 1;
+        while ( *pRootNameEnd != 0 && *pRootNameEnd != '>' && *pRootNameEnd != '/' && *pRootNameEnd != ' ' && *pRootNameEnd != '\t' && *pRootNameEnd != '\n' )
+            ++pRootNameEnd;
+
+        const U32 headLength = (U32)(pRootContent - pText);
+        const U32 rootNameLength = (U32)(pRootNameEnd - pRootStart - 1);
+        const U32 rootTextLength = headLength + rootNameLength + 3;
+        char* pRootText = new char[rootTextLength + 1];
+        dMemcpy( pRootText, pText, headLength );
+        dSprintf( pRootText + headLength, rootNameLength + 4, "</%s", pRootStart + 1 );
+        pRootText[headLength + rootNameLength + 2] = '>';
+        pRootText[rootTextLength] = 0;
+        rootDocument.Parse( pRootText );
+        delete [] pRootText;
+    }
+
+    // Finish if the root could not be parsed.
+    if ( rootDocument.Error() || rootDocument.RootElement() == NULL )
+    {
+        Con::warnf("Taml: Could not load Taml XML file from stream.");
+        delete [] pText;
+        return NULL;
+    }
+
+    // Use the same encoding as the document for the subtrees.
+    subtrees.mEncoding = TIXML_ENCODING_UNKNOWN;
+    TiXmlDeclaration* pDeclaration = rootDocument.FirstChild() != NULL ? rootDocument.FirstChild()->ToDeclaration() : NULL;
+    if ( pDeclaration != NULL )
+    {
+        const char* pEncoding = pDeclaration->Encoding();
+        subtrees.mEncoding = ( *pEncoding == 0 || dStricmp( pEncoding, "UTF-8" ) == 0 || dStricmp( pEncoding, "UTF8" ) == 0 ) ? TIXML_ENCODING_UTF8 : TIXML_ENCODING_LEGACY;
+    }
+    else if ( hasXmlByteOrderMark( skipXmlSpace( pText ) ) )
+    {
+        subtrees.mEncoding = TIXML_ENCODING_UTF8;
+    }
+
+    // Parse the subtrees in parallel.
+    subtrees.mDocuments.setSize( subtrees.mSpans.size() );
+    ThreadPool::getGlobal()->parallelFor( parseXmlSubtreeRange, &subtrees, (U32)subtrees.mSpans.size(), 1 );
+
+    delete [] pText;
+
+    SimObject* pSimObject = NULL;
+
+    // Did all the subtrees parse?
+    bool parsed = true;
+    for ( U32 index = 0; index < (U32)subtrees.mDocuments.size(); ++index )
+    {
+        if ( subtrees.mDocuments[index]->Error() || subtrees.mDocuments[index]->RootElement() == NULL )
+            parsed = false;
+    }
+
+    if ( parsed )
+    {
+        // Yes, so create the objects.
+        pSimObject = parseElement( rootDocument.RootElement(), &subtrees.mDocuments );
+    }
+    else
+    {
+        // No, so warn.
+        Con::warnf("Taml: Could not load Taml XML file from stream.");
+    }
+
+    // Delete the subtrees.
+    for ( U32 index = 0; index < (U32)subtrees.mDocuments.size(); ++index )
+    {
+        delete subtrees.mDocuments[index];
+    }
+
+    // Reset parse.
+    resetParse();
+
+    return pSimObject;
+}
+
+//-----------------------------------------------------------------------------
+
+SimObject* TamlXmlReader::readStreaming( FileStream& stream )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlXmlReader_ReadStreaming);
+
+    // Create tokenizer.
+    TamlXmlTokenizer tokenizer( stream );
+
+    // Find the root element.
+    TamlXmlTokenizer::Token token = tokenizer.next();
+    while ( token == TamlXmlTokenizer::TextToken )
+        token = tokenizer.next();
+
+    SimObject* pSimObject = NULL;
+
+    // Parse root element.
+    if ( token == TamlXmlTokenizer::StartElementToken )
+        pSimObject = parseStreamElement( tokenizer );
+
+    // Warn if the document was malformed.
+    if ( tokenizer.getError() != NULL || token != TamlXmlTokenizer::StartElementToken )
+    {
+        Con::warnf("Taml: Could not load Taml XML file from stream.  %s [row=%d column=%d]",
+            tokenizer.getError() != NULL ? tokenizer.getError() : "No root element.",
+            tokenizer.getRow()+1,
+            tokenizer.getColumn()+1 );
+    }
+
+    // Reset parse.
+    resetParse();
+
+    return pSimObject;
+}
+
+//-----------------------------------------------------------------------------
+
+bool TamlXmlReader::skipStreamElement( TamlXmlTokenizer& tokenizer )
+{
+    // Skip the rest of the current element.
+    U32 depth = 1;
+    while ( depth > 0 )
+    {
+        const TamlXmlTokenizer::Token token = tokenizer.next();
+
+        if ( token == TamlXmlTokenizer::StartElementToken )
+            ++depth;
+        else if ( token == TamlXmlTokenizer::EndElementToken )
+            --depth;
+        else if ( token != TamlXmlTokenizer::TextToken )
+            return false;
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+SimObject* TamlXmlReader::parseStreamElement( TamlXmlTokenizer& tokenizer )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlXmlReader_ParseStreamElement);
+
+    SimObject* pSimObject = NULL;
+
+    // Fetch element name.
+    StringTableEntry typeName = StringTable->insert( tokenizer.getName() );
+
+    // Fetch reference to Id.
+    const char* pRefToId = tokenizer.findAttribute( tamlRefToIdName );
+    const U32 tamlRefToId = pRefToId != NULL ? dAtoi( pRefToId ) : 0;
+
+    // Do we have a reference to Id?
+    if ( tamlRefToId != 0 )
+    {
+        // Yes, so skip the element.
+        skipStreamElement( tokenizer );
+
+        // Fetch reference.
+        typeObjectReferenceHash::iterator referenceItr = mObjectReferenceMap.find( tamlRefToId );
+
+        // Did we find the reference?
+        if ( referenceItr == mObjectReferenceMap.end() )
+        {
+            // No, so warn.
+            Con::warnf( "Taml: Could not find a reference Id of '%d'", tamlRefToId );
+            return NULL;
+        }
+
+        // Return object.
+        return referenceItr->value;
+    }
+
+    // No, so fetch reference Id.
+    const char* pRefId = tokenizer.findAttribute( tamlRefIdName );
+    const U32 tamlRefId = pRefId != NULL ? dAtoi( pRefId ) : 0;
+
+    // Fetch any template.
+    const char* pTemplateFile = tokenizer.findAttribute( tamlTemplateName );
+    const TamlWriteNode* pTemplate = pTemplateFile != NULL ? TamlTemplates::findTemplate( pTemplateFile ) : NULL;
+
+    // Use the template type if we have a template.
+    if ( pTemplate != NULL )
+        typeName = TamlTemplates::getTypeName( pTemplate );
+
+#ifdef TORQUE_DEBUG
+    // Format the type location.
+    char typeLocationBuffer[64];
+    dSprintf( typeLocationBuffer, sizeof(typeLocationBuffer), "Taml [format='xml' row=%d column=%d]", tokenizer.getRow()+1, tokenizer.getColumn()+1 );
+
+    // Create type.
+    pSimObject = Taml::createType( typeName, mpTaml, typeLocationBuffer );
+#else
+    // Create type.
+    pSimObject = Taml::createType( typeName, mpTaml );
+#endif
+
+    // Finish if we couldn't create the type.
+    if ( pSimObject == NULL )
+    {
+        skipStreamElement( tokenizer );
+        return NULL;
+    }
+
+    // Find Taml callbacks.
+    TamlCallbacks* pCallbacks = dynamic_cast<TamlCallbacks*>( pSimObject );
+
+    // Are there any Taml callbacks?
+    if ( pCallbacks != NULL )
+    {
+        // Yes, so call it.
+        mpTaml->tamlPreRead( pCallbacks );
+    }
+
+    // Apply any template fields.
+    if ( pTemplate != NULL )
+        TamlTemplates::applyFields( pSimObject, pTemplate );
+
+    // Parse attributes.
+    const U32 attributeCount = tokenizer.getAttributeCount();
+    for ( U32 index = 0; index < attributeCount; ++index )
+    {
+        // Insert attribute name.
+        StringTableEntry attributeName = StringTable->insert( tokenizer.getAttributeName( index ) );
+
+        // Ignore if this is a Taml attribute.
+        if (    attributeName == tamlRefIdName ||
+                attributeName == tamlRefToIdName ||
+                attributeName == tamlNamedObjectName ||
+                attributeName == tamlTemplateName )
+            continue;
+
+        // Set the field.
+        pSimObject->setPrefixedDataField( attributeName, NULL, tokenizer.getAttributeValue( index ) );
+    }
+
+    // Fetch object name.
+    StringTableEntry objectName = StringTable->insert( tokenizer.findAttribute( tamlNamedObjectName ) );
+
+    // Does the object require a name?
+    if ( objectName == StringTable->EmptyString )
+    {
+        // No, so just register anonymously.
+        pSimObject->registerObject();
+    }
+    else
+    {
+        // Yes, so register a named object.
+        pSimObject->registerObject( objectName );
+
+        // Was the name assigned?
+        if ( pSimObject->getName() != objectName )
+        {
+            // No, so warn that the name was rejected.
+#ifdef TORQUE_DEBUG
+            Con::warnf( "Taml::parseElement() - Registered an instance of type '%s' but a request to name it '%s' was rejected.  This is typically because an object of that name already exists.  '%s'", typeName, objectName, typeLocationBuffer );
+#else
+            Con::warnf( "Taml::parseElement() - Registered an instance of type '%s' but a request to name it '%s' was rejected.  This is typically because an object of that name already exists.", typeName, objectName );
+#endif
+        }
+    }
+
+    // Do we have a reference Id?
+    if ( tamlRefId != 0 )
+    {
+        // Yes, so insert reference.
+        mObjectReferenceMap.insert( tamlRefId, pSimObject );
+    }
+
+    // Add any template children.
+    if ( pTemplate != NULL )
+        TamlTemplates::addChildren( mpTaml, pSimObject, pTemplate );
+
+    // Fetch the Taml children.
+    TamlChildren* pChildren = dynamic_cast<TamlChildren*>( pSimObject );
+
+    // Fetch any container child class specifier.
+    AbstractClassRep* pContainerChildClass = pSimObject->getClassRep()->getContainerChildClass( true );
+
+    TamlCustomNodes customProperties;
+    bool hasChildNodes = false;
+
+    // Iterate children as they are read.
+    for ( TamlXmlTokenizer::Token token = tokenizer.next(); token != TamlXmlTokenizer::EndElementToken; token = tokenizer.next() )
+    {
+        // Finish if the document is malformed.
+        if ( token == TamlXmlTokenizer::ErrorToken || token == TamlXmlTokenizer::EndOfDocumentToken )
+            break;
+
+        hasChildNodes = true;
+
+        // Skip text.
+        if ( token == TamlXmlTokenizer::TextToken )
+            continue;
+
+        // Is this a standard child element?
+        if ( dStrchr( tokenizer.getName(), '.' ) == NULL )
+        {
+            // Is this a Taml child?
+            if ( pChildren == NULL )
+            {
+                // No, so warn.
+                Con::warnf("Taml: Child element '%s' found under parent '%s' but object cannot have children.",
+                    tokenizer.getName(),
+                    typeName );
+
+                // Skip.
+                skipStreamElement( tokenizer );
+                continue;
+            }
+
+            // Yes, so parse child element.
+            SimObject* pChildSimObject = parseStreamElement( tokenizer );
+
+            // Skip if the child was not created.
+            if ( pChildSimObject == NULL )
+                continue;
+
+            // Do we have a container child class?
+            if ( pContainerChildClass != NULL )
+            {
+                // Yes, so is the child object the correctly derived type?
+                if ( !pChildSimObject->getClassRep()->isClass( pContainerChildClass ) )
+                {
+                    // No, so warn.
+                    Con::warnf("Taml: Child element '%s' found under parent '%s' but object is restricted to children of type '%s'.",
+                        pChildSimObject->getClassName(),
+                        pSimObject->getClassName(),
+                        pContainerChildClass->getClassName() );
+
+                    // NOTE: We can't delete the object as it may be referenced elsewhere!
+                    pChildSimObject = NULL;
+
+                    // Skip.
+                    continue;
+                }
+            }
+
+            // Add child.
+            pChildren->addTamlChild( pChildSimObject );
+
+            // Find Taml callbacks for child.
+            TamlCallbacks* pChildCallbacks = dynamic_cast<TamlCallbacks*>( pChildSimObject );
+
+            // Do we have callbacks on the child?
+            if ( pChildCallbacks != NULL )
+            {
+                // Yes, so perform callback.
+                mpTaml->tamlAddParent( pChildCallbacks, pSimObject );
+            }
+        }
+        else
+        {
+            // No, so parse custom element.
+            parseStreamCustomElement( tokenizer, customProperties );
+        }
+    }
+
+    // Fetch the custom nodes to read.
+    const TamlCustomNodes& customNodes = TamlTemplates::getCustomNodes( pTemplate, customProperties );
+
+    // Call custom read.
+    if ( hasChildNodes || pTemplate != NULL )
+        mpTaml->tamlCustomRead( pCallbacks, customNodes );
+
+    // Are there any Taml callbacks?
+    if ( pCallbacks != NULL )
+    {
+        // Yes, so call it.
+        mpTaml->tamlPostRead( pCallbacks, customNodes );
+    }
+
+    // Return object.
+    return pSimObject;
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlXmlReader::parseStreamCustomElement( TamlXmlTokenizer& tokenizer, TamlCustomNodes& customNodes )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlXmlReader_ParseStreamCustomElement);
+
+    // Fetch the custom node name.
+    const char* pPeriod = dStrchr( tokenizer.getName(), '.' );
+
+    // Sanity!
+    AssertFatal( pPeriod != NULL, "Parsing extended element but no period character found." );
+
+    StringTableEntry customNodeName = StringTable->insert( pPeriod+1 );
+
+    TamlCustomNode* pCustomNode = NULL;
+
+    // Iterate children as they are read.
+    for ( TamlXmlTokenizer::Token token = tokenizer.next(); token != TamlXmlTokenizer::EndElementToken; token = tokenizer.next() )
+    {
+        // Finish if the document is malformed.
+        if ( token == TamlXmlTokenizer::ErrorToken || token == TamlXmlTokenizer::EndOfDocumentToken )
+            return;
+
+        // Add the custom node when the first child is found.
+        if ( pCustomNode == NULL )
+            pCustomNode = customNodes.addNode( customNodeName );
+
+        // Parse custom node.
+        if ( token == TamlXmlTokenizer::StartElementToken )
+            parseStreamCustomNode( tokenizer, pCustomNode );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlXmlReader::parseStreamCustomNode( TamlXmlTokenizer& tokenizer, TamlCustomNode* pCustomNode )
+{
+    // Is the node a proxy object?
+    if ( tokenizer.findAttribute( tamlRefIdName ) != NULL || tokenizer.findAttribute( tamlRefToIdName ) != NULL )
+    {
+        // Yes, so parse proxy object.
+        SimObject* pProxyObject = parseStreamElement( tokenizer );
+
+        // Add child node.
+        pCustomNode->addNode( pProxyObject );
+
+        return;
+    }
+
+    // No, so add child node.
+    TamlCustomNode* pChildNode = pCustomNode->addNode( tokenizer.getName() );
+
+    // Iterate attributes.
+    const U32 attributeCount = tokenizer.getAttributeCount();
+    for ( U32 index = 0; index < attributeCount; ++index )
+    {
+        // Insert attribute name.
+        StringTableEntry attributeName = StringTable->insert( tokenizer.getAttributeName( index ) );
+
+        // Skip if a Taml reference attribute.
+        if ( attributeName == tamlRefIdName || attributeName == tamlRefToIdName )
+            continue;
+
+        // Add node field.
+        pChildNode->addField( attributeName, tokenizer.getAttributeValue( index ) );
+    }
+
+    // Iterate children as they are read.
+    bool firstChild = true;
+    for ( TamlXmlTokenizer::Token token = tokenizer.next(); token != TamlXmlTokenizer::EndElementToken; token = tokenizer.next() )
+    {
+        // Finish if the document is malformed.
+        if ( token == TamlXmlTokenizer::ErrorToken || token == TamlXmlTokenizer::EndOfDocumentToken )
+            return;
+
+        // Store the element text if it's the first child.
+        if ( token == TamlXmlTokenizer::TextToken )
+        {
+            if ( firstChild )
+                pChildNode->setNodeText( tokenizer.getText() );
+        }
+        else
+        {
+            // Parse custom node.
+            parseStreamCustomNode( tokenizer, pChildNode );
+        }
+
+        firstChild = false;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 void TamlXmlReader::resetParse( void )
 {
     // Debug Profiling.
@@ -65,7 +834,7 @@ void TamlXmlReader::resetParse( void )
 
 //-----------------------------------------------------------------------------
 
-SimObject* TamlXmlReader::parseElement( TiXmlElement* pXmlElement )
+SimObject* TamlXmlReader::parseElement( TiXmlElement* pXmlElement, const Vector<TiXmlDocument*>* pChildDocuments )
 {
     // Debug Profiling.
     PROFILE_SCOPE(TamlXmlReader_ParseElement);
@@ -99,6 +868,14 @@ SimObject* TamlXmlReader::parseElement( TiXmlElement* pXmlElement )
     // No, so fetch reference Id.
     const U32 tamlRefId = getTamlRefId( pXmlElement );
 
+    // Fetch any template.
+    const char* pTemplateFile = pXmlElement->Attribute( tamlTemplateName );
+    const TamlWriteNode* pTemplate = pTemplateFile != NULL ? TamlTemplates::findTemplate( pTemplateFile ) : NULL;
+
+    // Use the template type if we have a template.
+    if ( pTemplate != NULL )
+        typeName = TamlTemplates::getTypeName( pTemplate );
+
 #ifdef TORQUE_DEBUG
     // Format the type location.
     char typeLocationBuffer[64];
@@ -126,6 +903,10 @@ SimObject* TamlXmlReader::parseElement( TiXmlElement* pXmlElement )
         mpTaml->tamlPreRead( pCallbacks );
     }
 
+    // Apply any template fields.
+    if ( pTemplate != NULL )
+        TamlTemplates::applyFields( pSimObject, pTemplate );
+
     // Parse attributes.
     parseAttributes( pXmlElement, pSimObject );
 
@@ -163,13 +944,20 @@ SimObject* TamlXmlReader::parseElement( TiXmlElement* pXmlElement )
         mObjectReferenceMap.insert( tamlRefId, pSimObject );
     }
 
+    // Add any template children.
+    if ( pTemplate != NULL )
+        TamlTemplates::addChildren( mpTaml, pSimObject, pTemplate );
+
     // Fetch any children.
-    TiXmlNode* pChildXmlNode = pXmlElement->FirstChild();
+    TiXmlNode* pChildXmlNode = pChildDocuments != NULL ? NULL : pXmlElement->FirstChild();
+
+    // Fetch the index of any separately parsed children.
+    U32 childDocumentIndex = 0;
 
     TamlCustomNodes customProperties;
 
     // Do we have any element children?
-    if ( pChildXmlNode != NULL )
+    if ( pChildXmlNode != NULL || (pChildDocuments != NULL && pChildDocuments->size() > 0) )
     {
         // Fetch the Taml children.
         TamlChildren* pChildren = dynamic_cast<TamlChildren*>( pSimObject );
@@ -180,11 +968,22 @@ SimObject* TamlXmlReader::parseElement( TiXmlElement* pXmlElement )
         // Iterate siblings.
         do
         {
-            // Fetch element.
-            TiXmlElement* pChildXmlElement = dynamic_cast<TiXmlElement*>( pChildXmlNode );
+            TiXmlElement* pChildXmlElement;
 
-            // Move to next sibling.
-            pChildXmlNode = pChildXmlNode->NextSibling();
+            // Are the children parsed separately?
+            if ( pChildDocuments != NULL )
+            {
+                // Yes, so fetch the next child document element.
+                pChildXmlElement = (*pChildDocuments)[childDocumentIndex++]->RootElement();
+            }
+            else
+            {
+                // No, so fetch element.
+                pChildXmlElement = dynamic_cast<TiXmlElement*>( pChildXmlNode );
+
+                // Move to next sibling.
+                pChildXmlNode = pChildXmlNode->NextSibling();
+            }
 
             // Skip if this is not an element?
             if ( pChildXmlElement == NULL )
@@ -251,17 +1050,22 @@ SimObject* TamlXmlReader::parseElement( TiXmlElement* pXmlElement )
                 parseCustomElement( pChildXmlElement, customProperties );
             }
         }
-        while( pChildXmlNode != NULL );
+        while( pChildXmlNode != NULL || (pChildDocuments != NULL && childDocumentIndex < (U32)pChildDocuments->size()) );
 
         // Call custom read.
-        mpTaml->tamlCustomRead( pCallbacks, customProperties );
+        mpTaml->tamlCustomRead( pCallbacks, TamlTemplates::getCustomNodes( pTemplate, customProperties ) );
+    }
+    else if ( pTemplate != NULL )
+    {
+        // Call custom read for the template.
+        mpTaml->tamlCustomRead( pCallbacks, pTemplate->mCustomNodes );
     }
 
     // Are there any Taml callbacks?
     if ( pCallbacks != NULL )
     {
         // Yes, so call it.
-        mpTaml->tamlPostRead( pCallbacks, customProperties );
+        mpTaml->tamlPostRead( pCallbacks, TamlTemplates::getCustomNodes( pTemplate, customProperties ) );
     }
 
     // Return object.
@@ -287,7 +1091,8 @@ void TamlXmlReader::parseAttributes( TiXmlElement* pXmlElement, SimObject* pSimO
         // Ignore if this is a Taml attribute.
         if (    attributeName == tamlRefIdName ||
                 attributeName == tamlRefToIdName ||
-                attributeName == tamlNamedObjectName )
+                attributeName == tamlNamedObjectName ||
+                attributeName == tamlTemplateName )
             continue;
 
         // Set the field.
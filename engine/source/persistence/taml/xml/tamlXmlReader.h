@@ -35,8 +35,22 @@
 #include "persistence/tinyXML/tinyxml.h"
 #endif
 
+#ifndef _TAML_XMLTOKENIZER_H_
+#include "persistence/taml/xml/tamlXmlTokenizer.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
+/// Large documents are read through a pipeline.  The document text is split into the
+/// subtrees of each root child element, which are tokenized and parsed in parallel on
+/// the thread pool.  Objects are then created and registered on the calling thread.
+/// The size above which the pipeline is used is "$pref::Taml::parallelReadSize" (in bytes)
+/// where zero disables it.
+///
+/// Other documents are streamed through a TamlXmlTokenizer and objects are built as the
+/// elements are read, without building a DOM.  This can be disabled by setting
+/// "$pref::Taml::streamingRead" to false.
+///
 /// @ingroup tamlGroup
 /// @see tamlGroup
 class TamlXmlReader
@@ -60,7 +74,15 @@ private:
 private:
     void resetParse( void );
 
-    SimObject* parseElement( TiXmlElement* pXmlElement );
+    SimObject* readPipelined( FileStream& stream, const U32 streamSize );
+    SimObject* readStreaming( FileStream& stream );
+
+    SimObject* parseStreamElement( TamlXmlTokenizer& tokenizer );
+    void parseStreamCustomElement( TamlXmlTokenizer& tokenizer, TamlCustomNodes& customNodes );
+    void parseStreamCustomNode( TamlXmlTokenizer& tokenizer, TamlCustomNode* pCustomNode );
+    bool skipStreamElement( TamlXmlTokenizer& tokenizer );
+
+    SimObject* parseElement( TiXmlElement* pXmlElement, const Vector<TiXmlDocument*>* pChildDocuments = NULL );
     void parseAttributes( TiXmlElement* pXmlElement, SimObject* pSimObject );
     void parseCustomElement( TiXmlElement* pXmlElement, TamlCustomNodes& pCustomNode );
     void parseCustomNode( TiXmlElement* pXmlElement, TamlCustomNode* pCustomNode );
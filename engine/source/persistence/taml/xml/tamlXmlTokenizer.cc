@@ -0,0 +1,524 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "persistence/taml/xml/tamlXmlTokenizer.h"
+
+#ifndef _MMATHFN_H_
+#include "math/mMathFn.h"
+#endif
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+static inline bool isXmlSpace( const S32 c )
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+//-----------------------------------------------------------------------------
+
+static inline bool isXmlNameChar( const S32 c )
+{
+    return c != -1 && !isXmlSpace( c ) && c != '/' && c != '>' && c != '=' && c != '<';
+}
+
+//-----------------------------------------------------------------------------
+
+TamlXmlTokenizer::TamlXmlTokenizer( Stream& stream ) :
+    mStream( stream ),
+    mBufferLength( 0 ),
+    mBufferPosition( 0 ),
+    mFirstBlock( true ),
+    mRow( 0 ),
+    mColumn( 0 ),
+    mTokenRow( 0 ),
+    mTokenColumn( 0 ),
+    mDepth( 0 ),
+    mPendingEnd( false ),
+    mpError( NULL )
+{
+    // Fetch the amount of the stream to read.
+    mStreamRemaining = stream.getStreamSize() - stream.getPosition();
+
+    // Terminate the token buffers.
+    mName.push_back( 0 );
+    mText.push_back( 0 );
+}
+
+//-----------------------------------------------------------------------------
+
+bool TamlXmlTokenizer::fillBuffer( void )
+{
+    // Finish if the stream has been consumed.
+    if ( mStreamRemaining == 0 )
+        return false;
+
+    // Read the next block.
+    const U32 readSize = getMin( mStreamRemaining, (U32)BufferSize );
+    if ( !mStream.read( readSize, mBuffer ) )
+    {
+        mStreamRemaining = 0;
+        return false;
+    }
+
+    mStreamRemaining -= readSize;
+    mBufferLength = readSize;
+    mBufferPosition = 0;
+
+    // Skip any UTF-8 byte order mark at the start of the document.
+    if ( mFirstBlock && readSize >= 3 && (U8)mBuffer[0] == 0xef && (U8)mBuffer[1] == 0xbb && (U8)mBuffer[2] == 0xbf )
+        mBufferPosition = 3;
+
+    mFirstBlock = false;
+
+    return mBufferPosition < mBufferLength || fillBuffer();
+}
+
+//-----------------------------------------------------------------------------
+
+S32 TamlXmlTokenizer::readChar( void )
+{
+    S32 c = peekChar();
+    if ( c == -1 )
+        return -1;
+
+    ++mBufferPosition;
+
+    // Normalize new lines.
+    if ( c == '\r' )
+    {
+        if ( peekChar() == '\n' )
+            ++mBufferPosition;
+
+        c = '\n';
+    }
+
+    // Track the location.
+    if ( c == '\n' )
+    {
+        ++mRow;
+        mColumn = 0;
+    }
+    else
+    {
+        ++mColumn;
+    }
+
+    return c;
+}
+
+//-----------------------------------------------------------------------------
+
+bool TamlXmlTokenizer::readExpected( const char* pExpected )
+{
+    for ( ; *pExpected != 0; ++pExpected )
+    {
+        if ( peekChar() != (U8)*pExpected )
+            return false;
+
+        readChar();
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlXmlTokenizer::skipSpace( void )
+{
+    while ( isXmlSpace( peekChar() ) )
+        readChar();
+}
+
+//-----------------------------------------------------------------------------
+
+bool TamlXmlTokenizer::skipPast( const char* pTerminator )
+{
+    const U32 terminatorLength = dStrlen( pTerminator );
+    U32 matched = 0;
+
+    while ( matched < terminatorLength )
+    {
+        const S32 c = readChar();
+        if ( c == -1 )
+            return false;
+
+        if ( c == (U8)pTerminator[matched] )
+            ++matched;
+        else
+            matched = c == (U8)pTerminator[0] ? 1 : 0;
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool TamlXmlTokenizer::readName( Vector<char>& buffer )
+{
+    buffer.clear();
+
+    while ( isXmlNameChar( peekChar() ) )
+        buffer.push_back( (char)readChar() );
+
+    buffer.push_back( 0 );
+
+    return buffer.size() > 1;
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlXmlTokenizer::appendEntity( Vector<char>& buffer )
+{
+    // Read the entity name (the ampersand has been consumed).
+    char entity[16];
+    U32 length = 0;
+    while ( length < sizeof(entity) - 1 )
+    {
+        const S32 c = peekChar();
+        if ( c == -1 || c == ';' || isXmlSpace( c ) || c == '<' || c == '&' )
+            break;
+
+        entity[length++] = (char)readChar();
+    }
+    entity[length] = 0;
+
+    // Keep the text as it is if this isn't a terminated entity.
+    if ( peekChar() != ';' )
+    {
+        buffer.push_back( '&' );
+        for ( U32 index = 0; index < length; ++index )
+            buffer.push_back( entity[index] );
+        return;
+    }
+    readChar();
+
+    // Predefined entities.
+    if ( dStrcmp( entity, "amp" ) == 0 ) { buffer.push_back( '&' ); return; }
+    if ( dStrcmp( entity, "lt" ) == 0 ) { buffer.push_back( '<' ); return; }
+    if ( dStrcmp( entity, "gt" ) == 0 ) { buffer.push_back( '>' ); return; }
+    if ( dStrcmp( entity, "quot" ) == 0 ) { buffer.push_back( '"' ); return; }
+    if ( dStrcmp( entity, "apos" ) == 0 ) { buffer.push_back( '\'' ); return; }
+
+    // Character references.
+    if ( entity[0] == '#' )
+    {
+        const bool hex = entity[1] == 'x';
+        U32 code = 0;
+        for ( const char* pDigit = entity + (hex ? 2 : 1); *pDigit != 0; ++pDigit )
+        {
+            const char digit = *pDigit;
+            if ( digit >= '0' && digit <= '9' )
+                code = code * (hex ? 16 : 10) + (digit - '0');
+            else if ( hex && digit >= 'a' && digit <= 'f' )
+                code = code * 16 + (digit - 'a' + 10);
+            else if ( hex && digit >= 'A' && digit <= 'F' )
+                code = code * 16 + (digit - 'A' + 10);
+        }
+
+        // Encode as UTF-8.
+        if ( code < 0x80 )
+        {
+            buffer.push_back( (char)code );
+        }
+        else if ( code < 0x800 )
+        {
+            buffer.push_back( (char)(0xc0 | (code >> 6)) );
+            buffer.push_back( (char)(0x80 | (code & 0x3f)) );
+        }
+        else if ( code < 0x10000 )
+        {
+            buffer.push_back( (char)(0xe0 | (code >> 12)) );
+            buffer.push_back( (char)(0x80 | ((code >> 6) & 0x3f)) );
+            buffer.push_back( (char)(0x80 | (code & 0x3f)) );
+        }
+        else
+        {
+            buffer.push_back( (char)(0xf0 | (code >> 18)) );
+            buffer.push_back( (char)(0x80 | ((code >> 12) & 0x3f)) );
+            buffer.push_back( (char)(0x80 | ((code >> 6) & 0x3f)) );
+            buffer.push_back( (char)(0x80 | (code & 0x3f)) );
+        }
+        return;
+    }
+
+    // Keep unknown entities as they are.
+    buffer.push_back( '&' );
+    for ( U32 index = 0; index < length; ++index )
+        buffer.push_back( entity[index] );
+    buffer.push_back( ';' );
+}
+
+//-----------------------------------------------------------------------------
+
+TamlXmlTokenizer::Token TamlXmlTokenizer::readText( void )
+{
+    mText.clear();
+
+    // Condense white-space.
+    bool whitespace = false;
+    for ( S32 c = peekChar(); c != -1 && c != '<'; c = peekChar() )
+    {
+        if ( isXmlSpace( c ) )
+        {
+            readChar();
+            whitespace = true;
+            continue;
+        }
+
+        if ( whitespace && mText.size() > 0 )
+            mText.push_back( ' ' );
+        whitespace = false;
+
+        if ( c == '&' )
+        {
+            readChar();
+            appendEntity( mText );
+            continue;
+        }
+
+        mText.push_back( (char)readChar() );
+    }
+
+    // Skip white-space only text.
+    if ( mText.size() == 0 )
+    {
+        mText.push_back( 0 );
+        return next();
+    }
+
+    mText.push_back( 0 );
+    return TextToken;
+}
+
+//-----------------------------------------------------------------------------
+
+TamlXmlTokenizer::Token TamlXmlTokenizer::readCData( void )
+{
+    mText.clear();
+
+    // Read the text verbatim.
+    while ( true )
+    {
+        const S32 c = readChar();
+        if ( c == -1 )
+            return setError( "Unterminated CDATA section." );
+
+        mText.push_back( (char)c );
+
+        // Finish at the terminator.
+        const U32 size = (U32)mText.size();
+        if ( size >= 3 && mText[size-1] == '>' && mText[size-2] == ']' && mText[size-3] == ']' )
+        {
+            mText[size-3] = 0;
+            mText.setSize( size-2 );
+            return TextToken;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TamlXmlTokenizer::Token TamlXmlTokenizer::readStartElement( void )
+{
+    // Read the element name.
+    if ( !readName( mName ) )
+        return setError( "Invalid element name." );
+
+    mAttributeText.clear();
+    mAttributeOffsets.clear();
+
+    // Read the attributes.
+    while ( true )
+    {
+        skipSpace();
+
+        const S32 c = peekChar();
+
+        // Empty element?
+        if ( c == '/' )
+        {
+            readChar();
+            if ( !readExpected( ">" ) )
+                return setError( "Invalid empty element." );
+
+            mPendingEnd = true;
+            return StartElementToken;
+        }
+
+        // End of the start tag?
+        if ( c == '>' )
+        {
+            readChar();
+            ++mDepth;
+            return StartElementToken;
+        }
+
+        // Read the attribute name.
+        mAttributeOffsets.push_back( (U32)mAttributeText.size() );
+        if ( !isXmlNameChar( c ) )
+            return setError( "Invalid attribute." );
+
+        while ( isXmlNameChar( peekChar() ) )
+            mAttributeText.push_back( (char)readChar() );
+        mAttributeText.push_back( 0 );
+
+        // Read the assignment.
+        skipSpace();
+        if ( !readExpected( "=" ) )
+            return setError( "Attribute has no value." );
+        skipSpace();
+
+        const S32 quote = readChar();
+        if ( quote != '"' && quote != '\'' )
+            return setError( "Attribute value is not quoted." );
+
+        // Read the attribute value.
+        mAttributeOffsets.push_back( (U32)mAttributeText.size() );
+        for ( S32 valueChar = readChar(); valueChar != quote; valueChar = readChar() )
+        {
+            if ( valueChar == -1 )
+                return setError( "Unterminated attribute value." );
+
+            if ( valueChar == '&' )
+                appendEntity( mAttributeText );
+            else
+                mAttributeText.push_back( (char)valueChar );
+        }
+        mAttributeText.push_back( 0 );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TamlXmlTokenizer::Token TamlXmlTokenizer::readEndElement( void )
+{
+    // Read the element name.
+    if ( !readName( mName ) )
+        return setError( "Invalid end element name." );
+
+    skipSpace();
+    if ( !readExpected( ">" ) || mDepth == 0 )
+        return setError( "Invalid end element." );
+
+    --mDepth;
+
+    return EndElementToken;
+}
+
+//-----------------------------------------------------------------------------
+
+TamlXmlTokenizer::Token TamlXmlTokenizer::next( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlXmlTokenizer_Next);
+
+    // Finish if an error has occurred.
+    if ( mpError != NULL )
+        return ErrorToken;
+
+    // Close an empty element.
+    if ( mPendingEnd )
+    {
+        mPendingEnd = false;
+        return EndElementToken;
+    }
+
+    while ( true )
+    {
+        mTokenRow = mRow;
+        mTokenColumn = mColumn;
+
+        const S32 c = peekChar();
+
+        // End of document?
+        if ( c == -1 )
+            return mDepth == 0 ? EndOfDocumentToken : setError( "Unexpected end of document." );
+
+        // Text?
+        if ( c != '<' )
+            return readText();
+
+        readChar();
+
+        switch( peekChar() )
+        {
+            case '/':
+                readChar();
+                return readEndElement();
+
+            case '?':
+                // Skip processing instructions and declarations.
+                if ( !skipPast( "?>" ) )
+                    return setError( "Unterminated declaration." );
+                continue;
+
+            case '!':
+                readChar();
+
+                // Skip comments.
+                if ( readExpected( "--" ) )
+                {
+                    if ( !skipPast( "-->" ) )
+                        return setError( "Unterminated comment." );
+                    continue;
+                }
+
+                // Read CDATA.
+                if ( readExpected( "[CDATA[" ) )
+                    return readCData();
+
+                // Skip document type declarations.
+                if ( !skipPast( ">" ) )
+                    return setError( "Unterminated document type declaration." );
+                continue;
+
+            default:
+                return readStartElement();
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+const char* TamlXmlTokenizer::findAttribute( const char* pName ) const
+{
+    // Find the attribute value.
+    const U32 attributeCount = getAttributeCount();
+    for ( U32 index = 0; index < attributeCount; ++index )
+    {
+        if ( dStrcmp( getAttributeName( index ), pName ) == 0 )
+            return getAttributeValue( index );
+    }
+
+    return NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+TamlXmlTokenizer::Token TamlXmlTokenizer::setError( const char* pError )
+{
+    mpError = pError;
+    return ErrorToken;
+}
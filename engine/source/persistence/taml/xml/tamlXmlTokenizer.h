@@ -0,0 +1,134 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _TAML_XMLTOKENIZER_H_
+#define _TAML_XMLTOKENIZER_H_
+
+#ifndef _STREAM_H_
+#include "io/stream.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// A streaming (pull) XML tokenizer.
+///
+/// The document is read from the stream in small blocks and returned as a sequence of
+/// element start, element end and text tokens so a document can be processed without
+/// building a DOM.  Comments, processing instructions and document type declarations
+/// are skipped.  Character references and the predefined entities are decoded and text
+/// has its white-space condensed the same way as TinyXML.  Empty elements ("<a/>") are
+/// returned as a start token immediately followed by an end token.
+///
+/// The name, attributes and text of the current token are only valid until next() is called.
+///
+/// @ingroup tamlGroup
+/// @see tamlGroup
+class TamlXmlTokenizer
+{
+public:
+    enum Token
+    {
+        StartElementToken,
+        EndElementToken,
+        TextToken,
+        EndOfDocumentToken,
+        ErrorToken
+    };
+
+public:
+    TamlXmlTokenizer( Stream& stream );
+    virtual ~TamlXmlTokenizer() {}
+
+    /// Read the next token.
+    Token next( void );
+
+    /// The element name of a start or end token.
+    inline const char* getName( void ) const { return mName.address(); }
+
+    /// The attributes of a start token.
+    inline U32 getAttributeCount( void ) const { return (U32)mAttributeOffsets.size() / 2; }
+    inline const char* getAttributeName( const U32 index ) const { return mAttributeText.address() + mAttributeOffsets[index*2]; }
+    inline const char* getAttributeValue( const U32 index ) const { return mAttributeText.address() + mAttributeOffsets[index*2+1]; }
+    const char* findAttribute( const char* pName ) const;
+
+    /// The text of a text token.
+    inline const char* getText( void ) const { return mText.address(); }
+
+    /// The location of the current token.
+    inline U32 getRow( void ) const { return mTokenRow; }
+    inline U32 getColumn( void ) const { return mTokenColumn; }
+
+    /// The reason for an error token.
+    inline const char* getError( void ) const { return mpError; }
+
+private:
+    enum { BufferSize = 16384 };
+
+    Stream&         mStream;
+    U32             mStreamRemaining;
+    char            mBuffer[BufferSize];
+    U32             mBufferLength;
+    U32             mBufferPosition;
+    bool            mFirstBlock;
+
+    U32             mRow;
+    U32             mColumn;
+    U32             mTokenRow;
+    U32             mTokenColumn;
+    U32             mDepth;
+    bool            mPendingEnd;
+    const char*     mpError;
+
+    Vector<char>    mName;
+    Vector<char>    mText;
+    Vector<char>    mAttributeText;
+    Vector<U32>     mAttributeOffsets;
+
+private:
+    bool fillBuffer( void );
+
+    inline S32 peekChar( void )
+    {
+        if ( mBufferPosition == mBufferLength && !fillBuffer() )
+            return -1;
+
+        return (U8)mBuffer[mBufferPosition];
+    }
+
+    S32 readChar( void );
+    bool readExpected( const char* pExpected );
+    void skipSpace( void );
+    bool skipPast( const char* pTerminator );
+    bool readName( Vector<char>& buffer );
+    void appendEntity( Vector<char>& buffer );
+    Token readText( void );
+    Token readCData( void );
+    Token readStartElement( void );
+    Token readEndElement( void );
+    Token setError( const char* pError );
+};
+
+#endif // _TAML_XMLTOKENIZER_H_
@@ -38,48 +38,156 @@ bool TamlXmlWriter::write( FileStream& stream, const TamlWriteNode* pTamlWriteNo
     // Compile the root element.
     TiXmlElement* pRootElement = compileElement( pTamlWriteNode );
 
-    // Fetch any TAML Schema file reference.
-    const char* pTamlSchemaFile = Con::getVariable( TAML_SCHEMA_VARIABLE );
+    // Compile the schema attributes.
+    compileSchemaAttributes( pRootElement );
+
+    // Link the root element.
+    xmlDocument.LinkEndChild( pRootElement );
+
+    // Save document to stream.
+    return xmlDocument.SaveFile( stream );
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlXmlWriter::beginWrite( FileStream& stream )
+{
+    mpStream = &stream;
+    mOpenElements.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+bool TamlXmlWriter::endWrite( void )
+{
+    // Sanity!
+    AssertFatal( mOpenElements.size() == 0, "TamlXmlWriter::endWrite() - Elements are still open." );
+
+    const bool status = mpStream->getStatus() == Stream::Ok;
+    mpStream = NULL;
+
+    return status;
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlXmlWriter::beginNode( const TamlWriteNode* pTamlWriteNode )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlXmlWriter_BeginNode);
 
-    // Do we have a schema file reference?
-    if ( pTamlSchemaFile != NULL && *pTamlSchemaFile != 0 )
+    // Fetch the depth.
+    const U32 depth = mOpenElements.size();
+
+    // Is there a parent element?
+    if ( depth > 0 )
     {
-        // Yes, so add namespace attribute to root.
-        pRootElement->SetAttribute( "xmlns:xsi", "http://www.w3.org/2001/XMLSchema-instance" );
-
-        // Expand the file-path reference.
-        char schemaFilePathBuffer[1024];
-        Con::expandPath( schemaFilePathBuffer, sizeof(schemaFilePathBuffer), pTamlSchemaFile );
-
-        // Fetch the output path for the Taml file.
-        char outputFileBuffer[1024];
-        dSprintf( outputFileBuffer, sizeof(outputFileBuffer), "%s", mpTaml->getFilePathBuffer() );
-        char* pFileStart = dStrrchr( outputFileBuffer, '/' );
-        if ( pFileStart == NULL )
-            *outputFileBuffer = 0;
-        else
-            *pFileStart = 0;
+        // Yes, so start the element on a new line within it.
+        openParentElement();
+        mpStream->writeStringBuffer( "\n" );
+    }
+
+    // Create the element.
+    TiXmlElement* pElement = createElement( pTamlWriteNode );
 
-        // Fetch the schema file-path relative to the output file.
-        StringTableEntry relativeSchemaFilePath = Platform::makeRelativePathName( schemaFilePathBuffer, outputFileBuffer );
+    // Compile the schema attributes on the root element.
+    if ( depth == 0 )
+        compileSchemaAttributes( pElement );
 
-        // Add schema location attribute to root.
-        pRootElement->SetAttribute( "xsi:noNamespaceSchemaLocation", relativeSchemaFilePath );
+    // Write the start of the element.
+    // NOTE: The formatting matches TiXmlElement::Print().
+    writeIndent( depth );
+    mpStream->writeFormattedBuffer( "<%s", pElement->Value() );
+
+    // Write the attributes.
+    for( const TiXmlAttribute* pAttribute = pElement->FirstAttribute(); pAttribute != NULL; pAttribute = pAttribute->Next() )
+    {
+        mpStream->writeStringBuffer( "\n" );
+        pAttribute->Print( *mpStream, depth+1 );
     }
 
-    // Link the root element.
-    xmlDocument.LinkEndChild( pRootElement );
+    delete pElement;
 
-    // Save document to stream.
-    return xmlDocument.SaveFile( stream );
+    // The element is open until the node is ended.
+    mOpenElements.push_back( false );
 }
 
 //-----------------------------------------------------------------------------
 
-TiXmlElement* TamlXmlWriter::compileElement( const TamlWriteNode* pTamlWriteNode )
+void TamlXmlWriter::endNode( const TamlWriteNode* pTamlWriteNode )
 {
     // Debug Profiling.
-    PROFILE_SCOPE(TamlXmlWriter_CompileElement);
+    PROFILE_SCOPE(TamlXmlWriter_EndNode);
+
+    // Sanity!
+    AssertFatal( mOpenElements.size() > 0, "TamlXmlWriter::endNode() - No element is open." );
+
+    // Fetch the depth.
+    const U32 depth = mOpenElements.size() - 1;
+
+    // Fetch element name.
+    const char* pElementName = pTamlWriteNode->mpSimObject->getClassName();
+
+    // Compile the custom elements.
+    TiXmlElement customElements( pElementName );
+    compileCustomElements( &customElements, pTamlWriteNode );
+
+    // Write the custom elements.
+    for( const TiXmlNode* pNode = customElements.FirstChild(); pNode != NULL; pNode = pNode->NextSibling() )
+    {
+        openParentElement();
+        mpStream->writeStringBuffer( "\n" );
+        pNode->Print( *mpStream, depth+1 );
+    }
+
+    // Write the end of the element.
+    if ( mOpenElements.last() )
+    {
+        mpStream->writeStringBuffer( "\n" );
+        writeIndent( depth );
+        mpStream->writeFormattedBuffer( "</%s>", pElementName );
+    }
+    else
+    {
+        mpStream->writeStringBuffer( " />" );
+    }
+
+    mOpenElements.pop_back();
+
+    // Finish the document after the root element.
+    if ( depth == 0 )
+        mpStream->writeStringBuffer( "\n" );
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlXmlWriter::writeIndent( const U32 depth )
+{
+    for( U32 index = 0; index < depth; ++index )
+    {
+        mpStream->writeStringBuffer( "    " );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlXmlWriter::openParentElement( void )
+{
+    // Finish if the start tag of the parent element is already closed.
+    if ( mOpenElements.last() )
+        return;
+
+    // Close the start tag.
+    mpStream->writeStringBuffer( ">" );
+    mOpenElements.last() = true;
+}
+
+//-----------------------------------------------------------------------------
+
+TiXmlElement* TamlXmlWriter::createElement( const TamlWriteNode* pTamlWriteNode )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlXmlWriter_CreateElement);
 
     // Fetch object.
     SimObject* pSimObject = pTamlWriteNode->mpSimObject;
@@ -129,6 +237,57 @@ TiXmlElement* TamlXmlWriter::compileElement( const TamlWriteNode* pTamlWriteNode
     // Compile attributes.
     compileAttributes( pElement, pTamlWriteNode );
 
+    return pElement;
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlXmlWriter::compileSchemaAttributes( TiXmlElement* pRootElement )
+{
+    // Fetch any TAML Schema file reference.
+    const char* pTamlSchemaFile = Con::getVariable( TAML_SCHEMA_VARIABLE );
+
+    // Finish if we don't have a schema file reference.
+    if ( pTamlSchemaFile == NULL || *pTamlSchemaFile == 0 )
+        return;
+
+    // Add namespace attribute to root.
+    pRootElement->SetAttribute( "xmlns:xsi", "http://www.w3.org/2001/XMLSchema-instance" );
+
+    // Expand the file-path reference.
+    char schemaFilePathBuffer[1024];
+    Con::expandPath( schemaFilePathBuffer, sizeof(schemaFilePathBuffer), pTamlSchemaFile );
+
+    // Fetch the output path for the Taml file.
+    char outputFileBuffer[1024];
+    dSprintf( outputFileBuffer, sizeof(outputFileBuffer), "%s", mpTaml->getFilePathBuffer() );
+    char* pFileStart = dStrrchr( outputFileBuffer, '/' );
+    if ( pFileStart == NULL )
+        *outputFileBuffer = 0;
+    else
+        *pFileStart = 0;
+
+    // Fetch the schema file-path relative to the output file.
+    StringTableEntry relativeSchemaFilePath = Platform::makeRelativePathName( schemaFilePathBuffer, outputFileBuffer );
+
+    // Add schema location attribute to root.
+    pRootElement->SetAttribute( "xsi:noNamespaceSchemaLocation", relativeSchemaFilePath );
+}
+
+//-----------------------------------------------------------------------------
+
+TiXmlElement* TamlXmlWriter::compileElement( const TamlWriteNode* pTamlWriteNode )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlXmlWriter_CompileElement);
+
+    // Create element.
+    TiXmlElement* pElement = createElement( pTamlWriteNode );
+
+    // Finish if we're a reference to another object.
+    if ( pTamlWriteNode->mRefToNode != NULL )
+        return pElement;
+
     // Fetch children.
     Vector<TamlWriteNode*>* pChildren = pTamlWriteNode->mChildren;
 
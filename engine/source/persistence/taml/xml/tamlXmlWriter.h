@@ -35,21 +35,37 @@
 
 /// @ingroup tamlGroup
 /// @see tamlGroup
-class TamlXmlWriter
+class TamlXmlWriter : public TamlStreamWriter
 {
 public:
     TamlXmlWriter( Taml* pTaml ) :
-        mpTaml( pTaml )
+        mpTaml( pTaml ),
+        mpStream( NULL )
     {}
     virtual ~TamlXmlWriter() {}
 
     /// Write.
     bool write( FileStream& stream, const TamlWriteNode* pTamlWriteNode );
 
+    /// Stream write.
+    virtual void beginWrite( FileStream& stream );
+    virtual bool endWrite( void );
+    virtual void beginNode( const TamlWriteNode* pTamlWriteNode );
+    virtual void endNode( const TamlWriteNode* pTamlWriteNode );
+
 private:
     Taml* mpTaml;
 
+    /// The stream being written and whether each open element has any content.
+    FileStream* mpStream;
+    Vector<bool> mOpenElements;
+
 private:
+    void writeIndent( const U32 depth );
+    void openParentElement( void );
+
+    TiXmlElement* createElement( const TamlWriteNode* pTamlWriteNode );
+    void compileSchemaAttributes( TiXmlElement* pRootElement );
     TiXmlElement* compileElement( const TamlWriteNode* pTamlWriteNode );
     void compileAttributes( TiXmlElement* pXmlElement, const TamlWriteNode* pTamlWriteNode );
     void compileCustomElements( TiXmlElement* pXmlElement, const TamlWriteNode* pTamlWriteNode );
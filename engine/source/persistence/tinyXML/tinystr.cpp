@@ -22,9 +22,117 @@ distribution.
 */
 
 
-#ifndef TIXML_USE_STL
-
 #include "tinystr.h"
+#include <assert.h>
+#include <stdlib.h>
+
+#if defined(_MSC_VER)
+#define TIXML_THREAD_LOCAL __declspec(thread)
+#else
+#define TIXML_THREAD_LOCAL __thread
+#endif
+
+// The arena allocated from on this thread, if any.
+static TIXML_THREAD_LOCAL TiXmlArena* activeArena = 0;
+
+// Stored in front of every allocation to record the arena it came from, if any.
+// Padded so the alignment of the allocation is kept.
+union TiXmlArenaHeader
+{
+    TiXmlArena* arena;
+    double align;
+};
+
+
+TiXmlArena::Scope::Scope( TiXmlArena* arena )
+{
+    previous = activeArena;
+    activeArena = arena;
+}
+
+
+TiXmlArena::Scope::~Scope()
+{
+    activeArena = previous;
+}
+
+
+void* TiXmlArena::Allocate( size_t size )
+{
+    TiXmlArena* arena = activeArena;
+    const size_t bytesNeeded = sizeof(TiXmlArenaHeader) + size;
+
+    TiXmlArenaHeader* header = static_cast<TiXmlArenaHeader*>( arena ? arena->Alloc( bytesNeeded ) : malloc( bytesNeeded ) );
+    assert( header );
+    header->arena = arena;
+    return header + 1;
+}
+
+
+void TiXmlArena::Release( void* p )
+{
+    if ( !p )
+        return;
+
+    // Arena allocations are released with the arena.
+    TiXmlArenaHeader* header = static_cast<TiXmlArenaHeader*>( p ) - 1;
+    if ( !header->arena )
+        free( header );
+}
+
+
+void* TiXmlArena::Alloc( size_t size )
+{
+    // Keep every allocation aligned as the heap would.
+    const size_t align = sizeof(TiXmlArenaHeader);
+    const size_t blockHeader = ( sizeof(Block) + align - 1 ) & ~( align - 1 );
+    size = ( size + align - 1 ) & ~( align - 1 );
+    bytesUsed += size;
+
+    if ( !blocks || blocks->used + size > blocks->size )
+    {
+        // Large allocations get a block of their own behind the current one so
+        // the remainder of the current block isn't wasted.
+        const size_t blockSize = size > BlockSize / 4 ? size : BlockSize;
+        Block* block = static_cast<Block*>( malloc( blockHeader + blockSize ) );
+        assert( block );
+        block->size = blockSize;
+        block->used = 0;
+
+        if ( blocks && blockSize == size )
+        {
+            block->next = blocks->next;
+            blocks->next = block;
+        }
+        else
+        {
+            block->next = blocks;
+            blocks = block;
+        }
+
+        block->used = size;
+        return reinterpret_cast<char*>( block ) + blockHeader;
+    }
+
+    void* p = reinterpret_cast<char*>( blocks ) + blockHeader + blocks->used;
+    blocks->used += size;
+    return p;
+}
+
+
+void TiXmlArena::FreeAll()
+{
+    while ( blocks )
+    {
+        Block* next = blocks->next;
+        free( blocks );
+        blocks = next;
+    }
+    bytesUsed = 0;
+}
+
+
+#ifndef TIXML_USE_STL
 
 // Error value for find primitive
 const TiXmlString::size_type TiXmlString::npos = static_cast< TiXmlString::size_type >(-1);
@@ -22,6 +22,72 @@ distribution.
 */
 
 
+#ifndef TIXML_ARENA_INCLUDED
+#define TIXML_ARENA_INCLUDED
+
+#include <stddef.h>
+
+/*
+   TiXmlArena is a region that the nodes, attributes and strings of a document can be
+   allocated from. Whilst a TiXmlArena::Scope is active on a thread, everything TinyXML
+   allocates on that thread comes from the arena and deleting it does nothing. The whole
+   region is then released at once with FreeAll(), which must only be called once
+   nothing allocated from the arena is in use (typically after deleting the document).
+   Without an active scope, allocations come from the heap as normal.
+*/
+class TiXmlArena
+{
+  public :
+    TiXmlArena() : blocks(0), bytesUsed(0) {}
+    ~TiXmlArena() { FreeAll(); }
+
+    // Release everything allocated from the arena.
+    void FreeAll();
+
+    // The number of bytes allocated from the arena since it was last freed.
+    size_t BytesUsed() const { return bytesUsed; }
+
+    // Makes an arena the one allocated from on this thread until the scope ends.
+    class Scope
+    {
+      public :
+        explicit Scope( TiXmlArena* arena );
+        ~Scope();
+
+      private :
+        Scope( const Scope& );
+        void operator=( const Scope& );
+
+        TiXmlArena* previous;
+    };
+
+    // Allocate from the active arena or the heap if there isn't one.
+    static void* Allocate( size_t size );
+
+    // Release an allocation. Arena allocations are only released by FreeAll().
+    static void Release( void* p );
+
+  private :
+    TiXmlArena( const TiXmlArena& );
+    void operator=( const TiXmlArena& );
+
+    enum { BlockSize = 64 * 1024 };
+
+    struct Block
+    {
+        Block* next;
+        size_t size, used;
+    };
+
+    void* Alloc( size_t size );
+
+    Block* blocks;
+    size_t bytesUsed;
+} ;
+
+#endif	// TIXML_ARENA_INCLUDED
+
+
 #ifndef TIXML_USE_STL
 
 #ifndef TIXML_STRING_INCLUDED
@@ -218,14 +284,10 @@ class TiXmlString
     {
         if (cap)
         {
-            // Lee: the original form:
-            //	rep_ = static_cast<Rep*>(operator new(sizeof(Rep) + cap));
-            // doesn't work in some cases of new being overloaded. Switching
-            // to the normal allocation, although use an 'int' for systems
-            // that are overly picky about structure alignment.
+            // The rep comes from the active arena, if any, so a document's strings
+            // are released along with its nodes.
             const size_type bytesNeeded = sizeof(Rep) + cap;
-            const size_type intsNeeded = ( bytesNeeded + sizeof(int) - 1 ) / sizeof( int ); 
-            rep_ = reinterpret_cast<Rep*>( new int[ intsNeeded ] );
+            rep_ = static_cast<Rep*>( TiXmlArena::Allocate( bytesNeeded ) );
 
             rep_->str[ rep_->size = sz ] = '\0';
             rep_->capacity = cap;
@@ -240,9 +302,7 @@ class TiXmlString
     {
         if (rep_ != &nullrep_)
         {
-            // The rep_ is really an array of ints. (see the allocator, above).
-            // Cast it back before delete, so the compiler won't incorrectly call destructors.
-            delete [] ( reinterpret_cast<int*>( rep_ ) );
+            TiXmlArena::Release( rep_ );
         }
     }
 
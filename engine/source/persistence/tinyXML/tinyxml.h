@@ -47,13 +47,14 @@ distribution.
 #define DEBUG
 #endif
 
+#include "tinystr.h"
+
 #ifdef TIXML_USE_STL
     #include <string>
     #include <iostream>
     #include <sstream>
     #define TIXML_STRING		std::string
 #else
-    #include "tinystr.h"
     #define TIXML_STRING		TiXmlString
 #endif
 
@@ -205,6 +206,14 @@ public:
     TiXmlBase()	:	userData(0)		{}
     virtual ~TiXmlBase()			{}
 
+    /** Nodes and attributes are allocated from the active TiXmlArena, if any,
+        otherwise from the heap. See TiXmlArena.
+    */
+    static void* operator new( size_t size )			{ return TiXmlArena::Allocate( size ); }
+    static void* operator new( size_t, void* ptr )		{ return ptr; }
+    static void operator delete( void* p )				{ TiXmlArena::Release( p ); }
+    static void operator delete( void*, void* )			{}
+
     /**	All TinyXml classes can print themselves to a filestream
         or the string class (TiXmlString in non-STL mode, std::string
         in STL mode.) Either or both cfile and str can be null.
@@ -121,6 +121,46 @@ GL_GROUP_BEGIN(EXT_blend_minmax)
 GL_FUNCTION(void,       glBlendEquationEXT, (GLenum mode), return; )
 GL_GROUP_END()
 
+// ARB_vertex_buffer_object
+// http://www.opengl.org/registry/specs/ARB/vertex_buffer_object.txt
+#define GL_ARRAY_BUFFER_ARB                  0x8892
+#define GL_ELEMENT_ARRAY_BUFFER_ARB          0x8893
+#define GL_STREAM_DRAW_ARB                   0x88E0
+
+#ifndef _GL_ARB_VERTEX_BUFFER_OBJECT_TYPES_
+#define _GL_ARB_VERTEX_BUFFER_OBJECT_TYPES_
+#include <stddef.h>
+typedef ptrdiff_t GLsizeiptrARB;
+typedef ptrdiff_t GLintptrARB;
+#endif
+
+GL_GROUP_BEGIN(ARB_vertex_buffer_object)
+GL_FUNCTION(void,       glBindBufferARB, (GLenum target, GLuint buffer), return; )
+GL_FUNCTION(void,       glDeleteBuffersARB, (GLsizei n, const GLuint* buffers), return; )
+GL_FUNCTION(void,       glGenBuffersARB, (GLsizei n, GLuint* buffers), return; )
+GL_FUNCTION(void,       glBufferDataARB, (GLenum target, GLsizeiptrARB size, const void* data, GLenum usage), return; )
+GL_FUNCTION(void,       glBufferSubDataARB, (GLenum target, GLintptrARB offset, GLsizeiptrARB size, const void* data), return; )
+GL_GROUP_END()
+
+// ARB_timer_query
+// http://www.opengl.org/registry/specs/ARB/timer_query.txt
+#define GL_QUERY_RESULT                      0x8866
+#define GL_QUERY_RESULT_AVAILABLE            0x8867
+#define GL_TIMESTAMP                         0x8E28
+
+#ifndef _GL_ARB_TIMER_QUERY_TYPES_
+#define _GL_ARB_TIMER_QUERY_TYPES_
+typedef unsigned long long GLuint64;
+#endif
+
+GL_GROUP_BEGIN(ARB_timer_query)
+GL_FUNCTION(void,       glGenQueries, (GLsizei n, GLuint* ids), return; )
+GL_FUNCTION(void,       glDeleteQueries, (GLsizei n, const GLuint* ids), return; )
+GL_FUNCTION(void,       glGetQueryObjectuiv, (GLuint id, GLenum pname, GLuint* params), return; )
+GL_FUNCTION(void,       glQueryCounter, (GLuint id, GLenum target), return; )
+GL_FUNCTION(void,       glGetQueryObjectui64v, (GLuint id, GLenum pname, GLuint64* params), return; )
+GL_GROUP_END()
+
 //NV_vertex_array_range
 #ifdef TORQUE_OS_WIN32
 GL_GROUP_BEGIN(NV_vertex_array_range)
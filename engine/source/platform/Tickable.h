@@ -144,6 +144,13 @@ public:
    /// @returns True if any ticks were sent
    /// @see clientProcess
    static bool advanceTime( U32 timeDelta );
+
+   /// Returns the time of the tick currently (or last) being processed.  Every
+   /// tick has a distinct value so this can be used to do work once per tick.
+   static inline U32 getLastTick( void ) { return smLastTick; }
+
+   /// Returns the milliseconds that must pass before advanceTime will process another tick.
+   static inline U32 getTimeToNextTick( void ) { return smLastTick - smLastTime + 1; }
 };
 
 
@@ -32,6 +32,12 @@
 S32 sgBackgroundProcessSleepTime = 200;
 S32 sgTimeManagerProcessInterval = 0;
 
+#ifdef TORQUE_HEADLESS
+static bool sgHeadless = true;
+#else
+static bool sgHeadless = false;
+#endif
+
 
 void Platform::initConsole()
 {
@@ -39,6 +45,18 @@ void Platform::initConsole()
    Con::addVariable("Pref::timeManagerProcessInterval", TypeS32, &sgTimeManagerProcessInterval);
 }
 
+void Platform::setHeadless( const bool headless )
+{
+#ifndef TORQUE_HEADLESS
+   sgHeadless = headless;
+#endif
+}
+
+bool Platform::isHeadless()
+{
+   return sgHeadless;
+}
+
 S32 Platform::getBackgroundSleepTime()
 {
    return sgBackgroundProcessSleepTime;
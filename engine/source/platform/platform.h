@@ -139,6 +139,11 @@ struct Platform
     static void postQuitMessage(const U32 in_quitVal);
     static void forceShutdown(S32 returnValue);
 
+    /// A headless server only simulates so never initializes graphics, audio or the GUI and
+    /// loads assets as metadata only.  It is requested with "-headless" or by defining TORQUE_HEADLESS.
+    static void setHeadless(const bool headless);
+    static bool isHeadless();
+
     /// User.
     static StringTableEntry getUserHomeDirectory();
     static StringTableEntry getUserDataDirectory();
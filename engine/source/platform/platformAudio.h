@@ -83,7 +83,7 @@ class AudioEnvironment;
 class AudioSampleEnvironment;
 class AudioStreamSource;
 
-AUDIOHANDLE alxCreateSource(const Audio::Description *desc, const char *filename, const MatrixF *transform=NULL, AudioSampleEnvironment * sampleEnvironment = 0);
+AUDIOHANDLE alxCreateSource(const Audio::Description& desc, const char *filename, const MatrixF *transform=NULL, AudioSampleEnvironment * sampleEnvironment = 0);
 AUDIOHANDLE alxCreateSource(AudioDescription *descObject, const char *filename, const MatrixF *transform=NULL, AudioSampleEnvironment * sampleEnvironment = 0);
 AUDIOHANDLE alxCreateSource(const AudioAsset *profile, const MatrixF *transform=NULL);
 AudioStreamSource* alxFindAudioStreamSource(AUDIOHANDLE handle);
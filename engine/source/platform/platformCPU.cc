@@ -28,6 +28,15 @@
 
 #include "string/stringTable.h"
 
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+#define DETECT_X86_EXTENSIONS
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
 TorqueSystemInfo PlatformSystemInfo;
 
 enum CPUFlags
@@ -39,6 +48,61 @@ enum CPUFlags
    BIT_3DNOW   = BIT(31),
 };
 
+#if defined(DETECT_X86_EXTENSIONS)
+enum CPUExtendedFlags
+{
+   BIT_SSE2    = BIT(26),     // CPUID 1, EDX
+   BIT_OSXSAVE = BIT(27),     // CPUID 1, ECX
+   BIT_AVX     = BIT(28),     // CPUID 1, ECX
+   BIT_AVX2    = BIT(5),      // CPUID 7, EBX
+};
+
+static void readCPUID( const U32 leaf, U32* pRegisters )
+{
+#if defined(_MSC_VER)
+   int registers[4];
+   __cpuidex( registers, (int)leaf, 0 );
+   for ( U32 index = 0; index < 4; ++index )
+      pRegisters[index] = (U32)registers[index];
+#else
+   __cpuid_count( leaf, 0, pRegisters[0], pRegisters[1], pRegisters[2], pRegisters[3] );
+#endif
+}
+
+// Detect the extensions the original detection code predates.
+// AVX2 also needs the OS to save the 256-bit register state on a context switch.
+static U32 detectExtendedProperties()
+{
+   U32 registers[4];
+   readCPUID( 0, registers );
+   const U32 maxLeaf = registers[0];
+   if ( maxLeaf < 1 )
+      return 0;
+
+   readCPUID( 1, registers );
+   U32 properties = (registers[3] & BIT_SSE2) ? CPU_PROP_SSE2 : 0;
+
+   const U32 avxFlags = BIT_OSXSAVE | BIT_AVX;
+   if ( maxLeaf < 7 || (registers[2] & avxFlags) != avxFlags )
+      return properties;
+
+   // Check the OS saves the XMM and YMM state.
+#if defined(_MSC_VER)
+   const U32 enabledState = (U32)_xgetbv( 0 );
+#else
+   U32 enabledState, enabledStateHigh;
+   __asm__ __volatile__( "xgetbv" : "=a"(enabledState), "=d"(enabledStateHigh) : "c"(0) );
+#endif
+   if ( (enabledState & 0x6) != 0x6 )
+      return properties;
+
+   readCPUID( 7, registers );
+   properties |= (registers[1] & BIT_AVX2) ? CPU_PROP_AVX2 : 0;
+
+   return properties;
+}
+#endif
+
 // fill the specified structure with information obtained from asm code
 void SetProcessorInfo(TorqueSystemInfo::Processor& pInfo,
    char* vendor, U32 processor, U32 properties)
@@ -47,6 +111,10 @@ void SetProcessorInfo(TorqueSystemInfo::Processor& pInfo,
    PlatformSystemInfo.processor.properties |= (properties & BIT_RDTSC) ? CPU_PROP_RDTSC : 0;
    PlatformSystemInfo.processor.properties |= (properties & BIT_MMX)   ? CPU_PROP_MMX : 0;
 
+#if defined(DETECT_X86_EXTENSIONS)
+   PlatformSystemInfo.processor.properties |= detectExtendedProperties();
+#endif
+
    if (dStricmp(vendor, "GenuineIntel") == 0)
    {
       pInfo.properties |= (properties & BIT_SSE) ? CPU_PROP_SSE : 0;
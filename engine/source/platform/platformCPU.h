@@ -75,9 +75,10 @@ enum x86Properties
     CPU_PROP_MMX       = (1<<2),     // Integer-SIMD
     CPU_PROP_3DNOW     = (1<<3),     // AMD Float-SIMD
     CPU_PROP_SSE       = (1<<4),     // PentiumIII SIMD
-    CPU_PROP_RDTSC     = (1<<5)     // Read Time Stamp Counter
-    //   CPU_PROP_SSE2      = (1<<6),   // Pentium4 SIMD
+    CPU_PROP_RDTSC     = (1<<5),    // Read Time Stamp Counter
+    CPU_PROP_SSE2      = (1<<6),    // Pentium4 SIMD
     //   CPU_PROP_MP        = (1<<7)      // Multi-processor system
+    CPU_PROP_AVX2      = (1<<8)     // Haswell 256-bit SIMD (with OS support for the AVX state)
 };
 
 //-----------------------------------------------------------------------------
@@ -32,6 +32,10 @@
 struct Math
 {
    static void init( U32 properties = 0 );   // 0 == detect available hardware
+
+   /// Cross-check the installed math functions against the C versions.
+   /// @return Whether they all match (any that don't are reported to the console).
+   static bool verify( void );
 };
 
 #endif // _PLATFORM_MATH_H_
@@ -25,26 +25,1539 @@
 #include "console/console.h"
 #include "debug/profiler.h"
 #include "platform/threads/mutex.h"
+#include "platform/threads/atomic.h"
 #include "math/mMath.h"
 #include <stdlib.h>
+#include <new>
+
+//-----------------------------------------------------------------------------
+
+#if defined(_MSC_VER)
+#define MEMORY_THREAD_LOCAL __declspec(thread)
+#else
+#define MEMORY_THREAD_LOCAL __thread
+#endif
+
+namespace Memory
+{
+
+//-----------------------------------------------------------------------------
+// Allocation header.
+//-----------------------------------------------------------------------------
+
+/// Stored in front of every allocation.  Padded to 16 bytes so the alignment of the
+/// backend allocation is kept.
+struct AllocHeader
+{
+    dsize_t mSize;
+    U8      mTag;
+    U8      mBackend;
+    U8      mPadding[16 - sizeof(dsize_t) - 2 - sizeof(U32)];
+    U32     mCallsite;
+};
+
+//-----------------------------------------------------------------------------
+// Spin lock.
+//-----------------------------------------------------------------------------
+
+/// A lock that can be used before any static constructors have run.
+static inline void lockSpin( void* volatile* pLock )
+{
+    while ( dCompareAndSwapPointer( pLock, NULL, (void*)1 ) != NULL )
+    {
+    }
+}
+
+static inline void unlockSpin( void* volatile* pLock )
+{
+    dExchangePointer( pLock, NULL );
+}
+
+//-----------------------------------------------------------------------------
+// Per-thread state.
+//-----------------------------------------------------------------------------
+
+/// Size classes used by the thread caching backend.
+static const dsize_t sSizeClasses[] =
+{
+    16, 32, 48, 64, 80, 96, 112, 128, 144, 160, 176, 192, 208, 224, 240, 256,
+    320, 384, 448, 512,
+    640, 768, 896, 1024
+};
+
+static const U32 SizeClassCount = sizeof(sSizeClasses) / sizeof(dsize_t);
+static const dsize_t MaxSizeClassSize = 1024;
+static const dsize_t SpanSize = 64 * 1024;
+
+struct FreeBlock
+{
+    FreeBlock* mpNext;
+};
+
+/// Counters for a tag.  Only the owning thread writes them; they are summed across threads when read.
+struct TagCounters
+{
+    S64 mLiveBytes;
+    S64 mLiveCount;
+    U64 mTotalAllocations;
+    U64 mTotalBytes;
+};
+
+struct ThreadState
+{
+    TagCounters     mCounters[TagCount];
+    FreeBlock*      mpFreeBlocks[SizeClassCount];
+    U32             mFreeCount[SizeClassCount];
+    ThreadState*    mpNext;
+};
+
+static MEMORY_THREAD_LOCAL ThreadState* stpThreadState = NULL;
+static MEMORY_THREAD_LOCAL U32 stCurrentTag = TagGeneral;
+static MEMORY_THREAD_LOCAL Arena* stpCurrentArena = NULL;
+static MEMORY_THREAD_LOCAL S32 stNumaNode = -1;
+
+static ThreadState* volatile spThreadStates = NULL;
+static void* volatile spThreadStatesLock = NULL;
+
+//-----------------------------------------------------------------------------
+
+static ThreadState* getThreadState( void )
+{
+    ThreadState* pThreadState = stpThreadState;
+    if ( pThreadState != NULL )
+        return pThreadState;
+
+    // Create the state for this thread.  This is never freed as the counters are needed for the statistics.
+    pThreadState = (ThreadState*)malloc( sizeof(ThreadState) );
+    AssertISV( pThreadState != NULL, "Memory - Out of memory." );
+    dMemset( pThreadState, 0, sizeof(ThreadState) );
+
+    lockSpin( &spThreadStatesLock );
+    pThreadState->mpNext = spThreadStates;
+    dMemoryBarrier();
+    spThreadStates = pThreadState;
+    unlockSpin( &spThreadStatesLock );
+
+    stpThreadState = pThreadState;
+    return pThreadState;
+}
+
+//-----------------------------------------------------------------------------
+// System backend.
+//-----------------------------------------------------------------------------
+
+static void* systemAllocate( dsize_t size )
+{
+    return malloc( size );
+}
+
+static void systemRelease( void* ptr, dsize_t size )
+{
+    free( ptr );
+}
+
+const Backend SystemBackend = { "system", systemAllocate, systemRelease };
+
+//-----------------------------------------------------------------------------
+// Thread caching backend.
+//-----------------------------------------------------------------------------
+
+static FreeBlock* spCentralFreeBlocks[SizeClassCount];
+static U32 sCentralFreeCount[SizeClassCount];
+static void* volatile spCentralLocks[SizeClassCount];
+static U64 sThreadCachingReservedBytes = 0;
+
+//-----------------------------------------------------------------------------
+
+static inline U32 getSizeClass( const dsize_t size )
+{
+    // Small sizes are spaced 16 bytes apart.
+    if ( size <= 256 )
+        return size == 0 ? 0 : (U32)((size - 1) >> 4);
+
+    // Then 64 bytes apart up to 512 and 128 bytes apart up to 1024.
+    if ( size <= 512 )
+        return 16 + (U32)((size - 257) >> 6);
+
+    return 20 + (U32)((size - 513) >> 7);
+}
+
+//-----------------------------------------------------------------------------
+
+/// The number of blocks moved between a thread cache and the central free list at once.
+static inline U32 getBatchSize( const U32 sizeClass )
+{
+    const U32 batchSize = (U32)(4096 / sSizeClasses[sizeClass]);
+    return batchSize < 4 ? 4 : batchSize > 32 ? 32 : batchSize;
+}
+
+//-----------------------------------------------------------------------------
+
+static void refillThreadCache( ThreadState* pThreadState, const U32 sizeClass )
+{
+    const U32 batchSize = getBatchSize( sizeClass );
+
+    lockSpin( &spCentralLocks[sizeClass] );
+
+    // Carve a new span if the central free list cannot fill a batch.
+    if ( sCentralFreeCount[sizeClass] < batchSize )
+    {
+        U8* pSpan = (U8*)malloc( SpanSize );
+        if ( pSpan != NULL )
+        {
+            const dsize_t blockSize = sSizeClasses[sizeClass];
+            const U32 blockCount = (U32)(SpanSize / blockSize);
+            for ( U32 n = 0; n < blockCount; ++n )
+            {
+                FreeBlock* pBlock = (FreeBlock*)(pSpan + n * blockSize);
+                pBlock->mpNext = spCentralFreeBlocks[sizeClass];
+                spCentralFreeBlocks[sizeClass] = pBlock;
+            }
+            sCentralFreeCount[sizeClass] += blockCount;
+            sThreadCachingReservedBytes += SpanSize;
+        }
+    }
+
+    // Move a batch to the thread cache.
+    for ( U32 n = 0; n < batchSize && spCentralFreeBlocks[sizeClass] != NULL; ++n )
+    {
+        FreeBlock* pBlock = spCentralFreeBlocks[sizeClass];
+        spCentralFreeBlocks[sizeClass] = pBlock->mpNext;
+        sCentralFreeCount[sizeClass]--;
+
+        pBlock->mpNext = pThreadState->mpFreeBlocks[sizeClass];
+        pThreadState->mpFreeBlocks[sizeClass] = pBlock;
+        pThreadState->mFreeCount[sizeClass]++;
+    }
+
+    unlockSpin( &spCentralLocks[sizeClass] );
+}
+
+//-----------------------------------------------------------------------------
+
+static void flushThreadCache( ThreadState* pThreadState, const U32 sizeClass )
+{
+    const U32 batchSize = getBatchSize( sizeClass );
+
+    lockSpin( &spCentralLocks[sizeClass] );
+
+    // Return a batch to the central free list.
+    for ( U32 n = 0; n < batchSize && pThreadState->mpFreeBlocks[sizeClass] != NULL; ++n )
+    {
+        FreeBlock* pBlock = pThreadState->mpFreeBlocks[sizeClass];
+        pThreadState->mpFreeBlocks[sizeClass] = pBlock->mpNext;
+        pThreadState->mFreeCount[sizeClass]--;
+
+        pBlock->mpNext = spCentralFreeBlocks[sizeClass];
+        spCentralFreeBlocks[sizeClass] = pBlock;
+        sCentralFreeCount[sizeClass]++;
+    }
+
+    unlockSpin( &spCentralLocks[sizeClass] );
+}
+
+//-----------------------------------------------------------------------------
+
+static void* threadCachingAllocate( dsize_t size )
+{
+    // Large allocations go to the system heap.
+    if ( size > MaxSizeClassSize )
+        return malloc( size );
+
+    ThreadState* pThreadState = getThreadState();
+    const U32 sizeClass = getSizeClass( size );
+
+    if ( pThreadState->mpFreeBlocks[sizeClass] == NULL )
+    {
+        refillThreadCache( pThreadState, sizeClass );
+
+        if ( pThreadState->mpFreeBlocks[sizeClass] == NULL )
+            return NULL;
+    }
+
+    FreeBlock* pBlock = pThreadState->mpFreeBlocks[sizeClass];
+    pThreadState->mpFreeBlocks[sizeClass] = pBlock->mpNext;
+    pThreadState->mFreeCount[sizeClass]--;
+    return pBlock;
+}
+
+//-----------------------------------------------------------------------------
+
+static void threadCachingRelease( void* ptr, dsize_t size )
+{
+    if ( size > MaxSizeClassSize )
+    {
+        free( ptr );
+        return;
+    }
+
+    // Blocks go to the cache of the releasing thread, whichever thread allocated them.
+    ThreadState* pThreadState = getThreadState();
+    const U32 sizeClass = getSizeClass( size );
+
+    FreeBlock* pBlock = (FreeBlock*)ptr;
+    pBlock->mpNext = pThreadState->mpFreeBlocks[sizeClass];
+    pThreadState->mpFreeBlocks[sizeClass] = pBlock;
+    pThreadState->mFreeCount[sizeClass]++;
+
+    // Return a batch to the central free list if the cache is full.
+    if ( pThreadState->mFreeCount[sizeClass] > getBatchSize( sizeClass ) * 2 )
+        flushThreadCache( pThreadState, sizeClass );
+}
+
+const Backend ThreadCachingBackend = { "threadCaching", threadCachingAllocate, threadCachingRelease };
+
+//-----------------------------------------------------------------------------
+
+U64 getThreadCachingReservedBytes( void )
+{
+    return sThreadCachingReservedBytes;
+}
+
+//-----------------------------------------------------------------------------
+// Large page backend.
+//-----------------------------------------------------------------------------
+
+/// The size of a large (huge) page.
+static const dsize_t LargePageSize = 2 * 1024 * 1024;
+
+/// Allocations at least this size are made from large pages when enabled.
+static const dsize_t MinLargePageAllocation = 1024 * 1024;
+
+#ifdef DEDICATED
+static volatile bool sLargePages = true;
+#else
+static volatile bool sLargePages = false;
+#endif
+
+//-----------------------------------------------------------------------------
+
+static void* largePageAllocate( dsize_t size )
+{
+    return dLargePageAlloc( size, stNumaNode );
+}
+
+//-----------------------------------------------------------------------------
+
+static void largePageRelease( void* ptr, dsize_t size )
+{
+    dLargePageFree( ptr, size );
+}
+
+static const Backend LargePageBackend = { "largePage", largePageAllocate, largePageRelease };
+
+//-----------------------------------------------------------------------------
+
+void setLargePages( const bool enabled )
+{
+    sLargePages = enabled;
+}
+
+//-----------------------------------------------------------------------------
+
+bool getLargePages( void )
+{
+    return sLargePages;
+}
+
+//-----------------------------------------------------------------------------
+
+void setThreadNumaNode( const S32 node )
+{
+    stNumaNode = node;
+}
+
+//-----------------------------------------------------------------------------
+
+S32 getThreadNumaNode( void )
+{
+    return stNumaNode;
+}
+
+//-----------------------------------------------------------------------------
+// Arena backend.
+//-----------------------------------------------------------------------------
+
+static const dsize_t ArenaChunkSize = 256 * 1024;
+
+/// Blocks larger than this are given a chunk of their own.
+static const dsize_t MaxArenaBlockSize = ArenaChunkSize / 8;
+
+/// Each arena block is prefixed with its chunk, padded to keep blocks 16-byte aligned.
+static const dsize_t ArenaPrefixSize = 16;
+
+/// A chunk is freed once it is closed and it has no live blocks.  The lock guards both.
+struct ArenaChunk
+{
+    void* volatile  mLock;
+    U32             mLiveCount;
+    bool            mClosed;
+    bool            mLargePages;
+    dsize_t         mSize;
+};
+
+static const dsize_t ArenaChunkHeaderSize = (sizeof(ArenaChunk) + 15) & ~(dsize_t)15;
+
+static U64 sArenaReservedBytes = 0;
+static void* volatile spArenaReservedLock = NULL;
+
+//-----------------------------------------------------------------------------
+
+static ArenaChunk* createArenaChunk( const dsize_t size )
+{
+    // Back the chunk with large pages on the thread's NUMA node if enabled and the chunk fills a page.
+    const bool largePages = sLargePages && size >= LargePageSize;
+    ArenaChunk* pChunk = (ArenaChunk*)(largePages ? dLargePageAlloc( size, stNumaNode ) : malloc( size ));
+    if ( pChunk == NULL )
+        return NULL;
+
+    pChunk->mLock = NULL;
+    pChunk->mLiveCount = 0;
+    pChunk->mClosed = false;
+    pChunk->mLargePages = largePages;
+    pChunk->mSize = size;
+
+    lockSpin( &spArenaReservedLock );
+    sArenaReservedBytes += size;
+    unlockSpin( &spArenaReservedLock );
+
+    return pChunk;
+}
+
+//-----------------------------------------------------------------------------
+
+static void destroyArenaChunk( ArenaChunk* pChunk )
+{
+    lockSpin( &spArenaReservedLock );
+    sArenaReservedBytes -= pChunk->mSize;
+    unlockSpin( &spArenaReservedLock );
+
+    if ( pChunk->mLargePages )
+        dLargePageFree( pChunk, pChunk->mSize );
+    else
+        free( pChunk );
+}
+
+//-----------------------------------------------------------------------------
+
+static void closeArenaChunk( ArenaChunk* pChunk )
+{
+    lockSpin( &pChunk->mLock );
+    pChunk->mClosed = true;
+    const bool destroy = pChunk->mLiveCount == 0;
+    unlockSpin( &pChunk->mLock );
+
+    if ( destroy )
+        destroyArenaChunk( pChunk );
+}
+
+//-----------------------------------------------------------------------------
+
+Arena::Arena( void ) :
+    mpChunk( NULL ),
+    mChunkUsed( 0 ),
+    mAllocationCount( 0 ),
+    mAllocatedBytes( 0 ),
+    mChunkCount( 0 ),
+    mClosed( false )
+{
+}
+
+//-----------------------------------------------------------------------------
+
+Arena::~Arena()
+{
+    AssertFatal( stpCurrentArena != this, "Memory::Arena - Cannot destroy an arena that is current." );
+
+    close();
+}
+
+//-----------------------------------------------------------------------------
+
+void Arena::close( void )
+{
+    mClosed = true;
+
+    if ( mpChunk == NULL )
+        return;
+
+    closeArenaChunk( mpChunk );
+    mpChunk = NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+void* Arena::allocate( const dsize_t size )
+{
+    AssertFatal( !mClosed, "Memory::Arena - Cannot allocate from a closed arena." );
+
+    const dsize_t blockSize = (size + ArenaPrefixSize + 15) & ~(dsize_t)15;
+
+    ArenaChunk* pChunk;
+    U8* pBlock;
+
+    if ( blockSize > MaxArenaBlockSize )
+    {
+        // Give large blocks a chunk of their own, closed so it is freed with the block.
+        pChunk = createArenaChunk( ArenaChunkHeaderSize + blockSize );
+        if ( pChunk == NULL )
+            return NULL;
+
+        pChunk->mClosed = true;
+        pBlock = (U8*)pChunk + ArenaChunkHeaderSize;
+        mChunkCount++;
+    }
+    else
+    {
+        // Start a new chunk if the block does not fit in the current one.
+        if ( mpChunk == NULL || mChunkUsed + blockSize > mpChunk->mSize )
+        {
+            ArenaChunk* pNewChunk = createArenaChunk( sLargePages ? LargePageSize : ArenaChunkSize );
+            if ( pNewChunk == NULL )
+                return NULL;
+
+            if ( mpChunk != NULL )
+                closeArenaChunk( mpChunk );
+
+            mpChunk = pNewChunk;
+            mChunkUsed = ArenaChunkHeaderSize;
+            mChunkCount++;
+        }
+
+        pChunk = mpChunk;
+        pBlock = (U8*)pChunk + mChunkUsed;
+        mChunkUsed += blockSize;
+    }
+
+    mAllocationCount++;
+    mAllocatedBytes += size;
+
+    // NOTE: Blocks may be released concurrently by other threads.
+    lockSpin( &pChunk->mLock );
+    pChunk->mLiveCount++;
+    unlockSpin( &pChunk->mLock );
+
+    *(ArenaChunk**)pBlock = pChunk;
+    return pBlock + ArenaPrefixSize;
+}
+
+//-----------------------------------------------------------------------------
+
+void* arenaAllocate( dsize_t size )
+{
+    return stpCurrentArena->allocate( size );
+}
+
+//-----------------------------------------------------------------------------
+
+static void arenaRelease( void* ptr, dsize_t size )
+{
+    ArenaChunk* pChunk = *(ArenaChunk**)((U8*)ptr - ArenaPrefixSize);
+
+    lockSpin( &pChunk->mLock );
+    const bool destroy = --pChunk->mLiveCount == 0 && pChunk->mClosed;
+    unlockSpin( &pChunk->mLock );
+
+    if ( destroy )
+        destroyArenaChunk( pChunk );
+}
+
+static const Backend ArenaBackend = { "arena", arenaAllocate, arenaRelease };
+
+//-----------------------------------------------------------------------------
+
+Arena* setCurrentArena( Arena* pArena )
+{
+    AssertFatal( pArena == NULL || !pArena->isClosed(), "Memory::setCurrentArena() - Cannot allocate from a closed arena." );
+
+    Arena* pPreviousArena = stpCurrentArena;
+    stpCurrentArena = pArena;
+    return pPreviousArena;
+}
+
+//-----------------------------------------------------------------------------
+
+Arena* getCurrentArena( void )
+{
+    return stpCurrentArena;
+}
+
+//-----------------------------------------------------------------------------
+
+U64 getArenaReservedBytes( void )
+{
+    return sArenaReservedBytes;
+}
+
+//-----------------------------------------------------------------------------
+// Backend selection.
+//-----------------------------------------------------------------------------
+
+static const U32 MaxBackends = 8;
+
+/// Backends in use, indexed by the allocation header.
+static const Backend* volatile spBackends[MaxBackends] = { &SystemBackend };
+static volatile U32 sBackendCount = 1;
+static volatile U32 sCurrentBackend = 0;
+static void* volatile spBackendsLock = NULL;
+
+//-----------------------------------------------------------------------------
+
+/// Find or add a backend.  The backends lock must be held.
+/// @return The backend index or MaxBackends if there is no room for the backend.
+static U32 addBackend( const Backend* pBackend )
+{
+    U32 index = 0;
+    while ( index < sBackendCount && spBackends[index] != pBackend )
+        index++;
+
+    if ( index == sBackendCount )
+    {
+        if ( sBackendCount == MaxBackends )
+            return MaxBackends;
+
+        spBackends[index] = pBackend;
+        dMemoryBarrier();
+        sBackendCount++;
+    }
+
+    return index;
+}
+
+//-----------------------------------------------------------------------------
+
+bool setBackend( const Backend* pBackend )
+{
+    if ( pBackend == NULL )
+        return false;
+
+    lockSpin( &spBackendsLock );
+
+    const U32 index = addBackend( pBackend );
+    if ( index == MaxBackends )
+    {
+        unlockSpin( &spBackendsLock );
+        return false;
+    }
+
+    sCurrentBackend = index;
+
+    unlockSpin( &spBackendsLock );
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+const Backend* getBackend( void )
+{
+    return spBackends[sCurrentBackend];
+}
+
+//-----------------------------------------------------------------------------
+
+const Backend* findBackend( const char* pName )
+{
+    if ( dStricmp( pName, SystemBackend.mName ) == 0 )
+        return &SystemBackend;
+
+    if ( dStricmp( pName, ThreadCachingBackend.mName ) == 0 )
+        return &ThreadCachingBackend;
+
+    // Search the backends in use.
+    for ( U32 n = 0; n < sBackendCount; ++n )
+    {
+        if ( dStricmp( pName, spBackends[n]->mName ) == 0 )
+            return spBackends[n];
+    }
+
+    return NULL;
+}
+
+//-----------------------------------------------------------------------------
+// Tags.
+//-----------------------------------------------------------------------------
+
+static const char* sTagNames[TagCount] =
+{
+    "General",
+    "Scene",
+    "Particles",
+    "Physics",
+    "Script",
+    "Textures",
+    "Audio",
+    "Gui",
+};
+
+//-----------------------------------------------------------------------------
+
+Tag setCurrentTag( const Tag tag )
+{
+    const Tag previousTag = (Tag)stCurrentTag;
+    stCurrentTag = tag;
+    return previousTag;
+}
+
+//-----------------------------------------------------------------------------
+
+Tag getCurrentTag( void )
+{
+    return (Tag)stCurrentTag;
+}
+
+//-----------------------------------------------------------------------------
+
+const char* getTagName( const Tag tag )
+{
+    return tag >= 0 && tag < TagCount ? sTagNames[tag] : "";
+}
+
+//-----------------------------------------------------------------------------
+
+Tag getTagFromName( const char* pName )
+{
+    for ( U32 n = 0; n < TagCount; ++n )
+    {
+        if ( dStricmp( pName, sTagNames[n] ) == 0 )
+            return (Tag)n;
+    }
+
+    return TagCount;
+}
+
+//-----------------------------------------------------------------------------
+// Statistics.
+//-----------------------------------------------------------------------------
+
+static inline void recordAllocation( const U32 tag, const dsize_t size )
+{
+    TagCounters& counters = getThreadState()->mCounters[tag];
+    counters.mLiveBytes += size;
+    counters.mLiveCount++;
+    counters.mTotalAllocations++;
+    counters.mTotalBytes += size;
+}
+
+//-----------------------------------------------------------------------------
+
+static inline void recordRelease( const U32 tag, const dsize_t size )
+{
+    // The releasing thread may not be the allocating thread so the live counters
+    // of a single thread can go negative; only the sum is meaningful.
+    TagCounters& counters = getThreadState()->mCounters[tag];
+    counters.mLiveBytes -= size;
+    counters.mLiveCount--;
+}
+
+//-----------------------------------------------------------------------------
+// Callsite tracking.
+//-----------------------------------------------------------------------------
+
+#ifdef TORQUE_MEMORY_TRACKING
+
+/// Callsites are found by open addressing.  Slot zero is used for allocations without a callsite
+/// and for any callsites beyond the capacity of the table.
+
+struct Callsite
+{
+    const char* mpFileName;
+    const void* mpAddress;
+    U32         mLine;
+    bool        mUsed;
+    S64         mLiveBytes;
+    S64         mLiveCount;
+    U64         mTotalAllocations;
+    U64         mTotalBytes;
+    S64         mSnapshotLiveBytes;
+    S64         mSnapshotLiveCount;
+    U64         mSnapshotAllocations;
+    U64         mRateSampleAllocations;
+    U64         mRateSampleBytes;
+    F32         mAllocationRate;
+    F32         mByteRate;
+};
+
+// NOTE: The table is static as it cannot be allocated by the allocator it tracks.
+static Callsite sCallsites[MaxCallsites];
+static U32 sCallsiteCount = 0;
+static U32 sCallsiteRateSampleTime = 0;
+static void* volatile spCallsitesLock = NULL;
+
+/// The callsite of the allocation being made on this thread.
+static MEMORY_THREAD_LOCAL const char* stpCallsiteFileName = NULL;
+static MEMORY_THREAD_LOCAL const void* stpCallsiteAddress = NULL;
+static MEMORY_THREAD_LOCAL U32 stCallsiteLine = 0;
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define MEMORY_RETURN_ADDRESS _ReturnAddress()
+#else
+#define MEMORY_RETURN_ADDRESS __builtin_return_address(0)
+#endif
+
+//-----------------------------------------------------------------------------
+
+static inline void setCallsite( const char* pFileName, const dsize_t line )
+{
+    stpCallsiteFileName = pFileName;
+    stCallsiteLine = (U32)line;
+}
+
+//-----------------------------------------------------------------------------
+
+static inline void setCallsiteAddress( const void* pAddress )
+{
+    stpCallsiteAddress = pAddress;
+}
+
+//-----------------------------------------------------------------------------
+
+/// Find or add a callsite.  The callsites lock must be held.
+static U32 findCallsite( const char* pFileName, const void* pAddress, const U32 line )
+{
+    if ( pFileName == NULL && pAddress == NULL )
+        return 0;
+
+    const U32 mask = MaxCallsites - 1;
+    U32 slot = (U32)(((size_t)pFileName >> 2) ^ ((size_t)pAddress >> 2) ^ (line * 2654435761u)) & mask;
+
+    while ( true )
+    {
+        if ( slot == 0 )
+        {
+            slot = 1;
+            continue;
+        }
+
+        Callsite& callsite = sCallsites[slot];
+
+        if ( !callsite.mUsed )
+        {
+            // Leave room so probing stays short.
+            if ( sCallsiteCount >= MaxCallsites / 2 )
+                return 0;
+
+            callsite.mpFileName = pFileName;
+            callsite.mpAddress = pAddress;
+            callsite.mLine = line;
+            callsite.mUsed = true;
+            sCallsiteCount++;
+            return slot;
+        }
+
+        if ( callsite.mpFileName == pFileName && callsite.mpAddress == pAddress && callsite.mLine == line )
+            return slot;
+
+        slot = (slot + 1) & mask;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static inline void trackAllocation( AllocHeader* pHeader )
+{
+    lockSpin( &spCallsitesLock );
+
+    // Attribute the allocation to the pending callsite, if any.
+    const U32 callsiteIndex = findCallsite( stpCallsiteFileName, stpCallsiteAddress, stCallsiteLine );
+    Callsite& callsite = sCallsites[callsiteIndex];
+    callsite.mLiveBytes += pHeader->mSize;
+    callsite.mLiveCount++;
+    callsite.mTotalAllocations++;
+    callsite.mTotalBytes += pHeader->mSize;
+
+    unlockSpin( &spCallsitesLock );
+
+    pHeader->mCallsite = callsiteIndex;
+
+    stpCallsiteFileName = NULL;
+    stpCallsiteAddress = NULL;
+    stCallsiteLine = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+static inline void trackRelease( const U32 callsiteIndex, const dsize_t size )
+{
+    lockSpin( &spCallsitesLock );
+
+    Callsite& callsite = sCallsites[callsiteIndex];
+    callsite.mLiveBytes -= size;
+    callsite.mLiveCount--;
+
+    unlockSpin( &spCallsitesLock );
+}
+
+//-----------------------------------------------------------------------------
+
+U32 getCallsiteStats( CallsiteStats* pStats, const U32 maxCount )
+{
+    lockSpin( &spCallsitesLock );
+
+    // Re-sample the allocation rates.
+    const U32 time = Platform::getRealMilliseconds();
+    const F32 elapsed = (F32)(time - sCallsiteRateSampleTime) / 1000.0f;
+    const bool sampleRates = sCallsiteRateSampleTime == 0 || elapsed >= 1.0f;
+
+    U32 count = 0;
+    for ( U32 slot = 0; slot < MaxCallsites; ++slot )
+    {
+        Callsite& callsite = sCallsites[slot];
+
+        if ( slot != 0 && !callsite.mUsed )
+            continue;
+
+        if ( sampleRates )
+        {
+            if ( sCallsiteRateSampleTime != 0 )
+            {
+                callsite.mAllocationRate = (F32)(callsite.mTotalAllocations - callsite.mRateSampleAllocations) / elapsed;
+                callsite.mByteRate = (F32)(callsite.mTotalBytes - callsite.mRateSampleBytes) / elapsed;
+            }
+
+            callsite.mRateSampleAllocations = callsite.mTotalAllocations;
+            callsite.mRateSampleBytes = callsite.mTotalBytes;
+        }
+
+        if ( count == maxCount || (slot == 0 && callsite.mTotalAllocations == 0) )
+            continue;
+
+        CallsiteStats& stats = pStats[count++];
+        stats.fileName = callsite.mpFileName;
+        stats.address = callsite.mpAddress;
+        stats.line = callsite.mLine;
+        stats.liveBytes = callsite.mLiveBytes;
+        stats.liveCount = callsite.mLiveCount;
+        stats.totalAllocations = callsite.mTotalAllocations;
+        stats.totalBytes = callsite.mTotalBytes;
+        stats.allocationRate = callsite.mAllocationRate;
+        stats.byteRate = callsite.mByteRate;
+        stats.liveBytesChange = callsite.mLiveBytes - callsite.mSnapshotLiveBytes;
+        stats.liveCountChange = callsite.mLiveCount - callsite.mSnapshotLiveCount;
+        stats.allocationsChange = callsite.mTotalAllocations - callsite.mSnapshotAllocations;
+    }
+
+    if ( sampleRates )
+        sCallsiteRateSampleTime = time;
+
+    unlockSpin( &spCallsitesLock );
+
+    return count;
+}
+
+//-----------------------------------------------------------------------------
+
+void takeCallsiteSnapshot( void )
+{
+    lockSpin( &spCallsitesLock );
+
+    for ( U32 slot = 0; slot < MaxCallsites; ++slot )
+    {
+        Callsite& callsite = sCallsites[slot];
+        callsite.mSnapshotLiveBytes = callsite.mLiveBytes;
+        callsite.mSnapshotLiveCount = callsite.mLiveCount;
+        callsite.mSnapshotAllocations = callsite.mTotalAllocations;
+    }
+
+    unlockSpin( &spCallsitesLock );
+}
+
+#else
+
+static inline void setCallsite( const char* pFileName, const dsize_t line ) {}
+static inline void trackAllocation( AllocHeader* pHeader ) { pHeader->mCallsite = 0; }
+static inline void trackRelease( const U32 callsiteIndex, const dsize_t size ) {}
+
+#endif // TORQUE_MEMORY_TRACKING
+
+//-----------------------------------------------------------------------------
+
+static U32 sRateSampleTime = 0;
+static U64 sRateSampleAllocations[TagCount];
+static U64 sRateSampleBytes[TagCount];
+static F32 sAllocationRates[TagCount];
+static F32 sByteRates[TagCount];
+
+//-----------------------------------------------------------------------------
+
+static void sumCounters( const Tag tag, TagCounters& counters )
+{
+    dMemset( &counters, 0, sizeof(counters) );
+
+    for ( ThreadState* pThreadState = spThreadStates; pThreadState != NULL; pThreadState = pThreadState->mpNext )
+    {
+        const TagCounters& threadCounters = pThreadState->mCounters[tag];
+        counters.mLiveBytes += threadCounters.mLiveBytes;
+        counters.mLiveCount += threadCounters.mLiveCount;
+        counters.mTotalAllocations += threadCounters.mTotalAllocations;
+        counters.mTotalBytes += threadCounters.mTotalBytes;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static void updateRates( void )
+{
+    // Finish if the sample period has not elapsed.
+    const U32 currentTime = Platform::getRealMilliseconds();
+    const U32 elapsedTime = currentTime - sRateSampleTime;
+    if ( sRateSampleTime != 0 && elapsedTime < 1000 )
+        return;
+
+    const F32 elapsedSeconds = elapsedTime / 1000.0f;
+
+    for ( U32 n = 0; n < TagCount; ++n )
+    {
+        TagCounters counters;
+        sumCounters( (Tag)n, counters );
+
+        // Calculate the rates since the previous sample.
+        if ( sRateSampleTime != 0 )
+        {
+            sAllocationRates[n] = (F32)(counters.mTotalAllocations - sRateSampleAllocations[n]) / elapsedSeconds;
+            sByteRates[n] = (F32)(counters.mTotalBytes - sRateSampleBytes[n]) / elapsedSeconds;
+        }
+
+        sRateSampleAllocations[n] = counters.mTotalAllocations;
+        sRateSampleBytes[n] = counters.mTotalBytes;
+    }
+
+    sRateSampleTime = currentTime == 0 ? 1 : currentTime;
+}
+
+//-----------------------------------------------------------------------------
+
+void getTagStats( const Tag tag, TagStats& stats )
+{
+    AssertFatal( tag >= 0 && tag < TagCount, "Memory::getTagStats() - Invalid tag." );
+
+    updateRates();
+
+    TagCounters counters;
+    sumCounters( tag, counters );
+
+    stats.liveBytes = counters.mLiveBytes;
+    stats.liveCount = counters.mLiveCount;
+    stats.totalAllocations = counters.mTotalAllocations;
+    stats.totalBytes = counters.mTotalBytes;
+    stats.allocationRate = sAllocationRates[tag];
+    stats.byteRate = sByteRates[tag];
+}
+
+//-----------------------------------------------------------------------------
+// Budgets.
+//-----------------------------------------------------------------------------
+
+static const U32 MaxPressureCallbacks = 16;
+
+/// How often the callbacks are repeated whilst a tag remains under pressure.
+static const U32 PressureRepeatInterval = 1000;
+
+/// How long a platform low-memory warning keeps every tag under hard pressure.
+static const U32 LowMemoryWarningDuration = 5000;
+
+struct TagBudget
+{
+    U64         mSoftBytes;
+    U64         mHardBytes;
+    S64         mExternalBytes;
+    Pressure    mPressure;
+    U32         mRaisedTime;
+};
+
+struct PressureCallbackEntry
+{
+    PressureCallback    mCallback;
+    void*               mpUserData;
+    U32                 mKey;
+};
+
+static TagBudget sTagBudgets[TagCount];
+static PressureCallbackEntry sPressureCallbacks[MaxPressureCallbacks];
+static U32 sPressureCallbackCount = 0;
+static U32 sNextPressureCallbackKey = 1;
+static void* volatile spLowMemoryWarning = NULL;
+static U32 sLowMemoryWarningTime = 0;
+static bool sLowMemoryWarningActive = false;
+
+static const char* sPressureNames[] = { "none", "soft", "hard" };
+
+//-----------------------------------------------------------------------------
+
+void setTagBudget( const Tag tag, const U64 softBytes, const U64 hardBytes )
+{
+    AssertFatal( tag >= 0 && tag < TagCount, "Memory::setTagBudget() - Invalid tag." );
+
+    sTagBudgets[tag].mSoftBytes = softBytes;
+    sTagBudgets[tag].mHardBytes = hardBytes;
+}
+
+//-----------------------------------------------------------------------------
+
+void getTagBudget( const Tag tag, U64& softBytes, U64& hardBytes )
+{
+    AssertFatal( tag >= 0 && tag < TagCount, "Memory::getTagBudget() - Invalid tag." );
+
+    softBytes = sTagBudgets[tag].mSoftBytes;
+    hardBytes = sTagBudgets[tag].mHardBytes;
+}
+
+//-----------------------------------------------------------------------------
+
+Pressure getTagPressure( const Tag tag )
+{
+    AssertFatal( tag >= 0 && tag < TagCount, "Memory::getTagPressure() - Invalid tag." );
+
+    return sTagBudgets[tag].mPressure;
+}
+
+//-----------------------------------------------------------------------------
+
+const char* getPressureName( const Pressure pressure )
+{
+    return pressure >= PressureNone && pressure <= PressureHard ? sPressureNames[pressure] : "";
+}
+
+//-----------------------------------------------------------------------------
+
+void setTagExternalBytes( const Tag tag, const S64 bytes )
+{
+    AssertFatal( tag >= 0 && tag < TagCount, "Memory::setTagExternalBytes() - Invalid tag." );
+
+    sTagBudgets[tag].mExternalBytes = bytes;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 registerPressureCallback( PressureCallback callback, void* pUserData )
+{
+    AssertISV( sPressureCallbackCount < MaxPressureCallbacks, "Memory::registerPressureCallback() - Too many pressure callbacks." );
+
+    PressureCallbackEntry& entry = sPressureCallbacks[sPressureCallbackCount++];
+    entry.mCallback = callback;
+    entry.mpUserData = pUserData;
+    entry.mKey = sNextPressureCallbackKey++;
+
+    return entry.mKey;
+}
+
+//-----------------------------------------------------------------------------
+
+void unregisterPressureCallback( const U32 callbackKey )
+{
+    for ( U32 n = 0; n < sPressureCallbackCount; ++n )
+    {
+        if ( sPressureCallbacks[n].mKey == callbackKey )
+        {
+            sPressureCallbacks[n] = sPressureCallbacks[--sPressureCallbackCount];
+            return;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void raiseLowMemoryWarning( void )
+{
+    dExchangePointer( &spLowMemoryWarning, (void*)1 );
+}
+
+//-----------------------------------------------------------------------------
+
+void checkBudgets( void )
+{
+    const U32 time = Platform::getRealMilliseconds();
+
+    // Start or finish a low-memory warning.
+    if ( dExchangePointer( &spLowMemoryWarning, NULL ) != NULL )
+    {
+        if ( !sLowMemoryWarningActive )
+            Con::warnf( "Memory - The platform is low on memory." );
+
+        sLowMemoryWarningActive = true;
+        sLowMemoryWarningTime = time;
+    }
+    else if ( sLowMemoryWarningActive && (time - sLowMemoryWarningTime) >= LowMemoryWarningDuration )
+    {
+        sLowMemoryWarningActive = false;
+    }
+
+    for ( U32 tag = 0; tag < TagCount; ++tag )
+    {
+        TagBudget& budget = sTagBudgets[tag];
+
+        // Find the pressure.
+        Pressure pressure = PressureNone;
+        if ( sLowMemoryWarningActive )
+        {
+            pressure = PressureHard;
+        }
+        else if ( budget.mSoftBytes != 0 || budget.mHardBytes != 0 )
+        {
+            TagCounters counters;
+            sumCounters( (Tag)tag, counters );
+            const S64 liveBytes = counters.mLiveBytes + budget.mExternalBytes;
+
+            if ( budget.mHardBytes != 0 && liveBytes > (S64)budget.mHardBytes )
+            {
+                pressure = PressureHard;
+
+                if ( budget.mPressure != PressureHard )
+                    Con::warnf( "Memory - '%s' is over its hard budget (%.0fK of %.0fK).", sTagNames[tag], (F64)(liveBytes / 1024), (F64)(budget.mHardBytes / 1024) );
+            }
+            else if ( budget.mSoftBytes != 0 && liveBytes > (S64)budget.mSoftBytes )
+            {
+                pressure = PressureSoft;
+            }
+        }
+
+        // Finish if the pressure hasn't changed and the callbacks aren't due again.
+        if ( pressure == budget.mPressure && (pressure == PressureNone || (time - budget.mRaisedTime) < PressureRepeatInterval) )
+            continue;
+
+        budget.mPressure = pressure;
+        budget.mRaisedTime = time;
+
+        // Raise the callbacks.
+        for ( U32 n = 0; n < sPressureCallbackCount; ++n )
+        {
+            sPressureCallbacks[n].mCallback( (Tag)tag, pressure, sPressureCallbacks[n].mpUserData );
+        }
+
+        if ( Con::isFunction( "onMemoryPressure" ) )
+            Con::executef( 3, "onMemoryPressure", sTagNames[tag], sPressureNames[pressure] );
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Allocation.
+//-----------------------------------------------------------------------------
+
+static void* allocateFromBackend( const U32 backendIndex, const dsize_t size )
+{
+    const U32 tag = stCurrentTag;
+
+    AllocHeader* pHeader = (AllocHeader*)spBackends[backendIndex]->mAllocate( size + sizeof(AllocHeader) );
+    if ( pHeader == NULL )
+        return NULL;
+
+    pHeader->mSize = size;
+    pHeader->mTag = (U8)tag;
+    pHeader->mBackend = (U8)backendIndex;
+
+    recordAllocation( tag, size );
+    trackAllocation( pHeader );
+
+    return pHeader + 1;
+}
+
+//-----------------------------------------------------------------------------
+
+static volatile U32 sArenaBackend = MaxBackends;
+static volatile U32 sLargePageBackend = MaxBackends;
+
+//-----------------------------------------------------------------------------
+
+/// Get the index of the large page backend, or MaxBackends if the size should not use large pages.
+static inline U32 getLargePageBackend( const dsize_t size )
+{
+    if ( !sLargePages || size < MinLargePageAllocation )
+        return MaxBackends;
+
+    if ( sLargePageBackend == MaxBackends )
+    {
+        lockSpin( &spBackendsLock );
+        sLargePageBackend = addBackend( &LargePageBackend );
+        unlockSpin( &spBackendsLock );
+    }
+
+    return sLargePageBackend;
+}
+
+//-----------------------------------------------------------------------------
+
+static inline void* allocate( const dsize_t size )
+{
+    // Allocate large blocks from large pages if enabled.
+    const U32 largePageBackend = getLargePageBackend( size );
+    if ( largePageBackend != MaxBackends )
+        return allocateFromBackend( largePageBackend, size );
+
+    // Allocate from the current thread's arena if it has one.
+    if ( stpCurrentArena != NULL )
+    {
+        if ( sArenaBackend == MaxBackends )
+        {
+            lockSpin( &spBackendsLock );
+            sArenaBackend = addBackend( &ArenaBackend );
+            unlockSpin( &spBackendsLock );
+        }
+
+        if ( sArenaBackend != MaxBackends )
+            return allocateFromBackend( sArenaBackend, size );
+    }
+
+    return allocateFromBackend( sCurrentBackend, size );
+}
+
+//-----------------------------------------------------------------------------
+
+static void release( void* ptr )
+{
+    if ( ptr == NULL )
+        return;
+
+    AllocHeader* pHeader = (AllocHeader*)ptr - 1;
+
+    recordRelease( pHeader->mTag, pHeader->mSize );
+    trackRelease( pHeader->mCallsite, pHeader->mSize );
+
+    spBackends[pHeader->mBackend]->mRelease( pHeader, pHeader->mSize + sizeof(AllocHeader) );
+}
+
+//-----------------------------------------------------------------------------
+
+static void* reallocate( void* ptr, const dsize_t size )
+{
+    if ( ptr == NULL )
+        return allocate( size );
+
+    if ( size == 0 )
+    {
+        release( ptr );
+        return NULL;
+    }
+
+    AllocHeader* pHeader = (AllocHeader*)ptr - 1;
+    const dsize_t oldSize = pHeader->mSize;
+
+    const U32 largePageBackend = getLargePageBackend( size );
+
+    // Resize in place if the block and the current backend are both the system heap.
+    if ( spBackends[pHeader->mBackend] == &SystemBackend && sCurrentBackend == pHeader->mBackend && largePageBackend == MaxBackends )
+    {
+        const U32 tag = pHeader->mTag;
+        const U32 callsite = pHeader->mCallsite;
+
+        pHeader = (AllocHeader*)realloc( pHeader, size + sizeof(AllocHeader) );
+        if ( pHeader == NULL )
+            return NULL;
+
+        pHeader->mSize = size;
+
+        recordRelease( tag, oldSize );
+        recordAllocation( tag, size );
+        trackRelease( callsite, oldSize );
+        trackAllocation( pHeader );
+
+        return pHeader + 1;
+    }
+
+    // Move the block.
+    // NOTE: Reallocations are never placed in an arena as repeatedly grown blocks would waste it.
+    void* pNew = allocateFromBackend( largePageBackend != MaxBackends ? largePageBackend : sCurrentBackend, size );
+    if ( pNew == NULL )
+        return NULL;
+
+    dMemcpy( pNew, ptr, oldSize < size ? oldSize : size );
+    release( ptr );
+
+    return pNew;
+}
+
+//-----------------------------------------------------------------------------
+// Small-block pool.
+//-----------------------------------------------------------------------------
+
+static volatile bool sSmallBlockPooling = true;
+static volatile U32 sSmallBlockBackend = MaxBackends;
+
+//-----------------------------------------------------------------------------
+
+/// Get the index of the pooling backend, or MaxBackends if the size should not be pooled.
+static inline U32 getSmallBlockBackend( const dsize_t size )
+{
+    if ( !sSmallBlockPooling || size > MaxSizeClassSize - sizeof(AllocHeader) )
+        return MaxBackends;
+
+    if ( sSmallBlockBackend == MaxBackends )
+    {
+        lockSpin( &spBackendsLock );
+        sSmallBlockBackend = addBackend( &ThreadCachingBackend );
+        unlockSpin( &spBackendsLock );
+    }
+
+    return sSmallBlockBackend;
+}
+
+//-----------------------------------------------------------------------------
+
+void* allocateSmall( const dsize_t size, const char* pFileName, const U32 line )
+{
+    setCallsite( pFileName, line );
+
+    const U32 backendIndex = getSmallBlockBackend( size );
+
+    return backendIndex == MaxBackends ? allocate( size ) : allocateFromBackend( backendIndex, size );
+}
+
+//-----------------------------------------------------------------------------
+
+void* reallocateSmall( void* ptr, const dsize_t size, const char* pFileName, const U32 line )
+{
+    if ( ptr == NULL )
+        return allocateSmall( size, pFileName, line );
+
+    setCallsite( pFileName, line );
+
+    if ( size == 0 )
+    {
+        release( ptr );
+        return NULL;
+    }
+
+    const U32 backendIndex = getSmallBlockBackend( size );
+
+    // Use the current backend if the new size is not pooled.
+    if ( backendIndex == MaxBackends )
+        return reallocate( ptr, size );
+
+    AllocHeader* pHeader = (AllocHeader*)ptr - 1;
+    const dsize_t oldSize = pHeader->mSize;
+
+    // Resize in place if the block stays within its size class.
+    if ( pHeader->mBackend == backendIndex && getSizeClass( oldSize + sizeof(AllocHeader) ) == getSizeClass( size + sizeof(AllocHeader) ) )
+    {
+        pHeader->mSize = size;
+
+        recordRelease( pHeader->mTag, oldSize );
+        recordAllocation( pHeader->mTag, size );
+        trackRelease( pHeader->mCallsite, oldSize );
+        trackAllocation( pHeader );
+
+        return ptr;
+    }
+
+    // Move the block.
+    void* pNew = allocateFromBackend( backendIndex, size );
+    if ( pNew == NULL )
+        return NULL;
+
+    dMemcpy( pNew, ptr, oldSize < size ? oldSize : size );
+    release( ptr );
+
+    return pNew;
+}
+
+//-----------------------------------------------------------------------------
+
+void setSmallBlockPooling( const bool enabled )
+{
+    sSmallBlockPooling = enabled;
+}
+
+//-----------------------------------------------------------------------------
+
+bool getSmallBlockPooling( void )
+{
+    return sSmallBlockPooling;
+}
+
+} // namespace Memory
 
 //-----------------------------------------------------------------------------
 
 void* dMalloc_r(dsize_t in_size, const char* fileName, const dsize_t line)
 {
-   return malloc(in_size);
+   Memory::setCallsite(fileName, line);
+   return Memory::allocate(in_size);
 }
 
 //-----------------------------------------------------------------------------
 
 void dFree(void* in_pFree)
 {
-   free(in_pFree);
+   Memory::release(in_pFree);
 }
 
 //-----------------------------------------------------------------------------
 
 void* dRealloc_r(void* in_pResize, dsize_t in_size, const char* fileName, const dsize_t line)
 {
-   return realloc(in_pResize,in_size);
+   Memory::setCallsite(fileName, line);
+   return Memory::reallocate(in_pResize, in_size);
+}
+
+//-----------------------------------------------------------------------------
+
+#ifndef TORQUE_DISABLE_MEMORY_MANAGER
+
+#if __cplusplus >= 201103L
+#define MEMORY_NEW_THROW
+#else
+#define MEMORY_NEW_THROW throw(std::bad_alloc)
+#endif
+
+// Route the global operators through the engine allocator so they are attributed to the memory tags.
+// Every form is replaced as memory from one form may be freed with another.
+
+#ifdef TORQUE_MEMORY_TRACKING
+#define MEMORY_NEW_CALLSITE Memory::setCallsiteAddress(MEMORY_RETURN_ADDRESS)
+#else
+#define MEMORY_NEW_CALLSITE
+#endif
+
+void* FN_CDECL operator new(size_t size) MEMORY_NEW_THROW
+{
+   MEMORY_NEW_CALLSITE;
+   void* ptr = Memory::allocate((dsize_t)size);
+   AssertISV(ptr != NULL, "operator new - Out of memory.");
+   return ptr;
+}
+
+void* FN_CDECL operator new[](size_t size) MEMORY_NEW_THROW
+{
+   MEMORY_NEW_CALLSITE;
+   void* ptr = Memory::allocate((dsize_t)size);
+   AssertISV(ptr != NULL, "operator new[] - Out of memory.");
+   return ptr;
+}
+
+void* FN_CDECL operator new(size_t size, const std::nothrow_t&) throw()
+{
+   MEMORY_NEW_CALLSITE;
+   return Memory::allocate((dsize_t)size);
+}
+
+void* FN_CDECL operator new[](size_t size, const std::nothrow_t&) throw()
+{
+   MEMORY_NEW_CALLSITE;
+   return Memory::allocate((dsize_t)size);
 }
+
+void FN_CDECL operator delete(void* ptr) throw()
+{
+   Memory::release(ptr);
+}
+
+void FN_CDECL operator delete[](void* ptr) throw()
+{
+   Memory::release(ptr);
+}
+
+void FN_CDECL operator delete(void* ptr, const std::nothrow_t&) throw()
+{
+   Memory::release(ptr);
+}
+
+void FN_CDECL operator delete[](void* ptr, const std::nothrow_t&) throw()
+{
+   Memory::release(ptr);
+}
+
+#endif // TORQUE_DISABLE_MEMORY_MANAGER
+
+//-----------------------------------------------------------------------------
+
+#include "platformMemory_ScriptBinding.h"
@@ -71,9 +71,263 @@ extern void* dRealloc_r(void* in_pResize, dsize_t in_size, const char*, const ds
 extern void* dRealMalloc(dsize_t);
 extern void  dRealFree(void*);
 
+/// Allocate pages directly from the operating system, backed by large (huge) pages where the platform
+/// supports them and preferring the specified NUMA node (if not negative).  Freed with dLargePageFree()
+/// given the same size.
+extern void* dLargePageAlloc(dsize_t size, S32 numaNode);
+extern void  dLargePageFree(void* p, dsize_t size);
+
+/// Get the NUMA node of the processor the calling thread is running on (zero if unknown).
+extern S32   dGetCurrentNumaNode();
+
 extern void* dMemcpy(void *dst, const void *src, dsize_t size);
 extern void* dMemmove(void *dst, const void *src, dsize_t size);
 extern void* dMemset(void *dst, int c, dsize_t size);
 extern int   dMemcmp(const void *ptr1, const void *ptr2, dsize_t size);
 
+//------------------------------------------------------------------------------
+
+/// Engine allocator.
+///
+/// All allocations made with dMalloc(), dRealloc() and (unless TORQUE_DISABLE_MEMORY_MANAGER
+/// is defined) the global operator new are attributed to the memory tag that is current on the
+/// allocating thread.  Subsystems set their tag with a TagScope at their entry points so the
+/// live bytes and allocation rates of each subsystem can be reported.
+///
+/// The memory itself comes from a backend which can be changed at any time; each allocation
+/// remembers which backend it came from so it is always released to the right one.
+namespace Memory
+{
+    /// Subsystems that allocations are attributed to.
+    enum Tag
+    {
+        TagGeneral,
+        TagScene,
+        TagParticles,
+        TagPhysics,
+        TagScript,
+        TagTextures,
+        TagAudio,
+        TagGui,
+
+        TagCount
+    };
+
+    /// Statistics for a memory tag.
+    struct TagStats
+    {
+        S64 liveBytes;          ///< Bytes currently allocated.
+        S64 liveCount;          ///< Allocations currently live.
+        U64 totalAllocations;   ///< Allocations made since startup.
+        U64 totalBytes;         ///< Bytes allocated since startup.
+        F32 allocationRate;     ///< Allocations per-second over the last sample period.
+        F32 byteRate;           ///< Bytes allocated per-second over the last sample period.
+    };
+
+    /// An allocation backend.
+    /// Blocks are released with the size they were allocated with.
+    struct Backend
+    {
+        const char* mName;
+        void* (*mAllocate)( dsize_t size );
+        void (*mRelease)( void* ptr, dsize_t size );
+    };
+
+    /// The C runtime heap.
+    extern const Backend SystemBackend;
+
+    /// Small allocations are served from per-thread caches of fixed size blocks, refilled in
+    /// batches from shared free lists, with larger allocations going to the C runtime heap.
+    /// Cached blocks are not returned to the system so this suits long-lived threads.
+    extern const Backend ThreadCachingBackend;
+
+    /// Set the backend used for new allocations.
+    /// @return Whether the backend was set (only a limited number of distinct backends can be used).
+    bool setBackend( const Backend* pBackend );
+    const Backend* getBackend( void );
+    const Backend* findBackend( const char* pName );
+
+    /// Set the memory tag for the current thread.
+    /// @return The previous tag.
+    Tag setCurrentTag( const Tag tag );
+    Tag getCurrentTag( void );
+
+    const char* getTagName( const Tag tag );
+    Tag getTagFromName( const char* pName );
+
+    /// Fetch the statistics for a tag.  Allocation rates are re-sampled at most once per-second.
+    void getTagStats( const Tag tag, TagStats& stats );
+
+    /// Memory pressure on a tag.
+    enum Pressure
+    {
+        PressureNone,
+        PressureSoft,       ///< Over the soft budget so caches should be trimmed.
+        PressureHard,       ///< Over the hard budget, or the platform is low on memory, so release whatever can be.
+    };
+
+    /// Called on the main thread when the pressure on a tag changes and then once per-second whilst it remains under pressure.
+    typedef void (*PressureCallback)( const Tag tag, const Pressure pressure, void* pUserData );
+
+    /// Set the soft and hard budgets of a tag in bytes.  Zero disables a budget.
+    void setTagBudget( const Tag tag, const U64 softBytes, const U64 hardBytes );
+    void getTagBudget( const Tag tag, U64& softBytes, U64& hardBytes );
+    Pressure getTagPressure( const Tag tag );
+    const char* getPressureName( const Pressure pressure );
+
+    /// Set the bytes held outside the engine allocator on behalf of a tag, such as texture memory held
+    /// by the graphics driver.  These count towards the budget of the tag but not its statistics.
+    void setTagExternalBytes( const Tag tag, const S64 bytes );
+
+    U32 registerPressureCallback( PressureCallback callback, void* pUserData );
+    void unregisterPressureCallback( const U32 callbackKey );
+
+    /// Notify that the platform is low on memory.  Every tag is put under hard pressure for a few
+    /// seconds from the next budget check.  This is safe to call from any thread.
+    void raiseLowMemoryWarning( void );
+
+    /// Compare the tags against their budgets and raise the pressure callbacks (and the script
+    /// callback "onMemoryPressure(%tag, %pressure)" if it exists).  Called once per-frame on the main thread.
+    void checkBudgets( void );
+
+    /// Bytes held by the thread caching backend, whether allocated or cached.
+    U64 getThreadCachingReservedBytes( void );
+
+    /// Allocate a small block from the size-class pool of the thread caching backend, whichever
+    /// backend is current.  This keeps frequently resized or short-lived small blocks out of the
+    /// general heap.  Blocks too large for the pool, or any block whilst small-block pooling is
+    /// disabled, are allocated from the current backend.  The block is freed with dFree().
+    void* allocateSmall( const dsize_t size, const char* pFileName = NULL, const U32 line = 0 );
+
+    /// Reallocate a block, keeping it in the small-block pool where it fits.
+    /// A block that stays within its size class is resized in place.
+    void* reallocateSmall( void* ptr, const dsize_t size, const char* pFileName = NULL, const U32 line = 0 );
+
+    /// Enable or disable the small-block pool.  Existing pooled blocks remain valid.
+    void setSmallBlockPooling( const bool enabled );
+    bool getSmallBlockPooling( void );
+
+    /// Enable or disable large pages, which are enabled by default in dedicated builds.  Whilst
+    /// enabled, allocations of a megabyte or more and the chunks of arenas are allocated from
+    /// large (huge) pages, where the platform supports them, on the NUMA node of the allocating
+    /// thread.  This reduces TLB misses and remote memory traffic for large scenes on servers.
+    /// Existing allocations remain valid.
+    void setLargePages( const bool enabled );
+    bool getLargePages( void );
+
+    /// Set the NUMA node that large page allocations made by the current thread prefer.
+    /// A negative node leaves placement to the operating system.  Worker threads set this to
+    /// the node they start on.
+    void setThreadNumaNode( const S32 node );
+    S32 getThreadNumaNode( void );
+
+    /// Sets the memory tag for the current thread whilst in scope.
+    class TagScope
+    {
+    public:
+        explicit TagScope( const Tag tag ) : mPreviousTag( setCurrentTag( tag ) ) {}
+        ~TagScope() { setCurrentTag( mPreviousTag ); }
+
+    private:
+        Tag mPreviousTag;
+    };
+
+    struct ArenaChunk;
+
+    /// A region for allocations that are released together, such as those made whilst loading a level.
+    ///
+    /// Whilst an arena is current on a thread, new allocations made by that thread (other than
+    /// reallocations and small-block pool allocations) are carved sequentially from large chunks
+    /// of the arena.  They are freed as usual with dFree() or delete, and destructors run as usual,
+    /// but freeing a block only counts it off against its chunk.  Once the arena is closed, each
+    /// chunk is returned to the system as a whole when the last block in it is freed so the cost of
+    /// freeing the blocks one by one is avoided.  Blocks that outlive the arena keep their chunk alive.
+    ///
+    /// An arena must only be current on one thread at a time.
+    class Arena
+    {
+    public:
+        Arena( void );
+
+        /// Closes the arena.  The arena must not be current on any thread.
+        ~Arena();
+
+        /// Stop allocating from the arena.  Chunks are freed once all their blocks have been freed.
+        void close( void );
+
+        inline bool isClosed( void ) const { return mClosed; }
+        inline U32 getAllocationCount( void ) const { return mAllocationCount; }
+        inline U64 getAllocatedBytes( void ) const { return mAllocatedBytes; }
+        inline U32 getChunkCount( void ) const { return mChunkCount; }
+
+    private:
+        friend void* arenaAllocate( dsize_t size );
+
+        void* allocate( const dsize_t size );
+
+        ArenaChunk* mpChunk;
+        dsize_t     mChunkUsed;
+        U32         mAllocationCount;
+        U64         mAllocatedBytes;
+        U32         mChunkCount;
+        bool        mClosed;
+    };
+
+    /// Set the arena that the current thread allocates from, or NULL to allocate from the current backend.
+    /// @return The previous arena.
+    Arena* setCurrentArena( Arena* pArena );
+    Arena* getCurrentArena( void );
+
+    /// Bytes held by the chunks of all arenas, including closed arenas with live blocks.
+    U64 getArenaReservedBytes( void );
+
+    /// Sets the arena for the current thread whilst in scope.
+    class ArenaScope
+    {
+    public:
+        explicit ArenaScope( Arena* pArena ) : mpPreviousArena( setCurrentArena( pArena ) ) {}
+        ~ArenaScope() { setCurrentArena( mpPreviousArena ); }
+
+    private:
+        Arena* mpPreviousArena;
+    };
+
+#ifdef TORQUE_MEMORY_TRACKING
+    /// The capacity of the callsite table.
+    const U32 MaxCallsites = 8192;
+
+    /// The live allocations and allocation rate of a callsite.
+    ///
+    /// Allocations made with dMalloc(), dRealloc() or a Vector are attributed to their source file and
+    /// line.  Allocations made by the global operator new are attributed to the return address of the
+    /// operator, which can be resolved to a source line with the platform debugging tools.  Allocations
+    /// with no known callsite, or beyond the capacity of the callsite table, share a single entry with
+    /// no file name or address.
+    struct CallsiteStats
+    {
+        const char* fileName;
+        const void* address;
+        U32 line;
+        S64 liveBytes;
+        S64 liveCount;
+        U64 totalAllocations;
+        U64 totalBytes;
+        F32 allocationRate;
+        F32 byteRate;
+
+        /// Changes since the last snapshot.
+        S64 liveBytesChange;
+        S64 liveCountChange;
+        U64 allocationsChange;
+    };
+
+    /// Fetch the statistics for up to the specified number of callsites.  Allocation rates are re-sampled at most once per-second.
+    /// @return The number of callsites fetched.
+    U32 getCallsiteStats( CallsiteStats* pStats, const U32 maxCount );
+
+    /// Record the current statistics of all callsites so later changes can be found with getCallsiteStats().
+    void takeCallsiteSnapshot( void );
+#endif
+}
+
 #endif // _PLATFORM_MEMORY_H_
@@ -0,0 +1,439 @@
+﻿//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+/*! @defgroup MemoryFunctions Memory
+	@ingroup TorqueScriptFunctions
+	@{
+*/
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of memory tags.
+    @return The number of memory tags.
+    @sa getMemoryTagName, getMemoryTagStats
+*/
+ConsoleFunctionWithDocs( getMemoryTagCount, ConsoleInt, 1, 1, () )
+{
+    return Memory::TagCount;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the name of a memory tag.
+    @param index The index of the memory tag.
+    @return The name of the memory tag.
+*/
+ConsoleFunctionWithDocs( getMemoryTagName, ConsoleString, 2, 2, ( index ) )
+{
+    const S32 index = dAtoi( argv[1] );
+
+    if ( index < 0 || index >= Memory::TagCount )
+    {
+        Con::warnf( "getMemoryTagName() - Invalid tag index '%d'.", index );
+        return StringTable->EmptyString;
+    }
+
+    return Memory::getTagName( (Memory::Tag)index );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the memory statistics for a subsystem.
+    @param tag The name of the memory tag (General, Scene, Particles, Physics, Script, Textures, Audio or Gui).
+    @return The live bytes, live allocations, allocations per-second, bytes allocated per-second, total allocations and total bytes allocated, separated by spaces.
+*/
+ConsoleFunctionWithDocs( getMemoryTagStats, ConsoleString, 2, 2, ( tag ) )
+{
+    const Memory::Tag tag = Memory::getTagFromName( argv[1] );
+
+    if ( tag == Memory::TagCount )
+    {
+        Con::warnf( "getMemoryTagStats() - Invalid tag '%s'.", argv[1] );
+        return StringTable->EmptyString;
+    }
+
+    Memory::TagStats stats;
+    Memory::getTagStats( tag, stats );
+
+    char* pBuffer = Con::getReturnBuffer( 128 );
+    dSprintf( pBuffer, 128, "%.0f %.0f %.1f %.0f %.0f %.0f",
+        (F64)stats.liveBytes,
+        (F64)stats.liveCount,
+        stats.allocationRate,
+        stats.byteRate,
+        (F64)stats.totalAllocations,
+        (F64)stats.totalBytes );
+    return pBuffer;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Dumps the memory statistics for all subsystems to the console.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs( dumpMemoryStats, ConsoleVoid, 1, 1, () )
+{
+    Con::printf( "Memory (backend '%s', thread caching reserved %.0fK, arenas reserved %.0fK):",
+        Memory::getBackend()->mName,
+        (F64)(Memory::getThreadCachingReservedBytes() / 1024),
+        (F64)(Memory::getArenaReservedBytes() / 1024) );
+    Con::printf( "  %-10s %12s %10s %12s %14s %10s %10s %9s", "Tag", "LiveKB", "Live", "Allocs/s", "KB/s", "SoftKB", "HardKB", "Pressure" );
+
+    for ( U32 n = 0; n < Memory::TagCount; ++n )
+    {
+        Memory::TagStats stats;
+        Memory::getTagStats( (Memory::Tag)n, stats );
+
+        U64 softBytes, hardBytes;
+        Memory::getTagBudget( (Memory::Tag)n, softBytes, hardBytes );
+
+        Con::printf( "  %-10s %12.0f %10.0f %12.1f %14.1f %10.0f %10.0f %9s",
+            Memory::getTagName( (Memory::Tag)n ),
+            (F64)stats.liveBytes / 1024.0,
+            (F64)stats.liveCount,
+            stats.allocationRate,
+            stats.byteRate / 1024.0f,
+            (F64)(softBytes / 1024),
+            (F64)(hardBytes / 1024),
+            Memory::getPressureName( Memory::getTagPressure( (Memory::Tag)n ) ) );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets the memory budgets for a subsystem.  Exceeding a budget raises the memory pressure callbacks,
+    including the script callback onMemoryPressure(%tag, %pressure), so that caches can be released.
+    @param tag The name of the memory tag.
+    @param softBytes The live bytes above which caches should be trimmed (soft pressure).  Zero disables the budget.
+    @param hardBytes The live bytes above which everything that can be released should be (hard pressure).  Zero disables the budget.
+    @return Whether the budgets were set.
+*/
+ConsoleFunctionWithDocs( setMemoryBudget, ConsoleBool, 4, 4, ( tag, softBytes, hardBytes ) )
+{
+    const Memory::Tag tag = Memory::getTagFromName( argv[1] );
+
+    if ( tag == Memory::TagCount )
+    {
+        Con::warnf( "setMemoryBudget() - Invalid tag '%s'.", argv[1] );
+        return false;
+    }
+
+    const F64 softBytes = dAtof( argv[2] );
+    const F64 hardBytes = dAtof( argv[3] );
+
+    if ( softBytes < 0.0 || hardBytes < 0.0 )
+    {
+        Con::warnf( "setMemoryBudget() - Budgets cannot be negative." );
+        return false;
+    }
+
+    Memory::setTagBudget( tag, (U64)softBytes, (U64)hardBytes );
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the memory budgets for a subsystem.
+    @param tag The name of the memory tag.
+    @return The soft budget, hard budget (in bytes) and current pressure ("none", "soft" or "hard") separated by spaces.
+*/
+ConsoleFunctionWithDocs( getMemoryBudget, ConsoleString, 2, 2, ( tag ) )
+{
+    const Memory::Tag tag = Memory::getTagFromName( argv[1] );
+
+    if ( tag == Memory::TagCount )
+    {
+        Con::warnf( "getMemoryBudget() - Invalid tag '%s'.", argv[1] );
+        return StringTable->EmptyString;
+    }
+
+    U64 softBytes, hardBytes;
+    Memory::getTagBudget( tag, softBytes, hardBytes );
+
+    char* pBuffer = Con::getReturnBuffer( 64 );
+    dSprintf( pBuffer, 64, "%.0f %.0f %s", (F64)softBytes, (F64)hardBytes, Memory::getPressureName( Memory::getTagPressure( tag ) ) );
+    return pBuffer;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Simulates a platform low-memory warning, putting every subsystem under hard memory pressure for a few seconds.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs( raiseLowMemoryWarning, ConsoleVoid, 1, 1, () )
+{
+    Memory::raiseLowMemoryWarning();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets the allocation backend used for new allocations.  Existing allocations are released to the backend they came from.
+    @param backend The backend name, either "system" or "threadCaching".
+    @return Whether the backend was set.
+*/
+ConsoleFunctionWithDocs( setMemoryBackend, ConsoleBool, 2, 2, ( backend ) )
+{
+    const Memory::Backend* pBackend = Memory::findBackend( argv[1] );
+
+    if ( pBackend == NULL )
+    {
+        Con::warnf( "setMemoryBackend() - Unknown backend '%s'.", argv[1] );
+        return false;
+    }
+
+    return Memory::setBackend( pBackend );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the allocation backend used for new allocations.
+    @return The backend name.
+*/
+ConsoleFunctionWithDocs( getMemoryBackend, ConsoleString, 1, 1, () )
+{
+    return Memory::getBackend()->mName;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets whether small vectors and pool allocated objects use the small-block pool whichever backend is current.
+    @param enabled Whether small-block pooling is enabled.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs( setMemorySmallBlockPooling, ConsoleVoid, 2, 2, ( enabled ) )
+{
+    Memory::setSmallBlockPooling( dAtob( argv[1] ) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether small vectors and pool allocated objects use the small-block pool.
+    @return Whether small-block pooling is enabled.
+*/
+ConsoleFunctionWithDocs( getMemorySmallBlockPooling, ConsoleBool, 1, 1, () )
+{
+    return Memory::getSmallBlockPooling();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets whether large allocations and arena chunks use large (huge) pages on the NUMA node of the allocating thread.
+    Large pages are enabled by default in dedicated builds.
+    @param enabled Whether large pages are enabled.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs( setMemoryLargePages, ConsoleVoid, 2, 2, ( enabled ) )
+{
+    Memory::setLargePages( dAtob( argv[1] ) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether large allocations and arena chunks use large pages.
+    @return Whether large pages are enabled.
+*/
+ConsoleFunctionWithDocs( getMemoryLargePages, ConsoleBool, 1, 1, () )
+{
+    return Memory::getLargePages();
+}
+
+#ifdef TORQUE_MEMORY_TRACKING
+
+//-----------------------------------------------------------------------------
+
+static S32 QSORT_CALLBACK compareCallsiteLiveBytes( const void* a, const void* b )
+{
+    const S64 liveBytesA = ((const Memory::CallsiteStats*)a)->liveBytes;
+    const S64 liveBytesB = ((const Memory::CallsiteStats*)b)->liveBytes;
+    return liveBytesA < liveBytesB ? 1 : liveBytesA > liveBytesB ? -1 : 0;
+}
+
+//-----------------------------------------------------------------------------
+
+static S32 QSORT_CALLBACK compareCallsiteByteRate( const void* a, const void* b )
+{
+    const F32 byteRateA = ((const Memory::CallsiteStats*)a)->byteRate;
+    const F32 byteRateB = ((const Memory::CallsiteStats*)b)->byteRate;
+    return byteRateA < byteRateB ? 1 : byteRateA > byteRateB ? -1 : 0;
+}
+
+//-----------------------------------------------------------------------------
+
+static S32 QSORT_CALLBACK compareCallsiteLiveBytesChange( const void* a, const void* b )
+{
+    const S64 changeA = ((const Memory::CallsiteStats*)a)->liveBytesChange;
+    const S64 changeB = ((const Memory::CallsiteStats*)b)->liveBytesChange;
+    return changeA < changeB ? 1 : changeA > changeB ? -1 : 0;
+}
+
+//-----------------------------------------------------------------------------
+
+static void formatCallsite( const Memory::CallsiteStats& stats, char* pBuffer, const U32 bufferSize )
+{
+    if ( stats.fileName != NULL )
+        dSprintf( pBuffer, bufferSize, "%s(%d)", stats.fileName, stats.line );
+    else if ( stats.address != NULL )
+        dSprintf( pBuffer, bufferSize, "new@%p", stats.address );
+    else
+        dStrcpy( pBuffer, "<unknown>" );
+}
+
+//-----------------------------------------------------------------------------
+
+static void dumpCallsites( const char* pFunctionName, const U32 maxEntries, const bool byRate, const bool diff, const char* pFileName )
+{
+    Memory::CallsiteStats* pStats = (Memory::CallsiteStats*)dMalloc( sizeof(Memory::CallsiteStats) * Memory::MaxCallsites );
+    U32 count = Memory::getCallsiteStats( pStats, Memory::MaxCallsites );
+
+    // Only callsites that changed are of interest in a diff.
+    if ( diff )
+    {
+        U32 changedCount = 0;
+        for ( U32 n = 0; n < count; ++n )
+        {
+            if ( pStats[n].liveBytesChange != 0 || pStats[n].allocationsChange != 0 )
+                pStats[changedCount++] = pStats[n];
+        }
+        count = changedCount;
+    }
+
+    dQsort( pStats, count, sizeof(Memory::CallsiteStats), diff ? compareCallsiteLiveBytesChange : byRate ? compareCallsiteByteRate : compareCallsiteLiveBytes );
+
+    char callsiteBuffer[1024];
+
+    // Export all the callsites if a file was specified.
+    if ( pFileName != NULL && pFileName[0] != 0 )
+    {
+        FileStream fileStream;
+        if ( fileStream.open( pFileName, FileStream::Write ) )
+        {
+            char lineBuffer[1280];
+            dStrcpy( lineBuffer, "Callsite,LiveBytes,LiveCount,TotalAllocations,TotalBytes,AllocationsPerSecond,BytesPerSecond,LiveBytesChange,LiveCountChange,AllocationsChange" );
+            fileStream.writeLine( (U8*)lineBuffer );
+
+            for ( U32 n = 0; n < count; ++n )
+            {
+                const Memory::CallsiteStats& stats = pStats[n];
+                formatCallsite( stats, callsiteBuffer, sizeof(callsiteBuffer) );
+                dSprintf( lineBuffer, sizeof(lineBuffer), "\"%s\",%.0f,%.0f,%.0f,%.0f,%.1f,%.0f,%.0f,%.0f,%.0f",
+                    callsiteBuffer,
+                    (F64)stats.liveBytes,
+                    (F64)stats.liveCount,
+                    (F64)stats.totalAllocations,
+                    (F64)stats.totalBytes,
+                    stats.allocationRate,
+                    stats.byteRate,
+                    (F64)stats.liveBytesChange,
+                    (F64)stats.liveCountChange,
+                    (F64)stats.allocationsChange );
+                fileStream.writeLine( (U8*)lineBuffer );
+            }
+
+            fileStream.close();
+        }
+        else
+        {
+            Con::warnf( "%s() - Could not open '%s' for write.", pFunctionName, pFileName );
+        }
+    }
+
+    if ( diff )
+        Con::printf( "  %12s %10s %12s  %s", "LiveKB+", "Live+", "Allocs+", "Callsite" );
+    else
+        Con::printf( "  %12s %10s %12s %14s  %s", "LiveKB", "Live", "Allocs/s", "KB/s", "Callsite" );
+
+    for ( U32 n = 0; n < count && n < maxEntries; ++n )
+    {
+        const Memory::CallsiteStats& stats = pStats[n];
+        formatCallsite( stats, callsiteBuffer, sizeof(callsiteBuffer) );
+
+        if ( diff )
+        {
+            Con::printf( "  %12.1f %10.0f %12.0f  %s",
+                (F64)stats.liveBytesChange / 1024.0,
+                (F64)stats.liveCountChange,
+                (F64)stats.allocationsChange,
+                callsiteBuffer );
+        }
+        else
+        {
+            Con::printf( "  %12.1f %10.0f %12.1f %14.1f  %s",
+                (F64)stats.liveBytes / 1024.0,
+                (F64)stats.liveCount,
+                stats.allocationRate,
+                stats.byteRate / 1024.0f,
+                callsiteBuffer );
+        }
+    }
+
+    dFree( pStats );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Records the live allocations of every callsite so that later changes can be shown with memDiff().
+    @return No return value.
+*/
+ConsoleFunctionWithDocs( memSnapshot, ConsoleVoid, 1, 1, () )
+{
+    Memory::takeCallsiteSnapshot();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Dumps the callsites whose live allocations changed since the last memSnapshot(), largest growth first.
+    Callsites that keep growing between snapshots are likely to be leaking.
+    @param maxEntries The maximum number of callsites to dump to the console.  Optional: Defaults to 20.
+    @param fileName A file to export all the changed callsites to as comma-separated values.  Optional.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs( memDiff, ConsoleVoid, 1, 3, ( [maxEntries], [fileName] ) )
+{
+    const U32 maxEntries = argc > 1 ? dAtoi( argv[1] ) : 20;
+
+    Con::printf( "Memory changes since the last snapshot:" );
+    dumpCallsites( "memDiff", maxEntries, false, true, argc > 2 ? argv[2] : NULL );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Dumps the callsites with the most live memory or the highest allocation rate.
+    @param maxEntries The maximum number of callsites to dump to the console.  Optional: Defaults to 20.
+    @param sortBy Either "live" to sort by live bytes or "rate" to sort by bytes allocated per-second.  Optional: Defaults to "live".
+    @param fileName A file to export all the callsites to as comma-separated values.  Optional.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs( memDumpCallsites, ConsoleVoid, 1, 4, ( [maxEntries], [sortBy], [fileName] ) )
+{
+    const U32 maxEntries = argc > 1 ? dAtoi( argv[1] ) : 20;
+    const bool byRate = argc > 2 && dStricmp( argv[2], "rate" ) == 0;
+
+    if ( argc > 2 && !byRate && dStricmp( argv[2], "live" ) != 0 )
+        Con::warnf( "memDumpCallsites() - Unknown sort '%s', sorting by live bytes.", argv[2] );
+
+    Con::printf( "Memory callsites:" );
+    dumpCallsites( "memDumpCallsites", maxEntries, byRate, false, argc > 3 ? argv[3] : NULL );
+}
+
+#endif // TORQUE_MEMORY_TRACKING
+
+/*! @} */ // group MemoryFunctions
@@ -94,4 +94,13 @@ ConsoleFunctionWithDocs( createUUID, ConsoleString, 1, 1, () )
     return Platform::createUUID();
 }
 
+/*! Gets whether this is a headless server that only simulates, started with "-headless".
+    No canvas or audio is available and images and sounds are loaded as metadata only.
+    @return Returns true if headless, false otherwise.
+*/
+ConsoleFunctionWithDocs( isHeadless, ConsoleBool, 1, 1, () )
+{
+    return Platform::isHeadless();
+}
+
 /*! @} */ // group PlatformFunctions
@@ -0,0 +1,207 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _PLATFORM_THREADS_ATOMIC_H_
+#define _PLATFORM_THREADS_ATOMIC_H_
+
+#include "platform/types.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// Atomically replace the pointer at pDest with pNew if it currently equals pOld.
+/// This is a full memory barrier.
+/// @return The pointer that was at pDest before the operation.
+inline void* dCompareAndSwapPointer( void* volatile* pDest, void* pOld, void* pNew )
+{
+#if defined(_MSC_VER)
+#if defined(_WIN64)
+   return _InterlockedCompareExchangePointer( pDest, pNew, pOld );
+#else
+   return (void*)_InterlockedCompareExchange( (long volatile*)pDest, (long)pNew, (long)pOld );
+#endif
+#else
+   return __sync_val_compare_and_swap( pDest, pOld, pNew );
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+/// Atomically replace the pointer at pDest with pNew.
+/// This is a full memory barrier.
+/// @return The pointer that was at pDest before the operation.
+inline void* dExchangePointer( void* volatile* pDest, void* pNew )
+{
+   void* pOld;
+   do
+   {
+      pOld = *pDest;
+   }
+   while ( dCompareAndSwapPointer( pDest, pOld, pNew ) != pOld );
+
+   return pOld;
+}
+
+//-----------------------------------------------------------------------------
+
+/// Atomically increment the value at pValue.
+/// This is a full memory barrier.
+/// @return The incremented value.
+inline S32 dAtomicIncrement( volatile S32* pValue )
+{
+#if defined(_MSC_VER)
+   return (S32)_InterlockedIncrement( (long volatile*)pValue );
+#else
+   return __sync_add_and_fetch( pValue, 1 );
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+/// Atomically decrement the value at pValue.
+/// This is a full memory barrier.
+/// @return The decremented value.
+inline S32 dAtomicDecrement( volatile S32* pValue )
+{
+#if defined(_MSC_VER)
+   return (S32)_InterlockedDecrement( (long volatile*)pValue );
+#else
+   return __sync_sub_and_fetch( pValue, 1 );
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+/// Atomically add amount to the value at pValue.
+/// This is a full memory barrier.
+/// @return The value after the addition.
+inline S32 dAtomicAdd( volatile S32* pValue, const S32 amount )
+{
+#if defined(_MSC_VER)
+   return (S32)_InterlockedExchangeAdd( (long volatile*)pValue, (long)amount ) + amount;
+#else
+   return __sync_add_and_fetch( pValue, amount );
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+/// Atomically replace the value at pValue with newValue if it currently equals oldValue.
+/// This is a full memory barrier.
+/// @return The value that was at pValue before the operation.
+inline S32 dAtomicCompareAndSwap( volatile S32* pValue, const S32 oldValue, const S32 newValue )
+{
+#if defined(_MSC_VER)
+   return (S32)_InterlockedCompareExchange( (long volatile*)pValue, (long)newValue, (long)oldValue );
+#else
+   return __sync_val_compare_and_swap( pValue, oldValue, newValue );
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+/// Atomically replace the value at pValue with newValue.
+/// This is a full memory barrier.
+/// @return The value that was at pValue before the operation.
+inline S32 dAtomicExchange( volatile S32* pValue, const S32 newValue )
+{
+#if defined(_MSC_VER)
+   return (S32)_InterlockedExchange( (long volatile*)pValue, (long)newValue );
+#else
+   S32 oldValue;
+   do
+   {
+      oldValue = *pValue;
+   }
+   while ( __sync_val_compare_and_swap( pValue, oldValue, newValue ) != oldValue );
+
+   return oldValue;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+/// Full memory barrier.  Writes before the barrier are visible to other threads
+/// before any writes after it.
+inline void dMemoryBarrier( void )
+{
+#if defined(_MSC_VER)
+   long barrier;
+   _InterlockedExchange( &barrier, 0 );
+#else
+   __sync_synchronize();
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+/// An integer that is shared between threads.  Every operation is a full memory barrier.
+class AtomicS32
+{
+public:
+   explicit AtomicS32( const S32 value = 0 ) : mValue( value ) {}
+
+   inline S32 load( void ) const { const S32 value = mValue; dMemoryBarrier(); return value; }
+   inline void store( const S32 value ) { dAtomicExchange( &mValue, value ); }
+   inline S32 exchange( const S32 value ) { return dAtomicExchange( &mValue, value ); }
+
+   /// @return The value before the operation.
+   inline S32 compareAndSwap( const S32 oldValue, const S32 newValue ) { return dAtomicCompareAndSwap( &mValue, oldValue, newValue ); }
+
+   /// @return The value after the operation.
+   inline S32 increment( void ) { return dAtomicIncrement( &mValue ); }
+   inline S32 decrement( void ) { return dAtomicDecrement( &mValue ); }
+   inline S32 add( const S32 amount ) { return dAtomicAdd( &mValue, amount ); }
+
+private:
+   AtomicS32( const AtomicS32& );
+   AtomicS32& operator=( const AtomicS32& );
+
+   volatile S32 mValue;
+};
+
+//-----------------------------------------------------------------------------
+
+/// A pointer that is shared between threads.  Every operation is a full memory barrier.
+template< class T > class AtomicPointer
+{
+public:
+   explicit AtomicPointer( T* pValue = NULL ) : mpValue( pValue ) {}
+
+   inline T* load( void ) const { T* pValue = (T*)mpValue; dMemoryBarrier(); return pValue; }
+   inline void store( T* pValue ) { dExchangePointer( (void* volatile*)&mpValue, pValue ); }
+   inline T* exchange( T* pValue ) { return (T*)dExchangePointer( (void* volatile*)&mpValue, pValue ); }
+
+   /// @return The pointer before the operation.
+   inline T* compareAndSwap( T* pOld, T* pNew ) { return (T*)dCompareAndSwapPointer( (void* volatile*)&mpValue, pOld, pNew ); }
+
+private:
+   AtomicPointer( const AtomicPointer& );
+   AtomicPointer& operator=( const AtomicPointer& );
+
+   T* volatile mpValue;
+};
+
+#endif // _PLATFORM_THREADS_ATOMIC_H_
@@ -0,0 +1,455 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "platform/threads/jobSystem.h"
+#include "platform/threads/atomic.h"
+#include "platform/platform.h"
+#include "console/console.h"
+#include "math/mMathFn.h"
+#include "memory/frameAllocator.h"
+#include "memory/factoryCache.h"
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+#define JOBSYSTEM_MAX_WORKERS       32
+
+#if defined(_MSC_VER)
+#define JOBSYSTEM_THREAD_LOCAL __declspec(thread)
+#else
+#define JOBSYSTEM_THREAD_LOCAL __thread
+#endif
+
+JobSystem* JobSystem::smGlobalJobSystem = NULL;
+
+// The job system and queue owned by a worker thread.
+static JOBSYSTEM_THREAD_LOCAL JobSystem* sThreadJobSystem = NULL;
+static JOBSYSTEM_THREAD_LOCAL U32 sThreadQueueIndex = 0;
+
+//-----------------------------------------------------------------------------
+
+// A chunk of a parallel-for.
+struct ParallelForChunk
+{
+   ParallelForChunk( JobSystem::RangeFunction pRangeFunction, void* pContext, const U32 start, const U32 end, Job* pParent, Job::JobFunction pJobFunction ) :
+      mJob( pJobFunction, this, pParent ),
+      mpRangeFunction( pRangeFunction ),
+      mpContext( pContext ),
+      mStart( start ),
+      mEnd( end )
+   {
+   }
+
+   Job                        mJob;
+   JobSystem::RangeFunction   mpRangeFunction;
+   void*                      mpContext;
+   U32                        mStart;
+   U32                        mEnd;
+};
+
+//-----------------------------------------------------------------------------
+
+Job::Job( JobFunction pJobFunction, void* pContext, Job* pParent, const bool mainThreadOnly ) :
+   mpJobFunction( pJobFunction ),
+   mpContext( pContext ),
+   mpParent( pParent ),
+   mUnfinishedCount( 1 ),
+   mMainThreadOnly( mainThreadOnly )
+{
+   // Sanity!
+   AssertFatal( pParent == NULL || !pParent->isFinished(), "Job::Job() - Cannot add a child to a finished job." );
+
+   // The parent isn't finished until this job is.
+   if ( pParent != NULL )
+      dAtomicIncrement( &pParent->mUnfinishedCount );
+}
+
+//-----------------------------------------------------------------------------
+
+bool JobSystem::JobQueue::push( Job* pJob )
+{
+   MutexHandle lock;
+   lock.lock( &mMutex, true );
+
+   if ( mCount == JOBSYSTEM_QUEUE_CAPACITY )
+      return false;
+
+   mJobs[(mHead + mCount) % JOBSYSTEM_QUEUE_CAPACITY] = pJob;
+   mCount++;
+   return true;
+}
+
+//-----------------------------------------------------------------------------
+
+Job* JobSystem::JobQueue::pop( void )
+{
+   MutexHandle lock;
+   lock.lock( &mMutex, true );
+
+   if ( mCount == 0 )
+      return NULL;
+
+   mCount--;
+   return mJobs[(mHead + mCount) % JOBSYSTEM_QUEUE_CAPACITY];
+}
+
+//-----------------------------------------------------------------------------
+
+Job* JobSystem::JobQueue::steal( void )
+{
+   MutexHandle lock;
+   lock.lock( &mMutex, true );
+
+   if ( mCount == 0 )
+      return NULL;
+
+   Job* pJob = mJobs[mHead];
+   mHead = (mHead + 1) % JOBSYSTEM_QUEUE_CAPACITY;
+   mCount--;
+   return pJob;
+}
+
+//-----------------------------------------------------------------------------
+
+JobSystem::JobSystem( const U32 workerCount ) :
+   mpQueues( NULL ),
+   mQueueCount( 0 ),
+   mWorkSemaphore( 0 ),
+   mMainThreadId( ThreadManager::getCurrentThreadId() ),
+   mNextWorkerQueue( 0 ),
+   mShutdown( false )
+{
+   VECTOR_SET_ASSOCIATION( mWorkers );
+
+#ifdef JOBSYSTEM_SINGLE_THREADED
+   // Threads are not available.
+   const U32 clampedWorkerCount = 0;
+#else
+   // Clamp the worker count.
+   const U32 clampedWorkerCount = workerCount > JOBSYSTEM_MAX_WORKERS ? JOBSYSTEM_MAX_WORKERS : workerCount;
+#endif
+
+   // Create a queue for the main thread and each worker.
+   mQueueCount = clampedWorkerCount + 1;
+   mpQueues = new JobQueue[mQueueCount];
+
+   // Start the workers.
+   for ( U32 index = 0; index < clampedWorkerCount; ++index )
+   {
+      mWorkers.push_back( new Thread( workerThreadFunction, this, true ) );
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+JobSystem::~JobSystem()
+{
+   // Flag shutdown.
+   mShutdown = true;
+   dMemoryBarrier();
+
+   // Wake all the workers so they can see the shutdown.
+   for ( S32 index = 0; index < mWorkers.size(); ++index )
+      mWorkSemaphore.release();
+
+   // Destroy the workers (this joins them).
+   for ( S32 index = 0; index < mWorkers.size(); ++index )
+      delete mWorkers[index];
+
+   mWorkers.clear();
+
+   // Sanity!
+   AssertFatal( mMainThreadQueue.mCount == 0, "JobSystem::~JobSystem() - Main thread jobs were never run." );
+
+   delete [] mpQueues;
+   mpQueues = NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+void JobSystem::run( Job* pJob )
+{
+   // Sanity!
+   AssertFatal( pJob != NULL && pJob->mpJobFunction != NULL, "JobSystem::run() - Invalid job." );
+
+   const bool mainThread = isMainThread();
+
+   // Run immediately if there are no workers.
+   if ( mWorkers.size() == 0 && (mainThread || !pJob->mMainThreadOnly) )
+   {
+      execute( pJob );
+      return;
+   }
+
+   // Main thread jobs go on their own queue.
+   if ( pJob->mMainThreadOnly )
+   {
+      while ( !mMainThreadQueue.push( pJob ) )
+      {
+         // Run it immediately if the main thread would be waiting on itself.
+         if ( mainThread )
+         {
+            execute( pJob );
+            return;
+         }
+
+         Platform::sleep( 0 );
+      }
+
+      return;
+   }
+
+   // Run immediately if the queue is full.
+   if ( !mpQueues[getQueueIndex()].push( pJob ) )
+   {
+      execute( pJob );
+      return;
+   }
+
+   // Wake a worker.
+   mWorkSemaphore.release();
+}
+
+//-----------------------------------------------------------------------------
+
+void JobSystem::wait( Job* pJob )
+{
+   // Debug Profiling.
+   PROFILE_SCOPE(JobSystem_Wait);
+
+   const U32 queueIndex = getQueueIndex();
+   const bool mainThread = isMainThread();
+
+   // Run other jobs until the job is finished.
+   while ( !pJob->isFinished() )
+   {
+      Job* pOtherJob = fetchJob( queueIndex, mainThread );
+
+      if ( pOtherJob != NULL )
+         execute( pOtherJob );
+      else
+         Platform::sleep( 0 );
+   }
+
+   // Make sure the results of the job are visible.
+   dMemoryBarrier();
+}
+
+//-----------------------------------------------------------------------------
+
+void JobSystem::parallelFor( RangeFunction pRangeFunction, void* pContext, const U32 itemCount, const U32 grainSize )
+{
+   // Sanity!
+   AssertFatal( pRangeFunction != NULL, "JobSystem::parallelFor() - Invalid range function." );
+
+   // Finish if nothing to do.
+   if ( itemCount == 0 )
+      return;
+
+   // Calculate chunk count.
+   const U32 safeGrainSize = grainSize == 0 ? 1 : grainSize;
+   const U32 chunkCount = (itemCount + safeGrainSize - 1) / safeGrainSize;
+
+   // Process serially if there are no workers or there is only a single chunk.
+   if ( mWorkers.size() == 0 || chunkCount == 1 )
+   {
+      pRangeFunction( pContext, 0, itemCount );
+      return;
+   }
+
+   // Create a job for each chunk as a child of a root job.
+   Job rootJob( parallelForChunkFunction, NULL );
+   ParallelForChunk* pChunks = (ParallelForChunk*)dMalloc( sizeof(ParallelForChunk) * chunkCount );
+   for ( U32 chunk = 0; chunk < chunkCount; ++chunk )
+   {
+      const U32 start = chunk * safeGrainSize;
+      new ( pChunks + chunk ) ParallelForChunk( pRangeFunction, pContext, start, getMin( start + safeGrainSize, itemCount ), &rootJob, parallelForChunkFunction );
+   }
+
+   // Run the chunks.
+   for ( U32 chunk = 0; chunk < chunkCount; ++chunk )
+      run( &pChunks[chunk].mJob );
+
+   // The root job has no work of its own.
+   finish( &rootJob );
+
+   // Participate until all the chunks are finished.
+   wait( &rootJob );
+
+   dFree( pChunks );
+}
+
+//-----------------------------------------------------------------------------
+
+void JobSystem::processMainThreadJobs( void )
+{
+   // Sanity!
+   AssertFatal( isMainThread(), "JobSystem::processMainThreadJobs() - Must be called on the main thread." );
+
+   // Debug Profiling.
+   PROFILE_SCOPE(JobSystem_MainThreadJobs);
+
+   // Run the main thread jobs including any they run.
+   Job* pJob;
+   while ( (pJob = mMainThreadQueue.steal()) != NULL )
+      execute( pJob );
+}
+
+//-----------------------------------------------------------------------------
+
+U32 JobSystem::getQueueIndex( void ) const
+{
+   // Threads other than workers use the main thread queue.
+   return sThreadJobSystem == this ? sThreadQueueIndex : 0;
+}
+
+//-----------------------------------------------------------------------------
+
+bool JobSystem::isMainThread( void ) const
+{
+   return ThreadManager::compare( mMainThreadId, ThreadManager::getCurrentThreadId() );
+}
+
+//-----------------------------------------------------------------------------
+
+Job* JobSystem::fetchJob( const U32 queueIndex, const bool mainThread )
+{
+   Job* pJob = NULL;
+
+   // The main thread runs main thread jobs first.
+   if ( mainThread && (pJob = mMainThreadQueue.steal()) != NULL )
+      return pJob;
+
+   // Take the most recent job from our own queue.
+   if ( (pJob = mpQueues[queueIndex].pop()) != NULL )
+      return pJob;
+
+   // Steal the oldest job from the other queues.
+   for ( U32 offset = 1; offset < mQueueCount; ++offset )
+   {
+      if ( (pJob = mpQueues[(queueIndex + offset) % mQueueCount].steal()) != NULL )
+         return pJob;
+   }
+
+   return NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+void JobSystem::execute( Job* pJob )
+{
+   {
+      // Debug Profiling.
+      PROFILE_SCOPE(JobSystem_Job);
+
+      pJob->mpJobFunction( pJob, pJob->mpContext );
+   }
+
+   finish( pJob );
+}
+
+//-----------------------------------------------------------------------------
+
+void JobSystem::finish( Job* pJob )
+{
+   // Fetch the parent first as a finished job may be destroyed by its waiter.
+   Job* pParent = pJob->mpParent;
+
+   // Finish the parent if this was the last thing it was waiting on.
+   if ( dAtomicDecrement( &pJob->mUnfinishedCount ) == 0 && pParent != NULL )
+      finish( pParent );
+}
+
+//-----------------------------------------------------------------------------
+
+void JobSystem::workerThreadFunction( void* pJobSystem )
+{
+   JobSystem* pSystem = static_cast<JobSystem*>( pJobSystem );
+
+   // Claim a queue (the main thread owns the first).
+   sThreadJobSystem = pSystem;
+   sThreadQueueIndex = (U32)dAtomicIncrement( &pSystem->mNextWorkerQueue );
+
+   // Keep this worker's large page allocations on its NUMA node.
+   Memory::setThreadNumaNode( dGetCurrentNumaNode() );
+
+   while( true )
+   {
+      // Wait for work.
+      pSystem->mWorkSemaphore.acquire();
+
+      // Finish if shutting down.
+      if ( pSystem->mShutdown )
+      {
+         FrameAllocator::releaseThreadArena();
+         FactoryCacheBase::releaseThreadCaches();
+         sThreadJobSystem = NULL;
+         return;
+      }
+
+      // Run jobs until there are none left to find.
+      Job* pJob;
+      while ( (pJob = pSystem->fetchJob( sThreadQueueIndex, false )) != NULL )
+         pSystem->execute( pJob );
+
+      // Discard any frame allocations made by the jobs.
+      FrameAllocator::resetThreadArena();
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+void JobSystem::parallelForChunkFunction( Job* pJob, void* pContext )
+{
+   ParallelForChunk* pChunk = static_cast<ParallelForChunk*>( pContext );
+
+   pChunk->mpRangeFunction( pChunk->mpContext, pChunk->mStart, pChunk->mEnd );
+}
+
+//-----------------------------------------------------------------------------
+
+JobSystem* JobSystem::getGlobal( void )
+{
+   if ( smGlobalJobSystem == NULL )
+   {
+      // Default to a worker for each processor other than the one running the main thread.
+      const S32 processorCount = (S32)ThreadManager::getProcessorCount();
+      const S32 workerCount = Con::getIntVariable( "$pref::JobSystem::workerCount", processorCount - 1 );
+      smGlobalJobSystem = new JobSystem( workerCount < 0 ? 0 : (U32)workerCount );
+   }
+
+   return smGlobalJobSystem;
+}
+
+//-----------------------------------------------------------------------------
+
+void JobSystem::destroyGlobal( void )
+{
+   if ( smGlobalJobSystem == NULL )
+      return;
+
+   // Run any main thread jobs still pending.
+   smGlobalJobSystem->processMainThreadJobs();
+
+   delete smGlobalJobSystem;
+   smGlobalJobSystem = NULL;
+}
@@ -0,0 +1,188 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _PLATFORM_THREADS_JOBSYSTEM_H_
+#define _PLATFORM_THREADS_JOBSYSTEM_H_
+
+#ifndef _TORQUE_TYPES_H_
+#include "platform/types.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_MUTEX_H_
+#include "platform/threads/mutex.h"
+#endif
+
+#ifndef _PLATFORM_THREAD_SEMAPHORE_H_
+#include "platform/threads/semaphore.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+// Emscripten builds without pthreads cannot start threads so every job runs on the calling thread.
+#if defined(TORQUE_OS_EMSCRIPTEN) && !defined(__EMSCRIPTEN_PTHREADS__)
+#define JOBSYSTEM_SINGLE_THREADED
+#endif
+
+#define JOBSYSTEM_QUEUE_CAPACITY    1024
+
+//-----------------------------------------------------------------------------
+
+/// A unit of work run by the JobSystem.
+///
+/// A job is finished once its function has returned and all of its children are finished
+/// so waiting on a parent waits on the whole tree.  Children must be created before the parent
+/// finishes, typically from within the parent's job function.  Jobs are owned by the caller
+/// and must stay alive until they are finished.
+class Job
+{
+   friend class JobSystem;
+
+public:
+   /// Does the work of the job.
+   typedef void (*JobFunction)( Job* pJob, void* pContext );
+
+   /// Create a job, optionally as a child of another and optionally only runnable on the main thread.
+   Job( JobFunction pJobFunction, void* pContext, Job* pParent = NULL, const bool mainThreadOnly = false );
+
+   inline bool       isFinished( void ) const { return mUnfinishedCount == 0; }
+   inline Job*       getParent( void ) const { return mpParent; }
+   inline void*      getContext( void ) const { return mpContext; }
+   inline bool       getMainThreadOnly( void ) const { return mMainThreadOnly; }
+
+private:
+   JobFunction       mpJobFunction;
+   void*             mpContext;
+   Job*              mpParent;
+   volatile S32      mUnfinishedCount;
+   bool              mMainThreadOnly;
+};
+
+//-----------------------------------------------------------------------------
+
+/// A work-stealing job scheduler with a worker thread per core.
+///
+/// Each thread pushes the jobs it runs onto its own queue and takes the most recent
+/// from the back whilst idle workers steal the oldest from the front of the other queues.
+/// A thread waiting on a job runs other jobs until it is finished so jobs may run and wait
+/// on further jobs.  Jobs that must run on the main thread (anything touching the console,
+/// the Sim or GL) are only run by the main thread whilst it waits or when it calls
+/// processMainThreadJobs() each frame.
+///
+/// Work functions must not call into the console or the Sim unless they are main thread jobs.
+/// They may use the profiler macros and each job is profiled as "JobSystem_Job".  Without
+/// any workers (and on Emscripten builds without pthreads) jobs run immediately on the calling thread.
+///
+/// @code
+/// static void myJobFunction( Job* pJob, void* pContext )
+/// {
+///    static_cast<MyObject*>(pContext)->update();
+/// }
+///
+/// Job job( myJobFunction, pMyObject );
+/// JobSystem::getGlobal()->run( &job );
+/// JobSystem::getGlobal()->wait( &job );
+///
+/// JobSystem::getGlobal()->parallelFor( myRangeFunction, pMyObject, itemCount, 256 );
+/// @endcode
+class JobSystem
+{
+public:
+   /// Processes the work items in the range [start, end).
+   typedef void (*RangeFunction)( void* pContext, const U32 start, const U32 end );
+
+private:
+   /// A bounded queue of jobs.  The owner pushes and pops at the back, other threads steal from the front.
+   struct JobQueue
+   {
+      Mutex          mMutex;
+      Job*           mJobs[JOBSYSTEM_QUEUE_CAPACITY];
+      U32            mHead;
+      U32            mCount;
+
+      JobQueue() : mHead( 0 ), mCount( 0 ) {}
+
+      bool           push( Job* pJob );
+      Job*           pop( void );
+      Job*           steal( void );
+   };
+
+   Vector<Thread*>   mWorkers;
+   JobQueue*         mpQueues;
+   U32               mQueueCount;
+   JobQueue          mMainThreadQueue;
+   Semaphore         mWorkSemaphore;
+   ThreadIdent       mMainThreadId;
+   volatile S32      mNextWorkerQueue;
+   volatile bool     mShutdown;
+
+   static JobSystem* smGlobalJobSystem;
+
+   static void       workerThreadFunction( void* pJobSystem );
+   static void       parallelForChunkFunction( Job* pJob, void* pContext );
+
+   U32               getQueueIndex( void ) const;
+   bool              isMainThread( void ) const;
+   Job*              fetchJob( const U32 queueIndex, const bool mainThread );
+   void              execute( Job* pJob );
+   void              finish( Job* pJob );
+
+public:
+   JobSystem( const U32 workerCount );
+   ~JobSystem();
+
+   /// Fetch the number of worker threads (excluding the main thread).
+   inline U32        getWorkerCount( void ) const { return (U32)mWorkers.size(); }
+
+   /// Schedule a job.  The job runs immediately on the calling thread if there are no workers
+   /// or the queue is full (main thread jobs scheduled by other threads wait for space instead).
+   void              run( Job* pJob );
+
+   /// Run other jobs until the job (and all its children) are finished.
+   void              wait( Job* pJob );
+
+   /// Process "itemCount" items in chunks of "grainSize" items, blocking until they are all complete.
+   /// Unlike the ThreadPool, calls may nest as the calling thread runs other jobs whilst it waits.
+   void              parallelFor( RangeFunction pRangeFunction, void* pContext, const U32 itemCount, const U32 grainSize );
+
+   /// Run any pending main thread jobs.  Called by the main loop each frame.
+   void              processMainThreadJobs( void );
+
+   /// Fetch the global job system, creating it on first use (this must be on the main thread).
+   /// The worker count is taken from "$pref::JobSystem::workerCount", defaulting to one less than the processor count.
+   static JobSystem* getGlobal( void );
+
+   /// Destroy the global job system.
+   static void       destroyGlobal( void );
+
+   /// Gets whether the global job system exists.
+   static inline bool hasGlobal( void ) { return smGlobalJobSystem != NULL; }
+};
+
+#endif // _PLATFORM_THREADS_JOBSYSTEM_H_
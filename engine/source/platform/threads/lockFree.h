@@ -0,0 +1,315 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#ifndef _PLATFORM_THREADS_LOCKFREE_H_
+#define _PLATFORM_THREADS_LOCKFREE_H_
+
+#ifndef _PLATFORM_THREADS_ATOMIC_H_
+#include "platform/threads/atomic.h"
+#endif
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// A lock that spins rather than sleeping, for guarding a few instructions of work.
+/// Not recursive.  Use a Mutex if the lock may be held for long.
+class SpinLock
+{
+public:
+   SpinLock() : mLocked( 0 ) {}
+
+   inline bool tryLock( void ) { return dAtomicCompareAndSwap( &mLocked, 0, 1 ) == 0; }
+
+   inline void lock( void )
+   {
+      while ( !tryLock() )
+      {
+         // Wait until the lock looks free before trying again.
+         while ( mLocked != 0 )
+            Platform::sleep( 0 );
+      }
+   }
+
+   inline void unlock( void ) { dAtomicExchange( &mLocked, 0 ); }
+
+private:
+   SpinLock( const SpinLock& );
+   SpinLock& operator=( const SpinLock& );
+
+   volatile S32 mLocked;
+};
+
+//-----------------------------------------------------------------------------
+
+/// Holds a SpinLock for the lifetime of the handle.
+class SpinLockHandle
+{
+public:
+   SpinLockHandle( SpinLock* pLock ) : mpLock( pLock ) { mpLock->lock(); }
+   ~SpinLockHandle() { mpLock->unlock(); }
+
+private:
+   SpinLock* mpLock;
+};
+
+//-----------------------------------------------------------------------------
+
+/// A spinning reader-writer lock.  Any number of readers or a single writer may hold it.
+/// Writers are not given priority so the lock suits data that is read often and written rarely.
+class ReadWriteLock
+{
+public:
+   ReadWriteLock() : mState( 0 ) {}
+
+   inline void lockRead( void )
+   {
+      for ( ;; )
+      {
+         const S32 state = mState;
+         if ( state >= 0 && dAtomicCompareAndSwap( &mState, state, state + 1 ) == state )
+            return;
+
+         Platform::sleep( 0 );
+      }
+   }
+
+   inline void unlockRead( void ) { dAtomicDecrement( &mState ); }
+
+   inline void lockWrite( void )
+   {
+      while ( dAtomicCompareAndSwap( &mState, 0, -1 ) != 0 )
+         Platform::sleep( 0 );
+   }
+
+   inline void unlockWrite( void ) { dAtomicExchange( &mState, 0 ); }
+
+private:
+   ReadWriteLock( const ReadWriteLock& );
+   ReadWriteLock& operator=( const ReadWriteLock& );
+
+   /// The number of readers or -1 when held by a writer.
+   volatile S32 mState;
+};
+
+//-----------------------------------------------------------------------------
+
+/// A fixed size ring that passes values from one producer thread to one consumer thread
+/// without locking.  Capacity must be a power of two.
+///
+/// Each side only writes its own index and fences around the slot it touches, so a value is
+/// always completely written before the consumer can see it and completely read before the
+/// producer can reuse its slot.
+template< class T, U32 Capacity > class SPSCQueue
+{
+public:
+   SPSCQueue() : mHead( 0 ), mTail( 0 )
+   {
+      AssertFatal( Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "SPSCQueue - Capacity must be a power of two." );
+   }
+
+   /// Producer only.
+   /// @return False if the queue is full.
+   bool push( const T& value )
+   {
+      const U32 tail = mTail;
+      if ( tail - mHead == Capacity )
+         return false;
+
+      mElements[tail & (Capacity - 1)] = value;
+      dMemoryBarrier();
+      mTail = tail + 1;
+      return true;
+   }
+
+   /// Consumer only.
+   /// @return False if the queue is empty.
+   bool pop( T& value )
+   {
+      const U32 head = mHead;
+      if ( head == mTail )
+         return false;
+
+      dMemoryBarrier();
+      value = mElements[head & (Capacity - 1)];
+      dMemoryBarrier();
+      mHead = head + 1;
+      return true;
+   }
+
+   /// Only exact when called from the producer or the consumer while the other side is idle.
+   inline U32 size( void ) const { return mTail - mHead; }
+   inline bool isEmpty( void ) const { return mTail == mHead; }
+   inline U32 capacity( void ) const { return Capacity; }
+
+private:
+   SPSCQueue( const SPSCQueue& );
+   SPSCQueue& operator=( const SPSCQueue& );
+
+   T mElements[Capacity];
+   volatile U32 mHead;
+   volatile U32 mTail;
+};
+
+//-----------------------------------------------------------------------------
+
+/// A node of an MPSCQueue.  Queued types derive from this.
+class MPSCQueueNode
+{
+public:
+   MPSCQueueNode() : mpQueueNext( NULL ) {}
+
+   MPSCQueueNode* volatile mpQueueNext;
+};
+
+//-----------------------------------------------------------------------------
+
+/// An unbounded intrusive queue that any number of threads may push to and a single thread pops
+/// from, in push order, without locking.  Nodes are owned by the caller and a node may only be
+/// in one queue at a time.
+///
+/// A push is a single exchange so producers never wait on each other.  If a producer is
+/// preempted part way through a push the consumer sees the queue as empty from that node on
+/// until the push completes.
+template< class T > class MPSCQueue
+{
+public:
+   MPSCQueue() : mpHead( &mStub ), mpTail( &mStub ) {}
+
+   /// Any thread.
+   void push( T* pValue )
+   {
+      pushNode( static_cast<MPSCQueueNode*>( pValue ) );
+   }
+
+   /// Consumer only.
+   /// @return The oldest value or NULL if the queue is empty.
+   T* pop( void )
+   {
+      MPSCQueueNode* pTail = mpTail;
+      MPSCQueueNode* pNext = pTail->mpQueueNext;
+
+      // Skip the stub.
+      if ( pTail == &mStub )
+      {
+         if ( pNext == NULL )
+            return NULL;
+
+         mpTail = pNext;
+         pTail = pNext;
+         pNext = pNext->mpQueueNext;
+      }
+
+      if ( pNext != NULL )
+      {
+         dMemoryBarrier();
+         mpTail = pNext;
+         return static_cast<T*>( pTail );
+      }
+
+      // The tail is the last node unless a push is in progress.
+      if ( pTail != mpHead )
+         return NULL;
+
+      // Requeue the stub so the last node can be taken.
+      pushNode( &mStub );
+
+      pNext = pTail->mpQueueNext;
+      if ( pNext == NULL )
+         return NULL;
+
+      dMemoryBarrier();
+      mpTail = pNext;
+      return static_cast<T*>( pTail );
+   }
+
+   /// Consumer only.
+   inline bool isEmpty( void ) const { return mpTail == &mStub && mStub.mpQueueNext == NULL; }
+
+private:
+   MPSCQueue( const MPSCQueue& );
+   MPSCQueue& operator=( const MPSCQueue& );
+
+   void pushNode( MPSCQueueNode* pNode )
+   {
+      pNode->mpQueueNext = NULL;
+      MPSCQueueNode* pPrevious = (MPSCQueueNode*)dExchangePointer( (void* volatile*)&mpHead, pNode );
+      pPrevious->mpQueueNext = pNode;
+   }
+
+   MPSCQueueNode* volatile mpHead;
+   MPSCQueueNode* mpTail;
+   MPSCQueueNode mStub;
+};
+
+//-----------------------------------------------------------------------------
+
+/// Shares a small plain value written by one thread with any number of reader threads.
+/// Readers never block the writer; they retry if the value changed while they copied it.
+/// Writers must be serialized by the caller.  T must be copyable with a plain memory copy.
+template< class T > class SeqLock
+{
+public:
+   SeqLock() : mSequence( 0 ) {}
+   explicit SeqLock( const T& value ) : mSequence( 0 ), mValue( value ) {}
+
+   void write( const T& value )
+   {
+      // An odd sequence marks a write in progress.
+      dAtomicIncrement( &mSequence );
+      mValue = value;
+      dAtomicIncrement( &mSequence );
+   }
+
+   T read( void ) const
+   {
+      for ( ;; )
+      {
+         const S32 sequence = mSequence;
+         if ( (sequence & 1) == 0 )
+         {
+            dMemoryBarrier();
+            const T value = mValue;
+            dMemoryBarrier();
+            if ( mSequence == sequence )
+               return value;
+         }
+
+         Platform::sleep( 0 );
+      }
+   }
+
+   /// Incremented twice per write.
+   inline U32 getSequence( void ) const { return (U32)mSequence; }
+
+private:
+   SeqLock( const SeqLock& );
+   SeqLock& operator=( const SeqLock& );
+
+   volatile S32 mSequence;
+   T mValue;
+};
+
+#endif // _PLATFORM_THREADS_LOCKFREE_H_
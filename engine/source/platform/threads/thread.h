@@ -119,6 +119,9 @@ public:
    /// platforms do not guarantee that this ID stays the same over the life of 
    /// the thread, so use ThreadManager::compare() to compare thread ids.
    static ThreadIdent getCurrentThreadId();
+
+   /// Returns the number of processors available to run threads (at least one).
+   static U32 getProcessorCount();
    
    /// Each thread should add itself to the thread pool the first time it runs.
    
@@ -0,0 +1,242 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "platform/threads/threadPool.h"
+#include "platform/threads/thread.h"
+#include "console/console.h"
+#include "math/mMathFn.h"
+#include "memory/frameAllocator.h"
+#include "memory/factoryCache.h"
+
+//-----------------------------------------------------------------------------
+
+#define THREADPOOL_MAX_WORKERS      32
+#define THREADPOOL_DEFAULT_WORKERS  3
+
+ThreadPool* ThreadPool::smGlobalPool = NULL;
+
+//-----------------------------------------------------------------------------
+
+ThreadPool::ThreadPool( const U32 workerCount ) :
+   mWorkSemaphore( 0 ),
+   mDoneSemaphore( 0 ),
+   mShutdown( false ),
+   mpRangeFunction( NULL ),
+   mpContext( NULL ),
+   mItemCount( 0 ),
+   mChunkSize( 0 ),
+   mNextItem( 0 ),
+   mChunksPending( 0 ),
+   mCallerWaiting( false )
+{
+   VECTOR_SET_ASSOCIATION( mWorkers );
+
+   // Clamp the worker count.
+   const U32 clampedWorkerCount = workerCount > THREADPOOL_MAX_WORKERS ? THREADPOOL_MAX_WORKERS : workerCount;
+
+   // Start the workers.
+   for ( U32 index = 0; index < clampedWorkerCount; ++index )
+   {
+      mWorkers.push_back( new Thread( workerThreadFunction, this, true ) );
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+ThreadPool::~ThreadPool()
+{
+   // Sanity!
+   AssertFatal( mpRangeFunction == NULL, "ThreadPool::~ThreadPool() - Cannot destroy the pool whilst a batch is in progress." );
+
+   // Flag shutdown.
+   mShutdown = true;
+
+   // Wake all the workers so they can see the shutdown.
+   for ( S32 index = 0; index < mWorkers.size(); ++index )
+      mWorkSemaphore.release();
+
+   // Destroy the workers (this joins them).
+   for ( S32 index = 0; index < mWorkers.size(); ++index )
+      delete mWorkers[index];
+
+   mWorkers.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void ThreadPool::parallelFor( RangeFunction pRangeFunction, void* pContext, const U32 itemCount, const U32 chunkSize )
+{
+   // Sanity!
+   AssertFatal( pRangeFunction != NULL, "ThreadPool::parallelFor() - Invalid range function." );
+
+   // Finish if nothing to do.
+   if ( itemCount == 0 )
+      return;
+
+   // Calculate chunk count.
+   const U32 safeChunkSize = chunkSize == 0 ? 1 : chunkSize;
+   const U32 chunkCount = (itemCount + safeChunkSize - 1) / safeChunkSize;
+
+   // Process serially if there are no workers or there is only a single chunk.
+   if ( mWorkers.size() == 0 || chunkCount == 1 )
+   {
+      pRangeFunction( pContext, 0, itemCount );
+      return;
+   }
+
+   // Configure the batch.
+   mBatchMutex.lock();
+
+   // Process serially if a batch is already in progress (a nested or concurrent call).
+   if ( mpRangeFunction != NULL )
+   {
+      mBatchMutex.unlock();
+      pRangeFunction( pContext, 0, itemCount );
+      return;
+   }
+
+   mpRangeFunction = pRangeFunction;
+   mpContext       = pContext;
+   mItemCount      = itemCount;
+   mChunkSize      = safeChunkSize;
+   mNextItem       = 0;
+   mChunksPending  = chunkCount;
+   mCallerWaiting  = false;
+   mBatchMutex.unlock();
+
+   // Wake only as many workers as there are chunks the caller won't immediately take.
+   const U32 wakeCount = getMin( chunkCount - 1, (U32)mWorkers.size() );
+   for ( U32 index = 0; index < wakeCount; ++index )
+      mWorkSemaphore.release();
+
+   // Participate in the batch.
+   while( processChunk() ) {}
+
+   // Wait for any chunks still being processed by the workers.
+   mBatchMutex.lock();
+   if ( mChunksPending > 0 )
+   {
+      mCallerWaiting = true;
+      mBatchMutex.unlock();
+      mDoneSemaphore.acquire();
+      mBatchMutex.lock();
+   }
+
+   // Reset the batch.
+   mpRangeFunction = NULL;
+   mpContext       = NULL;
+   mBatchMutex.unlock();
+}
+
+//-----------------------------------------------------------------------------
+
+bool ThreadPool::processChunk( void )
+{
+   // Fetch the next chunk.
+   mBatchMutex.lock();
+   if ( mpRangeFunction == NULL || mNextItem >= mItemCount )
+   {
+      mBatchMutex.unlock();
+      return false;
+   }
+   const U32 start = mNextItem;
+   const U32 end = getMin( start + mChunkSize, mItemCount );
+   mNextItem = end;
+   RangeFunction pRangeFunction = mpRangeFunction;
+   void* pContext = mpContext;
+   mBatchMutex.unlock();
+
+   // Process the chunk.
+   pRangeFunction( pContext, start, end );
+
+   // Complete the chunk.
+   mBatchMutex.lock();
+   const bool signalCaller = --mChunksPending == 0 && mCallerWaiting;
+   if ( signalCaller )
+      mCallerWaiting = false;
+   mBatchMutex.unlock();
+
+   // Signal the caller if it's waiting on the final chunk.
+   if ( signalCaller )
+      mDoneSemaphore.release();
+
+   return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void ThreadPool::workerThreadFunction( void* pThreadPool )
+{
+   ThreadPool* pPool = static_cast<ThreadPool*>( pThreadPool );
+
+   // Keep this worker's large page allocations on its NUMA node.
+   Memory::setThreadNumaNode( dGetCurrentNumaNode() );
+
+   while( true )
+   {
+      // Wait for work.
+      pPool->mWorkSemaphore.acquire();
+
+      // Finish if shutting down.
+      if ( pPool->mShutdown )
+      {
+         FrameAllocator::releaseThreadArena();
+         FactoryCacheBase::releaseThreadCaches();
+         return;
+      }
+
+      // Process chunks until the batch is exhausted.
+      while( pPool->processChunk() ) {}
+
+      // Discard any frame allocations made by the batch.
+      FrameAllocator::resetThreadArena();
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+ThreadPool* ThreadPool::getGlobal( void )
+{
+   if ( smGlobalPool == NULL )
+   {
+#if defined(TORQUE_OS_EMSCRIPTEN)
+      // Threads are not available.
+      const S32 workerCount = 0;
+#else
+      const S32 workerCount = Con::getIntVariable( "$pref::ThreadPool::workerCount", THREADPOOL_DEFAULT_WORKERS );
+#endif
+      smGlobalPool = new ThreadPool( workerCount < 0 ? 0 : (U32)workerCount );
+   }
+
+   return smGlobalPool;
+}
+
+//-----------------------------------------------------------------------------
+
+void ThreadPool::destroyGlobal( void )
+{
+   if ( smGlobalPool == NULL )
+      return;
+
+   delete smGlobalPool;
+   smGlobalPool = NULL;
+}
@@ -0,0 +1,111 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _PLATFORM_THREADS_THREADPOOL_H_
+#define _PLATFORM_THREADS_THREADPOOL_H_
+
+#ifndef _TORQUE_TYPES_H_
+#include "platform/types.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_MUTEX_H_
+#include "platform/threads/mutex.h"
+#endif
+
+#ifndef _PLATFORM_THREAD_SEMAPHORE_H_
+#include "platform/threads/semaphore.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class Thread;
+
+//-----------------------------------------------------------------------------
+
+/// A fixed set of worker threads used to split a range of independent work items
+/// into chunks and process them in parallel.
+///
+/// The calling thread always participates in the work and the call does not return
+/// until every chunk has been processed so callers can treat a parallel range exactly
+/// like a serial loop.  Work functions must not call into the console or the Sim
+/// as neither is thread-safe.  They may use the profiler macros.
+///
+/// @code
+/// static void myRangeFunction( void* pContext, const U32 start, const U32 end )
+/// {
+///    for( U32 index = start; index < end; ++index )
+///       static_cast<MyObject*>(pContext)->update( index );
+/// }
+///
+/// ThreadPool::getGlobal()->parallelFor( myRangeFunction, pMyObject, itemCount, 256 );
+/// @endcode
+class ThreadPool
+{
+public:
+   /// Processes the work items in the range [start, end).
+   typedef void (*RangeFunction)( void* pContext, const U32 start, const U32 end );
+
+private:
+   Vector<Thread*>   mWorkers;
+   Mutex             mBatchMutex;
+   Semaphore         mWorkSemaphore;
+   Semaphore         mDoneSemaphore;
+   bool              mShutdown;
+
+   /// Current batch.
+   RangeFunction     mpRangeFunction;
+   void*             mpContext;
+   U32               mItemCount;
+   U32               mChunkSize;
+   U32               mNextItem;
+   U32               mChunksPending;
+   bool              mCallerWaiting;
+
+   static ThreadPool* smGlobalPool;
+
+   static void       workerThreadFunction( void* pThreadPool );
+   bool              processChunk( void );
+
+public:
+   ThreadPool( const U32 workerCount );
+   ~ThreadPool();
+
+   /// Fetch the number of worker threads (excluding the calling thread).
+   inline U32        getWorkerCount( void ) const { return (U32)mWorkers.size(); }
+
+   /// Process "itemCount" items in chunks of "chunkSize" items, blocking until they are all complete.
+   /// Calls made whilst another batch is in progress (e.g. from within a range function) are processed serially.
+   void              parallelFor( RangeFunction pRangeFunction, void* pContext, const U32 itemCount, const U32 chunkSize );
+
+   /// Fetch the global pool, creating it on first use.
+   /// The worker count is taken from "$pref::ThreadPool::workerCount".
+   static ThreadPool* getGlobal( void );
+
+   /// Destroy the global pool.
+   static void       destroyGlobal( void );
+};
+
+#endif // _PLATFORM_THREADS_THREADPOOL_H_
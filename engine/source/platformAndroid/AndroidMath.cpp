@@ -27,6 +27,7 @@
 
 extern void mInstallLibrary_C();
 extern void mInstallLibrary_Vec();
+extern void mInstall_Library_NEON();
 
 
 //--------------------------------------
@@ -73,6 +74,11 @@ void Math::init(U32 properties)
    Con::printf("Math Init:");
    Con::printf("   Installing Standard C extensions");
    mInstallLibrary_C();
+
+   #if defined(__ARM_NEON__) || defined(__ARM_NEON)
+   Con::printf("   Installing NEON extensions");
+   mInstall_Library_NEON();
+   #endif
    
    #if defined(__VEC__)
    if (properties & CPU_PROP_ALTIVEC)
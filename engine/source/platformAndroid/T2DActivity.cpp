@@ -1178,6 +1178,10 @@ static void engine_handle_cmd(struct android_app* app, int32_t cmd) {
             break;
         case APP_CMD_PAUSE:
             break;
+        case APP_CMD_LOW_MEMORY:
+            // Release any cached data that isn't in use.
+            Memory::raiseLowMemoryWarning();
+            break;
     }
 }
 
@@ -31,5 +31,10 @@ void Processor::init()
    PlatformSystemInfo.processor.name = StringTable->insert("JavaScript");
 
    PlatformSystemInfo.processor.properties = CPU_PROP_PPCMIN;
+
+   // Builds with wasm SIMD (TORQUE_WASM_SIMD) compile the SSE kernels to SIMD128.
+#if defined(__wasm_simd128__) && defined(__SSE__)
+   PlatformSystemInfo.processor.properties |= CPU_PROP_SSE;
+#endif
 }
 
@@ -26,6 +26,7 @@
 
 #include "math/mMatrix.h"
 #include "math/mPoint.h"
+#include "graphics/dgl.h"
 
 
 #define	INV_255		0.0039215686f
@@ -195,19 +196,19 @@ void glEnd()
     }
     
     if (beginEndVertex_size > 0) {
-        glEnableClientState( GL_VERTEX_ARRAY );
+        dglEnableClientState( GL_VERTEX_ARRAY );
         glVertexPointer( 4, GL_FLOAT, 4*sizeof(GL_FLOAT), beginEndVertex );
     }
     if (beginEndNormal_size > 0) {
-        glEnableClientState( GL_NORMAL_ARRAY );
+        dglEnableClientState( GL_NORMAL_ARRAY );
         glNormalPointer( GL_FLOAT, 3*sizeof(GL_FLOAT), beginEndNormal );
     }
     if (beginEndColor_size > 0) {
-        glEnableClientState( GL_COLOR_ARRAY );
+        dglEnableClientState( GL_COLOR_ARRAY );
         glColorPointer( 4, GL_FLOAT, 4*sizeof(GL_FLOAT), beginEndColor );
     }
     if (beginEndTexCoord2f_size > 0) {
-        glEnableClientState( GL_TEXTURE_COORD_ARRAY );
+        dglEnableClientState( GL_TEXTURE_COORD_ARRAY );
         glTexCoordPointer( 2, GL_FLOAT, 2*sizeof(GL_FLOAT), beginEndTexCoord2f );
     }
 
@@ -261,16 +262,16 @@ void glEnd()
     }
     
     if (beginEndVertex_size > 0) {
-        glDisableClientState( GL_VERTEX_ARRAY );
+        dglDisableClientState( GL_VERTEX_ARRAY );
     }
     if (beginEndNormal_size > 0) {
-        glDisableClientState( GL_NORMAL_ARRAY );
+        dglDisableClientState( GL_NORMAL_ARRAY );
     }
     if (beginEndColor_size > 0) {
-        glDisableClientState( GL_COLOR_ARRAY );
+        dglDisableClientState( GL_COLOR_ARRAY );
     }
     if (beginEndTexCoord2f_size > 0) {
-        glDisableClientState( GL_TEXTURE_COORD_ARRAY );
+        dglDisableClientState( GL_TEXTURE_COORD_ARRAY );
     }
     beginEndMode = -1;	
     int glError;
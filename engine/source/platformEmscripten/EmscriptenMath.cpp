@@ -27,10 +27,11 @@
 
 extern void mInstallLibrary_C();
 extern void mInstallLibrary_Vec();
+extern void mInstall_Library_SSE();
 
 
 //--------------------------------------
-ConsoleFunction( MathInit, void, 1, 10, "(DETECT|C)")
+ConsoleFunction( MathInit, void, 1, 10, "(DETECT|C|SSE)")
 {
    U32 properties = CPU_PROP_C;  // C entensions are always used
    
@@ -49,6 +50,10 @@ ConsoleFunction( MathInit, void, 1, 10, "(DETECT|C)")
          properties |= CPU_PROP_C; 
          continue; 
       }
+      if (dStricmp(*argv, "SSE") == 0) { 
+         properties |= CPU_PROP_SSE; 
+         continue; 
+      }
       Con::printf("Error: MathInit(): ignoring unknown math extension '%s'", *argv);
    }
    Math::init(properties);
@@ -69,6 +74,12 @@ void Math::init(U32 properties)
    Con::printf("Math Init:");
    Con::printf("   Installing Standard C extensions");
    mInstallLibrary_C();
+
+   if (properties & CPU_PROP_SSE)
+   {
+      Con::printf("   Installing SSE extensions (wasm SIMD)");
+      mInstall_Library_SSE();
+   }
    
    Con::printf(" ");
 }   
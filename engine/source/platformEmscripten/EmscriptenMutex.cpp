@@ -29,16 +29,28 @@
 #include "platform/threads/thread.h"
 #include "memory/safeDelete.h"
 
+// Without pthreads (TORQUE_WASM_THREADS) there is only the main thread so locking only tracks state.
 struct PlatformMutexData
 {
+#ifdef __EMSCRIPTEN_PTHREADS__
+   pthread_mutex_t   mMutex;
+#endif
    bool              locked;
    U32         lockedByThread;
 };
 
 Mutex::Mutex(void)
 {
-   bool ok;
    mData = new PlatformMutexData;
+
+#ifdef __EMSCRIPTEN_PTHREADS__
+   pthread_mutexattr_t attr;
+   pthread_mutexattr_init(&attr);
+   pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+   const int ok = pthread_mutex_init(&mData->mMutex, &attr);
+   pthread_mutexattr_destroy(&attr);
+   AssertFatal(ok == 0, "Mutex() failed: pthread_mutex_init() failed.");
+#endif
    
    mData->locked = false;
    mData->lockedByThread = 0;
@@ -46,11 +58,25 @@ Mutex::Mutex(void)
 
 Mutex::~Mutex()
 {
+#ifdef __EMSCRIPTEN_PTHREADS__
+   pthread_mutex_destroy(&mData->mMutex);
+#endif
    SAFE_DELETE(mData);
 }
  
 bool Mutex::lock( bool block)
 {
+#ifdef __EMSCRIPTEN_PTHREADS__
+   if( block )
+   {
+      const int ok = pthread_mutex_lock(&mData->mMutex);
+      AssertFatal(ok == 0, "Mutex::lock() failed: pthread_mutex_lock() failed.");
+   }
+   else if( pthread_mutex_trylock(&mData->mMutex) != 0 )
+   {
+      return false;
+   }
+#endif
    mData->locked = true;
    mData->lockedByThread = ThreadManager::getCurrentThreadId();
    return true;
@@ -60,4 +86,7 @@ void Mutex::unlock()
 {
    mData->locked = false;
    mData->lockedByThread = 0;
+#ifdef __EMSCRIPTEN_PTHREADS__
+   pthread_mutex_unlock(&mData->mMutex);
+#endif
 }
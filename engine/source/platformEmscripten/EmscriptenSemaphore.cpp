@@ -24,15 +24,29 @@
 #include "platform/platform.h"
 #include "platform/threads/semaphore.h"
 
+#ifdef __EMSCRIPTEN_PTHREADS__
+#include <pthread.h>
+#endif
+
+// Without pthreads (TORQUE_WASM_THREADS) nothing can ever release a semaphore the main thread
+// is waiting on so acquiring always succeeds.
 struct PlatformSemaphore
 {
+#ifdef __EMSCRIPTEN_PTHREADS__
+   pthread_mutex_t mDarkroom;
+   pthread_cond_t  mCond;
+#endif
    S32 count;
 };
 
 Semaphore::Semaphore(S32 initialCount)
 {
-   bool ok;
    PlatformSemaphore* semaphore = new PlatformSemaphore();
+
+#ifdef __EMSCRIPTEN_PTHREADS__
+   pthread_mutex_init(&semaphore->mDarkroom, NULL);
+   pthread_cond_init(&semaphore->mCond, NULL);
+#endif
    
    semaphore->count = initialCount;
    mData = semaphore;
@@ -40,14 +54,41 @@ Semaphore::Semaphore(S32 initialCount)
 
 Semaphore::~Semaphore()
 {
+#ifdef __EMSCRIPTEN_PTHREADS__
+   pthread_mutex_destroy(&mData->mDarkroom);
+   pthread_cond_destroy(&mData->mCond);
+#endif
    delete mData;
 }
 
 bool Semaphore::acquire( bool block, S32 timeoutMS )
 {
+#ifdef __EMSCRIPTEN_PTHREADS__
+   pthread_mutex_lock(&mData->mDarkroom);
+
+   if( mData->count <= 0 && !block )
+   {
+      pthread_mutex_unlock(&mData->mDarkroom);
+      return false;
+   }
+
+   // Releases mDarkroom while blocked.
+   while( mData->count <= 0 )
+      pthread_cond_wait(&mData->mCond, &mData->mDarkroom);
+
+   mData->count--;
+   pthread_mutex_unlock(&mData->mDarkroom);
+#endif
    return true;
 }
 
 void Semaphore::release()
 {
+#ifdef __EMSCRIPTEN_PTHREADS__
+   pthread_mutex_lock(&mData->mDarkroom);
+   mData->count++;
+   if( mData->count > 0 )
+      pthread_cond_signal(&mData->mCond);
+   pthread_mutex_unlock(&mData->mDarkroom);
+#endif
 }
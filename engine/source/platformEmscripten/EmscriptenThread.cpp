@@ -19,7 +19,6 @@
 // LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 // IN THE SOFTWARE.
-//-----------------------------------------------------------------------------
 
 #include "platform/threads/thread.h"
 #include "platform/platformSemaphore.h"
@@ -28,6 +27,15 @@
 #include "memory/safeDelete.h"
 #include <stdlib.h>
 
+#ifdef __EMSCRIPTEN_PTHREADS__
+#include <pthread.h>
+#include <emscripten/threading.h>
+#endif
+
+// Threads only run when the build enables pthreads (TORQUE_WASM_THREADS) and the page is
+// cross-origin isolated so SharedArrayBuffer is available.  Otherwise threads never start and
+// everything that would use them falls back to running on the main thread.
+
 struct PlatformThreadData
 {
    ThreadRunFunction       mRunFunc;
@@ -35,6 +43,7 @@ struct PlatformThreadData
    Thread*                 mThread;
    Semaphore               mGateway; // default count is 1
    U32                     mThreadID;
+   bool                    mDead;
 };
 
 //-----------------------------------------------------------------------------
@@ -48,20 +57,27 @@ static void *ThreadRunHandler(void * arg)
    PlatformThreadData *mData = reinterpret_cast<PlatformThreadData*>(arg);
    Thread *thread = mData->mThread;
 
+   // mThreadID is also filled in by pthread_create() but addThread() can run before that returns.
    mData->mThreadID = ThreadManager::getCurrentThreadId();
+
    ThreadManager::addThread(thread);
-   
+#ifdef __EMSCRIPTEN_PTHREADS__
+   thread->run(mData->mRunArg);
+#else
    // not possible with emscripten
    AssertFatal(false, "Cannot run threads with emscripten");
-   //thread->run(mData->mRunArg);
+#endif
+   ThreadManager::removeThread(thread);
 
-	mData->mGateway.release();
-   // we could delete the Thread here, if it wants to be auto-deleted...
-   if(thread->autoDelete)
-   {
-      ThreadManager::removeThread(thread);
+   bool autoDelete = thread->autoDelete;
+
+   mData->mThreadID = 0;
+   mData->mDead = true;
+   mData->mGateway.release();
+
+   if( autoDelete )
       delete thread;
-   }
+
    // return value for pthread lib's benefit
    return NULL;
    // the end of this function is where the created pthread will die.
@@ -75,22 +91,27 @@ Thread::Thread(ThreadRunFunction func, void* arg, bool start_thread, bool autode
    mData->mRunArg = arg;
    mData->mThread = this;
    mData->mThreadID = 0;
+   mData->mDead = true;
    autoDelete = autodelete;
-   
-   //if(start_thread)
-   //   start();
+
+#ifdef __EMSCRIPTEN_PTHREADS__
+   if(start_thread)
+      start();
+#endif
 }
 
 Thread::~Thread()
 {
    stop();
-   join();
+   if(isAlive())
+      join();
 
    SAFE_DELETE(mData);
 }
 
 void Thread::start()
 {
+#ifdef __EMSCRIPTEN_PTHREADS__
    if(isAlive())
       return;
 
@@ -101,7 +122,18 @@ void Thread::start()
    // reset the shouldStop flag, so we'll know when someone asks us to stop.
    shouldStop = false;
 
-   //pthread_create((pthread_t*)(&mData->mThreadID), NULL, ThreadRunHandler, mData);
+   mData->mDead = false;
+
+   pthread_t threadID;
+   if(pthread_create(&threadID, NULL, ThreadRunHandler, mData) != 0)
+   {
+      // The worker pool is exhausted or threads are unavailable on this page.
+      mData->mDead = true;
+      mData->mGateway.release();
+      return;
+   }
+   pthread_detach(threadID);
+#endif
 }
 
 bool Thread::join()
@@ -118,22 +150,15 @@ bool Thread::join()
 
 void Thread::run(void* arg)
 {
-   //if(mData->mRunFunc)
-   //   mData->mRunFunc(arg);
+#ifdef __EMSCRIPTEN_PTHREADS__
+   if(mData->mRunFunc)
+      mData->mRunFunc(arg);
+#endif
 }
 
 bool Thread::isAlive()
 {
-   if(mData->mThreadID == 0)
-      return false;
-
-   if( mData->mGateway.acquire(false) ) 
-   {
-     mData->mGateway.release();
-     return false; // we got the lock, it aint alive.
-   }
-   else
-     return true; // we could not get the lock, it must be alive.
+   return !mData->mDead;
 }
 
 U32 Thread::getId()
@@ -143,12 +168,27 @@ U32 Thread::getId()
 
 U32 ThreadManager::getCurrentThreadId()
 {
-   return 0;//(U32)pthread_self();
+#ifdef __EMSCRIPTEN_PTHREADS__
+   return (U32)pthread_self();
+#else
+   return 0;
+#endif
+}
+
+U32 ThreadManager::getProcessorCount()
+{
+#ifdef __EMSCRIPTEN_PTHREADS__
+   const int processorCount = emscripten_num_logical_cores();
+   return processorCount > 0 ? (U32)processorCount : 1;
+#else
+   // Threads are not available.
+   return 1;
+#endif
 }
 
 bool ThreadManager::compare(U32 threadId_1, U32 threadId_2)
 {
-   return threadId_1 == threadId_2;//(bool)pthread_equal((pthread_t)threadId_1, (pthread_t)threadId_2);
+   return threadId_1 == threadId_2;
 }
 
 
@@ -156,7 +196,11 @@ bool ThreadManager::compare(U32 threadId_1, U32 threadId_2)
 class PlatformThreadStorage
 {
 public:
-   //pthread_key_t mThreadKey;
+#ifdef __EMSCRIPTEN_PTHREADS__
+   pthread_key_t mThreadKey;
+#else
+   void* mValue;
+#endif
 };
 
 ThreadStorage::ThreadStorage()
@@ -164,21 +208,34 @@ ThreadStorage::ThreadStorage()
    mThreadStorage = (PlatformThreadStorage *) mStorage;
    constructInPlace(mThreadStorage);
 
-   //pthread_key_create(&mThreadStorage->mThreadKey, NULL);
+#ifdef __EMSCRIPTEN_PTHREADS__
+   pthread_key_create(&mThreadStorage->mThreadKey, NULL);
+#else
+   mThreadStorage->mValue = NULL;
+#endif
 }
 
 ThreadStorage::~ThreadStorage()
 {
-   //pthread_key_delete(mThreadStorage->mThreadKey);
+#ifdef __EMSCRIPTEN_PTHREADS__
+   pthread_key_delete(mThreadStorage->mThreadKey);
+#endif
 }
 
 void *ThreadStorage::get()
 {
-   return NULL;//return pthread_getspecific(mThreadStorage->mThreadKey);
+#ifdef __EMSCRIPTEN_PTHREADS__
+   return pthread_getspecific(mThreadStorage->mThreadKey);
+#else
+   return mThreadStorage->mValue;
+#endif
 }
 
 void ThreadStorage::set(void *value)
 {
-   return;//pthread_setspecific(mThreadStorage->mThreadKey, value);
+#ifdef __EMSCRIPTEN_PTHREADS__
+   pthread_setspecific(mThreadStorage->mThreadKey, value);
+#else
+   mThreadStorage->mValue = value;
+#endif
 }
-
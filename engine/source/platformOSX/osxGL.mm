@@ -202,6 +202,10 @@ void getGLCapabilities()
         if (dStrstr(pExtString, (const char*)"GL_NV_vertex_array_range") != NULL)
             gGLState.suppVertexArrayRange = true;
         
+        // ARB_vertex_buffer_object ========================================
+        if (dStrstr(pExtString, (const char*)"GL_ARB_vertex_buffer_object") != NULL)
+            gGLState.suppARBVertexBufferObject = true;
+        
         
         // EXT_fog_coord ========================================
         if (dStrstr(pExtString, (const char*)"GL_EXT_fog_coord") != NULL)
@@ -285,6 +289,9 @@ void getGLCapabilities()
     if (gGLState.suppVertexArrayRange)
         Con::printf("  NV_vertex_array_range");
     
+    if (gGLState.suppARBVertexBufferObject)
+        Con::printf("  ARB_vertex_buffer_object");
+    
     if (gGLState.suppTextureEnvCombine)
         Con::printf("  EXT_texture_env_combine");
     
@@ -335,6 +342,9 @@ void getGLCapabilities()
     if (!gGLState.suppVertexArrayRange)
         Con::warnf("  NV_vertex_array_range");
     
+    if (!gGLState.suppARBVertexBufferObject)
+        Con::warnf("  ARB_vertex_buffer_object");
+    
     if (!gGLState.suppTextureEnvCombine)
         Con::warnf("  EXT_texture_env_combine");
     
@@ -23,6 +23,7 @@
 #import <pthread.h>
 #import <stdlib.h>
 #import <errno.h>
+#import <unistd.h>
 #import "memory/safeDelete.h"
 #import "platform/threads/thread.h"
 #import "platform/platformSemaphore.h"
@@ -176,6 +177,14 @@ ThreadIdent ThreadManager::getCurrentThreadId()
 
 //-----------------------------------------------------------------------------
 
+U32 ThreadManager::getProcessorCount()
+{
+   const long processorCount = sysconf(_SC_NPROCESSORS_ONLN);
+   return processorCount > 0 ? (U32)processorCount : 1;
+}
+
+//-----------------------------------------------------------------------------
+
 bool ThreadManager::compare( ThreadIdent threadId_1, ThreadIdent threadId_2 )
 {
    return (bool)pthread_equal((pthread_t)threadId_1, (pthread_t)threadId_2);
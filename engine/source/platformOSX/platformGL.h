@@ -90,6 +90,7 @@ struct GLState
 
    bool suppTextureEnvCombine;
    bool suppVertexArrayRange;
+   bool suppARBVertexBufferObject;
    bool suppFogCoord;
    bool suppEdgeClamp;
 
@@ -173,6 +174,11 @@ inline bool dglDoesSupportVertexArrayRange()
    return gGLState.suppVertexArrayRange;
 }
 
+inline bool dglDoesSupportARBVertexBufferObject()
+{
+   return gGLState.suppARBVertexBufferObject;
+}
+
 inline bool dglDoesSupportFogCoord()
 {
    return gGLState.suppFogCoord && (gOpenGLDisableFC == false);
@@ -67,6 +67,8 @@ struct GLState
    bool suppLockedArrays;
    bool suppTextureEnvCombine;
    bool suppVertexArrayRange;
+   bool suppARBVertexBufferObject;
+   bool suppARBTimerQuery;
    bool suppFogCoord;
    bool suppEdgeClamp;
    bool suppTextureCompression;
@@ -145,6 +147,16 @@ inline bool dglDoesSupportVertexArrayRange()
    return gGLState.suppVertexArrayRange;
 }
 
+inline bool dglDoesSupportARBVertexBufferObject()
+{
+   return gGLState.suppARBVertexBufferObject;
+}
+
+inline bool dglDoesSupportARBTimerQuery()
+{
+   return gGLState.suppARBTimerQuery;
+}
+
 inline bool dglDoesSupportFogCoord()
 {
    return gGLState.suppFogCoord && (gOpenGLDisableFC == false);
@@ -149,6 +149,13 @@ ThreadIdent ThreadManager::getCurrentThreadId()
    return GetCurrentThreadId();
 }
 
+U32 ThreadManager::getProcessorCount()
+{
+   SYSTEM_INFO systemInfo;
+   GetSystemInfo(&systemInfo);
+   return systemInfo.dwNumberOfProcessors > 0 ? (U32)systemInfo.dwNumberOfProcessors : 1;
+}
+
 bool ThreadManager::compare(ThreadIdent threadId_1, ThreadIdent threadId_2)
 {
    return (threadId_1 == threadId_2);
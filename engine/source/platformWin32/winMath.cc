@@ -32,6 +32,7 @@ extern void mInstallLibrary_ASM();
 
 extern void mInstall_AMD_Math();
 extern void mInstall_Library_SSE();
+extern void mInstall_Library_AVX2();
 
 
 //--------------------------------------
@@ -77,6 +78,12 @@ void Math::init(U32 properties)
       mInstall_Library_SSE();
    }
 
+   if (properties & CPU_PROP_AVX2)
+   {
+      Con::printf("   Installing AVX2 extensions");
+      mInstall_Library_AVX2();
+   }
+
    Con::printf(" ");
 }
 
@@ -38,6 +38,28 @@ void dRealFree(void* p)
 
 //-----------------------------------------------------------------------------
 
+void* dLargePageAlloc(dsize_t size, S32 numaNode)
+{
+   // Large pages need the lock pages privilege so use normal pages straight from the system.
+   return VirtualAlloc(NULL, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+}
+
+//-----------------------------------------------------------------------------
+
+void dLargePageFree(void* p, dsize_t size)
+{
+   VirtualFree(p, 0, MEM_RELEASE);
+}
+
+//-----------------------------------------------------------------------------
+
+S32 dGetCurrentNumaNode()
+{
+   return 0;
+}
+
+//-----------------------------------------------------------------------------
+
 void* dMemcpy(void *dst, const void *src, dsize_t size)
 {
    return memcpy(dst,src,size);
@@ -1480,6 +1480,14 @@ void Platform::init()
    Con::setVariable( "$platform", "windows" );
 
    WinConsole::create();
+
+   // A headless server has no window, input or video.
+   if ( Platform::isHeadless() )
+   {
+      sgQueueEvents = true;
+      return;
+   }
+
    if ( !WinConsole::isEnabled() )
       Input::init();
    InitInput();   // in case DirectInput falls through
@@ -155,6 +155,10 @@ void Processor::init()
       Con::printf("   3DNow detected");
    if (PlatformSystemInfo.processor.properties & CPU_PROP_SSE)
       Con::printf("   SSE detected");
+   if (PlatformSystemInfo.processor.properties & CPU_PROP_SSE2)
+      Con::printf("   SSE2 detected");
+   if (PlatformSystemInfo.processor.properties & CPU_PROP_AVX2)
+      Con::printf("   AVX2 detected");
    Con::printf(" ");
 
    PlatformBlitInit();
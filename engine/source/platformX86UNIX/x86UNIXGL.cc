@@ -58,7 +58,9 @@ enum {
    EXT_paletted_texture          = BIT(4),
    NV_vertex_array_range         = BIT(5),
    EXT_blend_color               = BIT(6),
-   EXT_blend_minmax              = BIT(7)
+   EXT_blend_minmax              = BIT(7),
+   ARB_vertex_buffer_object      = BIT(8),
+   ARB_timer_query               = BIT(9)
 };
 
 //WGL_ARB
@@ -309,6 +311,24 @@ bool GL_EXT_Init( )
    // NV_vertex_array_range (not on *nix)
    gGLState.suppVertexArrayRange = false;
 
+   // ARB_vertex_buffer_object
+   if (pExtString && dStrstr(pExtString, (const char*)"GL_ARB_vertex_buffer_object") != NULL)
+   {
+      extBitMask |= ARB_vertex_buffer_object;
+      gGLState.suppARBVertexBufferObject = true;
+   }
+   else
+      gGLState.suppARBVertexBufferObject = false;
+
+   // ARB_timer_query
+   if (pExtString && dStrstr(pExtString, (const char*)"GL_ARB_timer_query") != NULL)
+   {
+      extBitMask |= ARB_timer_query;
+      gGLState.suppARBTimerQuery = true;
+   }
+   else
+      gGLState.suppARBTimerQuery = false;
+
    // 3DFX_texture_compression_FXT1
    if (pExtString && dStrstr(pExtString, (const char*)"3DFX_texture_compression_FXT1") != NULL)
       gGLState.suppFXT1 = true;
@@ -349,6 +369,8 @@ bool GL_EXT_Init( )
    if (gGLState.suppPalettedTexture)    Con::printf("  EXT_paletted_texture");
    if (gGLState.suppLockedArrays)       Con::printf("  EXT_compiled_vertex_array");
    if (gGLState.suppVertexArrayRange)   Con::printf("  NV_vertex_array_range");
+   if (gGLState.suppARBVertexBufferObject)   Con::printf("  ARB_vertex_buffer_object");
+   if (gGLState.suppARBTimerQuery)        Con::printf("  ARB_timer_query");
    if (gGLState.suppTextureEnvCombine)  Con::printf("  EXT_texture_env_combine");
    if (gGLState.suppPackedPixels)       Con::printf("  EXT_packed_pixels");
    if (gGLState.suppFogCoord)           Con::printf("  EXT_fog_coord");
@@ -366,6 +388,8 @@ bool GL_EXT_Init( )
    if (!gGLState.suppPalettedTexture)    Con::warnf("  EXT_paletted_texture");
    if (!gGLState.suppLockedArrays)       Con::warnf("  EXT_compiled_vertex_array");
    if (!gGLState.suppVertexArrayRange)   Con::warnf("  NV_vertex_array_range");
+   if (!gGLState.suppARBVertexBufferObject)   Con::warnf("  ARB_vertex_buffer_object");
+   if (!gGLState.suppARBTimerQuery)      Con::warnf("  ARB_timer_query");
    if (!gGLState.suppTextureEnvCombine)  Con::warnf("  EXT_texture_env_combine");
    if (!gGLState.suppPackedPixels)       Con::warnf("  EXT_packed_pixels");
    if (!gGLState.suppFogCoord)           Con::warnf("  EXT_fog_coord");
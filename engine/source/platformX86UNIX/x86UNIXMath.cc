@@ -33,10 +33,11 @@ extern void mInstallLibrary_ASM();
 
 extern void mInstall_AMD_Math();
 extern void mInstall_Library_SSE();
+extern void mInstall_Library_AVX2();
 
 
 //--------------------------------------
-ConsoleFunction( MathInit, void, 1, 10, "(detect|C|FPU|MMX|3DNOW|SSE|...)")
+ConsoleFunction( MathInit, void, 1, 10, "(detect|C|FPU|MMX|3DNOW|SSE|AVX2|...)")
 {
    U32 properties = CPU_PROP_C;  // C entensions are always used
    
@@ -71,6 +72,10 @@ ConsoleFunction( MathInit, void, 1, 10, "(detect|C|FPU|MMX|3DNOW|SSE|...)")
          properties |= CPU_PROP_SSE; 
          continue; 
       }
+      if (dStricmp(*argv, "AVX2") == 0) { 
+         properties |= CPU_PROP_AVX2; 
+         continue; 
+      }
       Con::printf("Error: MathInit(): ignoring unknown math extension '%s'", *argv);
    }
    Math::init(properties);
@@ -116,6 +121,12 @@ void Math::init(U32 properties)
       Con::printf("   Installing SSE extensions");
       mInstall_Library_SSE();
    }
+
+   if (properties & CPU_PROP_AVX2)
+   {
+      Con::printf("   Installing AVX2 extensions");
+      mInstall_Library_AVX2();
+   }
 #endif //mwerks>2.4
 
    Con::printf(" ");
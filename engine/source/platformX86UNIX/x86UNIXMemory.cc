@@ -24,6 +24,9 @@
 
 #include "platformX86UNIX/platformX86UNIX.h"
 #include <stdlib.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
 
 void* dMemcpy(void *dst, const void *src, unsigned size)
 {
@@ -69,4 +72,61 @@ void dRealFree(void* p)
    free(p);
 }
 
+//--------------------------------------
+// Transparent huge pages are only used for 2MB aligned ranges.
+static const dsize_t LargePageSize = 2 * 1024 * 1024;
+
+void* dLargePageAlloc(dsize_t size, S32 numaNode)
+{
+   // Over-allocate so the range can be aligned to a large page.
+   const bool align = size >= LargePageSize;
+   const dsize_t mapSize = align ? size + LargePageSize : size;
+
+   U8* pMap = (U8*)mmap(NULL, mapSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+   if (pMap == (U8*)MAP_FAILED)
+      return NULL;
+
+   U8* p = pMap;
+   if (align)
+   {
+      // Unmap the unaligned head and the tail.
+      p = (U8*)(((size_t)pMap + LargePageSize - 1) & ~(size_t)(LargePageSize - 1));
+      if (p != pMap)
+         munmap(pMap, p - pMap);
+      if (pMap + mapSize != p + size)
+         munmap(p + size, (pMap + mapSize) - (p + size));
+   }
+
+#ifdef MADV_HUGEPAGE
+   madvise(p, size, MADV_HUGEPAGE);
+#endif
+
+#ifdef SYS_mbind
+   // Prefer the node (MPOL_PREFERRED); pages are placed when first touched.
+   if (numaNode >= 0 && numaNode < (S32)(sizeof(unsigned long) * 8))
+   {
+      unsigned long nodeMask = 1UL << numaNode;
+      syscall(SYS_mbind, p, size, 1, &nodeMask, sizeof(nodeMask) * 8 + 1, 0);
+   }
+#endif
+
+   return p;
+}
+
+void dLargePageFree(void* p, dsize_t size)
+{
+   munmap(p, size);
+}
+
+//--------------------------------------
+S32 dGetCurrentNumaNode()
+{
+#ifdef SYS_getcpu
+   unsigned cpu, node;
+   if (syscall(SYS_getcpu, &cpu, &node, NULL) == 0)
+      return (S32)node;
+#endif
+   return 0;
+}
+
 
@@ -47,6 +47,10 @@
 #include <netipx/ipx.h>
 #include <stdlib.h>
 
+#if defined(__linux__)
+#include <sys/epoll.h>
+#endif
+
 #include "console/console.h"
 #include "game/gameInterface.h"
 #include "io/fileStream.h"
@@ -78,17 +82,78 @@ struct Socket
          state = InvalidState;
          remoteAddr[0] = 0;
          remotePort = -1;
+         polledIndex = -1;
+         watched = false;
       }
 
       NetSocket fd;
       S32 state;
       char remoteAddr[256];
       S32 remotePort;
+      S32 polledIndex;  // index in gPolledSockets or -1
+      bool watched;     // registered with epoll
 };
 
-// list of polled sockets
+// every open socket, indexed by descriptor
+static Vector<Socket*> gSockets;
+
+// list of sockets that are checked every frame.  When epoll is available
+// this only holds the sockets waiting for a name lookup; the rest are
+// only visited when epoll reports them as ready.
 static Vector<Socket*> gPolledSockets;
 
+#if defined(__linux__)
+static int gEpollFd = -1;
+
+enum {
+   EpollBatchSize = 64,
+};
+#endif
+
+static void setPolled(Socket* sock, bool polled)
+{
+   if (polled == (sock->polledIndex != -1))
+      return;
+
+   if (polled)
+   {
+      sock->polledIndex = gPolledSockets.size();
+      gPolledSockets.push_back(sock);
+   }
+   else
+   {
+      // move the last socket into the hole
+      S32 index = sock->polledIndex;
+      gPolledSockets.erase_fast(index);
+      if (index < gPolledSockets.size())
+         gPolledSockets[index]->polledIndex = index;
+      sock->polledIndex = -1;
+   }
+}
+
+// Watch a socket for the events its state needs, either through epoll or by
+// polling it every frame.
+static void watchSocket(Socket* sock)
+{
+#if defined(__linux__)
+   if (gEpollFd != -1 && sock->state != NameLookupRequired)
+   {
+      // Edge triggered, so the socket must be drained each time it is reported.
+      epoll_event ev;
+      ev.events = (sock->state == ConnectionPending ? EPOLLOUT : EPOLLIN) | EPOLLET;
+      ev.data.ptr = sock;
+      if (epoll_ctl(gEpollFd, sock->watched ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, sock->fd, &ev) == 0)
+      {
+         sock->watched = true;
+         setPolled(sock, false);
+         return;
+      }
+   }
+#endif
+
+   setPolled(sock, true);
+}
+
 static Socket* addPolledSocket(NetSocket& fd, S32 state,
                                char* remoteAddr = NULL, S32 port = -1)
 {
@@ -99,10 +164,35 @@ static Socket* addPolledSocket(NetSocket& fd, S32 state,
       dStrcpy(sock->remoteAddr, remoteAddr);
    if (port != -1)
       sock->remotePort = port;
-   gPolledSockets.push_back(sock);
+
+   if (fd >= gSockets.size())
+   {
+      S32 oldSize = gSockets.size();
+      gSockets.setSize(fd + 1);
+      for (S32 i = oldSize; i < gSockets.size(); i++)
+         gSockets[i] = NULL;
+   }
+   gSockets[fd] = sock;
+
+   watchSocket(sock);
    return sock;
 }
 
+static void removePolledSocket(NetSocket fd)
+{
+   if (fd < 0 || fd >= gSockets.size() || gSockets[fd] == NULL)
+      return;
+
+   Socket* sock = gSockets[fd];
+   setPolled(sock, false);
+#if defined(__linux__)
+   if (sock->watched)
+      epoll_ctl(gEpollFd, EPOLL_CTL_DEL, fd, NULL);
+#endif
+   gSockets[fd] = NULL;
+   delete sock;
+}
+
 enum {
    MaxConnections = 1024,
 };
@@ -124,17 +214,33 @@ S32 Poll(NetSocket fd, S32 eventMask, S32 timeoutMs)
 
 bool Net::init()
 {
+#if defined(__linux__)
+   // fall back to polling every socket if epoll is unavailable
+   gEpollFd = epoll_create(MaxConnections);
+   if (gEpollFd == -1)
+      Con::warnf("Unable to create epoll instance: %s", strerror(errno));
+#endif
+
    NetAsync::startAsync();
    return(true);
 }
 
 void Net::shutdown()
 {
-   while (gPolledSockets.size() > 0)
-      closeConnectTo(gPolledSockets[0]->fd);
+   for (S32 i = 0; i < gSockets.size(); i++)
+      if (gSockets[i] != NULL)
+         closeConnectTo(gSockets[i]->fd);
    
    closePort();
    NetAsync::stopAsync();
+
+#if defined(__linux__)
+   if (gEpollFd != -1)
+   {
+      ::close(gEpollFd);
+      gEpollFd = -1;
+   }
+#endif
 }
 
 static void netToIPSocketAddress(const NetAddress *address, struct sockaddr_in *sockAddr)
@@ -316,13 +422,7 @@ void Net::closeConnectTo(NetSocket sock)
 #endif	//TORQUE_ALLOW_JOURNALING
 
    // if this socket is in the list of polled sockets, remove it
-   for (int i = 0; i < gPolledSockets.size(); ++i)
-      if (gPolledSockets[i]->fd == sock)
-      {
-         delete gPolledSockets[i];
-         gPolledSockets.erase(i);
-         break;
-      }
+   removePolledSocket(sock);
    
    closeSocket(sock);
 }
@@ -443,53 +543,83 @@ Net::Error Net::sendto(const NetAddress *address, const U8 *buffer, S32 bufferSi
    }
 }
 
-void Net::process()
+// Dispatch a received datagram straight to the game without queuing it.
+static void dispatchPacket(const sockaddr &sa, PacketReceiveEvent &receiveEvent, S32 bytesRead)
 {
-   sockaddr sa;
+   if(sa.sa_family == AF_INET)
+      IPSocketToNetAddress((sockaddr_in *) &sa, &receiveEvent.sourceAddress);
+   else if(sa.sa_family == AF_IPX)
+      IPXSocketToNetAddress((sockaddr_ipx *) &sa, &receiveEvent.sourceAddress);
+   else
+      return;
+
+   NetAddress &na = receiveEvent.sourceAddress;
+   if(na.type == NetAddress::IPAddress &&
+      na.netNum[0] == 127 &&
+      na.netNum[1] == 0 &&
+      na.netNum[2] == 0 &&
+      na.netNum[3] == 1 &&
+      na.port == netPort)
+      return;
+   if(bytesRead <= 0)
+      return;
+   receiveEvent.size = PacketReceiveEventHeaderSize + bytesRead;
+   Game->dispatchEvent(receiveEvent);
+}
+
+#ifdef __linux__
+
+enum {
+   ReceiveBatchSize = 32,
+};
+
+// The receive buffers are reused for every batch so no per-packet allocation is needed.
+static PacketReceiveEvent gReceiveEvents[ReceiveBatchSize];
+static sockaddr gReceiveAddresses[ReceiveBatchSize];
+static iovec gReceiveVectors[ReceiveBatchSize];
+static mmsghdr gReceiveMessages[ReceiveBatchSize];
+
+// Read all the pending datagrams on a socket, a batch at a time.
+static void receivePackets(int socket)
+{
+   if(socket == InvalidSocket)
+      return;
 
-   PacketReceiveEvent receiveEvent;
    for(;;)
    {
-      U32 addrLen = sizeof(sa);
-      S32 bytesRead = -1;
-      if(udpSocket != InvalidSocket)
-         bytesRead = recvfrom(udpSocket, (char *) receiveEvent.data, MaxPacketDataSize, 0, &sa, &addrLen);
-      if(bytesRead == -1 && ipxSocket != InvalidSocket)
+      for(S32 i = 0; i < ReceiveBatchSize; i++)
       {
-         addrLen = sizeof(sa);
-         bytesRead = recvfrom(ipxSocket, (char *) receiveEvent.data, MaxPacketDataSize, 0, &sa, &addrLen);
+         gReceiveVectors[i].iov_base = gReceiveEvents[i].data;
+         gReceiveVectors[i].iov_len = MaxPacketDataSize;
+
+         msghdr &header = gReceiveMessages[i].msg_hdr;
+         dMemset(&header, 0, sizeof(header));
+         header.msg_name = &gReceiveAddresses[i];
+         header.msg_namelen = sizeof(sockaddr);
+         header.msg_iov = &gReceiveVectors[i];
+         header.msg_iovlen = 1;
       }
-      
-      if(bytesRead == -1)
+
+      S32 count = recvmmsg(socket, gReceiveMessages, ReceiveBatchSize, MSG_DONTWAIT, NULL);
+      if(count <= 0)
          break;
-      
-      if(sa.sa_family == AF_INET)
-         IPSocketToNetAddress((sockaddr_in *) &sa, &receiveEvent.sourceAddress);
-      else if(sa.sa_family == AF_IPX)
-         IPXSocketToNetAddress((sockaddr_ipx *) &sa, &receiveEvent.sourceAddress);
-      else
-         continue;
-         
-      NetAddress &na = receiveEvent.sourceAddress;
-      if(na.type == NetAddress::IPAddress &&
-         na.netNum[0] == 127 &&
-         na.netNum[1] == 0 &&
-         na.netNum[2] == 0 &&
-         na.netNum[3] == 1 &&
-         na.port == netPort)
-         continue;
-      if(bytesRead <= 0)
-         continue;
-      receiveEvent.size = PacketReceiveEventHeaderSize + bytesRead;
-      Game->postEvent(receiveEvent);
-   }
 
-   // process the polled sockets.  This blob of code performs functions
-   // similar to WinsockProc in winNet.cc
+      for(S32 i = 0; i < count; i++)
+         dispatchPacket(gReceiveAddresses[i], gReceiveEvents[i], gReceiveMessages[i].msg_len);
 
-   if (gPolledSockets.size() == 0)
-      return;
+      // A partial batch means the socket has been drained.
+      if(count < ReceiveBatchSize)
+         break;
+   }
+}
+
+#endif
 
+// Handle whatever is ready on a socket.  Connected and listening sockets are
+// drained as an edge triggered epoll won't report them again until more
+// data or connections arrive.  Returns whether the socket should be closed.
+static bool processSocket(Socket* currentSock)
+{
    static ConnectedNotifyEvent notifyEvent;
    static ConnectedAcceptEvent acceptEvent;
    static ConnectedReceiveEvent cReceiveEvent;
@@ -499,158 +629,212 @@ void Net::process()
    S32 bytesRead;
    Net::Error err;
    bool removeSock = false;
-   Socket *currentSock = NULL;
    sockaddr_in ipAddr;
    NetSocket incoming = InvalidSocket;
    char out_h_addr[1024];
    int out_h_length = 0;
 
-   for (S32 i = 0; i < gPolledSockets.size(); 
-        /* no increment, this is done at end of loop body */)
+   switch (currentSock->state)
    {
-      removeSock = false;
-      currentSock = gPolledSockets[i];
-      switch (currentSock->state)
-      {
-         case InvalidState:
-            Con::errorf("Error, InvalidState socket in polled sockets list");
-            break;
-         case ConnectionPending:
-            notifyEvent.tag = currentSock->fd;
-            // see if it is now connected
-            if (getsockopt(currentSock->fd, SOL_SOCKET, SO_ERROR, 
-                           &optval, &optlen) == -1)
+      case InvalidState:
+         Con::errorf("Error, InvalidState socket in polled sockets list");
+         break;
+      case ConnectionPending:
+         notifyEvent.tag = currentSock->fd;
+         // see if it is now connected
+         if (getsockopt(currentSock->fd, SOL_SOCKET, SO_ERROR, 
+                        &optval, &optlen) == -1)
+         {
+            Con::errorf("Error getting socket options: %s", strerror(errno));
+            notifyEvent.state = ConnectedNotifyEvent::ConnectFailed;
+            Game->postEvent(notifyEvent);
+            removeSock = true;
+         }
+         else
+         {
+            if (optval == EINPROGRESS)
+               // still connecting...
+               break;
+
+            if (optval == 0)
             {
-               Con::errorf("Error getting socket options: %s", strerror(errno));
-               notifyEvent.state = ConnectedNotifyEvent::ConnectFailed;
+               // connected
+               notifyEvent.state = ConnectedNotifyEvent::Connected;
                Game->postEvent(notifyEvent);
-               removeSock = true;
+               currentSock->state = Connected;
+               watchSocket(currentSock);
             }
             else
             {
-               if (optval == EINPROGRESS)
-                  // still connecting...
-                  break;
-
-               if (optval == 0)
-               {
-                  // connected
-                  notifyEvent.state = ConnectedNotifyEvent::Connected;
-                  Game->postEvent(notifyEvent);
-                  currentSock->state = Connected;
-               }
-               else
-               {
-                  // some kind of error
-                  Con::errorf("Error connecting: %s", strerror(errno));
-                  notifyEvent.state = ConnectedNotifyEvent::ConnectFailed;
-                  Game->postEvent(notifyEvent);
-                  removeSock = true;
-               }
+               // some kind of error
+               Con::errorf("Error connecting: %s", strerror(errno));
+               notifyEvent.state = ConnectedNotifyEvent::ConnectFailed;
+               Game->postEvent(notifyEvent);
+               removeSock = true;
             }
-            break;
-         case Connected:
+         }
+         break;
+      case Connected:
+         // read until the socket would block
+         for (;;)
+         {
             bytesRead = 0;
-            // try to get some data
             err = Net::recv(currentSock->fd, cReceiveEvent.data, 
                             MaxPacketDataSize, &bytesRead);
-            if(err == Net::NoError)
+            if (err == Net::WouldBlock)
+               break;
+
+            if (err == Net::NoError && bytesRead > 0)
             {
-               if (bytesRead > 0)
-               {
-                  // got some data, post it
-                  cReceiveEvent.tag = currentSock->fd;
-                  cReceiveEvent.size = ConnectedReceiveEventHeaderSize + 
-                     bytesRead;
-                  Game->postEvent(cReceiveEvent);
-               }
-               else 
-               {
-                  // zero bytes read means EOF
-                  if (bytesRead < 0)
-                     // ack! this shouldn't happen
-                     Con::errorf("Unexpected error on socket: %s", 
-                                 strerror(errno));
-
-                  notifyEvent.tag = currentSock->fd;
-                  notifyEvent.state = ConnectedNotifyEvent::Disconnected;
-                  Game->postEvent(notifyEvent);
-                  removeSock = true;
-               }
+               // got some data, post it
+               cReceiveEvent.tag = currentSock->fd;
+               cReceiveEvent.size = ConnectedReceiveEventHeaderSize + 
+                  bytesRead;
+               Game->postEvent(cReceiveEvent);
+               continue;
             }
-            else if (err != Net::NoError && err != Net::WouldBlock)
-            {
+
+            // zero bytes read means EOF
+            if (err != Net::NoError)
                Con::errorf("Error reading from socket: %s", strerror(errno));
-               notifyEvent.tag = currentSock->fd;
-               notifyEvent.state = ConnectedNotifyEvent::Disconnected;
-               Game->postEvent(notifyEvent);
-               removeSock = true;
-            }
-            break;
-         case NameLookupRequired:
-            // is the lookup complete?
-            if (!gNetAsync.checkLookup(
-                   currentSock->fd, out_h_addr, &out_h_length, 
-                   sizeof(out_h_addr)))
-               break;
-            
+
             notifyEvent.tag = currentSock->fd;
-            if (out_h_length == -1)
-            {
-               Con::errorf("DNS lookup failed: %s", currentSock->remoteAddr);
-               notifyEvent.state = ConnectedNotifyEvent::DNSFailed;
-               removeSock = true;
-            }
-            else
+            notifyEvent.state = ConnectedNotifyEvent::Disconnected;
+            Game->postEvent(notifyEvent);
+            removeSock = true;
+            break;
+         }
+         break;
+      case NameLookupRequired:
+         // is the lookup complete?
+         if (!gNetAsync.checkLookup(
+                currentSock->fd, out_h_addr, &out_h_length, 
+                sizeof(out_h_addr)))
+            break;
+         
+         notifyEvent.tag = currentSock->fd;
+         if (out_h_length == -1)
+         {
+            Con::errorf("DNS lookup failed: %s", currentSock->remoteAddr);
+            notifyEvent.state = ConnectedNotifyEvent::DNSFailed;
+            removeSock = true;
+         }
+         else
+         {
+            // try to connect
+            dMemcpy(&(ipAddr.sin_addr.s_addr), out_h_addr, out_h_length);
+            ipAddr.sin_port = currentSock->remotePort;
+            ipAddr.sin_family = AF_INET;
+            if(::connect(currentSock->fd, (struct sockaddr *)&ipAddr, 
+                         sizeof(ipAddr)) == -1)
             {
-               // try to connect
-               dMemcpy(&(ipAddr.sin_addr.s_addr), out_h_addr, out_h_length);
-               ipAddr.sin_port = currentSock->remotePort;
-               ipAddr.sin_family = AF_INET;
-               if(::connect(currentSock->fd, (struct sockaddr *)&ipAddr, 
-                            sizeof(ipAddr)) == -1)
+               if (errno == EINPROGRESS)
                {
-                  if (errno == EINPROGRESS)
-                  {
-                     notifyEvent.state = ConnectedNotifyEvent::DNSResolved;
-                     currentSock->state = ConnectionPending;
-                  }
-                  else
-                  {
-                     Con::errorf("Error connecting to %s: %s", 
-                                 currentSock->remoteAddr, strerror(errno));
-                     notifyEvent.state = ConnectedNotifyEvent::ConnectFailed;
-                     removeSock = true;
-                  }
+                  notifyEvent.state = ConnectedNotifyEvent::DNSResolved;
+                  currentSock->state = ConnectionPending;
                }
                else
                {
-                  notifyEvent.state = ConnectedNotifyEvent::Connected;
-                  currentSock->state = Connected;
+                  Con::errorf("Error connecting to %s: %s", 
+                              currentSock->remoteAddr, strerror(errno));
+                  notifyEvent.state = ConnectedNotifyEvent::ConnectFailed;
+                  removeSock = true;
                }
             }
-            Game->postEvent(notifyEvent);			
-            break;
-    	 case Listening:
-            incoming = 
-               Net::accept(currentSock->fd, &acceptEvent.address);
-            if(incoming != InvalidSocket)
+            else
             {
-               acceptEvent.portTag = currentSock->fd;
-               acceptEvent.connectionTag = incoming;
-               setBlocking(incoming, false);
-               addPolledSocket(incoming, Connected);
-               Game->postEvent(acceptEvent);
+               notifyEvent.state = ConnectedNotifyEvent::Connected;
+               currentSock->state = Connected;
             }
+         }
+         if (!removeSock)
+            watchSocket(currentSock);
+         Game->postEvent(notifyEvent);			
+         break;
+ 	 case Listening:
+         // accept every pending connection
+         for (;;)
+         {
+            incoming = 
+               Net::accept(currentSock->fd, &acceptEvent.address);
+            if(incoming == InvalidSocket)
+               break;
+
+            acceptEvent.portTag = currentSock->fd;
+            acceptEvent.connectionTag = incoming;
+            Net::setBlocking(incoming, false);
+            addPolledSocket(incoming, Connected);
+            Game->postEvent(acceptEvent);
+         }
+         break;
+   }
+
+   return removeSock;
+}
+
+void Net::process()
+{
+#ifdef __linux__
+   receivePackets(udpSocket);
+   receivePackets(ipxSocket);
+#else
+   sockaddr sa;
+
+   PacketReceiveEvent receiveEvent;
+   for(;;)
+   {
+      U32 addrLen = sizeof(sa);
+      S32 bytesRead = -1;
+      if(udpSocket != InvalidSocket)
+         bytesRead = recvfrom(udpSocket, (char *) receiveEvent.data, MaxPacketDataSize, 0, &sa, &addrLen);
+      if(bytesRead == -1 && ipxSocket != InvalidSocket)
+      {
+         addrLen = sizeof(sa);
+         bytesRead = recvfrom(ipxSocket, (char *) receiveEvent.data, MaxPacketDataSize, 0, &sa, &addrLen);
+      }
+      
+      if(bytesRead == -1)
+         break;
+
+      dispatchPacket(sa, receiveEvent, bytesRead);
+   }
+#endif
+
+   // process the sockets.  This blob of code performs functions
+   // similar to WinsockProc in winNet.cc
+
+#if defined(__linux__)
+   if (gEpollFd != -1)
+   {
+      // handle the sockets epoll reports as ready, a batch at a time
+      epoll_event events[EpollBatchSize];
+      for (;;)
+      {
+         S32 count = epoll_wait(gEpollFd, events, EpollBatchSize, 0);
+         for (S32 i = 0; i < count; i++)
+         {
+            Socket* currentSock = (Socket*)events[i].data.ptr;
+            if (processSocket(currentSock))
+               closeConnectTo(currentSock->fd);
+         }
+
+         // A partial batch means every ready socket has been handled.
+         if (count < EpollBatchSize)
             break;
       }
+   }
+#endif
+
+   // iterate backwards as sockets may be removed from the list whilst
+   // they're processed
+   for (S32 i = gPolledSockets.size() - 1; i >= 0; i--)
+   {
+      if (i >= gPolledSockets.size())
+         continue;
 
-      // only increment index if we're not removing the connection, since 
-      // the removal will shift the indices down by one
-      if (removeSock)
+      Socket* currentSock = gPolledSockets[i];
+      if (processSocket(currentSock))
          closeConnectTo(currentSock->fd);
-      else
-         i++;
    }
 }
                  
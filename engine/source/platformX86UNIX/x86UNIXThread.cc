@@ -21,6 +21,7 @@
 //-----------------------------------------------------------------------------
 
 #include <pthread.h>
+#include <unistd.h>
 #include "platform/threads/thread.h"
 #include "platformX86UNIX/platformX86UNIX.h"
 #include "platform/platformSemaphore.h"
@@ -139,6 +140,12 @@ ThreadIdent ThreadManager::getCurrentThreadId()
    return pthread_self();
 }
 
+U32 ThreadManager::getProcessorCount()
+{
+   const long processorCount = sysconf(_SC_NPROCESSORS_ONLN);
+   return processorCount > 0 ? (U32)processorCount : 1;
+}
+
 bool ThreadManager::compare(U32 threadId_1, U32 threadId_2)
 {
    return pthread_equal((pthread_t)threadId_1, (pthread_t)threadId_2);
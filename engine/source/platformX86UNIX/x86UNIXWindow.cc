@@ -92,6 +92,12 @@ static S32 ParseCommandLine(S32 argc, const char **argv,
          foundDedicated = true;
          // no continue because dedicated is also handled by script
       }
+      if (dStrcmp(argv[i], "-headless") == 0)
+      {
+         // a headless server never needs a display
+         foundDedicated = true;
+         // no continue because headless is also handled by the game
+      }
       if (dStrcmp(argv[i], "-dsleep") == 0)
       {
          x86UNIXState->setDSleep(true);
@@ -62,6 +62,7 @@ extern void _iOSGameInnerLoop();
     [super didReceiveMemoryWarning];
     
     // Release any cached data, images, etc that aren't in use.
+    Memory::raiseLowMemoryWarning();
 }
 
 #pragma mark - View lifecycle
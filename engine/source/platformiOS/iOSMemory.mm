@@ -40,6 +40,27 @@ void dRealFree(void* in_pFree)
 
 //-----------------------------------------------------------------------------
 
+void* dLargePageAlloc(dsize_t size, S32 numaNode)
+{
+   return malloc(size);
+}
+
+//-----------------------------------------------------------------------------
+
+void dLargePageFree(void* p, dsize_t size)
+{
+   free(p);
+}
+
+//-----------------------------------------------------------------------------
+
+S32 dGetCurrentNumaNode()
+{
+   return 0;
+}
+
+//-----------------------------------------------------------------------------
+
 void* dMemcpy(void *dst, const void *src, dsize_t size)
 {
    return memcpy(dst,src,size);
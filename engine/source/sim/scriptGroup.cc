@@ -38,3 +38,20 @@ ScriptGroup::ScriptGroup()
 
 //-----------------------------------------------------------------------------
 
+void ScriptGroup::initPersistFields()
+{
+   Parent::initPersistFields();
+}
+
+//-----------------------------------------------------------------------------
+
+void ScriptGroup::consoleInit()
+{
+   Parent::consoleInit();
+
+   // All the persisted state is held in fields and children.
+   getStaticClassRep()->setTamlModifyTracked( true );
+}
+
+//-----------------------------------------------------------------------------
+
@@ -36,6 +36,9 @@ class ScriptGroup : public SimGroup
 public:
    ScriptGroup();
 
+   static void initPersistFields();
+   static void consoleInit();
+
    DECLARE_CONOBJECT(ScriptGroup);
 };
 
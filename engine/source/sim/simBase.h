@@ -162,6 +162,11 @@ namespace Sim
 
    SimObject* findObject(SimObjectId);
    SimObject* findObject(const char* name);
+
+   /// Register a number of objects at once, optionally adding them to a group.
+   /// @see SimObject::registerObjects()
+   U32 registerObjects(SimObject** ppObjects, const U32 count, SimGroup* pGroup = NULL);
+
    template<class T> inline bool findObject(SimObjectId id,T*&t)
    {
       t = dynamic_cast<T*>(findObject(id));
@@ -186,6 +191,10 @@ namespace Sim
    SimTime getCurrentTime();
    SimTime getTargetTime();
 
+   /// Fetch the time until the earliest queued event is due, zero if one is due now or
+   /// U32_MAX if no events are queued.
+   SimTime getTimeToNextEvent();
+
    /// a target time of 0 on an event means current event
    U32 postEvent(SimObject*, SimEvent*, U32 targetTime);
 
@@ -210,6 +219,17 @@ namespace Sim
       return postEvent(obj,evt,getCurrentTime());
    }
 
+   /// Post an event from any thread without taking the event queue lock.
+   ///
+   /// The event is queued for the main thread, which moves it into the event queue
+   /// the next time it advances time.  The destination object is looked up then and
+   /// the event is deleted if it no longer exists.
+   ///
+   /// @param destObjectId The id of the object to process the event.
+   /// @param evt The event, which is owned by the event queue from here on.
+   /// @param delay The time after the event is moved into the event queue to process it.
+   void postThreadEvent(SimObjectId destObjectId, SimEvent* evt, U32 delay = 0);
+
    void cancelEvent(U32 eventId);
    bool isEventPending(U32 eventId);
    U32  getEventTimeLeft(U32 eventId);
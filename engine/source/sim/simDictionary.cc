@@ -29,13 +29,11 @@ extern U32 HashPointer(StringTableEntry e);
 
 SimNameDictionary::SimNameDictionary()
 {
-   hashTable = NULL;
    mutex = Mutex::createMutex();
 }
 
 SimNameDictionary::~SimNameDictionary()
 {
-   delete[] hashTable;
    Mutex::destroyMutex(mutex);
 }
 
@@ -45,75 +43,22 @@ void SimNameDictionary::insert(SimObject* obj)
       return;
 
    Mutex::lockMutex(mutex);
-   
-   if(!hashTable)
-   {
-      hashTable = new SimObject *[DefaultTableSize];
-      hashTableSize = DefaultTableSize;
-      hashEntryCount = 0;
-      S32 i;
-      for(i = 0; i < hashTableSize; i++)
-         hashTable[i] = NULL;
-   }
-   S32 idx = HashPointer(obj->objectName) % hashTableSize;
-   obj->nextNameObject = hashTable[idx];
-   hashTable[idx] = obj;
-   hashEntryCount++;
-   if(hashEntryCount > hashTableSize)
-   {
-      // resize the hash table
-      S32 i;
-      SimObject *head = NULL, *walk, *temp;
-   	for(i = 0; i < hashTableSize; i++) {
-   		walk = hashTable[i];
-         while(walk)
-         {
-            temp = walk->nextNameObject;
-            walk->nextNameObject = head;
-            head = walk;
-            walk = temp;
-         }
-   	}
-      delete[] hashTable;
-      hashTableSize = hashTableSize * 2 + 1;
-      hashTable = new SimObject *[hashTableSize];
-
-      for(i = 0; i < hashTableSize;i++)
-         hashTable[i] = NULL;
-      while(head)
-      {
-         temp = head->nextNameObject;
-         idx = HashPointer(head->objectName) % hashTableSize;
-         head->nextNameObject = hashTable[idx];
-         hashTable[idx] = head;
-         head = temp;
-      }
-   }
+   table.insert(obj->objectName, obj);
+   obj->nextNameObject = NULL;
    Mutex::unlockMutex(mutex);
 }
 
 SimObject* SimNameDictionary::find(StringTableEntry name)
 {
    // NULL is a valid lookup - it will always return NULL
-   if(!hashTable)
+   if(!table.size())
       return NULL;
       
    Mutex::lockMutex(mutex);
-
-   S32 idx = HashPointer(name) % hashTableSize;
-   SimObject *walk = hashTable[idx];
-   while(walk)
-   {
-      if(walk->objectName == name)
-      {
-         Mutex::unlockMutex(mutex);
-         return walk;
-      }
-      walk = walk->nextNameObject;
-   }
-
+   SimObject *obj = table.find(name);
    Mutex::unlockMutex(mutex);
-   return NULL;
+
+   return obj;
 }
 
 void SimNameDictionary::remove(SimObject* obj)
@@ -122,22 +67,8 @@ void SimNameDictionary::remove(SimObject* obj)
       return;
 
    Mutex::lockMutex(mutex);
-
-   SimObject **walk = &hashTable[HashPointer(obj->objectName) % hashTableSize];
-   while(*walk)
-   {
-      if(*walk == obj)
-      {
-         *walk = obj->nextNameObject;
-			obj->nextNameObject = (SimObject*)-1;
-         hashEntryCount--;
-
-         Mutex::unlockMutex(mutex);
-         return;
-      }
-      walk = &((*walk)->nextNameObject);
-   }
-
+   if(table.remove(obj->objectName, obj))
+      obj->nextNameObject = (SimObject*)-1;
    Mutex::unlockMutex(mutex);
 }	
 
@@ -145,18 +76,11 @@ void SimNameDictionary::remove(SimObject* obj)
 
 SimManagerNameDictionary::SimManagerNameDictionary()
 {
-   hashTable = new SimObject *[DefaultTableSize];
-   hashTableSize = DefaultTableSize;
-   hashEntryCount = 0;
-   S32 i;
-   for(i = 0; i < hashTableSize; i++)
-      hashTable[i] = NULL;
    mutex = Mutex::createMutex();
 }
 
 SimManagerNameDictionary::~SimManagerNameDictionary()
 {
-   delete[] hashTable;
    Mutex::destroyMutex(mutex);
 }
 
@@ -166,42 +90,24 @@ void SimManagerNameDictionary::insert(SimObject* obj)
       return;
 
    Mutex::lockMutex(mutex);
+   table.insert(obj->objectName, obj);
+   obj->nextManagerNameObject = NULL;
+   Mutex::unlockMutex(mutex);
+}
 
-   S32 idx = HashPointer(obj->objectName) % hashTableSize;
-   obj->nextManagerNameObject = hashTable[idx];
-   hashTable[idx] = obj;
-   hashEntryCount++;
-   if(hashEntryCount > hashTableSize)
+void SimManagerNameDictionary::insert(SimObject** objects, U32 count)
+{
+   Mutex::lockMutex(mutex);
+   table.reserve(table.size() + count);
+   for(U32 i = 0; i < count; i++)
    {
-      // resize the hash table
-      S32 i;
-      SimObject *head = NULL, *walk, *temp;
-   	for(i = 0; i < hashTableSize; i++) {
-   		walk = hashTable[i];
-         while(walk)
-         {
-            temp = walk->nextManagerNameObject;
-            walk->nextManagerNameObject = head;
-            head = walk;
-            walk = temp;
-         }
-   	}
-      delete[] hashTable;
-      hashTableSize = hashTableSize * 2 + 1;
-      hashTable = new SimObject *[hashTableSize];
-
-      for(i = 0; i < hashTableSize;i++)
-         hashTable[i] = NULL;
-      while(head)
-      {
-         temp = head->nextManagerNameObject;
-         idx = HashPointer(head->objectName) % hashTableSize;
-         head->nextManagerNameObject = hashTable[idx];
-         hashTable[idx] = head;
-         head = temp;
-      }
+      SimObject *obj = objects[i];
+      if(!obj->objectName)
+         continue;
+
+      table.insert(obj->objectName, obj);
+      obj->nextManagerNameObject = NULL;
    }
-   
    Mutex::unlockMutex(mutex);
 }
 
@@ -210,21 +116,10 @@ SimObject* SimManagerNameDictionary::find(StringTableEntry name)
    // NULL is a valid lookup - it will always return NULL
 
    Mutex::lockMutex(mutex);
-
-   S32 idx = HashPointer(name) % hashTableSize;
-   SimObject *walk = hashTable[idx];
-   while(walk)
-   {
-      if(walk->objectName == name)
-      {
-         Mutex::unlockMutex(mutex);
-         return walk;
-      }
-      walk = walk->nextManagerNameObject;
-   }
-
+   SimObject *obj = table.find(name);
    Mutex::unlockMutex(mutex);
-   return NULL;
+
+   return obj;
 }
 
 void SimManagerNameDictionary::remove(SimObject* obj)
@@ -233,22 +128,8 @@ void SimManagerNameDictionary::remove(SimObject* obj)
       return;
 
    Mutex::lockMutex(mutex);
-
-   SimObject **walk = &hashTable[HashPointer(obj->objectName) % hashTableSize];
-   while(*walk)
-   {
-      if(*walk == obj)
-      {
-         *walk = obj->nextManagerNameObject;
-			obj->nextManagerNameObject = (SimObject*)-1;
-         hashEntryCount--;
-
-         Mutex::unlockMutex(mutex);
-         return;
-      }
-      walk = &((*walk)->nextManagerNameObject);
-   }
-
+   if(table.remove(obj->objectName, obj))
+      obj->nextManagerNameObject = (SimObject*)-1;
    Mutex::unlockMutex(mutex);
 }	
 
@@ -257,8 +138,6 @@ void SimManagerNameDictionary::remove(SimObject* obj)
 
 SimIdDictionary::SimIdDictionary()
 {
-   for(S32 i = 0; i < DefaultTableSize; i++)
-      table[i] = NULL;
    mutex = Mutex::createMutex();
 }
 
@@ -271,45 +150,39 @@ void SimIdDictionary::insert(SimObject* obj)
 {
    Mutex::lockMutex(mutex);
 
-   S32 idx = obj->getId() & TableBitMask;
-   obj->nextIdObject = table[idx];
-   AssertFatal( obj->nextIdObject != obj, "SimIdDictionary::insert - Creating Infinite Loop linking to self!" );
-   table[idx] = obj;
+   AssertFatal( table.find(obj->getId()) != obj, "SimIdDictionary::insert - Object is already in the dictionary!" );
+   table.insert(obj->getId(), obj);
 
    Mutex::unlockMutex(mutex);
 }
 
-SimObject* SimIdDictionary::find(S32 id)
+void SimIdDictionary::insert(SimObject** objects, U32 count)
 {
    Mutex::lockMutex(mutex);
 
-   S32 idx = id & TableBitMask;
-   SimObject *walk = table[idx];
-   while(walk)
+   table.reserve(table.size() + count);
+   for(U32 i = 0; i < count; i++)
    {
-      if(walk->getId() == U32(id))
-      {
-         Mutex::unlockMutex(mutex);
-         return walk;
-      }
-      walk = walk->nextIdObject;
+      AssertFatal( table.find(objects[i]->getId()) != objects[i], "SimIdDictionary::insert - Object is already in the dictionary!" );
+      table.insert(objects[i]->getId(), objects[i]);
    }
 
    Mutex::unlockMutex(mutex);
-
-   return NULL;
 }
 
-void SimIdDictionary::remove(SimObject* obj)
+SimObject* SimIdDictionary::find(S32 id)
 {
    Mutex::lockMutex(mutex);
+   SimObject *obj = table.find(U32(id));
+   Mutex::unlockMutex(mutex);
 
-   SimObject **walk = &table[obj->getId() & TableBitMask];
-   while(*walk && *walk != obj)
-      walk = &((*walk)->nextIdObject);
-   if(*walk)
-      *walk = obj->nextIdObject;
+   return obj;
+}
 
+void SimIdDictionary::remove(SimObject* obj)
+{
+   Mutex::lockMutex(mutex);
+   table.remove(obj->getId(), obj);
    Mutex::unlockMutex(mutex);
 }
 
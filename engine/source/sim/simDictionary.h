@@ -36,20 +36,194 @@
 class SimObject;
 
 //----------------------------------------------------------------------------
-/// Map of names to SimObjects
+/// Open addressing table of SimObjects used by the Sim dictionaries.
 ///
-/// Provides fast lookup for name->object and
-/// for fast removal of an object given object*
-class SimNameDictionary
+/// Slots hold the key alongside the object so probing never touches the objects
+/// themselves.  The table uses linear probing with a power of two size and grows
+/// to keep the load below one half.  Removal shifts the following entries back so
+/// that no tombstones are needed.
+///
+/// Several objects may share a key.  The most recently inserted of them is found
+/// first.
+///
+/// The KeyTraits provide "static U32 hash(Key)".
+template< typename Key, typename KeyTraits >
+class SimObjectLookupTable
 {
    enum
    {
-      DefaultTableSize = 29
+      MinimumTableSize = 32
+   };
+
+   struct Slot
+   {
+      Key         key;
+      SimObject*  object;
    };
 
-   SimObject **hashTable;  // hash the pointers of the names...
-   S32 hashTableSize;
-   S32 hashEntryCount;
+   Slot* mSlots;
+   U32   mTableSize;
+   U32   mEntryCount;
+
+   inline U32 getHomeIndex( Key key ) const { return KeyTraits::hash( key ) & (mTableSize - 1); }
+
+   void resize( U32 newSize )
+   {
+      Slot* oldSlots = mSlots;
+      const U32 oldSize = mTableSize;
+
+      mSlots = new Slot[newSize];
+      mTableSize = newSize;
+      for ( U32 i = 0; i < newSize; i++ )
+         mSlots[i].object = NULL;
+
+      // Find a free slot to start from so that every cluster is re-inserted in probe
+      // order, keeping the newest object with a key ahead of older ones.
+      U32 start = 0;
+      while ( start < oldSize && oldSlots[start].object != NULL )
+         start++;
+
+      for ( U32 i = 0; i < oldSize; i++ )
+      {
+         const Slot& slot = oldSlots[(start + i) % oldSize];
+         if ( slot.object == NULL )
+            continue;
+
+         U32 index = getHomeIndex( slot.key );
+         while ( mSlots[index].object != NULL )
+            index = (index + 1) & (mTableSize - 1);
+         mSlots[index] = slot;
+      }
+
+      delete [] oldSlots;
+   }
+
+public:
+   SimObjectLookupTable() : mSlots( NULL ), mTableSize( 0 ), mEntryCount( 0 ) {}
+   ~SimObjectLookupTable() { delete [] mSlots; }
+
+   U32 size() const { return mEntryCount; }
+
+   /// Make room for a number of entries in total so that inserting them doesn't resize the table repeatedly.
+   void reserve( U32 count )
+   {
+      U32 newSize = mTableSize ? mTableSize : MinimumTableSize;
+      while ( count * 2 > newSize )
+         newSize *= 2;
+
+      if ( newSize != mTableSize )
+         resize( newSize );
+   }
+
+   void insert( Key key, SimObject* object )
+   {
+      if ( mSlots == NULL )
+         resize( MinimumTableSize );
+      else if ( (mEntryCount + 1) * 2 > mTableSize )
+         resize( mTableSize * 2 );
+
+      // Probe for a free slot.  An object already in the table with the same key is
+      // displaced further along so the newest object is found first.
+      U32 index = getHomeIndex( key );
+      while ( mSlots[index].object != NULL )
+      {
+         if ( mSlots[index].key == key )
+         {
+            SimObject* displaced = mSlots[index].object;
+            mSlots[index].object = object;
+            object = displaced;
+         }
+
+         index = (index + 1) & (mTableSize - 1);
+      }
+
+      mSlots[index].key = key;
+      mSlots[index].object = object;
+      mEntryCount++;
+   }
+
+   SimObject* find( Key key ) const
+   {
+      if ( mSlots == NULL )
+         return NULL;
+
+      for ( U32 index = getHomeIndex( key ); mSlots[index].object != NULL; index = (index + 1) & (mTableSize - 1) )
+      {
+         if ( mSlots[index].key == key )
+            return mSlots[index].object;
+      }
+
+      return NULL;
+   }
+
+   bool remove( Key key, SimObject* object )
+   {
+      if ( mSlots == NULL )
+         return false;
+
+      const U32 mask = mTableSize - 1;
+
+      // Find the object.
+      U32 index = getHomeIndex( key );
+      while ( mSlots[index].object != object )
+      {
+         if ( mSlots[index].object == NULL )
+            return false;
+
+         index = (index + 1) & mask;
+      }
+
+      // Shift back any following entries that would no longer be reachable.
+      U32 next = (index + 1) & mask;
+      while ( mSlots[next].object != NULL )
+      {
+         const U32 home = getHomeIndex( mSlots[next].key );
+
+         // Move the entry if its home is not cyclically within (index, next].
+         if ( ((next - home) & mask) >= ((next - index) & mask) )
+         {
+            mSlots[index] = mSlots[next];
+            index = next;
+         }
+
+         next = (next + 1) & mask;
+      }
+
+      mSlots[index].object = NULL;
+      mEntryCount--;
+      return true;
+   }
+};
+
+//----------------------------------------------------------------------------
+
+struct SimNameKeyTraits
+{
+   static inline U32 hash( StringTableEntry name )
+   {
+      // Mix the pointer bits so the low bits used by the table vary.
+      U32 value = (U32)(dsize_t)name;
+      value ^= value >> 16;
+      value *= 0x45d9f3b;
+      value ^= value >> 16;
+      return value;
+   }
+};
+
+struct SimIdKeyTraits
+{
+   // Ids are allocated sequentially so using them directly keeps packed ids in contiguous slots.
+   static inline U32 hash( U32 id ) { return id; }
+};
+
+//----------------------------------------------------------------------------
+/// Map of names to SimObjects
+///
+/// Provides fast lookup for name->object and
+/// for fast removal of an object given object*
+class SimNameDictionary
+{
+   SimObjectLookupTable<StringTableEntry, SimNameKeyTraits> table;
 
    void *mutex;
 
@@ -64,19 +238,13 @@ public:
 
 class SimManagerNameDictionary
 {
-   enum
-   {
-      DefaultTableSize = 29
-   };
-
-   SimObject **hashTable;  // hash the pointers of the names...
-   S32 hashTableSize;
-   S32 hashEntryCount;
+   SimObjectLookupTable<StringTableEntry, SimNameKeyTraits> table;
 
    void *mutex;
 
 public:
    void insert(SimObject* obj);
+   void insert(SimObject** objects, U32 count);
    void remove(SimObject* obj);
    SimObject* find(StringTableEntry name);
 
@@ -91,17 +259,13 @@ public:
 /// for fast removal of an object given object*
 class SimIdDictionary
 {
-   enum
-   {
-      DefaultTableSize = 4096,
-      TableBitMask = 4095
-   };
-   SimObject *table[DefaultTableSize];
+   SimObjectLookupTable<U32, SimIdKeyTraits> table;
 
    void *mutex;
 
 public:
    void insert(SimObject* obj);
+   void insert(SimObject** objects, U32 count);
    void remove(SimObject* obj);
    SimObject* find(S32 id);
 
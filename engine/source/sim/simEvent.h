@@ -53,14 +53,16 @@ typedef U32 SimTime;
 class SimEvent
 {
   public:
-   SimEvent *nextEvent;     ///< Linked list details - pointer to next item in the list.
    SimTime startTime;       ///< When the event was posted.
    SimTime time;            ///< When the event is scheduled to occur.
    U32 sequenceCount;       ///< Unique ID. These are assigned sequentially based on order
                             ///  of addition to the list.
    SimObject *destObject;   ///< Object on which this event will be applied.
 
-   SimEvent() { destObject = NULL; }
+   SimEvent *nextEvent;     ///< Link to the next event whilst waiting in the thread event inbox.
+   U32 destObjectId;        ///< Id of the destination object whilst waiting in the thread event inbox.
+
+   SimEvent() { destObject = NULL; nextEvent = NULL; destObjectId = 0; }
    virtual ~SimEvent() {}   ///< Destructor
                             ///
                             /// A dummy virtual destructor is required
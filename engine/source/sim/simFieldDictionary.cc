@@ -27,6 +27,133 @@
 
 //-----------------------------------------------------------------------------
 
+/// The names and order of the dynamic fields of one or more SimFieldDictionary.
+///
+/// Shapes form a tree rooted at an empty shape.  Adding a field to a dictionary moves
+/// it to the child shape for that field, so dictionaries that add the same fields in
+/// the same order share shapes.  Shapes are never deleted.
+class SimFieldShape
+{
+public:
+   enum
+   {
+      MaxSlots = 64,
+      MaxShapes = 8192,
+      MinIndexedSlots = 8
+   };
+
+   static SimFieldShape* getRoot( void );
+
+   /// Get the shape with the specified field added, or NULL if no more shapes can be created.
+   SimFieldShape* getChild( StringTableEntry slotName );
+
+   /// Find the slot of a field or -1 if the shape doesn't have it.
+   inline S32 findSlot( StringTableEntry slotName ) const
+   {
+      if ( mpSlotIndex == NULL )
+      {
+         for ( U32 index = 0; index < mSlotCount; ++index )
+         {
+            if ( mpSlotNames[index] == slotName )
+               return index;
+         }
+         return -1;
+      }
+
+      for ( U32 bucket = HashPointer( slotName ) & mSlotIndexMask; mpSlotIndex[bucket] != EmptyIndex; bucket = (bucket + 1) & mSlotIndexMask )
+      {
+         if ( mpSlotNames[mpSlotIndex[bucket]] == slotName )
+            return mpSlotIndex[bucket];
+      }
+      return -1;
+   }
+
+   inline U32 getSlotCount( void ) const { return mSlotCount; }
+
+private:
+   enum { EmptyIndex = 0xFF };
+
+   SimFieldShape( SimFieldShape* pParent, StringTableEntry slotName );
+
+   U32                     mSlotCount;
+   StringTableEntry*       mpSlotNames;
+   U8*                     mpSlotIndex;
+   U32                     mSlotIndexMask;
+   Vector<SimFieldShape*>  mChildren;
+
+   static U32 smShapeCount;
+};
+
+U32 SimFieldShape::smShapeCount = 0;
+
+//-----------------------------------------------------------------------------
+
+SimFieldShape::SimFieldShape( SimFieldShape* pParent, StringTableEntry slotName ) :
+   mSlotCount( 0 ),
+   mpSlotNames( NULL ),
+   mpSlotIndex( NULL ),
+   mSlotIndexMask( 0 )
+{
+   smShapeCount++;
+
+   if ( pParent == NULL )
+      return;
+
+   // Copy the parent slots and add the new one.
+   mSlotCount = pParent->mSlotCount + 1;
+   mpSlotNames = (StringTableEntry*)dMalloc( mSlotCount * sizeof(StringTableEntry) );
+   dMemcpy( mpSlotNames, pParent->mpSlotNames, pParent->mSlotCount * sizeof(StringTableEntry) );
+   mpSlotNames[pParent->mSlotCount] = slotName;
+
+   if ( mSlotCount < MinIndexedSlots )
+      return;
+
+   // Index larger shapes by name so finding a slot doesn't have to search them all.
+   const U32 indexSize = getNextPow2( mSlotCount * 2 );
+   mSlotIndexMask = indexSize - 1;
+   mpSlotIndex = (U8*)dMalloc( indexSize );
+   dMemset( mpSlotIndex, EmptyIndex, indexSize );
+
+   for ( U32 index = 0; index < mSlotCount; ++index )
+   {
+      U32 bucket = HashPointer( mpSlotNames[index] ) & mSlotIndexMask;
+      while ( mpSlotIndex[bucket] != EmptyIndex )
+         bucket = (bucket + 1) & mSlotIndexMask;
+
+      mpSlotIndex[bucket] = (U8)index;
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+SimFieldShape* SimFieldShape::getRoot( void )
+{
+   static SimFieldShape* pRoot = new SimFieldShape( NULL, NULL );
+   return pRoot;
+}
+
+//-----------------------------------------------------------------------------
+
+SimFieldShape* SimFieldShape::getChild( StringTableEntry slotName )
+{
+   for ( Vector<SimFieldShape*>::iterator childItr = mChildren.begin(); childItr != mChildren.end(); ++childItr )
+   {
+      if ( (*childItr)->mpSlotNames[mSlotCount] == slotName )
+         return *childItr;
+   }
+
+   // Objects with many fields, or with fields that differ for every object, don't
+   // benefit from sharing a shape so don't let them use up memory with new shapes.
+   if ( mSlotCount + 1 > MaxSlots || smShapeCount >= MaxShapes )
+      return NULL;
+
+   SimFieldShape* pChild = new SimFieldShape( this, slotName );
+   mChildren.push_back( pChild );
+   return pChild;
+}
+
+//-----------------------------------------------------------------------------
+
 SimFieldDictionary::Entry *SimFieldDictionary::mFreeList = NULL;
 
 static Chunker<SimFieldDictionary::Entry> fieldChunker;
@@ -51,14 +178,25 @@ void SimFieldDictionary::freeEntry(SimFieldDictionary::Entry *ent)
 
 SimFieldDictionary::SimFieldDictionary()
 {
-   for(U32 i = 0; i < HashTableSize; i++)
-      mHashTable[i] = 0;
+   mShape = SimFieldShape::getRoot();
+   mSlots = NULL;
+   mSlotCapacity = 0;
+   mRemovedSlotCount = 0;
+   mHashTable = NULL;
 
    mVersion = 0;
 }
 
 SimFieldDictionary::~SimFieldDictionary()
 {
+   if(mShape)
+   {
+      for(U32 i = 0; i < mShape->getSlotCount(); i++)
+         dFree(mSlots[i].value);
+      dFree(mSlots);
+      return;
+   }
+
    for(U32 i = 0; i < HashTableSize; i++)
    {
       for(Entry *walk = mHashTable[i]; walk;)
@@ -70,10 +208,98 @@ SimFieldDictionary::~SimFieldDictionary()
          freeEntry(temp);
       }
    }
+   dFree(mHashTable);
+}
+
+void SimFieldDictionary::convertToHashTable()
+{
+   mHashTable = (Entry **) dMalloc(HashTableSize * sizeof(Entry *));
+   for(U32 i = 0; i < HashTableSize; i++)
+      mHashTable[i] = 0;
+
+   for(U32 i = 0; i < mShape->getSlotCount(); i++)
+   {
+      if(!mSlots[i].value)
+         continue;
+
+      U32 bucket = HashPointer(mSlots[i].slotName) % HashTableSize;
+      Entry *field = allocEntry();
+      field->slotName = mSlots[i].slotName;
+      field->value = mSlots[i].value;
+      field->next = mHashTable[bucket];
+      mHashTable[bucket] = field;
+   }
+
+   dFree(mSlots);
+   mSlots = NULL;
+   mSlotCapacity = 0;
+   mRemovedSlotCount = 0;
+   mShape = NULL;
 }
 
 void SimFieldDictionary::setFieldValue(StringTableEntry slotName, const char *value)
 {
+   if(mShape)
+   {
+      S32 slot = mShape->findSlot(slotName);
+      if(slot >= 0)
+      {
+         Entry *field = &mSlots[slot];
+         if(!*value)
+         {
+            if(field->value)
+            {
+               mVersion++;
+
+               dFree(field->value);
+               field->value = NULL;
+
+               // Lots of removed fields waste slots so use a hash table instead.
+               if(++mRemovedSlotCount > MinSlotCapacity && mRemovedSlotCount * 2 > mShape->getSlotCount())
+                  convertToHashTable();
+            }
+         }
+         else
+         {
+            if(field->value)
+               dFree(field->value);
+            else
+            {
+               mVersion++;
+               mRemovedSlotCount--;
+            }
+            field->value = dStrdup(value);
+         }
+         return;
+      }
+
+      if(!*value)
+         return;
+
+      SimFieldShape *shape = mShape->getChild(slotName);
+      if(shape)
+      {
+         mVersion++;
+
+         const U32 slotCount = shape->getSlotCount();
+         if(slotCount > mSlotCapacity)
+         {
+            mSlotCapacity = getMax((U32)MinSlotCapacity, mSlotCapacity * 2);
+            mSlots = (Entry *) dRealloc(mSlots, mSlotCapacity * sizeof(Entry));
+         }
+
+         Entry *field = &mSlots[slotCount - 1];
+         field->slotName = slotName;
+         field->value = dStrdup(value);
+         field->next = NULL;
+         mShape = shape;
+         return;
+      }
+
+      // No shape can be used so fall back to a hash table.
+      convertToHashTable();
+   }
+
    U32 bucket = HashPointer(slotName) % HashTableSize;
    Entry **walk = &mHashTable[bucket];
    while(*walk && (*walk)->slotName != slotName)
@@ -113,6 +339,12 @@ void SimFieldDictionary::setFieldValue(StringTableEntry slotName, const char *va
 
 const char *SimFieldDictionary::getFieldValue(StringTableEntry slotName)
 {
+   if(mShape)
+   {
+      S32 slot = mShape->findSlot(slotName);
+      return slot >= 0 ? mSlots[slot].value : NULL;
+   }
+
    U32 bucket = HashPointer(slotName) % HashTableSize;
 
    for(Entry *walk = mHashTable[bucket];walk;walk = walk->next)
@@ -125,11 +357,13 @@ const char *SimFieldDictionary::getFieldValue(StringTableEntry slotName)
 
 void SimFieldDictionary::assignFrom(SimFieldDictionary *dict)
 {
+   if(dict == this)
+      return;
+
    mVersion++;
 
-   for(U32 i = 0; i < HashTableSize; i++)
-      for(Entry *walk = dict->mHashTable[i];walk; walk = walk->next)
-         setFieldValue(walk->slotName, walk->value);
+   for(SimFieldDictionaryIterator itr(dict); *itr; ++itr)
+      setFieldValue((*itr)->slotName, (*itr)->value);
 }
 
 static S32 QSORT_CALLBACK compareEntries(const void* a,const void* b)
@@ -145,25 +379,24 @@ void SimFieldDictionary::writeFields(SimObject *obj, Stream &stream, U32 tabStop
    const AbstractClassRep::FieldList &list = obj->getFieldList();
    Vector<Entry *> flist(__FILE__, __LINE__);
 
-   for(U32 i = 0; i < HashTableSize; i++)
+   for(SimFieldDictionaryIterator itr(this); *itr; ++itr)
    {
-      for(Entry *walk = mHashTable[i];walk; walk = walk->next)
-      {
-         // make sure we haven't written this out yet:
-         U32 i;
-         for(i = 0; i < (U32)list.size(); i++)
-            if(list[i].pFieldname == walk->slotName)
-               break;
+      Entry *walk = *itr;
 
-         if(i != list.size())
-            continue;
+      // make sure we haven't written this out yet:
+      U32 i;
+      for(i = 0; i < (U32)list.size(); i++)
+         if(list[i].pFieldname == walk->slotName)
+            break;
 
+      if(i != list.size())
+         continue;
 
-         if (!obj->writeField(walk->slotName, walk->value))
-            continue;
 
-         flist.push_back(walk);
-      }
+      if (!obj->writeField(walk->slotName, walk->value))
+         continue;
+
+      flist.push_back(walk);
    }
 
    // Sort Entries to prevent version control conflicts
@@ -172,7 +405,7 @@ void SimFieldDictionary::writeFields(SimObject *obj, Stream &stream, U32 tabStop
    // Save them out
    for(Vector<Entry *>::iterator itr = flist.begin(); itr != flist.end(); itr++)
    {
-      U32 nBufferSize = (dStrlen( (*itr)->value ) * 2) + dStrlen( (*itr)->slotName ) + 16;
+      U32 nBufferSize = (dStrlen( (*itr)->value ) * 2) + _StringTable::getEntryLength( (*itr)->slotName ) + 16;
       FrameTemp<char> expandedBuffer( nBufferSize );
 
       stream.writeTabs(tabStop+1);
@@ -191,21 +424,20 @@ void SimFieldDictionary::printFields(SimObject *obj)
    char expandedBuffer[4096];
    Vector<Entry *> flist(__FILE__, __LINE__);
 
-   for(U32 i = 0; i < HashTableSize; i++)
+   for(SimFieldDictionaryIterator itr(this); *itr; ++itr)
    {
-      for(Entry *walk = mHashTable[i];walk; walk = walk->next)
-      {
-         // make sure we haven't written this out yet:
-         U32 i;
-         for(i = 0; i < (U32)list.size(); i++)
-            if(list[i].pFieldname == walk->slotName)
-               break;
+      Entry *walk = *itr;
 
-         if(i != list.size())
-            continue;
+      // make sure we haven't written this out yet:
+      U32 i;
+      for(i = 0; i < (U32)list.size(); i++)
+         if(list[i].pFieldname == walk->slotName)
+            break;
 
-         flist.push_back(walk);
-      }
+      if(i != list.size())
+         continue;
+
+      flist.push_back(walk);
    }
    dQsort(flist.address(),flist.size(),sizeof(Entry *),compareEntries);
 
@@ -222,6 +454,7 @@ void SimFieldDictionary::printFields(SimObject *obj)
 SimFieldDictionaryIterator::SimFieldDictionaryIterator(SimFieldDictionary * dictionary)
 {
    mDictionary = dictionary;
+   mSlotIndex = -1;
    mHashIndex = -1;
    mEntry = 0;
    operator++();
@@ -232,6 +465,20 @@ SimFieldDictionary::Entry* SimFieldDictionaryIterator::operator++()
    if(!mDictionary)
       return(mEntry);
 
+   if(mDictionary->mShape)
+   {
+      // Skip the slots of removed fields.
+      const S32 slotCount = mDictionary->mShape->getSlotCount();
+      mEntry = 0;
+      while(!mEntry && mSlotIndex < slotCount - 1)
+      {
+         SimFieldDictionary::Entry* entry = &mDictionary->mSlots[++mSlotIndex];
+         if(entry->value)
+            mEntry = entry;
+      }
+      return(mEntry);
+   }
+
    if(mEntry)
       mEntry = mEntry->next;
 
@@ -30,10 +30,17 @@
 //-----------------------------------------------------------------------------
 
 class SimObject;
+class SimFieldShape;
 
 //-----------------------------------------------------------------------------
 
 /// Dictionary to keep track of dynamic fields on SimObject.
+///
+/// Fields are normally stored densely, one slot per field, with the field names
+/// held by a shared SimFieldShape.  Objects that add the same fields in the same
+/// order share a shape so a field lookup is a search of the shape followed by an
+/// index into the slots.  An object with too many fields, or that removes many
+/// of its fields, falls back to a per-object hash table.
 
 class SimFieldDictionary
 {
@@ -48,15 +55,29 @@ class SimFieldDictionary
    };
    enum
    {
-      HashTableSize = 19
+      HashTableSize = 19,
+      MinSlotCapacity = 4
    };
-   Entry *mHashTable[HashTableSize];
+
   private:
+   /// The shape of the slots or NULL if the hash table is in use.
+   SimFieldShape *mShape;
+
+   /// One entry per shape slot.  A removed field keeps its slot with a NULL value.
+   Entry *mSlots;
+   U32 mSlotCapacity;
+   U32 mRemovedSlotCount;
+
+   /// Only allocated if the dictionary has fallen back to a hash table.
+   Entry **mHashTable;
 
    static Entry *mFreeList;
    static void freeEntry(Entry *entry);
    static Entry *allocEntry();
 
+   /// Move the fields from the slots to a hash table.
+   void convertToHashTable();
+
    /// In order to efficiently detect when a dynamic field has been
    /// added or deleted, we increment this every time we add or
    /// remove a field.
@@ -76,9 +97,14 @@ public:
 
 //-----------------------------------------------------------------------------
 
+/// Iterate the fields of a SimFieldDictionary.
+///
+/// The entries returned are only valid until a field is added to or removed
+/// from the dictionary.
 class SimFieldDictionaryIterator
 {
    SimFieldDictionary *          mDictionary;
+   S32                           mSlotIndex;
    S32                           mHashIndex;
    SimFieldDictionary::Entry *   mEntry;
 
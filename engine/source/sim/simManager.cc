@@ -22,6 +22,7 @@
 
 #include "platform/platform.h"
 #include "platform/threads/mutex.h"
+#include "platform/threads/atomic.h"
 #include "sim/simBase.h"
 #include "string/stringTable.h"
 #include "console/console.h"
@@ -30,6 +31,7 @@
 #include "io/fileObject.h"
 #include "console/consoleInternal.h"
 #include "memory/safeDelete.h"
+#include "collection/hashTable.h"
 
 //---------------------------------------------------------------------------
 
@@ -44,9 +46,130 @@ SimTime gCurrentTime;
 SimTime gTargetTime;
 
 void *gEventQueueMutex;
-SimEvent *gEventQueue;
 U32 gEventSequence;
 
+// The pending events, as a binary min-heap ordered by time and then by post order.
+// Cancelled events stay in the heap (with no destination object) until they are
+// popped or the heap is compacted.
+Vector<SimEvent*> gEventQueue;
+U32 gCancelledEventCount;
+
+// The pending (not cancelled) events by their sequence count.
+HashTable<U32, SimEvent*> gEventLookup;
+
+// Events posted with postThreadEvent(), most recent first, waiting to be moved into
+// the event queue by the main thread.
+SimEvent* volatile gThreadEventInbox = NULL;
+
+//---------------------------------------------------------------------------
+// event queue heap
+
+static inline bool isEventBefore(const SimEvent* eventA, const SimEvent* eventB)
+{
+   if(eventA->time != eventB->time)
+      return eventA->time < eventB->time;
+
+   // Events at the same time are dispatched in the order they were posted.
+   return S32(eventA->sequenceCount - eventB->sequenceCount) < 0;
+}
+
+static void siftEventUp(U32 index)
+{
+   SimEvent *event = gEventQueue[index];
+   while(index > 0)
+   {
+      const U32 parent = (index - 1) / 2;
+      if(!isEventBefore(event, gEventQueue[parent]))
+         break;
+
+      gEventQueue[index] = gEventQueue[parent];
+      index = parent;
+   }
+   gEventQueue[index] = event;
+}
+
+static void siftEventDown(U32 index)
+{
+   const U32 count = gEventQueue.size();
+   SimEvent *event = gEventQueue[index];
+   for(;;)
+   {
+      U32 child = index * 2 + 1;
+      if(child >= count)
+         break;
+
+      if(child + 1 < count && isEventBefore(gEventQueue[child + 1], gEventQueue[child]))
+         child++;
+
+      if(!isEventBefore(gEventQueue[child], event))
+         break;
+
+      gEventQueue[index] = gEventQueue[child];
+      index = child;
+   }
+   gEventQueue[index] = event;
+}
+
+static SimEvent* popQueuedEvent()
+{
+   SimEvent *event = gEventQueue[0];
+
+   // Move the last event to the top and restore the heap.
+   SimEvent *last = gEventQueue.last();
+   gEventQueue.pop_back();
+   if(gEventQueue.size())
+   {
+      gEventQueue[0] = last;
+      siftEventDown(0);
+   }
+
+   if(event->destObject == NULL)
+      gCancelledEventCount--;
+
+   return event;
+}
+
+static void compactEventQueue()
+{
+   // Delete the cancelled events and rebuild the heap from the rest.
+   U32 count = 0;
+   for(S32 i = 0; i < gEventQueue.size(); i++)
+   {
+      SimEvent *event = gEventQueue[i];
+      if(event->destObject == NULL)
+         delete event;
+      else
+         gEventQueue[count++] = event;
+   }
+
+   gEventQueue.setSize(count);
+   gCancelledEventCount = 0;
+
+   for(S32 i = S32(count / 2) - 1; i >= 0; i--)
+      siftEventDown(i);
+}
+
+static void cancelQueuedEvent(SimEvent* event)
+{
+   // Mark the event as cancelled rather than removing it from the heap.
+   gEventLookup.erase(event->sequenceCount);
+   event->destObject = NULL;
+   gCancelledEventCount++;
+}
+
+static void checkCancelledEvents()
+{
+   // Compact once cancelled events make up most of the heap.
+   if(gCancelledEventCount > 64 && gCancelledEventCount > U32(gEventQueue.size()) / 2)
+      compactEventQueue();
+}
+
+static inline SimEvent* findQueuedEvent(U32 eventSequence)
+{
+   HashTable<U32, SimEvent*>::iterator itr = gEventLookup.find(eventSequence);
+   return itr != gEventLookup.end() ? itr->value : NULL;
+}
+
 //---------------------------------------------------------------------------
 // event queue init/shutdown
 
@@ -55,7 +178,9 @@ void initEventQueue()
    gCurrentTime = 0;
    gTargetTime = 0;
    gEventSequence = 1;
-   gEventQueue = NULL;
+   gEventQueue.clear();
+   gCancelledEventCount = 0;
+   gEventLookup.clear();
    gEventQueueMutex = Mutex::createMutex();
 }
 
@@ -63,13 +188,17 @@ void shutdownEventQueue()
 {
    // Delete all pending events
    Mutex::lockMutex(gEventQueueMutex);
-   SimEvent *walk = gEventQueue;
-   while(walk)
+   for(SimEvent *walk = (SimEvent*)dExchangePointer((void* volatile*)&gThreadEventInbox, NULL); walk; )
    {
-      SimEvent *temp = walk->nextEvent;
+      SimEvent *next = walk->nextEvent;
       delete walk;
-      walk = temp;
+      walk = next;
    }
+   for(S32 i = 0; i < gEventQueue.size(); i++)
+      delete gEventQueue[i];
+   gEventQueue.clear();
+   gEventLookup.clear();
+   gCancelledEventCount = 0;
    Mutex::unlockMutex(gEventQueueMutex);
    Mutex::destroyMutex(gEventQueueMutex);
 }
@@ -101,19 +230,12 @@ U32 postEvent(SimObject *destObject, SimEvent* event,U32 time)
       return InvalidEventId;
    }
    event->sequenceCount = gEventSequence++;
-   SimEvent **walk = &gEventQueue;
-   SimEvent *current;
-   
-   while((current = *walk) != NULL && (current->time < event->time))
-      walk = &(current->nextEvent);
-   
-   // [tom, 6/24/2005] This ensures that SimEvents are dispatched in the same order that they are posted.
+
+   // [tom, 6/24/2005] Events are dispatched in the same order that they are posted.
    // This is needed to ensure Con::threadSafeExecute() executes script code in the correct order.
-   while((current = *walk) != NULL && (current->time == event->time))
-      walk = &(current->nextEvent);
-   
-   event->nextEvent = current;
-   *walk = event;
+   gEventQueue.push_back(event);
+   siftEventUp(gEventQueue.size() - 1);
+   gEventLookup.insertUnique(event->sequenceCount, event);
 
    U32 seqCount = event->sequenceCount;
 
@@ -122,6 +244,51 @@ U32 postEvent(SimObject *destObject, SimEvent* event,U32 time)
    return seqCount;
 }
 
+void postThreadEvent(SimObjectId destObjectId, SimEvent* event, U32 delay)
+{
+   event->destObjectId = destObjectId;
+   event->time = delay;
+
+   // Push the event onto the inbox.
+   SimEvent *head;
+   do
+   {
+      head = gThreadEventInbox;
+      event->nextEvent = head;
+   }
+   while(dCompareAndSwapPointer((void* volatile*)&gThreadEventInbox, head, event) != head);
+}
+
+static void drainThreadEventInbox()
+{
+   if(gThreadEventInbox == NULL)
+      return;
+
+   // Take the whole inbox and reverse it into posting order.
+   SimEvent *walk = (SimEvent*)dExchangePointer((void* volatile*)&gThreadEventInbox, NULL);
+   SimEvent *ordered = NULL;
+   while(walk)
+   {
+      SimEvent *next = walk->nextEvent;
+      walk->nextEvent = ordered;
+      ordered = walk;
+      walk = next;
+   }
+
+   while(ordered)
+   {
+      SimEvent *event = ordered;
+      ordered = event->nextEvent;
+      event->nextEvent = NULL;
+
+      SimObject *destObject = findObject(event->destObjectId);
+      if(destObject)
+         postEvent(destObject, event, gCurrentTime + event->time);
+      else
+         delete event;
+   }
+}
+
 //---------------------------------------------------------------------------
 // event cancellation
 
@@ -134,20 +301,11 @@ void cancelEvent(U32 eventSequence)
 {
    Mutex::lockMutex(gEventQueueMutex);
 
-   SimEvent **walk = &gEventQueue;
-   SimEvent *current;
-   
-   while((current = *walk) != NULL)
+   SimEvent *event = findQueuedEvent(eventSequence);
+   if(event)
    {
-      if(current->sequenceCount == eventSequence)
-      {
-         *walk = current->nextEvent;
-         delete current;
-         Mutex::unlockMutex(gEventQueueMutex);
-         return;
-      }
-      else
-         walk = &(current->nextEvent);
+      cancelQueuedEvent(event);
+      checkCancelledEvents();
    }
 
    Mutex::unlockMutex(gEventQueueMutex);
@@ -157,19 +315,14 @@ void cancelPendingEvents(SimObject *obj)
 {
    Mutex::lockMutex(gEventQueueMutex);
 
-   SimEvent **walk = &gEventQueue;
-   SimEvent *current;
-   
-   while((current = *walk) != NULL)
+   for(S32 i = 0; i < gEventQueue.size(); i++)
    {
-      if(current->destObject == obj)
-      {
-         *walk = current->nextEvent;
-         delete current;
-      }
-      else
-         walk = &(current->nextEvent);
+      SimEvent *event = gEventQueue[i];
+      if(event->destObject == obj)
+         cancelQueuedEvent(event);
    }
+   checkCancelledEvents();
+
    Mutex::unlockMutex(gEventQueueMutex);
 }
 
@@ -188,14 +341,10 @@ bool isEventPending(U32 eventSequence)
 {
    Mutex::lockMutex(gEventQueueMutex);
 
-   for(SimEvent *walk = gEventQueue; walk; walk = walk->nextEvent)
-      if(walk->sequenceCount == eventSequence)
-      {
-         Mutex::unlockMutex(gEventQueueMutex);
-         return true;
-      }
+   const bool pending = findQueuedEvent(eventSequence) != NULL;
+
    Mutex::unlockMutex(gEventQueueMutex);
-   return false;
+   return pending;
 }
 
 /*!
@@ -209,17 +358,12 @@ U32 getEventTimeLeft(U32 eventSequence)
 {
    Mutex::lockMutex(gEventQueueMutex);
 
-   for(SimEvent *walk = gEventQueue; walk; walk = walk->nextEvent)
-      if(walk->sequenceCount == eventSequence)
-      {
-         SimTime t = walk->time - getCurrentTime();
-         Mutex::unlockMutex(gEventQueueMutex);
-         return t;
-      }
+   SimEvent *event = findQueuedEvent(eventSequence);
+   SimTime t = event ? event->time - gCurrentTime : 0;
 
    Mutex::unlockMutex(gEventQueueMutex);
 
-   return 0;   
+   return t;   
 }
 
 /*!
@@ -231,10 +375,8 @@ U32 getEventTimeLeft(U32 eventSequence)
 */
 U32 getScheduleDuration(U32 eventSequence)
 {
-   for(SimEvent *walk = gEventQueue; walk; walk = walk->nextEvent)
-      if(walk->sequenceCount == eventSequence)
-         return (walk->time-walk->startTime);
-   return 0;
+   SimEvent *event = findQueuedEvent(eventSequence);
+   return event ? (event->time-event->startTime) : 0;
 }
 
 /*!
@@ -246,10 +388,8 @@ U32 getScheduleDuration(U32 eventSequence)
 */
 U32 getTimeSinceStart(U32 eventSequence)
 {
-   for(SimEvent *walk = gEventQueue; walk; walk = walk->nextEvent)
-      if(walk->sequenceCount == eventSequence)
-         return (getCurrentTime()-walk->startTime);
-   return 0;
+   SimEvent *event = findQueuedEvent(eventSequence);
+   return event ? (getCurrentTime()-event->startTime) : 0;
 }
 
 //---------------------------------------------------------------------------
@@ -259,12 +399,23 @@ void advanceToTime(SimTime targetTime)
 {
    AssertFatal(targetTime >= getCurrentTime(), "EventQueue::process: cannot advance to time in the past.");
 
+   // Move the events posted by other threads into the queue.
+   drainThreadEventInbox();
+
    Mutex::lockMutex(gEventQueueMutex);
    gTargetTime = targetTime;
-   while(gEventQueue && gEventQueue->time <= targetTime)
+   while(gEventQueue.size() && gEventQueue[0]->time <= targetTime)
    {
-      SimEvent *event = gEventQueue;
-      gEventQueue = gEventQueue->nextEvent;
+      SimEvent *event = popQueuedEvent();
+
+      // Skip cancelled events.
+      if(event->destObject == NULL)
+      {
+         delete event;
+         continue;
+      }
+
+      gEventLookup.erase(event->sequenceCount);
       AssertFatal(event->time >= gCurrentTime,
             "SimEventQueue::pop: Cannot go back in time (flux capacitor not installed - BJG).");
       gCurrentTime = event->time;
@@ -306,6 +457,23 @@ U32 getTargetTime()
    return gTargetTime;
 }
 
+U32 getTimeToNextEvent()
+{
+   // Events posted by other threads are due as soon as they are drained.
+   if(gThreadEventInbox != NULL)
+      return 0;
+
+   Mutex::lockMutex(gEventQueueMutex);
+
+   SimTime t = U32_MAX;
+   if(gEventQueue.size())
+      t = gEventQueue[0]->time > gCurrentTime ? gEventQueue[0]->time - gCurrentTime : 0;
+
+   Mutex::unlockMutex(gEventQueueMutex);
+
+   return t;
+}
+
 //---------------------------------------------------------------------------
 //---------------------------------------------------------------------------
 
@@ -313,6 +481,7 @@ SimGroup *gRootGroup = NULL;
 SimManagerNameDictionary *gNameDictionary;
 SimIdDictionary *gIdDictionary;
 U32 gNextObjectId;
+U32 gNextObjectGeneration = 1;
 
 void initRoot()
 {
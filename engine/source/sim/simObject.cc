@@ -39,6 +39,7 @@ IMPLEMENT_CONOBJECT(SimObject);
 namespace Sim
 {
     extern U32 gNextObjectId;
+    extern U32 gNextObjectGeneration;
     extern SimIdDictionary *gIdDictionary;
     extern SimManagerNameDictionary *gNameDictionary;
     extern void cancelPendingEvents(SimObject *obj);
@@ -53,12 +54,13 @@ SimObject::SimObject( const U8 namespaceLinkMask ) : mNSLinkMask( namespaceLinkM
     mInternalName            = NULL;
     nextNameObject           = (SimObject*)-1;
     nextManagerNameObject    = (SimObject*)-1;
-    nextIdObject             = NULL;  
     mId                      = 0;
+    mGeneration              = 0;
     mIdString                = StringTable->EmptyString;
     mGroup                   = 0;
     mNameSpace               = NULL;
     mNotifyList              = NULL;
+    mSetMemberships          = NULL;
     mTypeMask                = 0;
     mScriptCallbackGuard     = 0;
     mFieldDictionary         = NULL;
@@ -67,6 +69,7 @@ SimObject::SimObject( const U8 namespaceLinkMask ) : mNSLinkMask( namespaceLinkM
     mSuperClassName          = NULL;
     mProgenitorFile          = CodeBlock::getCurrentCodeBlockFullPath();
     mPeriodicTimerID         = 0;
+    mTamlModifySequence      = ++smTamlModifySequence;
 }
 
 //---------------------------------------------------------------------------
@@ -94,12 +97,11 @@ bool SimObject::registerObject()
     if( mId == 0 )
     {
         mId = Sim::gNextObjectId++;
-
-        char idBuffer[64];
-        dSprintf(idBuffer, sizeof(idBuffer), "%d", mId);
-        mIdString = StringTable->insert( idBuffer );
+        updateIdString();
     }
 
+    mGeneration = Sim::gNextObjectGeneration++;
+
    AssertFatal(Sim::gIdDictionary && Sim::gNameDictionary, 
       "SimObject::registerObject - tried to register an object before Sim::init()!");
 
@@ -107,6 +109,13 @@ bool SimObject::registerObject()
 
    Sim::gNameDictionary->insert(this);
 
+   return completeRegistration();
+}
+
+//---------------------------------------------------------------------------
+
+bool SimObject::completeRegistration()
+{
     // Notify object
    bool ret = onAdd();
 
@@ -123,6 +132,61 @@ bool SimObject::registerObject()
 
 //---------------------------------------------------------------------------
 
+U32 SimObject::registerObjects(SimObject** ppObjects, const U32 count, SimGroup* pGroup)
+{
+   AssertFatal(Sim::gIdDictionary && Sim::gNameDictionary, 
+      "SimObject::registerObjects - tried to register objects before Sim::init()!");
+
+   // Assign ids to all the objects first.
+   for(U32 i = 0; i < count; i++)
+   {
+      SimObject* pObject = ppObjects[i];
+      AssertFatal( !pObject->mFlags.test( Added ), "SimObject::registerObjects - Object already registered!");
+      pObject->mFlags.clear(Deleted | Removed);
+
+      if( pObject->mId == 0 )
+      {
+         pObject->mId = Sim::gNextObjectId++;
+         pObject->updateIdString();
+      }
+
+      pObject->mGeneration = Sim::gNextObjectGeneration++;
+   }
+
+   // Add them to the dictionaries in one go.
+   Sim::gIdDictionary->insert(ppObjects, count);
+   Sim::gNameDictionary->insert(ppObjects, count);
+
+   U32 registeredCount = 0;
+   for(U32 i = 0; i < count; i++)
+   {
+      if(ppObjects[i]->completeRegistration())
+         registeredCount++;
+   }
+
+   // Add the objects to the group once they have all been added.
+   if(pGroup)
+   {
+      for(U32 i = 0; i < count; i++)
+      {
+         if(ppObjects[i]->isProperlyAdded())
+            pGroup->addObject(ppObjects[i]);
+      }
+   }
+
+   return registeredCount;
+}
+
+namespace Sim
+{
+   U32 registerObjects(SimObject** ppObjects, const U32 count, SimGroup* pGroup)
+   {
+      return SimObject::registerObjects(ppObjects, count, pGroup);
+   }
+}
+
+//---------------------------------------------------------------------------
+
 void SimObject::unregisterObject()
 {
     // Sanity!
@@ -146,12 +210,15 @@ void SimObject::unregisterObject()
    if (getGroup())
       getGroup()->removeObject(this);
 
+   processSetMembershipDeletes();
    processDeleteNotifies();
 
    // Do removals from the Sim.
    Sim::gNameDictionary->remove(this);
    Sim::gIdDictionary->remove(this);
    Sim::cancelPendingEvents(this);
+
+   mGeneration = 0;
 }
 
 //---------------------------------------------------------------------------
@@ -193,6 +260,11 @@ void SimObject::setId(SimObjectId newId)
         Sim::gIdDictionary->insert(this);
     }
 
+    updateIdString();
+}
+
+void SimObject::updateIdString()
+{
     char idBuffer[64];
     dSprintf(idBuffer, sizeof(idBuffer), "%d", mId);
     mIdString = StringTable->insert( idBuffer );
@@ -259,6 +331,8 @@ bool SimObject::registerObject(const char *name, U32 id)
 
 void SimObject::assignDynamicFieldsFrom(SimObject* parent)
 {
+   setTamlModified();
+
    if(parent->mFieldDictionary)
    {
       if( mFieldDictionary == NULL )
@@ -269,6 +343,8 @@ void SimObject::assignDynamicFieldsFrom(SimObject* parent)
 
 void SimObject::assignFieldsFrom(SimObject *parent)
 {
+   setTamlModified();
+
    // only allow field assigns from objects of the same class:
    if(getClassRep() == parent->getClassRep())
    {
@@ -474,6 +550,8 @@ void SimObject::setInternalName(const char* newname)
 {
    if(newname)
       mInternalName = StringTable->insert(newname);
+
+   setTamlModified();
 }
 
 StringTableEntry SimObject::getInternalName()
@@ -500,6 +578,9 @@ const char *SimObject::tabComplete(const char *prevText, S32 baseLen, bool fForw
 
 void SimObject::setDataField(StringTableEntry slotName, const char *array, const char *value)
 {
+   // Record the change for incremental Taml writes.
+   setTamlModified();
+
    // first search the static fields if enabled
    if(mFlags.test(ModStaticFields))
    {
@@ -833,6 +914,14 @@ SimObject::~SimObject()
 {
    delete mFieldDictionary;
 
+   // Objects deleted by their group are still recorded as its members.
+   while(mSetMemberships)
+   {
+      SetMembership *membership = mSetMemberships;
+      mSetMemberships = membership->next;
+      freeSetMembership(membership);
+   }
+
    AssertFatal(nextNameObject == (SimObject*)-1,avar(
                   "SimObject::~SimObject:  Not removed from dictionary: name %s, id %i",
                   objectName, mId));
@@ -941,6 +1030,10 @@ bool SimObject::isChildOfGroup(SimGroup* pGroup)
 
 //---------------------------------------------------------------------------
 
+U32 SimObject::smTamlModifySequence = 0;
+
+//---------------------------------------------------------------------------
+
 static Chunker<SimObject::Notify> notifyChunker(128000);
 SimObject::Notify *SimObject::mNotifyFreeList = NULL;
 
@@ -981,6 +1074,83 @@ SimObject::Notify* SimObject::removeNotify(void *ptr, SimObject::Notify::Type ty
    return NULL;
 }
 
+static Chunker<SimObject::SetMembership> setMembershipChunker(128000);
+SimObject::SetMembership *SimObject::mSetMembershipFreeList = NULL;
+
+SimObject::SetMembership *SimObject::allocSetMembership()
+{
+   if(mSetMembershipFreeList)
+   {
+      SimObject::SetMembership *ret = mSetMembershipFreeList;
+      mSetMembershipFreeList = ret->next;
+      return ret;
+   }
+   return setMembershipChunker.alloc();
+}
+
+void SimObject::freeSetMembership(SimObject::SetMembership* membership)
+{
+   membership->set = NULL;
+   membership->next = mSetMembershipFreeList;
+   mSetMembershipFreeList = membership;
+}
+
+SimObject::SetMembership* SimObject::findSetMembership(SimSet* set)
+{
+   for(SetMembership *walk = mSetMemberships; walk; walk = walk->next)
+   {
+      if(walk->set == set)
+         return walk;
+   }
+   return NULL;
+}
+
+void SimObject::addSetMembership(SimSet* set, U32 index, bool deleteNotify)
+{
+   AssertFatal(!isDeleted(), "SimObject::addSetMembership: Object is being deleted");
+   SetMembership *membership = allocSetMembership();
+   membership->set = set;
+   membership->index = index;
+   membership->deleteNotify = deleteNotify;
+   membership->next = mSetMemberships;
+   mSetMemberships = membership;
+}
+
+void SimObject::removeSetMembership(SimSet* set)
+{
+   for(SetMembership **walk = &mSetMemberships; *walk; walk = &((*walk)->next))
+   {
+      if((*walk)->set == set)
+      {
+         SetMembership *membership = *walk;
+         *walk = membership->next;
+         freeSetMembership(membership);
+         return;
+      }
+   }
+}
+
+void SimObject::processSetMembershipDeletes()
+{
+   // Sets normally remove the membership when notified but the notification
+   // can change the list so search it again after each one.
+   for(;;)
+   {
+      SetMembership *membership = mSetMemberships;
+      while(membership && !membership->deleteNotify)
+         membership = membership->next;
+
+      if(!membership)
+         break;
+
+      SimSet *set = membership->set;
+      set->onDeleteNotify(this);
+
+      if(findSetMembership(set) == membership)
+         removeSetMembership(set);
+   }
+}
+
 void SimObject::deleteNotify(SimObject* obj)
 {
    AssertFatal(!obj->isDeleted(),
@@ -1093,6 +1263,16 @@ void SimObject::initPersistFields()
 
 //-----------------------------------------------------------------------------
 
+void SimObject::consoleInit()
+{
+   Parent::consoleInit();
+
+   // All the persisted state is held in fields.
+   getStaticClassRep()->setTamlModifyTracked( true );
+}
+
+//-----------------------------------------------------------------------------
+
 SimObject* SimObject::clone( const bool copyDynamicFields )
 {
     // Craete cloned object.
@@ -1315,6 +1495,7 @@ void SimObject::unlinkNamespaces()
 void SimObject::setClassNamespace( const char *classNamespace )
 {
     mClassName = StringTable->insert( classNamespace );
+    setTamlModified();
     if (mFlags.test(Added))
         linkNamespaces();
 }
@@ -1322,6 +1503,7 @@ void SimObject::setClassNamespace( const char *classNamespace )
 void SimObject::setSuperClassNamespace( const char *superClassNamespace )
 {
     mSuperClassName = StringTable->insert( superClassNamespace );
+    setTamlModified();
     if (mFlags.test(Added))
         linkNamespaces();
 }
@@ -39,6 +39,7 @@
 
 typedef U32 SimObjectId;
 class SimGroup;
+class SimSet;
 
 //---------------------------------------------------------------------------
 /// Base class for objects involved in the simulation.
@@ -232,6 +233,7 @@ class SimObject: public ConsoleObject, public TamlCallbacks
     typedef ConsoleObject Parent;
 
     friend class SimManager;
+    friend class SimSet;
     friend class SimGroup;
     friend class SimNameDictionary;
     friend class SimManagerNameDictionary;
@@ -265,6 +267,14 @@ public:
         Notify *next;     ///< Next notification in the linked list.
     };
 
+    /// A record of the object being a member of a SimSet.
+    struct SetMembership {
+        SimSet *set;           ///< The set the object is in.
+        U32 index;             ///< Where the object is in the set (only a hint if the set keeps its order on removal).
+        bool deleteNotify;     ///< Whether the set is notified when the object is deleted.
+        SetMembership *next;   ///< Next membership in the linked list.
+    };
+
     /// @}
 
     enum WriteFlags {
@@ -277,7 +287,6 @@ private:
     StringTableEntry objectName;
     SimObject*       nextNameObject;
     SimObject*       nextManagerNameObject;
-    SimObject*       nextIdObject;
 
     SimGroup*   mGroup;  ///< SimGroup we're contained in, if any.
     BitSet32    mFlags;
@@ -286,16 +295,21 @@ private:
 
     S32 mPeriodicTimerID;
 
+    U32 mTamlModifySequence;
+    static U32 smTamlModifySequence;
+
 
     /// @name Notification
     /// @{
-    Notify*     mNotifyList;
+    Notify*         mNotifyList;
+    SetMembership*  mSetMemberships;
     /// @}
 
     Vector<StringTableEntry> mFieldFilter;
 
 protected:
     SimObjectId mId;         ///< Id number for this object.
+    U32         mGeneration; ///< Unique number assigned each time the object is registered.
     StringTableEntry mIdString;
     Namespace*  mNameSpace;
     U32         mTypeMask;
@@ -311,11 +325,18 @@ protected:
     static SimObject::Notify *allocNotify();     ///< Get a free Notify structure.
     static void freeNotify(SimObject::Notify*);  ///< Mark a Notify structure as free.
 
+    static SimObject::SetMembership *mSetMembershipFreeList;
+    static SimObject::SetMembership *allocSetMembership();    ///< Get a free SetMembership structure.
+    static void freeSetMembership(SimObject::SetMembership*); ///< Mark a SetMembership structure as free.
+
     /// @}
 
     private:
     SimFieldDictionary *mFieldDictionary;    ///< Storage for dynamic fields.
 
+    void updateIdString();                   ///< Set the id string from the id.
+    bool completeRegistration();             ///< Call onAdd() once the object is in the dictionaries.
+
 protected:
     /// Taml callbacks.
     virtual void onTamlPreWrite( void ) {}
@@ -427,7 +448,7 @@ public:
     inline void clearDynamicFields( void ) { if ( mFieldDictionary != NULL ) { delete mFieldDictionary; mFieldDictionary = new SimFieldDictionary; } }
 
     /// Set whether fields created at runtime should be saved. Default is true.
-    void		setCanSaveDynamicFields(bool bCanSave){ mCanSaveFieldDictionary	=	bCanSave;}
+    void		setCanSaveDynamicFields(bool bCanSave){ mCanSaveFieldDictionary	=	bCanSave; setTamlModified(); }
     /// Get whether fields created at runtime should be saved. Default is true.
     inline bool getCanSaveDynamicFields(void) const { return	mCanSaveFieldDictionary;}
 
@@ -514,6 +535,11 @@ public:
     void clearAllNotifications();                    ///< Remove all notifications for this object.
     void processDeleteNotifies();                    ///< Send out deletion notifications.
 
+    SetMembership* findSetMembership(SimSet* set);                          ///< Find the membership of a set, if any.
+    void addSetMembership(SimSet* set, U32 index, bool deleteNotify);      ///< Record being added to a set.
+    void removeSetMembership(SimSet* set);                                 ///< Remove the membership of a set.
+    void processSetMembershipDeletes();                                    ///< Tell the sets that want to know that we are being deleted.
+
     /// Register a reference to this object.
     ///
     /// You pass a pointer to your reference to this object.
@@ -579,6 +605,22 @@ public:
     /// @param   id  ID to assign to the object.
     bool registerObject(const char *name, U32 id);
 
+    /// Register a number of objects at once.
+    ///
+    /// Ids are assigned to all the objects that don't have one and they are all added
+    /// to the dictionaries in one pass.  Each object's onAdd() is then called in order,
+    /// so an object being added can already find those that follow it.  If a group is
+    /// specified, the objects that registered are added to it once all have been added.
+    ///
+    /// Objects that fail to register are unregistered but not deleted; check them with
+    /// isProperlyAdded().
+    ///
+    /// @param   ppObjects   The objects to register.
+    /// @param   count       The number of objects.
+    /// @param   pGroup      A group to add the objects to, if any.
+    /// @return  The number of objects that registered successfully.
+    static U32 registerObjects(SimObject** ppObjects, const U32 count, SimGroup* pGroup = NULL);
+
     /// Unregister the object from Sim.
     ///
     /// This performs several operations:
@@ -602,6 +644,7 @@ public:
     /// @name Accessors
     /// @{
     inline SimObjectId getId( void ) const { return mId; }
+    inline U32 getGeneration( void ) const { return mGeneration; }  ///< @see SimObjectHandle
     inline StringTableEntry getIdString( void ) const { return mIdString; }
     U32 getType() const  { return mTypeMask; }
     const StringTableEntry getName( void ) const { return objectName; };
@@ -717,13 +760,27 @@ public:
     void setExpanded(bool exp) { if(exp) mFlags.set(Expanded); else mFlags.clear(Expanded); }
     void setModDynamicFields(bool dyn) { if(dyn) mFlags.set(ModDynamicFields); else mFlags.clear(ModDynamicFields); }
     void setModStaticFields(bool sta) { if(sta) mFlags.set(ModStaticFields); else mFlags.clear(ModStaticFields); }
+    bool isModStaticFields() const { return mFlags.test(ModStaticFields); }
 
+    /// @}
+
+    /// @name Taml Modification Tracking
+    /// Changes made through fields are recorded so that incremental Taml writes can reuse the
+    /// fields compiled for objects that haven't changed.  Only classes flagged with
+    /// AbstractClassRep::setTamlModifyTracked() are trusted to record every change so objects
+    /// of any other class are always treated as modified.  C++ code changing the persisted
+    /// state of a tracked class without using fields should call setTamlModified().
+    /// @{
+    inline void setTamlModified( void ) { mTamlModifySequence = ++smTamlModifySequence; }
+    inline bool isTamlModifiedSince( const U32 sequence ) { return !getClassRep()->isTamlModifyTracked() || mTamlModifySequence > sequence; }
+    static inline U32 getTamlModifySequence( void ) { return smTamlModifySequence; }
     /// @}
 
 	virtual void			dump();
     virtual void			dumpClassHierarchy();
 
     static void initPersistFields();
+    static void consoleInit();
     SimObject* clone( const bool copyDynamicFields );
     virtual void copyTo(SimObject* object);
 
@@ -0,0 +1,105 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SIM_OBJECT_HANDLE_H_
+#define _SIM_OBJECT_HANDLE_H_
+
+#ifndef _SIMBASE_H_
+#include "sim/simBase.h"
+#endif
+
+//---------------------------------------------------------------------------
+/// Weak SimObject handle.
+///
+/// This class holds a reference to a registered SimObject (or subclass thereof)
+/// without registering a notification with it.  Unlike SimObjectPtr, assigning
+/// or clearing a handle is free and deleting the object costs nothing for each
+/// handle that refers to it.
+///
+/// The handle stores the object id along with the generation the object was given
+/// when it was registered.  The object is resolved through the id dictionary each
+/// time the handle is used and is only returned if it is still registered with the
+/// same generation, so a handle to a deleted object simply resolves to NULL.
+///
+/// Only registered objects can be referred to; assigning an unregistered object
+/// clears the handle, and changing the id of a registered object with
+/// SimObject::setId() leaves its handles resolving to NULL.  As the object is looked up on each use, code that uses it
+/// repeatedly should resolve it once into a local pointer.
+///
+/// @code
+///     // Assign an object.
+///     SimObjectHandle<SceneObject> mTrackedObject = pSceneObject;
+///
+///     // Resolve it, which returns NULL if it has since been deleted.
+///     SceneObject* pTrackedObject = mTrackedObject;
+/// @endcode
+template <class T> class SimObjectHandle
+{
+  private:
+   SimObjectId mId;
+   U32 mGeneration;
+
+  public:
+   SimObjectHandle() : mId( 0 ), mGeneration( 0 ) {}
+   SimObjectHandle( T* ptr ) { set( ptr ); }
+   SimObjectHandle<T>& operator=( T* ptr ) { set( ptr ); return *this; }
+
+   void set( T* ptr )
+   {
+      // Only registered objects can be resolved by id.
+      if ( ptr != NULL && ptr->isProperlyAdded() )
+      {
+         mId = ptr->getId();
+         mGeneration = ptr->getGeneration();
+      }
+      else
+      {
+         clear();
+      }
+   }
+
+   void clear( void ) { mId = 0; mGeneration = 0; }
+
+   T* getObject( void ) const
+   {
+      if ( mGeneration == 0 )
+         return NULL;
+
+      // The object may have been deleted or its id reused.
+      SimObject* pObject = Sim::findObject( mId );
+      if ( pObject == NULL || pObject->getGeneration() != mGeneration )
+         return NULL;
+
+      return static_cast<T*>( pObject );
+   }
+
+   inline SimObjectId getId( void ) const { return mId; }
+   bool isNull() const   { return getObject() == NULL; }
+   bool notNull() const  { return getObject() != NULL; }
+   T* operator->() const { return getObject(); }
+   operator T*() const   { return getObject(); }
+
+   bool operator==( const SimObjectHandle<T>& rhs ) const { return mId == rhs.mId && mGeneration == rhs.mGeneration; }
+   bool operator!=( const SimObjectHandle<T>& rhs ) const { return !(*this == rhs); }
+};
+
+#endif // _SIM_OBJECT_HANDLE_H_
@@ -41,7 +41,7 @@ bool SimObject::writeObject(Stream *stream)
 
    // Static fields
    AbstractClassRep *rep = getClassRep();
-   AbstractClassRep::FieldList &fieldList = rep->mFieldList;
+   AbstractClassRep::FieldList &fieldList = rep->getFieldList();
    AbstractClassRep::FieldList::iterator itr;
    
    U32 savePos = stream->getPosition();
@@ -39,27 +39,97 @@
 // Sim Set
 //////////////////////////////////////////////////////////////////////////
 
+S32 SimSet::findMemberIndex(SimObject* obj)
+{
+   SimObject::SetMembership *membership = obj->findSetMembership(this);
+   if (!membership || objectList.empty())
+      return -1;
+
+   // The recorded index is exact unless objects before it have been removed or
+   // inserted whilst keeping the order, so search outwards from it.
+   const S32 count = objectList.size();
+   const S32 hint = getMin((S32)membership->index, count - 1);
+   for (S32 distance = 0; hint - distance >= 0 || hint + distance < count; distance++)
+   {
+      if (hint - distance >= 0 && objectList[hint - distance] == obj)
+      {
+         membership->index = hint - distance;
+         return membership->index;
+      }
+
+      if (distance > 0 && hint + distance < count && objectList[hint + distance] == obj)
+      {
+         membership->index = hint + distance;
+         return membership->index;
+      }
+   }
+
+   AssertFatal(false, "SimSet::findMemberIndex - Object is recorded as a member but is not in the set.");
+   return -1;
+}
+
+void SimSet::addMember(SimObject* obj, bool deleteNotify)
+{
+   obj->addSetMembership(this, objectList.size(), deleteNotify);
+   objectList.push_back(obj);
+}
+
+void SimSet::removeMemberAt(U32 index)
+{
+   SimObject* pObject = objectList[index];
+   pObject->removeSetMembership(this);
+
+   if (mOrderedRemoval || index == (U32)objectList.size() - 1)
+   {
+      objectList.erase(objectList.begin() + index);
+      return;
+   }
+
+   // Move the last object into the gap.
+   SimObject* pLast = objectList.last();
+   objectList[index] = pLast;
+   objectList.decrement();
+
+   SimObject::SetMembership *membership = pLast->findSetMembership(this);
+   if (membership)
+      membership->index = index;
+}
+
+bool SimSet::isMember(SimObject* obj)
+{
+   lock();
+   const bool member = obj->findSetMembership(this) != NULL;
+   unlock();
+   return member;
+}
+
 void SimSet::addObject(SimObject* obj)
 {
    lock();
-   objectList.pushBack(obj);
-   deleteNotify(obj);
+   if (!obj->findSetMembership(this))
+      addMember(obj, true);
    unlock();
 }
 
 void SimSet::removeObject(SimObject* obj)
 {
    lock();
-   objectList.remove(obj);
-   clearNotify(obj);
+   S32 index = findMemberIndex(obj);
+   if (index >= 0)
+      removeMemberAt(index);
    unlock();
 }
 
 void SimSet::pushObject(SimObject* pObj)
 {
    lock();
-   objectList.pushBackForce(pObj);
-   deleteNotify(pObj);
+
+   // Move the object to the back if it is already a member.
+   S32 index = findMemberIndex(pObj);
+   if (index >= 0)
+      removeMemberAt(index);
+
+   addMember(pObj, true);
    unlock();
 }
 
@@ -74,10 +144,7 @@ void SimSet::popObject()
       return;
    }
 
-   SimObject* pObject = objectList[objectList.size() - 1];
-
-   objectList.removeStable(pObject);
-   clearNotify(pObject);
+   removeMemberAt(objectList.size() - 1);
 }
 
 //-----------------------------------------------------------------------------
@@ -112,8 +179,8 @@ bool SimSet::reOrder( SimObject *obj, SimObject *target )
    MutexHandle handle;
    handle.lock(mMutex);
 
-   iterator itrS, itrD;
-   if ( (itrS = find(begin(),end(),obj)) == end() )
+   S32 indexS, indexD;
+   if ( (indexS = findMemberIndex(obj)) < 0 )
    {
       return false;  // object must be in list
    }
@@ -125,24 +192,29 @@ bool SimSet::reOrder( SimObject *obj, SimObject *target )
 
    if ( !target )    // if no target, then put to back of list
    {
-      if ( itrS != (end()-1) )      // don't move if already last object
+      if ( indexS != size() - 1 )   // don't move if already last object
       {
-         objectList.erase(itrS);    // remove object from its current location
-         objectList.push_back(obj); // push it to the back of the list
+         objectList.erase(begin() + indexS);    // remove object from its current location
+         objectList.push_back(obj);             // push it to the back of the list
+         indexD = size() - 1;
       }
+      else
+         indexD = indexS;
    }
    else              // if target, insert object in front of target
    {
-      if ( (itrD = find(begin(),end(),target)) == end() )
+      if ( (indexD = findMemberIndex(target)) < 0 )
          return false;              // target must be in list
 
-      objectList.erase(itrS);
+      objectList.erase(begin() + indexS);
 
-      //Tinman - once itrS has been erased, itrD won't be pointing at the same place anymore - re-find...
-      itrD = find(begin(),end(),target);
-      objectList.insert(itrD,obj);
+      // The target moves down if it was after the object.
+      if ( indexD > indexS )
+         indexD--;
+      objectList.insert(begin() + indexD, obj);
    }
 
+   obj->findSetMembership(this)->index = indexD;
    return true;
 }   
 
@@ -165,7 +237,7 @@ void SimSet::onRemove()
       for (SimObjectList::iterator ptr = objectList.end() - 1;
          ptr >= objectList.begin(); ptr--)
       {
-         clearNotify(*ptr);
+         (*ptr)->removeSetMembership(this);
       }
    }
 
@@ -250,6 +322,19 @@ SimObject* SimSet::findObjectByInternalName(const char* internalName, bool searc
 
 IMPLEMENT_CONOBJECT_CHILDREN(SimSet);
 
+void SimSet::initPersistFields()
+{
+   Parent::initPersistFields();
+}
+
+void SimSet::consoleInit()
+{
+   Parent::consoleInit();
+
+   // All the persisted state is held in fields and children.
+   getStaticClassRep()->setTamlModifyTracked( true );
+}
+
 
 inline void SimSetIterator::Stack::push_back(SimSet* set)
 {
@@ -361,7 +446,8 @@ void SimGroup::addObject(SimObject* obj)
          obj->mGroup->removeObject(obj);
       nameDictionary.insert(obj);
       obj->mGroup = this;
-      objectList.push_back(obj); // force it into the object list
+      obj->setTamlModified();
+      addMember(obj, false); // force it into the object list
       // doesn't get a delete notify
       obj->onGroupAdd();
    }
@@ -375,8 +461,11 @@ void SimGroup::removeObject(SimObject* obj)
    {
       obj->onGroupRemove();
       nameDictionary.remove(obj);
-      objectList.remove(obj);
+      S32 index = findMemberIndex(obj);
+      if (index >= 0)
+         removeMemberAt(index);
       obj->mGroup = 0;
+      obj->setTamlModified();
    }
    unlock();
 }
@@ -473,3 +562,16 @@ bool SimGroup::processArguments(S32, const char **)
 
 IMPLEMENT_CONOBJECT(SimGroup);
 
+void SimGroup::initPersistFields()
+{
+   Parent::initPersistFields();
+}
+
+void SimGroup::consoleInit()
+{
+   Parent::consoleInit();
+
+   // All the persisted state is held in fields and children.
+   getStaticClassRep()->setTamlModifyTracked( true );
+}
+
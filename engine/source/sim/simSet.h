@@ -107,11 +107,25 @@ protected:
    SimObjectList objectList;
    void *mMutex;
 
+   /// Whether removing an object keeps the order of the others.  If not, the last
+   /// object is moved into the gap which makes removal from large sets much faster.
+   bool mOrderedRemoval;
+
+   /// Find where an object is in the set or -1 if it isn't a member.
+   S32 findMemberIndex( SimObject* obj );
+
+   /// Add an object to the end of the set.  It must not already be a member.
+   void addMember( SimObject* obj, bool deleteNotify );
+
+   /// Remove the object at an index from the set.
+   void removeMemberAt( U32 index );
+
 public:
    SimSet() {
       VECTOR_SET_ASSOCIATION(objectList);
 
       mMutex = Mutex::createMutex();
+      mOrderedRemoval = true;
    }
 
    ~SimSet()
@@ -154,6 +168,12 @@ public:
    virtual bool reOrder( SimObject *obj, SimObject *target=0 );
    SimObject* at(S32 index) const { return objectList.at(index); }
 
+   bool isMember( SimObject* obj );
+
+   /// Set whether removing an object keeps the order of the others (the default).
+   void setOrderedRemoval( const bool ordered ) { mOrderedRemoval = ordered; }
+   bool getOrderedRemoval( void ) const { return mOrderedRemoval; }
+
    void deleteObjects( void );
 
    void clear();
@@ -229,6 +249,9 @@ public:
 #endif
    }
 
+   static void initPersistFields();
+   static void consoleInit();
+
    DECLARE_CONOBJECT(SimSet);
 
 #ifdef TORQUE_DEBUG
@@ -315,6 +338,9 @@ public:
 
    bool processArguments(S32 argc, const char **argv);
 
+   static void initPersistFields();
+   static void consoleInit();
+
    DECLARE_CONOBJECT(SimGroup);
 };
 
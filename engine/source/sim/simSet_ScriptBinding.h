@@ -336,18 +336,7 @@ ConsoleMethodWithDocs(SimSet, isMember, ConsoleBool, 3, 3, (object))
       return false;
    }
 
-   object->lock();
-   for(SimSet::iterator i = object->begin(); i != object->end(); i++)
-   {
-      if(*i == testObject)
-      {
-         object->unlock();
-         return true;
-      }
-   }
-   object->unlock();
-
-   return false;
+   return object->isMember(testObject);
 }
 
 /*! Returns the object with given internal name
@@ -393,4 +382,22 @@ ConsoleMethodWithDocs(SimSet, pushToBack, ConsoleVoid, 3, 3, (object))
    object->pushObjectToBack(obj);
 }
 
+/*! Sets whether removing an object keeps the order of the remaining objects.
+    When not ordered, the last object is moved into the place of the removed one which is much faster for large sets.
+    @param ordered Whether to keep the order on removal (the default).
+    @return No return value.
+*/
+ConsoleMethodWithDocs(SimSet, setOrderedRemoval, ConsoleVoid, 3, 3, (bool ordered))
+{
+   object->setOrderedRemoval( dAtob(argv[2]) );
+}
+
+/*! Gets whether removing an object keeps the order of the remaining objects.
+    @return Returns true if the order is kept on removal.
+*/
+ConsoleMethodWithDocs(SimSet, getOrderedRemoval, ConsoleBool, 2, 2, ())
+{
+   return object->getOrderedRemoval();
+}
+
 ConsoleMethodGroupEndWithDocs(SimSet)
@@ -23,11 +23,41 @@
 #include "stringStack.h"
 #include "math/mMath.h"
 
-void StringStack::getArgcArgv(StringTableEntry name, U32 *argc, const char ***in_argv, bool popStackFrame /* = false */)
+void StringStack::formatNumericArg(U32 argIndex)
+{
+   const U32 stackIndex = getArgStackIndex(argIndex);
+   const U32 type = mNumericArgTypes[stackIndex];
+
+   if(type == NumericArgNone)
+      return;
+
+   // Format the same way as setIntValue() and setFloatValue().
+   char *buffer = mBuffer + mStartOffsets[stackIndex];
+   if(type == NumericArgInt)
+      dSprintf(buffer, NumericArgSize, "%d", (S32)mNumericArgValues[stackIndex]);
+   else
+      dSprintf(buffer, NumericArgSize, "%.9g", mNumericArgValues[stackIndex]);
+
+   mNumericArgTypes[stackIndex] = NumericArgNone;
+}
+
+void StringStack::formatNumericArgs()
+{
+   U32 startStack = mFrameOffsets[mNumFrames-1] + 1;
+   U32 argCount   = getMin(mStartStackSize - startStack, (U32)MaxArgs);
+
+   for(U32 i = 0; i < argCount; i++)
+      formatNumericArg(i + 1);
+}
+
+void StringStack::getArgcArgv(StringTableEntry name, U32 *argc, const char ***in_argv, bool popStackFrame /* = false */, bool formatNumeric /* = true */)
 {
    U32 startStack = mFrameOffsets[mNumFrames-1] + 1;
    U32 argCount   = getMin(mStartStackSize - startStack, (U32)MaxArgs);
 
+   if(formatNumeric)
+      formatNumericArgs();
+
    *in_argv = mArgV;
    mArgV[0] = name;
    
@@ -37,7 +37,20 @@ struct StringStack
    enum {
       MaxStackDepth = 1024,
       MaxArgs = 20,
-      ReturnBufferSpace = 512
+      ReturnBufferSpace = 512,
+      NumericArgSize = 32,
+      InitialBufferSize = 64 * 1024,
+      InitialArgBufferSize = 16 * 1024
+   };
+
+   /// Types of arguments pushed as numbers.
+   ///
+   /// Numeric arguments reserve NumericArgSize bytes but are only formatted
+   /// into them when the callee needs its arguments as strings.
+   enum {
+      NumericArgNone,
+      NumericArgInt,
+      NumericArgFloat
    };
    char *mBuffer;
    U32   mBufferSize;
@@ -56,11 +69,24 @@ struct StringStack
    U32 mArgBufferSize;
    char *mArgBuffer;
 
+   U8  mNumericArgTypes[MaxStackDepth];
+   F64 mNumericArgValues[MaxStackDepth];
+
+   /// The numeric type of the top of the stack (a NumericArg value).
+   ///
+   /// Numbers set on the top of the stack are only formatted into its string
+   /// when something needs the string, so numeric consumers read them directly.
+   U32  mValueType;
+   F64  mValue;
+   bool mValueFormatted;
+
+   // The buffers grow geometrically from a preallocated size so that growing
+   // them (which moves every string on the stack) is rare.
    void validateBufferSize(U32 size)
    {
       if(size > mBufferSize)
       {
-         mBufferSize = size + 2048;
+         mBufferSize = getMax(size + 2048, mBufferSize * 2);
          mBuffer = (char *) dRealloc(mBuffer, mBufferSize);
       }
    }
@@ -68,7 +94,7 @@ struct StringStack
    {
       if(size > mArgBufferSize)
       {
-         mArgBufferSize = size + 2048;
+         mArgBufferSize = getMax(size + 2048, mArgBufferSize * 2);
          mArgBuffer = (char *) dRealloc(mArgBuffer, mArgBufferSize);
       }
    }
@@ -76,29 +102,58 @@ struct StringStack
    {
       mBufferSize = 0;
       mBuffer = NULL;
+      mArgBufferSize = 0;
+      mArgBuffer = NULL;
       mNumFrames = 0;
       mStart = 0;
       mLen = 0;
       mStartStackSize = 0;
       mFunctionOffset = 0;
-      validateBufferSize(8192);
-      validateArgBufferSize(2048);
+      mValueType = NumericArgNone;
+      mValue = 0;
+      mValueFormatted = false;
+      validateBufferSize(InitialBufferSize);
+      validateArgBufferSize(InitialArgBufferSize);
+   }
+
+   /// Format a numeric top of the stack into its string, if it has not been already.
+   inline void formatValue()
+   {
+      if(mValueType != NumericArgNone && !mValueFormatted)
+      {
+         // Format the same way as formatNumericArg().
+         if(mValueType == NumericArgInt)
+            dSprintf(mBuffer + mStart, NumericArgSize, "%d", (S32)mValue);
+         else
+            dSprintf(mBuffer + mStart, NumericArgSize, "%.9g", mValue);
+
+         mLen = dStrlen(mBuffer + mStart);
+         mValueFormatted = true;
+      }
+   }
+
+   /// Get the numeric type of the top of the stack (a NumericArg value).
+   inline U32 getValueType() const
+   {
+      return mValueType;
    }
 
    /// Set the top of the stack to be an integer value.
    void setIntValue(U32 i)
    {
-      validateBufferSize(mStart + 32);
-      dSprintf(mBuffer + mStart, 32, "%d", i);
-      mLen = dStrlen(mBuffer + mStart);
+      validateBufferSize(mStart + NumericArgSize);
+      mValueType = NumericArgInt;
+      mValue = (S32)i;
+      mValueFormatted = false;
    }
 
    /// Set the top of the stack to be a float value.
    void setFloatValue(F64 v)
    {
-      validateBufferSize(mStart + 32);
-      dSprintf(mBuffer + mStart, 32, "%.9g", v);
-      mLen = dStrlen(mBuffer + mStart);
+      validateBufferSize(mStart + NumericArgSize);
+      mValueType = NumericArgFloat;
+      mValue = v;
+      mValueFormatted = false;
    }
 
    /// Return a temporary buffer we can use to return data.
@@ -114,6 +169,7 @@ struct StringStack
       else
       {
          validateBufferSize(mStart + size);
+         mValueType = NumericArgNone;
          return mBuffer + mStart;
       }
    }
@@ -126,6 +182,7 @@ struct StringStack
       validateBufferSize(mStart + mFunctionOffset + size);
       char *ret = mBuffer + mStart + mFunctionOffset;
       mFunctionOffset += size;
+      mValueType = NumericArgNone;
       return ret;
    }
 
@@ -138,6 +195,7 @@ struct StringStack
    /// Set a string value on the top of the stack.
    void setStringValue(const char *s)
    {
+      mValueType = NumericArgNone;
       if(!s)
       {
          mLen = 0;
@@ -155,18 +213,26 @@ struct StringStack
    /// @note Don't free this memory!
    inline StringTableEntry getSTValue()
    {
+      formatValue();
       return StringTable->insert(mBuffer + mStart);
    }
 
    /// Get an integer representation of the top of the stack.
    inline U32 getIntValue()
    {
+      if(mValueType == NumericArgInt)
+         return (U32)(S32)mValue;
+
+      formatValue();
       return dAtoi(mBuffer + mStart);
    }
 
    /// Get a float representation of the top of the stack.
    inline F64 getFloatValue()
    {
+      if(mValueType != NumericArgNone)
+         return mValue;
+
       return dAtof(mBuffer + mStart);
    }
 
@@ -175,6 +241,7 @@ struct StringStack
    /// @note This returns a pointer to the actual top of the stack, be careful!
    inline const char *getStringValue()
    {
+      formatValue();
       return mBuffer + mStart;
    }
 
@@ -184,6 +251,8 @@ struct StringStack
    ///       properly push the stack.
    void advance()
    {
+      formatValue();
+      mValueType = NumericArgNone;
       mStartOffsets[mStartStackSize++] = mStart;
       mStart += mLen;
       mLen = 0;
@@ -196,6 +265,8 @@ struct StringStack
    ///       properly push the stack.
    void advanceChar(char c)
    {
+      formatValue();
+      mValueType = NumericArgNone;
       mStartOffsets[mStartStackSize++] = mStart;
       mStart += mLen;
       mBuffer[mStart] = c;
@@ -207,17 +278,59 @@ struct StringStack
    /// Push the stack, placing a zero-length string on the top.
    void push()
    {
+      mNumericArgTypes[mStartStackSize] = NumericArgNone;
       advanceChar(0);
    }
 
+   /// Push a numeric argument without formatting it, placing a zero-length
+   /// string on the top.
+   void pushNumeric(U32 type, F64 value)
+   {
+      validateBufferSize(mStart + NumericArgSize + 1);
+      mValueType = NumericArgNone;
+      mNumericArgTypes[mStartStackSize] = (U8)type;
+      mNumericArgValues[mStartStackSize] = value;
+      mBuffer[mStart] = 0;
+      mLen = NumericArgSize - 1;
+      advanceChar(0);
+   }
+
+   /// Get the stack index of an argument in the current frame.
+   ///
+   /// @note The index is into argv so argument 0 is the function name.
+   inline U32 getArgStackIndex(U32 argIndex) const
+   {
+      return mFrameOffsets[mNumFrames-1] + argIndex;
+   }
+
+   /// Get the numeric type of an argument in the current frame.
+   inline U32 getArgNumericType(U32 argIndex) const
+   {
+      return mNumericArgTypes[getArgStackIndex(argIndex)];
+   }
+
+   /// Get the value of a numeric argument in the current frame.
+   inline F64 getArgNumericValue(U32 argIndex) const
+   {
+      return mNumericArgValues[getArgStackIndex(argIndex)];
+   }
+
+   /// Format a numeric argument in the current frame into its string.
+   void formatNumericArg(U32 argIndex);
+
+   /// Format all the numeric arguments in the current frame into their strings.
+   void formatNumericArgs();
+
    inline void setLen(U32 newlen)
    {
+      mValueType = NumericArgNone;
       mLen = newlen;
    }
 
    /// Pop the start stack.
    void rewind()
    {
+      mValueType = NumericArgNone;
       mStart = mStartOffsets[--mStartStackSize];
       mLen = dStrlen(mBuffer + mStart);
    }
@@ -225,6 +338,7 @@ struct StringStack
    // Terminate the current string, and pop the start stack.
    void rewindTerminate()
    {
+      mValueType = NumericArgNone;
       mBuffer[mStart] = 0;
       mStart = mStartOffsets[--mStartStackSize];
       mLen   = dStrlen(mBuffer + mStart);
@@ -235,6 +349,8 @@ struct StringStack
    U32 compare()
    {
       // Figure out the 1st and 2nd item offsets.
+      formatValue();
+      mValueType = NumericArgNone;
       U32 oldStart = mStart;
       mStart = mStartOffsets[--mStartStackSize];
 
@@ -251,6 +367,7 @@ struct StringStack
    
    void pushFrame()
    {
+      mValueType = NumericArgNone;
       mFrameOffsets[mNumFrames++] = mStartStackSize;
       mStartOffsets[mStartStackSize++] = mStart;
       mStart += ReturnBufferSpace;
@@ -259,13 +376,17 @@ struct StringStack
 
    void popFrame()
    {
+      mValueType = NumericArgNone;
       mStartStackSize = mFrameOffsets[--mNumFrames];
       mStart = mStartOffsets[mStartStackSize];
       mLen = 0;
    }
 
    /// Get the arguments for a function call from the stack.
-   void getArgcArgv(StringTableEntry name, U32 *argc, const char ***in_argv, bool popStackFrame = false);
+   ///
+   /// Numeric arguments are formatted unless formatNumeric is false, in which
+   /// case the caller must format them before using them as strings.
+   void getArgcArgv(StringTableEntry name, U32 *argc, const char ***in_argv, bool popStackFrame = false, bool formatNumeric = true);
 };
 
 #endif
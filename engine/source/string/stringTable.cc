@@ -22,6 +22,7 @@
 
 #include "platform/platform.h"
 #include "stringTable.h"
+#include "platform/threads/atomic.h"
 
 _StringTable *_gStringTable = NULL;
 const U32 _StringTable::csm_stInitSize = 29;
@@ -77,17 +78,54 @@ U32 _StringTable::hashStringn(const char* str, S32 len)
    return ret;
 }
 
+//--------------------------------------
+namespace {
+
+/// Spread the bits of a string hash so that both the shard (top bits)
+/// and the bucket (bottom bits) are well distributed.
+inline U32 mixHash(U32 hash)
+{
+   hash ^= hash >> 16;
+   hash *= 0x85ebca6b;
+   hash ^= hash >> 13;
+   hash *= 0xc2b2ae35;
+   hash ^= hash >> 16;
+   return hash;
+}
+
+} // namespace {}
+
+//--------------------------------------
+_StringTable::Table* _StringTable::createTable(const U32 numBuckets)
+{
+   AssertFatal((numBuckets & (numBuckets - 1)) == 0, "StringTable: bucket count must be a power of two.");
+
+   // The buckets and migration flags share the table allocation.
+   const dsize_t size = sizeof(Table) + numBuckets * sizeof(Node*) + numBuckets * sizeof(bool);
+   Table* table = (Table*) dMalloc(size);
+   dMemset(table, 0, size);
+
+   table->mask = numBuckets - 1;
+   table->buckets = (Node * volatile *) (table + 1);
+   table->migrated = (volatile bool *) (table->buckets + numBuckets);
+   return table;
+}
+
 //--------------------------------------
 _StringTable::_StringTable()
 {
-   buckets = (Node **) dMalloc(csm_stInitSize * sizeof(Node *));
-   for(U32 i = 0; i < csm_stInitSize; i++) {
-      buckets[i] = 0;
+   // Start with roughly the same total number of buckets as a single table would.
+   U32 shardBuckets = 1;
+   while(shardBuckets * ShardCount < csm_stInitSize)
+      shardBuckets <<= 1;
+
+   for(U32 i = 0; i < ShardCount; i++) {
+      mShards[i].table = createTable(shardBuckets);
+      mShards[i].retired = NULL;
+      mShards[i].migrateIndex = 0;
+      mShards[i].itemCount = 0;
    }
 
-   numBuckets = csm_stInitSize;
-   itemCount = 0;
-
    // Insert empty string.
    EmptyString = insert("");
 }
@@ -95,7 +133,19 @@ _StringTable::_StringTable()
 //--------------------------------------
 _StringTable::~_StringTable()
 {
-   dFree(buckets);
+   for(U32 i = 0; i < ShardCount; i++) {
+      Shard& shard = mShards[i];
+
+      if(shard.table->previous)
+         dFree(shard.table->previous);
+      dFree(shard.table);
+
+      while(shard.retired) {
+         Table* next = shard.retired->nextRetired;
+         dFree(shard.retired);
+         shard.retired = next;
+      }
+   }
 }
 
 
@@ -117,38 +167,153 @@ void _StringTable::destroy()
    _gStringTable = NULL;
 }
 
+//--------------------------------------
+_StringTable::Node* _StringTable::findNode(const Table* table, const U32 hash, const char* val, const S32 len, const bool caseSens)
+{
+   // Strings in a bucket that has not been moved to this table yet are still in the
+   // previous one.  Check before walking this table as the bucket may be moved meanwhile.
+   const Table* previous = table->previous;
+   const bool searchPrevious = previous != NULL && !previous->migrated[hash & previous->mask];
+
+   // This runs without a lock.  Nodes are only ever appended to a bucket after they
+   // have been filled in so a reader always sees a complete chain.
+   for(Node* walk = table->buckets[hash & table->mask]; walk != NULL; walk = walk->next) {
+      if(walk->hash != hash || getEntryLength(walk->val) != (U32)len)
+         continue;
+      if(caseSens && !dStrncmp(walk->val, val, len))
+         return walk;
+      else if(!caseSens && !dStrnicmp(walk->val, val, len))
+         return walk;
+   }
+
+   if(searchPrevious)
+      return findNode(previous, hash, val, len, caseSens);
+
+   return NULL;
+}
+
+//--------------------------------------
+void _StringTable::appendNode(Node * volatile * walk, Node* node)
+{
+   // New strings are added at the end of bucket lists so that case sens
+   // strings are always after their corresponding case insens strings.
+   while(*walk != NULL)
+      walk = &((*walk)->next);
+
+   // Publish the node only once it is complete.
+   dMemoryBarrier();
+   *walk = node;
+}
+
+//--------------------------------------
+void _StringTable::migrateBucket(Shard& shard, const U32 index)
+{
+   Table* table = shard.table;
+   Table* previous = table->previous;
+   if(previous->migrated[index])
+      return;
+
+   // Copy rather than relink the nodes as readers may still be walking the old bucket.
+   for(Node* walk = previous->buckets[index]; walk != NULL; walk = walk->next) {
+      Node* node = (Node *) shard.mempool.alloc(sizeof(Node));
+      node->val = walk->val;
+      node->hash = walk->hash;
+      node->next = NULL;
+      appendNode(&table->buckets[walk->hash & table->mask], node);
+   }
+
+   dMemoryBarrier();
+   previous->migrated[index] = true;
+}
+
+//--------------------------------------
+void _StringTable::migrateBuckets(Shard& shard, U32 count)
+{
+   Table* table = shard.table;
+   Table* previous = table->previous;
+   if(previous == NULL)
+      return;
+
+   while(count && shard.migrateIndex <= previous->mask) {
+      if(!previous->migrated[shard.migrateIndex]) {
+         migrateBucket(shard, shard.migrateIndex);
+         count--;
+      }
+      shard.migrateIndex++;
+   }
+
+   if(shard.migrateIndex <= previous->mask)
+      return;
+
+   // Every bucket has been moved.  The previous table can't be freed as readers may
+   // still hold it so keep it until the StringTable is destroyed.
+   table->previous = NULL;
+   previous->nextRetired = shard.retired;
+   shard.retired = previous;
+}
+
+//--------------------------------------
+void _StringTable::beginResize(Shard& shard, const U32 numBuckets)
+{
+   // Finish any resize already under way.
+   migrateBuckets(shard, U32_MAX);
+
+   Table* table = createTable(numBuckets);
+   table->previous = shard.table;
+   shard.migrateIndex = 0;
+
+   dMemoryBarrier();
+   shard.table = table;
+}
+
 //--------------------------------------
 StringTableEntry _StringTable::insert(const char* val, const bool  caseSens)
 {
    if ( val == NULL )
        return StringTable->EmptyString;
 
+   const S32 len = dStrlen(val);
+   const U32 stringHash = hashString(val);
+   const U32 hash = mixHash(stringHash);
+   Shard& shard = mShards[hash >> ShardShift];
+
+   // Most strings are already present so look without locking first.
+   Node* node = findNode(shard.table, hash, val, len, caseSens);
+   if(node)
+      return node->val;
+
    MutexHandle mutex;
-   mutex.lock(&mMutex, true);
-
-   Node **walk, *temp;
-   U32 key = hashString(val);
-   walk = &buckets[key % numBuckets];
-   while((temp = *walk) != NULL)   {
-      if(caseSens && !dStrcmp(temp->val, val))
-         return temp->val;
-      else if(!caseSens && !dStricmp(temp->val, val))
-         return temp->val;
-      walk = &(temp->next);
-   }
-   char *ret = 0;
-   if(!*walk) {
-      *walk = (Node *) mempool.alloc(sizeof(Node));
-      (*walk)->next = 0;
-      (*walk)->val = (char *) mempool.alloc(dStrlen(val) + 1);
-      dStrcpy((*walk)->val, val);
-      ret = (*walk)->val;
-      itemCount ++;
+   mutex.lock(&shard.mutex, true);
+
+   // Another thread may have added the string whilst we waited.
+   node = findNode(shard.table, hash, val, len, caseSens);
+   if(node)
+      return node->val;
+
+   // Move some more buckets across if the shard is growing.  The bucket the string
+   // belongs to must be moved first to keep the order of its strings.
+   Table* table = shard.table;
+   if(table->previous != NULL) {
+      migrateBucket(shard, hash & table->previous->mask);
+      migrateBuckets(shard, MigrateBucketsPerInsert);
    }
-   if(itemCount > 2 * numBuckets) {
-      resize(4 * numBuckets - 1);
-   }
-   return ret;
+
+   // The hash and length are kept in front of the string.
+   EntryHeader* header = (EntryHeader *) shard.mempool.alloc(sizeof(EntryHeader) + len + 1);
+   header->hash = stringHash;
+   header->length = len;
+
+   node = (Node *) shard.mempool.alloc(sizeof(Node));
+   node->val = (char *) (header + 1);
+   dStrcpy(node->val, val);
+   node->hash = hash;
+   node->next = NULL;
+   appendNode(&table->buckets[hash & table->mask], node);
+
+   if(++shard.itemCount > 2 * (table->mask + 1))
+      beginResize(shard, 4 * (table->mask + 1));
+
+   return node->val;
 }
 
 //--------------------------------------
@@ -157,9 +322,6 @@ StringTableEntry _StringTable::insertn(const char* src, S32 len, const bool  cas
    if ( src == NULL )
        return StringTable->EmptyString;
 
-   MutexHandle mutex;
-   mutex.lock(&mMutex, true);
-
    char val[1024];
    AssertFatal(len < sizeof(val), "Invalid string to insertn");
    dStrncpy(val, src, len);
@@ -173,20 +335,9 @@ StringTableEntry _StringTable::lookup(const char* val, const bool  caseSens)
    if ( val == NULL )
        return StringTable->EmptyString;
 
-   MutexHandle mutex;
-   mutex.lock(&mMutex, true);
-
-   Node **walk, *temp;
-   U32 key = hashString(val);
-   walk = &buckets[key % numBuckets];
-   while((temp = *walk) != NULL)   {
-      if(caseSens && !dStrcmp(temp->val, val))
-            return temp->val;
-      else if(!caseSens && !dStricmp(temp->val, val))
-         return temp->val;
-      walk = &(temp->next);
-   }
-   return NULL;
+   const U32 hash = mixHash(hashString(val));
+   Node* node = findNode(mShards[hash >> ShardShift].table, hash, val, dStrlen(val), caseSens);
+   return node ? node->val : NULL;
 }
 
 //--------------------------------------
@@ -194,57 +345,31 @@ StringTableEntry _StringTable::lookupn(const char* val, S32 len, const bool  cas
 {
    if ( val == NULL )
        return StringTable->EmptyString;
-       
-   MutexHandle mutex;
-   mutex.lock(&mMutex, true);
-
-   Node **walk, *temp;
-   U32 key = hashStringn(val, len);
-   walk = &buckets[key % numBuckets];
-   while((temp = *walk) != NULL) {
-      if(caseSens && !dStrncmp(temp->val, val, len) && temp->val[len] == 0)
-         return temp->val;
-      else if(!caseSens && !dStrnicmp(temp->val, val, len) && temp->val[len] == 0)
-         return temp->val;
-      walk = &(temp->next);
-   }
-   return NULL;
+
+   // The string may end before len.
+   S32 stringLen = 0;
+   while(stringLen < len && val[stringLen] != 0)
+      stringLen++;
+
+   const U32 hash = mixHash(hashStringn(val, stringLen));
+   Node* node = findNode(mShards[hash >> ShardShift].table, hash, val, stringLen, caseSens);
+   return node ? node->val : NULL;
 }
 
 //--------------------------------------
 void _StringTable::resize(const U32 newSize)
 {
-   Node *head = NULL, *walk, *temp;
-   U32 i;
-   // reverse individual bucket lists
-   // we do this because new strings are added at the end of bucket
-   // lists so that case sens strings are always after their
-   // corresponding case insens strings
-
-   for(i = 0; i < numBuckets; i++) {
-      walk = buckets[i];
-      while(walk)
-      {
-         temp = walk->next;
-         walk->next = head;
-         head = walk;
-         walk = temp;
-      }
-   }
-   buckets = (Node **) dRealloc(buckets, newSize * sizeof(Node));
-   for(i = 0; i < newSize; i++) {
-      buckets[i] = 0;
-   }
-   numBuckets = newSize;
-   walk = head;
-   while(walk) {
-      U32 key;
-      Node *temp = walk;
-
-      walk = walk->next;
-      key = hashString(temp->val);
-      temp->next = buckets[key % newSize];
-      buckets[key % newSize] = temp;
+   U32 shardBuckets = 1;
+   while(shardBuckets * ShardCount < newSize)
+      shardBuckets <<= 1;
+
+   for(U32 i = 0; i < ShardCount; i++) {
+      Shard& shard = mShards[i];
+
+      MutexHandle mutex;
+      mutex.lock(&shard.mutex, true);
+
+      if(shardBuckets > shard.table->mask + 1)
+         beginResize(shard, shardBuckets);
    }
 }
-
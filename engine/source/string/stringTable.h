@@ -72,6 +72,13 @@
 ///  The scripting engine and the resource manager are the primary users of the
 ///  StringTable.
 ///
+/// The StringTable is safe to use from any thread.  Strings are spread over a number
+/// of shards, each with its own lock and memory pool, so threads only contend when
+/// inserting new strings into the same shard.  Lookups (and inserts of strings that are
+/// already present) do not lock at all as entries are never moved or removed once added.
+/// A shard grows incrementally; a few buckets are moved to the larger table on each
+/// insert rather than rehashing every string at once.
+///
 /// @note Be aware that the StringTable NEVER DEALLOCATES memory, so be careful when you
 ///       add strings to it. If you carelessly add many strings, you will end up wasting
 ///       space.
@@ -81,19 +88,58 @@ private:
    /// @name Implementation details
    /// @{
 
+   enum
+   {
+      ShardBits = 4,
+      ShardCount = 1 << ShardBits,
+      ShardShift = 32 - ShardBits,
+      MigrateBucketsPerInsert = 2
+   };
+
+   /// Stored immediately before each string in the table.
+   struct EntryHeader
+   {
+      U32 hash;
+      U32 length;
+   };
+
    /// This is internal to the _StringTable class.
    struct Node
    {
       char *val;
-      Node *next;
+      U32 hash;
+      Node * volatile next;
    };
 
-   Node**      buckets;
-   U32         numBuckets;
-   U32         itemCount;
-   DataChunker mempool;
+   /// A bucket array.  Whilst a shard is growing, the new table refers to the
+   /// previous table until all of its buckets have been moved across.
+   struct Table
+   {
+      U32               mask;
+      Table * volatile  previous;
+      Table *           nextRetired;
+      Node * volatile * buckets;
+      volatile bool *   migrated;
+   };
 
-   Mutex mMutex;
+   struct Shard
+   {
+      Table * volatile  table;
+      Table *           retired;
+      U32               migrateIndex;
+      U32               itemCount;
+      DataChunker       mempool;
+      Mutex             mutex;
+   };
+
+   Shard mShards[ShardCount];
+
+   static Table* createTable(const U32 numBuckets);
+   static Node* findNode(const Table* table, const U32 hash, const char* val, const S32 len, const bool caseSens);
+   static void appendNode(Node * volatile * walk, Node* node);
+   static void migrateBucket(Shard& shard, const U32 index);
+   static void migrateBuckets(Shard& shard, U32 count);
+   static void beginResize(Shard& shard, const U32 numBuckets);
 
   protected:
    static const U32 csm_stInitSize;
@@ -145,16 +191,27 @@ private:
    StringTableEntry lookupn(const char *string, S32 len, bool caseSens = false);
 
 
-   /// Resize the StringTable to be able to hold newSize items. This
-   /// is called automatically by the StringTable when the table is
-   /// full past a certain threshhold.
+   /// Resize the StringTable to have at least newSize buckets. This
+   /// is called automatically for each shard of the StringTable when
+   /// it is full past a certain threshhold.
    ///
-   /// @param newSize   Number of new items to allocate space for.
+   /// @param newSize   Number of buckets to allocate space for.
    void             resize(const U32 newSize);
 
    /// Hash a string into a U32.
    static U32 hashString(const char* in_pString);
 
+   /// Get the hash of a string in the table.  This is the same as hashString()
+   /// but is stored with the string so costs nothing to fetch.
+   ///
+   /// @param  entry    A string returned by the StringTable (not any other string).
+   static inline U32 getEntryHash(StringTableEntry entry) { return ((const EntryHeader*)entry - 1)->hash; }
+
+   /// Get the length in bytes of a string in the table without scanning it.
+   ///
+   /// @param  entry    A string returned by the StringTable (not any other string).
+   static inline U32 getEntryLength(StringTableEntry entry) { return ((const EntryHeader*)entry - 1)->length; }
+
    /// Hash a string of given length into a U32.
    static U32 hashStringn(const char* in_pString, S32 len);
 
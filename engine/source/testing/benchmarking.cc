@@ -0,0 +1,207 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want benchmarks in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _BENCHMARKING_H_
+#include "testing/benchmarking.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define BENCHMARK_MINIMUM_SAMPLE_TIME       50.0
+#define BENCHMARK_MAXIMUM_ITERATIONS        (1 << 30)
+#define BENCHMARK_SAMPLE_COUNT              5
+
+//-----------------------------------------------------------------------------
+
+Benchmark* Benchmark::smFirst = NULL;
+volatile U32 Benchmark::smSink = 0;
+
+//-----------------------------------------------------------------------------
+
+void BenchmarkState::pauseTiming( void )
+{
+    if ( !mTiming )
+        return;
+
+    mElapsedTime += mTimer.GetMilliseconds();
+    mTiming = false;
+}
+
+//-----------------------------------------------------------------------------
+
+void BenchmarkState::resumeTiming( void )
+{
+    if ( mTiming )
+        return;
+
+    mTiming = true;
+    mTimer.Reset();
+}
+
+//-----------------------------------------------------------------------------
+
+Benchmark::Benchmark( const char* pGroupName, const char* pName, BenchmarkFunction function ) :
+    mGroupName( pGroupName ),
+    mName( pName ),
+    mFunction( function )
+{
+    // Register the benchmark.
+    mNext = smFirst;
+    smFirst = this;
+}
+
+//-----------------------------------------------------------------------------
+
+S32 QSORT_CALLBACK Benchmark::compareBenchmarks( const void* a, const void* b )
+{
+    const Benchmark* pBenchmarkA = *(const Benchmark**)a;
+    const Benchmark* pBenchmarkB = *(const Benchmark**)b;
+
+    const S32 groupOrder = dStrcmp( pBenchmarkA->mGroupName, pBenchmarkB->mGroupName );
+    return groupOrder != 0 ? groupOrder : dStrcmp( pBenchmarkA->mName, pBenchmarkB->mName );
+}
+
+//-----------------------------------------------------------------------------
+
+static S32 QSORT_CALLBACK compareSamples( const void* a, const void* b )
+{
+    const F64 sampleA = *(const F64*)a;
+    const F64 sampleB = *(const F64*)b;
+    return sampleA < sampleB ? -1 : sampleA > sampleB ? 1 : 0;
+}
+
+//-----------------------------------------------------------------------------
+
+F64 Benchmark::runSample( const U32 iterations ) const
+{
+    BenchmarkState state( iterations );
+
+    state.resumeTiming();
+    mFunction( state );
+    state.pauseTiming();
+
+    return state.getElapsedTime();
+}
+
+//-----------------------------------------------------------------------------
+
+U32 Benchmark::runAll( const char* pFilter, const char* pOutputFile )
+{
+    // Gather the benchmarks that match the filter.
+    Vector<Benchmark*> benchmarks;
+    char nameBuffer[256];
+    for ( Benchmark* pBenchmark = smFirst; pBenchmark != NULL; pBenchmark = pBenchmark->mNext )
+    {
+        dSprintf( nameBuffer, sizeof(nameBuffer), "%s.%s", pBenchmark->mGroupName, pBenchmark->mName );
+        if ( pFilter == NULL || *pFilter == 0 || dStrstr( nameBuffer, pFilter ) != NULL )
+            benchmarks.push_back( pBenchmark );
+    }
+
+    // Sort the benchmarks so that the output order is stable.
+    dQsort( benchmarks.address(), benchmarks.size(), sizeof(Benchmark*), compareBenchmarks );
+
+    // Open the output file if requested.
+    FileStream outputStream;
+    bool outputOpen = false;
+    if ( pOutputFile != NULL && *pOutputFile != 0 )
+    {
+        char filePathBuffer[1024];
+        Con::expandPath( filePathBuffer, sizeof(filePathBuffer), pOutputFile );
+
+        const bool newFile = !Platform::isFile( filePathBuffer );
+        outputOpen = outputStream.open( filePathBuffer, FileStream::WriteAppend );
+
+        if ( !outputOpen )
+        {
+            Con::warnf( "Benchmark::runAll() - Could not open output file '%s'.", filePathBuffer );
+        }
+        else if ( newFile )
+        {
+            outputStream.writeLine( (U8*)"benchmark,iterations,medianNs,minimumNs,maximumNs" );
+        }
+    }
+
+    Con::printBlankLine();
+    Con::printSeparator();
+    Con::printf( "Benchmarks Starting..." );
+    Con::printBlankLine();
+
+    for ( S32 index = 0; index < benchmarks.size(); ++index )
+    {
+        const Benchmark* pBenchmark = benchmarks[index];
+        dSprintf( nameBuffer, sizeof(nameBuffer), "%s.%s", pBenchmark->mGroupName, pBenchmark->mName );
+
+        // Double the iterations until a sample is long enough to time reliably.
+        U32 iterations = 1;
+        while ( pBenchmark->runSample( iterations ) < BENCHMARK_MINIMUM_SAMPLE_TIME && iterations < BENCHMARK_MAXIMUM_ITERATIONS )
+            iterations *= 2;
+
+        // Sample the time per operation.
+        F64 samples[BENCHMARK_SAMPLE_COUNT];
+        for ( U32 sample = 0; sample < BENCHMARK_SAMPLE_COUNT; ++sample )
+            samples[sample] = pBenchmark->runSample( iterations ) * 1000000.0 / iterations;
+
+        dQsort( samples, BENCHMARK_SAMPLE_COUNT, sizeof(F64), compareSamples );
+
+        const F64 medianTime = samples[BENCHMARK_SAMPLE_COUNT / 2];
+        const F64 minimumTime = samples[0];
+        const F64 maximumTime = samples[BENCHMARK_SAMPLE_COUNT - 1];
+
+        Con::printf( "BENCH %-40s %10u iterations %14.1f ns/op (min %.1f, max %.1f)", nameBuffer, iterations, medianTime, minimumTime, maximumTime );
+
+        if ( outputOpen )
+        {
+            char lineBuffer[512];
+            dSprintf( lineBuffer, sizeof(lineBuffer), "%s,%u,%.1f,%.1f,%.1f", nameBuffer, iterations, medianTime, minimumTime, maximumTime );
+            outputStream.writeLine( (U8*)lineBuffer );
+        }
+    }
+
+    Con::printBlankLine();
+    Con::printf( "... Benchmarks Ended." );
+    Con::printSeparator();
+    Con::printBlankLine();
+
+    if ( outputOpen )
+        outputStream.close();
+
+    return benchmarks.size();
+}
+
+#include "benchmarking_ScriptBinding.h"
+
+#endif // TORQUE_SHIPPING
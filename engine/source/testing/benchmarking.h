@@ -0,0 +1,123 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _BENCHMARKING_H_
+#define _BENCHMARKING_H_
+
+#ifndef TORQUE_SHIPPING
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef B2_TIMER_H
+#include "Box2D/Common/b2Timer.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// The state handed to a benchmark when it runs.
+///
+/// A benchmark performs its operation getIterations() times.  Everything it does is timed
+/// unless it excludes set-up and tear-down by wrapping them with pauseTiming() and resumeTiming().
+class BenchmarkState
+{
+public:
+    BenchmarkState( const U32 iterations ) :
+        mIterations( iterations ),
+        mElapsedTime( 0.0 ),
+        mTiming( false )
+    {}
+
+    inline U32 getIterations( void ) const { return mIterations; }
+
+    void pauseTiming( void );
+    void resumeTiming( void );
+
+    /// Milliseconds timed so far.
+    inline F64 getElapsedTime( void ) const { return mElapsedTime; }
+
+private:
+    U32     mIterations;
+    F64     mElapsedTime;
+    bool    mTiming;
+    b2Timer mTimer;
+};
+
+//-----------------------------------------------------------------------------
+
+/// A registered microbenchmark.
+///
+/// Benchmarks are declared with the BENCHMARK macro and are run with "runAllBenchmarks()".
+/// Each one is run with a doubling iteration count until a sample takes long enough to time
+/// reliably, then sampled several times and the median, minimum and maximum time per operation
+/// are reported.  Benchmarks are run and reported in name order so the output of different
+/// builds can be compared line by line.
+class Benchmark
+{
+public:
+    typedef void (*BenchmarkFunction)( BenchmarkState& state );
+
+    Benchmark( const char* pGroupName, const char* pName, BenchmarkFunction function );
+
+    /// Run the benchmarks whose "group.name" contains the filter (all of them if the filter is empty).
+    /// The results are printed to the console and are also appended to the output file if one is specified.
+    /// @return The number of benchmarks run.
+    static U32 runAll( const char* pFilter, const char* pOutputFile );
+
+    /// Consume a result so that the work producing it cannot be optimized away.
+    static inline void consume( const U32 value ) { smSink = smSink + value; }
+
+private:
+    static S32 QSORT_CALLBACK compareBenchmarks( const void* a, const void* b );
+    F64 runSample( const U32 iterations ) const;
+
+    const char*         mGroupName;
+    const char*         mName;
+    BenchmarkFunction   mFunction;
+    Benchmark*          mNext;
+
+    static Benchmark*   smFirst;
+    static volatile U32 smSink;
+};
+
+//-----------------------------------------------------------------------------
+
+/// Declare and register a benchmark.
+///
+/// @code
+/// BENCHMARK( Vector, pushBack )
+/// {
+///     for ( U32 iteration = 0; iteration < state.getIterations(); ++iteration )
+///     {
+///         ...
+///     }
+/// }
+/// @endcode
+#define BENCHMARK( groupName, name ) \
+    static void benchmark_##groupName##_##name( BenchmarkState& state ); \
+    static Benchmark benchmarkRegistration_##groupName##_##name( #groupName, #name, benchmark_##groupName##_##name ); \
+    static void benchmark_##groupName##_##name( BenchmarkState& state )
+
+#endif // TORQUE_SHIPPING
+
+#endif // _BENCHMARKING_H_
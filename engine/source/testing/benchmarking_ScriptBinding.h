@@ -0,0 +1,45 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef TORQUE_SHIPPING
+
+/*! @defgroup Benchmarking Benchmarking
+	@ingroup TorqueScriptFunctions
+	@{
+*/
+
+/*! Runs the registered microbenchmarks and prints the time per operation of each to the console.
+    @param filter Only benchmarks whose "group.name" contains this text are run (optional, all are run if not specified).
+    @param outputFile A file the results are appended to as comma separated values (optional).
+    @return The number of benchmarks run.
+*/
+ConsoleFunctionWithDocs( runAllBenchmarks, S32, 1, 3, ([filter], [outputFile]) )
+{
+    const char* pFilter = argc > 1 ? argv[1] : NULL;
+    const char* pOutputFile = argc > 2 ? argv[2] : NULL;
+
+    return (S32)Benchmark::runAll( pFilter, pOutputFile );
+}
+
+/*! @} */ // end group Benchmarking
+
+#endif // TORQUE_SHIPPING
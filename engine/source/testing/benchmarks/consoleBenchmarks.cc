@@ -0,0 +1,198 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want benchmarks in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _BENCHMARKING_H_
+#include "testing/benchmarking.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _AST_H_
+#include "console/ast.h"
+#endif
+
+#ifndef _CONSOLE_EXPREVALSTATE_H_
+#include "console/consoleExprEvalState.h"
+#endif
+
+#ifndef _STRINGTABLE_H_
+#include "string/stringTable.h"
+#endif
+
+#ifndef _CONSOLE_NAMESPACE_H
+#include "console/consoleNamespace.h"
+#endif
+
+#ifndef _CONSOLEOBJECT_H_
+#include "console/consoleObject.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define CONSOLE_BENCHMARK_VARIABLE_COUNT    256
+#define CONSOLE_BENCHMARK_LOOP_COUNT        "100"
+
+//-----------------------------------------------------------------------------
+
+// Representative script functions, each looping over a typical kind of work.
+static const char* sBenchmarkScript =
+    "function benchmarkScriptArithmetic( %count )\n"
+    "{\n"
+    "    %total = 0;\n"
+    "    for ( %i = 0; %i < %count; %i++ )\n"
+    "        %total += %i * 2 - 1;\n"
+    "    return %total;\n"
+    "}\n"
+    "function benchmarkScriptStrings( %count )\n"
+    "{\n"
+    "    %text = \"\";\n"
+    "    for ( %i = 0; %i < %count; %i++ )\n"
+    "        %text = getSubStr( %text @ %i SPC \"\", 0, 64 );\n"
+    "    return strlen( %text );\n"
+    "}\n"
+    "function benchmarkScriptCallee( %value )\n"
+    "{\n"
+    "    return %value + 1;\n"
+    "}\n"
+    "function benchmarkScriptCalls( %count )\n"
+    "{\n"
+    "    %total = 0;\n"
+    "    for ( %i = 0; %i < %count; %i++ )\n"
+    "        %total = benchmarkScriptCallee( %total );\n"
+    "    return %total;\n"
+    "}\n"
+    "function benchmarkScriptGlobals( %count )\n"
+    "{\n"
+    "    $Benchmark::Total = 0;\n"
+    "    for ( %i = 0; %i < %count; %i++ )\n"
+    "        $Benchmark::Total = $Benchmark::Total + %i;\n"
+    "    return $Benchmark::Total;\n"
+    "}\n";
+
+//-----------------------------------------------------------------------------
+
+static void runScriptBenchmark( BenchmarkState& state, const char* pFunctionName )
+{
+    state.pauseTiming();
+    Con::evaluate( sBenchmarkScript, false, "benchmarks" );
+    state.resumeTiming();
+
+    for ( U32 iteration = 0; iteration < state.getIterations(); ++iteration )
+        Benchmark::consume( (U32)dAtoi( Con::executef( 2, pFunctionName, CONSOLE_BENCHMARK_LOOP_COUNT ) ) );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Dictionary, lookup )
+{
+    state.pauseTiming();
+    StringTableEntry names[CONSOLE_BENCHMARK_VARIABLE_COUNT];
+    char nameBuffer[64];
+    for ( U32 index = 0; index < CONSOLE_BENCHMARK_VARIABLE_COUNT; ++index )
+    {
+        dSprintf( nameBuffer, sizeof(nameBuffer), "$Benchmark::Variable%d", index );
+        names[index] = StringTable->insert( nameBuffer );
+        Con::setIntVariable( names[index], index );
+    }
+    state.resumeTiming();
+
+    for ( U32 iteration = 0; iteration < state.getIterations(); ++iteration )
+    {
+        for ( U32 index = 0; index < CONSOLE_BENCHMARK_VARIABLE_COUNT; ++index )
+        {
+            Dictionary::Entry* pEntry = gEvalState.globalVars.lookup( names[index] );
+            Benchmark::consume( pEntry != NULL ? (U32)pEntry->getIntValue() : 0 );
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Dictionary, getVariable )
+{
+    state.pauseTiming();
+    char names[CONSOLE_BENCHMARK_VARIABLE_COUNT][64];
+    for ( U32 index = 0; index < CONSOLE_BENCHMARK_VARIABLE_COUNT; ++index )
+    {
+        dSprintf( names[index], sizeof(names[index]), "$Benchmark::Variable%d", index );
+        Con::setIntVariable( names[index], index );
+    }
+    state.resumeTiming();
+
+    for ( U32 iteration = 0; iteration < state.getIterations(); ++iteration )
+    {
+        for ( U32 index = 0; index < CONSOLE_BENCHMARK_VARIABLE_COUNT; ++index )
+            Benchmark::consume( (U32)dStrlen( Con::getVariable( names[index] ) ) );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Namespace, find )
+{
+    state.pauseTiming();
+    Vector<StringTableEntry> classNames;
+    for ( AbstractClassRep* pClassRep = AbstractClassRep::getClassList(); pClassRep != NULL; pClassRep = pClassRep->getNextClass() )
+        classNames.push_back( StringTable->insert( pClassRep->getClassName() ) );
+    state.resumeTiming();
+
+    for ( U32 iteration = 0; iteration < state.getIterations(); ++iteration )
+    {
+        for ( S32 index = 0; index < classNames.size(); ++index )
+            Benchmark::consume( Namespace::find( classNames[index] )->mRefCountToParent );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( CodeBlock, execArithmetic )
+{
+    runScriptBenchmark( state, "benchmarkScriptArithmetic" );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( CodeBlock, execStrings )
+{
+    runScriptBenchmark( state, "benchmarkScriptStrings" );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( CodeBlock, execCalls )
+{
+    runScriptBenchmark( state, "benchmarkScriptCalls" );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( CodeBlock, execGlobals )
+{
+    runScriptBenchmark( state, "benchmarkScriptGlobals" );
+}
+
+#endif // TORQUE_SHIPPING
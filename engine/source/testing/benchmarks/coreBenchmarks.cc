@@ -0,0 +1,254 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want benchmarks in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _BENCHMARKING_H_
+#include "testing/benchmarking.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
+#ifndef _FLAT_HASH_MAP_H_
+#include "collection/flatHashMap.h"
+#endif
+
+#ifndef _STRINGTABLE_H_
+#include "string/stringTable.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define CORE_BENCHMARK_ELEMENT_COUNT    1024
+
+//-----------------------------------------------------------------------------
+
+// Fetch a well spread key for an index.
+static inline U32 getBenchmarkKey( const U32 index )
+{
+    return index * 2654435761u;
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Vector, pushBack )
+{
+    Vector<U32> elements;
+
+    for ( U32 iteration = 0; iteration < state.getIterations(); ++iteration )
+    {
+        elements.clear();
+
+        for ( U32 index = 0; index < CORE_BENCHMARK_ELEMENT_COUNT; ++index )
+            elements.push_back( index );
+
+        Benchmark::consume( elements.size() );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Vector, iterate )
+{
+    state.pauseTiming();
+    Vector<U32> elements;
+    for ( U32 index = 0; index < CORE_BENCHMARK_ELEMENT_COUNT; ++index )
+        elements.push_back( index );
+    state.resumeTiming();
+
+    for ( U32 iteration = 0; iteration < state.getIterations(); ++iteration )
+    {
+        U32 total = 0;
+        for ( Vector<U32>::iterator elementItr = elements.begin(); elementItr != elements.end(); ++elementItr )
+            total += *elementItr;
+
+        Benchmark::consume( total );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( Vector, eraseFast )
+{
+    Vector<U32> elements;
+
+    for ( U32 iteration = 0; iteration < state.getIterations(); ++iteration )
+    {
+        state.pauseTiming();
+        elements.setSize( CORE_BENCHMARK_ELEMENT_COUNT );
+        state.resumeTiming();
+
+        while ( elements.size() > 0 )
+            elements.erase_fast( (U32)elements.size() / 2 );
+
+        Benchmark::consume( elements.size() );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( HashTable, insertUnique )
+{
+    HashTable<U32, U32> table;
+
+    for ( U32 iteration = 0; iteration < state.getIterations(); ++iteration )
+    {
+        table.clear();
+
+        for ( U32 index = 0; index < CORE_BENCHMARK_ELEMENT_COUNT; ++index )
+            table.insertUnique( getBenchmarkKey( index ), index );
+
+        Benchmark::consume( table.size() );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( HashTable, find )
+{
+    state.pauseTiming();
+    HashTable<U32, U32> table;
+    for ( U32 index = 0; index < CORE_BENCHMARK_ELEMENT_COUNT; ++index )
+        table.insertUnique( getBenchmarkKey( index ), index );
+    state.resumeTiming();
+
+    for ( U32 iteration = 0; iteration < state.getIterations(); ++iteration )
+    {
+        U32 total = 0;
+        for ( U32 index = 0; index < CORE_BENCHMARK_ELEMENT_COUNT; ++index )
+            total += table.find( getBenchmarkKey( index ) )->value;
+
+        Benchmark::consume( total );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( FlatHashMap, insert )
+{
+    FlatHashMap<U32, U32> map;
+
+    for ( U32 iteration = 0; iteration < state.getIterations(); ++iteration )
+    {
+        map.clear();
+
+        for ( U32 index = 0; index < CORE_BENCHMARK_ELEMENT_COUNT; ++index )
+            map.insert( getBenchmarkKey( index ), index );
+
+        Benchmark::consume( map.size() );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( FlatHashMap, find )
+{
+    state.pauseTiming();
+    FlatHashMap<U32, U32> map;
+    for ( U32 index = 0; index < CORE_BENCHMARK_ELEMENT_COUNT; ++index )
+        map.insert( getBenchmarkKey( index ), index );
+    state.resumeTiming();
+
+    for ( U32 iteration = 0; iteration < state.getIterations(); ++iteration )
+    {
+        U32 total = 0;
+        for ( U32 index = 0; index < CORE_BENCHMARK_ELEMENT_COUNT; ++index )
+            total += map.find( getBenchmarkKey( index ) )->value;
+
+        Benchmark::consume( total );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( HashMap, findString )
+{
+    state.pauseTiming();
+    HashMap<StringTableEntry, U32> map;
+    StringTableEntry keys[CORE_BENCHMARK_ELEMENT_COUNT];
+    char keyBuffer[64];
+    for ( U32 index = 0; index < CORE_BENCHMARK_ELEMENT_COUNT; ++index )
+    {
+        dSprintf( keyBuffer, sizeof(keyBuffer), "BenchmarkKey%d", index );
+        keys[index] = StringTable->insert( keyBuffer );
+        map.insert( keys[index], index );
+    }
+    state.resumeTiming();
+
+    for ( U32 iteration = 0; iteration < state.getIterations(); ++iteration )
+    {
+        U32 total = 0;
+        for ( U32 index = 0; index < CORE_BENCHMARK_ELEMENT_COUNT; ++index )
+            total += map.find( keys[index] )->value;
+
+        Benchmark::consume( total );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( StringTable, insertExisting )
+{
+    state.pauseTiming();
+    char keys[CORE_BENCHMARK_ELEMENT_COUNT][32];
+    for ( U32 index = 0; index < CORE_BENCHMARK_ELEMENT_COUNT; ++index )
+    {
+        dSprintf( keys[index], sizeof(keys[index]), "BenchmarkString%d", index );
+        StringTable->insert( keys[index] );
+    }
+    state.resumeTiming();
+
+    for ( U32 iteration = 0; iteration < state.getIterations(); ++iteration )
+    {
+        for ( U32 index = 0; index < CORE_BENCHMARK_ELEMENT_COUNT; ++index )
+            Benchmark::consume( (U32)dStrlen( StringTable->insert( keys[index] ) ) );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( StringTable, insertCaseSensitive )
+{
+    state.pauseTiming();
+    char keys[CORE_BENCHMARK_ELEMENT_COUNT][32];
+    for ( U32 index = 0; index < CORE_BENCHMARK_ELEMENT_COUNT; ++index )
+    {
+        dSprintf( keys[index], sizeof(keys[index]), "BenchmarkCaseString%d", index );
+        StringTable->insert( keys[index], true );
+    }
+    state.resumeTiming();
+
+    for ( U32 iteration = 0; iteration < state.getIterations(); ++iteration )
+    {
+        for ( U32 index = 0; index < CORE_BENCHMARK_ELEMENT_COUNT; ++index )
+            Benchmark::consume( (U32)dStrlen( StringTable->insert( keys[index], true ) ) );
+    }
+}
+
+#endif // TORQUE_SHIPPING
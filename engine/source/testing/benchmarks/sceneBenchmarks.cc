@@ -0,0 +1,180 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want benchmarks in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _BENCHMARKING_H_
+#include "testing/benchmarking.h"
+#endif
+
+#ifndef _TICKABLE_H_
+#include "platform/Tickable.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+#ifndef _PARTICLE_PLAYER_H_
+#include "2d/sceneobject/ParticlePlayer.h"
+#endif
+
+#ifndef _PARTICLE_ASSET_H_
+#include "2d/assets/ParticleAsset.h"
+#endif
+
+#ifndef _PARTICLE_ASSET_EMITTER_H_
+#include "2d/assets/ParticleAssetEmitter.h"
+#endif
+
+#ifndef _ASSET_MANAGER_H_
+#include "assets/assetManager.h"
+#endif
+
+#ifndef BOX2D_H
+#include "Box2D/Box2D.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define SCENE_BENCHMARK_PYRAMID_ROWS            20
+#define SCENE_BENCHMARK_PARTICLE_QUANTITY       2000.0f
+#define SCENE_BENCHMARK_PARTICLE_LIFETIME       2.0f
+#define SCENE_BENCHMARK_PARTICLE_WARMUP_TICKS   128
+
+//-----------------------------------------------------------------------------
+
+// Create a world with a pyramid of boxes resting on the ground.
+static b2World* createBenchmarkWorld( void )
+{
+    b2World* pWorld = new b2World( b2Vec2( 0.0f, -10.0f ) );
+
+    // Keep the bodies awake so every step does the same work.
+    pWorld->SetAllowSleeping( false );
+
+    // Create the ground.
+    b2BodyDef groundBodyDef;
+    b2Body* pGroundBody = pWorld->CreateBody( &groundBodyDef );
+    b2EdgeShape groundShape;
+    groundShape.Set( b2Vec2( -40.0f, 0.0f ), b2Vec2( 40.0f, 0.0f ) );
+    pGroundBody->CreateFixture( &groundShape, 0.0f );
+
+    // Create the pyramid.
+    b2PolygonShape boxShape;
+    boxShape.SetAsBox( 0.5f, 0.5f );
+    b2Vec2 rowPosition( -7.0f, 0.75f );
+    for ( U32 row = 0; row < SCENE_BENCHMARK_PYRAMID_ROWS; ++row )
+    {
+        b2Vec2 boxPosition = rowPosition;
+        for ( U32 column = row; column < SCENE_BENCHMARK_PYRAMID_ROWS; ++column )
+        {
+            b2BodyDef boxBodyDef;
+            boxBodyDef.type = b2_dynamicBody;
+            boxBodyDef.position = boxPosition;
+            pWorld->CreateBody( &boxBodyDef )->CreateFixture( &boxShape, 5.0f );
+            boxPosition.x += 1.125f;
+        }
+        rowPosition += b2Vec2( 0.5625f, 1.0f );
+    }
+
+    return pWorld;
+}
+
+//-----------------------------------------------------------------------------
+
+// Integrate a particle player for a tick the same way the scene does.
+static void integrateBenchmarkParticles( ParticlePlayer* pParticlePlayer, Vector<ParticleSystem::EmitterIntegration>& emitterIntegrations, F32& totalTime, DebugStats* pDebugStats )
+{
+    totalTime += Tickable::smTickSec;
+    pParticlePlayer->integrateObject( totalTime, Tickable::smTickSec, pDebugStats );
+
+    emitterIntegrations.clear();
+    pParticlePlayer->gatherEmitterIntegrations( emitterIntegrations );
+    ParticlePlayer::integrateEmitterRange( emitterIntegrations.address(), 0, emitterIntegrations.size() );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( b2World, step )
+{
+    state.pauseTiming();
+    b2World* pWorld = createBenchmarkWorld();
+    state.resumeTiming();
+
+    for ( U32 iteration = 0; iteration < state.getIterations(); ++iteration )
+    {
+        pWorld->Step( Tickable::smTickSec, 8, 3 );
+        Benchmark::consume( pWorld->GetContactCount() );
+    }
+
+    state.pauseTiming();
+    delete pWorld;
+    state.resumeTiming();
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( ParticlePlayer, integrate )
+{
+    state.pauseTiming();
+
+    Scene* pScene = new Scene();
+    pScene->registerObject();
+
+    // Create a particle asset with a single busy emitter.
+    ParticleAsset* pParticleAsset = new ParticleAsset();
+    ParticleAssetEmitter* pParticleAssetEmitter = pParticleAsset->createEmitter();
+    pParticleAssetEmitter->getQuantityBaseField().setSingleDataKey( SCENE_BENCHMARK_PARTICLE_QUANTITY );
+    pParticleAssetEmitter->getParticleLifeBaseField().setSingleDataKey( SCENE_BENCHMARK_PARTICLE_LIFETIME );
+    pParticleAssetEmitter->getSpeedBaseField().setSingleDataKey( 5.0f );
+    pParticleAssetEmitter->getEmissionArcBaseField().setSingleDataKey( 360.0f );
+    const StringTableEntry particleAssetId = AssetDatabase.addPrivateAsset( pParticleAsset );
+
+    // Create the particle player.
+    ParticlePlayer* pParticlePlayer = new ParticlePlayer();
+    pParticlePlayer->registerObject();
+    pScene->addToScene( pParticlePlayer );
+    pParticlePlayer->setParticle( particleAssetId );
+    pParticlePlayer->play( true );
+
+    // Let the particle count reach its steady state.
+    Vector<ParticleSystem::EmitterIntegration> emitterIntegrations;
+    F32 totalTime = 0.0f;
+    for ( U32 tick = 0; tick < SCENE_BENCHMARK_PARTICLE_WARMUP_TICKS; ++tick )
+        integrateBenchmarkParticles( pParticlePlayer, emitterIntegrations, totalTime, &pScene->getDebugStats() );
+
+    state.resumeTiming();
+
+    for ( U32 iteration = 0; iteration < state.getIterations(); ++iteration )
+    {
+        integrateBenchmarkParticles( pParticlePlayer, emitterIntegrations, totalTime, &pScene->getDebugStats() );
+        Benchmark::consume( emitterIntegrations.size() );
+    }
+
+    state.pauseTiming();
+    pParticlePlayer->deleteObject();
+    pScene->deleteObject();
+    state.resumeTiming();
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,252 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want benchmarks in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _BENCHMARKING_H_
+#include "testing/benchmarking.h"
+#endif
+
+#ifndef _BITSTREAM_H_
+#include "io/bitStream.h"
+#endif
+
+#ifndef _TAML_H_
+#include "persistence/taml/taml.h"
+#endif
+
+#ifndef _SIMSET_H_
+#include "sim/simSet.h"
+#endif
+
+#ifndef _SCRIPT_OBJECT_H_
+#include "sim/scriptObject.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define STREAM_BENCHMARK_BUFFER_SIZE        4096
+#define STREAM_BENCHMARK_RECORD_COUNT       64
+#define STREAM_BENCHMARK_FLOAT_COUNT        1024
+#define STREAM_BENCHMARK_FLOAT_BITS         10
+#define STREAM_BENCHMARK_TAML_OBJECT_COUNT  256
+#define STREAM_BENCHMARK_TAML_FILE          "_benchmarkTaml_RemoveMe.baml"
+
+//-----------------------------------------------------------------------------
+
+// Pack a record of the kind of state a network update typically carries.
+static void packBenchmarkRecord( BitStream& stream, const U32 index )
+{
+    if ( stream.writeFlag( (index & 1) == 0 ) )
+    {
+        stream.writeInt( index, 16 );
+        stream.writeRangedU32( index % 100, 0, 99 );
+    }
+    stream.writeFloat( (index % 256) / 255.0f, 8 );
+    stream.writeCompressedPoint( Point3F( (F32)index, (F32)index * 0.5f, 0.0f ) );
+}
+
+//-----------------------------------------------------------------------------
+
+// Unpack a record written by packBenchmarkRecord().
+static U32 unpackBenchmarkRecord( BitStream& stream )
+{
+    U32 total = 0;
+    if ( stream.readFlag() )
+    {
+        total += stream.readInt( 16 );
+        total += stream.readRangedU32( 0, 99 );
+    }
+    total += (U32)( stream.readFloat( 8 ) * 255.0f );
+
+    Point3F point;
+    stream.readCompressedPoint( &point );
+    return total + (U32)point.x;
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( BitStream, pack )
+{
+    U8 buffer[STREAM_BENCHMARK_BUFFER_SIZE];
+    BitStream stream( buffer, sizeof(buffer) );
+    stream.clearCompressionPoint();
+
+    for ( U32 iteration = 0; iteration < state.getIterations(); ++iteration )
+    {
+        stream.setPosition( 0 );
+
+        for ( U32 index = 0; index < STREAM_BENCHMARK_RECORD_COUNT; ++index )
+            packBenchmarkRecord( stream, index );
+
+        Benchmark::consume( stream.getPosition() );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( BitStream, unpack )
+{
+    state.pauseTiming();
+    U8 buffer[STREAM_BENCHMARK_BUFFER_SIZE];
+    BitStream stream( buffer, sizeof(buffer) );
+    stream.clearCompressionPoint();
+    for ( U32 index = 0; index < STREAM_BENCHMARK_RECORD_COUNT; ++index )
+        packBenchmarkRecord( stream, index );
+    state.resumeTiming();
+
+    for ( U32 iteration = 0; iteration < state.getIterations(); ++iteration )
+    {
+        stream.setPosition( 0 );
+
+        U32 total = 0;
+        for ( U32 index = 0; index < STREAM_BENCHMARK_RECORD_COUNT; ++index )
+            total += unpackBenchmarkRecord( stream );
+
+        Benchmark::consume( total );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+// Fill values with floats spread over 0 to 1.
+static void fillBenchmarkFloats( F32* pValues )
+{
+    for ( U32 index = 0; index < STREAM_BENCHMARK_FLOAT_COUNT; ++index )
+        pValues[index] = (index % 1000) / 999.0f;
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( BitStream, writeFloat )
+{
+    state.pauseTiming();
+    U8 buffer[STREAM_BENCHMARK_BUFFER_SIZE * 2];
+    BitStream stream( buffer, sizeof(buffer) );
+    F32 values[STREAM_BENCHMARK_FLOAT_COUNT];
+    fillBenchmarkFloats( values );
+    state.resumeTiming();
+
+    for ( U32 iteration = 0; iteration < state.getIterations(); ++iteration )
+    {
+        stream.setPosition( 0 );
+
+        for ( U32 index = 0; index < STREAM_BENCHMARK_FLOAT_COUNT; ++index )
+            stream.writeFloat( values[index], STREAM_BENCHMARK_FLOAT_BITS );
+
+        Benchmark::consume( stream.getPosition() );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( BitStream, writeFloats )
+{
+    state.pauseTiming();
+    U8 buffer[STREAM_BENCHMARK_BUFFER_SIZE * 2];
+    BitStream stream( buffer, sizeof(buffer) );
+    F32 values[STREAM_BENCHMARK_FLOAT_COUNT];
+    fillBenchmarkFloats( values );
+    state.resumeTiming();
+
+    for ( U32 iteration = 0; iteration < state.getIterations(); ++iteration )
+    {
+        stream.setPosition( 0 );
+        stream.writeFloats( values, STREAM_BENCHMARK_FLOAT_COUNT, STREAM_BENCHMARK_FLOAT_BITS );
+        Benchmark::consume( stream.getPosition() );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( BitStream, readFloats )
+{
+    state.pauseTiming();
+    U8 buffer[STREAM_BENCHMARK_BUFFER_SIZE * 2];
+    BitStream stream( buffer, sizeof(buffer) );
+    F32 values[STREAM_BENCHMARK_FLOAT_COUNT];
+    fillBenchmarkFloats( values );
+    stream.writeFloats( values, STREAM_BENCHMARK_FLOAT_COUNT, STREAM_BENCHMARK_FLOAT_BITS );
+    state.resumeTiming();
+
+    for ( U32 iteration = 0; iteration < state.getIterations(); ++iteration )
+    {
+        stream.setPosition( 0 );
+        stream.readFloats( values, STREAM_BENCHMARK_FLOAT_COUNT, STREAM_BENCHMARK_FLOAT_BITS );
+        Benchmark::consume( (U32)( values[STREAM_BENCHMARK_FLOAT_COUNT - 1] * 999.0f ) );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK( TamlBinaryReader, read )
+{
+    state.pauseTiming();
+
+    Taml taml;
+    taml.setAutoFormat( false );
+    taml.setFormatMode( Taml::BinaryFormat );
+
+    // Write a group of objects, each with a few fields.
+    SimGroup* pGroup = new SimGroup();
+    pGroup->registerObject();
+    char valueBuffer[64];
+    for ( U32 index = 0; index < STREAM_BENCHMARK_TAML_OBJECT_COUNT; ++index )
+    {
+        ScriptObject* pObject = new ScriptObject();
+        pObject->registerObject();
+
+        dSprintf( valueBuffer, sizeof(valueBuffer), "%d", index );
+        pObject->setDataField( StringTable->insert( "Index" ), NULL, valueBuffer );
+        dSprintf( valueBuffer, sizeof(valueBuffer), "%d %d", index, index * 2 );
+        pObject->setDataField( StringTable->insert( "Position" ), NULL, valueBuffer );
+        pObject->setDataField( StringTable->insert( "Label" ), NULL, "BenchmarkObject" );
+
+        pGroup->addObject( pObject );
+    }
+
+    const bool written = taml.write( pGroup, STREAM_BENCHMARK_TAML_FILE );
+    pGroup->deleteObject();
+
+    state.resumeTiming();
+
+    if ( written )
+    {
+        for ( U32 iteration = 0; iteration < state.getIterations(); ++iteration )
+        {
+            SimObject* pSimObject = taml.read( STREAM_BENCHMARK_TAML_FILE );
+            if ( pSimObject == NULL )
+                break;
+
+            state.pauseTiming();
+            pSimObject->deleteObject();
+            state.resumeTiming();
+        }
+    }
+
+    state.pauseTiming();
+    Platform::fileDelete( taml.getFilePathBuffer() );
+    state.resumeTiming();
+}
+
+#endif // TORQUE_SHIPPING
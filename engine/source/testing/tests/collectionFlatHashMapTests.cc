@@ -0,0 +1,130 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _FLAT_HASH_MAP_H_
+#include "collection/flatHashMap.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define FLAT_HASH_MAP_TEST_KEY_COUNT    5000
+
+//-----------------------------------------------------------------------------
+
+// Fetch a key that lands in the same few home slots as many other keys.
+static inline U32 getCollidingKey( const U32 index )
+{
+    return index << 16;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( CollectionFlatHashMapTests, insertFindTest )
+{
+    FlatHashMap<U32, U32> map;
+
+    for ( U32 index = 0; index < FLAT_HASH_MAP_TEST_KEY_COUNT; ++index )
+    {
+        FlatHashMap<U32, U32>::iterator itr = map.insert( getCollidingKey( index ), index );
+        ASSERT_TRUE( itr != map.end() );
+        ASSERT_EQ( getCollidingKey( index ), itr->key );
+    }
+    ASSERT_EQ( (U32)FLAT_HASH_MAP_TEST_KEY_COUNT, map.size() );
+
+    // Duplicate keys are not inserted.
+    ASSERT_TRUE( map.insert( getCollidingKey( 7 ), 0 ) == map.end() );
+    ASSERT_EQ( (U32)FLAT_HASH_MAP_TEST_KEY_COUNT, map.size() );
+
+    for ( U32 index = 0; index < FLAT_HASH_MAP_TEST_KEY_COUNT; ++index )
+    {
+        FlatHashMap<U32, U32>::iterator itr = map.find( getCollidingKey( index ) );
+        ASSERT_TRUE( itr != map.end() );
+        ASSERT_EQ( index, itr->value );
+    }
+    ASSERT_TRUE( map.find( 1 ) == map.end() );
+
+    // Every entry is visited once by iteration.
+    U32 total = 0;
+    U32 count = 0;
+    for ( FlatHashMap<U32, U32>::iterator itr = map.begin(); itr != map.end(); ++itr )
+    {
+        total += itr->value;
+        count++;
+    }
+    ASSERT_EQ( (U32)FLAT_HASH_MAP_TEST_KEY_COUNT, count );
+    ASSERT_EQ( (U32)(FLAT_HASH_MAP_TEST_KEY_COUNT * (FLAT_HASH_MAP_TEST_KEY_COUNT - 1) / 2), total );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( CollectionFlatHashMapTests, eraseTest )
+{
+    FlatHashMap<U32, U32> map;
+    for ( U32 index = 0; index < FLAT_HASH_MAP_TEST_KEY_COUNT; ++index )
+        map[getCollidingKey( index )] = index;
+
+    // Erase the odd keys by key and check the even keys are still found after the entries shift back.
+    for ( U32 index = 1; index < FLAT_HASH_MAP_TEST_KEY_COUNT; index += 2 )
+        map.erase( getCollidingKey( index ) );
+    ASSERT_EQ( (U32)(FLAT_HASH_MAP_TEST_KEY_COUNT / 2), map.size() );
+
+    for ( U32 index = 0; index < FLAT_HASH_MAP_TEST_KEY_COUNT; ++index )
+        ASSERT_EQ( (index & 1) == 0, map.contains( getCollidingKey( index ) ) ) << "Key index " << index;
+
+    // Erase the rest by iterator.
+    while ( !map.isEmpty() )
+        map.erase( map.begin() );
+    ASSERT_TRUE( map.begin() == map.end() );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( CollectionFlatHashMapTests, clearCopyTest )
+{
+    FlatHashMap<U32, U32> map;
+    for ( U32 index = 0; index < FLAT_HASH_MAP_TEST_KEY_COUNT; ++index )
+        map.insert( index, index * 3 );
+
+    FlatHashMap<U32, U32> copy( map );
+    const U32 tableSize = map.tableSize();
+
+    // Clearing keeps the table.
+    map.clear();
+    ASSERT_TRUE( map.isEmpty() );
+    ASSERT_EQ( tableSize, map.tableSize() );
+    ASSERT_TRUE( map.find( 10 ) == map.end() );
+
+    ASSERT_EQ( (U32)FLAT_HASH_MAP_TEST_KEY_COUNT, copy.size() );
+    for ( U32 index = 0; index < FLAT_HASH_MAP_TEST_KEY_COUNT; ++index )
+        ASSERT_EQ( index * 3, copy[index] );
+    ASSERT_EQ( (U32)FLAT_HASH_MAP_TEST_KEY_COUNT, copy.size() );
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,100 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _NAMETAGS_H_
+#include "collection/nameTags.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define NAMETAGS_TEST_OBJECT_COUNT      200
+
+//-----------------------------------------------------------------------------
+
+TEST( CollectionNameTagsTests, tagIndexTest )
+{
+    NameTags* pNameTags = new NameTags();
+    ASSERT_TRUE( pNameTags->registerObject() );
+    const NameTags::TagId redTag = pNameTags->createTag( "red" );
+    const NameTags::TagId blueTag = pNameTags->createTag( "blue" );
+
+    // Tag every other object red and every third object blue.
+    Vector<SimObject*> objects;
+    for ( U32 index = 0; index < NAMETAGS_TEST_OBJECT_COUNT; ++index )
+    {
+        SimObject* pObject = new SimObject();
+        pObject->registerObject();
+        pNameTags->addObject( pObject );
+        if ( index % 2 == 0 )
+            ASSERT_TRUE( pNameTags->tag( pObject->getId(), redTag ) );
+        if ( index % 3 == 0 )
+            ASSERT_TRUE( pNameTags->tag( pObject->getId(), blueTag ) );
+        objects.push_back( pObject );
+    }
+    ASSERT_EQ( (U32)NAMETAGS_TEST_OBJECT_COUNT / 2, pNameTags->getTaggedObjects( redTag )->size() );
+    ASSERT_EQ( (U32)(NAMETAGS_TEST_OBJECT_COUNT + 2) / 3, pNameTags->getTaggedObjects( blueTag )->size() );
+
+    // A query includes objects with any of the tags and excludes the rest.
+    char tags[32];
+    dSprintf( tags, sizeof(tags), "%d %d", redTag, blueTag );
+    pNameTags->queryTags( tags, true );
+    U32 expectedCount = 0;
+    for ( U32 index = 0; index < NAMETAGS_TEST_OBJECT_COUNT; ++index )
+    {
+        if ( index % 2 == 0 || index % 3 == 0 )
+            expectedCount++;
+    }
+    ASSERT_EQ( expectedCount, pNameTags->mIncludedQueryMap.size() );
+    ASSERT_EQ( NAMETAGS_TEST_OBJECT_COUNT - expectedCount, pNameTags->mExcludedQueryMap.size() );
+
+    // Untagging, removing and deleting objects keeps the index up to date.
+    ASSERT_TRUE( pNameTags->untag( objects[0]->getId(), redTag ) );
+    pNameTags->removeObject( objects[2] );
+    objects[4]->deleteObject();
+    ASSERT_EQ( (U32)NAMETAGS_TEST_OBJECT_COUNT / 2 - 3, pNameTags->getTaggedObjects( redTag )->size() );
+    ASSERT_TRUE( pNameTags->hasTag( objects[2]->getId(), redTag ) );
+
+    // Adding a tagged object back indexes its tags.
+    pNameTags->addObject( objects[2] );
+    ASSERT_EQ( (U32)NAMETAGS_TEST_OBJECT_COUNT / 2 - 2, pNameTags->getTaggedObjects( redTag )->size() );
+
+    // Deleting a tag drops its index.
+    pNameTags->deleteTag( blueTag );
+    ASSERT_TRUE( pNameTags->getTaggedObjects( blueTag ) == NULL );
+    ASSERT_EQ( (U32)0, pNameTags->getTagId( "blue" ) );
+
+    for ( S32 index = 0; index < objects.size(); ++index )
+    {
+        if ( index != 4 )
+            objects[index]->deleteObject();
+    }
+    pNameTags->deleteObject();
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,179 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _UNDO_H_
+#include "collection/undo.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define UNDO_TEST_OBJECT_COUNT      500
+
+//-----------------------------------------------------------------------------
+
+// Create objects with a dynamic field set to a value.
+static void createUndoTestObjects( Vector<SimObject*>& objects, StringTableEntry fieldName, const char* pValue )
+{
+    for ( U32 index = 0; index < UNDO_TEST_OBJECT_COUNT; ++index )
+    {
+        SimObject* pObject = new SimObject();
+        pObject->registerObject();
+        pObject->setDataField( fieldName, NULL, pValue );
+        objects.push_back( pObject );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+// Change a dynamic field of every object within a delta action.
+static void changeUndoTestObjects( UndoManager& undoManager, const char* pActionName, Vector<SimObject*>& objects, StringTableEntry fieldName, const char* pValue )
+{
+    undoManager.beginDeltaAction( pActionName );
+    for ( S32 index = 0; index < objects.size(); ++index )
+    {
+        undoManager.recordField( objects[index], fieldName );
+        objects[index]->setDataField( fieldName, NULL, pValue );
+    }
+    undoManager.endDeltaAction();
+}
+
+//-----------------------------------------------------------------------------
+
+static void deleteUndoTestObjects( Vector<SimObject*>& objects )
+{
+    for ( S32 index = 0; index < objects.size(); ++index )
+        objects[index]->deleteObject();
+    objects.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( CollectionUndoTests, deltaUndoRedoTest )
+{
+    UndoManager* pUndoManager = new UndoManager();
+    ASSERT_TRUE( pUndoManager->registerObject() );
+    UndoManager& undoManager = *pUndoManager;
+    StringTableEntry fieldName = StringTable->insert( "undoTestField" );
+    Vector<SimObject*> objects;
+    createUndoTestObjects( objects, fieldName, "before" );
+
+    // The whole edit is a single action.
+    changeUndoTestObjects( undoManager, "Edit", objects, fieldName, "after" );
+    ASSERT_EQ( 1, undoManager.getUndoCount() );
+
+    undoManager.undo();
+    for ( S32 index = 0; index < objects.size(); ++index )
+        ASSERT_STREQ( "before", objects[index]->getDataField( fieldName, NULL ) );
+
+    undoManager.redo();
+    for ( S32 index = 0; index < objects.size(); ++index )
+        ASSERT_STREQ( "after", objects[index]->getDataField( fieldName, NULL ) );
+
+    // Deleted objects are skipped.
+    objects[0]->deleteObject();
+    objects.erase( 0U );
+    undoManager.undo();
+    for ( S32 index = 0; index < objects.size(); ++index )
+        ASSERT_STREQ( "before", objects[index]->getDataField( fieldName, NULL ) );
+
+    deleteUndoTestObjects( objects );
+    pUndoManager->deleteObject();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( CollectionUndoTests, deltaCoalesceTest )
+{
+    UndoManager* pUndoManager = new UndoManager();
+    ASSERT_TRUE( pUndoManager->registerObject() );
+    UndoManager& undoManager = *pUndoManager;
+    StringTableEntry fieldName = StringTable->insert( "undoTestField" );
+    Vector<SimObject*> objects;
+    createUndoTestObjects( objects, fieldName, "0" );
+
+    // Consecutive edits of the same name and fields are coalesced.
+    changeUndoTestObjects( undoManager, "Move", objects, fieldName, "1" );
+    changeUndoTestObjects( undoManager, "Move", objects, fieldName, "2" );
+    changeUndoTestObjects( undoManager, "Move", objects, fieldName, "3" );
+    ASSERT_EQ( 1, undoManager.getUndoCount() );
+
+    // A differently named edit is not.
+    changeUndoTestObjects( undoManager, "Rotate", objects, fieldName, "4" );
+    ASSERT_EQ( 2, undoManager.getUndoCount() );
+
+    undoManager.undo();
+    undoManager.undo();
+    for ( S32 index = 0; index < objects.size(); ++index )
+        ASSERT_STREQ( "0", objects[index]->getDataField( fieldName, NULL ) );
+
+    // Unchanged fields are dropped so an edit changing nothing adds nothing.
+    undoManager.clearAll();
+    changeUndoTestObjects( undoManager, "Nothing", objects, fieldName, "0" );
+    ASSERT_EQ( 0, undoManager.getUndoCount() );
+
+    deleteUndoTestObjects( objects );
+    pUndoManager->deleteObject();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( CollectionUndoTests, memoryBudgetTest )
+{
+    UndoManager* pUndoManager = new UndoManager();
+    ASSERT_TRUE( pUndoManager->registerObject() );
+    UndoManager& undoManager = *pUndoManager;
+    StringTableEntry fieldName = StringTable->insert( "undoTestField" );
+    Vector<SimObject*> objects;
+    createUndoTestObjects( objects, fieldName, "0" );
+
+    // Set a budget of roughly three edits.
+    changeUndoTestObjects( undoManager, "Edit0", objects, fieldName, "1" );
+    const U32 editSize = undoManager.getMemoryUsage();
+    ASSERT_GT( editSize, 0u );
+    undoManager.mMemoryBudget = editSize * 3 + editSize / 2;
+
+    // The oldest edits are dropped to stay within the budget.
+    char actionName[32];
+    char value[32];
+    for ( U32 edit = 1; edit < 10; ++edit )
+    {
+        dSprintf( actionName, sizeof(actionName), "Edit%d", edit );
+        dSprintf( value, sizeof(value), "%d", edit + 1 );
+        changeUndoTestObjects( undoManager, actionName, objects, fieldName, value );
+    }
+    ASSERT_EQ( 3, undoManager.getUndoCount() );
+    ASSERT_LE( undoManager.getMemoryUsage(), undoManager.mMemoryBudget );
+    ASSERT_STREQ( "Edit9", undoManager.getNextUndoName() );
+
+    deleteUndoTestObjects( objects );
+    pUndoManager->deleteObject();
+}
+
+#endif // TORQUE_SHIPPING
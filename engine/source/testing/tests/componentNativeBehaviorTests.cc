@@ -0,0 +1,162 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _NATIVE_BEHAVIORTEMPLATE_H_
+#include "component/behaviors/nativeBehaviorTemplate.h"
+#endif
+
+#ifndef _BEHAVIOR_COMPONENT_H_
+#include "component/behaviors/behaviorComponent.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define NATIVE_BEHAVIOR_TEST_INSTANCE_COUNT     64
+
+//-----------------------------------------------------------------------------
+
+// A native behavior counting its updates and inputs per instance.
+class NativeBehaviorTestTemplate : public NativeBehaviorTemplate
+{
+public:
+    NativeBehaviorTestTemplate() : mInputCount( 0 )
+    {
+        addBehaviorOutput( "fired", "Fired", "Raised by the test." );
+        addBehaviorInput( "trigger", "Trigger", "Counted by the test." );
+    }
+
+    void tick( void ) { processTick(); }
+
+    Vector<U32> mUpdateCounts;
+    Vector<SimObjectId> mInstanceIds;
+    U32 mInputCount;
+
+    virtual bool onBehaviorInput( BehaviorInstance* pInputBehavior, StringTableEntry pInputName, BehaviorInstance* pOutputBehavior, StringTableEntry pOutputName )
+    {
+        mInputCount++;
+        return true;
+    }
+
+protected:
+    virtual void updateInstances( BehaviorInstance** pInstances, const U32 instanceCount, const F32 elapsedTime )
+    {
+        for ( U32 index = 0; index < instanceCount; ++index )
+        {
+            // The state must follow its instance.
+            if ( mInstanceIds[index] == pInstances[index]->getId() )
+                mUpdateCounts[index]++;
+        }
+    }
+
+    virtual void onInstanceAdded( const U32 index )
+    {
+        mUpdateCounts.push_back( 0 );
+        mInstanceIds.push_back( getInstance( index )->getId() );
+    }
+
+    virtual void onInstanceRemoved( const U32 index )
+    {
+        mUpdateCounts.erase_fast( index );
+        mInstanceIds.erase_fast( index );
+    }
+};
+
+//-----------------------------------------------------------------------------
+
+TEST( ComponentNativeBehaviorTests, updateInstancesTest )
+{
+    NativeBehaviorTestTemplate* pTemplate = new NativeBehaviorTestTemplate();
+    ASSERT_TRUE( pTemplate->registerObject( "NativeBehaviorTestUpdate" ) );
+
+    Vector<BehaviorInstance*> instances;
+    for ( U32 index = 0; index < NATIVE_BEHAVIOR_TEST_INSTANCE_COUNT; ++index )
+        instances.push_back( pTemplate->createInstance() );
+    ASSERT_EQ( (U32)NATIVE_BEHAVIOR_TEST_INSTANCE_COUNT, pTemplate->getInstanceCount() );
+
+    // Every instance is updated by a tick.
+    pTemplate->tick();
+    for ( U32 index = 0; index < NATIVE_BEHAVIOR_TEST_INSTANCE_COUNT; ++index )
+        ASSERT_EQ( 1u, pTemplate->mUpdateCounts[index] );
+
+    // Remove every third instance and check the state still follows the remaining instances.
+    for ( U32 index = 0; index < NATIVE_BEHAVIOR_TEST_INSTANCE_COUNT; index += 3 )
+    {
+        instances[index]->deleteObject();
+        instances[index] = NULL;
+    }
+    ASSERT_EQ( (U32)(NATIVE_BEHAVIOR_TEST_INSTANCE_COUNT - (NATIVE_BEHAVIOR_TEST_INSTANCE_COUNT + 2) / 3), pTemplate->getInstanceCount() );
+
+    pTemplate->tick();
+    for ( U32 index = 0; index < pTemplate->getInstanceCount(); ++index )
+    {
+        ASSERT_EQ( (S32)index, pTemplate->getInstance( index )->getTemplateIndex() );
+        ASSERT_EQ( pTemplate->getInstance( index )->getId(), pTemplate->mInstanceIds[index] );
+        ASSERT_EQ( 2u, pTemplate->mUpdateCounts[index] );
+    }
+
+    // Instances can outlive their template.
+    pTemplate->deleteObject();
+    for ( U32 index = 0; index < NATIVE_BEHAVIOR_TEST_INSTANCE_COUNT; ++index )
+    {
+        if ( instances[index] == NULL )
+            continue;
+
+        ASSERT_EQ( -1, instances[index]->getTemplateIndex() );
+        instances[index]->deleteObject();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ComponentNativeBehaviorTests, behaviorInputTest )
+{
+    NativeBehaviorTestTemplate* pTemplate = new NativeBehaviorTestTemplate();
+    ASSERT_TRUE( pTemplate->registerObject( "NativeBehaviorTestInput" ) );
+
+    BehaviorComponent* pComponent = new BehaviorComponent();
+    ASSERT_TRUE( pComponent->registerObject() );
+
+    BehaviorInstance* pOutputBehavior = pTemplate->createInstance();
+    BehaviorInstance* pInputBehavior = pTemplate->createInstance();
+    ASSERT_TRUE( pComponent->addBehavior( pOutputBehavior ) );
+    ASSERT_TRUE( pComponent->addBehavior( pInputBehavior ) );
+
+    // Raising a connected output is handled by the native input.
+    StringTableEntry outputName = StringTable->insert( "fired" );
+    StringTableEntry inputName = StringTable->insert( "trigger" );
+    ASSERT_TRUE( pComponent->connect( pOutputBehavior, pInputBehavior, outputName, inputName ) );
+    ASSERT_TRUE( pComponent->raise( pOutputBehavior, outputName ) );
+    ASSERT_EQ( 1u, pTemplate->mInputCount );
+
+    pComponent->deleteObject();
+    pTemplate->deleteObject();
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,161 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _BITSTREAM_H_
+#include "io/bitStream.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define BITSTREAM_TEST_BUFFER_SIZE  4096
+#define BITSTREAM_TEST_VALUE_COUNT  300
+
+//-----------------------------------------------------------------------------
+
+TEST( IoBitStreamTests, writeBitsTest )
+{
+    U8 source[64];
+    for ( U32 index = 0; index < sizeof(source); ++index )
+        source[index] = (U8)( index * 37 + 11 );
+
+    // Write and read back every bit count at every bit alignment.
+    for ( S32 offset = 0; offset < 8; ++offset )
+    {
+        for ( S32 bitCount = 1; bitCount <= 200; ++bitCount )
+        {
+            U8 buffer[BITSTREAM_TEST_BUFFER_SIZE];
+            dMemset( buffer, 0xA5, sizeof(buffer) );
+            BitStream stream( buffer, sizeof(buffer) );
+
+            stream.setCurPos( offset );
+            stream.writeBits( bitCount, source );
+            stream.writeFlag( true );
+            ASSERT_EQ( offset + bitCount + 1, stream.getCurPos() );
+
+            // The bits either side of those written must be untouched.
+            for ( S32 bit = 0; bit < offset; ++bit )
+                ASSERT_EQ( ((0xA5 >> (bit & 0x7)) & 1) != 0, stream.testBit( bit ) );
+
+            U8 result[64];
+            stream.setCurPos( offset );
+            stream.readBits( bitCount, result );
+            ASSERT_TRUE( stream.readFlag() );
+
+            for ( S32 bit = 0; bit < bitCount; ++bit )
+                ASSERT_EQ( (source[bit >> 3] >> (bit & 0x7)) & 1, (result[bit >> 3] >> (bit & 0x7)) & 1 ) << "Bit " << bit << " of " << bitCount << " at offset " << offset;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( IoBitStreamTests, writeIntsTest )
+{
+    U32 values[BITSTREAM_TEST_VALUE_COUNT];
+    for ( U32 index = 0; index < BITSTREAM_TEST_VALUE_COUNT; ++index )
+        values[index] = index * 2654435761u;
+
+    for ( S32 bitCount = 1; bitCount <= 32; ++bitCount )
+    {
+        U8 batchBuffer[BITSTREAM_TEST_BUFFER_SIZE];
+        U8 singleBuffer[BITSTREAM_TEST_BUFFER_SIZE];
+        dMemset( batchBuffer, 0, sizeof(batchBuffer) );
+        dMemset( singleBuffer, 0, sizeof(singleBuffer) );
+        BitStream batchStream( batchBuffer, sizeof(batchBuffer) );
+        BitStream singleStream( singleBuffer, sizeof(singleBuffer) );
+
+        // The batched write must produce the same bits as writing each value.
+        batchStream.writeFlag( true );
+        singleStream.writeFlag( true );
+        batchStream.writeInts( values, BITSTREAM_TEST_VALUE_COUNT, bitCount );
+        for ( U32 index = 0; index < BITSTREAM_TEST_VALUE_COUNT; ++index )
+            singleStream.writeInt( values[index], bitCount );
+
+        ASSERT_EQ( singleStream.getCurPos(), batchStream.getCurPos() );
+        ASSERT_EQ( 0, dMemcmp( batchBuffer, singleBuffer, sizeof(batchBuffer) ) ) << "Bit count " << bitCount;
+
+        // The batched read must return the same values as reading each value.
+        U32 results[BITSTREAM_TEST_VALUE_COUNT];
+        batchStream.setCurPos( 1 );
+        batchStream.readInts( results, BITSTREAM_TEST_VALUE_COUNT, bitCount );
+        ASSERT_EQ( singleStream.getCurPos(), batchStream.getCurPos() );
+
+        singleStream.setCurPos( 1 );
+        for ( U32 index = 0; index < BITSTREAM_TEST_VALUE_COUNT; ++index )
+            ASSERT_EQ( (U32)singleStream.readInt( bitCount ), results[index] );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( IoBitStreamTests, writeFloatsTest )
+{
+    F32 values[BITSTREAM_TEST_VALUE_COUNT];
+    for ( U32 index = 0; index < BITSTREAM_TEST_VALUE_COUNT; ++index )
+        values[index] = ( index % 101 ) / 100.0f;
+
+    U8 batchBuffer[BITSTREAM_TEST_BUFFER_SIZE];
+    U8 singleBuffer[BITSTREAM_TEST_BUFFER_SIZE];
+    dMemset( batchBuffer, 0, sizeof(batchBuffer) );
+    dMemset( singleBuffer, 0, sizeof(singleBuffer) );
+    BitStream batchStream( batchBuffer, sizeof(batchBuffer) );
+    BitStream singleStream( singleBuffer, sizeof(singleBuffer) );
+
+    batchStream.writeFloats( values, BITSTREAM_TEST_VALUE_COUNT, 9 );
+    batchStream.writeSignedFloats( values, BITSTREAM_TEST_VALUE_COUNT, 7 );
+    batchStream.writeRangedF32s( values, BITSTREAM_TEST_VALUE_COUNT, 0.25f, 0.75f, 11 );
+    for ( U32 index = 0; index < BITSTREAM_TEST_VALUE_COUNT; ++index )
+        singleStream.writeFloat( values[index], 9 );
+    for ( U32 index = 0; index < BITSTREAM_TEST_VALUE_COUNT; ++index )
+        singleStream.writeSignedFloat( values[index], 7 );
+    for ( U32 index = 0; index < BITSTREAM_TEST_VALUE_COUNT; ++index )
+        singleStream.writeRangedF32( values[index], 0.25f, 0.75f, 11 );
+
+    ASSERT_EQ( singleStream.getCurPos(), batchStream.getCurPos() );
+    ASSERT_EQ( 0, dMemcmp( batchBuffer, singleBuffer, sizeof(batchBuffer) ) );
+
+    F32 floats[BITSTREAM_TEST_VALUE_COUNT];
+    F32 signedFloats[BITSTREAM_TEST_VALUE_COUNT];
+    F32 rangedFloats[BITSTREAM_TEST_VALUE_COUNT];
+    batchStream.setCurPos( 0 );
+    batchStream.readFloats( floats, BITSTREAM_TEST_VALUE_COUNT, 9 );
+    batchStream.readSignedFloats( signedFloats, BITSTREAM_TEST_VALUE_COUNT, 7 );
+    batchStream.readRangedF32s( rangedFloats, BITSTREAM_TEST_VALUE_COUNT, 0.25f, 0.75f, 11 );
+
+    singleStream.setCurPos( 0 );
+    for ( U32 index = 0; index < BITSTREAM_TEST_VALUE_COUNT; ++index )
+        ASSERT_EQ( singleStream.readFloat( 9 ), floats[index] );
+    for ( U32 index = 0; index < BITSTREAM_TEST_VALUE_COUNT; ++index )
+        ASSERT_EQ( singleStream.readSignedFloat( 7 ), signedFloats[index] );
+    for ( U32 index = 0; index < BITSTREAM_TEST_VALUE_COUNT; ++index )
+        ASSERT_EQ( singleStream.readRangedF32( 0.25f, 0.75f, 11 ), rangedFloats[index] );
+}
+
+#endif // TORQUE_SHIPPING
@@ -35,6 +35,14 @@
 #include "platform/platformFileIO.h"
 #endif
 
+#ifndef _ASYNC_FILE_IO_H_
+#include "io/asyncFileIO.h"
+#endif
+
+#ifndef _STREAM_H_
+#include "io/stream.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 #define PLATFORM_UNITTEST_FILEIO_FILE           "_unitTestFile_RemoveMe.txt"
@@ -122,4 +130,55 @@ TEST( PlatformFileIOTests, FileWriteRead )
 }
 //-----------------------------------------------------------------------------
 
+static void asyncFileReadCallback( void* pContext, const U32 requestId, Stream* pStream )
+{
+    char* pReadBuffer = static_cast<char*>(pContext);
+
+    // Read the whole stream.
+    if ( pStream != NULL )
+    {
+        const U32 streamSize = pStream->getStreamSize();
+        pStream->read( streamSize, pReadBuffer );
+        pReadBuffer[streamSize] = 0;
+        delete pStream;
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST( PlatformFileIOTests, AsyncFileRead )
+{
+    File testWriteFile;
+
+    // Write the test file.
+    const U32 fileMessageLength = dStrlen(PLATFORM_UNITTEST_FILEIO_FILEMESSAGE);
+    U32 bytesWritten;
+    ASSERT_EQ( testWriteFile.open( PLATFORM_UNITTEST_FILEIO_FILE, File::Write ), File::Ok ) << "Failed to open file for (over)write.";
+    ASSERT_EQ( testWriteFile.write( fileMessageLength, PLATFORM_UNITTEST_FILEIO_FILEMESSAGE, &bytesWritten ), File::Ok ) << "Test message write operation failed.";
+    testWriteFile.close();
+
+    // Read the file asynchronously.
+    char readBuffer[256] = { 0 };
+    const U32 requestId = AsyncFileIO::read( PLATFORM_UNITTEST_FILEIO_FILE, AsyncFileIO::PriorityHigh, asyncFileReadCallback, readBuffer );
+    ASSERT_NE( requestId, 0 ) << "Read request was not queued.";
+
+    // Wait for the read to be delivered.
+    ASSERT_TRUE( AsyncFileIO::finish( requestId ) ) << "Read request was not found.";
+    ASSERT_EQ( AsyncFileIO::getStatus( requestId ), AsyncFileIO::StatusUnknown ) << "Read request was not delivered.";
+
+    // Check contents.
+    ASSERT_STREQ( PLATFORM_UNITTEST_FILEIO_FILEMESSAGE, readBuffer ) << "Test message read incorrectly.";
+
+    // A cancelled read is never delivered.
+    readBuffer[0] = 0;
+    const U32 cancelledRequestId = AsyncFileIO::read( PLATFORM_UNITTEST_FILEIO_FILE, AsyncFileIO::PriorityLow, asyncFileReadCallback, readBuffer );
+    ASSERT_TRUE( AsyncFileIO::cancel( cancelledRequestId ) ) << "Read request was not found.";
+    AsyncFileIO::finish( cancelledRequestId );
+    AsyncFileIO::processCompletions();
+    ASSERT_EQ( readBuffer[0], 0 ) << "Cancelled read request was delivered.";
+
+    // Check the file has been deleted.
+    ASSERT_TRUE( Platform::fileDelete( PLATFORM_UNITTEST_FILEIO_FILE ) );
+}
+//-----------------------------------------------------------------------------
+
 #endif // TORQUE_SHIPPING
@@ -0,0 +1,191 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_JOBSYSTEM_H_
+#include "platform/threads/jobSystem.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_ATOMIC_H_
+#include "platform/threads/atomic.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define PLATFORM_UNITTEST_JOBSYSTEM_ITEMCOUNT      10000
+#define PLATFORM_UNITTEST_JOBSYSTEM_CHILDCOUNT     64
+
+//-----------------------------------------------------------------------------
+
+static void jobSystemTestRangeFunction( void* pContext, const U32 start, const U32 end )
+{
+    U32* pItems = static_cast<U32*>( pContext );
+
+    for ( U32 index = start; index < end; ++index )
+    {
+        pItems[index] += index;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static void jobSystemTestCountFunction( Job* pJob, void* pContext )
+{
+    dAtomicIncrement( static_cast<volatile S32*>( pContext ) );
+}
+
+//-----------------------------------------------------------------------------
+
+// The context of a job that spawns children.
+struct JobSystemTestParent
+{
+    JobSystem*      mpJobSystem;
+    Job*            mpChildren;
+    volatile S32    mCount;
+};
+
+static void jobSystemTestParentFunction( Job* pJob, void* pContext )
+{
+    JobSystemTestParent* pParent = static_cast<JobSystemTestParent*>( pContext );
+
+    // Create and run the children.
+    for ( U32 index = 0; index < PLATFORM_UNITTEST_JOBSYSTEM_CHILDCOUNT; ++index )
+    {
+        new ( pParent->mpChildren + index ) Job( jobSystemTestCountFunction, (void*)&pParent->mCount, pJob );
+        pParent->mpJobSystem->run( pParent->mpChildren + index );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( PlatformJobSystemTests, parallelForTest )
+{
+    // Create a job system.
+    JobSystem jobSystem( 3 );
+
+    // Check workers.
+    ASSERT_EQ( (U32)3, jobSystem.getWorkerCount() ) << "Incorrect worker count.";
+
+    // Clear the items.
+    U32* pItems = new U32[PLATFORM_UNITTEST_JOBSYSTEM_ITEMCOUNT];
+    dMemset( pItems, 0, sizeof(U32) * PLATFORM_UNITTEST_JOBSYSTEM_ITEMCOUNT );
+
+    // Process the items several times.
+    for ( U32 pass = 0; pass < 4; ++pass )
+    {
+        jobSystem.parallelFor( jobSystemTestRangeFunction, pItems, PLATFORM_UNITTEST_JOBSYSTEM_ITEMCOUNT, 64 );
+    }
+
+    // Check each item was processed exactly once per pass.
+    for ( U32 index = 0; index < PLATFORM_UNITTEST_JOBSYSTEM_ITEMCOUNT; ++index )
+    {
+        ASSERT_EQ( index * 4, pItems[index] ) << "Item processed incorrectly.";
+    }
+
+    delete [] pItems;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( PlatformJobSystemTests, dependencyTest )
+{
+    // Create a job system.
+    JobSystem jobSystem( 3 );
+
+    // Create a parent that spawns children.
+    JobSystemTestParent parent;
+    parent.mpJobSystem = &jobSystem;
+    parent.mpChildren = (Job*)dMalloc( sizeof(Job) * PLATFORM_UNITTEST_JOBSYSTEM_CHILDCOUNT );
+    parent.mCount = 0;
+    Job parentJob( jobSystemTestParentFunction, &parent );
+
+    // Run the parent and wait on it.
+    jobSystem.run( &parentJob );
+    jobSystem.wait( &parentJob );
+
+    // Check the parent wasn't finished until all of its children were.
+    ASSERT_TRUE( parentJob.isFinished() ) << "Parent job not finished.";
+    ASSERT_EQ( PLATFORM_UNITTEST_JOBSYSTEM_CHILDCOUNT, parent.mCount ) << "Parent job finished before its children.";
+
+    dFree( parent.mpChildren );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( PlatformJobSystemTests, mainThreadTest )
+{
+    // Create a job system.
+    JobSystem jobSystem( 2 );
+
+    // Run a main thread job.
+    volatile S32 count = 0;
+    Job job( jobSystemTestCountFunction, (void*)&count, NULL, true );
+    jobSystem.run( &job );
+
+    // Check it waits for the main thread.
+    ASSERT_FALSE( job.isFinished() ) << "Main thread job run by a worker.";
+
+    // Run it on the main thread.
+    jobSystem.processMainThreadJobs();
+    ASSERT_TRUE( job.isFinished() ) << "Main thread job not run.";
+    ASSERT_EQ( 1, count ) << "Main thread job run incorrectly.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( PlatformJobSystemTests, noWorkersTest )
+{
+    // Create a job system without workers.
+    JobSystem jobSystem( 0 );
+
+    // Clear the items.
+    U32 items[256];
+    dMemset( items, 0, sizeof(items) );
+
+    // Process the items on the calling thread.
+    jobSystem.parallelFor( jobSystemTestRangeFunction, items, 256, 16 );
+
+    // Check each item was processed.
+    for ( U32 index = 0; index < 256; ++index )
+    {
+        ASSERT_EQ( index, items[index] ) << "Item processed incorrectly.";
+    }
+
+    // Check jobs run immediately.
+    volatile S32 count = 0;
+    Job job( jobSystemTestCountFunction, (void*)&count );
+    jobSystem.run( &job );
+    ASSERT_TRUE( job.isFinished() ) << "Job not run immediately.";
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,287 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_LOCKFREE_H_
+#include "platform/threads/lockFree.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define PLATFORM_UNITTEST_LOCKFREE_VALUECOUNT      100000
+#define PLATFORM_UNITTEST_LOCKFREE_PRODUCERCOUNT   4
+#define PLATFORM_UNITTEST_LOCKFREE_NODECOUNT       10000
+
+//-----------------------------------------------------------------------------
+
+typedef SPSCQueue<U32, 64> LockFreeTestRing;
+
+static void lockFreeTestRingProducer( void* pContext )
+{
+    LockFreeTestRing* pRing = static_cast<LockFreeTestRing*>( pContext );
+
+    for ( U32 value = 0; value < PLATFORM_UNITTEST_LOCKFREE_VALUECOUNT; ++value )
+    {
+        while ( !pRing->push( value ) )
+            Platform::sleep( 0 );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+struct LockFreeTestNode : public MPSCQueueNode
+{
+    U32 mProducer;
+    U32 mValue;
+};
+
+// The context of a thread that pushes nodes.
+struct LockFreeTestProducer
+{
+    MPSCQueue<LockFreeTestNode>*    mpQueue;
+    LockFreeTestNode*               mpNodes;
+    U32                             mProducer;
+};
+
+static void lockFreeTestQueueProducer( void* pContext )
+{
+    LockFreeTestProducer* pProducer = static_cast<LockFreeTestProducer*>( pContext );
+
+    for ( U32 index = 0; index < PLATFORM_UNITTEST_LOCKFREE_NODECOUNT; ++index )
+    {
+        LockFreeTestNode* pNode = pProducer->mpNodes + index;
+        pNode->mProducer = pProducer->mProducer;
+        pNode->mValue = index;
+        pProducer->mpQueue->push( pNode );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+// A value whose fields are always written together.
+struct LockFreeTestPair
+{
+    U32 mFirst;
+    U32 mSecond;
+};
+
+// The context of a thread that writes pairs.
+struct LockFreeTestWriter
+{
+    SeqLock<LockFreeTestPair>*  mpSeqLock;
+    volatile S32                mStop;
+};
+
+static void lockFreeTestSeqLockWriter( void* pContext )
+{
+    LockFreeTestWriter* pWriter = static_cast<LockFreeTestWriter*>( pContext );
+
+    LockFreeTestPair pair;
+    for ( U32 value = 1; pWriter->mStop == 0; ++value )
+    {
+        pair.mFirst = value;
+        pair.mSecond = value * 2;
+        pWriter->mpSeqLock->write( pair );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( PlatformLockFreeTests, atomicTest )
+{
+    AtomicS32 value( 5 );
+
+    // Check arithmetic.
+    ASSERT_EQ( 6, value.increment() ) << "Incorrect increment.";
+    ASSERT_EQ( 5, value.decrement() ) << "Incorrect decrement.";
+    ASSERT_EQ( 15, value.add( 10 ) ) << "Incorrect add.";
+
+    // Check swaps.
+    ASSERT_EQ( 15, value.compareAndSwap( 15, 20 ) ) << "Incorrect compare and swap.";
+    ASSERT_EQ( 20, value.compareAndSwap( 15, 30 ) ) << "Compare and swap should have failed.";
+    ASSERT_EQ( 20, value.exchange( 40 ) ) << "Incorrect exchange.";
+    ASSERT_EQ( 40, value.load() ) << "Incorrect load.";
+
+    // Check pointers.
+    S32 first = 0;
+    S32 second = 0;
+    AtomicPointer<S32> pointer( &first );
+    ASSERT_EQ( &first, pointer.compareAndSwap( &first, &second ) ) << "Incorrect pointer compare and swap.";
+    ASSERT_EQ( &second, pointer.exchange( NULL ) ) << "Incorrect pointer exchange.";
+    ASSERT_TRUE( pointer.load() == NULL ) << "Incorrect pointer load.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( PlatformLockFreeTests, spinLockTest )
+{
+    SpinLock spinLock;
+
+    // Check the lock excludes.
+    ASSERT_TRUE( spinLock.tryLock() ) << "Free lock could not be taken.";
+    ASSERT_FALSE( spinLock.tryLock() ) << "Held lock was taken.";
+    spinLock.unlock();
+
+    {
+        SpinLockHandle handle( &spinLock );
+        ASSERT_FALSE( spinLock.tryLock() ) << "Handle did not take the lock.";
+    }
+    ASSERT_TRUE( spinLock.tryLock() ) << "Handle did not release the lock.";
+    spinLock.unlock();
+
+    // Check readers share and writers exclude.
+    ReadWriteLock readWriteLock;
+    readWriteLock.lockRead();
+    readWriteLock.lockRead();
+    readWriteLock.unlockRead();
+    readWriteLock.unlockRead();
+    readWriteLock.lockWrite();
+    readWriteLock.unlockWrite();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( PlatformLockFreeTests, spscQueueTest )
+{
+    LockFreeTestRing ring;
+
+    // Check it is bounded.
+    for ( U32 index = 0; index < ring.capacity(); ++index )
+    {
+        ASSERT_TRUE( ring.push( index ) ) << "Push failed before the ring was full.";
+    }
+    ASSERT_FALSE( ring.push( 0 ) ) << "Push succeeded on a full ring.";
+
+    U32 value;
+    for ( U32 index = 0; index < ring.capacity(); ++index )
+    {
+        ASSERT_TRUE( ring.pop( value ) ) << "Pop failed before the ring was empty.";
+        ASSERT_EQ( index, value ) << "Ring popped out of order.";
+    }
+    ASSERT_FALSE( ring.pop( value ) ) << "Pop succeeded on an empty ring.";
+
+    // Stream values from another thread.
+    Thread producer( lockFreeTestRingProducer, &ring );
+
+    for ( U32 expected = 0; expected < PLATFORM_UNITTEST_LOCKFREE_VALUECOUNT; )
+    {
+        if ( !ring.pop( value ) )
+            continue;
+
+        ASSERT_EQ( expected, value ) << "Value lost or reordered.";
+        ++expected;
+    }
+
+    producer.join();
+    ASSERT_TRUE( ring.isEmpty() ) << "Ring not empty.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( PlatformLockFreeTests, mpscQueueTest )
+{
+    MPSCQueue<LockFreeTestNode> queue;
+    ASSERT_TRUE( queue.pop() == NULL ) << "Pop succeeded on an empty queue.";
+
+    // Push nodes from several threads.
+    LockFreeTestNode* pNodes = new LockFreeTestNode[PLATFORM_UNITTEST_LOCKFREE_PRODUCERCOUNT * PLATFORM_UNITTEST_LOCKFREE_NODECOUNT];
+    LockFreeTestProducer producers[PLATFORM_UNITTEST_LOCKFREE_PRODUCERCOUNT];
+    Thread* pThreads[PLATFORM_UNITTEST_LOCKFREE_PRODUCERCOUNT];
+    for ( U32 producer = 0; producer < PLATFORM_UNITTEST_LOCKFREE_PRODUCERCOUNT; ++producer )
+    {
+        producers[producer].mpQueue = &queue;
+        producers[producer].mpNodes = pNodes + producer * PLATFORM_UNITTEST_LOCKFREE_NODECOUNT;
+        producers[producer].mProducer = producer;
+        pThreads[producer] = new Thread( lockFreeTestQueueProducer, producers + producer );
+    }
+
+    // Pop them all, checking each producer's nodes arrive in the order they were pushed.
+    U32 nextValues[PLATFORM_UNITTEST_LOCKFREE_PRODUCERCOUNT];
+    dMemset( nextValues, 0, sizeof(nextValues) );
+    for ( U32 count = 0; count < PLATFORM_UNITTEST_LOCKFREE_PRODUCERCOUNT * PLATFORM_UNITTEST_LOCKFREE_NODECOUNT; )
+    {
+        LockFreeTestNode* pNode = queue.pop();
+        if ( pNode == NULL )
+            continue;
+
+        ASSERT_EQ( nextValues[pNode->mProducer], pNode->mValue ) << "Node lost or reordered.";
+        ++nextValues[pNode->mProducer];
+        ++count;
+    }
+
+    for ( U32 producer = 0; producer < PLATFORM_UNITTEST_LOCKFREE_PRODUCERCOUNT; ++producer )
+    {
+        pThreads[producer]->join();
+        delete pThreads[producer];
+    }
+
+    ASSERT_TRUE( queue.isEmpty() ) << "Queue not empty.";
+    ASSERT_TRUE( queue.pop() == NULL ) << "Pop succeeded on an empty queue.";
+
+    delete [] pNodes;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( PlatformLockFreeTests, seqLockTest )
+{
+    LockFreeTestPair pair;
+    pair.mFirst = 0;
+    pair.mSecond = 0;
+    SeqLock<LockFreeTestPair> seqLock( pair );
+
+    // Write from another thread.
+    LockFreeTestWriter writer;
+    writer.mpSeqLock = &seqLock;
+    writer.mStop = 0;
+    Thread writerThread( lockFreeTestSeqLockWriter, &writer );
+
+    // Check a torn pair is never read.
+    for ( U32 read = 0; read < PLATFORM_UNITTEST_LOCKFREE_VALUECOUNT; ++read )
+    {
+        pair = seqLock.read();
+        ASSERT_EQ( pair.mFirst * 2, pair.mSecond ) << "Torn value read.";
+    }
+
+    writer.mStop = 1;
+    writerThread.join();
+
+    ASSERT_EQ( (U32)0, seqLock.getSequence() & 1 ) << "Write left in progress.";
+}
+
+#endif // TORQUE_SHIPPING
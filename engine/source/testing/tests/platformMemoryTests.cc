@@ -31,6 +31,18 @@
 #include "platform/platform.h"
 #endif
 
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#ifndef _FRAMEALLOCATOR_H_
+#include "memory/frameAllocator.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 #define PLATFORM_UNITTEST_MEMORY_BUFFERSIZE     16384
@@ -165,4 +177,346 @@ TEST( PlatformMemoryTests, dMemcmpTest )
     ASSERT_GT( 0, result3 ) << "Memory compare is incorrect.";
 }
 
+//-----------------------------------------------------------------------------
+
+TEST( PlatformMemoryTests, MemoryTagTest )
+{
+    // Fetch the initial stats.
+    Memory::TagStats initialStats;
+    Memory::getTagStats( Memory::TagAudio, initialStats );
+
+    void* pResult;
+    {
+        // Allocate some memory with a tag.
+        Memory::TagScope memoryTag( Memory::TagAudio );
+        pResult = dMalloc_r( PLATFORM_UNITTEST_MEMORY_BUFFERSIZE, __FILE__, __LINE__ );
+
+        // Check.
+        ASSERT_EQ( Memory::TagAudio, Memory::getCurrentTag() ) << "Memory tag not set.";
+    }
+
+    // Check.
+    ASSERT_NE( Memory::TagAudio, Memory::getCurrentTag() ) << "Memory tag not restored.";
+
+    // Check.
+    Memory::TagStats stats;
+    Memory::getTagStats( Memory::TagAudio, stats );
+    ASSERT_EQ( initialStats.liveBytes + PLATFORM_UNITTEST_MEMORY_BUFFERSIZE, stats.liveBytes ) << "Live bytes are incorrect.";
+    ASSERT_EQ( initialStats.totalAllocations + 1, stats.totalAllocations ) << "Total allocations are incorrect.";
+
+    // Free memory outside of the tag.
+    dFree( pResult );
+
+    // Check.
+    Memory::getTagStats( Memory::TagAudio, stats );
+    ASSERT_EQ( initialStats.liveBytes, stats.liveBytes ) << "Live bytes are incorrect.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( PlatformMemoryTests, MemoryBackendTest )
+{
+    const Memory::Backend* pInitialBackend = Memory::getBackend();
+
+    // Allocate memory from the system backend.
+    ASSERT_TRUE( Memory::setBackend( &Memory::SystemBackend ) ) << "Backend not set.";
+    U8* pSystem = (U8*)dMalloc_r( 100, __FILE__, __LINE__ );
+    dMemset( pSystem, 1, 100 );
+
+    // Allocate memory from the thread caching backend.
+    ASSERT_TRUE( Memory::setBackend( &Memory::ThreadCachingBackend ) ) << "Backend not set.";
+    ASSERT_EQ( &Memory::ThreadCachingBackend, Memory::getBackend() ) << "Backend incorrect.";
+    U8* pCached = (U8*)dMalloc_r( 100, __FILE__, __LINE__ );
+    dMemset( pCached, 2, 100 );
+
+    // Reallocate the system memory, which moves it to the current backend.
+    pSystem = (U8*)dRealloc_r( pSystem, 200, __FILE__, __LINE__ );
+
+    // Check.
+    for( U32 index = 0; index < 100; ++index )
+    {
+        ASSERT_EQ( 1, pSystem[index] ) << "Reallocated memory value is incorrect.";
+        ASSERT_EQ( 2, pCached[index] ) << "Cached memory value is incorrect.";
+    }
+
+    // Free memory with the original backend current.
+    Memory::setBackend( pInitialBackend );
+    dFree( pSystem );
+    dFree( pCached );
+
+    // Check.
+    ASSERT_EQ( &Memory::SystemBackend, Memory::findBackend( "system" ) ) << "Backend not found.";
+    ASSERT_EQ( &Memory::ThreadCachingBackend, Memory::findBackend( "threadCaching" ) ) << "Backend not found.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( PlatformMemoryTests, SmallBlockPoolTest )
+{
+    const bool initialPooling = Memory::getSmallBlockPooling();
+    Memory::setSmallBlockPooling( true );
+
+    // Allocate a small block.
+    U8* pBlock = (U8*)Memory::allocateSmall( 40 );
+    ASSERT_NE( (U8*)NULL, pBlock ) << "Small block not allocated.";
+    dMemset( pBlock, 5, 40 );
+
+    // Grow within the size class.
+    U8* pResized = (U8*)Memory::reallocateSmall( pBlock, 44 );
+    ASSERT_EQ( pBlock, pResized ) << "Small block not resized in place.";
+
+    // Grow beyond the pool.
+    pResized = (U8*)Memory::reallocateSmall( pResized, PLATFORM_UNITTEST_MEMORY_BUFFERSIZE );
+    ASSERT_NE( (U8*)NULL, pResized ) << "Small block not reallocated.";
+
+    // Check.
+    for( U32 index = 0; index < 40; ++index )
+    {
+        ASSERT_EQ( 5, pResized[index] ) << "Reallocated memory value is incorrect.";
+    }
+
+    dFree( pResized );
+
+    // Grow a vector through the pool.
+    Vector<U32> values;
+    for( U32 index = 0; index < 1000; ++index )
+        values.push_back( index );
+
+    // Check.
+    for( U32 index = 0; index < 1000; ++index )
+    {
+        ASSERT_EQ( index, values[index] ) << "Vector value is incorrect.";
+    }
+
+    Memory::setSmallBlockPooling( initialPooling );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( PlatformMemoryTests, ArenaTest )
+{
+    const U64 initialReservedBytes = Memory::getArenaReservedBytes();
+
+    Memory::Arena* pArena = new Memory::Arena();
+
+    // Allocate small and large blocks from the arena.
+    U8* pSmall;
+    U8* pLarge;
+    {
+        Memory::ArenaScope scope( pArena );
+        ASSERT_EQ( pArena, Memory::getCurrentArena() ) << "Arena not current.";
+
+        pSmall = (U8*)dMalloc( 100 );
+        pLarge = (U8*)dMalloc( PLATFORM_UNITTEST_MEMORY_BUFFERSIZE * 4 );
+        dMemset( pSmall, 1, 100 );
+        dMemset( pLarge, 2, PLATFORM_UNITTEST_MEMORY_BUFFERSIZE * 4 );
+    }
+
+    // Check.
+    ASSERT_EQ( (Memory::Arena*)NULL, Memory::getCurrentArena() ) << "Arena not restored.";
+    ASSERT_EQ( 2u, pArena->getAllocationCount() ) << "Arena allocation count is incorrect.";
+    ASSERT_GT( Memory::getArenaReservedBytes(), initialReservedBytes ) << "Arena reserved bytes are incorrect.";
+
+    // Release the arena whilst its blocks are live.
+    delete pArena;
+
+    // Check.
+    for( U32 index = 0; index < 100; ++index )
+    {
+        ASSERT_EQ( 1, pSmall[index] ) << "Arena memory value is incorrect.";
+    }
+
+    // Free the blocks, which frees the chunks.
+    dFree( pSmall );
+    dFree( pLarge );
+
+    // Check.
+    ASSERT_EQ( initialReservedBytes, Memory::getArenaReservedBytes() ) << "Arena chunks not freed.";
+}
+
+//-----------------------------------------------------------------------------
+
+struct FrameAllocatorThreadResult
+{
+    U8*     mpAllocation;
+    U32     mWaterMark;
+    U32     mPeakWaterMark;
+};
+
+static void frameAllocatorThreadFunction( void* pData )
+{
+    FrameAllocatorThreadResult* pResult = static_cast<FrameAllocatorThreadResult*>( pData );
+
+    // Allocate from this thread's arena.
+    {
+        FrameTemp<U8> buffer( 1000 );
+        dMemset( ~buffer, 3, 1000 );
+        pResult->mpAllocation = ~buffer;
+        pResult->mWaterMark = FrameAllocator::getWaterMark();
+        pResult->mPeakWaterMark = FrameAllocator::getPeakWaterMark();
+    }
+
+    FrameAllocator::releaseThreadArena();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( PlatformMemoryTests, FrameAllocatorThreadTest )
+{
+    FrameAllocatorMarker marker;
+    const U32 waterMark = FrameAllocator::getWaterMark();
+
+    // Allocate on this thread.
+    U8* pAllocation = (U8*)marker.alloc( 100 );
+    dMemset( pAllocation, 1, 100 );
+
+    // Allocate on another thread.
+    FrameAllocatorThreadResult result;
+    Thread thread( frameAllocatorThreadFunction, &result, true );
+    thread.join();
+
+    // Check.
+    ASSERT_NE( (U8*)NULL, result.mpAllocation ) << "Thread allocation failed.";
+    ASSERT_TRUE( result.mpAllocation + 1000 <= pAllocation || pAllocation + 100 <= result.mpAllocation ) << "Thread allocations overlap.";
+    ASSERT_GE( result.mWaterMark, 1000u ) << "Thread watermark is incorrect.";
+    ASSERT_GE( result.mPeakWaterMark, result.mWaterMark ) << "Thread peak watermark is incorrect.";
+    ASSERT_GE( FrameAllocator::getWaterMark(), waterMark + 100 ) << "Thread allocation changed this thread's watermark.";
+
+    for( U32 index = 0; index < 100; ++index )
+    {
+        ASSERT_EQ( 1, pAllocation[index] ) << "Allocation overwritten.";
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+struct MemoryPressureResult
+{
+    U32 mCallCount;
+    Memory::Pressure mPressure;
+};
+
+static void memoryPressureTestCallback( const Memory::Tag tag, const Memory::Pressure pressure, void* pUserData )
+{
+    if ( tag != Memory::TagGui )
+        return;
+
+    MemoryPressureResult* pResult = (MemoryPressureResult*)pUserData;
+    pResult->mCallCount++;
+    pResult->mPressure = pressure;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( PlatformMemoryTests, MemoryBudgetTest )
+{
+    MemoryPressureResult result = { 0, Memory::PressureNone };
+    const U32 callbackKey = Memory::registerPressureCallback( memoryPressureTestCallback, &result );
+
+    // Set budgets just above the live bytes.
+    Memory::TagStats stats;
+    Memory::getTagStats( Memory::TagGui, stats );
+    const U64 liveBytes = stats.liveBytes > 0 ? (U64)stats.liveBytes : 0;
+    Memory::setTagBudget( Memory::TagGui, liveBytes + 64 * 1024, liveBytes + 128 * 1024 );
+
+    // Exceed the soft budget.
+    void* pSoft;
+    {
+        Memory::TagScope tagScope( Memory::TagGui );
+        pSoft = dMalloc( 96 * 1024 );
+    }
+    Memory::checkBudgets();
+    ASSERT_EQ( 1u, result.mCallCount ) << "Soft pressure callback not raised.";
+    ASSERT_EQ( Memory::PressureSoft, result.mPressure ) << "Pressure should be soft.";
+    ASSERT_EQ( Memory::PressureSoft, Memory::getTagPressure( Memory::TagGui ) ) << "Tag pressure should be soft.";
+
+    // The callback is not raised again immediately.
+    Memory::checkBudgets();
+    ASSERT_EQ( 1u, result.mCallCount ) << "Pressure callback repeated too soon.";
+
+    // Exceed the hard budget.
+    void* pHard;
+    {
+        Memory::TagScope tagScope( Memory::TagGui );
+        pHard = dMalloc( 64 * 1024 );
+    }
+    Memory::checkBudgets();
+    ASSERT_EQ( 2u, result.mCallCount ) << "Hard pressure callback not raised.";
+    ASSERT_EQ( Memory::PressureHard, result.mPressure ) << "Pressure should be hard.";
+
+    // Release.
+    dFree( pHard );
+    dFree( pSoft );
+    Memory::checkBudgets();
+    ASSERT_EQ( 3u, result.mCallCount ) << "Pressure relief callback not raised.";
+    ASSERT_EQ( Memory::PressureNone, result.mPressure ) << "Pressure should be none.";
+
+    Memory::setTagBudget( Memory::TagGui, 0, 0 );
+    Memory::unregisterPressureCallback( callbackKey );
+}
+
+//-----------------------------------------------------------------------------
+
+#ifdef TORQUE_MEMORY_TRACKING
+
+static bool findCallsiteStats( const char* pFileName, const U32 line, Memory::CallsiteStats& stats )
+{
+    static Memory::CallsiteStats callsites[Memory::MaxCallsites];
+    const U32 count = Memory::getCallsiteStats( callsites, Memory::MaxCallsites );
+
+    for ( U32 index = 0; index < count; ++index )
+    {
+        if ( callsites[index].fileName == pFileName && callsites[index].line == line )
+        {
+            stats = callsites[index];
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( PlatformMemoryTests, CallsiteTrackingTest )
+{
+    static const char* pFileName = "callsiteTrackingTest";
+
+    Memory::takeCallsiteSnapshot();
+
+    // Allocate from a callsite.
+    void* pAllocations[10];
+    for ( U32 index = 0; index < 10; ++index )
+    {
+        pAllocations[index] = dMalloc_r( 100, pFileName, 1 );
+    }
+
+    // Check.
+    Memory::CallsiteStats stats;
+    ASSERT_TRUE( findCallsiteStats( pFileName, 1, stats ) ) << "Callsite not found.";
+    ASSERT_EQ( 1000, stats.liveBytes ) << "Callsite live bytes are incorrect.";
+    ASSERT_EQ( 10, stats.liveCount ) << "Callsite live count is incorrect.";
+    ASSERT_EQ( 1000, stats.liveBytesChange ) << "Callsite change since the snapshot is incorrect.";
+
+    // Reallocation keeps the callsite of the reallocation.
+    pAllocations[0] = dRealloc_r( pAllocations[0], 200, pFileName, 2 );
+    ASSERT_TRUE( findCallsiteStats( pFileName, 1, stats ) ) << "Callsite not found.";
+    ASSERT_EQ( 900, stats.liveBytes ) << "Callsite live bytes are incorrect after reallocation.";
+    ASSERT_TRUE( findCallsiteStats( pFileName, 2, stats ) ) << "Reallocation callsite not found.";
+    ASSERT_EQ( 200, stats.liveBytes ) << "Reallocation callsite live bytes are incorrect.";
+
+    // Free.
+    for ( U32 index = 0; index < 10; ++index )
+    {
+        dFree( pAllocations[index] );
+    }
+
+    ASSERT_TRUE( findCallsiteStats( pFileName, 1, stats ) ) << "Callsite not found.";
+    ASSERT_EQ( 0, stats.liveBytes ) << "Callsite live bytes are incorrect after freeing.";
+    ASSERT_EQ( 0, stats.liveCount ) << "Callsite live count is incorrect after freeing.";
+    ASSERT_EQ( 10u, stats.allocationsChange ) << "Callsite allocations since the snapshot are incorrect.";
+}
+
+#endif // TORQUE_MEMORY_TRACKING
+
 #endif // TORQUE_SHIPPING
@@ -0,0 +1,104 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREADPOOL_H_
+#include "platform/threads/threadPool.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define PLATFORM_UNITTEST_THREADPOOL_ITEMCOUNT     10000
+
+//-----------------------------------------------------------------------------
+
+static void threadPoolTestRangeFunction( void* pContext, const U32 start, const U32 end )
+{
+    U32* pItems = static_cast<U32*>( pContext );
+
+    for ( U32 index = start; index < end; ++index )
+    {
+        pItems[index] += index;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( PlatformThreadPoolTests, parallelForTest )
+{
+    // Create a pool.
+    ThreadPool threadPool( 3 );
+
+    // Check workers.
+    ASSERT_EQ( (U32)3, threadPool.getWorkerCount() ) << "Incorrect worker count.";
+
+    // Clear the items.
+    U32* pItems = new U32[PLATFORM_UNITTEST_THREADPOOL_ITEMCOUNT];
+    dMemset( pItems, 0, sizeof(U32) * PLATFORM_UNITTEST_THREADPOOL_ITEMCOUNT );
+
+    // Process the items several times.
+    for ( U32 pass = 0; pass < 4; ++pass )
+    {
+        threadPool.parallelFor( threadPoolTestRangeFunction, pItems, PLATFORM_UNITTEST_THREADPOOL_ITEMCOUNT, 64 );
+    }
+
+    // Check each item was processed exactly once per pass.
+    for ( U32 index = 0; index < PLATFORM_UNITTEST_THREADPOOL_ITEMCOUNT; ++index )
+    {
+        ASSERT_EQ( index * 4, pItems[index] ) << "Item processed incorrectly.";
+    }
+
+    delete [] pItems;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( PlatformThreadPoolTests, noWorkersTest )
+{
+    // Create a pool without workers.
+    ThreadPool threadPool( 0 );
+
+    // Clear the items.
+    U32 items[256];
+    dMemset( items, 0, sizeof(items) );
+
+    // Process the items on the calling thread.
+    threadPool.parallelFor( threadPoolTestRangeFunction, items, 256, 16 );
+
+    // Check each item was processed.
+    for ( U32 index = 0; index < 256; ++index )
+    {
+        ASSERT_EQ( index, items[index] ) << "Item processed incorrectly.";
+    }
+}
+
+#endif // TORQUE_SHIPPING
@@ -87,6 +87,15 @@
 /// When defined, Torque will attempt to make select systems thread-safe.  This does not
 /// make the entire engine thread-safe nor is it a magic bullet that will make the engine
 /// perform operations in parallel and speed-up the engine.
+///
+/// 'TORQUE_DISABLE_MEMORY_MANAGER'
+/// When defined, the global operator new and delete are not routed through the engine
+/// allocator so only dMalloc() allocations are included in the memory tag statistics.
+///
+/// 'TORQUE_MEMORY_TRACKING'
+/// When defined, live allocations and allocation rates are aggregated per callsite so leaks
+/// and allocation hotspots can be found with memSnapshot(), memDiff() and memDumpCallsites().
+/// This adds a lock to every allocation so is intended for debugging and profiling builds.
 
 #endif
 
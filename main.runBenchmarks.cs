@@ -0,0 +1,211 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// Runs each of the benchmark toys for a fixed number of frames and writes the results to a file.
+//
+// Run the engine with this file as the main script:
+//
+//     Torque2D main.runBenchmarks.cs
+//
+// Time is advanced by a fixed step every frame and the random seed is reset before each toy is
+// loaded so every run simulates the same frames.  The frame stats are gathered over the measured
+// frames of each toy and appended as a line of comma separated values to the output file so the
+// results of different builds can be compared.
+
+// Set log mode.
+setLogMode(2);
+
+// Controls whether the execution or script files or compiled DSOs are echoed to the console or not.
+// Being able to turn this off means far less spam in the console during typical development.
+setScriptExecEcho( false );
+
+// Controls whether all script execution is traced (echoed) to the console or not.
+trace( false );
+
+// Sets whether to ignore compiled TorqueScript files (DSOs) or not.
+$Scripts::ignoreDSOs = true;
+
+setCompanyAndProduct("GarageGames", "Torque 2D" );
+
+//-----------------------------------------------------------------------------
+
+// The toys to run.
+$Benchmark::Toys = "SpriteStressToy PyramidToy TumblerToy CompositeSpriteToy AquariumToy";
+
+// The random seed each toy is started with.
+$Benchmark::Seed = 1234;
+
+// Milliseconds the simulation is advanced each frame.
+$Benchmark::FrameStep = 16;
+
+// Frames to let each toy settle before measuring.
+$Benchmark::WarmupFrames = 60;
+
+// Frames to measure (the frame stats hold the most recent 256 frames).
+$Benchmark::MeasureFrames = 240;
+
+// The file the results are written to.
+$Benchmark::OutputFile = "benchmarkResults.csv";
+
+//-----------------------------------------------------------------------------
+
+function startBenchmarks()
+{
+    // Advance time by a fixed step each frame so that the toys are deterministic.
+    $timeAdvance = $Benchmark::FrameStep;
+
+    // Write the header if the results file is new.
+    if ( !isFile( $Benchmark::OutputFile ) )
+    {
+        %file = new FileObject();
+        if ( %file.openForWrite( $Benchmark::OutputFile ) )
+        {
+            %header = "time,toy,seed,frames";
+            %header = %header @ ",frameTimeP50,frameTimeP95,frameTimeP99,frameTimeMax";
+            %header = %header @ ",simTimeP50,simTimeP95,simTimeP99,simTimeMax";
+            %header = %header @ ",renderTimeP50,renderTimeP95,renderTimeP99,renderTimeMax";
+            %header = %header @ ",drawCallsP50,batchFlushesP50,trianglesP50,tickedObjectsP50,contactsP50,particlesP50,allocationsP50";
+            %header = %header @ ",sceneObjects,liveBytes";
+            %file.writeLine( %header );
+        }
+        %file.delete();
+    }
+
+    $Benchmark::ToyIndex = 0;
+    runNextBenchmark();
+}
+
+//-----------------------------------------------------------------------------
+
+function runNextBenchmark()
+{
+    // Finish once all the toys have run.
+    if ( $Benchmark::ToyIndex >= getWordCount( $Benchmark::Toys ) )
+    {
+        echo( "Benchmarks complete, results written to '" @ $Benchmark::OutputFile @ "'." );
+        quit();
+        return;
+    }
+
+    %toyId = getWord( $Benchmark::Toys, $Benchmark::ToyIndex );
+    $Benchmark::ToyIndex++;
+
+    // Find the toy.
+    %toyDefinition = ModuleDatabase.findModule( %toyId, 1 );
+    if ( !isObject( %toyDefinition ) )
+    {
+        error( "Benchmark: Cannot find the toy '" @ %toyId @ "', skipping." );
+        runNextBenchmark();
+        return;
+    }
+
+    echo( "Benchmark: Running '" @ %toyId @ "'..." );
+
+    // Load the toy with a fixed seed.
+    setRandomSeed( $Benchmark::Seed );
+    loadToy( %toyDefinition );
+
+    // Measure once the toy has settled.
+    schedule( $Benchmark::WarmupFrames * $Benchmark::FrameStep, 0, "measureBenchmark", %toyId );
+}
+
+//-----------------------------------------------------------------------------
+
+function measureBenchmark( %toyId )
+{
+    resetFrameStats();
+
+    schedule( $Benchmark::MeasureFrames * $Benchmark::FrameStep, 0, "finishBenchmark", %toyId );
+}
+
+//-----------------------------------------------------------------------------
+
+function finishBenchmark( %toyId )
+{
+    %result = getLocalTime() @ "," @ %toyId @ "," @ $Benchmark::Seed @ "," @ getFrameStatsCount();
+
+    // Time percentiles.
+    %stats = "frameTime simTime renderTime";
+    %statCount = getWordCount( %stats );
+    for ( %i = 0; %i < %statCount; %i++ )
+    {
+        %stat = getWord( %stats, %i );
+        %result = %result @ "," @ getFrameStat( %stat, 50 ) @ "," @ getFrameStat( %stat, 95 ) @ "," @ getFrameStat( %stat, 99 ) @ "," @ getFrameStat( %stat, 100 );
+    }
+
+    // Work medians.
+    %stats = "drawCalls batchFlushes triangles tickedObjects contacts particles allocations";
+    %statCount = getWordCount( %stats );
+    for ( %i = 0; %i < %statCount; %i++ )
+    {
+        %result = %result @ "," @ getFrameStat( getWord( %stats, %i ), 50 );
+    }
+
+    // Object count and memory.
+    %liveBytes = 0;
+    %tagCount = getMemoryTagCount();
+    for ( %i = 0; %i < %tagCount; %i++ )
+    {
+        %liveBytes += getWord( getMemoryTagStats( getMemoryTagName( %i ) ), 0 );
+    }
+    %result = %result @ "," @ SandboxScene.getSceneObjectCount() @ "," @ %liveBytes;
+
+    // Append the result.
+    %file = new FileObject();
+    if ( %file.openForAppend( $Benchmark::OutputFile ) )
+        %file.writeLine( %result );
+    else
+        error( "Benchmark: Cannot write to '" @ $Benchmark::OutputFile @ "'." );
+    %file.delete();
+
+    echo( "Benchmark: " @ %result );
+
+    runNextBenchmark();
+}
+
+//-----------------------------------------------------------------------------
+
+// Set module database information echo.
+ModuleDatabase.EchoInfo = false;
+
+// Set asset database information echo.
+AssetDatabase.EchoInfo = false;
+
+// Set the asset manager to ignore any auto-unload assets.
+AssetDatabase.IgnoreAutoUnload = true;
+
+// Scan modules.
+ModuleDatabase.scanModules( "modules" );
+
+// Load AppCore module.
+ModuleDatabase.LoadExplicit( "AppCore" );
+
+// Start the benchmarks once the sandbox is running.
+schedule( 1000, 0, "startBenchmarks" );
+
+//-----------------------------------------------------------------------------
+
+function onExit()
+{
+    // Unload the AppCore module.
+    ModuleDatabase.unloadExplicit( "AppCore" );
+}
@@ -28,15 +28,19 @@ function AppCore::create( %this )
     exec("./scripts/canvas.cs");
     exec("./scripts/openal.cs");
     
-    // Initialize the canvas
-    initializeCanvas("Torque 2D");
-    
-    // Set the canvas color
-    Canvas.BackgroundColor = "CornflowerBlue";
-    Canvas.UseBackgroundColor = true;
-    
-    // Initialize audio
-    initializeOpenAL();
+    // A headless server only simulates so has no canvas or audio
+    if ( !isHeadless() )
+    {
+        // Initialize the canvas
+        initializeCanvas("Torque 2D");
+        
+        // Set the canvas color
+        Canvas.BackgroundColor = "CornflowerBlue";
+        Canvas.UseBackgroundColor = true;
+        
+        // Initialize audio
+        initializeOpenAL();
+    }
     
     ModuleDatabase.loadGroup("gameBase");
 }